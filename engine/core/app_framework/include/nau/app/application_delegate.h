@@ -9,6 +9,7 @@
 #include <chrono>
 
 #include "nau/app/application_init_delegate.h"
+#include "nau/app/application_profile.h"
 #include "nau/async/task_base.h"
 #include "nau/utils/result.h"
 
@@ -24,6 +25,13 @@ namespace nau
          */
         virtual eastl::string getModulesListString() const = 0;
 
+        /**
+            @brief the profile of the application (the modules and the presentation services).
+                By default it is read from the "/app/profile" global property (see readApplicationProfile),
+                so must not be called before configureApplication.
+         */
+        virtual ApplicationProfile getApplicationProfile() const;
+
         /**
          */
         virtual Result<> initializeServices() = 0;
@@ -0,0 +1,92 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <EASTL/string.h>
+#include <EASTL/vector.h>
+
+#include "nau/meta/class_info.h"
+
+namespace nau
+{
+    /**
+        The declarative description of what the application brings up: the modules and the presentation services.
+
+        The profile is taken from ApplicationDelegate::getApplicationProfile (by default from the "/app/profile" global property),
+        for example the dedicated server config:
+        @code
+            "app": {
+                "profile": {
+                    "name": "server",
+                    "excludeModules": ["PlatformApp", "CoreInput", "Graphics", "GraphicsAssets", "Render", "DebugRenderer", "VFX", "ui", "Audio"],
+                    "headless": true,
+                    "imgui": false,
+                    "tickRate": 60,
+                    "simulationCores": [2, 3]
+                }
+            }
+        @endcode
+     */
+    struct ApplicationProfile
+    {
+        eastl::string name;
+
+        /**
+            Comma separated modules list which replaces the delegate list (see ApplicationDelegate::getModulesListString) when not empty.
+         */
+        eastl::string modules;
+
+        /**
+            The modules (case insensitive) which are removed from the modules list.
+         */
+        eastl::vector<eastl::string> excludeModules;
+
+        /**
+            The platform window service is not created and the window is not shown.
+         */
+        bool headless = false;
+
+        /**
+            The imgui state is not updated and the imgui render data is not cached on the game step.
+         */
+        bool imgui = true;
+
+        /**
+            The fixed number of the game steps per second: the step is paced and the step delta time is constant.
+            0 means the step is not paced and the delta time is measured.
+         */
+        uint32_t tickRate = 0;
+
+        /**
+            The logical cores to which the main (simulation) thread is pinned, empty means no pinning.
+         */
+        eastl::vector<uint32_t> simulationCores;
+
+        NAU_CLASS_FIELDS(
+            CLASS_FIELD(name),
+            CLASS_FIELD(modules),
+            CLASS_FIELD(excludeModules),
+            CLASS_FIELD(headless),
+            CLASS_FIELD(imgui),
+            CLASS_FIELD(tickRate),
+            CLASS_FIELD(simulationCores))
+    };
+
+    /**
+        The profile of the dedicated server: only simulation, physics, scripts and network at the fixed tick rate.
+     */
+    ApplicationProfile makeServerApplicationProfile(uint32_t tickRate = 60);
+
+    /**
+        Reads the profile from the "/app/profile" global property, the default (full) profile if the property is not defined.
+     */
+    ApplicationProfile readApplicationProfile();
+
+    /**
+        Applies the profile module overrides to the modules list.
+     */
+    eastl::string applyApplicationProfileModules(const ApplicationProfile& profile, eastl::string_view modulesList);
+
+}  // namespace nau
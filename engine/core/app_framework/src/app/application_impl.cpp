@@ -4,10 +4,13 @@
 
 #include "./application_impl.h"
 
+#include "nau/app/application_profile.h"
 #include "nau/diag/device_error.h"
 #include "nau/service/internal/service_provider_initialization.h"
 #include "nau/service/service_provider.h"
+#include "nau/threading/thread_affinity.h"
 #include "nau/ui.h"
+#include "nau/utils/performance_profiling.h"
 
 
 namespace nau
@@ -19,6 +22,12 @@ namespace nau
 
         m_moduleManager->doModulesPhase(IModuleManager::ModulesPhase::Init);
         getServiceProvider().addService<MainLoopService>();
+
+        if (auto sessionRecorder = SessionRecorderImpl::create())
+        {
+            m_sessionRecorder = sessionRecorder.get();
+            getServiceProvider().addService(std::move(sessionRecorder));
+        }
     }
 
     ApplicationImpl::~ApplicationImpl()
@@ -80,6 +89,8 @@ namespace nau
 
         m_mainLoop = &serviceProvider.get<MainLoopService>();
 
+        applyApplicationProfile();
+
         if (getServiceProvider().has<ui::UiManager>())
         {
             m_uiManager = &getServiceProvider().get<ui::UiManager>();
@@ -98,7 +109,7 @@ namespace nau
         NAU_ASSERT(m_hostThreadId == std::thread::id{});
 
         m_hostThreadId = std::this_thread::get_id();
-        m_appWorkQueue = WorkQueue::create();
+        m_appWorkQueue = WorkQueue::create(WorkQueueMode::Mpsc);
         m_appWorkQueue->setName("App Work Queue");
 
         async::Executor::setThisThreadExecutor(m_appWorkQueue);
@@ -121,8 +132,24 @@ namespace nau
             return false;
         }
 
-        const float dt = m_tickStopwatch.tick();
-        m_appWorkQueue->poll();
+        NAU_CPU_SCOPED_TAG(nau::PerfTag::Core);
+
+        float dt = m_fixedTickInterval.count() > 0 ? waitFixedTick() : m_tickStopwatch.tick();
+        {
+            NAU_CPU_SCOPED_TAG_NAME("PollAppWorkQueue", nau::PerfTag::Core);
+            m_appWorkQueue->poll();
+        }
+
+        if (m_sessionRecorder && m_appState == AppState::Active)
+        {
+            // The recorded/replayed session runs with the fixed timestep
+            dt = m_sessionRecorder->beginFrame();
+            if (m_sessionRecorder->isReplayCompleted())
+            {
+                NAU_LOG("The session replay is completed");
+                stop();
+            }
+        }
 
         if (m_appState == AppState::Active)
         {
@@ -188,6 +215,46 @@ namespace nau
         shutdownCoreServices();
     }
 
+    void ApplicationImpl::applyApplicationProfile()
+    {
+        const ApplicationProfile profile = readApplicationProfile();
+
+        if (!profile.simulationCores.empty())
+        {
+            // The game step (simulation) is running on the application thread.
+            if (!threading::setThisThreadAffinity(profile.simulationCores))
+            {
+                NAU_LOG_WARNING("Fail to pin the simulation thread to the cores of the application profile ({})", profile.name);
+            }
+        }
+
+        if (profile.tickRate > 0)
+        {
+            using namespace std::chrono;
+
+            m_fixedTickInterval = duration_cast<steady_clock::duration>(duration<double>{1.0 / profile.tickRate});
+            m_nextTickTime = steady_clock::now();
+        }
+    }
+
+    float ApplicationImpl::waitFixedTick()
+    {
+        using namespace std::chrono;
+
+        NAU_CPU_SCOPED_TAG_NAME("WaitFixedTick", nau::PerfTag::Core);
+
+        std::this_thread::sleep_until(m_nextTickTime);
+        m_nextTickTime += m_fixedTickInterval;
+
+        // Do not try to catch up after a long stall (e.g. the debugger break): the ticks are skipped instead.
+        if (const auto now = steady_clock::now(); now > m_nextTickTime + m_fixedTickInterval)
+        {
+            m_nextTickTime = now;
+        }
+
+        return duration_cast<duration<float>>(m_fixedTickInterval).count();
+    }
+
     void ApplicationImpl::mainGameStep(float dt)
     {
         NAU_FATAL(m_mainLoop);
@@ -4,6 +4,7 @@
 
 #include "./logging_service.h"
 #include "./main_loop/main_loop_service.h"
+#include "./session_recorder_impl.h"
 #include "nau/app/application.h"
 #include "nau/app/main_loop/game_system.h"
 #include "nau/async/work_queue.h"
@@ -68,6 +69,10 @@ namespace nau
 
         void mainGameStep(float dt);
 
+        void applyApplicationProfile();
+
+        float waitFixedTick();
+
         RuntimeState::Ptr m_runtime = RuntimeState::create();
         IModuleManager::Ptr m_moduleManager = createModuleManager();
         WorkQueue::Ptr m_appWorkQueue;
@@ -76,6 +81,7 @@ namespace nau
         std::atomic<AppState> m_appState = AppState::Active;
 
         MainLoopService* m_mainLoop = nullptr;
+        SessionRecorderImpl* m_sessionRecorder = nullptr;
 
         ui::UiManager* m_uiManager = nullptr;
         vfx::VFXManager* m_vfxManager = nullptr;
@@ -83,5 +89,9 @@ namespace nau
         async::Task<> m_shutdownTask;
         Functor<bool()> m_runtimeShutdown;
         nau::TickStopwatch m_tickStopwatch;
+
+        // Fixed tick rate (see ApplicationProfile::tickRate): zero interval means the step is not paced.
+        std::chrono::steady_clock::duration m_fixedTickInterval{};
+        std::chrono::steady_clock::time_point m_nextTickTime;
     };
 }  // namespace nau
@@ -190,7 +190,7 @@ namespace nau
                     NAU_ASSERT(fs::is_regular_file(mountPath));
 
                     io::IFileSystem::Ptr packFs = io::createAssetPackFileSystem(utf8Path);
-                    vfs.mount(mount.mountPoint, std::move(packFs)).ignore();
+                    vfs.mount(mount.mountPoint, std::move(packFs), 1, io::MountTrust::Trusted).ignore();
                 }
             }
 
@@ -0,0 +1,72 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "nau/app/application_profile.h"
+
+#include <EASTL/algorithm.h>
+
+#include "nau/app/global_properties.h"
+#include "nau/string/string_utils.h"
+
+namespace nau
+{
+    ApplicationProfile makeServerApplicationProfile(uint32_t tickRate)
+    {
+        ApplicationProfile profile;
+        profile.name = "server";
+        profile.excludeModules = {"PlatformApp", "CoreInput", "Graphics", "GraphicsAssets", "Render", "DebugRenderer", "VFX", "ui", "Audio"};
+        profile.headless = true;
+        profile.imgui = false;
+        profile.tickRate = tickRate;
+
+        return profile;
+    }
+
+    ApplicationProfile readApplicationProfile()
+    {
+        GlobalProperties* const props = getServiceProvider().find<GlobalProperties>();
+        if (!props)
+        {
+            return {};
+        }
+
+        return props->getValue<ApplicationProfile>("/app/profile").value_or(ApplicationProfile{});
+    }
+
+    eastl::string applyApplicationProfileModules(const ApplicationProfile& profile, eastl::string_view modulesList)
+    {
+        const eastl::string_view sourceList = profile.modules.empty() ? modulesList : eastl::string_view{profile.modules};
+
+        eastl::string result;
+        for (const eastl::string_view moduleName : strings::split(sourceList, eastl::string_view{","}))
+        {
+            const eastl::string_view name = strings::trim(moduleName);
+            if (name.empty())
+            {
+                continue;
+            }
+
+            const bool isExcluded = eastl::any_of(profile.excludeModules.begin(), profile.excludeModules.end(), [name](const eastl::string& excludedName)
+            {
+                return strings::icaseEqual(name, eastl::string_view{excludedName});
+            });
+
+            if (isExcluded)
+            {
+                NAU_LOG("Module ({}) is excluded by the application profile ({})", eastl::string{name}, profile.name);
+                continue;
+            }
+
+            if (!result.empty())
+            {
+                result.append(",");
+            }
+
+            result.append(name.data(), name.size());
+        }
+
+        return result;
+    }
+
+}  // namespace nau
@@ -79,7 +79,8 @@ namespace nau
                     continue;
                 }
 
-                if (strings::icaseEqual(entry.path().extension().wstring(), L".json"))
+                // ".roblk" are the configs cooked by the build
+                if (strings::icaseEqual(entry.path().extension().wstring(), L".json") || strings::icaseEqual(entry.path().extension().wstring(), L".roblk"))
                 {
                     NauCheckResult(mergePropertiesFromFile(globalProperties, entry.path()));
                 }
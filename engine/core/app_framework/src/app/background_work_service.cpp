@@ -3,8 +3,14 @@
 
 #include "nau/app/background_work_service.h"
 
+#include <EASTL/array.h>
 #include <EASTL/unique_ptr.h>
 
+#include <algorithm>
+#include <mutex>
+
+#include "nau/app/global_properties.h"
+#include "nau/async/thread_pool_executor.h"
 #include "nau/async/work_queue.h"
 #include "nau/runtime/internal/runtime_component.h"
 #include "nau/service/service.h"
@@ -59,12 +65,67 @@ namespace nau
         }
 
     private:
-        async::Executor::Ptr getExecutor() override
+        struct LaneConfig
+        {
+            std::string_view name;
+            eastl::string_view threadsProperty;
+            size_t defaultThreadsCount;
+            async::ThreadPoolMode mode;
+        };
+
+        static constexpr size_t LanesCount = static_cast<size_t>(BackgroundWorkPriority::BlockingIo) + 1;
+
+        /**
+         * The lanes (except the Normal one) are created on the first request:
+         * the configuration ("/backgroundWork/...Threads") is not available when the service is constructed.
+         */
+        static LaneConfig getLaneConfig(BackgroundWorkPriority priority)
+        {
+            const size_t cpuCount = std::max(static_cast<size_t>(std::thread::hardware_concurrency()), size_t{1});
+
+            switch (priority)
+            {
+                case BackgroundWorkPriority::LatencyCritical:
+                    return {"Nau Background Work (Critical)", "/backgroundWork/latencyCriticalThreads", std::max(cpuCount / 4, size_t{1}), async::ThreadPoolMode::WorkStealing};
+                case BackgroundWorkPriority::Background:
+                    return {"Nau Background Work (Low)", "/backgroundWork/backgroundThreads", std::max(cpuCount / 4, size_t{1}), async::ThreadPoolMode::SharedQueue};
+                case BackgroundWorkPriority::BlockingIo:
+                    return {"Nau Background Work (IO)", "/backgroundWork/blockingIoThreads", std::max(cpuCount, size_t{4}), async::ThreadPoolMode::SharedQueue};
+                default:
+                    NAU_FAILURE("Unexpected lane");
+                    return {};
+            }
+        }
+
+        async::Executor::Ptr getExecutor(BackgroundWorkPriority priority) override
         {
-            return m_workQueue;
+            if (priority == BackgroundWorkPriority::Normal)
+            {
+                return m_workQueue;
+            }
+
+            const std::lock_guard lock(m_lanesMutex);
+
+            async::Executor::Ptr& executor = m_lanes[static_cast<size_t>(priority)];
+            if (!executor)
+            {
+                const LaneConfig config = getLaneConfig(priority);
+                size_t threadsCount = config.defaultThreadsCount;
+                if (hasServiceProvider() && getServiceProvider().has<GlobalProperties>())
+                {
+                    const auto value = getServiceProvider().get<GlobalProperties>().getValue<unsigned>(config.threadsProperty);
+                    threadsCount = value ? std::max(static_cast<size_t>(*value), size_t{1}) : threadsCount;
+                }
+
+                executor = async::createThreadPoolExecutor(config.name, threadsCount, config.mode);
+            }
+
+            return executor;
         }
 
         WorkQueue::Ptr m_workQueue = WorkQueue::create();
+        eastl::array<async::Executor::Ptr, LanesCount> m_lanes;
+        std::mutex m_lanesMutex;
         std::thread m_thread;
         std::atomic<bool> m_isAlive = true;
         std::atomic<bool> m_isCompleted = false;
@@ -52,6 +52,11 @@ namespace nau
 
         void onApplicationInitialized() override
         {
+            if (readApplicationProfile().headless)
+            {
+                return;
+            }
+
             auto& windowService = getServiceProvider().get<IWindowManager>();
             auto& window = windowService.getActiveWindow();
             window.setVisible(true);
@@ -112,7 +117,7 @@ namespace nau
                     {
                         const auto& filePath = entry.path();
                         auto assetPackFS = io::createAssetPackFileSystem(strings::toU8StringView(filePath.string()));
-                        vfs.mount("/packs", assetPackFS).ignore();
+                        vfs.mount("/packs", assetPackFS, 1, io::MountTrust::Trusted).ignore();
                         assetDb.addAssetDB("packs/assets_database/database.db");
                     }
                 }
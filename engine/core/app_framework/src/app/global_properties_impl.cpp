@@ -49,12 +49,56 @@ namespace nau
 
     RuntimeValue::Ptr GlobalPropertiesImpl::findValueAtPath(eastl::string_view valuePath) const
     {  // BE AWARE: findValueAtPath requires m_mutex lock !
-        if (!m_propsRoot)
+        if (m_cookedPropsRoots.empty())
         {
-            return nullptr;
+            return m_propsRoot ? findValueAtPath(m_propsRoot, valuePath) : nullptr;
         }
 
-        RuntimeValue::Ptr current = m_propsRoot;
+        // The layers: from the earliest cooked properties to the properties set at runtime.
+        RuntimeValue::Ptr result;
+        RuntimeDictionary::Ptr mergedDictionary;
+
+        const auto applyLayer = [&result, &mergedDictionary](RuntimeValue::Ptr value)
+        {
+            if (!value)
+            {
+                return;
+            }
+
+            if (!result || !result->is<RuntimeReadonlyDictionary>() || !value->is<RuntimeReadonlyDictionary>())
+            {
+                result = std::move(value);
+                mergedDictionary.reset();
+                return;
+            }
+
+            // Both layers have the dictionary: the merged copy is built for the requested sub-tree only.
+            if (!mergedDictionary)
+            {
+                mergedDictionary = serialization::jsonCreateDictionary();
+                RuntimeValue::assign(mergedDictionary, result, ValueAssignOption::MergeCollection).ignore();
+                result = mergedDictionary;
+            }
+
+            RuntimeValue::assign(mergedDictionary, value, ValueAssignOption::MergeCollection).ignore();
+        };
+
+        for (const RuntimeReadonlyDictionary::Ptr& cookedRoot : m_cookedPropsRoots)
+        {
+            applyLayer(findValueAtPath(cookedRoot, valuePath));
+        }
+
+        if (m_propsRoot)
+        {
+            applyLayer(findValueAtPath(m_propsRoot, valuePath));
+        }
+
+        return result;
+    }
+
+    RuntimeValue::Ptr GlobalPropertiesImpl::findValueAtPath(RuntimeValue::Ptr root, eastl::string_view valuePath)
+    {
+        RuntimeValue::Ptr current = std::move(root);
 
         for (eastl::string_view propName : strings::split(valuePath, eastl::string_view{"/"}))
         {
@@ -261,6 +305,23 @@ namespace nau
         return RuntimeValue::assign(m_propsRoot, nau::Ptr{&const_cast<RuntimeValue&>(value)}, ValueAssignOption::MergeCollection);
     }
 
+    void GlobalPropertiesImpl::addCookedProperties(RoDataBlockPtr properties)
+    {
+        NAU_ASSERT(properties);
+        if (!properties)
+        {
+            return;
+        }
+
+        auto cookedRoot = wrapRoDataBlock(std::move(properties), nullptr, [this](eastl::string_view str)
+        {
+            return expandConfigString(str);
+        });
+
+        lock_(m_mutex);
+        m_cookedPropsRoots.emplace_back(std::move(cookedRoot));
+    }
+
     void GlobalPropertiesImpl::addVariableResolver(eastl::string_view kind, VariableResolverCallback resolver)
     {
         NAU_ASSERT(!kind.empty());
@@ -285,6 +346,14 @@ namespace nau
 
             return properties.mergeWithValue(**parseResult);
         }
+        else if (strings::icaseEqual(contentType, CookedPropertiesContentType))
+        {
+            Result<RoDataBlockPtr> loadResult = loadRoDataBlock(stream);
+            NauCheckResult(loadResult)
+
+            properties.addCookedProperties(*std::move(loadResult));
+            return ResultSuccess;
+        }
         else
         {
             return NauMakeError("Unknown config's content type:({})", contentType);
@@ -309,6 +378,10 @@ namespace nau
             {
                 contentType = "application/json";
             }
+            else if (strings::icaseEqual(std::wstring_view{filePath.extension().c_str()}, std::wstring_view{L".roblk"}))
+            {
+                contentType = CookedPropertiesContentType;
+            }
             else
             {
                 return NauMakeError("Can not determine file's content type:({})", filePath.string());
@@ -30,16 +30,21 @@ namespace nau
 
         Result<> mergeWithValue(const RuntimeValue& value) override;
 
+        void addCookedProperties(RoDataBlockPtr properties) override;
+
         void addVariableResolver(eastl::string_view kind, VariableResolverCallback resolver) override;
 
     private:
         RuntimeValue::Ptr findValueAtPath(eastl::string_view valuePath) const;
 
+        static RuntimeValue::Ptr findValueAtPath(RuntimeValue::Ptr root, eastl::string_view valuePath);
+
         Result<RuntimeDictionary::Ptr> getDictionaryAtPath(eastl::string_view valuePath, bool createPath = true);
 
         eastl::optional<eastl::string> expandConfigString(eastl::string_view str) const;
 
         RuntimeDictionary::Ptr m_propsRoot;
+        eastl::vector<RuntimeReadonlyDictionary::Ptr> m_cookedPropsRoots; /** < The latest cooked properties are the last. */
         std::map<eastl::string, VariableResolverCallback, strings::CiStringComparer<eastl::string_view>> m_variableResolvers;
         mutable std::shared_mutex m_mutex;
     };
@@ -23,7 +23,7 @@ namespace nau
         m_logSubscriptions.reserve(2);
 
         m_logSubscriptions.push_back(getLogger().subscribe(createDebugOutputLogSubscriber()));
-        m_logSubscriptions.push_back(getLogger().subscribe(createConioOutputLogSubscriber()));
+        m_logSubscriptions.push_back(getLogger().subscribe(createDeferredLogSubscriber(createConioOutputLogSubscriber())));
     }
 
     LoggingService::~LoggingService()
@@ -35,7 +35,7 @@ namespace nau
     void LoggingService::addFileOutput(eastl::string_view filename)
     {
         using namespace nau::diag;
-        m_logSubscriptions.push_back(getLogger().subscribe(createFileOutputLogSubscriber(filename)));
+        m_logSubscriptions.push_back(getLogger().subscribe(createDeferredLogSubscriber(createFileOutputLogSubscriber(filename))));
     }
 
     async::Task<> LoggingService::shutdownService()
@@ -6,12 +6,14 @@
 
 #include "nau/app/application.h"
 #include "nau/app/application_services.h"
+#include "nau/app/global_properties.h"
 #include "nau/app/core_window_manager.h"
 #include "nau/app/main_loop/game_system.h"
 #include "nau/app/platform_window.h"
 #include "nau/input.h"
 #include "nau/module/module_manager.h"
 #include "nau/rtti/rtti_impl.h"
+#include "nau/utils/performance_profiling.h"
 
 namespace nau
 {
@@ -65,16 +67,29 @@ namespace nau
     {
     }
 
+    ApplicationProfile ApplicationDelegate::getApplicationProfile() const
+    {
+        return readApplicationProfile();
+    }
+
     Result<> ApplicationDelegate::initializeApplication()
     {
+        const ApplicationProfile profile = getApplicationProfile();
+
+        // The engine services (the application and the main loop) read the active profile from the properties.
+        NauCheckResult(getServiceProvider().get<GlobalProperties>().setValue("/app/profile", profile));
+
 #if !defined(NAU_STATIC_RUNTIME)
-        const eastl::string moduleList = getModulesListString();
+        const eastl::string moduleList = applyApplicationProfileModules(profile, getModulesListString());
         if (!moduleList.empty())
         {
             NauCheckResult(loadModulesList(moduleList));
         }
 #endif
-        getServiceProvider().addService(createPlatformWindowService());
+        if (!profile.headless)
+        {
+            getServiceProvider().addService(createPlatformWindowService());
+        }
 
         getServiceProvider().addService(eastl::make_unique<DelegateLoop>(*this));
 
@@ -92,15 +107,24 @@ namespace nau
         }
 
         app->startupOnCurrentThread();
-        getServiceProvider().get<IWindowManager>().getActiveWindow().setVisible(true);
+        if (!readApplicationProfile().headless)
+        {
+            getServiceProvider().get<IWindowManager>().getActiveWindow().setVisible(true);
+        }
 
         appDelegate->onApplicationInitialized();
         getServiceProvider().get<DelegateLoop>().startupAppDelegate();
 
+        bool isFirstFrame = true;
         while (app->step())
         {
-// TODO Tracy            NAU_CPU_SCOPED;
-// TODO Tracy            NAU_PROFILING_FRAME_END;
+            NAU_PROFILING_FRAME_END;
+
+            if (eastl::exchange(isFirstFrame, false))
+            {
+                // The modules which are not requested by the startup are loaded while the application is already running.
+                startLazyModulesPreload();
+            }
         }
 
         return 0;
@@ -0,0 +1,394 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "./session_recorder_impl.h"
+
+#include <EASTL/sort.h>
+
+#include <filesystem>
+
+#include "nau/app/global_properties.h"
+#include "nau/io/file_system.h"
+#include "nau/serialization/json.h"
+#include "nau/serialization/runtime_value_builder.h"
+
+namespace nau
+{
+    namespace
+    {
+        constexpr char RecordingMagic[8] = {'N', 'A', 'U', 'S', 'R', 'E', 'C', '\0'};
+        constexpr uint32_t RecordingVersion = 1;
+
+        struct SessionTimingsSummary
+        {
+            eastl::string mode;
+            eastl::string recording;
+            float fixedTimestep = 0.f;
+            uint32_t frames = 0;
+            float averageMs = 0.f;
+            float medianMs = 0.f;
+            float p95Ms = 0.f;
+            float p99Ms = 0.f;
+            float maxMs = 0.f;
+
+            NAU_CLASS_FIELDS(
+                CLASS_FIELD(mode),
+                CLASS_FIELD(recording),
+                CLASS_FIELD(fixedTimestep),
+                CLASS_FIELD(frames),
+                CLASS_FIELD(averageMs),
+                CLASS_FIELD(medianMs),
+                CLASS_FIELD(p95Ms),
+                CLASS_FIELD(p99Ms),
+                CLASS_FIELD(maxMs))
+        };
+
+        template <typename T>
+        void appendValue(eastl::string& buffer, T value)
+        {
+            buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        template <typename T>
+        bool readValue(eastl::string_view& data, T& value)
+        {
+            if (data.size() < sizeof(T))
+            {
+                return false;
+            }
+
+            memcpy(&value, data.data(), sizeof(T));
+            data.remove_prefix(sizeof(T));
+            return true;
+        }
+
+        bool readBytes(eastl::string_view& data, size_t size, eastl::string_view& bytes)
+        {
+            if (data.size() < size)
+            {
+                return false;
+            }
+
+            bytes = data.substr(0, size);
+            data.remove_prefix(size);
+            return true;
+        }
+
+        Result<> writeText(io::IStreamWriter& stream, eastl::string_view text)
+        {
+            NauCheckResult(stream.write(reinterpret_cast<const std::byte*>(text.data()), text.size()));
+            return ResultSuccess;
+        }
+
+        io::IStreamWriter::Ptr createFile(const std::filesystem::path& path)
+        {
+            const std::string pathStr = path.string();
+            return io::createNativeFileStream(pathStr.c_str(), io::AccessMode::Write, io::OpenFileMode::CreateAlways);
+        }
+    }  // namespace
+
+    eastl::unique_ptr<SessionRecorderImpl> SessionRecorderImpl::create()
+    {
+        const eastl::optional<SessionConfig> config = getServiceProvider().get<GlobalProperties>().getValue<SessionConfig>("/app/session");
+        if (!config || config->mode.empty())
+        {
+            return nullptr;
+        }
+
+        const Result<SessionRecorderMode> mode = EnumTraits<SessionRecorderMode>::parse({config->mode.data(), config->mode.size()});
+        if (!mode)
+        {
+            NAU_LOG_ERROR("Invalid session mode ({})", config->mode);
+            return nullptr;
+        }
+
+        if (*mode == SessionRecorderMode::Off)
+        {
+            return nullptr;
+        }
+
+        NAU_ASSERT_RETURN(config->fixedTimestep > 0.f, nullptr, "The session fixed timestep must be positive");
+
+        eastl::unique_ptr<SessionRecorderImpl> recorder{new SessionRecorderImpl(*mode, *config)};
+        if (const Result<> openResult = *mode == SessionRecorderMode::Record ? recorder->openRecording() : recorder->loadRecording(); !openResult)
+        {
+            NAU_LOG_ERROR("Fail to start the session {} ({}): {}", config->mode, config->path, openResult.getError()->getMessage());
+            return nullptr;
+        }
+
+        NAU_LOG("Session {} ({}) with the fixed timestep ({})", config->mode, config->path, config->fixedTimestep);
+
+        return recorder;
+    }
+
+    SessionRecorderImpl::SessionRecorderImpl(SessionRecorderMode mode, SessionConfig config) :
+        m_mode(mode),
+        m_config(std::move(config))
+    {
+    }
+
+    SessionRecorderMode SessionRecorderImpl::getMode() const
+    {
+        return m_mode;
+    }
+
+    uint64_t SessionRecorderImpl::getFrameIndex() const
+    {
+        return m_frameIndex;
+    }
+
+    void SessionRecorderImpl::recordEvent(eastl::string_view channel, eastl::string_view payload)
+    {
+        NAU_ASSERT_RETURN(m_mode == SessionRecorderMode::Record, );
+        NAU_ASSERT_RETURN(channel.size() <= std::numeric_limits<uint16_t>::max(), );
+
+        appendValue(m_frameBuffer, static_cast<uint16_t>(channel.size()));
+        m_frameBuffer.append(channel.data(), channel.size());
+        appendValue(m_frameBuffer, static_cast<uint32_t>(payload.size()));
+        m_frameBuffer.append(payload.data(), payload.size());
+        ++m_frameEventsCount;
+    }
+
+    eastl::vector<eastl::string_view> SessionRecorderImpl::getReplayEvents(eastl::string_view channel) const
+    {
+        NAU_ASSERT_RETURN(m_mode == SessionRecorderMode::Replay, {});
+
+        eastl::vector<eastl::string_view> payloads;
+        if (m_frameIndex < m_frames.size())
+        {
+            for (const Event& event : m_frames[m_frameIndex])
+            {
+                if (event.channel == channel)
+                {
+                    payloads.push_back(event.payload);
+                }
+            }
+        }
+
+        return payloads;
+    }
+
+    float SessionRecorderImpl::beginFrame()
+    {
+        const auto now = std::chrono::steady_clock::now();
+        if (m_frameStarted)
+        {
+            completeFrame(now);
+            ++m_frameIndex;
+        }
+
+        m_frameStarted = true;
+        m_frameStartTime = now;
+
+        return m_config.fixedTimestep;
+    }
+
+    bool SessionRecorderImpl::isReplayCompleted() const
+    {
+        return m_mode == SessionRecorderMode::Replay && m_config.stopOnReplayEnd && m_frameIndex >= m_frames.size();
+    }
+
+    Result<> SessionRecorderImpl::openRecording()
+    {
+        m_stream = createFile(std::filesystem::path{m_config.path.c_str()});
+        if (!m_stream)
+        {
+            return NauMakeError("Fail to create the recording file");
+        }
+
+        eastl::string header{RecordingMagic, sizeof(RecordingMagic)};
+        appendValue(header, RecordingVersion);
+        appendValue(header, m_config.fixedTimestep);
+
+        return writeText(*m_stream, header);
+    }
+
+    Result<> SessionRecorderImpl::loadRecording()
+    {
+        io::IStreamBase::Ptr stream = io::createNativeFileStream(m_config.path.c_str(), io::AccessMode::Read, io::OpenFileMode::OpenExisting);
+        if (!stream)
+        {
+            return NauMakeError("Fail to open the recording file");
+        }
+
+        auto& reader = stream->as<io::IStreamReader&>();
+        char buffer[64 * 1024];
+        while (true)
+        {
+            const Result<size_t> readResult = reader.read(reinterpret_cast<std::byte*>(buffer), sizeof(buffer));
+            NauCheckResult(readResult);
+            if (*readResult == 0)
+            {
+                break;
+            }
+
+            m_recording.append(buffer, *readResult);
+        }
+
+        eastl::string_view data = m_recording;
+        eastl::string_view magic;
+        uint32_t version = 0;
+        float fixedTimestep = 0.f;
+        if (!readBytes(data, sizeof(RecordingMagic), magic) || magic != eastl::string_view{RecordingMagic, sizeof(RecordingMagic)} ||
+            !readValue(data, version) || !readValue(data, fixedTimestep))
+        {
+            return NauMakeError("Invalid recording header");
+        }
+
+        if (version != RecordingVersion)
+        {
+            return NauMakeError("Unsupported recording version ({})", version);
+        }
+
+        if (fixedTimestep != m_config.fixedTimestep)
+        {
+            NAU_LOG_WARNING("The session is replayed with the fixed timestep ({}) which differs from the recorded one ({})", m_config.fixedTimestep, fixedTimestep);
+        }
+
+        while (!data.empty())
+        {
+            uint32_t eventsCount = 0;
+            if (!readValue(data, eventsCount))
+            {
+                return NauMakeError("Truncated recording at the frame ({})", m_frames.size());
+            }
+
+            auto& events = m_frames.emplace_back();
+            events.reserve(eventsCount);
+
+            for (uint32_t i = 0; i < eventsCount; ++i)
+            {
+                uint16_t channelSize = 0;
+                uint32_t payloadSize = 0;
+                Event& event = events.emplace_back();
+                if (!readValue(data, channelSize) || !readBytes(data, channelSize, event.channel) ||
+                    !readValue(data, payloadSize) || !readBytes(data, payloadSize, event.payload))
+                {
+                    return NauMakeError("Truncated recording at the frame ({})", m_frames.size() - 1);
+                }
+            }
+        }
+
+        return ResultSuccess;
+    }
+
+    void SessionRecorderImpl::completeFrame(std::chrono::steady_clock::time_point now)
+    {
+        using namespace std::chrono;
+
+        m_frameTimesMs.push_back(duration_cast<duration<float, std::milli>>(now - m_frameStartTime).count());
+
+        if (m_stream)
+        {
+            // Every frame is written (even with no events): the replay relies on the frame indices
+            eastl::string frame;
+            frame.reserve(sizeof(uint32_t) + m_frameBuffer.size());
+            appendValue(frame, m_frameEventsCount);
+            frame.append(m_frameBuffer);
+
+            if (!writeText(*m_stream, frame))
+            {
+                NAU_LOG_ERROR("Fail to write the session recording, the recording is stopped");
+                m_stream.reset();
+            }
+
+            m_frameBuffer.clear();
+            m_frameEventsCount = 0;
+        }
+    }
+
+    Result<> SessionRecorderImpl::writeTimings() const
+    {
+        namespace fs = std::filesystem;
+
+        const fs::path outputDir{m_config.timingsDir.c_str()};
+        std::error_code ec;
+        fs::create_directories(outputDir, ec);
+        if (ec)
+        {
+            return NauMakeError("Fail to create the timings directory ({}): {}", outputDir.string(), ec.message());
+        }
+
+        {
+            io::IStreamWriter::Ptr csv = createFile(outputDir / "frames.csv");
+            if (!csv)
+            {
+                return NauMakeError("Fail to create frames.csv");
+            }
+
+            NauCheckResult(writeText(*csv, "frame,frameMs"));
+            for (size_t i = 0; i < m_frameTimesMs.size(); ++i)
+            {
+                eastl::string row;
+                row.sprintf("\n%zu,%.3f", i, m_frameTimesMs[i]);
+                NauCheckResult(writeText(*csv, row));
+            }
+        }
+
+        SessionTimingsSummary summary;
+        summary.mode = m_config.mode;
+        summary.recording = m_config.path;
+        summary.fixedTimestep = m_config.fixedTimestep;
+        summary.frames = static_cast<uint32_t>(m_frameTimesMs.size());
+
+        if (!m_frameTimesMs.empty())
+        {
+            eastl::vector<float> values = m_frameTimesMs;
+            eastl::sort(values.begin(), values.end());
+
+            // Nearest rank percentile
+            const auto percentile = [&values](float p)
+            {
+                const size_t rank = static_cast<size_t>(std::ceil(p * static_cast<float>(values.size())));
+                return values[eastl::clamp<size_t>(rank, 1, values.size()) - 1];
+            };
+
+            float total = 0.f;
+            for (const float value : values)
+            {
+                total += value;
+            }
+
+            summary.averageMs = total / static_cast<float>(values.size());
+            summary.medianMs = percentile(0.5f);
+            summary.p95Ms = percentile(0.95f);
+            summary.p99Ms = percentile(0.99f);
+            summary.maxMs = values.back();
+        }
+
+        io::IStreamWriter::Ptr json = createFile(outputDir / "summary.json");
+        if (!json)
+        {
+            return NauMakeError("Fail to create summary.json");
+        }
+
+        return serialization::jsonWrite(*json, makeValueRef(summary), serialization::JsonSettings{.pretty = true});
+    }
+
+    async::Task<> SessionRecorderImpl::shutdownService()
+    {
+        // The last frame is not completed by the next beginFrame
+        if (m_frameStarted)
+        {
+            completeFrame(std::chrono::steady_clock::now());
+            m_frameStarted = false;
+        }
+
+        if (m_stream)
+        {
+            m_stream->flush();
+            m_stream.reset();
+        }
+
+        if (!m_config.timingsDir.empty())
+        {
+            if (const Result<> writeResult = writeTimings(); !writeResult)
+            {
+                NAU_LOG_ERROR("Fail to write the session timings: {}", writeResult.getError()->getMessage());
+            }
+        }
+
+        return async::makeResolvedTask();
+    }
+}  // namespace nau
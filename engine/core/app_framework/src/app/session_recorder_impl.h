@@ -0,0 +1,117 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <EASTL/string.h>
+#include <EASTL/unique_ptr.h>
+#include <EASTL/vector.h>
+
+#include <chrono>
+
+#include "nau/app/session_recorder.h"
+#include "nau/io/stream.h"
+#include "nau/meta/class_info.h"
+#include "nau/rtti/rtti_impl.h"
+#include "nau/service/service.h"
+#include "nau/utils/result.h"
+
+namespace nau
+{
+    /**
+        The session configuration ("/app/session" property):
+        @code
+            "app": {
+                "session": {
+                    "mode": "Replay",
+                    "path": "sessions/match_01.naurec",
+                    "fixedTimestep": 0.016666,
+                    "timingsDir": "perf/match_01",
+                    "stopOnReplayEnd": true
+                }
+            }
+        @endcode
+     */
+    struct SessionConfig
+    {
+        eastl::string mode;
+        eastl::string path;
+        eastl::string timingsDir;
+        float fixedTimestep = 1.f / 60.f;
+        bool stopOnReplayEnd = true;
+
+        NAU_CLASS_FIELDS(
+            CLASS_FIELD(mode),
+            CLASS_FIELD(path),
+            CLASS_FIELD(timingsDir),
+            CLASS_FIELD(fixedTimestep),
+            CLASS_FIELD(stopOnReplayEnd))
+    };
+
+    /**
+        The recording is the sequence of the frames: [events count:uint32] and the events [channel size:uint16][channel][payload size:uint32][payload],
+        after the header [magic][version:uint32][fixed timestep:float].
+     */
+    class SessionRecorderImpl final : public ISessionRecorder,
+                                      public IServiceShutdown
+    {
+        NAU_RTTI_CLASS(nau::SessionRecorderImpl, ISessionRecorder, IServiceShutdown)
+
+    public:
+        /**
+            Creates the recorder for the "/app/session" configuration, nullptr if the session is not configured (or can not be opened).
+         */
+        static eastl::unique_ptr<SessionRecorderImpl> create();
+
+        SessionRecorderMode getMode() const override;
+        uint64_t getFrameIndex() const override;
+        void recordEvent(eastl::string_view channel, eastl::string_view payload) override;
+        eastl::vector<eastl::string_view> getReplayEvents(eastl::string_view channel) const override;
+
+        /**
+            Called by the application at the start of the game step: completes the previous frame and returns the step delta time.
+         */
+        float beginFrame();
+
+        /**
+            All the recorded frames are replayed and the application is expected to stop.
+         */
+        bool isReplayCompleted() const;
+
+    private:
+        struct Event
+        {
+            eastl::string_view channel;
+            eastl::string_view payload;
+        };
+
+        SessionRecorderImpl(SessionRecorderMode mode, SessionConfig config);
+
+        Result<> openRecording();
+        Result<> loadRecording();
+
+        void completeFrame(std::chrono::steady_clock::time_point now);
+
+        Result<> writeTimings() const;
+
+        async::Task<> shutdownService() override;
+
+        const SessionRecorderMode m_mode;
+        const SessionConfig m_config;
+
+        uint64_t m_frameIndex = 0;
+        bool m_frameStarted = false;
+        std::chrono::steady_clock::time_point m_frameStartTime;
+        eastl::vector<float> m_frameTimesMs;
+
+        // Record: the stream and the serialized events of the current frame
+        io::IStreamWriter::Ptr m_stream;
+        eastl::string m_frameBuffer;
+        uint32_t m_frameEventsCount = 0;
+
+        // Replay: the whole recording and its events per frame (the views into m_recording)
+        eastl::string m_recording;
+        eastl::vector<eastl::vector<Event>> m_frames;
+    };
+}  // namespace nau
@@ -4,29 +4,59 @@
 #include "concurrent_execution_container.h"
 
 #include "nau/app/application.h"
+#include "nau/app/global_properties.h"
 #include "nau/app/main_loop/game_system.h"
+#include "nau/app/main_loop/game_system_timings.h"
 #include "nau/service/internal/service_provider_initialization.h"
 #include "nau/service/service.h"
 #include "nau/threading/set_thread_name.h"
+#include "nau/utils/performance_profiling.h"
+
+#include <thread>
 
 namespace nau
 {
     namespace
     {
+        using Clock = std::chrono::steady_clock;
+
+        /**
+            Limits the fixed steps performed within the one iteration when the system falls behind:
+            the time above the limit is dropped (the simulation slows down instead of the spiral of death).
+         */
+        constexpr uint32_t MaxFixedStepsPerIteration = 4;
+
+        /**
+            The timer based sleep has the milliseconds granularity (and is not precise),
+            so the last part of the wait before the fixed step tick is spent spinning (if enabled).
+         */
+        constexpr std::chrono::microseconds SpinWaitThreshold{2000};
+
         struct Timer
         {
-            std::chrono::system_clock::time_point lastTimePoint = std::chrono::system_clock::now();
+            Clock::time_point lastTimePoint = Clock::now();
 
-            std::chrono::milliseconds getDt()
+            std::chrono::microseconds getDt()
             {
                 using namespace std::chrono;
 
-                const auto currentTimePoint = system_clock::now();
-                const milliseconds dt = duration_cast<milliseconds>(currentTimePoint - lastTimePoint);
+                const auto currentTimePoint = Clock::now();
+                const microseconds dt = duration_cast<microseconds>(currentTimePoint - lastTimePoint);
                 lastTimePoint = currentTimePoint;
                 return dt;
             }
         };
+
+        bool isFixedStepSpinWaitEnabled()
+        {
+            // Spinning burns the cpu core, so it is expected to be enabled only for the dedicated servers (or benchmarks)
+            if (!getServiceProvider().has<GlobalProperties>())
+            {
+                return false;
+            }
+
+            return getServiceProvider().get<GlobalProperties>().getValue<bool>("/app/fixedStepSpinWait").value_or(false);
+        }
     }  // namespace
 
     ConcurrentExecutionContainer::ConcurrentExecutionContainer(IClassDescriptor::Ptr systemClass) :
@@ -43,7 +73,7 @@ namespace nau
         {
             threading::setThisThreadName(::fmt::format("NAU SYS ({})", m_systemClass->getClassName()));
 
-            m_workQueue = WorkQueue::create();
+            m_workQueue = WorkQueue::create(WorkQueueMode::Mpsc);
             Executor::setThisThreadExecutor(m_workQueue);
 
             TaskSource<> threadCompletedTaskSource;
@@ -75,9 +105,11 @@ namespace nau
                 m_workQueue->poll((isFixedGameStep && m_isAlive) ? BlockingTimeout : NonBlockingTimeout);
             }
 
+            // Shutdown is completed with m_workQueue->notify(), so the queue can be polled in blocking mode
+            // (instead of spinning) - poll() returns as soon as the notification or a new work arrives.
             while (!m_isShutdownCompleted)
             {
-                m_workQueue->poll(NonBlockingTimeout);
+                m_workQueue->poll(BlockingTimeout);
             }
         });
 
@@ -119,6 +151,7 @@ namespace nau
         }
         else
         {
+            m_isShutdownCompleted = true;
             m_workQueue->notify();
         }
 
@@ -151,27 +184,108 @@ namespace nau
 
         IGameSceneUpdate& gameSceneUpdate = m_gameSystemInstance->as<IGameSceneUpdate&>();
 
-        const auto syncSceneState = [&gameSceneUpdate]() -> Task<>
+        // The update and the sync times are reported separately: the sync runs on the main thread
+        const eastl::string updateTimingName{m_systemClass->getClassName().c_str()};
+        const eastl::string syncTimingName = updateTimingName + "/syncSceneState";
+
+        const auto syncSceneState = [&gameSceneUpdate, &syncTimingName]() -> Task<>
         {
             co_await getApplication().getExecutor();
+
+            NAU_CPU_SCOPED_TAG_NAME("GameSystemSyncSceneState", nau::PerfTag::Core);
+            const GameSystemTimeScope timeScope{syncTimingName};
             gameSceneUpdate.syncSceneState();
         };
 
+        const auto update = [&gameSceneUpdate, &updateTimingName](microseconds dt) -> Task<bool>
+        {
+            const auto startTime = Clock::now();
+            const bool doContinueUpdate = co_await gameSceneUpdate.update(dt);
+            reportGameSystemTime(updateTimingName, duration_cast<microseconds>(Clock::now() - startTime));
+
+            co_return doContinueUpdate;
+        };
+
+        // Sleeps (with the catching up the timer errors) while the work queue is being pumped.
+        const auto sleepFor = [this](microseconds sleepTime) -> Task<>
+        {
+            // TODO: add async delay(timeout) -> Task<>.
+            // Or revise the implementation of the timer manager so as not to terminate the current coroutine with an error,
+            // but to immediately complete the co_await without waiting.
+            //
+            // Currently co_await timeout will automatically completed current coroutine.
+            // But to complete gracefully, the game system expects gameSceneUpdate to always be called
+            // otherwise it will never complete its execution: executeGameSystem will only stops after gameSceneUpdate.update() returns false.
+            //
+            // As a workaround, a "proxy" task is used to catch-up an error.
+            auto sleepTask = [](microseconds timeout) -> Task<>
+            {
+                co_await timeout;
+            }(sleepTime);
+
+            Result<> waitRes = co_await sleepTask.doTry();
+            if (!waitRes)
+            {
+                m_workQueue->notify();
+            }
+        };
+
+        const bool spinWait = isFixedStepSpinWaitEnabled();
+
+        // The pipelined system does not wait for the sync: the next update overlaps with the sync of the previous one.
+        Task<> pendingSync;
+
         Timer timer;
+        // Simulated time debt of the fixed step system: the fixed steps are performed while the debt covers the whole step,
+        // the remainder is carried over to the next iteration (so the fractional part of the step is never lost).
+        microseconds accumulatedTime{0};
+
         do
         {
-            const std::chrono::milliseconds updateStep = timer.getDt();
+            const microseconds frameTime = timer.getDt();
+            const eastl::optional<microseconds> fixedTimeStep = gameSceneUpdate.getFixedUpdateTimeStep();
+
+            bool doContinueUpdate = true;
+            if (fixedTimeStep.has_value())
+            {
+                accumulatedTime = std::min(accumulatedTime + frameTime, *fixedTimeStep * MaxFixedStepsPerIteration);
+                while (doContinueUpdate && accumulatedTime >= *fixedTimeStep)
+                {
+                    doContinueUpdate = co_await update(*fixedTimeStep);
+                    accumulatedTime -= *fixedTimeStep;
+                }
+            }
+            else
+            {
+                doContinueUpdate = co_await update(frameTime);
+            }
 
-            const bool doContinueUpdate = co_await gameSceneUpdate.update(updateStep);
             if (!doContinueUpdate)
             {
+                if (pendingSync && !pendingSync.isReady())
+                {
+                    co_await pendingSync;
+                }
+
                 m_workQueue->notify();
                 break;
             }
 
             if (m_isAlive)
             {
-                co_await syncSceneState();
+                if (gameSceneUpdate.isSceneSyncPipelined())
+                {
+                    if (pendingSync && !pendingSync.isReady())
+                    {
+                        co_await pendingSync;
+                    }
+
+                    pendingSync = syncSceneState();
+                }
+                else
+                {
+                    co_await syncSceneState();
+                }
             }
             else
             {
@@ -180,45 +294,40 @@ namespace nau
                 co_await m_workQueue;
             }
 
-            // with fixed time step the game system will simulate for fixed time duration.
-            // If the simulation calculation took less than the target time,
-            // then in this case we simply fall asleep for a while to maintain the specified system update rate.
+            // With fixed time step the game system will simulate for fixed time duration.
+            // The next tick is aligned to the time when the accumulated time covers the whole step:
+            // if the simulation calculation took less than the step, then the thread sleeps until the tick,
+            // the last (sub millisecond) part of the wait can be spun to hit the tick precisely.
             //
-            // f the simulation takes longer, then
+            // If the simulation takes longer, then
             // 1) most likely the target update rate needs to be revised (but this can be done only by game system itself
             // 2) give control (yield) to the queue - so that there is an opportunity to pump the accumulated asynchronous messages
-            //    and immediately proceed to the next step of the simulation
-            if (const auto fixedTimeStep = gameSceneUpdate.getFixedUpdateTimeStep(); fixedTimeStep.has_value())
+            //    and immediately proceed to the next step of the simulation (the lag is caught up with several steps, see MaxFixedStepsPerIteration)
+            if (fixedTimeStep.has_value())
             {
-                const auto updateDuration = duration_cast<milliseconds>(system_clock::now() - timer.lastTimePoint);
+                const Clock::time_point nextTick = timer.lastTimePoint + (*fixedTimeStep - accumulatedTime);
+                const auto waitTime = duration_cast<microseconds>(nextTick - Clock::now());
 
-                if (updateDuration < *fixedTimeStep)
+                if (waitTime <= microseconds{0})
+                {
+                    co_await m_workQueue;
+                }
+                else if (spinWait)
                 {
-                    const auto sleepTime = *fixedTimeStep - updateDuration;
-
-                    // TODO: add async delay(timeout) -> Task<>.
-                    // Or revise the implementation of the timer manager so as not to terminate the current coroutine with an error, 
-                    // but to immediately complete the co_await without waiting.
-                    // 
-                    // Currently co_await timeout will automatically completed current coroutine.
-                    // But to complete gracefully, the game system expects gameSceneUpdate to always be called
-                    // otherwise it will never complete its execution: executeGameSystem will only stops after gameSceneUpdate.update() returns false.
-                    //
-                    // As a workaround, a "proxy" task is used to catch-up an error.
-                    auto sleepTask = [&]() -> Task<>
+                    if (waitTime > SpinWaitThreshold)
                     {
-                        co_await sleepTime;
-                    }();
+                        co_await sleepFor(waitTime - SpinWaitThreshold);
+                    }
 
-                    Result<> waitRes = co_await sleepTask.doTry();
-                    if (!waitRes)
+                    while (Clock::now() < nextTick)
                     {
-                        m_workQueue->notify();
+                        std::this_thread::yield();
                     }
                 }
                 else
                 {
-                    co_await m_workQueue;
+                    // The sleep is rounded up: the step must not start before the tick (that would result in an empty iteration)
+                    co_await sleepFor(ceil<milliseconds>(waitTime));
                 }
             }
 
@@ -0,0 +1,83 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#include "game_update_graph.h"
+
+#include <EASTL/algorithm.h>
+
+namespace nau
+{
+    void GameUpdateGraph::addHook(Hook hook, eastl::optional<GameUpdateAccess> access)
+    {
+        NAU_ASSERT(hook);
+        m_hooks.push_back(Entry{std::move(hook), std::move(access)});
+    }
+
+    bool GameUpdateGraph::hasConflict(const eastl::optional<GameUpdateAccess>& access1, const eastl::optional<GameUpdateAccess>& access2)
+    {
+        if (!access1 || !access2)
+        {
+            return true;
+        }
+
+        const auto intersects = [](const eastl::vector<eastl::string_view>& resources1, const eastl::vector<eastl::string_view>& resources2)
+        {
+            return eastl::any_of(resources1.begin(), resources1.end(), [&resources2](eastl::string_view resource)
+            {
+                return eastl::find(resources2.begin(), resources2.end(), resource) != resources2.end();
+            });
+        };
+
+        return intersects(access1->writes, access2->writes) ||
+               intersects(access1->writes, access2->reads) ||
+               intersects(access1->reads, access2->writes);
+    }
+
+    void GameUpdateGraph::build()
+    {
+        m_graph.clear();
+        m_isParallel = false;
+
+        for (size_t i = 0; i < m_hooks.size(); ++i)
+        {
+            const Entry& entry = m_hooks[i];
+            const bool callingThreadOnly = !entry.access || !entry.access->isThreadSafe;
+
+            [[maybe_unused]] const auto jobId = m_graph.addJob([this, i]
+            {
+                m_hooks[i].hook(m_dt);
+            }, callingThreadOnly);
+            NAU_FATAL(jobId == i);
+
+            bool dependsOnPrevious = (i == 0);
+            for (size_t previous = 0; previous < i; ++previous)
+            {
+                if (hasConflict(m_hooks[previous].access, entry.access))
+                {
+                    m_graph.addDependency(static_cast<async::JobGraph::JobId>(i), static_cast<async::JobGraph::JobId>(previous));
+                    dependsOnPrevious = true;
+                }
+            }
+
+            // At least one hook can be executed concurrently with others
+            m_isParallel = m_isParallel || !dependsOnPrevious || !callingThreadOnly;
+        }
+    }
+
+    void GameUpdateGraph::run(std::chrono::milliseconds dt)
+    {
+        if (!m_isParallel)
+        {
+            // Nothing is declared: the hooks are called in the registration order without the job system overhead
+            for (Entry& entry : m_hooks)
+            {
+                entry.hook(dt);
+            }
+            return;
+        }
+
+        m_dt = dt;
+        m_graph.run();
+    }
+
+}  // namespace nau
@@ -0,0 +1,49 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <EASTL/optional.h>
+#include <EASTL/vector.h>
+
+#include <chrono>
+
+#include "nau/app/main_loop/game_system.h"
+#include "nau/async/job_graph.h"
+#include "nau/utils/functor.h"
+
+namespace nau
+{
+    /**
+     * Executes the game update hooks (gamePreUpdate or gamePostUpdate) respecting their declared accesses (see GameUpdateAccess).
+     * The dependencies are built once: the hook depends on each previously added hook it conflicts with,
+     * the independent hooks are executed in parallel on the default executor.
+     * The hooks without the declared access and the hooks that are not thread safe are executed on the calling (main) thread.
+     */
+    class GameUpdateGraph
+    {
+    public:
+        using Hook = Functor<void(std::chrono::milliseconds)>;
+
+        void addHook(Hook hook, eastl::optional<GameUpdateAccess> access);
+
+        void build();
+
+        void run(std::chrono::milliseconds dt);
+
+    private:
+        struct Entry
+        {
+            Hook hook;
+            eastl::optional<GameUpdateAccess> access;
+        };
+
+        static bool hasConflict(const eastl::optional<GameUpdateAccess>& access1, const eastl::optional<GameUpdateAccess>& access2);
+
+        eastl::vector<Entry> m_hooks;
+        async::JobGraph m_graph;
+        std::chrono::milliseconds m_dt{0};
+        bool m_isParallel = false;
+    };
+
+}  // namespace nau
@@ -4,7 +4,11 @@
 
 #include "main_loop_service.h"
 
+#include "nau/3d/dag_lowLatency.h"
+#include "nau/app/application_profile.h"
+#include "nau/app/main_loop/game_system_timings.h"
 #include "nau/gui/dag_imgui.h"
+#include "nau/utils/performance_profiling.h"
 
 namespace nau
 {
@@ -125,6 +129,28 @@ namespace nau
             m_sceneManager = &getServiceProvider().get<scene::ISceneManagerInternal>();
         }
 
+        m_imguiEnabled = readApplicationProfile().imgui;
+
+        // All the game systems are pre-initialized, so the hook lists are final
+        for (IGamePreUpdate* const preUpdate : m_preUpdate)
+        {
+            m_preUpdateGraph.addHook([preUpdate](std::chrono::milliseconds dt)
+            {
+                preUpdate->gamePreUpdate(dt);
+            }, preUpdate->getPreUpdateAccess());
+        }
+
+        for (IGamePostUpdate* const postUpdate : m_postUpdate)
+        {
+            m_postUpdateGraph.addHook([postUpdate](std::chrono::milliseconds dt)
+            {
+                postUpdate->gamePostUpdate(dt);
+            }, postUpdate->getPostUpdateAccess());
+        }
+
+        m_preUpdateGraph.build();
+        m_postUpdateGraph.build();
+
         return async::makeResolvedTask();
     }
 
@@ -147,26 +173,40 @@ namespace nau
 
         const milliseconds msDt{static_cast<milliseconds::rep>(1000.f * dt)};
 
-        for (IGamePreUpdate* const preUpdate : m_preUpdate)
+        NAU_CPU_SCOPED_TAG(nau::PerfTag::Core);
+
+        // Low latency mode: wait (when enabled and supported by the driver) as late as possible before the input is sampled,
+        // the markers let the driver pace the simulation against the render/present.
+        const uint32_t latencyFrameId = lowlatency::start_frame();
+        lowlatency::sleep();
+        SCOPED_LATENCY_MARKER(latencyFrameId, SIMULATION_START, SIMULATION_END);
+
         {
-            preUpdate->gamePreUpdate(msDt);
+            NAU_CPU_SCOPED_TAG_NAME("GamePreUpdate", nau::PerfTag::Core);
+            const GameSystemTimeScope timeScope{"GamePreUpdate"};
+            m_preUpdateGraph.run(msDt);
         }
 
+        lowlatency::set_marker(latencyFrameId, lowlatency::LatencyMarkerType::INPUT_SAMPLE_FINISHED);
+
         if (m_sceneManager != nullptr)
         {
+            NAU_CPU_SCOPED_TAG_NAME("SceneManagerUpdate", nau::PerfTag::Core);
+            const GameSystemTimeScope timeScope{"SceneManagerUpdate"};
             m_sceneManager->update(dt);
         }
 
-        for (IGamePostUpdate* const postUpdate : m_postUpdate)
         {
-            postUpdate->gamePostUpdate(msDt);
+            NAU_CPU_SCOPED_TAG_NAME("GamePostUpdate", nau::PerfTag::Core);
+            const GameSystemTimeScope timeScope{"GamePostUpdate"};
+            m_postUpdateGraph.run(msDt);
         }
 
-        if (imgui_get_state() != ImGuiState::OFF)
+        if (m_imguiEnabled && imgui_get_state() != ImGuiState::OFF)
         {
+            NAU_CPU_SCOPED_TAG_NAME("ImGuiUpdate", nau::PerfTag::Core);
             imgui_cache_render_data();
             imgui_update();
         }
-        
     }
 }  // namespace nau
@@ -5,6 +5,7 @@
 
 #include "app/platform_window_service.h"
 #include "concurrent_execution_container.h"
+#include "game_update_graph.h"
 #include "nau/app/main_loop/game_system.h"
 #include "nau/rtti/rtti_impl.h"
 #include "nau/scene/internal/scene_manager_internal.h"
@@ -38,7 +39,14 @@ namespace nau
         eastl::vector<IGameSceneUpdate*> m_sceneUpdate;
         eastl::vector<eastl::unique_ptr<ConcurrentExecutionContainer> > m_concurrentContainers;
 
+        // The pre/post update hooks are executed respecting their declared accesses (see GameUpdateAccess)
+        GameUpdateGraph m_preUpdateGraph;
+        GameUpdateGraph m_postUpdateGraph;
+
         scene::ISceneManagerInternal* m_sceneManager = nullptr;
+
+        // Disabled by the application profile (see ApplicationProfile::imgui)
+        bool m_imguiEnabled = true;
     };
 
 }  // namespace nau
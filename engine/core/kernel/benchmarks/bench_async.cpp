@@ -0,0 +1,172 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "benchmark.h"
+#include "nau/async/task.h"
+#include "nau/async/thread_pool_executor.h"
+
+namespace nau::bench
+{
+    namespace
+    {
+        async::Task<int> makeReadyCoroutine()
+        {
+            co_return 1;
+        }
+
+        async::Task<int> makeCoroutineChain(int depth)
+        {
+            if (depth == 0)
+            {
+                co_return 1;
+            }
+
+            const int value = co_await makeCoroutineChain(depth - 1);
+            co_return value + 1;
+        }
+
+        async::Task<int> awaitTask(async::Task<int> task)
+        {
+            const int value = co_await std::move(task);
+            co_return value + 1;
+        }
+
+        /**
+            Each producer thread schedules the jobs into the same executor, iteration is completed when all jobs are executed.
+            Producer threads are started for each iteration: their startup is small compared to the jobs count.
+        */
+        void runExecutorContention(State& state, async::Executor::Ptr executor)
+        {
+            constexpr size_t JobsPerProducer = 10'000;
+            const size_t producersCount = static_cast<size_t>(state.getArg());
+
+            std::atomic<size_t> counter = 0;
+            const auto job = [](void* counterPtr, void*) noexcept
+            {
+                reinterpret_cast<std::atomic<size_t>*>(counterPtr)->fetch_add(1, std::memory_order_relaxed);
+            };
+
+            std::vector<std::thread> producers;
+            producers.reserve(producersCount);
+
+            while (state.keepRunning())
+            {
+                counter.store(0, std::memory_order_relaxed);
+                for (size_t i = 0; i < producersCount; ++i)
+                {
+                    producers.emplace_back([&]
+                    {
+                        for (size_t j = 0; j < JobsPerProducer; ++j)
+                        {
+                            executor->execute(job, &counter);
+                        }
+                    });
+                }
+
+                for (std::thread& producer : producers)
+                {
+                    producer.join();
+                }
+                producers.clear();
+
+                while (counter.load(std::memory_order_acquire) < producersCount * JobsPerProducer)
+                {
+                    std::this_thread::yield();
+                }
+            }
+
+            executor->waitAnyActivity();
+            state.setItemsProcessed(state.getIterations() * producersCount * JobsPerProducer);
+        }
+    }  // namespace
+
+    NAU_BENCHMARK(TaskMakeResolved)
+    {
+        while (state.keepRunning())
+        {
+            async::Task<int> task = async::makeResolvedTask(42);
+            doNotOptimize(task.result());
+        }
+        state.setItemsProcessed(state.getIterations());
+    }
+
+    NAU_BENCHMARK(TaskSourceResolve)
+    {
+        while (state.keepRunning())
+        {
+            async::TaskSource<int> taskSource;
+            async::Task<int> task = taskSource.getTask();
+            taskSource.resolve(42);
+            doNotOptimize(task.result());
+        }
+        state.setItemsProcessed(state.getIterations());
+    }
+
+    NAU_BENCHMARK(CoroutineReady)
+    {
+        while (state.keepRunning())
+        {
+            async::Task<int> task = makeReadyCoroutine();
+            async::wait(task);
+            doNotOptimize(task.result());
+        }
+        state.setItemsProcessed(state.getIterations());
+    }
+
+    // Synchronous co_await of the nested coroutines (each one is completed without suspension).
+    NAU_BENCHMARK(CoroutineChain, 1, 8, 64)
+    {
+        const int depth = static_cast<int>(state.getArg());
+        while (state.keepRunning())
+        {
+            async::Task<int> task = makeCoroutineChain(depth);
+            async::wait(task);
+            doNotOptimize(task.result());
+        }
+        state.setItemsProcessed(state.getIterations() * static_cast<uint64_t>(depth));
+    }
+
+    // Coroutine is suspended on the not ready task and resumed (continuation) when the task is resolved.
+    NAU_BENCHMARK(TaskContinuation)
+    {
+        while (state.keepRunning())
+        {
+            async::TaskSource<int> taskSource;
+            async::Task<int> task = awaitTask(taskSource.getTask());
+            taskSource.resolve(1);
+            async::wait(task);
+            doNotOptimize(task.result());
+        }
+        state.setItemsProcessed(state.getIterations());
+    }
+
+    // Schedule into the default pool and wait for the result on the calling thread.
+    NAU_BENCHMARK(AsyncRunRoundTrip)
+    {
+        while (state.keepRunning())
+        {
+            async::Task<int> task = async::run([]
+            {
+                return 1;
+            }, nullptr);
+            async::wait(task);
+            doNotOptimize(task.result());
+        }
+        state.setItemsProcessed(state.getIterations());
+    }
+
+    NAU_BENCHMARK(ExecutorContentionWorkStealing, 1, 2, 4, 8)
+    {
+        runExecutorContention(state, async::createThreadPoolExecutor("Bench WorkStealing", 4, async::ThreadPoolMode::WorkStealing));
+    }
+
+    NAU_BENCHMARK(ExecutorContentionSharedQueue, 1, 2, 4, 8)
+    {
+        runExecutorContention(state, async::createThreadPoolExecutor("Bench SharedQueue", 4, async::ThreadPoolMode::SharedQueue));
+    }
+
+}  // namespace nau::bench
@@ -0,0 +1,230 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "benchmark.h"
+#include "nau/dag_ioSys/dag_memIo.h"
+#include "nau/dataBlock/dag_dataBlock.h"
+#include "nau/dataBlock/dag_roDataBlock.h"
+#include "nau/memory/mem_allocator.h"
+
+namespace nau::bench
+{
+    namespace
+    {
+        std::string makeBlkText(size_t blocksCount)
+        {
+            std::string text;
+            for (size_t i = 0; i < blocksCount; ++i)
+            {
+                const std::string index = std::to_string(i);
+                text += "entity{\n";
+                text += "  name:t=\"entity_" + index + "\"\n";
+                text += "  id:i=" + index + "\n";
+                text += "  mass:r=" + index + ".5\n";
+                text += "  mesh:t=\"file:/content/mesh_" + index + ".gltf\"\n";
+                text += "  transform{\n";
+                text += "    pos:p3=" + index + ", 1.5, -2\n";
+                text += "    visible:b=yes\n";
+                text += "  }\n";
+                text += "}\n";
+            }
+            return text;
+        }
+
+#if NAU_64BIT
+        /**
+            There is no RoDataBlock dump writer in the engine, so the dump is built here by hand:
+            the root block with the "entity" sub-blocks, each one has name:t, id:i, mass:r and mesh:t parameters.
+            All offsets in the dump are relative to its beginning, except the string values that are relative to the name map.
+        */
+        class RoDataBlockDumpBuilder
+        {
+        public:
+            static constexpr size_t BlockSize = 48;
+            static constexpr size_t ParamSize = 8;
+            static constexpr size_t PatchableTabSize = 16;
+            static constexpr size_t PatchablePtrSize = 8;
+            static constexpr size_t ParamsPerBlock = 4;
+
+            std::vector<std::byte> build(size_t blocksCount)
+            {
+                // sorted: RoNameMap::getNameId() uses the binary search.
+                const char* const names[] = {"entity", "id", "mass", "mesh", "name"};
+                enum : uint16_t
+                {
+                    EntityNameId,
+                    IdNameId,
+                    MassNameId,
+                    MeshNameId,
+                    NameNameId
+                };
+
+                const size_t blocksOffset = BlockSize;
+                const size_t paramsOffset = blocksOffset + blocksCount * BlockSize;
+                const size_t nameMapOffset = paramsOffset + blocksCount * ParamsPerBlock * ParamSize;
+                const size_t nameMapEntriesOffset = nameMapOffset + PatchableTabSize;
+                size_t stringsOffset = nameMapEntriesOffset + std::size(names) * PatchablePtrSize;
+
+                m_data.assign(stringsOffset, std::byte{0});
+
+                writeBlock(0, -1, blocksOffset, blocksCount, 0, 0, nameMapOffset);
+
+                writeTab(nameMapOffset, nameMapEntriesOffset, std::size(names));
+                for (size_t i = 0; i < std::size(names); ++i)
+                {
+                    writePtr(nameMapEntriesOffset + i * PatchablePtrSize, appendString(names[i]));
+                }
+
+                for (size_t i = 0; i < blocksCount; ++i)
+                {
+                    const std::string index = std::to_string(i);
+                    const size_t blockParamsOffset = paramsOffset + i * ParamsPerBlock * ParamSize;
+
+                    writeBlock(blocksOffset + i * BlockSize, EntityNameId, 0, 0, blockParamsOffset, ParamsPerBlock, nameMapOffset);
+
+                    const size_t nameValue = appendString(("entity_" + index).c_str()) - nameMapOffset;
+                    const size_t meshValue = appendString(("file:/content/mesh_" + index + ".gltf").c_str()) - nameMapOffset;
+                    const float mass = static_cast<float>(i) + 0.5f;
+                    int massValue;
+                    memcpy(&massValue, &mass, sizeof(massValue));
+
+                    writeParam(blockParamsOffset + 0 * ParamSize, NameNameId, RoDataBlock::TYPE_STRING, static_cast<int>(nameValue));
+                    writeParam(blockParamsOffset + 1 * ParamSize, IdNameId, RoDataBlock::TYPE_INT, static_cast<int>(i));
+                    writeParam(blockParamsOffset + 2 * ParamSize, MassNameId, RoDataBlock::TYPE_REAL, massValue);
+                    writeParam(blockParamsOffset + 3 * ParamSize, MeshNameId, RoDataBlock::TYPE_STRING, static_cast<int>(meshValue));
+                }
+
+                return std::move(m_data);
+            }
+
+        private:
+            template <typename T>
+            void writeValue(size_t offset, T value)
+            {
+                memcpy(m_data.data() + offset, &value, sizeof(T));
+            }
+
+            // PatchableTab: 64-bit value (offset | count << 32), the second half is not used.
+            void writeTab(size_t offset, size_t dataOffset, size_t count)
+            {
+                writeValue<uint64_t>(offset, count > 0 ? (static_cast<uint64_t>(dataOffset) | (static_cast<uint64_t>(count) << 32)) : 0);
+            }
+
+            // PatchablePtr: lower 32 bits are the offset.
+            void writePtr(size_t offset, size_t dataOffset)
+            {
+                writeValue<uint64_t>(offset, static_cast<uint32_t>(dataOffset));
+            }
+
+            void writeParam(size_t offset, uint16_t nameId, uint16_t type, int value)
+            {
+                writeValue<int>(offset, value);
+                writeValue<uint16_t>(offset + 4, nameId);
+                writeValue<uint16_t>(offset + 6, type);
+            }
+
+            void writeBlock(size_t offset, int nameId, size_t blocksOffset, size_t blocksCount, size_t paramsOffset, size_t paramsCount, size_t nameMapOffset)
+            {
+                writeTab(offset, paramsOffset, paramsCount);
+                writeTab(offset + PatchableTabSize, blocksOffset, blocksCount);
+                writePtr(offset + PatchableTabSize * 2, nameMapOffset);
+                writeValue<int>(offset + PatchableTabSize * 2 + PatchablePtrSize, nameId);
+            }
+
+            size_t appendString(const char* str)
+            {
+                const size_t offset = m_data.size();
+                const size_t length = strlen(str) + 1;
+                m_data.resize(offset + length);
+                memcpy(m_data.data() + offset, str, length);
+                return offset;
+            }
+
+            std::vector<std::byte> m_data;
+        };
+
+        static_assert(sizeof(RoDataBlock) == RoDataBlockDumpBuilder::BlockSize, "RoDataBlock dump layout is changed");
+#endif
+    }  // namespace
+
+    NAU_BENCHMARK(DataBlockLoadText, 16, 256, 2048)
+    {
+        const std::string text = makeBlkText(static_cast<size_t>(state.getArg()));
+
+        while (state.keepRunning())
+        {
+            DataBlock blk;
+            if (!blk.loadText(text.data(), static_cast<int>(text.size()), "bench.blk"))
+            {
+                state.setError("DataBlock::loadText failed");
+                return;
+            }
+            doNotOptimize(blk.blockCount());
+        }
+        state.setBytesProcessed(state.getIterations() * text.size());
+    }
+
+    NAU_BENCHMARK(DataBlockLoadBinary, 16, 256, 2048)
+    {
+        const std::string text = makeBlkText(static_cast<size_t>(state.getArg()));
+
+        DataBlock sourceBlk;
+        iosys::DynamicMemGeneralSaveCB binaryData(nullptr, text.size());
+        if (!sourceBlk.loadText(text.data(), static_cast<int>(text.size()), "bench.blk") || !sourceBlk.saveToStream(binaryData))
+        {
+            state.setError("Fail to prepare binary DataBlock");
+            return;
+        }
+
+        while (state.keepRunning())
+        {
+            iosys::InPlaceMemLoadCB reader{binaryData.data(), static_cast<int>(binaryData.size())};
+            DataBlock blk;
+            if (!blk.loadFromStream(reader))
+            {
+                state.setError("DataBlock::loadFromStream failed");
+                return;
+            }
+            doNotOptimize(blk.blockCount());
+        }
+        state.setBytesProcessed(state.getIterations() * static_cast<uint64_t>(binaryData.size()));
+    }
+
+#if NAU_64BIT
+    NAU_BENCHMARK(RoDataBlockLoad, 16, 256, 2048)
+    {
+        const size_t blocksCount = static_cast<size_t>(state.getArg());
+        const std::vector<std::byte> dump = RoDataBlockDumpBuilder{}.build(blocksCount);
+
+        {
+            iosys::InPlaceMemLoadCB reader{dump.data(), static_cast<int>(dump.size())};
+            RoDataBlock* const blk = RoDataBlock::load(reader, static_cast<int>(dump.size()));
+            const RoDataBlock* const lastBlock = blk->getBlock(static_cast<uint32_t>(blocksCount - 1));
+            const bool isValid = blk->blockCount() == static_cast<int>(blocksCount) && lastBlock &&
+                                 lastBlock->getInt("id", -1) == static_cast<int>(blocksCount - 1) &&
+                                 strcmp(lastBlock->getStr("name", ""), ("entity_" + std::to_string(blocksCount - 1)).c_str()) == 0;
+            getDefaultAllocator()->deallocate(blk);
+
+            if (!isValid)
+            {
+                state.setError("Invalid RoDataBlock dump");
+                return;
+            }
+        }
+
+        while (state.keepRunning())
+        {
+            iosys::InPlaceMemLoadCB reader{dump.data(), static_cast<int>(dump.size())};
+            RoDataBlock* const blk = RoDataBlock::load(reader, static_cast<int>(dump.size()));
+            doNotOptimize(blk->getBlockByName("entity"));
+            getDefaultAllocator()->deallocate(blk);
+        }
+        state.setBytesProcessed(state.getIterations() * dump.size());
+    }
+#endif
+
+}  // namespace nau::bench
@@ -0,0 +1,67 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#include <EASTL/vector.h>
+
+#include "benchmark.h"
+#include "nau/math/dag_frustum.h"
+
+namespace nau::bench
+{
+    namespace
+    {
+        math::NauFrustum makeFrustum()
+        {
+            using namespace nau::math;
+
+            const Matrix4 view = Matrix4::lookAtRH(Point3{0.f, 2.f, 10.f}, Point3{0.f, 0.f, 0.f}, Vector3{0.f, 1.f, 0.f});
+            const Matrix4 proj = Matrix4::perspectiveRH(1.2f, 16.f / 9.f, 0.1f, 100.f);
+            return NauFrustum{proj * view};
+        }
+
+        // Dense grid around the camera, about the half of the spheres is visible.
+        eastl::vector<math::BSphere3> makeSpheres(size_t count)
+        {
+            eastl::vector<math::BSphere3> spheres;
+            spheres.reserve(count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                const float x = static_cast<float>(i % 64) * 1.5f - 48.f;
+                const float z = static_cast<float>(i / 64) * 1.5f - 90.f;
+                spheres.emplace_back(math::Vector3{x, 0.f, z}, 0.5f);
+            }
+            return spheres;
+        }
+    }  // namespace
+
+    // One testSphere() call per sphere: the culling cost before the batched test.
+    NAU_BENCHMARK(FrustumTestSphere, 1024, 16384)
+    {
+        const math::NauFrustum frustum = makeFrustum();
+        const eastl::vector<math::BSphere3> spheres = makeSpheres(static_cast<size_t>(state.getArg()));
+        while (state.keepRunning())
+        {
+            uint32_t visibleCount = 0;
+            for (const math::BSphere3& sphere : spheres)
+            {
+                visibleCount += frustum.testSphere(sphere) != 0 ? 1 : 0;
+            }
+            doNotOptimize(visibleCount);
+        }
+        state.setItemsProcessed(state.getIterations() * spheres.size());
+    }
+
+    NAU_BENCHMARK(FrustumTestSpheres, 1024, 16384)
+    {
+        const math::NauFrustum frustum = makeFrustum();
+        const eastl::vector<math::BSphere3> spheres = makeSpheres(static_cast<size_t>(state.getArg()));
+        eastl::vector<uint32_t> mask(math::NauFrustum::getVisibleMaskSize(spheres.size()));
+        while (state.keepRunning())
+        {
+            frustum.testSpheres(spheres, mask);
+            doNotOptimize(mask.data());
+        }
+        state.setItemsProcessed(state.getIterations() * spheres.size());
+    }
+
+}  // namespace nau::bench
@@ -0,0 +1,48 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#include <string>
+
+#include "benchmark.h"
+#include "nau/string/hash_string.h"
+
+namespace nau::bench
+{
+    namespace
+    {
+        std::string makeString(size_t length)
+        {
+            std::string str;
+            str.reserve(length);
+            for (size_t i = 0; i < length; ++i)
+            {
+                str.push_back(static_cast<char>('a' + (i % 26)));
+            }
+            return str;
+        }
+    }  // namespace
+
+    // Hash function only.
+    NAU_BENCHMARK(HashStringConstHash, 8, 32, 128, 1024)
+    {
+        const std::string str = makeString(static_cast<size_t>(state.getArg()));
+        while (state.keepRunning())
+        {
+            doNotOptimize(hash_string::constHash(reinterpret_cast<const char8_t*>(str.c_str()), str.size()));
+        }
+        state.setBytesProcessed(state.getIterations() * str.size());
+    }
+
+    // hash_string construction: string copy + hash.
+    NAU_BENCHMARK(HashStringConstruct, 8, 32, 128, 1024)
+    {
+        const std::string str = makeString(static_cast<size_t>(state.getArg()));
+        while (state.keepRunning())
+        {
+            const hash_string hashString{string{str}};
+            doNotOptimize(hashString.toHash());
+        }
+        state.setBytesProcessed(state.getIterations() * str.size());
+    }
+
+}  // namespace nau::bench
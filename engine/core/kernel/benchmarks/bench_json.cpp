@@ -0,0 +1,91 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#include <string>
+
+#include "benchmark.h"
+#include "nau/io/memory_stream.h"
+#include "nau/io/stream_utils.h"
+#include "nau/serialization/json.h"
+
+namespace nau::bench
+{
+    namespace
+    {
+        // Scene-like document: array of the entities with the nested values.
+        std::string makeJsonDocument(size_t entitiesCount)
+        {
+            std::string json = "{\"version\": 3, \"entities\": [";
+            for (size_t i = 0; i < entitiesCount; ++i)
+            {
+                if (i > 0)
+                {
+                    json += ",";
+                }
+
+                const std::string index = std::to_string(i);
+                json += "{\"id\": " + index;
+                json += ", \"name\": \"entity_" + index + "\"";
+                json += ", \"enabled\": " + std::string{i % 3 == 0 ? "false" : "true"};
+                json += ", \"position\": [" + index + ".5, -1.25, 100.0]";
+                json += ", \"tags\": [\"static\", \"render\", \"physics\"]";
+                json += ", \"component\": {\"type\": \"MeshComponent\", \"mesh\": \"file:/content/mesh_" + index + ".gltf\", \"scale\": 1.0}}";
+            }
+            json += "]}";
+            return json;
+        }
+
+        eastl::span<const std::byte> asBytes(const std::string& str)
+        {
+            return {reinterpret_cast<const std::byte*>(str.data()), str.size()};
+        }
+    }  // namespace
+
+    NAU_BENCHMARK(JsonParse, 16, 256, 4096)
+    {
+        const std::string json = makeJsonDocument(static_cast<size_t>(state.getArg()));
+        const io::IMemoryStream::Ptr stream = io::createReadonlyMemoryStream(asBytes(json));
+
+        while (state.keepRunning())
+        {
+            stream->setPosition(io::OffsetOrigin::Begin, 0);
+
+            Result<RuntimeValue::Ptr> value = serialization::jsonParse(stream->as<io::IStreamReader&>());
+            if (!value)
+            {
+                state.setError("jsonParse failed");
+                return;
+            }
+            doNotOptimize(*value);
+        }
+        state.setBytesProcessed(state.getIterations() * json.size());
+    }
+
+    NAU_BENCHMARK(JsonWrite, 16, 256, 4096)
+    {
+        const std::string json = makeJsonDocument(static_cast<size_t>(state.getArg()));
+        Result<RuntimeValue::Ptr> value = serialization::jsonParseString(eastl::string_view{json.data(), json.size()});
+        if (!value)
+        {
+            state.setError("jsonParseString failed");
+            return;
+        }
+
+        eastl::string buffer;
+        buffer.reserve(json.size() * 2);
+
+        while (state.keepRunning())
+        {
+            buffer.clear();
+            io::InplaceStringWriter<char> writer{buffer};
+            if (!serialization::jsonWrite(writer, *value))
+            {
+                state.setError("jsonWrite failed");
+                return;
+            }
+            doNotOptimize(buffer.data());
+        }
+        state.setBytesProcessed(state.getIterations() * buffer.size());
+    }
+
+}  // namespace nau::bench
@@ -0,0 +1,130 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "benchmark.h"
+#include "nau/memory/general_allocator.h"
+#include "nau/memory/mem_allocator.h"
+
+namespace nau::bench
+{
+    namespace
+    {
+        constexpr size_t BatchSize = 1024;
+
+        struct SystemAllocator
+        {
+            void* allocate(size_t size)
+            {
+                return ::malloc(size);
+            }
+
+            void deallocate(void* ptr)
+            {
+                ::free(ptr);
+            }
+        };
+
+        struct NauAllocator
+        {
+            IMemAllocator& allocator;
+
+            void* allocate(size_t size)
+            {
+                return allocator.allocate(size);
+            }
+
+            void deallocate(void* ptr)
+            {
+                allocator.deallocate(ptr);
+            }
+        };
+
+        std::vector<size_t> makeBatchSizes()
+        {
+            // Fixed seed: every run (and every allocator) gets the same sizes sequence.
+            std::mt19937 random{1234};
+            std::uniform_int_distribution<size_t> distribution{8, 512};
+
+            std::vector<size_t> sizes(BatchSize);
+            for (size_t& size : sizes)
+            {
+                size = distribution(random);
+            }
+            return sizes;
+        }
+
+        template <typename Allocator>
+        void runAllocFree(State& state, Allocator allocator)
+        {
+            const size_t size = static_cast<size_t>(state.getArg());
+            while (state.keepRunning())
+            {
+                void* const ptr = allocator.allocate(size);
+                doNotOptimize(ptr);
+                allocator.deallocate(ptr);
+            }
+            state.setItemsProcessed(state.getIterations());
+        }
+
+        // Allocates the batch of the different sizes, then releases it in the allocation order.
+        template <typename Allocator>
+        void runAllocBatch(State& state, Allocator allocator)
+        {
+            const std::vector<size_t> sizes = makeBatchSizes();
+            std::vector<void*> blocks(BatchSize);
+
+            while (state.keepRunning())
+            {
+                for (size_t i = 0; i < BatchSize; ++i)
+                {
+                    blocks[i] = allocator.allocate(sizes[i]);
+                }
+
+                doNotOptimize(blocks.data());
+
+                for (void* const block : blocks)
+                {
+                    allocator.deallocate(block);
+                }
+            }
+            state.setItemsProcessed(state.getIterations() * BatchSize);
+        }
+    }  // namespace
+
+    NAU_BENCHMARK(AllocFreeSystem, 16, 64, 256, 1024, 4096)
+    {
+        runAllocFree(state, SystemAllocator{});
+    }
+
+    NAU_BENCHMARK(AllocFreeGeneral, 16, 64, 256, 1024, 4096)
+    {
+        GeneralAllocator generalAllocator;
+        runAllocFree(state, NauAllocator{generalAllocator});
+    }
+
+    NAU_BENCHMARK(AllocFreeDefault, 16, 64, 256, 1024, 4096)
+    {
+        runAllocFree(state, NauAllocator{*getDefaultAllocator()});
+    }
+
+    NAU_BENCHMARK(AllocBatchSystem)
+    {
+        runAllocBatch(state, SystemAllocator{});
+    }
+
+    NAU_BENCHMARK(AllocBatchGeneral)
+    {
+        GeneralAllocator generalAllocator;
+        runAllocBatch(state, NauAllocator{generalAllocator});
+    }
+
+    NAU_BENCHMARK(AllocBatchDefault)
+    {
+        runAllocBatch(state, NauAllocator{*getDefaultAllocator()});
+    }
+
+}  // namespace nau::bench
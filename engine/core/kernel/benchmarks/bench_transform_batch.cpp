@@ -0,0 +1,75 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#include <EASTL/vector.h>
+
+#include "benchmark.h"
+#include "nau/math/transform_batch.h"
+
+namespace nau::bench
+{
+    namespace
+    {
+        eastl::vector<math::Transform> makeTransforms(size_t count)
+        {
+            eastl::vector<math::Transform> transforms;
+            transforms.reserve(count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                const float f = static_cast<float>(i);
+                transforms.emplace_back(math::Quat::rotationY(f * 0.01f), math::Vector3{f, 1.f, -f}, math::Vector3{1.f + f * 0.001f, 1.f, 1.f});
+            }
+            return transforms;
+        }
+
+        eastl::vector<math::Matrix4> makeMatrices(size_t count)
+        {
+            const eastl::vector<math::Transform> transforms = makeTransforms(count);
+            eastl::vector<math::Matrix4> matrices(count);
+            math::transformsToMatrices(transforms, matrices);
+            return matrices;
+        }
+    }  // namespace
+
+    // The normal matrices through the full 4x4 inverse: the cost before the batched kernel.
+    NAU_BENCHMARK(NormalMatrixInverse, 1024, 16384)
+    {
+        const eastl::vector<math::Matrix4> matrices = makeMatrices(static_cast<size_t>(state.getArg()));
+        eastl::vector<math::Matrix4> normalMatrices(matrices.size());
+        while (state.keepRunning())
+        {
+            for (size_t i = 0; i < matrices.size(); ++i)
+            {
+                normalMatrices[i] = math::transpose(math::inverse(matrices[i]));
+            }
+            doNotOptimize(normalMatrices.data());
+        }
+        state.setItemsProcessed(state.getIterations() * matrices.size());
+    }
+
+    NAU_BENCHMARK(NormalMatrixInverseTransposeAffine, 1024, 16384)
+    {
+        const eastl::vector<math::Matrix4> matrices = makeMatrices(static_cast<size_t>(state.getArg()));
+        eastl::vector<math::Matrix4> normalMatrices(matrices.size());
+        while (state.keepRunning())
+        {
+            math::inverseTransposeAffine(matrices, normalMatrices);
+            doNotOptimize(normalMatrices.data());
+        }
+        state.setItemsProcessed(state.getIterations() * matrices.size());
+    }
+
+    NAU_BENCHMARK(TransformHierarchyMultiply, 1024, 16384)
+    {
+        const math::Transform parent{math::Quat::rotationX(0.5f), math::Vector3{1.f, 2.f, 3.f}, math::Vector3{2.f, 2.f, 2.f}};
+        const eastl::vector<math::Transform> locals = makeTransforms(static_cast<size_t>(state.getArg()));
+        eastl::vector<math::Transform> worlds(locals.size());
+        while (state.keepRunning())
+        {
+            math::multiplyTransforms(parent, locals, worlds);
+            doNotOptimize(worlds.data());
+        }
+        state.setItemsProcessed(state.getIterations() * locals.size());
+    }
+
+}  // namespace nau::bench
@@ -0,0 +1,110 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#include <string>
+#include <vector>
+
+#include "benchmark.h"
+#include "nau/io/virtual_file_system.h"
+#include "nau/rtti/rtti_impl.h"
+
+namespace nau::bench
+{
+    namespace
+    {
+        /**
+            File system that reports any path as existing: measured time is the virtual file system path resolution only.
+        */
+        class NullFileSystem final : public io::IFileSystem
+        {
+            NAU_CLASS_(nau::bench::NullFileSystem, io::IFileSystem)
+
+        public:
+            bool isReadOnly() const override
+            {
+                return true;
+            }
+
+            bool exists(const io::FsPath&, std::optional<io::FsEntryKind>) override
+            {
+                return true;
+            }
+
+            size_t getLastWriteTime(const io::FsPath&) override
+            {
+                return 0;
+            }
+
+            io::IFile::Ptr openFile(const io::FsPath&, io::AccessModeFlag, io::OpenFileMode) override
+            {
+                return nullptr;
+            }
+
+            OpenDirResult openDirIterator(const io::FsPath&) override
+            {
+                return NauMakeError("Not supported");
+            }
+
+            void closeDirIterator(void*) override
+            {
+            }
+
+            io::FsEntry incrementDirIterator(void*) override
+            {
+                return {};
+            }
+        };
+
+        // Typical application mount layout: the content (overridden by the second file system), resources, packs and the per-module content.
+        // Mount points are the leaf nodes only: the virtual file system does not allow nested mounts.
+        io::IVirtualFileSystem::Ptr createBenchVirtualFileSystem()
+        {
+            io::IVirtualFileSystem::Ptr vfs = io::createVirtualFileSystem();
+            vfs->mount("/content", rtti::createInstance<NullFileSystem, io::IFileSystem>()).ignore();
+            vfs->mount("/content", rtti::createInstance<NullFileSystem, io::IFileSystem>(), 2).ignore();
+            vfs->mount("/res", rtti::createInstance<NullFileSystem, io::IFileSystem>()).ignore();
+            vfs->mount("/packs/base", rtti::createInstance<NullFileSystem, io::IFileSystem>()).ignore();
+
+            for (int i = 0; i < 16; ++i)
+            {
+                vfs->mount(io::FsPath{"/modules"} / ("module_" + std::to_string(i)), rtti::createInstance<NullFileSystem, io::IFileSystem>()).ignore();
+            }
+
+            return vfs;
+        }
+
+        void runVfsExists(State& state, const std::vector<io::FsPath>& paths)
+        {
+            const io::IVirtualFileSystem::Ptr vfs = createBenchVirtualFileSystem();
+            while (state.keepRunning())
+            {
+                for (const io::FsPath& path : paths)
+                {
+                    doNotOptimize(vfs->exists(path));
+                }
+            }
+            state.setItemsProcessed(state.getIterations() * paths.size());
+        }
+    }  // namespace
+
+    NAU_BENCHMARK(VfsExistsShallowPath)
+    {
+        runVfsExists(state, {"/content/config.json", "/res/shader.bin", "/modules/module_7/module.blk"});
+    }
+
+    NAU_BENCHMARK(VfsExistsDeepPath)
+    {
+        runVfsExists(state, {
+                                "/content/scenes/levels/city/district_02/buildings/tower_a/lod0/mesh.gltf",
+                                "/content/textures/ui/hud/icons/inventory/weapons/rifle_64x64.dds",
+                                "/modules/module_15/content/prefabs/characters/enemies/boss/materials/skin.mat",
+                            });
+    }
+
+    // Path resolution stops at the node without the mounted file system.
+    NAU_BENCHMARK(VfsExistsNotMounted)
+    {
+        runVfsExists(state, {"/unknown/path/to/the/file.bin", "/modules/module_99/file.bin"});
+    }
+
+}  // namespace nau::bench
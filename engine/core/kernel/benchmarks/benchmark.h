@@ -0,0 +1,205 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+/**
+ * @file benchmark.h
+ * @brief Minimal micro-benchmark harness used by the nau_kernel_benchmarks target.
+ *
+ * Benchmark is a function that repeats the measured code while State::keepRunning() returns true:
+ * @code
+ *  NAU_BENCHMARK(HashString, 16, 256)
+ *  {
+ *      const std::string str(state.getArg(), 'a');
+ *      while (state.keepRunning())
+ *      {
+ *          nau::bench::doNotOptimize(hash(str));
+ *      }
+ *      state.setBytesProcessed(state.getIterations() * str.size());
+ *  }
+ * @endcode
+ * The runner increases the iterations count until the run takes at least the minimal time,
+ * then repeats the run several times and reports the statistics (see benchmark_runner.cpp).
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <initializer_list>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "nau/utils/preprocessor.h"
+
+#if defined(_MSC_VER) && !defined(__clang__)
+    #include <intrin.h>
+#endif
+
+namespace nau::bench
+{
+    /**
+     * @brief Controls the single run of the benchmark: iterations count, timer and the reported counters.
+     */
+    class State
+    {
+    public:
+        State(uint64_t iterations, std::optional<int64_t> arg) :
+            m_iterations(iterations),
+            m_arg(arg)
+        {
+        }
+
+        State(const State&) = delete;
+        State& operator=(const State&) = delete;
+
+        /**
+         * @brief Starts the timer on the first call, stops it after the last iteration.
+         * @return true while there are iterations to run.
+         */
+        bool keepRunning()
+        {
+            if (m_counter == 0)
+            {
+                m_startTime = Clock::now();
+            }
+
+            if (m_counter++ < m_iterations)
+            {
+                return true;
+            }
+
+            if (!m_isPaused)
+            {
+                m_elapsed += Clock::now() - m_startTime;
+            }
+            return false;
+        }
+
+        /**
+         * @brief Excludes the setup code from the measured time. Must be followed by resumeTiming().
+         */
+        void pauseTiming()
+        {
+            m_elapsed += Clock::now() - m_startTime;
+            m_isPaused = true;
+        }
+
+        void resumeTiming()
+        {
+            m_isPaused = false;
+            m_startTime = Clock::now();
+        }
+
+        uint64_t getIterations() const
+        {
+            return m_iterations;
+        }
+
+        /**
+         * @brief Gets the benchmark argument (the benchmark is registered with the arguments list).
+         */
+        int64_t getArg() const
+        {
+            return m_arg.value_or(0);
+        }
+
+        void setItemsProcessed(uint64_t items)
+        {
+            m_itemsProcessed = items;
+        }
+
+        void setBytesProcessed(uint64_t bytes)
+        {
+            m_bytesProcessed = bytes;
+        }
+
+        /**
+         * @brief Marks the run as failed: the result is reported with the error and does not take part in the comparison.
+         */
+        void setError(std::string message)
+        {
+            m_error = std::move(message);
+        }
+
+        std::chrono::nanoseconds getElapsedTime() const
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(m_elapsed);
+        }
+
+        uint64_t getItemsProcessed() const
+        {
+            return m_itemsProcessed;
+        }
+
+        uint64_t getBytesProcessed() const
+        {
+            return m_bytesProcessed;
+        }
+
+        const std::optional<std::string>& getError() const
+        {
+            return m_error;
+        }
+
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        const uint64_t m_iterations;
+        const std::optional<int64_t> m_arg;
+        uint64_t m_counter = 0;
+        Clock::time_point m_startTime;
+        Clock::duration m_elapsed{0};
+        bool m_isPaused = false;
+        uint64_t m_itemsProcessed = 0;
+        uint64_t m_bytesProcessed = 0;
+        std::optional<std::string> m_error;
+    };
+
+    using BenchmarkFunc = void (*)(State&);
+
+    struct BenchmarkInfo
+    {
+        const char* name;
+        BenchmarkFunc func;
+        std::vector<int64_t> args;
+    };
+
+    /**
+     * @brief Gets all benchmarks registered with NAU_BENCHMARK (in registration order within the each translation unit).
+     */
+    std::vector<BenchmarkInfo>& getRegisteredBenchmarks();
+
+    struct BenchmarkRegistration
+    {
+        BenchmarkRegistration(const char* name, BenchmarkFunc func, std::initializer_list<int64_t> args)
+        {
+            getRegisteredBenchmarks().push_back({name, func, std::vector<int64_t>{args}});
+        }
+    };
+
+    /**
+     * @brief Prevents the compiler from optimizing out the computation of the value.
+     */
+    template <typename T>
+    inline void doNotOptimize(const T& value)
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        static_cast<void>(*static_cast<const volatile char*>(static_cast<const volatile void*>(&value)));
+        _ReadWriteBarrier();
+#else
+        asm volatile("" : : "r,m"(value) : "memory");
+#endif
+    }
+
+}  // namespace nau::bench
+
+/**
+ * @brief Defines and registers the benchmark. Optional arguments are the values of State::getArg():
+ * the benchmark is run separately for each of them.
+ */
+#define NAU_BENCHMARK(Name, ...)                                                                           \
+    static void Name(::nau::bench::State&);                                                                \
+    static const ::nau::bench::BenchmarkRegistration ANONYMOUS_VAR(benchmarkRegistration__){#Name, &Name, \
+                                                                                           {__VA_ARGS__}}; \
+    static void Name([[maybe_unused]] ::nau::bench::State& state)
@@ -0,0 +1,489 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+/**
+    nau_kernel_benchmarks [options]
+        --filter=<regex>        run only benchmarks which full name (Name/Arg) matches the regex
+        --min-time=<seconds>    minimal duration of the single repetition (default 0.5)
+        --repetitions=<count>   repetitions count, statistics are computed over them (default 5)
+        --json=<path>           write machine-readable results into the file
+        --label=<text>          label stored in the results context (i.e. engine drop name)
+        --baseline=<path>       compare with the previous results (json written with --json)
+        --threshold=<percent>   allowed slowdown against the baseline (default 10)
+        --list                  print benchmark names and exit
+
+    Exit code is non zero if any benchmark failed or regressed against the baseline.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <regex>
+#include <sstream>
+#include <thread>
+
+#include "benchmark.h"
+#include "nau/async/executor.h"
+#include "nau/async/thread_pool_executor.h"
+#include "nau/io/stream_utils.h"
+#include "nau/serialization/json.h"
+
+namespace nau::bench
+{
+    namespace
+    {
+        constexpr unsigned ResultsFormatVersion = 1;
+
+        struct Options
+        {
+            std::optional<std::regex> filter;
+            double minTimeSeconds = 0.5;
+            unsigned repetitions = 5;
+            std::string jsonPath;
+            std::string label;
+            std::string baselinePath;
+            double thresholdPercent = 10.0;
+            bool listOnly = false;
+        };
+
+        struct BenchmarkResult
+        {
+            std::string name;
+            uint64_t iterations = 0;
+            // Per iteration time of the each repetition.
+            std::vector<double> timesNs;
+            double itemsPerSecond = 0;
+            double bytesPerSecond = 0;
+            std::optional<std::string> error;
+
+            double getMedianNs() const
+            {
+                std::vector<double> sorted = timesNs;
+                std::sort(sorted.begin(), sorted.end());
+                const size_t middle = sorted.size() / 2;
+                return (sorted.size() % 2 == 0) ? (sorted[middle - 1] + sorted[middle]) * 0.5 : sorted[middle];
+            }
+
+            double getMinNs() const
+            {
+                return *std::min_element(timesNs.begin(), timesNs.end());
+            }
+
+            double getMeanNs() const
+            {
+                double sum = 0;
+                for (const double time : timesNs)
+                {
+                    sum += time;
+                }
+                return sum / static_cast<double>(timesNs.size());
+            }
+
+            double getStdDevNs() const
+            {
+                const double mean = getMeanNs();
+                double sum = 0;
+                for (const double time : timesNs)
+                {
+                    sum += (time - mean) * (time - mean);
+                }
+                return timesNs.size() > 1 ? std::sqrt(sum / static_cast<double>(timesNs.size() - 1)) : 0.0;
+            }
+        };
+
+        std::optional<std::string_view> getOptionValue(std::string_view arg, std::string_view option)
+        {
+            if (arg.size() > option.size() && arg.substr(0, option.size()) == option && arg[option.size()] == '=')
+            {
+                return arg.substr(option.size() + 1);
+            }
+            return std::nullopt;
+        }
+
+        bool parseOptions(int argc, char** argv, Options& options)
+        {
+            for (int i = 1; i < argc; ++i)
+            {
+                const std::string_view arg = argv[i];
+                if (const auto value = getOptionValue(arg, "--filter"))
+                {
+                    options.filter.emplace(std::string{*value});
+                }
+                else if (const auto value = getOptionValue(arg, "--min-time"))
+                {
+                    options.minTimeSeconds = std::stod(std::string{*value});
+                }
+                else if (const auto value = getOptionValue(arg, "--repetitions"))
+                {
+                    options.repetitions = std::max(1, std::stoi(std::string{*value}));
+                }
+                else if (const auto value = getOptionValue(arg, "--json"))
+                {
+                    options.jsonPath = *value;
+                }
+                else if (const auto value = getOptionValue(arg, "--label"))
+                {
+                    options.label = *value;
+                }
+                else if (const auto value = getOptionValue(arg, "--baseline"))
+                {
+                    options.baselinePath = *value;
+                }
+                else if (const auto value = getOptionValue(arg, "--threshold"))
+                {
+                    options.thresholdPercent = std::stod(std::string{*value});
+                }
+                else if (arg == "--list")
+                {
+                    options.listOnly = true;
+                }
+                else
+                {
+                    fprintf(stderr, "Unknown option: (%s)\n", argv[i]);
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        std::string makeBenchmarkName(const BenchmarkInfo& info, std::optional<int64_t> arg)
+        {
+            return arg ? std::string{info.name} + "/" + std::to_string(*arg) : std::string{info.name};
+        }
+
+        BenchmarkResult runBenchmark(const BenchmarkInfo& info, std::optional<int64_t> arg, const Options& options)
+        {
+            using namespace std::chrono;
+
+            BenchmarkResult result;
+            result.name = makeBenchmarkName(info, arg);
+
+            const nanoseconds minTime = duration_cast<nanoseconds>(duration<double>{options.minTimeSeconds});
+
+            // Calibration: grow the iterations count until the run is long enough.
+            uint64_t iterations = 1;
+            constexpr uint64_t MaxIterations = 1'000'000'000;
+            for (;;)
+            {
+                State state{iterations, arg};
+                info.func(state);
+                if (state.getError())
+                {
+                    result.error = state.getError();
+                    return result;
+                }
+
+                const nanoseconds elapsed = state.getElapsedTime();
+                if (elapsed >= minTime || iterations >= MaxIterations)
+                {
+                    break;
+                }
+
+                // Predict the required iterations count with some margin, but do not grow too fast on the very short runs.
+                const double ratio = elapsed.count() > 0 ? static_cast<double>(minTime.count()) / static_cast<double>(elapsed.count()) : 10.0;
+                const double multiplier = std::clamp(ratio * 1.4, 2.0, 10.0);
+                iterations = std::min(MaxIterations, static_cast<uint64_t>(static_cast<double>(iterations) * multiplier));
+            }
+
+            result.iterations = iterations;
+
+            double totalSeconds = 0;
+            uint64_t totalItems = 0;
+            uint64_t totalBytes = 0;
+
+            for (unsigned i = 0; i < options.repetitions; ++i)
+            {
+                State state{iterations, arg};
+                info.func(state);
+                if (state.getError())
+                {
+                    result.error = state.getError();
+                    return result;
+                }
+
+                const double elapsedNs = static_cast<double>(state.getElapsedTime().count());
+                result.timesNs.push_back(elapsedNs / static_cast<double>(iterations));
+                totalSeconds += elapsedNs * 1e-9;
+                totalItems += state.getItemsProcessed();
+                totalBytes += state.getBytesProcessed();
+            }
+
+            if (totalSeconds > 0)
+            {
+                result.itemsPerSecond = static_cast<double>(totalItems) / totalSeconds;
+                result.bytesPerSecond = static_cast<double>(totalBytes) / totalSeconds;
+            }
+
+            return result;
+        }
+
+        void printHeader()
+        {
+            printf("%-48s %14s %14s %10s %14s %12s\n", "Benchmark", "Median, ns", "Min, ns", "StdDev %", "Iterations", "Items/s");
+            printf("%s\n", std::string(117, '-').c_str());
+        }
+
+        void printResult(const BenchmarkResult& result)
+        {
+            if (result.error)
+            {
+                printf("%-48s ERROR: %s\n", result.name.c_str(), result.error->c_str());
+                return;
+            }
+
+            const double median = result.getMedianNs();
+            const double stdDevPercent = median > 0 ? result.getStdDevNs() / median * 100.0 : 0.0;
+            printf("%-48s %14.1f %14.1f %10.1f %14llu %12.4g\n", result.name.c_str(), median, result.getMinNs(), stdDevPercent,
+                   static_cast<unsigned long long>(result.iterations), result.itemsPerSecond);
+        }
+
+        std::string getCurrentDateString()
+        {
+            const std::time_t now = std::time(nullptr);
+            std::tm localTime{};
+#ifdef _MSC_VER
+            localtime_s(&localTime, &now);
+#else
+            localtime_r(&now, &localTime);
+#endif
+            char buffer[64];
+            std::strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%S", &localTime);
+            return buffer;
+        }
+
+        Json::Value makeResultsJson(const std::vector<BenchmarkResult>& results, const Options& options)
+        {
+            Json::Value root{Json::objectValue};
+
+            Json::Value& context = root["context"];
+            context["format_version"] = ResultsFormatVersion;
+            context["date"] = getCurrentDateString();
+            context["label"] = options.label;
+            context["num_cpus"] = std::thread::hardware_concurrency();
+            context["repetitions"] = options.repetitions;
+            context["min_time_s"] = options.minTimeSeconds;
+#ifdef NDEBUG
+            context["build_type"] = "release";
+#else
+            context["build_type"] = "debug";
+#endif
+
+            Json::Value& benchmarks = root["benchmarks"];
+            benchmarks = Json::Value{Json::arrayValue};
+
+            for (const BenchmarkResult& result : results)
+            {
+                Json::Value entry{Json::objectValue};
+                entry["name"] = result.name;
+                if (result.error)
+                {
+                    entry["error"] = *result.error;
+                }
+                else
+                {
+                    entry["iterations"] = Json::UInt64{result.iterations};
+                    entry["time_unit"] = "ns";
+                    entry["median_time"] = result.getMedianNs();
+                    entry["min_time"] = result.getMinNs();
+                    entry["mean_time"] = result.getMeanNs();
+                    entry["stddev_time"] = result.getStdDevNs();
+                    if (result.itemsPerSecond > 0)
+                    {
+                        entry["items_per_second"] = result.itemsPerSecond;
+                    }
+                    if (result.bytesPerSecond > 0)
+                    {
+                        entry["bytes_per_second"] = result.bytesPerSecond;
+                    }
+                }
+
+                benchmarks.append(std::move(entry));
+            }
+
+            return root;
+        }
+
+        bool writeResultsJson(const std::vector<BenchmarkResult>& results, const Options& options)
+        {
+            eastl::string buffer;
+            io::InplaceStringWriter<char> writer{buffer};
+            if (!serialization::jsonWrite(writer, makeResultsJson(results, options), serialization::JsonSettings{.pretty = true}))
+            {
+                fprintf(stderr, "Fail to serialize the results\n");
+                return false;
+            }
+
+            std::ofstream file{options.jsonPath, std::ios::binary | std::ios::trunc};
+            file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            if (!file)
+            {
+                fprintf(stderr, "Fail to write the results: (%s)\n", options.jsonPath.c_str());
+                return false;
+            }
+
+            return true;
+        }
+
+        /**
+            Compares the median times with the baseline, prints the difference.
+            Returns false if any benchmark is slower than baseline by more than the threshold.
+        */
+        bool compareWithBaseline(const std::vector<BenchmarkResult>& results, const Options& options)
+        {
+            std::ifstream file{options.baselinePath, std::ios::binary};
+            if (!file)
+            {
+                fprintf(stderr, "Can not open the baseline: (%s)\n", options.baselinePath.c_str());
+                return false;
+            }
+
+            const std::string content{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+            Result<Json::Value> baseline = serialization::jsonParseToValue(eastl::string_view{content.data(), content.size()});
+            if (!baseline || !(*baseline)["benchmarks"].isArray())
+            {
+                fprintf(stderr, "Invalid baseline: (%s)\n", options.baselinePath.c_str());
+                return false;
+            }
+
+            std::map<std::string, double> baselineTimes;
+            for (const Json::Value& entry : (*baseline)["benchmarks"])
+            {
+                if (entry["median_time"].isNumeric())
+                {
+                    baselineTimes[entry["name"].asString()] = entry["median_time"].asDouble();
+                }
+            }
+
+            printf("\nComparison with baseline (%s), threshold %.1f%%:\n", options.baselinePath.c_str(), options.thresholdPercent);
+            printf("%-48s %14s %14s %10s\n", "Benchmark", "Baseline, ns", "Current, ns", "Change %");
+
+            bool noRegressions = true;
+            for (const BenchmarkResult& result : results)
+            {
+                const auto baselineTime = baselineTimes.find(result.name);
+                if (result.error || baselineTime == baselineTimes.end() || baselineTime->second <= 0)
+                {
+                    continue;
+                }
+
+                const double current = result.getMedianNs();
+                const double changePercent = (current - baselineTime->second) / baselineTime->second * 100.0;
+                const bool isRegression = changePercent > options.thresholdPercent;
+                noRegressions = noRegressions && !isRegression;
+
+                printf("%-48s %14.1f %14.1f %+10.1f%s\n", result.name.c_str(), baselineTime->second, current, changePercent, isRegression ? "  REGRESSION" : "");
+            }
+
+            return noRegressions;
+        }
+
+        /**
+            Async benchmarks (continuations, whenAll) require the default executor.
+        */
+        class BenchmarkRuntime
+        {
+        public:
+            BenchmarkRuntime() :
+                m_defaultExecutor(async::createThreadPoolExecutor("Benchmark Pool"))
+            {
+                async::Executor::setDefault(m_defaultExecutor);
+            }
+
+            ~BenchmarkRuntime()
+            {
+                m_defaultExecutor->waitAnyActivity();
+                async::Executor::setDefault(nullptr);
+            }
+
+        private:
+            async::Executor::Ptr m_defaultExecutor;
+        };
+    }  // namespace
+
+    std::vector<BenchmarkInfo>& getRegisteredBenchmarks()
+    {
+        static std::vector<BenchmarkInfo> benchmarks;
+        return benchmarks;
+    }
+
+}  // namespace nau::bench
+
+int main(int argc, char** argv)
+{
+    using namespace nau::bench;
+
+    Options options;
+    if (!parseOptions(argc, argv, options))
+    {
+        return 2;
+    }
+
+    std::vector<BenchmarkInfo> benchmarks = getRegisteredBenchmarks();
+    std::stable_sort(benchmarks.begin(), benchmarks.end(), [](const BenchmarkInfo& left, const BenchmarkInfo& right)
+    {
+        return std::string_view{left.name} < std::string_view{right.name};
+    });
+
+    // Empty arguments list means that the benchmark is run once, without argument.
+    std::vector<std::pair<const BenchmarkInfo*, std::optional<int64_t>>> runs;
+    for (const BenchmarkInfo& info : benchmarks)
+    {
+        std::vector<std::optional<int64_t>> args{info.args.begin(), info.args.end()};
+        if (args.empty())
+        {
+            args.emplace_back(std::nullopt);
+        }
+
+        for (const std::optional<int64_t>& arg : args)
+        {
+            if (!options.filter || std::regex_search(makeBenchmarkName(info, arg), *options.filter))
+            {
+                runs.emplace_back(&info, arg);
+            }
+        }
+    }
+
+    if (options.listOnly)
+    {
+        for (const auto& [info, arg] : runs)
+        {
+            printf("%s\n", makeBenchmarkName(*info, arg).c_str());
+        }
+        return 0;
+    }
+
+    std::vector<BenchmarkResult> results;
+    {
+        const BenchmarkRuntime runtime;
+
+        printHeader();
+        for (const auto& [info, arg] : runs)
+        {
+            results.push_back(runBenchmark(*info, arg, options));
+            printResult(results.back());
+            fflush(stdout);
+        }
+    }
+
+    bool success = std::none_of(results.begin(), results.end(), [](const BenchmarkResult& result)
+    {
+        return result.error.has_value();
+    });
+
+    if (!options.jsonPath.empty())
+    {
+        success = writeResultsJson(results, options) && success;
+    }
+
+    if (!options.baselinePath.empty())
+    {
+        success = compareWithBaseline(results, options) && success;
+    }
+
+    return success ? 0 : 1;
+}
@@ -7,13 +7,40 @@
 
 namespace nau
 {
+    /**
+     * The background work lanes: each lane has its own executor and concurrency limit,
+     * so the long background work can not starve the latency critical one.
+     */
+    enum class BackgroundWorkPriority
+    {
+        /**
+         * The work awaited by the frame (e.g. gameplay requested jobs).
+         */
+        LatencyCritical,
+
+        /**
+         * The default lane: the single ordered worker.
+         */
+        Normal,
+
+        /**
+         * The long CPU work that can be spread over several frames (texture compression, shader compilation).
+         */
+        Background,
+
+        /**
+         * The work blocked on the I/O (file reads): the lane is oversubscribed, its threads are mostly waiting.
+         */
+        BlockingIo
+    };
+
     struct NAU_ABSTRACT_TYPE BackgroundWorkService
     {
         NAU_TYPEID(nau::BackgroundWorkService)
 
         virtual ~BackgroundWorkService() = default;
 
-        virtual async::Executor::Ptr getExecutor() = 0;
+        virtual async::Executor::Ptr getExecutor(BackgroundWorkPriority priority = BackgroundWorkPriority::Normal) = 0;
     };
 
 }  // namespace nau
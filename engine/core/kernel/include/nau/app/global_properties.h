@@ -13,6 +13,7 @@
 #include <shared_mutex>
 #include <type_traits>
 
+#include "nau/dataBlock/ro_data_block_value.h"
 #include "nau/diag/logging.h"
 #include "nau/io/stream.h"
 #include "nau/memory/mem_allocator.h"
@@ -74,6 +75,13 @@ namespace nau
         */
         virtual Result<> mergeWithValue(const RuntimeValue& value) = 0;
 
+        /**
+            @brief adds the cooked properties (see saveRoDataBlock()): they are read from the block on access, no runtime value tree is built.
+
+            The properties set or merged from the other sources override the cooked ones, the later cooked properties override the earlier.
+        */
+        virtual void addCookedProperties(RoDataBlockPtr properties) = 0;
+
         /**
          */
         virtual void addVariableResolver(eastl::string_view kind, VariableResolverCallback resolver) = 0;
@@ -127,6 +135,11 @@ namespace nau
     */
     Result<> mergePropertiesFromStream(GlobalProperties& properties, io::IStreamReader& stream, eastl::string_view contentType = "application/json");
 
+    /**
+        @brief the content type of the cooked properties: the read-only data block dump (".roblk" files, see saveRoDataBlock()).
+    */
+    inline constexpr eastl::string_view CookedPropertiesContentType = "application/x-nau-roblk";
+
     /**
         @brief reads and parses a file, then applies all the properties it retrieves to the properties dictionary.
     */
@@ -3,6 +3,8 @@
 
 #pragma once
 #include <EASTL/optional.h>
+#include <EASTL/string_view.h>
+#include <EASTL/vector.h>
 
 #include <chrono>
 
@@ -39,6 +41,34 @@ namespace nau
      */
     NAU_DEFINE_ATTRIBUTE_(GameSystemName)
 
+    /**
+        The well known resources for GameUpdateAccess (any other name can be used as well).
+     */
+    namespace GameUpdateResource
+    {
+        inline constexpr eastl::string_view Transforms = "transforms";
+        inline constexpr eastl::string_view Cameras = "cameras";
+        inline constexpr eastl::string_view Input = "input";
+        inline constexpr eastl::string_view Audio = "audio";
+        inline constexpr eastl::string_view Ui = "ui";
+        inline constexpr eastl::string_view Assets = "assets";
+        inline constexpr eastl::string_view Telemetry = "telemetry";
+    }  // namespace GameUpdateResource
+
+    /**
+        Resources accessed by the game update hook.
+        The main loop runs the hooks with no conflicting accesses (write/write or read/write of the same resource) in parallel,
+        the conflicting hooks keep their registration order.
+     */
+    struct GameUpdateAccess
+    {
+        eastl::vector<eastl::string_view> reads;
+        eastl::vector<eastl::string_view> writes;
+
+        // The hook can be called from the job system threads (otherwise it is always called on the main thread)
+        bool isThreadSafe = false;
+    };
+
     struct NAU_ABSTRACT_TYPE IGamePreUpdate
     {
         NAU_TYPEID(nau::IGamePreUpdate)
@@ -46,6 +76,14 @@ namespace nau
         virtual ~IGamePreUpdate() = default;
 
         virtual void gamePreUpdate(std::chrono::milliseconds dt) = 0;
+
+        /**
+            nullopt: the hook can access anything, it is executed exclusively on the main thread.
+         */
+        virtual eastl::optional<GameUpdateAccess> getPreUpdateAccess() const
+        {
+            return eastl::nullopt;
+        }
     };
 
     struct NAU_ABSTRACT_TYPE IGamePostUpdate
@@ -55,6 +93,14 @@ namespace nau
         virtual ~IGamePostUpdate() = default;
 
         virtual void gamePostUpdate(std::chrono::milliseconds dt) = 0;
+
+        /**
+            nullopt: the hook can access anything, it is executed exclusively on the main thread.
+         */
+        virtual eastl::optional<GameUpdateAccess> getPostUpdateAccess() const
+        {
+            return eastl::nullopt;
+        }
     };
 
     /**
@@ -64,16 +110,30 @@ namespace nau
         NAU_TYPEID(nau::IGameSceneUpdate)
 
         /**
+            @param dt Time to simulate: exactly getFixedUpdateTimeStep() for the fixed step systems, the elapsed time otherwise.
+            @return false to stop the system updates.
          */
-        virtual async::Task<bool> update(std::chrono::milliseconds dt) = 0;
+        virtual async::Task<bool> update(std::chrono::microseconds dt) = 0;
 
         /**
+            Fixed step systems are updated at the constant rate (with the accumulated time catch-up),
+            the update is called repeatedly without a pause if nullopt is returned.
          */
-        virtual eastl::optional<std::chrono::milliseconds> getFixedUpdateTimeStep() = 0;
+        virtual eastl::optional<std::chrono::microseconds> getFixedUpdateTimeStep() = 0;
 
         /**
+            Called on the main thread after the update: copies the state produced by the update into the scene (or captures the scene state).
          */
         virtual void syncSceneState() = 0;
+
+        /**
+            If true, the next update is started without waiting for syncSceneState to complete (at most one sync is in flight).
+            The system must keep the state accessed by syncSceneState separate from the state used by its update (i.e. double-buffered).
+         */
+        virtual bool isSceneSyncPipelined() const
+        {
+            return false;
+        }
     };
 
 }  // namespace nau
@@ -0,0 +1,69 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <EASTL/string.h>
+#include <EASTL/string_view.h>
+#include <EASTL/vector.h>
+
+#include <chrono>
+
+#include "nau/kernel/kernel_config.h"
+
+namespace nau
+{
+    /**
+        The CPU (wall) time of the game system update: the main loop stages and the concurrent game systems.
+        The average and the max are over the last GameSystemTimings::SamplesCount updates.
+     */
+    struct GameSystemTimings
+    {
+        static constexpr size_t SamplesCount = 64;
+
+        eastl::string name;
+        uint64_t updatesCount = 0;
+        std::chrono::microseconds last{0};
+        std::chrono::microseconds average{0};
+        std::chrono::microseconds max{0};
+    };
+
+    /**
+        Reports the update time of the game system. Can be called from any thread.
+     */
+    NAU_KERNEL_EXPORT
+    void reportGameSystemTime(eastl::string_view name, std::chrono::microseconds time);
+
+    /**
+        Retrieves the timings of all the reported game systems in the order of their first report.
+     */
+    NAU_KERNEL_EXPORT
+    eastl::vector<GameSystemTimings> getGameSystemTimings();
+
+    /**
+        Measures the scope time and reports it with reportGameSystemTime.
+     */
+    class GameSystemTimeScope
+    {
+    public:
+        GameSystemTimeScope(eastl::string_view name) :
+            m_name(name),
+            m_startTime(std::chrono::steady_clock::now())
+        {
+        }
+
+        GameSystemTimeScope(const GameSystemTimeScope&) = delete;
+        GameSystemTimeScope& operator=(const GameSystemTimeScope&) = delete;
+
+        ~GameSystemTimeScope()
+        {
+            using namespace std::chrono;
+            reportGameSystemTime(m_name, duration_cast<microseconds>(steady_clock::now() - m_startTime));
+        }
+
+    private:
+        const eastl::string_view m_name;
+        const std::chrono::steady_clock::time_point m_startTime;
+    };
+}  // namespace nau
@@ -0,0 +1,56 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#pragma once
+#include <EASTL/string_view.h>
+#include <EASTL/vector.h>
+
+#include "nau/rtti/type_info.h"
+#include "nau/utils/enum/enum_reflection.h"
+
+namespace nau
+{
+    /**
+     */
+    NAU_DEFINE_ENUM_(
+        SessionRecorderMode,
+        Off,
+        Record,
+        Replay)
+
+    /**
+     * The session record/replay for the reproducible (perf regression) runs.
+     *
+     * The recorder captures the external inputs of the session (the input device states, the received network frames) per frame,
+     * the replay feeds them back at the same frames. Both the recording and the replay run the game step with the fixed timestep,
+     * and the wall frame times are captured alongside, so the same session can be compared between the builds.
+     *
+     * The service exists only when the session is configured with the "/app/session" property (see the application framework).
+     * The event sources (e.g. the input and the network) are identified by the channel name.
+     */
+    struct NAU_ABSTRACT_TYPE ISessionRecorder
+    {
+        NAU_TYPEID(nau::ISessionRecorder)
+
+        virtual ~ISessionRecorder() = default;
+
+        virtual SessionRecorderMode getMode() const = 0;
+
+        /**
+         * The index of the current game step from the start of the session.
+         */
+        virtual uint64_t getFrameIndex() const = 0;
+
+        /**
+         * Appends the event to the current frame. Must be called only in the Record mode and only from the main thread.
+         */
+        virtual void recordEvent(eastl::string_view channel, eastl::string_view payload) = 0;
+
+        /**
+         * Retrieves the payloads of the channel events recorded at the current frame (in the recording order).
+         * Must be called only in the Replay mode and only from the main thread, the views are valid until the end of the frame.
+         */
+        virtual eastl::vector<eastl::string_view> getReplayEvents(eastl::string_view channel) const = 0;
+    };
+
+}  // namespace nau
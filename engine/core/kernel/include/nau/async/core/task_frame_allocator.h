@@ -0,0 +1,30 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <cstddef>
+
+#include "nau/kernel/kernel_config.h"
+
+namespace nau::async_detail
+{
+    /**
+        @brief Allocates storage for the task state or coroutine frame.
+
+        Small blocks are taken from the per-thread size class free lists (without any synchronization),
+        blocks that are too large for pooling go directly to the global operator new.
+        Block can be released from any thread: it is returned into the free list of the releasing thread.
+
+        @param size requested block size in bytes. The result is aligned at least by alignof(std::max_align_t).
+     */
+    NAU_KERNEL_EXPORT void* allocateTaskFrame(size_t size);
+
+    /**
+        @brief Releases storage allocated with allocateTaskFrame.
+        @param size must be the same value as specified for the allocateTaskFrame.
+     */
+    NAU_KERNEL_EXPORT void freeTaskFrame(void* ptr, size_t size) noexcept;
+
+}  // namespace nau::async_detail
@@ -5,6 +5,8 @@
 #pragma once
 #include <EASTL/span.h>
 
+#include <chrono>
+#include <optional>
 #include <thread>
 #include <type_traits>
 
@@ -68,12 +70,26 @@ namespace nau::async
 
             void operator()();
 
+            /**
+                The id which links the invocation scheduling with its run in the task trace (see nau/async/task_trace.h), 0 if not traced.
+             */
+            uint64_t getTraceId() const
+            {
+                return m_traceId;
+            }
+
+            void setTraceId(uint64_t traceId)
+            {
+                m_traceId = traceId;
+            }
+
         private:
             void reset();
 
             Callback m_callback = nullptr;
             void* m_callbackData1 = nullptr;
             void* m_callbackData2 = nullptr;
+            uint64_t m_traceId = 0;
         };
 
         /**
@@ -116,7 +132,20 @@ namespace nau::async
 
         NAU_KERNEL_EXPORT void execute(Callback, void* data1, void* data2 = nullptr) noexcept;
 
-        virtual void waitAnyActivity() noexcept = 0;
+        /**
+            @brief Blocks the calling thread until the executor has no scheduled or running invocations.
+            @param timeout maximum time to wait, the infinite wait if not specified.
+            @returns true if the executor became idle, false if the timeout expired.
+         */
+        virtual bool waitAnyActivity(std::optional<std::chrono::milliseconds> timeout = std::nullopt) noexcept = 0;
+
+        /**
+            @brief Returns the maximum number of invocations that can be executed by the executor simultaneously.
+         */
+        virtual size_t getConcurrency() const noexcept
+        {
+            return 1;
+        }
 
     protected:
         NAU_KERNEL_EXPORT static void invoke(Executor&, Invocation) noexcept;
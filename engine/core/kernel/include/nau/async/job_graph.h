@@ -0,0 +1,74 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <EASTL/vector.h>
+
+#include "nau/async/executor.h"
+#include "nau/kernel/kernel_config.h"
+#include "nau/utils/functor.h"
+
+namespace nau::async
+{
+    /**
+        @brief Set of jobs with the dependencies between them, executed on the executor.
+
+        The graph is intended to be built once and executed many times (e.g. every frame):
+        run() does not allocate per job, only the single execution state is allocated per run.
+        The calling thread is blocked until all jobs are completed, but it also executes the ready jobs.
+     */
+    class NAU_KERNEL_EXPORT JobGraph
+    {
+    public:
+        using JobId = uint32_t;
+
+        JobGraph() = default;
+        JobGraph(const JobGraph&) = delete;
+        JobGraph(JobGraph&&) = default;
+        JobGraph& operator=(const JobGraph&) = delete;
+        JobGraph& operator=(JobGraph&&) = default;
+
+        /**
+            @param callingThreadOnly the job is executed only by the thread that calls run() (e.g. the main thread bound work).
+        */
+        JobId addJob(Functor<void()> job, bool callingThreadOnly = false);
+
+        /**
+            @brief Specifies that job can be started only after the dependsOn job is completed.
+        */
+        void addDependency(JobId job, JobId dependsOn);
+
+        size_t getJobsCount() const;
+
+        /**
+            @brief Checks whether the dependencies form a cycle, i.e. some jobs can never become ready.
+        */
+        bool hasCycles() const;
+
+        void clear();
+
+        /**
+            @brief Executes all jobs respecting the dependencies and blocks until all of them are completed.
+            The graph with cyclic dependencies is a fatal error (checked once after the graph is changed).
+            @param executor executor that is used for the helper invocations. Executor::getDefault() is used if not specified.
+        */
+        void run(Executor::Ptr executor = nullptr);
+
+    private:
+        struct Job
+        {
+            Functor<void()> callable;
+            eastl::vector<JobId> successors;
+            uint32_t dependenciesCount = 0;
+            bool callingThreadOnly = false;
+        };
+
+        eastl::vector<Job> m_jobs;
+        bool m_isValidated = false;
+
+        friend struct JobGraphRunState;
+    };
+
+}  // namespace nau::async
@@ -0,0 +1,66 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <type_traits>
+
+#include "nau/async/executor.h"
+#include "nau/kernel/kernel_config.h"
+
+namespace nau::async_detail
+{
+    using ParallelForCallback = void (*)(void* data, size_t begin, size_t end);
+
+    NAU_KERNEL_EXPORT void parallelForInternal(size_t count, size_t grainSize, ParallelForCallback callback, void* data, async::Executor::Ptr executor);
+
+}  // namespace nau::async_detail
+
+namespace nau::async
+{
+    /**
+        @brief Splits the range [0, count) into chunks of grainSize items and processes them on the executor.
+
+        The calling thread is blocked until all chunks are processed, but it also takes part in processing,
+        so parallelFor can be called from within an executor's worker thread.
+        There is no allocation per item/chunk: chunks are claimed from the single shared atomic counter.
+
+        @param count items count.
+        @param grainSize items per chunk. If zero, the grain size is selected automatically from the executor concurrency.
+        @param fn callable with the signature void(size_t begin, size_t end) or void(size_t index).
+        @param executor executor that is used for the helper invocations. Executor::getDefault() is used if not specified.
+     */
+    template <typename F>
+    void parallelFor(size_t count, size_t grainSize, F&& fn, Executor::Ptr executor = nullptr)
+    {
+        using Callable = std::remove_reference_t<F>;
+
+        static_assert(std::is_invocable_v<Callable&, size_t, size_t> || std::is_invocable_v<Callable&, size_t>,
+                      "Expected void(size_t begin, size_t end) or void(size_t index)");
+
+        if (count == 0)
+        {
+            return;
+        }
+
+        const async_detail::ParallelForCallback callback = [](void* data, size_t begin, size_t end)
+        {
+            Callable& callable = *reinterpret_cast<Callable*>(data);
+            if constexpr (std::is_invocable_v<Callable&, size_t, size_t>)
+            {
+                callable(begin, end);
+            }
+            else
+            {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    callable(i);
+                }
+            }
+        };
+
+        async_detail::parallelForInternal(count, grainSize, callback, const_cast<void*>(reinterpret_cast<const void*>(&fn)), std::move(executor));
+    }
+
+}  // namespace nau::async
@@ -9,6 +9,7 @@
 
 #include "nau/async/async_timer.h"
 #include "nau/async/core/core_task_linked_list.h"
+#include "nau/async/core/task_frame_allocator.h"
 #include "nau/async/cpp_coroutine.h"
 #include "nau/async/executor.h"
 #include "nau/async/task_base.h"
@@ -278,6 +279,17 @@ namespace nau::async_detail
             }
         }
 
+        // Coroutine frames are short living and allocated very often: using per-thread pool instead of the general heap.
+        static void* operator new(size_t size)
+        {
+            return async_detail::allocateTaskFrame(size);
+        }
+
+        static void operator delete(void* ptr, size_t size) noexcept
+        {
+            async_detail::freeTaskFrame(ptr, size);
+        }
+
         async::Task<T> get_return_object()
         {
             return taskSource.getTask();
@@ -0,0 +1,47 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include "nau/io/stream.h"
+#include "nau/kernel/kernel_config.h"
+#include "nau/utils/result.h"
+
+namespace nau::async
+{
+    /**
+        The async task lifecycle trace: the task creation, the await (the awaiting coroutine is suspended), the task readiness,
+        the invocation scheduling on the executor and the invocation run (the coroutine resume) with the executor and the thread.
+        The scheduling is linked with its run, so the continuation chains and the executor hops are seen on the timeline.
+
+        The events are collected into the per thread buffers only while the trace is active.
+        The instrumentation is compiled in when NAU_ASYNC_TASK_TRACE is enabled (the default), when the trace is not active it costs one relaxed atomic load.
+     */
+    struct TaskTraceSettings
+    {
+        /**
+            The maximum number of the events kept per thread, the events over the limit are dropped (and counted).
+         */
+        size_t maxEventsPerThread = 256 * 1024;
+    };
+
+    /**
+        Starts collecting the events, the events of the previous trace are discarded.
+     */
+    NAU_KERNEL_EXPORT void startTaskTrace(TaskTraceSettings settings = {});
+
+    /**
+        Stops collecting the events, the collected events are kept until the next start.
+     */
+    NAU_KERNEL_EXPORT void stopTaskTrace();
+
+    NAU_KERNEL_EXPORT bool isTaskTraceActive();
+
+    /**
+        Writes the collected events in the Chrome trace event format (JSON), which is opened by chrome://tracing and the Perfetto UI.
+        Can be called while the trace is active: only the events collected before the call are written.
+     */
+    NAU_KERNEL_EXPORT Result<> writeTaskTraceChromeJson(io::IStreamWriter& stream);
+
+}  // namespace nau::async
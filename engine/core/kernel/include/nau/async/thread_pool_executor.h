@@ -5,14 +5,41 @@
 #pragma once
 
 #include <optional>
+#include <string_view>
 
 #include "nau/async/executor.h"
 #include "nau/kernel/kernel_config.h"
 
 namespace nau::async
 {
+    /**
+        @brief Scheduling strategy used by the thread pool executor.
+     */
+    enum class ThreadPoolMode
+    {
+        /**
+            All workers take invocations from the single queue guarded by the one mutex.
+        */
+        SharedQueue,
+
+        /**
+            Each worker owns its own deque: invocations scheduled from the worker thread are taken back in LIFO order,
+            idle workers steal the oldest invocations (FIFO) from the other workers.
+            Only one sleeping worker is woken per scheduled invocation.
+        */
+        WorkStealing
+    };
+
     NAU_KERNEL_EXPORT Executor::Ptr createThreadPoolExecutor(std::optional<size_t> threadsCount = std::nullopt);
 
+    /**
+        @brief Creates the thread pool executor with the named worker threads ("<poolName>-<index>").
+        @param poolName the name prefix for worker threads.
+        @param threadsCount the number of worker threads. If not specified, the default count (depends on the CPU cores count) is used.
+        @param mode the scheduling strategy.
+     */
+    NAU_KERNEL_EXPORT Executor::Ptr createThreadPoolExecutor(std::string_view poolName, std::optional<size_t> threadsCount = std::nullopt, ThreadPoolMode mode = ThreadPoolMode::WorkStealing);
+
     // NAU_KERNEL_EXPORT Executor::Ptr createDagThreadPoolExecutor(bool initCpuJobs, std::optional<size_t> threadsCount = std::nullopt);
 
 }  // namespace nau::async
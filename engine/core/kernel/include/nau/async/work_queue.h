@@ -16,14 +16,32 @@
 
 namespace nau
 {
+    /**
+        @brief Storage strategy for the work queue invocations.
+     */
+    enum class WorkQueueMode
+    {
+        /**
+            Invocations are stored in the vector guarded by the mutex.
+        */
+        Locked,
+
+        /**
+            Multiple producers/single consumer: invocations are pushed into the intrusive lock-free list
+            and poll() takes all of them with a single atomic exchange.
+            The queue must be polled only from one thread at a time.
+        */
+        Mpsc
+    };
+
     struct NAU_ABSTRACT_TYPE WorkQueue : async::Executor
     {
         NAU_INTERFACE(nau::WorkQueue, async::Executor)
 
         using Ptr = nau::Ptr<WorkQueue>;
 
-        NAU_KERNEL_EXPORT static WorkQueue::Ptr create();
-        
+        NAU_KERNEL_EXPORT static WorkQueue::Ptr create(WorkQueueMode mode = WorkQueueMode::Locked);
+
 
         virtual async::Task<> waitForWork() = 0;
 
@@ -2,6 +2,7 @@
 // Copyright (C) 2024  Gaijin Games KFT.  All rights reserved
 #pragma once
 
+#include <nau/dag_ioSys/dag_genIo.h>
 #include <nau/math/dag_e3dColor.h>
 #include <nau/utils/dag_roNameMap.h>
 #include <nau/utils/dag_stdint.h>
@@ -9,6 +10,8 @@
 #include "nau/math/math.h"
 namespace nau
 {
+    class DataBlock;
+
     /// Read-only data block (with interface similar to DataBlock)
     struct RoDataBlock
     {
@@ -41,6 +44,9 @@ namespace nau
         /// create Read-only data block via loading dump from stream
         NAU_KERNEL_EXPORT static RoDataBlock* load(iosys::IGenLoad& crd, int sz = -1);
 
+        /// write the dump of the data block (preceded by its size) to be created with load(): used to cook the configs
+        NAU_KERNEL_EXPORT static bool saveDump(const DataBlock& blk, iosys::IGenSave& cwr);
+
         /// patch data once after creating from dump
         NAU_KERNEL_EXPORT void patchData(void* base);
 
@@ -0,0 +1,61 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <EASTL/optional.h>
+#include <EASTL/shared_ptr.h>
+#include <EASTL/string.h>
+#include <EASTL/string_view.h>
+
+#include "nau/dataBlock/dag_roDataBlock.h"
+#include "nau/io/stream.h"
+#include "nau/kernel/kernel_config.h"
+#include "nau/serialization/runtime_value.h"
+#include "nau/utils/functor.h"
+#include "nau/utils/result.h"
+
+namespace nau
+{
+    class DataBlock;
+
+    /**
+        @brief The loaded read-only data block: its memory is released with the last reference.
+     */
+    using RoDataBlockPtr = eastl::shared_ptr<const RoDataBlock>;
+
+    /**
+        @brief Transforms the string values on read (i.e. expands the variables), returns nothing to keep the value as is.
+     */
+    using RoDataBlockStringCallback = Functor<eastl::optional<eastl::string>(eastl::string_view)>;
+
+    /**
+        @brief Loads the dump written by RoDataBlock::saveDump(): the data is read once and patched in place, nothing is parsed.
+     */
+    NAU_KERNEL_EXPORT Result<RoDataBlockPtr> loadRoDataBlock(io::IStreamReader& stream);
+
+    /**
+        @brief Wraps the block as the read-only dictionary: the values are read from the block on access, the tree is not copied.
+
+        The sub-blocks are the dictionaries, the sub-block written for the collection (see runtimeValueToDataBlock()) is the collection.
+        If the name repeats within the block (possible with the hand written blk) the first parameter or sub-block is taken.
+
+        @param root The loaded block, kept alive by the returned value and all the values it returns.
+        @param block The block of the root to wrap, the root itself if null.
+     */
+    NAU_KERNEL_EXPORT RuntimeReadonlyDictionary::Ptr wrapRoDataBlock(RoDataBlockPtr root, const RoDataBlock* block = nullptr, RoDataBlockStringCallback stringCallback = {});
+
+    /**
+        @brief Converts the dictionary (i.e. the parsed json config) to the data block to be cooked with RoDataBlock::saveDump().
+
+        The dictionaries become the sub-blocks, the collections become the sub-blocks marked with the "@array" parameter
+        with the elements named "@item". The null values are skipped.
+     */
+    NAU_KERNEL_EXPORT Result<> runtimeValueToDataBlock(const RuntimeReadonlyDictionary& value, DataBlock& blk);
+
+    /**
+        @brief Converts the dictionary with runtimeValueToDataBlock() and writes its read-only dump to the stream.
+     */
+    NAU_KERNEL_EXPORT Result<> saveRoDataBlock(const RuntimeReadonlyDictionary& value, io::IStreamWriter& stream);
+}  // namespace nau
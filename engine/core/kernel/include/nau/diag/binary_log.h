@@ -0,0 +1,50 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+// nau/diag/binary_log.h
+
+
+#pragma once
+
+#include <EASTL/span.h>
+#include <EASTL/string.h>
+
+#include "nau/diag/logging.h"
+#include "nau/kernel/kernel_config.h"
+#include "nau/utils/functor.h"
+#include "nau/utils/result.h"
+
+namespace nau::diag
+{
+    struct BinaryLogOptions
+    {
+        /** The file is rotated (path -> path.1 -> path.2 ...) when its size exceeds the limit. */
+        size_t maxFileSize = 32 * 1024 * 1024;
+
+        /** The count of the files to keep (including the current one). */
+        unsigned maxFiles = 4;
+
+        /** The records are written to the file by blocks, Error and Critical messages are written immediately. */
+        size_t writeBufferSize = 64 * 1024;
+    };
+
+    /**
+        Makes the subscriber that writes the messages in the compact binary form instead of the text.
+
+        Each call site (source file, function and line) and each tag are written to the file once, and then referenced by the id:
+        the message record only keeps the site id, level, index, time delta, thread id, tag ids and the message text.
+        Every file (including rotated ones) is self-contained and can be rendered to the text later with decodeBinaryLog().
+     */
+    NAU_KERNEL_EXPORT ILogSubscriber::Ptr createBinaryLogSubscriber(eastl::string_view filePath, BinaryLogOptions options = {});
+
+    /**
+        Decodes the binary log data (the content of the file written by createBinaryLogSubscriber()).
+        The message (and its string views) passed to the callback is valid only during the call.
+     */
+    NAU_KERNEL_EXPORT Result<> decodeBinaryLog(eastl::span<const std::byte> data, const Functor<void(const LoggerMessage&)>& callback);
+
+    /**
+        Renders the binary log data as the text: one line per message.
+     */
+    NAU_KERNEL_EXPORT Result<eastl::string> binaryLogToText(eastl::span<const std::byte> data);
+
+}  // namespace nau::diag
@@ -16,4 +16,11 @@ namespace nau::diag
 
     NAU_KERNEL_EXPORT ILogSubscriber::Ptr createFileOutputLogSubscriber(eastl::string_view filename);
 
+    /**
+        Makes the subscriber that passes the messages to the target subscriber on its own dispatcher thread:
+        the logging thread only puts the message copy into the lock-free queue.
+        Error and Critical messages are waited until all queued messages are processed (so they are not lost on crash).
+     */
+    NAU_KERNEL_EXPORT ILogSubscriber::Ptr createDeferredLogSubscriber(ILogSubscriber::Ptr subscriber);
+
 }  // namespace nau::diag
\ No newline at end of file
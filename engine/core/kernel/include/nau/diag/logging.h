@@ -58,6 +58,23 @@ namespace nau::diag
         Verbose,
     };
 
+    /**
+        Gets the level rank to compare the levels by severity: Verbose is the least severe level, Critical is the most severe one.
+     */
+    constexpr unsigned getLogLevelSeverity(LogLevel level)
+    {
+        return level == LogLevel::Verbose ? 0 : static_cast<unsigned>(level) + 1;
+    }
+
+#ifndef NAU_LOG_COMPILED_MIN_LEVEL
+    #define NAU_LOG_COMPILED_MIN_LEVEL Verbose
+#endif
+
+    /**
+        The messages with the less severe levels are compiled out (NAU_LOG_COMPILED_MIN_LEVEL defines the level name).
+     */
+    inline constexpr LogLevel CompiledMinLogLevel = LogLevel::NAU_LOG_COMPILED_MIN_LEVEL;
+
     struct LoggerMessage
     {
         uint32_t index;
@@ -66,6 +83,9 @@ namespace nau::diag
         eastl::vector<eastl::string> tags;
         SourceInfo source;
         eastl::string data;
+
+        /** Small sequential id of the thread that logged the message (messages can be processed on the other thread). */
+        uint32_t threadId = 0;
     };
 
     struct NAU_ABSTRACT_TYPE ILogSubscriber
@@ -150,6 +170,19 @@ namespace nau::diag
 
         void resetFilter(const SubscriptionHandle& handle);
 
+        /**
+            Sets the least severe level of the messages to log: the other messages are skipped before formatting.
+         */
+        void setMinLevel(LogLevel level)
+        {
+            m_minLevelSeverity.store(getLogLevelSeverity(level), eastl::memory_order_relaxed);
+        }
+
+        bool isLevelEnabled(LogLevel level) const
+        {
+            return getLogLevelSeverity(level) >= m_minLevelSeverity.load(eastl::memory_order_relaxed);
+        }
+
     protected:
         virtual SubscriptionHandle subscribeImpl(ILogSubscriber::Ptr subscriber, ILogMessageFilter::Ptr = nullptr) = 0;
 
@@ -162,6 +195,8 @@ namespace nau::diag
     private:
         template <LogFilterConcept TFilter>
         static ILogMessageFilter::Ptr makeLogMessageFilterPtr(TFilter filter);
+
+        eastl::atomic<unsigned> m_minLevelSeverity = 0;
     };
 
     NAU_KERNEL_EXPORT Logger::Ptr createLogger();
@@ -230,6 +265,11 @@ namespace nau::diag_detail
         template <typename S, typename... Args>
         void operator()(eastl::vector<eastl::string> tags, S&& formatStr, Args&&... args)
         {
+            if (diag::getLogLevelSeverity(level) < diag::getLogLevelSeverity(diag::CompiledMinLogLevel) || !diag::getLogger().isLevelEnabled(level))
+            {
+                return;
+            }
+
             if constexpr (sizeof...(Args) > 0)
             {
                 auto message = nau::utils::format(formatStr, std::forward<Args>(args)...);
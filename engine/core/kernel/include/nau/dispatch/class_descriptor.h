@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <EASTL/span.h>
+
 #include <optional>
 
 #include "nau/dispatch/dispatch_args.h"
@@ -11,11 +13,39 @@
 #include "nau/rtti/ptr.h"
 #include "nau/rtti/rtti_object.h"
 #include "nau/serialization/runtime_value.h"
+#include "nau/serialization/runtime_value_builder.h"
 #include "nau/string/string_utils.h"
 #include "nau/utils/result.h"
 
 namespace nau
 {
+    /**
+        @brief Boxes the not boxed argument (the boxed argument is returned as is).
+     */
+    inline nau::Ptr<> boxDispatchArgument(const DispatchArgument& argument)
+    {
+        return eastl::visit([](const auto& value) -> nau::Ptr<>
+        {
+            using T = std::decay_t<decltype(value)>;
+            if constexpr (std::is_same_v<T, eastl::monostate>)
+            {
+                return nullptr;
+            }
+            else if constexpr (std::is_same_v<T, nau::Ptr<>>)
+            {
+                return value;
+            }
+            else if constexpr (std::is_same_v<T, eastl::string_view>)
+            {
+                return makeValueCopy(std::string{value.data(), value.size()});
+            }
+            else
+            {
+                return makeValueCopy(value);
+            }
+        }, argument);
+    }
+
     /**
      */
     enum class MethodCategory
@@ -50,6 +80,22 @@ namespace nau
          */
         virtual Result<IRttiObject*> invoke(IRttiObject* instance, DispatchArguments args) const = 0;
 
+        /**
+            @brief Invokes the method without boxing the primitive arguments.
+                The native methods read the primitives directly into the parameters (no RuntimeValue is created for them),
+                the default implementation boxes the arguments and calls invoke.
+         */
+        virtual Result<IRttiObject*> invokeUnboxed(IRttiObject* instance, eastl::span<const DispatchArgument> args) const
+        {
+            DispatchArguments boxedArgs;
+            for (const DispatchArgument& arg : args)
+            {
+                boxedArgs.emplace_back(boxDispatchArgument(arg));
+            }
+
+            return this->invoke(instance, std::move(boxedArgs));
+        }
+
         /**
             @brief temporary method.
                 MUST be removed after invoke will be refatored to returns Universal ptr
@@ -68,6 +114,23 @@ namespace nau
 
             return rtti::TakeOwnership{refCounted};
         }
+
+        Result<nau::Ptr<>> invokeUnboxedToPtr(IRttiObject* instance, eastl::span<const DispatchArgument> args) const
+        {
+            Result<IRttiObject*> result = this->invokeUnboxed(instance, args);
+            NauCheckResult(result);
+
+            IRttiObject* const obj = *result;
+            if (!obj)
+            {
+                return nau::Ptr<>{};
+            }
+
+            IRefCounted* const refCounted = obj->as<IRefCounted*>();
+            NAU_FATAL(refCounted);
+
+            return nau::Ptr<>{rtti::TakeOwnership{refCounted}};
+        }
     };
 
     /**
@@ -176,4 +239,45 @@ namespace nau
 
         return nullptr;
     }
+
+    /**
+        @brief The method resolved once by the name (the lookup compares the names of all the class methods),
+            then invoked directly. Keeps the class descriptor (the owner of the method info) alive.
+     */
+    class MethodHandle
+    {
+    public:
+        MethodHandle() = default;
+
+        MethodHandle(IClassDescriptor::Ptr classDescriptor, std::string_view methodName) :
+            m_classDescriptor(std::move(classDescriptor)),
+            m_method(m_classDescriptor ? m_classDescriptor->findMethod(methodName) : nullptr)
+        {
+        }
+
+        explicit operator bool() const
+        {
+            return m_method != nullptr;
+        }
+
+        const IMethodInfo& getMethod() const
+        {
+            NAU_FATAL(m_method);
+            return *m_method;
+        }
+
+        Result<nau::Ptr<>> invoke(IRttiObject* instance, eastl::span<const DispatchArgument> args = {}) const
+        {
+            if (!m_method)
+            {
+                return NauMakeError("Method is not resolved");
+            }
+
+            return m_method->invokeUnboxedToPtr(instance, args);
+        }
+
+    private:
+        IClassDescriptor::Ptr m_classDescriptor;
+        const IMethodInfo* m_method = nullptr;
+    };
 }  // namespace nau
@@ -25,6 +25,12 @@ namespace nau::nau_detail
     template <typename... T>
     Result<> assignArgumentValues(const DispatchArguments& inArgs, T&... outValues);
 
+    template <typename T>
+    Result<> assignUnboxedValue(const DispatchArgument& inArg, T& value);
+
+    template <typename... T>
+    Result<> assignUnboxedArgumentValues(eastl::span<const DispatchArgument> inArgs, T&... outValues);
+
     template <typename T>
     requires(HasRuntimeValueRepresentation<T> || meta::IsCallable<T>)
     nau::Ptr<> makeRuntimeValue(T&& value);
@@ -167,6 +173,77 @@ namespace nau::nau_detail
         return {};
     }
 
+    /**
+        Reads the primitive argument directly, the argument that does not match the parameter type is converted through the boxing.
+     */
+    template <typename T>
+    Result<> assignUnboxedValue(const DispatchArgument& inArg, T& outValue)
+    {
+        if (const nau::Ptr<>* const boxedValue = eastl::get_if<nau::Ptr<>>(&inArg))
+        {
+            return assignNativeValue(*boxedValue, outValue);
+        }
+
+        if constexpr (std::is_same_v<T, bool>)
+        {
+            if (const bool* const value = eastl::get_if<bool>(&inArg))
+            {
+                outValue = *value;
+                return ResultSuccess;
+            }
+        }
+        else if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>)
+        {
+            if (const int64_t* const value = eastl::get_if<int64_t>(&inArg))
+            {
+                outValue = static_cast<T>(*value);
+                return ResultSuccess;
+            }
+            else if (const double* const value = eastl::get_if<double>(&inArg))
+            {
+                outValue = static_cast<T>(*value);
+                return ResultSuccess;
+            }
+        }
+        else if constexpr (std::is_constructible_v<T, const char*, size_t>)
+        {
+            if (const eastl::string_view* const value = eastl::get_if<eastl::string_view>(&inArg))
+            {
+                outValue = T{value->data(), value->size()};
+                return ResultSuccess;
+            }
+        }
+
+        const nau::Ptr<> boxedValue = boxDispatchArgument(inArg);
+        if (!boxedValue)
+        {
+            return NauMakeError("Argument value is not specified");
+        }
+
+        return assignNativeValue(boxedValue, outValue);
+    }
+
+    template <typename... A>
+    Result<> assignUnboxedArgumentValues(eastl::span<const DispatchArgument> inArgs, A&... outValues)
+    {
+        static_assert(sizeof...(A) == 0 || !(std::is_reference_v<A> || ...));
+
+        if (inArgs.size() < sizeof...(A))
+        {
+            return NauMakeError("Expected ({}) arguments, but ({}) passed", sizeof...(A), inArgs.size());
+        }
+
+        Error::Ptr error;
+        size_t argIndex = 0;
+
+        if (!(assignUnboxedValue(inArgs[argIndex++], outValues).isSuccess(&error) && ...))
+        {
+            return error;
+        }
+
+        return {};
+    }
+
     template <typename T>
     requires(HasRuntimeValueRepresentation<T> || meta::IsCallable<T>)
     nau::Ptr<> makeRuntimeValue(T&& value)
@@ -226,6 +303,11 @@ namespace nau::nau_detail
             return invokeImpl(instance, typename MethodInfo::FunctionTypeInfo{}, args);
         }
 
+        Result<IRttiObject*> invokeUnboxed(IRttiObject* instance, eastl::span<const DispatchArgument> args) const override
+        {
+            return invokeUnboxedImpl(instance, typename MethodInfo::FunctionTypeInfo{}, args);
+        }
+
     private:
         template <bool Const, bool NoExcept, typename C, typename R, typename... P>
         static Result<IRttiObject*> invokeImpl(IRttiObject* instance, meta::CallableTypeInfo<Const, NoExcept, C, R, P...> callableInfo, DispatchArguments& inArgs)
@@ -240,12 +322,40 @@ namespace nau::nau_detail
             }
         }
 
+        template <bool Const, bool NoExcept, typename C, typename R, typename... P>
+        static Result<IRttiObject*> invokeUnboxedImpl(IRttiObject* instance, meta::CallableTypeInfo<Const, NoExcept, C, R, P...> callableInfo, eastl::span<const DispatchArgument> inArgs)
+        {
+            if constexpr (MethodInfo::IsMemberFunction)
+            {
+                return invokeInstanceUnboxedImpl<C, R>(instance, inArgs, std::remove_const_t<std::remove_reference_t<P>>{}...);
+            }
+            else
+            {  // INVOKE STATIC
+                return nullptr;
+            }
+        }
+
         template <typename Class, typename R, typename... P>
         static Result<IRttiObject*> invokeInstanceImpl(IRttiObject* instance, DispatchArguments& inArgs, P... arguments)
         {
             NAU_ASSERT(instance);
             NauCheckResult(assignArgumentValues(inArgs, arguments...));
 
+            return callInstance<Class, R>(instance, std::move(arguments)...);
+        }
+
+        template <typename Class, typename R, typename... P>
+        static Result<IRttiObject*> invokeInstanceUnboxedImpl(IRttiObject* instance, eastl::span<const DispatchArgument> inArgs, P... arguments)
+        {
+            NAU_ASSERT(instance);
+            NauCheckResult(assignUnboxedArgumentValues(inArgs, arguments...));
+
+            return callInstance<Class, R>(instance, std::move(arguments)...);
+        }
+
+        template <typename Class, typename R, typename... P>
+        static Result<IRttiObject*> callInstance(IRttiObject* instance, P... arguments)
+        {
             Class* const api = instance->as<Class*>();
             NAU_ASSERT(api);
             if (!api)
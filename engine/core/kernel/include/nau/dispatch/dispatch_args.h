@@ -5,10 +5,26 @@
 #pragma once
 
 #include "nau/rtti/ptr.h"
-#include "EASTL/vector.h"
+#include "EASTL/fixed_vector.h"
+#include "EASTL/string_view.h"
+#include "EASTL/variant.h"
 
 namespace nau
 {
-    using DispatchArguments = eastl::vector<nau::Ptr<>>;
+    /**
+        @brief The count of the arguments kept inline (without the heap allocation) by the argument packs
+     */
+    inline constexpr size_t DispatchInlineArgumentsCount = 8;
+
+    using DispatchArguments = eastl::fixed_vector<nau::Ptr<>, DispatchInlineArgumentsCount, true>;
+
+    /**
+        @brief Not boxed invocation argument (see IMethodInfo::invokeUnboxed).
+            The primitives are passed by value, any other value is passed boxed (RuntimeValue or IDispatch).
+            The string view references the caller's storage and is valid only during the invocation.
+     */
+    using DispatchArgument = eastl::variant<eastl::monostate, bool, int64_t, double, eastl::string_view, nau::Ptr<>>;
+
+    using DispatchArgumentsPack = eastl::fixed_vector<DispatchArgument, DispatchInlineArgumentsCount, true>;
 
 } // namespace nau
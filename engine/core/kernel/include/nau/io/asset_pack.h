@@ -3,7 +3,11 @@
 
 #pragma once
 
+#include "nau/kernel/kernel_config.h"
 #include "nau/meta/class_info.h"
+#include "nau/utils/result.h"
+#include "EASTL/span.h"
+#include "EASTL/string_view.h"
 #include "EASTL/vector.h"
 
 /**
@@ -28,6 +32,24 @@ namespace nau::io
 #pragma endregion
     };
 
+    /**
+     * @enum AssetPackCompression
+     * @brief Compression of the asset pack entries.
+     * @details The compressed entry blob starts with the table of the compressed blocks ends (uint64_t per block, relative to the blob start),
+     *          followed by the compressed blocks. Each block is compressed independently and (except the last one) is decompressed to blockSize bytes,
+     *          so the blocks can be decompressed in parallel and in any order.
+     */
+    enum class AssetPackCompression : uint32_t
+    {
+        None,
+        Zstd
+    };
+
+    /**
+     * @brief Name of the compression used for AssetPackFileEntry::contentCompression.
+     */
+    inline constexpr eastl::string_view AssetPackZstdCompressionName = "zstd";
+
     /**
      * @struct AssetPackFileEntry
      * @brief Represents a file entry within an asset pack.
@@ -35,16 +57,20 @@ namespace nau::io
     struct AssetPackFileEntry
     {
         eastl::string filePath;            ///< Path to the file within the asset pack.
-        eastl::string contentCompression;  ///< Compression method used for the content, if any.
+        eastl::string contentCompression;  ///< Compression method used for the content, if any (empty or AssetPackZstdCompressionName).
         size_t clientSize;                 ///< Size of the file without compression.
         BlobData blobData;                 ///< Blob data associated with this file entry.
+        uint32_t blockSize = 0;            ///< Size of the uncompressed block (compressed entries only).
+        uint32_t dictionaryIndex = 0;      ///< Index of the compression dictionary plus one, 0 if the entry is compressed without the dictionary.
 
 #pragma region Class Info
         NAU_CLASS_FIELDS(
             CLASS_FIELD(filePath),
             CLASS_FIELD(contentCompression),
             CLASS_FIELD(clientSize),
-            CLASS_FIELD(blobData))
+            CLASS_FIELD(blobData),
+            CLASS_FIELD(blockSize),
+            CLASS_FIELD(dictionaryIndex))
 #pragma endregion
     };
 
@@ -57,13 +83,112 @@ namespace nau::io
         eastl::string version;             ///< Version of the asset pack.
         eastl::string description;         ///< Description of the asset pack.
 
-        eastl::vector<AssetPackFileEntry> content; ///< List of file entries within the asset pack.
+        eastl::vector<AssetPackFileEntry> content; ///< List of file entries within the asset pack (packs without the binary index).
+        eastl::vector<BlobData> dictionaries;      ///< Compression dictionaries (packs without the binary index).
+
+        size_t binaryIndexSize = 0;        ///< Size of the binary index (AssetPackBinaryIndex) that precedes the blobs, 0 if the pack has no binary index.
 
 #pragma region Class Info
         NAU_CLASS_FIELDS(
             CLASS_FIELD(version),
             CLASS_FIELD(description),
-            CLASS_FIELD(content))
+            CLASS_FIELD(content),
+            CLASS_FIELD(dictionaries),
+            CLASS_FIELD(binaryIndexSize))
 #pragma endregion
     };
+
+    /**
+     * @struct AssetPackBinaryIndexHeader
+     * @brief Header of the binary index: followed by the entries (sorted by the path hash), the compression dictionaries and the paths of the entries.
+     */
+    struct AssetPackBinaryIndexHeader
+    {
+        static constexpr uint32_t Magic = 0x58444950;  ///< "PIDX"
+        static constexpr uint32_t FormatVersion = 2;
+
+        uint32_t magic;             ///< Must be Magic.
+        uint32_t formatVersion;     ///< Must be FormatVersion.
+        uint64_t entriesCount;      ///< Number of the entries.
+        uint64_t dictionariesCount; ///< Number of the compression dictionaries.
+        uint64_t pathsSize;         ///< Size of the paths data (not null terminated paths of the entries).
+    };
+
+    /**
+     * @struct AssetPackBinaryIndexDictionary
+     * @brief Compression dictionary (zstd) stored within an asset pack.
+     */
+    struct AssetPackBinaryIndexDictionary
+    {
+        uint64_t offset; ///< Offset of the dictionary data within a asset pack (relative to the end of the pack header).
+        uint64_t size;   ///< Size of the dictionary data.
+    };
+
+    /**
+     * @struct AssetPackBinaryIndexEntry
+     * @brief Represents a file entry within the binary index of an asset pack.
+     */
+    struct AssetPackBinaryIndexEntry
+    {
+        uint64_t pathHash;   ///< Hash of the normalized file path (see getAssetPackPathHash).
+        uint64_t offset;     ///< Offset of the blob within a asset pack (relative to the end of the pack header).
+        uint64_t size;       ///< Size of the blob.
+        uint64_t clientSize; ///< Size of the file without compression.
+        uint32_t pathOffset; ///< Offset of the file path within the paths data.
+        uint32_t pathLength; ///< Length of the file path.
+        uint32_t compression;     ///< AssetPackCompression.
+        uint32_t blockSize;       ///< Size of the uncompressed block (compressed entries only).
+        uint32_t dictionaryIndex; ///< Index of the compression dictionary plus one, 0 if the entry is compressed without the dictionary.
+        uint32_t reserved;        ///< Must be 0.
+    };
+
+    /**
+     * @class AssetPackBinaryIndex
+     * @brief Read-only view of the binary index of an asset pack.
+     * @details The index is used as is (i.e. directly from the memory mapped pack): nothing is parsed or allocated on open.
+     *          Lookups are binary searches by the path hash.
+     */
+    class NAU_KERNEL_EXPORT AssetPackBinaryIndex
+    {
+    public:
+        /**
+         * @brief Validates the index data and creates the view of it. The data must outlive the view.
+         */
+        static Result<AssetPackBinaryIndex> open(eastl::span<const std::byte> indexData);
+
+        /**
+         * @brief Builds the binary index of the specified entries and compression dictionaries.
+         * @details The file paths are normalized, the blob offsets are kept as is.
+         */
+        static eastl::vector<std::byte> build(eastl::span<const AssetPackFileEntry> entries, eastl::span<const BlobData> dictionaries = {});
+
+        AssetPackBinaryIndex() = default;
+
+        /**
+         * @brief Finds the entry of the file.
+         * @param normalizedPath File path normalized with normalizeAssetPackPath.
+         * @return Pointer to the entry or nullptr if the pack does not contain the file.
+         */
+        const AssetPackBinaryIndexEntry* find(eastl::string_view normalizedPath) const;
+
+        eastl::span<const AssetPackBinaryIndexEntry> getEntries() const;
+
+        eastl::span<const AssetPackBinaryIndexDictionary> getDictionaries() const;
+
+        eastl::string_view getPath(const AssetPackBinaryIndexEntry& entry) const;
+
+    private:
+        eastl::span<const AssetPackBinaryIndexEntry> m_entries;
+        eastl::span<const AssetPackBinaryIndexDictionary> m_dictionaries;
+        eastl::string_view m_paths;
+    };
+
+    /**
+     * @brief Converts the file path within an asset pack to the form used by the index: "/dir/file.ext".
+     */
+    NAU_KERNEL_EXPORT
+    eastl::string normalizeAssetPackPath(eastl::string_view path);
+
+    NAU_KERNEL_EXPORT
+    uint64_t getAssetPackPathHash(eastl::string_view normalizedPath);
 } // namespace nau::io
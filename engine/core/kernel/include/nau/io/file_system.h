@@ -3,12 +3,16 @@
 
 #pragma once
 
+#include <EASTL/span.h>
+
 #include <optional>
 
+#include "nau/async/task.h"
 #include "nau/io/fs_path.h"
 #include "nau/io/io_constants.h"
 #include "nau/io/stream.h"
 #include "nau/kernel/kernel_config.h"
+#include "nau/memory/bytes_buffer.h"
 #include "nau/rtti/rtti_object.h"
 
 /**
@@ -148,6 +152,14 @@ namespace nau::io
          * @return File path.
          */
         virtual FsPath getPath() const = 0;
+
+        /**
+         * @brief Reads the file data asynchronously, without blocking the calling (or any pool) thread while the data is read.
+         * @param offset Offset in the file to read from.
+         * @param buffer Buffer to read into. Must stay valid until the task is completed.
+         * @return Task with the number of the bytes read (less than the buffer size only at the end of the file).
+         */
+        virtual async::Task<size_t> readAsync(size_t offset, eastl::span<std::byte> buffer) = 0;
     };
 
     /**
@@ -407,6 +419,16 @@ namespace nau::io
     NAU_KERNEL_EXPORT
     IFileSystem::Ptr createZipArchiveFileSystem(IStreamReader::Ptr stream, std::string basePath = {});
 
+    /**
+     * @brief Creates a zip archive file system over the memory mapped archive file.
+     * @param archivePath Path to the zip archive.
+     * @return Pointer to the created file system or nullptr if the archive can not be opened.
+     * @details Stored entries are read directly from the mapped archive, deflated entries are inflated into the client buffers.
+     *          Different entries can be extracted concurrently.
+     */
+    NAU_KERNEL_EXPORT
+    IFileSystem::Ptr createZipArchiveFileSystem(eastl::u8string_view archivePath);
+
     /**
      * @brief Creates a file stream.
      * @param path Path to the file.
@@ -417,6 +439,17 @@ namespace nau::io
     NAU_KERNEL_EXPORT
     IStreamBase::Ptr createNativeFileStream(const char* path, AccessModeFlag accessMode, OpenFileMode openMode);
 
+    /**
+     * @brief Reads the whole file content asynchronously.
+     *
+     * Large files are read with several concurrent IFile::readAsync requests (which are batched by the platform backend).
+     *
+     * @param file File to read.
+     * @return Task with the file content.
+     */
+    NAU_KERNEL_EXPORT
+    async::Task<BytesBuffer> readFileContentAsync(IFile::Ptr file);
+
 }  // namespace nau::io
 
 namespace nau::io_detail
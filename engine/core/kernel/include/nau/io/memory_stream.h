@@ -21,11 +21,13 @@ namespace nau::io
      * @brief An abstract interface for in-memory streams that support both reading and writing.
      *
      * `IMemoryStream` provides methods for accessing and manipulating data in memory. It inherits from both `IStreamReader` and `IStreamWriter`.
+     * The data can also be read in place through `IMemoryMappedStream`.
      */
     struct NAU_ABSTRACT_TYPE IMemoryStream : IStreamReader,
-                                             IStreamWriter
+                                             IStreamWriter,
+                                             IMemoryMappedStream
     {
-        NAU_INTERFACE(nau::io::IMemoryStream, IStreamReader, IStreamWriter)
+        NAU_INTERFACE(nau::io::IMemoryStream, IStreamReader, IStreamWriter, IMemoryMappedStream)
 
         using Ptr = nau::Ptr<IMemoryStream>; /**< A smart pointer type for `IMemoryStream`. */
 
@@ -3,9 +3,12 @@
 
 #pragma once
 
+#include <EASTL/span.h>
+
 #include "nau/async/task.h"
 #include "nau/io/io_constants.h"
 #include "nau/kernel/kernel_config.h"
+#include "nau/memory/bytes_buffer.h"
 #include "nau/rtti/ptr.h"
 #include "nau/rtti/rtti_object.h"
 #include "nau/utils/result.h"
@@ -64,6 +67,27 @@ namespace nau::io
         virtual Result<size_t> read(std::byte* buffer, size_t count) = 0;
     };
 
+    /**
+     * @struct IMemoryMappedStream
+     * @brief Optional interface of the streams whose data is already in memory (memory streams, mapped files).
+     *
+     * Allows to consume the stream data in place, without the copy into the client buffer.
+     */
+    struct NAU_ABSTRACT_TYPE IMemoryMappedStream : virtual IStreamBase
+    {
+        NAU_INTERFACE(nau::io::IMemoryMappedStream, IStreamBase)
+
+        using Ptr = nau::Ptr<IMemoryMappedStream>; /**< A smart pointer type for `IMemoryMappedStream`. */
+
+        /**
+         * @brief Gets the stream data starting at the current position and moves the position past it (as read() does).
+         * @param count The maximum number of bytes to get.
+         * @return A view of up to `count` bytes. It can be shorter than the available data (if the data is not contiguous).
+         *         The view is valid while the stream is alive.
+         */
+        virtual eastl::span<const std::byte> getContiguousView(size_t count) = 0;
+    };
+
     // struct NAU_ABSTRACT_TYPE IAsyncStreamReader : virtual IStreamBase
     // {
     //     NAU_INTERFACE(nau::io::IAsyncStreamReader, IStreamBase)
@@ -127,4 +151,15 @@ namespace nau::io
      */
     NAU_KERNEL_EXPORT
     Result<size_t> copyStream(IStreamWriter& dst, IStreamReader& src);
+
+    /**
+     * @brief Reads the data from the stream without the copy when the stream supports it (`IMemoryMappedStream`).
+     * @param src The `IStreamReader` instance to read from.
+     * @param size The number of bytes to read.
+     * @param storage The buffer that receives the data if the stream can not provide the contiguous view.
+     * @return A `Result` containing the view of the read data (which is shorter than `size` only at the end of the stream).
+     *         The view is valid while the stream (or the storage) is alive.
+     */
+    NAU_KERNEL_EXPORT
+    Result<eastl::span<const std::byte>> readStreamView(IStreamReader& src, size_t size, BytesBuffer& storage);
 }  // namespace nau::io
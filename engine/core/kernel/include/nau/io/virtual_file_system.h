@@ -13,6 +13,16 @@
 
 namespace nau::io
 {
+    /**
+     * @enum MountTrust
+     * @brief Specifies whether the content of a mounted file system is produced by the engine build tools.
+     */
+    enum class MountTrust
+    {
+        Untrusted,  ///< External content (mods, user archives): only the plain data and sources are accepted.
+        Trusted     ///< Content cooked by the build tools (asset packs): can contain binary (precompiled) chunks.
+    };
+
     /**
      * @struct IVirtualFileSystem
      * @brief Interface for a virtual file system that supports mounting and unmounting of other file systems.
@@ -31,16 +41,24 @@ namespace nau::io
          * @param path Path at which the file system will be mounted.
          * @param fileSystem Pointer to the file system to mount.
          * @param priority Priority of the mounted file system.
+         * @param trust Whether the content of the file system is cooked by the build tools.
          * @return Result of the operation.
          * @details If multiple file systems are mounted at the same path, the one with the highest priority will be used.
          */
-        virtual Result<> mount(const FsPath&, IFileSystem::Ptr, unsigned priority = 1) = 0;
+        virtual Result<> mount(const FsPath&, IFileSystem::Ptr, unsigned priority = 1, MountTrust trust = MountTrust::Untrusted) = 0;
 
         /**
          * @brief Unmounts a previously mounted file system.
          * @param fileSystem Pointer to the file system to unmount.
          */
         virtual void unmount(IFileSystem::Ptr) = 0;
+
+        /**
+         * @brief Checks whether the file at the specified path is served by a file system mounted as `MountTrust::Trusted`.
+         * @param path Path of the file within the virtual file system.
+         * @return `false` if the file does not exist or comes from an untrusted mount.
+         */
+        virtual bool isTrustedFile(const FsPath& path) = 0;
     };
 
     /**
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <EASTL/span.h>
+
 #include "nau/math/math.h"
 #include "nau/math/dag_bounds3.h"
 
@@ -48,6 +50,16 @@ namespace nau::math
 
         inline int testSphere(const BSphere3& sphere) const { return testSphere(sphere.c, Vector4{ sphere.r }); }
 
+        // Batched visibility test: bit (i % 32) of outVisibleMask[i / 32] is set when testSphere(spheres[i]) != 0.
+        // Spheres are tested by 4 (SSE) or 8 (AVX) at once. outVisibleMask must hold getVisibleMaskSize(spheres.size()) words.
+        void testSpheres(eastl::span<const BSphere3> spheres, eastl::span<uint32_t> outVisibleMask) const;
+
+        // Multi-view version: the spheres are traversed once, each batch is tested against all the frusta.
+        // outVisibleMasks[f] receives the mask of frusta[f] and must hold getVisibleMaskSize(spheres.size()) words.
+        static void testSpheres(eastl::span<const NauFrustum* const> frusta, eastl::span<const BSphere3> spheres, eastl::span<uint32_t* const> outVisibleMasks);
+
+        static constexpr size_t getVisibleMaskSize(size_t spheresCount) { return (spheresCount + 31) / 32; }
+
 
         Vector4 camPlanes[6];
         Vector4 plane03X, plane03Y, plane03Z, plane03W2, plane03W, plane4W2, plane5W2;
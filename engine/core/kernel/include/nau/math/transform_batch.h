@@ -0,0 +1,92 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <EASTL/span.h>
+
+#include "nau/kernel/kernel_config.h"
+#include "nau/math/dag_bounds3.h"
+#include "nau/math/transform.h"
+
+namespace nau::math
+{
+    /**
+     * @brief The inverse-transpose of the matrix upper 3x3 (the normal matrix), through the cofactors instead of the 4x4 inverse.
+     *
+     * For the affine matrices the result equals transpose(inverse(matrix)). The singular 3x3 gives the zero rotation part.
+     */
+    NAU_FORCE_INLINE Matrix4 inverseTransposeAffine(const Matrix4& matrix)
+    {
+        const Vector3 col0 = matrix.getCol0().getXYZ();
+        const Vector3 col1 = matrix.getCol1().getXYZ();
+        const Vector3 col2 = matrix.getCol2().getXYZ();
+        const Vector3 translation = matrix.getCol3().getXYZ();
+
+        // The rows of the 3x3 inverse multiplied by the determinant.
+        const Vector3 row0 = cross(col1, col2);
+        const Vector3 row1 = cross(col2, col0);
+        const Vector3 row2 = cross(col0, col1);
+
+        const float det = static_cast<float>(dot(col0, row0));
+        const float invDet = det != 0.f ? 1.f / det : 0.f;
+
+        return Matrix4{
+            Vector4{row0 * invDet, -static_cast<float>(dot(row0, translation)) * invDet},
+            Vector4{row1 * invDet, -static_cast<float>(dot(row1, translation)) * invDet},
+            Vector4{row2 * invDet, -static_cast<float>(dot(row2, translation)) * invDet},
+            Vector4{0.f, 0.f, 0.f, 1.f}};
+    }
+
+    /**
+     * @brief Transforms the bounding sphere: the center is transformed, the radius is scaled by the largest axis scale.
+     */
+    NAU_FORCE_INLINE BSphere3 transformSphere(const Matrix4& matrix, const BSphere3& sphere)
+    {
+        if (sphere.isempty())
+        {
+            return sphere;
+        }
+
+        const float maxScaleSqr = static_cast<float>(maxElem(Vector3{
+            static_cast<float>(lengthSqr(matrix.getCol0().getXYZ())),
+            static_cast<float>(lengthSqr(matrix.getCol1().getXYZ())),
+            static_cast<float>(lengthSqr(matrix.getCol2().getXYZ()))}));
+
+        return BSphere3{(matrix * Point3{sphere.c}).getXYZ(), sphere.r * sqrtf(maxScaleSqr)};
+    }
+
+    /**
+     * @brief Batch kernels over the transform spans: hierarchy updates, normal matrices and bounds of the instances.
+     *
+     * The loops are built on the Vectormath types (SSE or NEON depending on the platform) with no per element call,
+     * the results are equal to the per element operations. The output span must be of the input size, it may alias the input.
+     */
+
+    /**
+     * @brief outWorld[i] = parent * locals[i], the children of the one parent.
+     */
+    NAU_KERNEL_EXPORT void multiplyTransforms(const Transform& parent, eastl::span<const Transform> locals, eastl::span<Transform> outWorld);
+
+    /**
+     * @brief out[i] = lhs[i] * rhs[i].
+     */
+    NAU_KERNEL_EXPORT void multiplyTransforms(eastl::span<const Transform> lhs, eastl::span<const Transform> rhs, eastl::span<Transform> out);
+
+    /**
+     * @brief out[i] = transforms[i].toMatrixWithScale().
+     */
+    NAU_KERNEL_EXPORT void transformsToMatrices(eastl::span<const Transform> transforms, eastl::span<Matrix4> out);
+
+    /**
+     * @brief out[i] = inverseTransposeAffine(matrices[i]).
+     */
+    NAU_KERNEL_EXPORT void inverseTransposeAffine(eastl::span<const Matrix4> matrices, eastl::span<Matrix4> out);
+
+    /**
+     * @brief out[i] = transformSphere(matrices[i], spheres[i]).
+     */
+    NAU_KERNEL_EXPORT void transformSpheres(eastl::span<const Matrix4> matrices, eastl::span<const BSphere3> spheres, eastl::span<BSphere3> out);
+
+}  // namespace nau::math
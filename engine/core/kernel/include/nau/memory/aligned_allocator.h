@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <EASTL/unordered_map.h>
+
 #include "nau/memory/mem_allocator.h"
 #include "nau/threading/thread_local_value.h"
 #include "nau/threading/spin_lock.h"
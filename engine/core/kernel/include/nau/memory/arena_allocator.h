@@ -0,0 +1,98 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+/**
+ * @file arena_allocator.h
+ * @brief Definition of the ArenaAllocator class.
+ */
+#pragma once
+
+#include "nau/memory/aligned_allocator_debug.h"
+#include "nau/memory/mem_allocator.h"
+#include "nau/memory/mem_page.h"
+#include "nau/threading/spin_lock.h"
+
+namespace nau
+{
+    /**
+     * @brief Linear allocator for the data that is released at once: e.g. the runtime values of a single parsed document.
+     *
+     * Blocks are carved from the growing pages, deallocation of the separate blocks is a no-op
+     * and all the pages are released with the allocator.
+     * The allocator is held by IMemAllocator::Ptr: each value created with it (see rtti::createInstanceWithAllocator)
+     * keeps it alive, so the memory of the document is released with the last of its values.
+     *
+     * Usage:
+     * auto arena = eastl::make_shared<ArenaAllocator>();
+     * RuntimeValue::Ptr document = *serialization::jsonParse(stream, arena);
+     */
+    class NAU_KERNEL_EXPORT ArenaAllocator final : public IAlignedAllocatorDebug
+    {
+    public:
+        static constexpr size_t DefaultPageSize = 16 * 1024;
+
+        /**
+         * @brief Constructs a new ArenaAllocator object. No memory is allocated until the first allocation.
+         *
+         * @param pageSize Size of the memory page that the arena is growing by.
+         */
+        ArenaAllocator(size_t pageSize = DefaultPageSize);
+
+        /**
+         * @brief Destroys the ArenaAllocator object and releases all its pages.
+         */
+        ~ArenaAllocator();
+
+        ArenaAllocator(const ArenaAllocator&) = delete;
+        ArenaAllocator& operator=(const ArenaAllocator&) = delete;
+
+        /**
+         * @brief Allocates memory from the current page. Thread safe.
+         * @param size Size of the memory to allocate.
+         * @return void* Pointer to the allocated memory, aligned by 16 bytes.
+         */
+        [[nodiscard]] void* allocate(size_t size) override;
+
+        /**
+         * @brief Reallocates memory to a new size. The last allocation is grown in place when possible.
+         * @param ptr Pointer to the existing memory block.
+         * @param size New size for the memory block.
+         * @return void* Pointer to the reallocated memory block.
+         */
+        [[nodiscard]] void* reallocate(void* ptr, size_t size) override;
+
+        /**
+         * @brief Does nothing: memory is released with the whole arena.
+         * @param ptr Pointer to the memory block to deallocate.
+         */
+        void deallocate(void* ptr) override;
+
+        /**
+         * @brief Gets the size of the allocated memory block.
+         * @param ptr Pointer to the memory block.
+         * @return size_t Size of the memory block.
+         */
+        size_t getSize(const void* ptr) const override;
+
+        /**
+         * @brief Gets the number of the blocks allocated from the arena.
+         */
+        [[nodiscard]] size_t getAllocationsCount() const;
+
+        /**
+         * @brief Gets the total size of the arena pages.
+         */
+        [[nodiscard]] size_t getReservedSize() const;
+
+    private:
+        void* allocateBlock(size_t blockSize);
+
+        const size_t m_pageSize;
+        MemPage* m_pages = nullptr;
+        char* m_top = nullptr;
+        char* m_end = nullptr;
+        size_t m_allocationsCount = 0;
+        size_t m_reservedSize = 0;
+        mutable threading::SpinLock m_arenaLock;
+    };
+}  // namespace nau
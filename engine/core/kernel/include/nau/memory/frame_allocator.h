@@ -7,7 +7,10 @@
  */
 #pragma once
 
+#include <atomic>
+
 #include "nau/memory/mem_allocator.h"
+#include "nau/memory/mem_page.h"
 #include "nau/memory/mem_section_ptr.h"
 #include "nau/memory/aligned_allocator_debug.h"
 #include "nau/threading/thread_local_value.h"
@@ -135,6 +138,138 @@ namespace nau
         ThreadLocalValue<MemSectionPtr> m_memSection;
         ThreadLocalValue<int> m_numAllocs;
     };
+
+    /**
+     * @brief Per-thread linear allocator with the memory that remains valid for several frames.
+     *
+     * Each thread allocates from its own arena without any synchronization.
+     * Memory of the frame is kept for the next framesCount - 1 frames
+     * (i.e. while GPU or other consumer can still read the data produced within the frame) and then reused as a whole.
+     * Deallocation of the separate blocks is a no-op.
+     *
+     * By default frame is considered as completed when framesCount newer frames are started.
+     * With the external fence the frame memory is reclaimed only after completeFrame() is called for it
+     * (until that the frame slot keeps growing instead of being reused).
+     *
+     * Usage (with nau::FrameVector / EastlFrameAllocator):
+     * BufferedFrameAllocator frameAllocator;
+     * IFrameAllocator::setFrameAllocator(&frameAllocator);
+     * ...
+     * frameAllocator.prepareFrame(); // at the beginning of each frame
+     */
+    class NAU_KERNEL_EXPORT BufferedFrameAllocator final : public IFrameAllocator
+    {
+    public:
+        static constexpr size_t MaxFramesCount = 4;
+        static constexpr size_t DefaultFramesCount = 3;
+        static constexpr size_t DefaultPageSize = 256 * 1024;
+
+        /**
+         * @brief Constructs a new BufferedFrameAllocator object.
+         *
+         * @param framesCount Number of the frames that can be in use simultaneously (1..MaxFramesCount).
+         * @param useExternalFence If true, frame memory is reused only after completeFrame() is called for the frame.
+         * @param pageSize Size of the memory page that thread arena is growing by.
+         * @param useLargePages Requests the large (2 MB) system pages for the arena pages (see MemPage::allocateMemPage).
+         *        The page size is rounded up to the large page size, so it suits the allocators with the large per-thread frame data.
+         */
+        BufferedFrameAllocator(size_t framesCount = DefaultFramesCount, bool useExternalFence = false, size_t pageSize = DefaultPageSize, bool useLargePages = false);
+
+        /**
+         * @brief Destroys the BufferedFrameAllocator object and releases all pages of all threads.
+         */
+        ~BufferedFrameAllocator();
+
+        BufferedFrameAllocator(const BufferedFrameAllocator&) = delete;
+        BufferedFrameAllocator& operator=(const BufferedFrameAllocator&) = delete;
+
+        /**
+         * @brief Starts the next frame. Memory of the frame that previously used the same slot is reclaimed if it is completed.
+         * Must not be called concurrently with allocations.
+         *
+         * @return Always true.
+         */
+        [[nodiscard]] bool prepareFrame() override;
+
+        /**
+         * @brief Signals that the consumer (e.g. GPU) has finished with the frame data. Can be called from any thread.
+         * Meaningful only when allocator is constructed with useExternalFence.
+         *
+         * @param frameIndex Index of the completed frame (as returned by getFrameIndex()). All previous frames are completed too.
+         */
+        void completeFrame(uint64_t frameIndex);
+
+        /**
+         * @brief Gets the index of the current frame (increased by each prepareFrame call).
+         */
+        [[nodiscard]] uint64_t getFrameIndex() const;
+
+        /**
+         * @brief Gets the number of frames in use simultaneously.
+         */
+        [[nodiscard]] size_t getFramesCount() const;
+
+        /**
+         * @brief Allocates memory within the current frame. Thread safe.
+         * @param size Size of the memory to allocate.
+         * @return void* Pointer to the allocated memory, aligned by 16 bytes.
+         */
+        [[nodiscard]] void* allocate(size_t size) override;
+
+        /**
+         * @brief Reallocates memory to a new size.
+         * The last allocation of the thread is grown in place when possible.
+         * @param ptr Pointer to the existing memory block.
+         * @param size New size for the memory block.
+         * @return void* Pointer to the reallocated memory block.
+         */
+        [[nodiscard]] void* reallocate(void* ptr, size_t size) override;
+
+        /**
+         * @brief Does nothing: memory is reclaimed with the whole frame.
+         * @param ptr Pointer to the memory block to deallocate.
+         */
+        void deallocate(void* ptr) override;
+
+        /**
+         * @brief Gets the size of the allocated memory block.
+         * @param ptr Pointer to the memory block.
+         * @return size_t Size of the memory block.
+         */
+        virtual size_t getSize(const void* ptr) const override;
+
+    private:
+        struct FrameArena
+        {
+            MemPage* pages = nullptr;
+            MemPage* currentPage = nullptr;
+            char* top = nullptr;
+            char* end = nullptr;
+
+            ~FrameArena();
+
+            void* allocate(size_t blockSize, size_t pageSize, bool useLargePages);
+            void reset();
+        };
+
+        struct ThreadArenas
+        {
+            FrameArena frames[MaxFramesCount];
+        };
+
+        const size_t m_framesCount;
+        const size_t m_pageSize;
+        const bool m_useExternalFence;
+        const bool m_useLargePages;
+
+        ThreadLocalValue<ThreadArenas> m_threadArenas;
+        std::atomic<size_t> m_currentSlot = 0;
+        uint64_t m_frameIndex = 0;
+        uint64_t m_slotFrameIndices[MaxFramesCount] = {};
+
+        // Frames with the index less than this value are completed.
+        std::atomic<uint64_t> m_completedFramesCount = 0;
+    };
 }
 
 
@@ -56,6 +56,13 @@ namespace nau
          */
         [[nodiscard]] void* getAddress() const;
 
+        /**
+         * @brief Checks if the memory page is backed by the large (huge) system pages.
+         * 
+         * @return True if the page got the large pages, false if it is allocated from the heap (requested without the large pages or fallen back).
+         */
+        [[nodiscard]] bool isLargePage() const;
+
         /**
          * @brief Sets the next memory page in the linked list.
          * 
@@ -68,9 +75,13 @@ namespace nau
          * 
          * @param size The size of the memory page.
          * @param alignment The alignment of the memory page.
+         * @param useLargePages Requests the large pages (2 MB on x64): MEM_LARGE_PAGES on Windows, MADV_HUGEPAGE on Linux.
+         *        The page size is rounded up to the large page size and all of it is usable (see getSize()).
+         *        If the large pages are not available (no SeLockMemoryPrivilege, transparent huge pages are disabled, no contiguous physical memory),
+         *        the page is allocated from the heap. The result is accounted in MemoryStatsSnapshot::largePageBytes.
          * @return Pointer to the newly allocated memory page.
          */
-        [[nodiscard]] static MemPage* allocateMemPage(size_t size, size_t alignment = alignof(std::max_align_t));
+        [[nodiscard]] static MemPage* allocateMemPage(size_t size, size_t alignment = alignof(std::max_align_t), bool useLargePages = false);
 
         /**
          * @brief Frees a memory page.
@@ -89,6 +100,9 @@ namespace nau
         size_t m_alligned = 0;           
         MemPage* m_next = nullptr;
         void *m_address = nullptr;
+        size_t m_allocationSize = 0;
+        bool m_isLargePageRequested = false;
+        bool m_isLargePage = false;
     };
 }
 
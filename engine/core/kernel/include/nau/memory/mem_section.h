@@ -43,6 +43,27 @@ namespace nau
          */
         [[nodiscard]] size_t getPageSize() const;
 
+        /**
+         * @brief Requests the large (2 MB) system pages for the new memory pages of the section (see MemPage::allocateMemPage).
+         * Suits the large, long-lived and frequently scanned data: the large pages reduce the TLB misses.
+         * The page size is rounded up to the large page size, the pages that are already allocated are not changed.
+         * 
+         * @param useLargePages True to request the large pages.
+         */
+        void setLargePages(bool useLargePages);
+
+        /**
+         * @brief Checks if the large pages are requested for the section.
+         */
+        [[nodiscard]] bool isLargePages() const;
+
+        /**
+         * @brief Gets the size of the section pages that actually got the large pages.
+         * 
+         * @return The size in bytes.
+         */
+        [[nodiscard]] size_t getLargePageBytes() const;
+
         /**
          * @brief Allocates a block of memory with the specified size and alignment.
          * 
@@ -73,6 +94,7 @@ namespace nau
         void* m_free = nullptr;
         size_t m_pageSize = 64 * 1024; // typical L1 cache size in bytes.
         bool m_inWork = false;
+        bool m_useLargePages = false;
 
         void freeMem();
     };
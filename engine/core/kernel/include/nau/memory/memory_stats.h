@@ -0,0 +1,152 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+/**
+ * @file memory_stats.h
+ * @brief Per-subsystem memory tagging and live allocation statistics.
+ *
+ * Tracked: the SlabAllocator, the EASTL default allocator (the containers with the default allocator) and the lua states (always Scripts).
+ * Not tracked: the global operator new/malloc and the std containers (on Windows each module has its own operator new),
+ * the memory of the graphics/audio/physics backends allocated through their own allocators.
+ * The tag is thread local: the scope does not follow the coroutine over co_await, the continuation is charged to the tag of the thread it is resumed on.
+ */
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+
+#include "nau/kernel/kernel_config.h"
+#include "nau/utils/enum/enum_reflection.h"
+#include "nau/utils/preprocessor.h"
+
+namespace nau
+{
+    /**
+     * @brief Subsystem that the allocation is attributed to.
+     * Tag is selected by the NAU_MEMORY_SCOPE for the current thread. No more than 8 tags are supported.
+     */
+    NAU_DEFINE_ENUM(MemoryTag, uint8_t, "MemoryTag",
+        Default,
+        Render,
+        Assets,
+        Physics,
+        Scripts,
+        Scene,
+        Audio,
+        Ui)
+
+    inline constexpr size_t MemoryTagsCount = 8;
+
+    /**
+     * @brief RAII scope that sets the memory tag for all allocations of the current thread. Scopes can be nested.
+     */
+    class NAU_KERNEL_EXPORT MemoryTagScope
+    {
+    public:
+        explicit MemoryTagScope(MemoryTag tag);
+        ~MemoryTagScope();
+
+        MemoryTagScope(const MemoryTagScope&) = delete;
+        MemoryTagScope& operator=(const MemoryTagScope&) = delete;
+
+    private:
+        const MemoryTag m_prevTag;
+    };
+
+    /**
+     * @brief Gets the memory tag that is active for the current thread.
+     */
+    NAU_KERNEL_EXPORT MemoryTag getCurrentMemoryTag();
+
+    /**
+     * @brief Statistics of the single memory tag.
+     * Peak value is sampled: it is updated from the current value each time the snapshot is taken.
+     */
+    struct MemoryTagStats
+    {
+        int64_t currentBytes = 0;
+        int64_t peakBytes = 0;
+        uint64_t allocatedBytesTotal = 0;
+        uint64_t allocationsCount = 0;
+        uint64_t deallocationsCount = 0;
+        size_t budgetBytes = 0;
+
+        /**
+         * @brief Checks whether the current usage exceeds the budget (zero budget means no limit).
+         */
+        bool isOverBudget() const
+        {
+            return budgetBytes > 0 && currentBytes > static_cast<int64_t>(budgetBytes);
+        }
+    };
+
+    /**
+     * @brief Aggregated statistics of all threads at the moment.
+     */
+    struct MemoryStatsSnapshot
+    {
+        std::chrono::steady_clock::time_point timestamp;
+        std::array<MemoryTagStats, MemoryTagsCount> tags;
+
+        // Memory that is requested by the SlabAllocator from the system for the slabs.
+        size_t slabReservedBytes = 0;
+
+        // Memory of the pages that are requested with the large pages (see MemSection::setLargePages)
+        // and how much of it actually got them (on Linux: the transparent huge pages are advised, the kernel assigns them on the page faults).
+        size_t largePageRequestedBytes = 0;
+        size_t largePageBytes = 0;
+
+        const MemoryTagStats& operator[](MemoryTag tag) const
+        {
+            return tags[static_cast<size_t>(tag)];
+        }
+
+        /**
+         * @brief Computes allocations per second for the tag between previous and this snapshot.
+         */
+        double getAllocationsRate(const MemoryStatsSnapshot& prev, MemoryTag tag) const;
+
+        /**
+         * @brief Computes allocated bytes per second for the tag between previous and this snapshot.
+         */
+        double getAllocatedBytesRate(const MemoryStatsSnapshot& prev, MemoryTag tag) const;
+    };
+
+    /**
+     * @brief Collects counters of all threads. Counters are not locked while collected,
+     * so the snapshot is consistent only approximately (which is enough for the monitoring).
+     */
+    NAU_KERNEL_EXPORT MemoryStatsSnapshot getMemoryStatsSnapshot();
+
+    /**
+     * @brief Sets the memory budget for the tag (zero to remove the budget).
+     */
+    NAU_KERNEL_EXPORT void setMemoryBudget(MemoryTag tag, size_t budgetBytes);
+
+}  // namespace nau
+
+namespace nau::memory_detail
+{
+    /**
+        Allocation hooks for the allocators which track the memory tags.
+        Counters are thread local (single writer), so there is no lock and no atomic read-modify-write.
+     */
+    NAU_KERNEL_EXPORT void onMemoryAllocated(MemoryTag tag, size_t size);
+
+    NAU_KERNEL_EXPORT void onMemoryFreed(MemoryTag tag, size_t size);
+
+    NAU_KERNEL_EXPORT void onSlabMemoryReserved(size_t size);
+
+    NAU_KERNEL_EXPORT void onLargePageMemoryReserved(size_t requestedSize, size_t largePageSize);
+
+    NAU_KERNEL_EXPORT void onLargePageMemoryReleased(size_t requestedSize, size_t largePageSize);
+
+}  // namespace nau::memory_detail
+
+/**
+ * @brief Attributes all allocations of the current thread in the scope to the MemoryTag::Tag.
+ * Example: NAU_MEMORY_SCOPE(Render);
+ */
+#define NAU_MEMORY_SCOPE(Tag) const ::nau::MemoryTagScope ANONYMOUS_VAR(memoryTagScope__){::nau::MemoryTag::Tag}
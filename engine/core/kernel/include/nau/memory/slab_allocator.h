@@ -0,0 +1,85 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+/**
+ * @file slab_allocator.h
+ * @brief Defines the SlabAllocator class: header-less size class allocator for small blocks.
+ */
+
+#pragma once
+
+#include "nau/memory/aligned_allocator_debug.h"
+
+namespace nau
+{
+    /**
+     * @brief Size class allocator that does not store any per-block header.
+     *
+     * Small blocks are carved from the 64KB slabs, each slab contains blocks of the single size class only.
+     * The size class of the block is found in O(1) by the slab address through the global page table,
+     * so the 16 byte node takes exactly 16 bytes of the memory (GeneralAllocator spends additional 16 bytes for the header).
+     * Freed blocks are kept in the per-thread caches (allocation and deallocation are not synchronized),
+     * the excess is moved by batches into the shared per-class lists.
+     * Blocks can be released from any thread.
+     * Slabs are also separated by the memory tag (NAU_MEMORY_SCOPE), so allocations are accounted in the memory stats
+     * without any header.
+     *
+     * Blocks larger than getMaxSlabBlockSize() are allocated directly from the system heap (with a small header).
+     * All instances share the same slab heap, so a block allocated by one instance can be released by another.
+     */
+    class NAU_KERNEL_EXPORT SlabAllocator final : public IAlignedAllocatorDebug
+    {
+    public:
+        /**
+         * @brief Gets the maximum block size that is served by slabs. Larger blocks go to the system heap.
+         */
+        static constexpr size_t getMaxSlabBlockSize()
+        {
+            return 1024;
+        }
+
+        /**
+         * @brief Checks whether the given pointer belongs to the slab heap.
+         *
+         * @param ptr Pointer to check.
+         * @return true if ptr points into the slab memory (not necessary to the allocated block).
+         */
+        [[nodiscard]] static bool isSlabPointer(const void* ptr);
+
+        SlabAllocator();
+
+        /**
+         * @brief Allocates a memory block of the specified size.
+         *
+         * @param size Size of the memory block to allocate. Actual block size is rounded up to the size class.
+         * @return void* Pointer to the allocated memory block, aligned at least by 16 bytes.
+         */
+        [[nodiscard]] void* allocate(size_t size) override;
+
+        /**
+         * @brief Reallocates a memory block to a new size.
+         * Block remains in place while the new size fits into its size class.
+         *
+         * @param ptr Pointer to the memory block to reallocate.
+         * @param size New size of the memory block.
+         * @return void* Pointer to the reallocated memory block.
+         */
+        [[nodiscard]] void* reallocate(void* ptr, size_t size) override;
+
+        /**
+         * @brief Deallocates a memory block.
+         *
+         * @param ptr Pointer to the memory block to deallocate.
+         */
+        void deallocate(void* ptr) override;
+
+        /**
+         * @brief Gets the usable size of the allocated memory block (the size class block size for the small blocks).
+         *
+         * @param ptr Pointer to the memory block.
+         * @return size_t Size of the memory block.
+         */
+        size_t getSize(const void* ptr) const override;
+    };
+
+}  // namespace nau
@@ -0,0 +1,453 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+// nau/messaging/message_channel.h
+
+
+#pragma once
+
+#include <EASTL/span.h>
+#include <EASTL/unique_ptr.h>
+#include <EASTL/vector.h>
+
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <type_traits>
+
+#include "nau/async/executor.h"
+#include "nau/kernel/kernel_config.h"
+#include "nau/string/name_id.h"
+#include "nau/threading/lock_guard.h"
+
+namespace nau
+{
+    /**
+        The bounded multi producer single consumer queue of the messages.
+        The messages are constructed in place in the ring cells, the push and the consume do not lock and do not allocate.
+        When the ring is full the messages go into the overflow list (under the lock) until the consumer drains it.
+     */
+    template <typename T>
+    class MessageQueue
+    {
+    public:
+        explicit MessageQueue(size_t capacity) :
+            m_cells(eastl::make_unique<Cell[]>(capacity)),
+            m_mask(capacity - 1)
+        {
+            NAU_ASSERT(capacity > 1 && (capacity & m_mask) == 0, "The capacity must be the power of two");
+
+            for (size_t i = 0; i < capacity; ++i)
+            {
+                m_cells[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        MessageQueue(const MessageQueue&) = delete;
+        MessageQueue& operator=(const MessageQueue&) = delete;
+
+        ~MessageQueue()
+        {
+            consume([](T&)
+            {
+            });
+        }
+
+        /**
+            Can be called from any thread.
+         */
+        void push(const T& message)
+        {
+            if (!m_isOverflowed.load(std::memory_order_acquire) && tryPushRing(message))
+            {
+                return;
+            }
+
+            lock_(m_overflowMutex);
+            m_overflow.push_back(message);
+            m_isOverflowed.store(true, std::memory_order_seq_cst);
+        }
+
+        /**
+            Calls the callback for all the queued messages. Must be called only from one thread at a time (the consumer).
+         */
+        template <typename Callback>
+        size_t consume(Callback&& callback)
+        {
+            size_t count = 0;
+
+            while (true)
+            {
+                Cell& cell = m_cells[m_dequeuePos & m_mask];
+                if (cell.sequence.load(std::memory_order_acquire) != m_dequeuePos + 1)
+                {
+                    break;
+                }
+
+                T* const message = std::launder(reinterpret_cast<T*>(cell.storage));
+                callback(*message);
+                message->~T();
+
+                cell.sequence.store(m_dequeuePos + m_mask + 1, std::memory_order_release);
+                ++m_dequeuePos;
+                ++count;
+            }
+
+            if (m_isOverflowed.load(std::memory_order_acquire))
+            {
+                eastl::vector<T> overflow;
+                {
+                    lock_(m_overflowMutex);
+                    overflow.swap(m_overflow);
+                    m_isOverflowed.store(false, std::memory_order_release);
+                }
+
+                for (T& message : overflow)
+                {
+                    callback(message);
+                }
+
+                count += overflow.size();
+            }
+
+            return count;
+        }
+
+        /**
+            Checks whether the queue has messages to consume. Must be called only by the consumer.
+         */
+        bool hasMessages() const
+        {
+            const Cell& cell = m_cells[m_dequeuePos & m_mask];
+            return cell.sequence.load(std::memory_order_seq_cst) == m_dequeuePos + 1 || m_isOverflowed.load(std::memory_order_seq_cst);
+        }
+
+    private:
+        struct Cell
+        {
+            std::atomic<size_t> sequence;
+            alignas(T) unsigned char storage[sizeof(T)];
+        };
+
+        bool tryPushRing(const T& message)
+        {
+            Cell* cell = nullptr;
+            size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+
+            while (true)
+            {
+                cell = &m_cells[pos & m_mask];
+                const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+                const intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+
+                if (diff == 0)
+                {
+                    if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    pos = m_enqueuePos.load(std::memory_order_relaxed);
+                }
+            }
+
+            new (cell->storage) T(message);
+            cell->sequence.store(pos + 1, std::memory_order_seq_cst);
+            return true;
+        }
+
+        eastl::unique_ptr<Cell[]> m_cells;
+        const size_t m_mask;
+        alignas(64) std::atomic<size_t> m_enqueuePos = 0;
+        alignas(64) size_t m_dequeuePos = 0;
+
+        std::atomic<bool> m_isOverflowed = false;
+        std::mutex m_overflowMutex;
+        eastl::vector<T> m_overflow;
+    };
+
+    /**
+        The subscriber of the message channel: delivers the queued messages on the subscriber executor.
+        One executor invocation delivers all the messages queued up to the moment, not one invocation per message.
+
+        The subscriber is referenced by its subscription, by the channel subscriber lists and by the scheduled delivery.
+     */
+    class NAU_KERNEL_EXPORT MessageSubscriberBase
+    {
+    public:
+        MessageSubscriberBase(async::Executor::Ptr executor);
+
+        MessageSubscriberBase(const MessageSubscriberBase&) = delete;
+
+        virtual ~MessageSubscriberBase();
+
+        MessageSubscriberBase& operator=(const MessageSubscriberBase&) = delete;
+
+        void addRef();
+
+        void releaseRef();
+
+        /**
+            The handler is not called for the messages delivered after the cancellation.
+            The delivery which is already running on the other thread is not awaited.
+         */
+        void cancel();
+
+        bool isCancelled() const;
+
+    protected:
+        /**
+            Schedules the delivery on the executor if it is not scheduled yet. Called after the message is queued.
+         */
+        void scheduleDelivery();
+
+        /**
+            Delivers (or drops if cancelled) all the queued messages. Called on the executor.
+         */
+        virtual void deliverMessages() = 0;
+
+        virtual bool hasMessages() const = 0;
+
+    private:
+        static void deliveryCallback(void* data1, void* data2) noexcept;
+
+        const async::Executor::Ptr m_executor;
+        std::atomic<uint32_t> m_refs = 1;
+        std::atomic<bool> m_isScheduled = false;
+        std::atomic<bool> m_isCancelled = false;
+    };
+
+    class MessageChannelSubscription;
+
+    /**
+        The typeless part of the message channel: the channel id and the list of the subscribers.
+
+        The subscriber list is read without the locks: it is replaced as the whole on the subscription change
+        and the replaced lists are released when there are no readers (by the writer or by the last leaving reader).
+     */
+    class NAU_KERNEL_EXPORT MessageChannelBase
+    {
+    public:
+        MessageChannelBase(eastl::string_view channelName);
+
+        MessageChannelBase(const MessageChannelBase&) = delete;
+
+        ~MessageChannelBase();
+
+        MessageChannelBase& operator=(const MessageChannelBase&) = delete;
+
+        /**
+            The interned channel id (see NameId::intern), the channel name is accessible through NameId::getName().
+         */
+        NameId getChannelId() const;
+
+        bool hasSubscribers() const;
+
+    protected:
+        using SubscriberList = eastl::vector<MessageSubscriberBase*>;
+
+        /**
+            Takes the subscriber reference.
+         */
+        MessageChannelSubscription addSubscriber(MessageSubscriberBase* subscriber);
+
+        template <typename Callback>
+        void forEachSubscriber(Callback&& callback)
+        {
+            m_readerCount.fetch_add(1, std::memory_order_seq_cst);
+
+            if (const SubscriberList* const subscribers = m_subscribers.load(std::memory_order_seq_cst))
+            {
+                for (MessageSubscriberBase* const subscriber : *subscribers)
+                {
+                    callback(*subscriber);
+                }
+            }
+
+            if (m_readerCount.fetch_sub(1, std::memory_order_seq_cst) == 1 && m_hasRetiredSubscribers.load(std::memory_order_seq_cst))
+            {
+                releaseRetiredSubscribers();
+            }
+        }
+
+    private:
+        void removeSubscriber(MessageSubscriberBase& subscriber);
+
+        void replaceSubscribers(SubscriberList* subscribers);
+
+        void releaseRetiredSubscribers();
+
+        static void releaseSubscribers(SubscriberList* subscribers);
+
+        const NameId m_channelId;
+        std::atomic<SubscriberList*> m_subscribers = nullptr;
+        std::atomic<size_t> m_readerCount = 0;
+
+        std::mutex m_mutex;
+        eastl::vector<SubscriberList*> m_retiredSubscribers;
+        std::atomic<bool> m_hasRetiredSubscribers = false;
+
+        friend class MessageChannelSubscription;
+    };
+
+    /**
+        The subscription to the message channel: the handler is not called after the subscription is reset (see MessageSubscriberBase::cancel).
+     */
+    class [[nodiscard]] NAU_KERNEL_EXPORT MessageChannelSubscription
+    {
+    public:
+        MessageChannelSubscription() = default;
+
+        MessageChannelSubscription(MessageChannelSubscription&&);
+
+        MessageChannelSubscription(const MessageChannelSubscription&) = delete;
+
+        ~MessageChannelSubscription();
+
+        MessageChannelSubscription& operator=(MessageChannelSubscription&&);
+
+        MessageChannelSubscription& operator=(std::nullptr_t);
+
+        MessageChannelSubscription& operator=(const MessageChannelSubscription&) = delete;
+
+        explicit operator bool() const;
+
+        void reset();
+
+    private:
+        MessageChannelSubscription(MessageChannelBase& channel, MessageSubscriberBase* subscriber);
+
+        MessageChannelBase* m_channel = nullptr;
+        MessageSubscriberBase* m_subscriber = nullptr;
+
+        friend class MessageChannelBase;
+    };
+
+    /**
+        The typed message channel for the high frequency messages.
+
+        Unlike AsyncMessageSource::post, the post to the channel does not box the message into the RuntimeValue,
+        does not look up the stream by the name and does not lock: the message is copied into the lock-free queue of each subscriber
+        and the subscriber delivery is scheduled on its executor once for all the messages queued before it runs.
+
+        Declared with NAU_DECLARE_MESSAGE_CHANNEL.
+     */
+    template <typename T>
+    class MessageChannel final : public MessageChannelBase
+    {
+    public:
+        using ValueType = T;
+
+        static constexpr size_t QueueCapacity = 256;
+
+        using MessageChannelBase::MessageChannelBase;
+
+        void post(const T& message)
+        {
+            forEachSubscriber([&message](MessageSubscriberBase& subscriber)
+            {
+                static_cast<Subscriber&>(subscriber).push(message);
+            });
+        }
+
+        /**
+            Posts the messages with the single delivery scheduling per subscriber.
+         */
+        void post(eastl::span<const T> messages)
+        {
+            forEachSubscriber([messages](MessageSubscriberBase& subscriber)
+            {
+                static_cast<Subscriber&>(subscriber).push(messages);
+            });
+        }
+
+        /**
+            @param handler Called on the executor for each delivered message: `void(const T&)`.
+            @param executor The executor of the delivery, the default executor if not specified.
+         */
+        template <typename Callable>
+            requires(std::is_invocable_r_v<void, Callable, const T&>)
+        MessageChannelSubscription subscribe(Callable handler, async::Executor::Ptr executor = nullptr)
+        {
+            if (!executor)
+            {
+                executor = async::Executor::getDefault();
+            }
+
+            NAU_FATAL(executor);
+            return addSubscriber(new HandlerSubscriber<Callable>(std::move(executor), std::move(handler)));
+        }
+
+    private:
+        class Subscriber : public MessageSubscriberBase
+        {
+        public:
+            Subscriber(async::Executor::Ptr executor) :
+                MessageSubscriberBase(std::move(executor)),
+                m_queue(QueueCapacity)
+            {
+            }
+
+            void push(const T& message)
+            {
+                m_queue.push(message);
+                scheduleDelivery();
+            }
+
+            void push(eastl::span<const T> messages)
+            {
+                for (const T& message : messages)
+                {
+                    m_queue.push(message);
+                }
+
+                scheduleDelivery();
+            }
+
+        protected:
+            bool hasMessages() const override
+            {
+                return m_queue.hasMessages();
+            }
+
+            MessageQueue<T> m_queue;
+        };
+
+        template <typename Callable>
+        class HandlerSubscriber final : public Subscriber
+        {
+        public:
+            HandlerSubscriber(async::Executor::Ptr executor, Callable handler) :
+                Subscriber(std::move(executor)),
+                m_handler(std::move(handler))
+            {
+            }
+
+        private:
+            void deliverMessages() override
+            {
+                this->m_queue.consume([this](const T& message)
+                {
+                    if (!this->isCancelled())
+                    {
+                        m_handler(message);
+                    }
+                });
+            }
+
+            Callable m_handler;
+        };
+    };
+
+}  // namespace nau
+
+#define NAU_DECLARE_MESSAGE_CHANNEL(Descriptor, ChannelName, ValueType) \
+    inline ::nau::MessageChannel<ValueType> Descriptor                 \
+    {                                                                   \
+        ChannelName                                                     \
+    }
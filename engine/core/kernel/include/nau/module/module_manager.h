@@ -3,12 +3,16 @@
 
 #pragma once
 
+#include <EASTL/algorithm.h>
 #include <EASTL/shared_ptr.h>
 #include <EASTL/string.h>
 #include <EASTL/string_view.h>
 #include <EASTL/unique_ptr.h>
+#include <EASTL/vector.h>
 
+#include "nau/async/task_base.h"
 #include "nau/kernel/kernel_config.h"
+#include "nau/meta/class_info.h"
 #include "nau/rtti/rtti_object.h"
 #include "nau/string/hash_string.h"
 #include "nau/utils/result.h"
@@ -17,6 +21,36 @@ namespace nau
 {
     struct IModule;
 
+    /**
+        The manifest of the module, shipped next to the module library as "<module>.module.json".
+
+        The module which has the manifest can be loaded lazily (see "engine/modules/lazyLoading"):
+        its library is loaded only by the first request of the service or the class it provides (ServiceProvider::find/get/has/findClasses),
+        or by the background preload after the first frame (see "engine/modules/preloadLazyModules").
+        The types are named as rtti::TypeInfo::getTypeName() names them, i.e. "nau::IAssetManager".
+     */
+    struct ModuleManifest
+    {
+        eastl::vector<eastl::string> services; /** < The service APIs the module adds. */
+        eastl::vector<eastl::string> classes;  /** < The interfaces of the class descriptors the module adds. */
+        bool lazy = true;                      /** < False when the module must be loaded at startup anyway (i.e. it subscribes to the engine events). */
+
+        NAU_CLASS_FIELDS(
+            CLASS_FIELD(services),
+            CLASS_FIELD(classes),
+            CLASS_FIELD(lazy))
+
+        bool providesType(eastl::string_view typeName) const
+        {
+            const auto isType = [typeName](const eastl::string& name)
+            {
+                return name == typeName;
+            };
+
+            return eastl::any_of(services.begin(), services.end(), isType) || eastl::any_of(classes.begin(), classes.end(), isType);
+        }
+    };
+
     /**
      */
     struct NAU_ABSTRACT_TYPE IModuleManager
@@ -58,7 +92,26 @@ namespace nau
 #if !NAU_STATIC_RUNTIME
         // For runtime module loading
         virtual Result<> loadModule(const nau::string& name, const nau::string& dllPath) = 0;
+
+        /**
+            @brief Registers the module to be loaded by the first request of one of the types in its manifest.
+         */
+        virtual void addLazyModule(const nau::string& name, const nau::string& dllPath, ModuleManifest manifest) = 0;
 #endif
+
+        /**
+            @brief Loads the lazy modules which provide the type. Called by the service provider when the type is not found.
+
+            @return true if any module has been loaded: the type should be looked up again.
+         */
+        virtual bool loadLazyModulesForType(const rtti::TypeInfo& type) = 0;
+
+        virtual bool hasLazyModules() const = 0;
+
+        /**
+            @brief Loads all the remaining lazy modules one by one on the worker thread.
+         */
+        virtual async::Task<> preloadLazyModules() = 0;
     };
 
     NAU_KERNEL_EXPORT IModuleManager::Ptr createModuleManager();
@@ -68,4 +121,9 @@ namespace nau
     NAU_KERNEL_EXPORT bool hasModuleManager();
 
     NAU_KERNEL_EXPORT Result<> loadModulesList(eastl::string_view moduleList);
+
+    /**
+        @brief Starts the background preload of the lazy modules if "engine/modules/preloadLazyModules" is on (default). Called after the first frame.
+     */
+    NAU_KERNEL_EXPORT void startLazyModulesPreload();
 }  // namespace nau
@@ -7,12 +7,14 @@
 #include <EASTL/functional.h>
 #include <guiddef.h>
 
+#include <cstring>
 #include <string>
 #include <string_view>
 #include <type_traits>
 
 #include "nau/kernel/kernel_config.h"
 #include "nau/rtti/type_info.h"
+#include "nau/utils/mum_hash.h"
 #include "nau/utils/result.h"
 
 namespace nau
@@ -39,7 +41,18 @@ namespace nau
     private:
         Uid(GUID data) noexcept;
 
-        size_t getHashCode() const;
+        /**
+            The hash of all the 128 bits: the two halves are mixed by the single multiplication step
+            (UuidHash gives only 16 bits, which collides in the large Uid maps).
+         */
+        size_t getHashCode() const
+        {
+            static_assert(sizeof(GUID) == sizeof(uint64_t) * 2);
+
+            uint64_t parts[2];
+            memcpy(parts, &m_data, sizeof(GUID));
+            return static_cast<size_t>(mum_hash64(parts[0], parts[1]));
+        }
 
         GUID m_data;
 
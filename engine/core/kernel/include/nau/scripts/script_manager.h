@@ -3,18 +3,164 @@
 
 
 #pragma once
+#include <EASTL/array.h>
 #include <EASTL/span.h>
 #include <EASTL/string_view.h>
+#include <EASTL/variant.h>
 
+#include <chrono>
+#include <string_view>
+#include <type_traits>
+
+#include "nau/async/executor.h"
+#include "nau/async/task.h"
 #include "nau/dispatch/class_descriptor.h"
 #include "nau/dispatch/dispatch.h"
 #include "nau/io/fs_path.h"
+#include "nau/math/math.h"
+#include "nau/rtti/rtti_object.h"
 #include "nau/rtti/type_info.h"
 #include "nau/utils/functor.h"
 #include "nau/utils/result.h"
 
 namespace nau::scripts
 {
+    /**
+     * @brief Memory usage of the script state (in bytes).
+     */
+    struct ScriptMemoryStatistics
+    {
+        size_t usedBytes = 0;
+        size_t peakBytes = 0;
+        // Memory reserved by the small objects pools (included in the used memory only for the live objects)
+        size_t pooledBytes = 0;
+        // 0 if the memory is not limited
+        size_t memoryLimit = 0;
+    };
+
+    /**
+     * @brief Argument (or result) of the typed script call: passed to the script stack as is, without the RuntimeValue boxing.
+     * The string is passed by the view: the result string is valid until the next typed call.
+     */
+    using ScriptValue = eastl::variant<eastl::monostate, bool, int64_t, double, eastl::string_view, math::vec2, math::vec3, math::vec4, math::quat>;
+
+    namespace scripts_detail
+    {
+        template <typename T>
+        struct ScriptValueType
+        {
+            using type = std::conditional_t<std::is_same_v<T, bool>, bool,
+                         std::conditional_t<std::is_integral_v<T> || std::is_enum_v<T>, int64_t,
+                         std::conditional_t<std::is_floating_point_v<T>, double,
+                         std::conditional_t<std::is_convertible_v<const T&, eastl::string_view> || std::is_convertible_v<const T&, std::string_view>, eastl::string_view,
+                         T>>>>;
+        };
+
+        template <typename T>
+        using ScriptValueType_t = typename ScriptValueType<std::decay_t<T>>::type;
+
+        template <typename T>
+        concept TypedScriptValue = std::is_arithmetic_v<T> || std::is_enum_v<T> ||
+                                   std::is_convertible_v<const T&, eastl::string_view> || std::is_convertible_v<const T&, std::string_view> ||
+                                   std::is_same_v<T, math::vec2> || std::is_same_v<T, math::vec3> || std::is_same_v<T, math::vec4> || std::is_same_v<T, math::quat>;
+
+        template <typename T>
+        ScriptValue makeScriptValue(const T& value)
+        {
+            using ValueType = ScriptValueType_t<T>;
+
+            if constexpr (std::is_same_v<ValueType, eastl::string_view> && !std::is_convertible_v<const T&, eastl::string_view>)
+            {
+                const std::string_view str{value};
+                return eastl::string_view{str.data(), str.size()};
+            }
+            else
+            {
+                return static_cast<ValueType>(value);
+            }
+        }
+
+        template <typename T>
+        T fromScriptValue(const ScriptValue& value)
+        {
+            const auto& typedValue = eastl::get<ScriptValueType_t<T>>(value);
+            if constexpr (std::is_same_v<ScriptValueType_t<T>, eastl::string_view>)
+            {
+                return T{typedValue.data(), typedValue.size()};
+            }
+            else
+            {
+                return static_cast<T>(typedValue);
+            }
+        }
+
+        template <typename R, typename Target, typename... Args>
+        Result<R> invokeTyped(Target& target, eastl::string_view function, const Args&... args)
+        {
+            const eastl::array<ScriptValue, sizeof...(Args)> arguments{makeScriptValue(args)...};
+
+            if constexpr (std::is_void_v<R>)
+            {
+                return target.invokeFunction(function, arguments, nullptr);
+            }
+            else
+            {
+                ScriptValue result{ScriptValueType_t<R>{}};
+                NauCheckResult(target.invokeFunction(function, arguments, &result));
+                return fromScriptValue<R>(result);
+            }
+        }
+    }  // namespace scripts_detail
+
+    /**
+     * @brief Isolated script environment: its own script state (globals, loaded modules, memory) executed on its own executor.
+     *
+     * The environment methods must be called only on the environment executor (see run): the environments are executed in parallel.
+     * The environments do not share any script data, the scripts exchange the messages through the application broadcaster (getBroadcaster):
+     * messaging.post(streamName, value) and messaging.subscribe(streamName, function(value) ... end).
+     * The posted values are copied, so the tables can be passed between the environments.
+     */
+    struct NAU_ABSTRACT_TYPE IScriptEnvironment : virtual IRefCounted
+    {
+        NAU_INTERFACE(nau::scripts::IScriptEnvironment, IRefCounted)
+
+        using Ptr = nau::Ptr<IScriptEnvironment>;
+
+        virtual eastl::string_view getName() const = 0;
+
+        virtual async::Executor::Ptr getExecutor() const = 0;
+
+        virtual Result<> executeScriptFromBytes(const char* scriptName, eastl::span<const std::byte> scriptCode) = 0;
+
+        virtual Result<> executeScriptFromFile(const io::FsPath& path) = 0;
+
+        virtual Result<> invokeFunction(eastl::string_view function, eastl::span<const ScriptValue> args, ScriptValue* result) = 0;
+
+        virtual ScriptMemoryStatistics getMemoryStatistics() const = 0;
+
+        /**
+         * @brief Calls the global script function of the environment (see ScriptManager::invoke).
+         */
+        template <typename R = void, typename... Args>
+        requires(std::is_void_v<R> || scripts_detail::TypedScriptValue<R>) && (scripts_detail::TypedScriptValue<Args> && ...)
+        Result<R> invoke(eastl::string_view function, const Args&... args)
+        {
+            return scripts_detail::invokeTyped<R>(*this, function, args...);
+        }
+
+        /**
+         * @brief Runs the operation (void(IScriptEnvironment&)) on the environment executor.
+         */
+        template <typename F>
+        async::Task<> run(F operation)
+        {
+            return async::run([environment = Ptr{this}, operation = std::move(operation)]() mutable
+            {
+                operation(*environment);
+            }, getExecutor());
+        }
+    };
+
     /**
      */
     struct NAU_ABSTRACT_TYPE ScriptManager
@@ -31,12 +177,87 @@ namespace nau::scripts
 
         virtual Result<> invokeGlobal(eastl::string_view method, DispatchArguments args, Functor<void(const nau::Ptr<>& result)>) = 0;
 
+        /**
+         * @brief Calls the global script function with the typed arguments (see invoke).
+         * The functions are resolved once: the references are kept until the next script is executed.
+         *
+         * @param [in] function     Name of the global function.
+         * @param [in] args         Arguments pushed to the script stack.
+         * @param [in, out] result  Optional result: the held alternative defines the expected result type.
+         */
+        virtual Result<> invokeFunction(eastl::string_view function, eastl::span<const ScriptValue> args, ScriptValue* result) = 0;
+
         virtual Result<Ptr<IDispatch>> createScriptInstance(eastl::string_view scriptClass) = 0;
 
         virtual void addScriptSearchPath(io::FsPath path) = 0;
 
         virtual void addScriptFileExtension(eastl::string_view ext) = 0;
 
+        virtual ScriptMemoryStatistics getMemoryStatistics() const = 0;
+
+        /**
+         * @brief Limits the script memory: the allocations over the limit fail with the script memory error.
+         *
+         * @param [in] limit Limit in bytes, 0 removes the limit.
+         */
+        virtual void setMemoryLimit(size_t limit) = 0;
+
+        /**
+         * @brief Sets the time spent on the incremental garbage collection steps each frame (at the end of the frame update).
+         * The zero budget stops the scheduled collection (the Lua automatic collection is still performed when the memory grows significantly).
+         */
+        virtual void setGcFrameBudget(std::chrono::microseconds budget) = 0;
+
+        /**
+         * @brief Requests the full garbage collection, it is performed at the next frame update regardless of the frame budget.
+         * Intended for the level transitions, when the long frame is not noticeable.
+         */
+        virtual void collectGarbage() = 0;
+
+        /**
+         * @brief Creates the isolated script environment (i.e. per world or per subsystem: AI, UI).
+         * The registered classes, the search paths and the memory settings are applied to the new environment.
+         * The methods of ScriptManager itself operate on the main environment (executed on the thread that initialized the service).
+         *
+         * @param [in] name     Unique name of the environment.
+         * @param [in] executor Executor of the environment, if not specified the environment gets its own worker thread.
+         *                      Must execute the invocations one at a time (the script state is not thread safe).
+         * @return              The environment or nullptr if the environment with the name already exists.
+         */
+        virtual IScriptEnvironment::Ptr createEnvironment(eastl::string_view name, async::Executor::Ptr executor = nullptr) = 0;
+
+        virtual IScriptEnvironment::Ptr findEnvironment(eastl::string_view name) const = 0;
+
+        /**
+         * @brief Shuts down the environment (on its executor) and removes it from the manager.
+         */
+        virtual async::Task<> destroyEnvironment(eastl::string_view name) = 0;
+
+        /**
+         * @brief Adds the native object to the batched update of the script function (of the main environment).
+         * Each frame (at the game pre update) the function is called once for all its objects: function(handles, count, dt),
+         * the handles array keeps the objects as the light userdata (the views the script passes back to the native functions),
+         * dt is in seconds. So the script iterates the objects itself instead of the per object native to script calls.
+         *
+         * @param [in] updateFunction   Name of the global function.
+         * @param [in] object           Object state, must stay valid until it is removed from the update.
+         */
+        virtual void addBatchedUpdate(eastl::string_view updateFunction, void* object) = 0;
+
+        virtual void removeBatchedUpdate(eastl::string_view updateFunction, void* object) = 0;
+
+        /**
+         * @brief Calls the global script function without boxing the arguments and the result (unlike invokeGlobal).
+         * Supported types: bool, integers, enums, floating point numbers, strings and the math vectors (vec2, vec3, vec4, quat).
+         * The string_view result is valid until the next typed call.
+         */
+        template <typename R = void, typename... Args>
+        requires(std::is_void_v<R> || scripts_detail::TypedScriptValue<R>) && (scripts_detail::TypedScriptValue<Args> && ...)
+        Result<R> invoke(eastl::string_view function, const Args&... args)
+        {
+            return scripts_detail::invokeTyped<R>(*this, function, args...);
+        }
+
         template <typename T>
         void registerNativeClass()
         {
@@ -32,6 +32,12 @@ namespace nau::scripts
 
         Result<R> operator()(P... params)
         {
+            // the primitives and the math vectors are passed without boxing
+            if constexpr ((std::is_void_v<R> || scripts_detail::TypedScriptValue<R>) && (scripts_detail::TypedScriptValue<std::decay_t<P>> && ...))
+            {
+                return getServiceProvider().get<scripts::ScriptManager>().invoke<R>(name, params...);
+            }
+
             DispatchArguments args;
             (args.emplace_back(makeValueCopy(std::move(params))), ...);
 
@@ -0,0 +1,531 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+// nau/serialization/binary_serialization.h
+
+
+#pragma once
+
+#include <EASTL/span.h>
+
+#include <cstring>
+#include <type_traits>
+
+#include "nau/memory/bytes_buffer.h"
+#include "nau/serialization/native_runtime_value/native_value_forwards.h"
+#include "nau/serialization/serialization.h"
+
+namespace nau::serialization
+{
+    /**
+        Compact binary format written directly from the C++ objects (by the NAU_CLASS_FIELDS metadata) without the RuntimeValue graph.
+
+        Layout:
+            - arithmetic values and enums: the native (little endian) representation;
+            - strings, collections, dictionaries: the varuint elements count followed by the elements;
+            - optional: the bool flag followed by the value;
+            - tuples: the elements one after another;
+            - trivially copyable types with own runtime value representation (math types): the native representation;
+            - objects: the varuint fields count followed by the fields, each one prefixed with its uint32 payload size.
+
+        The objects are versioned by the fields order: the new fields must be appended to the end of NAU_CLASS_FIELDS.
+        Reading skips the unknown (trailing) fields of the newer data and keeps the default values of the fields missed in the older data.
+     */
+    class BinaryWriter
+    {
+    public:
+        explicit BinaryWriter(BytesBuffer& buffer) :
+            m_buffer(buffer)
+        {
+        }
+
+        void writeBytes(const void* data, size_t size)
+        {
+            if (size > 0)
+            {
+                memcpy(m_buffer.append(size), data, size);
+            }
+        }
+
+        template <typename T>
+        requires(std::is_trivially_copyable_v<T>)
+        void writeRaw(const T& value)
+        {
+            writeBytes(&value, sizeof(T));
+        }
+
+        void writeVarUInt(uint64_t value)
+        {
+            std::byte bytes[10];
+            size_t count = 0;
+            do
+            {
+                const uint8_t lowBits = static_cast<uint8_t>(value & 0x7f);
+                value >>= 7;
+                bytes[count++] = static_cast<std::byte>(value != 0 ? (lowBits | 0x80) : lowBits);
+            } while (value != 0);
+
+            writeBytes(bytes, count);
+        }
+
+        /**
+            Reserves uint32 value that must be written later with patchUInt32 (i.e. the size of the data that follows).
+         */
+        size_t reserveUInt32()
+        {
+            const size_t offset = m_buffer.size();
+            m_buffer.append(sizeof(uint32_t));
+            return offset;
+        }
+
+        void patchUInt32(size_t offset, uint32_t value)
+        {
+            NAU_ASSERT(offset + sizeof(uint32_t) <= m_buffer.size());
+            memcpy(m_buffer.data() + offset, &value, sizeof(uint32_t));
+        }
+
+        size_t getPosition() const
+        {
+            return m_buffer.size();
+        }
+
+    private:
+        BytesBuffer& m_buffer;
+    };
+
+    /**
+     */
+    class BinaryReader
+    {
+    public:
+        explicit BinaryReader(eastl::span<const std::byte> data) :
+            m_data(data)
+        {
+        }
+
+        Result<eastl::span<const std::byte>> readView(size_t size)
+        {
+            if (m_data.size() - m_position < size)
+            {
+                return NauMakeErrorT(EndOfStreamError)();
+            }
+
+            const auto view = m_data.subspan(m_position, size);
+            m_position += size;
+            return view;
+        }
+
+        Result<> readBytes(void* data, size_t size)
+        {
+            auto view = readView(size);
+            NauCheckResult(view);
+
+            if (size > 0)
+            {
+                memcpy(data, view->data(), size);
+            }
+            return ResultSuccess;
+        }
+
+        template <typename T>
+        requires(std::is_trivially_copyable_v<T>)
+        Result<> readRaw(T& value)
+        {
+            return readBytes(&value, sizeof(T));
+        }
+
+        Result<uint64_t> readVarUInt()
+        {
+            uint64_t value = 0;
+            for (unsigned shift = 0; shift < 64; shift += 7)
+            {
+                if (m_position == m_data.size())
+                {
+                    return NauMakeErrorT(EndOfStreamError)();
+                }
+
+                const uint8_t byte = static_cast<uint8_t>(m_data[m_position++]);
+                value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+                if ((byte & 0x80) == 0)
+                {
+                    return value;
+                }
+            }
+
+            return NauMakeErrorT(NumericOverflowError)();
+        }
+
+        /**
+            Reads the elements count: the count is limited by the remaining data size (each element takes at least one byte, except the empty objects)
+            to not allocate huge containers for the corrupted data.
+         */
+        Result<size_t> readCount()
+        {
+            auto count = readVarUInt();
+            NauCheckResult(count);
+
+            if (*count > m_data.size() - m_position)
+            {
+                return NauMakeErrorT(EndOfStreamError)();
+            }
+
+            return static_cast<size_t>(*count);
+        }
+
+        size_t getRemainingSize() const
+        {
+            return m_data.size() - m_position;
+        }
+
+    private:
+        eastl::span<const std::byte> m_data;
+        size_t m_position = 0;
+    };
+
+}  // namespace nau::serialization
+
+namespace nau::ser_detail
+{
+    template <typename T>
+    concept BinaryStringLike = requires(const T& str) {
+        typename T::traits_type;
+        { str.data() } -> std::same_as<const typename T::value_type*>;
+        { str.size() } -> std::same_as<typename T::size_type>;
+    } && requires(T& str) {
+        str.resize(size_t{0});
+    } && (sizeof(typename T::value_type) == sizeof(char));
+
+    template <typename T>
+    inline constexpr bool AlwaysFalse = false;
+
+}  // namespace nau::ser_detail
+
+namespace nau::serialization
+{
+    template <typename T>
+    void binaryWrite(BinaryWriter& writer, const T& value);
+
+    template <typename T>
+    Result<> binaryRead(BinaryReader& reader, T& value);
+
+    /**
+        Writes the value to the writer: the type must be one of the types that have RuntimeValue representation
+        (arithmetic, enum, string, optional, tuple, collection, dictionary, NAU_CLASS_FIELDS object or string representable type).
+     */
+    template <typename T>
+    void binaryWrite(BinaryWriter& writer, const T& value)
+    {
+        if constexpr (std::is_same_v<T, bool>)
+        {
+            writer.writeRaw<uint8_t>(value ? 1 : 0);
+        }
+        else if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>)
+        {
+            writer.writeRaw(value);
+        }
+        else if constexpr (ser_detail::BinaryStringLike<T>)
+        {
+            writer.writeVarUInt(value.size());
+            writer.writeBytes(value.data(), value.size());
+        }
+        else if constexpr (LikeStdOptional<T>)
+        {
+            binaryWrite(writer, value.has_value());
+            if (value.has_value())
+            {
+                binaryWrite(writer, *value);
+            }
+        }
+        else if constexpr (LikeTuple<T>)
+        {
+            std::apply([&writer](const auto&... element)
+            {
+                (binaryWrite(writer, element), ...);
+            }, value);
+        }
+        else if constexpr (LikeUniformTuple<T>)
+        {
+            for (const auto& element : value)
+            {
+                binaryWrite(writer, element);
+            }
+        }
+        else if constexpr (LikeStdMap<T>)
+        {
+            writer.writeVarUInt(value.size());
+            for (const auto& [key, element] : value)
+            {
+                binaryWrite(writer, key);
+                binaryWrite(writer, element);
+            }
+        }
+        else if constexpr (LikeSet<T> || LikeStdCollection<T>)
+        {
+            writer.writeVarUInt(value.size());
+            for (const auto& element : value)
+            {
+                binaryWrite(writer, element);
+            }
+        }
+        else if constexpr (NauClassWithFields<T>)
+        {
+            const auto fields = meta::getClassAllFields<T>();
+
+            writer.writeVarUInt(std::tuple_size_v<std::decay_t<decltype(fields)>>);
+            std::apply([&writer, &value](const auto&... field)
+            {
+                const auto writeField = [&writer, &value](const auto& field)
+                {
+                    const size_t sizeOffset = writer.reserveUInt32();
+                    const size_t fieldPosition = writer.getPosition();
+                    binaryWrite(writer, field.getValue(value));
+                    writer.patchUInt32(sizeOffset, static_cast<uint32_t>(writer.getPosition() - fieldPosition));
+                };
+
+                (writeField(field), ...);
+            }, fields);
+        }
+        else if constexpr (AutoStringRepresentable<T>)
+        {
+            binaryWrite(writer, toString(value));
+        }
+        else if constexpr (std::is_trivially_copyable_v<T> && RuntimeValueRepresentable<T>)
+        {
+            // Types with own runtime value representation (math types): written as is.
+            writer.writeRaw(value);
+        }
+        else
+        {
+            static_assert(ser_detail::AlwaysFalse<T>, "Type does not supported by the binary serialization");
+        }
+    }
+
+    /**
+        Reads the value written by binaryWrite.
+     */
+    template <typename T>
+    Result<> binaryRead(BinaryReader& reader, T& value)
+    {
+        if constexpr (std::is_same_v<T, bool>)
+        {
+            uint8_t flag = 0;
+            NauCheckResult(reader.readRaw(flag));
+            value = flag != 0;
+        }
+        else if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>)
+        {
+            NauCheckResult(reader.readRaw(value));
+        }
+        else if constexpr (ser_detail::BinaryStringLike<T>)
+        {
+            auto size = reader.readCount();
+            NauCheckResult(size);
+
+            value.resize(*size);
+            NauCheckResult(reader.readBytes(value.data(), *size));
+        }
+        else if constexpr (LikeStdOptional<T>)
+        {
+            bool hasValue = false;
+            NauCheckResult(binaryRead(reader, hasValue));
+            if (!hasValue)
+            {
+                value.reset();
+                return ResultSuccess;
+            }
+
+            value.emplace();
+            NauCheckResult(binaryRead(reader, value.value()));
+        }
+        else if constexpr (LikeTuple<T>)
+        {
+            return std::apply([&reader](auto&... element) -> Result<>
+            {
+                Result<> result = ResultSuccess;
+                [[maybe_unused]] const bool success = ((result = binaryRead(reader, element)) && ...);
+                return result;
+            }, value);
+        }
+        else if constexpr (LikeUniformTuple<T>)
+        {
+            for (auto& element : value)
+            {
+                NauCheckResult(binaryRead(reader, element));
+            }
+        }
+        else if constexpr (LikeStdMap<T>)
+        {
+            auto count = reader.readCount();
+            NauCheckResult(count);
+
+            value.clear();
+            for (size_t i = 0; i < *count; ++i)
+            {
+                typename T::key_type key{};
+                NauCheckResult(binaryRead(reader, key));
+
+                auto [iter, emplaced] = value.try_emplace(std::move(key));
+                NauCheckResult(binaryRead(reader, iter->second));
+            }
+        }
+        else if constexpr (LikeSet<T>)
+        {
+            auto count = reader.readCount();
+            NauCheckResult(count);
+
+            value.clear();
+            for (size_t i = 0; i < *count; ++i)
+            {
+                typename T::value_type element{};
+                NauCheckResult(binaryRead(reader, element));
+                value.emplace(std::move(element));
+            }
+        }
+        else if constexpr (LikeStdCollection<T>)
+        {
+            auto count = reader.readCount();
+            NauCheckResult(count);
+
+            value.clear();
+            if constexpr (requires { value.reserve(size_t{0}); })
+            {
+                value.reserve(*count);
+            }
+
+            for (size_t i = 0; i < *count; ++i)
+            {
+                NauCheckResult(binaryRead(reader, value.emplace_back()));
+            }
+        }
+        else if constexpr (NauClassWithFields<T>)
+        {
+            auto fieldsCount = reader.readCount();
+            NauCheckResult(fieldsCount);
+
+            size_t fieldIndex = 0;
+            Result<> result = ResultSuccess;
+
+            const auto readField = [&](const auto& field) -> bool
+            {
+                if (fieldIndex++ >= *fieldsCount)
+                {
+                    // Field is missed in the older data: the current value is kept.
+                    return true;
+                }
+
+                uint32_t fieldSize = 0;
+                if (result = reader.readRaw(fieldSize); !result)
+                {
+                    return false;
+                }
+
+                auto fieldData = reader.readView(fieldSize);
+                if (!fieldData)
+                {
+                    result = fieldData.getError();
+                    return false;
+                }
+
+                using FieldValue = std::remove_reference_t<decltype(field.getValue(value))>;
+                if constexpr (!std::is_const_v<FieldValue>)
+                {
+                    BinaryReader fieldReader{*fieldData};
+                    result = binaryRead(fieldReader, field.getValue(value));
+                }
+
+                return static_cast<bool>(result);
+            };
+
+            std::apply([&readField](const auto&... field)
+            {
+                (readField(field) && ...);
+            }, meta::getClassAllFields<T>());
+
+            NauCheckResult(result);
+
+            // Unknown fields written by the newer version of the type.
+            for (; fieldIndex < *fieldsCount; ++fieldIndex)
+            {
+                uint32_t fieldSize = 0;
+                NauCheckResult(reader.readRaw(fieldSize));
+                NauCheckResult(reader.readView(fieldSize));
+            }
+        }
+        else if constexpr (AutoStringRepresentable<T>)
+        {
+            std::string str;
+            NauCheckResult(binaryRead(reader, str));
+            return parse(std::string_view{str}, value);
+        }
+        else if constexpr (std::is_trivially_copyable_v<T> && RuntimeValueRepresentable<T>)
+        {
+            NauCheckResult(reader.readRaw(value));
+        }
+        else
+        {
+            static_assert(ser_detail::AlwaysFalse<T>, "Type does not supported by the binary serialization");
+        }
+
+        return ResultSuccess;
+    }
+
+    /**
+        The header of the data produced by binarySerialize.
+     */
+    struct BinarySerializationHeader
+    {
+        static constexpr uint32_t Magic = 0x4E415542;  // 'NAUB'
+        static constexpr uint16_t FormatVersion = 1;
+
+        uint32_t magic;
+        uint16_t formatVersion;
+    };
+
+    /**
+        Serializes the value into the buffer (appends the header and the value data).
+     */
+    template <typename T>
+    void binarySerialize(const T& value, BytesBuffer& buffer)
+    {
+        BinaryWriter writer{buffer};
+        writer.writeRaw(BinarySerializationHeader::Magic);
+        writer.writeRaw(BinarySerializationHeader::FormatVersion);
+        binaryWrite(writer, value);
+    }
+
+    template <typename T>
+    BytesBuffer binarySerialize(const T& value)
+    {
+        BytesBuffer buffer;
+        binarySerialize(value, buffer);
+        return buffer;
+    }
+
+    /**
+        Deserializes the value written by binarySerialize.
+     */
+    template <typename T>
+    Result<> binaryDeserialize(eastl::span<const std::byte> data, T& value)
+    {
+        BinaryReader reader{data};
+
+        uint32_t magic = 0;
+        uint16_t formatVersion = 0;
+        NauCheckResult(reader.readRaw(magic));
+        NauCheckResult(reader.readRaw(formatVersion));
+        if (magic != BinarySerializationHeader::Magic || formatVersion != BinarySerializationHeader::FormatVersion)
+        {
+            return NauMakeError("Unsupported binary serialization format");
+        }
+
+        return binaryRead(reader, value);
+    }
+
+    template <typename T>
+    Result<T> binaryDeserialize(eastl::span<const std::byte> data)
+    {
+        T value{};
+        NauCheckResult(binaryDeserialize(data, value));
+        return value;
+    }
+
+}  // namespace nau::serialization
@@ -0,0 +1,68 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#pragma once
+#include <concepts>
+#include <type_traits>
+
+#include "nau/kernel/kernel_config.h"
+#include "nau/serialization/native_runtime_value/native_boolean_value.h"
+#include "nau/serialization/native_runtime_value/native_float_value.h"
+#include "nau/serialization/native_runtime_value/native_integer_value.h"
+
+namespace nau::ser_detail
+{
+    /**
+        The range of the small integers that are shared by makeConstValue() instead of being allocated.
+     */
+    inline constexpr int MinSharedConstInt = -128;
+    inline constexpr int MaxSharedConstInt = 1023;
+
+    NAU_KERNEL_EXPORT const RuntimeIntegerValue::Ptr& getSharedConstInt(int value);
+
+    NAU_KERNEL_EXPORT const RuntimeIntegerValue::Ptr& getSharedConstUInt(unsigned value);
+
+    NAU_KERNEL_EXPORT const RuntimeBooleanValue::Ptr& getSharedConstBool(bool value);
+}  // namespace nau::ser_detail
+
+namespace nau
+{
+    /**
+        @brief Makes the immutable copy of the value.
+
+        The values that are parsed in large numbers (booleans and the small int/unsigned integers) are not allocated:
+        the shared preallocated instances are returned (the allocator is not used).
+     */
+    inline RuntimeBooleanValue::Ptr makeConstValue(bool value, [[maybe_unused]] IMemAllocator::Ptr allocator = nullptr)
+    {
+        return ser_detail::getSharedConstBool(value);
+    }
+
+    template <std::integral T>
+    requires(!std::is_same_v<T, bool>)
+    RuntimeIntegerValue::Ptr makeConstValue(T value, IMemAllocator::Ptr allocator = nullptr)
+    {
+        if constexpr (std::is_same_v<T, int>)
+        {
+            if (ser_detail::MinSharedConstInt <= value && value <= ser_detail::MaxSharedConstInt)
+            {
+                return ser_detail::getSharedConstInt(value);
+            }
+        }
+        else if constexpr (std::is_same_v<T, unsigned>)
+        {
+            if (value <= static_cast<unsigned>(ser_detail::MaxSharedConstInt))
+            {
+                return ser_detail::getSharedConstUInt(value);
+            }
+        }
+
+        return rtti::createInstanceWithAllocator<ser_detail::NativeIntegerValue<const T>>(std::move(allocator), value);
+    }
+
+    template <std::floating_point T>
+    RuntimeFloatValue::Ptr makeConstValue(T value, IMemAllocator::Ptr allocator = nullptr)
+    {
+        return rtti::createInstanceWithAllocator<ser_detail::NativeFloatValue<const T>>(std::move(allocator), value);
+    }
+}  // namespace nau
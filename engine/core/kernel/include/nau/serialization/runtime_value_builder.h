@@ -11,6 +11,7 @@
 #include "nau/serialization/native_runtime_value/native_integer_value.h"
 #include "nau/serialization/native_runtime_value/native_boolean_value.h"
 #include "nau/serialization/native_runtime_value/native_float_value.h"
+#include "nau/serialization/native_runtime_value/native_const_value.h"
 #include "nau/serialization/native_runtime_value/native_string_value.h"
 #include "nau/serialization/native_runtime_value/native_optional_value.h"
 #include "nau/serialization/native_runtime_value/native_collection.h"
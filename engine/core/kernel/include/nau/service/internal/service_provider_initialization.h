@@ -42,6 +42,13 @@ namespace nau::core_detail
 
         virtual async::Task<> initServices() = 0;
 
+        /**
+            @brief pre-initializes and initializes the services added after initServices() (i.e. by the lazily loaded module).
+
+            Does nothing until initServices() is completed: the services added earlier are initialized by it.
+         */
+        virtual async::Task<> initLateServices() = 0;
+
         virtual async::Task<> shutdownServices() = 0;
     };
 }  // namespace nau::core_detail
\ No newline at end of file
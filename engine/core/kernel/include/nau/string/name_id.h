@@ -0,0 +1,97 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+// nau/string/name_id.h
+
+
+#pragma once
+
+#include <EASTL/functional.h>
+#include <EASTL/string_view.h>
+
+#include <type_traits>
+
+#include "nau/kernel/kernel_config.h"
+
+namespace nau
+{
+    /**
+        Pre-hashed name (FNV-1a of the name characters) to key the lookups by names without hashing and allocations per call.
+
+        The id is made from any string convertible to string_view (at compile time when used in the constant expression, see _nid).
+        The name itself is not stored: intern() keeps the name to get it back by the id (for diagnostics),
+        it also checks that different interned names do not have the same hash.
+     */
+    class NameId
+    {
+    public:
+        static constexpr size_t hashName(eastl::string_view name)
+        {
+            size_t hash = sizeof(size_t) == 8 ? 0xcbf29ce484222325 : 0x811c9dc5;
+            const size_t prime = sizeof(size_t) == 8 ? 0x00000100000001b3 : 0x01000193;
+
+            for (const char c : name)
+            {
+                hash ^= static_cast<size_t>(static_cast<unsigned char>(c));
+                hash *= prime;
+            }
+
+            return hash;
+        }
+
+        /**
+            Makes the id and registers the name, see getName().
+         */
+        NAU_KERNEL_EXPORT static NameId intern(eastl::string_view name);
+
+        constexpr NameId() = default;
+
+        template <typename T>
+        requires(std::is_convertible_v<const T&, eastl::string_view>)
+        constexpr NameId(const T& name) :
+            m_hash(hashName(eastl::string_view{name}))
+        {
+        }
+
+        constexpr size_t getHash() const
+        {
+            return m_hash;
+        }
+
+        constexpr explicit operator bool() const
+        {
+            return m_hash != 0;
+        }
+
+        constexpr bool operator==(const NameId&) const = default;
+
+        constexpr bool operator<(const NameId& other) const
+        {
+            return m_hash < other.m_hash;
+        }
+
+        /**
+            Gets the name registered by intern(): empty for the name that was not interned.
+         */
+        NAU_KERNEL_EXPORT eastl::string_view getName() const;
+
+    private:
+        size_t m_hash = 0;
+    };
+
+    namespace string_literals
+    {
+        consteval NameId operator"" _nid(const char* str, size_t len)
+        {
+            return NameId{eastl::string_view{str, len}};
+        }
+    }  // namespace string_literals
+}  // namespace nau
+
+template <>
+struct eastl::hash<nau::NameId>
+{
+    size_t operator()(const nau::NameId& id) const
+    {
+        return id.getHash();
+    }
+};
@@ -0,0 +1,197 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+// nau/threading/lock_contention.h
+
+
+#pragma once
+
+#include <EASTL/vector.h>
+
+#include <atomic>
+#include <chrono>
+#include <concepts>
+#include <cstring>
+
+#include "nau/kernel/kernel_config.h"
+#include "nau/threading/thread_safe_annotations.h"
+#include "nau/utils/performance_profiling.h"
+
+/**
+    The contention statistics are collected only when the engine is configured with NAU_LOCK_CONTENTION_STATS=ON:
+    the lock_/shared_lock_ macros and the critical sections are routed through the profiled guards.
+    Otherwise the report is always empty and the locking has no additional cost.
+ */
+#ifndef NAU_LOCK_CONTENTION_STATS
+    #define NAU_LOCK_CONTENTION_STATS 0
+#endif
+
+namespace nau::threading
+{
+    struct LockSiteStats
+    {
+        const char* name = nullptr;
+        const char* file = nullptr;
+        int line = 0;
+        uint64_t acquireCount = 0;
+        uint64_t contendedCount = 0;
+        uint64_t totalWaitNs = 0;
+        uint64_t maxWaitNs = 0;
+    };
+
+    /**
+        The statistics of the single place where the lock is acquired.
+        The sites are static objects (see lock_) which are registered on the first use and never released.
+     */
+    class NAU_KERNEL_EXPORT LockSite
+    {
+    public:
+        LockSite(const char* name, const char* file = nullptr, int line = 0);
+
+        LockSite(const LockSite&) = delete;
+        LockSite& operator=(const LockSite&) = delete;
+
+        void addAcquire()
+        {
+            m_acquireCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void addContendedAcquire(uint64_t waitNs);
+
+        LockSiteStats getStats() const;
+
+        void reset();
+
+        const char* getName() const
+        {
+            return m_name;
+        }
+
+    private:
+        const char* const m_name;
+        const char* const m_file;
+        const int m_line;
+
+        std::atomic<uint64_t> m_acquireCount = 0;
+        std::atomic<uint64_t> m_contendedCount = 0;
+        std::atomic<uint64_t> m_totalWaitNs = 0;
+        std::atomic<uint64_t> m_maxWaitNs = 0;
+
+        LockSite* m_next = nullptr;
+
+        friend struct LockSiteRegistry;
+    };
+
+    /**
+        Returns the site for the dynamically named lock (i.e. the critical section waiter name).
+        The name must outlive the program (the literals are expected).
+     */
+    NAU_KERNEL_EXPORT LockSite& getNamedLockSite(const char* name);
+
+    /**
+        The statistics of all the sites with at least one acquisition, sorted by the total wait time (the most contended first).
+     */
+    NAU_KERNEL_EXPORT eastl::vector<LockSiteStats> getLockContentionReport();
+
+    NAU_KERNEL_EXPORT void resetLockContentionStats();
+
+    /**
+        Writes the report (up to maxSites of the most contended sites) into the log.
+     */
+    NAU_KERNEL_EXPORT void logLockContentionReport(size_t maxSites = 32);
+
+    /**
+        Acquires the mutex through the uncontended attempt first: only the failed attempt is measured and annotated in the profiler
+        as the "LockWait" zone with the site name.
+     */
+    template <typename T>
+    void lockProfiled(T& mutex, LockSite& site)
+    {
+        site.addAcquire();
+
+        if constexpr (requires { { mutex.try_lock() } -> std::convertible_to<bool>; })
+        {
+            if (mutex.try_lock())
+            {
+                return;
+            }
+        }
+
+        NAU_CPU_SCOPED_TAG_NAME("LockWait", PerfTag::Core);
+        NAU_CPU_SCOPED_TAG_TEXT(site.getName(), strlen(site.getName()));
+
+        const auto waitStart = std::chrono::steady_clock::now();
+        mutex.lock();
+        const auto waitTime = std::chrono::steady_clock::now() - waitStart;
+        site.addContendedAcquire(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(waitTime).count()));
+    }
+
+    template <typename T>
+    void lockSharedProfiled(T& mutex, LockSite& site)
+    {
+        site.addAcquire();
+
+        if (mutex.try_lock_shared())
+        {
+            return;
+        }
+
+        NAU_CPU_SCOPED_TAG_NAME("LockWait", PerfTag::Core);
+        NAU_CPU_SCOPED_TAG_TEXT(site.getName(), strlen(site.getName()));
+
+        const auto waitStart = std::chrono::steady_clock::now();
+        mutex.lock_shared();
+        const auto waitTime = std::chrono::steady_clock::now() - waitStart;
+        site.addContendedAcquire(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(waitTime).count()));
+    }
+
+    template <typename T>
+    class THREAD_SCOPED_CAPABILITY ProfiledLockGuard
+    {
+    public:
+        ProfiledLockGuard(T& mutex, LockSite& site) THREAD_ACQUIRE(mutex) :
+            m_mutex(mutex)
+        {
+            lockProfiled(m_mutex, site);
+        }
+
+        ProfiledLockGuard(const ProfiledLockGuard&) = delete;
+        ProfiledLockGuard& operator=(const ProfiledLockGuard&) = delete;
+
+        ~ProfiledLockGuard() THREAD_RELEASE()
+        {
+            m_mutex.unlock();
+        }
+
+    private:
+        T& m_mutex;
+    };
+
+    template <typename T>
+    class ProfiledSharedLockGuard
+    {
+    public:
+        ProfiledSharedLockGuard(T& mutex, LockSite& site) :
+            m_mutex(mutex)
+        {
+            lockSharedProfiled(m_mutex, site);
+        }
+
+        ProfiledSharedLockGuard(const ProfiledSharedLockGuard&) = delete;
+        ProfiledSharedLockGuard& operator=(const ProfiledSharedLockGuard&) = delete;
+
+        ~ProfiledSharedLockGuard()
+        {
+            m_mutex.unlock_shared();
+        }
+
+    private:
+        T& m_mutex;
+    };
+
+}  // namespace nau::threading
+
+// clang-format off
+// The site is named by the mutex expression, the file and the line identify it in the report.
+#define NAU_LOCK_SITE(Mutex) \
+    ([]() -> ::nau::threading::LockSite& { static ::nau::threading::LockSite site{#Mutex, __FILE__, __LINE__}; return site; }())
+// clang-format on
@@ -8,6 +8,7 @@
 #include <mutex>
 #include <shared_mutex>
 
+#include "nau/threading/lock_contention.h"
 #include "nau/threading/thread_safe_annotations.h"
 #include "nau/utils/preprocessor.h"
 
@@ -34,10 +35,21 @@ namespace nau::threading
 }  // namespace nau::threading
 
 // clang-format off
+#if NAU_LOCK_CONTENTION_STATS
+
+#define lock_(Mutex) \
+    ::nau::threading::ProfiledLockGuard ANONYMOUS_VAR(lock_mutex_) {Mutex, NAU_LOCK_SITE(Mutex)}
+
+#define shared_lock_(Mutex) \
+    ::nau::threading::ProfiledSharedLockGuard ANONYMOUS_VAR(lock_mutex_) {Mutex, NAU_LOCK_SITE(Mutex)}
+
+#else
+
 #define lock_(Mutex) \
     ::nau::threading::LockGuard ANONYMOUS_VAR(lock_mutex_) {Mutex}
 
 #define shared_lock_(Mutex) \
     ::std::shared_lock ANONYMOUS_VAR(lock_mutex_) {Mutex}
 
-// clang-format on
\ No newline at end of file
+#endif
+// clang-format on
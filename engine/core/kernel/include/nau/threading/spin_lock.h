@@ -70,6 +70,12 @@ namespace nau::threading
             }
         }
 
+        inline bool try_lock() THREAD_TRY_ACQUIRE(true)
+        {
+            auto expectedValue = std::thread::id{};
+            return m_threadOwner.compare_exchange_strong(expectedValue, std::this_thread::get_id(), std::memory_order_seq_cst, std::memory_order_relaxed);
+        }
+
         inline void unlock() THREAD_RELEASE()
         {
             NAU_FATAL(m_threadOwner.load(std::memory_order_relaxed) == std::this_thread::get_id());
@@ -132,6 +138,21 @@ namespace nau::threading
             }
         }
 
+        inline bool try_lock() THREAD_TRY_ACQUIRE(true)
+        {
+            const std::thread::id ThisThread = std::this_thread::get_id();
+
+            auto expectedValue = std::thread::id{};
+            if (m_threadOwner.load(std::memory_order_acquire) != ThisThread &&
+                !m_threadOwner.compare_exchange_strong(expectedValue, ThisThread, std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+                return false;
+            }
+
+            ++m_lockCounter;
+            return true;
+        }
+
         inline void unlock() THREAD_RELEASE()
         {
             NAU_ASSERT(m_threadOwner == std::this_thread::get_id());
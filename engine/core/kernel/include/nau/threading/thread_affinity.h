@@ -0,0 +1,22 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+// nau/threading/thread_affinity.h
+
+
+#pragma once
+
+#include <EASTL/span.h>
+
+#include "nau/kernel/kernel_config.h"
+
+namespace nau::threading
+{
+    /**
+        Pins the calling thread to the specified logical cores (the core indices are counted from zero).
+        The indices which are out of the process affinity are ignored.
+
+        @return false if none of the cores can be used or the affinity is not supported by the platform: the thread affinity is not changed.
+     */
+    NAU_KERNEL_EXPORT bool setThisThreadAffinity(eastl::span<const uint32_t> cores);
+
+}  // namespace nau::threading
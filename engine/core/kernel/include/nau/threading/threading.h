@@ -5,7 +5,9 @@
 
 #pragma once
 
+#include "nau/threading/lock_contention.h"
 #include "nau/threading/lock_guard.h"
 #include "nau/threading/spin_lock.h"
 #include "nau/threading/set_thread_name.h"
+#include "nau/threading/thread_affinity.h"
 #include "nau/threading/thread_safe_annotations.h"
@@ -0,0 +1,54 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+// nau/threading/waitable_counter.h
+
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+
+#include "nau/kernel/kernel_config.h"
+
+namespace nau::threading
+{
+    /**
+        @brief Counter of pending works that allows to block until the counter becomes zero.
+
+        increment/decrement are lock-free while there are no waiting threads:
+        the mutex is only touched by the waiter and by the decrement that resets counter to zero while someone is waiting.
+     */
+    class NAU_KERNEL_EXPORT WaitableCounter
+    {
+    public:
+        WaitableCounter() = default;
+        WaitableCounter(const WaitableCounter&) = delete;
+        WaitableCounter& operator=(const WaitableCounter&) = delete;
+
+        void increment(size_t count = 1);
+
+        /**
+            @brief Decrements the counter and wakes all waiting threads if the counter becomes zero.
+        */
+        void decrement(size_t count = 1);
+
+        size_t getCount() const;
+
+        /**
+            @brief Blocks the current thread until the counter becomes zero.
+            @param[in] timeout timeout, the infinite wait if not specified.
+            @returns true if the counter is zero, false if the timeout expired.
+        */
+        bool waitForZero(std::optional<std::chrono::milliseconds> timeout = std::nullopt) const;
+
+    private:
+        std::atomic_size_t m_counter{0};
+        mutable std::atomic_size_t m_waitersCount{0};
+        mutable std::mutex m_mutex;
+        mutable std::condition_variable m_signal;
+    };
+
+}  // namespace nau::threading
@@ -1,31 +1,82 @@
 // Copyright 2024 N-GINN LLC. All rights reserved.
 // Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
 
+/**
+ * @file performance_profiling.h
+ * @brief Profiler instrumentation macros.
+ *
+ * Macros are backed by Tracy when the engine is configured with NAU_PROFILING_TRACY=ON,
+ * otherwise all of them are expanded to nothing and have no runtime cost.
+ */
 
 #pragma once
 
 #include <nau/utils/typed_flag.h>
-//#include "tracy/Tracy.hpp"
+
+#if NAU_PROFILING_TRACY
+    #include <tracy/Tracy.hpp>
+#endif
 
 namespace nau
 {
-	enum class PerfTag : unsigned 
-	{ 
-		Core = NauFlag(1), 
-		Physics = NauFlag(2), 
+	enum class PerfTag : unsigned
+	{
+		Core = NauFlag(1),
+		Physics = NauFlag(2),
 		Render = NauFlag(3),
-		Platform = NauFlag(4)
-	}; 
-  
+		Platform = NauFlag(4),
+		Assets = NauFlag(5)
+	};
+
 	NAU_DEFINE_TYPED_FLAG(PerfTag)
 }
 
-static const nau::PerfTagFlag NAU_PERFTAGS = nau::PerfTagFlag{nau::PerfTag::Core, nau::PerfTag::Physics, nau::PerfTag::Render, nau::PerfTag::Platform};
+static const nau::PerfTagFlag NAU_PERFTAGS = nau::PerfTagFlag{nau::PerfTag::Core, nau::PerfTag::Physics, nau::PerfTag::Render, nau::PerfTag::Platform, nau::PerfTag::Assets};
+
+#if NAU_PROFILING_TRACY
+
+    #define NAU_PROFILING_ENABLED 1
+
+    // CPU zones. Zone must not span co_await: the coroutine can be resumed on the other thread.
+    #define NAU_CPU_SCOPED ZoneScoped
+    #define NAU_CPU_SCOPED_NAME ZoneScopedN
+
+    #define NAU_CPU_SCOPED_TAG(TagName) ZoneNamed(__tracy, NAU_PERFTAGS.has(TagName));
+    #define NAU_CPU_SCOPED_TAG_NAME(Name, TagName) ZoneNamedN(__tracy, Name, NAU_PERFTAGS.has(TagName));
+
+    // Attaches dynamic text (i.e. asset path) to the zone that is opened by NAU_CPU_SCOPED_TAG*.
+    #define NAU_CPU_SCOPED_TAG_TEXT(Text, Size) __tracy.Text(Text, Size)
+
+    #define NAU_PROFILING_FRAME_END FrameMark
+    #define NAU_PROFILING_SET_THREAD_NAME(Name) ::tracy::SetThreadName(Name)
+
+    // Memory events of the named allocator.
+    #define NAU_PROFILING_ALLOC(Ptr, Size, Name) TracyAllocN(Ptr, Size, Name)
+    #define NAU_PROFILING_FREE(Ptr, Name) TracyFreeN(Ptr, Name)
+
+    // Lock annotations: NAU_PROFILING_LOCKABLE(std::mutex, m_mutex) declares the annotated member,
+    // NAU_PROFILING_LOCKABLE_BASE(std::mutex) is the type for lock_guard/unique_lock over it.
+    #define NAU_PROFILING_LOCKABLE(Type, Var) TracyLockable(Type, Var)
+    #define NAU_PROFILING_LOCKABLE_BASE(Type) LockableBase(Type)
+
+#else
+
+    #define NAU_PROFILING_ENABLED 0
+
+    #define NAU_CPU_SCOPED
+    #define NAU_CPU_SCOPED_NAME(Name)
+
+    #define NAU_CPU_SCOPED_TAG(TagName)
+    #define NAU_CPU_SCOPED_TAG_NAME(Name, TagName)
+    #define NAU_CPU_SCOPED_TAG_TEXT(Text, Size)
+
+    #define NAU_PROFILING_FRAME_END
+    #define NAU_PROFILING_SET_THREAD_NAME(Name)
 
-#define NAU_CPU_SCOPED ZoneScoped
-#define NAU_CPU_SCOPED_NAME ZoneScopedN
+    #define NAU_PROFILING_ALLOC(Ptr, Size, Name)
+    #define NAU_PROFILING_FREE(Ptr, Name)
 
-#define NAU_CPU_SCOPED_TAG(TagName) ZoneNamed(__tracy, NAU_PERFTAGS.has(TagName));
-#define NAU_CPU_SCOPED_TAG_NAME(Name, TagName) ZoneNamedN(__tracy, Name, NAU_PERFTAGS.has(TagName));
+    #define NAU_PROFILING_LOCKABLE(Type, Var) Type Var
+    #define NAU_PROFILING_LOCKABLE_BASE(Type) Type
 
-#define NAU_PROFILING_FRAME_END FrameMark
+#endif
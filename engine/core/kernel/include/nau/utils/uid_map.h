@@ -0,0 +1,27 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <ska_hash_map/flat_hash_map2.hpp>
+
+#include "nau/utils/uid.h"
+
+namespace nau
+{
+    /**
+        The flat (open addressing) Uid keyed map: the entries are stored in the single array, the lookup is one probe sequence
+        without the node indirection.
+        The references and the iterators to the entries are invalidated on the insertion (rehash) and on the erase,
+        the values are expected to be the pointers or the small handles.
+     */
+    template <typename T>
+    using UidMap = ska::flat_hash_map<Uid, T, eastl::hash<Uid>>;
+
+    /**
+        The flat (open addressing) Uid set. See UidMap.
+     */
+    using UidSet = ska::flat_hash_set<Uid, eastl::hash<Uid>>;
+
+}  // namespace nau
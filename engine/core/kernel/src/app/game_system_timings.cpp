@@ -0,0 +1,89 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "nau/app/main_loop/game_system_timings.h"
+
+#include <EASTL/algorithm.h>
+#include <EASTL/array.h>
+
+#include <mutex>
+
+#include "nau/threading/lock_guard.h"
+
+namespace nau
+{
+    namespace
+    {
+        struct GameSystemTimingsEntry
+        {
+            eastl::string name;
+            uint64_t updatesCount = 0;
+            eastl::array<std::chrono::microseconds, GameSystemTimings::SamplesCount> samples{};
+        };
+
+        struct GameSystemTimingsRegistry
+        {
+            std::mutex mutex;
+            eastl::vector<GameSystemTimingsEntry> entries;
+        };
+
+        GameSystemTimingsRegistry& getRegistry()
+        {
+            static GameSystemTimingsRegistry registry;
+            return registry;
+        }
+    }  // namespace
+
+    void reportGameSystemTime(eastl::string_view name, std::chrono::microseconds time)
+    {
+        GameSystemTimingsRegistry& registry = getRegistry();
+        lock_(registry.mutex);
+
+        // There are only a few game systems: the linear lookup is cheaper than hashing of the name
+        auto entry = eastl::find_if(registry.entries.begin(), registry.entries.end(), [name](const GameSystemTimingsEntry& e)
+        {
+            return name == e.name;
+        });
+
+        if (entry == registry.entries.end())
+        {
+            entry = &registry.entries.emplace_back();
+            entry->name = eastl::string{name};
+        }
+
+        entry->samples[entry->updatesCount % GameSystemTimings::SamplesCount] = time;
+        ++entry->updatesCount;
+    }
+
+    eastl::vector<GameSystemTimings> getGameSystemTimings()
+    {
+        using namespace std::chrono;
+
+        GameSystemTimingsRegistry& registry = getRegistry();
+        lock_(registry.mutex);
+
+        eastl::vector<GameSystemTimings> timings;
+        timings.reserve(registry.entries.size());
+
+        for (const GameSystemTimingsEntry& entry : registry.entries)
+        {
+            GameSystemTimings& systemTimings = timings.emplace_back();
+            systemTimings.name = entry.name;
+            systemTimings.updatesCount = entry.updatesCount;
+            systemTimings.last = entry.samples[(entry.updatesCount - 1) % GameSystemTimings::SamplesCount];
+
+            const size_t samplesCount = eastl::min<size_t>(entry.updatesCount, GameSystemTimings::SamplesCount);
+            microseconds total{0};
+            for (size_t i = 0; i < samplesCount; ++i)
+            {
+                total += entry.samples[i];
+                systemTimings.max = eastl::max(systemTimings.max, entry.samples[i]);
+            }
+
+            systemTimings.average = total / static_cast<int64_t>(samplesCount);
+        }
+
+        return timings;
+    }
+}  // namespace nau
@@ -6,9 +6,18 @@
 
 #include <iostream>
 
+#include "nau/async/core/task_frame_allocator.h"
 #include "nau/memory/general_allocator.h"
 #include "nau/utils/scope_guard.h"
 
+/**
+    Keeps registry of all alive tasks (for the diagnostics: dumpAliveTasks).
+    Registry requires global lock for every task construction/destruction, so it is disabled for the non debug builds by default.
+*/
+#if !defined(NAU_ASYNC_TRACK_ALIVE_TASKS)
+    #define NAU_ASYNC_TRACK_ALIVE_TASKS NAU_DEBUG
+#endif
+
 namespace nau::async
 {
     namespace
@@ -108,7 +117,7 @@ namespace nau::async
 
         using TaskRejector = TaskRejectorNoException;
 
-        // TODO: need to make tracking for TaskCreationInfo optional (and possible exclude from production builds)
+#if NAU_ASYNC_TRACK_ALIVE_TASKS
         struct TaskCreationInfo
         {
             // NAU-2338
@@ -117,19 +126,26 @@ namespace nau::async
 
         std::mutex g_aliveTasksMutex;
         std::unordered_map<CoreTaskImpl*, TaskCreationInfo> g_aliveTasks;
+#endif
+
+        // Count of the tasks which continuation is holding captured executor (not depends on NAU_ASYNC_TRACK_ALIVE_TASKS).
+        std::atomic<size_t> g_tasksWithCapturedExecutorCount{0};
 
     }  // namespace
 
     CoreTask::~CoreTask() = default;
 
-    CoreTaskImpl::CoreTaskImpl(IMemAllocator::Ptr allocator, void* allocatedStorage, size_t dataSize, StateDestructorCallback destructor) :
+    CoreTaskImpl::CoreTaskImpl(IMemAllocator::Ptr allocator, void* allocatedStorage, size_t storageSize, size_t dataSize, StateDestructorCallback destructor) :
         m_allocator(std::move(allocator)),
         m_allocatedStorage(allocatedStorage),
+        m_storageSize(storageSize),
         m_dataSize(dataSize),
         m_destructor(destructor)
     {
+#if NAU_ASYNC_TRACK_ALIVE_TASKS
         lock_(g_aliveTasksMutex);
         g_aliveTasks.emplace(this, TaskCreationInfo{});
+#endif
     }
 
     CoreTaskImpl::~CoreTaskImpl()
@@ -139,8 +155,12 @@ namespace nau::async
             m_destructor(getData());
         }
 
+        releaseCapturedExecutorCounter();
+
+#if NAU_ASYNC_TRACK_ALIVE_TASKS
         lock_(g_aliveTasksMutex);
         g_aliveTasks.erase(this);
+#endif
     }
 
     void CoreTaskImpl::addRef()
@@ -156,11 +176,19 @@ namespace nau::async
         }
 
         auto allocator = std::move(m_allocator);
-        NAU_ASSERT(allocator);
 
         void* const storage = m_allocatedStorage;
+        const size_t storageSize = m_storageSize;
         std::destroy_at(this);
-        allocator->deallocate(storage);
+
+        if (allocator)
+        {
+            allocator->deallocate(storage);
+        }
+        else
+        {
+            async_detail::freeTaskFrame(storage, storageSize);
+        }
     }
 
     bool CoreTaskImpl::isReady() const
@@ -188,6 +216,7 @@ namespace nau::async
             setFlagsOnce(m_flags, TaskFlag_Ready);
         }
 
+        addTraceEvent(async_detail::TaskTraceEventType::TaskReady);
         invokeReadyCallback();
         tryScheduleContinuation();
 
@@ -229,6 +258,13 @@ namespace nau::async
             m_continuation.executor = nullptr;
         }
 
+        if (m_continuation.executor)
+        {
+            m_isCapturedExecutorCounted = true;
+            g_tasksWithCapturedExecutorCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        addTraceEvent(async_detail::TaskTraceEventType::TaskAwait);
         setFlagsOnce(m_flags, TaskFlag_HasContinuation);
         tryScheduleContinuation();
     }
@@ -315,10 +351,18 @@ namespace nau::async
         TaskContinuation continuation = std::move(m_continuation);
         NAU_ASSERT(continuation);
         NAU_ASSERT(!m_continuation);
+        releaseCapturedExecutorCounter();
 
         Executor::Ptr executor = continuation.executor ? std::move(continuation.executor) : Executor::getCurrent();
         if (executor && m_isContinueOnCapturedExecutor.load(std::memory_order_acquire))
         {
+#if NAU_ASYNC_TASK_TRACE
+            if (async_detail::isTaskTraceActive())
+            {
+                // The continuation run is linked with the task
+                continuation.invocation.setTraceId(getTraceId());
+            }
+#endif
             // !!! BE AWARE !!!
             // In any moment right after continuation is scheduled 'this' Task Core instance can be destructed.
             // Continuation will resume awaiter that holds reference to this task instance and this reference can be released.
@@ -331,6 +375,38 @@ namespace nau::async
         }
     }
 
+    void CoreTaskImpl::releaseCapturedExecutorCounter()
+    {
+        if (m_isCapturedExecutorCounted)
+        {
+            m_isCapturedExecutorCounted = false;
+            [[maybe_unused]] const size_t prevCount = g_tasksWithCapturedExecutorCount.fetch_sub(1, std::memory_order_relaxed);
+            NAU_ASSERT(prevCount > 0);
+        }
+    }
+
+    uint64_t CoreTaskImpl::getTraceId()
+    {
+        uint64_t traceId = m_traceId.load(std::memory_order_relaxed);
+        if (traceId == 0)
+        {
+            const uint64_t newTraceId = async_detail::newTaskTraceId();
+            traceId = m_traceId.compare_exchange_strong(traceId, newTraceId, std::memory_order_relaxed) ? newTraceId : traceId;
+        }
+
+        return traceId;
+    }
+
+    void CoreTaskImpl::addTraceEvent([[maybe_unused]] async_detail::TaskTraceEventType type)
+    {
+#if NAU_ASYNC_TASK_TRACE
+        if (async_detail::isTaskTraceActive())
+        {
+            async_detail::addTaskTraceEvent(type, getTraceId());
+        }
+#endif
+    }
+
     CoreTaskImpl* CoreTaskImpl::getNext() const
     {
         return m_next;
@@ -413,10 +489,8 @@ namespace nau::async
         m_coreTask = nullptr;
     }
 
-    CoreTaskPtr CoreTask::create(IMemAllocator::Ptr customAllocator, size_t dataSize, size_t dataAlignment, StateDestructorCallback destructor)
+    CoreTaskPtr CoreTask::create(IMemAllocator::Ptr allocator, size_t dataSize, size_t dataAlignment, StateDestructorCallback destructor)
     {
-        IMemAllocator::Ptr allocator = customAllocator ? std::move(customAllocator) : getDefaultAllocator();
-        NAU_ASSERT(allocator);
         NAU_ASSERT(isPowerOf2(dataAlignment));
         NAU_ASSERT(dataAlignment < DefaultAlign || (dataAlignment % DefaultAlign) == 0);
 
@@ -424,7 +498,8 @@ namespace nau::async
         const size_t storageSize = getCoreTaskStorageSize(dataSize, dataAlignment);
 
         // the allocated storage may be different from where the CoreTaskImpl will actually be created.
-        void* const allocatedStorage = allocator->allocate(storageSize);
+        // Without custom allocator the storage is taken from the per-thread task frames pool.
+        void* const allocatedStorage = allocator ? allocator->allocate(storageSize) : async_detail::allocateTaskFrame(storageSize);
         NAU_ASSERT(allocatedStorage);
 
         // By default the placement storage is the same as the allocated one, but it can be changed if it requires by type alignment
@@ -442,12 +517,14 @@ namespace nau::async
         NAU_FATAL(reinterpret_cast<uintptr_t>(placementStorage) % alignof(CoreTaskImpl) == 0);
         NAU_FATAL(reinterpret_cast<uintptr_t>(reinterpret_cast<std::byte*>(placementStorage) + CoreTaskSize) % dataAlignment == 0);
 
-        auto const coreTask = new(placementStorage) CoreTaskImpl{std::move(allocator), allocatedStorage, dataSize, destructor};
+        auto const coreTask = new(placementStorage) CoreTaskImpl{std::move(allocator), allocatedStorage, storageSize, dataSize, destructor};
+        coreTask->addTraceEvent(async_detail::TaskTraceEventType::TaskCreate);
         return CoreTaskOwnership{coreTask};
     }
 
     NAU_KERNEL_EXPORT void dumpAliveTasks()
     {
+#if NAU_ASYNC_TRACK_ALIVE_TASKS
         lock_(g_aliveTasksMutex);
 
         const size_t aliveTasksWithCapturedExecutorCount = std::count_if(g_aliveTasks.begin(), g_aliveTasks.end(), [](const auto& pair)
@@ -473,16 +550,21 @@ namespace nau::async
             // NAU-2338
             // dump task's creation stack trace.
         }
+#else
+        const size_t aliveTasksWithCapturedExecutorCount = g_tasksWithCapturedExecutorCount.load(std::memory_order_relaxed);
+        if (aliveTasksWithCapturedExecutorCount == 0)
+        {
+            std::cout << "There is no alive tasks with captured executor\n";
+            return;
+        }
+
+        std::cout << std::format("Has ({}) alive tasks with captured executor (build with NAU_ASYNC_TRACK_ALIVE_TASKS for details)\n", aliveTasksWithCapturedExecutorCount);
+#endif
     }
 
     NAU_KERNEL_EXPORT bool hasAliveTasksWithCapturedExecutor()
     {
-        lock_(g_aliveTasksMutex);
-
-        return std::any_of(g_aliveTasks.begin(), g_aliveTasks.end(), [](const auto& pair)
-        {
-            return pair.first->hasCapturedExecutor();
-        });
+        return g_tasksWithCapturedExecutorCount.load(std::memory_order_relaxed) > 0;
     }
 
 }  // namespace nau::async
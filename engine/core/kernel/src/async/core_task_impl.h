@@ -8,6 +8,7 @@
 
 #include "nau/async/core/core_task.h"
 #include "nau/memory/mem_allocator.h"
+#include "task_trace_internal.h"
 
 namespace nau::async
 {
@@ -17,7 +18,7 @@ namespace nau::async
     class CoreTaskImpl final : public CoreTask
     {
     public:
-        CoreTaskImpl(IMemAllocator::Ptr, void* allocatedStorage, size_t size, StateDestructorCallback destructor);
+        CoreTaskImpl(IMemAllocator::Ptr, void* allocatedStorage, size_t storageSize, size_t dataSize, StateDestructorCallback destructor);
 
         ~CoreTaskImpl();
 
@@ -46,17 +47,21 @@ namespace nau::async
         std::string getName() const;
         void setName(std::string name);
 
-
+        void addTraceEvent(async_detail::TaskTraceEventType type);
 
     private:
         void invokeReadyCallback();
+        uint64_t getTraceId();
         void tryScheduleContinuation();
+        void releaseCapturedExecutorCounter();
 
+        // Null if the storage is allocated from the task frames pool (async_detail::allocateTaskFrame).
         IMemAllocator::Ptr m_allocator;
 
         // In some cases m_allocatedStorage can differ from (void*)this, because of custom types alignment.
         // For simplification aligned storage allocation, just keeps m_allocatedStorage (which may initially have incorrect alignment).
         void* const m_allocatedStorage;
+        const size_t m_storageSize;
         const size_t m_dataSize;
         const StateDestructorCallback m_destructor;
         std::atomic<uint32_t> m_refsCount{1};
@@ -65,8 +70,11 @@ namespace nau::async
         TaskContinuation m_continuation;
         Executor::Invocation m_readyCallback;
         std::atomic<bool> m_isContinueOnCapturedExecutor = true;
+        bool m_isCapturedExecutorCounted = false;
         CoreTaskImpl* m_next = nullptr;
         std::string m_name = "";
+        // Assigned on the first trace event of the task (see nau/async/task_trace.h)
+        std::atomic<uint64_t> m_traceId = 0;
     };
 
 }  // namespace nau::async
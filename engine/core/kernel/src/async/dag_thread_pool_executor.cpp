@@ -60,16 +60,24 @@ namespace nau::async
             threadpool::add(this);
         }
 
-        void waitAnyActivity() noexcept override
+        bool waitAnyActivity(std::optional<std::chrono::milliseconds> timeout) noexcept override
         {
+            using namespace std::chrono;
             using namespace std::chrono_literals;
 
             constexpr auto SleepTimeout = 2ms;
 
+            const auto startTime = steady_clock::now();
             while(m_taskCounter.load() > 0)
             {
+                if(timeout && steady_clock::now() - startTime >= *timeout)
+                {
+                    return false;
+                }
                 std::this_thread::sleep_for(SleepTimeout);
             }
+
+            return true;
         }
 
         void doJob() override
@@ -5,6 +5,7 @@
 #include "nau/async/executor.h"
 
 #include "nau/utils/scope_guard.h"
+#include "task_trace_internal.h"
 
 namespace nau::async
 {
@@ -49,7 +50,8 @@ namespace nau::async
     Executor::Invocation::Invocation(Invocation&& other) :
         m_callback(other.m_callback),
         m_callbackData1(other.m_callbackData1),
-        m_callbackData2(other.m_callbackData2)
+        m_callbackData2(other.m_callbackData2),
+        m_traceId(other.m_traceId)
     {
         other.reset();
     }
@@ -59,6 +61,7 @@ namespace nau::async
         m_callback = other.m_callback;
         m_callbackData1 = other.m_callbackData1;
         m_callbackData2 = other.m_callbackData2;
+        m_traceId = other.m_traceId;
 
         other.reset();
         return *this;
@@ -90,6 +93,7 @@ namespace nau::async
         m_callback = nullptr;
         m_callbackData1 = nullptr;
         m_callbackData2 = nullptr;
+        m_traceId = 0;
     }
 
     Executor::Invocation Executor::Invocation::fromCoroutine(CoroNs::coroutine_handle<> coroutine)
@@ -184,18 +188,29 @@ namespace nau::async
 
     void Executor::execute(Invocation invocation) noexcept
     {
+#if NAU_ASYNC_TASK_TRACE
+        if (async_detail::isTaskTraceActive())
+        {
+            if (invocation.getTraceId() == 0)
+            {
+                invocation.setTraceId(async_detail::newTaskTraceId());
+            }
+
+            async_detail::addTaskTraceEvent(async_detail::TaskTraceEventType::Schedule, invocation.getTraceId(), this);
+        }
+#endif
         scheduleInvocation(std::move(invocation));
     }
 
     void Executor::execute(std::coroutine_handle<> coroutine) noexcept
     {
         NAU_ASSERT(coroutine);
-        scheduleInvocation(Invocation::fromCoroutine(std::move(coroutine)));
+        execute(Invocation::fromCoroutine(std::move(coroutine)));
     }
 
     void Executor::execute(Callback callback, void* data1, void* data2) noexcept
     {
-        scheduleInvocation(Invocation{callback, data1, data2});
+        execute(Invocation{callback, data1, data2});
     }
 
     void Executor::invoke([[maybe_unused]] Executor& executor, Invocation invocation) noexcept
@@ -204,6 +219,15 @@ namespace nau::async
         NAU_ASSERT(getThisThreadInvokedExecutor() == &executor, "Invalid executor.");
         NAU_ASSERT(invocation);
 
+#if NAU_ASYNC_TASK_TRACE
+        if (async_detail::isTaskTraceActive())
+        {
+            async_detail::addTaskTraceEvent(async_detail::TaskTraceEventType::InvokeBegin, invocation.getTraceId(), &executor);
+            invocation();
+            async_detail::addTaskTraceEvent(async_detail::TaskTraceEventType::InvokeEnd, 0, &executor);
+            return;
+        }
+#endif
         invocation();
     }
 
@@ -214,6 +238,15 @@ namespace nau::async
 
         for(auto& invocation : invocations)
         {
+#if NAU_ASYNC_TASK_TRACE
+            if (async_detail::isTaskTraceActive())
+            {
+                async_detail::addTaskTraceEvent(async_detail::TaskTraceEventType::InvokeBegin, invocation.getTraceId(), &executor);
+                invocation();
+                async_detail::addTaskTraceEvent(async_detail::TaskTraceEventType::InvokeEnd, 0, &executor);
+                continue;
+            }
+#endif
             invocation();
         }
     }
@@ -0,0 +1,263 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "nau/async/job_graph.h"
+
+#include <EASTL/unique_ptr.h>
+
+#include "nau/async/core/task_frame_allocator.h"
+#include "nau/threading/event.h"
+
+namespace nau::async
+{
+    /**
+        Execution state of the single run().
+        Helper invocations can be started after run() has returned (when all jobs are already executed by others),
+        so the state is reference counted and helpers access the graph only while there is a job taken from the ready list.
+     */
+    struct JobGraphRunState
+    {
+        JobGraph& graph;
+        Executor::Ptr executor;
+        eastl::unique_ptr<std::atomic_uint32_t[]> pendingDependencies;
+        std::atomic_size_t remainingJobs;
+        std::atomic_uint32_t refsCount{1};
+
+        std::mutex mutex;
+        eastl::vector<JobGraph::JobId> readyJobs;
+        // Ready jobs that can be executed only by the calling thread (helpers never take them)
+        eastl::vector<JobGraph::JobId> callingThreadJobs;
+        threading::Event signal{threading::Event::ResetMode::Auto};
+
+        JobGraphRunState(JobGraph& inGraph, Executor::Ptr inExecutor) :
+            graph(inGraph),
+            executor(std::move(inExecutor)),
+            pendingDependencies(new std::atomic_uint32_t[inGraph.m_jobs.size()]),
+            remainingJobs(inGraph.m_jobs.size())
+        {
+            readyJobs.reserve(inGraph.m_jobs.size());
+            for (size_t i = 0, size = graph.m_jobs.size(); i < size; ++i)
+            {
+                pendingDependencies[i].store(graph.m_jobs[i].dependenciesCount, std::memory_order_relaxed);
+            }
+        }
+
+        static JobGraphRunState* create(JobGraph& graph, Executor::Ptr executor)
+        {
+            void* const storage = async_detail::allocateTaskFrame(sizeof(JobGraphRunState));
+            return new(storage) JobGraphRunState(graph, std::move(executor));
+        }
+
+        void release()
+        {
+            if (refsCount.fetch_sub(1) == 1)
+            {
+                std::destroy_at(this);
+                async_detail::freeTaskFrame(this, sizeof(JobGraphRunState));
+            }
+        }
+
+        bool popReadyJob(JobGraph::JobId& jobId, bool isCallingThread = false)
+        {
+            const std::lock_guard lock{mutex};
+            if (isCallingThread && !callingThreadJobs.empty())
+            {
+                jobId = callingThreadJobs.back();
+                callingThreadJobs.pop_back();
+                return true;
+            }
+
+            if (readyJobs.empty())
+            {
+                return false;
+            }
+
+            jobId = readyJobs.back();
+            readyJobs.pop_back();
+            return true;
+        }
+
+        void pushReadyJob(JobGraph::JobId jobId)
+        {
+            if (graph.m_jobs[jobId].callingThreadOnly)
+            {
+                {
+                    const std::lock_guard lock{mutex};
+                    callingThreadJobs.push_back(jobId);
+                }
+
+                signal.set();
+                return;
+            }
+
+            {
+                const std::lock_guard lock{mutex};
+                readyJobs.push_back(jobId);
+            }
+
+            if (executor)
+            {
+                refsCount.fetch_add(1);
+                executor->execute([](void* statePtr, void*) noexcept
+                {
+                    auto* const state = reinterpret_cast<JobGraphRunState*>(statePtr);
+                    state->executeReadyJobs();
+                    state->release();
+                }, this);
+            }
+
+            // wake the calling thread: it can help with the ready job.
+            signal.set();
+        }
+
+        void executeJob(JobGraph::JobId jobId)
+        {
+            JobGraph::Job& job = graph.m_jobs[jobId];
+            job.callable();
+
+            for (const JobGraph::JobId successor : job.successors)
+            {
+                if (pendingDependencies[successor].fetch_sub(1) == 1)
+                {
+                    pushReadyJob(successor);
+                }
+            }
+
+            // The graph must not be accessed after the last job is completed: run() can return at any moment.
+            if (remainingJobs.fetch_sub(1) == 1)
+            {
+                signal.set();
+            }
+        }
+
+        void executeReadyJobs()
+        {
+            for (JobGraph::JobId jobId; popReadyJob(jobId);)
+            {
+                executeJob(jobId);
+            }
+        }
+    };
+
+    JobGraph::JobId JobGraph::addJob(Functor<void()> job, bool callingThreadOnly)
+    {
+        NAU_ASSERT(job);
+
+        const auto jobId = static_cast<JobId>(m_jobs.size());
+        Job& newJob = m_jobs.emplace_back();
+        newJob.callable = std::move(job);
+        newJob.callingThreadOnly = callingThreadOnly;
+        m_isValidated = false;
+        return jobId;
+    }
+
+    void JobGraph::addDependency(JobId job, JobId dependsOn)
+    {
+        NAU_ASSERT(job < m_jobs.size() && dependsOn < m_jobs.size());
+        NAU_ASSERT(job != dependsOn);
+
+        m_jobs[dependsOn].successors.push_back(job);
+        ++m_jobs[job].dependenciesCount;
+        m_isValidated = false;
+    }
+
+    size_t JobGraph::getJobsCount() const
+    {
+        return m_jobs.size();
+    }
+
+    bool JobGraph::hasCycles() const
+    {
+        // Kahn's algorithm: every job of an acyclic graph is eventually taken with no pending dependencies.
+        eastl::vector<uint32_t> pendingDependencies;
+        eastl::vector<JobId> readyJobs;
+        pendingDependencies.reserve(m_jobs.size());
+        readyJobs.reserve(m_jobs.size());
+
+        for (JobId jobId = 0, size = static_cast<JobId>(m_jobs.size()); jobId < size; ++jobId)
+        {
+            pendingDependencies.push_back(m_jobs[jobId].dependenciesCount);
+            if (m_jobs[jobId].dependenciesCount == 0)
+            {
+                readyJobs.push_back(jobId);
+            }
+        }
+
+        size_t visitedCount = 0;
+        while (!readyJobs.empty())
+        {
+            const JobId jobId = readyJobs.back();
+            readyJobs.pop_back();
+            ++visitedCount;
+
+            for (const JobId successor : m_jobs[jobId].successors)
+            {
+                if (--pendingDependencies[successor] == 0)
+                {
+                    readyJobs.push_back(successor);
+                }
+            }
+        }
+
+        return visitedCount != m_jobs.size();
+    }
+
+    void JobGraph::clear()
+    {
+        m_jobs.clear();
+        m_isValidated = false;
+    }
+
+    void JobGraph::run(Executor::Ptr executor)
+    {
+        if (m_jobs.empty())
+        {
+            return;
+        }
+
+        // A cycle that is reachable only from the root jobs would stall the calling thread forever.
+        if (!m_isValidated)
+        {
+            NAU_FATAL(!hasCycles(), "Job graph has cyclic dependencies");
+            m_isValidated = true;
+        }
+
+        if (!executor)
+        {
+            executor = Executor::getDefault();
+        }
+
+        if (executor && executor->getConcurrency() <= 1)
+        {
+            executor.reset();
+        }
+
+        JobGraphRunState* const state = JobGraphRunState::create(*this, std::move(executor));
+        scope_on_leave
+        {
+            state->release();
+        };
+
+        for (JobId jobId = 0, size = static_cast<JobId>(m_jobs.size()); jobId < size; ++jobId)
+        {
+            if (m_jobs[jobId].dependenciesCount == 0)
+            {
+                state->pushReadyJob(jobId);
+            }
+        }
+
+        while (state->remainingJobs.load() > 0)
+        {
+            if (JobId jobId; state->popReadyJob(jobId, true))
+            {
+                state->executeJob(jobId);
+            }
+            else if (state->remainingJobs.load() > 0)
+            {
+                state->signal.wait();
+            }
+        }
+    }
+
+}  // namespace nau::async
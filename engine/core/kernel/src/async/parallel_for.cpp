@@ -0,0 +1,133 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "nau/async/parallel_for.h"
+
+#include "nau/async/core/task_frame_allocator.h"
+#include "nau/threading/waitable_counter.h"
+
+namespace nau::async_detail
+{
+    namespace
+    {
+        // Number of chunks per executor thread when grain size is selected automatically:
+        // more chunks than threads gives a better load balancing for non uniform work.
+        constexpr size_t AutoChunksPerThread = 4;
+
+        /**
+            State is shared between the caller and the helper invocations.
+            Helper can be started by executor after the caller has already returned (all chunks are processed by others),
+            so state is reference counted and helpers never touch the caller's data after the chunks are exhausted.
+         */
+        struct ParallelForState
+        {
+            const ParallelForCallback callback;
+            void* const data;
+            const size_t count;
+            const size_t grainSize;
+            const size_t chunksCount;
+
+            std::atomic_size_t nextChunk{0};
+            std::atomic_uint32_t refsCount{1};
+            threading::WaitableCounter remainingChunks;
+
+            ParallelForState(ParallelForCallback inCallback, void* inData, size_t inCount, size_t inGrainSize, size_t inChunksCount) :
+                callback(inCallback),
+                data(inData),
+                count(inCount),
+                grainSize(inGrainSize),
+                chunksCount(inChunksCount)
+            {
+                remainingChunks.increment(chunksCount);
+            }
+
+            static ParallelForState* create(ParallelForCallback callback, void* data, size_t count, size_t grainSize, size_t chunksCount)
+            {
+                void* const storage = allocateTaskFrame(sizeof(ParallelForState));
+                return new(storage) ParallelForState(callback, data, count, grainSize, chunksCount);
+            }
+
+            void addRef(uint32_t refs)
+            {
+                refsCount.fetch_add(refs);
+            }
+
+            void release()
+            {
+                if (refsCount.fetch_sub(1) == 1)
+                {
+                    std::destroy_at(this);
+                    freeTaskFrame(this, sizeof(ParallelForState));
+                }
+            }
+
+            void processChunks()
+            {
+                for (size_t chunk = nextChunk.fetch_add(1); chunk < chunksCount; chunk = nextChunk.fetch_add(1))
+                {
+                    const size_t begin = chunk * grainSize;
+                    const size_t end = std::min(begin + grainSize, count);
+
+                    callback(data, begin, end);
+                    remainingChunks.decrement();
+                }
+            }
+        };
+    }  // namespace
+
+    void parallelForInternal(size_t count, size_t grainSize, ParallelForCallback callback, void* data, async::Executor::Ptr executor)
+    {
+        NAU_ASSERT(callback);
+
+        if (count == 0)
+        {
+            return;
+        }
+
+        if (!executor)
+        {
+            executor = async::Executor::getDefault();
+        }
+
+        const size_t concurrency = executor ? executor->getConcurrency() : 1;
+
+        if (grainSize == 0)
+        {
+            const size_t targetChunks = concurrency * AutoChunksPerThread;
+            grainSize = std::max((count + targetChunks - 1) / targetChunks, size_t{1});
+        }
+
+        const size_t chunksCount = (count + grainSize - 1) / grainSize;
+
+        // Nothing to share: process all items inline without any allocation and scheduling.
+        if (chunksCount == 1 || concurrency <= 1)
+        {
+            callback(data, 0, count);
+            return;
+        }
+
+        ParallelForState* const state = ParallelForState::create(callback, data, count, grainSize, chunksCount);
+
+        // The calling thread is also processing chunks, so at most chunksCount - 1 helpers are useful.
+        const size_t helpersCount = std::min(chunksCount - 1, concurrency);
+        state->addRef(static_cast<uint32_t>(helpersCount));
+
+        for (size_t i = 0; i < helpersCount; ++i)
+        {
+            executor->execute([](void* statePtr, void*) noexcept
+            {
+                auto* const state = reinterpret_cast<ParallelForState*>(statePtr);
+                state->processChunks();
+                state->release();
+            }, state);
+        }
+
+        state->processChunks();
+
+        // All chunks are claimed, but some of them can still be processed by helpers.
+        state->remainingChunks.waitForZero();
+        state->release();
+    }
+
+}  // namespace nau::async_detail
@@ -0,0 +1,132 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "nau/async/core/task_frame_allocator.h"
+
+#include <bit>
+#include <new>
+
+#include "nau/diag/assertion.h"
+
+namespace nau::async_detail
+{
+    namespace
+    {
+        constexpr size_t MinBlockSizeLog2 = 6;   // 64 bytes
+        constexpr size_t MaxBlockSizeLog2 = 12;  // 4096 bytes
+        constexpr size_t MaxBlockSize = size_t{1} << MaxBlockSizeLog2;
+        constexpr size_t SizeClassesCount = MaxBlockSizeLog2 - MinBlockSizeLog2 + 1;
+
+        // Limits the memory that is kept by the each thread for the each size class.
+        constexpr size_t MaxCachedBytesPerClass = 64 * 1024;
+        constexpr size_t MinCachedBlocksPerClass = 16;
+
+        inline size_t getSizeClass(size_t size)
+        {
+            const size_t sizeLog2 = static_cast<size_t>(std::bit_width(std::max(size, size_t{1} << MinBlockSizeLog2) - 1));
+            return sizeLog2 - MinBlockSizeLog2;
+        }
+
+        inline constexpr size_t getClassBlockSize(size_t sizeClass)
+        {
+            return size_t{1} << (sizeClass + MinBlockSizeLog2);
+        }
+
+        inline constexpr size_t getClassMaxCachedBlocks(size_t sizeClass)
+        {
+            return std::max(MaxCachedBytesPerClass / getClassBlockSize(sizeClass), MinCachedBlocksPerClass);
+        }
+
+        /**
+            Blocks are allocated individually (so they are not bound to the thread that allocates it),
+            the cache only keeps released blocks for the reuse.
+         */
+        struct ThreadFrameCache
+        {
+            struct FreeBlock
+            {
+                FreeBlock* next;
+            };
+
+            FreeBlock* freeLists[SizeClassesCount] = {};
+            size_t freeCounts[SizeClassesCount] = {};
+
+            ~ThreadFrameCache();
+
+            void* allocate(size_t sizeClass)
+            {
+                if (FreeBlock* const block = freeLists[sizeClass])
+                {
+                    freeLists[sizeClass] = block->next;
+                    --freeCounts[sizeClass];
+                    return block;
+                }
+
+                return ::operator new(getClassBlockSize(sizeClass));
+            }
+
+            void free(void* ptr, size_t sizeClass)
+            {
+                if (freeCounts[sizeClass] >= getClassMaxCachedBlocks(sizeClass))
+                {
+                    ::operator delete(ptr);
+                    return;
+                }
+
+                auto* const block = reinterpret_cast<FreeBlock*>(ptr);
+                block->next = freeLists[sizeClass];
+                freeLists[sizeClass] = block;
+                ++freeCounts[sizeClass];
+            }
+        };
+
+        thread_local ThreadFrameCache s_threadFrameCache;
+
+        // Trivially destructible flag: remains valid while thread local objects are destructed.
+        // Frames that are released after the cache destruction are going directly to the operator delete.
+        thread_local bool s_threadFrameCacheDestroyed = false;
+
+        ThreadFrameCache::~ThreadFrameCache()
+        {
+            s_threadFrameCacheDestroyed = true;
+
+            for (FreeBlock*& head : freeLists)
+            {
+                while (head)
+                {
+                    FreeBlock* const next = head->next;
+                    ::operator delete(head);
+                    head = next;
+                }
+            }
+        }
+    }  // namespace
+
+    void* allocateTaskFrame(size_t size)
+    {
+        if (size > MaxBlockSize || s_threadFrameCacheDestroyed)
+        {
+            return ::operator new(size);
+        }
+
+        return s_threadFrameCache.allocate(getSizeClass(size));
+    }
+
+    void freeTaskFrame(void* ptr, size_t size) noexcept
+    {
+        if (!ptr)
+        {
+            return;
+        }
+
+        if (size > MaxBlockSize || s_threadFrameCacheDestroyed)
+        {
+            ::operator delete(ptr);
+            return;
+        }
+
+        s_threadFrameCache.free(ptr, getSizeClass(size));
+    }
+
+}  // namespace nau::async_detail
@@ -0,0 +1,233 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "task_trace_internal.h"
+
+#include <EASTL/string.h>
+#include <EASTL/unique_ptr.h>
+#include <EASTL/vector.h>
+
+#include <chrono>
+#include <mutex>
+
+#include "nau/threading/lock_guard.h"
+
+namespace nau::async_detail
+{
+    std::atomic<bool> g_taskTraceActive = false;
+
+    namespace
+    {
+        struct TaskTraceEvent
+        {
+            int64_t timeNs;
+            uint64_t id;
+            const void* executor;
+            TaskTraceEventType type;
+        };
+
+        /**
+            The events of the single thread. The mutex is locked by the owner thread for each event (uncontended)
+            and by the start/export for the whole buffer.
+         */
+        struct ThreadTraceBuffer
+        {
+            uint32_t threadIndex = 0;
+            std::mutex mutex;
+            eastl::vector<TaskTraceEvent> events;
+            uint64_t droppedCount = 0;
+        };
+
+        std::mutex g_buffersMutex;
+        // The buffers are never released: the thread can be finished while its events are still not exported
+        eastl::vector<eastl::unique_ptr<ThreadTraceBuffer>> g_buffers;
+        thread_local ThreadTraceBuffer* t_threadBuffer = nullptr;
+
+        std::atomic<uint64_t> g_traceIdCounter = 0;
+        std::atomic<size_t> g_maxEventsPerThread = 0;
+        std::atomic<int64_t> g_traceStartTimeNs = 0;
+
+        int64_t getTimeNs()
+        {
+            using namespace std::chrono;
+            return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+        }
+
+        ThreadTraceBuffer& getThreadBuffer()
+        {
+            if (!t_threadBuffer)
+            {
+                lock_(g_buffersMutex);
+                auto& buffer = g_buffers.emplace_back(eastl::make_unique<ThreadTraceBuffer>());
+                buffer->threadIndex = static_cast<uint32_t>(g_buffers.size());
+                t_threadBuffer = buffer.get();
+            }
+
+            return *t_threadBuffer;
+        }
+
+        const char* getEventName(TaskTraceEventType type)
+        {
+            switch (type)
+            {
+                case TaskTraceEventType::TaskCreate:
+                    return "TaskCreate";
+                case TaskTraceEventType::TaskAwait:
+                    return "TaskAwait";
+                case TaskTraceEventType::TaskReady:
+                    return "TaskReady";
+                case TaskTraceEventType::Schedule:
+                    return "Schedule";
+                default:
+                    return "Invoke";
+            }
+        }
+
+        Result<> writeText(io::IStreamWriter& stream, eastl::string& text, bool force = false)
+        {
+            constexpr size_t FlushSize = 64 * 1024;
+
+            if (text.size() >= FlushSize || (force && !text.empty()))
+            {
+                NauCheckResult(stream.write(reinterpret_cast<const std::byte*>(text.data()), text.size()));
+                text.clear();
+            }
+
+            return ResultSuccess;
+        }
+    }  // namespace
+
+    uint64_t newTaskTraceId()
+    {
+        return g_traceIdCounter.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
+    void addTaskTraceEvent(TaskTraceEventType type, uint64_t id, const void* executor)
+    {
+        ThreadTraceBuffer& buffer = getThreadBuffer();
+        const int64_t timeNs = getTimeNs();
+
+        lock_(buffer.mutex);
+        if (buffer.events.size() >= g_maxEventsPerThread.load(std::memory_order_relaxed))
+        {
+            ++buffer.droppedCount;
+            return;
+        }
+
+        buffer.events.push_back({timeNs, id, executor, type});
+    }
+}  // namespace nau::async_detail
+
+namespace nau::async
+{
+    using namespace nau::async_detail;
+
+    void startTaskTrace(TaskTraceSettings settings)
+    {
+        g_taskTraceActive.store(false, std::memory_order_relaxed);
+
+        {
+            lock_(g_buffersMutex);
+            for (auto& buffer : g_buffers)
+            {
+                lock_(buffer->mutex);
+                buffer->events.clear();
+                buffer->droppedCount = 0;
+            }
+        }
+
+        g_maxEventsPerThread.store(settings.maxEventsPerThread, std::memory_order_relaxed);
+        g_traceStartTimeNs.store(getTimeNs(), std::memory_order_relaxed);
+        g_taskTraceActive.store(true, std::memory_order_release);
+    }
+
+    void stopTaskTrace()
+    {
+        g_taskTraceActive.store(false, std::memory_order_release);
+    }
+
+    bool isTaskTraceActive()
+    {
+        return async_detail::isTaskTraceActive();
+    }
+
+    Result<> writeTaskTraceChromeJson(io::IStreamWriter& stream)
+    {
+        struct ThreadEvents
+        {
+            uint32_t threadIndex;
+            uint64_t droppedCount;
+            eastl::vector<TaskTraceEvent> events;
+        };
+
+        eastl::vector<ThreadEvents> threads;
+        {
+            lock_(g_buffersMutex);
+            threads.reserve(g_buffers.size());
+            for (auto& buffer : g_buffers)
+            {
+                lock_(buffer->mutex);
+                threads.push_back({buffer->threadIndex, buffer->droppedCount, buffer->events});
+            }
+        }
+
+        const int64_t startTimeNs = g_traceStartTimeNs.load(std::memory_order_relaxed);
+        const auto toUs = [startTimeNs](int64_t timeNs)
+        {
+            return static_cast<double>(timeNs - startTimeNs) / 1000.0;
+        };
+
+        eastl::string text = "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+        text.append("{\"ph\":\"M\",\"pid\":1,\"tid\":0,\"name\":\"process_name\",\"args\":{\"name\":\"async tasks\"}}");
+
+        for (const ThreadEvents& thread : threads)
+        {
+            const uint32_t tid = thread.threadIndex;
+            text.append_sprintf(",\n{\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"name\":\"thread_name\",\"args\":{\"name\":\"Thread %u (dropped %llu)\"}}",
+                                tid, tid, static_cast<unsigned long long>(thread.droppedCount));
+
+            for (const TaskTraceEvent& event : thread.events)
+            {
+                const double ts = toUs(event.timeNs);
+                const auto id = static_cast<unsigned long long>(event.id);
+                const auto executor = reinterpret_cast<uintptr_t>(event.executor);
+
+                switch (event.type)
+                {
+                    case TaskTraceEventType::TaskCreate:
+                    case TaskTraceEventType::TaskAwait:
+                    case TaskTraceEventType::TaskReady:
+                        text.append_sprintf(",\n{\"ph\":\"i\",\"s\":\"t\",\"cat\":\"task\",\"name\":\"%s\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"args\":{\"task\":%llu}}",
+                                            getEventName(event.type), tid, ts, id);
+                        break;
+
+                    case TaskTraceEventType::Schedule:
+                        // The zero length slice holds the flow start: the flow is bound to the enclosing slice
+                        text.append_sprintf(",\n{\"ph\":\"X\",\"cat\":\"executor\",\"name\":\"Schedule\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":0,\"args\":{\"id\":%llu,\"executor\":\"0x%llx\"}}",
+                                            tid, ts, id, static_cast<unsigned long long>(executor));
+                        text.append_sprintf(",\n{\"ph\":\"s\",\"cat\":\"flow\",\"name\":\"continuation\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"id\":%llu}", tid, ts, id);
+                        break;
+
+                    case TaskTraceEventType::InvokeBegin:
+                        text.append_sprintf(",\n{\"ph\":\"B\",\"cat\":\"executor\",\"name\":\"Invoke\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"args\":{\"id\":%llu,\"executor\":\"0x%llx\"}}",
+                                            tid, ts, id, static_cast<unsigned long long>(executor));
+                        if (id != 0)
+                        {
+                            text.append_sprintf(",\n{\"ph\":\"f\",\"bp\":\"e\",\"cat\":\"flow\",\"name\":\"continuation\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"id\":%llu}", tid, ts, id);
+                        }
+                        break;
+
+                    case TaskTraceEventType::InvokeEnd:
+                        text.append_sprintf(",\n{\"ph\":\"E\",\"pid\":1,\"tid\":%u,\"ts\":%.3f}", tid, ts);
+                        break;
+                }
+
+                NauCheckResult(writeText(stream, text));
+            }
+        }
+
+        text.append("\n]}\n");
+        return writeText(stream, text, true);
+    }
+}  // namespace nau::async
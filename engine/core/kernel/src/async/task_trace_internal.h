@@ -0,0 +1,49 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "nau/async/task_trace.h"
+
+/**
+    Compiles in the task trace instrumentation (see nau/async/task_trace.h).
+*/
+#if !defined(NAU_ASYNC_TASK_TRACE)
+    #define NAU_ASYNC_TASK_TRACE 1
+#endif
+
+namespace nau::async_detail
+{
+    enum class TaskTraceEventType : uint8_t
+    {
+        TaskCreate,
+        TaskAwait,
+        TaskReady,
+        Schedule,
+        InvokeBegin,
+        InvokeEnd
+    };
+
+    extern std::atomic<bool> g_taskTraceActive;
+
+    inline bool isTaskTraceActive()
+    {
+#if NAU_ASYNC_TASK_TRACE
+        return g_taskTraceActive.load(std::memory_order_relaxed);
+#else
+        return false;
+#endif
+    }
+
+    /**
+        The unique (for the process) id of the traced task or invocation.
+     */
+    uint64_t newTaskTraceId();
+
+    void addTaskTraceEvent(TaskTraceEventType type, uint64_t id, const void* executor = nullptr);
+
+}  // namespace nau::async_detail
@@ -4,12 +4,17 @@
 
 #include "nau/async/thread_pool_executor.h"
 
+#include <EASTL/deque.h>
+
 #include "nau/rtti/rtti_impl.h"
 #include "nau/runtime/internal/runtime_component.h"
 #include "nau/runtime/internal/runtime_object_registry.h"
+#include "nau/threading/event.h"
 #include "nau/threading/set_thread_name.h"
+#include "nau/threading/waitable_counter.h"
 #include "nau/utils/functor.h"
 #include "nau/utils/scope_guard.h"
+#include "nau/utils/performance_profiling.h"
 
 namespace nau::async
 {
@@ -28,12 +33,26 @@ namespace nau::async
 #else
         size_t getDefaultThreadsCount()
         {
-            return 5;
+            constexpr size_t MinThreadsCount = 5;
+
+            const size_t processorsCount = static_cast<size_t>(std::thread::hardware_concurrency());
+            return std::max(processorsCount / 3, MinThreadsCount);
         }
 #endif
+
+        constexpr std::string_view DefaultPoolName = "Nau Pool";
+
+        struct ThisThreadWorker
+        {
+            const Executor* executor = nullptr;
+            size_t workerIndex = 0;
+        };
+
+        thread_local ThisThreadWorker s_thisThreadWorker;
     }  // namespace
 
     /**
+        Shared queue pool: all workers are taking invocations from the single list.
      */
     class ThreadPoolExecutor final : public Executor,
                                      public IRuntimeComponent
@@ -41,18 +60,18 @@ namespace nau::async
         NAU_CLASS_(nau::async::ThreadPoolExecutor, Executor, IRuntimeComponent)
 
     public:
-        ThreadPoolExecutor(std::optional<size_t> threadsCount)
+        ThreadPoolExecutor(std::string_view poolName, std::optional<size_t> threadsCount)
         {
             const size_t maxThreads = threadsCount ? *threadsCount : getDefaultThreadsCount();
             m_threads.reserve(maxThreads);
 
             for (size_t i = 0; i < maxThreads; ++i)
             {
-                m_threads.emplace_back([](ThreadPoolExecutor& executor, size_t threadIndex)
+                m_threads.emplace_back([](ThreadPoolExecutor& executor, std::string threadName)
                 {
-                    threading::setThisThreadName(std::format("Nau Pool-{}", threadIndex + 1));
+                    threading::setThisThreadName(threadName);
                     executor.threadWork();
-                }, std::ref(*this), i);
+                }, std::ref(*this), std::format("{}-{}", poolName, i + 1));
             }
 
             RuntimeObjectRegistration{nau::Ptr<>{this}}.setAutoRemove();
@@ -74,7 +93,7 @@ namespace nau::async
                 return;
             }
 
-            m_taskCounter.fetch_add(1);
+            m_taskCounter.increment();
 
             const std::lock_guard lock{m_mutex};
 
@@ -82,21 +101,19 @@ namespace nau::async
             m_signal.notify_all();
         }
 
-        void waitAnyActivity() noexcept override
+        bool waitAnyActivity(std::optional<std::chrono::milliseconds> timeout) noexcept override
         {
-            using namespace std::chrono_literals;
-
-            constexpr auto SleepTimeout = 2ms;
+            return m_taskCounter.waitForZero(timeout);
+        }
 
-            while (m_taskCounter.load() > 0)
-            {
-                std::this_thread::sleep_for(SleepTimeout);
-            }
+        size_t getConcurrency() const noexcept override
+        {
+            return m_threads.size();
         }
 
         bool hasWorks() override
         {
-            return m_taskCounter.load() > 0;
+            return m_taskCounter.getCount() > 0;
         }
 
         Invocation getOrWaitNextInvocation()
@@ -134,8 +151,7 @@ namespace nau::async
 
                 scope_on_leave
                 {
-                    NAU_ASSERT(m_taskCounter > 0);
-                    m_taskCounter.fetch_sub(1);
+                    m_taskCounter.decrement();
                 };
 
                 const Executor::InvokeGuard guard{*this};
@@ -170,12 +186,279 @@ namespace nau::async
         eastl::vector<std::thread> m_threads;
         std::mutex m_mutex;
         std::condition_variable m_signal;
-        std::atomic_size_t m_taskCounter = 0;
+        threading::WaitableCounter m_taskCounter;
+    };
+
+    /**
+        Work stealing pool: every worker owns its own deque of invocations.
+        Invocations scheduled from a worker thread go to that worker's deque (and are taken back in LIFO order),
+        invocations scheduled from the outside are distributed between workers in round-robin.
+        A worker with an empty deque steals the oldest invocation from the other workers.
+        Sleeping workers are kept in the idle list and only one of them is woken per scheduled invocation.
+     */
+    class WorkStealingThreadPoolExecutor final : public Executor,
+                                                 public IRuntimeComponent
+    {
+        NAU_CLASS_(nau::async::WorkStealingThreadPoolExecutor, Executor, IRuntimeComponent)
+
+    public:
+        WorkStealingThreadPoolExecutor(std::string_view poolName, std::optional<size_t> threadsCount)
+        {
+            const size_t maxThreads = std::max(threadsCount ? *threadsCount : getDefaultThreadsCount(), size_t{1});
+            m_workers.reserve(maxThreads);
+            m_idleWorkers.reserve(maxThreads);
+
+            for (size_t i = 0; i < maxThreads; ++i)
+            {
+                m_workers.emplace_back(eastl::make_unique<Worker>());
+            }
+
+            // All workers must be created before any thread starts: threads are accessing the neighbor's deques.
+            for (size_t i = 0; i < maxThreads; ++i)
+            {
+                m_workers[i]->thread = std::thread([](WorkStealingThreadPoolExecutor& executor, size_t workerIndex, std::string threadName)
+                {
+                    threading::setThisThreadName(threadName);
+                    executor.threadWork(workerIndex);
+                }, std::ref(*this), i, std::format("{}-{}", poolName, i + 1));
+            }
+
+            RuntimeObjectRegistration{nau::Ptr<>{this}}.setAutoRemove();
+        }
+
+        ~WorkStealingThreadPoolExecutor()
+        {
+            join();
+        }
+
+    private:
+        struct alignas(64) Worker
+        {
+            std::mutex mutex;
+            eastl::deque<Invocation> invocations;
+            threading::Event signal{threading::Event::ResetMode::Auto};
+            std::thread thread;
+        };
+
+        void scheduleInvocation(Invocation invocation) noexcept override
+        {
+            NAU_ASSERT(invocation);
+            if (!invocation)
+            {
+                return;
+            }
+
+            m_taskCounter.increment();
+
+            const bool isLocalWorker = s_thisThreadWorker.executor == this;
+            const size_t workerIndex = isLocalWorker ? s_thisThreadWorker.workerIndex : m_nextWorkerIndex.fetch_add(1, std::memory_order_relaxed) % m_workers.size();
+
+            {
+                Worker& worker = *m_workers[workerIndex];
+                const std::lock_guard lock{worker.mutex};
+                worker.invocations.emplace_back(std::move(invocation));
+            }
+
+            // The local worker is obviously not sleeping, so wake anyone else to steal the work.
+            // The external invocation prefers to wake the worker that owns the deque.
+            wakeIdleWorker(isLocalWorker ? std::nullopt : std::optional<size_t>{workerIndex});
+        }
+
+        bool waitAnyActivity(std::optional<std::chrono::milliseconds> timeout) noexcept override
+        {
+            return m_taskCounter.waitForZero(timeout);
+        }
+
+        size_t getConcurrency() const noexcept override
+        {
+            return m_workers.size();
+        }
+
+        bool hasWorks() override
+        {
+            return m_taskCounter.getCount() > 0;
+        }
+
+        Invocation popLocalInvocation(size_t workerIndex)
+        {
+            Worker& worker = *m_workers[workerIndex];
+            const std::lock_guard lock{worker.mutex};
+            if (worker.invocations.empty())
+            {
+                return {};
+            }
+
+            Invocation invocation = std::move(worker.invocations.back());
+            worker.invocations.pop_back();
+            return invocation;
+        }
+
+        Invocation stealInvocation(size_t thiefIndex)
+        {
+            const size_t workersCount = m_workers.size();
+
+            for (size_t i = 1; i < workersCount; ++i)
+            {
+                Worker& victim = *m_workers[(thiefIndex + i) % workersCount];
+                const std::lock_guard lock{victim.mutex};
+                if (!victim.invocations.empty())
+                {
+                    Invocation invocation = std::move(victim.invocations.front());
+                    victim.invocations.pop_front();
+                    return invocation;
+                }
+            }
+
+            return {};
+        }
+
+        Invocation findInvocation(size_t workerIndex)
+        {
+            if (Invocation invocation = popLocalInvocation(workerIndex))
+            {
+                return invocation;
+            }
+
+            return stealInvocation(workerIndex);
+        }
+
+        void wakeIdleWorker(std::optional<size_t> preferredWorkerIndex)
+        {
+            if (m_idleWorkersCount.load(std::memory_order_acquire) == 0)
+            {
+                return;
+            }
+
+            size_t workerIndex = 0;
+            {
+                const std::lock_guard lock{m_idleMutex};
+                if (m_idleWorkers.empty())
+                {
+                    return;
+                }
+
+                auto iter = m_idleWorkers.end() - 1;
+                if (preferredWorkerIndex)
+                {
+                    if (auto preferred = eastl::find(m_idleWorkers.begin(), m_idleWorkers.end(), *preferredWorkerIndex); preferred != m_idleWorkers.end())
+                    {
+                        iter = preferred;
+                    }
+                }
+
+                workerIndex = *iter;
+                m_idleWorkers.erase_unsorted(iter);
+                m_idleWorkersCount.fetch_sub(1, std::memory_order_release);
+            }
+
+            m_workers[workerIndex]->signal.set();
+        }
+
+        void setWorkerIdle(size_t workerIndex)
+        {
+            const std::lock_guard lock{m_idleMutex};
+            m_idleWorkers.push_back(workerIndex);
+            m_idleWorkersCount.fetch_add(1, std::memory_order_seq_cst);
+        }
+
+        void resetWorkerIdle(size_t workerIndex)
+        {
+            const std::lock_guard lock{m_idleMutex};
+            if (auto iter = eastl::find(m_idleWorkers.begin(), m_idleWorkers.end(), workerIndex); iter != m_idleWorkers.end())
+            {
+                m_idleWorkers.erase_unsorted(iter);
+                m_idleWorkersCount.fetch_sub(1, std::memory_order_release);
+            }
+        }
+
+        void threadWork(size_t workerIndex)
+        {
+            s_thisThreadWorker = ThisThreadWorker{this, workerIndex};
+            scope_on_leave
+            {
+                s_thisThreadWorker = ThisThreadWorker{};
+            };
+
+            Worker& worker = *m_workers[workerIndex];
+
+            while (true)
+            {
+                Invocation invocation = findInvocation(workerIndex);
+                if (!invocation)
+                {
+                    if (!m_isActive)
+                    {
+                        break;
+                    }
+
+                    // Worker must be published as idle before the final check of the deques:
+                    // otherwise invocation that is scheduled between the check and the wait can be lost.
+                    setWorkerIdle(workerIndex);
+                    invocation = findInvocation(workerIndex);
+                    if (!invocation)
+                    {
+                        if (!m_isActive)
+                        {
+                            resetWorkerIdle(workerIndex);
+                            break;
+                        }
+
+                        worker.signal.wait();
+                        continue;
+                    }
+
+                    resetWorkerIdle(workerIndex);
+                }
+
+                scope_on_leave
+                {
+                    m_taskCounter.decrement();
+                };
+
+                const Executor::InvokeGuard guard{*this};
+                Executor::invoke(*this, std::move(invocation));
+            }
+        }
+
+        void join()
+        {
+            m_isActive = false;
+
+            for (auto& worker : m_workers)
+            {
+                worker->signal.set();
+            }
+
+            for (auto& worker : m_workers)
+            {
+                worker->thread.join();
+            }
+        }
+
+        std::atomic_bool m_isActive{true};
+        eastl::vector<eastl::unique_ptr<Worker>> m_workers;
+        std::atomic_size_t m_nextWorkerIndex = 0;
+
+        NAU_PROFILING_LOCKABLE(std::mutex, m_idleMutex);
+        eastl::vector<size_t> m_idleWorkers;
+        std::atomic_size_t m_idleWorkersCount = 0;
+
+        threading::WaitableCounter m_taskCounter;
     };
 
     Executor::Ptr createThreadPoolExecutor(std::optional<size_t> threadsCount)
     {
-        return rtti::createInstance<ThreadPoolExecutor, Executor>(threadsCount);
+        return createThreadPoolExecutor(DefaultPoolName, threadsCount, ThreadPoolMode::WorkStealing);
+    }
+
+    Executor::Ptr createThreadPoolExecutor(std::string_view poolName, std::optional<size_t> threadsCount, ThreadPoolMode mode)
+    {
+        if (mode == ThreadPoolMode::SharedQueue)
+        {
+            return rtti::createInstance<ThreadPoolExecutor, Executor>(poolName, threadsCount);
+        }
+
+        return rtti::createInstance<WorkStealingThreadPoolExecutor, Executor>(poolName, threadsCount);
     }
 
 }  // namespace nau::async
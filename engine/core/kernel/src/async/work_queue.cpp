@@ -4,11 +4,14 @@
 
 #include "nau/async/work_queue.h"
 
+#include "nau/async/core/task_frame_allocator.h"
 #include "nau/async/task_base.h"
 #include "nau/rtti/rtti_impl.h"
 #include "nau/runtime/internal/runtime_component.h"
 #include "nau/runtime/internal/runtime_object_registry.h"
 #include "nau/threading/event.h"
+#include "nau/threading/waitable_counter.h"
+#include "nau/utils/performance_profiling.h"
 
 namespace nau
 {
@@ -20,7 +23,7 @@ namespace nau
         NAU_CLASS_(nau::WorkQueueImpl, WorkQueue, IRuntimeComponent)
 
     public:
-        WorkQueueImpl();
+        WorkQueueImpl(WorkQueueMode mode);
 
         ~WorkQueueImpl();
 
@@ -33,7 +36,7 @@ namespace nau
 
         bool hasWorks() override;
 
-        void waitAnyActivity() noexcept override;
+        bool waitAnyActivity(std::optional<std::chrono::milliseconds> timeout) noexcept override;
 
         void scheduleInvocation(Invocation) noexcept override;
 
@@ -48,6 +51,15 @@ namespace nau
         }
 
     private:
+        /**
+            Node of the intrusive lock-free list that is used in WorkQueueMode::Mpsc.
+        */
+        struct InvocationNode
+        {
+            Executor::Invocation invocation;
+            InvocationNode* next = nullptr;
+        };
+
         void notifyInternal()
         {
             if (m_signal)
@@ -58,24 +70,99 @@ namespace nau
             m_event.set();
         }
 
-        std::mutex m_mutex;
+        void pushMpscInvocation(Invocation invocation);
+
+        /**
+            Takes all invocations from the lock-free list at once (with a single atomic exchange) preserving scheduling order.
+        */
+        void drainMpscInvocations(eastl::vector<Executor::Invocation>& invocations);
+
+        const WorkQueueMode m_mode;
+        std::atomic<InvocationNode*> m_mpscHead = nullptr;
+        // Set while there is a pending waitForWork() task (Mpsc mode): producers only take the mutex in that case.
+        std::atomic<bool> m_hasWorkAwaiter = false;
+
+        NAU_PROFILING_LOCKABLE(std::mutex, m_mutex);
         eastl::vector<async::Executor::Invocation> m_invocations;
         async::TaskSource<> m_signal;
         std::atomic<bool> m_isPolled = false;
         std::atomic<bool> m_isNotified = false;
 
         threading::Event m_event{threading::Event::ResetMode::Manual};
+        // Scheduled but not yet completed invocations.
+        threading::WaitableCounter m_pendingCounter;
 
         std::string m_name;
     };
 
-    WorkQueueImpl::WorkQueueImpl()
+    WorkQueueImpl::WorkQueueImpl(WorkQueueMode mode) :
+        m_mode(mode)
     {
         RuntimeObjectRegistration{nau::Ptr<>{this}}.setAutoRemove();
     }
 
     WorkQueueImpl::~WorkQueueImpl()
     {
+        for (InvocationNode* node = m_mpscHead.exchange(nullptr); node;)
+        {
+            InvocationNode* const next = node->next;
+            std::destroy_at(node);
+            async_detail::freeTaskFrame(node, sizeof(InvocationNode));
+            node = next;
+        }
+    }
+
+    void WorkQueueImpl::pushMpscInvocation(Invocation invocation)
+    {
+        void* const storage = async_detail::allocateTaskFrame(sizeof(InvocationNode));
+        auto* const node = new(storage) InvocationNode{std::move(invocation)};
+
+        InvocationNode* head = m_mpscHead.load(std::memory_order_relaxed);
+        do
+        {
+            node->next = head;
+        } while (!m_mpscHead.compare_exchange_weak(head, node, std::memory_order_seq_cst, std::memory_order_relaxed));
+
+        // The consumer resets the event before the list draining,
+        // so only the transition from the empty list requires the wake up.
+        if (!head)
+        {
+            m_event.set();
+        }
+
+        if (m_hasWorkAwaiter.load())
+        {
+            lock_(m_mutex);
+            m_hasWorkAwaiter = false;
+            if (m_signal)
+            {
+                m_signal.resolve();
+            }
+        }
+    }
+
+    void WorkQueueImpl::drainMpscInvocations(eastl::vector<Executor::Invocation>& invocations)
+    {
+        invocations.clear();
+
+        // The list is LIFO: reverse it to execute invocations in the scheduling order.
+        InvocationNode* reversed = nullptr;
+        for (InvocationNode* node = m_mpscHead.exchange(nullptr, std::memory_order_acquire); node;)
+        {
+            InvocationNode* const next = node->next;
+            node->next = reversed;
+            reversed = node;
+            node = next;
+        }
+
+        for (InvocationNode* node = reversed; node;)
+        {
+            InvocationNode* const next = node->next;
+            invocations.emplace_back(std::move(node->invocation));
+            std::destroy_at(node);
+            async_detail::freeTaskFrame(node, sizeof(InvocationNode));
+            node = next;
+        }
     }
 
     async::Task<> WorkQueueImpl::waitForWork()
@@ -85,8 +172,15 @@ namespace nau
         lock_(m_mutex);
         NAU_ASSERT(!m_isPolled);
 
-        if (!m_invocations.empty())
+        if (m_mode == WorkQueueMode::Mpsc)
+        {
+            // The flag must be published before the list check: producer checks it after the push.
+            m_hasWorkAwaiter = true;
+        }
+
+        if (!m_invocations.empty() || m_mpscHead.load() != nullptr)
         {
+            m_hasWorkAwaiter = false;
             return Task<>::makeResolved();
         }
 
@@ -109,9 +203,20 @@ namespace nau
         NAU_ASSERT(!m_isPolled);
         m_isPolled = true;
 
+        // Notification is consumed only by the poll that actually observes it:
+        // notify() that is called when the queue is not polled will interrupt the next poll().
+        bool isNotified = false;
+        const auto consumeNotification = [&]() -> bool
+        {
+            if (!isNotified)
+            {
+                isNotified = m_isNotified.exchange(false);
+            }
+            return isNotified;
+        };
+
         scope_on_leave
         {
-            m_isNotified = false;
             m_isPolled = false;
         };
 
@@ -129,6 +234,23 @@ namespace nau
 
         auto takeInvocations = [this](eastl::vector<Executor::Invocation>& invocations) mutable
         {
+            if (m_mode == WorkQueueMode::Mpsc)
+            {
+                // Event must be reset prior the draining: the push to the drained (empty) list will set it again.
+                m_event.reset();
+                drainMpscInvocations(invocations);
+
+                if (m_signal && m_signal.isReady())
+                {
+                    lock_(m_mutex);
+                    if (m_signal && m_signal.isReady())
+                    {
+                        m_signal = nullptr;
+                    }
+                }
+                return;
+            }
+
             lock_(m_mutex);
             if (m_signal && m_signal.isReady())
             {
@@ -155,6 +277,12 @@ namespace nau
         {
             for (takeInvocations(invocations); invocations.empty(); takeInvocations(invocations))
             {
+                // Must be checked after the event reset (inside takeInvocations), so the notification can not be lost.
+                if (consumeNotification())
+                {
+                    break;
+                }
+
                 if (timeout)
                 {
                     const auto dt = duration_cast<milliseconds>(Timer::now() - timePoint);
@@ -173,7 +301,7 @@ namespace nau
                     [[maybe_unused]] const bool waitTimeouted = m_event.wait();
                 }
 
-                if (m_isNotified)
+                if (consumeNotification())
                 {
                     break;
                 }
@@ -181,11 +309,17 @@ namespace nau
 
             if (!invocations.empty())
             {
+                const size_t invocationsCount = invocations.size();
+                scope_on_leave
+                {
+                    m_pendingCounter.decrement(invocationsCount);
+                };
+
                 const Executor::InvokeGuard guard{*this};
                 Executor::invoke(*this, {invocations.data(), invocations.size()});
             }
 
-        } while (!timeIsOut() && !m_isNotified);
+        } while (!consumeNotification() && !timeIsOut());
     }
 
     void WorkQueueImpl::notify()
@@ -197,25 +331,40 @@ namespace nau
 
     bool WorkQueueImpl::hasWorks()
     {
+        if (m_isPolled || m_mpscHead.load() != nullptr)
+        {
+            return true;
+        }
+
         lock_(m_mutex);
-        return !m_invocations.empty() || m_isPolled;
+        return !m_invocations.empty();
     }
 
-    void WorkQueueImpl::waitAnyActivity() noexcept
+    bool WorkQueueImpl::waitAnyActivity(std::optional<std::chrono::milliseconds> timeout) noexcept
     {
+        // The queue is only drained by poll(): waiting makes sense only from a thread other than the polling one.
+        return m_pendingCounter.waitForZero(timeout);
     }
 
     void WorkQueueImpl::scheduleInvocation(Invocation invocation) noexcept
     {
+        m_pendingCounter.increment();
+
+        if (m_mode == WorkQueueMode::Mpsc)
+        {
+            pushMpscInvocation(std::move(invocation));
+            return;
+        }
+
         lock_(m_mutex);
         m_invocations.emplace_back(std::move(invocation));
 
         notifyInternal();
     }
 
-    WorkQueue::Ptr WorkQueue::create()
+    WorkQueue::Ptr WorkQueue::create(WorkQueueMode mode)
     {
-        return rtti::createInstance<WorkQueueImpl, WorkQueue>();
+        return rtti::createInstance<WorkQueueImpl, WorkQueue>(mode);
     }
 
 }  // namespace nau
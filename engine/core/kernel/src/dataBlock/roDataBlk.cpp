@@ -1,7 +1,12 @@
 // Copyright 2024 N-GINN LLC. All rights reserved.
 
 // Copyright (C) 2024  Gaijin Games KFT.  All rights reserved
+#include <EASTL/algorithm.h>
+#include <EASTL/sort.h>
+#include <EASTL/unordered_map.h>
+#include <EASTL/vector.h>
 #include <nau/dag_ioSys/dag_genIo.h>
+#include <nau/dataBlock/dag_dataBlock.h>
 #include <nau/dataBlock/dag_roDataBlock.h>
 
 #include "nau/memory/mem_allocator.h"
@@ -25,6 +30,217 @@ namespace nau
         return blk;
     }
 
+    namespace
+    {
+        /// the offset within the dump as it is stored by PatchableTab before patching (see PatchableTab::patch())
+        template <class T>
+        void initPatchableTab(PatchableTab<T>& tab, size_t offset, size_t count)
+        {
+#if NAU_64BIT
+    #if _TARGET_BE
+            tab.init(count ? reinterpret_cast<void*>((uint64_t(offset) << 32) | uint64_t(count)) : nullptr, 0);
+    #else
+            tab.init(count ? reinterpret_cast<void*>(uint64_t(offset) | (uint64_t(count) << 32)) : nullptr, 0);
+    #endif
+#else
+            tab.init(reinterpret_cast<void*>(offset), count);
+#endif
+        }
+
+        template <class T>
+        void initPatchablePtr(PatchablePtr<T>& ptr, size_t offset)
+        {
+            ptr.setPtr(reinterpret_cast<const void*>(offset));
+            ptr.clearUpperBits();
+        }
+
+        size_t alignOffset(size_t offset, size_t alignment)
+        {
+            return (offset + alignment - 1) & ~(alignment - 1);
+        }
+    }  // namespace
+
+    bool RoDataBlock::saveDump(const DataBlock& root, iosys::IGenSave& cwr)
+    {
+        // Layout: the blocks (the sub-blocks of each block are contiguous), the params, the name map with its entries,
+        // then the names, the string values and the values which do not fit into the param.
+        // The values are addressed relative to the name map, everything else relative to the dump beginning.
+
+        eastl::vector<const DataBlock*> blocks{&root};
+        eastl::vector<uint32_t> firstSubBlocks;
+        eastl::vector<uint32_t> firstParams;
+        size_t paramCount = 0;
+        for (size_t i = 0; i < blocks.size(); ++i)
+        {
+            firstSubBlocks.push_back(static_cast<uint32_t>(blocks.size()));
+            firstParams.push_back(static_cast<uint32_t>(paramCount));
+            paramCount += blocks[i]->paramCount();
+            for (uint32_t j = 0, count = blocks[i]->blockCount(); j < count; ++j)
+            {
+                blocks.push_back(blocks[i]->getBlock(j));
+            }
+        }
+
+        // RoNameMap::getNameId() uses the binary search: the names are sorted as strcmp() does
+        eastl::vector<const char*> names;
+        for (size_t i = 0; i < blocks.size(); ++i)
+        {
+            if (i != 0)
+            {
+                names.push_back(blocks[i]->getBlockName());
+            }
+            for (uint32_t j = 0, count = blocks[i]->paramCount(); j < count; ++j)
+            {
+                names.push_back(blocks[i]->getParamName(j));
+            }
+        }
+
+        const auto isNameLess = [](const char* left, const char* right)
+        {
+            return strcmp(left, right) < 0;
+        };
+
+        eastl::sort(names.begin(), names.end(), isNameLess);
+        names.erase(eastl::unique(names.begin(), names.end(), [](const char* left, const char* right)
+        {
+            return strcmp(left, right) == 0;
+        }), names.end());
+
+        if (names.size() > UINT16_MAX)
+        {
+            return false;
+        }
+
+        const auto getNameId = [&names, &isNameLess](const char* name)
+        {
+            return static_cast<int>(eastl::lower_bound(names.begin(), names.end(), name, isNameLess) - names.begin());
+        };
+
+        const size_t paramsOffset = blocks.size() * sizeof(RoDataBlock);
+        const size_t nameMapOffset = alignOffset(paramsOffset + paramCount * sizeof(Param), alignof(dag::RoNameMap));
+        const size_t nameMapEntriesOffset = nameMapOffset + sizeof(dag::RoNameMap);
+
+        eastl::vector<char> dump(nameMapEntriesOffset + names.size() * sizeof(PatchablePtr<const char>), 0);
+
+        const auto appendData = [&dump](const void* data, size_t size, size_t alignment)
+        {
+            const size_t offset = alignOffset(dump.size(), alignment);
+            dump.resize(offset + size, 0);
+            memcpy(dump.data() + offset, data, size);
+            return offset;
+        };
+
+        eastl::vector<size_t> nameOffsets;
+        nameOffsets.reserve(names.size());
+        for (const char* const name : names)
+        {
+            nameOffsets.push_back(appendData(name, strlen(name) + 1, 1));
+        }
+
+        eastl::unordered_map<eastl::string_view, int> stringValues;
+        const auto appendString = [&](const char* str) -> int
+        {
+            auto [iter, emplaced] = stringValues.emplace(eastl::string_view{str}, 0);
+            if (emplaced)
+            {
+                iter->second = static_cast<int>(appendData(str, strlen(str) + 1, 1) - nameMapOffset);
+            }
+            return iter->second;
+        };
+
+        const auto appendValue = [&]<typename T>(const T& value) -> int
+        {
+            return static_cast<int>(appendData(&value, sizeof(T), eastl::max<size_t>(alignof(T), 16)) - nameMapOffset);
+        };
+
+        eastl::vector<Param> params;
+        params.reserve(paramCount);
+        for (const DataBlock* const blk : blocks)
+        {
+            for (uint32_t i = 0, count = blk->paramCount(); i < count; ++i)
+            {
+                Param& param = params.emplace_back();
+                param.i = 0;
+                param.nameId = static_cast<uint16_t>(getNameId(blk->getParamName(i)));
+                param.type = static_cast<uint16_t>(blk->getParamType(i));
+
+                switch (param.type)
+                {
+                    case TYPE_STRING:
+                        param.i = appendString(blk->getStr(i));
+                        break;
+                    case TYPE_INT:
+                        param.i = blk->getInt(i);
+                        break;
+                    case TYPE_REAL:
+                        param.r = blk->getReal(i);
+                        break;
+                    case TYPE_BOOL:
+                        param.i = blk->getBool(i) ? 1 : 0;
+                        break;
+                    case TYPE_E3DCOLOR:
+                        param.i = static_cast<int>(static_cast<uint32_t>(blk->getE3dcolor(i)));
+                        break;
+                    case TYPE_POINT2:
+                        param.i = appendValue(nau::math::vec2{blk->getPoint2(i)});
+                        break;
+                    case TYPE_POINT3:
+                        param.i = appendValue(nau::math::vec3{blk->getPoint3(i)});
+                        break;
+                    case TYPE_POINT4:
+                        param.i = appendValue(nau::math::vec4{blk->getPoint4(i)});
+                        break;
+                    case TYPE_IPOINT2:
+                        param.i = appendValue(nau::math::ivec2{blk->getIPoint2(i)});
+                        break;
+                    case TYPE_IPOINT3:
+                        param.i = appendValue(nau::math::ivec3{blk->getIPoint3(i)});
+                        break;
+                    case TYPE_MATRIX:
+                        param.i = appendValue(nau::math::mat4{blk->getTm(i)});
+                        break;
+                    case TYPE_INT64:
+                        param.i = appendValue(blk->getInt64(i));
+                        break;
+                    default:
+                        return false;
+                }
+            }
+        }
+
+        if (dump.size() > INT32_MAX)
+        {
+            return false;
+        }
+
+        // the dump layout is filled after all the data is appended: the appending reallocates it
+        for (size_t i = 0; i < blocks.size(); ++i)
+        {
+            RoDataBlock* const blk = new (dump.data() + i * sizeof(RoDataBlock)) RoDataBlock;
+            initPatchableTab(blk->params, paramsOffset + firstParams[i] * sizeof(Param), blocks[i]->paramCount());
+            initPatchableTab(blk->blocks, firstSubBlocks[i] * sizeof(RoDataBlock), blocks[i]->blockCount());
+            initPatchablePtr(blk->nameMap, nameMapOffset);
+            blk->nameId = i == 0 ? -1 : getNameId(blocks[i]->getBlockName());
+        }
+
+        if (!params.empty())
+        {
+            memcpy(dump.data() + paramsOffset, params.data(), params.size() * sizeof(Param));
+        }
+
+        dag::RoNameMap* const nameMap = new (dump.data() + nameMapOffset) dag::RoNameMap;
+        initPatchableTab(nameMap->map, nameMapEntriesOffset, names.size());
+        for (size_t i = 0; i < names.size(); ++i)
+        {
+            auto* const entry = new (dump.data() + nameMapEntriesOffset + i * sizeof(PatchablePtr<const char>)) PatchablePtr<const char>;
+            initPatchablePtr(*entry, nameOffsets[i]);
+        }
+
+        cwr.writeInt(static_cast<int>(dump.size()));
+        cwr.write(dump.data(), static_cast<int>(dump.size()));
+        return true;
+    }
+
     void RoDataBlock::patchData(void* base)
     {
         nameMap.patch(base);
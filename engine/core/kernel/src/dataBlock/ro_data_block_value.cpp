@@ -0,0 +1,388 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "nau/dataBlock/ro_data_block_value.h"
+
+#include <EASTL/vector.h>
+
+#include "nau/dag_ioSys/dag_memIo.h"
+#include "nau/dataBlock/dag_dataBlock.h"
+#include "nau/memory/mem_allocator.h"
+#include "nau/rtti/rtti_impl.h"
+#include "nau/serialization/runtime_value_builder.h"
+
+namespace nau
+{
+    namespace
+    {
+        constexpr const char* ArrayMarkerName = "@array";
+        constexpr const char* ArrayItemName = "@item";
+
+        struct RoDataBlockContext
+        {
+            RoDataBlockPtr root;
+            RoDataBlockStringCallback stringCallback;
+        };
+
+        using RoDataBlockContextPtr = eastl::shared_ptr<RoDataBlockContext>;
+
+        RuntimeValue::Ptr wrapBlock(const RoDataBlockContextPtr& context, const RoDataBlock& block);
+
+        RuntimeValue::Ptr getParamValue(RoDataBlockContext& context, const RoDataBlock& block, int index)
+        {
+            switch (block.getParamType(index))
+            {
+                case RoDataBlock::TYPE_STRING:
+                {
+                    const char* const str = block.getStr(index);
+                    if (context.stringCallback)
+                    {
+                        if (auto newString = context.stringCallback(eastl::string_view{str}); newString)
+                        {
+                            return makeValueCopy(std::string{newString->data(), newString->size()});
+                        }
+                    }
+                    return makeValueCopy(std::string{str});
+                }
+                case RoDataBlock::TYPE_INT:
+                    return makeConstValue(block.getInt(index));
+                case RoDataBlock::TYPE_REAL:
+                    return makeConstValue(block.getReal(index));
+                case RoDataBlock::TYPE_BOOL:
+                    return makeConstValue(block.getBool(index));
+                case RoDataBlock::TYPE_INT64:
+                    return makeConstValue(block.getInt64(index));
+                case RoDataBlock::TYPE_E3DCOLOR:
+                    return makeConstValue(static_cast<unsigned>(block.getE3dcolor(index)));
+                case RoDataBlock::TYPE_POINT2:
+                    return math::makeValueCopy(block.getPoint2(index));
+                case RoDataBlock::TYPE_POINT3:
+                    return math::makeValueCopy(block.getPoint3(index));
+                case RoDataBlock::TYPE_POINT4:
+                {
+                    const math::vec4& value = block.getPoint4(index);
+                    return makeValueCopy(eastl::vector<float>{value.getX(), value.getY(), value.getZ(), value.getW()});
+                }
+                case RoDataBlock::TYPE_IPOINT2:
+                    return math::makeValueCopy(block.getIPoint2(index));
+                case RoDataBlock::TYPE_IPOINT3:
+                {
+                    const math::ivec3& value = block.getIPoint3(index);
+                    return makeValueCopy(eastl::vector<int>{value.getX(), value.getY(), value.getZ()});
+                }
+                case RoDataBlock::TYPE_MATRIX:
+                    return math::makeValueCopy(block.getTm(index));
+                default:
+                    NAU_FAILURE("Unknown RoDataBlock param type ({})", block.getParamType(index));
+                    return nullptr;
+            }
+        }
+
+        /**
+            The sub-block written for the collection: the elements are the params and the sub-blocks named "@item".
+         */
+        class RoDataBlockCollection final : public RuntimeReadonlyCollection
+        {
+            NAU_CLASS_(nau::RoDataBlockCollection, RuntimeReadonlyCollection)
+
+        public:
+            RoDataBlockCollection(RoDataBlockContextPtr context, const RoDataBlock& block) :
+                m_context(std::move(context)),
+                m_block(block)
+            {
+                const int itemNameId = m_block.getNameId(ArrayItemName);
+                for (int i = 0, count = m_block.paramCount(); i < count; ++i)
+                {
+                    if (m_block.getParamNameId(i) == itemNameId)
+                    {
+                        m_params.push_back(i);
+                    }
+                }
+
+                for (int i = 0, count = m_block.blockCount(); i < count; ++i)
+                {
+                    if (m_block.getBlock(i)->getBlockNameId() == itemNameId)
+                    {
+                        m_blocks.push_back(i);
+                    }
+                }
+            }
+
+            bool isMutable() const override
+            {
+                return false;
+            }
+
+            size_t getSize() const override
+            {
+                return m_params.size() + m_blocks.size();
+            }
+
+            RuntimeValue::Ptr getAt(size_t index) override
+            {
+                NAU_ASSERT(index < getSize(), "Invalid index [{}]", index);
+                if (index < m_params.size())
+                {
+                    return getParamValue(*m_context, m_block, m_params[index]);
+                }
+
+                index -= m_params.size();
+                return index < m_blocks.size() ? wrapBlock(m_context, *m_block.getBlock(m_blocks[index])) : nullptr;
+            }
+
+            Result<> setAt([[maybe_unused]] size_t index, [[maybe_unused]] const RuntimeValue::Ptr& value) override
+            {
+                return NauMakeError("Attempt to modify non mutable RoDataBlock value");
+            }
+
+        private:
+            const RoDataBlockContextPtr m_context;
+            const RoDataBlock& m_block;
+            eastl::vector<int> m_params;
+            eastl::vector<int> m_blocks;
+        };
+
+        /**
+         */
+        class RoDataBlockDictionary final : public RuntimeReadonlyDictionary
+        {
+            NAU_CLASS_(nau::RoDataBlockDictionary, RuntimeReadonlyDictionary)
+
+        public:
+            RoDataBlockDictionary(RoDataBlockContextPtr context, const RoDataBlock& block) :
+                m_context(std::move(context)),
+                m_block(block)
+            {
+                const auto addKey = [this](int nameId)
+                {
+                    if (eastl::find(m_keys.begin(), m_keys.end(), nameId) == m_keys.end())
+                    {
+                        m_keys.push_back(nameId);
+                    }
+                };
+
+                for (int i = 0, count = m_block.paramCount(); i < count; ++i)
+                {
+                    addKey(m_block.getParamNameId(i));
+                }
+
+                for (int i = 0, count = m_block.blockCount(); i < count; ++i)
+                {
+                    addKey(m_block.getBlock(i)->getBlockNameId());
+                }
+            }
+
+            bool isMutable() const override
+            {
+                return false;
+            }
+
+            size_t getSize() const override
+            {
+                return m_keys.size();
+            }
+
+            std::string_view getKey(size_t index) const override
+            {
+                NAU_ASSERT(index < m_keys.size(), "Invalid index ({}) > size:({})", index, m_keys.size());
+                return m_block.getName(m_keys[index]);
+            }
+
+            RuntimeValue::Ptr getValue(std::string_view key) override
+            {
+                const int nameId = getNameId(key);
+                if (nameId < 0)
+                {
+                    return nullptr;
+                }
+
+                if (const int paramIndex = m_block.findParam(nameId); paramIndex >= 0)
+                {
+                    return getParamValue(*m_context, m_block, paramIndex);
+                }
+
+                if (const RoDataBlock* const subBlock = m_block.getBlockByName(nameId))
+                {
+                    return wrapBlock(m_context, *subBlock);
+                }
+
+                return nullptr;
+            }
+
+            Result<> setValue([[maybe_unused]] std::string_view key, [[maybe_unused]] const RuntimeValue::Ptr& value) override
+            {
+                return NauMakeError("Attempt to modify non mutable RoDataBlock value");
+            }
+
+            bool containsKey(std::string_view key) const override
+            {
+                const int nameId = getNameId(key);
+                return nameId >= 0 && eastl::find(m_keys.begin(), m_keys.end(), nameId) != m_keys.end();
+            }
+
+        private:
+            int getNameId(std::string_view key) const
+            {
+                // the name map lookup requires the null terminated name
+                const eastl::string name{key.data(), key.size()};
+                return key.empty() ? -1 : m_block.getNameId(name.c_str());
+            }
+
+            const RoDataBlockContextPtr m_context;
+            const RoDataBlock& m_block;
+            eastl::vector<int> m_keys;
+        };
+
+        RuntimeValue::Ptr wrapBlock(const RoDataBlockContextPtr& context, const RoDataBlock& block)
+        {
+            if (block.paramCount() > 0 && block.getBool(ArrayMarkerName, false))
+            {
+                return rtti::createInstance<RoDataBlockCollection>(context, block);
+            }
+
+            return rtti::createInstance<RoDataBlockDictionary>(context, block);
+        }
+
+        Result<> addDataBlockValue(DataBlock& blk, const char* name, RuntimeValue& value)
+        {
+            if (auto* const optValue = value.as<RuntimeOptionalValue*>())
+            {
+                return optValue->hasValue() ? addDataBlockValue(blk, name, *optValue->getValue()) : ResultSuccess;
+            }
+            else if (const auto* const intValue = value.as<const RuntimeIntegerValue*>())
+            {
+                const int64_t i = intValue->isSigned() ? intValue->getInt64() : static_cast<int64_t>(intValue->getUint64());
+                if (INT32_MIN <= i && i <= INT32_MAX)
+                {
+                    blk.addInt(name, static_cast<int>(i));
+                }
+                else
+                {
+                    blk.addInt64(name, i);
+                }
+            }
+            else if (const auto* const floatValue = value.as<const RuntimeFloatValue*>())
+            {
+                blk.addReal(name, floatValue->getSingle());
+            }
+            else if (const auto* const boolValue = value.as<const RuntimeBooleanValue*>())
+            {
+                blk.addBool(name, boolValue->getBool());
+            }
+            else if (const auto* const strValue = value.as<const RuntimeStringValue*>())
+            {
+                const std::string str = strValue->getString();
+                blk.addStr(name, str.c_str());
+            }
+            else if (auto* const collection = value.as<RuntimeReadonlyCollection*>())
+            {
+                DataBlock* const arrayBlock = blk.addNewBlock(name);
+                arrayBlock->addBool(ArrayMarkerName, true);
+                for (size_t i = 0, size = collection->getSize(); i < size; ++i)
+                {
+                    if (RuntimeValue::Ptr element = collection->getAt(i))
+                    {
+                        NauCheckResult(addDataBlockValue(*arrayBlock, ArrayItemName, *element));
+                    }
+                }
+            }
+            else if (const auto* const dictionary = value.as<const RuntimeReadonlyDictionary*>())
+            {
+                NauCheckResult(runtimeValueToDataBlock(*dictionary, *blk.addNewBlock(name)));
+            }
+            else
+            {
+                return NauMakeError("The value of ({}) can not be represented with DataBlock", name);
+            }
+
+            return ResultSuccess;
+        }
+    }  // namespace
+
+    Result<RoDataBlockPtr> loadRoDataBlock(io::IStreamReader& stream)
+    {
+        const auto readBytes = [&stream](void* buffer, size_t size) -> Result<>
+        {
+            for (size_t offset = 0; offset < size;)
+            {
+                Result<size_t> readCount = stream.read(reinterpret_cast<std::byte*>(buffer) + offset, size - offset);
+                NauCheckResult(readCount);
+                if (*readCount == 0)
+                {
+                    return NauMakeError("Unexpected end of the RoDataBlock dump");
+                }
+                offset += *readCount;
+            }
+            return ResultSuccess;
+        };
+
+        int size = 0;
+        NauCheckResult(readBytes(&size, sizeof(size)));
+        if (size < static_cast<int>(sizeof(RoDataBlock)))
+        {
+            return NauMakeError("Invalid RoDataBlock dump size ({})", size);
+        }
+
+        void* const mem = getDefaultAllocator()->allocate(static_cast<size_t>(size));
+        RoDataBlockPtr blk{new (mem) RoDataBlock, [](const RoDataBlock* blk)
+        {
+            getDefaultAllocator()->deallocate(const_cast<RoDataBlock*>(blk));
+        }};
+
+        NauCheckResult(readBytes(mem, static_cast<size_t>(size)));
+
+        RoDataBlock* const mutableBlk = const_cast<RoDataBlock*>(blk.get());
+        mutableBlk->patchData(mem);
+        mutableBlk->patchNameMap(mem);
+
+        return blk;
+    }
+
+    RuntimeReadonlyDictionary::Ptr wrapRoDataBlock(RoDataBlockPtr root, const RoDataBlock* block, RoDataBlockStringCallback stringCallback)
+    {
+        NAU_ASSERT(root);
+        if (!root)
+        {
+            return nullptr;
+        }
+
+        const RoDataBlock& thisBlock = block ? *block : *root;
+        auto context = eastl::make_shared<RoDataBlockContext>(RoDataBlockContext{std::move(root), std::move(stringCallback)});
+
+        return rtti::createInstance<RoDataBlockDictionary>(std::move(context), thisBlock);
+    }
+
+    Result<> runtimeValueToDataBlock(const RuntimeReadonlyDictionary& value, DataBlock& blk)
+    {
+        // getValue() is not const: the dictionary is not changed by reading.
+        auto& dictionary = const_cast<RuntimeReadonlyDictionary&>(value);
+
+        for (size_t i = 0, size = dictionary.getSize(); i < size; ++i)
+        {
+            const std::string_view key = dictionary.getKey(i);
+            const std::string name{key};
+            if (RuntimeValue::Ptr fieldValue = dictionary.getValue(key))
+            {
+                NauCheckResult(addDataBlockValue(blk, name.c_str(), *fieldValue));
+            }
+        }
+
+        return ResultSuccess;
+    }
+
+    Result<> saveRoDataBlock(const RuntimeReadonlyDictionary& value, io::IStreamWriter& stream)
+    {
+        DataBlock blk;
+        NauCheckResult(runtimeValueToDataBlock(value, blk));
+
+        iosys::DynamicMemGeneralSaveCB dump(getDefaultAllocator());
+        if (!RoDataBlock::saveDump(blk, dump))
+        {
+            return NauMakeError("Fail to write RoDataBlock dump");
+        }
+
+        NauCheckResult(stream.write(reinterpret_cast<const std::byte*>(dump.data()), static_cast<size_t>(dump.size())));
+        return ResultSuccess;
+    }
+}  // namespace nau
@@ -0,0 +1,402 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "nau/diag/binary_log.h"
+
+#include <EASTL/unordered_map.h>
+#include <EASTL/vector.h>
+
+#include <filesystem>
+#include <mutex>
+
+#include "nau/diag/assertion.h"
+#include "nau/io/file_system.h"
+#include "nau/serialization/binary_serialization.h"
+#include "nau/string/name_id.h"
+#include "nau/string/string_conv.h"
+#include "nau/threading/lock_guard.h"
+
+namespace nau::diag
+{
+    namespace
+    {
+        constexpr uint32_t BinaryLogMagic = 0x474F4C4E;  // 'NLOG'
+        constexpr uint32_t BinaryLogVersion = 1;
+
+        enum class BinaryLogRecord : uint8_t
+        {
+            Site = 1,
+            Tag = 2,
+            Message = 3
+        };
+
+        uint64_t zigZagEncode(int64_t value)
+        {
+            return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+        }
+
+        int64_t zigZagDecode(uint64_t value)
+        {
+            return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+        }
+
+        void writeString(serialization::BinaryWriter& writer, eastl::string_view str)
+        {
+            writer.writeVarUInt(str.size());
+            writer.writeBytes(str.data(), str.size());
+        }
+
+        Result<eastl::string_view> readString(serialization::BinaryReader& reader)
+        {
+            const Result<size_t> size = reader.readCount();
+            NauCheckResult(size);
+
+            const Result<eastl::span<const std::byte>> view = reader.readView(*size);
+            NauCheckResult(view);
+
+            return eastl::string_view{reinterpret_cast<const char*>(view->data()), view->size()};
+        }
+
+        const char* logLevelToString(LogLevel level)
+        {
+            switch (level)
+            {
+                case LogLevel::Debug:
+                    return "Debug";
+                case LogLevel::Info:
+                    return "Info";
+                case LogLevel::Warning:
+                    return "Warning";
+                case LogLevel::Error:
+                    return "Error";
+                case LogLevel::Critical:
+                    return "Critical";
+                case LogLevel::Verbose:
+                    return "Verbose";
+            }
+            return "unknown log level";
+        }
+    }  // namespace
+
+    class BinaryLogSubscriber final : public ILogSubscriber
+    {
+    public:
+        BinaryLogSubscriber(eastl::string_view filePath, BinaryLogOptions options) :
+            m_filePath(filePath),
+            m_options(options)
+        {
+            NAU_ASSERT(m_options.maxFiles > 0);
+            openFile();
+        }
+
+        ~BinaryLogSubscriber() override
+        {
+            lock_(m_mutex);
+            writeBuffer();
+        }
+
+        void processMessage(const LoggerMessage& message) override
+        {
+            lock_(m_mutex);
+
+            serialization::BinaryWriter writer{m_buffer};
+
+            const uint32_t siteId = getSiteId(writer, message.source);
+
+            m_tagIds.clear();
+            for (const eastl::string& tag : message.tags)
+            {
+                m_tagIds.push_back(getTagId(writer, tag));
+            }
+
+            writer.writeRaw(BinaryLogRecord::Message);
+            writer.writeVarUInt(siteId);
+            writer.writeRaw(message.level);
+            writer.writeVarUInt(message.index);
+            writer.writeVarUInt(zigZagEncode(message.time - m_lastTime));
+            writer.writeVarUInt(message.threadId);
+            writer.writeVarUInt(m_tagIds.size());
+            for (const uint32_t tagId : m_tagIds)
+            {
+                writer.writeVarUInt(tagId);
+            }
+            writeString(writer, message.data);
+
+            m_lastTime = message.time;
+
+            if (m_buffer.size() >= m_options.writeBufferSize || getLogLevelSeverity(message.level) >= getLogLevelSeverity(LogLevel::Error))
+            {
+                writeBuffer();
+            }
+        }
+
+    private:
+        uint32_t getSiteId(serialization::BinaryWriter& writer, const SourceInfo& source)
+        {
+            size_t key = NameId::hashName(source.filePath) ^ (NameId::hashName(source.functionName) * 31) ^ (NameId::hashName(source.moduleName) * 17);
+            key ^= static_cast<size_t>(source.line.value_or(0)) << 1;
+
+            auto [iter, emplaced] = m_siteIds.try_emplace(key, static_cast<uint32_t>(m_siteIds.size()));
+            if (emplaced)
+            {
+                writer.writeRaw(BinaryLogRecord::Site);
+                writer.writeVarUInt(iter->second);
+                writeString(writer, source.moduleName);
+                writeString(writer, source.functionName);
+                writeString(writer, source.filePath);
+                writer.writeVarUInt(source.line ? *source.line + 1 : 0);
+            }
+
+            return iter->second;
+        }
+
+        uint32_t getTagId(serialization::BinaryWriter& writer, eastl::string_view tag)
+        {
+            auto [iter, emplaced] = m_tagIdsByHash.try_emplace(NameId::hashName(tag), static_cast<uint32_t>(m_tagIdsByHash.size()));
+            if (emplaced)
+            {
+                writer.writeRaw(BinaryLogRecord::Tag);
+                writer.writeVarUInt(iter->second);
+                writeString(writer, tag);
+            }
+
+            return iter->second;
+        }
+
+        void openFile()
+        {
+            m_stream = io::createNativeFileStream(m_filePath.c_str(), io::AccessMode::Write, io::OpenFileMode::CreateAlways);
+            m_fileSize = 0;
+            m_lastTime = 0;
+            m_siteIds.clear();
+            m_tagIdsByHash.clear();
+
+            serialization::BinaryWriter writer{m_buffer};
+            writer.writeRaw(BinaryLogMagic);
+            writer.writeRaw(BinaryLogVersion);
+        }
+
+        void rotateFiles()
+        {
+            namespace fs = std::filesystem;
+
+            m_stream.reset();
+
+            const auto getRotatedPath = [this](unsigned index)
+            {
+                return fs::path{strings::toStringView(m_filePath)}.concat("." + std::to_string(index));
+            };
+
+            std::error_code ec;
+            if (m_options.maxFiles > 1)
+            {
+                fs::remove(getRotatedPath(m_options.maxFiles - 1), ec);
+                for (unsigned i = m_options.maxFiles - 1; i > 1; --i)
+                {
+                    fs::rename(getRotatedPath(i - 1), getRotatedPath(i), ec);
+                }
+                fs::rename(fs::path{strings::toStringView(m_filePath)}, getRotatedPath(1), ec);
+            }
+
+            openFile();
+        }
+
+        void writeBuffer()
+        {
+            if (m_buffer.size() == 0)
+            {
+                return;
+            }
+
+            if (m_stream)
+            {
+                // logging errors can not be reported through the logger: the data is dropped
+                [[maybe_unused]] const auto result = m_stream->write(m_buffer.data(), m_buffer.size());
+                m_stream->flush();
+                m_fileSize += m_buffer.size();
+            }
+
+            m_buffer.resize(0);
+
+            if (m_fileSize >= m_options.maxFileSize)
+            {
+                rotateFiles();
+            }
+        }
+
+        const eastl::string m_filePath;
+        const BinaryLogOptions m_options;
+        std::mutex m_mutex;
+        io::IStreamWriter::Ptr m_stream;
+        size_t m_fileSize = 0;
+        BytesBuffer m_buffer;
+        int64_t m_lastTime = 0;
+        eastl::unordered_map<size_t, uint32_t> m_siteIds;
+        eastl::unordered_map<size_t, uint32_t> m_tagIdsByHash;
+        eastl::vector<uint32_t> m_tagIds;
+    };
+
+    ILogSubscriber::Ptr createBinaryLogSubscriber(eastl::string_view filePath, BinaryLogOptions options)
+    {
+        return eastl::make_shared<BinaryLogSubscriber>(filePath, options);
+    }
+
+    Result<> decodeBinaryLog(eastl::span<const std::byte> data, const Functor<void(const LoggerMessage&)>& callback)
+    {
+        serialization::BinaryReader reader{data};
+
+        uint32_t magic = 0;
+        uint32_t version = 0;
+        NauCheckResult(reader.readRaw(magic));
+        NauCheckResult(reader.readRaw(version));
+        if (magic != BinaryLogMagic || version != BinaryLogVersion)
+        {
+            return NauMakeError("Not a binary log data (or unsupported version:{})", version);
+        }
+
+        // strings are referenced in place (from the data)
+        eastl::vector<SourceInfo> sites;
+        eastl::vector<eastl::string_view> tags;
+        LoggerMessage message;
+        int64_t time = 0;
+
+        while (reader.getRemainingSize() > 0)
+        {
+            BinaryLogRecord recordType;
+            NauCheckResult(reader.readRaw(recordType));
+
+            if (recordType == BinaryLogRecord::Site)
+            {
+                const Result<uint64_t> siteId = reader.readVarUInt();
+                NauCheckResult(siteId);
+
+                SourceInfo source;
+                Result<eastl::string_view> str = readString(reader);
+                NauCheckResult(str);
+                source.moduleName = *str;
+
+                str = readString(reader);
+                NauCheckResult(str);
+                source.functionName = *str;
+
+                str = readString(reader);
+                NauCheckResult(str);
+                source.filePath = *str;
+
+                const Result<uint64_t> line = reader.readVarUInt();
+                NauCheckResult(line);
+                if (*line != 0)
+                {
+                    source.line = static_cast<unsigned>(*line - 1);
+                }
+
+                if (*siteId != sites.size())
+                {
+                    return NauMakeError("Invalid binary log site id:{}", *siteId);
+                }
+                sites.push_back(source);
+            }
+            else if (recordType == BinaryLogRecord::Tag)
+            {
+                const Result<uint64_t> tagId = reader.readVarUInt();
+                NauCheckResult(tagId);
+
+                const Result<eastl::string_view> tag = readString(reader);
+                NauCheckResult(tag);
+
+                if (*tagId != tags.size())
+                {
+                    return NauMakeError("Invalid binary log tag id:{}", *tagId);
+                }
+                tags.push_back(*tag);
+            }
+            else if (recordType == BinaryLogRecord::Message)
+            {
+                const Result<uint64_t> siteId = reader.readVarUInt();
+                NauCheckResult(siteId);
+                if (*siteId >= sites.size())
+                {
+                    return NauMakeError("Unknown binary log site id:{}", *siteId);
+                }
+
+                NauCheckResult(reader.readRaw(message.level));
+
+                const Result<uint64_t> index = reader.readVarUInt();
+                NauCheckResult(index);
+
+                const Result<uint64_t> timeDelta = reader.readVarUInt();
+                NauCheckResult(timeDelta);
+
+                const Result<uint64_t> threadId = reader.readVarUInt();
+                NauCheckResult(threadId);
+
+                const Result<size_t> tagCount = reader.readCount();
+                NauCheckResult(tagCount);
+
+                message.tags.clear();
+                for (size_t i = 0; i < *tagCount; ++i)
+                {
+                    const Result<uint64_t> tagId = reader.readVarUInt();
+                    NauCheckResult(tagId);
+                    if (*tagId >= tags.size())
+                    {
+                        return NauMakeError("Unknown binary log tag id:{}", *tagId);
+                    }
+                    message.tags.emplace_back(tags[*tagId].data(), tags[*tagId].size());
+                }
+
+                const Result<eastl::string_view> text = readString(reader);
+                NauCheckResult(text);
+
+                time += zigZagDecode(*timeDelta);
+
+                message.index = static_cast<uint32_t>(*index);
+                message.time = time;
+                message.threadId = static_cast<uint32_t>(*threadId);
+                message.source = sites[*siteId];
+                message.data.assign(text->data(), text->size());
+
+                callback(message);
+            }
+            else
+            {
+                return NauMakeError("Unknown binary log record type:{}", static_cast<unsigned>(recordType));
+            }
+        }
+
+        return ResultSuccess;
+    }
+
+    Result<eastl::string> binaryLogToText(eastl::span<const std::byte> data)
+    {
+        eastl::string text;
+
+        NauCheckResult(decodeBinaryLog(data, [&text](const LoggerMessage& message)
+        {
+            eastl::string tags;
+            for (const eastl::string& tag : message.tags)
+            {
+                tags.append(tags.empty() ? "" : ", ").append(tag);
+            }
+
+            char timeString[64] = {};
+            const time_t time = static_cast<time_t>(message.time);
+            strftime(timeString, sizeof(timeString), "%F %H:%M:%S", std::localtime(&time));
+
+            text.append_sprintf("[%u][%s][%s][%s][thread:%u] %.*s(%u): %s\n",
+                                message.index,
+                                timeString,
+                                logLevelToString(message.level),
+                                tags.c_str(),
+                                message.threadId,
+                                static_cast<int>(message.source.filePath.size()),
+                                message.source.filePath.data(),
+                                message.source.line.value_or(0),
+                                message.data.c_str());
+        }));
+
+        return text;
+    }
+
+}  // namespace nau::diag
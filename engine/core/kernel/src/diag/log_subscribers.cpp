@@ -4,7 +4,9 @@
 #include <nau/app/application.h>
 #include <nau/async/task_collection.h>
 
+#include <atomic>
 #include <iostream>
+#include <thread>
 
 // #include "nau/diag/assertion.h"
 #include "file_helper.h"
@@ -191,6 +193,160 @@ namespace nau::diag
         }
     };
 
+    /**
+        Bounded multi-producer queue (sequence per slot) with the single consumer: the dispatcher thread.
+     */
+    class DeferredLogSubscriber final : public ILogSubscriber
+    {
+    public:
+        DeferredLogSubscriber(ILogSubscriber::Ptr subscriber) :
+            m_subscriber(std::move(subscriber)),
+            m_slots(eastl::make_unique<Slot[]>(Capacity))
+        {
+            for (size_t i = 0; i < Capacity; ++i)
+            {
+                m_slots[i].sequence.store(i, std::memory_order_relaxed);
+            }
+
+            m_thread = std::thread([this]
+            {
+                dispatchMessages();
+            });
+        }
+
+        ~DeferredLogSubscriber() override
+        {
+            m_state.fetch_or(StopFlag, std::memory_order_release);
+            m_state.notify_all();
+            m_thread.join();
+        }
+
+        void processMessage(const LoggerMessage& message) override
+        {
+            // Messages logged by the target subscriber itself are processed in place: the dispatcher can not wait for itself.
+            if (std::this_thread::get_id() == m_thread.get_id())
+            {
+                m_subscriber->processMessage(message);
+                return;
+            }
+
+            while (!tryPush(message))
+            {
+                std::this_thread::yield();
+            }
+
+            m_state.fetch_add(1, std::memory_order_release);
+            m_state.notify_all();
+
+            if (getLogLevelSeverity(message.level) >= getLogLevelSeverity(LogLevel::Error))
+            {
+                flush();
+            }
+        }
+
+    private:
+        static constexpr size_t Capacity = 1024;
+        static constexpr uint32_t StopFlag = 1u << 31;
+
+        static_assert((Capacity & (Capacity - 1)) == 0);
+
+        struct Slot
+        {
+            std::atomic<size_t> sequence;
+            LoggerMessage message;
+        };
+
+        bool tryPush(const LoggerMessage& message)
+        {
+            size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                Slot& slot = m_slots[pos & (Capacity - 1)];
+                const size_t sequence = slot.sequence.load(std::memory_order_acquire);
+                const intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+                if (diff == 0)
+                {
+                    if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        slot.message = message;
+                        slot.sequence.store(pos + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    pos = m_enqueuePos.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        bool tryPop(LoggerMessage& message)
+        {
+            Slot& slot = m_slots[m_dequeuePos & (Capacity - 1)];
+            if (slot.sequence.load(std::memory_order_acquire) != m_dequeuePos + 1)
+            {
+                return false;
+            }
+
+            message = std::move(slot.message);
+            slot.sequence.store(m_dequeuePos + Capacity, std::memory_order_release);
+            ++m_dequeuePos;
+            return true;
+        }
+
+        void dispatchMessages()
+        {
+            LoggerMessage message;
+            for (;;)
+            {
+                const uint32_t state = m_state.load(std::memory_order_acquire);
+                if ((state & ~StopFlag) == 0)
+                {
+                    if (state & StopFlag)
+                    {
+                        break;
+                    }
+
+                    m_state.wait(state, std::memory_order_acquire);
+                    continue;
+                }
+
+                // the counter is incremented after the push is completed, so the message is already there
+                while (!tryPop(message))
+                {
+                    std::this_thread::yield();
+                }
+
+                m_subscriber->processMessage(message);
+
+                m_state.fetch_sub(1, std::memory_order_release);
+                m_state.notify_all();
+            }
+        }
+
+        void flush()
+        {
+            uint32_t state = m_state.load(std::memory_order_acquire);
+            while ((state & ~StopFlag) != 0)
+            {
+                m_state.wait(state, std::memory_order_acquire);
+                state = m_state.load(std::memory_order_acquire);
+            }
+        }
+
+        const ILogSubscriber::Ptr m_subscriber;
+        eastl::unique_ptr<Slot[]> m_slots;
+        std::atomic<size_t> m_enqueuePos = 0;
+        size_t m_dequeuePos = 0;
+        // pending messages count and the StopFlag
+        std::atomic<uint32_t> m_state = 0;
+        std::thread m_thread;
+    };
+
     ILogSubscriber::Ptr createConioOutputLogSubscriber()
     {
         return eastl::make_unique<ConioLogSubscriber>();
@@ -200,4 +356,9 @@ namespace nau::diag
     {
         return eastl::make_unique<FileLogSubscriber>(filename);
     }
+
+    ILogSubscriber::Ptr createDeferredLogSubscriber(ILogSubscriber::Ptr subscriber)
+    {
+        return eastl::make_shared<DeferredLogSubscriber>(std::move(subscriber));
+    }
 }  // namespace nau::diag
@@ -10,6 +10,16 @@
 
 namespace nau::diag
 {
+    namespace
+    {
+        uint32_t getLoggingThreadId()
+        {
+            static std::atomic_uint32_t s_threadCounter = 0;
+            static thread_local const uint32_t threadId = s_threadCounter.fetch_add(1, std::memory_order_relaxed) + 1;
+            return threadId;
+        }
+    }  // namespace
+
     class LoggerImpl final : public Logger,
                              public eastl::enable_shared_from_this<LoggerImpl>
     {
@@ -109,7 +119,8 @@ namespace nau::diag
             .level = criticality,
             .tags = std::move(tags),
             .source = sourceInfo,
-            .data = std::move(text)};
+            .data = std::move(text),
+            .threadId = getLoggingThreadId()};
 
         if (recursionCounter > 1)
         {
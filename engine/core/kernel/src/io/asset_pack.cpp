@@ -0,0 +1,170 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "nau/io/asset_pack.h"
+
+#include <EASTL/algorithm.h>
+#include <EASTL/sort.h>
+
+#include "nau/string/string_utils.h"
+#include "nau/utils/mum_hash.h"
+
+namespace nau::io
+{
+    Result<AssetPackBinaryIndex> AssetPackBinaryIndex::open(eastl::span<const std::byte> indexData)
+    {
+        if (indexData.size() < sizeof(AssetPackBinaryIndexHeader))
+        {
+            return NauMakeError("Invalid asset pack index size");
+        }
+
+        const auto& header = *reinterpret_cast<const AssetPackBinaryIndexHeader*>(indexData.data());
+        if (header.magic != AssetPackBinaryIndexHeader::Magic || header.formatVersion != AssetPackBinaryIndexHeader::FormatVersion)
+        {
+            return NauMakeError("Unsupported asset pack index format");
+        }
+
+        const size_t entriesSize = static_cast<size_t>(header.entriesCount) * sizeof(AssetPackBinaryIndexEntry);
+        const size_t dictionariesSize = static_cast<size_t>(header.dictionariesCount) * sizeof(AssetPackBinaryIndexDictionary);
+        if (indexData.size() != sizeof(AssetPackBinaryIndexHeader) + entriesSize + dictionariesSize + header.pathsSize)
+        {
+            return NauMakeError("Invalid asset pack index size");
+        }
+
+        const std::byte* const entries = indexData.data() + sizeof(AssetPackBinaryIndexHeader);
+        const std::byte* const dictionaries = entries + entriesSize;
+
+        AssetPackBinaryIndex index;
+        index.m_entries = {reinterpret_cast<const AssetPackBinaryIndexEntry*>(entries), static_cast<size_t>(header.entriesCount)};
+        index.m_dictionaries = {reinterpret_cast<const AssetPackBinaryIndexDictionary*>(dictionaries), static_cast<size_t>(header.dictionariesCount)};
+        index.m_paths = {reinterpret_cast<const char*>(dictionaries + dictionariesSize), static_cast<size_t>(header.pathsSize)};
+
+        // The entries are not checked there (that requires to touch all index pages): invalid entries are checked on access.
+        return index;
+    }
+
+    eastl::vector<std::byte> AssetPackBinaryIndex::build(eastl::span<const AssetPackFileEntry> entries, eastl::span<const BlobData> dictionaries)
+    {
+        eastl::vector<AssetPackBinaryIndexEntry> indexEntries;
+        indexEntries.reserve(entries.size());
+
+        eastl::string paths;
+        for (const AssetPackFileEntry& entry : entries)
+        {
+            const eastl::string path = normalizeAssetPackPath(entry.filePath);
+
+            AssetPackBinaryIndexEntry& indexEntry = indexEntries.emplace_back();
+            indexEntry.pathHash = getAssetPackPathHash(path);
+            indexEntry.offset = entry.blobData.offset;
+            indexEntry.size = entry.blobData.size;
+            indexEntry.clientSize = entry.clientSize;
+            indexEntry.pathOffset = static_cast<uint32_t>(paths.size());
+            indexEntry.pathLength = static_cast<uint32_t>(path.size());
+            indexEntry.compression = static_cast<uint32_t>(entry.contentCompression == AssetPackZstdCompressionName ? AssetPackCompression::Zstd : AssetPackCompression::None);
+            indexEntry.blockSize = entry.blockSize;
+            indexEntry.dictionaryIndex = entry.dictionaryIndex;
+            indexEntry.reserved = 0;
+
+            paths += path;
+        }
+
+        eastl::sort(indexEntries.begin(), indexEntries.end(), [](const AssetPackBinaryIndexEntry& left, const AssetPackBinaryIndexEntry& right)
+        {
+            return left.pathHash < right.pathHash;
+        });
+
+        const AssetPackBinaryIndexHeader header{
+            .magic = AssetPackBinaryIndexHeader::Magic,
+            .formatVersion = AssetPackBinaryIndexHeader::FormatVersion,
+            .entriesCount = indexEntries.size(),
+            .dictionariesCount = dictionaries.size(),
+            .pathsSize = paths.size()};
+
+        eastl::vector<AssetPackBinaryIndexDictionary> indexDictionaries;
+        indexDictionaries.reserve(dictionaries.size());
+        for (const BlobData& dictionary : dictionaries)
+        {
+            indexDictionaries.push_back({dictionary.offset, dictionary.size});
+        }
+
+        const size_t entriesSize = indexEntries.size() * sizeof(AssetPackBinaryIndexEntry);
+        const size_t dictionariesSize = indexDictionaries.size() * sizeof(AssetPackBinaryIndexDictionary);
+
+        eastl::vector<std::byte> indexData(sizeof(header) + entriesSize + dictionariesSize + paths.size());
+        std::byte* const entriesPtr = indexData.data() + sizeof(header);
+        std::byte* const dictionariesPtr = entriesPtr + entriesSize;
+        std::byte* const pathsPtr = dictionariesPtr + dictionariesSize;
+
+        memcpy(indexData.data(), &header, sizeof(header));
+        memcpy(entriesPtr, indexEntries.data(), entriesSize);
+        memcpy(dictionariesPtr, indexDictionaries.data(), dictionariesSize);
+        memcpy(pathsPtr, paths.data(), paths.size());
+
+        return indexData;
+    }
+
+    const AssetPackBinaryIndexEntry* AssetPackBinaryIndex::find(eastl::string_view normalizedPath) const
+    {
+        const uint64_t pathHash = getAssetPackPathHash(normalizedPath);
+
+        auto iter = eastl::lower_bound(m_entries.begin(), m_entries.end(), pathHash, [](const AssetPackBinaryIndexEntry& entry, uint64_t hash)
+        {
+            return entry.pathHash < hash;
+        });
+
+        // The paths are compared also: different paths can have the same hash.
+        for (; iter != m_entries.end() && iter->pathHash == pathHash; ++iter)
+        {
+            if (getPath(*iter) == normalizedPath)
+            {
+                return iter;
+            }
+        }
+
+        return nullptr;
+    }
+
+    eastl::span<const AssetPackBinaryIndexEntry> AssetPackBinaryIndex::getEntries() const
+    {
+        return m_entries;
+    }
+
+    eastl::span<const AssetPackBinaryIndexDictionary> AssetPackBinaryIndex::getDictionaries() const
+    {
+        return m_dictionaries;
+    }
+
+    eastl::string_view AssetPackBinaryIndex::getPath(const AssetPackBinaryIndexEntry& entry) const
+    {
+        if (m_paths.size() < static_cast<size_t>(entry.pathOffset) + entry.pathLength)
+        {
+            NAU_FAILURE("Invalid asset pack index entry");
+            return {};
+        }
+
+        return m_paths.substr(entry.pathOffset, entry.pathLength);
+    }
+
+    eastl::string normalizeAssetPackPath(eastl::string_view path)
+    {
+        eastl::string result;
+        result.reserve(path.size() + 1);
+
+        for (eastl::string_view element : strings::split(path, eastl::string_view{"/\\"}))
+        {
+            if (!element.empty())
+            {
+                result += "/";
+                result.append(element.data(), element.size());
+            }
+        }
+
+        return result;
+    }
+
+    uint64_t getAssetPackPathHash(eastl::string_view normalizedPath)
+    {
+        return mum_hash(normalizedPath.data(), normalizedPath.size(), 0);
+    }
+}  // namespace nau::io
@@ -0,0 +1,411 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "./asset_pack_file.h"
+
+#include "./asset_pack_file_system.h"
+#include "nau/async/parallel_for.h"
+#include "nau/io/memory_stream.h"
+
+namespace nau::io
+{
+    namespace
+    {
+        size_t getNewStreamPosition(size_t currentPosition, size_t streamSize, OffsetOrigin origin, int64_t offset)
+        {
+            int64_t newPos = offset;
+            const int64_t currentSize = static_cast<int64_t>(streamSize);
+
+            if (origin == OffsetOrigin::Current)
+            {
+                newPos = static_cast<int64_t>(currentPosition) + offset;
+            }
+            else if (origin == OffsetOrigin::End)
+            {
+                newPos = currentSize + offset;
+            }
+#ifdef NAU_ASSERT_ENABLED
+            else
+            {
+                NAU_ASSERT(origin == OffsetOrigin::Begin);
+            }
+#endif
+
+            if (newPos < 0)
+            {
+                newPos = 0;
+            }
+            else if (currentSize < newPos)
+            {
+                newPos = currentSize;
+            }
+
+            NAU_FATAL(newPos >= 0);
+            NAU_FATAL(newPos <= currentSize);
+
+            return static_cast<size_t>(newPos);
+        }
+    }  // namespace
+
+    AssetPackFile::AssetPackFile(AssetPackFileSystemImpl* fileSystem, const AssetPackFileView& view) :
+        m_view(view),
+        m_fileSystemRef(nau::Ptr{fileSystem})
+    {
+        NAU_FATAL(fileSystem);
+        NAU_FATAL(m_fileSystemRef);
+    }
+
+    bool AssetPackFile::supports(FileFeature feature) const
+    {
+        return false;
+    }
+
+    bool AssetPackFile::isOpened() const
+    {
+        return true;
+    }
+
+    IStreamBase::Ptr AssetPackFile::createStream([[maybe_unused]] std::optional<AccessModeFlag> accessMode)
+    {
+        auto fileSystem = m_fileSystemRef.lock();
+        NAU_ASSERT(fileSystem);
+
+        if (m_view.compression == AssetPackCompression::Zstd)
+        {
+            return rtti::createInstance<AssetPackCompressedStream>(fileSystem, m_view);
+        }
+
+        return rtti::createInstance<AssetPackStream>(fileSystem, m_view.offset, m_view.size);
+    }
+
+    size_t AssetPackFile::getSize() const
+    {
+        return m_view.clientSize;
+    }
+
+    FsPath AssetPackFile::getPath() const
+    {
+        return m_vfsPath;
+    }
+
+    async::Task<size_t> AssetPackFile::readAsync(size_t offset, eastl::span<std::byte> buffer)
+    {
+        // The pack is memory mapped: the read is the copy (or the decompression) from the mapped pages,
+        // so it is moved off the calling thread and page faults/decompression are taken by the pool thread.
+        IStreamReader::Ptr stream = createStream(AccessMode::Read);
+        if (!stream)
+        {
+            co_return NauMakeError("Asset pack file system is released");
+        }
+
+        if (offset >= m_view.clientSize || buffer.empty())
+        {
+            co_return 0;
+        }
+
+        ASYNC_SWITCH_EXECUTOR(async::Executor::getDefault());
+
+        stream->setPosition(OffsetOrigin::Begin, static_cast<int64_t>(offset));
+
+        size_t totalRead = 0;
+        while (totalRead < buffer.size())
+        {
+            Result<size_t> readResult = stream->read(buffer.data() + totalRead, buffer.size() - totalRead);
+            if (!readResult)
+            {
+                co_return readResult.getError();
+            }
+
+            if (*readResult == 0)
+            {
+                break;
+            }
+
+            totalRead += *readResult;
+        }
+
+        co_return totalRead;
+    }
+
+    void AssetPackFile::setVfsPath(io::FsPath path)
+    {
+        m_vfsPath = std::move(path);
+    }
+
+    AccessModeFlag AssetPackFile::getAccessMode() const
+    {
+        return AccessMode::Read;
+    }
+
+    AssetPackStream::AssetPackStream(const nau::Ptr<AssetPackFileSystemImpl>& fileSystem, size_t offset, size_t size) :
+        m_fileSystemRef(fileSystem),
+        m_offset(offset),
+        m_size(size)
+    {
+        NAU_FATAL(fileSystem);
+        NAU_FATAL(m_fileSystemRef);
+
+        fileSystem->notifyStreamCreated(m_offset, m_size);
+    }
+
+    AssetPackStream::~AssetPackStream()
+    {
+        if (auto fileSystem = m_fileSystemRef.lock())
+        {
+            fileSystem->notifyStreamRemoved(m_offset, m_size);
+        }
+    }
+
+    size_t AssetPackStream::getPosition() const
+    {
+        return m_selfPosition;
+    }
+
+    size_t AssetPackStream::setPosition(OffsetOrigin origin, int64_t offset)
+    {
+        m_selfPosition = getNewStreamPosition(m_selfPosition, m_size, origin, offset);
+        return m_selfPosition;
+    }
+
+    Result<size_t> AssetPackStream::read(std::byte* buffer, size_t size)
+    {
+        NAU_FATAL(m_selfPosition <= m_size);
+
+        const size_t availableSize = m_size - m_selfPosition;
+        const size_t actualReadCount = std::min(availableSize, size);
+
+        if (actualReadCount == 0)
+        {
+            return 0;
+        }
+
+        size_t alreadyRead = 0;
+        size_t readOffset = m_selfPosition + m_offset;
+        size_t readCount = actualReadCount;
+        size_t writeOffset = 0;
+
+        auto fileSystem = m_fileSystemRef.lock();
+        NAU_FATAL(fileSystem);
+
+        while (alreadyRead < actualReadCount)
+        {
+            const auto& [ptr, availSize] = fileSystem->requestRead(readOffset, readCount);
+            alreadyRead += availSize;
+
+            size_t realRead = std::min(availSize, actualReadCount);
+            memcpy(buffer + writeOffset, reinterpret_cast<std::byte*>(ptr), realRead);
+            writeOffset += realRead;
+            readOffset += realRead;
+            m_selfPosition += realRead;
+            readCount -= realRead;
+        }
+
+        return actualReadCount;
+    }
+
+    eastl::span<const std::byte> AssetPackStream::getContiguousView(size_t count)
+    {
+        NAU_FATAL(m_selfPosition <= m_size);
+
+        const size_t viewSize = std::min(m_size - m_selfPosition, count);
+        if (viewSize == 0)
+        {
+            return {};
+        }
+
+        auto fileSystem = m_fileSystemRef.lock();
+        NAU_FATAL(fileSystem);
+
+        // The view is limited by the mapped pages: the rest of the data is requested by the next call.
+        const auto [ptr, availableSize] = fileSystem->requestRead(m_offset + m_selfPosition, viewSize);
+        const size_t actualSize = std::min(availableSize, viewSize);
+        m_selfPosition += actualSize;
+
+        return {reinterpret_cast<const std::byte*>(ptr), actualSize};
+    }
+
+    AssetPackCompressedStream::AssetPackCompressedStream(const nau::Ptr<AssetPackFileSystemImpl>& fileSystem, const AssetPackFileView& view) :
+        m_view(view),
+        m_fileSystemRef(fileSystem)
+    {
+        NAU_FATAL(fileSystem);
+        NAU_FATAL(m_fileSystemRef);
+
+        fileSystem->notifyStreamCreated(m_view.offset, m_view.size);
+
+        if (m_view.blockSize == 0 || m_view.clientSize == 0)
+        {
+            return;
+        }
+
+        const size_t blocksCount = (m_view.clientSize + m_view.blockSize - 1) / m_view.blockSize;
+        const size_t blockTableSize = blocksCount * sizeof(uint64_t);
+        if (blockTableSize > m_view.size)
+        {
+            return;
+        }
+
+        m_blockEnds.resize(blocksCount);
+        fileSystem->readData(m_view.offset, blockTableSize, reinterpret_cast<std::byte*>(m_blockEnds.data()));
+
+        uint64_t blockBegin = blockTableSize;
+        for (const uint64_t blockEnd : m_blockEnds)
+        {
+            if (blockEnd < blockBegin || m_view.size < blockEnd)
+            {
+                // Invalid entry: all reads will fail.
+                m_blockEnds.clear();
+                break;
+            }
+
+            blockBegin = blockEnd;
+        }
+    }
+
+    AssetPackCompressedStream::~AssetPackCompressedStream()
+    {
+        if (auto fileSystem = m_fileSystemRef.lock())
+        {
+            fileSystem->notifyStreamRemoved(m_view.offset, m_view.size);
+        }
+    }
+
+    size_t AssetPackCompressedStream::getPosition() const
+    {
+        return m_selfPosition;
+    }
+
+    size_t AssetPackCompressedStream::setPosition(OffsetOrigin origin, int64_t offset)
+    {
+        m_selfPosition = getNewStreamPosition(m_selfPosition, m_view.clientSize, origin, offset);
+        return m_selfPosition;
+    }
+
+    Result<size_t> AssetPackCompressedStream::read(std::byte* buffer, size_t size)
+    {
+        NAU_FATAL(m_selfPosition <= m_view.clientSize);
+
+        const size_t actualReadCount = std::min(m_view.clientSize - m_selfPosition, size);
+        if (actualReadCount == 0)
+        {
+            return 0;
+        }
+
+        if (m_blockEnds.empty())
+        {
+            return NauMakeError("Invalid compressed asset pack entry");
+        }
+
+        auto fileSystem = m_fileSystemRef.lock();
+        NAU_FATAL(fileSystem);
+
+        const size_t blockSize = m_view.blockSize;
+        const size_t readBegin = m_selfPosition;
+        const size_t readEnd = readBegin + actualReadCount;
+        const size_t firstBlock = readBegin / blockSize;
+        const size_t lastBlock = (readEnd - 1) / blockSize;
+
+        // [firstWholeBlock, wholeBlocksEnd) - blocks that are entirely covered by the read request.
+        const size_t firstWholeBlock = readBegin % blockSize == 0 ? firstBlock : firstBlock + 1;
+        const size_t wholeBlocksEnd = (readEnd % blockSize == 0 || readEnd == m_view.clientSize) ? lastBlock + 1 : lastBlock;
+
+        if (firstBlock < firstWholeBlock)
+        {
+            NauCheckResult(readFromBlock(*fileSystem, firstBlock, readBegin, readEnd, buffer));
+        }
+
+        if (firstWholeBlock < wholeBlocksEnd)
+        {
+            std::atomic<bool> decompressFailed = false;
+            async::parallelFor(wholeBlocksEnd - firstWholeBlock, 1, [&](size_t index)
+            {
+                const size_t blockIndex = firstWholeBlock + index;
+                if (!decompressBlock(*fileSystem, blockIndex, buffer + (blockIndex * blockSize - readBegin)))
+                {
+                    decompressFailed = true;
+                }
+            });
+
+            if (decompressFailed)
+            {
+                return NauMakeError("Fail to decompress asset pack entry");
+            }
+        }
+
+        // The last block is partially read (and it is not the first block that is already read).
+        if (wholeBlocksEnd <= lastBlock && (lastBlock != firstBlock || firstWholeBlock == firstBlock))
+        {
+            NauCheckResult(readFromBlock(*fileSystem, lastBlock, readBegin, readEnd, buffer));
+        }
+
+        m_selfPosition = readEnd;
+        return actualReadCount;
+    }
+
+    size_t AssetPackCompressedStream::getBlockClientSize(size_t blockIndex) const
+    {
+        const size_t blockBegin = blockIndex * m_view.blockSize;
+        return std::min(m_view.clientSize - blockBegin, static_cast<size_t>(m_view.blockSize));
+    }
+
+    Result<> AssetPackCompressedStream::decompressBlock(AssetPackFileSystemImpl& fileSystem, size_t blockIndex, std::byte* output) const
+    {
+        const size_t blockBegin = blockIndex == 0 ? m_blockEnds.size() * sizeof(uint64_t) : m_blockEnds[blockIndex - 1];
+        const size_t compressedSize = m_blockEnds[blockIndex] - blockBegin;
+        const size_t clientSize = getBlockClientSize(blockIndex);
+
+        // The compressed block is used right from the mapped pages when it does not cross the pages boundary.
+        eastl::vector<std::byte> compressedData;
+        auto [compressedPtr, availableSize] = fileSystem.requestRead(m_view.offset + blockBegin, compressedSize);
+        if (availableSize < compressedSize)
+        {
+            compressedData.resize(compressedSize);
+            fileSystem.readData(m_view.offset + blockBegin, compressedSize, compressedData.data());
+            compressedPtr = compressedData.data();
+        }
+
+        size_t decompressedSize = 0;
+        if (m_view.dictionaryIndex != 0)
+        {
+            const ZSTD_DDict_s* const dictionary = fileSystem.getCompressionDictionary(m_view.dictionaryIndex - 1);
+            if (!dictionary)
+            {
+                return NauMakeError("Invalid compression dictionary ({})", m_view.dictionaryIndex - 1);
+            }
+
+            ZSTD_DCtx_s* const context = iosys::zstd_create_dctx();
+            decompressedSize = iosys::zstd_decompress_with_dict(context, output, clientSize, compressedPtr, compressedSize, dictionary);
+            iosys::zstd_destroy_dctx(context);
+        }
+        else
+        {
+            decompressedSize = iosys::zstd_decompress(output, clientSize, compressedPtr, compressedSize);
+        }
+
+        if (decompressedSize != clientSize)
+        {
+            return NauMakeError("Fail to decompress asset pack block ({})", blockIndex);
+        }
+
+        return ResultSuccess;
+    }
+
+    Result<> AssetPackCompressedStream::readFromBlock(AssetPackFileSystemImpl& fileSystem, size_t blockIndex, size_t readBegin, size_t readEnd, std::byte* output)
+    {
+        if (m_cachedBlockIndex != blockIndex)
+        {
+            m_cachedBlockIndex = NoBlock;
+            m_blockCache.resize(m_view.blockSize);
+            NauCheckResult(decompressBlock(fileSystem, blockIndex, m_blockCache.data()));
+            m_cachedBlockIndex = blockIndex;
+        }
+
+        const size_t blockBegin = blockIndex * m_view.blockSize;
+        const size_t copyBegin = std::max(readBegin, blockBegin);
+        const size_t copyEnd = std::min(readEnd, blockBegin + getBlockClientSize(blockIndex));
+
+        memcpy(output + (copyBegin - readBegin), m_blockCache.data() + (copyBegin - blockBegin), copyEnd - copyBegin);
+        return ResultSuccess;
+    }
+}  // namespace nau::io
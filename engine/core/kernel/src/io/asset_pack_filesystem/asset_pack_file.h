@@ -0,0 +1,126 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include "nau/io/asset_pack.h"
+#include "nau/io/file_system.h"
+#include "nau/io/stream.h"
+#include "nau/rtti/rtti_impl.h"
+#include "nau/rtti/weak_ptr.h"
+
+namespace nau::io
+{
+    class AssetPackFileSystemImpl;
+
+    /**
+        Location of the file within the asset pack.
+     */
+    struct AssetPackFileView
+    {
+        size_t offset = 0;      // Offset of the blob within the pack file.
+        size_t size = 0;        // Size of the blob.
+        size_t clientSize = 0;  // Size of the file without compression.
+        AssetPackCompression compression = AssetPackCompression::None;
+        uint32_t blockSize = 0;
+        uint32_t dictionaryIndex = 0;
+    };
+
+    /**
+     */
+    class AssetPackFile final : public IFile,
+                                public io_detail::IFileInternal
+    {
+        NAU_CLASS_(AssetPackFile, IFile, io_detail::IFileInternal)
+    public:
+        AssetPackFile(const AssetPackFile&) = delete;
+        AssetPackFile(AssetPackFileSystemImpl* fileSystem, const AssetPackFileView& view);
+
+        virtual ~AssetPackFile() = default;
+
+        bool supports(FileFeature) const final;
+
+        bool isOpened() const final;
+
+        IStreamBase::Ptr createStream(std::optional<AccessModeFlag>) final;
+
+        AccessModeFlag getAccessMode() const override;
+
+        size_t getSize() const override;
+
+        FsPath getPath() const override;
+
+        async::Task<size_t> readAsync(size_t offset, eastl::span<std::byte> buffer) override;
+
+        void setVfsPath(io::FsPath path) override;
+
+    private:
+        FsPath m_vfsPath;
+        AssetPackFileView m_view;
+        WeakPtr<AssetPackFileSystemImpl> m_fileSystemRef;
+    };
+
+    /**
+     */
+    class AssetPackStream : public IStreamReader,
+                            public IMemoryMappedStream
+    {
+        NAU_CLASS_(AssetPackStream, IStreamReader, IMemoryMappedStream)
+    public:
+        AssetPackStream(const nau::Ptr<AssetPackFileSystemImpl>& fileSystem, size_t offset, size_t size);
+        ~AssetPackStream();
+
+        size_t getPosition() const override;
+
+        size_t setPosition(OffsetOrigin origin, int64_t offset) override;
+
+        Result<size_t> read(std::byte* buffer, size_t size) override;
+
+        /**
+            The view refers to the mapped pages, which are not released while the stream is alive.
+         */
+        eastl::span<const std::byte> getContiguousView(size_t count) override;
+
+    private:
+        size_t m_offset = 0;
+        size_t m_size = 0;
+        size_t m_selfPosition = 0;
+        WeakPtr<AssetPackFileSystemImpl> m_fileSystemRef;
+    };
+
+    /**
+        Reads the block compressed entry (see AssetPackCompression).
+        The blocks that are entirely covered by the read request are decompressed in parallel directly into the output buffer.
+        The partially read block is kept decompressed, so the small sequential reads do not decompress the same block again.
+     */
+    class AssetPackCompressedStream : public IStreamReader
+    {
+        NAU_CLASS_(AssetPackCompressedStream, IStreamReader)
+    public:
+        AssetPackCompressedStream(const nau::Ptr<AssetPackFileSystemImpl>& fileSystem, const AssetPackFileView& view);
+        ~AssetPackCompressedStream();
+
+        size_t getPosition() const override;
+
+        size_t setPosition(OffsetOrigin origin, int64_t offset) override;
+
+        Result<size_t> read(std::byte* buffer, size_t size) override;
+
+    private:
+        static constexpr size_t NoBlock = ~size_t{0};
+
+        size_t getBlockClientSize(size_t blockIndex) const;
+
+        Result<> decompressBlock(AssetPackFileSystemImpl& fileSystem, size_t blockIndex, std::byte* output) const;
+
+        Result<> readFromBlock(AssetPackFileSystemImpl& fileSystem, size_t blockIndex, size_t readBegin, size_t readEnd, std::byte* output);
+
+        AssetPackFileView m_view;
+        size_t m_selfPosition = 0;
+        eastl::vector<uint64_t> m_blockEnds;
+        eastl::vector<std::byte> m_blockCache;
+        size_t m_cachedBlockIndex = NoBlock;
+        WeakPtr<AssetPackFileSystemImpl> m_fileSystemRef;
+    };
+}  // namespace nau::io
@@ -0,0 +1,54 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <EASTL/string_view.h>
+
+#include "nau/utils/result.h"
+
+namespace nau::io
+{
+    /**
+        Read-only memory mapping of the asset pack file.
+        Implemented per platform (src/platform/<platform>/io/asset_pack_filesystem/asset_pack_file_mapping.cpp).
+     */
+    class AssetPackFileMapping
+    {
+    public:
+        /**
+            Unmaps the view returned by map().
+         */
+        static void unmap(std::byte* ptr, size_t size);
+
+        AssetPackFileMapping() = default;
+        AssetPackFileMapping(const AssetPackFileMapping&) = delete;
+        ~AssetPackFileMapping();
+
+        AssetPackFileMapping& operator=(const AssetPackFileMapping&) = delete;
+
+        Result<> open(eastl::u8string_view filePath);
+
+        bool isOpened() const;
+
+        size_t getFileSize() const;
+
+        size_t getLastWriteTime() const;
+
+        /**
+            Maps the view of the file.
+            @param offset must be aligned to the g_PageAlignment (which is the multiple of the mapping granularity for all platforms).
+            @return pointer to the view or nullptr on failure.
+         */
+        std::byte* map(size_t offset, size_t size) const;
+
+    private:
+        void close();
+
+        uintptr_t m_fileHandle = 0;
+        uintptr_t m_mappingHandle = 0;
+        size_t m_fileSize = 0;
+        size_t m_lastWriteTime = 0;
+    };
+}  // namespace nau::io
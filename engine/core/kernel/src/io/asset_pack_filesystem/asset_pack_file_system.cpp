@@ -14,32 +14,13 @@
 #include "nau/serialization/runtime_value_builder.h"
 #include "nau/utils/preprocessor.h"
 
+#include "nau/diag/logging.h"
 #include "nau/string/string_utils.h"
 
-#include NAU_PLATFORM_HEADER(diag/win_error.h)
-
 namespace nau::io
 {
     namespace
     {
-        eastl::string splitAndMergePath(eastl::string& path)
-        {
-            std::replace(path.begin(), path.end(), '\\', '/');
-
-            eastl::string result;
-
-            for (auto element : strings::split(path, "/"))
-            {
-                if (!element.empty())
-                {
-                    result += "/";
-                    result.append(element.data(), element.size());
-                }
-            }
-
-            return result;
-        }
-
         struct AssetPackDirIteratorData
         {
             AssetPackFileSystemImpl::AssetPackNode* root = nullptr;
@@ -138,71 +119,83 @@ namespace nau::io
     AssetPackFileSystemImpl::AssetPackFileSystemImpl(eastl::u8string_view assetPackPath, AssetPackFileSystemSettings settings) :
         m_lifetimeOfCache(settings.lifetimeOfCache),
         m_maxCacheSize(settings.maxCacheSize),
-        m_assetPackPath(std::move(assetPackPath)),
+        m_assetPackPath(assetPackPath),
         m_root(FsPath(m_assetPackPath).getStem())
     {
-        m_fileHandle = ::CreateFileW(strings::utf8ToWString(m_assetPackPath).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
-        if (m_fileHandle == nullptr)
+        if (Result<> openResult = m_fileMapping.open(m_assetPackPath); !openResult)
         {
-            NauMakeErrorT(diag::WinCodeError)("File handle is NULL.");
-        }
-
-        m_fileSize = GetFileSize(m_fileHandle, nullptr);
-        NAU_VERIFY(m_fileSize != 0);
-
-        m_fileMapHandle = CreateFileMappingA(m_fileHandle, NULL, PAGE_READONLY, 0, 0, NULL);
-        if (m_fileMapHandle == nullptr)
-        {
-            NauMakeErrorT(diag::WinCodeError)("File map handle is NULL.");
+            NAU_LOG_ERROR("Fail to open asset pack: ({})", openResult.getError()->getMessage());
+            return;
         }
 
-        FILETIME fileTimeCreated;
-        GetFileTime(m_fileHandle, &fileTimeCreated, nullptr, nullptr);
-        m_fileTimeCreated = fileTimeCreated.dwHighDateTime;
+        m_fileSize = m_fileMapping.getFileSize();
 
         const auto& [startPtr, size] = requestRead(0, g_PageAlignment);
         NAU_VERIFY(startPtr);
         auto stream = createReadonlyMemoryStream({reinterpret_cast<std::byte*>(startPtr), size});
 
+        auto header = readContainerHeader(stream);
+        if (!header)
+        {
+            NAU_LOG_ERROR("Invalid asset pack header: ({})", header.getError()->getMessage());
+            return;
+        }
+
         RuntimeValue::Ptr packData;
-        size_t headerDataOffset;
-        eastl::tie(packData, headerDataOffset) = *readContainerHeader(stream);
+        eastl::tie(packData, m_headerDataOffset) = *header;
 
         io::AssetPackIndexData packIndexData;
         auto value = nau::makeValueRef(packIndexData);
-        auto res = RuntimeValue::assign(value, packData);
+        RuntimeValue::assign(value, packData).ignore();
 
-        FsPath rootPath(FsPath(m_assetPackPath).getStem());
         size_t fileCount = 0;
-        for (io::AssetPackFileEntry& content : packIndexData.content)
+        if (packIndexData.binaryIndexSize > 0)
         {
-            content.filePath = splitAndMergePath(content.filePath);
+            // The index is mapped for the whole lifetime of the file system and used as is.
+            const size_t indexViewOffset = pageAlignedOffset(m_headerDataOffset);
+            m_indexViewSize = m_headerDataOffset - indexViewOffset + packIndexData.binaryIndexSize;
+            m_indexView = m_headerDataOffset + packIndexData.binaryIndexSize <= m_fileSize ? m_fileMapping.map(indexViewOffset, m_indexViewSize) : nullptr;
+            if (!m_indexView)
+            {
+                NAU_LOG_ERROR("Can not map the asset pack index");
+                return;
+            }
 
-            FsPath contentPath(content.filePath);
-           
-            AssetPackNode* node = &m_root;
-            for (auto name : contentPath.splitElements())
+            Result<AssetPackBinaryIndex> index = AssetPackBinaryIndex::open({m_indexView + (m_headerDataOffset - indexViewOffset), packIndexData.binaryIndexSize});
+            if (!index)
             {
-                auto res = node->getChild(name);
-                node = *res;
+                NAU_LOG_ERROR("Invalid asset pack index: ({})", index.getError()->getMessage());
+                return;
             }
-            NAU_ASSERT(node);
 
-            MapView* view = node->getContent();
-            view->offset = content.blobData.offset + headerDataOffset;
-            view->size = content.blobData.size;
-            fileCount++;
+            m_index = *index;
+            fileCount = m_index.getEntries().size();
+        }
+        else
+        {
+            m_indexData = AssetPackBinaryIndex::build(packIndexData.content, packIndexData.dictionaries);
+            m_index = *AssetPackBinaryIndex::open(m_indexData);
+            fileCount = packIndexData.content.size();
         }
 
         m_memPages.clear();
         m_liveFiles.clear();
-        m_memPageSize = pageAlignedOffset(std::min(((m_fileSize - headerDataOffset) / fileCount) * 2, m_fileSize));
+        if (fileCount > 0)
+        {
+            m_memPageSize = std::max(g_PageAlignment, pageAlignedOffset(std::min(((m_fileSize - m_headerDataOffset) / fileCount) * 2, m_fileSize)));
+        }
     }
 
     AssetPackFileSystemImpl::~AssetPackFileSystemImpl()
     {
-        CloseHandle(m_fileMapHandle);
-        CloseHandle(m_fileHandle);
+        for (ZSTD_DDict_s* dictionary : m_dictionaries)
+        {
+            iosys::zstd_destroy_ddict(dictionary);
+        }
+
+        // The mapped views must be released before the file mapping is closed.
+        m_memPages.clear();
+        AssetPackFileMapping::unmap(m_indexView, m_indexViewSize);
     }
 
     async::Task<> AssetPackFileSystemImpl::disposeAsync()
@@ -217,31 +210,44 @@ namespace nau::io
 
     bool AssetPackFileSystemImpl::exists(const FsPath& path, std::optional<FsEntryKind> kind)
     {
+        if (kind != FsEntryKind::Directory && findIndexEntry(path) != nullptr)
+        {
+            return true;
+        }
+
+        if (kind == FsEntryKind::File)
+        {
+            return false;
+        }
+
         const auto& [basePath, node] = findAssetPackNodeForPath(path);
-        return node != nullptr;
+        return node != nullptr && !node->hasContent();
     }
 
     size_t AssetPackFileSystemImpl::getLastWriteTime(const FsPath&)
     {
-        return m_fileTimeCreated;
+        return m_fileMapping.getLastWriteTime();
     }
 
     IFile::Ptr AssetPackFileSystemImpl::openFile(const FsPath& path, AccessModeFlag accessMode, OpenFileMode openMode)
     {
         NAU_ASSERT((openMode == OpenFileMode::OpenExisting || accessMode && AccessMode::Write), "Specified openMode requires write access also");
 
-        const auto& [basePath, node] = findAssetPackNodeForPath(path);
-        if (!node)
+        const AssetPackBinaryIndexEntry* const entry = findIndexEntry(path);
+        if (!entry || entry->size == 0)
         {
             return nullptr;
         }
 
-        MapView* view = node->getContent();
-        if (view->size == 0)
-        {
-            return nullptr;
-        }
-        return rtti::createInstance<AssetPackFile>(this, view->offset, view->size);
+        const AssetPackFileView view{
+            .offset = m_headerDataOffset + entry->offset,
+            .size = entry->size,
+            .clientSize = entry->clientSize,
+            .compression = static_cast<AssetPackCompression>(entry->compression),
+            .blockSize = entry->blockSize,
+            .dictionaryIndex = entry->dictionaryIndex};
+
+        return rtti::createInstance<AssetPackFile>(this, view);
     }
 
     IFileSystem::OpenDirResult AssetPackFileSystemImpl::openDirIterator(const FsPath& path)
@@ -330,6 +336,50 @@ namespace nau::io
         pendingPagesGC();
     }
 
+    void AssetPackFileSystemImpl::readData(size_t offset, size_t size, std::byte* buffer)
+    {
+        while (size > 0)
+        {
+            const auto [ptr, availableSize] = requestRead(offset, size);
+            NAU_FATAL(availableSize > 0);
+
+            memcpy(buffer, ptr, availableSize);
+            buffer += availableSize;
+            offset += availableSize;
+            size -= availableSize;
+        }
+    }
+
+    const ZSTD_DDict_s* AssetPackFileSystemImpl::getCompressionDictionary(size_t dictionaryIndex)
+    {
+        const eastl::span<const AssetPackBinaryIndexDictionary> dictionaries = m_index.getDictionaries();
+        if (dictionaryIndex >= dictionaries.size())
+        {
+            return nullptr;
+        }
+
+        lock_(m_dictionariesMutex);
+        if (m_dictionaries.empty())
+        {
+            m_dictionaries.resize(dictionaries.size(), nullptr);
+        }
+
+        if (!m_dictionaries[dictionaryIndex])
+        {
+            const AssetPackBinaryIndexDictionary& dictionary = dictionaries[dictionaryIndex];
+            if (m_headerDataOffset + dictionary.offset + dictionary.size > m_fileSize)
+            {
+                return nullptr;
+            }
+
+            eastl::vector<char> dictionaryData(dictionary.size);
+            readData(m_headerDataOffset + dictionary.offset, dictionaryData.size(), reinterpret_cast<std::byte*>(dictionaryData.data()));
+            m_dictionaries[dictionaryIndex] = iosys::zstd_create_ddict(dictionaryData);
+        }
+
+        return m_dictionaries[dictionaryIndex];
+    }
+
     void AssetPackFileSystemImpl::pendingPagesGC()
     {
         if (m_gcIsPending.exchange(true))
@@ -444,10 +494,10 @@ namespace nau::io
             }
 
             const size_t pageSize = (pageOffset + m_memPageSize) <= m_fileSize ? m_memPageSize : (m_fileSize - pageOffset);
-            void* const ptr = ::MapViewOfFile(m_fileMapHandle, FILE_MAP_READ, 0, pageOffset, pageSize);
+            std::byte* const ptr = m_fileMapping.map(pageOffset, pageSize);
             NAU_VERIFY(ptr);
 
-            [[maybe_unused]] const auto [iter, emplaceOk] = m_memPages.emplace(reinterpret_cast<std::byte*>(ptr), pageOffset, pageSize);
+            [[maybe_unused]] const auto [iter, emplaceOk] = m_memPages.emplace(ptr, pageOffset, pageSize);
             NAU_FATAL(emplaceOk);
 
             return *iter;
@@ -461,8 +511,46 @@ namespace nau::io
         return findOrCreateMemPage(offset);
     }
 
+    const AssetPackBinaryIndexEntry* AssetPackFileSystemImpl::findIndexEntry(const FsPath& path) const
+    {
+        return m_index.find(normalizeAssetPackPath(eastl::string_view{path.getCStr()}));
+    }
+
+    void AssetPackFileSystemImpl::buildDirectoryTree()
+    {
+        std::call_once(m_directoryTreeFlag, [this]
+        {
+            for (const AssetPackBinaryIndexEntry& entry : m_index.getEntries())
+            {
+                const eastl::string_view entryPath = m_index.getPath(entry);
+                const FsPath contentPath{entryPath};
+
+                AssetPackNode* node = &m_root;
+                for (auto name : contentPath.splitElements())
+                {
+                    Result<AssetPackNode*> child = node->getChild(name);
+                    if (!child)
+                    {
+                        node = nullptr;
+                        break;
+                    }
+                    node = *child;
+                }
+
+                if (node)
+                {
+                    MapView* view = node->getContent();
+                    view->offset = m_headerDataOffset + entry.offset;
+                    view->size = entry.clientSize;
+                }
+            }
+        });
+    }
+
     eastl::tuple<FsPath, AssetPackFileSystemImpl::AssetPackNode*> AssetPackFileSystemImpl::findAssetPackNodeForPath(const FsPath& path)
     {
+        buildDirectoryTree();
+
         AssetPackNode* node = &m_root;
         FsPath basePath{"/"};
 
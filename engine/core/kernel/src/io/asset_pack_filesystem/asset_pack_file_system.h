@@ -6,7 +6,11 @@
 
 #include <EASTL/functional.h>
 
+#include <mutex>
+
+#include "./asset_pack_file_mapping.h"
 #include "nau/async/task_collection.h"
+#include "nau/dag_ioSys/dag_zstdIo.h"
 #include "nau/io/asset_pack.h"
 #include "nau/io/asset_pack_file_system.h"
 #include "nau/rtti/rtti_impl.h"
@@ -37,7 +41,7 @@ namespace nau::io
         {
             if (m_ptr)
             {
-                UnmapViewOfFile(m_ptr);
+                AssetPackFileMapping::unmap(m_ptr, m_size);
             }
         }
 
@@ -85,6 +89,11 @@ namespace nau::io
 {
 
     /**
+        Files are found by the binary index of the pack (AssetPackBinaryIndex), which is used directly from the mapped view of the pack:
+        the mount does not depend on the number of the files.
+        The directory tree is only built when the directories are queried (openDirIterator, exists).
+        The packs without the binary index (the index is stored in the pack header) are still supported, the binary index is built on mount for them.
+        Compressed entries are read with AssetPackCompressedStream, the compression dictionaries are loaded on first use.
      */
     class AssetPackFileSystemImpl final : public IFileSystem,
                                           public IAsyncDisposable
@@ -95,7 +104,7 @@ namespace nau::io
         struct MapView
         {
             size_t offset = 0;
-            size_t size = 0;
+            size_t size = 0;  // Size of the file without compression.
         };
 
         class AssetPackNode
@@ -160,6 +169,16 @@ namespace nau::io
 
         void notifyStreamRemoved(size_t offset, size_t size);
 
+        /**
+            Copies the data of the pack (which can span multiple mapped pages) into the buffer.
+         */
+        void readData(size_t offset, size_t size, std::byte* buffer);
+
+        /**
+            @return decompression dictionary (created on first request) or nullptr if the pack does not have such dictionary.
+         */
+        const ZSTD_DDict_s* getCompressionDictionary(size_t dictionaryIndex);
+
     private:
         void pendingPagesGC();
 
@@ -182,24 +201,36 @@ namespace nau::io
 
         eastl::tuple<FsPath, AssetPackNode*> findAssetPackNodeForPath(const FsPath& path);
 
-        HANDLE m_fileHandle = nullptr;
-        HANDLE m_fileMapHandle = nullptr;
+        const AssetPackBinaryIndexEntry* findIndexEntry(const FsPath& path) const;
+
+        void buildDirectoryTree();
+
+        AssetPackFileMapping m_fileMapping;
         size_t m_fileSize = 0;
-        size_t m_fileTimeCreated = 0;
+        size_t m_headerDataOffset = 0;
+
+        AssetPackBinaryIndex m_index;
+        std::byte* m_indexView = nullptr;
+        size_t m_indexViewSize = 0;
+        eastl::vector<std::byte> m_indexData;
+
+        eastl::vector<ZSTD_DDict_s*> m_dictionaries;
+        std::mutex m_dictionariesMutex;
 
         Vector<LiveFileEntry> m_liveFiles;
         eastl::unordered_set<MemPages> m_memPages;
 
         size_t m_memPageSize = g_PageAlignment;
         size_t m_maxCacheSize = 0;
-        size_t m_currentCacheSize = 0;
+        std::atomic<size_t> m_currentCacheSize = 0;
 
         std::chrono::seconds m_lifetimeOfCache;
         async::TaskCollection m_taskCollection;
         std::atomic<bool> m_gcIsPending = false;
 
-        const eastl::u8string_view m_assetPackPath;
+        const eastl::u8string m_assetPackPath;
         AssetPackNode m_root;
+        std::once_flag m_directoryTreeFlag;
 
         std::shared_mutex m_mutex;
     };
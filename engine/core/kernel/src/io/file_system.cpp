@@ -0,0 +1,59 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "nau/io/file_system.h"
+
+#include <EASTL/vector.h>
+
+namespace nau::io
+{
+    async::Task<BytesBuffer> readFileContentAsync(IFile::Ptr file)
+    {
+        constexpr size_t ChunkSize = 1024 * 1024;
+
+        NAU_ASSERT(file);
+        if (!file || !file->isOpened())
+        {
+            co_return NauMakeError("File is not opened");
+        }
+
+        const size_t fileSize = file->getSize();
+        BytesBuffer buffer{fileSize};
+        if (fileSize == 0)
+        {
+            co_return buffer;
+        }
+
+        // All chunk requests are in flight at once: the backend completes them in batches.
+        eastl::vector<async::Task<size_t>> readTasks;
+        readTasks.reserve((fileSize + ChunkSize - 1) / ChunkSize);
+
+        for (size_t offset = 0; offset < fileSize; offset += ChunkSize)
+        {
+            const size_t chunkSize = std::min(ChunkSize, fileSize - offset);
+            readTasks.emplace_back(file->readAsync(offset, {buffer.data() + offset, chunkSize}));
+        }
+
+        co_await async::whenAll(readTasks);
+
+        size_t totalRead = 0;
+        for (async::Task<size_t>& readTask : readTasks)
+        {
+            if (readTask.isRejected())
+            {
+                co_return readTask.getError();
+            }
+
+            totalRead += readTask.result();
+        }
+
+        // The file can be truncated while it is read.
+        if (totalRead != fileSize)
+        {
+            co_return NauMakeError("File is changed while it is read");
+        }
+
+        co_return buffer;
+    }
+}  // namespace nau::io
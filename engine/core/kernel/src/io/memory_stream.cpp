@@ -32,6 +32,8 @@ namespace nau::io
 
         eastl::span<const std::byte> getBufferAsSpan(size_t offset, std::optional<size_t> size) const override;
 
+        eastl::span<const std::byte> getContiguousView(size_t count) override;
+
     private:
         BytesBuffer m_buffer;
         size_t m_pos = 0;
@@ -120,6 +122,17 @@ namespace nau::io
     {
     }
 
+    eastl::span<const std::byte> MemoryStream::getContiguousView(size_t count)
+    {
+        NAU_FATAL(m_pos <= m_buffer.size());
+
+        const size_t viewSize = std::min(m_buffer.size() - m_pos, count);
+        const eastl::span<const std::byte> view{m_buffer.data() + m_pos, viewSize};
+        m_pos += viewSize;
+
+        return view;
+    }
+
     eastl::span<const std::byte> MemoryStream::getBufferAsSpan(size_t offset, std::optional<size_t> size) const
     {
         NAU_ASSERT(offset >= 0 && offset <= m_buffer.size(), "Invalid offset");
@@ -151,6 +164,8 @@ namespace nau::io
 
         eastl::span<const std::byte> getBufferAsSpan(size_t offset, std::optional<size_t> size) const override;
 
+        eastl::span<const std::byte> getContiguousView(size_t count) override;
+
     private:
         eastl::span<const std::byte> m_buffer;
         size_t m_pos = 0;
@@ -228,6 +243,17 @@ namespace nau::io
     {
     }
 
+    eastl::span<const std::byte> ReadOnlyMemoryStream::getContiguousView(size_t count)
+    {
+        NAU_FATAL(m_pos <= m_buffer.size());
+
+        const size_t viewSize = std::min(m_buffer.size() - m_pos, count);
+        const eastl::span<const std::byte> view{m_buffer.data() + m_pos, viewSize};
+        m_pos += viewSize;
+
+        return view;
+    }
+
     eastl::span<const std::byte> ReadOnlyMemoryStream::getBufferAsSpan(size_t offset, std::optional<size_t> size) const
     {
         NAU_ASSERT(offset >= 0 && offset <= m_buffer.size(), "Invalid offset");
@@ -99,4 +99,29 @@ namespace nau::io
 
         return totalRead;
     }
+
+    Result<eastl::span<const std::byte>> readStreamView(IStreamReader& src, size_t size, BytesBuffer& storage)
+    {
+        eastl::span<const std::byte> view;
+        if (auto* const mappedStream = src.as<IMemoryMappedStream*>(); mappedStream)
+        {
+            view = mappedStream->getContiguousView(size);
+            if (view.size() == size)
+            {
+                return view;
+            }
+        }
+
+        // The data is not contiguous: the already viewed part and the rest of the data are copied into the storage.
+        storage = BytesBuffer{size};
+        if (!view.empty())
+        {
+            memcpy(storage.data(), view.data(), view.size());
+        }
+
+        const auto readResult = copyFromStream(storage.data() + view.size(), size - view.size(), src);
+        NauCheckResult(readResult);
+
+        return eastl::span<const std::byte>{storage.data(), view.size() + *readResult};
+    }
 }  // namespace nau::io
@@ -4,6 +4,8 @@
 
 #include "./virtual_file_system_impl.h"
 
+#include <EASTL/algorithm.h>
+
 #include "nau/threading/lock_guard.h"
 
 namespace nau::io
@@ -69,6 +71,11 @@ namespace nau::io
             const FsNode* m_current = nullptr;
         };
 
+        size_t getNameHash(std::string_view name)
+        {
+            return std::hash<std::string_view>{}(name);
+        }
+
         class MultiFsDirIteratorImpl final : public DirIteratorImplBase
         {
         public:
@@ -169,19 +176,34 @@ namespace nau::io
         };
     }  // namespace
 
+    VirtualFileSystemImpl::FsNode::FsNode(std::string name) :
+        m_name(std::move(name)),
+        m_nameHash(getNameHash(m_name))
+    {
+    }
+
     std::string_view VirtualFileSystemImpl::FsNode::getName() const
     {
         return m_name;
     }
 
+    eastl::vector<eastl::unique_ptr<VirtualFileSystemImpl::FsNode>>::iterator VirtualFileSystemImpl::FsNode::findChildPosition(std::string_view name, size_t nameHash)
+    {
+        return eastl::lower_bound(m_children.begin(), m_children.end(), name, [nameHash](const eastl::unique_ptr<FsNode>& child, std::string_view name)
+        {
+            return child->m_nameHash != nameHash ? child->m_nameHash < nameHash : child->getName() < name;
+        });
+    }
+
     Result<VirtualFileSystemImpl::FsNode*> VirtualFileSystemImpl::FsNode::getChild(std::string_view name)
     {
         lock_(m_mutex);
 
-        auto iter = findChildIter(name);
-        if(iter != m_children.end())
+        const size_t nameHash = getNameHash(name);
+        auto iter = findChildPosition(name, nameHash);
+        if(iter != m_children.end() && (*iter)->getName() == name)
         {
-            return &(*iter);
+            return iter->get();
         }
 
         NAU_ASSERT(m_mountedFs.empty());
@@ -190,18 +212,18 @@ namespace nau::io
             return NauMakeError("Already has mounted fs");
         }
 
-        m_children.emplace_back(std::string{name});
+        iter = m_children.insert(iter, eastl::make_unique<FsNode>(std::string{name}));
 
-        return &m_children.back();
+        return iter->get();
     }
 
     VirtualFileSystemImpl::FsNode* VirtualFileSystemImpl::FsNode::findChild(std::string_view name)
     {
         lock_(m_mutex);
 
-        auto iter = findChildIter(name);
+        auto iter = findChildPosition(name, getNameHash(name));
 
-        return iter != m_children.end() ? &(*iter) : nullptr;
+        return iter != m_children.end() && (*iter)->getName() == name ? iter->get() : nullptr;
     }
 
     VirtualFileSystemImpl::FsNode* VirtualFileSystemImpl::FsNode::getNextChild(const FsNode* current)
@@ -209,21 +231,17 @@ namespace nau::io
         lock_(m_mutex);
         if(current == nullptr)
         {
-            return !m_children.empty() ? &m_children.front() : nullptr;
+            return !m_children.empty() ? m_children.front().get() : nullptr;
         }
 
-        auto nextChild = m_children.end();
-
-        for(auto iter = m_children.begin(); iter != m_children.end(); ++iter)
+        auto iter = findChildPosition(current->getName(), current->m_nameHash);
+        if(iter == m_children.end() || iter->get() != current)
         {
-            if(&(*iter) == current)
-            {
-                nextChild = ++iter;
-                break;
-            }
+            return nullptr;
         }
 
-        return nextChild != m_children.end() ? &(*nextChild) : nullptr;
+        ++iter;
+        return iter != m_children.end() ? iter->get() : nullptr;
     }
 
     IFileSystem::Ptr VirtualFileSystemImpl::FsNode::getNextMountedFs(IFileSystem* current)
@@ -248,7 +266,7 @@ namespace nau::io
         return nextFs != m_mountedFs.end() ? nextFs->fs : nullptr;
     }
 
-    Result<> VirtualFileSystemImpl::FsNode::mount(IFileSystem::Ptr&& fileSystem, unsigned priority)
+    Result<> VirtualFileSystemImpl::FsNode::mount(IFileSystem::Ptr&& fileSystem, unsigned priority, MountTrust trust)
     {
         lock_(m_mutex);
         NAU_ASSERT(m_children.empty());
@@ -271,11 +289,28 @@ namespace nau::io
             }
         }
 
-        m_mountedFs.emplace_back(std::move(fileSystem), priority);
+        m_mountedFs.emplace_back(std::move(fileSystem), priority, trust);
         return {};
     }
-    void VirtualFileSystemImpl::FsNode::unmount(const IFileSystem::Ptr&)
+    bool VirtualFileSystemImpl::FsNode::unmount(const IFileSystem::Ptr& fileSystem)
     {
+        lock_(m_mutex);
+
+        bool unmounted = false;
+        for(auto& child : m_children)
+        {
+            unmounted = child->unmount(fileSystem) || unmounted;
+        }
+
+        auto iter = eastl::remove_if(m_mountedFs.begin(), m_mountedFs.end(), [&fileSystem](const FileSystemEntry& entry)
+        {
+            return entry.fs.get() == fileSystem.get();
+        });
+
+        unmounted = unmounted || iter != m_mountedFs.end();
+        m_mountedFs.erase(iter, m_mountedFs.end());
+
+        return unmounted;
     }
 
     eastl::vector<VirtualFileSystemImpl::FileSystemEntry> VirtualFileSystemImpl::FsNode::getMountedFs()
@@ -290,6 +325,86 @@ namespace nau::io
         return !m_mountedFs.empty();
     }
 
+    VirtualFileSystemImpl::PathCache::PathCache()
+    {
+        for(auto& slot : m_slots)
+        {
+            slot.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    VirtualFileSystemImpl::PathCache::~PathCache()
+    {
+        for(auto& slot : m_slots)
+        {
+            delete slot.load(std::memory_order_relaxed);
+        }
+
+        for(const Entry* entry : m_retiredEntries)
+        {
+            delete entry;
+        }
+    }
+
+    uint32_t VirtualFileSystemImpl::PathCache::getGeneration() const
+    {
+        return m_generation.load(std::memory_order_acquire);
+    }
+
+    const VirtualFileSystemImpl::PathCache::Entry* VirtualFileSystemImpl::PathCache::find(std::string_view path, size_t pathHash) const
+    {
+        const Entry* const entry = m_slots[pathHash % SlotsCount].load(std::memory_order_acquire);
+        if(!entry || entry->generation != getGeneration() || entry->pathHash != pathHash || entry->path != path)
+        {
+            return nullptr;
+        }
+
+        return entry;
+    }
+
+    void VirtualFileSystemImpl::PathCache::insert(std::string_view path, size_t pathHash, uint32_t generation, const FsPath& basePath, FsNode* node)
+    {
+        std::atomic<const Entry*>& slot = m_slots[pathHash % SlotsCount];
+
+        // The slot that is taken by the actual entry is not replaced: the colliding path is resolved without the cache.
+        const Entry* current = slot.load(std::memory_order_acquire);
+        if(current && current->generation == getGeneration())
+        {
+            return;
+        }
+
+        const Entry* const entry = new Entry{std::string{path}, pathHash, generation, basePath, node};
+        if(!slot.compare_exchange_strong(current, entry, std::memory_order_acq_rel))
+        {
+            delete entry;
+            return;
+        }
+
+        if(current)
+        {
+            retire(current);
+        }
+    }
+
+    void VirtualFileSystemImpl::PathCache::invalidate()
+    {
+        m_generation.fetch_add(1, std::memory_order_acq_rel);
+
+        for(auto& slot : m_slots)
+        {
+            if(const Entry* const entry = slot.exchange(nullptr, std::memory_order_acq_rel))
+            {
+                retire(entry);
+            }
+        }
+    }
+
+    void VirtualFileSystemImpl::PathCache::retire(const Entry* entry)
+    {
+        lock_(m_retiredEntriesMutex);
+        m_retiredEntries.push_back(entry);
+    }
+
     VirtualFileSystemImpl::VirtualFileSystemImpl() :
         m_root("")
     {
@@ -440,7 +555,7 @@ namespace nau::io
         return {};
     }
 
-    Result<> VirtualFileSystemImpl::mount(const FsPath& path, IFileSystem::Ptr fileSystem, unsigned priority)
+    Result<> VirtualFileSystemImpl::mount(const FsPath& path, IFileSystem::Ptr fileSystem, unsigned priority, MountTrust trust)
     {
         FsNode* fsNode = &m_root;
 
@@ -452,11 +567,45 @@ namespace nau::io
             NAU_ASSERT(fsNode);
         }
 
-        return fsNode->mount(std::move(fileSystem), priority);
+        NauCheckResult(fsNode->mount(std::move(fileSystem), priority, trust));
+
+        m_pathCache.invalidate();
+        return ResultSuccess;
     }
 
-    void VirtualFileSystemImpl::unmount(IFileSystem::Ptr)
+    void VirtualFileSystemImpl::unmount(IFileSystem::Ptr fileSystem)
     {
+        if(!fileSystem)
+        {
+            return;
+        }
+
+        // Nodes are kept after unmount: they can be referenced by the opened directory iterators.
+        if(m_root.unmount(fileSystem))
+        {
+            m_pathCache.invalidate();
+        }
+    }
+
+    bool VirtualFileSystemImpl::isTrustedFile(const FsPath& path)
+    {
+        auto [basePath, fsNode] = findFsNodeForPath(path);
+        if(!fsNode)
+        {
+            return false;
+        }
+
+        // Same lookup order as openFile: the file is trusted only if the mount that actually serves it is trusted.
+        const auto relativePath = path.getRelativePath(basePath);
+        for(const auto& mountedFs : fsNode->getMountedFs())
+        {
+            if(mountedFs.fs->exists(relativePath, FsEntryKind::File))
+            {
+                return mountedFs.trust == MountTrust::Trusted;
+            }
+        }
+
+        return false;
     }
 
     std::wstring VirtualFileSystemImpl::resolveToNativePath(const FsPath& path)
@@ -477,6 +626,24 @@ namespace nau::io
     }
 
     std::tuple<FsPath, VirtualFileSystemImpl::FsNode*> VirtualFileSystemImpl::findFsNodeForPath(const FsPath& path)
+    {
+        const std::string_view pathString = path.getCStr();
+        const size_t pathHash = path.getHashCode();
+
+        if(const PathCache::Entry* const entry = m_pathCache.find(pathString, pathHash))
+        {
+            return std::tuple{entry->basePath, entry->node};
+        }
+
+        // Generation is taken before resolving: the result is not cached if the mounts are changed meanwhile.
+        const uint32_t generation = m_pathCache.getGeneration();
+        auto [basePath, fsNode] = resolveFsNodeForPath(path);
+        m_pathCache.insert(pathString, pathHash, generation, basePath, fsNode);
+
+        return std::tuple{std::move(basePath), fsNode};
+    }
+
+    std::tuple<FsPath, VirtualFileSystemImpl::FsNode*> VirtualFileSystemImpl::resolveFsNodeForPath(const FsPath& path)
     {
         FsNode* fsNode = &m_root;
         FsPath basePath{"/"};
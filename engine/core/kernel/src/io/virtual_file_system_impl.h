@@ -2,6 +2,11 @@
 // Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
 
 
+#include <EASTL/array.h>
+#include <EASTL/unique_ptr.h>
+
+#include <mutex>
+
 #include "nau/io/virtual_file_system.h"
 #include "nau/rtti/rtti_impl.h"
 #include "nau/threading/spin_lock.h"
@@ -18,14 +23,14 @@ namespace nau::io
         {
             IFileSystem::Ptr fs;
             unsigned priority;
+            MountTrust trust;
         };
 
     public:
         class FsNode
         {
         public:
-            FsNode(std::string name): m_name(std::move(name))
-            {}
+            FsNode(std::string name);
 
             FsNode(const FsNode&) = delete;
 
@@ -39,31 +44,75 @@ namespace nau::io
 
             IFileSystem::Ptr getNextMountedFs(IFileSystem* current = nullptr);
 
-            Result<> mount(IFileSystem::Ptr&&, unsigned priority);
+            Result<> mount(IFileSystem::Ptr&&, unsigned priority, MountTrust trust);
 
-            void unmount(const IFileSystem::Ptr&);
+            /**
+                Unmounts the file system from this node and all child nodes.
+                @return true if the file system was mounted.
+             */
+            bool unmount(const IFileSystem::Ptr&);
 
             eastl::vector<FileSystemEntry> getMountedFs();
 
             bool hasMounts();
 
         private:
-            
-            decltype(auto) findChildIter(std::string_view name)
-            {
-                return std::find_if(m_children.begin(), m_children.end(), [name](const FsNode& c)
-                    {
-                        return c.m_name == name;
-                    });
-            }
-
+            /**
+                Children are sorted by (name hash, name).
+             */
+            eastl::vector<eastl::unique_ptr<FsNode>>::iterator findChildPosition(std::string_view name, size_t nameHash);
 
             const std::string m_name;
-            eastl::list<FsNode> m_children;
+            const size_t m_nameHash;
+            eastl::vector<eastl::unique_ptr<FsNode>> m_children;
             eastl::vector<FileSystemEntry> m_mountedFs;
             threading::SpinLock m_mutex;
         };
 
+        /**
+            Cache of the resolved paths: full path -> (mount point path, mount point node).
+            Lookups are lock-free: slots are atomic pointers to the immutable entries.
+            The cache is invalidated (by the generation) on mount/unmount. The replaced entries can still be read by the concurrent lookups,
+            so they are only deleted with the cache (mount/unmount are rare: at most SlotsCount entries are retired per invalidation).
+         */
+        class PathCache
+        {
+        public:
+            static constexpr size_t SlotsCount = 4096;
+
+            struct Entry
+            {
+                std::string path;
+                size_t pathHash;
+                uint32_t generation;
+                FsPath basePath;
+                FsNode* node;
+            };
+
+            PathCache();
+            PathCache(const PathCache&) = delete;
+            ~PathCache();
+
+            uint32_t getGeneration() const;
+
+            const Entry* find(std::string_view path, size_t pathHash) const;
+
+            /**
+                @param generation generation that was current before the path was resolved.
+             */
+            void insert(std::string_view path, size_t pathHash, uint32_t generation, const FsPath& basePath, FsNode* node);
+
+            void invalidate();
+
+        private:
+            void retire(const Entry* entry);
+
+            eastl::array<std::atomic<const Entry*>, SlotsCount> m_slots;
+            std::atomic<uint32_t> m_generation = 0;
+            eastl::vector<const Entry*> m_retiredEntries;
+            std::mutex m_retiredEntriesMutex;
+        };
+
         VirtualFileSystemImpl();
 
         bool isReadOnly() const override;
@@ -84,10 +133,12 @@ namespace nau::io
 
         Result<> remove(const FsPath&, bool recursive = false) override;
 
-        Result<> mount(const FsPath&, IFileSystem::Ptr, unsigned priority) override;
+        Result<> mount(const FsPath&, IFileSystem::Ptr, unsigned priority, MountTrust trust) override;
 
         void unmount(IFileSystem::Ptr) override;
 
+        bool isTrustedFile(const FsPath& path) override;
+
         std::wstring resolveToNativePath(const FsPath& path) override;
 
     private:
@@ -95,7 +146,10 @@ namespace nau::io
 
         std::tuple<FsPath, FsNode*> findFsNodeForPath(const FsPath& path);
 
+        std::tuple<FsPath, FsNode*> resolveFsNodeForPath(const FsPath& path);
+
         FsNode m_root;
+        PathCache m_pathCache;
 
     };
 }  // namespace nau::io
\ No newline at end of file
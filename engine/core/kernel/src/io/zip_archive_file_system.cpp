@@ -2,380 +2,724 @@
 // Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
 
 
+#include <zlib.h>
+
+#include <EASTL/sort.h>
+#include <EASTL/unique_ptr.h>
+#include <EASTL/unordered_map.h>
+
+#include <algorithm>
+#include <initializer_list>
+#include <mutex>
+
+#include "./asset_pack_filesystem/asset_pack_file_mapping.h"
+#include "nau/diag/logging.h"
 #include "nau/io/file_system.h"
+#include "nau/io/memory_stream.h"
 #include "nau/rtti/rtti_impl.h"
+#include "nau/string/string_utils.h"
+#include "nau/threading/lock_guard.h"
+#include "nau/utils/mum_hash.h"
 #include "nau/utils/scope_guard.h"
 
-#if 0
-
 namespace nau::io
 {
+    namespace
+    {
+        // Zip format records (APPNOTE.TXT). All values are little endian.
+        constexpr uint32_t LocalFileHeaderSignature = 0x04034b50;
+        constexpr uint32_t CentralDirectoryHeaderSignature = 0x02014b50;
+        constexpr uint32_t EndOfCentralDirectorySignature = 0x06054b50;
+        constexpr uint32_t Zip64EndOfCentralDirectorySignature = 0x06064b50;
+        constexpr uint32_t Zip64EndOfCentralDirectoryLocatorSignature = 0x07064b50;
+
+        constexpr size_t LocalFileHeaderSize = 30;
+        constexpr size_t CentralDirectoryHeaderSize = 46;
+        constexpr size_t EndOfCentralDirectorySize = 22;
+        constexpr size_t Zip64EndOfCentralDirectorySize = 56;
+        constexpr size_t Zip64EndOfCentralDirectoryLocatorSize = 20;
+        constexpr size_t MaxCommentSize = 0xFFFF;
+
+        constexpr uint16_t Zip64ExtraFieldId = 0x0001;
+        constexpr uint16_t EncryptedEntryFlag = 0x0001;
+
+        constexpr uint16_t StoredMethod = 0;
+        constexpr uint16_t DeflatedMethod = 8;
+
+        template <typename T>
+        T readValue(const std::byte* ptr)
+        {
+            T value;
+            memcpy(&value, ptr, sizeof(T));
+            return value;
+        }
+
+        /**
+            Archive path without the leading/trailing separators: "textures/file.png" (the root is the empty string).
+         */
+        eastl::string normalizeArchivePath(eastl::string_view path)
+        {
+            eastl::string result;
+            result.reserve(path.size());
+
+            for (eastl::string_view element : strings::split(path, eastl::string_view{"/\\"}))
+            {
+                if (!element.empty())
+                {
+                    if (!result.empty())
+                    {
+                        result += "/";
+                    }
+                    result.append(element.data(), element.size());
+                }
+            }
+
+            return result;
+        }
+
+        uint64_t getArchivePathHash(eastl::string_view normalizedPath)
+        {
+            return mum_hash(normalizedPath.data(), normalizedPath.size(), 0);
+        }
+
+        eastl::string_view getParentArchivePath(eastl::string_view path)
+        {
+            const size_t pos = path.rfind('/');
+            return pos == eastl::string_view::npos ? eastl::string_view{} : path.substr(0, pos);
+        }
+
+        eastl::string_view getArchivePathName(eastl::string_view path)
+        {
+            const size_t pos = path.rfind('/');
+            return pos == eastl::string_view::npos ? path : path.substr(pos + 1);
+        }
+    }  // namespace
+
+    /**
+        Inflate state of the deflated entry, kept between the reads: the read that continues the previous one resumes the stream,
+        so the chunked sequential reading of the entry is linear. Only the read behind the current position restarts the stream.
+     */
+    class ZipInflateCursor
+    {
+    public:
+        ZipInflateCursor(eastl::span<const std::byte> compressedData) :
+            m_compressedData(compressedData)
+        {
+        }
+
+        ZipInflateCursor(const ZipInflateCursor&) = delete;
+
+        ~ZipInflateCursor()
+        {
+            if (m_isInitialized)
+            {
+                inflateEnd(&m_stream);
+            }
+        }
+
+        ZipInflateCursor& operator=(const ZipInflateCursor&) = delete;
+
+        /**
+            Inflates the entry data from the offset directly into the output buffer.
+         */
+        Result<size_t> read(size_t offset, eastl::span<std::byte> output)
+        {
+            if (!m_isInitialized || offset < m_position)
+            {
+                NauCheckResult(restart());
+            }
+
+            // The deflate stream can not be started from the middle: the data before the offset is inflated and dropped.
+            if (m_position < offset)
+            {
+                constexpr size_t SkipBufferSize = 16 * 1024;
+                std::byte skipBuffer[SkipBufferSize];
+
+                while (m_position < offset)
+                {
+                    Result<size_t> skipResult = inflateNext({skipBuffer, std::min(SkipBufferSize, offset - m_position)});
+                    NauCheckResult(skipResult);
+                    if (*skipResult == 0)
+                    {
+                        return 0;
+                    }
+                }
+            }
+
+            return inflateNext(output);
+        }
+
+    private:
+        Result<> restart()
+        {
+            const int code = m_isInitialized ? inflateReset(&m_stream) : inflateInit2(&m_stream, -MAX_WBITS);
+            if (code != Z_OK)
+            {
+                return NauMakeError("Fail to initialize inflate");
+            }
+
+            m_isInitialized = true;
+            m_isFinished = false;
+            m_inputOffset = 0;
+            m_position = 0;
+            m_stream.avail_in = 0;
+
+            return ResultSuccess;
+        }
+
+        Result<size_t> inflateNext(eastl::span<std::byte> output)
+        {
+            constexpr size_t MaxChunkSize = std::numeric_limits<uInt>::max();
+
+            size_t outputOffset = 0;
+            while (outputOffset < output.size() && !m_isFinished)
+            {
+                if (m_stream.avail_in == 0 && m_inputOffset < m_compressedData.size())
+                {
+                    const size_t chunkSize = std::min(m_compressedData.size() - m_inputOffset, MaxChunkSize);
+                    m_stream.next_in = reinterpret_cast<Bytef*>(const_cast<std::byte*>(m_compressedData.data() + m_inputOffset));
+                    m_stream.avail_in = static_cast<uInt>(chunkSize);
+                    m_inputOffset += chunkSize;
+                }
+
+                const size_t chunkSize = std::min(output.size() - outputOffset, MaxChunkSize);
+                m_stream.next_out = reinterpret_cast<Bytef*>(output.data() + outputOffset);
+                m_stream.avail_out = static_cast<uInt>(chunkSize);
+
+                const int code = inflate(&m_stream, Z_NO_FLUSH);
+                outputOffset += chunkSize - m_stream.avail_out;
+
+                if (code == Z_STREAM_END)
+                {
+                    m_isFinished = true;
+                }
+                else if (code == Z_BUF_ERROR && m_stream.avail_in == 0 && m_inputOffset == m_compressedData.size())
+                {
+                    m_isInitialized = false;
+                    inflateEnd(&m_stream);
+                    return NauMakeError("Zip entry data is truncated");
+                }
+                else if (code != Z_OK && code != Z_BUF_ERROR)
+                {
+                    m_isInitialized = false;
+                    inflateEnd(&m_stream);
+                    return NauMakeError("Fail to inflate zip entry ({})", code);
+                }
+            }
+
+            m_position += outputOffset;
+            return outputOffset;
+        }
+
+        const eastl::span<const std::byte> m_compressedData;
+        z_stream m_stream{};
+        size_t m_inputOffset = 0;
+        size_t m_position = 0;
+        bool m_isInitialized = false;
+        bool m_isFinished = false;
+    };
+
+    /**
+        The archive is memory mapped (or read into memory when it is opened from the stream) for the whole lifetime of the file system.
+        The central directory is indexed once on mount (entries are sorted by the path hash), the directory tree is built from the same index.
+        Stored entries are served directly from the archive memory; deflated entries are inflated with zlib(-ng) straight into the client buffer.
+        The index is immutable after mount: different entries (and the same entry) can be extracted concurrently, without any lock.
+        The opened file of the deflated entry keeps its inflate cursor (the reads of the same file object are serialized by the file).
+     */
     class ZipArchiveFileSystem final : public IFileSystem
     {
         NAU_CLASS_(nau::io::ZipArchiveFileSystem, IFileSystem)
 
     public:
-        ZipArchiveFileSystem(IStreamReader::Ptr);
+        struct ZipEntry
+        {
+            uint64_t pathHash = 0;
+            eastl::string path;
+            size_t localHeaderOffset = 0;
+            size_t compressedSize = 0;
+            size_t size = 0;
+            size_t lastWriteTime = 0;
+            uint16_t method = StoredMethod;
+            uint16_t flags = 0;
+        };
+
+        struct ZipEntryView
+        {
+            eastl::span<const std::byte> data;
+            size_t size = 0;
+            uint16_t method = StoredMethod;
+        };
+
+        ZipArchiveFileSystem(eastl::u8string_view archivePath);
+        ZipArchiveFileSystem(IStreamReader::Ptr stream);
         ~ZipArchiveFileSystem();
 
+        Result<> readCentralDirectory();
+
         bool isReadOnly() const override;
+
         bool exists(const FsPath&, std::optional<FsEntryKind>) override;
+
         size_t getLastWriteTime(const FsPath&) override;
+
         IFile::Ptr openFile(const FsPath&, AccessModeFlag accessMode, OpenFileMode openMode) override;
 
         OpenDirResult openDirIterator(const FsPath& path) override;
+
         void closeDirIterator(void*) override;
+
         FsEntry incrementDirIterator(void*) override;
 
+        /**
+            Reads the entry (only the part up to the end of the buffer) into the buffer.
+            The deflated entry is read through the cursor (the temporary one if nullptr): the read that continues the previous one
+            does not inflate the entry from the beginning.
+         */
+        static Result<size_t> readEntry(const ZipEntryView& entry, size_t offset, eastl::span<std::byte> buffer, ZipInflateCursor* cursor = nullptr);
+
     private:
-        struct ZipFsEntry : io::FsEntry
+        struct ZipDirectoryChild
         {
-            ::unz64_file_pos zipPos;
-            std::vector<std::byte> buffer;
+            eastl::string_view name;
+            const ZipEntry* file = nullptr;  // nullptr for the subdirectory.
+        };
+
+        struct ZipDirectory
+        {
+            eastl::vector<ZipDirectoryChild> children;
         };
 
         struct DirIteratorState
         {
-            const std::vector<const ZipFsEntry*> entries;
-            const FsPath path;
+            const ZipDirectory* directory = nullptr;
             size_t currentIndex = 0;
+            FsPath basePath;
+        };
 
+        const ZipEntry* findEntry(eastl::string_view normalizedPath) const;
 
-            DirIteratorState(std::vector<const ZipFsEntry*>&& inEntries, FsPath inPath) :
-                entries(std::move(inEntries)),
-                path(std::move(inPath))
-            {}
+        const ZipDirectory* findDirectory(const eastl::string& normalizedPath) const;
 
-            FsEntry getCurrentFsEntry() const
-            {
-                if (entries.size() <= currentIndex)
-                {
-                    return {};
-                }
+        ZipDirectory& addDirectory(eastl::string_view normalizedPath);
 
-                const ZipFsEntry& zipEntry = *entries[currentIndex];
+        FsEntry getDirIteratorEntry(const DirIteratorState& state) const;
 
-                //FsEntry entry = zipEntry;
-                //entry.path = path / zipEntry.path;
+        AssetPackFileMapping m_fileMapping;
+        std::byte* m_mappedView = nullptr;
+        BytesBuffer m_archiveBuffer;
+        eastl::span<const std::byte> m_archiveData;
 
-                return zipEntry;
-            }
-        };
+        eastl::vector<ZipEntry> m_entries;
+        eastl::unordered_map<eastl::string, ZipDirectory> m_directories;
+        size_t m_lastWriteTime = 0;
+    };
 
+    /**
+        Zero-copy stream over the stored (uncompressed) entry: keeps the archive (its memory) alive.
+     */
+    class ZipStoredEntryStream final : public IStreamReader,
+                                       public IMemoryMappedStream
+    {
+        NAU_CLASS_(nau::io::ZipStoredEntryStream, IStreamReader, IMemoryMappedStream)
 
-        static void* zipOpen(void* opaque, const void*, int mode) noexcept
+    public:
+        ZipStoredEntryStream(nau::Ptr<ZipArchiveFileSystem> fileSystem, eastl::span<const std::byte> data) :
+            m_fileSystem(std::move(fileSystem)),
+            m_data(data)
         {
-            NAU_ASSERT(opaque);
-            auto& self = *reinterpret_cast<ZipArchiveFileSystem*>(opaque);
+        }
 
-            NAU_ASSERT(self.m_stream);
-            return self.m_stream.get();
+        size_t getPosition() const override
+        {
+            return m_position;
         }
 
-        static int zipClose([[maybe_unused]] void* opaque, [[maybe_unused]] void* streamPtr) noexcept
+        size_t setPosition(OffsetOrigin origin, int64_t offset) override
         {
-            NAU_ASSERT(opaque);
-            NAU_ASSERT(streamPtr);
+            int64_t newPosition = offset;
+            if (origin == OffsetOrigin::Current)
+            {
+                newPosition += static_cast<int64_t>(m_position);
+            }
+            else if (origin == OffsetOrigin::End)
+            {
+                newPosition += static_cast<int64_t>(m_data.size());
+            }
 
-            return 0;
+            m_position = static_cast<size_t>(std::clamp<int64_t>(newPosition, 0, static_cast<int64_t>(m_data.size())));
+            return m_position;
         }
 
-        static uint32_t zipRead(void*, void* streamPtr, void* buf, uint32_t count) noexcept
+        Result<size_t> read(std::byte* buffer, size_t count) override
         {
-            auto* const stream = reinterpret_cast<IStreamBase*>(streamPtr);
-            NAU_ASSERT(stream);
+            const size_t readCount = std::min(count, m_data.size() - m_position);
+            memcpy(buffer, m_data.data() + m_position, readCount);
+            m_position += readCount;
 
-            auto& streamReader = stream->as<IStreamReader&>();
+            return readCount;
+        }
 
-            const auto actualRead = streamReader.read(reinterpret_cast<std::byte*>(buf), static_cast<size_t>(count));
-            if(!actualRead)
-            {  // report error ?
-                return 0;
-            }
+        eastl::span<const std::byte> getContiguousView(size_t count) override
+        {
+            const size_t viewSize = std::min(count, m_data.size() - m_position);
+            const eastl::span<const std::byte> view = m_data.subspan(m_position, viewSize);
+            m_position += viewSize;
 
-            return static_cast<uint32_t>(*actualRead);
+            return view;
         }
 
-        static uint32_t zipWrite(void*, void*, const void*, uint32_t) noexcept
+    private:
+        const nau::Ptr<ZipArchiveFileSystem> m_fileSystem;
+        const eastl::span<const std::byte> m_data;
+        size_t m_position = 0;
+    };
+
+    class ArchiveFile final : public io::IFile, public io_detail::IFileInternal
+    {
+        NAU_CLASS_(nau::io::ArchiveFile, io::IFile, io_detail::IFileInternal)
+
+    public:
+        ArchiveFile(nau::Ptr<ZipArchiveFileSystem>&& archiveFileSystem, const ZipArchiveFileSystem::ZipEntryView& entry) :
+            m_archiveFileSystem(std::move(archiveFileSystem)),
+            m_entry(entry)
         {
-            NAU_ASSERT("Zip write is not supported");
-            return 0;
         }
 
-        static uint64_t zipTell(void*, void* streamPtr) noexcept
+        bool supports(FileFeature) const override
         {
-            auto* const stream = reinterpret_cast<IStreamBase*>(streamPtr);
-            NAU_ASSERT(stream);
+            return false;
+        }
 
-            return stream->getOffset();
+        bool isOpened() const override
+        {
+            return true;
         }
 
-        static long zipSeek(void*, void* streamPtr, uint64_t offset, int origin) noexcept
+        AccessModeFlag getAccessMode() const override
         {
-            auto* const stream = reinterpret_cast<IStreamBase*>(streamPtr);
-            NAU_ASSERT(stream);
+            return AccessMode::Read;
+        }
 
-            const auto seekOrigin = EXPR_Block -> OffsetOrigin
-            {
-                if(origin == ZLIB_FILEFUNC_SEEK_END)
-                {
-                    return OffsetOrigin::End;
-                }
-                else if(origin == ZLIB_FILEFUNC_SEEK_CUR)
-                {
-                    return OffsetOrigin::Current;
-                }
+        FsPath getPath() const override
+        {
+            return m_vfsPath;
+        }
 
-                NAU_ASSERT(origin == ZLIB_FILEFUNC_SEEK_SET);
-                return OffsetOrigin::Begin;
-            };
+        IStreamBase::Ptr createStream(std::optional<AccessModeFlag>) override
+        {
+            if (m_entry.method == StoredMethod)
+            {
+                return rtti::createInstance<ZipStoredEntryStream>(m_archiveFileSystem, m_entry.data);
+            }
 
-            [[maybe_unused]]
-            const auto newOffset = stream->setOffset(seekOrigin, offset);
+            BytesBuffer buffer{m_entry.size};
+            if (Result<size_t> readResult = ZipArchiveFileSystem::readEntry(m_entry, 0, {buffer.data(), buffer.size()}); !readResult || *readResult != m_entry.size)
+            {
+                NAU_LOG_ERROR("Fail to extract zip entry ({})", m_vfsPath.getCStr());
+                return nullptr;
+            }
 
-            return 0;
+            return io::createMemoryStream(std::move(buffer), AccessMode::Read);
         }
 
-        static int zipError(void*, void*) noexcept
+        size_t getSize() const override
         {
-            return 0;
+            return m_entry.size;
         }
 
-        static zlib_filefunc64_def_s getZipFileFuncs(void* opaque)
+        async::Task<size_t> readAsync(size_t offset, eastl::span<std::byte> buffer) override
         {
-            zlib_filefunc64_def_s fileFuncs{};
+            // Extraction is the memory copy or the inflate: that is done off the calling thread.
+            ASYNC_SWITCH_EXECUTOR(async::Executor::getDefault());
 
-            fileFuncs.zopen64_file = zipOpen;
-            fileFuncs.zread_file = zipRead;
-            fileFuncs.zwrite_file = zipWrite;
-            fileFuncs.ztell64_file = zipTell;
-            fileFuncs.zseek64_file = zipSeek;
-            fileFuncs.zclose_file = zipClose;
-            fileFuncs.zerror_file = zipError;
-            fileFuncs.opaque = opaque;
+            Result<size_t> readResult = readEntry(offset, buffer);
+            if (!readResult)
+            {
+                co_return readResult.getError();
+            }
+
+            co_return *readResult;
+        }
 
-            return fileFuncs;
+    private:
+        void setVfsPath(io::FsPath vfsPath) override
+        {
+            m_vfsPath = std::move(vfsPath);
         }
 
-        IStreamBase::Ptr m_stream;
-        ::unzFile m_zipArchive = nullptr;
+        Result<size_t> readEntry(size_t offset, eastl::span<std::byte> buffer)
+        {
+            if (m_entry.method == StoredMethod)
+            {
+                return ZipArchiveFileSystem::readEntry(m_entry, offset, buffer);
+            }
+
+            lock_(m_inflateMutex);
+            if (!m_inflateCursor)
+            {
+                m_inflateCursor = eastl::make_unique<ZipInflateCursor>(m_entry.data);
+            }
 
-        std::vector<ZipFsEntry> m_index;
-        std::mutex m_mutex;
+            return ZipArchiveFileSystem::readEntry(m_entry, offset, buffer, m_inflateCursor.get());
+        }
 
-        friend class ArchiveFile;
+        const nau::Ptr<ZipArchiveFileSystem> m_archiveFileSystem;
+        const ZipArchiveFileSystem::ZipEntryView m_entry;
+        FsPath m_vfsPath;
+        std::mutex m_inflateMutex;
+        eastl::unique_ptr<ZipInflateCursor> m_inflateCursor;
     };
 
-    ZipArchiveFileSystem::ZipArchiveFileSystem(IStreamReader::Ptr stream) :
-        m_stream(std::move(stream))
+    ZipArchiveFileSystem::ZipArchiveFileSystem(eastl::u8string_view archivePath)
     {
-        auto fileFuncs = getZipFileFuncs(this);
-        m_zipArchive = ::unzOpen2_64("internal", &fileFuncs);
-        NAU_ASSERT(m_zipArchive);
-        if(!m_zipArchive)
+        if (Result<> openResult = m_fileMapping.open(archivePath); !openResult)
         {
+            NAU_LOG_ERROR("Fail to open zip archive: ({})", openResult.getError()->getMessage());
             return;
         }
 
-        const auto makeForwardSlashPath = [](char* path, size_t pathLen)
+        m_mappedView = m_fileMapping.map(0, m_fileMapping.getFileSize());
+        if (!m_mappedView)
         {
-            for(size_t i = 0; i < pathLen; ++i)
-            {
-                if(path[i] == '\\')
-                {
-                    path[i] = '/';
-                }
-            }
-        };
-
-        m_index.reserve(10);
+            NAU_LOG_ERROR("Fail to map zip archive");
+            return;
+        }
 
-        constexpr size_t NameLenMax = 500;
-        std::array<char, NameLenMax + 1> nameBuffer;
+        m_archiveData = {m_mappedView, m_fileMapping.getFileSize()};
+        m_lastWriteTime = m_fileMapping.getLastWriteTime();
+    }
 
-        for(int code = ::unzGoToFirstFile(m_zipArchive); code == UNZ_OK; code = ::unzGoToNextFile(m_zipArchive))
-        {
-            unz_file_info64 zipFileInfo;
-            if(::unzGetCurrentFileInfo64(m_zipArchive, &zipFileInfo, nameBuffer.data(), static_cast<uint16_t>(nameBuffer.size()), nullptr, 0, nullptr, 0) != UNZ_OK)
-            {
-                break;
-            }
+    ZipArchiveFileSystem::ZipArchiveFileSystem(IStreamReader::Ptr stream)
+    {
+        NAU_ASSERT(stream);
 
-            const size_t fileNameLen = static_cast<size_t>(zipFileInfo.size_filename);
-            makeForwardSlashPath(nameBuffer.data(), fileNameLen);
+        const size_t streamSize = stream->setPosition(OffsetOrigin::End, 0);
+        stream->setPosition(OffsetOrigin::Begin, 0);
 
-            ZipFsEntry& arcEntry = m_index.emplace_back();
-            arcEntry.size = static_cast<size_t>(zipFileInfo.uncompressed_size);
-            arcEntry.kind = (arcEntry.size > 0) ? FsEntryKind::File : FsEntryKind::Directory;
-            arcEntry.lastWriteTime = static_cast<size_t>(zipFileInfo.dos_date);
+        m_archiveBuffer = BytesBuffer{streamSize};
 
-            std::string_view innerPath = {nameBuffer.data(), fileNameLen};
-            if (innerPath.ends_with('/'))
+        size_t readOffset = 0;
+        while (readOffset < streamSize)
+        {
+            Result<size_t> readResult = stream->read(m_archiveBuffer.data() + readOffset, streamSize - readOffset);
+            if (!readResult || *readResult == 0)
             {
-                innerPath.remove_suffix(1);
+                NAU_LOG_ERROR("Fail to read zip archive stream");
+                return;
             }
-            
-            arcEntry.path = innerPath;
 
-            ::unzGetFilePos64(m_zipArchive, &arcEntry.zipPos);
+            readOffset += *readResult;
         }
 
-        std::sort(m_index.begin(), m_index.end());
+        m_archiveData = {m_archiveBuffer.data(), m_archiveBuffer.size()};
     }
 
-    class ArchiveFile final : public io::IFile, public io_detail::IFileInternal
+    ZipArchiveFileSystem::~ZipArchiveFileSystem()
     {
-        NAU_CLASS_(nau::io::ArchiveFile, io::IFile, io_detail::IFileInternal)
+        AssetPackFileMapping::unmap(m_mappedView, m_fileMapping.getFileSize());
+    }
 
-    public:
-        ArchiveFile(nau::Ptr<ZipArchiveFileSystem>&& archiveFileSystem, const ZipArchiveFileSystem::ZipFsEntry& fsEntry) :
-            m_archiveFileSystem(std::move(archiveFileSystem)),
-            m_fsEntry(fsEntry)
-        {
-        }
+    Result<> ZipArchiveFileSystem::readCentralDirectory()
+    {
+        const std::byte* const data = m_archiveData.data();
+        const size_t dataSize = m_archiveData.size();
 
-        ~ArchiveFile()
+        if (dataSize < EndOfCentralDirectorySize)
         {
+            return NauMakeError("Invalid zip archive size");
         }
 
-        bool supports(FileFeature) const override
+        // The end of central directory record is the last record of the archive (followed only by the archive comment).
+        const size_t searchEnd = dataSize > EndOfCentralDirectorySize + MaxCommentSize ? dataSize - EndOfCentralDirectorySize - MaxCommentSize : 0;
+        size_t endRecordOffset = dataSize - EndOfCentralDirectorySize;
+        while (readValue<uint32_t>(data + endRecordOffset) != EndOfCentralDirectorySignature)
         {
-            return false;
+            if (endRecordOffset == searchEnd)
+            {
+                return NauMakeError("Zip end of central directory is not found");
+            }
+            --endRecordOffset;
         }
 
-        bool isOpened() const override
-        {
-            return true;
-        }
+        const std::byte* const endRecord = data + endRecordOffset;
+        uint64_t entriesCount = readValue<uint16_t>(endRecord + 10);
+        uint64_t directorySize = readValue<uint32_t>(endRecord + 12);
+        uint64_t directoryOffset = readValue<uint32_t>(endRecord + 16);
 
-        AccessModeFlag getAccessMode() const override
+        if (endRecordOffset >= Zip64EndOfCentralDirectoryLocatorSize && readValue<uint32_t>(endRecord - Zip64EndOfCentralDirectoryLocatorSize) == Zip64EndOfCentralDirectoryLocatorSignature)
         {
-            return AccessMode::Read;
+            const uint64_t zip64RecordOffset = readValue<uint64_t>(endRecord - Zip64EndOfCentralDirectoryLocatorSize + 8);
+            if (zip64RecordOffset > endRecordOffset || Zip64EndOfCentralDirectorySize > endRecordOffset - zip64RecordOffset || readValue<uint32_t>(data + zip64RecordOffset) != Zip64EndOfCentralDirectorySignature)
+            {
+                return NauMakeError("Invalid zip64 end of central directory");
+            }
+
+            const std::byte* const zip64Record = data + zip64RecordOffset;
+            entriesCount = readValue<uint64_t>(zip64Record + 32);
+            directorySize = readValue<uint64_t>(zip64Record + 40);
+            directoryOffset = readValue<uint64_t>(zip64Record + 48);
         }
 
-        FsPath getPath() const override
+        if (directoryOffset > endRecordOffset || directorySize > endRecordOffset - directoryOffset)
         {
-            return m_vfsPath;
+            return NauMakeError("Invalid zip central directory");
         }
 
-        IStreamBase::Ptr createStream(std::optional<AccessModeFlag>) override
+        m_entries.reserve(static_cast<size_t>(std::min(entriesCount, directorySize / CentralDirectoryHeaderSize)));
+
+        eastl::vector<eastl::string> directoryPaths;
+        const std::byte* const directoryEnd = data + directoryOffset + directorySize;
+        const std::byte* header = data + directoryOffset;
+
+        for (uint64_t i = 0; i < entriesCount; ++i)
         {
-            auto result = EXPR_Block->Result<std::tuple<const void*, size_t>>
+            if (static_cast<size_t>(directoryEnd - header) < CentralDirectoryHeaderSize || readValue<uint32_t>(header) != CentralDirectoryHeaderSignature)
             {
-                lock_(m_archiveFileSystem->m_mutex);
+                return NauMakeError("Invalid zip central directory entry");
+            }
 
-                if(m_uncompressedBuffer.empty())
-                {
-                    auto archive = m_archiveFileSystem->m_zipArchive;
+            const size_t nameLength = readValue<uint16_t>(header + 28);
+            const size_t extraLength = readValue<uint16_t>(header + 30);
+            const size_t commentLength = readValue<uint16_t>(header + 32);
+            if (nameLength + extraLength + commentLength > static_cast<size_t>(directoryEnd - header) - CentralDirectoryHeaderSize)
+            {
+                return NauMakeError("Invalid zip central directory entry");
+            }
 
-                    ::unzGoToFilePos64(archive, &m_fsEntry.zipPos);
-                    ::unzOpenCurrentFile(archive);
+            const std::byte* const name = header + CentralDirectoryHeaderSize;
+            const std::byte* const extra = name + nameLength;
+            const std::byte* const nextHeader = extra + extraLength + commentLength;
 
-                    scope_on_leave
-                    {
-                        ::unzCloseCurrentFile(archive);
-                    };
+            const eastl::string_view entryName{reinterpret_cast<const char*>(name), nameLength};
+            eastl::string path = normalizeArchivePath(entryName);
 
-                    m_uncompressedBuffer.resize(m_fsEntry.size);
-                    size_t readOffset = 0;
+            if (entryName.ends_with('/') || entryName.ends_with('\\'))
+            {
+                directoryPaths.emplace_back(std::move(path));
+                header = nextHeader;
+                continue;
+            }
 
-                    constexpr size_t ZipReadMaxBytes = UINT16_MAX;
+            ZipEntry& entry = m_entries.emplace_back();
+            entry.flags = readValue<uint16_t>(header + 8);
+            entry.method = readValue<uint16_t>(header + 10);
+            entry.lastWriteTime = (static_cast<size_t>(readValue<uint16_t>(header + 14)) << 16) | readValue<uint16_t>(header + 12);
+            entry.compressedSize = readValue<uint32_t>(header + 20);
+            entry.size = readValue<uint32_t>(header + 24);
+            entry.localHeaderOffset = readValue<uint32_t>(header + 42);
 
-                    for(; readOffset < m_uncompressedBuffer.size();)
-                    {
-                        void* const ptr = m_uncompressedBuffer.data() + readOffset;
-                        const size_t readCount = std::min(m_uncompressedBuffer.size() - readOffset, ZipReadMaxBytes);
-                        const int readResult = ::unzReadCurrentFile(archive, ptr, static_cast<uint32_t>(readCount));
+            // Zip64: the values that do not fit into 32 bits are stored (in that order) in the extra field.
+            for (size_t fieldOffset = 0; extraLength - fieldOffset >= 4;)
+            {
+                const std::byte* const field = extra + fieldOffset;
+                const uint16_t fieldId = readValue<uint16_t>(field);
+                const size_t fieldSize = std::min<size_t>(readValue<uint16_t>(field + 2), extraLength - fieldOffset - 4);
+                const std::byte* value = field + 4;
+                const std::byte* const valueEnd = value + fieldSize;
 
-                        NAU_ASSERT(readResult >= 0);
-                        if(readResult < 0)
-                        {
-                            return NauMakeError("Read zip entry error");
-                        }
-                        if(readResult == 0)
+                if (fieldId == Zip64ExtraFieldId)
+                {
+                    for (size_t* const field64 : {&entry.size, &entry.compressedSize, &entry.localHeaderOffset})
+                    {
+                        if (*field64 == 0xFFFFFFFF && static_cast<size_t>(valueEnd - value) >= sizeof(uint64_t))
                         {
-                            break;
+                            *field64 = static_cast<size_t>(readValue<uint64_t>(value));
+                            value += sizeof(uint64_t);
                         }
-
-                        readOffset += static_cast<size_t>(readResult);
-                    }
-
-                    if(readOffset < m_uncompressedBuffer.size())
-                    {
-                        m_uncompressedBuffer.resize(readOffset);
                     }
+                    break;
                 }
 
-                return {m_uncompressedBuffer.data(), m_uncompressedBuffer.size()};
-            };
-
-            if (!result)
-            {
-                return nullptr;
+                fieldOffset += 4 + fieldSize;
             }
-            
-            const auto [ptr, size] = *result;
-    
-            return io::createReadOnlyMemoryStream(ptr, size, rtti::Acquire {as<IRefCounted*>()});
+
+            entry.pathHash = getArchivePathHash(path);
+            entry.path = std::move(path);
+
+            header = nextHeader;
         }
 
-        uint64_t getSize() const override
+        eastl::sort(m_entries.begin(), m_entries.end(), [](const ZipEntry& left, const ZipEntry& right)
+        {
+            return left.pathHash < right.pathHash;
+        });
+
+        // m_entries are not changed anymore: the directory children refer to the entry paths.
+        addDirectory({});
+        for (const eastl::string& directoryPath : directoryPaths)
         {
-            return m_fsEntry.size;
+            addDirectory(directoryPath);
         }
-  
-    private:
-        void setVfsPath(io::FsPath vfsPath) override
+
+        for (const ZipEntry& entry : m_entries)
         {
-            m_vfsPath = std::move(vfsPath);
+            addDirectory(getParentArchivePath(entry.path)).children.push_back({getArchivePathName(entry.path), &entry});
         }
 
-        nau::Ptr<ZipArchiveFileSystem> m_archiveFileSystem;
-        const ZipArchiveFileSystem::ZipFsEntry& m_fsEntry;
-        std::vector<std::byte> m_uncompressedBuffer;
-        FsPath m_vfsPath;
-    };
+        return ResultSuccess;
+    }
 
-    ZipArchiveFileSystem::~ZipArchiveFileSystem()
+    ZipArchiveFileSystem::ZipDirectory& ZipArchiveFileSystem::addDirectory(eastl::string_view normalizedPath)
     {
-        if(m_zipArchive)
+        auto [iter, emplaced] = m_directories.try_emplace(eastl::string{normalizedPath});
+
+        // The map nodes are not moved by the rehash: the key and the directory references stay valid.
+        ZipDirectory& directory = iter->second;
+        if (emplaced && !normalizedPath.empty())
         {
-            ::unzClose(m_zipArchive);
+            const eastl::string_view path = iter->first;
+            addDirectory(getParentArchivePath(path)).children.push_back({getArchivePathName(path), nullptr});
         }
-    }
 
-    bool ZipArchiveFileSystem::isReadOnly() const
-    {
-        return true;
+        return directory;
     }
 
-    bool ZipArchiveFileSystem::exists(const FsPath& path, [[maybe_unused]] std::optional<FsEntryKind> kind)
+    const ZipArchiveFileSystem::ZipEntry* ZipArchiveFileSystem::findEntry(eastl::string_view normalizedPath) const
     {
-        struct OperatorLess
+        const uint64_t pathHash = getArchivePathHash(normalizedPath);
+
+        auto iter = eastl::lower_bound(m_entries.begin(), m_entries.end(), pathHash, [](const ZipEntry& entry, uint64_t hash)
         {
-            bool operator()(const FsEntry& fs, const FsPath& path) const
-            {
-                return fs.path < path;
-            }
+            return entry.pathHash < hash;
+        });
 
-            bool operator()(const FsPath& path, const FsEntry& fs) const
+        for (; iter != m_entries.end() && iter->pathHash == pathHash; ++iter)
+        {
+            if (iter->path == normalizedPath)
             {
-                return path < fs.path;
+                return iter;
             }
-        };
+        }
+
+        return nullptr;
+    }
+
+    const ZipArchiveFileSystem::ZipDirectory* ZipArchiveFileSystem::findDirectory(const eastl::string& normalizedPath) const
+    {
+        auto iter = m_directories.find(normalizedPath);
+        return iter != m_directories.end() ? &iter->second : nullptr;
+    }
 
-        if (path.isEmpty())
-        { // root
+    bool ZipArchiveFileSystem::isReadOnly() const
+    {
+        return true;
+    }
+
+    bool ZipArchiveFileSystem::exists(const FsPath& path, std::optional<FsEntryKind> kind)
+    {
+        const eastl::string normalizedPath = normalizeArchivePath(path.getCStr());
+
+        if (kind != FsEntryKind::Directory && findEntry(normalizedPath) != nullptr)
+        {
             return true;
         }
 
-
-        return std::binary_search(m_index.begin(), m_index.end(), path, OperatorLess{});
+        return kind != FsEntryKind::File && findDirectory(normalizedPath) != nullptr;
     }
 
     size_t ZipArchiveFileSystem::getLastWriteTime(const FsPath&)
     {
-        return 0;
+        return m_lastWriteTime;
     }
 
     IFile::Ptr ZipArchiveFileSystem::openFile(const FsPath& path, AccessModeFlag accessMode, OpenFileMode openMode)
@@ -383,39 +727,95 @@ namespace nau::io
         NAU_ASSERT(openMode == OpenFileMode::OpenExisting);
         NAU_ASSERT(!(accessMode && AccessMode::Write));
 
-        // m_index is not mutable.
-        auto iter = std::find_if(m_index.begin(), m_index.end(), [&path](const ZipFsEntry& entry)
-                                 {
-                                     return entry.path == path;
-                                 });
+        const ZipEntry* const entry = findEntry(normalizeArchivePath(path.getCStr()));
+        if (!entry)
+        {
+            return nullptr;
+        }
+
+        if ((entry->flags & EncryptedEntryFlag) != 0 || (entry->method != StoredMethod && entry->method != DeflatedMethod))
+        {
+            NAU_LOG_ERROR("Unsupported zip entry ({}): method ({}), flags ({})", entry->path, entry->method, entry->flags);
+            return nullptr;
+        }
 
-        if(iter == m_index.end())
+        // The local header is read only on open: the mount does not touch the archive beyond the central directory.
+        const size_t headerOffset = entry->localHeaderOffset;
+        if (headerOffset > m_archiveData.size() || LocalFileHeaderSize > m_archiveData.size() - headerOffset || readValue<uint32_t>(m_archiveData.data() + headerOffset) != LocalFileHeaderSignature)
         {
+            NAU_LOG_ERROR("Invalid zip local file header ({})", entry->path);
             return nullptr;
         }
 
-        return rtti::createInstance<ArchiveFile>(rtti::Acquire{this}, *iter);
+        const size_t dataOffset = headerOffset + LocalFileHeaderSize +
+                                  readValue<uint16_t>(m_archiveData.data() + headerOffset + 26) +
+                                  readValue<uint16_t>(m_archiveData.data() + headerOffset + 28);
+
+        const size_t dataSize = entry->method == StoredMethod ? entry->size : entry->compressedSize;
+        if (dataOffset > m_archiveData.size() || dataSize > m_archiveData.size() - dataOffset)
+        {
+            NAU_LOG_ERROR("Invalid zip entry size ({})", entry->path);
+            return nullptr;
+        }
+
+        const ZipEntryView view{
+            .data = m_archiveData.subspan(dataOffset, dataSize),
+            .size = entry->size,
+            .method = entry->method};
+
+        return rtti::createInstance<ArchiveFile>(nau::Ptr{this}, view);
     }
 
-    IFileSystem::OpenDirResult ZipArchiveFileSystem::openDirIterator(const FsPath& path)
+    Result<size_t> ZipArchiveFileSystem::readEntry(const ZipEntryView& entry, size_t offset, eastl::span<std::byte> buffer, ZipInflateCursor* cursor)
     {
-        std::vector<const ZipFsEntry*> entries;
-        for (const auto& entry : m_index)
+        if (offset >= entry.size || buffer.empty())
         {
-            if (entry.path.getParentPath() == path)
-            {
-                entries.push_back(&entry);
-            }
+            return 0;
+        }
+
+        const size_t readSize = std::min(buffer.size(), entry.size - offset);
+
+        if (entry.method == StoredMethod)
+        {
+            memcpy(buffer.data(), entry.data.data() + offset, readSize);
+            return readSize;
         }
 
-        if (entries.empty())
+        if (!cursor)
+        {
+            ZipInflateCursor entryCursor{entry.data};
+            return entryCursor.read(offset, buffer.first(readSize));
+        }
+
+        return cursor->read(offset, buffer.first(readSize));
+    }
+
+    FsEntry ZipArchiveFileSystem::getDirIteratorEntry(const DirIteratorState& state) const
+    {
+        if (state.currentIndex >= state.directory->children.size())
         {
             return {};
         }
 
-        auto* const state = new DirIteratorState {std::move(entries), path };
+        const ZipDirectoryChild& child = state.directory->children[state.currentIndex];
+        return FsEntry{
+            .path = state.basePath / std::string_view{child.name.data(), child.name.size()},
+            .kind = child.file ? FsEntryKind::File : FsEntryKind::Directory,
+            .size = child.file ? child.file->size : 0,
+            .lastWriteTime = child.file ? child.file->lastWriteTime : 0};
+    }
 
-        return { state, state->getCurrentFsEntry() };
+    IFileSystem::OpenDirResult ZipArchiveFileSystem::openDirIterator(const FsPath& path)
+    {
+        const ZipDirectory* const directory = findDirectory(normalizeArchivePath(path.getCStr()));
+        if (!directory || directory->children.empty())
+        {
+            return {};
+        }
+
+        auto* const state = new DirIteratorState{directory, 0, path};
+
+        return {state, getDirIteratorEntry(*state)};
     }
 
     void ZipArchiveFileSystem::closeDirIterator(void* statePtr)
@@ -432,19 +832,33 @@ namespace nau::io
         NAU_ASSERT(statePtr);
         auto* const state = reinterpret_cast<DirIteratorState*>(statePtr);
 
-        if (++state->currentIndex >= state->entries.size())
+        ++state->currentIndex;
+        return getDirIteratorEntry(*state);
+    }
+
+    IFileSystem::Ptr createZipArchiveFileSystem(IStreamReader::Ptr stream, [[maybe_unused]] std::string basePath)
+    {
+        NAU_ASSERT(basePath.empty(), "Archive base/inner path is not supported yet");
+
+        auto fileSystem = rtti::createInstance<ZipArchiveFileSystem>(std::move(stream));
+        if (Result<> readResult = fileSystem->readCentralDirectory(); !readResult)
         {
-            return {};
+            NAU_LOG_ERROR("Fail to open zip archive: ({})", readResult.getError()->getMessage());
+            return nullptr;
         }
 
-        return state->getCurrentFsEntry();
+        return fileSystem;
     }
 
-    IFileSystem::Ptr createZipArchiveFileSystem(IStreamReader::Ptr stream, [[maybe_unused]] std::string basePath)
+    IFileSystem::Ptr createZipArchiveFileSystem(eastl::u8string_view archivePath)
     {
-        NAU_ASSERT(basePath.empty(), "Archive base/inner path is not supported yet");
-        return rtti::createInstance<ZipArchiveFileSystem>(std::move(stream));
+        auto fileSystem = rtti::createInstance<ZipArchiveFileSystem>(archivePath);
+        if (Result<> readResult = fileSystem->readCentralDirectory(); !readResult)
+        {
+            NAU_LOG_ERROR("Fail to open zip archive: ({})", readResult.getError()->getMessage());
+            return nullptr;
+        }
+
+        return fileSystem;
     }
 }  // namespace nau::io
-
-#endif
@@ -301,6 +301,148 @@ namespace nau::math
     }
 
 
+    // 4 spheres in the SoA form: the centers are transposed, so each plane is tested against 4 spheres at once.
+    inline void v_spheres4_soa(const BSphere3* spheres, __m128& x, __m128& y, __m128& z, __m128& r)
+    {
+        __m128 xy01 = _mm_unpacklo_ps(spheres[0].c.get128(), spheres[1].c.get128());
+        __m128 xy23 = _mm_unpacklo_ps(spheres[2].c.get128(), spheres[3].c.get128());
+        __m128 zw01 = _mm_unpackhi_ps(spheres[0].c.get128(), spheres[1].c.get128());
+        __m128 zw23 = _mm_unpackhi_ps(spheres[2].c.get128(), spheres[3].c.get128());
+
+        x = _mm_movelh_ps(xy01, xy23);
+        y = _mm_movehl_ps(xy23, xy01);
+        z = _mm_movelh_ps(zw01, zw23);
+        r = _mm_setr_ps(spheres[0].r, spheres[1].r, spheres[2].r, spheres[3].r);
+    }
+
+    // Frustum plane components splatted once per testSpheres() call.
+    struct FrustumPlanesSplat
+    {
+        __m128 x[6], y[6], z[6], w[6];
+    };
+
+    inline void v_splat_planes(const NauFrustum& frustum, FrustumPlanesSplat& planes)
+    {
+        for (int p = 0; p < 6; p++)
+        {
+            planes.x[p] = v_splat_x(frustum.camPlanes[p].get128());
+            planes.y[p] = v_splat_y(frustum.camPlanes[p].get128());
+            planes.z[p] = v_splat_z(frustum.camPlanes[p].get128());
+            planes.w[p] = v_splat_w(frustum.camPlanes[p].get128());
+        }
+    }
+
+    // Same test as v_is_visible_sphere: the sphere is culled when (distance + r) is negative for any plane,
+    // so only the sign bits of all the planes results are accumulated.
+    inline uint32_t v_spheres4_visible_mask(__m128 x, __m128 y, __m128 z, __m128 r, const FrustumPlanesSplat& planes)
+    {
+        __m128 res = v_zero();
+        for (int p = 0; p < 6; p++)
+        {
+            __m128 dist = v_madd(x, planes.x[p], planes.w[p]);
+            dist = v_madd(y, planes.y[p], dist);
+            dist = v_madd(z, planes.z[p], dist);
+            res = v_or(res, v_add(dist, r));
+        }
+
+        return ~uint32_t(_mm_movemask_ps(res)) & 0xF;
+    }
+
+#if defined(__AVX__)
+    inline uint32_t v_spheres8_visible_mask(__m256 x, __m256 y, __m256 z, __m256 r, const FrustumPlanesSplat& planes)
+    {
+        __m256 res = _mm256_setzero_ps();
+        for (int p = 0; p < 6; p++)
+        {
+            __m256 dist = _mm256_add_ps(_mm256_mul_ps(x, _mm256_set_m128(planes.x[p], planes.x[p])), _mm256_set_m128(planes.w[p], planes.w[p]));
+            dist = _mm256_add_ps(_mm256_mul_ps(y, _mm256_set_m128(planes.y[p], planes.y[p])), dist);
+            dist = _mm256_add_ps(_mm256_mul_ps(z, _mm256_set_m128(planes.z[p], planes.z[p])), dist);
+            res = _mm256_or_ps(res, _mm256_add_ps(dist, r));
+        }
+
+        return ~uint32_t(_mm256_movemask_ps(res)) & 0xFF;
+    }
+#endif
+
+    static constexpr size_t MaxFrustaPerBatch = 8;
+
+    // Each spheres batch is loaded (and transposed) once and tested against all the frusta.
+    static void testSpheresBatch(const NauFrustum* const* frusta, uint32_t* const* outVisibleMasks, size_t frustaCount, eastl::span<const BSphere3> spheres)
+    {
+        NAU_ASSERT(frustaCount <= MaxFrustaPerBatch);
+
+        FrustumPlanesSplat planes[MaxFrustaPerBatch];
+        for (size_t f = 0; f < frustaCount; f++)
+            v_splat_planes(*frusta[f], planes[f]);
+
+        const size_t count = spheres.size();
+
+        // The batches are started at the multiple of their size, so a batch never crosses the mask word.
+        size_t index = 0;
+#if defined(__AVX__)
+        for (; index + 8 <= count; index += 8)
+        {
+            __m128 x0, y0, z0, r0, x1, y1, z1, r1;
+            v_spheres4_soa(spheres.data() + index, x0, y0, z0, r0);
+            v_spheres4_soa(spheres.data() + index + 4, x1, y1, z1, r1);
+
+            const __m256 x = _mm256_set_m128(x1, x0);
+            const __m256 y = _mm256_set_m128(y1, y0);
+            const __m256 z = _mm256_set_m128(z1, z0);
+            const __m256 r = _mm256_set_m128(r1, r0);
+
+            for (size_t f = 0; f < frustaCount; f++)
+                outVisibleMasks[f][index / 32] |= v_spheres8_visible_mask(x, y, z, r, planes[f]) << (index % 32);
+        }
+#endif
+        for (; index + 4 <= count; index += 4)
+        {
+            __m128 x, y, z, r;
+            v_spheres4_soa(spheres.data() + index, x, y, z, r);
+
+            for (size_t f = 0; f < frustaCount; f++)
+                outVisibleMasks[f][index / 32] |= v_spheres4_visible_mask(x, y, z, r, planes[f]) << (index % 32);
+        }
+
+        for (; index < count; index++)
+        {
+            const BSphere3& sphere = spheres[index];
+            for (size_t f = 0; f < frustaCount; f++)
+            {
+                if (frusta[f]->testSphereB(sphere.c, Vector4{sphere.r}))
+                    outVisibleMasks[f][index / 32] |= 1u << (index % 32);
+            }
+        }
+    }
+
+    void NauFrustum::testSpheres(eastl::span<const BSphere3> spheres, eastl::span<uint32_t> outVisibleMask) const
+    {
+        NAU_ASSERT(outVisibleMask.size() >= getVisibleMaskSize(spheres.size()));
+
+        const NauFrustum* const frustum = this;
+        uint32_t* const mask = outVisibleMask.data();
+        testSpheres({&frustum, 1}, spheres, {&mask, 1});
+    }
+
+    void NauFrustum::testSpheres(eastl::span<const NauFrustum* const> frusta, eastl::span<const BSphere3> spheres, eastl::span<uint32_t* const> outVisibleMasks)
+    {
+        NAU_ASSERT(outVisibleMasks.size() >= frusta.size());
+
+        const size_t maskSize = getVisibleMaskSize(spheres.size());
+        for (size_t f = 0; f < frusta.size(); f++)
+        {
+            for (size_t i = 0; i < maskSize; i++)
+                outVisibleMasks[f][i] = 0;
+        }
+
+        for (size_t first = 0; first < frusta.size(); first += MaxFrustaPerBatch)
+        {
+            const size_t frustaCount = eastl::min(MaxFrustaPerBatch, frusta.size() - first);
+            testSpheresBatch(frusta.data() + first, outVisibleMasks.data() + first, frustaCount, spheres);
+        }
+    }
+
+
     __m128 v_perm_xycw(__m128 xyzw, __m128 abcd)
     {
       __m128 wwcc = _mm_shuffle_ps(xyzw, abcd, _MM_SHUFFLE(2, 2, 3, 3));
@@ -0,0 +1,87 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "nau/math/transform_batch.h"
+
+namespace nau::math
+{
+    namespace
+    {
+        NAU_FORCE_INLINE bool hasPositiveScale(const Transform& transform)
+        {
+            return bool(transform.getScale() > Vector3::zero());
+        }
+
+        // Transform::operator* without the decomposition fallback: both scales must be positive.
+        NAU_FORCE_INLINE Transform multiplyPositiveScale(const Transform& lhs, const Transform& rhs)
+        {
+            return Transform{
+                normalize(lhs.getRotation() * rhs.getRotation()),
+                lhs.transformVector(rhs.getTranslation()) + lhs.getTranslation(),
+                lhs.getScale() * FloatInVec(rhs.getScale().get128())};
+        }
+    }  // namespace
+
+    void multiplyTransforms(const Transform& parent, eastl::span<const Transform> locals, eastl::span<Transform> outWorld)
+    {
+        NAU_ASSERT(locals.size() == outWorld.size());
+
+        // The parent is copied: the output may alias the locals, not the parent.
+        const Transform parentTransform = parent;
+        if (!hasPositiveScale(parentTransform))
+        {
+            for (size_t i = 0; i < locals.size(); ++i)
+            {
+                outWorld[i] = parentTransform * locals[i];
+            }
+            return;
+        }
+
+        for (size_t i = 0; i < locals.size(); ++i)
+        {
+            outWorld[i] = hasPositiveScale(locals[i]) ? multiplyPositiveScale(parentTransform, locals[i]) : parentTransform * locals[i];
+        }
+    }
+
+    void multiplyTransforms(eastl::span<const Transform> lhs, eastl::span<const Transform> rhs, eastl::span<Transform> out)
+    {
+        NAU_ASSERT(lhs.size() == rhs.size() && lhs.size() == out.size());
+
+        for (size_t i = 0; i < lhs.size(); ++i)
+        {
+            out[i] = hasPositiveScale(lhs[i]) && hasPositiveScale(rhs[i]) ? multiplyPositiveScale(lhs[i], rhs[i]) : lhs[i] * rhs[i];
+        }
+    }
+
+    void transformsToMatrices(eastl::span<const Transform> transforms, eastl::span<Matrix4> out)
+    {
+        NAU_ASSERT(transforms.size() == out.size());
+
+        for (size_t i = 0; i < transforms.size(); ++i)
+        {
+            out[i] = transforms[i].toMatrixWithScale();
+        }
+    }
+
+    void inverseTransposeAffine(eastl::span<const Matrix4> matrices, eastl::span<Matrix4> out)
+    {
+        NAU_ASSERT(matrices.size() == out.size());
+
+        for (size_t i = 0; i < matrices.size(); ++i)
+        {
+            out[i] = inverseTransposeAffine(matrices[i]);
+        }
+    }
+
+    void transformSpheres(eastl::span<const Matrix4> matrices, eastl::span<const BSphere3> spheres, eastl::span<BSphere3> out)
+    {
+        NAU_ASSERT(matrices.size() == spheres.size() && spheres.size() == out.size());
+
+        for (size_t i = 0; i < spheres.size(); ++i)
+        {
+            out[i] = transformSphere(matrices[i], spheres[i]);
+        }
+    }
+
+}  // namespace nau::math
@@ -29,7 +29,7 @@ namespace nau
                 info.m_unaligned = unaligned;
                 info.m_size = size;
                 info.m_alignment = alignment;
-// TODO Tracy                TracyAllocN(unaligned, reserved, m_name.value().c_str());
+                NAU_PROFILING_ALLOC(unaligned, reserved, m_name.value().c_str());
                 return aligned;
             }
         }
@@ -64,7 +64,7 @@ namespace nau
         if (info.first != nullptr)
         {
             this->deallocate(info.first->m_unaligned);
-// TODO Tracy            TracyFreeN(info.first->m_unaligned, m_name.value().c_str());
+            NAU_PROFILING_FREE(info.first->m_unaligned, m_name.value().c_str());
             m_allocations.value().erase(ptr);
         }
     }
@@ -50,7 +50,7 @@ namespace nau
                 info.m_unaligned = unaligned;
                 info.m_size = size;
                 info.m_alignment = alignment;
-//TODO Tracy                TracyAllocN(unaligned, reserved, m_name.value().c_str());
+                NAU_PROFILING_ALLOC(unaligned, reserved, m_name.value().c_str());
                 fillPattern(aligned, info);
                 return aligned;
             }
@@ -71,7 +71,7 @@ namespace nau
                 NAU_FAILURE("Memory overrun detected");
             }
             this->deallocate(info.first->m_unaligned);
-// TODO Tracy            TracyFreeN(info.first->m_unaligned, m_name.value().c_str());
+            NAU_PROFILING_FREE(info.first->m_unaligned, m_name.value().c_str());
             m_allocations.value().erase(ptr);
         }
     }
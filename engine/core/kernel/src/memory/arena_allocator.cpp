@@ -0,0 +1,136 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "nau/memory/arena_allocator.h"
+
+#include "nau/threading/lock_guard.h"
+
+namespace nau
+{
+    namespace
+    {
+        constexpr size_t ArenaBlockAlignment = 16;
+
+        struct alignas(ArenaBlockAlignment) ArenaBlockHeader
+        {
+            size_t size;
+        };
+
+        inline constexpr size_t alignArenaBlockSize(size_t size)
+        {
+            return (size + ArenaBlockAlignment - 1) & ~(ArenaBlockAlignment - 1);
+        }
+
+        inline ArenaBlockHeader* getArenaBlockHeader(const void* ptr)
+        {
+            return const_cast<ArenaBlockHeader*>(reinterpret_cast<const ArenaBlockHeader*>(ptr) - 1);
+        }
+    }  // namespace
+
+    ArenaAllocator::ArenaAllocator(size_t pageSize) :
+        m_pageSize(alignArenaBlockSize(pageSize))
+    {
+        NAU_ASSERT(m_pageSize > 0);
+        m_name.value() = "ArenaAllocator";
+    }
+
+    ArenaAllocator::~ArenaAllocator()
+    {
+        while (m_pages)
+        {
+            MemPage* const next = m_pages->getNext();
+            MemPage::freeMemPage(m_pages);
+            m_pages = next;
+        }
+    }
+
+    void* ArenaAllocator::allocateBlock(size_t blockSize)
+    {
+        if (static_cast<size_t>(m_end - m_top) < blockSize)
+        {
+            // The rest of the current page is abandoned: the blocks are small compared to the page.
+            MemPage* const newPage = MemPage::allocateMemPage(std::max(blockSize, m_pageSize), ArenaBlockAlignment);
+            NAU_FATAL(newPage, "Out of memory");
+            newPage->setNext(m_pages);
+            m_pages = newPage;
+            m_reservedSize += newPage->getSize();
+
+            m_top = static_cast<char*>(newPage->getAddress());
+            m_end = m_top + newPage->getSize();
+        }
+
+        void* const block = m_top;
+        m_top += blockSize;
+        ++m_allocationsCount;
+        return block;
+    }
+
+    void* ArenaAllocator::allocate(size_t size)
+    {
+        lock_(m_arenaLock);
+
+        auto* const header = reinterpret_cast<ArenaBlockHeader*>(allocateBlock(sizeof(ArenaBlockHeader) + alignArenaBlockSize(size)));
+        header->size = size;
+        return header + 1;
+    }
+
+    void* ArenaAllocator::reallocate(void* ptr, size_t size)
+    {
+        if (!ptr)
+        {
+            return allocate(size);
+        }
+
+        ArenaBlockHeader* const header = getArenaBlockHeader(ptr);
+        const size_t oldSize = header->size;
+        if (size <= oldSize)
+        {
+            return ptr;
+        }
+
+        {
+            lock_(m_arenaLock);
+
+            // The block is the last allocation and the page has enough space: it grows in place.
+            char* const blockEnd = static_cast<char*>(ptr) + alignArenaBlockSize(oldSize);
+            const size_t extraSize = alignArenaBlockSize(size) - alignArenaBlockSize(oldSize);
+            if (blockEnd == m_top && static_cast<size_t>(m_end - m_top) >= extraSize)
+            {
+                m_top += extraSize;
+                header->size = size;
+                return ptr;
+            }
+        }
+
+        void* const newPtr = allocate(size);
+        memcpy(newPtr, ptr, oldSize);
+        return newPtr;
+    }
+
+    void ArenaAllocator::deallocate([[maybe_unused]] void* ptr)
+    {
+    }
+
+    size_t ArenaAllocator::getSize(const void* ptr) const
+    {
+        if (!ptr)
+        {
+            return 0;
+        }
+
+        return getArenaBlockHeader(ptr)->size;
+    }
+
+    size_t ArenaAllocator::getAllocationsCount() const
+    {
+        lock_(m_arenaLock);
+        return m_allocationsCount;
+    }
+
+    size_t ArenaAllocator::getReservedSize() const
+    {
+        lock_(m_arenaLock);
+        return m_reservedSize;
+    }
+}  // namespace nau
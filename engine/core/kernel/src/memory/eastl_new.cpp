@@ -27,6 +27,65 @@ void* operator new[](size_t size, size_t alignment, [[maybe_unused]] size_t alig
 
 #else
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+#include "nau/memory/memory_stats.h"
+
+namespace
+{
+    /**
+        Prefix of each block of the EASTL allocator: the allocation is charged to the memory tag that was active when it was made,
+        the free is charged to the same tag (on any thread). The header size keeps the malloc alignment of the returned memory.
+     */
+    struct alignas(16) EastlBlockHeader
+    {
+        void* block;
+        size_t size;
+        nau::MemoryTag tag;
+    };
+
+    void* allocateTracked(size_t size, size_t alignment)
+    {
+        const size_t padding = alignment > alignof(EastlBlockHeader) ? alignment : 0;
+        std::byte* const block = reinterpret_cast<std::byte*>(::malloc(sizeof(EastlBlockHeader) + padding + size));
+        if (!block)
+        {
+            return nullptr;
+        }
+
+        uintptr_t data = reinterpret_cast<uintptr_t>(block + sizeof(EastlBlockHeader));
+        if (padding > 0)
+        {
+            data = (data + alignment - 1) & ~(alignment - 1);
+        }
+
+        EastlBlockHeader* const header = reinterpret_cast<EastlBlockHeader*>(data) - 1;
+        header->block = block;
+        header->size = size;
+        header->tag = nau::getCurrentMemoryTag();
+
+        nau::memory_detail::onMemoryAllocated(header->tag, size);
+
+        return reinterpret_cast<void*>(data);
+    }
+
+    void freeTracked(void* ptr)
+    {
+        if (!ptr)
+        {
+            return;
+        }
+
+        EastlBlockHeader* const header = reinterpret_cast<EastlBlockHeader*>(ptr) - 1;
+        nau::memory_detail::onMemoryFreed(header->tag, header->size);
+        ::free(header->block);
+    }
+}  // namespace
+
 namespace eastl
 {
 
@@ -77,22 +136,31 @@ namespace eastl
 
     void* allocator::allocate(size_t n, int flags)
     {
-        return ::malloc(n);
+        return allocateTracked(n, 0);
     }
 
     void* allocator::realloc(void* p, size_t n, int flags)
     {
-        return ::realloc(p, n);
+        void* const newPtr = allocateTracked(n, 0);
+        if (newPtr && p)
+        {
+            const EastlBlockHeader* const header = reinterpret_cast<EastlBlockHeader*>(p) - 1;
+            memcpy(newPtr, p, std::min(header->size, n));
+            freeTracked(p);
+        }
+
+        return newPtr;
     }
 
+    // The alignment offset is not supported: the alignment is applied to the returned pointer.
     void* allocator::allocate(size_t n, size_t alignment, size_t offset, int flags)
     {
-        return ::malloc(n);
+        return allocateTracked(n, alignment);
     }
 
     void allocator::deallocate(void* p, size_t)
     {
-        ::free(p);
+        freeTracked(p);
     }
 
     bool operator==(const allocator& a, const allocator& b)
@@ -96,4 +96,187 @@ namespace nau
         return alloc;
     }
 
-}
\ No newline at end of file
+    namespace
+    {
+        constexpr size_t FrameBlockAlignment = 16;
+
+        struct alignas(FrameBlockAlignment) FrameBlockHeader
+        {
+            size_t size;
+        };
+
+        inline constexpr size_t alignFrameBlockSize(size_t size)
+        {
+            return (size + FrameBlockAlignment - 1) & ~(FrameBlockAlignment - 1);
+        }
+
+        inline FrameBlockHeader* getFrameBlockHeader(const void* ptr)
+        {
+            return const_cast<FrameBlockHeader*>(reinterpret_cast<const FrameBlockHeader*>(ptr) - 1);
+        }
+    }  // namespace
+
+    BufferedFrameAllocator::FrameArena::~FrameArena()
+    {
+        while (pages)
+        {
+            MemPage* const next = pages->getNext();
+            MemPage::freeMemPage(pages);
+            pages = next;
+        }
+    }
+
+    void* BufferedFrameAllocator::FrameArena::allocate(size_t blockSize, size_t pageSize, bool useLargePages)
+    {
+        if (static_cast<size_t>(end - top) < blockSize)
+        {
+            // Pages that are left from the previous frames are reused first.
+            MemPage* nextPage = currentPage ? currentPage->getNext() : pages;
+            if (!nextPage || nextPage->getSize() < blockSize)
+            {
+                MemPage* const newPage = MemPage::allocateMemPage(std::max(blockSize, pageSize), FrameBlockAlignment, useLargePages);
+                NAU_FATAL(newPage, "Out of memory");
+                if (currentPage)
+                {
+                    newPage->setNext(currentPage->getNext());
+                    currentPage->setNext(newPage);
+                }
+                else
+                {
+                    newPage->setNext(pages);
+                    pages = newPage;
+                }
+                nextPage = newPage;
+            }
+
+            currentPage = nextPage;
+            top = static_cast<char*>(currentPage->getAddress());
+            end = top + currentPage->getSize();
+        }
+
+        void* const block = top;
+        top += blockSize;
+        return block;
+    }
+
+    void BufferedFrameAllocator::FrameArena::reset()
+    {
+        currentPage = nullptr;
+        top = nullptr;
+        end = nullptr;
+    }
+
+    BufferedFrameAllocator::BufferedFrameAllocator(size_t framesCount, bool useExternalFence, size_t pageSize, bool useLargePages) :
+        m_framesCount(framesCount),
+        m_pageSize(alignFrameBlockSize(pageSize)),
+        m_useExternalFence(useExternalFence),
+        m_useLargePages(useLargePages)
+    {
+        NAU_ASSERT(m_framesCount > 0 && m_framesCount <= MaxFramesCount);
+        NAU_ASSERT(m_pageSize > 0);
+        m_name.value() = "BufferedFrameAllocator";
+    }
+
+    BufferedFrameAllocator::~BufferedFrameAllocator() = default;
+
+    bool BufferedFrameAllocator::prepareFrame()
+    {
+        const uint64_t frameIndex = m_frameIndex + 1;
+        const size_t slot = static_cast<size_t>(frameIndex % m_framesCount);
+
+        if (!m_useExternalFence && frameIndex >= m_framesCount)
+        {
+            completeFrame(frameIndex - m_framesCount);
+        }
+
+        // Frame that used the slot is still in use by the consumer: slot keeps growing and is reclaimed later.
+        if (m_slotFrameIndices[slot] < m_completedFramesCount.load(std::memory_order_acquire))
+        {
+            m_threadArenas.visitAll([slot](ThreadArenas& arenas)
+            {
+                arenas.frames[slot].reset();
+            });
+        }
+
+        m_slotFrameIndices[slot] = frameIndex;
+        m_frameIndex = frameIndex;
+        m_currentSlot.store(slot, std::memory_order_release);
+
+        return true;
+    }
+
+    void BufferedFrameAllocator::completeFrame(uint64_t frameIndex)
+    {
+        uint64_t completedCount = m_completedFramesCount.load(std::memory_order_relaxed);
+        while (completedCount <= frameIndex && !m_completedFramesCount.compare_exchange_weak(completedCount, frameIndex + 1, std::memory_order_release))
+        {
+        }
+    }
+
+    uint64_t BufferedFrameAllocator::getFrameIndex() const
+    {
+        return m_frameIndex;
+    }
+
+    size_t BufferedFrameAllocator::getFramesCount() const
+    {
+        return m_framesCount;
+    }
+
+    void* BufferedFrameAllocator::allocate(size_t size)
+    {
+        const size_t slot = m_currentSlot.load(std::memory_order_acquire);
+        FrameArena& arena = m_threadArenas.value().frames[slot];
+
+        auto* const header = reinterpret_cast<FrameBlockHeader*>(arena.allocate(sizeof(FrameBlockHeader) + alignFrameBlockSize(size), m_pageSize, m_useLargePages));
+        header->size = size;
+        return header + 1;
+    }
+
+    void* BufferedFrameAllocator::reallocate(void* ptr, size_t size)
+    {
+        if (!ptr)
+        {
+            return allocate(size);
+        }
+
+        FrameBlockHeader* const header = getFrameBlockHeader(ptr);
+        const size_t oldSize = header->size;
+        if (size <= oldSize)
+        {
+            return ptr;
+        }
+
+        // Typical case for the growing vector: block is the last allocation of the thread and the page has enough space.
+        FrameArena& arena = m_threadArenas.value().frames[m_currentSlot.load(std::memory_order_acquire)];
+        char* const blockEnd = static_cast<char*>(ptr) + alignFrameBlockSize(oldSize);
+        if (blockEnd == arena.top)
+        {
+            const size_t extraSize = alignFrameBlockSize(size) - alignFrameBlockSize(oldSize);
+            if (static_cast<size_t>(arena.end - arena.top) >= extraSize)
+            {
+                arena.top += extraSize;
+                header->size = size;
+                return ptr;
+            }
+        }
+
+        void* const newPtr = allocate(size);
+        memcpy(newPtr, ptr, oldSize);
+        return newPtr;
+    }
+
+    void BufferedFrameAllocator::deallocate([[maybe_unused]] void* ptr)
+    {
+    }
+
+    size_t BufferedFrameAllocator::getSize(const void* ptr) const
+    {
+        if (!ptr)
+        {
+            return 0;
+        }
+
+        return getFrameBlockHeader(ptr)->size;
+    }
+}
@@ -5,13 +5,24 @@
 #include "nau/memory/mem_allocator.h"
 #include "nau/memory/nau_allocator_wrapper.h"
 #include "nau/memory/general_allocator.h"
+#include "nau/memory/slab_allocator.h"
 #include "nau/rtti/rtti_impl.h"
 
+// Selects the SlabAllocator (no per-block header, size class is found by the slab address) as the default allocator.
+// Define as 0 to fall back to the GeneralAllocator.
+#if !defined(NAU_MEMORY_SLAB_DEFAULT_ALLOCATOR)
+    #define NAU_MEMORY_SLAB_DEFAULT_ALLOCATOR 1
+#endif
+
 namespace nau
 {
     const IMemAllocator::Ptr& getDefaultAllocator()
     {
+#if NAU_MEMORY_SLAB_DEFAULT_ALLOCATOR
+        static IMemAllocator::Ptr defaultAlloc = eastl::make_shared<SlabAllocator>();
+#else
         static IMemAllocator::Ptr defaultAlloc = eastl::make_shared<GeneralAllocator>();
+#endif
         return defaultAlloc;
     }
 
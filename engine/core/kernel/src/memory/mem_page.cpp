@@ -4,11 +4,143 @@
 
 #include "nau/memory/mem_page.h"
 #include "nau/memory/mem_allocator.h"
+#include "nau/memory/memory_stats.h"
 #include "nau/diag/assertion.h"
 #include <cstddef>
+#include <cstdio>
+#include <cstring>
+
+#if defined(NAU_PLATFORM_WIN32)
+    #include "nau/platform/windows/windows_headers.h"
+#elif defined(__linux__)
+    #include <sys/mman.h>
+#endif
 
 namespace nau
 {
+    namespace
+    {
+#if defined(NAU_PLATFORM_WIN32)
+        /**
+            MEM_LARGE_PAGES requires the "Lock pages in memory" privilege: it must be granted to the user and enabled for the process token.
+         */
+        bool enableLockMemoryPrivilege()
+        {
+            HANDLE token = nullptr;
+            if (!OpenProcessToken(GetCurrentProcess(), TOKEN_ADJUST_PRIVILEGES | TOKEN_QUERY, &token))
+            {
+                return false;
+            }
+
+            TOKEN_PRIVILEGES privileges{};
+            privileges.PrivilegeCount = 1;
+            privileges.Privileges[0].Attributes = SE_PRIVILEGE_ENABLED;
+
+            // AdjustTokenPrivileges succeeds with ERROR_NOT_ALL_ASSIGNED when the privilege is not granted.
+            const bool isEnabled = LookupPrivilegeValueW(nullptr, SE_LOCK_MEMORY_NAME, &privileges.Privileges[0].Luid) &&
+                                   AdjustTokenPrivileges(token, FALSE, &privileges, 0, nullptr, nullptr) &&
+                                   GetLastError() == ERROR_SUCCESS;
+
+            CloseHandle(token);
+            return isEnabled;
+        }
+
+        /**
+            Zero if the large pages are not available.
+         */
+        size_t getLargePageSize()
+        {
+            static const size_t largePageSize = enableLockMemoryPrivilege() ? GetLargePageMinimum() : 0;
+            return largePageSize;
+        }
+
+        void* allocateLargePages(size_t size)
+        {
+            return VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+        }
+
+        void freeLargePages(void* ptr, [[maybe_unused]] size_t size)
+        {
+            VirtualFree(ptr, 0, MEM_RELEASE);
+        }
+#elif defined(__linux__)
+        constexpr size_t HugePageSize = 2 * 1024 * 1024;
+
+        /**
+            The transparent huge pages are used for the madvise'd memory in the "always" and the "madvise" modes, but not in the "never" mode.
+         */
+        size_t getLargePageSize()
+        {
+            static const size_t largePageSize = []() -> size_t
+            {
+                FILE* const file = fopen("/sys/kernel/mm/transparent_hugepage/enabled", "r");
+                if (!file)
+                {
+                    return 0;
+                }
+
+                char mode[64] = {};
+                const bool isRead = fgets(mode, sizeof(mode), file) != nullptr;
+                fclose(file);
+
+                return isRead && !strstr(mode, "[never]") ? HugePageSize : 0;
+            }();
+
+            return largePageSize;
+        }
+
+        /**
+            The mapping is aligned by the huge page size, otherwise the kernel can not back its head and tail with the huge pages.
+            The huge pages are assigned by the kernel on the page faults (or later by khugepaged), so the memory is eligible but not guaranteed to get them.
+         */
+        void* allocateLargePages(size_t size)
+        {
+            const size_t mappedSize = size + HugePageSize;
+            void* const mapped = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (mapped == MAP_FAILED)
+            {
+                return nullptr;
+            }
+
+            const uintptr_t begin = reinterpret_cast<uintptr_t>(mapped);
+            const uintptr_t alignedBegin = (begin + HugePageSize - 1) & ~(HugePageSize - 1);
+            if (alignedBegin > begin)
+            {
+                munmap(mapped, alignedBegin - begin);
+            }
+            munmap(reinterpret_cast<void*>(alignedBegin + size), begin + mappedSize - alignedBegin - size);
+
+            void* const ptr = reinterpret_cast<void*>(alignedBegin);
+            if (madvise(ptr, size, MADV_HUGEPAGE) != 0)
+            {
+                munmap(ptr, size);
+                return nullptr;
+            }
+
+            return ptr;
+        }
+
+        void freeLargePages(void* ptr, size_t size)
+        {
+            munmap(ptr, size);
+        }
+#else
+        size_t getLargePageSize()
+        {
+            return 0;
+        }
+
+        void* allocateLargePages([[maybe_unused]] size_t size)
+        {
+            return nullptr;
+        }
+
+        void freeLargePages([[maybe_unused]] void* ptr, [[maybe_unused]] size_t size)
+        {
+        }
+#endif
+    }  // namespace
+
     [[nodiscard]]
     bool MemPage::contains(void* address) const
     {
@@ -19,6 +151,7 @@ namespace nau
     [[nodiscard]] size_t MemPage::getAlignedSize() const { return m_alligned; }
     [[nodiscard]] MemPage* MemPage::getNext() const { return m_next; }
     [[nodiscard]] void* MemPage::getAddress() const { return m_address; }
+    [[nodiscard]] bool MemPage::isLargePage() const { return m_isLargePage; }
     
     MemPage::MemPage(size_t size, size_t alignment)
     {
@@ -35,21 +168,60 @@ namespace nau
         );
     }
 
-    [[nodiscard]] MemPage* MemPage::allocateMemPage(size_t size, size_t alignment)
+    [[nodiscard]] MemPage* MemPage::allocateMemPage(size_t size, size_t alignment, bool useLargePages)
     {
         NAU_ASSERT(isPowerOf2(alignment), "requested alignment is not a power of 2");
 
         alignment = (alignment < alignof(std::max_align_t)) ? alignof(std::max_align_t) : alignment;
         auto pageSize = sizeof(MemPage) + size + alignment - 1;
+
+        const size_t largePageSize = useLargePages ? getLargePageSize() : 0;
+        if (largePageSize > 0)
+        {
+            pageSize = (pageSize + largePageSize - 1) & ~(largePageSize - 1);
+            if (void* const mem = allocateLargePages(pageSize))
+            {
+                auto page = new(mem) MemPage(size, alignment);
+                page->m_size = static_cast<BytePtr>(mem) + pageSize - static_cast<BytePtr>(page->m_address);
+                page->m_allocationSize = pageSize;
+                page->m_isLargePageRequested = true;
+                page->m_isLargePage = true;
+                memory_detail::onLargePageMemoryReserved(pageSize, pageSize);
+
+                return page;
+            }
+        }
+
         auto page = new(malloc(pageSize)) MemPage(size, alignment);
         NAU_ASSERT(page, "MemPage page allocation failed");
 
+        page->m_allocationSize = pageSize;
+        page->m_isLargePageRequested = useLargePages;
+        if (useLargePages)
+        {
+            memory_detail::onLargePageMemoryReserved(pageSize, 0);
+        }
+
         return page;
     }
 
     void MemPage::freeMemPage(MemPage* page)
     {
+        const size_t allocationSize = page->m_allocationSize;
+        const bool isLargePage = page->m_isLargePage;
+        if (page->m_isLargePageRequested)
+        {
+            memory_detail::onLargePageMemoryReleased(allocationSize, isLargePage ? allocationSize : 0);
+        }
+
         page->~MemPage();
-        free(page);
+        if (isLargePage)
+        {
+            freeLargePages(page, allocationSize);
+        }
+        else
+        {
+            free(page);
+        }
     }
 }
@@ -33,13 +33,34 @@ namespace nau
         return m_pageSize;
     }
 
+    void MemSection::setLargePages(bool useLargePages)
+    {
+        m_useLargePages = useLargePages;
+    }
+
+    bool MemSection::isLargePages() const
+    {
+        return m_useLargePages;
+    }
+
+    size_t MemSection::getLargePageBytes() const
+    {
+        size_t size = 0;
+        for (auto it = m_rootPage; it; it = it->getNext())
+        {
+            if (it->isLargePage())
+                size += it->getSize();
+        }
+        return size;
+    }
+
 
     void* MemSection::allocate(size_t size, size_t alignment)
     {
         auto pageSize = std::max(size, m_pageSize);
         if (!m_rootPage)
         {
-            m_currentPage = m_rootPage = MemPage::allocateMemPage(pageSize, alignment);
+            m_currentPage = m_rootPage = MemPage::allocateMemPage(pageSize, alignment, m_useLargePages);
             m_free = m_currentPage->getAddress();
             NAU_ASSERT(m_free, "MemSection memory allocation failed");
         }
@@ -52,7 +73,7 @@ namespace nau
             }
             else
             {
-                auto newPage = MemPage::allocateMemPage(pageSize, alignment);
+                auto newPage = MemPage::allocateMemPage(pageSize, alignment, m_useLargePages);
                 m_currentPage->setNext(newPage);
                 m_currentPage = newPage;
                 m_free = m_currentPage->getAddress();
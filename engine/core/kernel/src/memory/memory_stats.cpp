@@ -0,0 +1,268 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "nau/memory/memory_stats.h"
+
+#include <atomic>
+#include <mutex>
+
+namespace nau
+{
+    namespace
+    {
+        static_assert(static_cast<size_t>(MemoryTag::Ui) + 1 == MemoryTagsCount);
+
+        struct TagCounters
+        {
+            std::atomic<uint64_t> allocatedBytes = 0;
+            std::atomic<uint64_t> freedBytes = 0;
+            std::atomic<uint64_t> allocations = 0;
+            std::atomic<uint64_t> deallocations = 0;
+        };
+
+        // Counter has the single writer: plain load/store is enough and much cheaper than fetch_add.
+        inline void addOwned(std::atomic<uint64_t>& counter, uint64_t value)
+        {
+            counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+        }
+
+        /**
+            Counters are owned by the thread, but can be read by anyone while the thread is registered.
+            Registry does not allocate anything: it is used from within the allocators.
+         */
+        struct alignas(64) ThreadMemoryCounters
+        {
+            TagCounters tags[MemoryTagsCount];
+            ThreadMemoryCounters* prev = nullptr;
+            ThreadMemoryCounters* next = nullptr;
+
+            ThreadMemoryCounters();
+            ~ThreadMemoryCounters();
+        };
+
+        struct MemoryStatsRegistry
+        {
+            std::mutex mutex;
+            ThreadMemoryCounters* threads = nullptr;
+
+            // Counters of the finished threads and of the allocations that are made while thread locals are destructed.
+            TagCounters sharedTags[MemoryTagsCount];
+
+            std::atomic<int64_t> peakBytes[MemoryTagsCount] = {};
+            std::atomic<size_t> budgetBytes[MemoryTagsCount] = {};
+            std::atomic<size_t> slabReservedBytes = 0;
+            std::atomic<size_t> largePageRequestedBytes = 0;
+            std::atomic<size_t> largePageBytes = 0;
+
+            static MemoryStatsRegistry& instance()
+            {
+                // Intentionally never destroyed: memory can be released while static objects are destructed.
+                static MemoryStatsRegistry* const registry = new MemoryStatsRegistry;
+                return *registry;
+            }
+        };
+
+        thread_local MemoryTag s_currentMemoryTag = MemoryTag::Default;
+        thread_local ThreadMemoryCounters s_threadMemoryCounters;
+
+        // Trivially destructible flag: remains valid while thread local objects are destructed.
+        thread_local bool s_threadMemoryCountersDestroyed = false;
+
+        ThreadMemoryCounters::ThreadMemoryCounters()
+        {
+            MemoryStatsRegistry& registry = MemoryStatsRegistry::instance();
+            const std::lock_guard lock{registry.mutex};
+
+            next = registry.threads;
+            if (next)
+            {
+                next->prev = this;
+            }
+            registry.threads = this;
+        }
+
+        ThreadMemoryCounters::~ThreadMemoryCounters()
+        {
+            s_threadMemoryCountersDestroyed = true;
+
+            MemoryStatsRegistry& registry = MemoryStatsRegistry::instance();
+            const std::lock_guard lock{registry.mutex};
+
+            for (size_t i = 0; i < MemoryTagsCount; ++i)
+            {
+                registry.sharedTags[i].allocatedBytes.fetch_add(tags[i].allocatedBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+                registry.sharedTags[i].freedBytes.fetch_add(tags[i].freedBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+                registry.sharedTags[i].allocations.fetch_add(tags[i].allocations.load(std::memory_order_relaxed), std::memory_order_relaxed);
+                registry.sharedTags[i].deallocations.fetch_add(tags[i].deallocations.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            }
+
+            if (prev)
+            {
+                prev->next = next;
+            }
+            else
+            {
+                registry.threads = next;
+            }
+
+            if (next)
+            {
+                next->prev = prev;
+            }
+        }
+    }  // namespace
+
+    MemoryTagScope::MemoryTagScope(MemoryTag tag) :
+        m_prevTag(s_currentMemoryTag)
+    {
+        s_currentMemoryTag = tag;
+    }
+
+    MemoryTagScope::~MemoryTagScope()
+    {
+        s_currentMemoryTag = m_prevTag;
+    }
+
+    MemoryTag getCurrentMemoryTag()
+    {
+        return s_currentMemoryTag;
+    }
+
+    double MemoryStatsSnapshot::getAllocationsRate(const MemoryStatsSnapshot& prev, MemoryTag tag) const
+    {
+        const std::chrono::duration<double> elapsed = timestamp - prev.timestamp;
+        if (elapsed.count() <= 0.0)
+        {
+            return 0.0;
+        }
+
+        return static_cast<double>((*this)[tag].allocationsCount - prev[tag].allocationsCount) / elapsed.count();
+    }
+
+    double MemoryStatsSnapshot::getAllocatedBytesRate(const MemoryStatsSnapshot& prev, MemoryTag tag) const
+    {
+        const std::chrono::duration<double> elapsed = timestamp - prev.timestamp;
+        if (elapsed.count() <= 0.0)
+        {
+            return 0.0;
+        }
+
+        return static_cast<double>((*this)[tag].allocatedBytesTotal - prev[tag].allocatedBytesTotal) / elapsed.count();
+    }
+
+    MemoryStatsSnapshot getMemoryStatsSnapshot()
+    {
+        MemoryStatsRegistry& registry = MemoryStatsRegistry::instance();
+
+        uint64_t allocatedBytes[MemoryTagsCount] = {};
+        uint64_t freedBytes[MemoryTagsCount] = {};
+
+        MemoryStatsSnapshot snapshot;
+        snapshot.timestamp = std::chrono::steady_clock::now();
+
+        {
+            const std::lock_guard lock{registry.mutex};
+
+            const auto collect = [&](const TagCounters(&tags)[MemoryTagsCount])
+            {
+                for (size_t i = 0; i < MemoryTagsCount; ++i)
+                {
+                    allocatedBytes[i] += tags[i].allocatedBytes.load(std::memory_order_relaxed);
+                    freedBytes[i] += tags[i].freedBytes.load(std::memory_order_relaxed);
+                    snapshot.tags[i].allocationsCount += tags[i].allocations.load(std::memory_order_relaxed);
+                    snapshot.tags[i].deallocationsCount += tags[i].deallocations.load(std::memory_order_relaxed);
+                }
+            };
+
+            collect(registry.sharedTags);
+            for (const ThreadMemoryCounters* thread = registry.threads; thread; thread = thread->next)
+            {
+                collect(thread->tags);
+            }
+        }
+
+        for (size_t i = 0; i < MemoryTagsCount; ++i)
+        {
+            MemoryTagStats& tagStats = snapshot.tags[i];
+            tagStats.allocatedBytesTotal = allocatedBytes[i];
+
+            // Block can be freed on the other thread than allocated, so the per-thread values are meaningful only in sum.
+            tagStats.currentBytes = static_cast<int64_t>(allocatedBytes[i] - freedBytes[i]);
+            tagStats.budgetBytes = registry.budgetBytes[i].load(std::memory_order_relaxed);
+
+            int64_t peakBytes = registry.peakBytes[i].load(std::memory_order_relaxed);
+            while (peakBytes < tagStats.currentBytes && !registry.peakBytes[i].compare_exchange_weak(peakBytes, tagStats.currentBytes, std::memory_order_relaxed))
+            {
+            }
+            tagStats.peakBytes = std::max(peakBytes, tagStats.currentBytes);
+        }
+
+        snapshot.slabReservedBytes = registry.slabReservedBytes.load(std::memory_order_relaxed);
+        snapshot.largePageRequestedBytes = registry.largePageRequestedBytes.load(std::memory_order_relaxed);
+        snapshot.largePageBytes = registry.largePageBytes.load(std::memory_order_relaxed);
+
+        return snapshot;
+    }
+
+    void setMemoryBudget(MemoryTag tag, size_t budgetBytes)
+    {
+        MemoryStatsRegistry::instance().budgetBytes[static_cast<size_t>(tag)].store(budgetBytes, std::memory_order_relaxed);
+    }
+
+}  // namespace nau
+
+namespace nau::memory_detail
+{
+    void onMemoryAllocated(MemoryTag tag, size_t size)
+    {
+        const size_t tagIndex = static_cast<size_t>(tag);
+        if (NAU_UNLIKELY(s_threadMemoryCountersDestroyed))
+        {
+            TagCounters& counters = MemoryStatsRegistry::instance().sharedTags[tagIndex];
+            counters.allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+            counters.allocations.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        TagCounters& counters = s_threadMemoryCounters.tags[tagIndex];
+        addOwned(counters.allocatedBytes, size);
+        addOwned(counters.allocations, 1);
+    }
+
+    void onMemoryFreed(MemoryTag tag, size_t size)
+    {
+        const size_t tagIndex = static_cast<size_t>(tag);
+        if (NAU_UNLIKELY(s_threadMemoryCountersDestroyed))
+        {
+            TagCounters& counters = MemoryStatsRegistry::instance().sharedTags[tagIndex];
+            counters.freedBytes.fetch_add(size, std::memory_order_relaxed);
+            counters.deallocations.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        TagCounters& counters = s_threadMemoryCounters.tags[tagIndex];
+        addOwned(counters.freedBytes, size);
+        addOwned(counters.deallocations, 1);
+    }
+
+    void onSlabMemoryReserved(size_t size)
+    {
+        MemoryStatsRegistry::instance().slabReservedBytes.fetch_add(size, std::memory_order_relaxed);
+    }
+
+    void onLargePageMemoryReserved(size_t requestedSize, size_t largePageSize)
+    {
+        MemoryStatsRegistry& registry = MemoryStatsRegistry::instance();
+        registry.largePageRequestedBytes.fetch_add(requestedSize, std::memory_order_relaxed);
+        registry.largePageBytes.fetch_add(largePageSize, std::memory_order_relaxed);
+    }
+
+    void onLargePageMemoryReleased(size_t requestedSize, size_t largePageSize)
+    {
+        MemoryStatsRegistry& registry = MemoryStatsRegistry::instance();
+        registry.largePageRequestedBytes.fetch_sub(requestedSize, std::memory_order_relaxed);
+        registry.largePageBytes.fetch_sub(largePageSize, std::memory_order_relaxed);
+    }
+
+}  // namespace nau::memory_detail
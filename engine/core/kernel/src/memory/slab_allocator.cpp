@@ -0,0 +1,575 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "nau/memory/slab_allocator.h"
+
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+
+#include "nau/diag/assertion.h"
+#include "nau/memory/memory_stats.h"
+#include "nau/threading/spin_lock.h"
+
+namespace nau
+{
+    namespace
+    {
+        constexpr size_t SlabSizeLog2 = 16;  // 64KB
+        constexpr size_t SlabSize = size_t{1} << SlabSizeLog2;
+
+        // Slabs are requested from the system heap by chunks and never returned back.
+        constexpr size_t SlabsPerChunk = 16;
+
+        // Page table covers 48 bits of the address space: two levels with 16 bits of the slab index for each level.
+        constexpr size_t AddressBits = 48;
+        constexpr size_t PageTableLevelBits = (AddressBits - SlabSizeLog2) / 2;
+        constexpr size_t PageTableLevelSize = size_t{1} << PageTableLevelBits;
+
+        constexpr size_t SizeClassGranularity = 16;
+        constexpr size_t MaxSlabBlockSize = SlabAllocator::getMaxSlabBlockSize();
+
+        constexpr std::array<uint16_t, 20> SizeClassBlockSizes = {
+            16, 32, 48, 64, 80, 96, 112, 128,
+            160, 192, 224, 256,
+            320, 384, 448, 512,
+            640, 768, 896, 1024};
+
+        constexpr size_t SizeClassesCount = SizeClassBlockSizes.size();
+
+        static_assert(SizeClassBlockSizes.back() == MaxSlabBlockSize);
+
+        // Blocks of the different memory tags never share the slab: the tag of the block is also found by the slab address.
+        constexpr size_t BinsCount = SizeClassesCount * MemoryTagsCount;
+        static_assert(BinsCount < 255, "Bin (+1) must fit into the page table entry");
+
+        // Blocks moved between the thread cache and the shared lists at once.
+        constexpr size_t BatchBytes = 16 * 1024;
+        constexpr size_t MinBatchBlocks = 16;
+
+        /**
+            Maps (size + 15) / 16 to the size class index.
+         */
+        constexpr auto SizeToClassTable = []
+        {
+            std::array<uint8_t, MaxSlabBlockSize / SizeClassGranularity + 1> table = {};
+            size_t sizeClass = 0;
+            for (size_t i = 0; i < table.size(); ++i)
+            {
+                while (SizeClassBlockSizes[sizeClass] < i * SizeClassGranularity)
+                {
+                    ++sizeClass;
+                }
+                table[i] = static_cast<uint8_t>(sizeClass);
+            }
+            return table;
+        }();
+
+        inline size_t getSizeClass(size_t size)
+        {
+            NAU_ASSERT(size <= MaxSlabBlockSize);
+            return SizeToClassTable[(size + SizeClassGranularity - 1) / SizeClassGranularity];
+        }
+
+        inline size_t getClassBlockSize(size_t sizeClass)
+        {
+            return SizeClassBlockSizes[sizeClass];
+        }
+
+        inline size_t getClassBatchBlocks(size_t sizeClass)
+        {
+            return std::max(BatchBytes / getClassBlockSize(sizeClass), MinBatchBlocks);
+        }
+
+        inline size_t makeBin(size_t sizeClass, MemoryTag tag)
+        {
+            return static_cast<size_t>(tag) * SizeClassesCount + sizeClass;
+        }
+
+        inline MemoryTag getBinTag(size_t bin)
+        {
+            return static_cast<MemoryTag>(bin / SizeClassesCount);
+        }
+
+        inline size_t getBinBlockSize(size_t bin)
+        {
+            return getClassBlockSize(bin % SizeClassesCount);
+        }
+
+        inline size_t getBinBatchBlocks(size_t bin)
+        {
+            return getClassBatchBlocks(bin % SizeClassesCount);
+        }
+
+        /**
+            Free block is used to build two level list: blocks within the batch are linked by the next,
+            batches are linked by the nextBatch (meaningful only for the batch head).
+            Requires minimal block size of the 16 bytes.
+         */
+        struct FreeBlock
+        {
+            FreeBlock* next;
+            FreeBlock* nextBatch;
+        };
+
+        static_assert(sizeof(FreeBlock) <= SizeClassBlockSizes.front());
+
+        /**
+            Page table: slab index -> bin + 1 (zero means the address is not owned by the slab heap).
+            Leaves are allocated on demand and never released.
+         */
+        using PageTableLeaf = std::atomic<uint8_t>;
+        static_assert(sizeof(PageTableLeaf) == sizeof(uint8_t));
+
+        std::atomic<PageTableLeaf*> s_pageTable[PageTableLevelSize];
+
+        inline size_t getSlabBinEntry(const void* ptr)
+        {
+            const uint64_t address = reinterpret_cast<uintptr_t>(ptr);
+            if ((address >> AddressBits) != 0)
+            {
+                return 0;
+            }
+
+            const uint64_t slabIndex = address >> SlabSizeLog2;
+            const PageTableLeaf* const leaf = s_pageTable[slabIndex >> PageTableLevelBits].load(std::memory_order_acquire);
+            return leaf ? leaf[slabIndex & (PageTableLevelSize - 1)].load(std::memory_order_relaxed) : 0;
+        }
+
+        void registerSlab(void* slab, size_t bin)
+        {
+            const uint64_t address = reinterpret_cast<uintptr_t>(slab);
+            NAU_FATAL((address >> AddressBits) == 0, "Slab address is out of the page table range");
+
+            const uint64_t slabIndex = address >> SlabSizeLog2;
+            std::atomic<PageTableLeaf*>& leafRef = s_pageTable[slabIndex >> PageTableLevelBits];
+
+            PageTableLeaf* leaf = leafRef.load(std::memory_order_acquire);
+            if (!leaf)
+            {
+                auto* const newLeaf = reinterpret_cast<PageTableLeaf*>(::calloc(PageTableLevelSize, sizeof(PageTableLeaf)));
+                NAU_FATAL(newLeaf, "Out of memory");
+
+                if (leafRef.compare_exchange_strong(leaf, newLeaf, std::memory_order_acq_rel))
+                {
+                    leaf = newLeaf;
+                }
+                else
+                {
+                    ::free(newLeaf);
+                }
+            }
+
+            leaf[slabIndex & (PageTableLevelSize - 1)].store(static_cast<uint8_t>(bin + 1), std::memory_order_relaxed);
+        }
+
+        /**
+            Shared part of the slab heap: slab chunks and per-class lists of the blocks that are moved from the thread caches.
+         */
+        class SlabHeap
+        {
+        public:
+            static SlabHeap& instance()
+            {
+                // Intentionally never destroyed: blocks can be released while static objects are destructed.
+                static SlabHeap* const heap = new SlabHeap;
+                return *heap;
+            }
+
+            char* allocateSlab(size_t bin)
+            {
+                char* slab = nullptr;
+                {
+                    lock_(m_chunkMutex);
+                    if (m_chunkCurrent == m_chunkEnd)
+                    {
+                        void* const chunk = ::malloc(SlabsPerChunk * SlabSize + SlabSize - 1);
+                        NAU_FATAL(chunk, "Out of memory");
+                        memory_detail::onSlabMemoryReserved(SlabsPerChunk * SlabSize + SlabSize - 1);
+
+                        const uintptr_t alignedChunk = (reinterpret_cast<uintptr_t>(chunk) + SlabSize - 1) & ~(SlabSize - 1);
+                        m_chunkCurrent = reinterpret_cast<char*>(alignedChunk);
+                        m_chunkEnd = m_chunkCurrent + SlabsPerChunk * SlabSize;
+                    }
+
+                    slab = m_chunkCurrent;
+                    m_chunkCurrent += SlabSize;
+                }
+
+                registerSlab(slab, bin);
+                return slab;
+            }
+
+            /**
+                Returns the list of the blocks (terminated by nullptr) or nullptr if there is no free blocks.
+             */
+            FreeBlock* popBlocks(size_t bin, size_t& outCount)
+            {
+                BinList& list = m_binLists[bin];
+                if (!list.hasBlocks.load(std::memory_order_relaxed))
+                {
+                    return nullptr;
+                }
+
+                lock_(list.mutex);
+
+                if (FreeBlock* const batch = list.batches)
+                {
+                    list.batches = batch->nextBatch;
+                    outCount = getBinBatchBlocks(bin);
+                    list.updateHasBlocks();
+                    return batch;
+                }
+
+                FreeBlock* const head = list.loose;
+                FreeBlock* tail = head;
+                outCount = 0;
+                for (const size_t maxCount = getBinBatchBlocks(bin); tail && ++outCount < maxCount;)
+                {
+                    tail = tail->next;
+                }
+
+                if (tail)
+                {
+                    list.loose = tail->next;
+                    tail->next = nullptr;
+                }
+                else
+                {
+                    list.loose = nullptr;
+                }
+
+                list.updateHasBlocks();
+                return head;
+            }
+
+            /**
+                Takes ownership over the list of exactly getBinBatchBlocks(bin) blocks.
+             */
+            void pushBatch(size_t bin, FreeBlock* batch)
+            {
+                BinList& list = m_binLists[bin];
+                lock_(list.mutex);
+                batch->nextBatch = list.batches;
+                list.batches = batch;
+                list.updateHasBlocks();
+            }
+
+            void pushLoose(size_t bin, FreeBlock* head, FreeBlock* tail)
+            {
+                BinList& list = m_binLists[bin];
+                lock_(list.mutex);
+                tail->next = list.loose;
+                list.loose = head;
+                list.updateHasBlocks();
+            }
+
+            /**
+                Used when the thread cache is not available (thread local objects are destructed).
+             */
+            void* allocateUncached(size_t bin)
+            {
+                size_t count = 0;
+                FreeBlock* const blocks = popBlocks(bin, count);
+                if (blocks)
+                {
+                    if (FreeBlock* const rest = blocks->next)
+                    {
+                        FreeBlock* tail = rest;
+                        while (tail->next)
+                        {
+                            tail = tail->next;
+                        }
+                        pushLoose(bin, rest, tail);
+                    }
+                    return blocks;
+                }
+
+                // Rare case: the whole slab is carved into the shared list.
+                const size_t blockSize = getBinBlockSize(bin);
+                char* const slab = allocateSlab(bin);
+                FreeBlock* head = nullptr;
+                FreeBlock* tail = nullptr;
+                for (char* block = slab + blockSize; block + blockSize <= slab + SlabSize; block += blockSize)
+                {
+                    auto* const freeBlock = reinterpret_cast<FreeBlock*>(block);
+                    freeBlock->next = head;
+                    head = freeBlock;
+                    tail = tail ? tail : freeBlock;
+                }
+
+                if (head)
+                {
+                    pushLoose(bin, head, tail);
+                }
+
+                return slab;
+            }
+
+        private:
+            struct alignas(64) BinList
+            {
+                threading::SpinLock mutex;
+                FreeBlock* batches = nullptr;
+                FreeBlock* loose = nullptr;
+                std::atomic_bool hasBlocks = false;
+
+                void updateHasBlocks()
+                {
+                    hasBlocks.store(batches != nullptr || loose != nullptr, std::memory_order_relaxed);
+                }
+            };
+
+            threading::SpinLock m_chunkMutex;
+            char* m_chunkCurrent = nullptr;
+            char* m_chunkEnd = nullptr;
+
+            BinList m_binLists[BinsCount];
+        };
+
+        struct ThreadSlabCache
+        {
+            struct BinCache
+            {
+                FreeBlock* freeList = nullptr;
+                size_t freeCount = 0;
+                char* bumpCurrent = nullptr;
+                char* bumpEnd = nullptr;
+            };
+
+            BinCache bins[BinsCount];
+
+            ~ThreadSlabCache();
+
+            void* allocate(size_t bin)
+            {
+                BinCache& cache = bins[bin];
+                if (FreeBlock* const block = cache.freeList)
+                {
+                    cache.freeList = block->next;
+                    --cache.freeCount;
+                    return block;
+                }
+
+                const size_t blockSize = getBinBlockSize(bin);
+                if (cache.bumpCurrent + blockSize <= cache.bumpEnd)
+                {
+                    void* const block = cache.bumpCurrent;
+                    cache.bumpCurrent += blockSize;
+                    return block;
+                }
+
+                size_t count = 0;
+                if (FreeBlock* const blocks = SlabHeap::instance().popBlocks(bin, count))
+                {
+                    cache.freeList = blocks->next;
+                    cache.freeCount = count - 1;
+                    return blocks;
+                }
+
+                char* const slab = SlabHeap::instance().allocateSlab(bin);
+                cache.bumpCurrent = slab + blockSize;
+                cache.bumpEnd = slab + SlabSize;
+                return slab;
+            }
+
+            void free(void* ptr, size_t bin)
+            {
+                BinCache& cache = bins[bin];
+
+                auto* const block = reinterpret_cast<FreeBlock*>(ptr);
+                block->next = cache.freeList;
+                cache.freeList = block;
+
+                const size_t batchBlocks = getBinBatchBlocks(bin);
+                if (++cache.freeCount < batchBlocks * 2)
+                {
+                    return;
+                }
+
+                // Keep one batch in the cache and give the other away:
+                // this bounds the memory that single thread can hold when blocks travel between threads.
+                FreeBlock* const batch = cache.freeList;
+                FreeBlock* tail = batch;
+                for (size_t i = 1; i < batchBlocks; ++i)
+                {
+                    tail = tail->next;
+                }
+
+                cache.freeList = tail->next;
+                cache.freeCount -= batchBlocks;
+                tail->next = nullptr;
+
+                SlabHeap::instance().pushBatch(bin, batch);
+            }
+        };
+
+        thread_local ThreadSlabCache s_threadSlabCache;
+
+        // Trivially destructible flag: remains valid while thread local objects are destructed.
+        thread_local bool s_threadSlabCacheDestroyed = false;
+
+        ThreadSlabCache::~ThreadSlabCache()
+        {
+            s_threadSlabCacheDestroyed = true;
+
+            for (size_t bin = 0; bin < BinsCount; ++bin)
+            {
+                BinCache& cache = bins[bin];
+                const size_t blockSize = getBinBlockSize(bin);
+
+                // Not yet used part of the slab also goes to the shared list.
+                for (; cache.bumpCurrent + blockSize <= cache.bumpEnd; cache.bumpCurrent += blockSize)
+                {
+                    auto* const block = reinterpret_cast<FreeBlock*>(cache.bumpCurrent);
+                    block->next = cache.freeList;
+                    cache.freeList = block;
+                }
+
+                if (FreeBlock* const head = cache.freeList)
+                {
+                    FreeBlock* tail = head;
+                    while (tail->next)
+                    {
+                        tail = tail->next;
+                    }
+
+                    SlabHeap::instance().pushLoose(bin, head, tail);
+                }
+
+                cache = {};
+            }
+        }
+
+        /**
+            Blocks that are not served by slabs are allocated from the system heap with the header that keeps the requested size.
+         */
+        struct alignas(16) LargeBlockHeader
+        {
+            size_t size;
+            MemoryTag tag;
+        };
+
+        void* allocateLargeBlock(size_t size, MemoryTag tag)
+        {
+            auto* const header = reinterpret_cast<LargeBlockHeader*>(::malloc(sizeof(LargeBlockHeader) + size));
+            NAU_FATAL(header, "Out of memory");
+            header->size = size;
+            header->tag = tag;
+            memory_detail::onMemoryAllocated(tag, size);
+            return header + 1;
+        }
+
+        inline LargeBlockHeader* getLargeBlockHeader(const void* ptr)
+        {
+            return const_cast<LargeBlockHeader*>(reinterpret_cast<const LargeBlockHeader*>(ptr) - 1);
+        }
+
+    }  // namespace
+
+    bool SlabAllocator::isSlabPointer(const void* ptr)
+    {
+        return getSlabBinEntry(ptr) != 0;
+    }
+
+    SlabAllocator::SlabAllocator()
+    {
+        m_name.value() = "SlabAllocator";
+    }
+
+    void* SlabAllocator::allocate(size_t size)
+    {
+        const MemoryTag tag = getCurrentMemoryTag();
+        if (size > MaxSlabBlockSize)
+        {
+            return allocateLargeBlock(size, tag);
+        }
+
+        const size_t bin = makeBin(getSizeClass(size), tag);
+        memory_detail::onMemoryAllocated(tag, getBinBlockSize(bin));
+
+        if (NAU_UNLIKELY(s_threadSlabCacheDestroyed))
+        {
+            return SlabHeap::instance().allocateUncached(bin);
+        }
+
+        return s_threadSlabCache.allocate(bin);
+    }
+
+    void* SlabAllocator::reallocate(void* ptr, size_t size)
+    {
+        if (!ptr)
+        {
+            return allocate(size);
+        }
+
+        const size_t binEntry = getSlabBinEntry(ptr);
+        if (binEntry == 0 && size > MaxSlabBlockSize)
+        {
+            // Large block remains large: let the system heap to grow it in place if possible.
+            LargeBlockHeader* header = getLargeBlockHeader(ptr);
+            const MemoryTag tag = header->tag;
+            memory_detail::onMemoryFreed(tag, header->size);
+
+            header = reinterpret_cast<LargeBlockHeader*>(::realloc(header, sizeof(LargeBlockHeader) + size));
+            NAU_FATAL(header, "Out of memory");
+            header->size = size;
+            memory_detail::onMemoryAllocated(tag, size);
+            return header + 1;
+        }
+
+        const size_t oldSize = binEntry != 0 ? getBinBlockSize(binEntry - 1) : getLargeBlockHeader(ptr)->size;
+        if (binEntry != 0 && size <= oldSize)
+        {
+            return ptr;
+        }
+
+        void* const newPtr = allocate(size);
+        memcpy(newPtr, ptr, std::min(oldSize, size));
+        deallocate(ptr);
+        return newPtr;
+    }
+
+    void SlabAllocator::deallocate(void* ptr)
+    {
+        if (!ptr)
+        {
+            return;
+        }
+
+        const size_t binEntry = getSlabBinEntry(ptr);
+        if (binEntry == 0)
+        {
+            LargeBlockHeader* const header = getLargeBlockHeader(ptr);
+            memory_detail::onMemoryFreed(header->tag, header->size);
+            ::free(header);
+            return;
+        }
+
+        const size_t bin = binEntry - 1;
+        memory_detail::onMemoryFreed(getBinTag(bin), getBinBlockSize(bin));
+
+        if (NAU_UNLIKELY(s_threadSlabCacheDestroyed))
+        {
+            auto* const block = reinterpret_cast<FreeBlock*>(ptr);
+            SlabHeap::instance().pushLoose(bin, block, block);
+            return;
+        }
+
+        s_threadSlabCache.free(ptr, bin);
+    }
+
+    size_t SlabAllocator::getSize(const void* ptr) const
+    {
+        if (!ptr)
+        {
+            return 0;
+        }
+
+        const size_t binEntry = getSlabBinEntry(ptr);
+        return binEntry != 0 ? getBinBlockSize(binEntry - 1) : getLargeBlockHeader(ptr)->size;
+    }
+
+}  // namespace nau
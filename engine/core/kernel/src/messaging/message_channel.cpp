@@ -0,0 +1,252 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "nau/messaging/message_channel.h"
+
+namespace nau
+{
+    MessageSubscriberBase::MessageSubscriberBase(async::Executor::Ptr executor) :
+        m_executor(std::move(executor))
+    {
+        NAU_ASSERT(m_executor);
+    }
+
+    MessageSubscriberBase::~MessageSubscriberBase() = default;
+
+    void MessageSubscriberBase::addRef()
+    {
+        m_refs.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void MessageSubscriberBase::releaseRef()
+    {
+        if (m_refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            delete this;
+        }
+    }
+
+    void MessageSubscriberBase::cancel()
+    {
+        m_isCancelled.store(true, std::memory_order_release);
+    }
+
+    bool MessageSubscriberBase::isCancelled() const
+    {
+        return m_isCancelled.load(std::memory_order_acquire);
+    }
+
+    void MessageSubscriberBase::scheduleDelivery()
+    {
+        if (m_isScheduled.exchange(true, std::memory_order_seq_cst))
+        {
+            return;
+        }
+
+        // The reference is kept by the scheduled delivery, it is released by the delivery callback.
+        addRef();
+        m_executor->execute(deliveryCallback, this);
+    }
+
+    void MessageSubscriberBase::deliveryCallback(void* data1, [[maybe_unused]] void* data2) noexcept
+    {
+        auto* const self = reinterpret_cast<MessageSubscriberBase*>(data1);
+
+        while (true)
+        {
+            self->deliverMessages();
+
+            // The messages pushed after the delivery but before the flag is cleared would not schedule the new delivery:
+            // they are checked after the flag is cleared.
+            self->m_isScheduled.store(false, std::memory_order_seq_cst);
+            if (!self->hasMessages() || self->m_isScheduled.exchange(true, std::memory_order_seq_cst))
+            {
+                break;
+            }
+        }
+
+        self->releaseRef();
+    }
+
+    MessageChannelBase::MessageChannelBase(eastl::string_view channelName) :
+        m_channelId(NameId::intern(channelName))
+    {
+    }
+
+    MessageChannelBase::~MessageChannelBase()
+    {
+        NAU_ASSERT(!hasSubscribers(), "The message channel ({}) is destroyed with the active subscriptions", m_channelId.getName());
+
+        releaseSubscribers(m_subscribers.exchange(nullptr));
+        for (SubscriberList* const subscribers : m_retiredSubscribers)
+        {
+            releaseSubscribers(subscribers);
+        }
+    }
+
+    NameId MessageChannelBase::getChannelId() const
+    {
+        return m_channelId;
+    }
+
+    bool MessageChannelBase::hasSubscribers() const
+    {
+        const SubscriberList* const subscribers = m_subscribers.load(std::memory_order_acquire);
+        return subscribers && !subscribers->empty();
+    }
+
+    MessageChannelSubscription MessageChannelBase::addSubscriber(MessageSubscriberBase* subscriber)
+    {
+        NAU_FATAL(subscriber);
+
+        {
+            lock_(m_mutex);
+
+            const SubscriberList* const current = m_subscribers.load(std::memory_order_relaxed);
+            SubscriberList* const subscribers = current ? new SubscriberList(*current) : new SubscriberList;
+            subscribers->push_back(subscriber);
+
+            for (MessageSubscriberBase* const listed : *subscribers)
+            {
+                listed->addRef();
+            }
+
+            replaceSubscribers(subscribers);
+        }
+
+        return MessageChannelSubscription{*this, subscriber};
+    }
+
+    void MessageChannelBase::removeSubscriber(MessageSubscriberBase& subscriber)
+    {
+        lock_(m_mutex);
+
+        const SubscriberList* const current = m_subscribers.load(std::memory_order_relaxed);
+        if (!current)
+        {
+            return;
+        }
+
+        SubscriberList* const subscribers = new SubscriberList;
+        subscribers->reserve(current->size());
+        for (MessageSubscriberBase* const listed : *current)
+        {
+            if (listed != &subscriber)
+            {
+                listed->addRef();
+                subscribers->push_back(listed);
+            }
+        }
+
+        replaceSubscribers(subscribers);
+    }
+
+    void MessageChannelBase::replaceSubscribers(SubscriberList* subscribers)
+    {
+        // The readers can still iterate the previous list: it is retired and released once there are no readers at all.
+        if (SubscriberList* const previous = m_subscribers.exchange(subscribers, std::memory_order_seq_cst))
+        {
+            m_retiredSubscribers.push_back(previous);
+            m_hasRetiredSubscribers.store(true, std::memory_order_seq_cst);
+        }
+
+        if (m_readerCount.load(std::memory_order_seq_cst) == 0)
+        {
+            for (SubscriberList* const retired : m_retiredSubscribers)
+            {
+                releaseSubscribers(retired);
+            }
+
+            m_retiredSubscribers.clear();
+            m_hasRetiredSubscribers.store(false, std::memory_order_relaxed);
+        }
+    }
+
+    void MessageChannelBase::releaseRetiredSubscribers()
+    {
+        // Called by the last leaving reader: the retired lists are not reachable through m_subscribers,
+        // so the readers that enter after the count is seen as zero can not iterate them.
+        lock_(m_mutex);
+
+        if (m_retiredSubscribers.empty() || m_readerCount.load(std::memory_order_seq_cst) != 0)
+        {
+            return;
+        }
+
+        for (SubscriberList* const retired : m_retiredSubscribers)
+        {
+            releaseSubscribers(retired);
+        }
+
+        m_retiredSubscribers.clear();
+        m_hasRetiredSubscribers.store(false, std::memory_order_relaxed);
+    }
+
+    void MessageChannelBase::releaseSubscribers(SubscriberList* subscribers)
+    {
+        if (!subscribers)
+        {
+            return;
+        }
+
+        for (MessageSubscriberBase* const subscriber : *subscribers)
+        {
+            subscriber->releaseRef();
+        }
+
+        delete subscribers;
+    }
+
+    MessageChannelSubscription::MessageChannelSubscription(MessageChannelBase& channel, MessageSubscriberBase* subscriber) :
+        m_channel(&channel),
+        m_subscriber(subscriber)
+    {
+    }
+
+    MessageChannelSubscription::MessageChannelSubscription(MessageChannelSubscription&& other) :
+        m_channel(std::exchange(other.m_channel, nullptr)),
+        m_subscriber(std::exchange(other.m_subscriber, nullptr))
+    {
+    }
+
+    MessageChannelSubscription::~MessageChannelSubscription()
+    {
+        reset();
+    }
+
+    MessageChannelSubscription& MessageChannelSubscription::operator=(MessageChannelSubscription&& other)
+    {
+        reset();
+
+        m_channel = std::exchange(other.m_channel, nullptr);
+        m_subscriber = std::exchange(other.m_subscriber, nullptr);
+
+        return *this;
+    }
+
+    MessageChannelSubscription& MessageChannelSubscription::operator=(std::nullptr_t)
+    {
+        reset();
+        return *this;
+    }
+
+    MessageChannelSubscription::operator bool() const
+    {
+        return m_subscriber != nullptr;
+    }
+
+    void MessageChannelSubscription::reset()
+    {
+        if (!m_subscriber)
+        {
+            return;
+        }
+
+        MessageSubscriberBase* const subscriber = std::exchange(m_subscriber, nullptr);
+        subscriber->cancel();
+        std::exchange(m_channel, nullptr)->removeSubscriber(*subscriber);
+        subscriber->releaseRef();
+    }
+
+}  // namespace nau
@@ -6,6 +6,7 @@
 
 #include <EASTL/map.h>
 
+#include <atomic>
 #include <filesystem>
 
 #include "nau/io/file_system.h"
@@ -13,6 +14,8 @@
 #include "nau/module/internal/module_entry.h"
 #include "nau/module/module.h"
 #include "nau/platform/windows/diag/win_error.h"
+#include "nau/service/internal/service_provider_initialization.h"
+#include "nau/service/service_provider.h"
 #include "nau/string/hash_string.h"
 #include "nau/string/string_conv.h"
 
@@ -177,13 +180,143 @@ namespace nau
                 moduleRegistry[hName].iModule->initialize();
             }
 
+            if (m_isPostInitDone)
+            {
+                moduleRegistry[hName].iModule->postInit();
+            }
+
             return ResultSuccess;
         }
+
+        void addLazyModule(const nau::string& name, const nau::string& dllPath, ModuleManifest manifest) override
+        {
+            lock_(m_mutex);
+
+            m_lazyModules.push_back({name, dllPath, std::move(manifest)});
+            m_lazyModulesCount.store(m_lazyModules.size(), std::memory_order_release);
+        }
+#endif
+
+        bool loadLazyModulesForType([[maybe_unused]] const rtti::TypeInfo& type) override
+        {
+#if !defined(NAU_STATIC_RUNTIME)
+            if (!hasLazyModules())
+            {
+                return false;
+            }
+
+            eastl::vector<LazyModuleEntry> modules;
+            {
+                lock_(m_mutex);
+
+                const std::string_view name = type.getTypeName();
+                const eastl::string_view typeName{name.data(), name.size()};
+                auto iter = eastl::stable_partition(m_lazyModules.begin(), m_lazyModules.end(), [typeName](const LazyModuleEntry& module)
+                {
+                    return !module.manifest.providesType(typeName);
+                });
+
+                modules.assign(std::make_move_iterator(iter), std::make_move_iterator(m_lazyModules.end()));
+                m_lazyModules.erase(iter, m_lazyModules.end());
+                m_lazyModulesCount.store(m_lazyModules.size(), std::memory_order_release);
+            }
+
+            if (modules.empty())
+            {
+                return false;
+            }
+
+            bool isAnyLoaded = false;
+            for (const LazyModuleEntry& module : modules)
+            {
+                NAU_LOG_INFO("Loading lazy module ({}) requested by ({})", module.name, type.getTypeName());
+                isAnyLoaded |= loadLazyModule(module);
+            }
+
+            return isAnyLoaded;
+#else
+            return false;
+#endif
+        }
+
+        bool hasLazyModules() const override
+        {
+            return m_lazyModulesCount.load(std::memory_order_acquire) > 0;
+        }
+
+        async::Task<> preloadLazyModules() override
+        {
+#if !defined(NAU_STATIC_RUNTIME)
+            ASYNC_SWITCH_EXECUTOR(async::Executor::getDefault());
+
+            // The modules are taken one by one: the module requested meanwhile is loaded by its requester.
+            while (hasLazyModules())
+            {
+                LazyModuleEntry module;
+                {
+                    lock_(m_mutex);
+                    if (m_lazyModules.empty())
+                    {
+                        break;
+                    }
+
+                    module = std::move(m_lazyModules.back());
+                    m_lazyModules.pop_back();
+                    m_lazyModulesCount.store(m_lazyModules.size(), std::memory_order_release);
+                }
+
+                NAU_LOG_INFO("Preloading lazy module ({})", module.name);
+                loadLazyModule(module);
+            }
 #endif
+            co_return;
+        }
 
     private:
+        struct LazyModuleEntry
+        {
+            nau::string name;
+            nau::string dllPath;
+            ModuleManifest manifest;
+        };
+
         inline static ModuleManagerImpl* s_instance = nullptr;
 
+#if !defined(NAU_STATIC_RUNTIME)
+        bool loadLazyModule(const LazyModuleEntry& module)
+        {
+            if (auto loadResult = loadModule(module.name, module.dllPath); !loadResult)
+            {
+                NAU_LOG_ERROR("Lazy module ({}) is not loaded:({})", module.name, loadResult.getError()->getMessage());
+                return false;
+            }
+
+            auto* const serviceProviderInit = getServiceProvider().as<core_detail::IServiceProviderInitialization*>();
+            if (!serviceProviderInit)
+            {
+                return true;
+            }
+
+            // The services of the module are initialized here if the other services are initialized already.
+            // The requested service is returned at once, so the requester is blocked until the initialization is completed.
+            // It is run on the default executor: its continuations must not be scheduled to the blocked thread.
+            async::Task<> initTask = [](core_detail::IServiceProviderInitialization& init) -> async::Task<>
+            {
+                ASYNC_SWITCH_EXECUTOR(async::Executor::getDefault());
+                co_await init.initLateServices();
+            }(*serviceProviderInit);
+
+            async::wait(initTask);
+            if (initTask.isRejected())
+            {
+                NAU_LOG_ERROR("The services of the lazy module ({}) are not initialized:({})", module.name, initTask.getError()->getMessage());
+                return false;
+            }
+
+            return true;
+        }
+#endif
+
         void doInit()
         {
 #if defined(NAU_STATIC_RUNTIME)  // TODO: maybe move this two blocks to other function
@@ -212,6 +345,8 @@ namespace nau
             {
                 moduleEntry.iModule->postInit();
             }
+
+            m_isPostInitDone = true;
         }
 
         void doCleanup()
@@ -225,8 +360,13 @@ namespace nau
         }
 
         eastl::map<nau::hash_string, ModuleEntry> moduleRegistry;
-        std::mutex m_mutex;
+        // Recursive: the lazy module can be requested by the initialization of the other module.
+        std::recursive_mutex m_mutex;
         bool m_needInitializeNewModules = false;
+        bool m_isPostInitDone = false;
+
+        eastl::vector<LazyModuleEntry> m_lazyModules;
+        std::atomic<size_t> m_lazyModulesCount = 0;
 
         friend IModuleManager& ::nau::getModuleManager();
         friend bool ::nau::hasModuleManager();
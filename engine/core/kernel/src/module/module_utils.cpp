@@ -4,8 +4,11 @@
 #include "nau/app/global_properties.h"
 #include "nau/core_defines.h"
 #include "nau/diag/logging.h"
+#include "nau/io/file_system.h"
 #include "nau/io/special_paths.h"
 #include "nau/module/module_manager.h"
+#include "nau/serialization/json.h"
+#include "nau/serialization/runtime_value_builder.h"
 #include "nau/service/service_provider.h"
 #include "nau/string/string_conv.h"
 #include "nau/string/string_utils.h"
@@ -23,12 +26,68 @@ namespace nau
             eastl::vector<eastl::string> searchPaths;
             eastl::vector<eastl::string> optionalModules;
             bool searchEnvPath = true;
+            bool lazyLoading = false;        /** < Modules with the manifest (see ModuleManifest) are loaded on demand. */
+            bool preloadLazyModules = true;  /** < The lazy modules which are not requested are loaded in background after the first frame. */
 
             NAU_CLASS_FIELDS(
                 CLASS_FIELD(searchPaths),
                 CLASS_FIELD(optionalModules),
-                CLASS_FIELD(searchEnvPath))
+                CLASS_FIELD(searchEnvPath),
+                CLASS_FIELD(lazyLoading),
+                CLASS_FIELD(preloadLazyModules))
         };
+
+        EngineModulesConfig getEngineModulesConfig()
+        {
+            GlobalProperties* const props = getServiceProvider().find<GlobalProperties>();
+            if (!props)
+            {
+                return {};
+            }
+
+            return props->getValue<EngineModulesConfig>("engine/modules").value_or(EngineModulesConfig{});
+        }
+
+        /**
+            Reads "<module>.module.json" next to the module library, returns nothing if the module has no manifest.
+         */
+        [[maybe_unused]] eastl::optional<ModuleManifest> readModuleManifest(const std::filesystem::path& modulePath)
+        {
+            namespace fs = std::filesystem;
+
+            const fs::path manifestPath = fs::path{modulePath}.replace_extension(L".module.json");
+
+            [[maybe_unused]] std::error_code ec;
+            if (!fs::exists(manifestPath) || !fs::is_regular_file(manifestPath, ec))
+            {
+                return eastl::nullopt;
+            }
+
+            const eastl::u8string manifestU8Path = strings::wstringToUtf8(strings::toStringView(manifestPath.wstring()));
+            const eastl::string manifestUtf8Path{reinterpret_cast<const char*>(manifestU8Path.data()), manifestU8Path.size()};
+            io::IStreamReader::Ptr stream = io::createNativeFileStream(manifestUtf8Path.c_str(), io::AccessMode::Read, io::OpenFileMode::OpenExisting);
+            if (!stream)
+            {
+                NAU_LOG_WARNING("Can not open module manifest ({})", manifestUtf8Path);
+                return eastl::nullopt;
+            }
+
+            Result<RuntimeValue::Ptr> manifestData = serialization::jsonParse(*stream);
+            if (!manifestData)
+            {
+                NAU_LOG_WARNING("Invalid module manifest ({}):({})", manifestUtf8Path, manifestData.getError()->getMessage());
+                return eastl::nullopt;
+            }
+
+            ModuleManifest manifest;
+            if (auto assignResult = RuntimeValue::assign(makeValueRef(manifest), *manifestData); !assignResult)
+            {
+                NAU_LOG_WARNING("Invalid module manifest ({}):({})", manifestUtf8Path, assignResult.getError()->getMessage());
+                return eastl::nullopt;
+            }
+
+            return manifest;
+        }
     }  // namespace
 
     Result<> loadModulesList([[maybe_unused]] eastl::string_view modulesList)
@@ -45,16 +104,7 @@ namespace nau
             return NauMakeError("No modules specified, list is empty");
         }
 
-        const EngineModulesConfig modulesConfig = EXPR_Block->EngineModulesConfig
-        {
-            GlobalProperties* const props = getServiceProvider().find<GlobalProperties>();
-            if (!props)
-            {
-                return {};
-            }
-
-            return props->getValue<EngineModulesConfig>("engine/modules").value_or(EngineModulesConfig{});
-        };
+        const EngineModulesConfig modulesConfig = getEngineModulesConfig();
 
         const fs::path binPath = io::getKnownFolderPath(io::KnownFolder::ExecutableLocation);
 
@@ -160,6 +210,16 @@ namespace nau
 
             const std::wstring wcsFullPath = moduleFullPath.wstring();
 
+            if (modulesConfig.lazyLoading)
+            {
+                if (auto manifest = readModuleManifest(moduleFullPath); manifest && manifest->lazy)
+                {
+                    NAU_LOG(u8"Lazy module ({}) at ({})", eastl::string{moduleName}, wstringToUtf8(toStringView(wcsFullPath)));
+                    getModuleManager().addLazyModule(moduleName, wcsFullPath, std::move(*manifest));
+                    continue;
+                }
+            }
+
             if (auto loadResult = getModuleManager().loadModule(moduleName, wcsFullPath); !loadResult)
             {
                 if (!isOptionalModule(moduleName))
@@ -180,4 +240,19 @@ namespace nau
 
         return ResultSuccess;
     }
+
+    void startLazyModulesPreload()
+    {
+        if (!hasModuleManager() || !getModuleManager().hasLazyModules())
+        {
+            return;
+        }
+
+        if (!getEngineModulesConfig().preloadLazyModules)
+        {
+            return;
+        }
+
+        getModuleManager().preloadLazyModules().detach();
+    }
 }  // namespace nau
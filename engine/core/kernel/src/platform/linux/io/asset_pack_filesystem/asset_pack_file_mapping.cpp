@@ -0,0 +1,93 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "../../../../io/asset_pack_filesystem/asset_pack_file_mapping.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+
+namespace nau::io
+{
+    void AssetPackFileMapping::unmap(std::byte* ptr, size_t size)
+    {
+        if (ptr)
+        {
+            ::munmap(ptr, size);
+        }
+    }
+
+    AssetPackFileMapping::~AssetPackFileMapping()
+    {
+        close();
+    }
+
+    Result<> AssetPackFileMapping::open(eastl::u8string_view filePath)
+    {
+        NAU_ASSERT(!isOpened());
+
+        const eastl::string path{reinterpret_cast<const char*>(filePath.data()), filePath.size()};
+        const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+        {
+            return NauMakeError("Fail to open asset pack file ({}):({})", path, std::strerror(errno));
+        }
+
+        struct stat fileStat;
+        if (::fstat(fd, &fileStat) != 0 || fileStat.st_size == 0)
+        {
+            ::close(fd);
+            return NauMakeError("Invalid asset pack file size ({})", path);
+        }
+
+        // The file descriptor is kept open (the mapping handle): the views are mapped on demand.
+        m_fileHandle = static_cast<uintptr_t>(fd);
+        m_mappingHandle = m_fileHandle;
+        m_fileSize = static_cast<size_t>(fileStat.st_size);
+        m_lastWriteTime = static_cast<size_t>(fileStat.st_mtime);
+
+        return ResultSuccess;
+    }
+
+    bool AssetPackFileMapping::isOpened() const
+    {
+        return m_mappingHandle != 0;
+    }
+
+    size_t AssetPackFileMapping::getFileSize() const
+    {
+        return m_fileSize;
+    }
+
+    size_t AssetPackFileMapping::getLastWriteTime() const
+    {
+        return m_lastWriteTime;
+    }
+
+    std::byte* AssetPackFileMapping::map(size_t offset, size_t size) const
+    {
+        NAU_ASSERT(isOpened());
+        NAU_ASSERT(offset + size <= m_fileSize);
+
+        void* const ptr = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, static_cast<int>(m_mappingHandle), static_cast<off_t>(offset));
+        return ptr != MAP_FAILED ? reinterpret_cast<std::byte*>(ptr) : nullptr;
+    }
+
+    void AssetPackFileMapping::close()
+    {
+        if (m_fileHandle != 0)
+        {
+            ::close(static_cast<int>(m_fileHandle));
+        }
+
+        m_fileHandle = 0;
+        m_mappingHandle = 0;
+        m_fileSize = 0;
+        m_lastWriteTime = 0;
+    }
+}  // namespace nau::io
@@ -0,0 +1,108 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "../../../../io/asset_pack_filesystem/asset_pack_file_mapping.h"
+
+#include "nau/platform/windows/diag/win_error.h"
+#include "nau/string/string_conv.h"
+
+namespace nau::io
+{
+    void AssetPackFileMapping::unmap(std::byte* ptr, [[maybe_unused]] size_t size)
+    {
+        if (ptr)
+        {
+            ::UnmapViewOfFile(ptr);
+        }
+    }
+
+    AssetPackFileMapping::~AssetPackFileMapping()
+    {
+        close();
+    }
+
+    Result<> AssetPackFileMapping::open(eastl::u8string_view filePath)
+    {
+        NAU_ASSERT(!isOpened());
+
+        const HANDLE fileHandle = ::CreateFileW(strings::utf8ToWString(filePath).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (fileHandle == INVALID_HANDLE_VALUE)
+        {
+            return NauMakeErrorT(diag::WinCodeError)("Fail to open asset pack file");
+        }
+
+        m_fileHandle = reinterpret_cast<uintptr_t>(fileHandle);
+
+        LARGE_INTEGER fileSize;
+        if (!::GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart == 0)
+        {
+            close();
+            return NauMakeError("Invalid asset pack file size");
+        }
+
+        m_fileSize = static_cast<size_t>(fileSize.QuadPart);
+
+        const HANDLE mappingHandle = ::CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mappingHandle == nullptr)
+        {
+            auto error = NauMakeErrorT(diag::WinCodeError)("Fail to create asset pack file mapping");
+            close();
+            return error;
+        }
+
+        m_mappingHandle = reinterpret_cast<uintptr_t>(mappingHandle);
+
+        FILETIME lastWriteTime;
+        if (::GetFileTime(fileHandle, nullptr, nullptr, &lastWriteTime))
+        {
+            m_lastWriteTime = (static_cast<size_t>(lastWriteTime.dwHighDateTime) << 32) | lastWriteTime.dwLowDateTime;
+        }
+
+        return ResultSuccess;
+    }
+
+    bool AssetPackFileMapping::isOpened() const
+    {
+        return m_mappingHandle != 0;
+    }
+
+    size_t AssetPackFileMapping::getFileSize() const
+    {
+        return m_fileSize;
+    }
+
+    size_t AssetPackFileMapping::getLastWriteTime() const
+    {
+        return m_lastWriteTime;
+    }
+
+    std::byte* AssetPackFileMapping::map(size_t offset, size_t size) const
+    {
+        NAU_ASSERT(isOpened());
+        NAU_ASSERT(offset + size <= m_fileSize);
+
+        const uint64_t offset64 = offset;
+        void* const ptr = ::MapViewOfFile(reinterpret_cast<HANDLE>(m_mappingHandle), FILE_MAP_READ, static_cast<DWORD>(offset64 >> 32), static_cast<DWORD>(offset64 & 0xFFFFFFFF), size);
+
+        return reinterpret_cast<std::byte*>(ptr);
+    }
+
+    void AssetPackFileMapping::close()
+    {
+        if (m_mappingHandle != 0)
+        {
+            ::CloseHandle(reinterpret_cast<HANDLE>(m_mappingHandle));
+            m_mappingHandle = 0;
+        }
+
+        if (m_fileHandle != 0)
+        {
+            ::CloseHandle(reinterpret_cast<HANDLE>(m_fileHandle));
+            m_fileHandle = 0;
+        }
+
+        m_fileSize = 0;
+        m_lastWriteTime = 0;
+    }
+}  // namespace nau::io
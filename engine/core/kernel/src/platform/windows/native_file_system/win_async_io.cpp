@@ -0,0 +1,148 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "./win_async_io.h"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+
+#include "nau/platform/windows/diag/win_error.h"
+
+namespace nau::io
+{
+    struct WinAsyncIo::ReadRequest
+    {
+        OVERLAPPED overlapped{};
+        HANDLE fileHandle = INVALID_HANDLE_VALUE;
+        async::TaskSource<size_t> promise;
+    };
+
+    WinAsyncIo& WinAsyncIo::getInstance()
+    {
+        static WinAsyncIo instance;
+        return instance;
+    }
+
+    WinAsyncIo::WinAsyncIo() :
+        m_completionPort(::CreateIoCompletionPort(INVALID_HANDLE_VALUE, nullptr, 0, 1))
+    {
+        NAU_ASSERT(m_completionPort != nullptr);
+        if (m_completionPort != nullptr)
+        {
+            m_completionThread = std::thread([this]
+            {
+                completionThreadMain();
+            });
+        }
+    }
+
+    WinAsyncIo::~WinAsyncIo()
+    {
+        if (m_completionThread.joinable())
+        {
+            ::PostQueuedCompletionStatus(m_completionPort, 0, ShutdownCompletionKey, nullptr);
+            m_completionThread.join();
+        }
+
+        if (m_completionPort != nullptr)
+        {
+            ::CloseHandle(m_completionPort);
+        }
+    }
+
+    bool WinAsyncIo::associate(HANDLE fileHandle)
+    {
+        NAU_ASSERT(fileHandle != INVALID_HANDLE_VALUE);
+
+        return m_completionPort != nullptr && ::CreateIoCompletionPort(fileHandle, m_completionPort, 0, 0) == m_completionPort;
+    }
+
+    async::Task<size_t> WinAsyncIo::read(HANDLE fileHandle, size_t offset, eastl::span<std::byte> buffer)
+    {
+        if (buffer.empty())
+        {
+            return async::makeResolvedTask<size_t>(0);
+        }
+
+        auto* const request = new ReadRequest;
+        request->fileHandle = fileHandle;
+        request->overlapped.Offset = static_cast<DWORD>(offset & 0xFFFFFFFF);
+        request->overlapped.OffsetHigh = static_cast<DWORD>(static_cast<uint64_t>(offset) >> 32);
+
+        // The single read is limited by the DWORD: the caller gets the partial result and reads the rest.
+        const DWORD readSize = static_cast<DWORD>(std::min<size_t>(buffer.size(), std::numeric_limits<DWORD>::max()));
+
+        async::Task<size_t> task = request->promise.getTask();
+        if (!::ReadFile(fileHandle, buffer.data(), readSize, nullptr, &request->overlapped))
+        {
+            const DWORD errorCode = ::GetLastError();
+            if (errorCode != ERROR_IO_PENDING)
+            {
+                // The request is not queued: the completion will never be dequeued.
+                if (errorCode == ERROR_HANDLE_EOF)
+                {
+                    request->promise.resolve(0);
+                }
+                else
+                {
+                    request->promise.reject(NauMakeErrorT(diag::WinCodeError)("Fail to read file", errorCode));
+                }
+
+                delete request;
+            }
+        }
+
+        return task;
+    }
+
+    void WinAsyncIo::completionThreadMain()
+    {
+        std::array<OVERLAPPED_ENTRY, CompletionBatchSize> entries;
+
+        while (true)
+        {
+            ULONG entriesCount = 0;
+            if (!::GetQueuedCompletionStatusEx(m_completionPort, entries.data(), static_cast<ULONG>(entries.size()), &entriesCount, INFINITE, FALSE))
+            {
+                continue;
+            }
+
+            bool shutdown = false;
+
+            for (const OVERLAPPED_ENTRY& entry : eastl::span{entries.data(), entriesCount})
+            {
+                if (entry.lpCompletionKey == ShutdownCompletionKey)
+                {
+                    shutdown = true;
+                    continue;
+                }
+
+                auto* const request = reinterpret_cast<ReadRequest*>(entry.lpOverlapped);
+
+                // The request is already completed: GetOverlappedResult does not wait and only translates the status to the error code.
+                DWORD readCount = 0;
+                if (::GetOverlappedResult(request->fileHandle, &request->overlapped, &readCount, FALSE))
+                {
+                    request->promise.resolve(static_cast<size_t>(readCount));
+                }
+                else if (const DWORD errorCode = ::GetLastError(); errorCode == ERROR_HANDLE_EOF)
+                {
+                    request->promise.resolve(0);
+                }
+                else
+                {
+                    request->promise.reject(NauMakeErrorT(diag::WinCodeError)("Fail to read file", errorCode));
+                }
+
+                delete request;
+            }
+
+            if (shutdown)
+            {
+                break;
+            }
+        }
+    }
+}  // namespace nau::io
@@ -0,0 +1,53 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <EASTL/span.h>
+
+#include <thread>
+
+#include "nau/async/task.h"
+
+namespace nau::io
+{
+    /**
+        Overlapped file reads completed through the single IO completion port.
+        The completions are dequeued in batches by the dedicated thread, which only resolves the tasks:
+        the awaiting code continues on the executor it is awaited from.
+     */
+    class WinAsyncIo
+    {
+    public:
+        static WinAsyncIo& getInstance();
+
+        WinAsyncIo();
+        WinAsyncIo(const WinAsyncIo&) = delete;
+        ~WinAsyncIo();
+
+        WinAsyncIo& operator=(const WinAsyncIo&) = delete;
+
+        /**
+            Associates the file handle (opened with FILE_FLAG_OVERLAPPED) with the completion port.
+         */
+        bool associate(HANDLE fileHandle);
+
+        /**
+            Starts the read of the associated file handle.
+            The handle and the buffer must stay valid until the task is completed.
+         */
+        async::Task<size_t> read(HANDLE fileHandle, size_t offset, eastl::span<std::byte> buffer);
+
+    private:
+        struct ReadRequest;
+
+        static constexpr ULONG_PTR ShutdownCompletionKey = 1;
+        static constexpr ULONG CompletionBatchSize = 64;
+
+        void completionThreadMain();
+
+        HANDLE m_completionPort = nullptr;
+        std::thread m_completionThread;
+    };
+}  // namespace nau::io
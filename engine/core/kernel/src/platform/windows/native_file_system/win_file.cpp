@@ -4,6 +4,8 @@
 
 #include "./win_file.h"
 
+#include "./win_async_io.h"
+
 #include "nau/platform/windows/diag/win_error.h"
 
 namespace nau::io
@@ -132,6 +134,11 @@ namespace nau::io
 
     WinFile::~WinFile()
     {
+        if (m_overlappedFileHandle != INVALID_HANDLE_VALUE)
+        {
+            CloseHandle(m_overlappedFileHandle);
+        }
+
         if (m_fileHandle != INVALID_HANDLE_VALUE)
         {
             CloseHandle(m_fileHandle);
@@ -186,6 +193,50 @@ namespace nau::io
         return createNativeFileStream(path.data(), m_accessMode, OpenFileMode::OpenExisting);
     }
 
+    HANDLE WinFile::getOverlappedFileHandle()
+    {
+        lock_(m_mutex);
+
+        // The file is opened without FILE_FLAG_OVERLAPPED (which is required for the streams):
+        // the overlapped handle is reopened once on the first async read and associated with the completion port.
+        if (m_overlappedFileHandle == INVALID_HANDLE_VALUE)
+        {
+            const HANDLE fileHandle = ::ReOpenFile(m_fileHandle, GENERIC_READ, FILE_SHARE_READ, FILE_FLAG_OVERLAPPED);
+            if (fileHandle == INVALID_HANDLE_VALUE)
+            {
+                return INVALID_HANDLE_VALUE;
+            }
+
+            if (!WinAsyncIo::getInstance().associate(fileHandle))
+            {
+                ::CloseHandle(fileHandle);
+                return INVALID_HANDLE_VALUE;
+            }
+
+            m_overlappedFileHandle = fileHandle;
+        }
+
+        return m_overlappedFileHandle;
+    }
+
+    async::Task<size_t> WinFile::readAsync(size_t offset, eastl::span<std::byte> buffer)
+    {
+        NAU_ASSERT(isOpened());
+        NAU_ASSERT(m_accessMode && AccessMode::Read);
+
+        const HANDLE fileHandle = isOpened() ? getOverlappedFileHandle() : INVALID_HANDLE_VALUE;
+        if (fileHandle == INVALID_HANDLE_VALUE)
+        {
+            co_return NauMakeErrorT(diag::WinCodeError)("Fail to open file for the async read");
+        }
+
+        // Keeps the file (and the overlapped handle) alive while the read is in flight.
+        [[maybe_unused]]
+        const nau::Ptr<WinFile> self{this};
+
+        co_return co_await WinAsyncIo::getInstance().read(fileHandle, offset, buffer);
+    }
+
     void* WinFile::memMap([[maybe_unused]] size_t offset, [[maybe_unused]] size_t count)
     {
         NAU_ASSERT(isOpened());
@@ -34,6 +34,8 @@ namespace nau::io
 
         FsPath getPath() const override;
 
+        async::Task<size_t> readAsync(size_t offset, eastl::span<std::byte> buffer) override;
+
         void* memMap(size_t offset = 0, size_t count = 0) override;
 
         void memUnmap(const void*) override;
@@ -43,9 +45,12 @@ namespace nau::io
         std::string getNativePath() const override;
 
     private:
+        HANDLE getOverlappedFileHandle();
+
         FsPath m_vfsPath;
         const AccessModeFlag m_accessMode;
         HANDLE m_fileHandle = INVALID_HANDLE_VALUE;
+        HANDLE m_overlappedFileHandle = INVALID_HANDLE_VALUE;
         HANDLE m_fileMappingHandle = nullptr;
         unsigned m_fileMappingCounter = 0;
         void* m_mappedPtr = nullptr;
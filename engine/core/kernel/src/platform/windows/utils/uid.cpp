@@ -103,16 +103,6 @@ namespace nau
     {
     }
 
-    size_t Uid::getHashCode() const
-    {
-        [[maybe_unused]] RPC_STATUS status = S_OK;
-        GUID mutableData = m_data;
-        const unsigned short hash = UuidHash(&mutableData, &status);
-        NAU_ASSERT(status == S_OK);
-
-        return static_cast<size_t>(hash);
-    }
-
     Uid::operator bool() const noexcept
     {
         const bool isNull = m_data.Data1 == 0 &&
@@ -33,6 +33,9 @@ namespace nau::async
 
         ~Win32TimerManager()
         {
+            // Unregister before the destruction: the removal waits for the concurrent runtime object visits that can use this object.
+            m_runtimeObjectRegistration = nullptr;
+
             NAU_ASSERT(m_timerStateList.empty());
 
             ::DeleteTimerQueue(m_hTimerQueue);
@@ -249,7 +252,7 @@ namespace nau::async
         eastl::intrusive_list<TimerState> m_timerStateList;
         std::atomic<InvokeAfterHandle> m_nextTimerStateId = 1;
         std::atomic_bool m_isDisposed = false;
-        const RuntimeObjectRegistration m_runtimeObjectRegistration;
+        RuntimeObjectRegistration m_runtimeObjectRegistration;
     };
 
     /**
@@ -4,6 +4,12 @@
 
 #include "nau/runtime/internal/runtime_object_registry.h"
 
+#include <EASTL/array.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
 #include "nau/memory/singleton_memop.h"
 #include "nau/threading/lock_guard.h"
 #include "nau/utils/scope_guard.h"
@@ -124,6 +130,14 @@ namespace nau
                 return instance;
             }
 
+            /**
+                The object is registered by the reference and is not ref counted: nothing keeps it alive while it is visited.
+             */
+            bool isPinnedOnVisit() const
+            {
+                return m_ptr && !m_isWeak && !reinterpret_cast<const IRttiObject*>(m_ptr)->is<IRefCounted>();
+            }
+
             bool isMyNonWeakRefObject(const IRttiObject* object) const
             {
                 return !m_isWeak && m_ptr == object;
@@ -152,136 +166,417 @@ namespace nau
             bool m_isWeak;
         };
 
-        void removeExpiredEntries();
+        /**
+            The objects are registered into the shards (chosen by the registering thread), so the concurrent registrations
+            do not contend on the single lock. The entry slot is addressed by the object id: the removal does not search.
+
+            The objects of the visited types are also kept in the per type buckets (the slot lists, built on the first visit of the type),
+            so the visit by type does not scan all the registered objects.
+
+            The visit callback runs without the shard locks. The ref counted objects are kept alive by the collected references,
+            the objects registered by the reference (not ref counted) are pinned by the shard visit counter:
+            their removal waits until the visits of the shard are finished.
+         */
+        static constexpr size_t ShardCount = 16;
+        static constexpr size_t MaxIndexedTypes = 8;
+
+        struct BucketItem
+        {
+            uint32_t slot;
+            ObjectId objectId;
+        };
+
+        struct TypeBucket
+        {
+            eastl::vector<BucketItem> items;
+            size_t staleCount = 0;
+        };
+
+        struct Shard
+        {
+            std::mutex mutex;
+            eastl::vector<ObjectEntry> entries;
+            eastl::vector<uint8_t> typeMasks; /** < Per entry: the bits of the type buckets which contain the entry. */
+            eastl::vector<uint32_t> freeSlots;
+            std::condition_variable visitsFinished;
+            uint32_t visitCount = 0; /** < Number of the running visits that collected the (not ref counted) objects of the shard. */
+            uint32_t serial = 0;
+            uint32_t builtBuckets = 0;
+            TypeBucket buckets[MaxIndexedTypes];
+        };
+
+        static ObjectId makeObjectId(uint32_t serial, size_t shardIndex, uint32_t slot)
+        {
+            return (static_cast<ObjectId>(serial) << 32) | (static_cast<ObjectId>(shardIndex) << 24) | slot;
+        }
+
+        static size_t getShardIndex(ObjectId objectId)
+        {
+            return static_cast<size_t>((objectId >> 24) & 0xFF);
+        }
+
+        static uint32_t getSlot(ObjectId objectId)
+        {
+            return static_cast<uint32_t>(objectId & 0xFFFFFF);
+        }
+
+        static Shard& getCurrentThreadShard(eastl::array<Shard, ShardCount>& shards, size_t& shardIndex);
+
+        template <typename... Args>
+        ObjectId addEntry(IRttiObject& object, Args&&... args);
+
+        void releaseSlot(Shard& shard, uint32_t slot);
+
+        int findTypeIndex(const rtti::TypeInfo& type);
+
+        void buildTypeBucket(Shard& shard, size_t typeIndex);
+
+        /**
+            @return true if the shard is pinned by the visit (collected objects are not ref counted).
+         */
+        bool collectObjects(Shard& shard, const rtti::TypeInfo* type, int typeIndex, eastl::vector<IRttiObject*>& instances);
 
         void visitObjects(void (*callback)(eastl::span<IRttiObject*>, void*), const rtti::TypeInfo*, void*) override;
 
-        std::recursive_mutex m_mutex;
-        ObjectId m_objectId = 0;
-        eastl::vector<ObjectEntry> m_objects;
+        static inline thread_local uint32_t s_threadVisitDepth = 0;
+
+        eastl::array<Shard, ShardCount> m_shards;
+
+        std::mutex m_typesMutex;
+        std::atomic<size_t> m_indexedTypeCount = 0;
+        const rtti::TypeInfo* m_indexedTypes[MaxIndexedTypes] = {};
     };
 
     RuntimeObjectRegistryImpl::~RuntimeObjectRegistryImpl()
     {
-        removeExpiredEntries();
-        NAU_ASSERT(m_objects.empty(), "Still alive ({}) objects", m_objects.size());
+        [[maybe_unused]] size_t aliveCount = 0;
+        for (Shard& shard : m_shards)
+        {
+            for (const ObjectEntry& entry : shard.entries)
+            {
+                aliveCount += entry.isExpired() ? 0 : 1;
+            }
+        }
+
+        NAU_ASSERT(aliveCount == 0, "Still alive ({}) objects", aliveCount);
+    }
+
+    RuntimeObjectRegistryImpl::Shard& RuntimeObjectRegistryImpl::getCurrentThreadShard(eastl::array<Shard, ShardCount>& shards, size_t& shardIndex)
+    {
+        static std::atomic<size_t> s_threadCounter = 0;
+        static thread_local const size_t s_threadShardIndex = s_threadCounter.fetch_add(1, std::memory_order_relaxed) % ShardCount;
+
+        shardIndex = s_threadShardIndex;
+        return shards[shardIndex];
     }
 
-    void RuntimeObjectRegistryImpl::visitObjects(VisitObjectsCallback callback, const rtti::TypeInfo* type, void* callbackData)
+    template <typename... Args>
+    RuntimeObjectRegistry::ObjectId RuntimeObjectRegistryImpl::addEntry(IRttiObject& object, Args&&... args)
     {
-        lock_(m_mutex);
+        size_t shardIndex = 0;
+        Shard& shard = getCurrentThreadShard(m_shards, shardIndex);
 
-        if(m_objects.empty())
+        lock_(shard.mutex);
+
+        uint32_t slot = 0;
+        if (!shard.freeSlots.empty())
         {
-            return;
+            slot = shard.freeSlots.back();
+            shard.freeSlots.pop_back();
+        }
+        else
+        {
+            slot = static_cast<uint32_t>(shard.entries.size());
+            NAU_FATAL(slot <= 0xFFFFFF, "Too many registered runtime objects");
+            shard.entries.emplace_back();
+            shard.typeMasks.push_back(0);
         }
 
-        eastl::vector<IRttiObject*> instances;
+        if (++shard.serial == 0)
+        {
+            shard.serial = 1;
+        }
 
-        scope_on_leave
+        const ObjectId objectId = makeObjectId(shard.serial, shardIndex, slot);
+        shard.entries[slot] = ObjectEntry{objectId, std::forward<Args>(args)...};
+
+        // Only the buckets that are built for the shard are updated, the others will be built on the first visit.
+        uint8_t typeMask = 0;
+        for (size_t i = 0; i < MaxIndexedTypes; ++i)
         {
-            for(IRttiObject* const obj : instances)
+            if ((shard.builtBuckets & (1u << i)) && object.is(*m_indexedTypes[i]))
             {
-                if(IRefCounted* const refCounted = obj->as<IRefCounted*>())
-                {
-                    refCounted->releaseRef();
-                }
+                shard.buckets[i].items.push_back({slot, objectId});
+                typeMask |= static_cast<uint8_t>(1 << i);
             }
-        };
+        }
+        shard.typeMasks[slot] = typeMask;
+
+        return objectId;
+    }
+
+    void RuntimeObjectRegistryImpl::releaseSlot(Shard& shard, uint32_t slot)
+    {
+        shard.entries[slot] = ObjectEntry{};
+        shard.freeSlots.push_back(slot);
 
-        // collect required objects, remove expired entries
-        for(size_t i = 0; i < m_objects.size();)
+        // The bucket items of the slot became stale, the bucket is compacted once the half of the items are stale.
+        uint8_t typeMask = std::exchange(shard.typeMasks[slot], 0);
+        for (size_t i = 0; typeMask != 0; ++i, typeMask >>= 1)
         {
-            IRttiObject* const instance = m_objects[i].lock();
-            if(!instance)
+            if (!(typeMask & 1))
             {
-                const size_t lastIndex = m_objects.size() - 1;
-                if(i != lastIndex)
+                continue;
+            }
+
+            TypeBucket& bucket = shard.buckets[i];
+            if (++bucket.staleCount * 2 > bucket.items.size())
+            {
+                eastl::erase_if(bucket.items, [&shard](const BucketItem& item)
                 {
-                    m_objects[i] = std::move(m_objects[lastIndex]);
-                }
+                    return shard.entries[item.slot].getObjectId() != item.objectId;
+                });
+                bucket.staleCount = 0;
+            }
+        }
+    }
+
+    int RuntimeObjectRegistryImpl::findTypeIndex(const rtti::TypeInfo& type)
+    {
+        const size_t indexedTypeCount = m_indexedTypeCount.load(std::memory_order_acquire);
+        for (size_t i = 0; i < indexedTypeCount; ++i)
+        {
+            if (*m_indexedTypes[i] == type)
+            {
+                return static_cast<int>(i);
+            }
+        }
+
+        lock_(m_typesMutex);
+
+        const size_t count = m_indexedTypeCount.load(std::memory_order_relaxed);
+        for (size_t i = indexedTypeCount; i < count; ++i)
+        {
+            if (*m_indexedTypes[i] == type)
+            {
+                return static_cast<int>(i);
+            }
+        }
 
-                m_objects.resize(lastIndex);
+        if (count == MaxIndexedTypes)
+        {
+            return -1;
+        }
+
+        m_indexedTypes[count] = &type;
+        m_indexedTypeCount.store(count + 1, std::memory_order_release);
+
+        return static_cast<int>(count);
+    }
+
+    void RuntimeObjectRegistryImpl::buildTypeBucket(Shard& shard, size_t typeIndex)
+    {
+        const rtti::TypeInfo& type = *m_indexedTypes[typeIndex];
+        TypeBucket& bucket = shard.buckets[typeIndex];
+
+        for (uint32_t slot = 0, size = static_cast<uint32_t>(shard.entries.size()); slot < size; ++slot)
+        {
+            IRttiObject* const instance = shard.entries[slot].lock();
+            if (!instance)
+            {
                 continue;
             }
 
-            if(!type || instance->is(*type))
+            if (instance->is(type))
+            {
+                bucket.items.push_back({slot, shard.entries[slot].getObjectId()});
+                shard.typeMasks[slot] |= static_cast<uint8_t>(1 << typeIndex);
+            }
+
+            if (IRefCounted* const refCounted = instance->as<IRefCounted*>())
             {
-                instances.push_back(std::move(instance));
+                refCounted->releaseRef();
             }
-            else if(IRefCounted* const refCounted = instance->as<IRefCounted*>())
+        }
+
+        shard.builtBuckets |= 1u << typeIndex;
+    }
+
+    bool RuntimeObjectRegistryImpl::collectObjects(Shard& shard, const rtti::TypeInfo* type, int typeIndex, eastl::vector<IRttiObject*>& instances)
+    {
+        bool pinned = false;
+
+        const auto collectEntry = [&](uint32_t slot) -> bool
+        {
+            IRttiObject* const instance = shard.entries[slot].lock();
+            if (!instance)
+            {
+                // The weak referenced object is dead: the entry is removed (the registration id will not be found).
+                releaseSlot(shard, slot);
+                return false;
+            }
+
+            if (!type || instance->is(*type))
+            {
+                instances.push_back(instance);
+                pinned = pinned || shard.entries[slot].isPinnedOnVisit();
+            }
+            else if (IRefCounted* const refCounted = instance->as<IRefCounted*>())
             {  // object will not be used and must be released immediately
                 refCounted->releaseRef();
             }
 
-            ++i;
+            return true;
+        };
+
+        lock_(shard.mutex);
+
+        scope_on_leave
+        {
+            shard.visitCount += pinned ? 1 : 0;
+        };
+
+        if (typeIndex < 0)
+        {
+            for (uint32_t slot = 0, size = static_cast<uint32_t>(shard.entries.size()); slot < size; ++slot)
+            {
+                if (shard.entries[slot])
+                {
+                    collectEntry(slot);
+                }
+            }
+
+            return pinned;
         }
 
-        if(!instances.empty())
+        if (!(shard.builtBuckets & (1u << typeIndex)))
         {
-            callback({instances.begin(), instances.end()}, callbackData);
+            buildTypeBucket(shard, static_cast<size_t>(typeIndex));
         }
+
+        // The bucket is copied: the removal of the expired entries compacts it.
+        TypeBucket& bucket = shard.buckets[typeIndex];
+        const eastl::vector<BucketItem> items = bucket.items;
+        for (const BucketItem& item : items)
+        {
+            if (shard.entries[item.slot].getObjectId() == item.objectId)
+            {
+                collectEntry(item.slot);
+            }
+        }
+
+        return pinned;
     }
 
-    RuntimeObjectRegistry::ObjectId RuntimeObjectRegistryImpl::addObject(nau::Ptr<> ptr)
+    void RuntimeObjectRegistryImpl::visitObjects(VisitObjectsCallback callback, const rtti::TypeInfo* type, void* callbackData)
     {
-        lock_(m_mutex);
+        const int typeIndex = type ? findTypeIndex(*type) : -1;
 
-        NAU_ASSERT(ptr);
+        eastl::vector<IRttiObject*> instances;
+        eastl::array<bool, ShardCount> pinnedShards = {};
 
-        const auto id = ++m_objectId;
-        m_objects.emplace_back(id, ptr);
+        ++s_threadVisitDepth;
 
-        return id;
+        scope_on_leave
+        {
+            --s_threadVisitDepth;
+
+            for(IRttiObject* const obj : instances)
+            {
+                if(IRefCounted* const refCounted = obj->as<IRefCounted*>())
+                {
+                    refCounted->releaseRef();
+                }
+            }
+
+            for (size_t i = 0; i < ShardCount; ++i)
+            {
+                if (!pinnedShards[i])
+                {
+                    continue;
+                }
+
+                Shard& shard = m_shards[i];
+                lock_(shard.mutex);
+                NAU_ASSERT(shard.visitCount > 0);
+                if (--shard.visitCount == 0)
+                {
+                    shard.visitsFinished.notify_all();
+                }
+            }
+        };
+
+        for (size_t i = 0; i < ShardCount; ++i)
+        {
+            pinnedShards[i] = collectObjects(m_shards[i], type, typeIndex, instances);
+        }
+
+        // The callback is invoked without the locks: the objects can be registered or unregistered from it.
+        // The ref counted objects are kept alive by the collected references, the other objects are pinned by the shard visit counters
+        // until the callback returns.
+        if(!instances.empty())
+        {
+            callback({instances.begin(), instances.end()}, callbackData);
+        }
     }
 
-    RuntimeObjectRegistry::ObjectId RuntimeObjectRegistryImpl::addObject(IRttiObject& object)
+    RuntimeObjectRegistry::ObjectId RuntimeObjectRegistryImpl::addObject(nau::Ptr<> ptr)
     {
-        lock_(m_mutex);
-
-        const auto id = ++m_objectId;
-        m_objects.emplace_back(id, std::ref(object));
+        NAU_ASSERT(ptr);
 
-        return id;
+        IRttiObject& object = *ptr;
+        return addEntry(object, ptr);
     }
 
-    void RuntimeObjectRegistryImpl::removeExpiredEntries()
+    RuntimeObjectRegistry::ObjectId RuntimeObjectRegistryImpl::addObject(IRttiObject& object)
     {
-        eastl::erase_if(m_objects, [](const ObjectEntry& entry)
-                        {
-                            return entry.isExpired();
-                        });
+        return addEntry(object, object);
     }
 
     void RuntimeObjectRegistryImpl::removeObject(ObjectId id)
     {
-        lock_(m_mutex);
+        Shard& shard = m_shards[getShardIndex(id)];
+        const uint32_t slot = getSlot(id);
+
+        std::unique_lock lock(shard.mutex);
+
+        const auto isRegistered = [&]
+        {
+            return slot < shard.entries.size() && shard.entries[slot].getObjectId() == id;
+        };
+
+        // The entry of the weak referenced object can be already removed by the visit (when the object is dead).
+        if (!isRegistered())
+        {
+            return;
+        }
 
-        for(size_t i = 0, size = m_objects.size(); i < size; ++i)
+        // The not ref counted object can be in use by the visit callback of the other thread: the owner destroys it right after the removal.
+        // Removal from the visit callback itself does not wait (the visit of the current thread would never finish).
+        if (shard.entries[slot].isPinnedOnVisit() && s_threadVisitDepth == 0)
         {
-            if(m_objects[i].getObjectId() == id)
+            shard.visitsFinished.wait(lock, [&shard]
             {
-                const auto lastIndex = size - 1;
-                if(i != lastIndex)
-                {
-                    m_objects[i] = std::move(m_objects[lastIndex]);
-                }
-                m_objects.resize(lastIndex);
-                break;
+                return shard.visitCount == 0;
+            });
+
+            if (!isRegistered())
+            {
+                return;
             }
         }
+
+        releaseSlot(shard, slot);
     }
 
-    bool RuntimeObjectRegistryImpl::isAutoRemovable(ObjectId objectId)
+    bool RuntimeObjectRegistryImpl::isAutoRemovable(ObjectId id)
     {
-        lock_(m_mutex);
+        Shard& shard = m_shards[getShardIndex(id)];
+        const uint32_t slot = getSlot(id);
 
-        auto iter = eastl::find_if(m_objects.begin(), m_objects.end(), [objectId](const ObjectEntry& entry)
-                                   {
-                                       return entry.getObjectId() == objectId;
-                                   });
+        lock_(shard.mutex);
 
-        return iter != m_objects.end() && iter->isWeakRef();
+        return slot < shard.entries.size() && shard.entries[slot].getObjectId() == id && shard.entries[slot].isWeakRef();
     }
 
     namespace
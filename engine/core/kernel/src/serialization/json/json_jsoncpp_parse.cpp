@@ -26,28 +26,16 @@ namespace nau::serialization
 
     Result<RuntimeValue::Ptr> jsonParse(io::IStreamReader& reader, IMemAllocator::Ptr allocator)
     {
-        constexpr size_t BlockSize = 256;
+        // The rest of the stream is parsed in place when the stream data is in memory (storage is used otherwise).
+        const size_t position = reader.getPosition();
+        const size_t size = reader.setPosition(io::OffsetOrigin::End, 0) - position;
+        reader.setPosition(io::OffsetOrigin::Begin, static_cast<int64_t>(position));
 
-        BytesBuffer buffer;
-        size_t totalRead = 0;
+        BytesBuffer storage;
+        auto data = io::readStreamView(reader, size, storage);
+        NauCheckResult(data);
 
-        do
-        {
-            auto readResult = reader.read(buffer.append(BlockSize), BlockSize);
-            NauCheckResult(readResult);
-
-            const size_t actualRead = *readResult;
-            totalRead += actualRead;
-
-            if (actualRead < BlockSize)
-            {
-                buffer.resize(totalRead);
-                break;
-            }
-
-        } while (true);
-
-        eastl::u8string_view str{reinterpret_cast<const char8_t*>(buffer.data()), buffer.size()};
+        eastl::u8string_view str{reinterpret_cast<const char8_t*>(data->data()), data->size()};
         return jsonParseString(str, std::move(allocator));
     }
 
@@ -69,21 +57,12 @@ namespace nau::serialization
         return root;
     }
 
-    Result<RuntimeValue::Ptr> jsonParseString(eastl::string_view str, IMemAllocator::Ptr)
+    Result<RuntimeValue::Ptr> jsonParseString(eastl::string_view str, IMemAllocator::Ptr allocator)
     {
         auto root = jsonParseToValue(str);
         NauCheckResult(root);
 
-        if (root->isObject())
-        {
-            return json_detail::createJsonDictionary(*std::move(root));
-        }
-        else if (root->isArray())
-        {
-            return json_detail::createJsonCollection(*std::move(root));
-        }
-
-        return json_detail::getValueFromJson(nullptr, *root);
+        return jsonToRuntimeValue(*std::move(root), std::move(allocator));
     }
 
 }  // namespace nau::serialization
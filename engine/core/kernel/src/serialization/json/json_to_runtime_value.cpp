@@ -105,49 +105,60 @@ namespace nau::json_detail
         return ResultSuccess;
     }
 
-    RuntimeValue::Ptr getValueFromJson(const nau::Ptr<JsonValueHolderImpl>& root, Json::Value& jsonValue)
+    namespace
     {
-        if (jsonValue.isNull())
-        {
-            return createJsonNullValue(root);
-        }
-        else if (jsonValue.isUInt())
-        {
-            return makeValueCopy(jsonValue.asUInt());
-        }
-        else if (jsonValue.isInt())
-        {
-            return makeValueCopy(jsonValue.asInt());
-        }
-        else if (jsonValue.isUInt64())
-        {
-            return makeValueCopy(jsonValue.asUInt64());
-        }
-        else if (jsonValue.isInt64())
-        {
-            return makeValueCopy(jsonValue.asInt64());
-        }
-        else if (jsonValue.isDouble())
+        RuntimeValue::Ptr makeJsonScalarValue(JsonValueHolderImpl* root, const IMemAllocator::Ptr& allocator, Json::Value& jsonValue)
         {
-            return makeValueCopy(jsonValue.asDouble());
-        }
-        else if (jsonValue.isBool())
-        {
-            return makeValueCopy(jsonValue.asBool());
-        }
-        else if (jsonValue.isString())
-        {
-            std::string str = jsonValue.asString();
-
-            if (root)
+            // The scalars are the immutable copies: the most common of them are shared and not allocated at all.
+            if (jsonValue.isUInt())
+            {
+                return makeConstValue(jsonValue.asUInt(), allocator);
+            }
+            else if (jsonValue.isInt())
+            {
+                return makeConstValue(jsonValue.asInt(), allocator);
+            }
+            else if (jsonValue.isUInt64())
+            {
+                return makeConstValue(jsonValue.asUInt64(), allocator);
+            }
+            else if (jsonValue.isInt64())
+            {
+                return makeConstValue(jsonValue.asInt64(), allocator);
+            }
+            else if (jsonValue.isDouble())
             {
-                if (auto newString = root->transformString(strings::toStringView(str)); newString)
+                return makeConstValue(jsonValue.asDouble(), allocator);
+            }
+            else if (jsonValue.isBool())
+            {
+                return makeConstValue(jsonValue.asBool(), allocator);
+            }
+            else if (jsonValue.isString())
+            {
+                std::string str = jsonValue.asString();
+
+                if (root)
                 {
-                    return makeValueCopy(std::move(*newString));
+                    if (auto newString = root->transformString(strings::toStringView(str)); newString)
+                    {
+                        return makeValueCopy(std::move(*newString), allocator);
+                    }
                 }
+
+                return makeValueCopy(std::move(str), allocator);
             }
 
-            return makeValueCopy(std::move(str));
+            NAU_FAILURE("Don't known how to encode jsonValue. Type: ({})", static_cast<int>(jsonValue.type()));
+            return nullptr;
+        }
+    }  // namespace
+
+    RuntimeValue::Ptr getValueFromJson(const nau::Ptr<JsonValueHolderImpl>& root, Json::Value& jsonValue)
+    {
+        if (jsonValue.isNull())
+        {
+            return createJsonNullValue(root);
         }
         else if (jsonValue.isArray())
         {
@@ -158,8 +169,17 @@ namespace nau::json_detail
             return wrapJsonValueAsDictionary(root, jsonValue);
         }
 
-        NAU_FAILURE("Don't known how to encode jsonValue. Type: ({})", static_cast<int>(jsonValue.type()));
-        return nullptr;
+        return makeJsonScalarValue(root.get(), root ? root->getAllocator() : nullptr, jsonValue);
+    }
+
+    RuntimeValue::Ptr getScalarValueFromJson(Json::Value& jsonValue, IMemAllocator::Ptr allocator)
+    {
+        if (jsonValue.isNull())
+        {
+            return nullptr;
+        }
+
+        return makeJsonScalarValue(nullptr, allocator, jsonValue);
     }
 
     /**
@@ -349,16 +369,14 @@ namespace nau::json_detail
             auto& jsonValue = getThisJsonValue();
             NAU_ASSERT(jsonValue.type() == Json::ValueType::objectValue);
 
-            if (jsonValue.find(key.data(), key.data() + key.size()) == nullptr)
+            // Value::find is const only, but the field is owned by the (non const) jsonValue: single lookup instead of find + demand.
+            const Json::Value* const field = jsonValue.find(key.data(), key.data() + key.size());
+            if (field == nullptr)
             {
                 return nullptr;
             }
 
-            // Value::demand will insert empty default value, so it used only after find.
-            Json::Value* const field = jsonValue.demand(key.data(), key.data() + key.size());
-            NAU_FATAL(field);
-
-            return getValueFromJson(getRoot(), *field);
+            return getValueFromJson(getRoot(), const_cast<Json::Value&>(*field));
         }
 
         Result<> setValue(std::string_view key, const RuntimeValue::Ptr& value) override
@@ -408,76 +426,84 @@ namespace nau::json_detail
 
     RuntimeValue::Ptr wrapJsonValueAsCollection(const Ptr<JsonValueHolderImpl>& root, Json::Value& jsonValue)
     {
-        return rtti::createInstance<JsonCollection>(root, jsonValue);
+        return rtti::createInstanceWithAllocator<JsonCollection>(root->getAllocator(), root, jsonValue);
     }
 
     RuntimeValue::Ptr wrapJsonValueAsDictionary(const Ptr<JsonValueHolderImpl>& root, Json::Value& jsonValue)
     {
-        return rtti::createInstance<JsonDictionary>(root, jsonValue);
+        return rtti::createInstanceWithAllocator<JsonDictionary>(root->getAllocator(), root, jsonValue);
     }
 
     RuntimeValue::Ptr createJsonNullValue(const Ptr<JsonValueHolderImpl>& root)
     {
-        return rtti::createInstance<JsonNull>(root);
+        return rtti::createInstanceWithAllocator<JsonNull>(root->getAllocator(), root);
     }
 
-    RuntimeDictionary::Ptr createJsonDictionary(Json::Value&& jsonValue)
+    RuntimeDictionary::Ptr createJsonDictionary(Json::Value&& jsonValue, IMemAllocator::Ptr allocator)
     {
-        return rtti::createInstance<JsonDictionary>(std::move(jsonValue));
+        auto dict = rtti::createInstanceWithAllocator<JsonDictionary>(allocator, std::move(jsonValue));
+        dict->setAllocator(std::move(allocator));
+        return dict;
     }
 
-    RuntimeCollection::Ptr createJsonCollection(Json::Value&& jsonValue)
+    RuntimeCollection::Ptr createJsonCollection(Json::Value&& jsonValue, IMemAllocator::Ptr allocator)
     {
-        return rtti::createInstance<JsonCollection>(std::move(jsonValue));
+        auto collection = rtti::createInstanceWithAllocator<JsonCollection>(allocator, std::move(jsonValue));
+        collection->setAllocator(std::move(allocator));
+        return collection;
     }
 
-    RuntimeDictionary::Ptr wrapJsonDictionary(Json::Value& jsonValue)
+    RuntimeDictionary::Ptr wrapJsonDictionary(Json::Value& jsonValue, IMemAllocator::Ptr allocator)
     {
-        return rtti::createInstance<JsonDictionary>(jsonValue);
+        auto dict = rtti::createInstanceWithAllocator<JsonDictionary>(allocator, jsonValue);
+        dict->setAllocator(std::move(allocator));
+        return dict;
     }
 
-    RuntimeCollection::Ptr wrapJsonCollection(Json::Value& jsonValue)
+    RuntimeCollection::Ptr wrapJsonCollection(Json::Value& jsonValue, IMemAllocator::Ptr allocator)
     {
-        return rtti::createInstance<JsonCollection>(jsonValue);
+        auto collection = rtti::createInstanceWithAllocator<JsonCollection>(allocator, jsonValue);
+        collection->setAllocator(std::move(allocator));
+        return collection;
     }
 
 }  // namespace nau::json_detail
 
 namespace nau::serialization
 {
-    RuntimeValue::Ptr jsonToRuntimeValue(Json::Value&& root, IMemAllocator::Ptr)
+    RuntimeValue::Ptr jsonToRuntimeValue(Json::Value&& root, IMemAllocator::Ptr allocator)
     {
         if (root.isObject())
         {
-            return json_detail::createJsonDictionary(std::move(root));
+            return json_detail::createJsonDictionary(std::move(root), std::move(allocator));
         }
         else if (root.isArray())
         {
-            return json_detail::createJsonCollection(std::move(root));
+            return json_detail::createJsonCollection(std::move(root), std::move(allocator));
         }
 
-        return json_detail::getValueFromJson(nullptr, root);
+        return json_detail::getScalarValueFromJson(root, std::move(allocator));
     }
 
-    RuntimeValue::Ptr jsonAsRuntimeValue(Json::Value& root, IMemAllocator::Ptr)
+    RuntimeValue::Ptr jsonAsRuntimeValue(Json::Value& root, IMemAllocator::Ptr allocator)
     {
         if (root.isObject())
         {
-            return json_detail::wrapJsonDictionary(root);
+            return json_detail::wrapJsonDictionary(root, std::move(allocator));
         }
         else if (root.isArray())
         {
-            return json_detail::wrapJsonCollection(root);
+            return json_detail::wrapJsonCollection(root, std::move(allocator));
         }
 
         return nullptr;
     }
 
-    RuntimeValue::Ptr jsonAsRuntimeValue(const Json::Value& root, IMemAllocator::Ptr)
+    RuntimeValue::Ptr jsonAsRuntimeValue(const Json::Value& root, IMemAllocator::Ptr allocator)
     {
-        auto value = jsonAsRuntimeValue(const_cast<Json::Value&>(root));
+        auto value = jsonAsRuntimeValue(const_cast<Json::Value&>(root), std::move(allocator));
         value->as<json_detail::JsonValueHolderImpl&>().setMutable(false);
 
         return value;
     }
-}  // namespace nau::serialization
+}  // namespace nau::serialization
\ No newline at end of file
@@ -54,7 +54,20 @@ namespace nau::json_detail
         {
             m_isMutable = isMutable;
         }
-        
+
+        /**
+            The allocator of the values created for the document (the wrappers of the nested values and the scalars), the default if null.
+         */
+        void setAllocator(IMemAllocator::Ptr allocator)
+        {
+            NAU_ASSERT(!m_root, "The allocator is set for the document root only");
+            m_allocator = std::move(allocator);
+        }
+
+        const IMemAllocator::Ptr& getAllocator() const
+        {
+            return m_root ? m_root->m_allocator : m_allocator;
+        }
 
     protected:
         JsonValueHolderImpl()
@@ -127,16 +140,22 @@ namespace nau::json_detail
         eastl::variant<Json::Value, Json::Value*> m_jsonValue;
         bool m_isMutable = true;
         GetStringCallback m_getStringCallback;
+        IMemAllocator::Ptr m_allocator;
     };
 
     RuntimeValue::Ptr getValueFromJson(const nau::Ptr<JsonValueHolderImpl>& root, Json::Value& jsonValue);
 
-    RuntimeDictionary::Ptr createJsonDictionary(Json::Value&& jsonValue);
+    RuntimeDictionary::Ptr createJsonDictionary(Json::Value&& jsonValue, IMemAllocator::Ptr allocator = nullptr);
     
-    RuntimeCollection::Ptr createJsonCollection(Json::Value&& jsonValue);
+    RuntimeCollection::Ptr createJsonCollection(Json::Value&& jsonValue, IMemAllocator::Ptr allocator = nullptr);
 
-    RuntimeDictionary::Ptr wrapJsonDictionary(Json::Value& jsonValue);
+    RuntimeDictionary::Ptr wrapJsonDictionary(Json::Value& jsonValue, IMemAllocator::Ptr allocator = nullptr);
     
-    RuntimeCollection::Ptr wrapJsonCollection(Json::Value& jsonValue);
+    RuntimeCollection::Ptr wrapJsonCollection(Json::Value& jsonValue, IMemAllocator::Ptr allocator = nullptr);
+
+    /**
+        Returns the scalar value (the document root is not an object or array).
+     */
+    RuntimeValue::Ptr getScalarValueFromJson(Json::Value& jsonValue, IMemAllocator::Ptr allocator);
 
 }  // namespace nau::json_detail
@@ -0,0 +1,51 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "nau/serialization/native_runtime_value/native_const_value.h"
+
+#include <EASTL/array.h>
+
+namespace nau::ser_detail
+{
+    namespace
+    {
+        constexpr size_t SharedConstIntCount = MaxSharedConstInt - MinSharedConstInt + 1;
+
+        template <typename T, size_t Count>
+        eastl::array<RuntimeIntegerValue::Ptr, Count> makeSharedConstIntegers(T first)
+        {
+            eastl::array<RuntimeIntegerValue::Ptr, Count> values;
+            for (size_t i = 0; i < Count; ++i)
+            {
+                values[i] = rtti::createInstance<NativeIntegerValue<const T>>(static_cast<T>(first + static_cast<T>(i)));
+            }
+
+            return values;
+        }
+    }  // namespace
+
+    const RuntimeIntegerValue::Ptr& getSharedConstInt(int value)
+    {
+        static const auto values = makeSharedConstIntegers<int, SharedConstIntCount>(MinSharedConstInt);
+
+        NAU_FATAL(MinSharedConstInt <= value && value <= MaxSharedConstInt);
+        return values[static_cast<size_t>(value - MinSharedConstInt)];
+    }
+
+    const RuntimeIntegerValue::Ptr& getSharedConstUInt(unsigned value)
+    {
+        static const auto values = makeSharedConstIntegers<unsigned, MaxSharedConstInt + 1>(0u);
+
+        NAU_FATAL(value <= static_cast<unsigned>(MaxSharedConstInt));
+        return values[value];
+    }
+
+    const RuntimeBooleanValue::Ptr& getSharedConstBool(bool value)
+    {
+        static const RuntimeBooleanValue::Ptr falseValue = rtti::createInstance<NativeBooleanValue<const bool>>(false);
+        static const RuntimeBooleanValue::Ptr trueValue = rtti::createInstance<NativeBooleanValue<const bool>>(true);
+
+        return value ? trueValue : falseValue;
+    }
+}  // namespace nau::ser_detail
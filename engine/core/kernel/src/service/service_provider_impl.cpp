@@ -4,6 +4,10 @@
 
 #include "./service_provider_impl.h"
 
+#include <chrono>
+
+#include "nau/diag/logging.h"
+#include "nau/module/module_manager.h"
 #include "nau/runtime/async_disposable.h"
 #include "nau/runtime/disposable.h"
 #include "nau/memory/eastl_aliases.h"
@@ -23,6 +27,19 @@ namespace nau
             {
             }
 
+            bool isDependsOn(const ServiceEntry& other) const
+            {
+                if (dependencies.empty() || other.service == service)
+                {
+                    return false;
+                }
+
+                return std::any_of(dependencies.begin(), dependencies.end(), [service = other.service](const rtti::TypeIndex& t)
+                {
+                    return service->is(t.getType());
+                });
+            }
+
         private:
             void appendDependencies(const eastl::vector<const rtti::TypeInfo*>& typeInfoCollection)
             {
@@ -40,19 +57,6 @@ namespace nau
                 }
             }
 
-            bool isDependsOn(const ServiceEntry& other) const
-            {
-                if (dependencies.empty() || other.service == service)
-                {
-                    return false;
-                }
-
-                return std::any_of(dependencies.begin(), dependencies.end(), [service = other.service](const rtti::TypeIndex& t)
-                {
-                    return service->is(t.getType());
-                });
-            }
-
             friend class OrderedServiceListBuilder;
         };
 
@@ -229,7 +233,29 @@ namespace nau
         }
     }
 
+    bool ServiceProviderImpl::loadLazyModulesForType(const rtti::TypeInfo& type)
+    {
+        // Must be called without m_mutex locked: the loaded module adds its services and classes.
+        if (!hasModuleManager())
+        {
+            return false;
+        }
+
+        IModuleManager& moduleManager = getModuleManager();
+        return moduleManager.hasLazyModules() && moduleManager.loadLazyModulesForType(type);
+    }
+
     void* ServiceProviderImpl::findInternal(const rtti::TypeInfo& type)
+    {
+        if (void* const api = findLoadedInternal(type))
+        {
+            return api;
+        }
+
+        return loadLazyModulesForType(type) ? findLoadedInternal(type) : nullptr;
+    }
+
+    void* ServiceProviderImpl::findLoadedInternal(const rtti::TypeInfo& type)
     {
         ServiceAccessor* accessor = nullptr;
 
@@ -268,6 +294,9 @@ namespace nau
             return;
         }
 
+        // all the implementations are requested: the lazy modules which provide the type must be loaded regardless of the already found ones
+        loadLazyModulesForType(type);
+
         // todo: use stack allocator
         eastl::vector<ServiceAccessor*> accessors;
         {
@@ -304,6 +333,11 @@ namespace nau
         lock_(m_mutex);
         NAU_ASSERT(!m_isDisposed);
 
+        if (classDescriptor)
+        {
+            m_accessorNames[accessor.get()] = classDescriptor->getClassName();
+        }
+
         m_accessors.emplace_back(std::move(accessor));
     }
 
@@ -318,6 +352,8 @@ namespace nau
 
     eastl::vector<IClassDescriptor::Ptr> ServiceProviderImpl::findClasses(const rtti::TypeInfo& t)
     {
+        loadLazyModulesForType(t);
+
         eastl::vector<IClassDescriptor::Ptr> classes;
 
         shared_lock_(m_mutex);
@@ -363,6 +399,11 @@ namespace nau
 
         const auto predicate = anyType ? matchAny : matchAll;
 
+        for (const rtti::TypeInfo* const type : types)
+        {
+            loadLazyModulesForType(*type);
+        }
+
         shared_lock_(m_mutex);
 
         for (const IClassDescriptor::Ptr& classDescriptor : m_classDescriptors)
@@ -378,12 +419,17 @@ namespace nau
 
     bool ServiceProviderImpl::hasApiInternal(const rtti::TypeInfo& type)
     {
-        shared_lock_(m_mutex);
-
-        return eastl::any_of(m_accessors.begin(), m_accessors.end(), [&type](ServiceAccessor::Ptr& accessor)
+        const auto hasApi = [this, &type]
         {
-            return accessor->hasApi(type);
-        });
+            shared_lock_(m_mutex);
+
+            return eastl::any_of(m_accessors.begin(), m_accessors.end(), [&type](ServiceAccessor::Ptr& accessor)
+            {
+                return accessor->hasApi(type);
+            });
+        };
+
+        return hasApi() || (loadLazyModulesForType(type) && hasApi());
     }
 
     template<typename T>
@@ -412,72 +458,171 @@ namespace nau
     }
 
 
-    async::Task<> ServiceProviderImpl::initServicesInternal(async::Task<> (*getTaskCallback)(IServiceInitialization&))
+    eastl::vector<IServiceInitialization*> ServiceProviderImpl::getInitializationServices()
     {
-        using namespace nau::async;
-
         eastl::vector<IServiceInitialization*> services;
         findAllInternal(rtti::getTypeInfo<IServiceInitialization>(), [](void* servicePtr, void* serviceCollection)
         {
             reinterpret_cast<decltype(services)*>(serviceCollection)->push_back(reinterpret_cast<IServiceInitialization*>(servicePtr));
         }, &services, ServiceAccessor::GetApiMode::AllowLazyCreation);
 
+        return services;
+    }
+
+    async::Task<> ServiceProviderImpl::initServicesInternal(async::Task<> (*getTaskCallback)(IServiceInitialization&), bool lateServicesOnly)
+    {
+        using namespace nau::async;
+
+        eastl::vector<IServiceInitialization*> services = getInitializationServices();
+        if (lateServicesOnly)
+        {
+            shared_lock_(m_mutex);
+            eastl::erase_if(services, [this](IServiceInitialization* service)
+            {
+                return m_initializedServices.count(service) > 0;
+            });
+        }
+
         auto [independentServices, orderedDependentServices] = makeInitOrderedServiceList(services);
 
+        // Wavefront: each service starts as soon as all its own dependencies are initialized.
+        struct InitNode
+        {
+            IServiceInitialization* service;
+            eastl::vector<size_t> dependencies;
+            Task<> task;
+            bool isStarted = false;
+            bool isCompleted = false;
+            std::chrono::steady_clock::time_point startTime;
+            std::chrono::microseconds duration{0};
+        };
+
+        eastl::vector<const ServiceEntry*> entries;
+        entries.reserve(independentServices.size() + orderedDependentServices.size());
+        for (const ServiceEntry& entry : independentServices)
+        {
+            entries.push_back(&entry);
+        }
+        for (const ServiceEntry& entry : orderedDependentServices)
+        {
+            entries.push_back(&entry);
+        }
+
+        eastl::vector<InitNode> nodes;
+        nodes.reserve(entries.size());
+        for (const ServiceEntry* const entry : entries)
         {
-            eastl::vector<Task<>> independentInitializationTasks;
-            for (const ServiceEntry& entry : independentServices)
+            InitNode& node = nodes.emplace_back(InitNode{entry->service});
+            for (size_t i = 0; i < entries.size(); ++i)
             {
-                IServiceInitialization& serviceInstance = getInitializationInstance(entry.service);
-                if (auto task = getTaskCallback(serviceInstance); task && !task.isReady())
+                if (entry->isDependsOn(*entries[i]))
                 {
-                    independentInitializationTasks.emplace_back(std::move(task));
+                    node.dependencies.push_back(i);
                 }
             }
+        }
 
-            co_await whenAll(independentInitializationTasks);
+        const auto initStartTime = std::chrono::steady_clock::now();
+        const auto completeNode = [](InitNode& node)
+        {
+            node.isCompleted = true;
+            node.duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - node.startTime);
 
 #ifdef NAU_ASSERT_ENABLED
-            for (auto& task : independentInitializationTasks)
+            if (node.task && node.task.isRejected())
             {
-                if (task.isRejected())
-                {
-                    NAU_FAILURE(task.getError()->getDiagMessage().c_str());
-                }
+                NAU_FAILURE(node.task.getError()->getDiagMessage().c_str());
             }
 #endif
-        }
+        };
+
+        size_t completedCount = 0;
+        eastl::vector<Task<>*> runningTasks;
 
-        for (const ServiceEntry& serviceEntry : orderedDependentServices)
+        while (completedCount < nodes.size())
         {
-            IServiceInitialization& serviceInstance = getInitializationInstance(serviceEntry.service);
-            if (Task<> task = getTaskCallback(serviceInstance); task)
+            bool hasStartedNodes = false;
+            for (InitNode& node : nodes)
             {
-                co_await task;
+                const bool isDependenciesCompleted = eastl::all_of(node.dependencies.begin(), node.dependencies.end(), [&nodes](size_t index)
+                {
+                    return nodes[index].isCompleted;
+                });
 
-#ifdef NAU_ASSERT_ENABLED
-                if (task.isRejected())
+                if (node.isStarted || !isDependenciesCompleted)
                 {
-                    NAU_FAILURE(task.getError()->getDiagMessage().c_str());
+                    continue;
+                }
+
+                node.isStarted = true;
+                node.startTime = std::chrono::steady_clock::now();
+                node.task = getTaskCallback(getInitializationInstance(node.service));
+                hasStartedNodes = true;
+
+                if (!node.task || node.task.isReady())
+                {
+                    // the dependents of the synchronously initialized service can be started within the same pass
+                    completeNode(node);
+                    ++completedCount;
                 }
-#endif
             }
-        }
-    }
 
+            runningTasks.clear();
+            for (InitNode& node : nodes)
+            {
+                if (node.isStarted && !node.isCompleted)
+                {
+                    runningTasks.push_back(&node.task);
+                }
+            }
 
-    void ServiceProviderImpl::setInitializationProxy(const IServiceInitialization& source, IServiceInitialization* proxy)
-    {
-        lock_(m_mutex);
+            if (runningTasks.empty())
+            {
+                NAU_FATAL(hasStartedNodes || completedCount == nodes.size(), "Service cyclic dependency");
+                continue;
+            }
 
-        if (proxy)
+            co_await whenAny(runningTasks);
+
+            for (InitNode& node : nodes)
+            {
+                if (node.isStarted && !node.isCompleted && node.task.isReady())
+                {
+                    completeNode(node);
+                    ++completedCount;
+                }
+            }
+        }
+
+        // Startup profiling report
+        eastl::vector<eastl::pair<ServiceAccessor*, std::string>> namedAccessors;
         {
-            NAU_ASSERT(!m_initializationProxy.contains(&source), "Proxy for source already set");
-            m_initializationProxy[&source] = proxy;
+            shared_lock_(m_mutex);
+            for (const ServiceAccessor::Ptr& accessor : m_accessors)
+            {
+                if (auto name = m_accessorNames.find(accessor.get()); name != m_accessorNames.end())
+                {
+                    namedAccessors.emplace_back(accessor.get(), name->second);
+                }
+            }
         }
-        else
+
+        eastl::unordered_map<const IServiceInitialization*, std::string> serviceNames;
+        for (auto& [accessor, name] : namedAccessors)
         {
-            m_initializationProxy.erase(&source);
+            if (const void* const api = accessor->getApi(rtti::getTypeInfo<IServiceInitialization>(), ServiceAccessor::GetApiMode::DoNotCreate))
+            {
+                serviceNames[reinterpret_cast<const IServiceInitialization*>(api)] = std::move(name);
+            }
+        }
+
+        using namespace std::chrono;
+        NAU_LOG_DEBUG("Services initialization step: ({}) services, ({})ms", nodes.size(), duration_cast<milliseconds>(steady_clock::now() - initStartTime).count());
+        for (const InitNode& node : nodes)
+        {
+            const auto name = serviceNames.find(node.service);
+            NAU_LOG_DEBUG("  ({}): started at ({})ms, took ({})us", name != serviceNames.end() ? name->second : std::string{"<unnamed>"},
+                          duration_cast<milliseconds>(node.startTime - initStartTime).count(), node.duration.count());
         }
     }
 
@@ -491,10 +636,44 @@ namespace nau
 
     async::Task<> ServiceProviderImpl::initServices()
     {
-        return initServicesInternal([](IServiceInitialization& serviceInit)
+        co_await initServicesInternal([](IServiceInitialization& serviceInit)
         {
             return serviceInit.initService();
         });
+
+        markServicesInitialized();
+    }
+
+    async::Task<> ServiceProviderImpl::initLateServices()
+    {
+        {
+            shared_lock_(m_mutex);
+            if (!m_isServicesInitialized)
+            {
+                co_return;
+            }
+        }
+
+        co_await initServicesInternal([](IServiceInitialization& serviceInit)
+        {
+            return serviceInit.preInitService();
+        }, true);
+
+        co_await initServicesInternal([](IServiceInitialization& serviceInit)
+        {
+            return serviceInit.initService();
+        }, true);
+
+        markServicesInitialized();
+    }
+
+    void ServiceProviderImpl::markServicesInitialized()
+    {
+        eastl::vector<IServiceInitialization*> services = getInitializationServices();
+
+        lock_(m_mutex);
+        m_initializedServices.insert(services.begin(), services.end());
+        m_isServicesInitialized = true;
     }
 
     async::Task<> ServiceProviderImpl::shutdownServices()
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <EASTL/unordered_set.h>
+
 #include "nau/rtti/rtti_impl.h"
 #include "nau/service/internal/service_provider_initialization.h"
 #include "nau/service/service.h"
@@ -41,6 +43,14 @@ namespace nau
 
         void* findInternal(const rtti::TypeInfo&) override;
 
+        void* findLoadedInternal(const rtti::TypeInfo&);
+
+        /**
+            Loads the lazy modules which provide the type (see IModuleManager::loadLazyModulesForType()).
+            Returns true if the type should be looked up again.
+         */
+        bool loadLazyModulesForType(const rtti::TypeInfo&);
+
         void findAllInternal(const rtti::TypeInfo&, void (*)(void* instancePtr, void*), void*, ServiceAccessor::GetApiMode) override;
 
         void addServiceAccessorInternal(ServiceAccessor::Ptr, IClassDescriptor::Ptr) override;
@@ -59,18 +69,27 @@ namespace nau
 
         async::Task<> initServices() override;
 
+        async::Task<> initLateServices() override;
+
         async::Task<> shutdownServices() override;
 
-        async::Task<> initServicesInternal(async::Task<> (*)(IServiceInitialization&));
+        async::Task<> initServicesInternal(async::Task<> (*)(IServiceInitialization&), bool lateServicesOnly = false);
+
+        eastl::vector<IServiceInitialization*> getInitializationServices();
+
+        void markServicesInitialized();
 
         template<typename T>
         T& getInitializationInstance(T* instance);
 
         eastl::list<ServiceAccessor::Ptr> m_accessors;
+        eastl::unordered_map<const ServiceAccessor*, std::string> m_accessorNames; /** < The service class names (for the startup profiling report). */
         eastl::unordered_map<rtti::TypeIndex, ServiceInstanceEntry> m_instances;
         eastl::vector<IClassDescriptor::Ptr> m_classDescriptors;
         eastl::unordered_map<const IServiceInitialization*, IServiceInitialization*> m_initializationProxy;
+        eastl::unordered_set<const IServiceInitialization*> m_initializedServices; /** < The services initialized by initServices() and initLateServices(). */
         std::shared_mutex m_mutex;
+        bool m_isServicesInitialized = false;
         bool m_isDisposed = false;
     };
 }  // namespace nau
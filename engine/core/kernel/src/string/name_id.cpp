@@ -0,0 +1,60 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "nau/string/name_id.h"
+
+#include <EASTL/string.h>
+#include <EASTL/unordered_map.h>
+
+#include <shared_mutex>
+
+#include "nau/diag/assertion.h"
+#include "nau/threading/lock_guard.h"
+
+namespace nau
+{
+    namespace
+    {
+        struct InternedNames
+        {
+            std::shared_mutex mutex;
+            eastl::unordered_map<size_t, eastl::string> names;
+        };
+
+        InternedNames& getInternedNames()
+        {
+            static InternedNames internedNames;
+            return internedNames;
+        }
+    }  // namespace
+
+    NameId NameId::intern(eastl::string_view name)
+    {
+        const NameId id{name};
+
+        InternedNames& internedNames = getInternedNames();
+        lock_(internedNames.mutex);
+
+        auto [iter, emplaced] = internedNames.names.try_emplace(id.getHash());
+        if (emplaced)
+        {
+            iter->second.assign(name.data(), name.size());
+        }
+        else
+        {
+            NAU_ASSERT(eastl::string_view{iter->second} == name, "The names ({}) and ({}) have the same hash", iter->second, name);
+        }
+
+        return id;
+    }
+
+    eastl::string_view NameId::getName() const
+    {
+        InternedNames& internedNames = getInternedNames();
+        shared_lock_(internedNames.mutex);
+
+        const auto iter = internedNames.names.find(m_hash);
+        return iter != internedNames.names.end() ? eastl::string_view{iter->second} : eastl::string_view{};
+    }
+}  // namespace nau
@@ -6,6 +6,7 @@
 #include "critsec.h"
 
 #include <nau/threading/critical_section.h>
+#include <nau/threading/lock_contention.h>
 #include <string.h>
 namespace dag
 {
@@ -182,11 +183,30 @@ namespace dag
 #endif
     }
 
-    void enter_critical_section(void* p, const char*)
+    void enter_critical_section(void* p, [[maybe_unused]] const char* waiter_perf_name)
     {
-        // ScopeLockProfiler<da_profiler::DescCritsec> lp; TODO Profiler support?
-        // NAU_UNUSED(lp);
+#if NAU_LOCK_CONTENTION_STATS
+        // The critical sections are not named at the creation: the sites are identified by the waiter name
+        struct CriticalSectionLock
+        {
+            void* p;
+
+            bool try_lock()
+            {
+                return try_enter_critical_section(p);
+            }
+
+            void lock()
+            {
+                enter_critical_section_raw(p);
+            }
+        } criticalSection{p};
+
+        static nau::threading::LockSite unnamedSite{"dag::CriticalSection"};
+        nau::threading::lockProfiled(criticalSection, waiter_perf_name ? nau::threading::getNamedLockSite(waiter_perf_name) : unnamedSite);
+#else
         enter_critical_section_raw(p);
+#endif
     }
 
 }  // namespace nau
@@ -0,0 +1,152 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "nau/threading/lock_contention.h"
+
+#include <EASTL/sort.h>
+#include <EASTL/string.h>
+#include <EASTL/unique_ptr.h>
+#include <EASTL/unordered_map.h>
+
+#include <mutex>
+
+#include "nau/diag/logging.h"
+
+namespace nau::threading
+{
+    /**
+        The sites are linked into the lock-free list: a site can be registered from any thread (and while the other lock is held),
+        the registry itself must never be guarded by the profiled lock.
+     */
+    struct LockSiteRegistry
+    {
+        static std::atomic<LockSite*>& getHead()
+        {
+            static std::atomic<LockSite*> head = nullptr;
+            return head;
+        }
+
+        static void add(LockSite& site)
+        {
+            auto& head = getHead();
+            site.m_next = head.load(std::memory_order_relaxed);
+            while (!head.compare_exchange_weak(site.m_next, &site, std::memory_order_release, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        template <typename F>
+        static void forEach(F&& callback)
+        {
+            for (LockSite* site = getHead().load(std::memory_order_acquire); site; site = site->m_next)
+            {
+                callback(*site);
+            }
+        }
+    };
+
+    LockSite::LockSite(const char* name, const char* file, int line) :
+        m_name(name ? name : "unnamed"),
+        m_file(file),
+        m_line(line)
+    {
+        LockSiteRegistry::add(*this);
+    }
+
+    void LockSite::addContendedAcquire(uint64_t waitNs)
+    {
+        m_contendedCount.fetch_add(1, std::memory_order_relaxed);
+        m_totalWaitNs.fetch_add(waitNs, std::memory_order_relaxed);
+
+        uint64_t maxWaitNs = m_maxWaitNs.load(std::memory_order_relaxed);
+        while (maxWaitNs < waitNs && !m_maxWaitNs.compare_exchange_weak(maxWaitNs, waitNs, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    LockSiteStats LockSite::getStats() const
+    {
+        return {
+            .name = m_name,
+            .file = m_file,
+            .line = m_line,
+            .acquireCount = m_acquireCount.load(std::memory_order_relaxed),
+            .contendedCount = m_contendedCount.load(std::memory_order_relaxed),
+            .totalWaitNs = m_totalWaitNs.load(std::memory_order_relaxed),
+            .maxWaitNs = m_maxWaitNs.load(std::memory_order_relaxed)};
+    }
+
+    void LockSite::reset()
+    {
+        m_acquireCount.store(0, std::memory_order_relaxed);
+        m_contendedCount.store(0, std::memory_order_relaxed);
+        m_totalWaitNs.store(0, std::memory_order_relaxed);
+        m_maxWaitNs.store(0, std::memory_order_relaxed);
+    }
+
+    LockSite& getNamedLockSite(const char* name)
+    {
+        static std::mutex mutex;
+        static eastl::unordered_map<eastl::string, eastl::unique_ptr<LockSite>> sites;
+
+        // Plain std::lock_guard: lock_ is profiled itself
+        const std::lock_guard lock{mutex};
+
+        auto& site = sites[name ? name : "unnamed"];
+        if (!site)
+        {
+            site = eastl::make_unique<LockSite>(name);
+        }
+
+        return *site;
+    }
+
+    eastl::vector<LockSiteStats> getLockContentionReport()
+    {
+        eastl::vector<LockSiteStats> report;
+        LockSiteRegistry::forEach([&report](const LockSite& site)
+        {
+            if (LockSiteStats stats = site.getStats(); stats.acquireCount > 0)
+            {
+                report.push_back(stats);
+            }
+        });
+
+        eastl::sort(report.begin(), report.end(), [](const LockSiteStats& left, const LockSiteStats& right)
+        {
+            return left.totalWaitNs != right.totalWaitNs ? left.totalWaitNs > right.totalWaitNs : left.contendedCount > right.contendedCount;
+        });
+
+        return report;
+    }
+
+    void resetLockContentionStats()
+    {
+        LockSiteRegistry::forEach([](LockSite& site)
+        {
+            site.reset();
+        });
+    }
+
+    void logLockContentionReport(size_t maxSites)
+    {
+#if !NAU_LOCK_CONTENTION_STATS
+        NAU_LOG_WARNING("The lock contention statistics are not collected: the engine is built without NAU_LOCK_CONTENTION_STATS");
+#endif
+        const eastl::vector<LockSiteStats> report = getLockContentionReport();
+
+        NAU_LOG("Lock contention ({} sites):", report.size());
+        for (size_t i = 0, count = eastl::min(report.size(), maxSites); i < count; ++i)
+        {
+            const LockSiteStats& stats = report[i];
+            const double contendedPercent = 100.0 * static_cast<double>(stats.contendedCount) / static_cast<double>(stats.acquireCount);
+
+            NAU_LOG("  {} ({}:{}): acquired {}, contended {} ({:.2f}%), wait total {:.3f} ms, max {:.3f} ms",
+                    stats.name, stats.file ? stats.file : "", stats.line,
+                    stats.acquireCount, stats.contendedCount, contendedPercent,
+                    static_cast<double>(stats.totalWaitNs) / 1'000'000.0, static_cast<double>(stats.maxWaitNs) / 1'000'000.0);
+        }
+    }
+
+}  // namespace nau::threading
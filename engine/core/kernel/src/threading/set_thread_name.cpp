@@ -3,7 +3,7 @@
 
 
 #include "nau/threading/set_thread_name.h"
-// TODO Tracy #include "tracy/Tracy.hpp"
+#include "nau/utils/performance_profiling.h"
 
 namespace nau::threading
 {
@@ -47,7 +47,7 @@ namespace nau::threading
         }
     #pragma warning(pop)
 
-// TODO Tracy        tracy::SetThreadName(name.c_str());
+        NAU_PROFILING_SET_THREAD_NAME(name.c_str());
 #endif // NAU_PLATFORM_WINDOWS
     }
 
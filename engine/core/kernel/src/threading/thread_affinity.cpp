@@ -0,0 +1,43 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "nau/threading/thread_affinity.h"
+
+#include "nau/diag/logging.h"
+
+namespace nau::threading
+{
+    bool setThisThreadAffinity([[maybe_unused]] eastl::span<const uint32_t> cores)
+    {
+#if NAU_PLATFORM_WIN32
+        DWORD_PTR processMask = 0;
+        DWORD_PTR systemMask = 0;
+        if (!::GetProcessAffinityMask(::GetCurrentProcess(), &processMask, &systemMask))
+        {
+            return false;
+        }
+
+        DWORD_PTR threadMask = 0;
+        for (const uint32_t core : cores)
+        {
+            if (core < sizeof(DWORD_PTR) * 8)
+            {
+                threadMask |= DWORD_PTR{1} << core;
+            }
+        }
+
+        threadMask &= processMask;
+        if (threadMask == 0)
+        {
+            NAU_LOG_WARNING("None of the requested cores is available to the process");
+            return false;
+        }
+
+        return ::SetThreadAffinityMask(::GetCurrentThread(), threadMask) != 0;
+#else
+        return false;
+#endif
+    }
+
+}  // namespace nau::threading
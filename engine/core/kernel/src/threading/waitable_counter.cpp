@@ -0,0 +1,67 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "nau/threading/waitable_counter.h"
+
+#include "nau/diag/assertion.h"
+#include "nau/utils/scope_guard.h"
+
+namespace nau::threading
+{
+    void WaitableCounter::increment(size_t count)
+    {
+        m_counter.fetch_add(count);
+    }
+
+    void WaitableCounter::decrement(size_t count)
+    {
+        [[maybe_unused]] const size_t prevCount = m_counter.fetch_sub(count);
+        NAU_ASSERT(prevCount >= count);
+
+        // Both the counter and the waiters count are accessed with sequential consistent ordering:
+        // if waiter is registered after this check, it will observe zero counter by itself.
+        if (prevCount == count && m_waitersCount.load() > 0)
+        {
+            // Taking the mutex guarantees that the waiter is either not checked the counter yet or is already blocked inside wait.
+            {
+                const std::lock_guard lock{m_mutex};
+            }
+            m_signal.notify_all();
+        }
+    }
+
+    size_t WaitableCounter::getCount() const
+    {
+        return m_counter.load();
+    }
+
+    bool WaitableCounter::waitForZero(std::optional<std::chrono::milliseconds> timeout) const
+    {
+        if (m_counter.load() == 0)
+        {
+            return true;
+        }
+
+        std::unique_lock lock{m_mutex};
+        m_waitersCount.fetch_add(1);
+        scope_on_leave
+        {
+            m_waitersCount.fetch_sub(1);
+        };
+
+        const auto isZero = [this]
+        {
+            return m_counter.load() == 0;
+        };
+
+        if (!timeout)
+        {
+            m_signal.wait(lock, isZero);
+            return true;
+        }
+
+        return m_signal.wait_for(lock, *timeout, isZero);
+    }
+
+}  // namespace nau::threading
@@ -98,7 +98,7 @@ namespace nau::test
                 continue;
             }
 
-            if (strings::icaseEqual(entry.path().extension().wstring(), L".json"))
+            if (strings::icaseEqual(entry.path().extension().wstring(), L".json") || strings::icaseEqual(entry.path().extension().wstring(), L".roblk"))
             {
                 NauCheckResult(mergePropertiesFromFile(globalProperties, entry.path()));
             }
@@ -0,0 +1,99 @@
+// test_frustum.cpp
+//
+// Copyright (c) N-GINN LLC., 2023-2025. All rights reserved.
+//
+
+#include "nau/math/dag_frustum.h"
+
+namespace nau::test
+{
+    using namespace nau::math;
+
+    namespace
+    {
+        NauFrustum makeTestFrustum(const Point3& eyePos = Point3{0.f, 2.f, 10.f})
+        {
+            const Matrix4 view = Matrix4::lookAtRH(eyePos, Point3{0.f, 0.f, 0.f}, Vector3{0.f, 1.f, 0.f});
+            const Matrix4 proj = Matrix4::perspectiveRH(1.2f, 16.f / 9.f, 0.1f, 50.f);
+            return NauFrustum{proj * view};
+        }
+
+        // Spheres all around the camera: inside, outside and intersecting the frustum planes.
+        eastl::vector<BSphere3> makeTestSpheres(size_t count)
+        {
+            eastl::vector<BSphere3> spheres;
+            spheres.reserve(count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                const float x = static_cast<float>(i % 17) * 4.1f - 33.f;
+                const float y = static_cast<float>((i / 17) % 7) * 3.3f - 10.f;
+                const float z = static_cast<float>(i / (17 * 7)) * 7.7f - 55.f;
+                spheres.emplace_back(Vector3{x, y, z}, 0.25f + static_cast<float>(i % 5) * 0.7f);
+            }
+            return spheres;
+        }
+    }  // namespace
+
+    TEST(TestFrustum, TestSpheresMatchesTestSphere)
+    {
+        const NauFrustum frustum = makeTestFrustum();
+
+        // Not a multiple of the batch sizes: the scalar tail is tested too.
+        const eastl::vector<BSphere3> spheres = makeTestSpheres(1003);
+        eastl::vector<uint32_t> mask(NauFrustum::getVisibleMaskSize(spheres.size()), ~0u);
+        frustum.testSpheres(spheres, mask);
+
+        size_t visibleCount = 0;
+        for (size_t i = 0; i < spheres.size(); ++i)
+        {
+            const bool isVisible = (mask[i / 32] & (1u << (i % 32))) != 0;
+            ASSERT_EQ(isVisible, frustum.testSphere(spheres[i]) != 0) << "sphere: " << i;
+            visibleCount += isVisible ? 1 : 0;
+        }
+
+        ASSERT_GT(visibleCount, 0);
+        ASSERT_LT(visibleCount, spheres.size());
+
+        // The unused bits of the last word are cleared.
+        const uint32_t tailBits = static_cast<uint32_t>(spheres.size() % 32);
+        ASSERT_EQ(mask.back() >> tailBits, 0u);
+    }
+
+    TEST(TestFrustum, TestSpheresMultipleFrusta)
+    {
+        // More frusta than the one pass handles: the frusta are split into several batches.
+        eastl::vector<NauFrustum> frusta;
+        for (int i = 0; i < 11; ++i)
+        {
+            frusta.push_back(makeTestFrustum(Point3{static_cast<float>(i) * 3.f - 15.f, 2.f, 10.f}));
+        }
+
+        const eastl::vector<BSphere3> spheres = makeTestSpheres(517);
+        const size_t maskSize = NauFrustum::getVisibleMaskSize(spheres.size());
+
+        eastl::vector<const NauFrustum*> frustaPtrs;
+        eastl::vector<eastl::vector<uint32_t>> masks(frusta.size(), eastl::vector<uint32_t>(maskSize, ~0u));
+        eastl::vector<uint32_t*> maskPtrs;
+        for (size_t f = 0; f < frusta.size(); ++f)
+        {
+            frustaPtrs.push_back(&frusta[f]);
+            maskPtrs.push_back(masks[f].data());
+        }
+
+        NauFrustum::testSpheres(frustaPtrs, spheres, maskPtrs);
+
+        for (size_t f = 0; f < frusta.size(); ++f)
+        {
+            eastl::vector<uint32_t> expectedMask(maskSize);
+            frusta[f].testSpheres(spheres, expectedMask);
+            ASSERT_EQ(masks[f], expectedMask) << "frustum: " << f;
+        }
+    }
+
+    TEST(TestFrustum, TestSpheresEmpty)
+    {
+        const NauFrustum frustum = makeTestFrustum();
+        frustum.testSpheres({}, {});
+    }
+
+}  // namespace nau::test
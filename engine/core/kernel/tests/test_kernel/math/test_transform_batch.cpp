@@ -0,0 +1,88 @@
+// test_transform_batch.cpp
+//
+// Copyright (c) N-GINN LLC., 2023-2025. All rights reserved.
+//
+
+#include "nau/math/transform_batch.h"
+
+namespace nau::test
+{
+    using namespace nau::math;
+
+    namespace
+    {
+        // Rotated, translated and scaled transforms, some of them with the zero or the negative scale (the decomposition path).
+        eastl::vector<Transform> makeTestTransforms(size_t count)
+        {
+            eastl::vector<Transform> transforms;
+            transforms.reserve(count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                const float f = static_cast<float>(i);
+                const Quat rotation = Quat::rotation(0.3f + f * 0.17f, normalize(Vector3{1.f + f, 2.f, 0.5f * f - 3.f}));
+                const float scaleX = i % 7 == 3 ? -1.5f : (i % 11 == 5 ? 0.f : 0.5f + f * 0.1f);
+                transforms.emplace_back(rotation, Vector3{f - 8.f, 2.f * f, 5.f - f}, Vector3{scaleX, 1.f + f * 0.05f, 2.f});
+            }
+            return transforms;
+        }
+    }  // namespace
+
+    TEST(TestTransformBatch, MultiplyTransformsMatchesOperator)
+    {
+        const eastl::vector<Transform> lhs = makeTestTransforms(37);
+        const eastl::vector<Transform> rhs = makeTestTransforms(lhs.size() + 1);
+
+        eastl::vector<Transform> out(lhs.size());
+        multiplyTransforms(lhs, eastl::span{rhs.data() + 1, lhs.size()}, out);
+        for (size_t i = 0; i < lhs.size(); ++i)
+        {
+            ASSERT_TRUE(out[i].similar(lhs[i] * rhs[i + 1])) << "transform: " << i;
+        }
+
+        // The output is the input: the children are updated in place.
+        const Transform parent{Quat::rotationY(0.7f), Vector3{1.f, 2.f, 3.f}, Vector3{2.f, 2.f, 0.5f}};
+        eastl::vector<Transform> children = lhs;
+        multiplyTransforms(parent, children, children);
+        for (size_t i = 0; i < lhs.size(); ++i)
+        {
+            ASSERT_TRUE(children[i].similar(parent * lhs[i])) << "transform: " << i;
+        }
+    }
+
+    TEST(TestTransformBatch, InverseTransposeMatchesInverse)
+    {
+        const eastl::vector<Transform> transforms = makeTestTransforms(29);
+
+        eastl::vector<Matrix4> matrices(transforms.size());
+        transformsToMatrices(transforms, matrices);
+
+        eastl::vector<Matrix4> normalMatrices(matrices.size());
+        inverseTransposeAffine(matrices, normalMatrices);
+
+        for (size_t i = 0; i < transforms.size(); ++i)
+        {
+            ASSERT_TRUE(matrices[i].similar(transforms[i].toMatrixWithScale())) << "transform: " << i;
+
+            const bool isSingular = transforms[i].getScale().getX() == 0.f;
+            if (!isSingular)
+            {
+                ASSERT_TRUE(normalMatrices[i].similar(transpose(inverse(matrices[i])), 1e-3f)) << "transform: " << i;
+            }
+        }
+    }
+
+    TEST(TestTransformBatch, TransformSpheres)
+    {
+        const Matrix4 matrix = Matrix4::translation(Vector3{10.f, 0.f, 0.f}) * Matrix4::rotationZ(1.f) * Matrix4::scale(Vector3{1.f, 3.f, 2.f});
+        const BSphere3 spheres[] = {BSphere3{Vector3{1.f, 0.f, 0.f}, 2.f}, BSphere3{}};
+
+        BSphere3 out[2];
+        transformSpheres(eastl::span{&matrix, 1}, eastl::span{spheres, 1}, eastl::span{out, 1});
+        ASSERT_TRUE(out[0].c.similar((matrix * Point3{spheres[0].c}).getXYZ()));
+        ASSERT_NEAR(out[0].r, 6.f, 1e-4f);
+
+        out[1] = transformSphere(matrix, spheres[1]);
+        ASSERT_TRUE(out[1].isempty());
+    }
+
+}  // namespace nau::test
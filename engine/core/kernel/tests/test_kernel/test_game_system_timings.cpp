@@ -0,0 +1,67 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include <EASTL/optional.h>
+
+#include "nau/app/main_loop/game_system_timings.h"
+
+namespace nau::test
+{
+    namespace
+    {
+        eastl::optional<GameSystemTimings> findTimings(eastl::string_view name)
+        {
+            for (GameSystemTimings& timings : getGameSystemTimings())
+            {
+                if (name == timings.name)
+                {
+                    return std::move(timings);
+                }
+            }
+
+            return eastl::nullopt;
+        }
+    }  // namespace
+
+    /**
+        Test: the timings keep the last sample and the average/max over the last SamplesCount samples.
+     */
+    TEST(TestGameSystemTimings, AverageOverLastSamples)
+    {
+        using namespace std::chrono;
+
+        constexpr eastl::string_view Name = "TestGameSystemTimings.AverageOverLastSamples";
+
+        reportGameSystemTime(Name, microseconds{1000});
+        for (size_t i = 0; i < GameSystemTimings::SamplesCount; ++i)
+        {
+            reportGameSystemTime(Name, microseconds{i % 2 == 0 ? 10 : 30});
+        }
+
+        const eastl::optional<GameSystemTimings> timings = findTimings(Name);
+        ASSERT_TRUE(timings);
+        ASSERT_EQ(timings->updatesCount, GameSystemTimings::SamplesCount + 1);
+        ASSERT_EQ(timings->last, microseconds{30});
+        ASSERT_EQ(timings->average, microseconds{20});
+        ASSERT_EQ(timings->max, microseconds{30});
+    }
+
+    /**
+        Test: the time scope reports the system once per scope.
+     */
+    TEST(TestGameSystemTimings, TimeScope)
+    {
+        constexpr eastl::string_view Name = "TestGameSystemTimings.TimeScope";
+
+        for (int i = 0; i < 3; ++i)
+        {
+            const GameSystemTimeScope timeScope{Name};
+        }
+
+        const eastl::optional<GameSystemTimings> timings = findTimings(Name);
+        ASSERT_TRUE(timings);
+        ASSERT_EQ(timings->updatesCount, 3);
+        ASSERT_LE(timings->average, timings->max);
+    }
+}  // namespace nau::test
@@ -0,0 +1,79 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include <fstream>
+
+#include "nau/io/special_paths.h"
+#include "nau/io/virtual_file_system.h"
+
+namespace nau::test
+{
+    class TestVirtualFileSystem : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            m_contentPath = io::getKnownFolderPath(io::KnownFolder::Temp) / "nau_test_vfs";
+            std::filesystem::create_directories(m_contentPath / "textures");
+            std::ofstream{m_contentPath / "textures" / "file.txt"} << "content";
+        }
+
+        void TearDown() override
+        {
+            std::error_code error;
+            std::filesystem::remove_all(m_contentPath, error);
+        }
+
+        std::filesystem::path m_contentPath;
+    };
+
+    TEST_F(TestVirtualFileSystem, ResolveMountedPath)
+    {
+        auto vfs = io::createVirtualFileSystem();
+        vfs->mount("/content", io::createNativeFileSystem(m_contentPath.string())).ignore();
+
+        // Repeat to check the lookup through the cached resolution.
+        for (int i = 0; i < 2; ++i)
+        {
+            ASSERT_TRUE(vfs->exists("/content/textures/file.txt", io::FsEntryKind::File));
+            ASSERT_FALSE(vfs->exists("/content/textures/missing.txt", io::FsEntryKind::File));
+            ASSERT_TRUE(vfs->openFile("/content/textures/file.txt", io::AccessMode::Read, io::OpenFileMode::OpenExisting));
+        }
+    }
+
+    TEST_F(TestVirtualFileSystem, UnmountInvalidatesResolvedPaths)
+    {
+        auto vfs = io::createVirtualFileSystem();
+        io::IFileSystem::Ptr contentFs = io::createNativeFileSystem(m_contentPath.string());
+
+        vfs->mount("/content", contentFs).ignore();
+        ASSERT_TRUE(vfs->exists("/content/textures/file.txt", io::FsEntryKind::File));
+
+        vfs->unmount(contentFs);
+        ASSERT_FALSE(vfs->exists("/content/textures/file.txt", io::FsEntryKind::File));
+
+        vfs->mount("/content", contentFs).ignore();
+        ASSERT_TRUE(vfs->exists("/content/textures/file.txt", io::FsEntryKind::File));
+    }
+
+    TEST_F(TestVirtualFileSystem, MountInvalidatesResolvedPaths)
+    {
+        auto vfs = io::createVirtualFileSystem();
+        ASSERT_FALSE(vfs->exists("/content/textures/file.txt", io::FsEntryKind::File));
+
+        vfs->mount("/content", io::createNativeFileSystem(m_contentPath.string())).ignore();
+        ASSERT_TRUE(vfs->exists("/content/textures/file.txt", io::FsEntryKind::File));
+    }
+
+    TEST_F(TestVirtualFileSystem, TrustedMount)
+    {
+        auto vfs = io::createVirtualFileSystem();
+        vfs->mount("/content", io::createNativeFileSystem(m_contentPath.string())).ignore();
+        vfs->mount("/packs", io::createNativeFileSystem(m_contentPath.string()), 1, io::MountTrust::Trusted).ignore();
+
+        ASSERT_FALSE(vfs->isTrustedFile("/content/textures/file.txt"));
+        ASSERT_TRUE(vfs->isTrustedFile("/packs/textures/file.txt"));
+        ASSERT_FALSE(vfs->isTrustedFile("/packs/textures/missing.txt"));
+    }
+}  // namespace nau::test
@@ -0,0 +1,166 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include <zlib.h>
+
+#include "nau/io/file_system.h"
+#include "nau/io/memory_stream.h"
+#include "nau/memory/bytes_buffer.h"
+
+namespace nau::test
+{
+    namespace
+    {
+        struct ZipTestEntry
+        {
+            std::string name;
+            std::string content;
+            bool deflate = false;
+        };
+
+        template <typename T>
+        void appendValue(std::string& data, T value)
+        {
+            data.append(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        std::string deflateRaw(const std::string& content)
+        {
+            z_stream stream{};
+            deflateInit2(&stream, Z_BEST_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+
+            std::string result(deflateBound(&stream, static_cast<uLong>(content.size())), '\0');
+            stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(content.data()));
+            stream.avail_in = static_cast<uInt>(content.size());
+            stream.next_out = reinterpret_cast<Bytef*>(result.data());
+            stream.avail_out = static_cast<uInt>(result.size());
+
+            deflate(&stream, Z_FINISH);
+            result.resize(stream.total_out);
+            deflateEnd(&stream);
+
+            return result;
+        }
+
+        /**
+            Builds the minimal zip archive: local headers with the data, the central directory and the end of central directory record.
+         */
+        io::IStreamReader::Ptr makeZipArchive(const std::vector<ZipTestEntry>& entries)
+        {
+            std::string archive;
+            std::string centralDirectory;
+
+            for (const ZipTestEntry& entry : entries)
+            {
+                const std::string data = entry.deflate ? deflateRaw(entry.content) : entry.content;
+                const uint16_t method = entry.deflate ? 8 : 0;
+                const uint32_t crc = crc32(0, reinterpret_cast<const Bytef*>(entry.content.data()), static_cast<uInt>(entry.content.size()));
+                const uint32_t localHeaderOffset = static_cast<uint32_t>(archive.size());
+
+                appendValue<uint32_t>(archive, 0x04034b50);
+                appendValue<uint16_t>(archive, 20);  // version needed
+                appendValue<uint16_t>(archive, 0);   // flags
+                appendValue<uint16_t>(archive, method);
+                appendValue<uint32_t>(archive, 0);  // time, date
+                appendValue<uint32_t>(archive, crc);
+                appendValue<uint32_t>(archive, static_cast<uint32_t>(data.size()));
+                appendValue<uint32_t>(archive, static_cast<uint32_t>(entry.content.size()));
+                appendValue<uint16_t>(archive, static_cast<uint16_t>(entry.name.size()));
+                appendValue<uint16_t>(archive, 0);  // extra length
+                archive += entry.name;
+                archive += data;
+
+                appendValue<uint32_t>(centralDirectory, 0x02014b50);
+                appendValue<uint16_t>(centralDirectory, 20);  // version made by
+                appendValue<uint16_t>(centralDirectory, 20);  // version needed
+                appendValue<uint16_t>(centralDirectory, 0);   // flags
+                appendValue<uint16_t>(centralDirectory, method);
+                appendValue<uint32_t>(centralDirectory, 0);  // time, date
+                appendValue<uint32_t>(centralDirectory, crc);
+                appendValue<uint32_t>(centralDirectory, static_cast<uint32_t>(data.size()));
+                appendValue<uint32_t>(centralDirectory, static_cast<uint32_t>(entry.content.size()));
+                appendValue<uint16_t>(centralDirectory, static_cast<uint16_t>(entry.name.size()));
+                appendValue<uint16_t>(centralDirectory, 0);  // extra length
+                appendValue<uint16_t>(centralDirectory, 0);  // comment length
+                appendValue<uint16_t>(centralDirectory, 0);  // disk number
+                appendValue<uint16_t>(centralDirectory, 0);  // internal attributes
+                appendValue<uint32_t>(centralDirectory, 0);  // external attributes
+                appendValue<uint32_t>(centralDirectory, localHeaderOffset);
+                centralDirectory += entry.name;
+            }
+
+            const uint32_t centralDirectoryOffset = static_cast<uint32_t>(archive.size());
+            archive += centralDirectory;
+
+            appendValue<uint32_t>(archive, 0x06054b50);
+            appendValue<uint32_t>(archive, 0);  // disk numbers
+            appendValue<uint16_t>(archive, static_cast<uint16_t>(entries.size()));
+            appendValue<uint16_t>(archive, static_cast<uint16_t>(entries.size()));
+            appendValue<uint32_t>(archive, static_cast<uint32_t>(centralDirectory.size()));
+            appendValue<uint32_t>(archive, centralDirectoryOffset);
+            appendValue<uint16_t>(archive, 0);  // comment length
+
+            return io::createMemoryStream(fromStringView(archive));
+        }
+
+        std::string readFileContent(io::IFileSystem& fileSystem, const io::FsPath& path)
+        {
+            io::IFile::Ptr file = fileSystem.openFile(path, io::AccessMode::Read, io::OpenFileMode::OpenExisting);
+            if (!file)
+            {
+                return {};
+            }
+
+            io::IStreamReader::Ptr stream = file->createStream();
+            std::string content(file->getSize(), '\0');
+            const size_t readCount = *stream->read(reinterpret_cast<std::byte*>(content.data()), content.size());
+            content.resize(readCount);
+
+            return content;
+        }
+    }  // namespace
+
+    TEST(TestZipArchiveFileSystem, ReadEntries)
+    {
+        const std::string longContent(10000, 'a');
+
+        io::IFileSystem::Ptr fileSystem = io::createZipArchiveFileSystem(makeZipArchive({
+            {"stored.txt", "stored content", false},
+            {"textures/deflated.txt", longContent, true}
+        }));
+        ASSERT_TRUE(fileSystem);
+
+        ASSERT_EQ(readFileContent(*fileSystem, "/stored.txt"), "stored content");
+        ASSERT_EQ(readFileContent(*fileSystem, "/textures/deflated.txt"), longContent);
+        ASSERT_FALSE(fileSystem->openFile("/missing.txt", io::AccessMode::Read, io::OpenFileMode::OpenExisting));
+    }
+
+    TEST(TestZipArchiveFileSystem, Directories)
+    {
+        io::IFileSystem::Ptr fileSystem = io::createZipArchiveFileSystem(makeZipArchive({
+            {"a/b/file1.txt", "1", false},
+            {"a/file2.txt", "2", true}
+        }));
+        ASSERT_TRUE(fileSystem);
+
+        ASSERT_TRUE(fileSystem->exists("/a", io::FsEntryKind::Directory));
+        ASSERT_TRUE(fileSystem->exists("/a/b", io::FsEntryKind::Directory));
+        ASSERT_TRUE(fileSystem->exists("/a/b/file1.txt", io::FsEntryKind::File));
+        ASSERT_FALSE(fileSystem->exists("/a/b", io::FsEntryKind::File));
+        ASSERT_FALSE(fileSystem->exists("/a/file1.txt"));
+
+        auto dirIterator = fileSystem->openDirIterator("/a");
+        ASSERT_TRUE(dirIterator);
+
+        auto [state, entry] = *dirIterator;
+        size_t entriesCount = 0;
+        for (; entry; entry = fileSystem->incrementDirIterator(state))
+        {
+            ++entriesCount;
+        }
+        fileSystem->closeDirIterator(state);
+
+        ASSERT_EQ(entriesCount, 2);
+    }
+}  // namespace nau::test
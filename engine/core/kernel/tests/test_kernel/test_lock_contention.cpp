@@ -0,0 +1,101 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#include <EASTL/optional.h>
+
+#include "nau/threading/lock_contention.h"
+#include "nau/threading/spin_lock.h"
+
+namespace nau::test
+{
+    namespace
+    {
+        eastl::optional<threading::LockSiteStats> findSiteStats(const char* name)
+        {
+            for (const threading::LockSiteStats& stats : threading::getLockContentionReport())
+            {
+                if (strcmp(stats.name, name) == 0)
+                {
+                    return stats;
+                }
+            }
+
+            return eastl::nullopt;
+        }
+    }  // namespace
+
+    /**
+        Test: the uncontended acquisitions are counted without the wait time.
+     */
+    TEST(TestLockContention, UncontendedAcquire)
+    {
+        static threading::LockSite site{"TestLockContention.UncontendedAcquire"};
+        site.reset();
+
+        std::mutex mutex;
+        for (int i = 0; i < 10; ++i)
+        {
+            threading::ProfiledLockGuard lock{mutex, site};
+        }
+
+        const auto stats = findSiteStats(site.getName());
+        ASSERT_TRUE(stats);
+        ASSERT_EQ(stats->acquireCount, 10);
+        ASSERT_EQ(stats->contendedCount, 0);
+        ASSERT_EQ(stats->totalWaitNs, 0);
+    }
+
+    /**
+        Test: the acquisition of the lock held by the other thread is counted as contended with the wait time.
+     */
+    TEST(TestLockContention, ContendedAcquire)
+    {
+        using namespace std::chrono_literals;
+
+        static threading::LockSite site{"TestLockContention.ContendedAcquire"};
+        site.reset();
+
+        threading::SpinLock mutex;
+        std::atomic<bool> locked = false;
+
+        std::thread ownerThread([&]
+        {
+            mutex.lock();
+            locked = true;
+            std::this_thread::sleep_for(20ms);
+            mutex.unlock();
+        });
+
+        while (!locked)
+        {
+            std::this_thread::yield();
+        }
+
+        {
+            threading::ProfiledLockGuard lock{mutex, site};
+        }
+
+        ownerThread.join();
+
+        const auto stats = findSiteStats(site.getName());
+        ASSERT_TRUE(stats);
+        ASSERT_EQ(stats->acquireCount, 1);
+        ASSERT_EQ(stats->contendedCount, 1);
+        ASSERT_GT(stats->totalWaitNs, 0);
+        ASSERT_EQ(stats->maxWaitNs, stats->totalWaitNs);
+
+        threading::resetLockContentionStats();
+        ASSERT_FALSE(findSiteStats(site.getName()));
+    }
+
+    /**
+        Test: the same named site is returned for the same name.
+     */
+    TEST(TestLockContention, NamedSite)
+    {
+        threading::LockSite& site1 = threading::getNamedLockSite("TestLockContention.NamedSite");
+        threading::LockSite& site2 = threading::getNamedLockSite(eastl::string{"TestLockContention.NamedSite"}.c_str());
+
+        ASSERT_EQ(&site1, &site2);
+    }
+}  // namespace nau::test
@@ -0,0 +1,167 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+// test_message_channel.cpp
+
+
+#include "nau/messaging/message_channel.h"
+#include "nau/runtime/internal/runtime_state.h"
+
+namespace nau::test
+{
+    namespace
+    {
+        struct HitMessage
+        {
+            uint32_t targetId;
+            float damage;
+        };
+
+        NAU_DECLARE_MESSAGE_CHANNEL(TestHitChannel, "test.hit", HitMessage);
+
+        bool waitForCount(const std::atomic<size_t>& counter, size_t expectedCount)
+        {
+            using namespace std::chrono_literals;
+
+            const auto deadline = std::chrono::steady_clock::now() + 5s;
+            while (counter.load() < expectedCount)
+            {
+                if (std::chrono::steady_clock::now() > deadline)
+                {
+                    return false;
+                }
+                std::this_thread::sleep_for(1ms);
+            }
+
+            return true;
+        }
+    }  // namespace
+
+    class TestMessageChannel : public ::testing::Test
+    {
+    protected:
+        ~TestMessageChannel()
+        {
+            auto shutdown = m_runtime->shutdown();
+
+            while (shutdown())
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            }
+        }
+
+        const RuntimeState::Ptr m_runtime = RuntimeState::create();
+    };
+
+    /**
+        Test: the messages posted from the several threads (more than the queue capacity) are all delivered to all the subscribers.
+     */
+    TEST_F(TestMessageChannel, PostFromThreads)
+    {
+        constexpr size_t ThreadCount = 4;
+        constexpr size_t MessagesPerThread = 1000;
+        constexpr size_t MessageCount = ThreadCount * MessagesPerThread;
+
+        std::atomic<size_t> counter1 = 0;
+        std::atomic<size_t> counter2 = 0;
+        std::atomic<uint64_t> targetSum = 0;
+
+        auto subscription1 = TestHitChannel.subscribe([&](const HitMessage& message)
+        {
+            targetSum += message.targetId;
+            ++counter1;
+        });
+
+        auto subscription2 = TestHitChannel.subscribe([&](const HitMessage&)
+        {
+            ++counter2;
+        });
+
+        ASSERT_TRUE(TestHitChannel.hasSubscribers());
+        ASSERT_EQ(TestHitChannel.getChannelId().getName(), "test.hit");
+
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < ThreadCount; ++t)
+        {
+            threads.emplace_back([t]
+            {
+                for (size_t i = 0; i < MessagesPerThread; ++i)
+                {
+                    TestHitChannel.post(HitMessage{static_cast<uint32_t>(t * MessagesPerThread + i), 1.f});
+                }
+            });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        ASSERT_TRUE(waitForCount(counter1, MessageCount));
+        ASSERT_TRUE(waitForCount(counter2, MessageCount));
+        ASSERT_EQ(targetSum.load(), static_cast<uint64_t>(MessageCount) * (MessageCount - 1) / 2);
+    }
+
+    /**
+        Test: the batch is delivered, the handler is not called after the subscription is reset.
+     */
+    TEST_F(TestMessageChannel, ResetSubscription)
+    {
+        std::atomic<size_t> counter = 0;
+
+        auto subscription = TestHitChannel.subscribe([&counter](const HitMessage&)
+        {
+            ++counter;
+        });
+
+        const HitMessage messages[] = {{1, 1.f}, {2, 2.f}, {3, 3.f}};
+        TestHitChannel.post(eastl::span{messages});
+        ASSERT_TRUE(waitForCount(counter, 3));
+
+        subscription = nullptr;
+        ASSERT_FALSE(TestHitChannel.hasSubscribers());
+
+        TestHitChannel.post(HitMessage{4, 4.f});
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        ASSERT_EQ(counter.load(), 3);
+    }
+
+    /**
+        Test: the subscriber list replaced while the messages are posted is released by the last leaving poster,
+        the subscriber is destroyed without the next subscription change.
+     */
+    TEST_F(TestMessageChannel, RetiredSubscribersReleasedByReaders)
+    {
+        using namespace std::chrono_literals;
+
+        auto handlerState = std::make_shared<int>(0);
+        const std::weak_ptr<int> handlerStateRef = handlerState;
+        auto subscription = TestHitChannel.subscribe([handlerState](const HitMessage&)
+        {
+        });
+        handlerState.reset();
+
+        std::atomic<bool> isPosting = true;
+        std::thread poster([&isPosting]
+        {
+            while (isPosting)
+            {
+                TestHitChannel.post(HitMessage{1, 1.f});
+            }
+        });
+
+        std::this_thread::sleep_for(10ms);
+        subscription = nullptr;
+        std::this_thread::sleep_for(10ms);
+        isPosting = false;
+        poster.join();
+
+        // the scheduled deliveries keep the subscriber until they are completed
+        const auto deadline = std::chrono::steady_clock::now() + 5s;
+        while (!handlerStateRef.expired() && std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::sleep_for(1ms);
+        }
+        ASSERT_TRUE(handlerStateRef.expired());
+    }
+
+}  // namespace nau::test
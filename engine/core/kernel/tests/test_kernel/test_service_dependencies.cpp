@@ -173,6 +173,73 @@ namespace nau::test
             bool m_isShutDown = false;
         };
 
+        struct ITestInterface5 : IRttiObject
+        {
+            NAU_INTERFACE(ITestInterface5, IRttiObject)
+        };
+
+        struct ITestInterface6 : IRttiObject
+        {
+            NAU_INTERFACE(ITestInterface6, IRttiObject)
+        };
+
+        struct ITestInterface7 : IRttiObject
+        {
+            NAU_INTERFACE(ITestInterface7, IRttiObject)
+        };
+
+        /**
+            The pre-initialization is completed only when it is signaled by other service.
+         */
+        class ServiceWaitingSignal final : public ITestInterface5,
+                                           public IServiceInitialization
+        {
+            NAU_RTTI_CLASS(ServiceWaitingSignal, ITestInterface5, IServiceInitialization)
+
+        public:
+            void signal()
+            {
+                m_signal.resolve();
+            }
+
+        private:
+            async::Task<> preInitService() override
+            {
+                return m_signal.getTask();
+            }
+
+            async::TaskSource<> m_signal;
+        };
+
+        /**
+            Signals ServiceWaitingSignal from its own pre-initialization.
+         */
+        class ServiceSignaling final : public ITestInterface7,
+                                       public IServiceInitialization
+        {
+            NAU_RTTI_CLASS(ServiceSignaling, ITestInterface7, IServiceInitialization)
+
+        public:
+            ServiceSignaling(ServiceProvider& serviceProvider) :
+                m_serviceProvider(serviceProvider)
+            {
+            }
+
+        private:
+            async::Task<> preInitService() override
+            {
+                m_serviceProvider.get<ITestInterface5>().as<ServiceWaitingSignal&>().signal();
+                return async::makeResolvedTask();
+            }
+
+            eastl::vector<const rtti::TypeInfo*> getServiceDependencies() const override
+            {
+                return {&rtti::getTypeInfo<ITestInterface6>()};
+            }
+
+            ServiceProvider& m_serviceProvider;
+        };
+
         using Service1 = ServiceWithInit<ITestInterface1>;
         using Service2 = ServiceWithInit<ITestInterface2, ITestInterface1>;
         using Service3 = ServiceWithInit<ITestInterface3, ITestInterface2>;
@@ -219,6 +286,53 @@ namespace nau::test
         ASSERT_TRUE(isInitializedOk(TypeList<ITestInterface4>{}));
     }
 
+    /**
+        Test:
+            the dependent service is initialized as soon as its own dependencies are initialized,
+            it does not wait for the unrelated services (ServiceWaitingSignal is completed only by the dependent ServiceSignaling).
+     */
+    TEST_F(TestServiceDependencies, DependentDoesNotWaitUnrelatedServices)
+    {
+        using ServiceNoDependencies = ServiceWithInit<ITestInterface6>;
+
+        m_serviceProvider->addService(eastl::make_unique<ServiceWaitingSignal>());
+        m_serviceProvider->addService(eastl::make_unique<ServiceSignaling>(*m_serviceProvider));
+        m_serviceProvider->addService(eastl::make_unique<ServiceNoDependencies>(*m_serviceProvider));
+
+        auto& serviceProviderInit = m_serviceProvider->as<core_detail::IServiceProviderInitialization&>();
+        auto preInitTask = serviceProviderInit.preInitServices();
+        ASSERT_TRUE(async::wait(preInitTask, std::chrono::seconds(5)));
+        ASSERT_FALSE(preInitTask.isRejected());
+    }
+
+    /**
+        Test:
+            initLateServices() initializes only the services added after initServices() (i.e. by the lazily loaded module),
+            and it does nothing until initServices() is completed.
+     */
+    TEST_F(TestServiceDependencies, InitLateServices)
+    {
+        m_serviceProvider->addService(eastl::make_unique<Service1>(*m_serviceProvider));
+
+        auto& serviceProviderInit = m_serviceProvider->as<core_detail::IServiceProviderInitialization&>();
+        ASSERT_TRUE(async::waitResult(serviceProviderInit.initLateServices()));
+        ASSERT_FALSE(m_serviceProvider->get<ITestInterface1>().as<const ServiceInitData&>().isPreInitialized);
+
+        ASSERT_TRUE(async::waitResult(serviceProviderInit.preInitServices()));
+        ASSERT_TRUE(async::waitResult(serviceProviderInit.initServices()));
+
+        // the late service depends on the already initialized one
+        m_serviceProvider->addService(eastl::make_unique<Service2>(*m_serviceProvider));
+        auto& service1 = m_serviceProvider->get<ITestInterface1>().as<ServiceInitData&>();
+        service1.isInitialized = false;
+
+        ASSERT_TRUE(async::waitResult(serviceProviderInit.initLateServices()));
+
+        EXPECT_FALSE(service1.isInitialized);
+        EXPECT_TRUE(m_serviceProvider->get<ITestInterface2>().as<const ServiceInitData&>().isInitialized);
+        EXPECT_TRUE(m_serviceProvider->get<ITestInterface2>().as<const ServiceInitData&>().isPreInitialized);
+    }
+
     /**
         Test:
             the order of services shutdown takes into account the dependencies between them: it must be reverse of the initialization sequence
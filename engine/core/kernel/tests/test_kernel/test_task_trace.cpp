@@ -0,0 +1,76 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#include "nau/async/task.h"
+#include "nau/async/task_trace.h"
+#include "nau/async/work_queue.h"
+#include "nau/io/memory_stream.h"
+#include "nau/serialization/json.h"
+
+namespace nau::test
+{
+    namespace
+    {
+        eastl::string writeTrace()
+        {
+            io::IMemoryStream::Ptr stream = io::createMemoryStream();
+            EXPECT_TRUE(async::writeTaskTraceChromeJson(*stream));
+
+            const auto buffer = stream->getBufferAsSpan();
+            return eastl::string{reinterpret_cast<const char*>(buffer.data()), buffer.size()};
+        }
+    }  // namespace
+
+    /**
+        Test: the task lifecycle (create, await, ready) and the continuation scheduling/run are written as the valid Chrome trace.
+     */
+    TEST(TestTaskTrace, TraceContinuation)
+    {
+        auto queue = WorkQueue::create();
+
+        async::startTaskTrace();
+        scope_on_leave
+        {
+            async::stopTaskTrace();
+        };
+
+        async::TaskSource<> taskSource;
+        auto awaitingTask = [](async::Task<> task, async::Executor::Ptr executor) -> async::Task<>
+        {
+            co_await task;
+            co_await executor;
+        }(taskSource.getTask(), queue);
+
+        taskSource.resolve();
+        queue->poll();
+        ASSERT_TRUE(awaitingTask.isReady());
+
+        const eastl::string trace = writeTrace();
+
+        const auto json = serialization::jsonParseString(trace);
+        ASSERT_TRUE(json);
+
+        for (const char* eventName : {"TaskCreate", "TaskAwait", "TaskReady", "Schedule", "Invoke"})
+        {
+            ASSERT_NE(trace.find(eventName), eastl::string::npos) << eventName;
+        }
+    }
+
+    /**
+        Test: no events are collected when the trace is not active.
+     */
+    TEST(TestTaskTrace, NoEventsWhenStopped)
+    {
+        async::startTaskTrace();
+        async::stopTaskTrace();
+        ASSERT_FALSE(async::isTaskTraceActive());
+
+        auto queue = WorkQueue::create();
+        queue->execute([](void*, void*) noexcept
+        {
+        }, nullptr);
+        queue->poll();
+
+        ASSERT_EQ(writeTrace().find("Invoke"), eastl::string::npos);
+    }
+}  // namespace nau::test
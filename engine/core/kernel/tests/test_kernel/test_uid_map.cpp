@@ -0,0 +1,69 @@
+// test_uid_map.cpp
+//
+// Copyright (c) N-GINN LLC., 2023-2025. All rights reserved.
+//
+
+#include <EASTL/hash_set.h>
+
+#include "nau/utils/uid_map.h"
+
+namespace nau::test
+{
+    TEST(TestUidMap, InsertFindErase)
+    {
+        constexpr size_t Count = 5000;
+
+        eastl::vector<Uid> uids;
+        UidMap<size_t> map;
+        for (size_t i = 0; i < Count; ++i)
+        {
+            const Uid& uid = uids.emplace_back(Uid::generate());
+            ASSERT_TRUE(map.emplace(uid, i).second);
+        }
+
+        ASSERT_EQ(map.size(), Count);
+        ASSERT_FALSE(map.emplace(uids.front(), Count).second);
+
+        for (size_t i = 0; i < Count; i += 2)
+        {
+            ASSERT_EQ(map.erase(uids[i]), 1);
+        }
+
+        for (size_t i = 0; i < Count; ++i)
+        {
+            const auto iter = map.find(uids[i]);
+            if (i % 2 == 0)
+            {
+                ASSERT_TRUE(iter == map.end());
+            }
+            else
+            {
+                ASSERT_TRUE(iter != map.end());
+                ASSERT_EQ(iter->second, i);
+            }
+        }
+
+        ASSERT_TRUE(map.find(NullUid) == map.end());
+    }
+
+    /**
+        Test: the hash uses all the Uid bits, the sequentially generated uids do not collide.
+     */
+    TEST(TestUidMap, HashIsNotTruncated)
+    {
+        constexpr size_t Count = 1000;
+
+        UidSet uids;
+        eastl::hash_set<size_t> hashes;
+        for (size_t i = 0; i < Count; ++i)
+        {
+            const Uid uid = Uid::generate();
+            uids.insert(uid);
+            hashes.insert(eastl::hash<Uid>{}(uid));
+        }
+
+        ASSERT_EQ(uids.size(), Count);
+        ASSERT_EQ(hashes.size(), Count);
+    }
+
+}  // namespace nau::test
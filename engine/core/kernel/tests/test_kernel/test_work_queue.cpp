@@ -150,6 +150,91 @@ namespace nau::test
         ASSERT_EQ(counter, ThreadsCount * ExecutePerThreadCount);
     }
 
+    /**
+        Test: Mpsc queue executes invocations in the scheduling order.
+     */
+    TEST_F(TestWorkQueue, MpscOrder)
+    {
+        constexpr size_t JobsCount = 100;
+
+        auto queue = WorkQueue::create(WorkQueueMode::Mpsc);
+        eastl::vector<size_t> order;
+
+        for (size_t i = 0; i < JobsCount; ++i)
+        {
+            queue->execute([](void* orderPtr, void* index) noexcept
+            {
+                reinterpret_cast<eastl::vector<size_t>*>(orderPtr)->push_back(reinterpret_cast<size_t>(index));
+            }, &order, reinterpret_cast<void*>(i));
+        }
+
+        ASSERT_TRUE(queue->waitForWork().isReady());
+        queue->poll();
+
+        ASSERT_EQ(order.size(), JobsCount);
+        for (size_t i = 0; i < JobsCount; ++i)
+        {
+            ASSERT_EQ(order[i], i);
+        }
+    }
+
+    /**
+        Test: Mpsc queue with multiple producer threads and the single polling thread.
+     */
+    TEST_F(TestWorkQueue, MpscMultithread)
+    {
+        constexpr size_t ThreadsCount = 10;
+        constexpr size_t ExecutePerThreadCount = 10'000;
+
+        std::atomic_bool completed = false;
+        std::atomic_size_t counter = 0;
+
+        auto queue = WorkQueue::create(WorkQueueMode::Mpsc);
+
+        std::thread pollThread([&]
+        {
+            while (!completed)
+            {
+                if (auto awaiter = queue->waitForWork(); !awaiter.isReady())
+                {
+                    async::wait(awaiter);
+                }
+                queue->poll();
+            }
+        });
+
+        eastl::vector<std::thread> threads;
+        threading::Barrier barrier{ThreadsCount};
+
+        for (size_t i = 0; i < ThreadsCount; ++i)
+        {
+            threads.emplace_back([&]
+            {
+                barrier.enter();
+                for (size_t j = 0; j < ExecutePerThreadCount; ++j)
+                {
+                    queue->execute([](void* counterPtr, void*) noexcept
+                    {
+                        reinterpret_cast<std::atomic_size_t*>(counterPtr)->fetch_add(1);
+                    }, &counter);
+                }
+            });
+        }
+
+        for (auto& t : threads)
+        {
+            t.join();
+        }
+
+        ASSERT_TRUE(queue->waitAnyActivity());
+
+        completed = true;
+        queue->notify();
+        pollThread.join();
+
+        ASSERT_EQ(counter, ThreadsCount * ExecutePerThreadCount);
+    }
+
     /**
         Test: poll with specified timeout.
         - execute poll with some time
@@ -222,6 +307,59 @@ namespace nau::test
         }
     }
 
+    /**
+        Test: notification that is sent while the queue is not polled must not be lost:
+        the next thread-blocking poll must be interrupted immediately.
+     */
+    TEST_F(TestWorkQueue, NotifyBeforeBlockingPoll)
+    {
+        using namespace eastl::chrono_literals;
+        constexpr auto Timeout = 1000ms;
+
+        auto queue = WorkQueue::create();
+        queue->notify();
+
+        const Stopwatch stopWatch;
+        queue->poll(std::nullopt);
+
+        ASSERT_LT(stopWatch.getTimePassed().count(), Timeout.count());
+    }
+
+    /**
+        Test: waitAnyActivity() blocks until all scheduled jobs are executed by the polling thread.
+     */
+    TEST_F(TestWorkQueue, WaitAnyActivity)
+    {
+        constexpr size_t JobsCount = 1000;
+
+        auto queue = WorkQueue::create();
+        std::atomic_size_t counter = 0;
+        std::atomic_bool completed = false;
+
+        for (size_t i = 0; i < JobsCount; ++i)
+        {
+            queue->execute([](void* counterPtr, void*) noexcept
+            {
+                reinterpret_cast<std::atomic_size_t*>(counterPtr)->fetch_add(1);
+            }, &counter);
+        }
+
+        std::thread pollThread([&]
+        {
+            while (!completed)
+            {
+                queue->poll(std::nullopt);
+            }
+        });
+
+        ASSERT_TRUE(queue->waitAnyActivity());
+        ASSERT_EQ(counter, JobsCount);
+
+        completed = true;
+        queue->notify();
+        pollThread.join();
+    }
+
     /**
         Test: checks that poll actually executes the scheduled jobs within the specified timeout (without early exit).
         - start work thread where poll(WorkloadTimeout) will be called
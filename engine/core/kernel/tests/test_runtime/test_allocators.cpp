@@ -8,7 +8,10 @@
 #include "nau/memory/frame_allocator.h"
 #include "nau/memory/stack_allocator.h"
 #include "nau/memory/general_allocator.h"
+#include "nau/memory/slab_allocator.h"
 #include "nau/memory/eastl_aliases.h"
+#include "nau/memory/mem_section.h"
+#include "nau/memory/memory_stats.h"
 #include "nau/memory/nau_allocator_wrapper.h"
 #include "nau/memory/platform/aligned_allocator_windows.h"
 
@@ -589,4 +592,239 @@ namespace nau::test
         }
 
     }
-}
\ No newline at end of file
+
+    TEST(TestSlabAllocator, NoBlockHeader)
+    {
+        SlabAllocator allocator;
+
+        // Small block occupies exactly its size class block: there is no hidden header.
+        void* const block1 = allocator.allocate(16);
+        void* const block2 = allocator.allocate(16);
+        ASSERT_TRUE(SlabAllocator::isSlabPointer(block1));
+        ASSERT_TRUE(SlabAllocator::isSlabPointer(block2));
+        EXPECT_EQ(allocator.getSize(block1), 16);
+        EXPECT_GE(std::abs(static_cast<char*>(block2) - static_cast<char*>(block1)), 16);
+
+        allocator.deallocate(block1);
+        allocator.deallocate(block2);
+
+        EXPECT_FALSE(SlabAllocator::isSlabPointer(&allocator));
+    }
+
+    TEST(TestSlabAllocator, SizeClasses)
+    {
+        SlabAllocator allocator;
+
+        for (size_t size = 1; size <= SlabAllocator::getMaxSlabBlockSize() + 100; ++size)
+        {
+            void* const block = allocator.allocate(size);
+            ASSERT_EQ(reinterpret_cast<uintptr_t>(block) % 16, 0);
+            ASSERT_EQ(SlabAllocator::isSlabPointer(block), size <= SlabAllocator::getMaxSlabBlockSize());
+            ASSERT_GE(allocator.getSize(block), size);
+            memset(block, 0xFF, size);
+            allocator.deallocate(block);
+        }
+    }
+
+    TEST(TestSlabAllocator, Reallocate)
+    {
+        SlabAllocator allocator;
+
+        auto* block = static_cast<char*>(allocator.allocate(20));
+        for (int i = 0; i < 20; ++i)
+            block[i] = static_cast<char>(i);
+
+        // Same size class: no copy.
+        EXPECT_EQ(allocator.reallocate(block, 30), block);
+
+        // Grows through the slab size classes and leaves them.
+        for (size_t size : {100, 1000, 5000, 100'000, 50})
+        {
+            block = static_cast<char*>(allocator.reallocate(block, size));
+            ASSERT_GE(allocator.getSize(block), std::min<size_t>(size, 20));
+            for (int i = 0; i < 20; ++i)
+                ASSERT_EQ(block[i], static_cast<char>(i));
+        }
+
+        EXPECT_TRUE(SlabAllocator::isSlabPointer(block));
+        allocator.deallocate(block);
+    }
+
+    TEST(TestSlabAllocator, Aligned)
+    {
+        SlabAllocator allocator;
+
+        void* const ptr = allocator.allocateAligned(100, 64);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % 64, 0);
+        EXPECT_TRUE(allocator.isAligned(ptr));
+        EXPECT_TRUE(allocator.isValid(ptr));
+        allocator.deallocateAligned(ptr);
+    }
+
+    /**
+        Blocks are allocated on one thread and released on the others.
+     */
+    TEST(TestSlabAllocator, ReleaseFromOtherThreads)
+    {
+        constexpr size_t BlocksCount = 10'000;
+        constexpr size_t ThreadsCount = 4;
+
+        SlabAllocator allocator;
+
+        for (int iteration = 0; iteration < 5; ++iteration)
+        {
+            std::vector<void*> blocks;
+            for (size_t i = 0; i < BlocksCount; ++i)
+            {
+                auto* const block = static_cast<size_t*>(allocator.allocate(16 + i % 64));
+                *block = i;
+                blocks.push_back(block);
+            }
+
+            std::unordered_set<void*> uniqueBlocks(blocks.begin(), blocks.end());
+            ASSERT_EQ(uniqueBlocks.size(), BlocksCount);
+
+            std::vector<std::thread> threads;
+            for (size_t t = 0; t < ThreadsCount; ++t)
+            {
+                threads.emplace_back([&allocator, &blocks, t]
+                {
+                    for (size_t i = t; i < blocks.size(); i += ThreadsCount)
+                    {
+                        ASSERT_EQ(*static_cast<size_t*>(blocks[i]), i);
+                        allocator.deallocate(blocks[i]);
+                    }
+                });
+            }
+
+            for (auto& thread : threads)
+                thread.join();
+        }
+    }
+
+    TEST(TestBufferedFrameAllocator, MemoryLivesForFramesCount)
+    {
+        BufferedFrameAllocator allocator(3);
+
+        auto* const frame0 = static_cast<int*>(allocator.allocate(sizeof(int)));
+        *frame0 = 75;
+
+        ASSERT_TRUE(allocator.prepareFrame());
+        ASSERT_TRUE(allocator.prepareFrame());
+        EXPECT_NE(allocator.allocate(sizeof(int)), frame0);
+        EXPECT_EQ(*frame0, 75);
+
+        // Frame 3 reuses the memory of the frame 0.
+        ASSERT_TRUE(allocator.prepareFrame());
+        EXPECT_EQ(allocator.getFrameIndex(), 3);
+        EXPECT_EQ(allocator.allocate(sizeof(int)), frame0);
+    }
+
+    TEST(TestBufferedFrameAllocator, ExternalFence)
+    {
+        BufferedFrameAllocator allocator(2, true);
+
+        void* const frame0 = allocator.allocate(100);
+        ASSERT_TRUE(allocator.prepareFrame());
+        ASSERT_TRUE(allocator.prepareFrame());
+
+        // Frame 0 is not completed: its memory must not be reused.
+        EXPECT_NE(allocator.allocate(100), frame0);
+
+        allocator.completeFrame(2);
+        ASSERT_TRUE(allocator.prepareFrame());
+        ASSERT_TRUE(allocator.prepareFrame());
+        EXPECT_EQ(allocator.allocate(100), frame0);
+    }
+
+    TEST(TestBufferedFrameAllocator, ReallocateInPlace)
+    {
+        BufferedFrameAllocator allocator;
+
+        void* const ptr = allocator.allocate(16);
+        memset(ptr, 1, 16);
+
+        void* const grown = allocator.reallocate(ptr, 1000);
+        EXPECT_EQ(grown, ptr);
+        EXPECT_EQ(allocator.getSize(grown), 1000);
+
+        void* const other = allocator.allocate(16);
+        void* const moved = allocator.reallocate(grown, 2000);
+        EXPECT_NE(moved, grown);
+        EXPECT_EQ(static_cast<char*>(moved)[15], 1);
+        EXPECT_NE(other, moved);
+    }
+
+    TEST(TestBufferedFrameAllocator, PerThreadArenas)
+    {
+        constexpr size_t ThreadsCount = 4;
+        constexpr size_t AllocationsCount = 10'000;
+
+        BufferedFrameAllocator allocator(2, false, 4096);
+        IFrameAllocator::setFrameAllocator(&allocator);
+
+        for (int frame = 0; frame < 4; ++frame)
+        {
+            std::vector<std::thread> threads;
+            for (size_t t = 0; t < ThreadsCount; ++t)
+            {
+                threads.emplace_back([t]
+                {
+                    nau::FrameVector<size_t> values;
+                    for (size_t i = 0; i < AllocationsCount; ++i)
+                        values.push_back(i * t);
+
+                    for (size_t i = 0; i < AllocationsCount; ++i)
+                        ASSERT_EQ(values[i], i * t);
+                });
+            }
+
+            for (auto& thread : threads)
+                thread.join();
+
+            ASSERT_TRUE(allocator.prepareFrame());
+        }
+
+        IFrameAllocator::setFrameAllocator(nullptr);
+    }
+
+    TEST(TestAllocator, MemSectionLargePages)
+    {
+        const MemoryStatsSnapshot before = getMemoryStatsSnapshot();
+        {
+            MemSection section;
+            section.setLargePages(true);
+            ASSERT_TRUE(section.isLargePages());
+
+            // The large pages may be not available: the section falls back to the heap pages, but the memory is usable either way.
+            char* const data = static_cast<char*>(section.allocate(section.getPageSize()));
+            ASSERT_TRUE(data);
+            memset(data, 1, section.getPageSize());
+            EXPECT_TRUE(section.contains(data + section.getPageSize() - 1));
+
+            const MemoryStatsSnapshot allocated = getMemoryStatsSnapshot();
+            EXPECT_GE(allocated.largePageRequestedBytes - before.largePageRequestedBytes, section.getPageSize());
+            EXPECT_EQ(allocated.largePageBytes - before.largePageBytes, section.getLargePageBytes() > 0 ? allocated.largePageRequestedBytes - before.largePageRequestedBytes : 0);
+        }
+
+        const MemoryStatsSnapshot released = getMemoryStatsSnapshot();
+        EXPECT_EQ(released.largePageRequestedBytes, before.largePageRequestedBytes);
+        EXPECT_EQ(released.largePageBytes, before.largePageBytes);
+    }
+
+    TEST(TestBufferedFrameAllocator, LargePages)
+    {
+        BufferedFrameAllocator allocator(2, false, BufferedFrameAllocator::DefaultPageSize, true);
+
+        void* const frame0 = allocator.allocate(100'000);
+        memset(frame0, 1, 100'000);
+
+        // The pages are rounded up to the large page size (when available): the allocations keep going into the same page.
+        void* const next = allocator.allocate(100'000);
+        EXPECT_EQ(static_cast<char*>(next), static_cast<char*>(frame0) + 100'000 + 16);
+
+        ASSERT_TRUE(allocator.prepareFrame());
+        ASSERT_TRUE(allocator.prepareFrame());
+        EXPECT_EQ(allocator.allocate(100), frame0);
+    }
+}
@@ -58,6 +58,43 @@ namespace nau::test
         ASSERT_THAT(counter, Eq(JobsCount));
     }
 
+    /**
+        Invocations scheduled from the worker threads: the work stealing pool must spread them to the other workers.
+     */
+    TEST_P(TestAsyncExecutor, ExecuteFromWorkers)
+    {
+        constexpr size_t BatchesCount = 1'000;
+        constexpr size_t BatchSize = 100;
+
+        struct State
+        {
+            async::Executor* executor;
+            std::atomic_size_t counter = 0;
+        } state;
+
+        auto executor = createExecutor();
+        state.executor = executor.get();
+
+        for(size_t i = 0; i < BatchesCount; ++i)
+        {
+            executor->execute([](void* statePtr, void*) noexcept
+            {
+                auto& state = *reinterpret_cast<State*>(statePtr);
+                for(size_t j = 0; j < BatchSize; ++j)
+                {
+                    state.executor->execute([](void* counterPtr, void*) noexcept
+                    {
+                        reinterpret_cast<std::atomic_size_t*>(counterPtr)->fetch_add(1);
+                    }, &state.counter);
+                }
+            }, &state);
+        }
+
+        waitWorks(executor);
+
+        ASSERT_THAT(state.counter, Eq(BatchesCount * BatchSize));
+    }
+
     const ExecutorFactory createDefaultPoolExecutor = []
     {
         return async::createThreadPoolExecutor();
@@ -69,8 +106,18 @@ namespace nau::test
         return async::createThreadPoolExecutor();
     };
 
+    const ExecutorFactory createSharedQueuePoolExecutor = []
+    {
+        return async::createThreadPoolExecutor("Test Pool", 4, async::ThreadPoolMode::SharedQueue);
+    };
+
+    const ExecutorFactory createWorkStealingPoolExecutor = []
+    {
+        return async::createThreadPoolExecutor("Test Pool", 4, async::ThreadPoolMode::WorkStealing);
+    };
+
     INSTANTIATE_TEST_SUITE_P(Default,
                              TestAsyncExecutor,
-                             testing::Values(createDefaultPoolExecutor, createDagPoolExecutor));
+                             testing::Values(createDefaultPoolExecutor, createDagPoolExecutor, createSharedQueuePoolExecutor, createWorkStealingPoolExecutor));
 
 }  // namespace nau::test
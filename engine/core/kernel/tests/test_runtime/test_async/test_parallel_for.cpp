@@ -0,0 +1,188 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include <thread>
+
+#include "nau/async/job_graph.h"
+#include "nau/async/parallel_for.h"
+#include "nau/async/thread_pool_executor.h"
+
+namespace nau::test
+{
+    class TestParallelFor : public testing::Test
+    {
+    protected:
+        async::Executor::Ptr m_executor = async::createThreadPoolExecutor("Test Pool", 4);
+    };
+
+    /**
+        Test: every index is processed exactly once.
+     */
+    TEST_F(TestParallelFor, ProcessEachIndexOnce)
+    {
+        constexpr size_t Count = 10'000;
+
+        for (const size_t grainSize : {size_t{0}, size_t{1}, size_t{7}, size_t{64}, Count, Count * 2})
+        {
+            eastl::vector<std::atomic_uint32_t> counters(Count);
+            for (auto& counter : counters)
+            {
+                counter = 0;
+            }
+
+            async::parallelFor(Count, grainSize, [&counters](size_t index)
+            {
+                counters[index].fetch_add(1);
+            }, m_executor);
+
+            for (const auto& counter : counters)
+            {
+                ASSERT_EQ(counter.load(), 1);
+            }
+        }
+    }
+
+    TEST_F(TestParallelFor, RangeCallback)
+    {
+        constexpr size_t Count = 1000;
+        static constexpr size_t GrainSize = 100;
+
+        std::atomic_size_t total = 0;
+        async::parallelFor(Count, GrainSize, [&total](size_t begin, size_t end)
+        {
+            ASSERT_LE(end - begin, GrainSize);
+            total.fetch_add(end - begin);
+        }, m_executor);
+
+        ASSERT_EQ(total, Count);
+    }
+
+    /**
+        Test: parallelFor called from the worker thread of the same executor must not dead lock.
+     */
+    TEST_F(TestParallelFor, Nested)
+    {
+        constexpr size_t OuterCount = 16;
+        constexpr size_t InnerCount = 100;
+
+        std::atomic_size_t total = 0;
+        async::parallelFor(OuterCount, 1, [&](size_t)
+        {
+            async::parallelFor(InnerCount, 10, [&total](size_t)
+            {
+                total.fetch_add(1);
+            }, m_executor);
+        }, m_executor);
+
+        ASSERT_EQ(total, OuterCount * InnerCount);
+    }
+
+    /**
+        Test: jobs are executed after their dependencies, graph can be executed multiple times.
+     */
+    TEST_F(TestParallelFor, JobGraphDependencies)
+    {
+        constexpr size_t LayerSize = 8;
+        constexpr size_t LayersCount = 4;
+
+        async::JobGraph graph;
+        std::atomic_size_t completedCounter = 0;
+        eastl::vector<size_t> completionOrder(LayerSize * LayersCount);
+
+        for (size_t layer = 0; layer < LayersCount; ++layer)
+        {
+            for (size_t i = 0; i < LayerSize; ++i)
+            {
+                const size_t index = layer * LayerSize + i;
+                const auto jobId = graph.addJob([&completedCounter, &completionOrder, index]
+                {
+                    completionOrder[index] = completedCounter.fetch_add(1);
+                });
+
+                ASSERT_EQ(jobId, index);
+                if (layer > 0)
+                {
+                    for (size_t j = 0; j < LayerSize; ++j)
+                    {
+                        graph.addDependency(jobId, static_cast<async::JobGraph::JobId>((layer - 1) * LayerSize + j));
+                    }
+                }
+            }
+        }
+
+        for (size_t iteration = 0; iteration < 3; ++iteration)
+        {
+            completedCounter = 0;
+            graph.run(m_executor);
+
+            ASSERT_EQ(completedCounter, LayerSize * LayersCount);
+            for (size_t index = 0; index < completionOrder.size(); ++index)
+            {
+                const size_t layer = index / LayerSize;
+                ASSERT_GE(completionOrder[index], layer * LayerSize);
+                ASSERT_LT(completionOrder[index], (layer + 1) * LayerSize);
+            }
+        }
+    }
+
+    TEST_F(TestParallelFor, JobGraphCallingThreadJobs)
+    {
+        constexpr size_t JobsCount = 16;
+
+        async::JobGraph graph;
+        const auto callingThreadId = std::this_thread::get_id();
+        std::atomic_size_t callingThreadJobsCounter = 0;
+        std::atomic_size_t wrongThreadCounter = 0;
+
+        async::JobGraph::JobId previousJob = 0;
+        for (size_t i = 0; i < JobsCount; ++i)
+        {
+            const bool callingThreadOnly = i % 2 == 0;
+            const auto jobId = graph.addJob([&, callingThreadOnly]
+            {
+                if (!callingThreadOnly)
+                {
+                    return;
+                }
+
+                ++callingThreadJobsCounter;
+                if (std::this_thread::get_id() != callingThreadId)
+                {
+                    ++wrongThreadCounter;
+                }
+            }, callingThreadOnly);
+
+            // The calling thread jobs become ready from the helper threads
+            if (i > 0)
+            {
+                graph.addDependency(jobId, previousJob);
+            }
+            previousJob = jobId;
+        }
+
+        graph.run(m_executor);
+
+        ASSERT_EQ(callingThreadJobsCounter, JobsCount / 2);
+        ASSERT_EQ(wrongThreadCounter, 0);
+    }
+
+    /**
+        Test: the cycle that is not reachable from the graph roots (the graph still has a root job) is detected.
+     */
+    TEST_F(TestParallelFor, JobGraphDetectsCycleBehindRoot)
+    {
+        async::JobGraph graph;
+        const auto root = graph.addJob([] {});
+        const auto first = graph.addJob([] {});
+        const auto second = graph.addJob([] {});
+
+        graph.addDependency(first, root);
+        graph.addDependency(second, first);
+        ASSERT_FALSE(graph.hasCycles());
+
+        graph.addDependency(first, second);
+        ASSERT_TRUE(graph.hasCycles());
+    }
+
+}  // namespace nau::test
@@ -0,0 +1,108 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "nau/async/core/task_frame_allocator.h"
+#include "nau/async/task.h"
+#include "helpers/runtime_guard.h"
+
+namespace nau::test
+{
+    using namespace nau::async_detail;
+
+    /**
+        Released block must be reused by the next allocation of the same size class on the same thread.
+     */
+    TEST(TestTaskFrameAllocator, ReuseReleasedBlock)
+    {
+        void* const block1 = allocateTaskFrame(100);
+        ASSERT_TRUE(block1);
+        freeTaskFrame(block1, 100);
+
+        void* const block2 = allocateTaskFrame(120);
+        ASSERT_EQ(block1, block2);
+        freeTaskFrame(block2, 120);
+    }
+
+    TEST(TestTaskFrameAllocator, Alignment)
+    {
+        for (size_t size : {1, 16, 64, 65, 1000, 4096, 4097, 100'000})
+        {
+            void* const block = allocateTaskFrame(size);
+            ASSERT_EQ(reinterpret_cast<uintptr_t>(block) % alignof(std::max_align_t), 0);
+            memset(block, 0, size);
+            freeTaskFrame(block, size);
+        }
+    }
+
+    /**
+        Blocks can be released from the thread other than it was allocated:
+        they are returned into the pool of the releasing thread and reused by its allocations of the same size class.
+     */
+    TEST(TestTaskFrameAllocator, ReleaseFromOtherThread)
+    {
+        constexpr size_t BlocksCount = 1000;
+        // The 65..128 bytes size class: all its released blocks are kept by the pool (within the per class limit).
+        constexpr size_t ReusedSize = 100;
+        constexpr size_t ReusedCount = 128 - 64;
+
+        eastl::vector<void*> blocks;
+        for (size_t i = 0; i < BlocksCount; ++i)
+        {
+            blocks.push_back(allocateTaskFrame(64 + i));
+        }
+
+        eastl::vector<void*> reusedBlocks;
+        std::thread([&blocks, &reusedBlocks]
+        {
+            for (size_t i = 0; i < blocks.size(); ++i)
+            {
+                freeTaskFrame(blocks[i], 64 + i);
+            }
+
+            for (size_t i = 0; i < ReusedCount; ++i)
+            {
+                reusedBlocks.push_back(allocateTaskFrame(ReusedSize));
+            }
+
+            for (void* const block : reusedBlocks)
+            {
+                freeTaskFrame(block, ReusedSize);
+            }
+        }).join();
+
+        // blocks[1..64] are the released blocks of the class
+        const eastl::vector<void*> classBlocks(blocks.begin() + 1, blocks.begin() + 1 + ReusedCount);
+        ASSERT_EQ(reusedBlocks.size(), ReusedCount);
+        for (void* const block : reusedBlocks)
+        {
+            ASSERT_NE(eastl::find(classBlocks.begin(), classBlocks.end(), block), classBlocks.end());
+            ASSERT_EQ(eastl::count(reusedBlocks.begin(), reusedBlocks.end(), block), 1);
+        }
+    }
+
+    TEST(TestTaskFrameAllocator, TasksFromMultipleThreads)
+    {
+        const RuntimeGuard::Ptr runtimeGuard = RuntimeGuard::create();
+
+        constexpr size_t TasksCount = 1000;
+
+        eastl::vector<async::Task<size_t>> tasks;
+        for (size_t i = 0; i < TasksCount; ++i)
+        {
+            tasks.emplace_back([](size_t value) -> async::Task<size_t>
+            {
+                co_await async::Executor::getDefault();
+                co_return value;
+            }(i));
+        }
+
+        async::waitResult(async::whenAll(tasks));
+
+        for (size_t i = 0; i < TasksCount; ++i)
+        {
+            ASSERT_EQ(*tasks[i], i);
+        }
+    }
+
+}  // namespace nau::test
@@ -3,7 +3,11 @@
 // test_error.cpp
 
 #include "nau/dataBlock/dag_dataBlock.h"
+#include "nau/dataBlock/ro_data_block_value.h"
+#include "nau/io/memory_stream.h"
 #include "nau/math/math.h"
+#include "nau/serialization/json.h"
+#include "nau/serialization/runtime_value_builder.h"
 
 namespace nau::test
 {
@@ -47,4 +51,56 @@ namespace nau::test
         TestTypes(block);
     }
 
+    /**
+        The json config is cooked to the read-only data block and read back through the dictionary view.
+     */
+    TEST(TestDataBlock, RoDataBlockValue)
+    {
+        constexpr eastl::string_view json = R"--(
+            {
+                "name": "test",
+                "count": 10,
+                "scale": 1.5,
+                "enabled": true,
+                "items": [1, 2, 3],
+                "child": {
+                    "name": "${value}"
+                }
+            }
+        )--";
+
+        RuntimeDictionary::Ptr dict = *serialization::jsonParseString(json);
+
+        io::IMemoryStream::Ptr stream = io::createMemoryStream();
+        ASSERT_TRUE(saveRoDataBlock(*dict, *stream));
+        stream->setPosition(io::OffsetOrigin::Begin, 0);
+
+        Result<RoDataBlockPtr> block = loadRoDataBlock(*stream);
+        ASSERT_TRUE(block);
+
+        RuntimeReadonlyDictionary::Ptr value = wrapRoDataBlock(*block, nullptr, [](eastl::string_view str) -> eastl::optional<eastl::string>
+        {
+            if (str == "${value}")
+            {
+                return eastl::string{"expanded"};
+            }
+            return eastl::nullopt;
+        });
+
+        ASSERT_EQ(value->getSize(), 6);
+        ASSERT_EQ(*runtimeValueCast<std::string>(value->getValue("name")), "test");
+        ASSERT_EQ(*runtimeValueCast<int>(value->getValue("count")), 10);
+        ASSERT_FLOAT_EQ(*runtimeValueCast<float>(value->getValue("scale")), 1.5f);
+        ASSERT_TRUE(*runtimeValueCast<bool>(value->getValue("enabled")));
+
+        const auto items = *runtimeValueCast<std::vector<int>>(value->getValue("items"));
+        ASSERT_EQ(items, (std::vector<int>{1, 2, 3}));
+
+        RuntimeReadonlyDictionary* const child = value->getValue("child")->as<RuntimeReadonlyDictionary*>();
+        ASSERT_TRUE(child);
+        ASSERT_EQ(*runtimeValueCast<std::string>(child->getValue("name")), "expanded");
+
+        ASSERT_FALSE(value->containsKey("missing"));
+    }
+
 }  // namespace nau::test
@@ -0,0 +1,68 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include <filesystem>
+#include <fstream>
+
+#include "nau/diag/binary_log.h"
+#include "nau/diag/logging.h"
+
+namespace nau::test
+{
+    namespace
+    {
+        eastl::vector<std::byte> readFileContent(const std::filesystem::path& path)
+        {
+            std::ifstream file{path, std::ios::binary | std::ios::ate};
+            eastl::vector<std::byte> content(static_cast<size_t>(file.tellg()));
+            file.seekg(0);
+            file.read(reinterpret_cast<char*>(content.data()), content.size());
+            return content;
+        }
+    }  // namespace
+
+    TEST(TestBinaryLog, WriteAndDecode)
+    {
+        using namespace nau::diag;
+
+        const auto logPath = std::filesystem::temp_directory_path() / "nau_test_binary_log.bin";
+
+        setLogger(createLogger());
+        {
+            auto subscription = getLogger().subscribe(createBinaryLogSubscriber(logPath.string().c_str()));
+
+            for (int i = 0; i < 3; ++i)
+            {
+                NAU_LOG_INFO({"tag1", "tag2"}, u8"Message {}", i);
+            }
+            NAU_LOG_WARNING(u8"Warning");
+        }
+        setLogger(nullptr);
+
+        const eastl::vector<std::byte> content = readFileContent(logPath);
+        std::filesystem::remove(logPath);
+
+        eastl::vector<LoggerMessage> messages;
+        ASSERT_TRUE(decodeBinaryLog(content, [&messages](const LoggerMessage& message)
+        {
+            messages.push_back(message);
+        }));
+
+        ASSERT_EQ(messages.size(), 4);
+        ASSERT_EQ(messages[2].data, "Message 2");
+        ASSERT_EQ(messages[2].level, LogLevel::Info);
+        ASSERT_EQ(messages[2].tags, (eastl::vector<eastl::string>{"tag1", "tag2"}));
+        ASSERT_EQ(messages[2].source.line, messages[0].source.line);
+        ASSERT_EQ(messages[3].data, "Warning");
+        ASSERT_TRUE(messages[3].tags.empty());
+        ASSERT_NE(messages[3].source.line, messages[0].source.line);
+        ASSERT_NE(messages[0].threadId, 0);
+    }
+
+    TEST(TestBinaryLog, DecodeInvalidData)
+    {
+        const std::byte data[] = {std::byte{1}, std::byte{2}, std::byte{3}};
+        ASSERT_FALSE(diag::binaryLogToText(data));
+    }
+}  // namespace nau::test
@@ -3,6 +3,7 @@
 // test_asserts.cpp
 
 
+#include "nau/diag/log_subscribers.h"
 #include "nau/diag/logging.h"
 #include "test_diag.h"
 
@@ -238,6 +239,65 @@ namespace nau::test
         ASSERT_EQ(acceptedMessageCount, 1);
     }
 
+    TEST_F(Test_LoggerFunctor, MinLevel)
+    {
+        using namespace ::nau::diag;
+
+        size_t formatCount = 0;
+        const auto countFormat = [&formatCount]
+        {
+            return ++formatCount;
+        };
+
+        eastl::vector<LogLevel> levels;
+        keepSubscription(getLogger().subscribe([&](const LoggerMessage& message)
+                                                      {
+                                                          levels.push_back(message.level);
+                                                      }));
+
+        getLogger().setMinLevel(LogLevel::Warning);
+        NAU_LOG_DEBUG(u8"{}", countFormat());
+        NAU_LOG_INFO(u8"{}", countFormat());
+        NAU_LOG_WARNING(u8"{}", countFormat());
+        NAU_LOG_ERROR(u8"{}", countFormat());
+
+        // the arguments of the skipped messages are still evaluated, only the formatting is skipped
+        ASSERT_EQ(formatCount, 4);
+        ASSERT_EQ(levels, (eastl::vector<LogLevel>{LogLevel::Warning, LogLevel::Error}));
+    }
+
+    TEST_F(Test_LoggerFunctor, DeferredSubscriber)
+    {
+        using namespace ::nau::diag;
+
+        constexpr size_t MessageCount = 3000;
+
+        eastl::vector<eastl::string> texts;
+        std::thread::id processThreadId;
+
+        auto callback = [&](const LoggerMessage& message)
+        {
+            processThreadId = std::this_thread::get_id();
+            texts.push_back(message.data);
+        };
+
+        using CallbackSubscriber = diag_detail::FunctionalLogSubscriber<decltype(callback)>;
+        keepSubscription(getLogger().subscribe(createDeferredLogSubscriber(eastl::make_shared<CallbackSubscriber>(std::move(callback)))));
+
+        for (size_t i = 0; i < MessageCount; ++i)
+        {
+            NAU_LOG_INFO(u8"{}", i);
+        }
+
+        // Error waits for all queued messages
+        NAU_LOG_ERROR(u8"last");
+
+        ASSERT_EQ(texts.size(), MessageCount + 1);
+        ASSERT_EQ(texts[10], "10");
+        ASSERT_EQ(texts.back(), "last");
+        ASSERT_NE(processThreadId, std::this_thread::get_id());
+    }
+
 
     // class Test_LoggerFunctor : public ::testing::TestWithParam<typename T>,
     //                            public LoggerState
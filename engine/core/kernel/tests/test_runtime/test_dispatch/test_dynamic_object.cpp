@@ -188,6 +188,55 @@ namespace nau::test
         ASSERT_EQ(changesCounter, 2);
     }
 
+    /**
+        Test: the primitive arguments are passed to the native method without boxing
+     */
+    TEST(TestDynamicObject, InvokeUnboxed)
+    {
+        DynamicObject::Ptr obj = rtti::createInstance<FooClass2>();
+        const auto classDesc = obj->getClassDescriptor();
+
+        const DispatchArgument valueArg{int64_t{55}};
+        ASSERT_TRUE(classDesc->findMethod("setValue1")->invokeUnboxed(obj.get(), {&valueArg, 1}));
+
+        const DispatchArgument textArg{eastl::string_view{"unboxed_text"}};
+        ASSERT_TRUE(classDesc->findMethod("setText")->invokeUnboxed(obj.get(), {&textArg, 1}));
+
+        auto& foo = obj->as<FooClass1&>();
+        ASSERT_EQ(foo.getValue1(), 55);
+        ASSERT_EQ(foo.getText(), "unboxed_text");
+
+        // not matching argument is converted through the boxing
+        const DispatchArgument doubleArg{77.0};
+        ASSERT_TRUE(classDesc->findMethod("setValue2")->invokeUnboxed(obj.get(), {&doubleArg, 1}));
+
+        const DispatchArgument boxedArg{nau::Ptr<>{makeValueCopy(88u)}};
+        ASSERT_TRUE(classDesc->findMethod("setValue1")->invokeUnboxed(obj.get(), {&boxedArg, 1}));
+        ASSERT_EQ(foo.getValue1(), 88);
+
+        ASSERT_FALSE(classDesc->findMethod("setValue1")->invokeUnboxed(obj.get(), {}));
+    }
+
+    /**
+     */
+    TEST(TestDynamicObject, MethodHandle)
+    {
+        DynamicObject::Ptr obj = rtti::createInstance<FooClass2>();
+
+        const MethodHandle setValue{obj->getClassDescriptor(), "setValue1"};
+        const MethodHandle getValue{obj->getClassDescriptor(), "getValue1"};
+        ASSERT_TRUE(setValue);
+        ASSERT_TRUE(getValue);
+        ASSERT_FALSE((MethodHandle{obj->getClassDescriptor(), "unknownMethod"}));
+
+        const DispatchArgument valueArg{int64_t{33}};
+        ASSERT_TRUE(setValue.invoke(obj.get(), {&valueArg, 1}));
+
+        Result<nau::Ptr<>> result = getValue.invoke(obj.get());
+        ASSERT_TRUE(result);
+        ASSERT_EQ(*runtimeValueCast<unsigned>(*result), 33);
+    }
+
     /**
      */
     TEST(TestDynamicObject, GetInterface)
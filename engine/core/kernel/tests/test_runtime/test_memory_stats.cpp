@@ -0,0 +1,79 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "nau/memory/memory_stats.h"
+#include "nau/memory/slab_allocator.h"
+
+namespace nau::test
+{
+    TEST(TestMemoryStats, TagScope)
+    {
+        EXPECT_EQ(getCurrentMemoryTag(), MemoryTag::Default);
+        {
+            NAU_MEMORY_SCOPE(Render);
+            EXPECT_EQ(getCurrentMemoryTag(), MemoryTag::Render);
+            {
+                NAU_MEMORY_SCOPE(Physics);
+                EXPECT_EQ(getCurrentMemoryTag(), MemoryTag::Physics);
+            }
+            EXPECT_EQ(getCurrentMemoryTag(), MemoryTag::Render);
+        }
+        EXPECT_EQ(getCurrentMemoryTag(), MemoryTag::Default);
+    }
+
+    TEST(TestMemoryStats, SlabAllocationsAreTagged)
+    {
+        constexpr size_t BlocksCount = 100;
+        constexpr size_t BlockSize = 64;
+
+        SlabAllocator allocator;
+        const MemoryStatsSnapshot before = getMemoryStatsSnapshot();
+
+        std::vector<void*> blocks;
+        {
+            NAU_MEMORY_SCOPE(Scripts);
+            for (size_t i = 0; i < BlocksCount; ++i)
+            {
+                blocks.push_back(allocator.allocate(BlockSize));
+            }
+            blocks.push_back(allocator.allocate(100'000));
+        }
+
+        const MemoryStatsSnapshot allocated = getMemoryStatsSnapshot();
+        EXPECT_EQ(allocated[MemoryTag::Scripts].currentBytes - before[MemoryTag::Scripts].currentBytes, BlocksCount * BlockSize + 100'000);
+        EXPECT_EQ(allocated[MemoryTag::Scripts].allocationsCount - before[MemoryTag::Scripts].allocationsCount, BlocksCount + 1);
+        EXPECT_GE(allocated[MemoryTag::Scripts].peakBytes, allocated[MemoryTag::Scripts].currentBytes);
+
+        // Deallocation is accounted to the tag of the allocation (not the current one) even on the other thread.
+        std::thread([&]
+        {
+            for (void* block : blocks)
+            {
+                allocator.deallocate(block);
+            }
+        }).join();
+
+        const MemoryStatsSnapshot released = getMemoryStatsSnapshot();
+        EXPECT_EQ(released[MemoryTag::Scripts].currentBytes, before[MemoryTag::Scripts].currentBytes);
+        EXPECT_EQ(released[MemoryTag::Scripts].deallocationsCount - before[MemoryTag::Scripts].deallocationsCount, BlocksCount + 1);
+    }
+
+    TEST(TestMemoryStats, Budget)
+    {
+        SlabAllocator allocator;
+        setMemoryBudget(MemoryTag::Audio, 1);
+
+        void* block = nullptr;
+        {
+            NAU_MEMORY_SCOPE(Audio);
+            block = allocator.allocate(16);
+        }
+
+        EXPECT_TRUE(getMemoryStatsSnapshot()[MemoryTag::Audio].isOverBudget());
+        allocator.deallocate(block);
+
+        setMemoryBudget(MemoryTag::Audio, 0);
+        EXPECT_FALSE(getMemoryStatsSnapshot()[MemoryTag::Audio].isOverBudget());
+    }
+}  // namespace nau::test
@@ -195,4 +195,130 @@ namespace nau::test
                                                                        });
     }
 
+    /**
+        Test: the not ref counted object can be unregistered from the visit callback of the same thread (does not wait for the own visit).
+     */
+    TEST_F(TestRuntimeObjectRegistry, UnregisterRttiObjectFromVisit)
+    {
+        auto object = eastl::make_unique<UniqueType>();
+        RuntimeObjectRegistration reg{*object};
+
+        RuntimeObjectRegistry::getInstance().visitObjects<UniqueType>([&reg](eastl::span<IRttiObject*> objects)
+        {
+            ASSERT_EQ(objects.size(), 1);
+            reg = nullptr;
+        });
+
+        ASSERT_TRUE(hasNoRegisteredObjects());
+    }
+
+    /**
+        Test: the removal of the not ref counted object waits for the visit of the other thread, which uses the object.
+     */
+    TEST_F(TestRuntimeObjectRegistry, RemoveWaitsForConcurrentVisit)
+    {
+        using namespace std::chrono_literals;
+
+        auto object = eastl::make_unique<UniqueType>();
+        RuntimeObjectRegistration reg{*object};
+
+        std::atomic_bool visitStarted = false;
+        std::atomic_bool removed = false;
+        bool removedDuringVisit = true;
+
+        std::thread visitThread([&]
+        {
+            RuntimeObjectRegistry::getInstance().visitObjects<UniqueType>([&](eastl::span<IRttiObject*> objects)
+            {
+                visitStarted = true;
+                std::this_thread::sleep_for(50ms);
+                removedDuringVisit = removed.load();
+            });
+        });
+
+        while (!visitStarted)
+        {
+            std::this_thread::yield();
+        }
+
+        reg = nullptr;
+        removed = true;
+        object.reset();
+
+        visitThread.join();
+
+        ASSERT_FALSE(removedDuringVisit);
+        ASSERT_TRUE(hasNoRegisteredObjects());
+    }
+
+    /**
+        Test: the objects registered and unregistered concurrently by the different threads are all visited (by all and by the type)
+        and the visit by the type does not return the objects of the other types.
+     */
+    TEST_F(TestRuntimeObjectRegistry, ConcurrentRegistration)
+    {
+        constexpr size_t ThreadCount = 4;
+        constexpr size_t ObjectsPerThread = 200;
+
+        // The bucket of the type is built before the registrations: the new objects are added into it.
+        RuntimeObjectRegistry::getInstance().visitObjects<IDisposable>([](eastl::span<IRttiObject*>)
+        {
+        });
+
+        eastl::vector<eastl::vector<nau::Ptr<>>> objects(ThreadCount);
+        eastl::vector<eastl::vector<RuntimeObjectRegistration>> registrations(ThreadCount);
+        std::vector<std::thread> threads;
+
+        for (size_t t = 0; t < ThreadCount; ++t)
+        {
+            threads.emplace_back([&objects, &registrations, t]
+            {
+                for (size_t i = 0; i < ObjectsPerThread; ++i)
+                {
+                    if (i % 2 == 0)
+                    {
+                        objects[t].push_back(rtti::createInstance<AutoType>());
+                    }
+                    else
+                    {
+                        objects[t].push_back(rtti::createInstance<DisposableHelper>());
+                    }
+                    registrations[t].emplace_back(objects[t].back());
+
+                    // Churn: every third registration is removed at once.
+                    if (i % 3 == 0)
+                    {
+                        RuntimeObjectRegistration{rtti::createInstance<AutoType>()} = nullptr;
+                    }
+                }
+            });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        // Each DisposableHelper registers itself too.
+        const size_t disposableCount = ThreadCount * ObjectsPerThread / 2;
+        ASSERT_EQ(getRegisteredObjectCount(), ThreadCount * ObjectsPerThread + disposableCount);
+
+        size_t visitedDisposableCount = 0;
+        RuntimeObjectRegistry::getInstance().visitObjects<IDisposable>([&visitedDisposableCount](eastl::span<IRttiObject*> objects)
+        {
+            for (IRttiObject* const object : objects)
+            {
+                ASSERT_TRUE(object->is<IDisposable>());
+            }
+            visitedDisposableCount = objects.size();
+        });
+
+        // The disposable helper is registered twice: by the test and by itself.
+        ASSERT_EQ(visitedDisposableCount, disposableCount * 2);
+
+        registrations.clear();
+        objects.clear();
+        ASSERT_TRUE(hasNoRegisteredObjects());
+    }
+
 }  // namespace nau::test
@@ -0,0 +1,121 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "nau/serialization/binary_serialization.h"
+
+using namespace ::testing;
+
+namespace nau::test
+{
+    namespace
+    {
+        enum class TestKind : uint8_t
+        {
+            First,
+            Second
+        };
+
+        struct ItemV1
+        {
+            int id = 0;
+            std::string name;
+
+            NAU_CLASS_FIELDS(
+                CLASS_FIELD(id),
+                CLASS_FIELD(name))
+        };
+
+        struct ItemV2
+        {
+            int id = 0;
+            std::string name;
+            float weight = 1.5f;
+
+            NAU_CLASS_FIELDS(
+                CLASS_FIELD(id),
+                CLASS_FIELD(name),
+                CLASS_FIELD(weight))
+        };
+
+        struct Snapshot
+        {
+            bool enabled = false;
+            TestKind kind = TestKind::First;
+            eastl::string title;
+            std::vector<ItemV1> items;
+            std::map<std::string, unsigned> counters;
+            std::optional<double> value;
+            std::tuple<int, std::string> pair;
+            std::array<float, 3> position{};
+
+            NAU_CLASS_FIELDS(
+                CLASS_FIELD(enabled),
+                CLASS_FIELD(kind),
+                CLASS_FIELD(title),
+                CLASS_FIELD(items),
+                CLASS_FIELD(counters),
+                CLASS_FIELD(value),
+                CLASS_FIELD(pair),
+                CLASS_FIELD(position))
+        };
+    }  // namespace
+
+    TEST(TestBinarySerialization, ObjectRoundTrip)
+    {
+        Snapshot snapshot;
+        snapshot.enabled = true;
+        snapshot.kind = TestKind::Second;
+        snapshot.title = "snapshot";
+        snapshot.items = {{1, "first"}, {2, "second"}};
+        snapshot.counters = {{"a", 10}, {"b", 20}};
+        snapshot.value = 3.5;
+        snapshot.pair = {7, "seven"};
+        snapshot.position = {1.f, 2.f, 3.f};
+
+        const BytesBuffer buffer = serialization::binarySerialize(snapshot);
+        const Result<Snapshot> result = serialization::binaryDeserialize<Snapshot>({buffer.data(), buffer.size()});
+        ASSERT_TRUE(result);
+
+        ASSERT_TRUE(result->enabled);
+        ASSERT_EQ(result->kind, TestKind::Second);
+        ASSERT_EQ(result->title, "snapshot");
+        ASSERT_EQ(result->items.size(), 2);
+        ASSERT_EQ(result->items[1].id, 2);
+        ASSERT_EQ(result->items[1].name, "second");
+        ASSERT_EQ(result->counters, snapshot.counters);
+        ASSERT_EQ(result->value, 3.5);
+        ASSERT_EQ(result->pair, snapshot.pair);
+        ASSERT_EQ(result->position, snapshot.position);
+    }
+
+    TEST(TestBinarySerialization, ReadOlderVersion)
+    {
+        const BytesBuffer buffer = serialization::binarySerialize(ItemV1{5, "item"});
+
+        const Result<ItemV2> result = serialization::binaryDeserialize<ItemV2>({buffer.data(), buffer.size()});
+        ASSERT_TRUE(result);
+        ASSERT_EQ(result->id, 5);
+        ASSERT_EQ(result->name, "item");
+        ASSERT_EQ(result->weight, 1.5f);
+    }
+
+    TEST(TestBinarySerialization, ReadNewerVersion)
+    {
+        const BytesBuffer buffer = serialization::binarySerialize(std::vector<ItemV2>{{5, "item", 3.f}, {6, "other", 4.f}});
+
+        const Result<std::vector<ItemV1>> result = serialization::binaryDeserialize<std::vector<ItemV1>>({buffer.data(), buffer.size()});
+        ASSERT_TRUE(result);
+        ASSERT_EQ(result->size(), 2);
+        ASSERT_EQ(result->at(1).id, 6);
+        ASSERT_EQ(result->at(1).name, "other");
+    }
+
+    TEST(TestBinarySerialization, TruncatedData)
+    {
+        const BytesBuffer buffer = serialization::binarySerialize(ItemV1{5, "item"});
+
+        const Result<ItemV1> result = serialization::binaryDeserialize<ItemV1>({buffer.data(), buffer.size() - 1});
+        ASSERT_FALSE(result);
+    }
+}  // namespace nau::test
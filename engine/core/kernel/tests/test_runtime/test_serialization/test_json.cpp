@@ -2,6 +2,7 @@
 // Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
 
 
+#include "nau/memory/arena_allocator.h"
 #include "nau/meta/class_info.h"
 #include "nau/serialization/json.h"
 #include "nau/serialization/json_utils.h"
@@ -363,4 +364,49 @@ namespace nau::test
         ASSERT_EQ(jsonValue["type"].asString(), "array");
     }
 
+    /**
+        Test:
+            the values of the document parsed with the allocator are allocated from it and keep it alive;
+            the small integers and booleans are the shared immutable values.
+     */
+    TEST(TestSerializationJson, ParseWithArena)
+    {
+        eastl::string_view json =
+            R"--(
+            {
+                "id": 7,
+                "enabled": true,
+                "name": "object",
+                "scale": 1.5,
+                "items": [7, 100000]
+            }
+        )--";
+
+        auto arena = eastl::make_shared<ArenaAllocator>();
+        RuntimeDictionary::Ptr dict = *serialization::jsonParseString(json, arena);
+        RuntimeCollection::Ptr items = dict->getValue("items");
+        RuntimeStringValue::Ptr name = dict->getValue("name");
+        RuntimeFloatValue::Ptr scale = dict->getValue("scale");
+        RuntimeIntegerValue::Ptr id = dict->getValue("id");
+
+        ASSERT_EQ(name->getString(), "object");
+        ASSERT_EQ(scale->getSingle(), 1.5f);
+        ASSERT_EQ(items->getAt(1)->as<const RuntimeIntegerValue&>().getInt64(), 100000);
+        ASSERT_GE(arena->getAllocationsCount(), 5u);
+
+        ASSERT_FALSE(id->isMutable());
+        ASSERT_EQ(id.get(), items->getAt(0).get());
+        ASSERT_EQ(dict->getValue("enabled").get(), makeConstValue(true).get());
+
+        // The arena is released with the last of the document values.
+        eastl::weak_ptr<IMemAllocator> weakArena = arena;
+        arena.reset();
+        dict.reset();
+        items.reset();
+        name.reset();
+        ASSERT_FALSE(weakArena.expired());
+        scale.reset();
+        ASSERT_TRUE(weakArena.expired());
+    }
+
 }  // namespace nau::test
@@ -0,0 +1,70 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#include "nau/test/helpers/stopwatch.h"
+#include "nau/threading/waitable_counter.h"
+
+namespace nau::test
+{
+    /**
+        Test: wait on zero counter must not block.
+     */
+    TEST(TestWaitableCounter, ZeroDoesNotBlock)
+    {
+        threading::WaitableCounter counter;
+        ASSERT_TRUE(counter.waitForZero());
+        ASSERT_TRUE(counter.waitForZero(std::chrono::milliseconds(0)));
+    }
+
+    /**
+        Test: wait with timeout for the counter that is never decremented.
+     */
+    TEST(TestWaitableCounter, Timeout)
+    {
+        using namespace std::chrono_literals;
+        constexpr auto Timeout = 10ms;
+
+        threading::WaitableCounter counter;
+        counter.increment();
+
+        const Stopwatch stopWatch;
+        ASSERT_FALSE(counter.waitForZero(Timeout));
+        ASSERT_GE(stopWatch.getTimePassed().count(), Timeout.count());
+
+        counter.decrement();
+        ASSERT_TRUE(counter.waitForZero(Timeout));
+    }
+
+    /**
+        Test: multiple threads are decrementing the counter, main thread must be woken when the counter becomes zero.
+     */
+    TEST(TestWaitableCounter, MultithreadDecrement)
+    {
+        constexpr size_t ThreadsCount = 8;
+        constexpr size_t DecrementsPerThread = 10'000;
+
+        threading::WaitableCounter counter;
+        counter.increment(ThreadsCount * DecrementsPerThread);
+
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < ThreadsCount; ++i)
+        {
+            threads.emplace_back([&counter]
+            {
+                for (size_t j = 0; j < DecrementsPerThread; ++j)
+                {
+                    counter.decrement();
+                }
+            });
+        }
+
+        ASSERT_TRUE(counter.waitForZero());
+        ASSERT_EQ(counter.getCount(), 0);
+
+        for (auto& t : threads)
+        {
+            t.join();
+        }
+    }
+
+}  // namespace nau::test
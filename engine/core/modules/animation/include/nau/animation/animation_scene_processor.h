@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "nau/app/main_loop/game_system.h"
 #include "nau/scene/components/component.h"
 #include "nau/scene/components/component_life_cycle.h"
 #include "nau/scene/scene_processor.h"
@@ -14,13 +15,15 @@ namespace nau::animation
     class NAU_ANIMATION_EXPORT AnimationSceneProcessor final : public IRefCounted,
                                                                public scene::ISceneProcessor,
                                                                public scene::IComponentsAsyncActivator,
-                                                               public IServiceInitialization
+                                                               public IServiceInitialization,
+                                                               public IGamePostUpdate
     {
         NAU_CLASS_(AnimationSceneProcessor,
                    IRefCounted,
                    scene::ISceneProcessor,
                    scene::IComponentsAsyncActivator,
-                   IServiceInitialization)
+                   IServiceInitialization,
+                   IGamePostUpdate)
 
     public:
         AnimationSceneProcessor();
@@ -33,6 +36,11 @@ namespace nau::animation
         async::Task<> activateComponentsAsync(Uid worldUid, eastl::span<const scene::Component*> components, async::Task<> barrier) override;
 
         void syncSceneState() override;
+
+        /**
+         * @brief Evaluates the skeletal animations requested during the scene update, see SkeletalAnimationStage.
+         */
+        void gamePostUpdate(std::chrono::milliseconds dt) override;
     };
 
 }  // namespace nau::animation
@@ -4,6 +4,9 @@
 
 #pragma once
 
+#include <EASTL/unique_ptr.h>
+#include <EASTL/vector.h>
+#include <ozz/animation/runtime/blending_job.h>
 #include <ozz/animation/runtime/sampling_job.h>
 #include <ozz/animation/runtime/skeleton.h>
 #include <ozz/base/containers/vector.h>
@@ -25,21 +28,56 @@ namespace nau
     {
     };
 
+    /**
+     * @brief Enumerates the conditions to compute the model space pose of a skeleton (see SkeletonComponent::setPosePolicy).
+     */
+    enum class SkeletonPosePolicy
+    {
+        Always,                 ///<The pose is computed on each animation update.
+        WhenVisible,            ///<The pose is computed while a mesh of the skeleton passes the render culling.
+        WhenVisibleOrDependent  ///<As WhenVisible, the pose is also computed while the skeleton has sockets.
+    };
+
     struct SkeletalTrackData final
     {
-        float weight;
-        animation::AnimationBlendMethod blendMethod;
+        float weight = .0f;
+        animation::AnimationBlendMethod blendMethod = animation::AnimationBlendMethod::Mix;
 
         ozz::animation::SamplingJob::Context animSamplingContext;
         ozz::vector<ozz::math::SoaTransform> locals;
+
+        // The sampling requested by the animation update, run by the skeletal animation stage.
+        const ozz::animation::Animation* sampledAnimation = nullptr;
+        float samplingRatio = .0f;
+        // The pose shared by the skeletons with the same sampling (see SkeletonComponent::setPoseCacheTimeStep), read only.
+        const ozz::vector<ozz::math::SoaTransform>* sharedLocals = nullptr;
     };
 
     struct SkeletalAnimRuntimeData final
     {
-        eastl::map<nau::string, SkeletalTrackData> tracks;
+        // Indexed by AnimationState::trackHandle, the tracks never applied are null.
+        // The sampling context is not movable: the tracks are allocated once each.
+        eastl::vector<eastl::unique_ptr<SkeletalTrackData>> tracks;
 
         // Buffer of local transforms after blending is performed
         ozz::vector<ozz::math::SoaTransform> locals;
+
+        // The evaluation steps requested by the mixer for the skeletal animation stage.
+        bool isBlendPending = false;
+        bool isLocalToModelPending = false;
+        // The local-to-model skipped while the pose was not needed, run once it is.
+        bool isLocalToModelDeferred = false;
+
+        // Scratch layers of the blending, reused between the evaluations.
+        ozz::vector<ozz::animation::BlendingJob::Layer> layers;
+        ozz::vector<ozz::animation::BlendingJob::Layer> additiveLayers;
+
+        // The update-rate LOD: below the full rate the poses are blended at the LOD rate only,
+        // locals are interpolated between the two last blended (key) poses in the frames between.
+        ozz::vector<ozz::math::SoaTransform> prevKeyLocals;
+        ozz::vector<ozz::math::SoaTransform> nextKeyLocals;
+        float keyPoseElapsedTime = .0f;
+        bool hasKeyPose = false;
     };
 
     class NAU_ANIMATION_EXPORT SkeletonComponent : public scene::SceneComponent,
@@ -82,6 +120,49 @@ namespace nau
 
         SkeletalAnimRuntimeData& getAnimRuntimeDataMutable();
 
+        /**
+         * @brief Reports the distance from the main camera, the animation update rate of the skeleton is chosen from it.
+         *
+         * @param [in] distance Distance in world units, set by the renderer on the scene sync. 0 keeps the full rate.
+         */
+        void setAnimationLodDistance(float distance);
+        float getAnimationLodDistance() const;
+
+        void setPosePolicy(SkeletonPosePolicy policy);
+        SkeletonPosePolicy getPosePolicy() const;
+
+        /**
+         * @brief Shares the sampled poses with the skeletons of the same asset playing the same clips at the same time.
+         *
+         * @param [in] timeStep Quantization of the sampling time in seconds, 0 disables the sharing (the default).
+         *
+         * The playback time is snapped to the step: a larger step puts more phases of a crowd in the same bucket.
+         */
+        void setPoseCacheTimeStep(float timeStep);
+        float getPoseCacheTimeStep() const;
+
+        /**
+         * @brief Reports whether a mesh skinned by the skeleton passed the render culling, set by the renderer on the scene sync.
+         *
+         * @param [in] isVisible Whether the mesh is visible in any view. A skeleton with several meshes is visible if any of them is.
+         */
+        void reportVisibility(bool isVisible);
+
+        /**
+         * @brief Retrieves the visibility reported since the previous call and resets the reports.
+         *
+         * @return Whether any mesh of the skeleton is visible, true if none was reported (no renderer).
+         */
+        bool consumeVisibility();
+
+        /**
+         * @brief Whether the model space matrices were computed by the last animation evaluation.
+         *
+         * While it is false, the matrices hold an earlier pose and the skinning of the meshes is not rebuilt.
+         */
+        bool isPoseFinalized() const;
+        void setPoseFinalized(bool isFinalized);
+
         static bool drawDebugSkeletons;  // todo: DevOptions (?)
 
     private:
@@ -94,6 +175,14 @@ namespace nau
         // Buffer of model space matrices.
         ozz::vector<ozz::math::Float4x4> models;
 
+        float m_animationLodDistance = .0f;
+
+        SkeletonPosePolicy m_posePolicy = SkeletonPosePolicy::WhenVisibleOrDependent;
+        float m_poseCacheTimeStep = .0f;
+        uint32_t m_visibilityReportsCount = 0;
+        bool m_isVisibleReported = false;
+        bool m_isPoseFinalized = true;
+
         eastl::string m_name;
     };
 }  // namespace nau
@@ -12,6 +12,8 @@
 
 namespace nau
 {
+    class SkeletonComponent;
+
     /**
      * @brief Provides opportunity for child objects to be attached to (i.e. move together with) a particular bone of the skeleton.
      */
@@ -30,6 +32,15 @@ namespace nau
     public:
         virtual void updateComponent(float dt) override;
 
+        /**
+         * @brief Moves the socket to the current pose of its bone.
+         *
+         * @param [in] skeletonComponent Skeleton of the parent object.
+         *
+         * Called after the skeletal animation evaluation, so the socket follows the pose of the same frame.
+         */
+        void updateFromSkeleton(const SkeletonComponent& skeletonComponent);
+
         /**
          * @brief Attaches the socket to a particular bone.
          *
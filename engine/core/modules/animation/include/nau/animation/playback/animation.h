@@ -104,11 +104,11 @@ namespace nau::animation
         IAnimationPlayer::Ptr player;
 
         /**
-         * @brief Identifier of the associated animation instance.
+         * @brief Dense index of the associated animation instance in its controller.
          * 
-         * @todo Change identifier string representation to UID.
+         * Assigned when the instance is added to the controller. The skeletal animations address their blending track by it.
          */
-        nau::string animInstanceName;
+        int trackHandle = -1;
         
         /**
          * @brief Animation weight that is regarded as its relative contribution to the resulted value of the animated parameter when accumulating (blending) influences from multiple animations.
@@ -210,6 +210,13 @@ namespace nau::animation
         const eastl::string& getName() const;
         AnimationAssetRef getAssetRef() const;
 
+        /**
+         * @brief Binds the instance to a track of the animated target. See AnimationState::trackHandle.
+         * 
+         * @param [in] trackHandle Index of the instance in its controller.
+         */
+        void setTrackHandle(int trackHandle);
+
     protected:
         const Animation* getAnimation() const;
 
@@ -9,6 +9,7 @@
 #include "nau/assets/asset_descriptor_factory.h"
 #include "nau/scene/scene_object.h"
 #include "nau/service/service_provider.h"
+#include "playback/skeletal_animation_stage.h"
 
 namespace nau::animation
 {
@@ -70,4 +71,9 @@ namespace nau::animation
     {
     }
 
+    void AnimationSceneProcessor::gamePostUpdate(std::chrono::milliseconds dt)
+    {
+        SkeletalAnimationStage::get().evaluate(static_cast<float>(dt.count()) / 1000.f);
+    }
+
 }  // namespace nau::animation
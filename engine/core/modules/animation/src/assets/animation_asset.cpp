@@ -4,6 +4,8 @@
 
 #include "nau/animation/assets/animation_asset.h"
 
+#include "assets/ozz_file_stream.h"
+
 #include <ozz/animation/runtime/animation.h>
 #include <ozz/base/io/archive.h>
 #include <ozz/base/io/stream.h>
@@ -157,20 +159,10 @@ namespace nau::animation::data
 
         nau::io::IStreamReader::Ptr nauFileStreamRead = static_cast<nau::io::IStreamReader::Ptr>(file->createStream(io::AccessMode::Read));
 
-        const size_t fileSize = file->getSize();
-
-        eastl::vector<std::byte> fileData(fileSize);
-        Result<size_t> readResult = nauFileStreamRead->read(fileData.data(), fileSize);
-        if (!readResult)
-        {
-            NAU_ASSERT(false);
-        }
-
-        ozz::io::MemoryStream memStream;  // extra copy of data since there is no required API
-        memStream.Write(fileData.data(), fileData.size());
-        memStream.Seek(0, ozz::io::Stream::Origin::kSet);
+        // Deserialized straight from the file: the peak memory of a clip load is the clip itself.
+        OzzFileStream fileStream(std::move(nauFileStreamRead), file->getSize());
 
-        ozz::io::IArchive animArchive(&memStream);
+        ozz::io::IArchive animArchive(&fileStream);
 
         if (!animArchive.TestTag<ozz::animation::Animation>())
         {
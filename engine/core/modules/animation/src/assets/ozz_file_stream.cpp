@@ -0,0 +1,50 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "assets/ozz_file_stream.h"
+
+namespace nau::animation::data
+{
+    OzzFileStream::OzzFileStream(io::IStreamReader::Ptr stream, size_t size) :
+        m_stream(std::move(stream)),
+        m_size(size)
+    {
+    }
+
+    bool OzzFileStream::opened() const
+    {
+        return static_cast<bool>(m_stream);
+    }
+
+    size_t OzzFileStream::Read(void* buffer, size_t size)
+    {
+        Result<size_t> readResult = m_stream->read(reinterpret_cast<std::byte*>(buffer), size);
+        return readResult ? *readResult : 0;
+    }
+
+    size_t OzzFileStream::Write([[maybe_unused]] const void* buffer, [[maybe_unused]] size_t size)
+    {
+        NAU_ASSERT(false, "The ozz file stream is read only");
+        return 0;
+    }
+
+    int OzzFileStream::Seek(int offset, Origin origin)
+    {
+        const io::OffsetOrigin streamOrigin = origin == kSet     ? io::OffsetOrigin::Begin
+                                              : origin == kEnd ? io::OffsetOrigin::End
+                                                               : io::OffsetOrigin::Current;
+        m_stream->setPosition(streamOrigin, offset);
+        return 0;
+    }
+
+    int OzzFileStream::Tell() const
+    {
+        return static_cast<int>(m_stream->getPosition());
+    }
+
+    size_t OzzFileStream::Size() const
+    {
+        return m_size;
+    }
+}  // namespace nau::animation::data
@@ -0,0 +1,35 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <ozz/base/io/stream.h>
+
+#include "nau/io/stream.h"
+
+namespace nau::animation::data
+{
+    /**
+     * @brief Reads an ozz archive straight from a file stream of the engine file system.
+     *
+     * The clips are deserialized by chunks into their runtime buffers:
+     * no whole file copy and no memory stream copy of it while loading.
+     */
+    class OzzFileStream final : public ozz::io::Stream
+    {
+    public:
+        OzzFileStream(io::IStreamReader::Ptr stream, size_t size);
+
+        bool opened() const override;
+        size_t Read(void* buffer, size_t size) override;
+        size_t Write(const void* buffer, size_t size) override;
+        int Seek(int offset, Origin origin) override;
+        int Tell() const override;
+        size_t Size() const override;
+
+    private:
+        io::IStreamReader::Ptr m_stream;
+        size_t m_size;
+    };
+}  // namespace nau::animation::data
@@ -4,6 +4,8 @@
 
 #include "nau/animation/assets/skeleton_asset.h"
 
+#include "assets/ozz_file_stream.h"
+
 #include <ozz/base/io/archive.h>
 #include <ozz/base/io/stream.h>
 #include <ozz/animation/runtime/local_to_model_job.h>
@@ -57,20 +59,9 @@ namespace nau
 
         nau::io::IStreamReader::Ptr nauFileStreamRead = static_cast<nau::io::IStreamReader::Ptr>(file->createStream(io::AccessMode::Read));
 
-        const size_t fileSize = file->getSize();
-
-        eastl::vector<std::byte> fileData(fileSize);
-        Result<size_t> readResult = nauFileStreamRead->read(fileData.data(), fileSize);
-        if (!readResult)
-        {
-            NAU_ASSERT(false);
-        }
-
-        ozz::io::MemoryStream memStream;  // extra copy of data since there is no required API
-        memStream.Write(fileData.data(), fileData.size());
-        memStream.Seek(0, ozz::io::Stream::Origin::kSet);
+        animation::data::OzzFileStream fileStream(std::move(nauFileStreamRead), file->getSize());
 
-        ozz::io::IArchive archive(&memStream);
+        ozz::io::IArchive archive(&fileStream);
 
         if (!archive.TestTag<ozz::animation::Skeleton>())
         {
@@ -48,6 +48,9 @@ namespace nau
         models.resize(getSkeleton().num_joints());
 
         animRuntimeData.locals.resize(getSkeleton().num_soa_joints());
+        animRuntimeData.prevKeyLocals.resize(getSkeleton().num_soa_joints());
+        animRuntimeData.nextKeyLocals.resize(getSkeleton().num_soa_joints());
+        animRuntimeData.hasKeyPose = false;
 
         setSkeletonToDefaultPose();
     }
@@ -90,6 +93,61 @@ namespace nau
         return animRuntimeData;
     }
 
+    void SkeletonComponent::setAnimationLodDistance(float distance)
+    {
+        m_animationLodDistance = distance;
+    }
+
+    float SkeletonComponent::getAnimationLodDistance() const
+    {
+        return m_animationLodDistance;
+    }
+
+    void SkeletonComponent::setPosePolicy(SkeletonPosePolicy policy)
+    {
+        m_posePolicy = policy;
+    }
+
+    SkeletonPosePolicy SkeletonComponent::getPosePolicy() const
+    {
+        return m_posePolicy;
+    }
+
+    void SkeletonComponent::setPoseCacheTimeStep(float timeStep)
+    {
+        m_poseCacheTimeStep = eastl::max(timeStep, .0f);
+    }
+
+    float SkeletonComponent::getPoseCacheTimeStep() const
+    {
+        return m_poseCacheTimeStep;
+    }
+
+    void SkeletonComponent::reportVisibility(bool isVisible)
+    {
+        ++m_visibilityReportsCount;
+        m_isVisibleReported |= isVisible;
+    }
+
+    bool SkeletonComponent::consumeVisibility()
+    {
+        const bool isVisible = m_visibilityReportsCount == 0 || m_isVisibleReported;
+        m_visibilityReportsCount = 0;
+        m_isVisibleReported = false;
+
+        return isVisible;
+    }
+
+    bool SkeletonComponent::isPoseFinalized() const
+    {
+        return m_isPoseFinalized;
+    }
+
+    void SkeletonComponent::setPoseFinalized(bool isFinalized)
+    {
+        m_isPoseFinalized = isFinalized;
+    }
+
     unsigned SkeletonComponent::getBonesCount() const
     {
         return models.size();
@@ -21,13 +21,18 @@ namespace nau
             return;
         }
 
-        const eastl::vector<SkeletonJoint>& joints = skeletonComponent->getJoints();
+        updateFromSkeleton(*skeletonComponent);
+    }
+
+    void SkeletonSocketComponent::updateFromSkeleton(const SkeletonComponent& skeletonComponent)
+    {
+        const eastl::vector<SkeletonJoint>& joints = skeletonComponent.getJoints();
 
         for (size_t jointIndex = 0; jointIndex < joints.size(); ++jointIndex)
         {
             if (joints[jointIndex].jointName == m_boneName)
             {
-                const auto& modelSpaceJointMatrices = skeletonComponent->getModelSpaceJointMatrices();
+                const auto& modelSpaceJointMatrices = skeletonComponent.getModelSpaceJointMatrices();
 
                 math::Matrix4 socketTransform;
                 std::memcpy(&socketTransform, &modelSpaceJointMatrices.at(jointIndex), 64);
@@ -57,6 +57,7 @@ namespace nau::animation
 
     void AnimationController::addAnimation(nau::Ptr<AnimationInstance> animation)
     {
+        animation->setTrackHandle(static_cast<int>(m_animations.size()));
         m_animations.push_back(animation);
     }
     
@@ -82,8 +82,6 @@ namespace nau::animation
 
             m_animationState.target = target;
 
-            m_animationState.animInstanceName = m_name;
-
             const bool isPlaying = m_animationState.weight > AnimationController::NEGLIGIBLE_WEIGHT;
 
             if (!m_animationState.ignoreController)
@@ -220,6 +218,11 @@ namespace nau::animation
         return m_animationAsset;
     }
 
+    void AnimationInstance::setTrackHandle(int trackHandle)
+    {
+        m_animationState.trackHandle = trackHandle;
+    }
+
     const Animation* AnimationInstance::getAnimation() const
     {
         return m_animation.get();
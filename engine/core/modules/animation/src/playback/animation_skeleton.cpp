@@ -5,13 +5,11 @@
 #include "nau/animation/playback/animation_skeleton.h"
 
 #include "animation_helper.h"
+#include "playback/skeletal_animation_stage.h"
+#include "nau/math/math.h"
 
-#include <ozz/base/span.h>
 #include <ozz/base/maths/soa_transform.h>
 #include <ozz/base/maths/vec_float.h>
-#include <ozz/animation/runtime/sampling_job.h>
-#include <ozz/animation/runtime/blending_job.h>
-#include <ozz/animation/runtime/local_to_model_job.h>
 #include <ozz/base/containers/vector.h>
 #include <ozz/animation/runtime/skeleton.h>
 #include <ozz/animation/runtime/animation.h>
@@ -33,7 +31,18 @@ namespace nau::animation
 
             SkeletalAnimRuntimeData& d = skeletonComponent->getAnimRuntimeDataMutable();
 
-            auto& track = d.tracks[animationState.animInstanceName];
+            NAU_ASSERT_RETURN(animationState.trackHandle >= 0);
+            if (d.tracks.size() <= static_cast<size_t>(animationState.trackHandle))
+            {
+                d.tracks.resize(animationState.trackHandle + 1);
+            }
+
+            if (!d.tracks[animationState.trackHandle])
+            {
+                d.tracks[animationState.trackHandle] = eastl::make_unique<SkeletalTrackData>();
+            }
+
+            SkeletalTrackData& track = *d.tracks[animationState.trackHandle];
 
             track.blendMethod = animationState.blendMethod;
             track.weight = !animationState.isStopped ? animationState.weight : .0f;
@@ -47,14 +56,12 @@ namespace nau::animation
                 track.animSamplingContext.Resize(numJoints);
             }
 
-            ozz::animation::SamplingJob sampling_job;
-            sampling_job.animation = &ozzAnimation;
-            sampling_job.context = &track.animSamplingContext;
-            sampling_job.ratio = frame / getDurationInFrames(); // [0, 1]
-            sampling_job.output = ozz::make_span(track.locals);
-            if (!sampling_job.Run()) {
-                NAU_ASSERT(false);
-            }
+            // The blending ignores the layers without weight: their pose is not sampled.
+            // The sampling itself runs with the other skeletons in SkeletalAnimationStage::evaluate.
+            track.sampledAnimation = track.weight > .0f ? &ozzAnimation : nullptr;
+            // By the continuous playback time: the pose does not snap to the frames of the controller frame rate.
+            const float duration = ozzAnimation.duration();
+            track.samplingRatio = duration > .0f ? math::clamp(animationState.time / duration, .0f, 1.f) : .0f; // [0, 1]
         }
     }
 
@@ -68,45 +75,12 @@ namespace nau::animation
         if (SkeletonComponent* skeletonComponent = getAnimatableTarget<SkeletonComponent>(target))
         {
             SkeletalAnimRuntimeData& d = skeletonComponent->getAnimRuntimeDataMutable();
-
-            ozz::vector<ozz::animation::BlendingJob::Layer> layers;
-            ozz::vector<ozz::animation::BlendingJob::Layer> additiveLayers;
-
-            ozz::animation::BlendingJob::Layer* curLayer = nullptr;
-            for (const auto& track : d.tracks)
+            if (!d.isBlendPending && !d.isLocalToModelPending)
             {
-                switch(track.second.blendMethod) // blendMethod is set in SkeletalAnimation::apply
-                {
-                case AnimationBlendMethod::Mix:
-                    curLayer = &layers.emplace_back();
-                    break;
-                case AnimationBlendMethod::Additive:
-                    curLayer = &additiveLayers.emplace_back();
-                    break;
-                default:
-                    break;
-                }
-
-                if (!curLayer)
-                {
-                    NAU_ASSERT(false);
-                    continue;
-                }
-                curLayer->weight = track.second.weight; // weight is set in SkeletalAnimation::apply
-                curLayer->transform = make_span(track.second.locals);
-                //curLayer->joint_weights // <- can be used for per-bone masking for animation, not yet supported
+                SkeletalAnimationStage::get().enqueue(*skeletonComponent);
             }
 
-            ozz::animation::BlendingJob blend_job;
-            blend_job.threshold = 0.05f; // todo: tunable param per skeleton? 
-            blend_job.layers = ozz::make_span(layers);
-            blend_job.additive_layers = ozz::make_span(additiveLayers);
-            blend_job.rest_pose = skeletonComponent->getSkeleton().joint_rest_poses();
-            blend_job.output = ozz::make_span(d.locals);
-
-            if (!blend_job.Run()) {
-                NAU_ASSERT(false);
-            }
+            d.isBlendPending = true;
         }
     }
 
@@ -115,14 +89,12 @@ namespace nau::animation
         if (SkeletonComponent* skeletonComponent = getAnimatableTarget<SkeletonComponent>(target))
         {
             SkeletalAnimRuntimeData& d = skeletonComponent->getAnimRuntimeDataMutable();
-
-            ozz::animation::LocalToModelJob ltm_job;
-            ltm_job.skeleton = &skeletonComponent->getSkeleton();
-            ltm_job.input = ozz::make_span(d.locals);
-            ltm_job.output = ozz::make_span(skeletonComponent->getModelSpaceJointMatricesMutable());
-            if (!ltm_job.Run()) {
-                NAU_ASSERT(false);
+            if (!d.isBlendPending && !d.isLocalToModelPending)
+            {
+                SkeletalAnimationStage::get().enqueue(*skeletonComponent);
             }
+
+            d.isLocalToModelPending = true;
         }
     }
 
@@ -0,0 +1,388 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "playback/skeletal_animation_stage.h"
+
+#include "nau/animation/components/skeleton_socket_component.h"
+#include "nau/async/parallel_for.h"
+#include "nau/scene/scene_object.h"
+
+#include <ozz/animation/runtime/animation.h>
+#include <ozz/animation/runtime/blending_job.h>
+#include <ozz/animation/runtime/local_to_model_job.h>
+#include <ozz/animation/runtime/sampling_job.h>
+#include <ozz/base/maths/simd_math.h>
+#include <ozz/base/maths/soa_transform.h>
+#include <ozz/base/span.h>
+
+#include <cmath>
+
+namespace nau::animation
+{
+    namespace
+    {
+        struct AnimationLodTier
+        {
+            float maxDistance;
+            // The key poses per second, 0 is every evaluation.
+            float updateRate;
+        };
+
+        constexpr AnimationLodTier AnimationLodTiers[] = {{15.f, .0f}, {30.f, 30.f}, {60.f, 15.f}};
+        constexpr float FarthestUpdateRate = 5.f;
+
+        float getKeyPosePeriod(float lodDistance)
+        {
+            for (const AnimationLodTier& tier : AnimationLodTiers)
+            {
+                if (lodDistance < tier.maxDistance)
+                {
+                    return tier.updateRate > .0f ? 1.f / tier.updateRate : .0f;
+                }
+            }
+
+            return 1.f / FarthestUpdateRate;
+        }
+
+        void interpolateLocals(const ozz::vector<ozz::math::SoaTransform>& from, const ozz::vector<ozz::math::SoaTransform>& to,
+                               float alpha, ozz::vector<ozz::math::SoaTransform>& output)
+        {
+            using namespace ozz::math;
+
+            const SimdFloat4 alpha4 = simd_float4::Load1(alpha);
+            for (size_t i = 0; i < output.size(); ++i)
+            {
+                // The rotations are interpolated by the shortest path, like the blending does.
+                const SimdInt4 sign = Sign(Dot(from[i].rotation, to[i].rotation));
+                const SoaQuaternion toRotation = {Xor(to[i].rotation.x, sign), Xor(to[i].rotation.y, sign),
+                                                  Xor(to[i].rotation.z, sign), Xor(to[i].rotation.w, sign)};
+
+                output[i].translation = Lerp(from[i].translation, to[i].translation, alpha4);
+                output[i].rotation = NLerpEst(from[i].rotation, toRotation, alpha4);
+                output[i].scale = Lerp(from[i].scale, to[i].scale, alpha4);
+            }
+        }
+    }  // namespace
+
+    SkeletalAnimationStage& SkeletalAnimationStage::get()
+    {
+        static SkeletalAnimationStage stage;
+        return stage;
+    }
+
+    void SkeletalAnimationStage::enqueue(SkeletonComponent& skeletonComponent)
+    {
+        std::lock_guard lock(m_mutex);
+        m_pendingSkeletons.emplace_back(skeletonComponent);
+    }
+
+    void SkeletalAnimationStage::evaluate(float dt)
+    {
+        {
+            std::lock_guard lock(m_mutex);
+
+            // The skeletons deactivated since the enqueue are dropped.
+            m_evaluatedSkeletons.clear();
+            for (auto& skeletonRef : m_pendingSkeletons)
+            {
+                if (skeletonRef)
+                {
+                    m_evaluatedSkeletons.push_back(skeletonRef.get());
+                }
+            }
+            m_pendingSkeletons.clear();
+        }
+
+        if (m_evaluatedSkeletons.empty())
+        {
+            return;
+        }
+
+        // The visibility is reported by the renderer of the previous frame, the sockets are looked up on the main thread.
+        for (SkeletonComponent* const skeletonComponent : m_evaluatedSkeletons)
+        {
+            const bool isVisible = skeletonComponent->consumeVisibility();
+
+            bool isPoseNeeded = true;
+            switch (skeletonComponent->getPosePolicy())
+            {
+            case SkeletonPosePolicy::WhenVisible:
+                isPoseNeeded = isVisible;
+                break;
+            case SkeletonPosePolicy::WhenVisibleOrDependent:
+                isPoseNeeded = isVisible || hasSockets(*skeletonComponent);
+                break;
+            default:
+                break;
+            }
+
+            skeletonComponent->setPoseFinalized(isPoseNeeded);
+        }
+
+        // The shared poses are sampled first, one job per distinct sampling, then read by the skeletons.
+        m_poseCache.clear();
+        m_poseCacheEntriesCount = 0;
+        for (SkeletonComponent* const skeletonComponent : m_evaluatedSkeletons)
+        {
+            if (skeletonComponent->getPoseCacheTimeStep() > .0f)
+            {
+                resolvePoseCache(*skeletonComponent);
+            }
+        }
+
+        if (m_poseCacheEntriesCount > 0)
+        {
+            async::parallelFor(m_poseCacheEntriesCount, 1, [this](size_t entryIndex)
+            {
+                PoseCacheEntry& entry = *m_poseCacheEntries[entryIndex];
+
+                ozz::animation::SamplingJob sampling_job;
+                sampling_job.animation = entry.animation;
+                sampling_job.context = &entry.samplingContext;
+                sampling_job.ratio = entry.samplingRatio;
+                sampling_job.output = ozz::make_span(entry.locals);
+                if (!sampling_job.Run()) {
+                    NAU_ASSERT(false);
+                }
+            });
+        }
+
+        // Each skeleton writes its own runtime data and matrices only.
+        async::parallelFor(m_evaluatedSkeletons.size(), 1, [this, dt](size_t skeletonIndex)
+        {
+            evaluateSkeleton(*m_evaluatedSkeletons[skeletonIndex], dt);
+        });
+
+        // The sync point: the sockets follow the evaluated poses of this frame.
+        for (SkeletonComponent* const skeletonComponent : m_evaluatedSkeletons)
+        {
+            if (!skeletonComponent->isPoseFinalized())
+            {
+                continue;
+            }
+
+            for (scene::SceneObject* const childObject : skeletonComponent->getParentObject().getChildObjects(false))
+            {
+                if (auto* const socketComponent = childObject->findFirstComponent<SkeletonSocketComponent>())
+                {
+                    socketComponent->updateFromSkeleton(*skeletonComponent);
+                }
+            }
+        }
+    }
+
+    void SkeletalAnimationStage::evaluateSkeleton(SkeletonComponent& skeletonComponent, float dt)
+    {
+        SkeletalAnimRuntimeData& d = skeletonComponent.getAnimRuntimeDataMutable();
+
+        if (d.isBlendPending)
+        {
+            const float keyPosePeriod = getKeyPosePeriod(skeletonComponent.getAnimationLodDistance());
+            if (keyPosePeriod <= .0f)
+            {
+                sampleTracks(d);
+                blendTracks(d, skeletonComponent, ozz::make_span(d.locals));
+                d.hasKeyPose = false;
+            }
+            else
+            {
+                d.keyPoseElapsedTime += dt;
+                if (!d.hasKeyPose || d.keyPoseElapsedTime >= keyPosePeriod)
+                {
+                    sampleTracks(d);
+                    eastl::swap(d.prevKeyLocals, d.nextKeyLocals);
+                    blendTracks(d, skeletonComponent, ozz::make_span(d.nextKeyLocals));
+
+                    if (!d.hasKeyPose)
+                    {
+                        d.prevKeyLocals = d.nextKeyLocals;
+                        d.hasKeyPose = true;
+                    }
+
+                    // The remainder keeps the rate, a long frame does not queue up the key poses.
+                    d.keyPoseElapsedTime = std::fmod(d.keyPoseElapsedTime, keyPosePeriod);
+                }
+
+                const float alpha = eastl::min(d.keyPoseElapsedTime / keyPosePeriod, 1.f);
+                interpolateLocals(d.prevKeyLocals, d.nextKeyLocals, alpha, d.locals);
+            }
+
+            d.isBlendPending = false;
+        }
+
+        // The tracks requested without the blending are not used, the shared poses are valid for this evaluation only.
+        for (const auto& trackPtr : d.tracks)
+        {
+            if (trackPtr)
+            {
+                trackPtr->sampledAnimation = nullptr;
+                trackPtr->sharedLocals = nullptr;
+            }
+        }
+
+        // Not needed this frame: the model space pose is computed once the skeleton is needed again.
+        if (d.isLocalToModelPending && !skeletonComponent.isPoseFinalized())
+        {
+            d.isLocalToModelPending = false;
+            d.isLocalToModelDeferred = true;
+        }
+
+        if (d.isLocalToModelPending || (d.isLocalToModelDeferred && skeletonComponent.isPoseFinalized()))
+        {
+            ozz::animation::LocalToModelJob ltm_job;
+            ltm_job.skeleton = &skeletonComponent.getSkeleton();
+            ltm_job.input = ozz::make_span(d.locals);
+            ltm_job.output = ozz::make_span(skeletonComponent.getModelSpaceJointMatricesMutable());
+            if (!ltm_job.Run()) {
+                NAU_ASSERT(false);
+            }
+
+            d.isLocalToModelPending = false;
+            d.isLocalToModelDeferred = false;
+        }
+    }
+
+    bool SkeletalAnimationStage::PoseCacheKey::operator==(const PoseCacheKey& other) const
+    {
+        return animation == other.animation && skeleton == other.skeleton && time == other.time;
+    }
+
+    size_t SkeletalAnimationStage::PoseCacheKeyHash::operator()(const PoseCacheKey& key) const
+    {
+        size_t hash = eastl::hash<const void*>{}(key.animation);
+        hash = hash * 31 + eastl::hash<const void*>{}(key.skeleton);
+        return hash * 31 + eastl::hash<float>{}(key.time);
+    }
+
+    void SkeletalAnimationStage::resolvePoseCache(SkeletonComponent& skeletonComponent)
+    {
+        SkeletalAnimRuntimeData& d = skeletonComponent.getAnimRuntimeDataMutable();
+        const float timeStep = skeletonComponent.getPoseCacheTimeStep();
+
+        for (const auto& trackPtr : d.tracks)
+        {
+            if (!trackPtr || !trackPtr->sampledAnimation)
+            {
+                continue;
+            }
+
+            SkeletalTrackData& track = *trackPtr;
+            const ozz::animation::Animation& animation = *track.sampledAnimation;
+
+            const float duration = animation.duration();
+            const float time = duration > .0f ? std::round(track.samplingRatio * duration / timeStep) * timeStep : .0f;
+
+            const PoseCacheKey key{&animation, &skeletonComponent.getSkeleton(), time};
+            auto [entryIter, isNewEntry] = m_poseCache.emplace(key, nullptr);
+            if (isNewEntry)
+            {
+                if (m_poseCacheEntriesCount == m_poseCacheEntries.size())
+                {
+                    m_poseCacheEntries.push_back(eastl::make_unique<PoseCacheEntry>());
+                }
+
+                PoseCacheEntry& entry = *m_poseCacheEntries[m_poseCacheEntriesCount++];
+                entry.animation = &animation;
+                entry.samplingRatio = duration > .0f ? eastl::min(time / duration, 1.f) : .0f;
+                if (entry.samplingContext.max_tracks() < animation.num_tracks())
+                {
+                    entry.samplingContext.Resize(animation.num_tracks());
+                }
+                entry.locals.resize(animation.num_soa_tracks());
+
+                entryIter->second = &entry;
+            }
+
+            track.sharedLocals = &entryIter->second->locals;
+            track.sampledAnimation = nullptr;
+        }
+    }
+
+    bool SkeletalAnimationStage::hasSockets(SkeletonComponent& skeletonComponent)
+    {
+        for (scene::SceneObject* const childObject : skeletonComponent.getParentObject().getChildObjects(false))
+        {
+            if (childObject->findFirstComponent<SkeletonSocketComponent>())
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void SkeletalAnimationStage::sampleTracks(SkeletalAnimRuntimeData& d)
+    {
+        for (const auto& trackPtr : d.tracks)
+        {
+            if (!trackPtr || !trackPtr->sampledAnimation)
+            {
+                continue;
+            }
+
+            SkeletalTrackData& track = *trackPtr;
+
+            ozz::animation::SamplingJob sampling_job;
+            sampling_job.animation = track.sampledAnimation;
+            sampling_job.context = &track.animSamplingContext;
+            sampling_job.ratio = track.samplingRatio;  // [0, 1]
+            sampling_job.output = ozz::make_span(track.locals);
+            if (!sampling_job.Run()) {
+                NAU_ASSERT(false);
+            }
+
+            track.sampledAnimation = nullptr;
+        }
+    }
+
+    void SkeletalAnimationStage::blendTracks(SkeletalAnimRuntimeData& d, const SkeletonComponent& skeletonComponent, ozz::span<ozz::math::SoaTransform> output)
+    {
+        // The capacity of the scratch layers is kept: no allocation once the tracks are known.
+        d.layers.clear();
+        d.additiveLayers.clear();
+
+        ozz::animation::BlendingJob::Layer* curLayer = nullptr;
+        for (const auto& trackPtr : d.tracks)
+        {
+            if (!trackPtr)
+            {
+                continue;
+            }
+
+            const SkeletalTrackData& track = *trackPtr;
+
+            switch(track.blendMethod) // blendMethod is set in SkeletalAnimation::apply
+            {
+            case AnimationBlendMethod::Mix:
+                curLayer = &d.layers.emplace_back();
+                break;
+            case AnimationBlendMethod::Additive:
+                curLayer = &d.additiveLayers.emplace_back();
+                break;
+            default:
+                break;
+            }
+
+            if (!curLayer)
+            {
+                NAU_ASSERT(false);
+                continue;
+            }
+            curLayer->weight = track.weight; // weight is set in SkeletalAnimation::apply
+            curLayer->transform = make_span(track.sharedLocals ? *track.sharedLocals : track.locals);
+            //curLayer->joint_weights // <- can be used for per-bone masking for animation, not yet supported
+        }
+
+        ozz::animation::BlendingJob blend_job;
+        blend_job.threshold = 0.05f; // todo: tunable param per skeleton? 
+        blend_job.layers = ozz::make_span(d.layers);
+        blend_job.additive_layers = ozz::make_span(d.additiveLayers);
+        blend_job.rest_pose = skeletonComponent.getSkeleton().joint_rest_poses();
+        blend_job.output = output;
+
+        if (!blend_job.Run()) {
+            NAU_ASSERT(false);
+        }
+    }
+}  // namespace nau::animation
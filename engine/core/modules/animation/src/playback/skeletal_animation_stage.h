@@ -0,0 +1,91 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include "nau/animation/components/skeleton_component.h"
+
+#include <ozz/base/span.h>
+
+#include <EASTL/hash_map.h>
+#include <EASTL/unique_ptr.h>
+#include <EASTL/vector.h>
+
+#include <mutex>
+
+namespace nau::animation
+{
+    /**
+     * @brief Evaluates the skeletal animations of the scene update in parallel.
+     *
+     * SkeletalAnimation::apply and SkeletalAnimationMixer only record the sampling, blending and local-to-model work
+     * of a skeleton during the scene update. After the update, evaluate() runs the work of each skeleton as a job on
+     * the thread pool and waits for all of them: the model space matrices are ready for the skinning from there on.
+     *
+     * The skeletons far from the camera (see SkeletonComponent::setAnimationLodDistance) are sampled and blended
+     * at a reduced rate, their locals are interpolated between the blended poses in the frames between.
+     * The model space pose of the skeletons that are not needed (see SkeletonPosePolicy) is not computed.
+     *
+     * The skeletons with the pose cache (see SkeletonComponent::setPoseCacheTimeStep) share the sampled poses:
+     * the tracks of the same clip, skeleton and quantized time are sampled once per evaluation and read by all of them.
+     */
+    class SkeletalAnimationStage
+    {
+    public:
+        static SkeletalAnimationStage& get();
+
+        /**
+         * @brief Schedules the pending work of the skeleton for the next evaluate().
+         *
+         * @param [in] skeletonComponent Skeleton with the work requested in its SkeletalAnimRuntimeData, enqueued once per update.
+         */
+        void enqueue(SkeletonComponent& skeletonComponent);
+
+        /**
+         * @brief Runs the work of all the scheduled skeletons and updates their sockets.
+         *
+         * @param [in] dt Time since the previous evaluation in seconds, advances the reduced rate skeletons.
+         */
+        void evaluate(float dt);
+
+    private:
+        struct PoseCacheKey
+        {
+            const ozz::animation::Animation* animation = nullptr;
+            const ozz::animation::Skeleton* skeleton = nullptr;
+            float time = .0f;
+
+            bool operator==(const PoseCacheKey& other) const;
+        };
+
+        struct PoseCacheKeyHash
+        {
+            size_t operator()(const PoseCacheKey& key) const;
+        };
+
+        // The shared sampling of a key, the entries are reused between the evaluations.
+        struct PoseCacheEntry
+        {
+            const ozz::animation::Animation* animation = nullptr;
+            float samplingRatio = .0f;
+            ozz::animation::SamplingJob::Context samplingContext;
+            ozz::vector<ozz::math::SoaTransform> locals;
+        };
+
+        void resolvePoseCache(SkeletonComponent& skeletonComponent);
+
+        static void evaluateSkeleton(SkeletonComponent& skeletonComponent, float dt);
+        static bool hasSockets(SkeletonComponent& skeletonComponent);
+        static void sampleTracks(SkeletalAnimRuntimeData& d);
+        static void blendTracks(SkeletalAnimRuntimeData& d, const SkeletonComponent& skeletonComponent, ozz::span<ozz::math::SoaTransform> output);
+
+        std::mutex m_mutex;
+        eastl::vector<scene::ObjectWeakRef<SkeletonComponent>> m_pendingSkeletons;
+        eastl::vector<SkeletonComponent*> m_evaluatedSkeletons;
+
+        eastl::hash_map<PoseCacheKey, PoseCacheEntry*, PoseCacheKeyHash> m_poseCache;
+        eastl::vector<eastl::unique_ptr<PoseCacheEntry>> m_poseCacheEntries;
+        size_t m_poseCacheEntriesCount = 0;
+    };
+}  // namespace nau::animation
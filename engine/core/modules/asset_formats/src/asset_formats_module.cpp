@@ -5,6 +5,7 @@
 #include "animation/nanim_asset_container.h"
 #include "gltf/gltf_asset_container.h"
 #include "material/material_asset_container.h"
+#include "mesh/native_mesh_asset_container.h"
 #include "nau/module/module.h"
 #include "nau/service/service_provider.h"
 #include "scene/scene_container_builder.h"
@@ -42,6 +43,7 @@ namespace nau
             NAU_MODULE_EXPORT_SERVICE(SceneContainerBuilder);
             NAU_MODULE_EXPORT_SERVICE(SceneAssetLoader);
             NAU_MODULE_EXPORT_SERVICE(NanimAssetContainerLoader);
+            NAU_MODULE_EXPORT_SERVICE(NativeMeshAssetContainerLoader);
         }
     };
 
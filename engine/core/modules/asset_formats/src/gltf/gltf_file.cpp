@@ -5,6 +5,7 @@
 #include "gltf/gltf_file.h"
 
 #include "nau/diag/logging.h"
+#include "nau/memory/arena_allocator.h"
 #include "nau/serialization/json.h"
 #include "nau/serialization/runtime_value_builder.h"
 
@@ -12,7 +13,8 @@ namespace nau
 {
     Result<> GltfFile::loadFromJsonStream(const io::IStreamReader::Ptr& stream, GltfFile& gltfFile)
     {
-        auto parseResult = serialization::jsonParse(stream->as<io::IStreamReader&>());
+        // The parsed document is released right after it is applied to the gltfFile.
+        auto parseResult = serialization::jsonParse(stream->as<io::IStreamReader&>(), eastl::make_shared<ArenaAllocator>());
         NauCheckResult(parseResult);
 
         auto value = nau::makeValueRef(gltfFile);
@@ -70,18 +70,49 @@ namespace nau
 
     struct GltfMeshData
     {
+        /**
+         * The lod generated by the asset tools: the indices accessor of the triangles of the lod 0 vertices.
+         */
+        struct PrimitiveLod
+        {
+            unsigned indices;
+            float screenSize;
+
+#pragma region Class Info
+
+            NAU_CLASS_FIELDS(
+                CLASS_FIELD(indices),
+                CLASS_FIELD(screenSize))
+
+#pragma endregion
+        };
+
+        struct PrimitiveExtras
+        {
+            eastl::vector<PrimitiveLod> lods;
+
+#pragma region Class Info
+
+            NAU_CLASS_FIELDS(
+                CLASS_FIELD(lods))
+
+#pragma endregion
+        };
+
         struct MeshPrimitive
         {
             eastl::map<eastl::string, unsigned> attributes;
             unsigned indices;
             std::optional<unsigned> material;
+            std::optional<PrimitiveExtras> extras;
 
 #pragma region Class Info
 
             NAU_CLASS_FIELDS(
                 CLASS_FIELD(attributes),
                 CLASS_FIELD(indices),
-                CLASS_FIELD(material))
+                CLASS_FIELD(material),
+                CLASS_FIELD(extras))
 
 #pragma endregion
         };
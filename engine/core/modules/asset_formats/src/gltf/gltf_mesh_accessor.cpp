@@ -162,6 +162,24 @@ namespace nau
             binaryAccessor.offset = bufferView.byteOffset;
             binaryAccessor.size = bufferView.byteLength;
         }
+
+        if (subMesh.extras)
+        {
+            for (const GltfMeshData::PrimitiveLod& primitiveLod : subMesh.extras->lods)
+            {
+                const auto& lodIndexAccessor = file.accessors[primitiveLod.indices];
+                const auto& lodIndexBufferView = file.bufferViews[lodIndexAccessor.bufferView];
+
+                Lod& lod = m_lods.emplace_back();
+                lod.description.indexCount = lodIndexAccessor.count;
+                lod.description.screenSize = primitiveLod.screenSize;
+                lod.indexFormat = gltf2ElementFormat(lodIndexAccessor.componentType);
+                lod.indices.file = bufferFiles[lodIndexBufferView.buffer];
+                lod.indices.attrib = nullptr;
+                lod.indices.offset = lodIndexBufferView.byteOffset;
+                lod.indices.size = lodIndexBufferView.byteLength;
+            }
+        }
     }
 
     ElementFormatFlag GltfMeshAssetAccessor::getSupportedIndexTypes() const
@@ -260,31 +278,58 @@ namespace nau
         const ElementFormatFlag supportedIndexFormats = getSupportedIndexTypes();
         NAU_ASSERT(supportedIndexFormats.has(m_meshDescription.indexFormat));
 
-        auto& binaryAccessor = m_binaryAccessors.front();
+        return copyIndices(m_binaryAccessors.front(), m_meshDescription.indexFormat, m_meshDescription.indexCount, outputBuffer, outputBufferSize, outputIndexFormat);
+    }
+
+    eastl::vector<MeshLodDescription> GltfMeshAssetAccessor::getLodDescriptions() const
+    {
+        eastl::vector<MeshLodDescription> lods;
+        lods.reserve(m_lods.size());
+        for (const Lod& lod : m_lods)
+        {
+            lods.push_back(lod.description);
+        }
 
-        auto stream = binaryAccessor.file->createStream(io::AccessMode::Read);
-        stream->setPosition(io::OffsetOrigin::Begin, binaryAccessor.offset);
+        return lods;
+    }
+
+    Result<> GltfMeshAssetAccessor::copyLodIndices(unsigned lodIndex, void* outputBuffer, size_t outputBufferSize, ElementFormat outputIndexFormat) const
+    {
+        if (lodIndex >= m_lods.size())
+        {
+            return NauMakeError("Invalid lod index ({})", lodIndex);
+        }
+
+        const Lod& lod = m_lods[lodIndex];
+        return copyIndices(lod.indices, lod.indexFormat, lod.description.indexCount, outputBuffer, outputBufferSize, outputIndexFormat);
+    }
+
+    Result<> GltfMeshAssetAccessor::copyIndices(const BinaryAccessor& indices, ElementFormat indexFormat, unsigned indexCount, void* outputBuffer, size_t outputBufferSize, ElementFormat outputIndexFormat)
+    {
+        auto stream = indices.file->createStream(io::AccessMode::Read);
+        stream->setPosition(io::OffsetOrigin::Begin, indices.offset);
 
         auto* reader = stream->as<io::IStreamReader*>();
         NAU_ASSERT(reader);
 
         NAU_ASSERT(outputIndexFormat == ElementFormat::Uint16); // todo: NAU-1797 Fully support 32 bit indices up to drawing stage
 
-        const size_t expectedBufferLength = formatByteSize(m_meshDescription.indexFormat) * m_meshDescription.indexCount;
+        const size_t expectedBufferLength = formatByteSize(indexFormat) * indexCount;
 
-        NAU_ASSERT(binaryAccessor.size <= expectedBufferLength);
+        NAU_ASSERT(indices.size <= expectedBufferLength);
 
-        if (m_meshDescription.indexFormat == outputIndexFormat)
+        if (indexFormat == outputIndexFormat)
         {
             io::copyFromStream(outputBuffer, outputBufferSize, *reader).ignore();
         }
-        else if (m_meshDescription.indexFormat == ElementFormat::Uint32)
+        else if (indexFormat == ElementFormat::Uint32)
         {
             std::vector<uint32_t> tmpU32;
-            tmpU32.resize(binaryAccessor.size);
+            tmpU32.resize(indices.size / sizeof(uint32_t));
 
-            io::copyFromStream(tmpU32.data(), binaryAccessor.size, *reader).ignore();
+            io::copyFromStream(tmpU32.data(), indices.size, *reader).ignore();
 
+            NAU_ASSERT(outputBufferSize >= tmpU32.size() * sizeof(uint16_t));
             uint16_t* buf = reinterpret_cast<uint16_t*>(outputBuffer);
             for (size_t i = 0; i < tmpU32.size(); ++i)
             {
@@ -28,6 +28,10 @@ namespace nau
 
         Result<> copyIndices(void* outputBuffer, size_t outputBufferSize, ElementFormat outputIndexFormat) const override;
 
+        eastl::vector<MeshLodDescription> getLodDescriptions() const override;
+
+        Result<> copyLodIndices(unsigned lodIndex, void* outputBuffer, size_t outputBufferSize, ElementFormat outputIndexFormat) const override;
+
     private:
 
         struct BinaryAccessor
@@ -39,9 +43,19 @@ namespace nau
             io::IFile::Ptr file;
         };
 
+        struct Lod
+        {
+            MeshLodDescription description;
+            ElementFormat indexFormat;
+            BinaryAccessor indices;
+        };
+
+        static Result<> copyIndices(const BinaryAccessor& indices, ElementFormat indexFormat, unsigned indexCount, void* outputBuffer, size_t outputBufferSize, ElementFormat outputIndexFormat);
+
         MeshDescription m_meshDescription;
         eastl::vector<VertAttribDescription> m_vertAttributes;
         eastl::vector<BinaryAccessor> m_binaryAccessors;
+        eastl::vector<Lod> m_lods;
     };
 
 }  // namespace nau
@@ -5,6 +5,7 @@
 #include "material_asset_container.h"
 
 #include "nau/assets/material.h"
+#include "nau/assets/native_material.h"
 #include "nau/serialization/json_utils.h"
 #include "nau/serialization/runtime_value_builder.h"
 
@@ -32,7 +33,7 @@ namespace nau
             NAU_CLASS_(nau::MaterialAssetContainer, IAssetContainer)
 
         public:
-            MaterialAssetContainer(io::IStreamReader::Ptr stream);
+            MaterialAssetContainer(io::IStreamReader::Ptr stream, bool isNativeMaterial);
 
             Result<> fillMaterial(Material& material);
 
@@ -45,10 +46,12 @@ namespace nau
             io::IStreamReader::Ptr m_stream;
             std::mutex m_mutex;
             size_t m_size;
+            bool m_isNativeMaterial;
             std::optional<Material> m_material = std::nullopt;
         };
 
-        MaterialAssetContainer::MaterialAssetContainer(io::IStreamReader::Ptr stream)
+        MaterialAssetContainer::MaterialAssetContainer(io::IStreamReader::Ptr stream, bool isNativeMaterial) :
+            m_isNativeMaterial(isNativeMaterial)
         {
             using namespace nau::io;
             m_stream = stream;
@@ -60,21 +63,29 @@ namespace nau
 
         Result<> MaterialAssetContainer::fillMaterial(Material& material)
         {
-            eastl::u8string json;
-            json.resize(m_size);
-
             lock_(m_mutex);
 
             if (!m_material.has_value())
             {
-                auto result = m_stream->read(reinterpret_cast<std::byte*>(json.data()), json.size());
+                // The material is parsed in place when the stream data is in memory (storage is used otherwise).
+                BytesBuffer storage;
+                auto result = io::readStreamView(*m_stream, m_size, storage);
                 NauCheckResult(result);
-                NAU_ASSERT(*result != 0, "Nothing was read from the file.");
-
-
-                auto mat = serialization::JsonUtils::parse<Material>(json);
-                NauCheckResult(mat);
-                m_material = *mat;
+                NAU_ASSERT(!result->empty(), "Nothing was read from the file.");
+
+                if (m_isNativeMaterial)
+                {
+                    auto mat = readNativeMaterial(*result);
+                    NauCheckResult(mat);
+                    m_material = *std::move(mat);
+                }
+                else
+                {
+                    const eastl::u8string_view json{reinterpret_cast<const char8_t*>(result->data()), result->size()};
+                    auto mat = serialization::JsonUtils::parse<Material>(json);
+                    NauCheckResult(mat);
+                    m_material = *mat;
+                }
             }
 
             material = m_material.value();
@@ -113,12 +124,13 @@ namespace nau
 
     eastl::vector<eastl::string_view> MaterialAssetContainerLoader::getSupportedAssetKind() const
     {
-        return {"Material/*", "nmat_json", "nmat_inst_json"};
+        return {"Material/*", "nmat_json", "nmat_inst_json", "nmat"};
     }
 
-    async::Task<IAssetContainer::Ptr> MaterialAssetContainerLoader::loadFromStream(io::IStreamReader::Ptr stream, [[maybe_unused]] AssetContentInfo)
+    async::Task<IAssetContainer::Ptr> MaterialAssetContainerLoader::loadFromStream(io::IStreamReader::Ptr stream, AssetContentInfo info)
     {
-        auto materialContainer = rtti::createInstance<MaterialAssetContainer>(std::move(stream));
+        // The cooked material (see native_material.h) is read as is, the others are the json.
+        auto materialContainer = rtti::createInstance<MaterialAssetContainer>(std::move(stream), info.kind == "nmat");
         co_return materialContainer;
     }
 
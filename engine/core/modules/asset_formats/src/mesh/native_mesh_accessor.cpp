@@ -0,0 +1,177 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "mesh/native_mesh_accessor.h"
+
+#include "mesh/native_mesh_asset_container.h"
+
+namespace nau
+{
+    namespace
+    {
+        size_t formatByteSize(ElementFormat format)
+        {
+            if (format == ElementFormat::Uint8)
+            {
+                return sizeof(uint8_t);
+            }
+            else if (format == ElementFormat::Uint16)
+            {
+                return sizeof(uint16_t);
+            }
+
+            return sizeof(uint32_t);
+        }
+
+        /**
+            The indices are stored in the runtime index format: they are converted only if the other format is requested.
+         */
+        Result<> copyIndexData(eastl::span<const std::byte> indices, ElementFormat indexFormat, void* outputBuffer, size_t outputBufferSize, ElementFormat outputIndexFormat)
+        {
+            const size_t indexCount = indices.size() / formatByteSize(indexFormat);
+            if (outputBufferSize < indexCount * formatByteSize(outputIndexFormat))
+            {
+                return NauMakeError("The index buffer is too small ({}) for ({}) indices", outputBufferSize, indexCount);
+            }
+
+            if (indexFormat == outputIndexFormat)
+            {
+                memcpy(outputBuffer, indices.data(), indices.size());
+            }
+            else if (indexFormat == ElementFormat::Uint32 && outputIndexFormat == ElementFormat::Uint16)
+            {
+                const uint32_t* const source = reinterpret_cast<const uint32_t*>(indices.data());
+                uint16_t* const output = reinterpret_cast<uint16_t*>(outputBuffer);
+                for (size_t i = 0; i < indexCount; ++i)
+                {
+                    output[i] = static_cast<uint16_t>(source[i]);
+                }
+            }
+            else if (indexFormat == ElementFormat::Uint16 && outputIndexFormat == ElementFormat::Uint32)
+            {
+                const uint16_t* const source = reinterpret_cast<const uint16_t*>(indices.data());
+                uint32_t* const output = reinterpret_cast<uint32_t*>(outputBuffer);
+                for (size_t i = 0; i < indexCount; ++i)
+                {
+                    output[i] = source[i];
+                }
+            }
+            else
+            {
+                return NauMakeError("Unsupported index format");
+            }
+
+            return ResultSuccess;
+        }
+    }  // namespace
+
+    NativeMeshAssetAccessor::NativeMeshAssetAccessor(nau::Ptr<NativeMeshAssetContainer> container) :
+        m_container(std::move(container))
+    {
+        NAU_ASSERT(m_container);
+    }
+
+    ElementFormatFlag NativeMeshAssetAccessor::getSupportedIndexTypes() const
+    {
+        return ElementFormat::Uint16 | ElementFormat::Uint32;
+    }
+
+    MeshDescription NativeMeshAssetAccessor::getDescription() const
+    {
+        return m_container->getMesh().getDescription();
+    }
+
+    eastl::vector<VertAttribDescription> NativeMeshAssetAccessor::getVertAttribDescriptions() const
+    {
+        eastl::vector<VertAttribDescription> descriptions;
+        for (const NativeMeshAttribute& attribute : m_container->getMesh().getAttributes())
+        {
+            VertAttribDescription& description = descriptions.emplace_back();
+            description.semantic = attribute.semantic;
+            description.semanticIndex = attribute.semanticIndex;
+            description.elementFormat = static_cast<ElementFormat>(attribute.elementFormat);
+            description.attributeType = static_cast<AttributeType>(attribute.attributeType);
+        }
+
+        return descriptions;
+    }
+
+    Result<> NativeMeshAssetAccessor::copyVertAttribs(eastl::span<OutputVertAttribDescription> outputLayout) const
+    {
+        const NativeMeshView& mesh = m_container->getMesh();
+
+        for (const OutputVertAttribDescription& outputDesc : outputLayout)
+        {
+            const NativeMeshAttribute* const attribute = mesh.findAttribute(eastl::string_view{outputDesc.semantic.data(), outputDesc.semantic.size()}, outputDesc.semanticIndex);
+            if (!attribute)
+            {
+                continue;
+            }
+
+            NAU_ASSERT(outputDesc.byteStride == 0);
+            NAU_ASSERT(outputDesc.attributeType == static_cast<AttributeType>(attribute->attributeType));
+
+            const eastl::span<const std::byte> data = mesh.getBlock(attribute->data);
+            const ElementFormat elementFormat = static_cast<ElementFormat>(attribute->elementFormat);
+
+            if (elementFormat == outputDesc.elementFormat)
+            {
+                NAU_ASSERT(outputDesc.outputBufferSize == data.size());
+                memcpy(outputDesc.outputBuffer, data.data(), std::min(outputDesc.outputBufferSize, data.size()));
+                continue;
+            }
+
+            // The cook writes the runtime formats: only the integer streams are widened for the other consumers.
+            if (outputDesc.elementFormat != ElementFormat::Uint32 || (elementFormat != ElementFormat::Uint8 && elementFormat != ElementFormat::Uint16))
+            {
+                return NauMakeError("Unsupported conversion of the vertex attribute ({})", outputDesc.semantic);
+            }
+
+            const size_t elementCount = data.size() / formatByteSize(elementFormat);
+            NAU_ASSERT(outputDesc.outputBufferSize == elementCount * sizeof(uint32_t));
+
+            uint32_t* const output = reinterpret_cast<uint32_t*>(outputDesc.outputBuffer);
+            for (size_t i = 0, count = std::min(elementCount, outputDesc.outputBufferSize / sizeof(uint32_t)); i < count; ++i)
+            {
+                output[i] = elementFormat == ElementFormat::Uint8 ? static_cast<uint32_t>(static_cast<uint8_t>(data[i])) :
+                                                                    static_cast<uint32_t>(reinterpret_cast<const uint16_t*>(data.data())[i]);
+            }
+        }
+
+        return ResultSuccess;
+    }
+
+    Result<> NativeMeshAssetAccessor::copyIndices(void* outputBuffer, size_t outputBufferSize, ElementFormat outputIndexFormat) const
+    {
+        const NativeMeshView& mesh = m_container->getMesh();
+        return copyIndexData(mesh.getIndices(), mesh.getDescription().indexFormat, outputBuffer, outputBufferSize, outputIndexFormat);
+    }
+
+    eastl::vector<MeshLodDescription> NativeMeshAssetAccessor::getLodDescriptions() const
+    {
+        eastl::vector<MeshLodDescription> lods;
+        for (const NativeMeshLod& lod : m_container->getMesh().getLods())
+        {
+            lods.push_back({lod.indexCount, lod.screenSize});
+        }
+
+        return lods;
+    }
+
+    Result<> NativeMeshAssetAccessor::copyLodIndices(unsigned lodIndex, void* outputBuffer, size_t outputBufferSize, ElementFormat outputIndexFormat) const
+    {
+        const NativeMeshView& mesh = m_container->getMesh();
+        if (lodIndex >= mesh.getLods().size())
+        {
+            return NauMakeError("Invalid lod index ({})", lodIndex);
+        }
+
+        return copyIndexData(mesh.getBlock(mesh.getLods()[lodIndex].indices), mesh.getDescription().indexFormat, outputBuffer, outputBufferSize, outputIndexFormat);
+    }
+
+    eastl::optional<math::BBox3> NativeMeshAssetAccessor::getBounds() const
+    {
+        return m_container->getMesh().getBounds();
+    }
+}  // namespace nau
@@ -0,0 +1,41 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include "nau/assets/mesh_asset_accessor.h"
+#include "nau/rtti/ptr.h"
+#include "nau/rtti/rtti_impl.h"
+
+namespace nau
+{
+    class NativeMeshAssetContainer;
+
+    class NativeMeshAssetAccessor final : public IMeshAssetAccessor
+    {
+        NAU_CLASS_(nau::NativeMeshAssetAccessor, IMeshAssetAccessor)
+
+    public:
+        NativeMeshAssetAccessor(nau::Ptr<NativeMeshAssetContainer> container);
+
+        ElementFormatFlag getSupportedIndexTypes() const override;
+
+        MeshDescription getDescription() const override;
+
+        eastl::vector<VertAttribDescription> getVertAttribDescriptions() const override;
+
+        Result<> copyVertAttribs(eastl::span<OutputVertAttribDescription>) const override;
+
+        Result<> copyIndices(void* outputBuffer, size_t outputBufferSize, ElementFormat outputIndexFormat) const override;
+
+        eastl::vector<MeshLodDescription> getLodDescriptions() const override;
+
+        Result<> copyLodIndices(unsigned lodIndex, void* outputBuffer, size_t outputBufferSize, ElementFormat outputIndexFormat) const override;
+
+        eastl::optional<math::BBox3> getBounds() const override;
+
+    private:
+        nau::Ptr<NativeMeshAssetContainer> m_container;
+    };
+}  // namespace nau
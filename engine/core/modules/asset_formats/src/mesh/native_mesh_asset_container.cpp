@@ -0,0 +1,72 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "mesh/native_mesh_asset_container.h"
+
+#include "mesh/native_mesh_accessor.h"
+
+namespace nau
+{
+    NativeMeshAssetContainer::NativeMeshAssetContainer(io::IStreamReader::Ptr stream, BytesBuffer storage, NativeMeshView mesh) :
+        m_stream(std::move(stream)),
+        m_storage(std::move(storage)),
+        m_mesh(std::move(mesh))
+    {
+    }
+
+    const NativeMeshView& NativeMeshAssetContainer::getMesh() const
+    {
+        return m_mesh;
+    }
+
+    nau::Ptr<> NativeMeshAssetContainer::getAsset(eastl::string_view path)
+    {
+        // The cooked mesh file holds the single mesh, it is addressed as the mesh of the gltf it replaces.
+        if (!path.empty() && path != "mesh/0")
+        {
+            return nullptr;
+        }
+
+        return rtti::createInstance<NativeMeshAssetAccessor, IAssetAccessor>(nau::Ptr{this});
+    }
+
+    eastl::vector<eastl::string> NativeMeshAssetContainer::getContent() const
+    {
+        return {};
+    }
+
+    eastl::vector<eastl::string_view> NativeMeshAssetContainerLoader::getSupportedAssetKind() const
+    {
+        return {"nmesh"};
+    }
+
+    async::Task<IAssetContainer::Ptr> NativeMeshAssetContainerLoader::loadFromStream(io::IStreamReader::Ptr stream, [[maybe_unused]] AssetContentInfo info)
+    {
+        NAU_ASSERT(stream);
+
+        const size_t size = stream->setPosition(io::OffsetOrigin::End, 0);
+        stream->setPosition(io::OffsetOrigin::Begin, 0);
+
+        // The whole mesh is read at once, or used in place when the stream is in memory (IMemoryMappedStream).
+        BytesBuffer storage;
+        const Result<eastl::span<const std::byte>> data = io::readStreamView(*stream, size, storage);
+        if (!data)
+        {
+            co_return data.getError();
+        }
+
+        Result<NativeMeshView> mesh = NativeMeshView::open(*data);
+        if (!mesh)
+        {
+            co_return mesh.getError();
+        }
+
+        co_return rtti::createInstance<NativeMeshAssetContainer>(std::move(stream), std::move(storage), *std::move(mesh));
+    }
+
+    RuntimeReadonlyDictionary::Ptr NativeMeshAssetContainerLoader::getDefaultImportSettings() const
+    {
+        return nullptr;
+    }
+}  // namespace nau
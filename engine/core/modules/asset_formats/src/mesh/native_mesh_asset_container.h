@@ -0,0 +1,54 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include "nau/assets/asset_container.h"
+#include "nau/assets/native_mesh.h"
+#include "nau/io/stream.h"
+#include "nau/memory/bytes_buffer.h"
+#include "nau/rtti/rtti_impl.h"
+
+namespace nau
+{
+    /**
+     * The cooked mesh (see NativeMeshView): the container keeps the mesh data (the mapped stream or the read copy),
+     * its accessor copies the streams into the output buffers without the conversion.
+     */
+    class NativeMeshAssetContainer final : public IAssetContainer
+    {
+        NAU_CLASS_(nau::NativeMeshAssetContainer, IAssetContainer)
+
+    public:
+        NativeMeshAssetContainer(io::IStreamReader::Ptr stream, BytesBuffer storage, NativeMeshView mesh);
+
+        const NativeMeshView& getMesh() const;
+
+    private:
+        nau::Ptr<> getAsset(eastl::string_view path) override;
+
+        eastl::vector<eastl::string> getContent() const override;
+
+        io::IStreamReader::Ptr m_stream;
+        BytesBuffer m_storage;
+        NativeMeshView m_mesh;
+    };
+
+    /**
+     */
+    class NativeMeshAssetContainerLoader final : public IAssetContainerLoader
+    {
+        NAU_INTERFACE(nau::NativeMeshAssetContainerLoader, IAssetContainerLoader)
+
+    public:
+        NativeMeshAssetContainerLoader() = default;
+
+    private:
+        eastl::vector<eastl::string_view> getSupportedAssetKind() const override;
+
+        async::Task<IAssetContainer::Ptr> loadFromStream(io::IStreamReader::Ptr stream, AssetContentInfo info) override;
+
+        RuntimeReadonlyDictionary::Ptr getDefaultImportSettings() const override;
+    };
+}  // namespace nau
@@ -4,10 +4,12 @@
 
 #include "scene_asset_container.h"
 
+#include "nau/memory/arena_allocator.h"
 #include "nau/memory/eastl_aliases.h"
 #include "nau/memory/stack_allocator.h"
 #include "nau/rtti/rtti_impl.h"
 #include "nau/rtti/weak_ptr.h"
+#include "scene_binary_serialization.h"
 #include "scene_serialization.h"
 
 namespace nau
@@ -150,16 +152,27 @@ namespace nau
 
         NAU_FATAL(stream);
 
-        const auto objectsProducer = [](ReadOnlyBuffer buffer) -> Task<ObjectsMap>
+        // mappedData: the block in the memory of the stream (that is kept alive while the tasks are awaited), storage is used otherwise.
+        const auto objectsProducer = [](eastl::span<const std::byte> mappedData, ReadOnlyBuffer storage, bool binaryContent) -> Task<ObjectsMap>
         {
             co_await Executor::getDefault();
 
-            io::IStreamReader::Ptr stream = io::createReadonlyMemoryStream(eastl::span{buffer.data(), buffer.size()});
+            const eastl::span<const std::byte> data = mappedData.empty() ? eastl::span{storage.data(), storage.size()} : mappedData;
 
             // TODO: replace by StackVector, when allocators will support proper alignment
             eastl::vector<SerializedSceneObject> objects;
-            RuntimeValue::Ptr value = *serialization::jsonParse(stream->as<io::IStreamReader&>());
-            runtimeValueApply(objects, value).ignore();
+            if (binaryContent)
+            {
+                const Result<> readResult = readBinarySceneObjects(data, objects);
+                NAU_ASSERT(readResult, "Fail to read scene objects: ({})", readResult.getError()->getMessage());
+            }
+            else
+            {
+                io::IStreamReader::Ptr stream = io::createReadonlyMemoryStream(data);
+                // The values of the block are allocated at once and released with the last of them.
+                RuntimeValue::Ptr value = *serialization::jsonParse(stream->as<io::IStreamReader&>(), eastl::make_shared<ArenaAllocator>());
+                runtimeValueApply(objects, value).ignore();
+            }
 
             ObjectsMap result;
             for (SerializedSceneObject& object : objects)
@@ -175,6 +188,8 @@ namespace nau
         SceneHeader header;
         runtimeValueApply(header, headerValue).ignore();
 
+        const bool binaryContent = eastl::string_view{header.objectsContentFormat} == SceneBinaryContentFormat;
+
         Vector<Task<ObjectsMap>> tasks;
         tasks.reserve(header.objects.size());
 
@@ -182,13 +197,20 @@ namespace nau
         {
             stream->setPosition(io::OffsetOrigin::Begin, blockInfo.offset + dataOffset);
 
-            BytesBuffer buffer{blockInfo.size};
+            // The blocks are read directly from the memory of the stream when it is available (IMemoryMappedStream).
+            BytesBuffer storage;
+            const auto blockData = io::readStreamView(*stream, blockInfo.size, storage);
+            NAU_ASSERT(blockData);
+            NAU_ASSERT(blockData->size() == blockInfo.size);
 
-            auto readResult = stream->read(buffer.data(), buffer.size());
-            NAU_ASSERT(readResult);
-            NAU_ASSERT(*readResult == buffer.size());
-
-            tasks.emplace_back(objectsProducer(buffer.toReadOnly()));
+            if (storage)
+            {
+                tasks.emplace_back(objectsProducer({}, storage.toReadOnly(), binaryContent));
+            }
+            else
+            {
+                tasks.emplace_back(objectsProducer(blockData ? *blockData : eastl::span<const std::byte>{}, {}, binaryContent));
+            }
         }
 
         co_await whenAll(tasks);
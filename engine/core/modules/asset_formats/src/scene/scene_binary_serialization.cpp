@@ -0,0 +1,277 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#include "scene_binary_serialization.h"
+
+#include "nau/serialization/json.h"
+
+namespace nau
+{
+    namespace
+    {
+        constexpr uint32_t SceneBlockMagic = 0x42435353;  // "SSCB"
+        constexpr uint32_t SceneBlockVersion = 1;
+
+        /**
+         * Tags of the self-described property values, they mirror the JSON value types
+         * so the properties are restored exactly as the JSON scene format restores them.
+         */
+        enum class PropertyTag : uint8_t
+        {
+            Null,
+            Boolean,
+            Int,
+            UInt,
+            Real,
+            String,
+            Array,
+            Object,
+            NoProperties = 0xFF
+        };
+    }  // namespace
+
+    void SceneBinaryWriter::writeBytes(const void* data, size_t size)
+    {
+        const std::byte* const bytes = reinterpret_cast<const std::byte*>(data);
+        m_buffer.insert(m_buffer.end(), bytes, bytes + size);
+    }
+
+    void SceneBinaryWriter::writeString(std::string_view str)
+    {
+        write(static_cast<uint32_t>(str.size()));
+        writeBytes(str.data(), str.size());
+    }
+
+    void SceneBinaryWriter::writeProperties(const RuntimeValue::Ptr& properties)
+    {
+        if (!properties)
+        {
+            write(PropertyTag::NoProperties);
+            return;
+        }
+
+        const auto writeJsonValue = [this](const Json::Value& value, auto& self) -> void
+        {
+            switch (value.type())
+            {
+                case Json::booleanValue:
+                    write(PropertyTag::Boolean);
+                    write(static_cast<uint8_t>(value.asBool()));
+                    break;
+                case Json::intValue:
+                    write(PropertyTag::Int);
+                    write(static_cast<int64_t>(value.asInt64()));
+                    break;
+                case Json::uintValue:
+                    write(PropertyTag::UInt);
+                    write(static_cast<uint64_t>(value.asUInt64()));
+                    break;
+                case Json::realValue:
+                    write(PropertyTag::Real);
+                    write(value.asDouble());
+                    break;
+                case Json::stringValue:
+                {
+                    write(PropertyTag::String);
+                    const char* begin = nullptr;
+                    const char* end = nullptr;
+                    value.getString(&begin, &end);
+                    writeString({begin, static_cast<size_t>(end - begin)});
+                    break;
+                }
+                case Json::arrayValue:
+                    write(PropertyTag::Array);
+                    write(static_cast<uint32_t>(value.size()));
+                    for (const Json::Value& element : value)
+                    {
+                        self(element, self);
+                    }
+                    break;
+                case Json::objectValue:
+                    write(PropertyTag::Object);
+                    write(static_cast<uint32_t>(value.size()));
+                    for (auto member = value.begin(); member != value.end(); ++member)
+                    {
+                        writeString(member.name());
+                        self(*member, self);
+                    }
+                    break;
+                default:
+                    write(PropertyTag::Null);
+                    break;
+            }
+        };
+
+        writeJsonValue(serialization::runtimeToJsonValue(properties), writeJsonValue);
+    }
+
+    bool SceneBinaryReader::readBytes(void* data, size_t size)
+    {
+        if (!m_valid || m_data.size() - m_position < size)
+        {
+            m_valid = false;
+            memset(data, 0, size);
+            return false;
+        }
+
+        memcpy(data, m_data.data() + m_position, size);
+        m_position += size;
+        return true;
+    }
+
+    uint32_t SceneBinaryReader::readSize()
+    {
+        uint32_t size = 0;
+        read(size);
+
+        // Every element takes at least one byte: a size beyond the rest of the data can only come from broken data.
+        if (size > m_data.size() - m_position)
+        {
+            m_valid = false;
+            return 0;
+        }
+
+        return size;
+    }
+
+    void SceneBinaryReader::readProperties(RuntimeValue::Ptr& properties)
+    {
+        PropertyTag tag = PropertyTag::NoProperties;
+        read(tag);
+        if (tag == PropertyTag::NoProperties)
+        {
+            properties = nullptr;
+            return;
+        }
+
+        const auto readJsonValue = [this](PropertyTag tag, Json::Value& value, auto& self) -> void
+        {
+            switch (tag)
+            {
+                case PropertyTag::Boolean:
+                {
+                    uint8_t boolValue = 0;
+                    read(boolValue);
+                    value = boolValue != 0;
+                    break;
+                }
+                case PropertyTag::Int:
+                {
+                    int64_t intValue = 0;
+                    read(intValue);
+                    value = Json::Int64{intValue};
+                    break;
+                }
+                case PropertyTag::UInt:
+                {
+                    uint64_t uintValue = 0;
+                    read(uintValue);
+                    value = Json::UInt64{uintValue};
+                    break;
+                }
+                case PropertyTag::Real:
+                {
+                    double realValue = 0;
+                    read(realValue);
+                    value = realValue;
+                    break;
+                }
+                case PropertyTag::String:
+                {
+                    const uint32_t size = readSize();
+                    const char* const begin = reinterpret_cast<const char*>(m_data.data() + m_position);
+                    if (m_valid)
+                    {
+                        value = Json::Value{begin, begin + size};
+                        m_position += size;
+                    }
+                    break;
+                }
+                case PropertyTag::Array:
+                {
+                    const uint32_t size = readSize();
+                    value = Json::Value{Json::arrayValue};
+                    value.resize(size);
+                    for (Json::ArrayIndex i = 0; i < size && m_valid; ++i)
+                    {
+                        PropertyTag elementTag = PropertyTag::Null;
+                        read(elementTag);
+                        self(elementTag, value[i], self);
+                    }
+                    break;
+                }
+                case PropertyTag::Object:
+                {
+                    const uint32_t size = readSize();
+                    value = Json::Value{Json::objectValue};
+                    std::string key;
+                    for (uint32_t i = 0; i < size && m_valid; ++i)
+                    {
+                        readString(key);
+                        PropertyTag memberTag = PropertyTag::Null;
+                        read(memberTag);
+                        self(memberTag, value[key], self);
+                    }
+                    break;
+                }
+                case PropertyTag::Null:
+                    value = Json::Value{};
+                    break;
+                default:
+                    m_valid = false;
+                    break;
+            }
+        };
+
+        Json::Value jsonProperties;
+        readJsonValue(tag, jsonProperties, readJsonValue);
+        properties = m_valid ? serialization::jsonToRuntimeValue(std::move(jsonProperties)) : nullptr;
+    }
+
+    void writeBinarySceneObjects(SceneBinaryWriter& writer, eastl::span<const SerializedSceneObject* const> objects)
+    {
+        writer.write(SceneBlockMagic);
+        writer.write(SceneBlockVersion);
+        writer.write(static_cast<uint32_t>(objects.size()));
+
+        for (const SerializedSceneObject* const object : objects)
+        {
+            writer.write(*object);
+        }
+    }
+
+    Result<> readBinarySceneObjects(eastl::span<const std::byte> data, eastl::vector<SerializedSceneObject>& objects)
+    {
+        SceneBinaryReader reader{data};
+
+        uint32_t magic = 0;
+        uint32_t version = 0;
+        reader.read(magic);
+        reader.read(version);
+        if (magic != SceneBlockMagic || version != SceneBlockVersion)
+        {
+            return NauMakeError("Invalid cooked scene block (version:{})", version);
+        }
+
+        uint32_t count = 0;
+        reader.read(count);
+        if (count > data.size())
+        {
+            return NauMakeError("Invalid cooked scene block objects count:({})", count);
+        }
+
+        objects.resize(count);
+        for (SerializedSceneObject& object : objects)
+        {
+            reader.read(object);
+        }
+
+        if (!reader.isValid())
+        {
+            objects.clear();
+            return NauMakeError("Cooked scene block is truncated");
+        }
+
+        return ResultSuccess;
+    }
+}  // namespace nau
@@ -0,0 +1,243 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <EASTL/optional.h>
+#include <EASTL/span.h>
+#include <EASTL/string.h>
+#include <EASTL/vector.h>
+
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "nau/math/transform.h"
+#include "nau/meta/class_info.h"
+#include "nau/serialization/runtime_value.h"
+#include "nau/utils/type_utility.h"
+#include "nau/utils/uid.h"
+#include "scene_serialization.h"
+
+namespace nau
+{
+    /**
+     * Content format of the cooked scene objects blocks (see SceneHeader::objectsContentFormat).
+     *
+     * The objects are laid out in the order of their NAU_CLASS_FIELDS without keys, so they are read straight into
+     * SerializedSceneObject without building a RuntimeValue tree. Only the component properties (whose layout is
+     * known to the component class only) are stored as self-described blocks.
+     */
+    inline constexpr eastl::string_view SceneBinaryContentFormat = "application/nau-scene-binary";
+
+    /**
+     * Writes the scene structures into the cooked binary layout.
+     */
+    class SceneBinaryWriter
+    {
+    public:
+        template <typename T>
+        void write(const T& value);
+
+        const eastl::vector<std::byte>& getBuffer() const
+        {
+            return m_buffer;
+        }
+
+        void clear()
+        {
+            m_buffer.clear();
+        }
+
+    private:
+        void writeBytes(const void* data, size_t size);
+
+        void writeString(std::string_view str);
+
+        void writeProperties(const RuntimeValue::Ptr& properties);
+
+        eastl::vector<std::byte> m_buffer;
+    };
+
+    /**
+     * Reads the scene structures from the memory of the cooked binary layout (i.e. a memory-mapped file).
+     */
+    class SceneBinaryReader
+    {
+    public:
+        SceneBinaryReader(eastl::span<const std::byte> data) :
+            m_data(data)
+        {
+        }
+
+        template <typename T>
+        void read(T& value);
+
+        /**
+         * @return false if the data ended before all the values were read.
+         */
+        bool isValid() const
+        {
+            return m_valid;
+        }
+
+    private:
+        bool readBytes(void* data, size_t size);
+
+        uint32_t readSize();
+
+        template <typename S>
+        void readString(S& str);
+
+        void readProperties(RuntimeValue::Ptr& properties);
+
+        eastl::span<const std::byte> m_data;
+        size_t m_position = 0;
+        bool m_valid = true;
+    };
+
+    /**
+     * Writes a block of objects with SceneBinaryContentFormat.
+     */
+    void writeBinarySceneObjects(SceneBinaryWriter& writer, eastl::span<const SerializedSceneObject* const> objects);
+
+    /**
+     * Reads a block of objects written by writeBinarySceneObjects.
+     */
+    Result<> readBinarySceneObjects(eastl::span<const std::byte> data, eastl::vector<SerializedSceneObject>& objects);
+
+    template <typename T>
+    void SceneBinaryWriter::write(const T& value)
+    {
+        if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>)
+        {
+            writeBytes(&value, sizeof(T));
+        }
+        else if constexpr (std::is_same_v<T, Uid>)
+        {
+            static_assert(std::is_trivially_copyable_v<Uid>);
+            writeBytes(&value, sizeof(Uid));
+        }
+        else if constexpr (std::is_same_v<T, eastl::string> || std::is_same_v<T, std::string>)
+        {
+            writeString({value.data(), value.size()});
+        }
+        else if constexpr (std::is_same_v<T, math::Transform>)
+        {
+            const math::Vector3& translation = value.getTranslation();
+            const math::Quat& rotation = value.getRotation();
+            const math::Vector3& scale = value.getScale();
+            const float data[] = {
+                static_cast<float>(translation.getX()), static_cast<float>(translation.getY()), static_cast<float>(translation.getZ()),
+                static_cast<float>(rotation.getX()), static_cast<float>(rotation.getY()), static_cast<float>(rotation.getZ()), static_cast<float>(rotation.getW()),
+                static_cast<float>(scale.getX()), static_cast<float>(scale.getY()), static_cast<float>(scale.getZ())};
+
+            writeBytes(data, sizeof(data));
+        }
+        else if constexpr (std::is_same_v<T, RuntimeValue::Ptr>)
+        {
+            writeProperties(value);
+        }
+        else if constexpr (IsTemplateOf<eastl::optional, T>)
+        {
+            write(static_cast<uint8_t>(value.has_value()));
+            if (value)
+            {
+                write(*value);
+            }
+        }
+        else if constexpr (IsTemplateOf<eastl::vector, T> || IsTemplateOf<std::vector, T>)
+        {
+            write(static_cast<uint32_t>(value.size()));
+            for (const auto& element : value)
+            {
+                write(element);
+            }
+        }
+        else
+        {
+            static_assert(meta::ClassHasFields<T>, "Type is not supported by the binary scene format");
+
+            std::apply([&](const auto&... field)
+            {
+                (write(field.getValue(value)), ...);
+            }, meta::getClassAllFields<T>());
+        }
+    }
+
+    template <typename T>
+    void SceneBinaryReader::read(T& value)
+    {
+        if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>)
+        {
+            readBytes(&value, sizeof(T));
+        }
+        else if constexpr (std::is_same_v<T, Uid>)
+        {
+            readBytes(&value, sizeof(Uid));
+        }
+        else if constexpr (std::is_same_v<T, eastl::string> || std::is_same_v<T, std::string>)
+        {
+            readString(value);
+        }
+        else if constexpr (std::is_same_v<T, math::Transform>)
+        {
+            float data[10];
+            if (readBytes(data, sizeof(data)))
+            {
+                value = math::Transform{
+                    math::Quat{data[3], data[4], data[5], data[6]},
+                    math::Vector3{data[0], data[1], data[2]},
+                    math::Vector3{data[7], data[8], data[9]}};
+            }
+        }
+        else if constexpr (std::is_same_v<T, RuntimeValue::Ptr>)
+        {
+            readProperties(value);
+        }
+        else if constexpr (IsTemplateOf<eastl::optional, T>)
+        {
+            uint8_t hasValue = 0;
+            read(hasValue);
+            if (hasValue != 0)
+            {
+                read(value.emplace());
+            }
+            else
+            {
+                value.reset();
+            }
+        }
+        else if constexpr (IsTemplateOf<eastl::vector, T> || IsTemplateOf<std::vector, T>)
+        {
+            const uint32_t size = readSize();
+            value.clear();
+            value.resize(size);
+            for (auto& element : value)
+            {
+                read(element);
+            }
+        }
+        else
+        {
+            static_assert(meta::ClassHasFields<T>, "Type is not supported by the binary scene format");
+
+            std::apply([&](const auto&... field)
+            {
+                (read(field.getValue(value)), ...);
+            }, meta::getClassAllFields<T>());
+        }
+    }
+
+    template <typename S>
+    void SceneBinaryReader::readString(S& str)
+    {
+        const uint32_t size = readSize();
+        str.resize(size);
+        if (size > 0)
+        {
+            readBytes(str.data(), size);
+        }
+    }
+}  // namespace nau
@@ -8,6 +8,8 @@
 #include "nau/io/memory_stream.h"
 #include "nau/io/nau_container.h"
 #include "nau/serialization/json.h"
+#include "nau/service/service_provider.h"
+#include "scene_binary_serialization.h"
 #include "scene_serialization.h"
 
 namespace nau
@@ -87,6 +89,9 @@ namespace nau
 
         const bool prettyWrite = true;
 
+        // JSON stays the authoring format, the asset tools enable the cooked binary format for the runtime content.
+        const bool cookedFormat = getServiceProvider().get<GlobalProperties>().getValue<bool>("/assets/scene/cookedFormat").value_or(false);
+
         NAU_FATAL(asset);
 
         const SceneAsset& sceneAsset = asset->as<SceneAsset&>();
@@ -100,6 +105,10 @@ namespace nau
         header.name = sceneInfo.name;
         header.version = "1.0.0";
         header.referencesInfo = sceneAsset.getReferencesInfo();
+        if (cookedFormat)
+        {
+            header.objectsContentFormat = eastl::string{SceneBinaryContentFormat};
+        }
 
         // Objects inside the container are organized into batches for greater convenience in organizing parallel loading.
         // The number of batches (as well as their size) is choose based on the potential number of simultaneously running workers.
@@ -112,11 +121,23 @@ namespace nau
         size_t offset = contentStream->getPosition();
 
         Json::Value objects{Json::arrayValue};
+        Vector<const SerializedSceneObject*> binaryObjects;
+        SceneBinaryWriter binaryWriter;
 
         const auto writeObjectsToStream = [&]() -> size_t
         {
-            serialization::jsonWrite(*contentStream, objects, serialization::JsonSettings{.pretty = prettyWrite}).ignore();
-            objects.clear();
+            if (cookedFormat)
+            {
+                binaryWriter.clear();
+                writeBinarySceneObjects(binaryWriter, {binaryObjects.data(), binaryObjects.size()});
+                contentStream->write(binaryWriter.getBuffer().data(), binaryWriter.getBuffer().size()).ignore();
+                binaryObjects.clear();
+            }
+            else
+            {
+                serialization::jsonWrite(*contentStream, objects, serialization::JsonSettings{.pretty = prettyWrite}).ignore();
+                objects.clear();
+            }
 
             const size_t currentOffset = contentStream->getPosition();
             header.objects.emplace_back(ObjectsBlockInfo{.offset = offset, .size = currentOffset - offset});
@@ -125,8 +146,15 @@ namespace nau
 
         for (auto& [uid, object] : visitor.getAllObjects())
         {
-            const Json::ArrayIndex arrayIndex = static_cast<Json::ArrayIndex>(objects.size());
-            serialization::runtimeApplyToJsonValue(objects[arrayIndex], makeValueRef(object)).ignore();
+            if (cookedFormat)
+            {
+                binaryObjects.push_back(&object);
+            }
+            else
+            {
+                const Json::ArrayIndex arrayIndex = static_cast<Json::ArrayIndex>(objects.size());
+                serialization::runtimeApplyToJsonValue(objects[arrayIndex], makeValueRef(object)).ignore();
+            }
 
             if (object.parentLocalId == 0)
             {
@@ -140,7 +168,7 @@ namespace nau
             }
         }
 
-        if (objects.size() > 0)
+        if (objects.size() > 0 || !binaryObjects.empty())
         {
             [[maybe_unused]] const size_t offset = writeObjectsToStream();
         }
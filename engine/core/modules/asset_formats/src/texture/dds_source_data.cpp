@@ -6,6 +6,7 @@
 #include "./texture_utils.h"
 #include "nau/diag/logging.h"
 #include "nau/service/service_provider.h"
+#include "nau/utils/performance_profiling.h"
 #include "texture_asset_container.h"
 
 // Nothings
@@ -83,6 +84,7 @@ namespace nau
 
     Result<DDSSourceData> DDSSourceData::loadFromStream(io::IStreamReader::Ptr stream)
     {
+        NAU_CPU_SCOPED_TAG(nau::PerfTag::Assets);
         return DDSSourceData{stream};
     }
 
@@ -4,16 +4,44 @@
 
 #include "texture_asset_container.h"
 
+#include "nau/app/global_properties.h"
+#include "nau/assets/derived_data_cache.h"
 #include "nau/service/service_provider.h"
 #include "nau/string/string_conv.h"
 
 namespace nau
 {
+    namespace
+    {
+        /**
+            The strict cooked mode: only the cooked dds textures are loaded, the source images are rejected.
+         */
+        bool isCookedTexturesOnly()
+        {
+            static const bool isEnabled = []
+            {
+                if (!getServiceProvider().has<GlobalProperties>())
+                {
+                    return false;
+                }
+
+                return getServiceProvider().get<GlobalProperties>().getValue<bool>("/assets/cookedTexturesOnly").value_or(false);
+            }();
+
+            return isEnabled;
+        }
+    }  // namespace
+
     TextureAssetContainer::TextureAssetContainer(TextureSourceData textureData) :
         m_textureData(std::move(textureData))
     {
     }
 
+    TextureAssetContainer::TextureAssetContainer(TextureDerivedData derivedData) :
+        m_derivedData(std::move(derivedData))
+    {
+    }
+
     nau::Ptr<> TextureAssetContainer::getAsset([[maybe_unused]] eastl::string_view path)
     {
         return rtti::staticCast<IRefCounted*>(this);
@@ -32,6 +60,17 @@ namespace nau
     TextureDescription TextureAssetContainer::getDescription() const
     {
         TextureDescription texDescription;
+        if (m_derivedData)
+        {
+            texDescription.width = m_derivedData->getWidth();
+            texDescription.height = m_derivedData->getHeight();
+            texDescription.numMipmaps = m_derivedData->getNumMipmaps();
+            texDescription.format = m_derivedData->getFormat();
+            texDescription.isCompressed = m_derivedData->isCompressed();
+
+            return texDescription;
+        }
+
         texDescription.width = m_textureData.getWidth();
         texDescription.height = m_textureData.getHeight();
         texDescription.numMipmaps = m_textureData.getNumMipmaps();
@@ -44,12 +83,24 @@ namespace nau
     void TextureAssetContainer::copyTextureData(size_t mipLevelStart, size_t mipLevelsCount, eastl::span<DestTextureData> destination)
     {
         NAU_ASSERT(destination.size() == mipLevelsCount);
+        if (m_derivedData)
+        {
+            m_derivedData->copyTextureData(mipLevelStart, mipLevelsCount, destination);
+            return;
+        }
+
         m_textureData.copyTextureData(mipLevelStart, mipLevelsCount, destination);
     }
 
     async::Task<IAssetContainer::Ptr> TextureAssetContainerLoader::loadFromStream(io::IStreamReader::Ptr stream, AssetContentInfo info)
     {
         NAU_ASSERT(stream);
+
+        if (isCookedTexturesOnly())
+        {
+            co_return NauMakeError("The texture ({}) is not cooked: only the dds textures are loaded in the cooked textures mode", info.path.getString());
+        }
+
         ASYNC_SWITCH_EXECUTOR(async::Executor::getDefault())
 
         TinyImageFormat forceFormat = TinyImageFormat_UNDEFINED;
@@ -57,13 +108,62 @@ namespace nau
         {
             forceFormat = TinyImageFormat_R32G32B32A32_SFLOAT;
         }
-        auto textureData = TextureSourceData::loadFromStream(stream, info.importSettings ? info.importSettings->as<RuntimeReadonlyDictionary *>() : getDefaultImportSettings(), forceFormat);
-        if(!textureData)
+        RuntimeReadonlyDictionary::Ptr importSettings = info.importSettings ? info.importSettings : getDefaultImportSettings();
+
+        IDerivedDataCache* const derivedDataCache = getServiceProvider().has<IDerivedDataCache>() ? &getServiceProvider().get<IDerivedDataCache>() : nullptr;
+        if (!derivedDataCache)
+        {
+            addTextureDecodeFallback();
+            NAU_LOG_WARNING("The texture ({}) is decoded on load, it should be cooked to dds", info.path.getString());
+
+            auto textureData = TextureSourceData::loadFromStream(stream, importSettings, forceFormat);
+            if (!textureData)
+            {
+                co_return textureData.getError();
+            }
+
+            co_return rtti::createInstance<TextureAssetContainer>(std::move(*textureData));
+        }
+
+        // The texture is keyed by its content (and everything else that affects the result),
+        // so the changed texture never gets the data derived from its previous version.
+        eastl::vector<std::byte> content(stream->setPosition(io::OffsetOrigin::End, 0));
+        stream->setPosition(io::OffsetOrigin::Begin, 0);
+        if (Result<size_t> readResult = io::copyFromStream(content.data(), content.size(), *stream); !readResult)
+        {
+            co_return readResult.getError();
+        }
+
+        ImportSettings settings;
+        if (importSettings)
+        {
+            runtimeValueApply(settings, importSettings).ignore();
+        }
+
+        DerivedDataKey key{"texture", TextureDerivedData::DerivationVersion};
+        key.add(content).add(settings.generateMipmaps).add(settings.isCompressed).add(forceFormat);
+
+        if (eastl::optional<eastl::vector<std::byte>> cachedData = derivedDataCache->find(key))
+        {
+            if (Result<TextureDerivedData> derivedData = TextureDerivedData::fromCachedData(*std::move(cachedData)))
+            {
+                co_return rtti::createInstance<TextureAssetContainer>(std::move(*derivedData));
+            }
+        }
+
+        addTextureDecodeFallback();
+        NAU_LOG_WARNING("The texture ({}) is decoded on load, it should be cooked to dds", info.path.getString());
+
+        auto textureData = TextureSourceData::loadFromStream(stream, importSettings, forceFormat);
+        if (!textureData)
         {
             co_return textureData.getError();
         }
 
-        co_return rtti::createInstance<TextureAssetContainer>(std::move(*textureData));
+        TextureDerivedData derivedData = TextureDerivedData::fromSourceData(*textureData);
+        derivedDataCache->store(key, derivedData.getCachedData());
+
+        co_return rtti::createInstance<TextureAssetContainer>(std::move(derivedData));
     }
 
     RuntimeReadonlyDictionary::Ptr TextureAssetContainerLoader::getDefaultImportSettings() const
@@ -8,6 +8,8 @@
 #include "nau/io/stream.h"
 #include "nau/meta/class_info.h"
 #include "nau/rtti/rtti_impl.h"
+#include "texture_compressor.h"
+#include "texture_derived_data.h"
 #include "texture_source_data.h"
 
 namespace nau
@@ -18,11 +20,13 @@ namespace nau
     {
         bool generateMipmaps = true;
         bool isCompressed = true;
+        TextureCompressionProfile compressionProfile = TextureCompressionProfile::Fast;
 
 #pragma region Class Info
         NAU_CLASS_FIELDS(
             CLASS_FIELD(generateMipmaps),
-            CLASS_FIELD(isCompressed))
+            CLASS_FIELD(isCompressed),
+            CLASS_FIELD(compressionProfile))
 #pragma endregion
     };
 
@@ -35,6 +39,7 @@ namespace nau
 
     public:
         TextureAssetContainer(TextureSourceData textureData);
+        TextureAssetContainer(TextureDerivedData derivedData);
 
     private:
         TextureDescription getDescription() const override;
@@ -46,6 +51,7 @@ namespace nau
         eastl::vector<eastl::string> getContent() const override;
 
         TextureSourceData m_textureData;
+        eastl::optional<TextureDerivedData> m_derivedData;
     };
 
     /**
@@ -9,9 +9,15 @@
 #define STBI_REALLOC(p, newsz) realloc(p, newsz)
 #define STBI_FREE(p) free(p)
 
+#include <optional>
+
 // ISPC texcomp
 #include "ispc_texcomp.h"
+#include "nau/app/background_work_service.h"
+#include "nau/async/parallel_for.h"
 #include "nau/diag/assertion.h"
+#include "nau/service/service_provider.h"
+#include "tinyimageformat.h"
 
 namespace nau
 {
@@ -93,46 +99,13 @@ namespace nau
         }
     }  // namespace
 
-    unsigned char* ASTCCompression(unsigned char* data, TinyImageFormat format, unsigned width, unsigned height)
+    namespace
     {
-        NAU_ASSERT(data);
-        NAU_ASSERT(width && height);  // widht/height cannot be 0
-
-        const uint32_t blockSizeX = 4;
-        const uint32_t blockSizeY = 4;
-        const uint32_t channels = TinyImageFormat_ChannelCount(format);
-        NAU_ASSERT(channels >= 3);  // ISPC astc compression requires atleast 3 channels
-
-        if (TinyImageFormat_BitSizeOfBlock(format) != 32)
-        {
-            NAU_ASSERT("Fast ISPC Texture Compressor only supports 32bits per pixel for ASTC");
-            return nullptr;
-        }
-
-        // Get astc encoder settings
-        astc_enc_settings astcEncSettings = {};
-        if (channels > 3)
-        {
-            GetProfile_astc_alpha_fast(&astcEncSettings, blockSizeX, blockSizeY);
-        }
-        else
-        {
-            GetProfile_astc_fast(&astcEncSettings, blockSizeX, blockSizeY);
-        }
-
-        rgba_surface input;
-        input.width = width;
-        input.height = height;
-        input.stride = width * channels;
-        input.ptr = data;
-        unsigned char* result = (unsigned char*)STBI_MALLOC(width * height * channels);
-        CompressBlocksASTC(&input, result, &astcEncSettings);
-
-        NAU_ASSERT(result);
-        return result;
-    }
+        // The pixel rows of the stripe must be a multiple of the block height (4 for all the supported formats)
+        constexpr unsigned BlockSize = 4;
+        constexpr unsigned StripeBlockRows = 16;
 
-    typedef void (*BCCompressionFunc)(const rgba_surface* src, uint8_t* dst);
+        typedef void (*BCCompressionFunc)(const rgba_surface* src, uint8_t* dst);
 
 #define DECLARE_COMPRESS_FUNCTION_BC6H(profile)                              \
     void CompressBlocksBC6H_##profile(const rgba_surface* src, uint8_t* dst) \
@@ -142,11 +115,11 @@ namespace nau
         CompressBlocksBC6H(src, dst, &settings);                             \
     }
 
-    DECLARE_COMPRESS_FUNCTION_BC6H(veryfast);
-    DECLARE_COMPRESS_FUNCTION_BC6H(fast);
-    DECLARE_COMPRESS_FUNCTION_BC6H(basic);
-    DECLARE_COMPRESS_FUNCTION_BC6H(slow);
-    DECLARE_COMPRESS_FUNCTION_BC6H(veryslow);
+        DECLARE_COMPRESS_FUNCTION_BC6H(veryfast);
+        DECLARE_COMPRESS_FUNCTION_BC6H(fast);
+        DECLARE_COMPRESS_FUNCTION_BC6H(basic);
+        DECLARE_COMPRESS_FUNCTION_BC6H(slow);
+        DECLARE_COMPRESS_FUNCTION_BC6H(veryslow);
 
 #define DECLARE_COMPRESS_FUNCTION_BC7(profile)                              \
     void CompressBlocksBC7_##profile(const rgba_surface* src, uint8_t* dst) \
@@ -156,112 +129,286 @@ namespace nau
         CompressBlocksBC7(src, dst, &settings);                             \
     }
 
-    DECLARE_COMPRESS_FUNCTION_BC7(ultrafast);
-    DECLARE_COMPRESS_FUNCTION_BC7(veryfast);
-    DECLARE_COMPRESS_FUNCTION_BC7(fast);
-    DECLARE_COMPRESS_FUNCTION_BC7(basic);
-    DECLARE_COMPRESS_FUNCTION_BC7(slow);
-    DECLARE_COMPRESS_FUNCTION_BC7(alpha_ultrafast);
-    DECLARE_COMPRESS_FUNCTION_BC7(alpha_veryfast);
-    DECLARE_COMPRESS_FUNCTION_BC7(alpha_fast);
-    DECLARE_COMPRESS_FUNCTION_BC7(alpha_basic);
-    DECLARE_COMPRESS_FUNCTION_BC7(alpha_slow);
-
-    unsigned char* BCCompression(unsigned char* data, TinyImageFormat format, unsigned width, unsigned height)
-    {
-        NAU_ASSERT(data);
-        NAU_ASSERT(width && height);  // width/height cannot be 0
+        DECLARE_COMPRESS_FUNCTION_BC7(ultrafast);
+        DECLARE_COMPRESS_FUNCTION_BC7(veryfast);
+        DECLARE_COMPRESS_FUNCTION_BC7(fast);
+        DECLARE_COMPRESS_FUNCTION_BC7(basic);
+        DECLARE_COMPRESS_FUNCTION_BC7(slow);
+        DECLARE_COMPRESS_FUNCTION_BC7(alpha_ultrafast);
+        DECLARE_COMPRESS_FUNCTION_BC7(alpha_veryfast);
+        DECLARE_COMPRESS_FUNCTION_BC7(alpha_fast);
+        DECLARE_COMPRESS_FUNCTION_BC7(alpha_basic);
+        DECLARE_COMPRESS_FUNCTION_BC7(alpha_slow);
+
+        BCCompressionFunc getBC6HCompressionFunc(TextureCompressionProfile profile)
+        {
+            switch (profile)
+            {
+                case TextureCompressionProfile::VeryFast:
+                    return CompressBlocksBC6H_veryfast;
+                case TextureCompressionProfile::Basic:
+                    return CompressBlocksBC6H_basic;
+                case TextureCompressionProfile::Slow:
+                    return CompressBlocksBC6H_slow;
+                default:
+                    return CompressBlocksBC6H_fast;
+            }
+        }
 
-        const uint32_t blockSize = 4;
-        BCCompressionFunc bcCompress = CompressBlocksBC7_alpha_fast;
-        uint32_t bytesPerBlock = 16;
+        BCCompressionFunc getBC7CompressionFunc(TextureCompressionProfile profile, bool hasAlpha)
+        {
+            switch (profile)
+            {
+                case TextureCompressionProfile::VeryFast:
+                    return hasAlpha ? CompressBlocksBC7_alpha_veryfast : CompressBlocksBC7_veryfast;
+                case TextureCompressionProfile::Basic:
+                    return hasAlpha ? CompressBlocksBC7_alpha_basic : CompressBlocksBC7_basic;
+                case TextureCompressionProfile::Slow:
+                    return hasAlpha ? CompressBlocksBC7_alpha_slow : CompressBlocksBC7_slow;
+                default:
+                    return hasAlpha ? CompressBlocksBC7_alpha_fast : CompressBlocksBC7_fast;
+            }
+        }
 
-        uint32_t inputChannels = TinyImageFormat_ChannelCount(format);
-        uint32_t requiredInputChannels = 4;
-        uint32_t bitsPerPixel = TinyImageFormat_BitSizeOfBlock(format);
+        /**
+         * The surface compression prepared to be split into the stripes.
+         */
+        struct SurfaceCompression
+        {
+            rgba_surface input = {};
+            uint8_t* output = nullptr;
+            uint32_t bytesPerBlock = 16;
+            BCCompressionFunc bcCompress = nullptr;
+            std::optional<astc_enc_settings> astcSettings;
 
-        //-LDR input is 32 bit / pixel(sRGB), HDR is 64 bit / pixel(half float)
-        //	- for BC4 input is 8bit / pixel(R8), for BC5 input is 16bit / pixel(RG8)
-        //	- dst buffer must be allocated with enough space for the compressed texture
+            unsigned getStripesCount() const
+            {
+                const unsigned stripeRows = StripeBlockRows * BlockSize;
+                return std::max((static_cast<unsigned>(input.height) + stripeRows - 1) / stripeRows, 1u);
+            }
 
-        switch (getDXTCompression(format))
+            void compressStripe(unsigned stripeIndex) const
+            {
+                const unsigned firstRow = stripeIndex * StripeBlockRows * BlockSize;
+                const unsigned rowsCount = std::min(StripeBlockRows * BlockSize, static_cast<unsigned>(input.height) - std::min(firstRow, static_cast<unsigned>(input.height)));
+
+                // ispc_texcomp writes the blocks row by row, (width / block size) blocks per row:
+                // the stripe output is the same part of the buffer as it would be for the whole surface compression
+                rgba_surface stripe = input;
+                stripe.ptr = input.ptr + static_cast<size_t>(firstRow) * input.stride;
+                stripe.height = static_cast<int32_t>(rowsCount);
+
+                const size_t blocksPerRow = static_cast<size_t>(input.width) / BlockSize;
+                uint8_t* const stripeOutput = output + (firstRow / BlockSize) * blocksPerRow * bytesPerBlock;
+
+                if (astcSettings)
+                {
+                    CompressBlocksASTC(&stripe, stripeOutput, const_cast<astc_enc_settings*>(&*astcSettings));
+                }
+                else
+                {
+                    bcCompress(&stripe, stripeOutput);
+                }
+            }
+        };
+
+        std::optional<SurfaceCompression> prepareASTCCompression(unsigned char* data, TinyImageFormat format, unsigned width, unsigned height, TextureCompressionProfile profile)
         {
-            case DXT_BC1:
-                bcCompress = CompressBlocksBC1;
-                bytesPerBlock = 8;
-                requiredInputChannels = 3;
-                break;
-            case DXT_BC3:
-                bcCompress = CompressBlocksBC3;
-                break;
-            case DXT_BC4:
-                bcCompress = CompressBlocksBC4;
-                bytesPerBlock = 8;
-                requiredInputChannels = 1;
-                break;
-            case DXT_BC5:
-                bcCompress = CompressBlocksBC5;
-                requiredInputChannels = 2;
-                break;
-            case DXT_BC6:
-                bcCompress = CompressBlocksBC6H_fast;
-                requiredInputChannels = 4;
-                if (bitsPerPixel != 64 || !TinyImageFormat_IsFloat(format))
+            NAU_ASSERT(data);
+            NAU_ASSERT(width && height);  // widht/height cannot be 0
+
+            const uint32_t blockSizeX = BlockSize;
+            const uint32_t blockSizeY = BlockSize;
+            const uint32_t channels = TinyImageFormat_ChannelCount(format);
+            NAU_ASSERT(channels >= 3);  // ISPC astc compression requires atleast 3 channels
+
+            if (TinyImageFormat_BitSizeOfBlock(format) != 32)
+            {
+                NAU_ASSERT("Fast ISPC Texture Compressor only supports 32bits per pixel for ASTC");
+                return std::nullopt;
+            }
+
+            // Get astc encoder settings
+            astc_enc_settings astcEncSettings = {};
+            if (channels > 3)
+            {
+                if (profile == TextureCompressionProfile::Slow)
                 {
-                    NAU_ASSERT("Unsupported format for BC6 compression");
-                    return nullptr;
+                    GetProfile_astc_alpha_slow(&astcEncSettings, blockSizeX, blockSizeY);
                 }
-                break;
-            case DXT_BC7:
-                bcCompress = inputChannels > 3 ? CompressBlocksBC7_alpha_fast : CompressBlocksBC7_fast;
-                break;
-            default:
-                NAU_ASSERT(false && "Unknown BC compression request");
-        }
-        NAU_ASSERT(requiredInputChannels <= inputChannels && "Input should always have more data available");
+                else
+                {
+                    GetProfile_astc_alpha_fast(&astcEncSettings, blockSizeX, blockSizeY);
+                }
+            }
+            else
+            {
+                GetProfile_astc_fast(&astcEncSettings, blockSizeX, blockSizeY);
+            }
 
-        rgba_surface input;
-        input.ptr = data;
-        input.stride = width * requiredInputChannels;
-        input.width = width;
-        input.height = height;
+            SurfaceCompression compression;
+            compression.input.width = width;
+            compression.input.height = height;
+            compression.input.stride = width * channels;
+            compression.input.ptr = data;
+            compression.astcSettings = astcEncSettings;
+            compression.output = (uint8_t*)STBI_MALLOC(width * height * channels);
+            NAU_FATAL(compression.output);
 
-        uint8_t* const resultStorage = EXPR_Block
+            return compression;
+        }
+
+        std::optional<SurfaceCompression> prepareBCCompression(unsigned char* data, TinyImageFormat format, unsigned width, unsigned height, TextureCompressionProfile profile)
         {
-            const unsigned nbw = std::max<unsigned>(1u, (unsigned(width) + 3u) / 4u);
-            const unsigned nbh = std::max<unsigned>(1u, (unsigned(height) + 3u) / 4u);
-            const unsigned rowPitch = nbw * bytesPerBlock;
-            const unsigned slicePitch = rowPitch * nbh;
+            NAU_ASSERT(data);
+            NAU_ASSERT(width && height);  // width/height cannot be 0
 
-            return reinterpret_cast<uint8_t*>(STBI_MALLOC(slicePitch));
-        };
-        NAU_FATAL(resultStorage);
+            SurfaceCompression compression;
+            compression.bcCompress = CompressBlocksBC7_alpha_fast;
 
-        bcCompress(&input, resultStorage);
-        return resultStorage;
-    }
+            uint32_t inputChannels = TinyImageFormat_ChannelCount(format);
+            uint32_t requiredInputChannels = 4;
+            uint32_t bitsPerPixel = TinyImageFormat_BitSizeOfBlock(format);
+
+            //-LDR input is 32 bit / pixel(sRGB), HDR is 64 bit / pixel(half float)
+            //	- for BC4 input is 8bit / pixel(R8), for BC5 input is 16bit / pixel(RG8)
+            //	- dst buffer must be allocated with enough space for the compressed texture
+
+            switch (getDXTCompression(format))
+            {
+                case DXT_BC1:
+                    compression.bcCompress = CompressBlocksBC1;
+                    compression.bytesPerBlock = 8;
+                    requiredInputChannels = 3;
+                    break;
+                case DXT_BC3:
+                    compression.bcCompress = CompressBlocksBC3;
+                    break;
+                case DXT_BC4:
+                    compression.bcCompress = CompressBlocksBC4;
+                    compression.bytesPerBlock = 8;
+                    requiredInputChannels = 1;
+                    break;
+                case DXT_BC5:
+                    compression.bcCompress = CompressBlocksBC5;
+                    requiredInputChannels = 2;
+                    break;
+                case DXT_BC6:
+                    compression.bcCompress = getBC6HCompressionFunc(profile);
+                    requiredInputChannels = 4;
+                    if (bitsPerPixel != 64 || !TinyImageFormat_IsFloat(format))
+                    {
+                        NAU_ASSERT("Unsupported format for BC6 compression");
+                        return std::nullopt;
+                    }
+                    break;
+                case DXT_BC7:
+                    compression.bcCompress = getBC7CompressionFunc(profile, inputChannels > 3);
+                    break;
+                default:
+                    NAU_ASSERT(false && "Unknown BC compression request");
+            }
+            NAU_ASSERT(requiredInputChannels <= inputChannels && "Input should always have more data available");
+
+            compression.input.ptr = data;
+            compression.input.stride = width * requiredInputChannels;
+            compression.input.width = width;
+            compression.input.height = height;
+
+            compression.output = EXPR_Block
+            {
+                const unsigned nbw = std::max<unsigned>(1u, (unsigned(width) + 3u) / 4u);
+                const unsigned nbh = std::max<unsigned>(1u, (unsigned(height) + 3u) / 4u);
+                const unsigned rowPitch = nbw * compression.bytesPerBlock;
+                const unsigned slicePitch = rowPitch * nbh;
+
+                return reinterpret_cast<uint8_t*>(STBI_MALLOC(slicePitch));
+            };
+            NAU_FATAL(compression.output);
+
+            return compression;
+        }
 
-    TextureCompressor::TextureCompressor(TinyImageFormat format, CompressionType compressionType) :
+        async::Executor::Ptr getCompressionExecutor()
+        {
+            // The compression must not steal the cores from the frame critical work when the import is running in the editor
+            if (hasServiceProvider())
+            {
+                if (auto* const workService = getServiceProvider().find<BackgroundWorkService>())
+                {
+                    return workService->getExecutor(BackgroundWorkPriority::Background);
+                }
+            }
+
+            return nullptr;
+        }
+    }  // namespace
+
+    TextureCompressor::TextureCompressor(TinyImageFormat format, CompressionType compressionType, TextureCompressionProfile profile) :
         m_compressionType(compressionType),
-        m_sourceFormat(format)
+        m_sourceFormat(format),
+        m_profile(profile)
     {
     }
 
     unsigned char* TextureCompressor::compress(unsigned char* data, unsigned width, unsigned height)
     {
         NAU_ASSERT(data);
-        switch (m_compressionType)
+
+        const Surface surface{data, width, height};
+        return compress(eastl::span{&surface, 1}).front();
+    }
+
+    eastl::vector<unsigned char*> TextureCompressor::compress(eastl::span<const Surface> surfaces)
+    {
+        eastl::vector<std::optional<SurfaceCompression>> compressions;
+        compressions.reserve(surfaces.size());
+
+        // The (surface index, stripe index) of every stripe
+        eastl::vector<eastl::pair<unsigned, unsigned>> stripes;
+
+        for (const Surface& surface : surfaces)
         {
-            case COMPRESSION_ASTC:
-                return ASTCCompression(data, m_sourceFormat, width, height);
-            case COMPRESSION_BC:
-                return BCCompression(data, m_sourceFormat, width, height);
-            default:
-                NAU_ASSERT("Unknown compression type");
-                return nullptr;
+            NAU_ASSERT(surface.data);
+
+            std::optional<SurfaceCompression>& compression = compressions.emplace_back();
+            switch (m_compressionType)
+            {
+                case COMPRESSION_ASTC:
+                    compression = prepareASTCCompression(surface.data, m_sourceFormat, surface.width, surface.height, m_profile);
+                    break;
+                case COMPRESSION_BC:
+                    compression = prepareBCCompression(surface.data, m_sourceFormat, surface.width, surface.height, m_profile);
+                    break;
+                default:
+                    NAU_ASSERT("Unknown compression type");
+                    break;
+            }
+
+            if (compression)
+            {
+                const auto surfaceIndex = static_cast<unsigned>(compressions.size() - 1);
+                for (unsigned i = 0, count = compression->getStripesCount(); i < count; ++i)
+                {
+                    stripes.emplace_back(surfaceIndex, i);
+                }
+            }
         }
 
-        return nullptr;
+        async::parallelFor(stripes.size(), 1, [&compressions, &stripes](size_t index)
+        {
+            const auto [surfaceIndex, stripeIndex] = stripes[index];
+            compressions[surfaceIndex]->compressStripe(stripeIndex);
+        }, getCompressionExecutor());
+
+        eastl::vector<unsigned char*> result;
+        result.reserve(compressions.size());
+        for (const std::optional<SurfaceCompression>& compression : compressions)
+        {
+            result.push_back(compression ? compression->output : nullptr);
+        }
+
+        return result;
     }
 
     TinyImageFormat TextureCompressor::getOutputTextureFormat(TinyImageFormat format, nau::TextureCompressor::CompressionType compressionType)
@@ -4,10 +4,27 @@
 
 #pragma once
 
-#include "tinyimageformat.h"
+#include <EASTL/span.h>
+#include <EASTL/vector.h>
+
+#include "nau/utils/enum/enum_reflection.h"
+#include "tinyimageformat_base.h"
 
 namespace nau
 {
+    /**
+     * The quality/speed trade-off of the block compression (selects the ispc_texcomp profile):
+     * the editor imports are expected to use the fast profiles, the cook - the slow ones.
+     * BC1/BC3/BC4/BC5 have the single quality level.
+     */
+    NAU_DEFINE_ENUM_(
+        TextureCompressionProfile,
+            VeryFast,
+            Fast,
+            Basic,
+            Slow
+    );
+
     /*
     */
     class TextureCompressor
@@ -20,14 +37,30 @@ namespace nau
                 COMPRESSION_BC,
             };
 
-            TextureCompressor(TinyImageFormat format, CompressionType compressionType = CompressionType::COMPRESSION_BC);
+            struct Surface
+            {
+                unsigned char* data;
+                unsigned width;
+                unsigned height;
+            };
+
+            TextureCompressor(TinyImageFormat format, CompressionType compressionType = CompressionType::COMPRESSION_BC, TextureCompressionProfile profile = TextureCompressionProfile::Fast);
             ~TextureCompressor() = default;
             unsigned char* compress(unsigned char* data, unsigned width, unsigned height);
 
+            /**
+             * Compresses the surfaces (e.g. the mip chain) at once: each surface is split into the stripes of block rows
+             * and the stripes of all the surfaces are compressed in parallel on the background executor.
+             * The blocks are compressed independently, so the output does not depend on the scheduling.
+             * @return the compressed surfaces (allocated with malloc), nullptr for the surface that can not be compressed.
+             */
+            eastl::vector<unsigned char*> compress(eastl::span<const Surface> surfaces);
+
             static TinyImageFormat getOutputTextureFormat(TinyImageFormat format, CompressionType compressionType = CompressionType::COMPRESSION_BC);
 
         private:
             CompressionType m_compressionType;
             TinyImageFormat m_sourceFormat = TinyImageFormat_UNDEFINED;
+            TextureCompressionProfile m_profile = TextureCompressionProfile::Fast;
     };
 }  // namespace nau
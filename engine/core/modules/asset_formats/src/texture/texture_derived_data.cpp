@@ -0,0 +1,137 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#include "texture_derived_data.h"
+
+#include "./texture_utils.h"
+#include "nau/utils/performance_profiling.h"
+
+namespace nau
+{
+    namespace
+    {
+        Result<size_t> getMipLevelSize(TinyImageFormat format, unsigned width, unsigned height, uint32_t mipLevel)
+        {
+            const auto [mipWidth, mipHeight] = TextureUtils::getMipSize(width, height, mipLevel);
+            Result<std::tuple<uint64_t, uint64_t>> pitch = TextureUtils::getImagePitch(format, mipWidth, mipHeight);
+            NauCheckResult(pitch);
+
+            return static_cast<size_t>(std::get<1>(*pitch));
+        }
+    }  // namespace
+
+    TextureDerivedData TextureDerivedData::fromSourceData(const TextureSourceData& sourceData)
+    {
+        NAU_CPU_SCOPED_TAG(nau::PerfTag::Assets);
+
+        const Header header{sourceData.getWidth(), sourceData.getHeight(), sourceData.getNumMipmaps(), static_cast<uint32_t>(sourceData.getFormat())};
+
+        TextureDerivedData derivedData;
+        size_t dataSize = sizeof(Header);
+        for (uint32_t mipLevel = 0; mipLevel < header.numMipmaps; ++mipLevel)
+        {
+            derivedData.m_mipOffsets.push_back(dataSize);
+            dataSize += *getMipLevelSize(sourceData.getFormat(), header.width, header.height, mipLevel);
+        }
+
+        derivedData.m_data.resize(dataSize);
+        memcpy(derivedData.m_data.data(), &header, sizeof(Header));
+
+        eastl::vector<DestTextureData> mipLevels(header.numMipmaps);
+        for (uint32_t mipLevel = 0; mipLevel < header.numMipmaps; ++mipLevel)
+        {
+            const auto [mipWidth, mipHeight] = TextureUtils::getMipSize(header.width, header.height, mipLevel);
+            const auto [rowPitch, slicePitch] = *TextureUtils::getImagePitch(sourceData.getFormat(), mipWidth, mipHeight);
+
+            DestTextureData& mipData = mipLevels[mipLevel];
+            mipData.outputBuffer = derivedData.m_data.data() + derivedData.m_mipOffsets[mipLevel];
+            mipData.rowsCount = slicePitch / rowPitch;
+            mipData.rowPitch = rowPitch;
+            mipData.rowBytesSize = rowPitch;
+            mipData.slicePitch = slicePitch;
+        }
+
+        sourceData.copyTextureData(0, header.numMipmaps, mipLevels);
+
+        return derivedData;
+    }
+
+    Result<TextureDerivedData> TextureDerivedData::fromCachedData(eastl::vector<std::byte> data)
+    {
+        if (data.size() < sizeof(Header))
+        {
+            return NauMakeError("Invalid texture derived data");
+        }
+
+        TextureDerivedData derivedData;
+        derivedData.m_data = std::move(data);
+
+        const Header& header = derivedData.getHeader();
+        size_t dataSize = sizeof(Header);
+        for (uint32_t mipLevel = 0; mipLevel < header.numMipmaps; ++mipLevel)
+        {
+            Result<size_t> mipLevelSize = getMipLevelSize(static_cast<TinyImageFormat>(header.format), header.width, header.height, mipLevel);
+            NauCheckResult(mipLevelSize);
+
+            derivedData.m_mipOffsets.push_back(dataSize);
+            dataSize += *mipLevelSize;
+        }
+
+        if (dataSize != derivedData.m_data.size())
+        {
+            return NauMakeError("Invalid texture derived data size");
+        }
+
+        return derivedData;
+    }
+
+    unsigned TextureDerivedData::getWidth() const
+    {
+        return getHeader().width;
+    }
+
+    unsigned TextureDerivedData::getHeight() const
+    {
+        return getHeader().height;
+    }
+
+    unsigned TextureDerivedData::getNumMipmaps() const
+    {
+        return getHeader().numMipmaps;
+    }
+
+    TinyImageFormat TextureDerivedData::getFormat() const
+    {
+        return static_cast<TinyImageFormat>(getHeader().format);
+    }
+
+    bool TextureDerivedData::isCompressed() const
+    {
+        return TinyImageFormat_IsCompressed(getFormat());
+    }
+
+    void TextureDerivedData::copyTextureData(size_t mipLevelStart, size_t mipLevelsCount, eastl::span<DestTextureData> destination) const
+    {
+        NAU_ASSERT(destination.size() == mipLevelsCount);
+        NAU_ASSERT(mipLevelStart + mipLevelsCount <= getNumMipmaps());
+
+        for (size_t i = 0; i < mipLevelsCount; ++i)
+        {
+            const size_t mipLevel = mipLevelStart + i;
+            const auto [mipWidth, mipHeight] = TextureUtils::getMipSize(getWidth(), getHeight(), static_cast<uint32_t>(mipLevel));
+
+            TextureUtils::copyImageData(destination[i], mipWidth, mipHeight, getFormat(), m_data.data() + m_mipOffsets[mipLevel]);
+        }
+    }
+
+    eastl::span<const std::byte> TextureDerivedData::getCachedData() const
+    {
+        return m_data;
+    }
+
+    const TextureDerivedData::Header& TextureDerivedData::getHeader() const
+    {
+        NAU_ASSERT(m_data.size() >= sizeof(Header));
+        return *reinterpret_cast<const Header*>(m_data.data());
+    }
+}  // namespace nau
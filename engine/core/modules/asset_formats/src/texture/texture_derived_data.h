@@ -0,0 +1,60 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <EASTL/span.h>
+#include <EASTL/vector.h>
+
+#include "nau/assets/texture_asset_accessor.h"
+#include "nau/utils/result.h"
+#include "texture_source_data.h"
+#include "tinyimageformat_base.h"
+
+namespace nau
+{
+    /**
+        Texture with all mip levels generated and converted to the final (possibly compressed) format.
+        Kept in the derived data cache, so the next loads of the same texture skip decoding, mip generation and compression.
+     */
+    class TextureDerivedData
+    {
+    public:
+        /**
+            Must be increased when TextureSourceData produces the different texture data for the same source.
+         */
+        static constexpr uint32_t DerivationVersion = 1;
+
+        static TextureDerivedData fromSourceData(const TextureSourceData& sourceData);
+
+        static Result<TextureDerivedData> fromCachedData(eastl::vector<std::byte> data);
+
+        unsigned getWidth() const;
+        unsigned getHeight() const;
+        unsigned getNumMipmaps() const;
+        TinyImageFormat getFormat() const;
+        bool isCompressed() const;
+
+        void copyTextureData(size_t mipLevelStart, size_t mipLevelsCount, eastl::span<DestTextureData> destination) const;
+
+        /**
+            @return Data to be stored in the derived data cache.
+         */
+        eastl::span<const std::byte> getCachedData() const;
+
+    private:
+        struct Header
+        {
+            uint32_t width;
+            uint32_t height;
+            uint32_t numMipmaps;
+            uint32_t format;
+        };
+
+        const Header& getHeader() const;
+
+        // Header followed by the tightly packed mip levels.
+        eastl::vector<std::byte> m_data;
+        eastl::vector<size_t> m_mipOffsets;
+    };
+}  // namespace nau
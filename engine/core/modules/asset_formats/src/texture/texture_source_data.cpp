@@ -6,6 +6,7 @@
 
 #include "./texture_utils.h"
 #include "nau/service/service_provider.h"
+#include "nau/utils/performance_profiling.h"
 #include "texture_asset_container.h"
 
 // Nothings
@@ -104,6 +105,8 @@ namespace nau
 
     Result<TextureSourceData> TextureSourceData::loadFromStream(io::IStreamReader::Ptr stream, RuntimeReadonlyDictionary::Ptr importSettings, TinyImageFormat forceFormat)
     {
+        NAU_CPU_SCOPED_TAG(nau::PerfTag::Assets);
+
         ImportSettings settings{};
         if(importSettings)
         {
@@ -199,15 +202,16 @@ namespace nau
         }
 
         void* anyData = isFloatTexture ? static_cast<void*>(floatData) : static_cast<void*>(data);
-        return TextureSourceData{static_cast<unsigned>(width), static_cast<unsigned>(height), numMipmaps, format, compressedFormat, anyData};
+        return TextureSourceData{static_cast<unsigned>(width), static_cast<unsigned>(height), numMipmaps, format, compressedFormat, settings.compressionProfile, anyData};
     }
 
-    TextureSourceData::TextureSourceData(unsigned width, unsigned height, unsigned numMipmaps, TinyImageFormat format, TinyImageFormat compressedFormat, void* data) :
+    TextureSourceData::TextureSourceData(unsigned width, unsigned height, unsigned numMipmaps, TinyImageFormat format, TinyImageFormat compressedFormat, TextureCompressionProfile compressionProfile, void* data) :
         m_width(width),
         m_height(height),
         m_numMipmaps(numMipmaps),
         m_format(format),
         m_compressedFormat(compressedFormat),
+        m_compressionProfile(compressionProfile),
         m_data(data)
     {
     }
@@ -218,6 +222,7 @@ namespace nau
         m_numMipmaps(std::exchange(other.m_numMipmaps, 1)),
         m_format(std::exchange(other.m_format, TinyImageFormat_UNDEFINED)),
         m_compressedFormat(std::exchange(other.m_compressedFormat, TinyImageFormat_UNDEFINED)),
+        m_compressionProfile(other.m_compressionProfile),
         m_data(std::exchange(other.m_data, nullptr))
     {
     }
@@ -239,6 +244,7 @@ namespace nau
         m_numMipmaps = std::exchange(other.m_numMipmaps, 0);
         m_format = std::exchange(other.m_format, TinyImageFormat_UNDEFINED);
         m_compressedFormat = std::exchange(other.m_compressedFormat, TinyImageFormat_UNDEFINED);
+        m_compressionProfile = other.m_compressionProfile;
         m_data = std::exchange(other.m_data, nullptr);
 
         return *this;
@@ -273,18 +279,16 @@ namespace nau
 
     void TextureSourceData::copyTextureData(size_t mipLevelStart, size_t mipLevelsCount, eastl::span<DestTextureData> destination) const
     {
-        struct Mip
-        {
-            unsigned width;
-            unsigned height;
-            unsigned char* data;
-        };
+        using Mip = TextureCompressor::Surface;
 
         NAU_ASSERT(mipLevelsCount >= 0);
         NAU_ASSERT(mipLevelsCount <= m_numMipmaps);
 
         std::optional<Mip> prevMip;
+        eastl::vector<Mip> mips;
+        mips.reserve(mipLevelsCount);
 
+        // The mips are generated one from another, but compressed all at once (see TextureCompressor::compress)
         const uint32_t channels = TinyImageFormat_ChannelCount(getFormat());
         for(uint32_t i = 0; i < mipLevelsCount; ++i)
         {
@@ -303,7 +307,7 @@ namespace nau
             {
                 if(!prevMip)
                 {
-                    prevMip = Mip{m_width, m_height, reinterpret_cast<unsigned char*>(m_data)};
+                    prevMip = Mip{reinterpret_cast<unsigned char*>(m_data), m_width, m_height};
                 }
 
                 std::tie(mip.width, mip.height) = TextureUtils::getMipSize(getWidth(), getHeight(), mipLevelIndex);
@@ -316,26 +320,37 @@ namespace nau
                 NAU_ASSERT(mipTexureData == mip.data);
             }
 
-            if(m_compressedFormat != TinyImageFormat_UNDEFINED)
+            mips.push_back(mip);
+            prevMip = mip;
+        }
+
+        if(m_compressedFormat != TinyImageFormat_UNDEFINED)
+        {
+            TextureCompressor compressor{m_format, TextureCompressor::COMPRESSION_BC, m_compressionProfile};
+            const eastl::vector<unsigned char*> compressedMips = compressor.compress(mips);
+
+            for(uint32_t i = 0; i < mipLevelsCount; ++i)
             {
-                TextureCompressor compressor{m_format};
-                unsigned char* compressed_data = compressor.compress(mip.data, mip.width, mip.height);
-                NAU_ASSERT(compressed_data);
-                TextureUtils::copyImageData(destination[i], mip.width, mip.height, getFormat(), reinterpret_cast<std::byte*>(compressed_data));
-                STBI_FREE(compressed_data);
+                NAU_ASSERT(compressedMips[i]);
+                TextureUtils::copyImageData(destination[i], mips[i].width, mips[i].height, getFormat(), reinterpret_cast<std::byte*>(compressedMips[i]));
+                STBI_FREE(compressedMips[i]);
             }
-            else
+        }
+        else
+        {
+            for(uint32_t i = 0; i < mipLevelsCount; ++i)
             {
-                TextureUtils::copyImageData(destination[i], mip.width, mip.height, getFormat(), reinterpret_cast<std::byte*>(mip.data));
+                TextureUtils::copyImageData(destination[i], mips[i].width, mips[i].height, getFormat(), reinterpret_cast<std::byte*>(mips[i].data));
             }
+        }
 
-            // NOTE: do not delete original (mip0) data
-            if(prevMip && (prevMip->width != m_width && prevMip->height != m_height))
+        // NOTE: do not delete original (mip0) data
+        for(const Mip& mip : mips)
+        {
+            if(mip.data != m_data)
             {
-                STBI_FREE(prevMip->data);
+                STBI_FREE(mip.data);
             }
-
-            prevMip = mip;
         }
     }
 
@@ -7,6 +7,7 @@
 #include "nau/io/file_system.h"
 #include "nau/utils/result.h"
 #include "tinyimageformat_base.h"
+#include "texture_compressor.h"
 #include "nau/serialization/runtime_value.h"
 #include "nau/assets/texture_asset_accessor.h"
 
@@ -39,13 +40,14 @@ namespace nau
         const void* getTextureData() const;
 
     private:
-        TextureSourceData(unsigned w, unsigned h, unsigned numMipmaps, TinyImageFormat format, TinyImageFormat compressedFormat, void* data);
+        TextureSourceData(unsigned w, unsigned h, unsigned numMipmaps, TinyImageFormat format, TinyImageFormat compressedFormat, TextureCompressionProfile compressionProfile, void* data);
 
         unsigned m_width = 0;
         unsigned m_height = 0;
         unsigned m_numMipmaps = 0;
         TinyImageFormat m_format = TinyImageFormat_UNDEFINED;
         TinyImageFormat m_compressedFormat = TinyImageFormat_UNDEFINED;
+        TextureCompressionProfile m_compressionProfile = TextureCompressionProfile::Fast;
         void* m_data = nullptr;
     };
 }  // namespace nau
@@ -30,6 +30,7 @@ namespace nau
 
         private:
             virtual async::Task<> copyUiElements(eastl::vector<UiElementAssetData>& elements) override;
+            virtual async::Task<> copyUiAtlases(eastl::vector<UiAtlasAssetData>& atlases) override;
 
             nau::WeakPtr<UiStreamAssetContainer> m_containerRef;
         };
@@ -42,6 +43,7 @@ namespace nau
             UiStreamAssetContainer(io::IStreamReader::Ptr stream);
 
             virtual async::Task<> copyUiElements(eastl::vector<UiElementAssetData>& elements);
+            virtual async::Task<> copyUiAtlases(eastl::vector<UiAtlasAssetData>& atlases);
 
         private:
             nau::Ptr<> getAsset(eastl::string_view path) override;
@@ -63,14 +65,13 @@ namespace nau
             m_size = stream->getPosition();
             stream->setPosition(io::OffsetOrigin::Begin, prevPosition);
 
-            eastl::u8string blkStr;
-            blkStr.resize(m_size);
-
             lock_(m_mutex);
 
-            if (stream->read(reinterpret_cast<std::byte*>(blkStr.data()), blkStr.size()))
+            // The blk is loaded in place when the stream data is in memory (storage is used otherwise).
+            BytesBuffer storage;
+            if (auto blkData = io::readStreamView(*stream, m_size, storage))
             {
-                iosys::MemGeneralLoadCB memStream(blkStr.data(), blkStr.size());
+                iosys::MemGeneralLoadCB memStream(blkData->data(), static_cast<int>(blkData->size()));
                 m_sceneBlk.loadFromStream(memStream);
             }
         }
@@ -250,6 +251,36 @@ namespace nau
             }
         }
 
+        void readAtlases(DataBlock& blk, eastl::vector<UiAtlasAssetData>& atlases)
+        {
+            const int atlasNameId = blk.getNameId("atlas");
+            for (int i = 0, c = blk.blockCount(); i < c; ++i)
+            {
+                DataBlock* atlasBlock = blk.getBlock(i);
+                if (atlasBlock->getNameId() != atlasNameId)
+                {
+                    continue;
+                }
+
+                UiAtlasAssetData& atlas = atlases.emplace_back();
+                atlas.imageFileName = atlasBlock->getStr("image", "");
+
+                const int frameNameId = atlasBlock->getNameId("frame");
+                for (int j = 0, frameCount = atlasBlock->blockCount(); j < frameCount; ++j)
+                {
+                    DataBlock* frameBlock = atlasBlock->getBlock(j);
+                    if (frameBlock->getNameId() != frameNameId)
+                    {
+                        continue;
+                    }
+
+                    UiAtlasFrameAssetData& frame = atlas.frames.emplace_back();
+                    frame.name = frameBlock->getStr("name", "");
+                    frame.rect = frameBlock->getPoint4("rect", {0.f, 0.f, 0.f, 0.f});
+                }
+            }
+        }
+
         async::Task<> UiStreamAssetContainer::copyUiElements(eastl::vector<UiElementAssetData>& elements)
         {
             lock_(m_mutex);
@@ -258,6 +289,14 @@ namespace nau
             return async::Task<>::makeResolved();
         }
 
+        async::Task<> UiStreamAssetContainer::copyUiAtlases(eastl::vector<UiAtlasAssetData>& atlases)
+        {
+            lock_(m_mutex);
+            readAtlases(m_sceneBlk, atlases);
+
+            return async::Task<>::makeResolved();
+        }
+
         nau::Ptr<> UiStreamAssetContainer::getAsset(eastl::string_view path)
         {
             return rtti::createInstance<UiStreamAssetAccessor>(*this);
@@ -285,6 +324,19 @@ namespace nau
 
             return async::Task<>::makeResolved();
         }
+
+        async::Task<> UiStreamAssetAccessor::copyUiAtlases(eastl::vector<UiAtlasAssetData>& atlases)
+        {
+            nau::Ptr<UiStreamAssetContainer> container = m_containerRef.lock();
+            NAU_ASSERT(container, "Invalid logic, asset accessor can not live longer that host container");
+
+            if (container)
+            {
+                return container->copyUiAtlases(atlases);
+            }
+
+            return async::Task<>::makeResolved();
+        }
     } // anonymous namespace
 
     eastl::vector<eastl::string_view> UiAssetContainerLoader::getSupportedAssetKind() const
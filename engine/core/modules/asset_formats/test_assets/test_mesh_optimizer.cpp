@@ -0,0 +1,133 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#include "nau/assets/mesh_optimizer.h"
+
+namespace nau::test
+{
+    class TestMeshOptimizer : public testing::Test
+    {
+    protected:
+        static constexpr unsigned GridSize = 32;
+
+        /**
+            The grid of the quads composed like the imported meshes: a vertex per triangle corner,
+            the triangles are shuffled so the source order is cache unfriendly.
+         */
+        void SetUp() override
+        {
+            const auto addVertex = [this](unsigned x, unsigned y)
+            {
+                m_positions.insert(m_positions.end(), {static_cast<float>(x), static_cast<float>(y), 0.f});
+                return static_cast<uint32_t>(m_positions.size() / 3 - 1);
+            };
+
+            eastl::vector<uint32_t> indices;
+            for (unsigned y = 0; y < GridSize; ++y)
+            {
+                for (unsigned x = 0; x < GridSize; ++x)
+                {
+                    indices.insert(indices.end(), {addVertex(x, y), addVertex(x + 1, y), addVertex(x + 1, y + 1)});
+                    indices.insert(indices.end(), {addVertex(x, y), addVertex(x + 1, y + 1), addVertex(x, y + 1)});
+                }
+            }
+
+            const size_t triangleCount = indices.size() / 3;
+            for (size_t i = 0; i < triangleCount; ++i)
+            {
+                const size_t triangle = (i * 7919) % triangleCount;
+                m_indices.insert(m_indices.end(), indices.begin() + triangle * 3, indices.begin() + triangle * 3 + 3);
+            }
+        }
+
+        size_t getVertexCount() const
+        {
+            return m_positions.size() / 3;
+        }
+
+        MeshVertexStream getPositions() const
+        {
+            return {m_positions.data(), sizeof(float) * 3, 0};
+        }
+
+        OptimizedMesh optimize(const MeshOptimizationSettings& settings) const
+        {
+            const MeshVertexStream positions = getPositions();
+            return optimizeMesh(m_indices, getVertexCount(), positions, {&positions, 1}, settings);
+        }
+
+        eastl::vector<float> m_positions;
+        eastl::vector<uint32_t> m_indices;
+    };
+
+    /**
+        Test: the corner vertices of the adjacent triangles are merged, the triangles are kept.
+     */
+    TEST_F(TestMeshOptimizer, DeduplicateVertices)
+    {
+        const OptimizedMesh mesh = optimize({});
+
+        ASSERT_EQ(mesh.vertexSources.size(), (GridSize + 1) * (GridSize + 1));
+        ASSERT_EQ(mesh.indices.size(), m_indices.size());
+
+        for (size_t i = 0; i < mesh.indices.size(); ++i)
+        {
+            const uint32_t source = mesh.vertexSources[mesh.indices[i]];
+            ASSERT_EQ(memcmp(&m_positions[source * 3], &m_positions[m_indices[i] * 3], sizeof(float) * 3), 0);
+        }
+    }
+
+    /**
+        Test: the optimized triangle order transforms less vertices than the source one.
+     */
+    TEST_F(TestMeshOptimizer, VertexCacheOrder)
+    {
+        MeshOptimizationSettings sourceOrderSettings;
+        sourceOrderSettings.optimizeVertexCache = false;
+        sourceOrderSettings.optimizeOverdraw = false;
+
+        const OptimizedMesh sourceOrderMesh = optimize(sourceOrderSettings);
+        const OptimizedMesh mesh = optimize({});
+
+        const float sourceMissRatio = computeVertexCacheMissRatio(sourceOrderMesh.indices, sourceOrderMesh.vertexSources.size());
+        const float missRatio = computeVertexCacheMissRatio(mesh.indices, mesh.vertexSources.size());
+
+        ASSERT_LT(missRatio, sourceMissRatio);
+        ASSERT_LT(missRatio, 1.f);
+    }
+
+    /**
+        Test: the meshlets respect the limits, cover all the triangles and bound their vertices.
+     */
+    TEST_F(TestMeshOptimizer, Meshlets)
+    {
+        MeshOptimizationSettings settings;
+        settings.generateMeshlets = true;
+        settings.maxMeshletVertices = 64;
+        settings.maxMeshletTriangles = 64;
+
+        const OptimizedMesh mesh = optimize(settings);
+        ASSERT_FALSE(mesh.meshlets.empty());
+
+        size_t triangleCount = 0;
+        for (const Meshlet& meshlet : mesh.meshlets)
+        {
+            ASSERT_LE(meshlet.vertexCount, settings.maxMeshletVertices);
+            ASSERT_LE(meshlet.triangleCount, settings.maxMeshletTriangles);
+            triangleCount += meshlet.triangleCount;
+
+            for (uint32_t i = 0; i < meshlet.vertexCount; ++i)
+            {
+                const float* const position = &m_positions[mesh.vertexSources[mesh.meshletVertices[meshlet.vertexOffset + i]] * 3];
+                const float distance = math::length(math::vec3{position[0], position[1], position[2]} - meshlet.center);
+                ASSERT_LE(distance, meshlet.radius + 1e-4f);
+            }
+
+            // The flat grid faces +Z: the meshlet is culled when viewed from below
+            ASSERT_LT(meshlet.coneCutoff, 1.f);
+            ASSERT_GT(static_cast<float>(meshlet.coneAxis.getZ()), 0.99f);
+        }
+
+        ASSERT_EQ(triangleCount, mesh.indices.size() / 3);
+    }
+}  // namespace nau::test
@@ -0,0 +1,149 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#include "nau/assets/mesh_simplifier.h"
+
+namespace nau::test
+{
+    class TestMeshSimplifier : public testing::Test
+    {
+    protected:
+        static constexpr unsigned GridSize = 32;
+
+        /**
+            The welded grid of the quads, height is the height field of the grid vertices.
+         */
+        void makeGrid(float (*height)(unsigned x, unsigned y))
+        {
+            m_positions.clear();
+            m_indices.clear();
+
+            for (unsigned y = 0; y <= GridSize; ++y)
+            {
+                for (unsigned x = 0; x <= GridSize; ++x)
+                {
+                    m_positions.insert(m_positions.end(), {static_cast<float>(x), static_cast<float>(y), height(x, y)});
+                }
+            }
+
+            for (unsigned y = 0; y < GridSize; ++y)
+            {
+                for (unsigned x = 0; x < GridSize; ++x)
+                {
+                    const uint32_t v0 = y * (GridSize + 1) + x;
+                    const uint32_t v1 = v0 + 1;
+                    const uint32_t v2 = v0 + GridSize + 2;
+                    const uint32_t v3 = v0 + GridSize + 1;
+                    m_indices.insert(m_indices.end(), {v0, v1, v2, v0, v2, v3});
+                }
+            }
+        }
+
+        size_t getVertexCount() const
+        {
+            return m_positions.size() / 3;
+        }
+
+        MeshVertexStream getPositions() const
+        {
+            return {m_positions.data(), sizeof(float) * 3, 0};
+        }
+
+        eastl::vector<float> m_positions;
+        eastl::vector<uint32_t> m_indices;
+    };
+
+    /**
+        Test: the flat grid is simplified without the error, its border vertices are kept.
+     */
+    TEST_F(TestMeshSimplifier, FlatGrid)
+    {
+        makeGrid([](unsigned, unsigned)
+        {
+            return 0.f;
+        });
+
+        float error = 1.f;
+        const eastl::vector<uint32_t> indices = simplifyMesh(m_indices, getVertexCount(), getPositions(), 0, 0.001f, &error);
+
+        ASSERT_LT(indices.size(), m_indices.size() / 4);
+        ASSERT_EQ(indices.size() % 3, 0);
+        ASSERT_LT(error, 1e-5f);
+
+        eastl::vector<bool> isUsed(getVertexCount(), false);
+        for (const uint32_t index : indices)
+        {
+            ASSERT_LT(index, getVertexCount());
+            isUsed[index] = true;
+        }
+
+        // The corners and the border vertices
+        for (unsigned i = 0; i <= GridSize; ++i)
+        {
+            ASSERT_TRUE(isUsed[i]);
+            ASSERT_TRUE(isUsed[i * (GridSize + 1)]);
+        }
+    }
+
+    /**
+        Test: the lods are coarser one by one, their errors are within the limits and the screen size thresholds decrease.
+     */
+    TEST_F(TestMeshSimplifier, LodChain)
+    {
+        makeGrid([](unsigned x, unsigned y)
+        {
+            return std::sin(static_cast<float>(x) * 0.3f) * std::cos(static_cast<float>(y) * 0.2f);
+        });
+
+        const MeshLodSettings settings;
+        const eastl::vector<MeshLod> lods = generateMeshLods(m_indices, getVertexCount(), getPositions(), {}, settings);
+        ASSERT_FALSE(lods.empty());
+
+        size_t previousIndexCount = m_indices.size();
+        float previousScreenSize = 1.f;
+
+        for (const MeshLod& lod : lods)
+        {
+            ASSERT_LT(lod.indices.size(), previousIndexCount);
+            ASSERT_LT(lod.screenSize, previousScreenSize);
+            ASSERT_GT(lod.screenSize, 0.f);
+            ASSERT_LE(lod.error, settings.levels.back().maxError);
+
+            ASSERT_EQ(lod.slots.size(), 1);
+            ASSERT_EQ(lod.slots.front().indexCount, lod.indices.size());
+
+            previousIndexCount = lod.indices.size();
+            previousScreenSize = lod.screenSize;
+        }
+    }
+
+    /**
+        Test: the triangles of the different material slots are simplified separately.
+     */
+    TEST_F(TestMeshSimplifier, MaterialSlots)
+    {
+        makeGrid([](unsigned, unsigned)
+        {
+            return 0.f;
+        });
+
+        const uint32_t halfIndexCount = static_cast<uint32_t>(m_indices.size() / 2);
+        const MeshIndexRange slots[] = {
+            {             0, halfIndexCount},
+            {halfIndexCount, halfIndexCount}
+        };
+
+        const eastl::vector<MeshLod> lods = generateMeshLods(m_indices, getVertexCount(), getPositions(), slots);
+        ASSERT_FALSE(lods.empty());
+
+        for (const MeshLod& lod : lods)
+        {
+            ASSERT_EQ(lod.slots.size(), 2);
+            ASSERT_EQ(lod.slots[0].startIndex, 0);
+            ASSERT_EQ(lod.slots[1].startIndex, lod.slots[0].indexCount);
+            ASSERT_EQ(lod.slots[0].indexCount + lod.slots[1].indexCount, lod.indices.size());
+            ASSERT_GT(lod.slots[0].indexCount, 0);
+            ASSERT_GT(lod.slots[1].indexCount, 0);
+        }
+    }
+}  // namespace nau::test
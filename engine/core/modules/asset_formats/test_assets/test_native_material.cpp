@@ -0,0 +1,90 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#include "nau/assets/native_material.h"
+#include "nau/math/math.h"
+#include "nau/serialization/runtime_value_builder.h"
+
+namespace nau::test
+{
+    namespace
+    {
+        /**
+            The master material with the single pipeline: the cooked constant buffer, the texture, the color and the sampler.
+         */
+        Material makeMaterial()
+        {
+            Material material;
+            material.name = "test_material";
+
+            MaterialPipeline& pipeline = material.pipelines["default"];
+            pipeline.shaders = {"file:/content/shaders/cache/shader_cache.nsbc+[test.vs]", "file:/content/shaders/cache/shader_cache.nsbc+[test.ps]"};
+            pipeline.constantBuffers["MaterialProps"] = {std::byte{1}, std::byte{2}, std::byte{3}, std::byte{4}};
+            pipeline.properties["albedoMap"] = makeValueCopy(eastl::string{"file:/content/textures/default.jpg"});
+            pipeline.properties["normalMap"] = makeValueCopy(math::Vector4{0.5f, 0.5f, 1.f, 1.f});
+            pipeline.properties["defaultSampler"] = makeValueCopy(3);
+            pipeline.cullMode = CullMode::Clockwise;
+            pipeline.isScissorsEnabled = false;
+            material.instanceProperties = {"baseColor", "roughness"};
+
+            return material;
+        }
+    }  // namespace
+
+    /**
+        Test: the written material is read back with the same shaders, constant buffers, properties and render states.
+     */
+    TEST(TestNativeMaterial, WriteAndRead)
+    {
+        const Result<eastl::vector<std::byte>> data = writeNativeMaterial(makeMaterial());
+        ASSERT_TRUE(data);
+
+        const Result<Material> material = readNativeMaterial(*data);
+        ASSERT_TRUE(material);
+        ASSERT_EQ(material->name, "test_material");
+        ASSERT_FALSE(material->master);
+        ASSERT_EQ(material->pipelines.size(), 1);
+
+        const MaterialPipeline& pipeline = material->pipelines.at("default");
+        ASSERT_EQ(pipeline.shaders.size(), 2);
+        ASSERT_EQ(pipeline.shaders[1], "file:/content/shaders/cache/shader_cache.nsbc+[test.ps]");
+
+        ASSERT_EQ(pipeline.constantBuffers.size(), 1);
+        ASSERT_EQ(pipeline.constantBuffers.at("MaterialProps").size(), 4);
+        ASSERT_EQ(pipeline.constantBuffers.at("MaterialProps")[3], std::byte{4});
+
+        ASSERT_EQ(pipeline.properties.size(), 3);
+        ASSERT_EQ(*runtimeValueCast<eastl::string>(pipeline.properties.at("albedoMap")), "file:/content/textures/default.jpg");
+        ASSERT_EQ(static_cast<float>(runtimeValueCast<math::Vector4>(pipeline.properties.at("normalMap"))->getZ()), 1.f);
+        ASSERT_EQ(*runtimeValueCast<int>(pipeline.properties.at("defaultSampler")), 3);
+
+        ASSERT_EQ(pipeline.cullMode, CullMode::Clockwise);
+        ASSERT_EQ(pipeline.isScissorsEnabled, false);
+        ASSERT_FALSE(pipeline.depthMode);
+        ASSERT_FALSE(pipeline.blendMode);
+        ASSERT_FALSE(pipeline.stencilCmpFunc);
+
+        ASSERT_EQ(material->instanceProperties.size(), 2);
+        ASSERT_EQ(material->instanceProperties[1], "roughness");
+    }
+
+    /**
+        Test: the truncated or foreign data is not read, the material instance is not written.
+     */
+    TEST(TestNativeMaterial, InvalidData)
+    {
+        const Result<eastl::vector<std::byte>> data = writeNativeMaterial(makeMaterial());
+        ASSERT_TRUE(data);
+
+        ASSERT_FALSE(readNativeMaterial(eastl::span{data->data(), sizeof(NativeMaterialHeader) - 1}));
+        ASSERT_FALSE(readNativeMaterial(eastl::span{data->data(), data->size() - 1}));
+
+        eastl::vector<std::byte> foreignData = *data;
+        foreignData[0] = std::byte{0};
+        ASSERT_FALSE(readNativeMaterial(foreignData));
+
+        Material instance = makeMaterial();
+        instance.master = "file:/content/materials/master.nmat_json";
+        ASSERT_FALSE(writeNativeMaterial(instance));
+    }
+}  // namespace nau::test
@@ -0,0 +1,101 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#include "nau/assets/native_mesh.h"
+
+namespace nau::test
+{
+    namespace
+    {
+        template <typename T>
+        eastl::vector<std::byte> toBytes(std::initializer_list<T> values)
+        {
+            eastl::vector<std::byte> bytes(values.size() * sizeof(T));
+            memcpy(bytes.data(), values.begin(), bytes.size());
+            return bytes;
+        }
+
+        /**
+            The quad of the two triangles with the positions, the 16 bit joints and the single lod.
+         */
+        NativeMeshData makeQuadMesh()
+        {
+            NativeMeshData mesh;
+            mesh.description = {6, 4, ElementFormat::Uint16};
+            mesh.bounds = math::BBox3{math::vec3{0.f, 0.f, 0.f}, math::vec3{1.f, 1.f, 0.f}};
+            mesh.indices = toBytes<uint16_t>({0, 1, 2, 0, 2, 3});
+
+            NativeMeshData::Attribute& positions = mesh.attributes.emplace_back();
+            positions.description = {"POSITION", 0, ElementFormat::Float, AttributeType::Vec3};
+            positions.data = toBytes<float>({0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 1.f, 1.f, 0.f, 0.f, 1.f, 0.f});
+
+            NativeMeshData::Attribute& joints = mesh.attributes.emplace_back();
+            joints.description = {"JOINTS", 0, ElementFormat::Uint16, AttributeType::Scalar};
+            joints.data = toBytes<uint16_t>({1, 2, 3, 4});
+
+            NativeMeshData::Lod& lod = mesh.lods.emplace_back();
+            lod.description = {3, 0.5f};
+            lod.indices = toBytes<uint16_t>({0, 1, 2});
+
+            return mesh;
+        }
+    }  // namespace
+
+    /**
+        Test: the written mesh is read back with the same description, bounds, streams and lods.
+     */
+    TEST(TestNativeMesh, WriteAndOpen)
+    {
+        const NativeMeshData source = makeQuadMesh();
+        const eastl::vector<std::byte> data = writeNativeMesh(source);
+
+        const Result<NativeMeshView> mesh = NativeMeshView::open(data);
+        ASSERT_TRUE(mesh);
+
+        const MeshDescription description = mesh->getDescription();
+        ASSERT_EQ(description.indexCount, 6);
+        ASSERT_EQ(description.vertexCount, 4);
+        ASSERT_EQ(description.indexFormat, ElementFormat::Uint16);
+
+        const math::BBox3 bounds = mesh->getBounds();
+        ASSERT_EQ(static_cast<float>(bounds.lim[1].getX()), 1.f);
+        ASSERT_EQ(static_cast<float>(bounds.lim[1].getY()), 1.f);
+
+        const eastl::span<const std::byte> indices = mesh->getIndices();
+        ASSERT_EQ(indices.size(), source.indices.size());
+        ASSERT_EQ(memcmp(indices.data(), source.indices.data(), indices.size()), 0);
+
+        ASSERT_EQ(mesh->getAttributes().size(), 2);
+        const NativeMeshAttribute* const joints = mesh->findAttribute("JOINTS", 0);
+        ASSERT_TRUE(joints);
+        ASSERT_EQ(static_cast<ElementFormat>(joints->elementFormat), ElementFormat::Uint16);
+        ASSERT_EQ(joints->data.offset % NativeMeshDataAlignment, 0);
+
+        const eastl::span<const std::byte> jointsData = mesh->getBlock(joints->data);
+        ASSERT_EQ(jointsData.size(), source.attributes[1].data.size());
+        ASSERT_EQ(memcmp(jointsData.data(), source.attributes[1].data.data(), jointsData.size()), 0);
+
+        ASSERT_FALSE(mesh->findAttribute("JOINTS", 1));
+        ASSERT_FALSE(mesh->findAttribute("NORMAL", 0));
+
+        ASSERT_EQ(mesh->getLods().size(), 1);
+        ASSERT_EQ(mesh->getLods()[0].indexCount, 3);
+        ASSERT_EQ(mesh->getLods()[0].screenSize, 0.5f);
+        ASSERT_EQ(mesh->getBlock(mesh->getLods()[0].indices).size(), 3 * sizeof(uint16_t));
+    }
+
+    /**
+        Test: the truncated or foreign data is not opened.
+     */
+    TEST(TestNativeMesh, InvalidData)
+    {
+        const eastl::vector<std::byte> data = writeNativeMesh(makeQuadMesh());
+
+        ASSERT_FALSE(NativeMeshView::open(eastl::span{data.data(), sizeof(NativeMeshHeader) - 1}));
+        ASSERT_FALSE(NativeMeshView::open(eastl::span{data.data(), data.size() - 1}));
+
+        eastl::vector<std::byte> foreignData = data;
+        foreignData[0] = std::byte{0};
+        ASSERT_FALSE(NativeMeshView::open(foreignData));
+    }
+}  // namespace nau::test
@@ -20,7 +20,7 @@ namespace nau
     {
         eastl::string kind;                /** < Asset kind. It has to be a kind supported by the corresponding asset view container*/
         io::FsPath path;                   /** < Path to the asset file. */
-        RuntimeObject::Ptr importSettings; /** < Settings to apply on load. */
+        RuntimeReadonlyDictionary::Ptr importSettings; /** < Settings to apply on load. */
 
         explicit operator bool() const
         {
@@ -38,6 +38,9 @@ namespace nau
 
         virtual ~IAssetContentProvider() = default;
 
+        /**
+            Content is the IAssetContainer, the io::IStreamReader or the io::IFile (which content is read asynchronously).
+         */
         virtual Result<AssetContent> openStreamOrContainer(const AssetPath& assetPath) = 0;
 
         virtual eastl::vector<eastl::string_view> getSupportedSchemes() const = 0;
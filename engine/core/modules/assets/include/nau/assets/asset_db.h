@@ -30,5 +30,11 @@ namespace nau
 
         virtual eastl::string getSourcePathFromNausdPath(const eastl::string& nausdPath) const = 0;
         virtual eastl::string getNausdPathFromSourcePath(const eastl::string& sourcePath) const = 0;
+
+        /**
+            Retrieves all assets the asset depends on: directly or through the other dependencies.
+            The dependencies are recorded when the assets are compiled.
+         */
+        virtual eastl::vector<Uid> getAssetDependencies(const Uid& uid) const = 0;
     };
 }  // namespace nau
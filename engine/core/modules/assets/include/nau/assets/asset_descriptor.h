@@ -31,6 +31,17 @@ namespace nau
         }
     };
 
+    /**
+     * @brief Priority of the asset loading: loads with the higher priority are started first.
+     */
+    enum class AssetLoadPriority : uint8_t
+    {
+        Critical,   ///< The asset is required right now (the caller is blocked until the asset is loaded).
+        Visible,    ///< The asset is required for the currently visible content.
+        Prefetch,   ///< The asset is likely required soon.
+        Background  ///< The asset is loaded when there is nothing else to load.
+    };
+
     /**
      * @brief Provides interface for retrieving asset views.
      */
@@ -74,8 +85,19 @@ namespace nau
          *
          * Current implementation supports asset load at the first getAssetView invokation.
          * However, a 'pre-load' can be requested using @ref load method.
+         *
+         * @param [in] priority Priority of the load. If the load is already waiting with a lower priority, its priority is raised.
+         */
+        virtual void load(AssetLoadPriority priority = AssetLoadPriority::Prefetch) = 0;
+
+        /**
+         * @brief Changes the priority of the asset load that is waiting to be started.
+         *
+         * Requesting an asset view raises the priority to at least AssetLoadPriority::Visible.
+         *
+         * @param [in] priority New load priority.
          */
-        virtual void load() = 0;
+        virtual void setLoadPriority(AssetLoadPriority priority) = 0;
 
         /**
          * @brief Clears resource cache.
@@ -0,0 +1,111 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <EASTL/array.h>
+#include <EASTL/string.h>
+#include <EASTL/vector.h>
+
+#include "nau/assets/asset_descriptor.h"
+#include "nau/io/stream.h"
+#include "nau/rtti/type_info.h"
+#include "nau/utils/result.h"
+
+namespace nau
+{
+    /**
+     * @brief The phases of the asset load, in the order they are passed.
+     */
+    enum class AssetLoadPhase : uint8_t
+    {
+        QueueWait,     ///< Waiting for the load slot (see "/assets/maxLoadsInFlight").
+        Open,          ///< Resolving and opening the asset content.
+        Read,          ///< Reading the asset content (file I/O).
+        Parse,         ///< Loading the asset container from the content.
+        FabricateView  ///< Creating the asset view from the container asset, including the GPU upload done by the view factory.
+    };
+
+    inline constexpr size_t AssetLoadPhaseCount = static_cast<size_t>(AssetLoadPhase::FabricateView) + 1;
+
+    struct AssetLoadSpan
+    {
+        AssetLoadPhase phase = AssetLoadPhase::QueueWait;
+        uint64_t startNs = 0;  ///< From the start of the timeline.
+        uint64_t durationNs = 0;
+    };
+
+    struct AssetLoadRecord
+    {
+        IAssetDescriptor::AssetId assetId = 0;
+        IAssetDescriptor::AssetId parentAssetId = 0;  ///< The asset which requested this asset as its dependency, 0 if none.
+        eastl::string path;
+        eastl::string kind;
+        eastl::vector<AssetLoadSpan> spans;
+
+        uint64_t getPhaseTimeNs(AssetLoadPhase phase) const
+        {
+            uint64_t time = 0;
+            for (const AssetLoadSpan& span : spans)
+            {
+                time += span.phase == phase ? span.durationNs : 0;
+            }
+
+            return time;
+        }
+    };
+
+    /**
+     * @brief The load times of all the assets of the same kind.
+     */
+    struct AssetKindLoadStats
+    {
+        eastl::string kind;
+        uint32_t assetCount = 0;
+        eastl::array<uint64_t, AssetLoadPhaseCount> phaseTimeNs{};
+        uint64_t maxAssetTimeNs = 0;  ///< The longest load of the single asset (all phases).
+    };
+
+    /**
+     * @brief Collects the per-asset timings of the load phases.
+     *
+     * The timeline is collected only between startLoadTimeline() and stopLoadTimeline(): otherwise the loads are not measured.
+     * The phases of the same asset can overlap (i.e. the views of the different types are fabricated concurrently).
+     */
+    struct NAU_ABSTRACT_TYPE IAssetLoadTimeline
+    {
+        NAU_TYPEID(nau::IAssetLoadTimeline)
+
+        virtual ~IAssetLoadTimeline() = default;
+
+        /**
+         * @brief Starts the new timeline: the previously collected records are discarded.
+         */
+        virtual void startLoadTimeline() = 0;
+
+        virtual void stopLoadTimeline() = 0;
+
+        virtual bool isLoadTimelineActive() const = 0;
+
+        /**
+         * @brief Retrieves the records of the assets in the order of their first measured phase.
+         */
+        virtual eastl::vector<AssetLoadRecord> getLoadRecords() const = 0;
+
+        /**
+         * @brief Retrieves the aggregated statistics per asset kind, sorted by the total load time (the slowest first).
+         */
+        virtual eastl::vector<AssetKindLoadStats> getLoadStatsByKind() const = 0;
+
+        /**
+         * @brief Writes the text report: the per-asset table and the per-kind statistics.
+         */
+        virtual Result<> writeLoadReport(io::IStreamWriter& stream) const = 0;
+
+        /**
+         * @brief Writes the timeline as the Chrome trace JSON (opened by chrome://tracing and Perfetto), one track per asset.
+         */
+        virtual Result<> writeLoadTraceChromeJson(io::IStreamWriter& stream) const = 0;
+    };
+}  // namespace nau
@@ -20,6 +20,14 @@ namespace nau
 
     NAU_DEFINE_TYPED_FLAG(UnloadAssets)
 
+    /**
+     */
+    struct AssetLoadStats
+    {
+        uint32_t loadsInFlight = 0;  ///< The asset loads which are opening, reading or decoding the asset content.
+        uint32_t pendingLoads = 0;   ///< The asset loads waiting for the load slot.
+    };
+
     /**
      */
     struct NAU_ABSTRACT_TYPE IAssetManager
@@ -54,6 +62,10 @@ namespace nau
          */
         virtual Result<AssetPath> resolvePath(const AssetPath& assetPath) = 0;
 
+        /**
+         */
+        virtual AssetLoadStats getLoadStats() = 0;
+
     };
 
 }  // namespace nau
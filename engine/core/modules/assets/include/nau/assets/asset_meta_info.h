@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <EASTL/vector.h>
+
 #include "nau/rtti/type_info.h"
 #include "nau/utils/uid.h"
 
@@ -18,6 +20,11 @@ namespace nau
         eastl::string sourcePath;
         eastl::string nausdPath;
 
+        /**
+            Assets referenced by the compiled asset (recorded by the asset compiler).
+         */
+        eastl::vector<Uid> dependencies;
+
 #pragma region Class Info
         NAU_CLASS_FIELDS(
             CLASS_FIELD(uid),
@@ -25,7 +32,8 @@ namespace nau
             CLASS_FIELD(kind),
             CLASS_FIELD(sourceType),
             CLASS_FIELD(sourcePath),
-            CLASS_FIELD(nausdPath))
+            CLASS_FIELD(nausdPath),
+            CLASS_FIELD(dependencies))
 #pragma endregion
     };
 }  // namespace nau
@@ -0,0 +1,86 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include "nau/rtti/type_info.h"
+
+namespace nau
+{
+    /**
+     * @brief Memory category of an asset: each category has its own residency budget.
+     */
+    enum class AssetMemoryCategory : uint8_t
+    {
+        Texture,
+        Mesh,
+        Animation,
+        Audio,
+        Other
+    };
+
+    /**
+     * @brief Memory held by a loaded asset container or asset view.
+     */
+    struct AssetMemoryFootprint
+    {
+        size_t cpuBytes = 0;
+        size_t gpuBytes = 0;
+
+        size_t getTotalBytes() const
+        {
+            return cpuBytes + gpuBytes;
+        }
+
+        AssetMemoryFootprint& operator+=(const AssetMemoryFootprint& other)
+        {
+            cpuBytes += other.cpuBytes;
+            gpuBytes += other.gpuBytes;
+            return *this;
+        }
+    };
+
+    /**
+     * @brief Implemented by the asset containers and the asset views that can report the memory they hold.
+     *
+     * Assets that do not provide the footprint are not counted against the budgets.
+     */
+    struct NAU_ABSTRACT_TYPE IAssetMemoryFootprint
+    {
+        NAU_TYPEID(nau::IAssetMemoryFootprint)
+
+        virtual ~IAssetMemoryFootprint() = default;
+
+        virtual AssetMemoryCategory getMemoryCategory() const = 0;
+
+        virtual AssetMemoryFootprint getMemoryFootprint() const = 0;
+    };
+
+    /**
+     * @brief Keeps the memory of the loaded assets within the per-category budgets.
+     *
+     * When a category exceeds its budget, the least recently used assets of the category that have no users are unloaded.
+     * An asset is unused when none of its views is referenced, except by ReloadableAssetView.
+     * An unloaded asset referenced by ReloadableAssetView is loaded again with the next ReloadableAssetView::get()
+     * (which returns null until the asset is reloaded).
+     */
+    struct NAU_ABSTRACT_TYPE IAssetResidencyManager
+    {
+        NAU_TYPEID(nau::IAssetResidencyManager)
+
+        virtual ~IAssetResidencyManager() = default;
+
+        /**
+         * @brief Sets the budget of the category, in bytes of CPU and GPU memory together. 0 means no budget (default).
+         */
+        virtual void setMemoryBudget(AssetMemoryCategory category, size_t budgetBytes) = 0;
+
+        virtual size_t getMemoryBudget(AssetMemoryCategory category) const = 0;
+
+        /**
+         * @brief Retrieves the memory held by the loaded assets of the category, as of the last residency update.
+         */
+        virtual AssetMemoryFootprint getMemoryUsage(AssetMemoryCategory category) const = 0;
+    };
+}  // namespace nau
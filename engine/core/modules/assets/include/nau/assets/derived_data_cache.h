@@ -0,0 +1,70 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <EASTL/optional.h>
+#include <EASTL/span.h>
+#include <EASTL/string_view.h>
+#include <EASTL/vector.h>
+
+#include <type_traits>
+
+#include "nau/rtti/type_info.h"
+
+namespace nau
+{
+    /**
+     * @brief Key of a derived product: the hash of the derivation kind and version, and all inputs of the derivation.
+     *
+     * The source content must be added to the key (not its path or modification time),
+     * so the changed source is never matched with the product derived from its previous content.
+     */
+    class NAU_COREASSETS_EXPORT DerivedDataKey
+    {
+    public:
+        /**
+         * @param kind              Kind of the derived products (i.e. "texture").
+         * @param derivationVersion Version of the derivation code: must be increased when the derivation output is changed.
+         */
+        DerivedDataKey(eastl::string_view kind, uint32_t derivationVersion);
+
+        DerivedDataKey& add(eastl::span<const std::byte> data);
+
+        DerivedDataKey& add(eastl::string_view str);
+
+        template <typename T>
+        requires(std::is_arithmetic_v<T> || std::is_enum_v<T>)
+        DerivedDataKey& add(T value)
+        {
+            return add(eastl::span<const std::byte>{reinterpret_cast<const std::byte*>(&value), sizeof(T)});
+        }
+
+        uint64_t getHash() const;
+
+    private:
+        uint64_t m_hash;
+    };
+
+    /**
+     * @brief Persistent (on disk) cache of the data derived from the asset content at load time.
+     *
+     * The products derived by the asset containers and the asset views (decoded and compressed textures, etc.)
+     * are stored by their content keys, so the next launches can skip the derivation.
+     * The whole cache is invalidated when the engine version is changed.
+     */
+    struct NAU_ABSTRACT_TYPE IDerivedDataCache
+    {
+        NAU_TYPEID(nau::IDerivedDataCache)
+
+        virtual ~IDerivedDataCache() = default;
+
+        /**
+         * @return The stored product or nullopt if there is no product for the key.
+         */
+        virtual eastl::optional<eastl::vector<std::byte>> find(const DerivedDataKey& key) = 0;
+
+        virtual void store(const DerivedDataKey& key, eastl::span<const std::byte> data) = 0;
+    };
+}  // namespace nau
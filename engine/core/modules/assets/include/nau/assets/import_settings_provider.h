@@ -11,6 +11,10 @@
 namespace nau
 {
     /**
+     * @brief Provides the settings applied on the asset load.
+     *
+     * The returned dictionary is only read: the settings cooked to the binary data block can be returned
+     * as the view of the block (see wrapRoDataBlock()) instead of the RuntimeValue tree.
      */
     struct IImportSettingsProvider
     {
@@ -38,6 +38,14 @@ namespace nau::assets
         NAU_TYPEID(nau::assets::IAssetDescriptorInternal)
 
         virtual eastl::optional<AssetInternalState> getCachedAssetViewInternalState(const rtti::TypeInfo* viewType, InternalStateOptsFlag) = 0;
+
+        /**
+            Asset references (AssetRefBase) holding the descriptor.
+            When the last reference is released the asset load that is still waiting to be started is cancelled.
+         */
+        virtual void addAssetRef() = 0;
+
+        virtual void releaseAssetRef() = 0;
     };
 
 }  // namespace nau::assets
@@ -7,6 +7,7 @@
 #include <EASTL/optional.h>
 #include <EASTL/string.h>
 #include <EASTL/unordered_map.h>
+#include <EASTL/vector.h>
 #include "nau/memory/bytes_buffer.h"
 #include "nau/serialization/runtime_value.h"
 #include "nau/utils/enum/enum_reflection.h"
@@ -80,6 +81,14 @@ namespace nau
         eastl::optional<bool> isScissorsEnabled;
         eastl::optional<ComparisonFunc> stencilCmpFunc;
 
+        /**
+         * @brief The cooked content of the property constant buffers by the buffer name (see native_material.h).
+         *
+         * The variables of a cooked buffer are not in the properties: the buffer content is uploaded as is.
+         * It is not serialized, only the cooked materials (.nmat) have it.
+         */
+        eastl::unordered_map<eastl::string, eastl::vector<std::byte>> constantBuffers;
+
         NAU_CLASS_FIELDS(
             CLASS_FIELD(properties),
             CLASS_FIELD(shaders),
@@ -112,10 +121,20 @@ namespace nau
          */
         eastl::unordered_map<eastl::string, MaterialPipeline> pipelines;
 
+        /**
+         * @brief The names of the constant properties the shaders read per instance, from the instance data instead of the constant buffers.
+         *
+         * Only the master material declares them. The material instances that differ from the master by these properties only
+         * are drawn together with it (see MaterialAssetView::getBatchHash): each property takes one float4 of the instance parameters,
+         * in the declaration order.
+         */
+        eastl::vector<eastl::string> instanceProperties;
+
         NAU_CLASS_FIELDS(
             CLASS_FIELD(name),
             CLASS_FIELD(master),
-            CLASS_FIELD(pipelines)
+            CLASS_FIELD(pipelines),
+            CLASS_FIELD(instanceProperties)
         )
     };
 } // namespace nau
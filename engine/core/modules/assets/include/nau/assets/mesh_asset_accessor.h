@@ -10,6 +10,7 @@
 
 #include "nau/assets/asset_accessor.h"
 #include "nau/async/task.h"
+#include "nau/math/dag_bounds3.h"
 #include "nau/utils/result.h"
 
 namespace nau
@@ -54,6 +55,17 @@ namespace nau
         ElementFormat indexFormat;
     };
 
+    /**
+     * The lod (from 1) of the mesh: its triangles index the lod 0 vertices.
+     */
+    struct MeshLodDescription
+    {
+        unsigned indexCount;
+
+        // The screen size (the bounding sphere diameter to the screen height ratio) below which the lod is used.
+        float screenSize;
+    };
+
     struct NAU_ABSTRACT_TYPE IMeshAssetAccessor : IAssetAccessor
     {
         NAU_INTERFACE(nau::IMeshAssetAccessor, IAssetAccessor)
@@ -67,6 +79,30 @@ namespace nau
         virtual Result<> copyVertAttribs(eastl::span<OutputVertAttribDescription>) const = 0;
 
         virtual Result<> copyIndices(void* outputBuffer, size_t outputBufferSize, ElementFormat outputIndexFormat) const = 0;
+
+        /**
+         * The generated lods of the mesh (see generateMeshLods), empty if the mesh has the lod 0 only.
+         */
+        virtual eastl::vector<MeshLodDescription> getLodDescriptions() const
+        {
+            return {};
+        }
+
+        /**
+         * @param lodIndex the index in getLodDescriptions() (the lod lodIndex + 1).
+         */
+        virtual Result<> copyLodIndices([[maybe_unused]] unsigned lodIndex, void*, size_t, ElementFormat) const
+        {
+            return NauMakeError("The mesh has no lods");
+        }
+
+        /**
+         * The bounds of the lod 0 vertices when they are precomputed (the cooked meshes), the mesh computes them itself otherwise.
+         */
+        virtual eastl::optional<math::BBox3> getBounds() const
+        {
+            return eastl::nullopt;
+        }
     };
 
 }  // namespace nau
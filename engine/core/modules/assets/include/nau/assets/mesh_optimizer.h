@@ -0,0 +1,142 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <EASTL/span.h>
+#include <EASTL/vector.h>
+
+#include "nau/diag/assertion.h"
+#include "nau/math/math.h"
+
+namespace nau
+{
+    /**
+     * @brief Vertex attribute data: vertexCount elements of the size bytes, stride bytes apart (0 - tightly packed).
+     */
+    struct MeshVertexStream
+    {
+        const void* data = nullptr;
+        size_t size = 0;
+        size_t stride = 0;
+    };
+
+    /**
+     * @brief The import time mesh optimization steps (applied in the declaration order).
+     */
+    struct MeshOptimizationSettings
+    {
+        /** Merges the vertices with the equal data of all the streams (the composed meshes have a vertex per face corner). */
+        bool deduplicateVertices = true;
+
+        /** Reorders the triangles for the post-transform vertex cache. */
+        bool optimizeVertexCache = true;
+
+        /** Reorders the triangle clusters to reduce the overdraw (meaningful for the opaque meshes only). */
+        bool optimizeOverdraw = true;
+
+        /** The allowed vertex cache efficiency loss for the overdraw optimization (the ratio of the average cache misses). */
+        float overdrawThreshold = 1.05f;
+
+        /** Reorders the vertices in the order of the first use by the index buffer. */
+        bool optimizeVertexFetch = true;
+
+        /** Splits the mesh into the meshlets (see Meshlet) for the mesh shaders or the cluster culling. */
+        bool generateMeshlets = false;
+        unsigned maxMeshletVertices = 64;
+        unsigned maxMeshletTriangles = 124;
+    };
+
+    /**
+     * @brief The triangle cluster with its culling bounds.
+     *
+     * The meshlet is back facing (can be culled) when
+     * dot(normalize(coneApex - cameraPosition), coneAxis) >= coneCutoff, coneCutoff == 1 means the meshlet can not be cone culled.
+     */
+    struct Meshlet
+    {
+        uint32_t vertexOffset = 0;   /** < The first vertex in OptimizedMesh::meshletVertices. */
+        uint32_t triangleOffset = 0; /** < The first triangle (3 local indices) in OptimizedMesh::meshletTriangles. */
+        uint32_t vertexCount = 0;
+        uint32_t triangleCount = 0;
+
+        math::vec3 center;
+        float radius = 0.f;
+
+        math::vec3 coneApex;
+        math::vec3 coneAxis;
+        float coneCutoff = 1.f;
+    };
+
+    struct OptimizedMesh
+    {
+        eastl::vector<uint32_t> indices;
+
+        /** The source vertex of every optimized vertex: the vertex attributes are gathered with remapVertices. */
+        eastl::vector<uint32_t> vertexSources;
+
+        eastl::vector<Meshlet> meshlets;
+        eastl::vector<uint32_t> meshletVertices;
+        eastl::vector<uint8_t> meshletTriangles;
+
+        template <typename T>
+        eastl::vector<T> remapVertices(eastl::span<const T> sourceVertices) const
+        {
+            eastl::vector<T> vertices;
+            vertices.reserve(vertexSources.size());
+            for (const uint32_t source : vertexSources)
+            {
+                NAU_ASSERT(source < sourceVertices.size());
+                vertices.push_back(sourceVertices[source]);
+            }
+
+            return vertices;
+        }
+    };
+
+    /**
+     * @brief Optimizes the indexed triangle list.
+     *
+     * @param indices       The source triangles.
+     * @param vertexCount   The number of the source vertices.
+     * @param positions     The vertex positions (3 floats), used by the overdraw optimization and the meshlet bounds.
+     * @param streams       All the vertex attributes (positions included): the vertices are merged only if all their attributes are equal.
+     */
+    NAU_COREASSETS_EXPORT OptimizedMesh optimizeMesh(eastl::span<const uint32_t> indices, size_t vertexCount, const MeshVertexStream& positions,
+                                                     eastl::span<const MeshVertexStream> streams, const MeshOptimizationSettings& settings = {});
+
+    /**
+     * @brief Builds the map of the source vertices to the unique ones (~0 for the vertices that are not referenced by the indices).
+     * @return The number of the unique vertices, numbered in the order of the first use.
+     */
+    NAU_COREASSETS_EXPORT size_t generateVertexRemap(eastl::span<uint32_t> remap, eastl::span<const uint32_t> indices, size_t vertexCount, eastl::span<const MeshVertexStream> streams);
+
+    /**
+     * @brief Reorders the triangles for the vertex cache locality (Forsyth's linear speed algorithm).
+     */
+    NAU_COREASSETS_EXPORT void optimizeVertexCache(eastl::span<uint32_t> indices, size_t vertexCount);
+
+    /**
+     * @brief Reorders the vertex cache local triangle clusters front to back relative to the mesh center (Sander et al. 2007),
+     * the order is kept if the vertex cache efficiency becomes worse than threshold.
+     */
+    NAU_COREASSETS_EXPORT void optimizeOverdraw(eastl::span<uint32_t> indices, const MeshVertexStream& positions, size_t vertexCount, float threshold);
+
+    /**
+     * @brief Builds the map of the vertices to their first use order (~0 for the vertices that are not referenced by the indices).
+     * @return The number of the referenced vertices.
+     */
+    NAU_COREASSETS_EXPORT size_t generateVertexFetchRemap(eastl::span<uint32_t> remap, eastl::span<const uint32_t> indices, size_t vertexCount);
+
+    /**
+     * @brief Splits the mesh triangles (in their order) into the meshlets.
+     * @param positions The positions of the source vertices (the optimized vertices are mapped through OptimizedMesh::vertexSources).
+     */
+    NAU_COREASSETS_EXPORT void buildMeshlets(OptimizedMesh& mesh, const MeshVertexStream& positions, unsigned maxVertices, unsigned maxTriangles);
+
+    /**
+     * @brief The average cache miss ratio (ACMR) of the FIFO vertex cache: the transformed vertices per triangle.
+     */
+    NAU_COREASSETS_EXPORT float computeVertexCacheMissRatio(eastl::span<const uint32_t> indices, size_t vertexCount, unsigned cacheSize = 16);
+}  // namespace nau
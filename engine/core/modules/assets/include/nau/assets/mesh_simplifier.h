@@ -0,0 +1,91 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <EASTL/span.h>
+#include <EASTL/vector.h>
+
+#include "nau/assets/mesh_optimizer.h"
+
+namespace nau
+{
+    /**
+     * @brief The index range of the mesh material slot: the triangles of the different slots are never merged.
+     */
+    struct MeshIndexRange
+    {
+        uint32_t startIndex = 0;
+        uint32_t indexCount = 0;
+    };
+
+    struct MeshLodLevelSettings
+    {
+        /** The target triangles count relative to the lod 0. */
+        float ratio = 0.5f;
+
+        /** The allowed geometric error relative to the mesh size (the bounding box diagonal). */
+        float maxError = 0.02f;
+    };
+
+    struct MeshLodSettings
+    {
+        eastl::vector<MeshLodLevelSettings> levels = {
+            {  0.5f, 0.02f},
+            { 0.25f, 0.05f},
+            {0.125f,  0.1f}
+        };
+
+        /**
+         * The screen size thresholds are chosen so the lod error is projected below maxPixelError
+         * on the screen of the referenceScreenHeight pixels.
+         */
+        float maxPixelError = 1.f;
+        float referenceScreenHeight = 1080.f;
+
+        /** The lod is dropped if it has more than this share of the previous lod triangles: it would not pay for its memory. */
+        float minReduction = 0.9f;
+    };
+
+    struct MeshLod
+    {
+        /** The triangles of the lod, indexing the lod 0 vertices. */
+        eastl::vector<uint32_t> indices;
+
+        /** The material slot ranges of the lod, in the order of the lod 0 slots. */
+        eastl::vector<MeshIndexRange> slots;
+
+        /** The geometric error relative to the mesh size. */
+        float error = 0.f;
+
+        /** The screen size (the bounding sphere diameter to the screen height ratio) below which the lod is used (see LodSelection). */
+        float screenSize = 0.f;
+    };
+
+    /**
+     * @brief Simplifies the triangles with the quadric error metric edge collapses (Garland and Heckbert 1997).
+     *
+     * The vertices are collapsed onto their neighbours, so no new vertices are created and the attributes stay valid.
+     * The vertices of the open borders and of the attribute seams (the vertices of the equal positions) are not moved,
+     * so the UV seams and the borders of the material slots are preserved. The mesh is expected to be deduplicated (see optimizeMesh).
+     *
+     * @param indices           The source triangles.
+     * @param positions         The vertex positions (3 floats).
+     * @param targetIndexCount  The simplification stops when the index count reaches the target.
+     * @param maxError          The simplification stops when the error (relative to the mesh size) exceeds the limit.
+     * @param resultError       The resulting error relative to the mesh size.
+     * @return                  The simplified triangles.
+     */
+    NAU_COREASSETS_EXPORT eastl::vector<uint32_t> simplifyMesh(eastl::span<const uint32_t> indices, size_t vertexCount, const MeshVertexStream& positions,
+                                                               size_t targetIndexCount, float maxError, float* resultError = nullptr);
+
+    /**
+     * @brief Generates the lod chain (the lods from 1) of the mesh with the screen size thresholds for the runtime lod selection.
+     *
+     * @param slots The material slot ranges of the lod 0 (empty - the whole mesh is a single slot), each slot is simplified separately.
+     */
+    NAU_COREASSETS_EXPORT eastl::vector<MeshLod> generateMeshLods(eastl::span<const uint32_t> indices, size_t vertexCount, const MeshVertexStream& positions,
+                                                                  eastl::span<const MeshIndexRange> slots,
+                                                                  const MeshLodSettings& settings = {});
+}  // namespace nau
@@ -0,0 +1,89 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <EASTL/span.h>
+#include <EASTL/vector.h>
+
+#include "nau/assets/material.h"
+#include "nau/utils/result.h"
+
+namespace nau
+{
+    /**
+     * The cooked master material (the .nmat file) stores the shader references, the render states, the content of the property
+     * constant buffers laid out by the shader reflection (see MaterialPipeline::constantBuffers) and the resource properties
+     * (textures and samplers), so the material is read without the json parsing and the constant buffer values conversion.
+     *
+     * Layout: NativeMaterialHeader, NativeMaterialPipeline[pipelineCount], then the tables and the data referenced by the blocks,
+     * each aligned by NativeMaterialDataAlignment. The block offsets are from the file start, the strings are not zero terminated.
+     */
+    inline constexpr uint32_t NativeMaterialMagic = 0x54414D4E;  // "NMAT"
+    inline constexpr uint32_t NativeMaterialVersion = 2;
+    inline constexpr size_t NativeMaterialDataAlignment = 8;
+    inline constexpr uint8_t NativeMaterialNoState = 0xFF;
+
+    enum class NativeMaterialPropertyType : uint8_t
+    {
+        Int,     ///< The int32 value (the sampler properties).
+        String,  ///< The asset path (the texture properties).
+        Color    ///< The four floats (the texture properties with the solid color).
+    };
+
+    struct NativeMaterialBlock
+    {
+        uint32_t offset;
+        uint32_t size;
+    };
+
+    struct NativeMaterialHeader
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t pipelineCount;
+        uint32_t reserved;
+        NativeMaterialBlock name;
+        NativeMaterialBlock instanceProperties;  // NativeMaterialBlock[] of the per-instance property names
+    };
+
+    struct NativeMaterialPipeline
+    {
+        NativeMaterialBlock name;
+        NativeMaterialBlock shaders;          // NativeMaterialBlock[] of the shader asset paths
+        NativeMaterialBlock constantBuffers;  // NativeMaterialConstantBuffer[]
+        NativeMaterialBlock properties;       // NativeMaterialProperty[]
+        uint8_t cullMode;                     // CullMode or NativeMaterialNoState
+        uint8_t depthMode;                    // DepthMode or NativeMaterialNoState
+        uint8_t blendMode;                    // BlendMode or NativeMaterialNoState
+        uint8_t isScissorsEnabled;            // 0, 1 or NativeMaterialNoState
+        uint8_t stencilCmpFunc;               // ComparisonFunc or NativeMaterialNoState
+        uint8_t reserved[3];
+    };
+
+    struct NativeMaterialConstantBuffer
+    {
+        NativeMaterialBlock name;
+        NativeMaterialBlock data;
+    };
+
+    struct NativeMaterialProperty
+    {
+        NativeMaterialBlock name;
+        NativeMaterialBlock value;
+        uint8_t type;  // NativeMaterialPropertyType
+        uint8_t reserved[7];
+    };
+
+    /**
+     * Writes the master material: its constant buffer variables must be already cooked into MaterialPipeline::constantBuffers
+     * (see MaterialAssetView::cookConstantBuffers), the other properties must be of the NativeMaterialPropertyType types.
+     */
+    NAU_COREASSETS_EXPORT Result<eastl::vector<std::byte>> writeNativeMaterial(const Material& material);
+
+    /**
+     * Validates and reads the native material.
+     */
+    NAU_COREASSETS_EXPORT Result<Material> readNativeMaterial(eastl::span<const std::byte> data);
+}  // namespace nau
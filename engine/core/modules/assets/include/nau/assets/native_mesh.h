@@ -0,0 +1,125 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <EASTL/span.h>
+#include <EASTL/string_view.h>
+#include <EASTL/vector.h>
+
+#include "nau/assets/mesh_asset_accessor.h"
+#include "nau/math/dag_bounds3.h"
+#include "nau/utils/result.h"
+
+namespace nau
+{
+    /**
+     * The cooked mesh (the .nmesh file) stores the vertex streams in the formats the runtime meshes upload (see StaticMesh, SkinnedMesh),
+     * the indices, the lod indices and the bounds, so the mesh is loaded with a single read (or from the mapped memory) and copied as is.
+     *
+     * Layout: NativeMeshHeader, NativeMeshAttribute[attributeCount], NativeMeshLod[lodCount],
+     * then the data blocks, each aligned by NativeMeshDataAlignment. The block offsets are from the file start.
+     */
+    inline constexpr uint32_t NativeMeshMagic = 0x48534D4E;  // "NMSH"
+    inline constexpr uint32_t NativeMeshVersion = 1;
+    inline constexpr size_t NativeMeshDataAlignment = 16;
+
+    struct NativeMeshBlock
+    {
+        uint64_t offset;
+        uint64_t size;
+    };
+
+    struct NativeMeshHeader
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t vertexCount;
+        uint32_t indexCount;
+        uint32_t attributeCount;
+        uint32_t lodCount;
+        uint8_t indexFormat;  // ElementFormat
+        uint8_t reserved[7];
+        float boundsMin[3];
+        float boundsMax[3];
+        NativeMeshBlock indices;
+    };
+
+    struct NativeMeshAttribute
+    {
+        char semantic[16];  // Zero terminated
+        uint32_t semanticIndex;
+        uint8_t elementFormat;  // ElementFormat
+        uint8_t attributeType;  // AttributeType
+        uint8_t reserved[2];
+        NativeMeshBlock data;
+    };
+
+    struct NativeMeshLod
+    {
+        uint32_t indexCount;
+        float screenSize;
+        NativeMeshBlock indices;  // In the format of the lod 0 indices
+    };
+
+    /**
+     * The mesh content to be written into the native mesh layout.
+     */
+    struct NativeMeshData
+    {
+        struct Attribute
+        {
+            VertAttribDescription description;
+            eastl::vector<std::byte> data;
+        };
+
+        struct Lod
+        {
+            MeshLodDescription description;
+            eastl::vector<std::byte> indices;
+        };
+
+        MeshDescription description;
+        math::BBox3 bounds;
+        eastl::vector<std::byte> indices;
+        eastl::vector<Attribute> attributes;
+        eastl::vector<Lod> lods;
+    };
+
+    NAU_COREASSETS_EXPORT eastl::vector<std::byte> writeNativeMesh(const NativeMeshData& mesh);
+
+    /**
+     * The view of the native mesh in memory: the data is not copied, so it must outlive the view.
+     */
+    class NAU_COREASSETS_EXPORT NativeMeshView
+    {
+    public:
+        /**
+         * Validates the header and the blocks of the native mesh.
+         */
+        static Result<NativeMeshView> open(eastl::span<const std::byte> data);
+
+        NativeMeshView() = default;
+
+        MeshDescription getDescription() const;
+
+        math::BBox3 getBounds() const;
+
+        eastl::span<const std::byte> getIndices() const;
+
+        const eastl::vector<NativeMeshAttribute>& getAttributes() const;
+
+        const NativeMeshAttribute* findAttribute(eastl::string_view semantic, unsigned semanticIndex) const;
+
+        const eastl::vector<NativeMeshLod>& getLods() const;
+
+        eastl::span<const std::byte> getBlock(const NativeMeshBlock& block) const;
+
+    private:
+        eastl::span<const std::byte> m_data;
+        NativeMeshHeader m_header{};
+        eastl::vector<NativeMeshAttribute> m_attributes;
+        eastl::vector<NativeMeshLod> m_lods;
+    };
+}  // namespace nau
@@ -5,11 +5,14 @@
 
 #pragma once
 
+#include <atomic>
+
 #include "nau/assets/asset_view.h"
 #include "nau/rtti/rtti_impl.h"
 #include "nau/rtti/weak_ptr.h"
 #include "nau/threading/lock_guard.h"
 #include "nau/threading/spin_lock.h"
+#include "nau/utils/functor.h"
 
 namespace nau
 {
@@ -30,11 +33,25 @@ namespace nau
         threading::SpinLock m_mutex;
         nau::Ptr<IAssetView> m_assetView = nullptr;
 
+        // Set when the asset is unloaded by the residency manager: requests the asset to be loaded again.
+        Functor<void()> m_reloadRequest;
+        std::atomic<bool> m_isUsed = false;
+
         ReloadableAssetView() = default;
         ReloadableAssetView(AssetViewPtr assetView);
 
         void reloadAssetView(AssetViewPtr newAssetView);
 
+        /**
+            Releases the view of the unloaded asset: the next get() calls reloadRequest.
+         */
+        void evictAssetView(Functor<void()> reloadRequest);
+
+        /**
+            Checks whether get() was called since the previous check.
+         */
+        bool checkIsUsed();
+
         friend AssetDescriptorImpl;
         friend AssetViewEntry;
 
@@ -44,19 +61,22 @@ namespace nau
         ReloadableAssetView(ReloadableAssetView&& reloadableAssetView) = delete;
         ~ReloadableAssetView() = default;
 
+        /**
+            Returns null while the asset that was unloaded by the residency manager is loaded again.
+         */
         AssetViewPtr get();
 
         template <std::derived_from<IAssetView> AssetViewType>
         void getTyped(nau::Ptr<AssetViewType>& ptr)
         {
-            lock_(m_mutex);
-
-            if (!m_assetView || !m_assetView->is<AssetViewType>())
+            AssetViewPtr assetView = get();
+            if (!assetView || !assetView->is<AssetViewType>())
             {
                 ptr = nullptr;
+                return;
             }
 
-            ptr = m_assetView;
+            ptr = std::move(assetView);
         };
     };
 }  // namespace nau
@@ -59,4 +59,13 @@ namespace nau
 
         virtual void copyTextureData(size_t mipLevelStart, size_t mipLevelsCount, eastl::span<DestTextureData> destination) = 0;
     };
+
+    /**
+     * The count of the textures that were decoded from the source images (png, jpg, hdr) on load:
+     * the image decode, the mipmaps generation and the compression run on the CPU instead of the plain copy of the cooked dds.
+     * The shipping content is expected to keep it zero (see the "/assets/cookedTexturesOnly" setting).
+     */
+    NAU_COREASSETS_EXPORT uint64_t getTextureDecodeFallbackCount();
+
+    NAU_COREASSETS_EXPORT void addTextureDecodeFallback();
 }  // namespace nau
@@ -108,11 +108,28 @@ namespace nau
         eastl::vector<UiElementAssetData> children;
     };
 
+    struct UiAtlasFrameAssetData
+    {
+        eastl::string name;     ///< Path of the packed image: the elements referencing the image use the frame.
+        math::vec4 rect;        ///< Image rectangle within the atlas (x, y, width, height in pixels).
+    };
+
+    /**
+     * @brief Atlas of the UI scene images packed by the asset tools.
+     */
+    struct UiAtlasAssetData
+    {
+        eastl::string imageFileName;
+        eastl::vector<UiAtlasFrameAssetData> frames;
+    };
+
     struct NAU_ABSTRACT_TYPE IUiAssetAccessor : IAssetAccessor
     {
         NAU_INTERFACE(nau::IUiAssetAccessor, IAssetAccessor)
 
         virtual async::Task<> copyUiElements(eastl::vector<UiElementAssetData>& elements) = 0;
+
+        virtual async::Task<> copyUiAtlases(eastl::vector<UiAtlasAssetData>& atlases) = 0;
     };
 
 }  // namespace nau
@@ -4,6 +4,8 @@
 
 #include "./asset_db_impl.h"
 
+#include <EASTL/set.h>
+
 #include <format>
 
 #include "nau/diag/logging.h"
@@ -149,6 +151,39 @@ namespace nau
         return {};
     }
 
+    eastl::vector<Uid> AssetDBImpl::getAssetDependencies(const Uid& uid) const
+    {
+        shared_lock_(m_mutex);
+
+        eastl::vector<Uid> dependencies;
+        eastl::set<Uid> visited = {uid};
+        eastl::vector<Uid> pending = {uid};
+
+        while (!pending.empty())
+        {
+            const Uid assetUid = pending.back();
+            pending.pop_back();
+
+            auto it = m_allAssets.find(assetUid);
+            if (it == m_allAssets.end())
+            {
+                continue;
+            }
+
+            for (const Uid& dependencyUid : it->second.dependencies)
+            {
+                // Cyclic references are possible (for example scenes that reference each other).
+                if (visited.insert(dependencyUid).second)
+                {
+                    dependencies.push_back(dependencyUid);
+                    pending.push_back(dependencyUid);
+                }
+            }
+        }
+
+        return dependencies;
+    }
+
     eastl::tuple<AssetPath, AssetContentInfo> AssetDBImpl::resolvePath(const AssetPath& assetPath)
     {
         using namespace nau::strings;
@@ -62,6 +62,8 @@ namespace nau
         eastl::string getSourcePathFromNausdPath(const eastl::string& nausdPath) const override;
         eastl::string getNausdPathFromSourcePath(const eastl::string& sourcePath) const override;
 
+        eastl::vector<Uid> getAssetDependencies(const Uid& uid) const override;
+
         eastl::tuple<AssetPath, AssetContentInfo> resolvePath(const AssetPath& assetPath) override;
 
         eastl::vector<eastl::string_view> getSupportedSchemes() const override;
@@ -73,6 +75,6 @@ namespace nau
     private:
         eastl::map<Uid, AssetMetaInfoInternal> m_allAssets;
         eastl::vector<AssetDBEntry> m_allDbs;
-        std::shared_mutex m_mutex;
+        mutable std::shared_mutex m_mutex;
     };
 }  // namespace nau
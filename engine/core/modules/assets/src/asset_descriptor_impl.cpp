@@ -67,10 +67,28 @@ namespace nau
             return m_parentAsset->getInnerCachedAssetViewState(m_assetInnerPath, viewType, opts);
         }
 
-        void load() override
+        void load(AssetLoadPriority priority) override
         {
             NAU_FATAL(m_parentAsset);
-            m_parentAsset->load();
+            m_parentAsset->load(priority);
+        }
+
+        void setLoadPriority(AssetLoadPriority priority) override
+        {
+            NAU_FATAL(m_parentAsset);
+            m_parentAsset->setLoadPriority(priority);
+        }
+
+        void addAssetRef() override
+        {
+            NAU_FATAL(m_parentAsset);
+            m_parentAsset->addAssetRef();
+        }
+
+        void releaseAssetRef() override
+        {
+            NAU_FATAL(m_parentAsset);
+            m_parentAsset->releaseAssetRef();
         }
 
         UnloadResult unload() override
@@ -91,7 +109,8 @@ namespace nau
         const AssetPath m_assetFullPath;
     };
 
-    AssetDescriptorImpl::AssetViewEntry::AssetViewEntry(eastl::string assetInnerPath, const rtti::TypeInfo* viewType) :
+    AssetDescriptorImpl::AssetViewEntry::AssetViewEntry(AssetId assetId, eastl::string assetInnerPath, const rtti::TypeInfo* viewType) :
+        m_assetId(assetId),
         m_assetInnerPath(std::move(assetInnerPath)),
         m_viewType(viewType)
     {
@@ -126,10 +145,61 @@ namespace nau
         return m_assetViewRef.isDead();
     }
 
+    bool AssetDescriptorImpl::AssetViewEntry::hasNoDirectAssetViewReferences()
+    {
+        lock_(m_mutex);
+        if (m_assetViewCreationState)
+        {  // the view is fabricating
+            return false;
+        }
+
+        IAssetView::Ptr assetView = m_assetViewRef.lock();
+        if (!assetView)
+        {
+            return true;
+        }
+
+        uint32_t ownReferences = 1;  // assetView
+        if (auto reloadableAssetView = m_reloadableAssetViewRef.lock(); reloadableAssetView)
+        {
+            lock_(reloadableAssetView->m_mutex);
+            if (reloadableAssetView->m_assetView == assetView)
+            {
+                ++ownReferences;
+            }
+        }
+
+        return assetView->getRefsCount() <= ownReferences;
+    }
+
+    bool AssetDescriptorImpl::AssetViewEntry::isReferenced()
+    {
+        lock_(m_mutex);
+        return !m_assetViewRef.isDead() || !m_reloadableAssetViewRef.isDead();
+    }
+
+    bool AssetDescriptorImpl::AssetViewEntry::checkReloadableAssetViewIsUsed()
+    {
+        lock_(m_mutex);
+        auto reloadableAssetView = m_reloadableAssetViewRef.lock();
+        return reloadableAssetView && reloadableAssetView->checkIsUsed();
+    }
+
+    void AssetDescriptorImpl::AssetViewEntry::evictAssetView(Functor<void()> reloadRequest)
+    {
+        lock_(m_mutex);
+        if (auto reloadableAssetView = m_reloadableAssetViewRef.lock(); reloadableAssetView)
+        {
+            reloadableAssetView->evictAssetView(std::move(reloadRequest));
+        }
+    }
+
     async::Task<IAssetView::Ptr> AssetDescriptorImpl::AssetViewEntry::fabricateAssetView(IAssetContainer& container)
     {
         IAssetView::Ptr assetView;
 
+        const auto fabricatePhase = AssetManagerImpl::getInstance().getLoadTimeline().measurePhase(m_assetId, AssetLoadPhase::FabricateView);
+
         nau::Ptr<> asset = container.getAsset(m_assetInnerPath);
         NAU_ASSERT(asset);
         if (!asset)
@@ -254,12 +324,14 @@ namespace nau
         if (oldAssetView)
         {
             co_await AssetManagerImpl::getInstance().updateAssetView(assetId, *m_viewType, oldAssetView, newAssetView);
+        }
+
+        // The reloadable view can be alive without the old view: when the asset was unloaded by the residency manager.
+        {
+            lock_(m_mutex);
+            if (auto reloadableAssetView = m_reloadableAssetViewRef.lock(); reloadableAssetView)
             {
-                lock_(m_mutex);
-                if (auto reloadableAssetView = m_reloadableAssetViewRef.lock(); reloadableAssetView)
-                {
-                    reloadableAssetView->reloadAssetView(newAssetView);
-                }
+                reloadableAssetView->reloadAssetView(newAssetView);
             }
         }
     }
@@ -298,11 +370,12 @@ namespace nau
         return m_container.get();
     }
 
-    async::Task<IAssetContainer::Ptr> AssetDescriptorImpl::getContainer()
+    async::Task<IAssetContainer::Ptr> AssetDescriptorImpl::getContainer(AssetLoadPriority priority)
     {
         using namespace nau::async;
 
         bool needToLoadContainer = false;
+        bool priorityRaised = false;
 
         {
             lock_(m_mutex);
@@ -315,15 +388,66 @@ namespace nau
             {  // first request to the specified asset container
                 m_containerLoadingState.emplace();
                 m_containerLoadingState.setAutoResetOnReady(true);
+                m_loadPriority = priority;
+            }
+            else if (priority < m_loadPriority)
+            {
+                m_loadPriority = priority;
+                priorityRaised = true;
             }
         }
 
+        AssetLoadScheduler& loadScheduler = AssetManagerImpl::getInstance().getLoadScheduler();
+        if (priorityRaised)
+        {  // the pending asset became more needed: move its load forward (if it is still waiting)
+            loadScheduler.setLoadPriority(this, priority);
+        }
+
         NAU_FATAL(m_containerLoadingState);
         if (needToLoadContainer)
         {  // load container and return it as result
             NAU_FATAL(m_containerLoader);
 
-            Result<IAssetContainer::Ptr> loadContainerResult = co_await m_containerLoader().doTry();
+            // The load can outlive all external references to the descriptor (i.e. when it is started by the AssetRef).
+            const nau::Ptr<AssetDescriptorImpl> selfRef{this};
+
+            AssetLoadTimeline& loadTimeline = AssetManagerImpl::getInstance().getLoadTimeline();
+            if (loadTimeline.isActive())
+            {
+                loadTimeline.setAssetPath(m_assetId, m_assetPath.toString());
+            }
+
+            // The dependencies are queued with the same priority: they are required as soon as the asset itself.
+            AssetManagerImpl::getInstance().prefetchAssetDependencies(m_assetPath, m_assetId, priority);
+
+            auto queueWaitPhase = loadTimeline.measurePhase(m_assetId, AssetLoadPhase::QueueWait);
+            Task<bool> loadSlot = loadScheduler.acquireLoadSlot(this, priority);
+            if (!loadSlot.isReady())
+            {
+                // the priority could be changed by the concurrent request before the load was queued.
+                AssetLoadPriority actualPriority = priority;
+                {
+                    lock_(m_mutex);
+                    actualPriority = m_loadPriority;
+                }
+
+                if (actualPriority != priority)
+                {
+                    loadScheduler.setLoadPriority(this, actualPriority);
+                }
+            }
+
+            const bool loadSlotAcquired = co_await loadSlot;
+            queueWaitPhase.end();
+
+            if (!loadSlotAcquired)
+            {
+                m_containerLoadingState.resolve(nullptr);
+                co_return nullptr;
+            }
+
+            Result<IAssetContainer::Ptr> loadContainerResult = co_await m_containerLoader(m_assetId).doTry();
+            loadScheduler.releaseLoadSlot();
             NAU_ASSERT(!m_container);
 
             if (!loadContainerResult)
@@ -340,6 +464,11 @@ namespace nau
                 eastl::vector<Task<>> updateTasks;
                 for (AssetViewEntry& viewEntry : m_assetViews)
                 {
+                    if (!viewEntry.isReferenced())
+                    {  // nobody needs the view anymore: it will be fabricated with the next request
+                        continue;
+                    }
+
                     if (auto task = viewEntry.updateAssetView(m_assetId, *m_container); task && !task.isReady())
                     {
                         updateTasks.emplace_back(std::move(task));
@@ -361,6 +490,8 @@ namespace nau
 
     async::Task<IAssetView::Ptr> AssetDescriptorImpl::getInnerAssetView(eastl::string_view innerPath, const rtti::TypeInfo* viewType)
     {
+        touch();
+
         auto container = co_await getContainer();
         if (!container)
         {
@@ -379,7 +510,7 @@ namespace nau
 
             if (viewEntryIter == m_assetViews.end())
             {
-                m_assetViews.emplace_back(eastl::string{innerPath}, viewType);
+                m_assetViews.emplace_back(m_assetId, eastl::string{innerPath}, viewType);
                 return m_assetViews.back();
             }
 
@@ -393,6 +524,8 @@ namespace nau
 
     async::Task<ReloadableAssetView::Ptr> AssetDescriptorImpl::getInnerReloadableAssetView(eastl::string_view innerPath, const rtti::TypeInfo* viewType)
     {
+        touch();
+
         auto container = co_await getContainer();
         if (!container)
         {
@@ -411,7 +544,7 @@ namespace nau
 
             if (viewEntryIter == m_assetViews.end())
             {
-                m_assetViews.emplace_back(eastl::string{innerPath}, viewType);
+                m_assetViews.emplace_back(m_assetId, eastl::string{innerPath}, viewType);
                 return m_assetViews.back();
             }
 
@@ -425,6 +558,8 @@ namespace nau
 
     async::Task<nau::Ptr<>> AssetDescriptorImpl::getInnerRawAsset(eastl::string_view innerPath)
     {
+        touch();
+
         auto container = co_await getContainer();
         if (!container)
         {
@@ -506,14 +641,45 @@ namespace nau
         return m_assetPath;
     }
 
-    void AssetDescriptorImpl::load()
+    void AssetDescriptorImpl::load(AssetLoadPriority priority)
     {
         if (lock_(m_mutex); m_container)
         {  // container already loaded - nothing to do.
             return;
         }
 
-        [[maybe_unused]] auto t = getContainer().detach();
+        [[maybe_unused]] auto t = getContainer(priority).detach();
+    }
+
+    void AssetDescriptorImpl::setLoadPriority(AssetLoadPriority priority)
+    {
+        {
+            lock_(m_mutex);
+            if (m_container || !m_containerLoadingState || m_loadPriority == priority)
+            {
+                return;
+            }
+
+            m_loadPriority = priority;
+        }
+
+        AssetManagerImpl::getInstance().getLoadScheduler().setLoadPriority(this, priority);
+    }
+
+    void AssetDescriptorImpl::addAssetRef()
+    {
+        m_assetRefCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void AssetDescriptorImpl::releaseAssetRef()
+    {
+        const uint32_t refCount = m_assetRefCount.fetch_sub(1, std::memory_order_acq_rel);
+        NAU_ASSERT(refCount > 0);
+
+        if (refCount == 1)
+        {  // nobody wants the asset anymore: the load that is not started yet is not needed too.
+            AssetManagerImpl::getInstance().getLoadScheduler().cancelLoad(this);
+        }
     }
 
     IAssetDescriptor::UnloadResult AssetDescriptorImpl::unload()
@@ -538,6 +704,98 @@ namespace nau
         return hasNoViewReferences ? UnloadResult::Unloaded : UnloadResult::UnloadedHasReferences;
     }
 
+    void AssetDescriptorImpl::touch()
+    {
+        m_lastUseFrame.store(AssetManagerImpl::getInstance().getResidency().getCurrentFrame(), std::memory_order_relaxed);
+    }
+
+    eastl::optional<AssetDescriptorImpl::ResidencyState> AssetDescriptorImpl::getResidencyState(uint64_t currentFrame)
+    {
+        lock_(m_mutex);
+        if (!m_container)
+        {
+            return eastl::nullopt;
+        }
+
+        ResidencyState state{.isUnused = true};
+        bool hasFootprint = false;
+
+        const auto addFootprint = [&state, &hasFootprint](IRttiObject& object)
+        {
+            if (IAssetMemoryFootprint* const footprint = object.as<IAssetMemoryFootprint*>())
+            {
+                if (!hasFootprint)
+                {  // the category of the first view (or the container) is the category of the asset
+                    state.category = footprint->getMemoryCategory();
+                    hasFootprint = true;
+                }
+
+                state.footprint += footprint->getMemoryFootprint();
+            }
+        };
+
+        for (AssetViewEntry& viewEntry : m_assetViews)
+        {
+            if (viewEntry.checkReloadableAssetViewIsUsed())
+            {
+                m_lastUseFrame.store(currentFrame, std::memory_order_relaxed);
+            }
+
+            if (IAssetView::Ptr assetView = viewEntry.getFabricatedAssetView())
+            {
+                addFootprint(*assetView);
+            }
+
+            state.isUnused = state.isUnused && viewEntry.hasNoDirectAssetViewReferences();
+        }
+
+        addFootprint(*m_container);
+        state.lastUseFrame = m_lastUseFrame.load(std::memory_order_relaxed);
+
+        return state;
+    }
+
+    bool AssetDescriptorImpl::evict()
+    {
+        IAssetContainer::Ptr container;
+
+        {
+            lock_(m_mutex);
+            if (!m_container || (m_containerLoadingState && !m_containerLoadingState.isReady()))
+            {
+                return false;
+            }
+
+            const bool isUnused = std::all_of(m_assetViews.begin(), m_assetViews.end(), [](AssetViewEntry& viewEntry)
+            {
+                return viewEntry.hasNoDirectAssetViewReferences();
+            });
+
+            if (!isUnused)
+            {
+                return false;
+            }
+
+            for (AssetViewEntry& viewEntry : m_assetViews)
+            {
+                viewEntry.evictAssetView([weakSelf = nau::WeakPtr<AssetDescriptorImpl>{nau::Ptr<AssetDescriptorImpl>{this}}]() mutable
+                {
+                    if (nau::Ptr<AssetDescriptorImpl> self = weakSelf.lock())
+                    {
+                        self->load(AssetLoadPriority::Visible);
+                    }
+                });
+            }
+
+            // The container is released outside of the lock.
+            container = std::move(m_container);
+        }
+
+        AssetUnloaded.post(getBroadcaster(), m_assetId);
+
+        return true;
+    }
+
     IAssetDescriptor::LoadState AssetDescriptorImpl::getLoadState() const
     {
         lock_(m_mutex);
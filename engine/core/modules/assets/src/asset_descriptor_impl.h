@@ -7,6 +7,7 @@
 #include "nau/assets/asset_accessor.h"
 #include "nau/assets/asset_container.h"
 #include "nau/assets/asset_descriptor.h"
+#include "nau/assets/asset_residency.h"
 #include "nau/assets/asset_view.h"
 #include "nau/assets/reloadable_asset_view.h"
 #include "nau/assets/internal/asset_descriptor_inernal.h"
@@ -28,7 +29,10 @@ namespace nau
         NAU_CLASS_(nau::AssetDescriptorImpl, IAssetDescriptor, assets::IAssetDescriptorInternal)
 
     public:
-        using ContainerLoaderFunc = Functor<async::Task<IAssetContainer::Ptr>()>;
+        /**
+            Loads the asset container, the asset id identifies the load in the load timeline.
+         */
+        using ContainerLoaderFunc = Functor<async::Task<IAssetContainer::Ptr>(AssetId)>;
 
         ~AssetDescriptorImpl();
         AssetDescriptorImpl(AssetPath assetPath, ContainerLoaderFunc loader);
@@ -49,19 +53,43 @@ namespace nau
 
         async::Task<nau::Ptr<>> getRawAsset() override;
 
-        void load() override;
+        void load(AssetLoadPriority priority) override;
+
+        void setLoadPriority(AssetLoadPriority priority) override;
 
         IAssetDescriptor::UnloadResult unload() override;
 
         LoadState getLoadState() const override;
 
+        struct ResidencyState
+        {
+            AssetMemoryCategory category = AssetMemoryCategory::Other;
+            AssetMemoryFootprint footprint;
+            uint64_t lastUseFrame = 0;
+            bool isUnused = false;
+        };
+
+        /**
+            Retrieves the memory and the use of the loaded asset, eastl::nullopt if the container is not loaded.
+            The asset is unused when its views are not referenced, except by ReloadableAssetView.
+         */
+        eastl::optional<ResidencyState> getResidencyState(uint64_t currentFrame);
+
+        /**
+            Unloads the container of the unused asset, the asset is loaded again on the next request
+            (including ReloadableAssetView::get()).
+
+            @return false if the asset is not loaded, is loading or is used.
+         */
+        bool evict();
+
 
     private:
         class AssetViewEntry
         {
         public:
             AssetViewEntry() = delete;
-            AssetViewEntry(eastl::string assetInnerPath, const rtti::TypeInfo* viewType);
+            AssetViewEntry(AssetId assetId, eastl::string assetInnerPath, const rtti::TypeInfo* viewType);
             AssetViewEntry(const AssetViewEntry&) = delete;
             ~AssetViewEntry();
 
@@ -71,6 +99,17 @@ namespace nau
 
             bool hasNoAssetViewReferences();
 
+            /**
+                Checks that the asset view is not referenced by anything but the ReloadableAssetView.
+             */
+            bool hasNoDirectAssetViewReferences();
+
+            bool isReferenced();
+
+            bool checkReloadableAssetViewIsUsed();
+
+            void evictAssetView(Functor<void()> reloadRequest);
+
             async::Task<IAssetView::Ptr> getAssetView(IAssetContainer& container);
             async::Task<ReloadableAssetView::Ptr> getReloadableAssetView(IAssetContainer& container);
 
@@ -82,6 +121,7 @@ namespace nau
 
             async::Task<IAssetView::Ptr> fabricateAssetView(IAssetContainer& container);
 
+            const AssetId m_assetId;
             const eastl::string m_assetInnerPath;
             const rtti::TypeInfo* const m_viewType = nullptr;
 
@@ -91,7 +131,9 @@ namespace nau
             threading::SpinLock m_mutex;
         };
 
-        async::Task<IAssetContainer::Ptr> getContainer();
+        async::Task<IAssetContainer::Ptr> getContainer(AssetLoadPriority priority = AssetLoadPriority::Visible);
+
+        void touch();
 
         async::Task<IAssetView::Ptr> getInnerAssetView(eastl::string_view innerPath, const rtti::TypeInfo* viewType);
         async::Task<ReloadableAssetView::Ptr> getInnerReloadableAssetView(eastl::string_view innerPath, const rtti::TypeInfo* viewType);
@@ -102,12 +144,19 @@ namespace nau
 
         eastl::optional<assets::AssetInternalState> getCachedAssetViewInternalState(const rtti::TypeInfo* viewType, assets::InternalStateOptsFlag) override;
 
+        void addAssetRef() override;
+
+        void releaseAssetRef() override;
+
 
         const AssetId m_assetId = 0;
         const AssetPath m_assetPath;
         ContainerLoaderFunc m_containerLoader;
         IAssetContainer::Ptr m_container;
         async::MultiTaskSource<IAssetContainer::Ptr> m_containerLoadingState = nullptr;
+        AssetLoadPriority m_loadPriority = AssetLoadPriority::Background;
+        std::atomic<uint32_t> m_assetRefCount = 0;
+        std::atomic<uint64_t> m_lastUseFrame = 0;
         eastl::list<AssetViewEntry, EastlBlockAllocator<alignedSize(sizeof(AssetViewEntry), 64)>> m_assetViews;
         mutable std::mutex m_mutex;
 
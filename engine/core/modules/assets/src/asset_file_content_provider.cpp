@@ -7,6 +7,7 @@
 #include "nau/assets/import_settings_provider.h"
 #include "nau/io/file_system.h"
 #include "nau/service/service_provider.h"
+#include "nau/utils/performance_profiling.h"
 
 namespace nau
 {
@@ -18,6 +19,8 @@ namespace nau
         auto& fileSystem = getServiceProvider().get<io::IFileSystem>();
 
         const eastl::string_view containerPath = assetPath.getContainerPath();
+        NAU_CPU_SCOPED_TAG_NAME("OpenAssetContent", nau::PerfTag::Assets);
+        NAU_CPU_SCOPED_TAG_TEXT(containerPath.data(), containerPath.size());
 
         auto file = fileSystem.openFile(containerPath, {io::AccessMode::Read, io::AccessMode::Async}, io::OpenFileMode::OpenExisting);
         if (!file)
@@ -46,9 +49,10 @@ namespace nau
 
         eastl::string assetKind(ext.empty() ? eastl::string_view{} : ext.substr(1, ext.size()));
 
+        // The file itself is returned (not the stream): the asset manager reads the content with the async file reads.
         return AssetContent{
-            file->createStream(),
-            {.kind = std::move(assetKind), .path = std::move(containerPath), .importSettings = importSettings ? importSettings->as<RuntimeObject*>() : nullptr}
+            file,
+            {.kind = std::move(assetKind), .path = std::move(containerPath), .importSettings = std::move(importSettings)}
         };
     }
 
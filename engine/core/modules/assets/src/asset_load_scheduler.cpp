@@ -0,0 +1,140 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "./asset_load_scheduler.h"
+
+#include "nau/app/global_properties.h"
+#include "nau/service/service_provider.h"
+
+namespace nau
+{
+    async::Task<bool> AssetLoadScheduler::acquireLoadSlot(const AssetDescriptorImpl* asset, AssetLoadPriority priority)
+    {
+        NAU_ASSERT(asset);
+
+        lock_(m_mutex);
+
+        // There are no waiting loads while the limit is not reached: the load can be started immediately.
+        if (m_loadsInFlight < getMaxLoadsInFlight())
+        {
+            ++m_loadsInFlight;
+            return async::Task<bool>::makeResolved(true);
+        }
+
+        PendingLoad& pendingLoad = m_pendingLoads[static_cast<size_t>(priority)].emplace_back();
+        pendingLoad.asset = asset;
+
+        return pendingLoad.slot.getTask();
+    }
+
+    void AssetLoadScheduler::releaseLoadSlot()
+    {
+        async::TaskSource<bool> nextLoadSlot = nullptr;
+
+        {
+            lock_(m_mutex);
+            NAU_ASSERT(m_loadsInFlight > 0);
+
+            for (PendingLoadQueue& queue : m_pendingLoads)
+            {
+                if (!queue.empty())
+                {
+                    nextLoadSlot = std::move(queue.front().slot);
+                    queue.pop_front();
+                    break;
+                }
+            }
+
+            if (!nextLoadSlot)
+            {
+                --m_loadsInFlight;
+            }
+        }
+
+        // The slot is passed to the next load as is (m_loadsInFlight is not changed).
+        // Resolved outside of the lock: the waiting load can be continued immediately within this call.
+        if (nextLoadSlot)
+        {
+            nextLoadSlot.resolve(true);
+        }
+    }
+
+    void AssetLoadScheduler::setLoadPriority(const AssetDescriptorImpl* asset, AssetLoadPriority priority)
+    {
+        lock_(m_mutex);
+
+        if (eastl::optional<PendingLoad> pendingLoad = extractPendingLoad(asset))
+        {
+            m_pendingLoads[static_cast<size_t>(priority)].push_back(*std::move(pendingLoad));
+        }
+    }
+
+    bool AssetLoadScheduler::cancelLoad(const AssetDescriptorImpl* asset)
+    {
+        eastl::optional<PendingLoad> pendingLoad;
+        {
+            lock_(m_mutex);
+            pendingLoad = extractPendingLoad(asset);
+        }
+
+        if (!pendingLoad)
+        {
+            return false;
+        }
+
+        pendingLoad->slot.resolve(false);
+        return true;
+    }
+
+    AssetLoadStats AssetLoadScheduler::getLoadStats()
+    {
+        lock_(m_mutex);
+
+        AssetLoadStats stats;
+        stats.loadsInFlight = static_cast<uint32_t>(m_loadsInFlight);
+        for (const PendingLoadQueue& queue : m_pendingLoads)
+        {
+            stats.pendingLoads += static_cast<uint32_t>(queue.size());
+        }
+
+        return stats;
+    }
+
+    eastl::optional<AssetLoadScheduler::PendingLoad> AssetLoadScheduler::extractPendingLoad(const AssetDescriptorImpl* asset)
+    {
+        for (PendingLoadQueue& queue : m_pendingLoads)
+        {
+            auto iter = eastl::find_if(queue.begin(), queue.end(), [asset](const PendingLoad& pendingLoad)
+            {
+                return pendingLoad.asset == asset;
+            });
+
+            if (iter != queue.end())
+            {
+                PendingLoad pendingLoad = std::move(*iter);
+                queue.erase(iter);
+                return pendingLoad;
+            }
+        }
+
+        return eastl::nullopt;
+    }
+
+    size_t AssetLoadScheduler::getMaxLoadsInFlight()
+    {
+        // Read on the first load: the global properties may be not available yet while the asset manager is created.
+        if (!m_maxLoadsInFlight)
+        {
+            eastl::optional<uint32_t> maxLoadsInFlight;
+            if (getServiceProvider().has<GlobalProperties>())
+            {
+                maxLoadsInFlight = getServiceProvider().get<GlobalProperties>().getValue<uint32_t>("/assets/maxLoadsInFlight");
+            }
+
+            m_maxLoadsInFlight = std::max<size_t>(maxLoadsInFlight.value_or(DefaultMaxLoadsInFlight), 1);
+        }
+
+        return *m_maxLoadsInFlight;
+    }
+}  // namespace nau
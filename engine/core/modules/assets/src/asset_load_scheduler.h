@@ -0,0 +1,77 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <EASTL/array.h>
+#include <EASTL/deque.h>
+#include <EASTL/optional.h>
+
+#include <mutex>
+
+#include "nau/assets/asset_descriptor.h"
+#include "nau/assets/asset_manager.h"
+#include "nau/async/task.h"
+
+namespace nau
+{
+    class AssetDescriptorImpl;
+
+    /**
+        Orders the asset container loads by their priorities and limits the number of loads in flight
+        (opening, reading and decoding of the asset content).
+
+        A load waits for a slot (acquireLoadSlot) before the asset content is opened and returns the slot (releaseLoadSlot)
+        when the container is loaded. While the load is waiting it can be moved to another priority or cancelled.
+
+        The limit is set by "/assets/maxLoadsInFlight" (DefaultMaxLoadsInFlight if not set).
+     */
+    class AssetLoadScheduler
+    {
+    public:
+        static constexpr size_t DefaultMaxLoadsInFlight = 8;
+
+        /**
+            @return Task that is resolved with true when the load can be started, or with false if the load is cancelled while waiting.
+         */
+        async::Task<bool> acquireLoadSlot(const AssetDescriptorImpl* asset, AssetLoadPriority priority);
+
+        void releaseLoadSlot();
+
+        /**
+            Moves the waiting load to the specified priority (at the end of its queue). Started loads are not affected.
+         */
+        void setLoadPriority(const AssetDescriptorImpl* asset, AssetLoadPriority priority);
+
+        /**
+            @return true if the load was waiting to be started and is cancelled.
+         */
+        bool cancelLoad(const AssetDescriptorImpl* asset);
+
+        AssetLoadStats getLoadStats();
+
+    private:
+        static constexpr size_t PriorityCount = static_cast<size_t>(AssetLoadPriority::Background) + 1;
+
+        struct PendingLoad
+        {
+            const AssetDescriptorImpl* asset = nullptr;
+            async::TaskSource<bool> slot;
+        };
+
+        using PendingLoadQueue = eastl::deque<PendingLoad>;
+
+        /**
+            This method does require that m_mutex are locked by caller.
+         */
+        eastl::optional<PendingLoad> extractPendingLoad(const AssetDescriptorImpl* asset);
+
+        size_t getMaxLoadsInFlight();
+
+        eastl::array<PendingLoadQueue, PriorityCount> m_pendingLoads;
+        size_t m_loadsInFlight = 0;
+        eastl::optional<size_t> m_maxLoadsInFlight;
+        std::mutex m_mutex;
+    };
+}  // namespace nau
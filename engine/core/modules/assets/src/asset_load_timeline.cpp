@@ -0,0 +1,327 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "./asset_load_timeline.h"
+
+#include <EASTL/sort.h>
+
+namespace nau
+{
+    namespace
+    {
+        const char* getPhaseName(AssetLoadPhase phase)
+        {
+            switch (phase)
+            {
+                case AssetLoadPhase::QueueWait:
+                    return "QueueWait";
+                case AssetLoadPhase::Open:
+                    return "Open";
+                case AssetLoadPhase::Read:
+                    return "Read";
+                case AssetLoadPhase::Parse:
+                    return "Parse";
+                default:
+                    return "FabricateView";
+            }
+        }
+
+        double toMs(uint64_t timeNs)
+        {
+            return static_cast<double>(timeNs) / 1'000'000.0;
+        }
+
+        eastl::string escapeJson(eastl::string_view str)
+        {
+            eastl::string result;
+            result.reserve(str.size());
+            for (const char c : str)
+            {
+                if (c == '"' || c == '\\')
+                {
+                    result.push_back('\\');
+                }
+                result.push_back(static_cast<unsigned char>(c) < 0x20 ? ' ' : c);
+            }
+
+            return result;
+        }
+
+        Result<> writeText(io::IStreamWriter& stream, eastl::string& text, bool force = false)
+        {
+            constexpr size_t FlushSize = 64 * 1024;
+
+            if (text.size() >= FlushSize || (force && !text.empty()))
+            {
+                NauCheckResult(stream.write(reinterpret_cast<const std::byte*>(text.data()), text.size()));
+                text.clear();
+            }
+
+            return ResultSuccess;
+        }
+    }  // namespace
+
+    AssetLoadTimeline::PhaseScope::PhaseScope(AssetLoadTimeline* timeline, IAssetDescriptor::AssetId assetId, AssetLoadPhase phase) :
+        m_timeline(timeline),
+        m_assetId(assetId),
+        m_phase(phase),
+        m_startTime(std::chrono::steady_clock::now())
+    {
+    }
+
+    AssetLoadTimeline::PhaseScope::PhaseScope(PhaseScope&& other) :
+        m_timeline(eastl::exchange(other.m_timeline, nullptr)),
+        m_assetId(other.m_assetId),
+        m_phase(other.m_phase),
+        m_startTime(other.m_startTime)
+    {
+    }
+
+    AssetLoadTimeline::PhaseScope::~PhaseScope()
+    {
+        end();
+    }
+
+    AssetLoadTimeline::PhaseScope& AssetLoadTimeline::PhaseScope::operator=(PhaseScope&& other)
+    {
+        end();
+        m_timeline = eastl::exchange(other.m_timeline, nullptr);
+        m_assetId = other.m_assetId;
+        m_phase = other.m_phase;
+        m_startTime = other.m_startTime;
+
+        return *this;
+    }
+
+    void AssetLoadTimeline::PhaseScope::end()
+    {
+        if (AssetLoadTimeline* const timeline = eastl::exchange(m_timeline, nullptr); timeline)
+        {
+            timeline->addSpan(m_assetId, m_phase, m_startTime, std::chrono::steady_clock::now());
+        }
+    }
+
+    void AssetLoadTimeline::start()
+    {
+        lock_(m_mutex);
+        m_records.clear();
+        m_recordIndices.clear();
+        m_startTime = std::chrono::steady_clock::now();
+        m_isActive.store(true, std::memory_order_release);
+    }
+
+    void AssetLoadTimeline::stop()
+    {
+        m_isActive.store(false, std::memory_order_release);
+    }
+
+    bool AssetLoadTimeline::isActive() const
+    {
+        return m_isActive.load(std::memory_order_acquire);
+    }
+
+    AssetLoadTimeline::PhaseScope AssetLoadTimeline::measurePhase(IAssetDescriptor::AssetId assetId, AssetLoadPhase phase)
+    {
+        if (!isActive())
+        {
+            return {};
+        }
+
+        return PhaseScope{this, assetId, phase};
+    }
+
+    void AssetLoadTimeline::setAssetPath(IAssetDescriptor::AssetId assetId, eastl::string_view path)
+    {
+        if (!isActive())
+        {
+            return;
+        }
+
+        lock_(m_mutex);
+        getRecord(assetId).path = path;
+    }
+
+    void AssetLoadTimeline::setAssetKind(IAssetDescriptor::AssetId assetId, eastl::string_view kind)
+    {
+        if (!isActive())
+        {
+            return;
+        }
+
+        lock_(m_mutex);
+        getRecord(assetId).kind = kind;
+    }
+
+    void AssetLoadTimeline::setParentAsset(IAssetDescriptor::AssetId assetId, IAssetDescriptor::AssetId parentAssetId)
+    {
+        if (!isActive())
+        {
+            return;
+        }
+
+        lock_(m_mutex);
+        AssetLoadRecord& record = getRecord(assetId);
+        // The first requester is kept: the asset is loaded once for all of them
+        if (record.parentAssetId == 0)
+        {
+            record.parentAssetId = parentAssetId;
+        }
+    }
+
+    AssetLoadRecord& AssetLoadTimeline::getRecord(IAssetDescriptor::AssetId assetId)
+    {
+        auto [iter, emplaced] = m_recordIndices.emplace(assetId, m_records.size());
+        if (emplaced)
+        {
+            m_records.emplace_back().assetId = assetId;
+        }
+
+        return m_records[iter->second];
+    }
+
+    void AssetLoadTimeline::addSpan(IAssetDescriptor::AssetId assetId, AssetLoadPhase phase, std::chrono::steady_clock::time_point startTime, std::chrono::steady_clock::time_point endTime)
+    {
+        using namespace std::chrono;
+
+        lock_(m_mutex);
+        // The phase could be started within the previous timeline
+        if (!isActive() || startTime < m_startTime)
+        {
+            return;
+        }
+
+        getRecord(assetId).spans.push_back({
+            .phase = phase,
+            .startNs = static_cast<uint64_t>(duration_cast<nanoseconds>(startTime - m_startTime).count()),
+            .durationNs = static_cast<uint64_t>(duration_cast<nanoseconds>(endTime - startTime).count())});
+    }
+
+    eastl::vector<AssetLoadRecord> AssetLoadTimeline::getRecords() const
+    {
+        lock_(m_mutex);
+        return m_records;
+    }
+
+    eastl::vector<AssetKindLoadStats> AssetLoadTimeline::getStatsByKind() const
+    {
+        eastl::vector<AssetKindLoadStats> stats;
+        for (const AssetLoadRecord& record : getRecords())
+        {
+            auto kindStats = eastl::find_if(stats.begin(), stats.end(), [&record](const AssetKindLoadStats& kindStats)
+            {
+                return kindStats.kind == record.kind;
+            });
+
+            if (kindStats == stats.end())
+            {
+                kindStats = &stats.emplace_back();
+                kindStats->kind = record.kind;
+            }
+
+            uint64_t assetTimeNs = 0;
+            for (size_t i = 0; i < AssetLoadPhaseCount; ++i)
+            {
+                const uint64_t phaseTimeNs = record.getPhaseTimeNs(static_cast<AssetLoadPhase>(i));
+                kindStats->phaseTimeNs[i] += phaseTimeNs;
+                assetTimeNs += phaseTimeNs;
+            }
+
+            ++kindStats->assetCount;
+            kindStats->maxAssetTimeNs = eastl::max(kindStats->maxAssetTimeNs, assetTimeNs);
+        }
+
+        const auto getTotalTime = [](const AssetKindLoadStats& kindStats)
+        {
+            uint64_t time = 0;
+            for (const uint64_t phaseTimeNs : kindStats.phaseTimeNs)
+            {
+                time += phaseTimeNs;
+            }
+            return time;
+        };
+
+        eastl::sort(stats.begin(), stats.end(), [&getTotalTime](const AssetKindLoadStats& left, const AssetKindLoadStats& right)
+        {
+            return getTotalTime(left) > getTotalTime(right);
+        });
+
+        return stats;
+    }
+
+    Result<> AssetLoadTimeline::writeReport(io::IStreamWriter& stream) const
+    {
+        const eastl::vector<AssetLoadRecord> records = getRecords();
+
+        eastl::string text;
+        text.append_sprintf("%-8s %-8s %-16s %10s %10s %10s %10s %10s %10s  %s\n",
+                            "id", "parent", "kind", "queue,ms", "open,ms", "read,ms", "parse,ms", "view,ms", "total,ms", "path");
+
+        for (const AssetLoadRecord& record : records)
+        {
+            eastl::array<uint64_t, AssetLoadPhaseCount> phaseTimeNs;
+            uint64_t totalTimeNs = 0;
+            for (size_t i = 0; i < AssetLoadPhaseCount; ++i)
+            {
+                phaseTimeNs[i] = record.getPhaseTimeNs(static_cast<AssetLoadPhase>(i));
+                totalTimeNs += phaseTimeNs[i];
+            }
+
+            text.append_sprintf("%-8llu %-8llu %-16s %10.3f %10.3f %10.3f %10.3f %10.3f %10.3f  %s\n",
+                                static_cast<unsigned long long>(record.assetId), static_cast<unsigned long long>(record.parentAssetId), record.kind.c_str(),
+                                toMs(phaseTimeNs[0]), toMs(phaseTimeNs[1]), toMs(phaseTimeNs[2]), toMs(phaseTimeNs[3]), toMs(phaseTimeNs[4]), toMs(totalTimeNs),
+                                record.path.c_str());
+
+            NauCheckResult(writeText(stream, text));
+        }
+
+        text.append_sprintf("\n%-16s %8s %10s %10s %10s %10s %10s %10s %10s\n",
+                            "kind", "assets", "queue,ms", "open,ms", "read,ms", "parse,ms", "view,ms", "avg,ms", "max,ms");
+
+        for (const AssetKindLoadStats& kindStats : getStatsByKind())
+        {
+            uint64_t totalTimeNs = 0;
+            for (const uint64_t phaseTimeNs : kindStats.phaseTimeNs)
+            {
+                totalTimeNs += phaseTimeNs;
+            }
+
+            text.append_sprintf("%-16s %8u %10.3f %10.3f %10.3f %10.3f %10.3f %10.3f %10.3f\n",
+                                kindStats.kind.c_str(), kindStats.assetCount,
+                                toMs(kindStats.phaseTimeNs[0]), toMs(kindStats.phaseTimeNs[1]), toMs(kindStats.phaseTimeNs[2]), toMs(kindStats.phaseTimeNs[3]), toMs(kindStats.phaseTimeNs[4]),
+                                toMs(totalTimeNs / eastl::max(kindStats.assetCount, 1u)), toMs(kindStats.maxAssetTimeNs));
+        }
+
+        return writeText(stream, text, true);
+    }
+
+    Result<> AssetLoadTimeline::writeTraceChromeJson(io::IStreamWriter& stream) const
+    {
+        const eastl::vector<AssetLoadRecord> records = getRecords();
+
+        eastl::string text = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+        text.append("{\"ph\":\"M\",\"pid\":1,\"tid\":0,\"name\":\"process_name\",\"args\":{\"name\":\"asset loads\"}}");
+
+        for (const AssetLoadRecord& record : records)
+        {
+            const auto tid = static_cast<unsigned long long>(record.assetId);
+            const eastl::string path = escapeJson(record.path);
+            const eastl::string kind = escapeJson(record.kind);
+
+            text.append_sprintf(",\n{\"ph\":\"M\",\"pid\":1,\"tid\":%llu,\"name\":\"thread_name\",\"args\":{\"name\":\"%s\"}}", tid, path.c_str());
+
+            for (const AssetLoadSpan& span : record.spans)
+            {
+                text.append_sprintf(",\n{\"ph\":\"X\",\"cat\":\"%s\",\"name\":\"%s\",\"pid\":1,\"tid\":%llu,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"path\":\"%s\",\"parent\":%llu}}",
+                                    kind.c_str(), getPhaseName(span.phase), tid,
+                                    static_cast<double>(span.startNs) / 1000.0, static_cast<double>(span.durationNs) / 1000.0,
+                                    path.c_str(), static_cast<unsigned long long>(record.parentAssetId));
+            }
+
+            NauCheckResult(writeText(stream, text));
+        }
+
+        text.append("\n]}\n");
+        return writeText(stream, text, true);
+    }
+}  // namespace nau
@@ -0,0 +1,84 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <EASTL/unordered_map.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+
+#include "nau/assets/asset_load_timeline.h"
+
+namespace nau
+{
+    /**
+        The storage of the asset load timeline (see IAssetLoadTimeline).
+        While the timeline is not active the phases are not measured: PhaseScope does not even read the clock.
+     */
+    class AssetLoadTimeline
+    {
+    public:
+        /**
+            Measures the phase from the creation till end() (or the destruction), can be held across co_await.
+         */
+        class PhaseScope
+        {
+        public:
+            PhaseScope() = default;
+            PhaseScope(AssetLoadTimeline* timeline, IAssetDescriptor::AssetId assetId, AssetLoadPhase phase);
+            PhaseScope(PhaseScope&&);
+            PhaseScope(const PhaseScope&) = delete;
+            ~PhaseScope();
+
+            PhaseScope& operator=(PhaseScope&&);
+            PhaseScope& operator=(const PhaseScope&) = delete;
+
+            void end();
+
+        private:
+            AssetLoadTimeline* m_timeline = nullptr;
+            IAssetDescriptor::AssetId m_assetId = 0;
+            AssetLoadPhase m_phase = AssetLoadPhase::QueueWait;
+            std::chrono::steady_clock::time_point m_startTime;
+        };
+
+        void start();
+
+        void stop();
+
+        bool isActive() const;
+
+        PhaseScope measurePhase(IAssetDescriptor::AssetId assetId, AssetLoadPhase phase);
+
+        void setAssetPath(IAssetDescriptor::AssetId assetId, eastl::string_view path);
+
+        void setAssetKind(IAssetDescriptor::AssetId assetId, eastl::string_view kind);
+
+        void setParentAsset(IAssetDescriptor::AssetId assetId, IAssetDescriptor::AssetId parentAssetId);
+
+        eastl::vector<AssetLoadRecord> getRecords() const;
+
+        eastl::vector<AssetKindLoadStats> getStatsByKind() const;
+
+        Result<> writeReport(io::IStreamWriter& stream) const;
+
+        Result<> writeTraceChromeJson(io::IStreamWriter& stream) const;
+
+    private:
+        /**
+            This method does require that m_mutex are locked by caller.
+         */
+        AssetLoadRecord& getRecord(IAssetDescriptor::AssetId assetId);
+
+        void addSpan(IAssetDescriptor::AssetId assetId, AssetLoadPhase phase, std::chrono::steady_clock::time_point startTime, std::chrono::steady_clock::time_point endTime);
+
+        std::atomic<bool> m_isActive = false;
+        std::chrono::steady_clock::time_point m_startTime;
+        eastl::unordered_map<IAssetDescriptor::AssetId, size_t> m_recordIndices;
+        eastl::vector<AssetLoadRecord> m_records;
+        mutable std::mutex m_mutex;
+    };
+}  // namespace nau
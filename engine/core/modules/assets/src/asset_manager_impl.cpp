@@ -4,15 +4,46 @@
 
 #include "./asset_manager_impl.h"
 
+#include "nau/assets/asset_db.h"
 #include "nau/assets/import_settings_provider.h"
 #include "nau/async/multi_task_source.h"
 #include "nau/diag/error.h"
+#include "nau/io/file_system.h"
+#include "nau/io/memory_stream.h"
 #include "nau/memory/mem_allocator.h"
+#include "nau/memory/memory_stats.h"
 #include "nau/service/service_provider.h"
 #include "nau/string/string_conv.h"
+#include "nau/utils/performance_profiling.h"
 
 namespace nau
 {
+    namespace
+    {
+        /**
+            The file content is read with the async file reads (not blocking the pool thread on the file io),
+            loaders then parse it from the memory.
+         */
+        async::Task<io::IStreamReader::Ptr> openContentStream(nau::Ptr<> content)
+        {
+            if (io::IFile* const file = content->as<io::IFile*>(); file)
+            {
+                BytesBuffer fileContent = co_await io::readFileContentAsync(file);
+                co_return io::createMemoryStream(std::move(fileContent), io::AccessMode::Read);
+            }
+
+            NAU_ASSERT(content->is<io::IStreamReader>());
+
+            io::IStreamReader::Ptr stream = content->as<io::IStreamReader*>();
+            if (!stream)
+            {
+                co_return NauMakeError("Unexpected content type");
+            }
+
+            co_return stream;
+        }
+    }  // namespace
+
     AssetManagerImpl& AssetManagerImpl::getInstance()
     {
         return getServiceProvider().get<AssetManagerImpl>();
@@ -20,6 +51,7 @@ namespace nau
 
     IAssetDescriptor::Ptr AssetManagerImpl::openAsset(const AssetPath& assetPath)
     {
+        NAU_CPU_SCOPED_TAG(nau::PerfTag::Assets);
         using namespace nau::async;
         using namespace nau::io;
 
@@ -48,51 +80,9 @@ namespace nau
         auto iter = m_assets.find_as(resolvedContent.assetPath.getSchemeAndContainerPath());
         if (iter == m_assets.end())
         {
-            AssetDescriptorImpl::ContainerLoaderFunc loaderFunc = [this, resolvedContent]() -> Task<IAssetContainer::Ptr>
+            AssetDescriptorImpl::ContainerLoaderFunc loaderFunc = [this, resolvedContent](IAssetDescriptor::AssetId assetId) -> Task<IAssetContainer::Ptr>
             {
-                const auto& [contentProvider, assetFilePath, incomingContentInfo] = resolvedContent;
-                const Result<IAssetContentProvider::AssetContent> contentResult = contentProvider->openStreamOrContainer(assetFilePath);
-
-                if (!contentResult)
-                {
-                    co_return contentResult.getError();
-                }
-
-                const auto& [content, contentInfo] = *contentResult;
-
-
-                // priority is given to content_info that came from the path resolver,
-                // since it potentially has more information about the asset (for example assetdb).
-                const AssetContentInfo& actualContentInfo = incomingContentInfo ? incomingContentInfo : contentInfo;
-                NAU_ASSERT(actualContentInfo, "Content Info not resolved");
-
-                if (IAssetContainer* const container = content->as<IAssetContainer*>(); container)
-                {
-                    co_return container;
-                }
-                NAU_ASSERT(content->is<io::IStreamReader>());
-
-                auto stream = content->as<io::IStreamReader*>();
-                if (!stream)
-                {
-                    co_return NauMakeError("Unexpected content type");
-                }
-
-                IAssetContainerLoader* const loader = findContainerLoader(actualContentInfo.kind);
-                if (!loader)
-                {
-                    // This may be a case where the content provider returned more up-to-date information about the asset ?
-                    // And maybe it's worth trying to request a container_loader again?
-                    co_return NauMakeError("Unsupported content kind: ({})", actualContentInfo.kind.c_str());
-                }
-
-                Result<IAssetContainer::Ptr> container = co_await loader->loadFromStream(stream, actualContentInfo).doTry();
-                if (!container)
-                {
-                    NAU_LOG_WARNING("Fail to load asset container. Asset kind: ({}), asset filepath: ({}):({})", actualContentInfo.kind.c_str(), assetFilePath.toString(), container.getError()->getMessage());
-                }
-
-                co_return container;
+                return loadAssetContainer(resolvedContent, assetId);
             };
 
             // There is a slight drawback here:
@@ -101,7 +91,7 @@ namespace nau
             nau::Ptr<AssetDescriptorImpl> newAsset = rtti::createInstance<AssetDescriptorImpl>(assetPath.getSchemeAndContainerPath(), std::move(loaderFunc));
 
             [[maybe_unused]] bool emplaceOk = false;
-            eastl::tie(iter, emplaceOk) = m_assets.emplace(resolvedContent.assetPath.getSchemeAndContainerPath(), std::move(newAsset));
+            eastl::tie(iter, emplaceOk) = m_assets.emplace(AssetPath{resolvedContent.assetPath.getSchemeAndContainerPath()}, std::move(newAsset));
             NAU_ASSERT(emplaceOk);
         }
 
@@ -125,7 +115,7 @@ namespace nau
             }
         }
 
-        AssetDescriptorImpl::ContainerLoaderFunc loaderFunc = [this, assetPath]() -> async::Task<IAssetContainer::Ptr>
+        AssetDescriptorImpl::ContainerLoaderFunc loaderFunc = [this, assetPath](IAssetDescriptor::AssetId assetId) -> async::Task<IAssetContainer::Ptr>
         {
             ResolvedContentData resolvedContent;
             {
@@ -138,48 +128,7 @@ namespace nau
                 }
             }
 
-            const auto& [contentProvider, assetFilePath, incomingContentInfo] = resolvedContent;
-            const Result<IAssetContentProvider::AssetContent> contentResult = contentProvider->openStreamOrContainer(assetFilePath);
-
-            if (!contentResult)
-            {
-                co_return contentResult.getError();
-            }
-
-            const auto& [content, contentInfo] = *contentResult;
-
-            // priority is given to content_info that came from the path resolver,
-            // since it potentially has more information about the asset (for example assetdb).
-            const AssetContentInfo& actualContentInfo = incomingContentInfo ? incomingContentInfo : contentInfo;
-            NAU_ASSERT(actualContentInfo, "Content Info not resolved");
-
-            if (IAssetContainer* const container = content->as<IAssetContainer*>(); container)
-            {
-                co_return container;
-            }
-            NAU_ASSERT(content->is<io::IStreamReader>());
-
-            auto stream = content->as<io::IStreamReader*>();
-            if (!stream)
-            {
-                co_return NauMakeError("Unexpected content type");
-            }
-
-            IAssetContainerLoader* const loader = findContainerLoader(actualContentInfo.kind);
-            if (!loader)
-            {
-                // This may be a case where the content provider returned more up-to-date information about the asset ?
-                // And maybe it's worth trying to request a container_loader again?
-                co_return NauMakeError("Unsupported content kind: ({})", actualContentInfo.kind.c_str());
-            }
-
-            Result<IAssetContainer::Ptr> container = co_await loader->loadFromStream(stream, actualContentInfo).doTry();
-            if (!container)
-            {
-                NAU_LOG_WARNING("Fail to load asset container. Asset kind: ({}), asset filepath: ({}):({})", actualContentInfo.kind.c_str(), assetFilePath.toString(), container.getError()->getMessage());
-            }
-
-            co_return container;
+            co_return co_await loadAssetContainer(std::move(resolvedContent), assetId);
         };
 
         return rtti::createInstance<AssetDescriptorImpl>(assetPath, std::move(loaderFunc));
@@ -189,7 +138,7 @@ namespace nau
     {
         shared_lock_(m_mutex);
         // TODO: wrong code. Must search by resolved path
-        auto it = m_assets.find_as(assetPath);
+        auto it = m_assets.find(assetPath);
         if (it != m_assets.end())
         {
             return it->second;
@@ -225,8 +174,13 @@ namespace nau
         }
     }
 
-    void AssetManagerImpl::unload(UnloadAssets flag)
+    void AssetManagerImpl::unload([[maybe_unused]] UnloadAssets flag)
     {
+        // Only the assets that are not used are unloaded (see AssetDescriptorImpl::evict), which is the only mode currently.
+        for (const nau::Ptr<AssetDescriptorImpl>& asset : getAssetsSnapshot())
+        {
+            asset->evict();
+        }
     }
 
     Result<AssetPath> AssetManagerImpl::resolvePath(const AssetPath& assetPath)
@@ -269,14 +223,14 @@ namespace nau
 
         lock_(m_mutex);
 
-        const bool containerExists = m_assets.find_as(assetPath) != m_assets.end();
+        const bool containerExists = m_assets.find(assetPath) != m_assets.end();
         NAU_ASSERT(!containerExists, "Container already exists:({})", assetPath.toString());
         if (containerExists)
         {
             return;
         }
 
-        AssetDescriptorImpl::ContainerLoaderFunc loaderFunc = [container = std::move(container), path = assetPath]() -> Task<IAssetContainer::Ptr>
+        AssetDescriptorImpl::ContainerLoaderFunc loaderFunc = [container = std::move(container), path = assetPath](IAssetDescriptor::AssetId) -> Task<IAssetContainer::Ptr>
         {
             return Task<IAssetContainer::Ptr>::makeResolved(container);
         };
@@ -294,7 +248,7 @@ namespace nau
     {
         lock_(m_mutex);
 
-        auto iter = m_assets.find_as(assetPath);
+        auto iter = m_assets.find(assetPath);
         NAU_ASSERT(iter != m_assets.end(), "Container doesn't exists:({})", assetPath.toString());
         if (iter == m_assets.end())
         {
@@ -305,6 +259,72 @@ namespace nau
         m_assets.erase(iter);
     }
 
+    async::Task<IAssetContainer::Ptr> AssetManagerImpl::loadAssetContainer(ResolvedContentData resolvedContent, IAssetDescriptor::AssetId assetId)
+    {
+        const auto& [contentProvider, assetFilePath, incomingContentInfo] = resolvedContent;
+
+        // The memory tag is thread local: the scopes must not span co_await (the coroutine can be resumed on the other thread).
+        Result<IAssetContentProvider::AssetContent> contentResult;
+        {
+            NAU_MEMORY_SCOPE(Assets);
+            auto openPhase = m_loadTimeline.measurePhase(assetId, AssetLoadPhase::Open);
+            contentResult = contentProvider->openStreamOrContainer(assetFilePath);
+            openPhase.end();
+        }
+
+        if (!contentResult)
+        {
+            co_return contentResult.getError();
+        }
+
+        const auto& [content, contentInfo] = *contentResult;
+
+        // priority is given to content_info that came from the path resolver,
+        // since it potentially has more information about the asset (for example assetdb).
+        const AssetContentInfo& actualContentInfo = incomingContentInfo ? incomingContentInfo : contentInfo;
+        NAU_ASSERT(actualContentInfo, "Content Info not resolved");
+        m_loadTimeline.setAssetKind(assetId, actualContentInfo.kind);
+
+        if (IAssetContainer* const container = content->as<IAssetContainer*>(); container)
+        {
+            co_return container;
+        }
+
+        auto readPhase = m_loadTimeline.measurePhase(assetId, AssetLoadPhase::Read);
+        Result<io::IStreamReader::Ptr> stream = co_await openContentStream(content).doTry();
+        readPhase.end();
+
+        if (!stream)
+        {
+            co_return stream.getError();
+        }
+
+        IAssetContainerLoader* const loader = findContainerLoader(actualContentInfo.kind);
+        if (!loader)
+        {
+            // This may be a case where the content provider returned more up-to-date information about the asset ?
+            // And maybe it's worth trying to request a container_loader again?
+            co_return NauMakeError("Unsupported content kind: ({})", actualContentInfo.kind.c_str());
+        }
+
+        auto parsePhase = m_loadTimeline.measurePhase(assetId, AssetLoadPhase::Parse);
+        async::Task<IAssetContainer::Ptr> loadTask;
+        {
+            // Covers the synchronous part of the loader (up to its first suspension).
+            NAU_MEMORY_SCOPE(Assets);
+            loadTask = loader->loadFromStream(*stream, actualContentInfo);
+        }
+        Result<IAssetContainer::Ptr> container = co_await loadTask.doTry();
+        parsePhase.end();
+
+        if (!container)
+        {
+            NAU_LOG_WARNING("Fail to load asset container. Asset kind: ({}), asset filepath: ({}):({})", actualContentInfo.kind.c_str(), assetFilePath.toString(), container.getError()->getMessage());
+        }
+
+        co_return container;
+    }
+
     IAssetContainerLoader* AssetManagerImpl::findContainerLoader(const eastl::string& kind)
     {
         // BE AWARE: findFileContainerLoader requires that m_mutex is locked
@@ -456,6 +476,139 @@ namespace nau
         return id;
     }
 
+    AssetLoadStats AssetManagerImpl::getLoadStats()
+    {
+        return m_loadScheduler.getLoadStats();
+    }
+
+    AssetLoadScheduler& AssetManagerImpl::getLoadScheduler()
+    {
+        return m_loadScheduler;
+    }
+
+    AssetResidency& AssetManagerImpl::getResidency()
+    {
+        return m_residency;
+    }
+
+    AssetLoadTimeline& AssetManagerImpl::getLoadTimeline()
+    {
+        return m_loadTimeline;
+    }
+
+    void AssetManagerImpl::prefetchAssetDependencies(const AssetPath& assetPath, IAssetDescriptor::AssetId assetId, AssetLoadPriority priority)
+    {
+        // Only the assets from the asset database have the recorded dependencies.
+        if (!assetPath.hasScheme("uid") || !getServiceProvider().has<IAssetDB>())
+        {
+            return;
+        }
+
+        const Result<Uid> uid = Uid::parseString(strings::toStringView(assetPath.getContainerPath()));
+        if (!uid)
+        {
+            return;
+        }
+
+        IAssetDB& assetDb = getServiceProvider().get<IAssetDB>();
+        const eastl::string kind = assetDb.findAssetMetaInfoByUid(*uid).kind;
+        if (kind != "scene" && kind != "prefab")
+        {
+            return;
+        }
+
+        for (const Uid& dependencyUid : assetDb.getAssetDependencies(*uid))
+        {
+            if (IAssetDescriptor::Ptr dependency = openAsset(AssetPath{"uid", strings::toStringView(toString(dependencyUid))}))
+            {
+                m_loadTimeline.setParentAsset(dependency->getAssetId(), assetId);
+                dependency->load(priority);
+            }
+        }
+    }
+
+    void AssetManagerImpl::setMemoryBudget(AssetMemoryCategory category, size_t budgetBytes)
+    {
+        m_residency.setMemoryBudget(category, budgetBytes);
+    }
+
+    size_t AssetManagerImpl::getMemoryBudget(AssetMemoryCategory category) const
+    {
+        return m_residency.getMemoryBudget(category);
+    }
+
+    AssetMemoryFootprint AssetManagerImpl::getMemoryUsage(AssetMemoryCategory category) const
+    {
+        return m_residency.getMemoryUsage(category);
+    }
+
+    void AssetManagerImpl::startLoadTimeline()
+    {
+        m_loadTimeline.start();
+    }
+
+    void AssetManagerImpl::stopLoadTimeline()
+    {
+        m_loadTimeline.stop();
+    }
+
+    bool AssetManagerImpl::isLoadTimelineActive() const
+    {
+        return m_loadTimeline.isActive();
+    }
+
+    eastl::vector<AssetLoadRecord> AssetManagerImpl::getLoadRecords() const
+    {
+        return m_loadTimeline.getRecords();
+    }
+
+    eastl::vector<AssetKindLoadStats> AssetManagerImpl::getLoadStatsByKind() const
+    {
+        return m_loadTimeline.getStatsByKind();
+    }
+
+    Result<> AssetManagerImpl::writeLoadReport(io::IStreamWriter& stream) const
+    {
+        return m_loadTimeline.writeReport(stream);
+    }
+
+    Result<> AssetManagerImpl::writeLoadTraceChromeJson(io::IStreamWriter& stream) const
+    {
+        return m_loadTimeline.writeTraceChromeJson(stream);
+    }
+
+    void AssetManagerImpl::gamePostUpdate([[maybe_unused]] std::chrono::milliseconds dt)
+    {
+        if (!m_residency.advanceFrame())
+        {
+            return;
+        }
+
+        m_residency.update(getAssetsSnapshot());
+    }
+
+    eastl::optional<GameUpdateAccess> AssetManagerImpl::getPostUpdateAccess() const
+    {
+        // The assets map is accessed under m_mutex, the residency state is owned by the update
+        return GameUpdateAccess{
+            .writes = {GameUpdateResource::Assets},
+            .isThreadSafe = true};
+    }
+
+    eastl::vector<nau::Ptr<AssetDescriptorImpl>> AssetManagerImpl::getAssetsSnapshot()
+    {
+        eastl::vector<nau::Ptr<AssetDescriptorImpl>> assets;
+
+        shared_lock_(m_mutex);
+        assets.reserve(m_assets.size());
+        for (const auto& [_, asset] : m_assets)
+        {
+            assets.push_back(asset);
+        }
+
+        return assets;
+    }
+
     async::Task<> AssetManagerImpl::updateAssetView(IAssetDescriptor::AssetId assetId, const rtti::TypeInfo& viewType, IAssetView::Ptr oldAssetView, IAssetView::Ptr newAssetView)
     {
         using namespace nau::async;
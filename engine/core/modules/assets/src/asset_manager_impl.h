@@ -4,14 +4,22 @@
 
 #pragma once
 
+#include <ska_hash_map/flat_hash_map2.hpp>
+
 #include "./asset_descriptor_impl.h"
+#include "./asset_load_scheduler.h"
+#include "./asset_load_timeline.h"
+#include "./asset_residency.h"
 #include "nau/assets/asset_container.h"
 #include "nau/assets/asset_descriptor_factory.h"
 #include "nau/assets/asset_listener.h"
+#include "nau/assets/asset_load_timeline.h"
 #include "nau/assets/asset_manager.h"
 #include "nau/assets/asset_path.h"
 #include "nau/assets/asset_path_resolver.h"
+#include "nau/assets/asset_residency.h"
 #include "nau/assets/asset_view_factory.h"
+#include "nau/app/main_loop/game_system.h"
 #include "nau/async/multi_task_source.h"
 #include "nau/rtti/rtti_impl.h"
 
@@ -23,9 +31,12 @@ namespace nau
     /**
      */
     class AssetManagerImpl final : public IAssetManager,
-                                   public IAssetDescriptorFactory
+                                   public IAssetDescriptorFactory,
+                                   public IAssetResidencyManager,
+                                   public IAssetLoadTimeline,
+                                   public IGamePostUpdate
     {
-        NAU_INTERFACE(nau::AssetManagerImpl, IAssetManager, IAssetDescriptorFactory)
+        NAU_INTERFACE(nau::AssetManagerImpl, IAssetManager, IAssetDescriptorFactory, IAssetResidencyManager, IAssetLoadTimeline, IGamePostUpdate)
 
     public:
         static AssetManagerImpl& getInstance();
@@ -39,6 +50,7 @@ namespace nau
         void removeAsset(const AssetPath& assetPath) override;
         void unload(UnloadAssets flag) override;
         Result<AssetPath> resolvePath(const AssetPath& assetPath) override;
+        AssetLoadStats getLoadStats() override;
 
         IAssetDescriptor::Ptr createAssetDescriptor(IAssetContainer&, eastl::string_view innerPath) override;
 
@@ -49,6 +61,43 @@ namespace nau
 
         IAssetDescriptor::AssetId getNextAssetId();
 
+        AssetLoadScheduler& getLoadScheduler();
+
+        AssetResidency& getResidency();
+
+        AssetLoadTimeline& getLoadTimeline();
+
+        /**
+            Starts the loads of all (transitive) dependencies of the scene asset recorded in the asset database,
+            so the referenced assets are loaded in parallel with the scene instead of being discovered one by one.
+            The scene asset (assetId) is recorded as the dependency parent in the load timeline.
+         */
+        void prefetchAssetDependencies(const AssetPath& assetPath, IAssetDescriptor::AssetId assetId, AssetLoadPriority priority);
+
+        void setMemoryBudget(AssetMemoryCategory category, size_t budgetBytes) override;
+
+        size_t getMemoryBudget(AssetMemoryCategory category) const override;
+
+        AssetMemoryFootprint getMemoryUsage(AssetMemoryCategory category) const override;
+
+        void startLoadTimeline() override;
+
+        void stopLoadTimeline() override;
+
+        bool isLoadTimelineActive() const override;
+
+        eastl::vector<AssetLoadRecord> getLoadRecords() const override;
+
+        eastl::vector<AssetKindLoadStats> getLoadStatsByKind() const override;
+
+        Result<> writeLoadReport(io::IStreamWriter& stream) const override;
+
+        Result<> writeLoadTraceChromeJson(io::IStreamWriter& stream) const override;
+
+        void gamePostUpdate(std::chrono::milliseconds dt) override;
+
+        eastl::optional<GameUpdateAccess> getPostUpdateAccess() const override;
+
         async::Task<> updateAssetView(IAssetDescriptor::AssetId assetId, const rtti::TypeInfo& viewType, IAssetView::Ptr oldAssetView, IAssetView::Ptr newAssetView);
 
     private:
@@ -68,6 +117,11 @@ namespace nau
 
         IAssetContainerLoader* findContainerLoader(const eastl::string& kind);
 
+        /**
+            Opens, reads and parses the resolved asset content, measuring the phases in the load timeline.
+         */
+        async::Task<IAssetContainer::Ptr> loadAssetContainer(ResolvedContentData resolvedContent, IAssetDescriptor::AssetId assetId);
+
         /**
             @brief Resolves assetPath (which can be a virtual path) to actual (real) path.
             Then looks up content provider associated with the real (resolved) path;
@@ -77,11 +131,16 @@ namespace nau
         ResolvedContentData resolveAssetContent(const AssetPath& path);
         const eastl::vector<IAssetListener*>& getAssetListeners();
 
-        eastl::unordered_map<AssetPath, nau::Ptr<AssetDescriptorImpl>> m_assets;
+        eastl::vector<nau::Ptr<AssetDescriptorImpl>> getAssetsSnapshot();
+
+        ska::flat_hash_map<AssetPath, nau::Ptr<AssetDescriptorImpl>> m_assets;
         eastl::unordered_map<eastl::string, IAssetContainerLoader*> m_containerLoaders;
         eastl::unordered_map<eastl::string_view, SchemeHandler> m_schemeHandlers;
         eastl::unordered_map<rtti::TypeIndex, IAssetViewFactory*> m_assetViewFactories;
         eastl::vector<IAssetListener*> m_assetListeners;
+        AssetLoadScheduler m_loadScheduler;
+        AssetResidency m_residency;
+        AssetLoadTimeline m_loadTimeline;
 
         std::atomic<IAssetDescriptor::AssetId> m_nextAssetId{1ui64};
         mutable std::shared_mutex m_mutex;
@@ -4,13 +4,36 @@
 #include "nau/assets/asset_ref.h"
 
 #include "nau/assets/asset_manager.h"
+#include "nau/assets/internal/asset_descriptor_inernal.h"
 #include "nau/service/service_provider.h"
 #include "nau/string/string_conv.h"
 #include "nau/string/string_utils.h"
 
 namespace nau
 {
-    AssetRefBase::~AssetRefBase() = default;
+    namespace
+    {
+        void addAssetRef(const IAssetDescriptor::Ptr& assetDescriptor)
+        {
+            if (auto* const descriptorInternal = assetDescriptor ? assetDescriptor->as<assets::IAssetDescriptorInternal*>() : nullptr)
+            {
+                descriptorInternal->addAssetRef();
+            }
+        }
+
+        void releaseAssetRef(const IAssetDescriptor::Ptr& assetDescriptor)
+        {
+            if (auto* const descriptorInternal = assetDescriptor ? assetDescriptor->as<assets::IAssetDescriptorInternal*>() : nullptr)
+            {
+                descriptorInternal->releaseAssetRef();
+            }
+        }
+    }  // namespace
+
+    AssetRefBase::~AssetRefBase()
+    {
+        releaseAssetRef(m_assetDescriptor);
+    }
 
     AssetRefBase::AssetRefBase(AssetPath assetPath, bool lazyLoad) noexcept
     {
@@ -18,12 +41,14 @@ namespace nau
         {
             if (m_assetDescriptor = getServiceProvider().get<IAssetManager>().openAsset(assetPath); m_assetDescriptor)
             {
+                addAssetRef(m_assetDescriptor);
                 m_assetDescriptor->load();
             }
         }
         else
         {
             m_assetDescriptor = getServiceProvider().get<IAssetManager>().preLoadAsset(assetPath);
+            addAssetRef(m_assetDescriptor);
         }
     }
 
@@ -36,15 +61,47 @@ namespace nau
     AssetRefBase::AssetRefBase(IAssetDescriptor::Ptr assetDescriptor) noexcept :
         m_assetDescriptor(std::move(assetDescriptor))
     {
+        addAssetRef(m_assetDescriptor);
     }
 
-    AssetRefBase::AssetRefBase(const AssetRefBase& other) noexcept = default;
+    AssetRefBase::AssetRefBase(const AssetRefBase& other) noexcept :
+        m_assetDescriptor(other.m_assetDescriptor)
+    {
+        addAssetRef(m_assetDescriptor);
+    }
 
     AssetRefBase::AssetRefBase(AssetRefBase&& other) noexcept = default;
 
-    AssetRefBase& AssetRefBase::operator=(const AssetRefBase& other) noexcept = default;
+    AssetRefBase& AssetRefBase::operator=(const AssetRefBase& other) noexcept
+    {
+        if (this != &other)
+        {
+            addAssetRef(other.m_assetDescriptor);
+            releaseAssetRef(m_assetDescriptor);
+            m_assetDescriptor = other.m_assetDescriptor;
+        }
+
+        return *this;
+    }
+
+    AssetRefBase& AssetRefBase::operator=(AssetRefBase&& other) noexcept
+    {
+        if (this != &other)
+        {
+            releaseAssetRef(m_assetDescriptor);
+            m_assetDescriptor = std::move(other.m_assetDescriptor);
+        }
+
+        return *this;
+    }
 
-    AssetRefBase& AssetRefBase::operator=(AssetRefBase&& other) noexcept = default;
+    AssetRefBase& AssetRefBase::operator=(std::nullptr_t) noexcept
+    {
+        releaseAssetRef(m_assetDescriptor);
+        m_assetDescriptor = nullptr;
+
+        return *this;
+    }
 
     AssetRefBase::operator bool() const
     {
@@ -0,0 +1,148 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "./asset_residency.h"
+
+#include <EASTL/sort.h>
+
+#include "./asset_descriptor_impl.h"
+#include "nau/app/global_properties.h"
+#include "nau/service/service_provider.h"
+#include "nau/utils/performance_profiling.h"
+
+namespace nau
+{
+    uint64_t AssetResidency::getCurrentFrame() const
+    {
+        return m_currentFrame.load(std::memory_order_relaxed);
+    }
+
+    bool AssetResidency::advanceFrame()
+    {
+        const uint64_t frame = m_currentFrame.fetch_add(1, std::memory_order_relaxed) + 1;
+        return frame % UpdateIntervalFrames == 0;
+    }
+
+    void AssetResidency::update(eastl::span<const nau::Ptr<AssetDescriptorImpl>> loadedAssets)
+    {
+        NAU_CPU_SCOPED_TAG(nau::PerfTag::Assets);
+
+        struct EvictionCandidate
+        {
+            AssetDescriptorImpl* asset;
+            uint64_t lastUseFrame;
+            AssetMemoryFootprint footprint;
+        };
+
+        const uint64_t currentFrame = getCurrentFrame();
+        eastl::array<size_t, CategoryCount> budgets;
+        {
+            lock_(m_mutex);
+            readBudgetsConfig();
+            budgets = m_budgets;
+        }
+
+        eastl::array<AssetMemoryFootprint, CategoryCount> usage{};
+        eastl::array<eastl::vector<EvictionCandidate>, CategoryCount> candidates;
+
+        for (const nau::Ptr<AssetDescriptorImpl>& asset : loadedAssets)
+        {
+            const eastl::optional<AssetDescriptorImpl::ResidencyState> state = asset->getResidencyState(currentFrame);
+            if (!state)
+            {
+                continue;
+            }
+
+            const size_t category = static_cast<size_t>(state->category);
+            usage[category] += state->footprint;
+
+            // Assets used since the previous check are kept: otherwise they could be unloaded and loaded again with every check.
+            if (state->isUnused && state->footprint.getTotalBytes() > 0 && state->lastUseFrame + UpdateIntervalFrames <= currentFrame)
+            {
+                candidates[category].push_back({asset.get(), state->lastUseFrame, state->footprint});
+            }
+        }
+
+        for (size_t category = 0; category < CategoryCount; ++category)
+        {
+            AssetMemoryFootprint& categoryUsage = usage[category];
+            const size_t budget = budgets[category];
+            if (budget == 0 || categoryUsage.getTotalBytes() <= budget)
+            {
+                continue;
+            }
+
+            eastl::vector<EvictionCandidate>& categoryCandidates = candidates[category];
+            eastl::sort(categoryCandidates.begin(), categoryCandidates.end(), [](const EvictionCandidate& left, const EvictionCandidate& right)
+            {
+                return left.lastUseFrame < right.lastUseFrame;
+            });
+
+            for (const EvictionCandidate& candidate : categoryCandidates)
+            {
+                if (categoryUsage.getTotalBytes() <= budget)
+                {
+                    break;
+                }
+
+                // The asset can be taken into use after its state is checked: evict() checks it again.
+                if (candidate.asset->evict())
+                {
+                    categoryUsage.cpuBytes -= candidate.footprint.cpuBytes;
+                    categoryUsage.gpuBytes -= candidate.footprint.gpuBytes;
+                }
+            }
+        }
+
+        lock_(m_mutex);
+        m_usage = usage;
+    }
+
+    void AssetResidency::setMemoryBudget(AssetMemoryCategory category, size_t budgetBytes)
+    {
+        lock_(m_mutex);
+
+        // The config is read first to be not applied over the explicitly set budget.
+        readBudgetsConfig();
+        m_budgets[static_cast<size_t>(category)] = budgetBytes;
+    }
+
+    size_t AssetResidency::getMemoryBudget(AssetMemoryCategory category) const
+    {
+        lock_(m_mutex);
+        return m_budgets[static_cast<size_t>(category)];
+    }
+
+    AssetMemoryFootprint AssetResidency::getMemoryUsage(AssetMemoryCategory category) const
+    {
+        lock_(m_mutex);
+        return m_usage[static_cast<size_t>(category)];
+    }
+
+    void AssetResidency::readBudgetsConfig()
+    {
+        if (m_budgetsConfigRead || !getServiceProvider().has<GlobalProperties>())
+        {
+            return;
+        }
+
+        m_budgetsConfigRead = true;
+
+        static constexpr eastl::array<const char*, CategoryCount> BudgetPropertyPaths = {
+            "/assets/residency/textureBudgetMb",
+            "/assets/residency/meshBudgetMb",
+            "/assets/residency/animationBudgetMb",
+            "/assets/residency/audioBudgetMb",
+            "/assets/residency/otherBudgetMb"};
+
+        GlobalProperties& properties = getServiceProvider().get<GlobalProperties>();
+        for (size_t category = 0; category < CategoryCount; ++category)
+        {
+            if (eastl::optional<uint32_t> budgetMb = properties.getValue<uint32_t>(BudgetPropertyPaths[category]))
+            {
+                m_budgets[category] = static_cast<size_t>(*budgetMb) * 1024 * 1024;
+            }
+        }
+    }
+}  // namespace nau
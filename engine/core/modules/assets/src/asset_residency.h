@@ -0,0 +1,60 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <EASTL/array.h>
+#include <EASTL/span.h>
+
+#include <atomic>
+#include <mutex>
+
+#include "nau/assets/asset_residency.h"
+#include "nau/rtti/ptr.h"
+
+namespace nau
+{
+    class AssetDescriptorImpl;
+
+    /**
+        Tracks the memory of the loaded assets and unloads the least recently used unused assets of the categories over budget.
+
+        The assets are checked every UpdateIntervalFrames frames. Assets used since the previous check are not unloaded.
+        The initial budgets are set by "/assets/residency/<category>BudgetMb" (texture, mesh, animation, audio, other).
+     */
+    class AssetResidency
+    {
+    public:
+        static constexpr uint64_t UpdateIntervalFrames = 16;
+
+        uint64_t getCurrentFrame() const;
+
+        /**
+            @return true if the assets are need to be checked at this frame.
+         */
+        bool advanceFrame();
+
+        void update(eastl::span<const nau::Ptr<AssetDescriptorImpl>> loadedAssets);
+
+        void setMemoryBudget(AssetMemoryCategory category, size_t budgetBytes);
+
+        size_t getMemoryBudget(AssetMemoryCategory category) const;
+
+        AssetMemoryFootprint getMemoryUsage(AssetMemoryCategory category) const;
+
+    private:
+        static constexpr size_t CategoryCount = static_cast<size_t>(AssetMemoryCategory::Other) + 1;
+
+        /**
+            This method does require that m_mutex are locked by caller.
+         */
+        void readBudgetsConfig();
+
+        std::atomic<uint64_t> m_currentFrame = 1;
+        eastl::array<size_t, CategoryCount> m_budgets{};
+        eastl::array<AssetMemoryFootprint, CategoryCount> m_usage{};
+        bool m_budgetsConfigRead = false;
+        mutable std::mutex m_mutex;
+    };
+}  // namespace nau
@@ -4,6 +4,7 @@
 
 #include "./asset_db_impl.h"
 #include "./asset_file_content_provider.h"
+#include "./derived_data_cache_impl.h"
 #include "asset_manager_impl.h"
 #include "nau/module/module.h"
 
@@ -24,6 +25,7 @@ namespace nau
             NAU_MODULE_EXPORT_SERVICE(AssetManagerImpl);
             NAU_MODULE_EXPORT_SERVICE(AssetFileContentProvider);
             NAU_MODULE_EXPORT_SERVICE(AssetDBImpl);
+            NAU_MODULE_EXPORT_SERVICE(DerivedDataCacheImpl);
         }
         void deinitialize() override
         {
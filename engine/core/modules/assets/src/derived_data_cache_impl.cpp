@@ -0,0 +1,297 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "./derived_data_cache_impl.h"
+
+#include <EASTL/algorithm.h>
+#include <EASTL/sort.h>
+
+#include <filesystem>
+
+#include "nau/app/global_properties.h"
+#include "nau/diag/logging.h"
+#include "nau/io/special_paths.h"
+#include "nau/service/service_provider.h"
+#include "nau/utils/mum_hash.h"
+#include "nau/version/engine_version.h"
+
+namespace nau
+{
+    namespace
+    {
+        constexpr uint32_t IndexMagic = 0x4344444E;  // "NDDC"
+        constexpr uint32_t IndexFormatVersion = 1;
+        constexpr std::string_view IndexFileName = "index.bin";
+        constexpr std::string_view DataFileName = "data.bin";
+
+        uint64_t getEngineVersionHash()
+        {
+            const eastl::string version = EngineVersion::current().toString().tostring();
+            return mum_hash(version.data(), version.size(), IndexFormatVersion);
+        }
+
+        std::filesystem::path getCacheDirectory()
+        {
+            eastl::optional<eastl::string> path;
+            if (getServiceProvider().has<GlobalProperties>())
+            {
+                path = getServiceProvider().get<GlobalProperties>().getValue<eastl::string>("/assets/derivedDataCache/path");
+            }
+
+            if (path && !path->empty())
+            {
+                return std::filesystem::path{path->c_str()};
+            }
+
+            return io::getKnownFolderPath(io::KnownFolder::LocalAppData) / "NauEngine" / "DerivedDataCache";
+        }
+    }  // namespace
+
+    DerivedDataKey::DerivedDataKey(eastl::string_view kind, uint32_t derivationVersion) :
+        m_hash(mum_hash(kind.data(), kind.size(), derivationVersion))
+    {
+    }
+
+    DerivedDataKey& DerivedDataKey::add(eastl::span<const std::byte> data)
+    {
+        m_hash = mum_hash(data.data(), data.size(), m_hash);
+        return *this;
+    }
+
+    DerivedDataKey& DerivedDataKey::add(eastl::string_view str)
+    {
+        return add(eastl::span<const std::byte>{reinterpret_cast<const std::byte*>(str.data()), str.size()});
+    }
+
+    uint64_t DerivedDataKey::getHash() const
+    {
+        return m_hash;
+    }
+
+    DerivedDataCacheImpl::~DerivedDataCacheImpl()
+    {
+        close();
+    }
+
+    eastl::optional<eastl::vector<std::byte>> DerivedDataCacheImpl::find(const DerivedDataKey& key)
+    {
+        lock_(m_mutex);
+        if (!open())
+        {
+            return eastl::nullopt;
+        }
+
+        const IndexEntry* const entry = findEntry(key.getHash());
+        if (!entry)
+        {
+            return eastl::nullopt;
+        }
+
+        eastl::vector<std::byte> data(entry->size);
+        m_dataStream->setPosition(io::OffsetOrigin::Begin, static_cast<int64_t>(entry->offset));
+
+        const Result<size_t> readResult = m_dataStream->as<io::IStreamReader*>()->read(data.data(), data.size());
+        if (!readResult || *readResult != data.size())
+        {
+            NAU_LOG_WARNING("Fail to read the derived data ({})", key.getHash());
+            return eastl::nullopt;
+        }
+
+        return data;
+    }
+
+    void DerivedDataCacheImpl::store(const DerivedDataKey& key, eastl::span<const std::byte> data)
+    {
+        lock_(m_mutex);
+        if (!open() || findEntry(key.getHash()))
+        {
+            return;
+        }
+
+        const size_t offset = m_dataStream->setPosition(io::OffsetOrigin::End, 0);
+
+        const Result<size_t> writeResult = m_dataStream->as<io::IStreamWriter*>()->write(data.data(), data.size());
+        if (!writeResult || *writeResult != data.size())
+        {
+            NAU_LOG_WARNING("Fail to write the derived data ({})", key.getHash());
+            return;
+        }
+
+        m_newEntries[key.getHash()] = IndexEntry{key.getHash(), offset, data.size()};
+    }
+
+    async::Task<> DerivedDataCacheImpl::shutdownService()
+    {
+        lock_(m_mutex);
+        close();
+
+        return async::Task<>::makeResolved();
+    }
+
+    bool DerivedDataCacheImpl::open()
+    {
+        if (m_openAttempted)
+        {
+            return static_cast<bool>(m_dataStream);
+        }
+
+        m_openAttempted = true;
+
+        uint32_t maxSizeMb = DefaultMaxSizeMb;
+        if (getServiceProvider().has<GlobalProperties>())
+        {
+            GlobalProperties& properties = getServiceProvider().get<GlobalProperties>();
+            if (!properties.getValue<bool>("/assets/derivedDataCache/enabled").value_or(true))
+            {
+                return false;
+            }
+
+            maxSizeMb = properties.getValue<uint32_t>("/assets/derivedDataCache/maxSizeMb").value_or(DefaultMaxSizeMb);
+        }
+
+        const std::filesystem::path cacheDirectory = getCacheDirectory();
+        if (std::error_code error; !std::filesystem::create_directories(cacheDirectory, error) && error)
+        {
+            NAU_LOG_WARNING("Derived data cache is disabled, can not create the directory ({}): ({})", cacheDirectory.string(), error.message());
+            return false;
+        }
+
+        const std::filesystem::path dataPath = cacheDirectory / DataFileName;
+        std::error_code error;
+        const uintmax_t dataSize = std::filesystem::file_size(dataPath, error);
+
+        bool isValid = !error && dataSize <= static_cast<uintmax_t>(maxSizeMb) * 1024 * 1024;
+
+        m_fileSystem = io::createNativeFileSystem(cacheDirectory.string(), false);
+        if (isValid && m_fileSystem->exists(io::FsPath{IndexFileName}, io::FsEntryKind::File))
+        {
+            m_indexFile = m_fileSystem->openFile(io::FsPath{IndexFileName}, io::AccessMode::Read, io::OpenFileMode::OpenExisting);
+        }
+
+        isValid = isValid && m_indexFile && m_indexFile->getSize() >= sizeof(IndexHeader);
+        if (isValid)
+        {
+            m_mappedIndex = m_indexFile->as<io::IMemoryMappableObject&>().memMap(0, m_indexFile->getSize());
+
+            const IndexHeader& header = *reinterpret_cast<const IndexHeader*>(m_mappedIndex);
+            isValid = header.magic == IndexMagic && header.formatVersion == IndexFormatVersion && header.engineVersionHash == getEngineVersionHash() &&
+                      m_indexFile->getSize() == sizeof(IndexHeader) + header.entriesCount * sizeof(IndexEntry);
+
+            if (isValid)
+            {
+                const IndexEntry* const entries = reinterpret_cast<const IndexEntry*>(reinterpret_cast<const std::byte*>(m_mappedIndex) + sizeof(IndexHeader));
+                m_indexEntries = {entries, static_cast<size_t>(header.entriesCount)};
+            }
+        }
+
+        if (!isValid)
+        {
+            // Written by the other engine version or overgrown (the products of the changed sources are never removed): start from scratch.
+            if (m_mappedIndex)
+            {
+                m_indexFile->as<io::IMemoryMappableObject&>().memUnmap(m_mappedIndex);
+                m_mappedIndex = nullptr;
+            }
+            m_indexFile.reset();
+            m_indexEntries = {};
+        }
+
+        const io::OpenFileMode openMode = isValid ? io::OpenFileMode::OpenAlways : io::OpenFileMode::CreateAlways;
+        m_dataStream = io::createNativeFileStream(dataPath.string().c_str(), io::AccessMode::Read | io::AccessMode::Write, openMode);
+        if (!m_dataStream)
+        {
+            NAU_LOG_WARNING("Derived data cache is disabled, can not open the data file ({})", dataPath.string());
+            return false;
+        }
+
+        if (!isValid)
+        {
+            // The new entries are always written over the new index.
+            writeIndex();
+        }
+
+        return true;
+    }
+
+    const DerivedDataCacheImpl::IndexEntry* DerivedDataCacheImpl::findEntry(uint64_t key) const
+    {
+        if (auto iter = m_newEntries.find(key); iter != m_newEntries.end())
+        {
+            return &iter->second;
+        }
+
+        auto iter = eastl::lower_bound(m_indexEntries.begin(), m_indexEntries.end(), key, [](const IndexEntry& entry, uint64_t key)
+        {
+            return entry.key < key;
+        });
+
+        return iter != m_indexEntries.end() && iter->key == key ? iter : nullptr;
+    }
+
+    void DerivedDataCacheImpl::writeIndex()
+    {
+        eastl::vector<IndexEntry> entries;
+        entries.reserve(m_indexEntries.size() + m_newEntries.size());
+        entries.insert(entries.end(), m_indexEntries.begin(), m_indexEntries.end());
+        for (const auto& [key, entry] : m_newEntries)
+        {
+            entries.push_back(entry);
+        }
+
+        eastl::sort(entries.begin(), entries.end(), [](const IndexEntry& left, const IndexEntry& right)
+        {
+            return left.key < right.key;
+        });
+
+        // The index file can not be rewritten while it is mapped.
+        if (m_mappedIndex)
+        {
+            m_indexFile->as<io::IMemoryMappableObject&>().memUnmap(m_mappedIndex);
+            m_mappedIndex = nullptr;
+        }
+        m_indexFile.reset();
+        m_indexEntries = {};
+        m_newEntries.clear();
+
+        const std::filesystem::path indexPath = getCacheDirectory() / IndexFileName;
+        io::IStreamBase::Ptr indexStream = io::createNativeFileStream(indexPath.string().c_str(), io::AccessMode::Write, io::OpenFileMode::CreateAlways);
+        if (!indexStream)
+        {
+            NAU_LOG_WARNING("Can not write the derived data cache index ({})", indexPath.string());
+            return;
+        }
+
+        const IndexHeader header{IndexMagic, IndexFormatVersion, getEngineVersionHash(), entries.size()};
+
+        io::IStreamWriter& writer = indexStream->as<io::IStreamWriter&>();
+        writer.write(reinterpret_cast<const std::byte*>(&header), sizeof(header)).ignore();
+        writer.write(reinterpret_cast<const std::byte*>(entries.data()), entries.size() * sizeof(IndexEntry)).ignore();
+        writer.flush();
+    }
+
+    void DerivedDataCacheImpl::close()
+    {
+        if (!m_dataStream)
+        {
+            return;
+        }
+
+        m_dataStream->as<io::IStreamWriter&>().flush();
+        if (!m_newEntries.empty())
+        {
+            writeIndex();
+        }
+
+        if (m_mappedIndex)
+        {
+            m_indexFile->as<io::IMemoryMappableObject&>().memUnmap(m_mappedIndex);
+            m_mappedIndex = nullptr;
+        }
+
+        m_indexEntries = {};
+        m_indexFile.reset();
+        m_dataStream.reset();
+        m_fileSystem.reset();
+    }
+}  // namespace nau
@@ -0,0 +1,78 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <EASTL/unordered_map.h>
+
+#include <mutex>
+
+#include "nau/assets/derived_data_cache.h"
+#include "nau/io/file_system.h"
+#include "nau/rtti/rtti_impl.h"
+#include "nau/service/service.h"
+
+namespace nau
+{
+    /**
+        Stores the derived products in the single data file (appended) and keeps the sorted lookup table in the index file.
+        The index file is memory mapped when the cache is opened, the new entries are kept in memory and written to the index at shutdown.
+
+        The cache is reset when it is created by the other engine version or the data file exceeds the size limit.
+        Config:
+            "/assets/derivedDataCache/enabled" (true by default);
+            "/assets/derivedDataCache/path" (<local app data>/NauEngine/DerivedDataCache by default);
+            "/assets/derivedDataCache/maxSizeMb" (DefaultMaxSizeMb by default).
+     */
+    class DerivedDataCacheImpl final : public IDerivedDataCache,
+                                       public IServiceShutdown
+    {
+        NAU_RTTI_CLASS(nau::DerivedDataCacheImpl, IDerivedDataCache, IServiceShutdown)
+
+    public:
+        static constexpr uint32_t DefaultMaxSizeMb = 2048;
+
+        ~DerivedDataCacheImpl();
+
+        eastl::optional<eastl::vector<std::byte>> find(const DerivedDataKey& key) override;
+
+        void store(const DerivedDataKey& key, eastl::span<const std::byte> data) override;
+
+        async::Task<> shutdownService() override;
+
+    private:
+        struct IndexHeader
+        {
+            uint32_t magic;
+            uint32_t formatVersion;
+            uint64_t engineVersionHash;
+            uint64_t entriesCount;
+        };
+
+        struct IndexEntry
+        {
+            uint64_t key;
+            uint64_t offset;
+            uint64_t size;
+        };
+
+        /**
+            These methods does require that m_mutex are locked by caller.
+         */
+        bool open();
+        const IndexEntry* findEntry(uint64_t key) const;
+        void writeIndex();
+        void close();
+
+        bool m_openAttempted = false;
+        io::IFileSystem::Ptr m_fileSystem;
+        io::IFile::Ptr m_indexFile;
+        const void* m_mappedIndex = nullptr;
+        eastl::span<const IndexEntry> m_indexEntries;
+        eastl::unordered_map<uint64_t, IndexEntry> m_newEntries;
+        io::IFile::Ptr m_dataFile;
+        io::IStreamBase::Ptr m_dataStream;
+        std::mutex m_mutex;
+    };
+}  // namespace nau
@@ -0,0 +1,655 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "nau/assets/mesh_optimizer.h"
+
+#include "nau/utils/dag_hash.h"
+
+namespace nau
+{
+    namespace
+    {
+        constexpr uint32_t InvalidIndex = ~0u;
+
+        inline size_t getStreamStride(const MeshVertexStream& stream)
+        {
+            return stream.stride != 0 ? stream.stride : stream.size;
+        }
+
+        inline const std::byte* getStreamVertex(const MeshVertexStream& stream, size_t vertex)
+        {
+            return reinterpret_cast<const std::byte*>(stream.data) + vertex * getStreamStride(stream);
+        }
+
+        inline math::vec3 readPosition(const MeshVertexStream& positions, size_t vertex)
+        {
+            const float* const position = reinterpret_cast<const float*>(getStreamVertex(positions, vertex));
+            return math::vec3{position[0], position[1], position[2]};
+        }
+
+        struct VertexHasher
+        {
+            eastl::span<const MeshVertexStream> streams;
+
+            size_t operator()(uint32_t vertex) const
+            {
+                uint64_t hash = FNV1Params<64>::offset_basis;
+                for (const MeshVertexStream& stream : streams)
+                {
+                    hash = mem_hash_fnv1<64>(reinterpret_cast<const char*>(getStreamVertex(stream, vertex)), stream.size, hash);
+                }
+
+                return static_cast<size_t>(hash);
+            }
+        };
+
+        struct VertexEqual
+        {
+            eastl::span<const MeshVertexStream> streams;
+
+            bool operator()(uint32_t vertex0, uint32_t vertex1) const
+            {
+                for (const MeshVertexStream& stream : streams)
+                {
+                    if (memcmp(getStreamVertex(stream, vertex0), getStreamVertex(stream, vertex1), stream.size) != 0)
+                    {
+                        return false;
+                    }
+                }
+
+                return true;
+            }
+        };
+
+        // Forsyth's vertex cache optimization ("Linear-Speed Vertex Cache Optimisation") parameters
+        constexpr unsigned ForsythCacheSize = 32;
+
+        float computeForsythVertexScore(int cachePosition, unsigned remainingValence)
+        {
+            if (remainingValence == 0)
+            {
+                return -1.f;
+            }
+
+            float score = 0.f;
+            if (cachePosition >= 0)
+            {
+                // The vertices of the last triangle have the fixed score, so the next triangle does not just use the most recent edge
+                if (cachePosition < 3)
+                {
+                    score = 0.75f;
+                }
+                else
+                {
+                    const float scaler = 1.f / static_cast<float>(ForsythCacheSize - 3);
+                    score = std::pow(1.f - static_cast<float>(cachePosition - 3) * scaler, 1.5f);
+                }
+            }
+
+            // The vertices with the few remaining triangles are preferred to finish them off
+            score += 2.f / std::sqrt(static_cast<float>(remainingValence));
+            return score;
+        }
+
+        struct TriangleCluster
+        {
+            size_t firstTriangle = 0;
+            size_t triangleCount = 0;
+            float sortKey = 0.f;
+        };
+    }  // namespace
+
+    size_t generateVertexRemap(eastl::span<uint32_t> remap, eastl::span<const uint32_t> indices, size_t vertexCount, eastl::span<const MeshVertexStream> streams)
+    {
+        NAU_ASSERT(remap.size() >= vertexCount);
+
+        eastl::fill(remap.begin(), remap.end(), InvalidIndex);
+
+        eastl::unordered_map<uint32_t, uint32_t, VertexHasher, VertexEqual> uniqueVertices(vertexCount, VertexHasher{streams}, VertexEqual{streams});
+        uint32_t uniqueCount = 0;
+
+        for (const uint32_t index : indices)
+        {
+            NAU_ASSERT(index < vertexCount);
+            if (remap[index] != InvalidIndex)
+            {
+                continue;
+            }
+
+            const auto [vertex, isNew] = uniqueVertices.emplace(index, uniqueCount);
+            remap[index] = vertex->second;
+            if (isNew)
+            {
+                ++uniqueCount;
+            }
+        }
+
+        return uniqueCount;
+    }
+
+    void optimizeVertexCache(eastl::span<uint32_t> indices, size_t vertexCount)
+    {
+        NAU_ASSERT(indices.size() % 3 == 0);
+
+        const size_t triangleCount = indices.size() / 3;
+        if (triangleCount < 2)
+        {
+            return;
+        }
+
+        // The live (not emitted) triangles of every vertex: [adjacencyOffsets[v], adjacencyOffsets[v] + valences[v])
+        eastl::vector<uint32_t> valences(vertexCount, 0);
+        for (const uint32_t index : indices)
+        {
+            NAU_ASSERT(index < vertexCount);
+            ++valences[index];
+        }
+
+        eastl::vector<uint32_t> adjacencyOffsets(vertexCount, 0);
+        for (size_t v = 1; v < vertexCount; ++v)
+        {
+            adjacencyOffsets[v] = adjacencyOffsets[v - 1] + valences[v - 1];
+        }
+
+        eastl::vector<uint32_t> adjacency(indices.size());
+        {
+            eastl::vector<uint32_t> fill(vertexCount, 0);
+            for (size_t t = 0; t < triangleCount; ++t)
+            {
+                for (size_t i = 0; i < 3; ++i)
+                {
+                    const uint32_t v = indices[t * 3 + i];
+                    adjacency[adjacencyOffsets[v] + fill[v]++] = static_cast<uint32_t>(t);
+                }
+            }
+        }
+
+        eastl::vector<int> cachePositions(vertexCount, -1);
+        eastl::vector<float> vertexScores(vertexCount);
+        for (size_t v = 0; v < vertexCount; ++v)
+        {
+            vertexScores[v] = computeForsythVertexScore(-1, valences[v]);
+        }
+
+        const auto triangleScore = [&](size_t t)
+        {
+            return vertexScores[indices[t * 3]] + vertexScores[indices[t * 3 + 1]] + vertexScores[indices[t * 3 + 2]];
+        };
+
+        eastl::vector<bool> isEmitted(triangleCount, false);
+        eastl::vector<uint32_t> output;
+        output.reserve(indices.size());
+
+        eastl::vector<uint32_t> cache;
+        eastl::vector<uint32_t> newCache;
+        cache.reserve(ForsythCacheSize + 3);
+        newCache.reserve(ForsythCacheSize + 3);
+
+        size_t nextTriangleCursor = 0;
+        size_t bestTriangle = 0;
+
+        for (size_t emitted = 0; emitted < triangleCount; ++emitted)
+        {
+            if (bestTriangle == InvalidIndex)
+            {
+                // No triangle is adjacent to the cache: continue with the next not emitted one
+                while (isEmitted[nextTriangleCursor])
+                {
+                    ++nextTriangleCursor;
+                }
+                bestTriangle = nextTriangleCursor;
+            }
+
+            isEmitted[bestTriangle] = true;
+            const uint32_t* const triangle = &indices[bestTriangle * 3];
+
+            newCache.clear();
+            for (size_t i = 0; i < 3; ++i)
+            {
+                const uint32_t v = triangle[i];
+                output.push_back(v);
+                newCache.push_back(v);
+
+                // Remove the triangle from the live triangles of the vertex
+                uint32_t* const vertexTriangles = &adjacency[adjacencyOffsets[v]];
+                uint32_t* const triangleEntry = eastl::find(vertexTriangles, vertexTriangles + valences[v], static_cast<uint32_t>(bestTriangle));
+                NAU_ASSERT(triangleEntry != vertexTriangles + valences[v]);
+                eastl::swap(*triangleEntry, vertexTriangles[--valences[v]]);
+            }
+
+            for (const uint32_t v : cache)
+            {
+                if (v != triangle[0] && v != triangle[1] && v != triangle[2])
+                {
+                    newCache.push_back(v);
+                }
+            }
+
+            // The vertices pushed out of the cache
+            for (size_t i = ForsythCacheSize; i < newCache.size(); ++i)
+            {
+                cachePositions[newCache[i]] = -1;
+                vertexScores[newCache[i]] = computeForsythVertexScore(-1, valences[newCache[i]]);
+            }
+
+            if (newCache.size() > ForsythCacheSize)
+            {
+                newCache.resize(ForsythCacheSize);
+            }
+
+            eastl::swap(cache, newCache);
+
+            float bestScore = -1.f;
+            bestTriangle = InvalidIndex;
+
+            for (size_t i = 0; i < cache.size(); ++i)
+            {
+                const uint32_t v = cache[i];
+                cachePositions[v] = static_cast<int>(i);
+                vertexScores[v] = computeForsythVertexScore(static_cast<int>(i), valences[v]);
+            }
+
+            for (const uint32_t v : cache)
+            {
+                for (uint32_t i = 0; i < valences[v]; ++i)
+                {
+                    const uint32_t t = adjacency[adjacencyOffsets[v] + i];
+                    if (const float score = triangleScore(t); score > bestScore)
+                    {
+                        bestScore = score;
+                        bestTriangle = t;
+                    }
+                }
+            }
+        }
+
+        eastl::copy(output.begin(), output.end(), indices.begin());
+    }
+
+    void optimizeOverdraw(eastl::span<uint32_t> indices, const MeshVertexStream& positions, size_t vertexCount, float threshold)
+    {
+        constexpr unsigned ClusterCacheSize = 16;
+
+        NAU_ASSERT(indices.size() % 3 == 0);
+
+        const size_t triangleCount = indices.size() / 3;
+        if (triangleCount < 2)
+        {
+            return;
+        }
+
+        // The cluster boundaries are the triangles that miss the cache with all the vertices:
+        // the clusters are vertex cache local, so they can be reordered without the cache efficiency loss.
+        eastl::vector<TriangleCluster> clusters;
+        {
+            eastl::vector<uint32_t> cacheTimestamps(vertexCount, 0);
+            uint32_t timestamp = ClusterCacheSize + 1;
+
+            for (size_t t = 0; t < triangleCount; ++t)
+            {
+                unsigned misses = 0;
+                for (size_t i = 0; i < 3; ++i)
+                {
+                    const uint32_t v = indices[t * 3 + i];
+                    if (timestamp - cacheTimestamps[v] > ClusterCacheSize)
+                    {
+                        cacheTimestamps[v] = timestamp++;
+                        ++misses;
+                    }
+                }
+
+                if (clusters.empty() || misses == 3)
+                {
+                    clusters.push_back({t, 0, 0.f});
+                }
+
+                ++clusters.back().triangleCount;
+            }
+        }
+
+        if (clusters.size() < 2)
+        {
+            return;
+        }
+
+        // The clusters facing away from the mesh center are drawn first: they are likely to occlude the rest
+        math::vec3 meshCentroid{0.f, 0.f, 0.f};
+        float meshArea = 0.f;
+
+        eastl::vector<math::vec3> clusterCentroids(clusters.size());
+        eastl::vector<math::vec3> clusterNormals(clusters.size());
+
+        for (size_t c = 0; c < clusters.size(); ++c)
+        {
+            math::vec3 centroid{0.f, 0.f, 0.f};
+            math::vec3 normal{0.f, 0.f, 0.f};
+            float clusterArea = 0.f;
+
+            for (size_t t = clusters[c].firstTriangle, end = t + clusters[c].triangleCount; t < end; ++t)
+            {
+                const math::vec3 p0 = readPosition(positions, indices[t * 3]);
+                const math::vec3 p1 = readPosition(positions, indices[t * 3 + 1]);
+                const math::vec3 p2 = readPosition(positions, indices[t * 3 + 2]);
+
+                const math::vec3 triangleNormal = math::cross(p1 - p0, p2 - p0);
+                const float area = math::length(triangleNormal);
+
+                centroid += (p0 + p1 + p2) * (area / 3.f);
+                normal += triangleNormal;
+                clusterArea += area;
+            }
+
+            meshCentroid += centroid;
+            meshArea += clusterArea;
+
+            clusterCentroids[c] = clusterArea > 0.f ? centroid / clusterArea : centroid;
+            clusterNormals[c] = normal;
+        }
+
+        if (meshArea > 0.f)
+        {
+            meshCentroid /= meshArea;
+        }
+
+        for (size_t c = 0; c < clusters.size(); ++c)
+        {
+            const float normalLength = math::length(clusterNormals[c]);
+            clusters[c].sortKey = normalLength > 0.f ? static_cast<float>(math::dot(clusterCentroids[c] - meshCentroid, clusterNormals[c] / normalLength)) : 0.f;
+        }
+
+        eastl::stable_sort(clusters.begin(), clusters.end(), [](const TriangleCluster& left, const TriangleCluster& right)
+        {
+            return left.sortKey > right.sortKey;
+        });
+
+        eastl::vector<uint32_t> sortedIndices;
+        sortedIndices.reserve(indices.size());
+        for (const TriangleCluster& cluster : clusters)
+        {
+            const auto first = indices.begin() + cluster.firstTriangle * 3;
+            sortedIndices.insert(sortedIndices.end(), first, first + cluster.triangleCount * 3);
+        }
+
+        const float sourceMissRatio = computeVertexCacheMissRatio(indices, vertexCount);
+        const float sortedMissRatio = computeVertexCacheMissRatio(sortedIndices, vertexCount);
+        if (sortedMissRatio <= sourceMissRatio * threshold)
+        {
+            eastl::copy(sortedIndices.begin(), sortedIndices.end(), indices.begin());
+        }
+    }
+
+    size_t generateVertexFetchRemap(eastl::span<uint32_t> remap, eastl::span<const uint32_t> indices, size_t vertexCount)
+    {
+        NAU_ASSERT(remap.size() >= vertexCount);
+
+        eastl::fill(remap.begin(), remap.end(), InvalidIndex);
+
+        uint32_t nextVertex = 0;
+        for (const uint32_t index : indices)
+        {
+            NAU_ASSERT(index < vertexCount);
+            if (remap[index] == InvalidIndex)
+            {
+                remap[index] = nextVertex++;
+            }
+        }
+
+        return nextVertex;
+    }
+
+    void buildMeshlets(OptimizedMesh& mesh, const MeshVertexStream& positions, unsigned maxVertices, unsigned maxTriangles)
+    {
+        NAU_ASSERT(maxVertices >= 3 && maxVertices <= 255);
+        NAU_ASSERT(maxTriangles >= 1);
+
+        mesh.meshlets.clear();
+        mesh.meshletVertices.clear();
+        mesh.meshletTriangles.clear();
+
+        const auto readMeshPosition = [&](uint32_t vertex)
+        {
+            return readPosition(positions, mesh.vertexSources.empty() ? vertex : mesh.vertexSources[vertex]);
+        };
+
+        const auto computeBounds = [&](Meshlet& meshlet)
+        {
+            math::vec3 boundsMin = readMeshPosition(mesh.meshletVertices[meshlet.vertexOffset]);
+            math::vec3 boundsMax = boundsMin;
+            for (uint32_t i = 1; i < meshlet.vertexCount; ++i)
+            {
+                const math::vec3 position = readMeshPosition(mesh.meshletVertices[meshlet.vertexOffset + i]);
+                boundsMin = math::minPerElem(boundsMin, position);
+                boundsMax = math::maxPerElem(boundsMax, position);
+            }
+
+            meshlet.center = (boundsMin + boundsMax) * 0.5f;
+            meshlet.radius = 0.f;
+            for (uint32_t i = 0; i < meshlet.vertexCount; ++i)
+            {
+                const float distance = math::length(readMeshPosition(mesh.meshletVertices[meshlet.vertexOffset + i]) - meshlet.center);
+                meshlet.radius = std::max(meshlet.radius, distance);
+            }
+
+            // The normal cone: the meshlet can be culled if all its triangles are back facing
+            eastl::vector<eastl::pair<math::vec3, math::vec3>> triangleNormals;  // (normal, first vertex)
+            triangleNormals.reserve(meshlet.triangleCount);
+
+            math::vec3 normalsSum{0.f, 0.f, 0.f};
+            for (uint32_t t = 0; t < meshlet.triangleCount; ++t)
+            {
+                const uint8_t* const triangle = &mesh.meshletTriangles[(meshlet.triangleOffset + t) * 3];
+                const math::vec3 p0 = readMeshPosition(mesh.meshletVertices[meshlet.vertexOffset + triangle[0]]);
+                const math::vec3 p1 = readMeshPosition(mesh.meshletVertices[meshlet.vertexOffset + triangle[1]]);
+                const math::vec3 p2 = readMeshPosition(mesh.meshletVertices[meshlet.vertexOffset + triangle[2]]);
+
+                const math::vec3 normal = math::cross(p1 - p0, p2 - p0);
+                if (const float area = math::length(normal); area > 0.f)
+                {
+                    triangleNormals.emplace_back(normal / area, p0);
+                    normalsSum += normal / area;
+                }
+            }
+
+            meshlet.coneCutoff = 1.f;
+            meshlet.coneAxis = math::vec3{0.f, 0.f, 0.f};
+            meshlet.coneApex = meshlet.center;
+
+            const float normalsSumLength = math::length(normalsSum);
+            if (triangleNormals.empty() || normalsSumLength <= 0.f)
+            {
+                return;
+            }
+
+            const math::vec3 axis = normalsSum / normalsSumLength;
+            float minDot = 1.f;
+            for (const auto& [normal, position] : triangleNormals)
+            {
+                const float normalDot = math::dot(axis, normal);
+                minDot = std::min(minDot, normalDot);
+            }
+
+            // The cone is too wide for the culling to be useful
+            if (minDot <= 0.1f)
+            {
+                return;
+            }
+
+            // The apex is moved back along the axis, so the planes of all the triangles are in front of it
+            float maxDistance = 0.f;
+            for (const auto& [normal, position] : triangleNormals)
+            {
+                const float distance = static_cast<float>(math::dot(meshlet.center - position, normal)) / static_cast<float>(math::dot(axis, normal));
+                maxDistance = std::max(maxDistance, distance);
+            }
+
+            meshlet.coneAxis = axis;
+            meshlet.coneApex = meshlet.center - axis * maxDistance;
+            meshlet.coneCutoff = std::sqrt(1.f - minDot * minDot);
+        };
+
+        if (mesh.indices.empty())
+        {
+            return;
+        }
+
+        const size_t vertexCount = !mesh.vertexSources.empty() ? mesh.vertexSources.size() : *eastl::max_element(mesh.indices.begin(), mesh.indices.end()) + 1;
+        eastl::vector<uint8_t> localIndices(vertexCount, 0xff);
+
+        const auto finishMeshlet = [&](Meshlet& meshlet)
+        {
+            for (uint32_t i = 0; i < meshlet.vertexCount; ++i)
+            {
+                localIndices[mesh.meshletVertices[meshlet.vertexOffset + i]] = 0xff;
+            }
+
+            computeBounds(meshlet);
+        };
+
+        Meshlet meshlet;
+        for (size_t t = 0; t < mesh.indices.size() / 3; ++t)
+        {
+            const uint32_t* const triangle = &mesh.indices[t * 3];
+
+            unsigned newVertices = 0;
+            for (size_t i = 0; i < 3; ++i)
+            {
+                newVertices += localIndices[triangle[i]] == 0xff ? 1 : 0;
+            }
+
+            if (meshlet.vertexCount + newVertices > maxVertices || meshlet.triangleCount >= maxTriangles)
+            {
+                finishMeshlet(mesh.meshlets.emplace_back(meshlet));
+
+                meshlet = Meshlet{};
+                meshlet.vertexOffset = static_cast<uint32_t>(mesh.meshletVertices.size());
+                meshlet.triangleOffset = static_cast<uint32_t>(mesh.meshletTriangles.size() / 3);
+            }
+
+            for (size_t i = 0; i < 3; ++i)
+            {
+                uint8_t& localIndex = localIndices[triangle[i]];
+                if (localIndex == 0xff)
+                {
+                    localIndex = static_cast<uint8_t>(meshlet.vertexCount++);
+                    mesh.meshletVertices.push_back(triangle[i]);
+                }
+
+                mesh.meshletTriangles.push_back(localIndex);
+            }
+
+            ++meshlet.triangleCount;
+        }
+
+        if (meshlet.triangleCount > 0)
+        {
+            finishMeshlet(mesh.meshlets.emplace_back(meshlet));
+        }
+    }
+
+    float computeVertexCacheMissRatio(eastl::span<const uint32_t> indices, size_t vertexCount, unsigned cacheSize)
+    {
+        if (indices.size() < 3)
+        {
+            return 0.f;
+        }
+
+        eastl::vector<uint32_t> cacheTimestamps(vertexCount, 0);
+        uint32_t timestamp = cacheSize + 1;
+        size_t misses = 0;
+
+        for (const uint32_t index : indices)
+        {
+            if (timestamp - cacheTimestamps[index] > cacheSize)
+            {
+                cacheTimestamps[index] = timestamp++;
+                ++misses;
+            }
+        }
+
+        return static_cast<float>(misses) / static_cast<float>(indices.size() / 3);
+    }
+
+    OptimizedMesh optimizeMesh(eastl::span<const uint32_t> indices, size_t vertexCount, const MeshVertexStream& positions,
+                               eastl::span<const MeshVertexStream> streams, const MeshOptimizationSettings& settings)
+    {
+        NAU_ASSERT(indices.size() % 3 == 0);
+
+        OptimizedMesh mesh;
+        mesh.indices.assign(indices.begin(), indices.end());
+
+        eastl::vector<uint32_t> remap(vertexCount);
+        size_t optimizedVertexCount = vertexCount;
+
+        if (settings.deduplicateVertices)
+        {
+            optimizedVertexCount = generateVertexRemap(remap, indices, vertexCount, streams);
+
+            mesh.vertexSources.resize(optimizedVertexCount, InvalidIndex);
+            for (uint32_t v = 0; v < vertexCount; ++v)
+            {
+                if (remap[v] != InvalidIndex && mesh.vertexSources[remap[v]] == InvalidIndex)
+                {
+                    mesh.vertexSources[remap[v]] = v;
+                }
+            }
+
+            for (uint32_t& index : mesh.indices)
+            {
+                index = remap[index];
+            }
+        }
+        else
+        {
+            mesh.vertexSources.resize(vertexCount);
+            eastl::iota(mesh.vertexSources.begin(), mesh.vertexSources.end(), 0u);
+        }
+
+        if (settings.optimizeVertexCache)
+        {
+            optimizeVertexCache(mesh.indices, optimizedVertexCount);
+        }
+
+        if (settings.optimizeOverdraw)
+        {
+            eastl::vector<float> optimizedPositions;
+            optimizedPositions.reserve(optimizedVertexCount * 3);
+            for (const uint32_t source : mesh.vertexSources)
+            {
+                const math::vec3 position = readPosition(positions, source);
+                optimizedPositions.insert(optimizedPositions.end(), {static_cast<float>(position.getX()), static_cast<float>(position.getY()), static_cast<float>(position.getZ())});
+            }
+
+            const MeshVertexStream optimizedPositionsStream{optimizedPositions.data(), sizeof(float) * 3, 0};
+            optimizeOverdraw(mesh.indices, optimizedPositionsStream, optimizedVertexCount, settings.overdrawThreshold);
+        }
+
+        if (settings.optimizeVertexFetch)
+        {
+            remap.resize(optimizedVertexCount);
+            const size_t fetchedVertexCount = generateVertexFetchRemap(remap, mesh.indices, optimizedVertexCount);
+
+            eastl::vector<uint32_t> vertexSources(fetchedVertexCount);
+            for (size_t v = 0; v < optimizedVertexCount; ++v)
+            {
+                if (remap[v] != InvalidIndex)
+                {
+                    vertexSources[remap[v]] = mesh.vertexSources[v];
+                }
+            }
+
+            mesh.vertexSources = std::move(vertexSources);
+            for (uint32_t& index : mesh.indices)
+            {
+                index = remap[index];
+            }
+        }
+
+        if (settings.generateMeshlets && !mesh.indices.empty())
+        {
+            buildMeshlets(mesh, positions, settings.maxMeshletVertices, settings.maxMeshletTriangles);
+        }
+
+        return mesh;
+    }
+}  // namespace nau
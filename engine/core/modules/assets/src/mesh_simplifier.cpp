@@ -0,0 +1,522 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "nau/assets/mesh_simplifier.h"
+
+#include "nau/utils/dag_hash.h"
+
+namespace nau
+{
+    namespace
+    {
+        constexpr uint32_t InvalidIndex = ~0u;
+
+        struct Position
+        {
+            double x = 0.;
+            double y = 0.;
+            double z = 0.;
+        };
+
+        inline Position operator-(const Position& left, const Position& right)
+        {
+            return {left.x - right.x, left.y - right.y, left.z - right.z};
+        }
+
+        inline Position cross(const Position& left, const Position& right)
+        {
+            return {left.y * right.z - left.z * right.y, left.z * right.x - left.x * right.z, left.x * right.y - left.y * right.x};
+        }
+
+        inline double dot(const Position& left, const Position& right)
+        {
+            return left.x * right.x + left.y * right.y + left.z * right.z;
+        }
+
+        /**
+         * The symmetric 4x4 matrix of the sum of the squared distances to the planes.
+         */
+        struct Quadric
+        {
+            double a2 = 0., b2 = 0., c2 = 0., d2 = 0.;
+            double ab = 0., ac = 0., ad = 0.;
+            double bc = 0., bd = 0., cd = 0.;
+
+            void addPlane(const Position& normal, double d, double weight)
+            {
+                a2 += normal.x * normal.x * weight;
+                b2 += normal.y * normal.y * weight;
+                c2 += normal.z * normal.z * weight;
+                d2 += d * d * weight;
+                ab += normal.x * normal.y * weight;
+                ac += normal.x * normal.z * weight;
+                ad += normal.x * d * weight;
+                bc += normal.y * normal.z * weight;
+                bd += normal.y * d * weight;
+                cd += normal.z * d * weight;
+            }
+
+            void add(const Quadric& other)
+            {
+                a2 += other.a2;
+                b2 += other.b2;
+                c2 += other.c2;
+                d2 += other.d2;
+                ab += other.ab;
+                ac += other.ac;
+                ad += other.ad;
+                bc += other.bc;
+                bd += other.bd;
+                cd += other.cd;
+            }
+
+            double evaluate(const Position& p) const
+            {
+                const double rx = a2 * p.x + ab * p.y + ac * p.z + ad;
+                const double ry = ab * p.x + b2 * p.y + bc * p.z + bd;
+                const double rz = ac * p.x + bc * p.y + c2 * p.z + cd;
+                const double rw = ad * p.x + bd * p.y + cd * p.z + d2;
+
+                return std::abs(rx * p.x + ry * p.y + rz * p.z + rw);
+            }
+        };
+
+        struct Collapse
+        {
+            uint32_t from;
+            uint32_t to;
+            double cost;
+        };
+
+        inline uint64_t makeEdgeKey(uint32_t from, uint32_t to)
+        {
+            return (static_cast<uint64_t>(from) << 32) | to;
+        }
+
+        struct PositionHasher
+        {
+            const Position* positions;
+
+            size_t operator()(uint32_t vertex) const
+            {
+                return static_cast<size_t>(mem_hash_fnv1<64>(reinterpret_cast<const char*>(&positions[vertex]), sizeof(Position)));
+            }
+        };
+
+        struct PositionEqual
+        {
+            const Position* positions;
+
+            bool operator()(uint32_t vertex0, uint32_t vertex1) const
+            {
+                return memcmp(&positions[vertex0], &positions[vertex1], sizeof(Position)) == 0;
+            }
+        };
+
+        class MeshSimplifier
+        {
+        public:
+            MeshSimplifier(eastl::span<const uint32_t> indices, size_t vertexCount, const MeshVertexStream& positions) :
+                m_indices(indices.begin(), indices.end()),
+                m_positions(vertexCount),
+                m_isLocked(vertexCount, false),
+                m_quadrics(vertexCount)
+            {
+                const size_t positionsStride = positions.stride != 0 ? positions.stride : positions.size;
+                for (size_t v = 0; v < vertexCount; ++v)
+                {
+                    const float* const position = reinterpret_cast<const float*>(reinterpret_cast<const std::byte*>(positions.data) + v * positionsStride);
+                    m_positions[v] = {position[0], position[1], position[2]};
+                }
+
+                computeMeshSize();
+                lockBordersAndSeams();
+                computeQuadrics();
+            }
+
+            eastl::vector<uint32_t> simplify(size_t targetIndexCount, double maxError, double& resultError)
+            {
+                // The errors are measured in the squared distances relative to the mesh size
+                const double scale = m_meshSize > 0. ? 1. / m_meshSize : 1.;
+                const double maxCost = maxError * maxError / (scale * scale);
+
+                double maxAppliedCost = 0.;
+
+                while (m_indices.size() > targetIndexCount)
+                {
+                    const size_t collapsesCount = collapsePass(targetIndexCount, maxCost, maxAppliedCost);
+                    if (collapsesCount == 0)
+                    {
+                        break;
+                    }
+                }
+
+                resultError = std::sqrt(maxAppliedCost) * scale;
+                return m_indices;
+            }
+
+        private:
+            void computeMeshSize()
+            {
+                constexpr double MaxValue = std::numeric_limits<double>::max();
+                Position boundsMin{MaxValue, MaxValue, MaxValue};
+                Position boundsMax{-MaxValue, -MaxValue, -MaxValue};
+                for (const uint32_t index : m_indices)
+                {
+                    const Position& p = m_positions[index];
+                    boundsMin = {std::min(boundsMin.x, p.x), std::min(boundsMin.y, p.y), std::min(boundsMin.z, p.z)};
+                    boundsMax = {std::max(boundsMax.x, p.x), std::max(boundsMax.y, p.y), std::max(boundsMax.z, p.z)};
+                }
+
+                m_meshSize = m_indices.empty() ? 0. : std::sqrt(dot(boundsMax - boundsMin, boundsMax - boundsMin));
+            }
+
+            /**
+             * Only the manifold vertices (the single vertex of its position with no border or non-manifold edges) are collapsed.
+             */
+            void lockBordersAndSeams()
+            {
+                const size_t vertexCount = m_positions.size();
+
+                // The vertices of the equal positions are the attribute seams (the mesh is expected to be deduplicated, see optimizeMesh)
+                eastl::vector<uint32_t> positionIds(vertexCount, InvalidIndex);
+                {
+                    eastl::unordered_map<uint32_t, uint32_t, PositionHasher, PositionEqual> uniquePositions(vertexCount, PositionHasher{m_positions.data()}, PositionEqual{m_positions.data()});
+                    eastl::vector<uint32_t> positionVertexCounts;
+
+                    for (const uint32_t index : m_indices)
+                    {
+                        if (positionIds[index] != InvalidIndex)
+                        {
+                            continue;
+                        }
+
+                        const auto [position, isNew] = uniquePositions.emplace(index, static_cast<uint32_t>(positionVertexCounts.size()));
+                        if (isNew)
+                        {
+                            positionVertexCounts.push_back(0);
+                        }
+
+                        positionIds[index] = position->second;
+                        ++positionVertexCounts[position->second];
+                    }
+
+                    for (size_t v = 0; v < vertexCount; ++v)
+                    {
+                        if (positionIds[v] != InvalidIndex && positionVertexCounts[positionIds[v]] > 1)
+                        {
+                            m_isLocked[v] = true;
+                        }
+                    }
+                }
+
+                // The border edges have no opposite edge, the non-manifold edges are shared by more than two triangles
+                eastl::unordered_map<uint64_t, uint32_t> edges(m_indices.size());
+                for (size_t i = 0; i < m_indices.size(); i += 3)
+                {
+                    for (size_t e = 0; e < 3; ++e)
+                    {
+                        ++edges[makeEdgeKey(positionIds[m_indices[i + e]], positionIds[m_indices[i + (e + 1) % 3]])];
+                    }
+                }
+
+                for (size_t i = 0; i < m_indices.size(); i += 3)
+                {
+                    for (size_t e = 0; e < 3; ++e)
+                    {
+                        const uint32_t v0 = m_indices[i + e];
+                        const uint32_t v1 = m_indices[i + (e + 1) % 3];
+
+                        const uint32_t edgeCount = edges[makeEdgeKey(positionIds[v0], positionIds[v1])];
+                        const auto oppositeEdge = edges.find(makeEdgeKey(positionIds[v1], positionIds[v0]));
+                        if (edgeCount != 1 || oppositeEdge == edges.end() || oppositeEdge->second != 1)
+                        {
+                            m_isLocked[v0] = true;
+                            m_isLocked[v1] = true;
+                        }
+                    }
+                }
+            }
+
+            void computeQuadrics()
+            {
+                for (size_t i = 0; i < m_indices.size(); i += 3)
+                {
+                    const Position& p0 = m_positions[m_indices[i]];
+                    const Position& p1 = m_positions[m_indices[i + 1]];
+                    const Position& p2 = m_positions[m_indices[i + 2]];
+
+                    Position normal = cross(p1 - p0, p2 - p0);
+                    const double area = std::sqrt(dot(normal, normal));
+                    if (area <= 0.)
+                    {
+                        continue;
+                    }
+
+                    normal = {normal.x / area, normal.y / area, normal.z / area};
+
+                    // The planes are weighted by the triangle areas: the small triangles do not hold the big collapses
+                    Quadric quadric;
+                    quadric.addPlane(normal, -dot(normal, p0), area);
+
+                    for (size_t v = 0; v < 3; ++v)
+                    {
+                        m_quadrics[m_indices[i + v]].add(quadric);
+                    }
+                }
+            }
+
+            void buildAdjacency()
+            {
+                const size_t vertexCount = m_positions.size();
+
+                m_adjacencyOffsets.assign(vertexCount + 1, 0);
+                for (const uint32_t index : m_indices)
+                {
+                    ++m_adjacencyOffsets[index + 1];
+                }
+
+                for (size_t v = 0; v < vertexCount; ++v)
+                {
+                    m_adjacencyOffsets[v + 1] += m_adjacencyOffsets[v];
+                }
+
+                m_adjacency.resize(m_indices.size());
+                eastl::vector<uint32_t> fill(m_adjacencyOffsets.begin(), m_adjacencyOffsets.end() - 1);
+                for (size_t i = 0; i < m_indices.size(); ++i)
+                {
+                    m_adjacency[fill[m_indices[i]]++] = static_cast<uint32_t>(i / 3);
+                }
+            }
+
+            /**
+             * The collapse is rejected if any of the remaining triangles around the vertex flips.
+             */
+            bool isCollapseValid(uint32_t from, uint32_t to) const
+            {
+                const Position& target = m_positions[to];
+
+                for (uint32_t a = m_adjacencyOffsets[from]; a < m_adjacencyOffsets[from + 1]; ++a)
+                {
+                    const uint32_t* const triangle = &m_indices[m_adjacency[a] * 3];
+                    if (triangle[0] == to || triangle[1] == to || triangle[2] == to)
+                    {
+                        continue;
+                    }
+
+                    const size_t corner = triangle[0] == from ? 0 : (triangle[1] == from ? 1 : 2);
+                    const Position& p1 = m_positions[triangle[(corner + 1) % 3]];
+                    const Position& p2 = m_positions[triangle[(corner + 2) % 3]];
+
+                    const Position sourceNormal = cross(p1 - m_positions[from], p2 - m_positions[from]);
+                    const Position targetNormal = cross(p1 - target, p2 - target);
+
+                    if (dot(sourceNormal, targetNormal) <= 0.)
+                    {
+                        return false;
+                    }
+                }
+
+                return true;
+            }
+
+            size_t collapsePass(size_t targetIndexCount, double maxCost, double& maxAppliedCost)
+            {
+                buildAdjacency();
+
+                eastl::vector<Collapse> collapses;
+                collapses.reserve(m_indices.size());
+
+                for (size_t i = 0; i < m_indices.size(); i += 3)
+                {
+                    for (size_t e = 0; e < 3; ++e)
+                    {
+                        const uint32_t v0 = m_indices[i + e];
+                        const uint32_t v1 = m_indices[i + (e + 1) % 3];
+
+                        // Both directions of the edge are considered once (by the edge of the smaller first vertex, or by the only collapsible direction)
+                        if (m_isLocked[v0] && m_isLocked[v1])
+                        {
+                            continue;
+                        }
+                        if (!m_isLocked[v0] && !m_isLocked[v1] && v0 > v1)
+                        {
+                            continue;
+                        }
+
+                        Quadric quadric = m_quadrics[v0];
+                        quadric.add(m_quadrics[v1]);
+
+                        Collapse collapse{InvalidIndex, InvalidIndex, std::numeric_limits<double>::max()};
+                        if (!m_isLocked[v0])
+                        {
+                            collapse = {v0, v1, quadric.evaluate(m_positions[v1])};
+                        }
+                        if (!m_isLocked[v1])
+                        {
+                            if (const double cost = quadric.evaluate(m_positions[v0]); cost < collapse.cost)
+                            {
+                                collapse = {v1, v0, cost};
+                            }
+                        }
+
+                        if (collapse.cost <= maxCost)
+                        {
+                            collapses.push_back(collapse);
+                        }
+                    }
+                }
+
+                eastl::sort(collapses.begin(), collapses.end(), [](const Collapse& left, const Collapse& right)
+                {
+                    return left.cost < right.cost;
+                });
+
+                // Every collapse removes two triangles of the manifold mesh
+                const size_t triangleCount = m_indices.size() / 3;
+                const size_t targetTriangleCount = targetIndexCount / 3;
+                const size_t maxCollapses = (triangleCount - targetTriangleCount + 1) / 2;
+
+                eastl::vector<uint32_t> collapseTargets(m_positions.size(), InvalidIndex);
+                eastl::vector<bool> isTouched(m_positions.size(), false);
+                size_t collapsesCount = 0;
+
+                for (const Collapse& collapse : collapses)
+                {
+                    if (collapsesCount >= maxCollapses)
+                    {
+                        break;
+                    }
+
+                    // The vertices around the applied collapses are changed: their collapses are evaluated in the next pass
+                    if (isTouched[collapse.from] || isTouched[collapse.to] || !isCollapseValid(collapse.from, collapse.to))
+                    {
+                        continue;
+                    }
+
+                    for (uint32_t a = m_adjacencyOffsets[collapse.from]; a < m_adjacencyOffsets[collapse.from + 1]; ++a)
+                    {
+                        const uint32_t* const triangle = &m_indices[m_adjacency[a] * 3];
+                        isTouched[triangle[0]] = isTouched[triangle[1]] = isTouched[triangle[2]] = true;
+                    }
+
+                    collapseTargets[collapse.from] = collapse.to;
+                    m_quadrics[collapse.to].add(m_quadrics[collapse.from]);
+                    maxAppliedCost = std::max(maxAppliedCost, collapse.cost);
+                    ++collapsesCount;
+                }
+
+                if (collapsesCount == 0)
+                {
+                    return 0;
+                }
+
+                size_t writeIndex = 0;
+                for (size_t i = 0; i < m_indices.size(); i += 3)
+                {
+                    uint32_t triangle[3];
+                    for (size_t v = 0; v < 3; ++v)
+                    {
+                        const uint32_t index = m_indices[i + v];
+                        triangle[v] = collapseTargets[index] != InvalidIndex ? collapseTargets[index] : index;
+                    }
+
+                    if (triangle[0] != triangle[1] && triangle[1] != triangle[2] && triangle[0] != triangle[2])
+                    {
+                        m_indices[writeIndex++] = triangle[0];
+                        m_indices[writeIndex++] = triangle[1];
+                        m_indices[writeIndex++] = triangle[2];
+                    }
+                }
+
+                m_indices.resize(writeIndex);
+                return collapsesCount;
+            }
+
+            eastl::vector<uint32_t> m_indices;
+            eastl::vector<Position> m_positions;
+            eastl::vector<bool> m_isLocked;
+            eastl::vector<Quadric> m_quadrics;
+
+            eastl::vector<uint32_t> m_adjacencyOffsets;
+            eastl::vector<uint32_t> m_adjacency;
+
+            double m_meshSize = 0.;
+        };
+    }  // namespace
+
+    eastl::vector<uint32_t> simplifyMesh(eastl::span<const uint32_t> indices, size_t vertexCount, const MeshVertexStream& positions,
+                                         size_t targetIndexCount, float maxError, float* resultError)
+    {
+        NAU_ASSERT(indices.size() % 3 == 0);
+
+        MeshSimplifier simplifier{indices, vertexCount, positions};
+
+        double error = 0.;
+        eastl::vector<uint32_t> result = simplifier.simplify(targetIndexCount, maxError, error);
+
+        if (resultError)
+        {
+            *resultError = static_cast<float>(error);
+        }
+
+        return result;
+    }
+
+    eastl::vector<MeshLod> generateMeshLods(eastl::span<const uint32_t> indices, size_t vertexCount, const MeshVertexStream& positions,
+                                            eastl::span<const MeshIndexRange> slots,
+                                            const MeshLodSettings& settings)
+    {
+        const MeshIndexRange wholeMesh{0, static_cast<uint32_t>(indices.size())};
+        if (slots.empty())
+        {
+            slots = {&wholeMesh, 1};
+        }
+
+        eastl::vector<MeshLod> lods;
+        size_t previousIndexCount = indices.size();
+        float previousScreenSize = 1.f;
+        float previousError = 0.f;
+
+        for (const MeshLodLevelSettings& level : settings.levels)
+        {
+            MeshLod lod;
+            lod.error = previousError;
+
+            for (const MeshIndexRange& slot : slots)
+            {
+                NAU_ASSERT(slot.startIndex + slot.indexCount <= indices.size());
+
+                const eastl::span<const uint32_t> slotIndices = indices.subspan(slot.startIndex, slot.indexCount);
+                const size_t targetIndexCount = static_cast<size_t>(static_cast<float>(slot.indexCount / 3) * level.ratio) * 3;
+
+                float slotError = 0.f;
+                const eastl::vector<uint32_t> slotLodIndices = simplifyMesh(slotIndices, vertexCount, positions, targetIndexCount, level.maxError, &slotError);
+
+                lod.slots.push_back({static_cast<uint32_t>(lod.indices.size()), static_cast<uint32_t>(slotLodIndices.size())});
+                lod.indices.insert(lod.indices.end(), slotLodIndices.begin(), slotLodIndices.end());
+                lod.error = std::max(lod.error, slotError);
+            }
+
+            if (static_cast<float>(lod.indices.size()) > static_cast<float>(previousIndexCount) * settings.minReduction)
+            {
+                // The error limit is reached: the next levels allow the bigger errors
+                continue;
+            }
+
+            // The projected error of the lod: error * screenSize * referenceScreenHeight pixels
+            float screenSize = lod.error > 0.f ? settings.maxPixelError / (lod.error * settings.referenceScreenHeight) : previousScreenSize * 0.5f;
+            screenSize = std::min(screenSize, previousScreenSize * 0.99f);
+
+            lod.screenSize = screenSize;
+            previousScreenSize = screenSize;
+            previousIndexCount = lod.indices.size();
+            previousError = lod.error;
+
+            lods.push_back(std::move(lod));
+        }
+
+        return lods;
+    }
+}  // namespace nau
@@ -0,0 +1,280 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "nau/assets/native_material.h"
+
+#include "nau/math/math.h"
+#include "nau/serialization/runtime_value_builder.h"
+
+namespace nau
+{
+    namespace
+    {
+        size_t alignDataOffset(size_t offset)
+        {
+            return (offset + NativeMaterialDataAlignment - 1) & ~(NativeMaterialDataAlignment - 1);
+        }
+
+        NativeMaterialBlock appendBlock(eastl::vector<std::byte>& buffer, eastl::span<const std::byte> data)
+        {
+            buffer.resize(alignDataOffset(buffer.size()));
+
+            const NativeMaterialBlock block{static_cast<uint32_t>(buffer.size()), static_cast<uint32_t>(data.size())};
+            buffer.insert(buffer.end(), data.begin(), data.end());
+
+            return block;
+        }
+
+        NativeMaterialBlock appendString(eastl::vector<std::byte>& buffer, eastl::string_view str)
+        {
+            return appendBlock(buffer, eastl::as_bytes(eastl::span{str.data(), str.size()}));
+        }
+
+        template <typename T>
+        NativeMaterialBlock appendTable(eastl::vector<std::byte>& buffer, const eastl::vector<T>& table)
+        {
+            return appendBlock(buffer, eastl::as_bytes(eastl::span{table.data(), table.size()}));
+        }
+
+        template <typename T>
+        uint8_t getStateValue(const eastl::optional<T>& state)
+        {
+            return state ? static_cast<uint8_t>(*state) : NativeMaterialNoState;
+        }
+
+        template <typename T>
+        eastl::optional<T> makeStateValue(uint8_t value)
+        {
+            return value != NativeMaterialNoState ? eastl::make_optional(static_cast<T>(value)) : eastl::nullopt;
+        }
+
+        Result<NativeMaterialProperty> appendProperty(eastl::vector<std::byte>& buffer, const eastl::string& name, const RuntimeValue::Ptr& value)
+        {
+            NativeMaterialProperty property{};
+            property.name = appendString(buffer, name);
+
+            if (value->is<RuntimeStringValue>())
+            {
+                property.type = static_cast<uint8_t>(NativeMaterialPropertyType::String);
+                property.value = appendString(buffer, *runtimeValueCast<eastl::string>(value));
+            }
+            else if (value->is<RuntimeIntegerValue>())
+            {
+                const int32_t intValue = *runtimeValueCast<int32_t>(value);
+                property.type = static_cast<uint8_t>(NativeMaterialPropertyType::Int);
+                property.value = appendBlock(buffer, eastl::as_bytes(eastl::span{&intValue, 1}));
+            }
+            else if (value->is<RuntimeReadonlyCollection>())
+            {
+                const math::Vector4 color = *runtimeValueCast<math::Vector4>(value);
+                const float colorValue[] = {static_cast<float>(color.getX()), static_cast<float>(color.getY()), static_cast<float>(color.getZ()), static_cast<float>(color.getW())};
+                property.type = static_cast<uint8_t>(NativeMaterialPropertyType::Color);
+                property.value = appendBlock(buffer, eastl::as_bytes(eastl::span{colorValue}));
+            }
+            else
+            {
+                return NauMakeError("The material property ({}) is not cooked: unsupported value", name);
+            }
+
+            return property;
+        }
+    }  // namespace
+
+    Result<eastl::vector<std::byte>> writeNativeMaterial(const Material& material)
+    {
+        if (material.master)
+        {
+            return NauMakeError("The material instance ({}) can not be cooked", material.name);
+        }
+
+        NativeMaterialHeader header{};
+        header.magic = NativeMaterialMagic;
+        header.version = NativeMaterialVersion;
+        header.pipelineCount = static_cast<uint32_t>(material.pipelines.size());
+
+        eastl::vector<std::byte> buffer(sizeof(NativeMaterialHeader) + sizeof(NativeMaterialPipeline) * material.pipelines.size());
+        header.name = appendString(buffer, material.name);
+
+        eastl::vector<NativeMaterialPipeline> pipelines;
+        pipelines.reserve(material.pipelines.size());
+
+        for (const auto& [name, source] : material.pipelines)
+        {
+            NativeMaterialPipeline& pipeline = pipelines.emplace_back();
+            memset(&pipeline, 0, sizeof(pipeline));
+            pipeline.name = appendString(buffer, name);
+
+            eastl::vector<NativeMaterialBlock> shaders;
+            for (const eastl::string& shader : source.shaders)
+            {
+                shaders.push_back(appendString(buffer, shader));
+            }
+            pipeline.shaders = appendTable(buffer, shaders);
+
+            eastl::vector<NativeMaterialConstantBuffer> constantBuffers;
+            for (const auto& [bufferName, data] : source.constantBuffers)
+            {
+                constantBuffers.push_back({appendString(buffer, bufferName), appendBlock(buffer, data)});
+            }
+            pipeline.constantBuffers = appendTable(buffer, constantBuffers);
+
+            eastl::vector<NativeMaterialProperty> properties;
+            for (const auto& [propertyName, value] : source.properties)
+            {
+                Result<NativeMaterialProperty> property = appendProperty(buffer, propertyName, value);
+                NauCheckResult(property);
+                properties.push_back(*property);
+            }
+            pipeline.properties = appendTable(buffer, properties);
+
+            pipeline.cullMode = getStateValue(source.cullMode);
+            pipeline.depthMode = getStateValue(source.depthMode);
+            pipeline.blendMode = getStateValue(source.blendMode);
+            pipeline.isScissorsEnabled = getStateValue(source.isScissorsEnabled);
+            pipeline.stencilCmpFunc = getStateValue(source.stencilCmpFunc);
+        }
+
+        eastl::vector<NativeMaterialBlock> instanceProperties;
+        for (const eastl::string& propertyName : material.instanceProperties)
+        {
+            instanceProperties.push_back(appendString(buffer, propertyName));
+        }
+        header.instanceProperties = appendTable(buffer, instanceProperties);
+
+        memcpy(buffer.data(), &header, sizeof(header));
+        memcpy(buffer.data() + sizeof(header), pipelines.data(), sizeof(NativeMaterialPipeline) * pipelines.size());
+
+        return buffer;
+    }
+
+    Result<Material> readNativeMaterial(eastl::span<const std::byte> data)
+    {
+        if (data.size() < sizeof(NativeMaterialHeader))
+        {
+            return NauMakeError("The native material is truncated");
+        }
+
+        NativeMaterialHeader header;
+        memcpy(&header, data.data(), sizeof(NativeMaterialHeader));
+        if (header.magic != NativeMaterialMagic || header.version != NativeMaterialVersion)
+        {
+            return NauMakeError("Unsupported native material version ({})", header.version);
+        }
+
+        bool isValid = true;
+
+        const auto getBlock = [&data, &isValid](const NativeMaterialBlock& block)
+        {
+            if (block.offset > data.size() || block.size > data.size() - block.offset)
+            {
+                isValid = false;
+                return eastl::span<const std::byte>{};
+            }
+
+            return data.subspan(block.offset, block.size);
+        };
+
+        const auto getString = [&getBlock](const NativeMaterialBlock& block)
+        {
+            const eastl::span<const std::byte> str = getBlock(block);
+            return eastl::string{reinterpret_cast<const char*>(str.data()), str.size()};
+        };
+
+        const auto getTable = [&getBlock, &isValid]<typename T>(const NativeMaterialBlock& block, eastl::vector<T>& table)
+        {
+            const eastl::span<const std::byte> tableData = getBlock(block);
+            isValid = isValid && tableData.size() % sizeof(T) == 0;
+
+            table.resize(isValid ? tableData.size() / sizeof(T) : 0);
+            memcpy(table.data(), tableData.data(), sizeof(T) * table.size());
+        };
+
+        if (data.size() - sizeof(NativeMaterialHeader) < sizeof(NativeMaterialPipeline) * static_cast<size_t>(header.pipelineCount))
+        {
+            return NauMakeError("The native material is truncated");
+        }
+
+        eastl::vector<NativeMaterialPipeline> pipelines(header.pipelineCount);
+        memcpy(pipelines.data(), data.data() + sizeof(NativeMaterialHeader), sizeof(NativeMaterialPipeline) * pipelines.size());
+
+        Material material;
+        material.name = getString(header.name);
+
+        eastl::vector<NativeMaterialBlock> shaders;
+        eastl::vector<NativeMaterialConstantBuffer> constantBuffers;
+        eastl::vector<NativeMaterialProperty> properties;
+
+        for (const NativeMaterialPipeline& source : pipelines)
+        {
+            MaterialPipeline& pipeline = material.pipelines[getString(source.name)];
+
+            getTable(source.shaders, shaders);
+            pipeline.shaders.reserve(shaders.size());
+            for (const NativeMaterialBlock& shader : shaders)
+            {
+                pipeline.shaders.push_back(getString(shader));
+            }
+
+            getTable(source.constantBuffers, constantBuffers);
+            for (const NativeMaterialConstantBuffer& constantBuffer : constantBuffers)
+            {
+                const eastl::span<const std::byte> bufferData = getBlock(constantBuffer.data);
+                pipeline.constantBuffers[getString(constantBuffer.name)].assign(bufferData.begin(), bufferData.end());
+            }
+
+            getTable(source.properties, properties);
+            for (const NativeMaterialProperty& property : properties)
+            {
+                const eastl::span<const std::byte> value = getBlock(property.value);
+                RuntimeValue::Ptr& propertyValue = pipeline.properties[getString(property.name)];
+
+                switch (static_cast<NativeMaterialPropertyType>(property.type))
+                {
+                    case NativeMaterialPropertyType::Int:
+                    {
+                        int32_t intValue = 0;
+                        isValid = isValid && value.size() == sizeof(intValue);
+                        memcpy(&intValue, value.data(), isValid ? sizeof(intValue) : 0);
+                        propertyValue = makeValueCopy(intValue);
+                        break;
+                    }
+                    case NativeMaterialPropertyType::String:
+                        propertyValue = makeValueCopy(eastl::string{reinterpret_cast<const char*>(value.data()), value.size()});
+                        break;
+                    case NativeMaterialPropertyType::Color:
+                    {
+                        float color[4] = {};
+                        isValid = isValid && value.size() == sizeof(color);
+                        memcpy(color, value.data(), isValid ? sizeof(color) : 0);
+                        propertyValue = makeValueCopy(math::Vector4{color[0], color[1], color[2], color[3]});
+                        break;
+                    }
+                    default:
+                        isValid = false;
+                }
+            }
+
+            pipeline.cullMode = makeStateValue<CullMode>(source.cullMode);
+            pipeline.depthMode = makeStateValue<DepthMode>(source.depthMode);
+            pipeline.blendMode = makeStateValue<BlendMode>(source.blendMode);
+            pipeline.isScissorsEnabled = makeStateValue<bool>(source.isScissorsEnabled);
+            pipeline.stencilCmpFunc = makeStateValue<ComparisonFunc>(source.stencilCmpFunc);
+        }
+
+        eastl::vector<NativeMaterialBlock> instanceProperties;
+        getTable(header.instanceProperties, instanceProperties);
+        material.instanceProperties.reserve(instanceProperties.size());
+        for (const NativeMaterialBlock& propertyName : instanceProperties)
+        {
+            material.instanceProperties.push_back(getString(propertyName));
+        }
+
+        if (!isValid)
+        {
+            return NauMakeError("The native material block is out of the data");
+        }
+
+        return material;
+    }
+}  // namespace nau
@@ -0,0 +1,172 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "nau/assets/native_mesh.h"
+
+namespace nau
+{
+    namespace
+    {
+        size_t alignDataOffset(size_t offset)
+        {
+            return (offset + NativeMeshDataAlignment - 1) & ~(NativeMeshDataAlignment - 1);
+        }
+
+        NativeMeshBlock appendBlock(eastl::vector<std::byte>& buffer, eastl::span<const std::byte> data)
+        {
+            buffer.resize(alignDataOffset(buffer.size()));
+
+            const NativeMeshBlock block{buffer.size(), data.size()};
+            buffer.insert(buffer.end(), data.begin(), data.end());
+
+            return block;
+        }
+    }  // namespace
+
+    eastl::vector<std::byte> writeNativeMesh(const NativeMeshData& mesh)
+    {
+        NativeMeshHeader header{};
+        header.magic = NativeMeshMagic;
+        header.version = NativeMeshVersion;
+        header.vertexCount = mesh.description.vertexCount;
+        header.indexCount = mesh.description.indexCount;
+        header.indexFormat = static_cast<uint8_t>(mesh.description.indexFormat);
+        header.attributeCount = static_cast<uint32_t>(mesh.attributes.size());
+        header.lodCount = static_cast<uint32_t>(mesh.lods.size());
+
+        for (unsigned i = 0; i < 3; ++i)
+        {
+            header.boundsMin[i] = static_cast<float>(mesh.bounds.lim[0][i]);
+            header.boundsMax[i] = static_cast<float>(mesh.bounds.lim[1][i]);
+        }
+
+        eastl::vector<std::byte> buffer(sizeof(NativeMeshHeader) + sizeof(NativeMeshAttribute) * mesh.attributes.size() + sizeof(NativeMeshLod) * mesh.lods.size());
+        header.indices = appendBlock(buffer, mesh.indices);
+
+        eastl::vector<NativeMeshAttribute> attributes(mesh.attributes.size());
+        for (size_t i = 0; i < mesh.attributes.size(); ++i)
+        {
+            const NativeMeshData::Attribute& source = mesh.attributes[i];
+            NAU_ASSERT(source.description.semantic.size() < sizeof(NativeMeshAttribute::semantic));
+
+            NativeMeshAttribute& attribute = attributes[i];
+            memset(&attribute, 0, sizeof(attribute));
+            memcpy(attribute.semantic, source.description.semantic.data(), std::min(source.description.semantic.size(), sizeof(attribute.semantic) - 1));
+            attribute.semanticIndex = source.description.semanticIndex;
+            attribute.elementFormat = static_cast<uint8_t>(source.description.elementFormat);
+            attribute.attributeType = static_cast<uint8_t>(source.description.attributeType);
+            attribute.data = appendBlock(buffer, source.data);
+        }
+
+        eastl::vector<NativeMeshLod> lods(mesh.lods.size());
+        for (size_t i = 0; i < mesh.lods.size(); ++i)
+        {
+            lods[i].indexCount = mesh.lods[i].description.indexCount;
+            lods[i].screenSize = mesh.lods[i].description.screenSize;
+            lods[i].indices = appendBlock(buffer, mesh.lods[i].indices);
+        }
+
+        std::byte* const tables = buffer.data();
+        memcpy(tables, &header, sizeof(header));
+        memcpy(tables + sizeof(header), attributes.data(), sizeof(NativeMeshAttribute) * attributes.size());
+        memcpy(tables + sizeof(header) + sizeof(NativeMeshAttribute) * attributes.size(), lods.data(), sizeof(NativeMeshLod) * lods.size());
+
+        return buffer;
+    }
+
+    Result<NativeMeshView> NativeMeshView::open(eastl::span<const std::byte> data)
+    {
+        NativeMeshView view;
+        view.m_data = data;
+
+        if (data.size() < sizeof(NativeMeshHeader))
+        {
+            return NauMakeError("The native mesh is truncated");
+        }
+
+        memcpy(&view.m_header, data.data(), sizeof(NativeMeshHeader));
+        const NativeMeshHeader& header = view.m_header;
+        if (header.magic != NativeMeshMagic || header.version != NativeMeshVersion)
+        {
+            return NauMakeError("Unsupported native mesh version ({})", header.version);
+        }
+
+        const size_t tablesSize = sizeof(NativeMeshHeader) + sizeof(NativeMeshAttribute) * header.attributeCount + sizeof(NativeMeshLod) * header.lodCount;
+        if (data.size() < tablesSize)
+        {
+            return NauMakeError("The native mesh is truncated");
+        }
+
+        view.m_attributes.resize(header.attributeCount);
+        memcpy(view.m_attributes.data(), data.data() + sizeof(NativeMeshHeader), sizeof(NativeMeshAttribute) * header.attributeCount);
+
+        view.m_lods.resize(header.lodCount);
+        memcpy(view.m_lods.data(), data.data() + sizeof(NativeMeshHeader) + sizeof(NativeMeshAttribute) * header.attributeCount, sizeof(NativeMeshLod) * header.lodCount);
+
+        const auto isValidBlock = [&data](const NativeMeshBlock& block)
+        {
+            return block.offset <= data.size() && block.size <= data.size() - block.offset;
+        };
+
+        bool isValid = isValidBlock(header.indices);
+        for (NativeMeshAttribute& attribute : view.m_attributes)
+        {
+            attribute.semantic[sizeof(attribute.semantic) - 1] = '\0';
+            isValid = isValid && isValidBlock(attribute.data);
+        }
+
+        for (const NativeMeshLod& lod : view.m_lods)
+        {
+            isValid = isValid && isValidBlock(lod.indices);
+        }
+
+        if (!isValid)
+        {
+            return NauMakeError("The native mesh block is out of the data");
+        }
+
+        return view;
+    }
+
+    MeshDescription NativeMeshView::getDescription() const
+    {
+        return {m_header.indexCount, m_header.vertexCount, static_cast<ElementFormat>(m_header.indexFormat)};
+    }
+
+    math::BBox3 NativeMeshView::getBounds() const
+    {
+        return math::BBox3{math::vec3{m_header.boundsMin[0], m_header.boundsMin[1], m_header.boundsMin[2]},
+                           math::vec3{m_header.boundsMax[0], m_header.boundsMax[1], m_header.boundsMax[2]}};
+    }
+
+    eastl::span<const std::byte> NativeMeshView::getIndices() const
+    {
+        return getBlock(m_header.indices);
+    }
+
+    const eastl::vector<NativeMeshAttribute>& NativeMeshView::getAttributes() const
+    {
+        return m_attributes;
+    }
+
+    const NativeMeshAttribute* NativeMeshView::findAttribute(eastl::string_view semantic, unsigned semanticIndex) const
+    {
+        auto iter = eastl::find_if(m_attributes.begin(), m_attributes.end(), [&](const NativeMeshAttribute& attribute)
+        {
+            return attribute.semanticIndex == semanticIndex && semantic == eastl::string_view{attribute.semantic};
+        });
+
+        return iter != m_attributes.end() ? &(*iter) : nullptr;
+    }
+
+    const eastl::vector<NativeMeshLod>& NativeMeshView::getLods() const
+    {
+        return m_lods;
+    }
+
+    eastl::span<const std::byte> NativeMeshView::getBlock(const NativeMeshBlock& block) const
+    {
+        return m_data.subspan(static_cast<size_t>(block.offset), static_cast<size_t>(block.size));
+    }
+}  // namespace nau
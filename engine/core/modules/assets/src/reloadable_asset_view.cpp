@@ -15,6 +15,19 @@ namespace nau
     {
         lock_(m_mutex);
         m_assetView = newAssetView;
+        m_reloadRequest = {};
+    }
+
+    void ReloadableAssetView::evictAssetView(Functor<void()> reloadRequest)
+    {
+        lock_(m_mutex);
+        m_assetView = nullptr;
+        m_reloadRequest = std::move(reloadRequest);
+    }
+
+    bool ReloadableAssetView::checkIsUsed()
+    {
+        return m_isUsed.exchange(false, std::memory_order_relaxed);
     }
 
     ReloadableAssetView::ReloadableAssetView(nullptr_t) :
@@ -24,7 +37,21 @@ namespace nau
 
     ReloadableAssetView::AssetViewPtr ReloadableAssetView::get()
     {
-        lock_(m_mutex);
-        return m_assetView;
+        m_isUsed.store(true, std::memory_order_relaxed);
+
+        Functor<void()> reloadRequest;
+        {
+            lock_(m_mutex);
+            if (m_assetView || !m_reloadRequest)
+            {
+                return m_assetView;
+            }
+
+            reloadRequest = std::move(m_reloadRequest);
+        }
+
+        // The view is set back with reloadAssetView() when the asset is loaded.
+        reloadRequest();
+        return nullptr;
     }
 }  // namespace nau
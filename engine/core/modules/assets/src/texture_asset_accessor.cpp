@@ -0,0 +1,25 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "nau/assets/texture_asset_accessor.h"
+
+#include <atomic>
+
+namespace nau
+{
+    namespace
+    {
+        std::atomic<uint64_t> g_textureDecodeFallbackCount = 0;
+    }
+
+    uint64_t getTextureDecodeFallbackCount()
+    {
+        return g_textureDecodeFallbackCount.load(std::memory_order_relaxed);
+    }
+
+    void addTextureDecodeFallback()
+    {
+        g_textureDecodeFallbackCount.fetch_add(1, std::memory_order_relaxed);
+    }
+}  // namespace nau
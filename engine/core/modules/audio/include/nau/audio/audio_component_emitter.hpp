@@ -5,6 +5,7 @@
 
 #include "nau/audio/audio_common.hpp"
 #include "nau/audio/audio_container.hpp"
+#include "nau/async/task.h"
 #include "nau/meta/class_info.h"
 #include "nau/scene/components/component_attributes.h"
 #include "nau/scene/components/component_life_cycle.h"
@@ -12,6 +13,8 @@
 #include "nau/scene/scene.h"
 #include "nau/rtti/ptr.h"
 
+#include <atomic>
+
 
 NAU_AUDIO_BEGIN
 
@@ -31,7 +34,11 @@ struct NAU_AUDIO_EXPORT AudioComponentEmitter
     NAU_CLASS_FIELDS(
         CLASS_FIELD(containerAssetUid),
         CLASS_FIELD(loop),
-        CLASS_FIELD(playOnStart))
+        CLASS_FIELD(playOnStart),
+        CLASS_FIELD(voiceCategory),
+        CLASS_FIELD(priority),
+        CLASS_FIELD(spatial),
+        CLASS_FIELD(maxDistance))
 
     /**
      * @brief Advances all managed audio sources playbacks.
@@ -43,15 +50,26 @@ struct NAU_AUDIO_EXPORT AudioComponentEmitter
     void activateComponent() override;
     void deactivateComponent() override;
 
+    /**
+     * @brief Passes the world transform to the playing source if it has changed (called by AudioService::syncSpatialParams).
+     */
+    void syncSpatialParams();
+
     // Properties
     nau::Uid containerAssetUid;
     AudioAssetContainerPtr container = nullptr;
     AudioSourcePtr source = nullptr;
     bool loop = false;
     bool playOnStart = false;
+    eastl::string voiceCategory;  // See IAudioEngine::setVoiceLimit
+    int priority = 0;
+    bool spatial = false;       // The source is heard from the emitter position by the listener
+    float maxDistance = 50.f;   // Beyond it the spatial source is culled
 
 protected:
-    void createContainerFromBlk(const eastl::string& path);
+    // The container is created at once, its sounds are added as they are loaded
+    async::Task<> createContainerFromBlk(eastl::string path);
+    void notifyTransformChanged() override;
 
 private:
     enum State
@@ -59,6 +77,8 @@ private:
         Unloaded,
         Playing
     } state;
+
+    std::atomic<bool> m_isTransformChanged = true;  // Set by the batched transform notifications, cleared by the spatial sync
 };
 
 NAU_AUDIO_END
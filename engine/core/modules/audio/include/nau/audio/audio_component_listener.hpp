@@ -5,15 +5,21 @@
 
 #include "nau/audio/audio_common.hpp"
 #include "nau/audio/audio_component_emitter.hpp"
+#include "nau/audio/audio_engine.hpp"
 #include "nau/scene/components/component_attributes.h"
+#include "nau/scene/components/component_life_cycle.h"
 #include "nau/scene/components/internal/component_internal_attributes.h"
 #include "nau/scene/scene.h"
 
+#include <atomic>
+
 NAU_AUDIO_BEGIN
 
-struct NAU_AUDIO_EXPORT AudioComponentListener : public scene::SceneComponent
+struct NAU_AUDIO_EXPORT AudioComponentListener
+    : public scene::SceneComponent,
+      public scene::IComponentActivation
 {
-    NAU_OBJECT(AudioComponentListener, scene::SceneComponent)
+    NAU_OBJECT(AudioComponentListener, scene::SceneComponent, scene::IComponentActivation)
 
 
     NAU_CLASS_ATTRIBUTES(
@@ -24,8 +30,22 @@ struct NAU_AUDIO_EXPORT AudioComponentListener : public scene::SceneComponent
     NAU_CLASS_FIELDS(
         CLASS_FIELD(emitters))
 
+    void activateComponent() override;
+    void deactivateComponent() override;
+
+    /**
+     * @brief Passes the world transform to the audio engine if it has changed (called by AudioService::syncSpatialParams).
+     */
+    void syncSpatialParams(IAudioEngine& engine);
+
     // Properties
     eastl::vector<AudioComponentEmitter> emitters;
+
+protected:
+    void notifyTransformChanged() override;
+
+private:
+    std::atomic<bool> m_isTransformChanged = true;
 };
 
 NAU_AUDIO_END
@@ -187,6 +187,31 @@ public:
 	 */
 	void setEndCallback(SoundCompletionCallback callback) override;
 
+	/**
+	 * @brief Assigns all audio sources in the container to the voice category.
+	 */
+	void setVoiceCategory(const eastl::string& category) override;
+
+	/**
+	 * @brief Sets the voice priority of all audio sources in the container.
+	 */
+	void setPriority(int priority) override;
+
+	/**
+	 * @brief Sets the estimated loudness of all audio sources in the container.
+	 */
+	void setAudibility(float audibility) override;
+
+	/**
+	 * @brief Checks whether the currently played audio source plays virtually.
+	 */
+	bool isVirtual() const override;
+
+	/**
+	 * @brief Spatializes all audio sources in the container.
+	 */
+	void setSpatialParams(const AudioSpatialParams& params) override;
+
 	/**
 	 * @brief Adds the audio source to the container.
 	 * 
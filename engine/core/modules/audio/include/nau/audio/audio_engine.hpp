@@ -7,9 +7,21 @@
 #include "audio_container.hpp"
 #include "audio_asset.hpp"
 
+#include "nau/async/task.h"
+#include "nau/utils/enum/enum_reflection.h"
+
 
 NAU_AUDIO_BEGIN
 
+/**
+ * @brief Enumerates the ways the sound data is kept by the engine (see IAudioEngine::loadSoundAsync).
+ *
+ * Decode		The sound is decoded once and kept in memory as PCM: cheap to play, suits the short often played sounds.
+ * Compressed	The encoded file is kept in memory and decoded by each playing source: less memory, more mixing cost.
+ * Stream		The sound is read and decoded in pieces while playing: suits the long sounds (e.g. music tracks).
+ */
+NAU_DEFINE_ENUM_(AudioLoadMode, Decode, Compressed, Stream);
+
 // ** IAudioEngine
 
 class NAU_AUDIO_EXPORT IAudioEngine
@@ -47,6 +59,10 @@ public:
 	 */
 	virtual void deinitialize() = 0;
 
+	/**
+	 * @brief Applies the changed spatial parameters in one pass, dispatches the ended playbacks and redistributes the voices
+	 * between the playing audio sources.
+	 */
 	virtual void update() = 0;
 
 	// Asset creation
@@ -54,15 +70,18 @@ public:
 	/**
 	 * @brief Creates an audio asset from the file.
 	 * 
-	 * @param [in] path Path to the audio file.
+	 * @param [in] path Path to the audio file (virtual file system path or native one).
 	 * @return			A pointer to the created asset.
+	 * 
+	 * @note	The sound is decoded once and kept in memory. The asset of the already loaded file is returned as is,
+	 *			its sources share the decoded data.
 	 */
 	virtual AudioAssetPtr loadSound(const eastl::string& path) = 0;
 
 	/**
 	 * @brief Creates an audio asset from the streamed audio file.
 	 * 
-	 * @param [in] path Path to the audio file to stream.
+	 * @param [in] path Path to the audio file to stream (virtual file system path or native one).
 	 * @return			A pointer to the created asset.
 	 * 
 	 * @note	When a large audio file (e.g. a music track) is to be loaded, it is more efficent to stream it then to boldly load the entire file.
@@ -70,6 +89,42 @@ public:
 	 */
 	virtual AudioAssetPtr loadStream(const eastl::string& path) = 0;
 
+	/**
+	 * @brief Creates an audio asset from the file without blocking the calling thread.
+	 * 
+	 * @param [in] path Path to the audio file (virtual file system path or native one).
+	 * @param [in] mode Determines how the sound data is kept (see AudioLoadMode).
+	 * @return			Task resolved with the created asset (null if the file can not be loaded).
+	 * 
+	 * @note	The file is read and decoded by the backend job threads. The task is resolved once the data is ready to play:
+	 *			when the whole file is loaded or, for the streamed sound, when its first pieces are decoded.
+	 *			The concurrent requests of the same file share a single load, the asset of the already loaded file is returned as is.
+	 */
+	virtual async::Task<AudioAssetPtr> loadSoundAsync(const eastl::string& path, AudioLoadMode mode = AudioLoadMode::Decode) = 0;
+
+	// Voice management
+
+	/**
+	 * @brief Limits the number of the simultaneously mixed voices of the category (see IAudioSource::setVoiceCategory).
+	 * 
+	 * @param [in] category  Name of the category. The empty name is the default category.
+	 * @param [in] maxVoices Maximum number of the voices. The sources above the limit play virtually.
+	 * 
+	 * @note The total number of the voices is limited by the preallocated voice pool of the backend.
+	 */
+	virtual void setVoiceLimit(const eastl::string& category, uint32_t maxVoices) = 0;
+
+	/**
+	 * @brief Sets the placement of the listener the spatialized sources are heard by.
+	 * 
+	 * @param [in] position  Listener position.
+	 * @param [in] direction Direction the listener faces.
+	 * @param [in] up        Listener up direction.
+	 * 
+	 * @note Applied by the next @ref update.
+	 */
+	virtual void setListener(const math::vec3& position, const math::vec3& direction, const math::vec3& up) = 0;
+
 	/**
 	 * @brief
 	 */
@@ -8,9 +8,14 @@
 
 #include "nau/audio/audio_engine.hpp"
 
+#include <EASTL/vector.h>
+
 
 NAU_AUDIO_BEGIN
 
+struct AudioComponentEmitter;
+struct AudioComponentListener;
+
 class NAU_AUDIO_EXPORT AudioService final
     : public IServiceInitialization
     , public IServiceShutdown
@@ -23,8 +28,22 @@ public:
 
     IAudioEngine& engine();
 
+    // Spatial sync: the active emitters and listeners are registered by themselves
+    void addEmitter(AudioComponentEmitter& emitter);
+    void removeEmitter(AudioComponentEmitter& emitter);
+    void addListener(AudioComponentListener& listener);
+    void removeListener(AudioComponentListener& listener);
+
+    /**
+     * @brief Passes the transforms of the moved emitters and of the listener to the engine (once per frame, before IAudioEngine::update).
+     */
+    void syncSpatialParams();
+
 private:
     AudioEnginePtr m_engine;
+
+    eastl::vector<AudioComponentEmitter*>   m_emitters;
+    eastl::vector<AudioComponentListener*>  m_listeners;
 };
 
 NAU_AUDIO_END
@@ -4,11 +4,13 @@
 #pragma once 
 
 #include "audio_common.hpp"
+#include "nau/math/math.h"
 
 #include <functional>
 #include <memory>
 #include <chrono>
 
+#include <EASTL/string.h>
 #include <EASTL/vector.h>
 
 
@@ -19,6 +21,23 @@ NAU_AUDIO_BEGIN
 using SoundCompletionCallback = std::function<void()>;
 
 
+// ** AudioSpatialParams
+
+/**
+ * @brief Placement of the spatialized audio source.
+ */
+struct AudioSpatialParams
+{
+	math::vec3 position = math::vec3::zero();
+	math::vec3 direction = math::vec3(0.f, 0.f, -1.f);
+
+	/**
+	 * @brief Distance at which the source becomes inaudible. The farther source is culled: it plays virtually.
+	 */
+	float maxDistance = 50.f;
+};
+
+
 // ** IAudioSource
 
 /**
@@ -106,6 +125,48 @@ public:
 	 * @param [in] next A pointer to the audio source to be played next.
 	 */
 	virtual void playNext(std::shared_ptr<IAudioSource> next);
+
+	// Voice management
+
+	/**
+	 * @brief Assigns the audio source to the voice category (see IAudioEngine::setVoiceLimit).
+	 * 
+	 * @param [in] category Name of the category. The empty name is the default category.
+	 */
+	virtual void setVoiceCategory(const eastl::string& category);
+
+	/**
+	 * @brief Sets the priority of the audio source voice.
+	 * 
+	 * @param [in] priority Value to assign. When the voices are exhausted, the sources of the higher priority take the voices of the lower ones.
+	 */
+	virtual void setPriority(int priority);
+
+	/**
+	 * @brief Sets the estimated loudness of the audio source (e.g. its volume attenuated by the distance to the listener).
+	 * 
+	 * @param [in] audibility Value to assign. Among the sources of the same priority the less audible one loses its voice first.
+	 *						  The inaudible (zero) source is not mixed at all.
+	 */
+	virtual void setAudibility(float audibility);
+
+	/**
+	 * @brief Checks whether the audio source plays virtually: its playback position advances, but it is not mixed.
+	 * 
+	 * @return `true` if the audio source has no voice, `false` otherwise.
+	 */
+	virtual bool isVirtual() const;
+
+	// Spatialization
+
+	/**
+	 * @brief Spatializes the audio source relative to the listener (see IAudioEngine::setListener).
+	 * 
+	 * @param [in] params Placement of the audio source.
+	 * 
+	 * @note The parameters are stored and applied to the mixed voice by the next IAudioEngine::update, with the other changed sources.
+	 */
+	virtual void setSpatialParams(const AudioSpatialParams& params);
 };
 
 using AudioSourcePtr = std::shared_ptr<IAudioSource>;
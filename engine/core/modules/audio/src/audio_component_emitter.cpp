@@ -44,6 +44,10 @@ void AudioComponentEmitter::updateComponent(float dt)
             }
             source = container->instantiate();
             if (!source) return;
+            source->setVoiceCategory(voiceCategory);
+            source->setPriority(priority);
+            m_isTransformChanged = true;
+            syncSpatialParams();
             if (loop) {
                 source->setEndCallback([this] {
                     source->stop();
@@ -59,6 +63,8 @@ void AudioComponentEmitter::updateComponent(float dt)
 
 void AudioComponentEmitter::activateComponent()
 {
+    nau::getServiceProvider().get<nau::audio::AudioService>().addEmitter(*this);
+
     if (!containerAssetUid) {
         return;
     }
@@ -78,7 +84,7 @@ void AudioComponentEmitter::activateComponent()
     if (itContainer != containers.end()) {  // Already loaded into the engine
         container = *itContainer;
     } else {  // Create container
-        createContainerFromBlk(absolutePath.c_str());
+        createContainerFromBlk(absolutePath.c_str()).detach();
     }
 
     NAU_LOG_DEBUG("Audio emmiter component activated");
@@ -86,25 +92,45 @@ void AudioComponentEmitter::activateComponent()
 
 void AudioComponentEmitter::deactivateComponent()
 {
+    nau::getServiceProvider().get<nau::audio::AudioService>().removeEmitter(*this);
     NAU_LOG_DEBUG("Audio emmiter component deactivated");
 }
 
-void AudioComponentEmitter::createContainerFromBlk(const eastl::string& path)
+void AudioComponentEmitter::syncSpatialParams()
+{
+    if (!spatial || !source || !m_isTransformChanged.exchange(false)) {
+        return;
+    }
+
+    const math::Transform& transform = getWorldTransform();
+    source->setSpatialParams({
+        transform.getTranslation(),
+        rotate(transform.getRotation(), math::vec3(0.f, 0.f, -1.f)),
+        maxDistance
+    });
+}
+
+void AudioComponentEmitter::notifyTransformChanged()
+{
+    SceneComponent::notifyTransformChanged();
+    m_isTransformChanged = true;
+}
+
+async::Task<> AudioComponentEmitter::createContainerFromBlk(eastl::string path)
 {
     if (path.empty()) {
         NAU_LOG_ERROR("Failed to create an audio container from blk: empty path");
-        return;
+        co_return;
     }
 
     nau::DataBlock blk;
     if (!blk.load(path.c_str())) {
         NAU_LOG_ERROR("Failed to load audio container at: {}", path);
-        return;
+        co_return;
     }
 
     auto& engine = nau::getServiceProvider().get<nau::audio::AudioService>().engine();
     auto& assetDb = nau::getServiceProvider().get<nau::IAssetDB>();
-    auto& vfs = nau::getServiceProvider().get<nau::io::IVirtualFileSystem>();
 
     // Set container kind
     const auto kindStr = blk.getStr("kind");
@@ -113,6 +139,7 @@ void AudioComponentEmitter::createContainerFromBlk(const eastl::string& path)
     container->setKind(*kind);
     
     // Add sources
+    eastl::vector<async::Task<AudioAssetPtr>> soundTasks;
     auto sourcesBlk = blk.getBlockByName("sources");
     for (int blockIndex = 0; blockIndex < sourcesBlk->blockCount(); blockIndex++)
     {
@@ -120,18 +147,21 @@ void AudioComponentEmitter::createContainerFromBlk(const eastl::string& path)
         auto sourceBlk = sourcesBlk->getBlock(blockIndex);
         auto sourceUid = sourceBlk->getStr("uid");
         const auto soundMeta = assetDb.findAssetMetaInfoByUid(*nau::Uid::parseString(sourceUid));
-        const std::string absolutePath = std::filesystem::path(vfs.resolveToNativePath(soundMeta.dbPath)).string();
-
-        // Check if asset already exists in the engine
-        const auto assets = engine.audioAssets();
-        const auto itAsset = std::find_if(assets.begin(), assets.end(), [this, absolutePath](nau::audio::AudioAssetPtr asset) {
-            return std::filesystem::path(asset->name().c_str()) == std::filesystem::path(absolutePath);
-        });
-
-        if (itAsset != assets.end()) {  // Already loaded into the engine
-            container->add(*itAsset);
-        } else {  // Loading this particular asset for the first time
-            auto sound = engine.loadSound(absolutePath.c_str());
+
+        // Optional "loadMode" of the source: Decode (default), Compressed or Stream
+        const auto loadMode = nau::EnumTraits<nau::audio::AudioLoadMode>().parse(sourceBlk->getStr("loadMode", "Decode"));
+        if (!loadMode) {
+            NAU_LOG_WARNING("Unknown audio load mode of the source {} in {}", sourceUid, path);
+        }
+
+        // The sound is read through the virtual file system (it can be packed) and decoded by the backend job threads,
+        // the engine shares the already loaded assets
+        soundTasks.push_back(engine.loadSoundAsync(soundMeta.dbPath.c_str(), loadMode ? *loadMode : AudioLoadMode::Decode));
+    }
+
+    // The sounds are loaded in parallel, the container keeps them in the order of the blk
+    for (auto& soundTask : soundTasks) {
+        if (auto sound = co_await std::move(soundTask)) {
             container->add(sound);
         }
     }
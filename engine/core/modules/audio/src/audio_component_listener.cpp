@@ -2,4 +2,41 @@
 // Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
 
 
-#include "nau/audio/audio_component_listener.hpp"
\ No newline at end of file
+#include "nau/audio/audio_component_listener.hpp"
+#include "nau/audio/audio_service.hpp"
+#include "nau/service/service_provider.h"
+
+
+NAU_AUDIO_BEGIN
+
+void AudioComponentListener::activateComponent()
+{
+    m_isTransformChanged = true;
+    getServiceProvider().get<AudioService>().addListener(*this);
+}
+
+void AudioComponentListener::deactivateComponent()
+{
+    getServiceProvider().get<AudioService>().removeListener(*this);
+}
+
+void AudioComponentListener::syncSpatialParams(IAudioEngine& engine)
+{
+    if (!m_isTransformChanged.exchange(false)) {
+        return;
+    }
+
+    const math::Transform& transform = getWorldTransform();
+    engine.setListener(
+        transform.getTranslation(),
+        rotate(transform.getRotation(), math::vec3(0.f, 0.f, -1.f)),
+        rotate(transform.getRotation(), math::vec3(0.f, 1.f, 0.f)));
+}
+
+void AudioComponentListener::notifyTransformChanged()
+{
+    SceneComponent::notifyTransformChanged();
+    m_isTransformChanged = true;
+}
+
+NAU_AUDIO_END
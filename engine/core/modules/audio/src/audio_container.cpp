@@ -194,6 +194,40 @@ void AudioContainer::setEndCallback(SoundCompletionCallback callback)
     m_sources.back()->setEndCallback(callback);
 }
 
+void AudioContainer::setVoiceCategory(const eastl::string& category)
+{
+    for (auto source : m_sources) {
+        source->setVoiceCategory(category);
+    }
+}
+
+void AudioContainer::setPriority(int priority)
+{
+    for (auto source : m_sources) {
+        source->setPriority(priority);
+    }
+}
+
+void AudioContainer::setAudibility(float audibility)
+{
+    for (auto source : m_sources) {
+        source->setAudibility(audibility);
+    }
+}
+
+bool AudioContainer::isVirtual() const
+{
+    if (!m_current) return false;
+    return m_current->isVirtual();
+}
+
+void AudioContainer::setSpatialParams(const AudioSpatialParams& params)
+{
+    for (auto source : m_sources) {
+        source->setSpatialParams(params);
+    }
+}
+
 void AudioContainer::addSource(AudioSourcePtr source)
 {
     if (m_sources.empty()) {
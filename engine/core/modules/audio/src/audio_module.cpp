@@ -7,11 +7,43 @@
 #include "nau/audio/audio_component_listener.hpp"
 #include "nau/audio/audio_service.hpp"
 
+#include "nau/app/main_loop/game_system.h"
 #include "nau/module/module.h"
+#include "nau/rtti/rtti_impl.h"
+#include "nau/service/service_provider.h"
 
 
 NAU_AUDIO_BEGIN
 
+// ** AudioGameSystem
+
+/**
+ * @brief Updates the audio engine after the components: the playbacks they started or stopped get their voices in the same frame.
+ * The moved emitters and listener are gathered before the update and applied by it in one batch.
+ */
+class AudioGameSystem final : public IGamePostUpdate, public IRttiObject
+{
+    NAU_RTTI_CLASS(nau::audio::AudioGameSystem, IGamePostUpdate, IRttiObject)
+
+private:
+    void gamePostUpdate([[maybe_unused]] std::chrono::milliseconds dt) override
+    {
+        auto& audioService = getServiceProvider().get<AudioService>();
+        audioService.syncSpatialParams();
+        audioService.engine().update();
+    }
+
+    eastl::optional<GameUpdateAccess> getPostUpdateAccess() const override
+    {
+        // The emitters/listener transforms are only read, the audio engine is guarded by the service
+        return GameUpdateAccess{
+            .reads = {GameUpdateResource::Transforms},
+            .writes = {GameUpdateResource::Audio},
+            .isThreadSafe = true};
+    }
+};
+
+
 // ** AudioModule
 
 class AudioModule : public IModule
@@ -34,6 +66,7 @@ void AudioModule::initialize()
     NAU_MODULE_EXPORT_SERVICE(AudioService);
     NAU_MODULE_EXPORT_CLASS(AudioComponentEmitter);
     NAU_MODULE_EXPORT_CLASS(AudioComponentListener);
+    NAU_MODULE_EXPORT_CLASS(AudioGameSystem);
 }
 
 void AudioModule::deinitialize()
@@ -3,6 +3,8 @@
 
 
 #include "nau/audio/audio_service.hpp"
+#include "nau/audio/audio_component_emitter.hpp"
+#include "nau/audio/audio_component_listener.hpp"
 
 
 NAU_AUDIO_BEGIN
@@ -26,4 +28,37 @@ IAudioEngine& AudioService::engine()
     return *m_engine.get();
 }
 
+void AudioService::addEmitter(AudioComponentEmitter& emitter)
+{
+    m_emitters.push_back(&emitter);
+}
+
+void AudioService::removeEmitter(AudioComponentEmitter& emitter)
+{
+    m_emitters.erase(std::remove(m_emitters.begin(), m_emitters.end(), &emitter), m_emitters.end());
+}
+
+void AudioService::addListener(AudioComponentListener& listener)
+{
+    m_listeners.push_back(&listener);
+}
+
+void AudioService::removeListener(AudioComponentListener& listener)
+{
+    m_listeners.erase(std::remove(m_listeners.begin(), m_listeners.end(), &listener), m_listeners.end());
+}
+
+void AudioService::syncSpatialParams()
+{
+    // The first activated listener is heard (miniaudio engine has the single listener by default)
+    if (!m_listeners.empty()) {
+        m_listeners.front()->syncSpatialParams(*m_engine);
+    }
+
+    // The emitters only store the changed parameters, the engine applies them to the voices in one pass
+    for (AudioComponentEmitter* const emitter : m_emitters) {
+        emitter->syncSpatialParams();
+    }
+}
+
 NAU_AUDIO_END
\ No newline at end of file
@@ -20,5 +20,26 @@ void IAudioSource::rewind()
     seek(std::chrono::milliseconds(0));
 }
 
+void IAudioSource::setVoiceCategory([[maybe_unused]] const eastl::string& category)
+{
+}
+
+void IAudioSource::setPriority([[maybe_unused]] int priority)
+{
+}
+
+void IAudioSource::setAudibility([[maybe_unused]] float audibility)
+{
+}
+
+bool IAudioSource::isVirtual() const
+{
+    return false;
+}
+
+void IAudioSource::setSpatialParams([[maybe_unused]] const AudioSpatialParams& params)
+{
+}
+
 
 NAU_AUDIO_END
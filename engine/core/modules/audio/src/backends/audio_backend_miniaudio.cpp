@@ -4,6 +4,16 @@
 
 #include "audio_backend_miniaudio.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <optional>
+
+#include "nau/async/multi_task_source.h"
+#include "nau/io/virtual_file_system.h"
+#include "nau/memory/memory_stats.h"
+#include "nau/service/service_provider.h"
+
 #define MINIAUDIO_IMPLEMENTATION
 #include "miniaudio.h"
 
@@ -15,14 +25,267 @@
 
 NAU_AUDIO_BEGIN
 
+// ** VfsMiniaudio
+
+/**
+ * @brief Miniaudio file access over the engine virtual file system.
+ *
+ * The files are read through the file streams, so the sounds can be loaded from the mounted asset packs.
+ * The memory mapped streams (asset packs, stored zip entries) are copied by the decoder directly from the mapped pages.
+ * The paths that are not found in the virtual file system are opened as the native ones.
+ */
+struct VfsMiniaudio
+{
+    ma_vfs_callbacks callbacks; // Must be the first member: miniaudio accesses ma_vfs as ma_vfs_callbacks
+    ma_default_vfs   nativeVfs;
+
+    VfsMiniaudio();
+};
+
+namespace {
+
+struct VfsFileMiniaudio
+{
+    io::IStreamReader::Ptr stream;
+    size_t                 size = 0;
+    ma_vfs_file            nativeFile = nullptr;
+};
+
+VfsMiniaudio& getVfs(ma_vfs* vfs)
+{
+    return *static_cast<VfsMiniaudio*>(vfs);
+}
+
+ma_result vfsOpen(ma_vfs* vfs, const char* path, ma_uint32 openMode, ma_vfs_file* file)
+{
+    if (openMode & MA_OPEN_MODE_WRITE) {
+        return MA_INVALID_OPERATION;
+    }
+
+    auto& fileSystem = getServiceProvider().get<io::IVirtualFileSystem>();
+    const io::FsPath vfsPath{path};
+    if (fileSystem.exists(vfsPath, io::FsEntryKind::File)) {
+        io::IFile::Ptr vfsFile = fileSystem.openFile(vfsPath, io::AccessMode::Read, io::OpenFileMode::OpenExisting);
+        io::IStreamReader::Ptr stream = vfsFile ? vfsFile->createStream(io::AccessMode::Read) : nullptr;
+        if (!stream) {
+            return MA_ERROR;
+        }
+
+        *file = new VfsFileMiniaudio{std::move(stream), vfsFile->getSize()};
+        return MA_SUCCESS;
+    }
+
+    ma_vfs_file nativeFile = nullptr;
+    const ma_result result = ma_vfs_open(&getVfs(vfs).nativeVfs, path, openMode, &nativeFile);
+    if (result != MA_SUCCESS) {
+        return result;
+    }
+
+    *file = new VfsFileMiniaudio{nullptr, 0, nativeFile};
+    return MA_SUCCESS;
+}
+
+ma_result vfsClose(ma_vfs* vfs, ma_vfs_file file)
+{
+    auto* const vfsFile = static_cast<VfsFileMiniaudio*>(file);
+    const ma_result result = vfsFile->nativeFile ? ma_vfs_close(&getVfs(vfs).nativeVfs, vfsFile->nativeFile) : MA_SUCCESS;
+    delete vfsFile;
+    return result;
+}
+
+ma_result vfsRead(ma_vfs* vfs, ma_vfs_file file, void* dst, size_t sizeInBytes, size_t* bytesRead)
+{
+    auto* const vfsFile = static_cast<VfsFileMiniaudio*>(file);
+    if (vfsFile->nativeFile) {
+        return ma_vfs_read(&getVfs(vfs).nativeVfs, vfsFile->nativeFile, dst, sizeInBytes, bytesRead);
+    }
+
+    size_t totalRead = 0;
+    auto* const output = static_cast<std::byte*>(dst);
+    if (auto* const mappedStream = vfsFile->stream->as<io::IMemoryMappedStream*>(); mappedStream) {
+        // The view can be shorter than requested (limited by the mapped pages)
+        while (totalRead < sizeInBytes) {
+            const eastl::span<const std::byte> view = mappedStream->getContiguousView(sizeInBytes - totalRead);
+            if (view.empty()) {
+                break;
+            }
+            memcpy(output + totalRead, view.data(), view.size());
+            totalRead += view.size();
+        }
+    } else {
+        const Result<size_t> readResult = vfsFile->stream->read(output, sizeInBytes);
+        if (readResult.isError()) {
+            NAU_LOG_ERROR("Failed to read audio file: {}", readResult.getError()->getMessage());
+            return MA_IO_ERROR;
+        }
+        totalRead = *readResult;
+    }
+
+    if (bytesRead) {
+        *bytesRead = totalRead;
+    }
+    return totalRead == 0 && sizeInBytes > 0 ? MA_AT_END : MA_SUCCESS;
+}
+
+ma_result vfsSeek(ma_vfs* vfs, ma_vfs_file file, ma_int64 offset, ma_seek_origin origin)
+{
+    auto* const vfsFile = static_cast<VfsFileMiniaudio*>(file);
+    if (vfsFile->nativeFile) {
+        return ma_vfs_seek(&getVfs(vfs).nativeVfs, vfsFile->nativeFile, offset, origin);
+    }
+
+    const io::OffsetOrigin streamOrigin = origin == ma_seek_origin_start ? io::OffsetOrigin::Begin
+                                        : origin == ma_seek_origin_end   ? io::OffsetOrigin::End
+                                                                         : io::OffsetOrigin::Current;
+    vfsFile->stream->setPosition(streamOrigin, offset);
+    return MA_SUCCESS;
+}
+
+ma_result vfsTell(ma_vfs* vfs, ma_vfs_file file, ma_int64* cursor)
+{
+    auto* const vfsFile = static_cast<VfsFileMiniaudio*>(file);
+    if (vfsFile->nativeFile) {
+        return ma_vfs_tell(&getVfs(vfs).nativeVfs, vfsFile->nativeFile, cursor);
+    }
+
+    *cursor = static_cast<ma_int64>(vfsFile->stream->getPosition());
+    return MA_SUCCESS;
+}
+
+ma_result vfsInfo(ma_vfs* vfs, ma_vfs_file file, ma_file_info* info)
+{
+    auto* const vfsFile = static_cast<VfsFileMiniaudio*>(file);
+    if (vfsFile->nativeFile) {
+        return ma_vfs_info(&getVfs(vfs).nativeVfs, vfsFile->nativeFile, info);
+    }
+
+    info->sizeInBytes = vfsFile->size;
+    return MA_SUCCESS;
+}
+
+}  // namespace
+
+VfsMiniaudio::VfsMiniaudio()
+    : callbacks()
+    , nativeVfs()
+{
+    callbacks.onOpen = vfsOpen;
+    callbacks.onClose = vfsClose;
+    callbacks.onRead = vfsRead;
+    callbacks.onSeek = vfsSeek;
+    callbacks.onTell = vfsTell;
+    callbacks.onInfo = vfsInfo;
+
+    ma_default_vfs_init(&nativeVfs, nullptr);
+}
+
+
+// ** LoadNotificationMiniaudio
+
+/**
+ * @brief Completes the asynchronous load of the sound, signaled from the resource manager job thread.
+ */
+struct LoadNotificationMiniaudio
+{
+    ma_async_notification_callbacks callbacks;  // Must be the first member: miniaudio accesses the notification as ma_async_notification_callbacks
+    async::MultiTaskSource<>        completion;
+
+    LoadNotificationMiniaudio();
+};
+
+LoadNotificationMiniaudio::LoadNotificationMiniaudio()
+    : callbacks()
+{
+    callbacks.onSignal = [](ma_async_notification* notification) {
+        static_cast<LoadNotificationMiniaudio*>(notification)->completion.resolve();
+    };
+}
+
+
+// ** VoiceMiniaudio
+
+class SoundMiniaudio;
+class SoundAssetMiniaudio;
+
+/**
+ * @brief Mixed voice of the pool. Its sound is reinitialized only when the voice is taken by another asset.
+ */
+struct VoiceMiniaudio
+{
+    ma_sound                   sound;
+    const SoundAssetMiniaudio* asset = nullptr;
+    SoundMiniaudio*            owner = nullptr;
+    std::atomic<bool>          ended = false;   // Set from the audio thread, dispatched by VoicePoolMiniaudio::update
+};
+
+
+// ** VoicePoolMiniaudio
+
+/**
+ * @brief Distributes the preallocated voices between the playing sounds.
+ *
+ * The sound that does not get a voice (the pool or the category limit is exhausted, or the sound is inaudible) plays virtually:
+ * its position advances with the time, but it is not mixed. The voices are taken by the higher priority and then by the more
+ * audible sounds, the sound that loses its voice continues virtually. The spatialized sound beyond its max distance is inaudible.
+ * All the methods are called from the game thread.
+ */
+class VoicePoolMiniaudio
+{
+public:
+    static constexpr uint32_t MaxVoices = 64;
+
+    VoicePoolMiniaudio();
+
+    void initialize(ma_engine& engine);
+    void deinitialize();
+
+    ma_engine& engine();
+
+    uint32_t findOrAddCategory(const eastl::string& name);
+    void setVoiceLimit(const eastl::string& category, uint32_t maxVoices);
+
+    void setListener(const math::vec3& position, const math::vec3& direction, const math::vec3& up);
+    // Linear attenuation of the spatialized sound by its distance to the listener, zero beyond the max distance
+    float getDistanceGain(const AudioSpatialParams& params) const;
+
+    // Gives the voice to the sound or starts its virtual playback
+    void play(SoundMiniaudio& sound);
+    // Takes the voice of the sound or stops its virtual playback
+    void stop(SoundMiniaudio& sound);
+
+    void update();
+
+private:
+    VoiceMiniaudio* acquireVoice(const SoundMiniaudio& sound);
+    void attachVoice(SoundMiniaudio& sound, VoiceMiniaudio& voice);
+    void detachVoice(SoundMiniaudio& sound);
+
+    void applySpatialParams();
+    static void applySpatialParams(SoundMiniaudio& sound, VoiceMiniaudio& voice);
+
+    ma_engine*                         m_engine = nullptr;
+    std::unique_ptr<VoiceMiniaudio[]>  m_voices;
+    eastl::vector<SoundMiniaudio*>     m_virtualSounds;
+
+    eastl::vector<eastl::string>       m_categoryNames;
+    eastl::vector<uint32_t>            m_categoryLimits;
+    eastl::vector<uint32_t>            m_categoryVoices;
+
+    math::vec3                         m_listenerPosition = math::vec3::zero();
+    math::vec3                         m_listenerDirection = math::vec3(0.f, 0.f, -1.f);
+    math::vec3                         m_listenerUp = math::vec3(0.f, 1.f, 0.f);
+    bool                               m_isListenerDirty = false;
+};
+
+
 // ** SoundMiniaudio
 
-class SoundMiniaudio : public IAudioSource
+class SoundMiniaudio : public IAudioSource, public std::enable_shared_from_this<SoundMiniaudio>
 {
-    friend class SoundAssetMiniaudio;
+    friend class VoicePoolMiniaudio;
 
 public:
-    SoundMiniaudio();
+    SoundMiniaudio(SoundAssetMiniaudio& asset, VoicePoolMiniaudio& pool);
     ~SoundMiniaudio();
 
     // From IAudioSource
@@ -39,55 +302,101 @@ public:
 
     void setEndCallback(SoundCompletionCallback callback) override;
 
+    void setVoiceCategory(const eastl::string& category) override;
+    void setPriority(int priority) override;
+    void setAudibility(float audibility) override;
+    bool isVirtual() const override;
+
+    void setSpatialParams(const AudioSpatialParams& params) override;
+
 private:
     std::chrono::milliseconds framesToMilliseconds(ma_uint64 frames) const;
     ma_uint64 millisecondsToFrames(std::chrono::milliseconds ms) const;
 
+    // Whether the sound takes the voice from the other one
+    bool outranks(const SoundMiniaudio& other) const;
+    float getEffectiveAudibility() const;
+    void onEnded();
+
 private:
-    ma_sound                               m_sound;
+    SoundAssetMiniaudio&                   m_asset;
+    VoicePoolMiniaudio&                    m_pool;
+    VoiceMiniaudio*                        m_voice;
+    uint32_t                               m_category;
+    int                                    m_priority;
+    float                                  m_audibility;
+    bool                                   m_isPlaying;
+    std::chrono::milliseconds              m_position;       // Position when the sound has no voice
+    std::chrono::steady_clock::time_point  m_virtualStart;   // Time the virtual playback is started from m_position
     std::optional<SoundCompletionCallback> m_endCallback;
+    std::optional<AudioSpatialParams>      m_spatialParams;
+    float                                  m_distanceGain;
+    bool                                   m_isSpatialDirty;  // The parameters are not applied to the voice yet
+};
+
+
+// ** SoundAssetMiniaudio
+
+class SoundAssetMiniaudio : public IAudioAsset
+{
+    friend class AudioEngineMiniaudio;
+    friend class SoundMiniaudio;
+    friend class VoicePoolMiniaudio;
+
+public:
+    SoundAssetMiniaudio(const eastl::string& name, VoicePoolMiniaudio& pool);
+
+    AudioSourcePtr instantiate() override;
+    eastl::string name() const override;
+
+private:
+    const eastl::string        m_name;
+    VoicePoolMiniaudio&        m_pool;
+    ma_sound                   m_sound;             // Source of the voice sounds, it is never played
+    LoadNotificationMiniaudio  m_loadNotification;  // Used by the asynchronous load only
 };
 
 
-SoundMiniaudio::SoundMiniaudio()
-    : m_sound()
+// ** SoundMiniaudio implementation
+
+SoundMiniaudio::SoundMiniaudio(SoundAssetMiniaudio& asset, VoicePoolMiniaudio& pool)
+    : m_asset(asset)
+    , m_pool(pool)
+    , m_voice(nullptr)
+    , m_category(0)
+    , m_priority(0)
+    , m_audibility(1.f)
+    , m_isPlaying(false)
+    , m_position(0)
+    , m_distanceGain(1.f)
+    , m_isSpatialDirty(false)
 {
 }
 
 SoundMiniaudio::~SoundMiniaudio()
 {
-    ma_sound_uninit(&m_sound);
+    m_pool.stop(*this);
 }
 
 void SoundMiniaudio::play()
 {
-    ma_result result;
-    if (m_endCallback) {
-        result = ma_sound_set_end_callback(&m_sound, [](void* data, [[maybe_unused]] ma_sound* sound) {
-            const auto& callback = *static_cast<SoundCompletionCallback*>(data);
-            callback();
-        }, &m_endCallback);
-    } else {
-        result = ma_sound_set_end_callback(&m_sound, nullptr, nullptr);
-    }
-
-    if (result != MA_SUCCESS) {
-        NAU_LOG_ERROR("Failed to set audio callback");
+    if (m_isPlaying) {
         return;
     }
 
-    result = ma_sound_start(&m_sound);
-    if (result != MA_SUCCESS) {
-        NAU_LOG_ERROR("Failed to play audio");
-        return;
-    }
+    m_isPlaying = true;
+    m_pool.play(*this);
 }
 
 void SoundMiniaudio::stop()
 {
-    if (const ma_result result = ma_sound_stop(&m_sound); result != MA_SUCCESS) {
-        NAU_LOG_ERROR("Failed to stop audio source. MA error: {}", static_cast<int>(result));
+    if (!m_isPlaying) {
+        return;
     }
+
+    m_position = position();
+    m_isPlaying = false;
+    m_pool.stop(*this);
 }
 
 void SoundMiniaudio::pause()
@@ -97,16 +406,22 @@ void SoundMiniaudio::pause()
 
 void SoundMiniaudio::seek(std::chrono::milliseconds ms)
 {
+    if (!m_voice) {
+        m_position = ms;
+        m_virtualStart = std::chrono::steady_clock::now();
+        return;
+    }
+
     const auto frame = millisecondsToFrames(ms);
-    if (const ma_result result = ma_sound_seek_to_pcm_frame(&m_sound, frame); result != MA_SUCCESS) {
-        NAU_LOG_ERROR("Failed to seek audio source to frame {}. MA error: ", frame, static_cast<int>(result));
+    if (const ma_result result = ma_sound_seek_to_pcm_frame(&m_voice->sound, frame); result != MA_SUCCESS) {
+        NAU_LOG_ERROR("Failed to seek audio source to frame {}. MA error: {}", frame, static_cast<int>(result));
     }
 }
 
 std::chrono::milliseconds SoundMiniaudio::duration() const
 {
     ma_uint64 frames;
-    const ma_result result = ma_sound_get_length_in_pcm_frames(&const_cast<ma_sound&>(m_sound), &frames);
+    const ma_result result = ma_sound_get_length_in_pcm_frames(&m_asset.m_sound, &frames);
     if (result != MA_SUCCESS) {
         NAU_LOG_ERROR("Failed to calculate audio source duration");
         return std::chrono::milliseconds(0);
@@ -117,18 +432,30 @@ std::chrono::milliseconds SoundMiniaudio::duration() const
 
 std::chrono::milliseconds SoundMiniaudio::position() const
 {
-    const ma_uint64 frames = ma_sound_get_time_in_pcm_frames(&m_sound);
-    return framesToMilliseconds(frames);
+    if (m_voice) {
+        const ma_uint64 frames = ma_sound_get_time_in_pcm_frames(&m_voice->sound);
+        return framesToMilliseconds(frames);
+    }
+
+    if (!m_isPlaying) {
+        return m_position;
+    }
+
+    const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - m_virtualStart);
+    return std::min(m_position + elapsed, duration());
 }
 
 bool SoundMiniaudio::isAtEnd() const
 {
-    return ma_sound_at_end(&m_sound);
+    if (m_voice) {
+        return ma_sound_at_end(&m_voice->sound);
+    }
+    return position() >= duration();
 }
 
 bool SoundMiniaudio::isPlaying() const
 {
-    return ma_sound_is_playing(&m_sound);
+    return m_isPlaying;
 }
 
 void SoundMiniaudio::setEndCallback(SoundCompletionCallback callback)
@@ -136,47 +463,381 @@ void SoundMiniaudio::setEndCallback(SoundCompletionCallback callback)
     m_endCallback = !callback ? std::nullopt : std::optional(callback);
 }
 
+void SoundMiniaudio::setVoiceCategory(const eastl::string& category)
+{
+    // The voice counted in the previous category is returned to the pool
+    const bool isPlaying = m_isPlaying;
+    stop();
+    m_category = m_pool.findOrAddCategory(category);
+    if (isPlaying) {
+        play();
+    }
+}
+
+void SoundMiniaudio::setPriority(int priority)
+{
+    m_priority = priority;
+}
+
+void SoundMiniaudio::setAudibility(float audibility)
+{
+    m_audibility = audibility;
+}
+
+bool SoundMiniaudio::isVirtual() const
+{
+    return m_isPlaying && !m_voice;
+}
+
+void SoundMiniaudio::setSpatialParams(const AudioSpatialParams& params)
+{
+    // Only stored: the voices are updated by the pool in one pass
+    m_spatialParams = params;
+    m_distanceGain = m_pool.getDistanceGain(params);
+    m_isSpatialDirty = true;
+}
+
 std::chrono::milliseconds SoundMiniaudio::framesToMilliseconds(ma_uint64 frames) const
 {
-    return std::chrono::milliseconds(frames * 1000 / ma_engine_get_sample_rate(ma_sound_get_engine(&m_sound)));
+    return std::chrono::milliseconds(frames * 1000 / ma_engine_get_sample_rate(&m_pool.engine()));
 }
 
 ma_uint64 SoundMiniaudio::millisecondsToFrames(std::chrono::milliseconds ms) const
 {
-    return (ms.count() * ma_engine_get_sample_rate(ma_sound_get_engine(&m_sound))) / 1000;
+    return (ms.count() * ma_engine_get_sample_rate(&m_pool.engine())) / 1000;
 }
 
+bool SoundMiniaudio::outranks(const SoundMiniaudio& other) const
+{
+    if (m_priority != other.m_priority) {
+        return m_priority > other.m_priority;
+    }
+    return getEffectiveAudibility() > other.getEffectiveAudibility();
+}
 
-// ** SoundAssetMiniaudio
+float SoundMiniaudio::getEffectiveAudibility() const
+{
+    return m_audibility * m_distanceGain;
+}
 
-class SoundAssetMiniaudio : public IAudioAsset
+void SoundMiniaudio::onEnded()
 {
-    friend class AudioEngineMiniaudio;
+    m_position = duration();
+    m_isPlaying = false;
+    m_pool.stop(*this);
 
-public:
-    SoundAssetMiniaudio(const eastl::string& name, ma_engine& engine);
+    if (m_endCallback) {
+        (*m_endCallback)();
+    }
+}
 
-    AudioSourcePtr instantiate() override;
-    eastl::string name() const override;
 
-private:
-    const eastl::string  m_name;
-    ma_engine&           m_engine;
-    ma_sound             m_sound;
-};
+// ** VoicePoolMiniaudio implementation
+
+VoicePoolMiniaudio::VoicePoolMiniaudio()
+    : m_categoryNames{eastl::string{}}
+    , m_categoryLimits{MaxVoices}
+    , m_categoryVoices{0}
+{
+}
+
+void VoicePoolMiniaudio::initialize(ma_engine& engine)
+{
+    m_engine = &engine;
+    m_voices = std::make_unique<VoiceMiniaudio[]>(MaxVoices);
+}
+
+void VoicePoolMiniaudio::deinitialize()
+{
+    for (uint32_t i = 0; i < MaxVoices; ++i) {
+        VoiceMiniaudio& voice = m_voices[i];
+        if (voice.owner) {
+            detachVoice(*voice.owner);
+        }
+        if (voice.asset) {
+            ma_sound_uninit(&voice.sound);
+            voice.asset = nullptr;
+        }
+    }
+    m_virtualSounds.clear();
+}
+
+ma_engine& VoicePoolMiniaudio::engine()
+{
+    return *m_engine;
+}
+
+uint32_t VoicePoolMiniaudio::findOrAddCategory(const eastl::string& name)
+{
+    if (const auto it = std::find(m_categoryNames.begin(), m_categoryNames.end(), name); it != m_categoryNames.end()) {
+        return static_cast<uint32_t>(it - m_categoryNames.begin());
+    }
+
+    m_categoryNames.push_back(name);
+    m_categoryLimits.push_back(MaxVoices);
+    m_categoryVoices.push_back(0);
+    return static_cast<uint32_t>(m_categoryNames.size() - 1);
+}
+
+void VoicePoolMiniaudio::setVoiceLimit(const eastl::string& category, uint32_t maxVoices)
+{
+    // The voices above the new limit are redistributed by the next update
+    m_categoryLimits[findOrAddCategory(category)] = std::min(maxVoices, MaxVoices);
+}
+
+void VoicePoolMiniaudio::setListener(const math::vec3& position, const math::vec3& direction, const math::vec3& up)
+{
+    m_listenerPosition = position;
+    m_listenerDirection = direction;
+    m_listenerUp = up;
+    m_isListenerDirty = true;
+}
+
+float VoicePoolMiniaudio::getDistanceGain(const AudioSpatialParams& params) const
+{
+    if (params.maxDistance <= 0.f) {
+        return 0.f;
+    }
+
+    const float distance = math::length(params.position - m_listenerPosition);
+    return distance < params.maxDistance ? 1.f - distance / params.maxDistance : 0.f;
+}
+
+void VoicePoolMiniaudio::play(SoundMiniaudio& sound)
+{
+    if (VoiceMiniaudio* voice = acquireVoice(sound)) {
+        attachVoice(sound, *voice);
+    } else {
+        sound.m_virtualStart = std::chrono::steady_clock::now();
+        m_virtualSounds.push_back(&sound);
+    }
+}
+
+void VoicePoolMiniaudio::stop(SoundMiniaudio& sound)
+{
+    if (sound.m_voice) {
+        detachVoice(sound);
+    }
+
+    if (const auto it = std::find(m_virtualSounds.begin(), m_virtualSounds.end(), &sound); it != m_virtualSounds.end()) {
+        m_virtualSounds.erase(it);
+    }
+}
+
+void VoicePoolMiniaudio::update()
+{
+    if (!m_voices) {
+        return;
+    }
+
+    applySpatialParams();
+
+    // The end callbacks can play and stop (or release) the other sounds: the ended sounds are collected first
+    eastl::vector<std::shared_ptr<SoundMiniaudio>> endedSounds;
+    for (uint32_t i = 0; i < MaxVoices; ++i) {
+        VoiceMiniaudio& voice = m_voices[i];
+        if (voice.ended.exchange(false) && voice.owner) {
+            endedSounds.push_back(voice.owner->shared_from_this());
+        }
+    }
+    for (SoundMiniaudio* const sound : m_virtualSounds) {
+        if (sound->isAtEnd()) {
+            endedSounds.push_back(sound->shared_from_this());
+        }
+    }
+    for (const auto& sound : endedSounds) {
+        if (sound->m_isPlaying) {
+            sound->onEnded();
+        }
+    }
+
+    // The inaudible sounds and the sounds above the category limits continue virtually
+    for (uint32_t i = 0; i < MaxVoices; ++i) {
+        VoiceMiniaudio& voice = m_voices[i];
+        if (voice.owner && (voice.owner->getEffectiveAudibility() <= 0.f || m_categoryVoices[voice.owner->m_category] > m_categoryLimits[voice.owner->m_category])) {
+            SoundMiniaudio& sound = *voice.owner;
+            detachVoice(sound);
+            sound.m_virtualStart = std::chrono::steady_clock::now();
+            m_virtualSounds.push_back(&sound);
+        }
+    }
+
+    // The virtual sounds get the free voices or take them from the less important sounds
+    if (m_virtualSounds.empty()) {
+        return;
+    }
+
+    eastl::vector<SoundMiniaudio*> candidates = m_virtualSounds;
+    std::sort(candidates.begin(), candidates.end(), [](const SoundMiniaudio* left, const SoundMiniaudio* right) {
+        return left->outranks(*right);
+    });
+    for (SoundMiniaudio* const sound : candidates) {
+        if (VoiceMiniaudio* voice = acquireVoice(*sound)) {
+            // The virtual position is taken before the sound leaves the virtual list
+            sound->m_position = sound->position();
+            m_virtualSounds.erase(std::find(m_virtualSounds.begin(), m_virtualSounds.end(), sound));
+            attachVoice(*sound, *voice);
+        }
+    }
+}
+
+VoiceMiniaudio* VoicePoolMiniaudio::acquireVoice(const SoundMiniaudio& sound)
+{
+    if (!m_voices || sound.getEffectiveAudibility() <= 0.f) {
+        return nullptr;
+    }
+
+    // When the category is exhausted, only the voice of the same category can be taken
+    const bool isCategoryFull = m_categoryVoices[sound.m_category] >= m_categoryLimits[sound.m_category];
+
+    VoiceMiniaudio* freeVoice = nullptr;
+    VoiceMiniaudio* weakestVoice = nullptr;
+    for (uint32_t i = 0; i < MaxVoices; ++i) {
+        VoiceMiniaudio& voice = m_voices[i];
+        if (!voice.owner) {
+            // The free voice of the same asset does not need the sound reinitialization
+            if (!freeVoice || (voice.asset == &sound.m_asset && freeVoice->asset != &sound.m_asset)) {
+                freeVoice = &voice;
+            }
+            continue;
+        }
+
+        if (isCategoryFull && voice.owner->m_category != sound.m_category) {
+            continue;
+        }
+        if (!weakestVoice || weakestVoice->owner->outranks(*voice.owner)) {
+            weakestVoice = &voice;
+        }
+    }
+
+    if (freeVoice && !isCategoryFull) {
+        return freeVoice;
+    }
+
+    if (weakestVoice && sound.outranks(*weakestVoice->owner)) {
+        SoundMiniaudio& stolenSound = *weakestVoice->owner;
+        detachVoice(stolenSound);
+        stolenSound.m_virtualStart = std::chrono::steady_clock::now();
+        m_virtualSounds.push_back(&stolenSound);
+        return weakestVoice;
+    }
+
+    return nullptr;
+}
+
+void VoicePoolMiniaudio::attachVoice(SoundMiniaudio& sound, VoiceMiniaudio& voice)
+{
+    if (voice.asset != &sound.m_asset) {
+        if (voice.asset) {
+            ma_sound_uninit(&voice.sound);
+            voice.asset = nullptr;
+        }
+
+        if (const ma_result result = ma_sound_init_copy(m_engine, &sound.m_asset.m_sound, 0, nullptr, &voice.sound); result != MA_SUCCESS) {
+            NAU_LOG_ERROR("Failed to initialize audio voice. MA error: {}", static_cast<int>(result));
+            sound.m_virtualStart = std::chrono::steady_clock::now();
+            m_virtualSounds.push_back(&sound);
+            return;
+        }
+
+        voice.asset = &sound.m_asset;
+        ma_sound_set_end_callback(&voice.sound, [](void* data, [[maybe_unused]] ma_sound* sound) {
+            static_cast<VoiceMiniaudio*>(data)->ended = true;
+        }, &voice);
+    }
 
-SoundAssetMiniaudio::SoundAssetMiniaudio(const eastl::string& name, ma_engine& engine)
+    voice.owner = &sound;
+    voice.ended = false;
+    sound.m_voice = &voice;
+    ++m_categoryVoices[sound.m_category];
+
+    // The voice can keep the settings of the previous sound of the same asset
+    ma_sound_set_spatialization_enabled(&voice.sound, sound.m_spatialParams ? MA_TRUE : MA_FALSE);
+    if (sound.m_spatialParams) {
+        ma_sound_set_attenuation_model(&voice.sound, ma_attenuation_model_linear);
+        ma_sound_set_min_distance(&voice.sound, 0.f);
+        applySpatialParams(sound, voice);
+    }
+
+    sound.seek(sound.m_position);
+    if (const ma_result result = ma_sound_start(&voice.sound); result != MA_SUCCESS) {
+        NAU_LOG_ERROR("Failed to play audio. MA error: {}", static_cast<int>(result));
+    }
+}
+
+void VoicePoolMiniaudio::applySpatialParams()
+{
+    if (m_isListenerDirty) {
+        ma_engine_listener_set_position(m_engine, 0, m_listenerPosition.getX(), m_listenerPosition.getY(), m_listenerPosition.getZ());
+        ma_engine_listener_set_direction(m_engine, 0, m_listenerDirection.getX(), m_listenerDirection.getY(), m_listenerDirection.getZ());
+        ma_engine_listener_set_world_up(m_engine, 0, m_listenerUp.getX(), m_listenerUp.getY(), m_listenerUp.getZ());
+    }
+
+    // Only the playing sounds are visited: the stopped ones get their distance gain when the parameters are set
+    for (SoundMiniaudio* const sound : m_virtualSounds) {
+        if (m_isListenerDirty && sound->m_spatialParams) {
+            sound->m_distanceGain = getDistanceGain(*sound->m_spatialParams);
+        }
+    }
+
+    for (uint32_t i = 0; i < MaxVoices; ++i) {
+        VoiceMiniaudio& voice = m_voices[i];
+        SoundMiniaudio* const sound = voice.owner;
+        if (!sound || !sound->m_spatialParams) {
+            continue;
+        }
+
+        if (m_isListenerDirty) {
+            sound->m_distanceGain = getDistanceGain(*sound->m_spatialParams);
+        }
+        if (sound->m_isSpatialDirty) {
+            applySpatialParams(*sound, voice);
+        }
+    }
+
+    m_isListenerDirty = false;
+}
+
+void VoicePoolMiniaudio::applySpatialParams(SoundMiniaudio& sound, VoiceMiniaudio& voice)
+{
+    const AudioSpatialParams& params = *sound.m_spatialParams;
+    ma_sound_set_position(&voice.sound, params.position.getX(), params.position.getY(), params.position.getZ());
+    ma_sound_set_direction(&voice.sound, params.direction.getX(), params.direction.getY(), params.direction.getZ());
+    ma_sound_set_max_distance(&voice.sound, params.maxDistance);
+    sound.m_isSpatialDirty = false;
+}
+
+void VoicePoolMiniaudio::detachVoice(SoundMiniaudio& sound)
+{
+    VoiceMiniaudio& voice = *sound.m_voice;
+    if (sound.m_isPlaying) {
+        sound.m_position = sound.position();
+    }
+
+    if (const ma_result result = ma_sound_stop(&voice.sound); result != MA_SUCCESS) {
+        NAU_LOG_ERROR("Failed to stop audio source. MA error: {}", static_cast<int>(result));
+    }
+
+    voice.owner = nullptr;
+    voice.ended = false;
+    sound.m_voice = nullptr;
+    --m_categoryVoices[sound.m_category];
+}
+
+
+// ** SoundAssetMiniaudio implementation
+
+SoundAssetMiniaudio::SoundAssetMiniaudio(const eastl::string& name, VoicePoolMiniaudio& pool)
     : m_name(name)
-    , m_engine(engine)
+    , m_pool(pool)
     , m_sound()
 {
 }
 
 AudioSourcePtr SoundAssetMiniaudio::instantiate()
 {
-    auto sound = std::make_shared<SoundMiniaudio>();
-    ma_sound_init_copy(&m_engine, &m_sound, 0, nullptr, &sound->m_sound);
-    return sound;
+    // The sound gets the voice from the pool when it is played
+    return std::make_shared<SoundMiniaudio>(*this, m_pool);
 }
 
 eastl::string SoundAssetMiniaudio::name() const
@@ -196,37 +857,83 @@ public:
     void deinitialize();
 
     AudioAssetPtr loadSound(const eastl::string& path, bool stream);
+    async::Task<AudioAssetPtr> loadSoundAsync(eastl::string path, AudioLoadMode mode);
 
     inline AudioAssetList audioAssets() { return assets; }
 
+private:
+    AudioAssetPtr findAsset(const eastl::string& path) const;
+    std::shared_ptr<SoundAssetMiniaudio> findPendingAsset(const eastl::string& path) const;
+
+    async::Task<AudioAssetPtr> awaitLoad(std::shared_ptr<SoundAssetMiniaudio> asset);
+    // Registers the asset whose data is ready, returns false if the load has failed
+    bool completeLoad(const std::shared_ptr<SoundAssetMiniaudio>& asset);
+
 public:
-    ma_engine       engine;
-    AudioAssetList  assets;
+    VfsMiniaudio        vfs;
+    ma_engine           engine;
+    VoicePoolMiniaudio  voices;
+    AudioAssetList      assets;
+    eastl::vector<std::shared_ptr<SoundAssetMiniaudio>> pendingAssets;  // Being loaded asynchronously
 };
 
 void AudioEngineMiniaudio::Impl::initialize()
 {
-    const ma_result result = ma_engine_init(nullptr, &engine);
+    ma_engine_config config = ma_engine_config_init();
+    config.pResourceManagerVfs = &vfs;
+
+    const ma_result result = ma_engine_init(&config, &engine);
     if (result != MA_SUCCESS) {
         NAU_LOG_CRITICAL("Failed to initialize audio engine! MA error: {}", static_cast<int>(result));
         return;
     }
 
+    voices.initialize(engine);
     NAU_LOG_DEBUG("Audio engine successfully initialized");
 }
 
 void AudioEngineMiniaudio::Impl::deinitialize()
 {
+    // The voice sounds refer to the engine
+    voices.deinitialize();
     ma_engine_uninit(&engine);
     NAU_LOG_DEBUG("Audio engine successfully deinitialized");
 }
 
+AudioAssetPtr AudioEngineMiniaudio::Impl::findAsset(const eastl::string& path) const
+{
+    const auto itAsset = std::find_if(assets.begin(), assets.end(), [&path](const AudioAssetPtr& asset) {
+        return asset->name() == path;
+    });
+    return itAsset != assets.end() ? *itAsset : nullptr;
+}
+
+std::shared_ptr<SoundAssetMiniaudio> AudioEngineMiniaudio::Impl::findPendingAsset(const eastl::string& path) const
+{
+    const auto itAsset = std::find_if(pendingAssets.begin(), pendingAssets.end(), [&path](const std::shared_ptr<SoundAssetMiniaudio>& asset) {
+        return asset->name() == path;
+    });
+    return itAsset != pendingAssets.end() ? *itAsset : nullptr;
+}
+
 AudioAssetPtr AudioEngineMiniaudio::Impl::loadSound(const eastl::string& path, bool stream)
 {
-    auto asset = std::make_shared<SoundAssetMiniaudio>(path, engine);
-    const int flags = stream ? MA_SOUND_FLAG_STREAM : 0;
+    // The asset of the same file is shared: its instances refer to the same resource manager data
+    if (AudioAssetPtr asset = findAsset(path)) {
+        return asset;
+    }
+
+    // The asset being loaded asynchronously is returned as is: its sources are silent until the data is ready
+    if (AudioAssetPtr asset = findPendingAsset(path)) {
+        return asset;
+    }
+
+    // The short sounds are decoded once and kept in memory, the instances (ma_sound_init_copy) play the cached PCM data
+    auto asset = std::make_shared<SoundAssetMiniaudio>(path, voices);
+    const int flags = stream ? MA_SOUND_FLAG_STREAM : MA_SOUND_FLAG_DECODE;
     const ma_result result = ma_sound_init_from_file(&engine, path.c_str(), flags, NULL, NULL, &asset->m_sound);
     if (result != MA_SUCCESS) {
+        NAU_LOG_ERROR("Failed to load sound at {}. MA error: {}", path, static_cast<int>(result));
         return nullptr;
     }
 
@@ -236,6 +943,78 @@ AudioAssetPtr AudioEngineMiniaudio::Impl::loadSound(const eastl::string& path, b
     return asset;
 }
 
+async::Task<AudioAssetPtr> AudioEngineMiniaudio::Impl::loadSoundAsync(eastl::string path, AudioLoadMode mode)
+{
+    if (AudioAssetPtr asset = findAsset(path)) {
+        co_return asset;
+    }
+
+    if (auto asset = findPendingAsset(path)) {
+        co_return co_await awaitLoad(std::move(asset));
+    }
+
+    ma_uint32 flags = MA_SOUND_FLAG_ASYNC;
+    if (mode == AudioLoadMode::Decode) {
+        flags |= MA_SOUND_FLAG_DECODE;
+    } else if (mode == AudioLoadMode::Stream) {
+        flags |= MA_SOUND_FLAG_STREAM;
+    }
+    // Without the decode and the stream flags the resource manager keeps the encoded file data
+
+    auto asset = std::make_shared<SoundAssetMiniaudio>(path, voices);
+
+    ma_sound_config config = ma_sound_config_init_2(&engine);
+    config.pFilePath = asset->m_name.c_str();
+    config.flags = flags;
+    // The stream is ready once its first pages are decoded, it never signals the done notification
+    ma_resource_manager_pipeline_stage_notification& readyStage = mode == AudioLoadMode::Stream ? config.initNotifications.init : config.initNotifications.done;
+    readyStage.pNotification = &asset->m_loadNotification;
+
+    // Only the job is posted here: the file is read and decoded by the resource manager job thread
+    const ma_result result = ma_sound_init_ex(&engine, &config, &asset->m_sound);
+    if (result != MA_SUCCESS) {
+        NAU_LOG_ERROR("Failed to load sound at {}. MA error: {}", path, static_cast<int>(result));
+        co_return nullptr;
+    }
+
+    pendingAssets.emplace_back(asset);
+    co_return co_await awaitLoad(std::move(asset));
+}
+
+async::Task<AudioAssetPtr> AudioEngineMiniaudio::Impl::awaitLoad(std::shared_ptr<SoundAssetMiniaudio> asset)
+{
+    // The continuation returns to the executor of the caller, so the asset lists are accessed from the caller thread only
+    co_await asset->m_loadNotification.completion.getNextTask();
+
+    if (!completeLoad(asset)) {
+        co_return nullptr;
+    }
+    co_return asset;
+}
+
+bool AudioEngineMiniaudio::Impl::completeLoad(const std::shared_ptr<SoundAssetMiniaudio>& asset)
+{
+    const auto itPending = std::find(pendingAssets.begin(), pendingAssets.end(), asset);
+    if (itPending == pendingAssets.end()) {
+        // Completed by the other request of the same file
+        return std::find(assets.begin(), assets.end(), asset) != assets.end();
+    }
+    pendingAssets.erase(itPending);
+
+    // The busy buffer is still being decoded by the job thread (the sound is played from the decoded part)
+    const ma_result result = ma_resource_manager_data_source_result(asset->m_sound.pResourceManagerDataSource);
+    if (result != MA_SUCCESS && result != MA_BUSY) {
+        NAU_LOG_ERROR("Failed to load sound at {}. MA error: {}", asset->m_name, static_cast<int>(result));
+        ma_sound_uninit(&asset->m_sound);
+        return false;
+    }
+
+    NAU_LOG_INFO("Sound at {} loaded successfully", asset->m_name);
+
+    assets.emplace_back(asset);
+    return true;
+}
+
 
 // ** AudioEngineMiniaudio
 
@@ -258,18 +1037,39 @@ void AudioEngineMiniaudio::deinitialize()
 
 void AudioEngineMiniaudio::update()
 {
+    NAU_MEMORY_SCOPE(Audio);
+    m_pimpl->voices.update();
 }
 
 AudioAssetPtr AudioEngineMiniaudio::loadSound(const eastl::string& path)
 {
+    NAU_MEMORY_SCOPE(Audio);
     return m_pimpl->loadSound(path, false);
 }
 
 AudioAssetPtr AudioEngineMiniaudio::loadStream(const eastl::string& path)
 {
+    NAU_MEMORY_SCOPE(Audio);
     return m_pimpl->loadSound(path, true);
 }
 
+async::Task<AudioAssetPtr> AudioEngineMiniaudio::loadSoundAsync(const eastl::string& path, AudioLoadMode mode)
+{
+    // Covers the synchronous part of the load (up to the first suspension): the tag is thread local.
+    NAU_MEMORY_SCOPE(Audio);
+    return m_pimpl->loadSoundAsync(path, mode);
+}
+
+void AudioEngineMiniaudio::setVoiceLimit(const eastl::string& category, uint32_t maxVoices)
+{
+    m_pimpl->voices.setVoiceLimit(category, maxVoices);
+}
+
+void AudioEngineMiniaudio::setListener(const math::vec3& position, const math::vec3& direction, const math::vec3& up)
+{
+    m_pimpl->voices.setListener(position, direction, up);
+}
+
 AudioAssetList AudioEngineMiniaudio::audioAssets()
 {
     return m_pimpl->audioAssets();
@@ -24,6 +24,10 @@ public:
 
 	AudioAssetPtr loadSound(const eastl::string& path) override;
 	AudioAssetPtr loadStream(const eastl::string& path) override;
+	async::Task<AudioAssetPtr> loadSoundAsync(const eastl::string& path, AudioLoadMode mode) override;
+
+	void setVoiceLimit(const eastl::string& category, uint32_t maxVoices) override;
+	void setListener(const math::vec3& position, const math::vec3& direction, const math::vec3& up) override;
 	
 	AudioAssetList audioAssets() override;
 
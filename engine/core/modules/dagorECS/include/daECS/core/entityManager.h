@@ -330,6 +330,12 @@ public:
   const component_index_t *queryComponents(QueryId) const; // invalid index means unresolved
 
   void setMaxUpdateJobs(uint32_t max_num_jobs); // TODO Uncomment or delete
+
+  // Parallel update mode: the consecutive ES of the update stage that don't write components the others read or write (and are not
+  // ordered to each other with before/after) run concurrently on the engine thread pool, in constrained MT mode.
+  // ES without components and dynamic ES always run alone. Off by default.
+  void setParallelEsUpdate(bool on);
+  bool isParallelEsUpdate() const { return parallelEsUpdate; }
   //uint32_t getMaxWorkerId() const; // this is inclusive! i.e. it can return setMaxUpdateJobs()/MAX_POSSIBLE_WORKERS_COUNT + 1!
   void setQueryUpdateQuant(const char *es, uint16_t min_quant);
 
@@ -902,6 +908,9 @@ public:
   };
   typedef EsIndexFixedSet es_index_set;
   eastl::vector<es_index_set> esUpdates;  // sorted by update priority ES functions (for each update stage)
+  eastl::vector<eastl::vector<es_index_type>> esUpdateWaves; // parallel to esUpdates, sizes of the consecutive ES ranges run concurrently
+  bool esUpdateWavesValid = false, parallelEsUpdate = false;
+  void buildEsUpdateWaves();
 
   // probably use ska::flat_hash_map<event_type_t, event_index_t> esEventsMap; eastl::vector<eastl::vector_set<es_index_type>>
   // esEventsList; check performance
@@ -202,6 +202,7 @@ void EntityManager::registerEsStage(int j)
   for (uint32_t iu = 0, maskLeft = es->stageMask & ((1 << esUpdates.size()) - 1); maskLeft; ++iu, maskLeft >>= 1)
     if (maskLeft & 1)
       esUpdates[iu].insert(es_index_type(j));
+  esUpdateWavesValid = false;
 }
 
 void EntityManager::registerEsEvent(int j)
@@ -5,8 +5,7 @@
 #include <daECS/core/entityManager.h>
 #include <daECS/core/componentTypes.h>
 #include <daECS/core/ecsQuery.h>
-#include <nau/async/thread_pool_executor.h>
-#include "nau/async/task.h"
+#include "nau/async/parallel_for.h"
 #include "nau/string/string.h"
 #include <daECS/core/internal/trackComponentAccess.h>
 #include "ecsPerformQueryInline.h"
@@ -119,11 +118,9 @@ public:
 
 static constexpr int num_jobs_to_wake_up_all = 2; // it is faster to wake up 2 thread workers one-by-one, than wake up all
 
-static __forceinline void parallel_for(int num_jobs, EntityManager &mgr, const query_cb_t &fun, const Query &pQuery, void *user_data, int min_quant /*, threadpool::JobPriority tpprio */)
+static __forceinline void parallel_for(int num_jobs, EntityManager &mgr, const query_cb_t &fun, const Query &pQuery, void *user_data, int min_quant)
 {
   // NAU_CORE_DEBUG_LF("start working on {:p}[{}] == {}({})", &pQuery, chunk, cnt);
-  alignas(ESJob) char jobStorage[MAX_ES_JOBS * sizeof(ESJob)];
-  ESJob *jobs = (ESJob *)jobStorage;
   JobInfo info(mgr, pQuery, fun, user_data, min_quant);
   TIME_PROFILE(ecs_parallel_for_query);
   const uint32_t chunksCount = pQuery.chunksCount();
@@ -134,66 +131,24 @@ static __forceinline void parallel_for(int num_jobs, EntityManager &mgr, const q
     info.starts[ci] = querySize;
     querySize += ESJob::getChunkSize(pQuery, ci);
   }
-  info.starts[chunksCount] = info.totalSize = querySize; // we have to copy querySize to info.totalSize. &query will die before thread
-                                                         // exits
+  info.starts[chunksCount] = info.totalSize = querySize;
 
   num_jobs = std::min(num_jobs, (int)MAX_ES_JOBS);
   // NAU_CORE_DEBUG_LF("num_jobs = {}", num_jobs);
-  uint32_t queue_pos = 0;
 
-  auto jobFactory = [&](ESJob* j) -> nau::async::Task<>
-  {
-      co_await nau::async::Executor::getDefault();
-      j->doJob();
-  };
-
-  eastl::vector<nau::async::Task<>> tasks;
-
- // auto wakeOnAdd = num_jobs <= num_jobs_to_wake_up_all ? threadpool::AddFlags::WakeOnAdd : threadpool::AddFlags::None;
-  {
-    // TIME_PROFILE(add);
-    for (int i = 0; i < num_jobs; ++i)
-    {
-      ESJob *j = new (jobs + i/*, _NEW_INPLACE*/) ESJob(&info, i + 1);
-      tasks.push_back(jobFactory(j));
-      //threadpool::add(j, tpprio, queue_pos, wakeOnAdd | threadpool::AddFlags::IgnoreNotDone); // job->done == 1 for sure
-    }
-  }
-  //if (wakeOnAdd == threadpool::AddFlags::None)
-  //{
-  //  // TIME_PROFILE(wake);
-  //  threadpool::wake_up_all();
-  //}
-  // NAU_CORE_DEBUG_LF("jobs added start is {} ({})",
-  //   info.work_started.load(std::memory_order_acquire), cnt);
-  {
-    // TIME_PROFILE(active_wait);
-    ESJob::perform_fun(&info, info.starts.data(), 0);
-  }
-  // todo: we can use just active wait, instead of barrier active wait, if we are running from non main thread
-  // it reflects the following assumption, when we run from main thread our primary goal is to reduce latency, if we run from other
-  // threads - our goal is to increase occupancy
-  //threadpool::barrier_active_wait_for_job(&jobs[num_jobs - 1], tpprio, queue_pos); // make sure we have captured all jobs
-  // NAU_CORE_DEBUG_LF("all work scheduled {} done = ({})",
-  //   info.work_started.load(std::memory_order_acquire), cnt);
-  TIME_PROFILE_WAIT_DEV("ecs_pfor_wait");
-
- // for (int i = 0; i < num_jobs; ++i) // ensure all other jobs are also finished
- //   threadpool::wait(&jobs[i]);
-  auto awaiter = [&tasks]() -> nau::async::Task<>
-  {
-      co_await nau::async::Executor::getDefault();
-      co_await nau::async::whenAll(tasks, nau::Expiration::never());
-  }();
-
-  nau::async::wait(awaiter);
+  // the calling thread takes part in the work (worker id 0), parallelFor returns when all the jobs are finished.
+  // each job claims the work by min_quant portions, so the jobs that started late just find no work left
+  nau::async::parallelFor(num_jobs + 1, 1, [&info](size_t workerId) {
+    ESJob::perform_fun(&info, info.starts.data(), uint32_t(workerId));
+  });
 }
 
 void EntityManager::setMaxUpdateJobs(uint32_t num_jobs) { maxNumJobsSet = std::min(num_jobs, (uint32_t)MAX_ES_JOBS); }
 
 void EntityManager::updateCurrentUpdateMaxJobs()
 {
-    maxNumJobs = std::min((uint32_t)std::max(int(/*threadpool::get_num_workers()) TODO Uncomment or delete */ 100), int(0)), maxNumJobsSet);
+    const nau::async::Executor::Ptr executor = nau::async::Executor::getDefault();
+    maxNumJobs = std::min(executor ? (uint32_t)executor->getConcurrency() : 0u, maxNumJobsSet);
 }
 
 bool EntityManager::performMTQuery(const Query &pQuery, const query_cb_t &fun, void *user_data, int min_quant)
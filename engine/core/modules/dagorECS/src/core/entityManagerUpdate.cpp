@@ -6,6 +6,7 @@
 #include <daECS/core/entitySystem.h>
 #include "entityManagerEvent.h"
 #include "ecsPerformQueryInline.h"
+#include "nau/async/parallel_for.h"
 
 
 #if defined(__cplusplus) && !defined(__GNUC__)
@@ -42,6 +43,78 @@ void init_profiler_tokens()
 #endif
 }
 
+static bool components_intersect(nau::ConstSpan<ComponentDesc> a, nau::ConstSpan<ComponentDesc> b)
+{
+  for (const ComponentDesc &ac : a)
+    for (const ComponentDesc &bc : b)
+      if (ac.name == bc.name)
+        return true;
+  return false;
+}
+
+static bool csv_has_name(const char *csv, const char *name)
+{
+  if (!csv || !name)
+    return false;
+  const size_t nameLen = strlen(name);
+  for (const char *p = csv; *p;)
+  {
+    while (*p == ',' || *p == ' ')
+      ++p;
+    const char *e = p;
+    while (*e && *e != ',' && *e != ' ')
+      ++e;
+    if (size_t(e - p) == nameLen && strncmp(p, name, nameLen) == 0)
+      return true;
+    p = e;
+  }
+  return false;
+}
+
+// ES without components can access anything, dynamic (scripted) ES share their runtime
+static bool can_update_concurrently(const EntitySystemDesc &es) { return !es.isEmpty() && !es.isDynamic(); }
+
+static bool can_update_concurrently(const EntitySystemDesc &a, const EntitySystemDesc &b)
+{
+  return !components_intersect(a.componentsRW, b.componentsRW) && !components_intersect(a.componentsRW, b.componentsRO) &&
+         !components_intersect(a.componentsRO, b.componentsRW) && !csv_has_name(a.getBefore(), b.name) &&
+         !csv_has_name(a.getAfter(), b.name) && !csv_has_name(b.getBefore(), a.name) && !csv_has_name(b.getAfter(), a.name);
+}
+
+void EntityManager::setParallelEsUpdate(bool on)
+{
+  NAU_ASSERT_RETURN(!isConstrainedMTMode(), );
+  parallelEsUpdate = on;
+}
+
+void EntityManager::buildEsUpdateWaves()
+{
+  // the ES order is kept: the ES joins the current wave only if it can run concurrently with all of the wave ES,
+  // otherwise the next wave is started
+  esUpdateWaves.resize(esUpdates.size());
+  for (uint32_t stage = 0; stage < esUpdates.size(); ++stage)
+  {
+    eastl::vector<es_index_type> &waves = esUpdateWaves[stage];
+    waves.clear();
+    const es_index_type *waveBegin = esUpdates[stage].begin();
+    for (const es_index_type *esi = waveBegin, *esEnd = esUpdates[stage].end(); esi != esEnd; ++esi)
+    {
+      const EntitySystemDesc &es = *esList[*esi];
+      bool joinWave = esi != waveBegin && can_update_concurrently(es) && can_update_concurrently(*esList[*waveBegin]);
+      for (const es_index_type *wi = waveBegin; joinWave && wi != esi; ++wi)
+        joinWave = can_update_concurrently(*esList[*wi], es);
+      if (!joinWave && esi != waveBegin)
+      {
+        waves.push_back(es_index_type(esi - waveBegin));
+        waveBegin = esi;
+      }
+    }
+    if (waveBegin != esUpdates[stage].end())
+      waves.push_back(es_index_type(esUpdates[stage].end() - waveBegin));
+  }
+  esUpdateWavesValid = true;
+}
+
 void EntityManager::update(const ecs::UpdateStageInfo &info)
 {
   NAU_ASSERT(lastEsGen == EntitySystemDesc::generation, "setEsOrder was not called");
@@ -55,20 +128,47 @@ void EntityManager::update(const ecs::UpdateStageInfo &info)
   DA_PROFILE_EVENT_DESC(dap_stage_tokens[eastl::min(info.stage, (int)US_COUNT)]);
 #endif
   createQueuedEntities(); // if entities were scheduled for creation outside ES
-  for (auto esIndex : esUpdates[info.stage])
-  {
+  const auto updateEs = [this, &info](es_index_type esIndex) {
     const EntitySystemDesc &es = *esList[esIndex];
-    {
 #if TIME_PROFILER_ENABLED && DAGOR_DBGLEVEL > 0
-      DA_PROFILE_EVENT_DESC(es.dapToken);
+    DA_PROFILE_EVENT_DESC(es.dapToken);
 #endif
-      performQueryEmptyAllowed(esListQueries[esIndex], (ESFuncType)es.ops.onUpdate, (const ESPayLoad &)info, es.userData, es.quant);
-    }
+    performQueryEmptyAllowed(esListQueries[esIndex], (ESFuncType)es.ops.onUpdate, (const ESPayLoad &)info, es.userData, es.quant);
+  };
+  const auto sendEvents = [this]() {
     if (!isConstrainedMTMode())
     {
       if (current_tick_events < average_tick_events_uint) // let's try to send events as early, as possible
         sendQueuedEvents(average_tick_events_uint - current_tick_events);
     }
+  };
+  if (!parallelEsUpdate || isConstrainedMTMode())
+  {
+    for (auto esIndex : esUpdates[info.stage])
+    {
+      updateEs(esIndex);
+      sendEvents();
+    }
+  }
+  else
+  {
+    if (!esUpdateWavesValid)
+      buildEsUpdateWaves();
+    const es_index_type *waveBegin = esUpdates[info.stage].begin();
+    for (es_index_type waveSize : esUpdateWaves[info.stage])
+    {
+      if (waveSize == 1)
+        updateEs(*waveBegin);
+      else
+      {
+        updateAllQueries(); // queries can't be updated in constrained MT mode
+        setConstrainedMTMode(true);
+        nau::async::parallelFor(waveSize, 1, [waveBegin, &updateEs](size_t i) { updateEs(waveBegin[i]); });
+        setConstrainedMTMode(false);
+      }
+      waveBegin += waveSize;
+      sendEvents();
+    }
   }
   if (hasQueuedEntitiesCreation())
     performDelayedCreation(false); // we try to destroy queued entities after each query, asap
@@ -384,6 +384,7 @@ void EntityManager::resetEsOrder()
     esList.resize(prio.size());
     esForAllEntities.resize(prio.size());
     esUpdates.clear();
+    esUpdateWavesValid = false;
 
     uint32_t mask = 0;
     for (int i = 0; i < prio.size(); ++i)
@@ -33,7 +33,7 @@ namespace nau
 
         Result<> pumpMessageQueue(bool waitForMessage, std::optional<std::chrono::milliseconds> maxProcessingTime) override;
 
-        void waitAnyActivity() noexcept override;
+        bool waitAnyActivity(std::optional<std::chrono::milliseconds> timeout) noexcept override;
 
         void scheduleInvocation(Invocation) noexcept override;
 
@@ -0,0 +1,83 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+
+#include "daECS/core/entityManager.h"
+#include "daECS/core/entitySystem.h"
+#include "daECS/core/updateStage.h"
+#include "nau/utils/span.h"
+#include "test_ecs_common.h"
+
+// parallel_a_es and parallel_b_es don't share components and run concurrently,
+// parallel_c_es reads parallel_a and runs in the next wave
+static constexpr ecs::ComponentDesc parallel_a_es_comps[] = {
+  {ECS_HASH("parallel_a"), ecs::ComponentTypeInfo<int>()}};
+static constexpr ecs::ComponentDesc parallel_b_es_comps[] = {
+  {ECS_HASH("parallel_b"), ecs::ComponentTypeInfo<int>()}};
+static constexpr ecs::ComponentDesc parallel_c_es_comps[] = {
+  {ECS_HASH("parallel_c"), ecs::ComponentTypeInfo<int>()},
+  {ECS_HASH("parallel_a"), ecs::ComponentTypeInfo<int>()}};
+
+static void parallel_a_es_all(const ecs::UpdateStageInfo &, const ecs::QueryView &__restrict components)
+{
+  for (auto comp = components.begin(), compE = components.end(); comp != compE; ++comp)
+    ++ECS_RW_COMP(parallel_a_es_comps, "parallel_a", int);
+}
+
+static void parallel_b_es_all(const ecs::UpdateStageInfo &, const ecs::QueryView &__restrict components)
+{
+  for (auto comp = components.begin(), compE = components.end(); comp != compE; ++comp)
+    ECS_RW_COMP(parallel_b_es_comps, "parallel_b", int) += 2;
+}
+
+static void parallel_c_es_all(const ecs::UpdateStageInfo &, const ecs::QueryView &__restrict components)
+{
+  for (auto comp = components.begin(), compE = components.end(); comp != compE; ++comp)
+    ECS_RW_COMP(parallel_c_es_comps, "parallel_c", int) = ECS_RO_COMP(parallel_c_es_comps, "parallel_a", int);
+}
+
+static ecs::EntitySystemDesc parallel_a_es_desc("parallel_a_es", ecs::EntitySystemOps(parallel_a_es_all),
+  make_span(parallel_a_es_comps + 0, 1) /*rw*/, empty_span(), empty_span(), empty_span(), ecs::EventSetBuilder<>::build(),
+  (1 << ecs::UpdateStageInfoAct::STAGE));
+static ecs::EntitySystemDesc parallel_b_es_desc("parallel_b_es", ecs::EntitySystemOps(parallel_b_es_all),
+  make_span(parallel_b_es_comps + 0, 1) /*rw*/, empty_span(), empty_span(), empty_span(), ecs::EventSetBuilder<>::build(),
+  (1 << ecs::UpdateStageInfoAct::STAGE));
+static ecs::EntitySystemDesc parallel_c_es_desc("parallel_c_es", ecs::EntitySystemOps(parallel_c_es_all),
+  make_span(parallel_c_es_comps + 0, 1) /*rw*/, make_span(parallel_c_es_comps + 1, 1) /*ro*/, empty_span(), empty_span(),
+  ecs::EventSetBuilder<>::build(), (1 << ecs::UpdateStageInfoAct::STAGE), nullptr, nullptr, nullptr, "parallel_a_es");
+
+namespace nau::test
+{
+    /**
+        Test: in the parallel update mode the ES that don't share the components run concurrently,
+        the ES reading the component written by the other ES runs after it.
+     */
+    TEST_F(TestDagorECS, ParallelUpdate)
+    {
+        {
+            ecs::ComponentsMap map;
+            map[ECS_HASH("parallel_a")] = 0;
+            map[ECS_HASH("parallel_b")] = 0;
+            map[ECS_HASH("parallel_c")] = 0;
+            create_template(eastl::move(map), {}, "parallelTemplate");
+        }
+
+        eastl::vector<ecs::EntityId> eids;
+        for (int i = 0; i < CREATE_RUNS; ++i)
+        {
+            eids.push_back(g_entity_mgr->createEntitySync("parallelTemplate"));
+        }
+
+        g_entity_mgr->setParallelEsUpdate(true);
+        g_entity_mgr->update(ecs::UpdateStageInfoAct{0.f, 0.f});
+        g_entity_mgr->update(ecs::UpdateStageInfoAct{0.f, 0.f});
+        g_entity_mgr->setParallelEsUpdate(false);
+
+        for (const ecs::EntityId eid : eids)
+        {
+            ASSERT_EQ(g_entity_mgr->get<int>(eid, ECS_HASH("parallel_a")), 2);
+            ASSERT_EQ(g_entity_mgr->get<int>(eid, ECS_HASH("parallel_b")), 4);
+            ASSERT_EQ(g_entity_mgr->get<int>(eid, ECS_HASH("parallel_c")), 2);
+        }
+
+        ASSERT_FALSE(g_entity_mgr->isConstrainedMTMode());
+    }
+}  // namespace nau::test
@@ -21,8 +21,11 @@ namespace nau
         virtual ~DebugRenderSystem() = default;
 
         virtual void draw(const math::Matrix4& cameraMatrix, float dTime) = 0;
+        // Removes all the drawn lines and shapes on the next draw().
         virtual void clear() = 0;
 
+        // The draw functions can be called from any thread, the lines and the shapes are submitted without locks.
+
         virtual void drawLine(const math::Point3& pos0, const math::Point3& pos1, const math::Color4& color, float time) = 0;
 
         virtual void drawBoundingBox(const math::BBox3& box, const math::Color4& color, float time) = 0;
@@ -31,6 +34,8 @@ namespace nau
         virtual void drawPoint(const math::Point3& pos, const float& size, float time) = 0;
         virtual void drawCircle(const double& radius, const math::Color4& color, const math::Matrix4& transform, int density, float time) = 0;
         virtual void drawSphere(const double& radius, const math::Color4& color, const math::Matrix4& transform, int density, float time) = 0;
+        // The capsule along the transform Y axis: the cylinder of halfHeight * 2 with the hemisphere ends of radius.
+        virtual void drawCapsule(float radius, float halfHeight, const math::Color4& color, const math::Matrix4& transform, float time) = 0;
         virtual void drawPlane(const math::Vector4& p, const math::Color4& color, float sizeWidth, float sizeNormal, bool drawCenterCross, float time) = 0;
         virtual void drawFrustrum(const math::Matrix4& view, const math::Matrix4& proj, float time) = 0;
 
@@ -4,6 +4,8 @@
 
 #include "debug_renderer_sys_impl.h"
 
+#include <EASTL/sort.h>
+
 #include <numbers>
 
 #include "graphics_assets/shader_asset.h"
@@ -13,7 +15,6 @@
 #include "nau/service/service_provider.h"
 
 #define MULTIPLICATION_LINES_ARRAY_INCREASE  0.3
-#define FIXED_LINES_ARRAY_INCREASE  100
 
 namespace nau
 {
@@ -44,8 +45,9 @@ namespace nau
         auto debugMatRef = MaterialAssetRef{"file:/res/materials/embedded/debug_renderer.nmat_json"};
         m_debugMaterial = co_await debugMatRef.getAssetViewTyped<MaterialAssetView>();
 
-        m_verticesPrimPositionBuffer = d3d::create_vb(m_maxPointsCount * sizeof(Point3), SBCF_DYNAMIC, u8"DebugVertexPositionBuf");
-        m_verticesPrimColorBuffer = d3d::create_vb(m_maxPointsCount * sizeof(Color4), SBCF_DYNAMIC, u8"DebugVertexColorBuf");
+        // The lines stay in the GPU buffers: only the changed ones are uploaded.
+        m_verticesPrimPositionBuffer = d3d::create_vb(m_linesCapacity * 2 * sizeof(Point3), 0, u8"DebugVertexPositionBuf");
+        m_verticesPrimColorBuffer = d3d::create_vb(m_linesCapacity * 2 * sizeof(Color4), 0, u8"DebugVertexColorBuf");
 
         co_return;
     }
@@ -62,6 +64,13 @@ namespace nau
         }
         m_meshesInfo.clear();
 
+        for (auto& [_, shapeMesh] : m_shapeMeshes)
+        {
+            shapeMesh.verticesBuffer->destroy();
+            shapeMesh.indicesBuffer->destroy();
+        }
+        m_shapeMeshes.clear();
+
         m_debugMaterial.reset();
 
         return async::Task<>::makeResolved();
@@ -72,11 +81,11 @@ namespace nau
         return {&rtti::getTypeInfo<ICoreGraphics>()};
     }
 
-    void DebugRenderSysImpl::DrawPrimitives(const math::Matrix4& cameraMatrix, float dTime)
+    void DebugRenderSysImpl::DrawPrimitives(const math::Matrix4& cameraMatrix)
     {
-        UpdateLinesBuffer(dTime);
+        UpdateLinesBuffer();
 
-        if (m_currentPointsCount == 0)
+        if (m_lines.size() == 0)
         {
             return;
         }
@@ -88,7 +97,41 @@ namespace nau
         d3d::setvsrc(0, m_verticesPrimPositionBuffer, sizeof(Point3));
         d3d::setvsrc(1, m_verticesPrimColorBuffer, sizeof(Color4));
 
-        d3d::draw(PRIM_LINELIST, 0, m_currentPointsCount / 2);
+        d3d::draw(PRIM_LINELIST, 0, m_lines.size());
+    }
+
+    void DebugRenderSysImpl::DrawShapes(const math::Matrix4& cameraMatrix)
+    {
+        if (m_shapes.empty())
+        {
+            return;
+        }
+
+        // The debug material draws a transform per draw call: the instances of a mesh share its buffers.
+        eastl::sort(m_shapes.begin(), m_shapes.end(), [](const ShapeInstance& a, const ShapeInstance& b)
+        {
+            return a.meshKey < b.meshKey;
+        });
+
+        m_debugMaterial->bindPipeline(MeshPipelineName);
+        d3d::set_vs_const(0, reinterpret_cast<const void*>(&cameraMatrix), 4);
+
+        const ShapeMesh* mesh = nullptr;
+        uint32_t meshKey = eastl::numeric_limits<uint32_t>::max();
+        for (const ShapeInstance& instance : m_shapes)
+        {
+            if (instance.meshKey != meshKey)
+            {
+                meshKey = instance.meshKey;
+                mesh = &getShapeMesh(meshKey);
+                d3d::setvsrc(0, mesh->verticesBuffer, sizeof(Point3));
+                d3d::setind(mesh->indicesBuffer);
+            }
+
+            const MeshConstData constData{instance.transform, instance.color};
+            d3d::set_vs_const(4, reinterpret_cast<const void*>(&constData), 5);
+            d3d::drawind(PRIM_LINELIST, 0, mesh->linesCount, 0);
+        }
     }
 
     void DebugRenderSysImpl::DrawMeshes(const math::Matrix4& cameraMatrix, float dTime)
@@ -140,113 +183,286 @@ namespace nau
         m_meshesInfo.resize(freeIndex);
     }
 
-    void DebugRenderSysImpl::UpdateLinesBuffer(float dTime)
+    void DebugRenderSysImpl::ConsumeSubmissions()
     {
-        lock_(m_linesRWMutex);
-
-        if (m_primDirtyFlag)
+        if (m_isClearRequested.exchange(false))
         {
-            if (m_freeLineIndexes.size() > MULTIPLICATION_LINES_ARRAY_INCREASE * m_lines.size() + 2*FIXED_LINES_ARRAY_INCREASE)
+            m_lines = {};
+            m_linesDirtyBegin = m_linesDirtyEnd = 0;
+            m_shapes.clear();
+            m_nextExpiry = eastl::numeric_limits<float>::max();
+
+            // The submissions before the clear are dropped too.
+            LineSubmit line;
+            while (m_linesQueue.tryPop(line))
             {
-                size_t freeCell = 0;
-                for (int i = 0; i < m_lines.size(); ++i)
-                {
-                    if (m_lines.timer[i] > 0)
-                    {
-                        if (i != freeCell)
-                        {
-                            m_lines.set(freeCell, i);
-                            m_lines.timer[i] = -1;
-                        }
-                        freeCell++;
-                    }
-                }
-                size_t newSize = freeCell;
-                m_lines.resize(newSize);
-                m_freeLineIndexes.clear();
             }
+            ShapeSubmit shape;
+            while (m_shapesQueue.tryPop(shape))
+            {
+            }
+            {
+                lock_(m_linesOverflowMutex);
+                m_linesOverflow.clear();
+            }
+            {
+                lock_(m_shapesOverflowMutex);
+                m_shapesOverflow.clear();
+            }
+            return;
+        }
 
-            m_primDirtyFlag = false;
+        const size_t linesCount = m_lines.size();
+        auto addLine = [this](const LineSubmit& line)
+        {
+            const float expiry = m_time + line.time;
+            m_lines.positions.push_back(line.pointA);
+            m_lines.positions.push_back(line.pointB);
+            m_lines.colors.push_back(line.color);
+            m_lines.colors.push_back(line.color);
+            m_lines.expiry.push_back(expiry);
+            m_nextExpiry = eastl::min(m_nextExpiry, expiry);
+        };
+
+        LineSubmit line;
+        while (m_linesQueue.tryPop(line))
+        {
+            addLine(line);
+        }
+        {
+            eastl::vector<LineSubmit> overflow;
+            {
+                lock_(m_linesOverflowMutex);
+                overflow.swap(m_linesOverflow);
+            }
+            for (const LineSubmit& overflowLine : overflow)
+            {
+                addLine(overflowLine);
+            }
+        }
 
-            m_currentPointsCount = (m_lines.size() - m_freeLineIndexes.size()) * 2;
+        if (m_lines.size() != linesCount)
+        {
+            m_linesDirtyBegin = m_linesDirtyBegin == m_linesDirtyEnd ? linesCount : eastl::min(m_linesDirtyBegin, linesCount);
+            m_linesDirtyEnd = m_lines.size();
+        }
 
-            if (m_currentPointsCount > m_maxPointsCount)
+        auto addShape = [this](const ShapeSubmit& shape)
+        {
+            const float expiry = m_time + shape.time;
+            const uint32_t meshKey = (static_cast<uint32_t>(shape.shape) << 16) | shape.segments;
+            m_shapes.push_back({shape.transform, shape.color, expiry, meshKey});
+            m_nextExpiry = eastl::min(m_nextExpiry, expiry);
+        };
+
+        ShapeSubmit shape;
+        while (m_shapesQueue.tryPop(shape))
+        {
+            addShape(shape);
+        }
+        {
+            eastl::vector<ShapeSubmit> overflow;
             {
-                m_maxPointsCount = alignedSize(m_currentPointsCount + m_currentPointsCount * MULTIPLICATION_LINES_ARRAY_INCREASE, 1024);
-                m_verticesPrimPositionBuffer->destroy();
-                m_verticesPrimColorBuffer->destroy();
-                m_verticesPrimPositionBuffer = d3d::create_vb(m_maxPointsCount * sizeof(Point3), SBCF_DYNAMIC, u8"DebugVertexPositionBuf");
-                m_verticesPrimColorBuffer = d3d::create_vb(m_maxPointsCount * sizeof(Color4), SBCF_DYNAMIC, u8"DebugVertexColorBuf");
+                lock_(m_shapesOverflowMutex);
+                overflow.swap(m_shapesOverflow);
             }
-
-            if (m_currentPointsCount > 0)
+            for (const ShapeSubmit& overflowShape : overflow)
             {
-                Point3* vertexPositionMem = nullptr;
-                Color4* vertexColorMem = nullptr;
+                addShape(overflowShape);
+            }
+        }
+    }
 
-                m_verticesPrimPositionBuffer->lock(0, m_currentPointsCount * sizeof(Point3),
-                    reinterpret_cast<void**>(&vertexPositionMem), VBLOCK_WRITEONLY);
-                m_verticesPrimColorBuffer->lock(0, m_currentPointsCount * sizeof(Color4),
-                    reinterpret_cast<void**>(&vertexColorMem), VBLOCK_WRITEONLY);
+    void DebugRenderSysImpl::UpdateLinesBuffer()
+    {
+        if (m_lines.size() > m_linesCapacity)
+        {
+            m_linesCapacity = alignedSize(static_cast<size_t>(m_lines.size() * (1. + MULTIPLICATION_LINES_ARRAY_INCREASE)), 1024);
+            m_verticesPrimPositionBuffer->destroy();
+            m_verticesPrimColorBuffer->destroy();
+            m_verticesPrimPositionBuffer = d3d::create_vb(m_linesCapacity * 2 * sizeof(Point3), 0, u8"DebugVertexPositionBuf");
+            m_verticesPrimColorBuffer = d3d::create_vb(m_linesCapacity * 2 * sizeof(Color4), 0, u8"DebugVertexColorBuf");
+
+            m_linesDirtyBegin = 0;
+            m_linesDirtyEnd = m_lines.size();
+        }
 
-                size_t vertexPosition = 0;
-                for (int i = 0; i < m_lines.size(); ++i)
-                {
-                    if (m_lines.timer[i] >= 0)
-                    {
-                        vertexPositionMem[i * 2] = m_lines.pointA[i];
-                        vertexPositionMem[i * 2 + 1] = m_lines.pointB[i];
-                        vertexColorMem[i * 2] = m_lines.color[i];
-                        vertexColorMem[i * 2 + 1] = m_lines.color[i];
-                        vertexPosition++;
-                    }
-                }
+        m_linesDirtyEnd = eastl::min(m_linesDirtyEnd, m_lines.size());
+        if (m_linesDirtyBegin < m_linesDirtyEnd)
+        {
+            const size_t firstVertex = m_linesDirtyBegin * 2;
+            const size_t verticesCount = (m_linesDirtyEnd - m_linesDirtyBegin) * 2;
+            m_verticesPrimPositionBuffer->updateData(firstVertex * sizeof(Point3), verticesCount * sizeof(Point3),
+                                                     m_lines.positions.data() + firstVertex, VBLOCK_WRITEONLY);
+            m_verticesPrimColorBuffer->updateData(firstVertex * sizeof(Color4), verticesCount * sizeof(Color4),
+                                                  m_lines.colors.data() + firstVertex, VBLOCK_WRITEONLY);
+        }
 
-                m_verticesPrimPositionBuffer->unlock();
-                m_verticesPrimColorBuffer->unlock();
-            }
+        m_linesDirtyBegin = m_linesDirtyEnd = 0;
+    }
+
+    void DebugRenderSysImpl::ExpireLinesAndShapes()
+    {
+        if (m_time <= m_nextExpiry)
+        {
+            return;
         }
 
-        for (int i = 0; i < m_lines.size(); ++i)
+        m_nextExpiry = eastl::numeric_limits<float>::max();
+
+        // The expired lines are replaced with the last ones: only the replaced lines are uploaded again.
+        size_t line = 0;
+        while (line < m_lines.size())
         {
-            if (m_lines.timer[i] < 0)
+            if (m_lines.expiry[line] >= m_time)
             {
+                m_nextExpiry = eastl::min(m_nextExpiry, m_lines.expiry[line]);
+                ++line;
                 continue;
             }
-            m_lines.timer[i] -= dTime;
-            if (m_lines.timer[i] < 0)
+
+            const size_t last = m_lines.size() - 1;
+            if (line != last)
             {
-                m_primDirtyFlag = true;
-                m_freeLineIndexes.push_back(i);
+                m_lines.positions[line * 2] = m_lines.positions[last * 2];
+                m_lines.positions[line * 2 + 1] = m_lines.positions[last * 2 + 1];
+                m_lines.colors[line * 2] = m_lines.colors[last * 2];
+                m_lines.colors[line * 2 + 1] = m_lines.colors[last * 2 + 1];
+                m_lines.expiry[line] = m_lines.expiry[last];
+
+                m_linesDirtyBegin = m_linesDirtyBegin == m_linesDirtyEnd ? line : eastl::min(m_linesDirtyBegin, line);
+                m_linesDirtyEnd = eastl::max(m_linesDirtyEnd, line + 1);
             }
+
+            m_lines.positions.resize(last * 2);
+            m_lines.colors.resize(last * 2);
+            m_lines.expiry.resize(last);
         }
-    }
 
+        eastl::erase_if(m_shapes, [this](const ShapeInstance& shape)
+        {
+            if (shape.expiry < m_time)
+            {
+                return true;
+            }
+            m_nextExpiry = eastl::min(m_nextExpiry, shape.expiry);
+            return false;
+        });
+    }
 
     void DebugRenderSysImpl::draw(const math::Matrix4& cameraMatrix, float dTime)
     {
+        ConsumeSubmissions();
+
         d3d::setwire(true);
 
-        DrawPrimitives(cameraMatrix, dTime);
+        DrawPrimitives(cameraMatrix);
+        DrawShapes(cameraMatrix);
         DrawQuads();
         DrawMeshes(cameraMatrix, dTime);
 
         d3d::setwire(false);
+
+        // The lines of zero time are drawn once.
+        m_time += dTime;
+        ExpireLinesAndShapes();
     }
 
     void DebugRenderSysImpl::clear()
     {
-        lock_(m_meshRWMutex);
-        lock_(m_linesRWMutex);
+        m_isClearRequested = true;
+    }
+
+    const DebugRenderSysImpl::ShapeMesh& DebugRenderSysImpl::getShapeMesh(uint32_t meshKey)
+    {
+        auto mesh = m_shapeMeshes.find(meshKey);
+        if (mesh != m_shapeMeshes.end())
+        {
+            return mesh->second;
+        }
+
+        const Shape shape = static_cast<Shape>(meshKey >> 16);
+        const uint32_t segments = meshKey & 0xffff;
 
-        if (m_lines.size() == 0 && m_freeLineIndexes.size() == 0)
+        eastl::vector<Point3> vertices;
+        eastl::vector<uint32_t> indices;
+
+        // The unit circle of the segments in the plane of the axes, the arc part of it for the hemisphere.
+        auto addCircle = [&vertices, &indices, segments](int axis0, int axis1, float arc)
+        {
+            const uint32_t arcSegments = eastl::max(static_cast<uint32_t>(segments * arc), 1u);
+            const float angleStep = std::numbers::pi_v<float> * 2.f * arc / arcSegments;
+            const uint32_t firstVertex = static_cast<uint32_t>(vertices.size());
+            for (uint32_t i = 0; i <= arcSegments; ++i)
+            {
+                float coords[3] = {0.f, 0.f, 0.f};
+                coords[axis0] = cosf(angleStep * i);
+                coords[axis1] = sinf(angleStep * i);
+                vertices.emplace_back(coords[0], coords[1], coords[2]);
+                if (i > 0)
+                {
+                    indices.push_back(firstVertex + i - 1);
+                    indices.push_back(firstVertex + i);
+                }
+            }
+        };
+
+        switch (shape)
+        {
+            case Shape::Box:
+                for (int k = 0; k < 8; ++k)
+                {
+                    vertices.emplace_back(k & 1 ? 1.f : -1.f, k & 2 ? 1.f : -1.f, k & 4 ? 1.f : -1.f);
+                }
+                indices = {0, 1, 1, 3, 3, 2, 2, 0, 4, 5, 5, 7, 7, 6, 6, 4, 0, 4, 1, 5, 2, 6, 3, 7};
+                break;
+            case Shape::Circle:
+                addCircle(0, 1, 1.f);
+                break;
+            case Shape::Sphere:
+                addCircle(0, 1, 1.f);
+                addCircle(1, 2, 1.f);
+                addCircle(2, 0, 1.f);
+                break;
+            case Shape::Hemisphere:
+                addCircle(2, 0, 1.f);
+                addCircle(0, 1, 0.5f);
+                addCircle(2, 1, 0.5f);
+                break;
+            case Shape::CapsuleBody:
+                for (const Vector3& side : {Vector3(1, 0, 0), Vector3(-1, 0, 0), Vector3(0, 0, 1), Vector3(0, 0, -1)})
+                {
+                    indices.push_back(static_cast<uint32_t>(vertices.size()));
+                    vertices.emplace_back(Point3(side) + Vector3(0, -1, 0));
+                    indices.push_back(static_cast<uint32_t>(vertices.size()));
+                    vertices.emplace_back(Point3(side) + Vector3(0, 1, 0));
+                }
+                break;
+        }
+
+        ShapeMesh shapeMesh;
+        shapeMesh.verticesBuffer = d3d::create_vb(vertices.size() * sizeof(Point3), 0, u8"DebugShapeVertexBuf");
+        shapeMesh.verticesBuffer->updateData(0, vertices.size() * sizeof(Point3), vertices.data(), VBLOCK_WRITEONLY);
+        shapeMesh.indicesBuffer = d3d::create_ib(indices.size() * sizeof(uint32_t), SBCF_INDEX32, u8"DebugShapeIndexBuf");
+        shapeMesh.indicesBuffer->updateData(0, indices.size() * sizeof(uint32_t), indices.data(), VBLOCK_WRITEONLY);
+        shapeMesh.linesCount = static_cast<uint32_t>(indices.size() / 2);
+
+        return m_shapeMeshes.emplace(meshKey, shapeMesh).first->second;
+    }
+
+    void DebugRenderSysImpl::submitShape(Shape shape, const math::Matrix4& transform, const math::Color4& color, uint32_t segments, float time)
+    {
+        if (time < 0)
         {
             return;
         }
 
-        m_lines.clear();
-        m_freeLineIndexes.clear();
-        m_primDirtyFlag = true;
+        const ShapeSubmit submit{transform, color, time, shape, eastl::clamp(segments, 3u, 256u)};
+        if (!m_shapesQueue.tryPush(submit))
+        {
+            lock_(m_shapesOverflowMutex);
+            m_shapesOverflow.push_back(submit);
+        }
     }
 
     void DebugRenderSysImpl::drawStaticMesh(const StaticMesh& mesh, const math::Matrix4& transform, const math::Color4& color, float time)
@@ -281,57 +497,14 @@ namespace nau
 
     void DebugRenderSysImpl::drawBoundingBox(const BBox3& box, const math::Color4& color, float time)
     {
-        Point3 corners[BBox3::PointsCount];
-
-        for (int k = 0; k < BBox3::PointsCount; ++k)
-        {
-            corners[k] = box.point(k);
-        }
-
-        drawLine(corners[0], corners[1], color, time);
-        drawLine(corners[0], corners[2], color, time);
-        drawLine(corners[2], corners[3], color, time);
-        drawLine(corners[3], corners[1], color, time);
-
-        drawLine(corners[4], corners[5], color, time);
-        drawLine(corners[4], corners[6], color, time);
-        drawLine(corners[6], corners[7], color, time);
-        drawLine(corners[7], corners[5], color, time);
-
-        drawLine(corners[0], corners[4], color, time);
-        drawLine(corners[1], corners[5], color, time);
-        drawLine(corners[2], corners[6], color, time);
-        drawLine(corners[3], corners[7], color, time);
+        drawBoundingBox(box, Matrix4::identity(), color, time);
     }
 
     void DebugRenderSysImpl::drawBoundingBox(const BBox3& box, const Matrix4& transform, const math::Color4& color, float time)
     {
-        Point3 corners[BBox3::PointsCount];
-
-        for (int k = 0; k < BBox3::PointsCount; ++k)
-        {
-            corners[k] = box.point(k);
-        }
-
-        for (auto& corner : corners)
-        {
-            corner = transform * corner;
-        }
-
-        drawLine(corners[0], corners[1], color, time);
-        drawLine(corners[1], corners[2], color, time);
-        drawLine(corners[2], corners[3], color, time);
-        drawLine(corners[3], corners[0], color, time);
-
-        drawLine(corners[4], corners[5], color, time);
-        drawLine(corners[5], corners[6], color, time);
-        drawLine(corners[6], corners[7], color, time);
-        drawLine(corners[7], corners[4], color, time);
-
-        drawLine(corners[0], corners[4], color, time);
-        drawLine(corners[1], corners[5], color, time);
-        drawLine(corners[2], corners[6], color, time);
-        drawLine(corners[3], corners[7], color, time);
+        // The unit box is [-1, 1].
+        const Matrix4 boxTransform = Matrix4::translation(Vector3(box.center())) * Matrix4::scale(box.width() * 0.5f);
+        submitShape(Shape::Box, transform * boxTransform, color, 0, time);
     }
 
     void DebugRenderSysImpl::drawLine(const math::Point3& pos0, const math::Point3& pos1, const math::Color4& color, float time)
@@ -340,25 +513,13 @@ namespace nau
         {
             return;
         }
-        lock_(m_linesRWMutex);
-        if (!m_freeLineIndexes.size())
+
+        const LineSubmit line{pos0, pos1, color, time};
+        if (!m_linesQueue.tryPush(line))
         {
-            size_t newSize = m_lines.size() +  m_lines.size() * MULTIPLICATION_LINES_ARRAY_INCREASE + FIXED_LINES_ARRAY_INCREASE;
-            for (int k = newSize; k > m_lines.size(); --k)
-            {
-                m_freeLineIndexes.push_back(k - 1);
-            }
-            m_lines.resize(newSize);
+            lock_(m_linesOverflowMutex);
+            m_linesOverflow.push_back(line);
         }
-        auto n = m_freeLineIndexes.back();
-        m_freeLineIndexes.pop_back();
-
-        m_lines.set(n, {Point3(pos0),
-                        Point3(pos1),
-                        time,
-                        e3dcolor(color)});
-
-        m_primDirtyFlag = true;
     }
 
     void DebugRenderSysImpl::drawArrow(const Point3& p0, const Point3& p1, const Color4& color, const Vector3& n, float time)
@@ -383,28 +544,21 @@ namespace nau
 
     void DebugRenderSysImpl::drawCircle(const double& radius, const Color4& color, const Matrix4& transform, int density, float time)
     {
-        double angleStep = std::numbers::pi_v<float> * 2 / density;
-
-        for (int i = 0; i < density; i++)
-        {
-            auto point0X = radius * cos(angleStep * i);
-            auto point0Y = radius * sin(angleStep * i);
-
-            auto point1X = radius * cos(angleStep * (i + 1));
-            auto point1Y = radius * sin(angleStep * (i + 1));
-
-            auto p0 = transform * Point3(static_cast<float>(point0X), static_cast<float>(point0Y), 0);
-            auto p1 = transform * Point3(static_cast<float>(point1X), static_cast<float>(point1Y), 0);
-
-            drawLine(p0, p1, color, time);
-        }
+        submitShape(Shape::Circle, transform * Matrix4::scale(Vector3(static_cast<float>(radius))), color, static_cast<uint32_t>(eastl::max(density, 0)), time);
     }
 
     void DebugRenderSysImpl::drawSphere(const double& radius, const Color4& color, const Matrix4& transform, int density, float time)
     {
-        drawCircle(radius, color, transform, density, time);
-        drawCircle(radius, color, transform*Matrix4::rotationX(0.5 * std::numbers::pi_v<float>), density, time);
-        drawCircle(radius, color, transform*Matrix4::rotationY(0.5 * std::numbers::pi_v<float>), density, time);
+        submitShape(Shape::Sphere, transform * Matrix4::scale(Vector3(static_cast<float>(radius))), color, static_cast<uint32_t>(eastl::max(density, 0)), time);
+    }
+
+    void DebugRenderSysImpl::drawCapsule(float radius, float halfHeight, const Color4& color, const Matrix4& transform, float time)
+    {
+        submitShape(Shape::CapsuleBody, transform * Matrix4::scale(Vector3(radius, halfHeight, radius)), color, CapsuleSegments, time);
+        submitShape(Shape::Hemisphere, transform * Matrix4::translation(Vector3(0, halfHeight, 0)) * Matrix4::scale(Vector3(radius)),
+                    color, CapsuleSegments, time);
+        submitShape(Shape::Hemisphere, transform * Matrix4::translation(Vector3(0, -halfHeight, 0)) * Matrix4::scale(Vector3(radius, -radius, radius)),
+                    color, CapsuleSegments, time);
     }
 
     void DebugRenderSysImpl::drawPlane(const Vector4& p, const Color4& color, float sizeWidth, float sizeNormal, bool drawCenterCross, float time)
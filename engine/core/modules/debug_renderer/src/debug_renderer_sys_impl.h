@@ -2,6 +2,10 @@
 // Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
 
 
+#include <EASTL/numeric_limits.h>
+#include <EASTL/vector_map.h>
+
+#include "debug_submit_queue.h"
 #include "nau/3d/dag_drv3d.h"
 #include "nau/assets/asset_manager.h"
 #include "nau/debugRenderer/debug_render_system.h"
@@ -26,70 +30,104 @@ namespace nau
 
 #pragma region Primitives
 
-        struct LinesDescription
+        struct LineSubmit
         {
-            struct LineDescription
-            {
-                math::Point3 pointA;
-                math::Point3 pointB;
-                float timer;
-                math::E3DCOLOR color;
-            };
-
-            eastl::vector<math::Point3> pointA;
-            eastl::vector<math::Point3> pointB;
-            eastl::vector<float> timer;
-            eastl::vector<math::E3DCOLOR> color;
-            size_t size()
-            {
-                return pointA.size();
-            }
-
-            void resize(size_t n)
-            {
-                pointA.resize(n);
-                pointB.resize(n);
-                timer.resize(n, -1);  // negative time not drawing
-                color.resize(n);
-            }
+            math::Point3 pointA;
+            math::Point3 pointB;
+            math::Color4 color;
+            float time;
+        };
 
-            void clear()
-            {
-                pointA.clear();
-                pointB.clear();
-                timer.clear();
-                color.clear();
-            }
-            void set(size_t n, const LineDescription& line)
-            {
-                pointA[n] = line.pointA;
-                pointB[n] = line.pointB;
-                timer[n] = line.timer;
-                color[n] = line.color;
-            }
+        // The drawn lines: the vertex streams mirror the GPU buffers, two vertices per line.
+        struct Lines
+        {
+            eastl::vector<math::Point3> positions;
+            eastl::vector<math::Color4> colors;
+            // The scene time after which the line is removed.
+            eastl::vector<float> expiry;
 
-            void set(size_t i, size_t j)
+            size_t size() const
             {
-                pointA[i] = pointA[j];
-                pointB[i] = pointB[j];
-                timer[i] = timer[j];
-                color[i] = color[j];
+                return expiry.size();
             }
         };
 
-        nau::threading::SpinLock m_linesRWMutex;
-        LinesDescription m_lines;
-        eastl::vector<uint32_t> m_freeLineIndexes;
+        static constexpr uint32_t LinesQueueCapacity = 1024 * 64;
 
-        Sbuffer* m_verticesPrimPositionBuffer;
-        Sbuffer* m_verticesPrimColorBuffer;
-        int m_maxPointsCount = 1024 * 1024 * 8;
-        int m_currentPointsCount = 0;
+        DebugSubmitQueue<LineSubmit> m_linesQueue{LinesQueueCapacity};
+        // The lines submitted when the queue is full.
+        nau::threading::SpinLock m_linesOverflowMutex;
+        eastl::vector<LineSubmit> m_linesOverflow;
 
-        bool m_primDirtyFlag = false;
+        Lines m_lines;
+        // The changed lines [begin, end) to upload.
+        size_t m_linesDirtyBegin = 0;
+        size_t m_linesDirtyEnd = 0;
+
+        Sbuffer* m_verticesPrimPositionBuffer = nullptr;
+        Sbuffer* m_verticesPrimColorBuffer = nullptr;
+        // The lines the GPU buffers hold.
+        size_t m_linesCapacity = 1024 * 64;
 
 #pragma endregion Primitives
 
+#pragma region Shapes
+
+        // The shapes drawn with the shared unit meshes instead of the lines.
+        enum class Shape : uint8_t
+        {
+            Box,
+            Circle,
+            Sphere,
+            // The y >= 0 half of a unit sphere with its equator: the capsule ends.
+            Hemisphere,
+            // The four unit height lines of the capsule sides.
+            CapsuleBody
+        };
+
+        struct ShapeSubmit
+        {
+            math::Matrix4 transform;
+            math::Color4 color;
+            float time;
+            Shape shape;
+            uint32_t segments;
+        };
+
+        struct ShapeInstance
+        {
+            math::Matrix4 transform;
+            math::Color4 color;
+            float expiry;
+            uint32_t meshKey;
+        };
+
+        struct ShapeMesh
+        {
+            Sbuffer* verticesBuffer = nullptr;
+            Sbuffer* indicesBuffer = nullptr;
+            uint32_t linesCount = 0;
+        };
+
+        static constexpr uint32_t ShapesQueueCapacity = 1024 * 4;
+        static constexpr uint32_t CapsuleSegments = 32;
+
+        DebugSubmitQueue<ShapeSubmit> m_shapesQueue{ShapesQueueCapacity};
+        nau::threading::SpinLock m_shapesOverflowMutex;
+        eastl::vector<ShapeSubmit> m_shapesOverflow;
+
+        eastl::vector<ShapeInstance> m_shapes;
+        // The unit meshes by the shape and the segments count, created on the render thread.
+        eastl::vector_map<uint32_t, ShapeMesh> m_shapeMeshes;
+
+#pragma endregion Shapes
+
+        // The scene time of the debug draw, advanced by draw(): the lines and the shapes expire against it.
+        float m_time = 0.f;
+        // The earliest expiry of the lines and the shapes: nothing is checked before it.
+        float m_nextExpiry = eastl::numeric_limits<float>::max();
+        std::atomic<bool> m_isClearRequested = false;
+
 #pragma region Meshes
 
         struct MeshConstData
@@ -113,13 +151,19 @@ namespace nau
 #pragma endregion Meshes
 
     protected:
-        void DrawPrimitives(const math::Matrix4& cameraMatrix, float dTime);
+        void DrawPrimitives(const math::Matrix4& cameraMatrix);
+        void DrawShapes(const math::Matrix4& cameraMatrix);
         void DrawQuads(){};
         void DrawMeshes(const math::Matrix4& cameraMatrix, float dTime);
 
-        void UpdateLinesBuffer(float dTime);
+        void ConsumeSubmissions();
+        void UpdateLinesBuffer();
+        void ExpireLinesAndShapes();
         void UpdateMeshesBuffers(float dTime);
 
+        void submitShape(Shape shape, const math::Matrix4& transform, const math::Color4& color, uint32_t segments, float time);
+        const ShapeMesh& getShapeMesh(uint32_t meshKey);
+
     public:
         async::Task<> preInitService() override;
         async::Task<> initService() override;
@@ -140,6 +184,7 @@ namespace nau
         virtual void drawPoint(const math::Point3& pos, const float& size, float time) override;
         virtual void drawCircle(const double& radius, const math::Color4& color, const math::Matrix4& transform, int density, float time) override;
         virtual void drawSphere(const double& radius, const math::Color4& color, const math::Matrix4& transform, int density, float time) override;
+        virtual void drawCapsule(float radius, float halfHeight, const math::Color4& color, const math::Matrix4& transform, float time) override;
         virtual void drawPlane(const math::Vector4& p, const math::Color4& color, float sizeWidth, float sizeNormal, bool drawCenterCross, float time) override;
         virtual void drawFrustrum(const math::Matrix4& view, const math::Matrix4& proj, float time) override;
 
@@ -0,0 +1,113 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <EASTL/unique_ptr.h>
+
+#include <atomic>
+
+namespace nau
+{
+    /**
+     * The bounded lock-free queue of the debug draw submissions: any thread pushes, the render thread pops.
+     * Each cell has its sequence number: the cell is free for the push of the position equal to it and ready for the pop
+     * when it is one past the position.
+     */
+    template <typename T>
+    class DebugSubmitQueue
+    {
+    public:
+        // The capacity is a power of two.
+        explicit DebugSubmitQueue(uint32_t capacity) :
+            m_cells(eastl::make_unique<Cell[]>(capacity)),
+            m_mask(capacity - 1)
+        {
+            NAU_ASSERT(capacity >= 2 && (capacity & m_mask) == 0);
+            for (uint32_t i = 0; i < capacity; ++i)
+            {
+                m_cells[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        DebugSubmitQueue(const DebugSubmitQueue&) = delete;
+        DebugSubmitQueue& operator=(const DebugSubmitQueue&) = delete;
+
+        // Returns false when the queue is full.
+        bool tryPush(const T& item)
+        {
+            uint32_t position = m_pushPosition.load(std::memory_order_relaxed);
+            Cell* cell = nullptr;
+            for (;;)
+            {
+                cell = &m_cells[position & m_mask];
+                const int32_t diff = static_cast<int32_t>(cell->sequence.load(std::memory_order_acquire) - position);
+                if (diff == 0)
+                {
+                    if (m_pushPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    position = m_pushPosition.load(std::memory_order_relaxed);
+                }
+            }
+
+            cell->item = item;
+            cell->sequence.store(position + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Returns false when the queue is empty.
+        bool tryPop(T& item)
+        {
+            uint32_t position = m_popPosition.load(std::memory_order_relaxed);
+            Cell* cell = nullptr;
+            for (;;)
+            {
+                cell = &m_cells[position & m_mask];
+                const int32_t diff = static_cast<int32_t>(cell->sequence.load(std::memory_order_acquire) - (position + 1));
+                if (diff == 0)
+                {
+                    if (m_popPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    position = m_popPosition.load(std::memory_order_relaxed);
+                }
+            }
+
+            item = cell->item;
+            cell->sequence.store(position + m_mask + 1, std::memory_order_release);
+            return true;
+        }
+
+    private:
+        struct Cell
+        {
+            std::atomic<uint32_t> sequence;
+            T item;
+        };
+
+        eastl::unique_ptr<Cell[]> m_cells;
+        const uint32_t m_mask;
+
+        alignas(64) std::atomic<uint32_t> m_pushPosition = 0;
+        alignas(64) std::atomic<uint32_t> m_popPosition = 0;
+    };
+
+}  // namespace nau
@@ -35,6 +35,8 @@ void imgui_render();
 
 NAU_GRAPHICS_EXPORT void imgui_cache_render_data();
 NAU_GRAPHICS_EXPORT void imgui_copy_render_data();
+// Called by the render thread at the frame latch: takes the data published by imgui_copy_render_data for imgui_render_copied_data
+void imgui_latch_render_data();
 void imgui_render_copied_data();
 //nau::DataBlock *imgui_get_blk();
 void imgui_save_blk();
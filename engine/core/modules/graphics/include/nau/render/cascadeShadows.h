@@ -25,6 +25,9 @@ namespace nau::csm
         virtual void getCascadeShadowAnchorPoint(float cascade_from, nau::math::Vector3& out_anchor) = 0;
         virtual void getCascadeShadowSparseUpdateParams(int cascade_no, const nau::math::NauFrustum& cascade_frustum, float &out_min_sparse_dist,
         int &out_min_sparse_frame) = 0;
+        // The shadow casters inside the caster culling frustum of a sparse cascade were changed since the cascade was rendered:
+        // the cascade is redrawn instead of keeping the cached depth.
+        virtual bool isCascadeShadowCastersChanged(int cascade_no, const nau::math::NauFrustum& caster_frustum) { return false; }
     };
 
     class CascadeShadowsPrivate;
@@ -51,8 +54,14 @@ namespace nau::csm
             // (static shadow texel size) * (this multiplier)
             float destructablesMinBboxRadiusTexelMul = 0.f;
 
+            // The cascades starting farther than the distance are sparse: their depth is cached and redrawn
+            // once in (minimalSparseFrame + cascade index) frames, when the camera leaves the cached area or the casters change.
             float minimalSparseDistance = 100000.0f;
             float minimalSparseFrame = -1000.0f;
+
+            // How far the caster culling frustum is extended towards the sun:
+            // the casters before the cascade near plane are rendered with the clamped depth.
+            float casterCullingExtension = 1000.f;
         };
 
         struct ModeSettings
@@ -96,6 +105,8 @@ namespace nau::csm
 
         int getNumCascadesToRender() const;
         const nau::math::NauFrustum& getFrustum(int cascade_no) const;
+        // The culling frustum of the cascade casters (see Settings::casterCullingExtension).
+        const nau::math::NauFrustum& getCasterCullingFrustum(int cascade_no) const;
         const nau::math::Vector3& getRenderCameraWorldViewPos(int cascade_no) const;
         const nau::math::Matrix4& getShadowViewItm(int cascade_no) const;
         const nau::math::Matrix4& getCameraRenderMatrix(int cascade_no) const;
@@ -6,6 +6,7 @@
 #include "graphics_assets/material_asset.h"
 #include "graphics_assets/shader_asset.h"
 #include "nau/assets/asset_ref.h"
+#include "nau/3d/dag_drv3dConsts.h"
 
 namespace nau::render
 {
@@ -20,6 +21,13 @@ namespace nau::render
 
         void setPanoramaTexture(ReloadableAssetView::Ptr panoramaTex);
 
+        /**
+         * Sets the cooked prefiltered cubemaps: they are read instead of the maps computed from the panorama.
+         * The runtime filtering stays the fallback (e.g. for the dynamic skies) when any of them is null.
+         */
+        void setPrefilteredMaps(ReloadableAssetView::Ptr irradianceMap, ReloadableAssetView::Ptr reflectionMap);
+        bool hasPrefilteredMaps() const;
+
         void renderSkybox(Texture* renderTargetHDR, Texture* sceneDepth, const nau::math::Matrix4& viewMatrix, const nau::math::Matrix4& projMatrix) const;
 
         void setEnvCubemapsDirty(bool value);
@@ -27,8 +35,9 @@ namespace nau::render
 
         void convertPanoramaToCubemap();
 
-        void generateIrradianceMap();
-        void generateReflectionMap();
+        // Compute only: can be dispatched on the async compute pipeline.
+        void generateIrradianceMap(GpuPipeline gpuPipeline = GpuPipeline::GRAPHICS);
+        void generateReflectionMap(GpuPipeline gpuPipeline = GpuPipeline::GRAPHICS);
 
         CubeTexture* getEnvCubemap() const;
 
@@ -37,6 +46,7 @@ namespace nau::render
 
     protected:
         void createSkyboxIndexBuffer();
+        static CubeTexture* getCubeTexture(const ReloadableAssetView::Ptr& textureView);
 
         bool m_envCubemapsDirty = true;
 
@@ -45,6 +55,8 @@ namespace nau::render
 
         TextureAssetView::Ptr m_panoramaTextureViewCached;
         ReloadableAssetView::Ptr m_panoramaTextureView;
+        ReloadableAssetView::Ptr m_prefilteredIrradianceView;
+        ReloadableAssetView::Ptr m_prefilteredReflectionView;
         d3d::SamplerHandle m_csTexSampler;
 
         ShaderAssetView::Ptr m_panoramaToCubemapCS;
@@ -55,9 +67,11 @@ namespace nau::render
         PROGRAM m_genIrradianceMapCSProgram;
         PROGRAM m_genReflectionMapCSProgram;
 
-        CubeTexture* m_envCubemapTexture;
-        CubeTexture* m_irradianceMap;
-        CubeTexture* m_reflectionMap;
+        // The runtime maps use a compact float format when the driver can write it; the filtered ones are created on the first use.
+        uint32_t m_cubemapsFormat = 0;
+        CubeTexture* m_envCubemapTexture = nullptr;
+        CubeTexture* m_irradianceMap = nullptr;
+        CubeTexture* m_reflectionMap = nullptr;
     };
 
 }  // namespace nau::render
\ No newline at end of file
@@ -0,0 +1,118 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <EASTL/array.h>
+#include <EASTL/functional.h>
+#include <EASTL/string.h>
+#include <EASTL/vector.h>
+
+#include <cstdint>
+
+namespace nau::render
+{
+    enum class GpuMemoryCategory : uint8_t
+    {
+        Textures,
+        RenderTargets,
+        Buffers,
+        UploadRings  ///< The driver upload and read back memory: the frame push ring, the upload rings, the temporary and persistent buffers.
+    };
+
+    inline constexpr size_t GpuMemoryCategoryCount = static_cast<size_t>(GpuMemoryCategory::UploadRings) + 1;
+
+    /**
+     * @brief How close the memory use of the pool is to the budget the OS gives the process (DXGI on DX12).
+     *
+     * Panic means the budget is exceeded or nearly exceeded: the OS starts to evict the resources of the process.
+     */
+    enum class GpuMemoryPressure : uint8_t
+    {
+        Panic,
+        High,
+        Medium,
+        Low
+    };
+
+    struct GpuMemoryPoolState
+    {
+        uint64_t budgetBytes = 0;
+        uint64_t usedBytes = 0;
+        uint64_t availableForReservationBytes = 0;
+        uint64_t physicalBytes = 0;  ///< 0 when unknown.
+        GpuMemoryPressure pressure = GpuMemoryPressure::Low;
+
+        /// The used part of the budget: above 1 the budget is exceeded.
+        float getBudgetUsage() const
+        {
+            return budgetBytes != 0 ? static_cast<float>(usedBytes) / static_cast<float>(budgetBytes) : 0.f;
+        }
+    };
+
+    struct GpuMemoryCategoryStats
+    {
+        uint64_t bytes = 0;
+        uint32_t objectsCount = 0;  ///< 0 for the upload rings.
+    };
+
+    /**
+     * @brief The GPU resource with its debug name.
+     */
+    struct GpuMemoryOwner
+    {
+        eastl::string name;
+        GpuMemoryCategory category = GpuMemoryCategory::Textures;
+        uint64_t bytes = 0;
+    };
+
+    struct GpuMemoryReport
+    {
+        /// False when the driver does not track its memory: the other fields are zero.
+        bool isAvailable = false;
+
+        GpuMemoryPoolState deviceLocal;
+        GpuMemoryPoolState hostLocal;
+
+        eastl::array<GpuMemoryCategoryStats, GpuMemoryCategoryCount> categories;
+
+        /// The heaps the driver places the resources in.
+        uint32_t heapsCount = 0;
+        uint64_t heapTotalBytes = 0;
+        uint64_t heapFreeBytes = 0;
+
+        /// The free memory of the heap scattered across the free ranges, in percents: 0 when it is a single range.
+        uint32_t maxHeapFragmentationPercent = 0;
+        uint32_t averageHeapFragmentationPercent = 0;
+
+        /// The largest resources first, empty unless requested (see getGpuMemoryReport()).
+        eastl::vector<GpuMemoryOwner> owners;
+    };
+
+    /**
+     * @brief Takes the snapshot of the video memory use from the driver.
+     *
+     * @param maxOwners The number of the largest resources listed in GpuMemoryReport::owners, 0 to skip the listing (it is not free).
+     *
+     * Can be called from any thread while the graphics is initialized.
+     */
+    NAU_GRAPHICS_EXPORT GpuMemoryReport getGpuMemoryReport(size_t maxOwners = 0);
+
+    /**
+     * @brief Called when the pressure of the device local (isDeviceLocal) or the host local memory pool changes.
+     *
+     * The handlers are called on the driver backend thread at the end of the frame: they must be short and must not call the driver.
+     */
+    using GpuMemoryBudgetHandler = eastl::function<void(bool isDeviceLocal, const GpuMemoryPoolState& state)>;
+
+    /**
+     * @brief Adds the handler of the memory pressure changes, returns the id to remove it with.
+     *
+     * The built-in handler is always active: under the device local pressure it updates the texture quota,
+     * limits the texture streaming budget and the texture residency budget (see IAssetResidencyManager), and restores them once the pressure is low.
+     */
+    NAU_GRAPHICS_EXPORT uint32_t addGpuMemoryBudgetHandler(GpuMemoryBudgetHandler handler);
+
+    NAU_GRAPHICS_EXPORT void removeGpuMemoryBudgetHandler(uint32_t handlerId);
+}  // namespace nau::render
@@ -0,0 +1,84 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <EASTL/string.h>
+#include <EASTL/vector.h>
+
+#include "graphics_assets/material_asset.h"
+#include "nau/3d/dag_drv3d.h"
+
+namespace nau::render
+{
+    /**
+     * The chain of the post effects of a window, composed into the fewest full-screen passes.
+     *
+     * The per-pixel effects of the same material are its stages (the "effectsMask" bits): the consecutive ones are fused into
+     * one pass, so the HDR target is read and written once for all of them. An effect reading the neighbour pixels breaks
+     * the fusion and runs as a pass of its own. Each pass is a render graph node: the passes but the last write intermediate
+     * targets, the last one writes the back buffer.
+     */
+    class NAU_GRAPHICS_EXPORT PostFxComposer
+    {
+    public:
+        // Must match the compute pipelines of the composition materials: one thread per pixel of a TileSize x TileSize tile.
+        static constexpr uint32_t TileSize = 8;
+
+        struct Effect
+        {
+            eastl::string name;
+            MaterialAssetView::Ptr material;
+            // The raster pipeline, the empty one binds the material default.
+            eastl::string pipeline;
+            // The compute pipeline of the fused passes writing an intermediate target, the empty one draws them.
+            eastl::string computePipeline;
+            // The bit of the effect in the "effectsMask" of the material, 0 for the effects that are not its stages.
+            uint32_t stageBit = 0;
+            bool readsNeighborhood = false;
+            bool isEnabled = true;
+        };
+
+        // The effects [firstEffect, firstEffect + effectsCount) drawn by a single pass.
+        struct Pass
+        {
+            uint32_t firstEffect = 0;
+            uint32_t effectsCount = 0;
+        };
+
+        // The effects are applied in the order they are added.
+        void addEffect(Effect effect);
+
+        /**
+         * The per-pixel stages are toggled within their pass, the other effects change the passes layout:
+         * the render graph nodes of the passes are registered again (see isLayoutChanged()).
+         */
+        void setEffectEnabled(eastl::string_view name, bool isEnabled);
+        bool isEffectEnabled(eastl::string_view name) const;
+
+        const eastl::vector<Pass>& getPasses() const;
+
+        // The pass is dispatched by tiles when it writes an intermediate target, see renderPass().
+        bool isComputePass(const Pass& pass) const;
+
+        bool isLayoutChanged() const;
+        void acceptLayout();
+
+        /**
+         * Renders the pass from the source. The null target is the bound render target: the pass is drawn.
+         * The fused passes with a compute pipeline are dispatched into the target by tiles.
+         */
+        void renderPass(const Pass& pass, BaseTexture* source, BaseTexture* target) const;
+
+    private:
+        static bool isStage(const Effect& effect);
+        bool canFuse(const Effect& previous, const Effect& next) const;
+        void buildPasses();
+
+        eastl::vector<Effect> m_effects;
+        eastl::vector<Pass> m_passes;
+        bool m_isLayoutChanged = true;
+    };
+
+}  // namespace nau::render
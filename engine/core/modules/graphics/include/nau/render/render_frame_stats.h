@@ -0,0 +1,74 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <EASTL/string.h>
+#include <EASTL/vector.h>
+
+#include <cstdint>
+
+namespace nau::render
+{
+    /**
+     * @brief The execution cost of the render graph node over the recently profiled frames, in milliseconds.
+     *
+     * The GPU values are negative when the driver provides no timestamps.
+     */
+    struct RenderNodeStats
+    {
+        eastl::string name;
+        float cpuAvgMs = 0.f;
+        float cpuMaxMs = 0.f;
+        float gpuAvgMs = -1.f;
+        float gpuMaxMs = -1.f;
+
+        /// The draws of the node (the render pass) in the newest profiled frame.
+        uint32_t drawCalls = 0;
+        uint32_t instances = 0;
+        uint64_t triangles = 0;
+    };
+
+    /**
+     * @brief The statistics of the last rendered frame, collected on the render thread after the present.
+     */
+    struct RenderFrameStats
+    {
+        uint64_t frameIndex = 0;
+
+        /// The CPU time of the frame render on the render thread, including the present.
+        float cpuRenderMs = 0.f;
+
+        /// The sum of the render graph nodes GPU time, negative when the node timings are off or not available.
+        float gpuFrameMs = -1.f;
+
+        /// The driver counters of the frame, zero when the driver does not count the draws.
+        uint32_t drawCalls = 0;
+        uint32_t instances = 0;
+        uint64_t triangles = 0;
+        uint32_t dispatches = 0;
+
+        /// The static mesh instances tested by the CPU culling of all the views (an instance is counted once per view) and the passed ones.
+        uint32_t testedInstances = 0;
+        uint32_t visibleInstances = 0;
+
+        uint32_t vramUsedKb = 0;
+        uint32_t vramBudgetKb = 0;
+
+        /// The render graph nodes in the execution order, empty when the node timings are off.
+        eastl::vector<RenderNodeStats> nodes;
+    };
+
+    /**
+     * @brief Requests the per node CPU and GPU timings of the render graph (the timestamp queries are not free).
+     *
+     * Can be called from any thread, the request is applied by the next rendered frame.
+     */
+    NAU_GRAPHICS_EXPORT void setRenderNodeTimingsEnabled(bool enabled);
+
+    /**
+     * @brief Retrieves the copy of the last rendered frame statistics. Can be called from any thread.
+     */
+    NAU_GRAPHICS_EXPORT RenderFrameStats getRenderFrameStats();
+}  // namespace nau::render
@@ -48,6 +48,8 @@ NameSpace root() { return {}; }
 
 void update_external_state(ExternalState state) { Runtime::get().updateExternalState(state); }
 
+GpuPipeline current_gpu_pipeline() { return Runtime::get().getCurrentGpuPipeline(); }
+
 void set_multiplexing_extents(multiplexing::Extents extents) { Runtime::get().setMultiplexingExtents(extents); }
 
 void run_nodes() { Runtime::get().runNodes(); }
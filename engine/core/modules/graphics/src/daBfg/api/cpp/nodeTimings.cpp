@@ -0,0 +1,22 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+
+// Copyright (C) 2024  Gaijin Games KFT.  All rights reserved
+
+#include "render/daBfg/nodeTimings.h"
+#include "dabfg/runtime/runtime.h"
+
+
+namespace dabfg
+{
+
+void set_node_timings_enabled(bool enabled) { Runtime::get().getNodeProfiler().setEnabled(enabled); }
+
+bool is_node_timings_enabled() { return Runtime::get().getNodeProfiler().isEnabled(); }
+
+eastl::vector<NodeTimings> get_node_timings()
+{
+  auto &runtime = Runtime::get();
+  return runtime.getNodeProfiler().getTimings(runtime.getInternalRegistry());
+}
+
+} // namespace dabfg
@@ -70,6 +70,18 @@ Registry Registry::executionHas(SideEffects sideEffect)
   return *this;
 }
 
+Registry Registry::executeAsyncCompute()
+{
+  registry->nodes[nodeId].asyncCompute = true;
+  return *this;
+}
+
+Registry Registry::prepareOnWorkerThread(PrepareCallback callback)
+{
+  registry->nodes[nodeId].prepare = eastl::move(callback);
+  return *this;
+}
+
 StateRequest Registry::requestState() { return {registry, nodeId}; }
 
 VirtualPassRequest Registry::requestRenderPass() { return {nodeId, registry}; }
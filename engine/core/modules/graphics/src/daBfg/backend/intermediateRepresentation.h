@@ -91,6 +91,9 @@ struct Node
 
   // Multiplexing iteration this node will be executed on
   MultiplexingIndex multiplexingIndex;
+
+  // Compute only node, submitted to the async compute queue when the driver supports it
+  bool asyncCompute;
 };
 
 struct ScheduledResource
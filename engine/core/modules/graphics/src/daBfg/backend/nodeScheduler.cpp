@@ -39,11 +39,17 @@ auto NodeScheduler::schedule(const intermediate::Graph &graph) -> NodePermutatio
   auto orderRange = IdRange<intermediate::NodeIndex>(graph.nodes.size());
   eastl::vector<intermediate::NodeIndex, nau::EastlFrameAllocator> dfsLaunchOrder(orderRange.begin(), orderRange.end());
 
+  // The async compute nodes go as early as possible: the more graphics work follows them,
+  // the more of it they overlap.
+  auto effectivePriority = [&graph](intermediate::NodeIndex i) {
+    return graph.nodes[i].asyncCompute ? PRIO_AS_EARLY_AS_POSSIBLE : graph.nodes[i].priority;
+  };
+
   // We can use the same lambda to order descending using .rbegin()/.rend().
-  auto orderComp = [&graph](intermediate::NodeIndex l, intermediate::NodeIndex r) {
+  auto orderComp = [&graph, &effectivePriority](intermediate::NodeIndex l, intermediate::NodeIndex r) {
     if (graph.nodes[l].multiplexingIndex != graph.nodes[r].multiplexingIndex)
       return graph.nodes[l].multiplexingIndex < graph.nodes[r].multiplexingIndex;
-    return graph.nodes[l].priority < graph.nodes[r].priority;
+    return effectivePriority(l) < effectivePriority(r);
   };
 
   eastl::sort(dfsLaunchOrder.begin(), dfsLaunchOrder.end(), orderComp);
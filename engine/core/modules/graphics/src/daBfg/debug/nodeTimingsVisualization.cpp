@@ -0,0 +1,84 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+
+// Copyright (C) 2024  Gaijin Games KFT.  All rights reserved
+
+#include "render/daBfg/nodeTimings.h"
+
+#include <EASTL/algorithm.h>
+#include "nau/gui/dag_imgui.h"
+#include <imgui.h>
+
+
+constexpr auto IMGUI_WINDOW_GROUP = "FRAMEGRAPH";
+constexpr auto IMGUI_NODE_TIMINGS_WINDOW = "Node Timings##FRAMEGRAPH-node-timings";
+
+// The frame budget of 60 fps: the nodes and the totals above it are highlighted.
+static float frame_budget_ms = 16.6f;
+
+static void timing_cell(float ms, float budget_ms)
+{
+  ImGui::TableNextColumn();
+  if (ms < 0.f)
+    ImGui::TextUnformatted("-");
+  else if (ms > budget_ms)
+    ImGui::TextColored(ImVec4(1.f, 0.3f, 0.3f, 1.f), "%.3f", ms);
+  else
+    ImGui::Text("%.3f", ms);
+}
+
+static void visualize_node_timings()
+{
+  bool enabled = dabfg::is_node_timings_enabled();
+  if (ImGui::Checkbox("Enabled", &enabled))
+    dabfg::set_node_timings_enabled(enabled);
+  ImGui::SameLine();
+  ImGui::SetNextItemWidth(100.f);
+  ImGui::InputFloat("Frame budget, ms", &frame_budget_ms, 0.f, 0.f, "%.1f");
+
+  const eastl::vector<dabfg::NodeTimings> timings = dabfg::get_node_timings();
+
+  float cpuTotal = 0.f, gpuTotal = 0.f;
+  for (const dabfg::NodeTimings &node : timings)
+  {
+    cpuTotal += node.cpuAvg;
+    gpuTotal += eastl::max(node.gpuAvg, 0.f);
+  }
+  const ImVec4 totalColor = eastl::max(cpuTotal, gpuTotal) > frame_budget_ms ? ImVec4(1.f, 0.3f, 0.3f, 1.f) : ImVec4(1.f, 1.f, 1.f, 1.f);
+  ImGui::TextColored(totalColor, "Average total: CPU %.3f ms, GPU %.3f ms", cpuTotal, gpuTotal);
+
+  if (!ImGui::BeginTable("NodeTimings", 8, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY))
+    return;
+
+  ImGui::TableSetupScrollFreeze(0, 1);
+  ImGui::TableSetupColumn("Node");
+  ImGui::TableSetupColumn("Frames");
+  ImGui::TableSetupColumn("CPU min");
+  ImGui::TableSetupColumn("CPU avg");
+  ImGui::TableSetupColumn("CPU max");
+  ImGui::TableSetupColumn("GPU min");
+  ImGui::TableSetupColumn("GPU avg");
+  ImGui::TableSetupColumn("GPU max");
+  ImGui::TableHeadersRow();
+
+  // A single node is highlighted when it takes a quarter of the frame budget alone.
+  const float nodeBudgetMs = frame_budget_ms * 0.25f;
+  for (const dabfg::NodeTimings &node : timings)
+  {
+    ImGui::TableNextRow();
+    ImGui::TableNextColumn();
+    ImGui::TextUnformatted(node.name.c_str());
+    ImGui::TableNextColumn();
+    ImGui::Text("%u", node.framesCount);
+
+    timing_cell(node.cpuMin, nodeBudgetMs);
+    timing_cell(node.cpuAvg, nodeBudgetMs);
+    timing_cell(node.cpuMax, nodeBudgetMs);
+    timing_cell(node.gpuMin, nodeBudgetMs);
+    timing_cell(node.gpuAvg, nodeBudgetMs);
+    timing_cell(node.gpuMax, nodeBudgetMs);
+  }
+
+  ImGui::EndTable();
+}
+
+REGISTER_IMGUI_WINDOW(IMGUI_WINDOW_GROUP, IMGUI_NODE_TIMINGS_WINDOW, visualize_node_timings);
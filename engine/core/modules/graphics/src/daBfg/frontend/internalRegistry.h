@@ -102,13 +102,18 @@ struct NodeData
   priority_t priority = PRIO_DEFAULT;
   multiplexing::Mode multiplexingMode = multiplexing::Mode::FullMultiplex;
   SideEffects sideEffect = SideEffects::Internal;
-  // For debug purposes only
+  // Compute only node that may run on the async compute queue
+  bool asyncCompute = false;
+  // Only the execution is skipped for a disabled node: it is scheduled
+  // as usual, so toggling it never triggers a recompilation.
   bool enabled = true;
 
   // Keeps track of how many times the node was recreated
   uint16_t generation{0};
   detail::DeclarationCallback declare;
   detail::ExecutionCallback execute;
+  // CPU only work executed on a worker thread before the node is executed
+  Registry::PrepareCallback prepare;
 
   dag::FixedVectorSet<NodeNameId, 4> precedingNodeIds;
   dag::FixedVectorSet<NodeNameId, 4> followingNodeIds;
@@ -670,6 +670,7 @@ eastl::pair<intermediate::Graph, intermediate::Mapping> IrGraphBuilder::createDi
         mapping.mapNode(nodeId, irMultiplexingIndex) = idx;
         irNode.frontendNode = nodeId;
         irNode.priority = nodeData.priority;
+        irNode.asyncCompute = nodeData.asyncCompute;
         irNode.multiplexingIndex = irMultiplexingIndex;
 
 
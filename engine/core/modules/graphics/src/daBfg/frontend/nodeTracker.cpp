@@ -122,6 +122,7 @@ void NodeTracker::updateNodeDeclarations()
     {
       // Reset the value first to avoid funny side-effects later on
       registry.nodes[nodeId].execute = {};
+      registry.nodes[nodeId].prepare = {};
       registry.nodes[nodeId].execute = declare(nodeId, &registry);
     }
 
@@ -10,6 +10,12 @@
 #include "nau/math/dag_color.h"
 #include "nau/diag/logging.h"
 #include "nau/utils/span.h"
+#include "nau/utils/performance_profiling.h"
+#include <EASTL/algorithm.h>
+#include <EASTL/bitvector.h>
+#include <EASTL/optional.h>
+#include <EASTL/vector_map.h>
+#include <string.h>
 
 
 namespace dabfg
@@ -53,6 +59,22 @@ void populate_resource_provider(ResourceProvider &provider, // passed by ref to
     processRes(resId, true, req.optional);
 }
 
+struct NodeExecutor::FrameState
+{
+  int prevFrame;
+  int currFrame;
+  multiplexing::Extents multiplexingExtents;
+  const ResourceScheduler::FrameEventsRef &events;
+  const sd::NodeStateDeltas &stateDeltas;
+
+  // The runs of the async compute nodes wait on the graphics work submitted before them, the graphics queue
+  // waits on the run only before the first node that depends on it (or at the end of the frame).
+  bool hasAsyncCompute;
+  bool isAsyncRunOpen = false;
+  GPUFENCEHANDLE computeFence = BAD_GPUFENCEHANDLE;
+  eastl::bitvector<nau::EastlFrameAllocator> awaitedAsyncNodes;
+};
+
 void NodeExecutor::execute(int prev_frame, int curr_frame, multiplexing::Extents multiplexing_extents,
   const ResourceScheduler::FrameEventsRef &events, const sd::NodeStateDeltas &state_deltas)
 {
@@ -61,45 +83,38 @@ void NodeExecutor::execute(int prev_frame, int curr_frame, multiplexing::Extents
     if (auto resolvedId = nameResolver.resolve(unresolvedId); resolvedId != AutoResTypeNameId::Invalid)
       resolution = registry.autoResTypes[resolvedId].dynamicResolution;
 
-  for (auto i : IdRange<intermediate::NodeIndex>(graph.nodes.size()))
+  if (eastl::exchange(jobsDirty, false))
+    rebuildJobs();
+
+  profiler.beginFrame();
+
+  const bool hasAsyncCompute = d3d::get_driver_desc().caps.hasAsyncCompute;
+  FrameState frame{prev_frame, curr_frame, multiplexing_extents, events, state_deltas, hasAsyncCompute};
+  frame.awaitedAsyncNodes.resize(hasAsyncCompute ? graph.nodes.size() : 0, false);
+
+  if (jobs.getJobsCount() > 0)
   {
-    const intermediate::Node &irNode = graph.nodes[i];
-    processEvents(events[i]);
-
-    const multiplexing::Index multiIdx = multiplexing_index_from_ir(irNode.multiplexingIndex, multiplexing_extents);
-    gatherExternalResources(irNode.frontendNode, irNode.multiplexingIndex, multiIdx, graph.resources);
-    populate_resource_provider(
-      currentlyProvidedResources, registry, nameResolver, irNode.frontendNode,
-      [this, prev_frame, curr_frame, multiIndex = irNode.multiplexingIndex](bool history, ResNameId res_id) -> ManagedTexView {
-        return getManagedTexView(res_id, history ? prev_frame : curr_frame, multiIndex);
-      },
-      [this, prev_frame, curr_frame, multiIndex = irNode.multiplexingIndex](bool history, ResNameId res_id) -> ManagedBufView {
-        return getManagedBufView(res_id, history ? prev_frame : curr_frame, multiIndex);
-      },
-      [this, prev_frame, curr_frame, multiIndex = irNode.multiplexingIndex](bool history, ResNameId res_id) -> BlobView {
-        return getBlobView(res_id, history ? prev_frame : curr_frame, multiIndex);
-      });
-
-
-    validation_set_current_node(registry, irNode.frontendNode);
-    applyState(state_deltas[i], curr_frame, prev_frame);
-    if (const auto &node = registry.nodes[irNode.frontendNode]; node.enabled && node.sideEffect != SideEffects::None)
-    {
-      {
-        //TIME_D3D_PROFILE_NAME(FramegraphNode, registry.knownNames.getName(irNode.frontendNode));
+    // The nodes are still executed by this thread in the graph order, the prepared nodes are only awaited.
+    currentFrame = &frame;
+    jobs.run();
+    currentFrame = nullptr;
+  }
+  else
+  {
+    for (auto i : IdRange<intermediate::NodeIndex>(graph.nodes.size()))
+      executeNode(i, frame);
+  }
 
-        if (auto &exec = registry.nodes[irNode.frontendNode].execute)
-          exec(multiIdx);
-        else
-          NAU_LOG_ERROR("Somehow, a node with an empty execution callback was "
-                 "attempted to be executed. This is a bug in framegraph!");
-      }
-      validate_global_state(registry, irNode.frontendNode);
-    }
-    validation_set_current_node(registry, NodeNameId::Invalid);
+  currentGpuPipeline = GpuPipeline::GRAPHICS;
+  profiler.endFrame();
 
-    // Clean up resource references inside the provider, just in case
-    currentlyProvidedResources.clear();
+  if (frame.isAsyncRunOpen)
+  {
+    frame.computeFence = d3d::insert_fence(GpuPipeline::ASYNC_COMPUTE);
+  }
+  if (frame.computeFence != BAD_GPUFENCEHANDLE)
+  {
+    d3d::insert_wait_on_fence(frame.computeFence, GpuPipeline::GRAPHICS);
   }
 
   if(!events.empty()) // events could be empty if no graph nodes present
@@ -115,6 +130,145 @@ void NodeExecutor::execute(int prev_frame, int curr_frame, multiplexing::Extents
   validation_of_external_resources_duplication(graph.resources, graph.resourceNames);
 }
 
+void NodeExecutor::rebuildJobs()
+{
+  jobs.clear();
+
+  const bool hasPreparedNodes = eastl::any_of(graph.nodes.begin(), graph.nodes.end(),
+    [this](const intermediate::Node &irNode) { return static_cast<bool>(registry.nodes[irNode.frontendNode].prepare); });
+  if (!hasPreparedNodes)
+    return;
+
+  // Every node gets the preparation job (a no-op for most of them) to keep the dependencies
+  // between the prepared nodes transitive through the nodes that are not prepared.
+  eastl::vector<nau::async::JobGraph::JobId> prepareJobs;
+  prepareJobs.reserve(graph.nodes.size());
+  for (auto i : IdRange<intermediate::NodeIndex>(graph.nodes.size()))
+    prepareJobs.push_back(jobs.addJob([this, i] { prepareNode(i, *currentFrame); }));
+
+  // The multiplexed instances of the node share its callback: they are prepared one after another.
+  eastl::vector_map<NodeNameId, nau::async::JobGraph::JobId> lastPrepareJobs;
+  eastl::optional<nau::async::JobGraph::JobId> prevExecuteJob;
+  for (auto i : IdRange<intermediate::NodeIndex>(graph.nodes.size()))
+  {
+    const intermediate::Node &irNode = graph.nodes[i];
+    const auto prepareJob = prepareJobs[eastl::to_underlying(i)];
+
+    for (const intermediate::NodeIndex pred : irNode.predecessors)
+      jobs.addDependency(prepareJob, prepareJobs[eastl::to_underlying(pred)]);
+
+    if (auto [it, inserted] = lastPrepareJobs.emplace(irNode.frontendNode, prepareJob); !inserted)
+      jobs.addDependency(prepareJob, eastl::exchange(it->second, prepareJob));
+
+    const auto executeJob = jobs.addJob([this, i] { executeNode(i, *currentFrame); }, true);
+    jobs.addDependency(executeJob, prepareJob);
+    if (prevExecuteJob)
+      jobs.addDependency(executeJob, *prevExecuteJob);
+    prevExecuteJob = executeJob;
+  }
+}
+
+void NodeExecutor::prepareNode(intermediate::NodeIndex node_idx, const FrameState &frame)
+{
+  const intermediate::Node &irNode = graph.nodes[node_idx];
+  auto &node = registry.nodes[irNode.frontendNode];
+  if (!node.prepare || !node.enabled || node.sideEffect == SideEffects::None)
+    return;
+
+  NAU_CPU_SCOPED_TAG_NAME("FramegraphNodePrepare", nau::PerfTag::Render);
+#if NAU_PROFILING_ENABLED
+  const char *nodeName = registry.knownNames.getName(irNode.frontendNode);
+  NAU_CPU_SCOPED_TAG_TEXT(nodeName, strlen(nodeName));
+#endif
+
+  node.prepare(multiplexing_index_from_ir(irNode.multiplexingIndex, frame.multiplexingExtents));
+}
+
+void NodeExecutor::executeNode(intermediate::NodeIndex node_idx, FrameState &frame)
+{
+  const intermediate::Node &irNode = graph.nodes[node_idx];
+  processEvents(frame.events[node_idx]);
+
+  if (frame.hasAsyncCompute && irNode.asyncCompute)
+  {
+    if (!frame.isAsyncRunOpen)
+    {
+      GPUFENCEHANDLE graphicsFence = d3d::insert_fence(GpuPipeline::GRAPHICS);
+      d3d::insert_wait_on_fence(graphicsFence, GpuPipeline::ASYNC_COMPUTE);
+      frame.isAsyncRunOpen = true;
+    }
+    frame.awaitedAsyncNodes.set(eastl::to_underlying(node_idx), true);
+  }
+  else if (frame.hasAsyncCompute)
+  {
+    if (frame.isAsyncRunOpen)
+    {
+      frame.computeFence = d3d::insert_fence(GpuPipeline::ASYNC_COMPUTE);
+      frame.isAsyncRunOpen = false;
+    }
+
+    const bool dependsOnAsync = eastl::any_of(irNode.predecessors.begin(), irNode.predecessors.end(),
+      [&frame](intermediate::NodeIndex pred) { return frame.awaitedAsyncNodes.test(eastl::to_underlying(pred), false); });
+    if (frame.computeFence != BAD_GPUFENCEHANDLE && dependsOnAsync)
+    {
+      d3d::insert_wait_on_fence(frame.computeFence, GpuPipeline::GRAPHICS);
+      frame.computeFence = BAD_GPUFENCEHANDLE;
+      frame.awaitedAsyncNodes.clear();
+      frame.awaitedAsyncNodes.resize(graph.nodes.size(), false);
+    }
+  }
+  currentGpuPipeline = frame.hasAsyncCompute && irNode.asyncCompute ? GpuPipeline::ASYNC_COMPUTE : GpuPipeline::GRAPHICS;
+
+  const int prev_frame = frame.prevFrame;
+  const int curr_frame = frame.currFrame;
+  const multiplexing::Index multiIdx = multiplexing_index_from_ir(irNode.multiplexingIndex, frame.multiplexingExtents);
+  gatherExternalResources(irNode.frontendNode, irNode.multiplexingIndex, multiIdx, graph.resources);
+  populate_resource_provider(
+    currentlyProvidedResources, registry, nameResolver, irNode.frontendNode,
+    [this, prev_frame, curr_frame, multiIndex = irNode.multiplexingIndex](bool history, ResNameId res_id) -> ManagedTexView {
+      return getManagedTexView(res_id, history ? prev_frame : curr_frame, multiIndex);
+    },
+    [this, prev_frame, curr_frame, multiIndex = irNode.multiplexingIndex](bool history, ResNameId res_id) -> ManagedBufView {
+      return getManagedBufView(res_id, history ? prev_frame : curr_frame, multiIndex);
+    },
+    [this, prev_frame, curr_frame, multiIndex = irNode.multiplexingIndex](bool history, ResNameId res_id) -> BlobView {
+      return getBlobView(res_id, history ? prev_frame : curr_frame, multiIndex);
+    });
+
+
+  validation_set_current_node(registry, irNode.frontendNode);
+  applyState(frame.stateDeltas[node_idx], curr_frame, prev_frame);
+  if (const auto &node = registry.nodes[irNode.frontendNode]; node.enabled && node.sideEffect != SideEffects::None)
+  {
+    {
+      NAU_CPU_SCOPED_TAG_NAME("FramegraphNode", nau::PerfTag::Render);
+#if NAU_PROFILING_ENABLED
+      // Same name is used for the GPU zone: the driver turns debug events into the profiler GPU zones.
+      const char *nodeName = registry.knownNames.getName(irNode.frontendNode);
+      NAU_CPU_SCOPED_TAG_TEXT(nodeName, strlen(nodeName));
+      d3d::beginEvent(nodeName);
+#endif
+
+      profiler.beginNode(irNode.frontendNode);
+      if (auto &exec = registry.nodes[irNode.frontendNode].execute)
+        exec(multiIdx);
+      else
+        NAU_LOG_ERROR("Somehow, a node with an empty execution callback was "
+               "attempted to be executed. This is a bug in framegraph!");
+      profiler.endNode();
+
+#if NAU_PROFILING_ENABLED
+      d3d::endEvent();
+#endif
+    }
+    validate_global_state(registry, irNode.frontendNode);
+  }
+  validation_set_current_node(registry, NodeNameId::Invalid);
+
+  // Clean up resource references inside the provider, just in case
+  currentlyProvidedResources.clear();
+}
+
 void NodeExecutor::gatherExternalResources(NodeNameId nameId, intermediate::MultiplexingIndex ir_multi_idx,
   multiplexing::Index multi_idx, IdIndexedMapping<intermediate::ResourceIndex, intermediate::Resource> &resources)
 {
@@ -5,12 +5,15 @@
 
 #include "render/daBfg/detail/nodeNameId.h"
 #include "render/daBfg/multiplexing.h"
+#include "nau/3d/dag_drv3dConsts.h"
+#include "nau/async/job_graph.h"
 
 #include "dabfg/frontend/internalRegistry.h"
 #include "dabfg/frontend/nameResolver.h"
 #include "dabfg/backend/intermediateRepresentation.h"
 #include "dabfg/backend/resourceScheduling/resourceScheduler.h"
 #include "dabfg/backend/nodeStateDeltas.h"
+#include "dabfg/runtime/nodeProfiler.h"
 
 
 namespace dabfg
@@ -20,16 +23,27 @@ class NodeExecutor
 {
 public:
   NodeExecutor(ResourceScheduler &rs, intermediate::Graph &g, const intermediate::Mapping &m, InternalRegistry &reg,
-    const NameResolver &res, ResourceProvider &rp) :
-    resourceScheduler{rs}, graph{g}, mapping{m}, registry{reg}, nameResolver{res}, currentlyProvidedResources{rp}
+    const NameResolver &res, ResourceProvider &rp, NodeProfiler &np) :
+    resourceScheduler{rs}, graph{g}, mapping{m}, registry{reg}, nameResolver{res}, currentlyProvidedResources{rp}, profiler{np}
   {}
 
   void execute(int prev_frame, int curr_frame, multiplexing::Extents multiplexing_extents,
     const ResourceScheduler::FrameEventsRef &events, const sd::NodeStateDeltas &state_deltas);
 
+  GpuPipeline getCurrentGpuPipeline() const { return currentGpuPipeline; }
+
+  // Must be called when the IR graph is rescheduled: the preparation jobs follow its order and dependencies.
+  void invalidateJobs() { jobsDirty = true; }
+
   ExternalState externalState;
 
 private:
+  struct FrameState;
+
+  void rebuildJobs();
+  void prepareNode(intermediate::NodeIndex node_idx, const FrameState &frame);
+  void executeNode(intermediate::NodeIndex node_idx, FrameState &frame);
+
   void gatherExternalResources(NodeNameId nameId, intermediate::MultiplexingIndex ir_multi_idx, multiplexing::Index multi_idx,
     IdIndexedMapping<intermediate::ResourceIndex, intermediate::Resource> &resources);
 
@@ -59,6 +73,14 @@ private:
   InternalRegistry &registry;
   const NameResolver &nameResolver;
   ResourceProvider &currentlyProvidedResources;
+  NodeProfiler &profiler;
+
+  GpuPipeline currentGpuPipeline = GpuPipeline::GRAPHICS;
+
+  // The preparation of the nodes (see Registry::prepareOnWorkerThread) and their execution, empty when no node is prepared.
+  nau::async::JobGraph jobs;
+  bool jobsDirty = true;
+  FrameState *currentFrame = nullptr;
 };
 
 } // namespace dabfg
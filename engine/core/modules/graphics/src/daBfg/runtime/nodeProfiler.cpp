@@ -0,0 +1,176 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+
+// Copyright (C) 2024  Gaijin Games KFT.  All rights reserved
+
+#include "nodeProfiler.h"
+
+#include <EASTL/vector_map.h>
+#include "dabfg/frontend/internalRegistry.h"
+#include "nau/3d/dag_drv3d.h"
+#include "nau/3d/dag_drv3dCmd.h"
+#include "nau/perfMon/dag_cpuFreq.h"
+
+
+namespace dabfg
+{
+
+NodeProfiler::~NodeProfiler() { releaseQueries(); }
+
+void NodeProfiler::setEnabled(bool value)
+{
+  if (enabled == value)
+    return;
+
+  enabled = value;
+  if (!enabled)
+    releaseQueries();
+}
+
+void NodeProfiler::beginFrame()
+{
+  if (!enabled)
+    return;
+
+  if (gpuFrequency == 0)
+    d3d::driver_command(D3V3D_COMMAND_TIMESTAMPFREQ, &gpuFrequency, nullptr, nullptr);
+
+  QueryFrame &frame = queryFrames[queryFrameIndex];
+  if (frame.pending)
+    resolve(frame);
+  frame.samples.clear();
+}
+
+void NodeProfiler::beginNode(NodeNameId node)
+{
+  if (!enabled)
+    return;
+
+  QueryFrame &frame = queryFrames[queryFrameIndex];
+  frame.samples.push_back({node});
+  if (frame.queries.size() < frame.samples.size())
+    frame.queries.emplace_back();
+
+  d3d::driver_command(D3V3D_COMMAND_TIMESTAMPISSUE, &frame.queries[frame.samples.size() - 1].begin, nullptr, nullptr);
+  if (!d3d::driver_command(DRV3D_COMMAND_GET_CURRENT_DRAW_STATS, &nodeStartDraws, nullptr, nullptr))
+    nodeStartDraws = {};
+  nodeStartTicks = ref_time_ticks();
+}
+
+void NodeProfiler::endNode()
+{
+  if (!enabled)
+    return;
+
+  QueryFrame &frame = queryFrames[queryFrameIndex];
+  NAU_ASSERT(!frame.samples.empty());
+  NodeSample &sample = frame.samples.back();
+  sample.cpuMs = ref_time_delta_to_usec(ref_time_ticks() - nodeStartTicks) * 1e-3f;
+
+  Drv3dDrawStats draws{};
+  if (d3d::driver_command(DRV3D_COMMAND_GET_CURRENT_DRAW_STATS, &draws, nullptr, nullptr))
+  {
+    sample.drawCalls = draws.drawCalls - nodeStartDraws.drawCalls;
+    sample.instances = draws.instances - nodeStartDraws.instances;
+    sample.triangles = draws.triangles - nodeStartDraws.triangles;
+  }
+  d3d::driver_command(D3V3D_COMMAND_TIMESTAMPISSUE, &frame.queries[frame.samples.size() - 1].end, nullptr, nullptr);
+}
+
+void NodeProfiler::endFrame()
+{
+  if (!enabled)
+    return;
+
+  queryFrames[queryFrameIndex].pending = true;
+  queryFrameIndex = (queryFrameIndex + 1) % QUERY_FRAMES;
+}
+
+void NodeProfiler::resolve(QueryFrame &frame)
+{
+  // The queries not ready after QUERY_FRAMES frames are dropped: the frame gets no GPU timings.
+  for (size_t i = 0; i < frame.samples.size(); ++i)
+  {
+    uint64_t begin = 0, end = 0;
+    const QueryPair &queries = frame.queries[i];
+    if (gpuFrequency != 0 && d3d::driver_command(D3V3D_COMMAND_TIMESTAMPGET, queries.begin, &begin, nullptr) &&
+        d3d::driver_command(D3V3D_COMMAND_TIMESTAMPGET, queries.end, &end, nullptr) && end >= begin)
+      frame.samples[i].gpuMs = float(double(end - begin) * 1000.0 / double(gpuFrequency));
+  }
+
+  history[historyFrameIndex] = frame.samples;
+  historyFrameIndex = (historyFrameIndex + 1) % HISTORY_FRAMES;
+  frame.pending = false;
+}
+
+void NodeProfiler::releaseQueries()
+{
+  for (QueryFrame &frame : queryFrames)
+  {
+    for (QueryPair &queries : frame.queries)
+    {
+      d3d::driver_command(DRV3D_COMMAND_RELEASE_QUERY, &queries.begin, nullptr, nullptr);
+      d3d::driver_command(DRV3D_COMMAND_RELEASE_QUERY, &queries.end, nullptr, nullptr);
+    }
+    frame.queries.clear();
+    frame.samples.clear();
+    frame.pending = false;
+  }
+}
+
+eastl::vector<NodeTimings> NodeProfiler::getTimings(const InternalRegistry &registry) const
+{
+  struct Accumulated
+  {
+    uint32_t index;
+    uint32_t gpuFramesCount;
+    float gpuSum;
+    float cpuSum;
+  };
+  eastl::vector_map<NodeNameId, Accumulated> accumulated;
+  eastl::vector<NodeTimings> result;
+
+  // From the newest frame: the nodes are listed in its execution order.
+  for (uint32_t age = 1; age <= HISTORY_FRAMES; ++age)
+  {
+    for (const NodeSample &sample : history[(historyFrameIndex + HISTORY_FRAMES - age) % HISTORY_FRAMES])
+    {
+      auto [it, inserted] = accumulated.insert({sample.node, {uint32_t(result.size()), 0, 0.f, 0.f}});
+      if (inserted)
+      {
+        NodeTimings &timings = result.emplace_back();
+        timings.name = registry.knownNames.getName(sample.node);
+        timings.cpuMin = sample.cpuMs;
+        timings.cpuMax = sample.cpuMs;
+        timings.drawCalls = sample.drawCalls;
+        timings.instances = sample.instances;
+        timings.triangles = sample.triangles;
+      }
+
+      NodeTimings &timings = result[it->second.index];
+      ++timings.framesCount;
+      it->second.cpuSum += sample.cpuMs;
+      timings.cpuMin = eastl::min(timings.cpuMin, sample.cpuMs);
+      timings.cpuMax = eastl::max(timings.cpuMax, sample.cpuMs);
+
+      if (sample.gpuMs >= 0.f)
+      {
+        timings.gpuMin = it->second.gpuFramesCount == 0 ? sample.gpuMs : eastl::min(timings.gpuMin, sample.gpuMs);
+        timings.gpuMax = eastl::max(timings.gpuMax, sample.gpuMs);
+        it->second.gpuSum += sample.gpuMs;
+        ++it->second.gpuFramesCount;
+      }
+    }
+  }
+
+  for (const auto &[node, acc] : accumulated)
+  {
+    NodeTimings &timings = result[acc.index];
+    timings.cpuAvg = acc.cpuSum / float(timings.framesCount);
+    if (acc.gpuFramesCount > 0)
+      timings.gpuAvg = acc.gpuSum / float(acc.gpuFramesCount);
+  }
+
+  return result;
+}
+
+} // namespace dabfg
@@ -0,0 +1,84 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+
+// Copyright (C) 2024  Gaijin Games KFT.  All rights reserved
+#pragma once
+
+#include <EASTL/array.h>
+#include <EASTL/vector.h>
+#include "render/daBfg/detail/nodeNameId.h"
+#include "render/daBfg/nodeTimings.h"
+#include "nau/3d/dag_drv3dCmd.h"
+
+
+namespace dabfg
+{
+
+struct InternalRegistry;
+
+// Measures the CPU time and the GPU time (with timestamp queries) of every executed node.
+// The queries of a frame are read back QUERY_FRAMES later, the resolved frames are kept in a ring
+// of HISTORY_FRAMES for the min/avg/max statistics.
+class NodeProfiler
+{
+public:
+  static constexpr uint32_t QUERY_FRAMES = 4;
+  static constexpr uint32_t HISTORY_FRAMES = 64;
+
+  NodeProfiler() = default;
+  ~NodeProfiler();
+
+  NodeProfiler(const NodeProfiler &) = delete;
+  NodeProfiler &operator=(const NodeProfiler &) = delete;
+
+  void setEnabled(bool enabled);
+  bool isEnabled() const { return enabled; }
+
+  void beginFrame();
+  void beginNode(NodeNameId node);
+  void endNode();
+  void endFrame();
+
+  eastl::vector<NodeTimings> getTimings(const InternalRegistry &registry) const;
+
+private:
+  struct NodeSample
+  {
+    NodeNameId node = NodeNameId::Invalid;
+    float cpuMs = 0.f;
+    float gpuMs = -1.f;
+    uint32_t drawCalls = 0;
+    uint32_t instances = 0;
+    uint64_t triangles = 0;
+  };
+
+  struct QueryPair
+  {
+    void *begin = nullptr;
+    void *end = nullptr;
+  };
+
+  struct QueryFrame
+  {
+    eastl::vector<NodeSample> samples;
+    // Pooled: the queries of the frame slot are reissued when it's reused.
+    eastl::vector<QueryPair> queries;
+    bool pending = false;
+  };
+
+  void resolve(QueryFrame &frame);
+  void releaseQueries();
+
+  bool enabled = false;
+  uint64_t gpuFrequency = 0;
+  int64_t nodeStartTicks = 0;
+  // The driver draw counters at the node start: the node draws are the difference at its end.
+  Drv3dDrawStats nodeStartDraws{};
+
+  uint32_t queryFrameIndex = 0;
+  eastl::array<QueryFrame, QUERY_FRAMES> queryFrames;
+
+  uint32_t historyFrameIndex = 0;
+  eastl::array<eastl::vector<NodeSample>, HISTORY_FRAMES> history;
+};
+
+} // namespace dabfg
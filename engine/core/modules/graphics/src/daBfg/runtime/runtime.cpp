@@ -17,6 +17,7 @@
 #include "dabfg/common/resourceUsage.h"
 #include "dabfg/id/idRange.h"
 #include "nau/diag/logging.h"
+#include "nau/utils/performance_profiling.h"
 
 
 #if _TARGET_D3D_MULTI || _TARGET_C1 || _TARGET_C2
@@ -48,7 +49,7 @@ Runtime::Runtime()
   else
     resourceScheduler.reset(new PoolResourceScheduler(nodeTracker));
 
-  nodeExec.emplace(*resourceScheduler, intermediateGraph, irMapping, registry, nameResolver, currentlyProvidedResources);
+  nodeExec.emplace(*resourceScheduler, intermediateGraph, irMapping, registry, nameResolver, currentlyProvidedResources, nodeProfiler);
 }
 
 Runtime::~Runtime()
@@ -104,6 +105,7 @@ void Runtime::scheduleNodes()
   }
 
   irMapping = intermediateGraph.calculateMapping();
+  nodeExec->invalidateJobs();
 
   if (debug_graph_generation)
   {
@@ -305,7 +307,7 @@ void Runtime::setMultiplexingExtents(multiplexing::Extents extents)
 
 void Runtime::runNodes()
 {
-  //TIME_D3D_PROFILE(ExecuteFrameGraph);
+  NAU_CPU_SCOPED_TAG_NAME("ExecuteFrameGraph", nau::PerfTag::Render);
   std::lock_guard<NodeTracker> lock(nodeTracker);
 
   if (nodeTracker.acquireNodesChanged())
@@ -20,6 +20,7 @@
 #include "dabfg/backend/intermediateRepresentation.h"
 
 #include "dabfg/runtime/nodeExecutor.h"
+#include "dabfg/runtime/nodeProfiler.h"
 #include "dabfg/runtime/compilationStage.h"
 
 
@@ -49,7 +50,9 @@ public:
 
   NodeTracker &getNodeTracker() { return nodeTracker; }
   InternalRegistry &getInternalRegistry() { return registry; }
+  NodeProfiler &getNodeProfiler() { return nodeProfiler; }
   void updateExternalState(ExternalState state) { nodeExec->externalState = state; }
+  GpuPipeline getCurrentGpuPipeline() const { return nodeExec ? nodeExec->getCurrentGpuPipeline() : GpuPipeline::GRAPHICS; }
   void setMultiplexingExtents(multiplexing::Extents extents);
   void runNodes();
 
@@ -100,6 +103,8 @@ private:
   sd::NodeStateDeltas perNodeStateDeltas;
   ResourceScheduler::EventsCollectionRef allResourceEvents;
 
+  NodeProfiler nodeProfiler;
+
   // Deferred init
   eastl::optional<NodeExecutor> nodeExec;
 
@@ -0,0 +1,129 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "dynamic_resolution.h"
+
+#include <EASTL/algorithm.h>
+
+#include <cmath>
+
+#include "nau/3d/dag_drv3d.h"
+#include "nau/3d/dag_drv3dCmd.h"
+#include "nau/app/global_properties.h"
+#include "nau/service/service_provider.h"
+
+namespace nau::render
+{
+    namespace
+    {
+        // The time is kept between the target and its part: the scale is not raised back at once after it is lowered.
+        constexpr float RaiseThreshold = 0.85f;
+        constexpr float SmoothingFactor = 0.1f;
+    }  // namespace
+
+    DynamicResolution::DynamicResolution()
+    {
+        if (getServiceProvider().has<GlobalProperties>())
+        {
+            auto& properties = getServiceProvider().get<GlobalProperties>();
+            m_isEnabled = properties.getValue<bool>("/graphics/dynamicResolution/enabled").value_or(false);
+            m_targetMs = properties.getValue<float>("/graphics/dynamicResolution/targetMs").value_or(m_targetMs);
+            m_minScale = properties.getValue<float>("/graphics/dynamicResolution/minScale").value_or(m_minScale);
+            m_maxScale = properties.getValue<float>("/graphics/dynamicResolution/maxScale").value_or(m_maxScale);
+        }
+
+        m_maxScale = eastl::clamp(m_maxScale, ScaleStep, 1.f);
+        m_minScale = eastl::clamp(m_minScale, ScaleStep, m_maxScale);
+        m_scale = m_maxScale;
+        m_isEnabled = m_isEnabled && m_targetMs > 0.f;
+    }
+
+    DynamicResolution::~DynamicResolution()
+    {
+        for (QueryFrame& frame : m_queryFrames)
+        {
+            d3d::driver_command(DRV3D_COMMAND_RELEASE_QUERY, &frame.begin, nullptr, nullptr);
+            d3d::driver_command(DRV3D_COMMAND_RELEASE_QUERY, &frame.end, nullptr, nullptr);
+        }
+    }
+
+    void DynamicResolution::beginFrame()
+    {
+        if (!m_isEnabled)
+        {
+            return;
+        }
+
+        if (m_gpuFrequency == 0)
+        {
+            d3d::driver_command(D3V3D_COMMAND_TIMESTAMPFREQ, &m_gpuFrequency, nullptr, nullptr);
+        }
+
+        QueryFrame& frame = m_queryFrames[m_queryFrameIndex];
+        if (frame.isPending)
+        {
+            resolve(frame);
+        }
+
+        d3d::driver_command(D3V3D_COMMAND_TIMESTAMPISSUE, &frame.begin, nullptr, nullptr);
+    }
+
+    void DynamicResolution::endFrame()
+    {
+        if (!m_isEnabled)
+        {
+            return;
+        }
+
+        QueryFrame& frame = m_queryFrames[m_queryFrameIndex];
+        d3d::driver_command(D3V3D_COMMAND_TIMESTAMPISSUE, &frame.end, nullptr, nullptr);
+        frame.isPending = true;
+        m_queryFrameIndex = (m_queryFrameIndex + 1) % QueryFrames;
+    }
+
+    void DynamicResolution::resolve(QueryFrame& frame)
+    {
+        frame.isPending = false;
+
+        // The queries not ready after QueryFrames frames are dropped: the controller waits for the next ones.
+        uint64_t begin = 0, end = 0;
+        if (m_gpuFrequency == 0 || !d3d::driver_command(D3V3D_COMMAND_TIMESTAMPGET, frame.begin, &begin, nullptr) ||
+            !d3d::driver_command(D3V3D_COMMAND_TIMESTAMPGET, frame.end, &end, nullptr) || end < begin)
+        {
+            return;
+        }
+
+        updateScale(static_cast<float>(double(end - begin) * 1000.0 / double(m_gpuFrequency)));
+    }
+
+    void DynamicResolution::updateScale(float gpuMs)
+    {
+        m_gpuFrameMs = m_framesAtScale == 0 ? gpuMs : m_gpuFrameMs + (gpuMs - m_gpuFrameMs) * SmoothingFactor;
+        if (++m_framesAtScale < MinFramesAtScale)
+        {
+            return;
+        }
+
+        const bool isOverTarget = m_gpuFrameMs > m_targetMs;
+        const bool isUnderTarget = m_gpuFrameMs < m_targetMs * RaiseThreshold;
+        if (!isOverTarget && !isUnderTarget)
+        {
+            return;
+        }
+
+        // The raise is aimed at the middle of the band and limited to a step: an overshoot costs a hitch, a slow raise does not.
+        const float targetMs = isOverTarget ? m_targetMs : m_targetMs * (1.f + RaiseThreshold) * 0.5f;
+        float scale = m_scale * std::sqrt(targetMs / eastl::max(m_gpuFrameMs, 0.01f));
+        scale = isOverTarget ? std::floor(scale / ScaleStep) * ScaleStep : eastl::min(m_scale + ScaleStep, std::round(scale / ScaleStep) * ScaleStep);
+        scale = eastl::clamp(scale, m_minScale, m_maxScale);
+
+        if (std::abs(scale - m_scale) < ScaleStep * 0.5f)
+        {
+            return;
+        }
+
+        m_scale = scale;
+        m_framesAtScale = 0;
+    }
+}  // namespace nau::render
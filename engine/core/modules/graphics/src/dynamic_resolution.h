@@ -0,0 +1,86 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <EASTL/array.h>
+
+#include <cstdint>
+
+namespace nau::render
+{
+    /**
+     * @brief Scales the render resolution of the windows to keep the GPU frame time at the target.
+     *
+     * The GPU time of the render graph is measured with the timestamp queries around dabfg::run_nodes(),
+     * the queries are read back QueryFrames later. The scale follows the square root of the target to the measured
+     * time ratio (the GPU time is proportional to the pixels count). It is quantized to ScaleStep and changed only
+     * when the time leaves the band around the target and the current scale was measured for MinFramesAtScale frames:
+     * the render targets are resized with each change.
+     *
+     * Settings (global properties):
+     *  - /graphics/dynamicResolution/enabled: off by default;
+     *  - /graphics/dynamicResolution/targetMs: the GPU frame time to keep, 16.6 by default;
+     *  - /graphics/dynamicResolution/minScale, maxScale: the bounds of the scale, 0.5 and 1 by default.
+     */
+    class DynamicResolution
+    {
+    public:
+        static constexpr uint32_t QueryFrames = 4;
+        static constexpr uint32_t MinFramesAtScale = 30;
+        static constexpr float ScaleStep = 0.05f;
+
+        DynamicResolution();
+        ~DynamicResolution();
+
+        DynamicResolution(const DynamicResolution&) = delete;
+        DynamicResolution& operator=(const DynamicResolution&) = delete;
+
+        bool isEnabled() const
+        {
+            return m_isEnabled;
+        }
+
+        /**
+         * @brief Returns the scale of the render resolution to the display one, 1 when the controller is off.
+         */
+        float getScale() const
+        {
+            return m_scale;
+        }
+
+        float getGpuFrameMs() const
+        {
+            return m_gpuFrameMs;
+        }
+
+        void beginFrame();
+        void endFrame();
+
+    private:
+        struct QueryFrame
+        {
+            void* begin = nullptr;
+            void* end = nullptr;
+            bool isPending = false;
+        };
+
+        void resolve(QueryFrame& frame);
+        void updateScale(float gpuMs);
+
+        bool m_isEnabled = false;
+        float m_targetMs = 16.6f;
+        float m_minScale = 0.5f;
+        float m_maxScale = 1.f;
+
+        float m_scale = 1.f;
+        // The smoothed GPU time of the frames rendered at the current scale.
+        float m_gpuFrameMs = 0.f;
+        uint32_t m_framesAtScale = 0;
+
+        uint64_t m_gpuFrequency = 0;
+        uint32_t m_queryFrameIndex = 0;
+        eastl::array<QueryFrame, QueryFrames> m_queryFrames;
+    };
+}  // namespace nau::render
@@ -0,0 +1,23 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace nau::render
+{
+    /**
+     * @brief Collects the statistics of the presented frame (see getRenderFrameStats()) and applies the node timings request.
+     *
+     * Called on the render thread after the present while the render device is owned.
+     */
+    void collectRenderFrameStats(std::chrono::microseconds cpuRenderTime);
+
+    /**
+     * @brief Adds the culling results of the rendered frame. Can be called from the render jobs.
+     */
+    void addInstanceCullingStats(uint32_t testedCount, uint32_t visibleCount);
+}  // namespace nau::render
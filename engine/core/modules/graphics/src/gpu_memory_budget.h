@@ -0,0 +1,20 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+namespace nau::render
+{
+    /**
+     * @brief Registers the driver memory budget callback, which calls the budget handlers (see addGpuMemoryBudgetHandler()).
+     *
+     * Called after the driver is initialized.
+     */
+    void initGpuMemoryBudget();
+
+    /**
+     * @brief Removes the driver memory budget callback and the limits applied by the built-in handler. Called before the driver is released.
+     */
+    void shutdownGpuMemoryBudget();
+}  // namespace nau::render
@@ -0,0 +1,247 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "nau/render/gpu_memory_report.h"
+
+#include <EASTL/sort.h>
+
+#include <mutex>
+
+#include "gpu_memory_budget.h"
+#include "graphics_assets/texture_streaming.h"
+#include "nau/3d/dag_drv3d.h"
+#include "nau/3d/tql.h"
+#include "nau/assets/asset_residency.h"
+#include "nau/diag/logging.h"
+#include "nau/service/service_provider.h"
+#include "nau/threading/lock_guard.h"
+
+namespace nau::render
+{
+    namespace
+    {
+        std::mutex s_handlersMutex;
+        eastl::vector<eastl::pair<uint32_t, GpuMemoryBudgetHandler>> s_handlers;
+        uint32_t s_nextHandlerId = 0;
+
+        // The state of the built-in handler, accessed by the driver backend thread only (and by the shutdown after the callback is removed).
+        GpuMemoryPressure s_deviceLocalPressure = GpuMemoryPressure::Low;
+        size_t s_residencyTextureBudget = 0;
+        bool s_isResidencyBudgetLimited = false;
+
+        GpuMemoryPoolState toPoolState(const Drv3dGpuMemoryPool& pool)
+        {
+            return {
+                .budgetBytes = pool.budget,
+                .usedBytes = pool.currentUsage,
+                .availableForReservationBytes = pool.availableForReservation,
+                .physicalBytes = pool.physicalSize,
+                .pressure = static_cast<GpuMemoryPressure>(pool.pressure)};
+        }
+
+        const char* getPressureName(GpuMemoryPressure pressure)
+        {
+            switch (pressure)
+            {
+                case GpuMemoryPressure::Panic:
+                    return "Panic";
+                case GpuMemoryPressure::High:
+                    return "High";
+                case GpuMemoryPressure::Medium:
+                    return "Medium";
+                default:
+                    return "Low";
+            }
+        }
+
+        void restoreTextureBudgets()
+        {
+            if (getServiceProvider().has<TextureStreaming>())
+            {
+                getServiceProvider().get<TextureStreaming>().setBudgetLimit(0);
+            }
+
+            if (s_isResidencyBudgetLimited && getServiceProvider().has<IAssetResidencyManager>())
+            {
+                getServiceProvider().get<IAssetResidencyManager>().setMemoryBudget(AssetMemoryCategory::Texture, s_residencyTextureBudget);
+            }
+            s_isResidencyBudgetLimited = false;
+        }
+
+        /**
+            The budgets are tightened only when the pressure grows: the memory freed by the previous limits is not counted twice.
+            Medium keeps the limits, they are removed once the pressure is low.
+         */
+        void applyDeviceLocalPressure(const GpuMemoryPoolState& state)
+        {
+            const GpuMemoryPressure previousPressure = eastl::exchange(s_deviceLocalPressure, state.pressure);
+
+            // The texture manager re-evaluates its quota from the new budget with the next frame.
+            tql::request_mem_quota_update();
+
+            if (state.pressure == GpuMemoryPressure::Low)
+            {
+                restoreTextureBudgets();
+                return;
+            }
+
+            if (state.pressure == GpuMemoryPressure::Medium || state.pressure >= previousPressure)
+            {
+                return;
+            }
+
+            // The share of the resident textures kept.
+            const auto limit = [&state](size_t bytes)
+            {
+                return state.pressure == GpuMemoryPressure::Panic ? bytes / 4 * 3 : bytes / 10 * 9;
+            };
+
+            if (getServiceProvider().has<TextureStreaming>())
+            {
+                auto& streaming = getServiceProvider().get<TextureStreaming>();
+                if (streaming.isEnabled())
+                {
+                    streaming.setBudgetLimit(eastl::max<size_t>(limit(streaming.getStats().residentBytes), 1));
+                }
+            }
+
+            if (getServiceProvider().has<IAssetResidencyManager>())
+            {
+                auto& residency = getServiceProvider().get<IAssetResidencyManager>();
+                if (!s_isResidencyBudgetLimited)
+                {
+                    s_residencyTextureBudget = residency.getMemoryBudget(AssetMemoryCategory::Texture);
+                    s_isResidencyBudgetLimited = true;
+                }
+
+                const size_t usedBytes = residency.getMemoryUsage(AssetMemoryCategory::Texture).getTotalBytes();
+                const size_t budgetBytes = residency.getMemoryBudget(AssetMemoryCategory::Texture);
+                const size_t limitBytes = eastl::max<size_t>(limit(usedBytes), 1);
+                if (budgetBytes == 0 || limitBytes < budgetBytes)
+                {
+                    residency.setMemoryBudget(AssetMemoryCategory::Texture, limitBytes);
+                }
+            }
+        }
+
+        void onPressureChanged(void*, uint32_t pool, Drv3dGpuMemoryPressure, const Drv3dGpuMemoryPool& poolState)
+        {
+            const bool isDeviceLocal = pool == 0;
+            const GpuMemoryPoolState state = toPoolState(poolState);
+
+            NAU_LOG_DEBUG("GPU memory: {} pressure is {}, {} of {} MB used", isDeviceLocal ? "device local" : "host local", getPressureName(state.pressure),
+                          state.usedBytes >> 20, state.budgetBytes >> 20);
+
+            if (isDeviceLocal)
+            {
+                applyDeviceLocalPressure(state);
+            }
+
+            eastl::vector<GpuMemoryBudgetHandler> handlers;
+            {
+                lock_(s_handlersMutex);
+                handlers.reserve(s_handlers.size());
+                for (const auto& [id, handler] : s_handlers)
+                {
+                    handlers.push_back(handler);
+                }
+            }
+
+            for (const GpuMemoryBudgetHandler& handler : handlers)
+            {
+                handler(isDeviceLocal, state);
+            }
+        }
+    }  // namespace
+
+    GpuMemoryReport getGpuMemoryReport(size_t maxOwners)
+    {
+        GpuMemoryReport report;
+        if (!d3d::is_inited())
+        {
+            return report;
+        }
+
+        eastl::vector<GpuMemoryOwner> owners;
+        Drv3dGpuMemoryOwnerVisitor ownerVisitor{
+            .visit = [](void* context, Drv3dGpuMemoryCategory category, const char* ownerName, uint64_t size)
+            {
+                static_cast<eastl::vector<GpuMemoryOwner>*>(context)->push_back({
+                    .name = ownerName ? ownerName : "",
+                    .category = static_cast<GpuMemoryCategory>(category),
+                    .bytes = size});
+            },
+            .context = &owners};
+
+        Drv3dGpuMemoryReport driverReport{};
+        if (d3d::driver_command(DRV3D_COMMAND_GET_GPU_MEMORY_REPORT, &driverReport, maxOwners > 0 ? &ownerVisitor : nullptr, nullptr) == 0)
+        {
+            return report;
+        }
+
+        report.isAvailable = true;
+        report.deviceLocal = toPoolState(driverReport.deviceLocal);
+        report.hostLocal = toPoolState(driverReport.hostLocal);
+        for (size_t i = 0; i < GpuMemoryCategoryCount; ++i)
+        {
+            report.categories[i].bytes = driverReport.categoryBytes[i];
+            report.categories[i].objectsCount = driverReport.categoryObjects[i];
+        }
+        report.heapsCount = driverReport.heapCount;
+        report.heapTotalBytes = driverReport.heapTotalBytes;
+        report.heapFreeBytes = driverReport.heapFreeBytes;
+        report.maxHeapFragmentationPercent = driverReport.maxHeapFragmentationPercent;
+        report.averageHeapFragmentationPercent = driverReport.averageHeapFragmentationPercent;
+
+        const auto ownersEnd = owners.begin() + eastl::min(maxOwners, owners.size());
+        eastl::partial_sort(owners.begin(), ownersEnd, owners.end(), [](const GpuMemoryOwner& left, const GpuMemoryOwner& right)
+        {
+            return left.bytes > right.bytes;
+        });
+        owners.erase(ownersEnd, owners.end());
+        report.owners = std::move(owners);
+
+        return report;
+    }
+
+    uint32_t addGpuMemoryBudgetHandler(GpuMemoryBudgetHandler handler)
+    {
+        NAU_ASSERT(handler);
+
+        lock_(s_handlersMutex);
+        const uint32_t handlerId = ++s_nextHandlerId;
+        s_handlers.emplace_back(handlerId, std::move(handler));
+
+        return handlerId;
+    }
+
+    void removeGpuMemoryBudgetHandler(uint32_t handlerId)
+    {
+        lock_(s_handlersMutex);
+        eastl::erase_if(s_handlers, [handlerId](const auto& handler)
+        {
+            return handler.first == handlerId;
+        });
+    }
+
+    void initGpuMemoryBudget()
+    {
+        Drv3dGpuMemoryBudgetCallback callback{
+            .onPressureChanged = onPressureChanged,
+            .context = nullptr};
+
+        if (d3d::driver_command(DRV3D_COMMAND_SET_GPU_MEMORY_BUDGET_CALLBACK, &callback, nullptr, nullptr) == 0)
+        {
+            NAU_LOG_DEBUG("GPU memory: the driver does not observe the memory budget");
+        }
+    }
+
+    void shutdownGpuMemoryBudget()
+    {
+        d3d::driver_command(DRV3D_COMMAND_SET_GPU_MEMORY_BUDGET_CALLBACK, nullptr, nullptr, nullptr);
+
+        restoreTextureBudgets();
+        s_deviceLocalPressure = GpuMemoryPressure::Low;
+    }
+}  // namespace nau::render
@@ -9,25 +9,34 @@
 #include "nau/input.h"
 #include "nau/scene/scene_manager.h"
 
+#include "frame_stats_collector.h"
+#include "gpu_memory_budget.h"
+#include "graphics_assets/gpu_upload_queue.h"
 #include "graphics_assets/shader_asset.h"
 #include "graphics_assets/texture_asset.h"
+#include "graphics_assets/texture_streaming.h"
 #include "nau/app/core_window_manager.h"
+#include "nau/app/global_properties.h"
 #include "nau/app/platform_window.h"
 #include "nau/app/window_manager.h"
 #include "nau/assets/asset_manager.h"
 #include "nau/assets/asset_ref.h"
 #include "nau/assets/shader_asset_accessor.h"
+#include "nau/dataBlock/dag_dataBlock.h"
 #include "nau/diag/logging.h"
 #include "nau/dxil/compiled_shader_header.h"
 #include "nau/gui/dag_imgui.h"
 #include "nau/gui/imguiInput.h"
 #include "nau/image/dag_texPixel.h"
 #include "nau/input.h"
+#include "nau/input_system.h"
+#include "nau/3d/dag_lowLatency.h"
 #include "nau/module/module_manager.h"
 #include "nau/osApiWrappers/dag_cpuJobs.h"
 #include "nau/shaders/shader_defines.h"
 #include "nau/service/service_provider.h"
 #include "nau/shaders/shader_globals.h"
+#include "nau/startup/dag_globalSettings.h"
 #include "nau/ui.h"
 #include "nau/utils/performance_profiling.h"
 #include "render/daBfg/bfg.h"
@@ -109,12 +118,66 @@ public:
 static Driver3dInitCB cb;
 namespace nau
 {
+    namespace
+    {
+        // The activated components have loaded their shaders: the cached pipelines are created ahead of the first draws.
+        // "/graphics/pipelinePrewarmFrameBudgetUs" moves them to the background frames, spending up to the budget per frame.
+        void prewarmPipelineCache()
+        {
+            uint32_t frameBudgetUs = 0;
+            if (getServiceProvider().has<GlobalProperties>())
+            {
+                frameBudgetUs = getServiceProvider().get<GlobalProperties>().getValue<uint32_t>("/graphics/pipelinePrewarmFrameBudgetUs").value_or(0);
+            }
+
+            PrewarmPipelineCache request{frameBudgetUs};
+            d3d::driver_command(DRV3D_COMMAND_PREWARM_PIPELINE_CACHE, &request, nullptr, nullptr);
+        }
+
+        nau::DataBlock g_driverSettings;
+
+        const nau::DataBlock* getDriverSettings()
+        {
+            return &g_driverSettings;
+        }
+
+        // "/graphics/dx12/executionMode" selects how the DX12 driver translates the recorded commands:
+        // "concurrent" replays them on the driver worker thread, "immediate" on the render thread.
+        // Without the property the driver picks its own default for the adapter.
+        void applyDriverSettings()
+        {
+            if (!getServiceProvider().has<GlobalProperties>())
+            {
+                return;
+            }
+
+            auto executionMode = getServiceProvider().get<GlobalProperties>().getValue<eastl::string>("/graphics/dx12/executionMode");
+            if (!executionMode)
+            {
+                return;
+            }
+
+            g_driverSettings.setFrom(::dgs_get_settings());
+            g_driverSettings.addBlock("dx12")->setStr("executionMode", executionMode->c_str());
+            ::dgs_get_settings = &getDriverSettings;
+        }
+    }  // namespace
+
     GraphicsImpl::GraphicsImpl() = default;
 
     GraphicsImpl::~GraphicsImpl() = default;
 
     async::Task<> GraphicsImpl::preInitService()
     {
+        applyDriverSettings();
+
+        // "/graphics/pipelinedFrames": the render does not wait for the scene sync,
+        // the frame N+1 is simulated while the latched frame N state is being rendered.
+        if (getServiceProvider().has<GlobalProperties>())
+        {
+            m_isSceneSyncPipelined = getServiceProvider().get<GlobalProperties>().getValue<bool>("/graphics/pipelinedFrames").value_or(false);
+        }
+
         bool isDriverInited = d3d::init_driver();
         NAU_ASSERT(isDriverInited);
         unsigned memSizeKb = d3d::get_dedicated_gpu_memory_size_kb();
@@ -145,6 +208,7 @@ namespace nau
         main_wnd_f* wndProc = nullptr;
 
         d3d::init_video(hinst, wndProc, wcName, ncmd, mainHwnd, mainHwnd, nullptr, title, &cb);
+        render::initGpuMemoryBudget();
 
         int posx, posy, width, height;
         float minz, maxz;
@@ -171,6 +235,7 @@ namespace nau
         nau::hal::init_main_thread_id();
 
         dabfg::startup();
+        m_dynamicResolution = eastl::make_unique<render::DynamicResolution>();
 
         co_await rendWindow->createRenderGraph();
 
@@ -295,8 +360,12 @@ namespace nau
         bool hasPrepared = frameAllocator->prepareFrame();
         NAU_ASSERT(hasPrepared);
 
+        imgui_latch_render_data();
+
         for (auto& [world, scene] : m_worldToGraphicScene)
         {
+            scene->latchSceneState();
+
             auto task = scene->update();
             task.detach();
         }
@@ -307,19 +376,35 @@ namespace nau
 
         d3d::finish_render_commands();
 
+        // The uploads of the loading threads are submitted together with the copy queue work of the frame.
+        if (getServiceProvider().has<GpuUploadQueue>())
+        {
+            getServiceProvider().get<GpuUploadQueue>().update();
+        }
+
+        // The levels requested by the views of the previous frame.
+        if (getServiceProvider().has<TextureStreaming>())
+        {
+            getServiceProvider().get<TextureStreaming>().update();
+        }
+
         renderMainScene();
 
         co_return true;
     }
 
-    async::Task<bool> GraphicsImpl::update([[maybe_unused]] std::chrono::milliseconds dt)
+    async::Task<bool> GraphicsImpl::update([[maybe_unused]] std::chrono::microseconds dt)
     {
         return renderFrame();
     }
 
     void GraphicsImpl::renderMainScene()
     {
-// TODO Tracy        NAU_CPU_SCOPED_TAG(nau::PerfTag::Render);
+        NAU_CPU_SCOPED_TAG(nau::PerfTag::Render);
+        const auto renderStartTime = std::chrono::steady_clock::now();
+
+        // Binds the rendered frame to the latest simulated frame (see MainLoopService::doGameStep)
+        lowlatency::start_render();
 
 #if VIEWPORT_AUTO_RESIZE
         IWindowManager& wndManager = getServiceProvider().get<IWindowManager>();
@@ -343,6 +428,7 @@ namespace nau
                 auto worldPtr = renderWindow->getWorld();
                 renderWindow->setRenderScene(m_worldToGraphicScene[worldPtr]);
             }
+            renderWindow->setResolutionScale(m_dynamicResolution->getScale());
             renderWindow->render();
         }
 
@@ -360,10 +446,22 @@ namespace nau
         }
 #endif
 
+        const uint32_t latencyFrameId = lowlatency::get_current_render_frame();
+
         dabfg::update_external_state(dabfg::ExternalState{false, false});
-        dabfg::run_nodes();
+        m_dynamicResolution->beginFrame();
+        {
+            SCOPED_LATENCY_MARKER(latencyFrameId, RENDERSUBMIT_START, RENDERSUBMIT_END);
+            dabfg::run_nodes();
+        }
+        m_dynamicResolution->endFrame();
 
-        d3d::update_screen();
+        {
+            SCOPED_LATENCY_MARKER(latencyFrameId, PRESENT_START, PRESENT_END);
+            d3d::update_screen();
+        }
+
+        render::collectRenderFrameStats(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - renderStartTime));
         d3d::driver_command(DRV3D_COMMAND_RELEASE_OWNERSHIP, NULL, NULL, NULL);
     }
 
@@ -415,8 +513,10 @@ namespace nau
         m_worldToGraphicScene.clear();
         m_renderWindows.clear();
         m_defaultRenderWindow.reset();
+        m_dynamicResolution.reset();
 
         dabfg::shutdown();
+        render::shutdownGpuMemoryBudget();
         d3d::release_driver();
     }
 
@@ -439,11 +539,16 @@ namespace nau
         if (worldEntry == m_worldToGraphicScene.end())
         {
             [[maybe_unused]] bool emplaceOk;
-            eastl::tie(worldEntry, emplaceOk) = m_worldToGraphicScene.emplace(worldUid, eastl::make_unique<GraphicsScene>(worldUid));
+            {
+                const std::unique_lock lock(m_worldToGraphicSceneMutex);
+                eastl::tie(worldEntry, emplaceOk) = m_worldToGraphicScene.emplace(worldUid, eastl::make_unique<GraphicsScene>(worldUid));
+            }
             co_await worldEntry->second->initialize();
         }
 
         co_await worldEntry->second->activateComponents(components, async::Task<>::makeResolved());
+
+        prewarmPipelineCache();
     }
 
     async::Task<> GraphicsImpl::deactivateComponentsAsync(Uid worldUid, eastl::span<const scene::DeactivatedComponentData> components)
@@ -456,9 +561,18 @@ namespace nau
 
     void GraphicsImpl::syncSceneState()
     {
-        for (auto& [world, scene] : m_worldToGraphicScene)
+        // Late latch: the freshest input is applied right before the camera/view state is copied for the render
+        if (getServiceProvider().has<IInputSystem>())
+        {
+            getServiceProvider().get<IInputSystem>().sampleLateInput();
+        }
+
         {
-            scene->syncSceneState();
+            const std::shared_lock lock(m_worldToGraphicSceneMutex);
+            for (auto& [world, scene] : m_worldToGraphicScene)
+            {
+                scene->syncSceneState();
+            }
         }
 
         imgui_copy_render_data();
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "dynamic_resolution.h"
 #include "graphics_scene.h"
 #include "nau/app/main_loop/game_system.h"
 #include "nau/async/work_queue.h"
@@ -51,15 +52,20 @@ namespace nau
         async::Task<> activateComponentsAsync(Uid worldUid, eastl::span<const scene::Component*> components, async::Task<> barrier) override;
         async::Task<> deactivateComponentsAsync(Uid worldUid, eastl::span<const scene::DeactivatedComponentData> components) override;
 
-        async::Task<bool> update(std::chrono::milliseconds dt) override;
+        async::Task<bool> update(std::chrono::microseconds dt) override;
 
-        eastl::optional<std::chrono::milliseconds> getFixedUpdateTimeStep() override
+        eastl::optional<std::chrono::microseconds> getFixedUpdateTimeStep() override
         {
             return eastl::nullopt;
         }
 
         void syncSceneState() override;
 
+        bool isSceneSyncPipelined() const override
+        {
+            return m_isSceneSyncPipelined;
+        }
+
         async::Task<> preInitService() override;
         async::Task<> initService() override;
         async::Task<> shutdownService() override;
@@ -97,17 +103,22 @@ namespace nau
 
         BaseTexture* m_defaultTex;
 
-        nau::FrameAllocator m_frameAllocator;
+        nau::BufferedFrameAllocator m_frameAllocator;
 
         nau::Uid m_defaultWorld = nau::NullUid;
         eastl::map<nau::Uid, eastl::shared_ptr<GraphicsScene>> m_worldToGraphicScene;
+        // Scenes are added by the render, syncSceneState iterates them on the main thread
+        std::shared_mutex m_worldToGraphicSceneMutex;
+        bool m_isSceneSyncPipelined = false;
         Ptr<nau::render::RenderWindowImpl> m_defaultRenderWindow;
         eastl::map<SWAPID, Ptr<nau::render::RenderWindowImpl>> m_renderWindows;
         uint32_t m_renderWindowsIds = 0;
 
         eastl::map<void*, SWAPID> m_hwndToSwapChain = {};
 
-        WorkQueue::Ptr m_preRenderWorkQueue = WorkQueue::create();
+        eastl::unique_ptr<render::DynamicResolution> m_dynamicResolution;
+
+        WorkQueue::Ptr m_preRenderWorkQueue = WorkQueue::create(WorkQueueMode::Mpsc);
         std::mutex m_preRenderJobsMutex;
         eastl::vector<AsyncAction> m_preRenderJobs;
 
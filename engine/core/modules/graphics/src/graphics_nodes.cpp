@@ -10,6 +10,7 @@
 #include "nau/animation/components/skeleton_socket_component.h"
 #include "nau/debugRenderer/debug_render_system.h"
 #include "nau/diag/logging.h"
+#include "nau/math/transform_batch.h"
 #include "nau/scene/components/camera_component.h"
 #include "nau/scene/components/skinned_mesh_component.h"
 #include "nau/scene/components/static_mesh_component.h"
@@ -17,6 +18,7 @@
 #include "nau/scene/scene_object.h"
 #include "nau/shaders/shader_globals.h"
 #include "nau/utils/performance_profiling.h"
+#include "scene_render_state.h"
 
 namespace nau
 {
@@ -84,35 +86,69 @@ namespace nau
         }
     }  // namespace Debug
 
-    async::Task<StaticMeshNode> makeStaticMeshNode(nau::Ptr<nau::RenderScene> renderScene, const scene::StaticMeshComponent& meshComponent, MaterialAssetRef overrideMaterial)
+    async::Task<eastl::vector<StaticMeshNode>> makeStaticMeshNodes(nau::Ptr<nau::RenderScene> renderScene,
+        eastl::span<const scene::StaticMeshComponent* const> meshComponents,
+        eastl::span<const MaterialAssetRef> overrideMaterials)
     {
-        StaticMeshAssetRef meshAsset = meshComponent.getMeshGeometry();
-        if (!meshAsset)
+        NAU_ASSERT(meshComponents.size() == overrideMaterials.size());
+
+        // The component state is captured before the first suspension.
+        struct MeshComponentState
         {
-            NAU_LOG("Mesh missing");
-            co_return StaticMeshNode{};
+            Uid componentUid;
+            bool isOccluder;
+            MaterialAssetRef material;
+            MaterialAssetRef overrideMaterial;
+        };
+
+        eastl::vector<MeshComponentState> states;
+        eastl::vector<StaticMeshPlacement> placements;
+        states.reserve(meshComponents.size());
+        placements.reserve(meshComponents.size());
+        for (size_t i = 0; i < meshComponents.size(); ++i)
+        {
+            const scene::StaticMeshComponent& meshComponent = *meshComponents[i];
+            StaticMeshAssetRef meshAsset = meshComponent.getMeshGeometry();
+            if (!meshAsset)
+            {
+                NAU_LOG("Mesh missing");
+                continue;
+            }
+
+            states.push_back({meshComponent.getUid(), meshComponent.isOccluder(), meshComponent.getMaterial(), overrideMaterials[i]});
+            placements.push_back({std::move(meshAsset), meshComponent.getWorldTransform().getMatrix()});
         }
 
-        nau::MaterialAssetRef matRef = meshComponent.getMaterial();
+        eastl::vector<eastl::unique_ptr<nau::MeshHandle>> handles = co_await renderScene->getManagerTyped<StaticMeshManager>()->addStaticMeshes(std::move(placements));
 
-        StaticMeshNode renderableMesh;
-        renderableMesh.componentUid = meshComponent.getUid();
+        eastl::vector<StaticMeshNode> renderableMeshes;
+        renderableMeshes.reserve(states.size());
+        for (size_t i = 0; i < states.size(); ++i)
+        {
+            MeshComponentState& state = states[i];
 
-        renderableMesh.handle = co_await renderScene->getManagerTyped<StaticMeshManager>()->addStaticMesh(meshAsset, meshComponent.getWorldTransform().getMatrix());
+            StaticMeshNode& renderableMesh = renderableMeshes.emplace_back();
+            renderableMesh.componentUid = state.componentUid;
+            renderableMesh.handle = std::move(handles[i]);
+            if (state.isOccluder)
+            {
+                renderableMesh.handle->setOccluder(true);
+            }
 
-        if (matRef)
-        {
-            renderableMesh.handle->overrideMaterial(0, 0, co_await matRef.getReloadableAssetViewTyped<MaterialAssetView>());
-        }
+            if (state.material)
+            {
+                renderableMesh.handle->overrideMaterial(0, 0, co_await state.material.getReloadableAssetViewTyped<MaterialAssetView>());
+            }
 
-        if (overrideMaterial)
-        {
-            ReloadableAssetView::Ptr dx12MaterialAsset;
-            dx12MaterialAsset = co_await overrideMaterial.getReloadableAssetViewTyped<MaterialAssetView>();
-            renderableMesh.handle->overrideMaterial(0, 0, dx12MaterialAsset);
+            if (state.overrideMaterial)
+            {
+                ReloadableAssetView::Ptr dx12MaterialAsset;
+                dx12MaterialAsset = co_await state.overrideMaterial.getReloadableAssetViewTyped<MaterialAssetView>();
+                renderableMesh.handle->overrideMaterial(0, 0, dx12MaterialAsset);
+            }
         }
 
-        co_return renderableMesh;
+        co_return renderableMeshes;
     }
 
     async::Task<SkinnedMeshNode> makeSkinnedMeshNode(nau::Ptr<nau::RenderScene> renderScene, const SkinnedMeshComponent& skinnedMeshComponent, MaterialAssetRef overrideMaterial)
@@ -181,6 +217,8 @@ namespace nau
         node.componentUid = envComponent.getUid();
         node.envIntensity = envComponent.getIntensity();
         node.newTextureRef = envComponent.getTextureAsset();
+        node.irradianceRef = envComponent.getIrradianceAsset();
+        node.reflectionRef = envComponent.getReflectionAsset();
         return node;
     }
 
@@ -189,36 +227,74 @@ namespace nau
         node.worldTransform = sceneComponent.getWorldTransform().getMatrix();
     }
 
-    void SkinnedMeshNode::updateFromScene(SkinnedMeshNode& mesh, const scene::SceneComponent& sceneComponent, const SkeletonComponent& skeletonComponent)
+    SkinnedMeshProxy makeSkinnedMeshProxy(const scene::SceneComponent& sceneComponent, const SkeletonComponent& skeletonComponent)
     {
-        GraphicsSceneNode::updateFromScene(mesh, sceneComponent);
+        SkinnedMeshProxy proxy;
+        proxy.componentUid = sceneComponent.getUid();
+        proxy.worldTransform = sceneComponent.getWorldTransform().getMatrix();
+        proxy.isPoseFinalized = skeletonComponent.isPoseFinalized();
 
         const unsigned bonesCount = skeletonComponent.getBonesCount();
-
-        if (bonesCount == 0)
+        if (bonesCount == 0 || !proxy.isPoseFinalized)
         {
-            return;
+            return proxy;
         }
         NAU_ASSERT(bonesCount <= NAU_MAX_SKINNING_BONES_COUNT);
 
         const auto& modelSpaceJointMatrices = skeletonComponent.getModelSpaceJointMatrices();
         const auto& inverseBindTransforms = skeletonComponent.getInverseBindTransforms();
 
-        std::memcpy(&mesh.instance->bonesTransforms[0], &modelSpaceJointMatrices[0], bonesCount * 64);  // 64 == 16 elements * 4 (sizeof(float))
+        proxy.modelSpaceJoints.resize(bonesCount);
+        std::memcpy(proxy.modelSpaceJoints.data(), &modelSpaceJointMatrices[0], bonesCount * 64);  // 64 == 16 elements * 4 (sizeof(float))
+        proxy.inverseBindTransforms.assign(inverseBindTransforms.begin(), inverseBindTransforms.begin() + bonesCount);
 
-        for (size_t i = 0; i < bonesCount; ++i)
+        if (SkeletonComponent::drawDebugSkeletons)
         {
-            mesh.instance->bonesTransforms[i] = mesh.worldTransform * mesh.instance->bonesTransforms[i] * inverseBindTransforms.at(i);
+            Debug::debugDrawSkeleton(skeletonComponent);
+        }
+
+        return proxy;
+    }
 
-            mesh.instance->bonesNormalTransforms[i] = math::transpose(math::inverse(mesh.instance->bonesTransforms[i]));
+    void SkinnedMeshNode::updateFromScene(SkinnedMeshNode& mesh, const scene::SceneComponent& sceneComponent, const SkeletonComponent& skeletonComponent)
+    {
+        if (skeletonComponent.getBonesCount() == 0)
+        {
+            GraphicsSceneNode::updateFromScene(mesh, sceneComponent);
+            return;
         }
 
-        mesh.instance->setWorldPos(mesh.worldTransform);
+        updateFromProxy(mesh, makeSkinnedMeshProxy(sceneComponent, skeletonComponent));
+    }
 
-        if (SkeletonComponent::drawDebugSkeletons)
+    void SkinnedMeshNode::updateFromProxy(SkinnedMeshNode& mesh, const SkinnedMeshProxy& proxy)
+    {
+        mesh.worldTransform = proxy.worldTransform;
+
+        // The skeleton pose was not computed (see SkeletonPosePolicy): the bones keep the last pose.
+        mesh.instance->setPoseStale(!proxy.isPoseFinalized);
+        if (!proxy.isPoseFinalized)
         {
-            Debug::debugDrawSkeleton(skeletonComponent);
+            mesh.instance->setWorldPos(mesh.worldTransform);
+            return;
         }
+
+        const unsigned bonesCount = static_cast<unsigned>(proxy.modelSpaceJoints.size());
+        if (bonesCount == 0)
+        {
+            return;
+        }
+
+        mesh.instance->bonesCount = bonesCount;
+
+        for (size_t i = 0; i < bonesCount; ++i)
+        {
+            mesh.instance->bonesTransforms[i] = mesh.worldTransform * proxy.modelSpaceJoints[i] * proxy.inverseBindTransforms[i];
+        }
+
+        math::inverseTransposeAffine(eastl::span{mesh.instance->bonesTransforms, bonesCount}, eastl::span{mesh.instance->bonesNormalTransforms, bonesCount});
+
+        mesh.instance->setWorldPos(mesh.worldTransform);
     }
 
     const scene::ICameraProperties& CameraNode::getProperties() const
@@ -233,8 +309,12 @@ namespace nau
 
         NAU_FATAL(cameraProperties);
 
+        cameraUid = cameraProperties->getCameraUid();
         worldPosition = cameraProperties->getWorldTransform().getTranslation();
         viewTransform = nau::math::inverse(cameraProperties->getWorldTransform().getMatrix());
+        fov = cameraProperties->getFov();
+        clipNearPlane = cameraProperties->getClipNearPlane();
+        clipFarPlane = cameraProperties->getClipFarPlane();
     }
 
     nau::math::Matrix4 CameraNode::getViewMatrix() const
@@ -257,9 +337,9 @@ namespace nau
             aspectRatioRec = static_cast<float>(height) / static_cast<float>(width);
         }
         
-        return nau::math::Matrix4::perspectiveRH(nau::math::degToRad(cameraProperties->getFov()),
+        return nau::math::Matrix4::perspectiveRH(nau::math::degToRad(fov),
             aspectRatioRec,
-            cameraProperties->getClipNearPlane(), cameraProperties->getClipFarPlane());
+            clipNearPlane, clipFarPlane);
     }
 
     nau::math::Matrix4 CameraNode::getProjMatrixReverseZ() const
@@ -275,9 +355,9 @@ namespace nau
             aspectRatioRec = static_cast<float>(height) / static_cast<float>(width);
         }
 
-        return nau::math::Matrix4::perspectiveRH_ReverseZ(nau::math::degToRad(cameraProperties->getFov()),
+        return nau::math::Matrix4::perspectiveRH_ReverseZ(nau::math::degToRad(fov),
             aspectRatioRec,
-            cameraProperties->getClipNearPlane(), cameraProperties->getClipFarPlane());
+            clipNearPlane, clipFarPlane);
     }
 
     nau::math::Matrix4 CameraNode::getViewProjectionMatrix() const
@@ -25,6 +25,8 @@ namespace nau::scene
 
 namespace nau
 {
+    struct SkinnedMeshProxy;
+
     struct GraphicsSceneNode
     {
         Uid componentUid;
@@ -49,11 +51,18 @@ namespace nau
         }
     };
 
+    /**
+     * The camera state copied by updateFromCamera (on the game side): the render must not access the camera properties directly.
+     */
     struct CameraNode
     {
         nau::Ptr<scene::ICameraProperties> cameraProperties;
+        Uid cameraUid;
         nau::math::Matrix4 viewTransform;
         nau::math::Vector3 worldPosition;
+        float fov = 90.f;
+        float clipNearPlane = 0.1f;
+        float clipFarPlane = 1000.f;
 
         void updateFromCamera();
         nau::math::Matrix4 getViewMatrix() const;
@@ -86,12 +95,16 @@ namespace nau
 
         eastl::optional<MaterialAssetRef> materialOverride;
 
+        // The culling feedback of the instance, copied at the render latch: the scene sync must not read the render-side instance.
+        bool isVisible = true;
+
         explicit operator bool() const
         {
             return componentUid != NullUid;
         }
 
         static void updateFromScene(SkinnedMeshNode& node, const scene::SceneComponent& sceneComponent, const SkeletonComponent& skeletonComponent);
+        static void updateFromProxy(SkinnedMeshNode& node, const SkinnedMeshProxy& proxy);
     };
 
     struct BillboardNode : GraphicsSceneNode
@@ -105,8 +118,13 @@ namespace nau
         Uid componentUid;
         float envIntensity = 1.0f;
         eastl::optional<nau::TextureAssetRef> newTextureRef;
+        // The cooked prefiltered maps, loaded with the new panorama.
+        nau::TextureAssetRef irradianceRef;
+        nau::TextureAssetRef reflectionRef;
 
         ReloadableAssetView::Ptr textureView;
+        ReloadableAssetView::Ptr irradianceView;
+        ReloadableAssetView::Ptr reflectionView;
 
         bool isDirty = false;
     };
@@ -121,10 +139,14 @@ namespace nau
         }
     };
 
-    async::Task<StaticMeshNode> makeStaticMeshNode(
+    /**
+     * Registers the meshes of all the components with a single StaticMeshManager::addStaticMeshes call.
+     * The components without the mesh are skipped, overrideMaterials keeps the override of each component (can be empty).
+     */
+    async::Task<eastl::vector<StaticMeshNode>> makeStaticMeshNodes(
         nau::Ptr<nau::RenderScene> renderScene,
-        const nau::scene::StaticMeshComponent& meshComponent,
-        MaterialAssetRef overrideMaterial);
+        eastl::span<const nau::scene::StaticMeshComponent* const> meshComponents,
+        eastl::span<const MaterialAssetRef> overrideMaterials);
 
     async::Task<SkinnedMeshNode> makeSkinnedMeshNode(
         nau::Ptr<nau::RenderScene> renderScene,
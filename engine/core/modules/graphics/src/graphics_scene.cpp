@@ -31,6 +31,7 @@ namespace nau
         m_renderScene = nau::rtti::createInstance<nau::RenderScene>();
         auto mainView = eastl::make_shared<nau::RenderView>("Main View");
         mainView->addTag(nau::RenderScene::Tags::opaqueTag);
+        mainView->setOcclusionCulling(true);
         m_renderScene->addView(mainView);
 
         for (int i = 0; i < nau::csm::CascadeShadows::MAX_CASCADES; ++i)
@@ -38,18 +39,15 @@ namespace nau
             auto csmView = eastl::make_shared<nau::RenderView>(nau::utils::format("{}_{}", "csmView", i).c_str());
             csmView->addTag(nau::RenderScene::Tags::shadowCascadeTag);
             csmView->setUserData((void*)i);
-            nau::RenderView* csmViewPtr = csmView.get();
-            auto csmFilter = eastl::function<bool(const InstanceInfo&)>([csmViewPtr](const InstanceInfo& info)
-            {
-                return info.isCastShadow && csmViewPtr->getFrustum().testSphere(info.worldSphere) != 0;
-            });
-            csmView->setInstanceFilter(csmFilter);
+            csmView->setRequiredInstanceState(InstanceState::Visible | InstanceState::CastShadow);
 
             m_renderScene->addView(csmView);
         }
 
         auto translucentView = eastl::make_shared<nau::RenderView>("Main View (Translucent)");
         translucentView->addTag(nau::RenderScene::Tags::translucentTag);
+        translucentView->setOcclusionCulling(true);
+        translucentView->setDrawOrder(nau::DrawOrder::BackToFront);
 
         auto translucentFilter = eastl::function<bool(const MaterialAssetView::Ptr)>([](const MaterialAssetView::Ptr material)
         {
@@ -96,7 +94,8 @@ namespace nau
         ASYNC_SWITCH_EXECUTOR(Executor::getDefault())
 
         // Async objects creation step
-        eastl::vector<Task<StaticMeshNode>> staticMeshes;
+        eastl::vector<const StaticMeshComponent*> staticMeshComponents;
+        eastl::vector<MaterialAssetRef> staticMeshMaterials;
         eastl::vector<Task<SkinnedMeshNode>> skinnedMeshes;
         eastl::vector<Task<BillboardNode>> billboards;
         eastl::vector<DirectionalLightNode> directionalLights;
@@ -122,7 +121,8 @@ namespace nau
             }
             if (const auto* const meshComponent = component->as<const StaticMeshComponent*>())
             {
-                staticMeshes.emplace_back(makeStaticMeshNode(m_renderScene, *meshComponent, meshMaterial));
+                staticMeshComponents.push_back(meshComponent);
+                staticMeshMaterials.push_back(std::move(meshMaterial));
             }
             else if (const auto* const skinnedMeshComponent = component->as<const SkinnedMeshComponent*>())
             {
@@ -158,31 +158,36 @@ namespace nau
             }
         }
 
+        // The static meshes are added in a single batch: thousands of instances of a few meshes take a single pre-render job.
+        Task<eastl::vector<StaticMeshNode>> staticMeshes = makeStaticMeshNodes(m_renderScene, staticMeshComponents, staticMeshMaterials);
+
         TaskCollection taskToMakeComponents;
 
-        taskToMakeComponents.push(async::whenAll(staticMeshes));
+        taskToMakeComponents.push(async::whenAll(Expiration::never(), staticMeshes));
         taskToMakeComponents.push(async::whenAll(skinnedMeshes));
         taskToMakeComponents.push(async::whenAll(billboards));
 
         co_await taskToMakeComponents.awaitCompletion();
 
         // switching to before render step,
-        // so can modify scene state without locking it.
+        // so can modify scene state without locking it (only the game side capture is excluded, see syncSceneState).
         auto& graphics = getServiceProvider().get<GraphicsImpl>();
         co_await graphics.getPreRenderExecutor();
 
-        if (!staticMeshes.empty())
+        const std::unique_lock nodesLock(m_nodesMutex);
+
+        if (staticMeshes.isReady() && !staticMeshes.isRejected())
         {
-            m_staticMeshes.reserve(m_staticMeshes.size() + staticMeshes.size());
-            for (Task<StaticMeshNode>& meshTask : staticMeshes)
+            eastl::vector<StaticMeshNode> meshNodes = *std::move(staticMeshes);
+            m_staticMeshes.reserve(m_staticMeshes.size() + meshNodes.size());
+            for (StaticMeshNode& meshNode : meshNodes)
             {
-                if (meshTask.isReady())
-                {
-                    m_staticMeshes.emplace_back(*std::move(meshTask));
+                m_staticMeshes.emplace_back(std::move(meshNode));
 
-                    auto& mesh = m_staticMeshes.back();
-                    mesh.handle->setUid(mesh.componentUid);
-                }
+                auto& mesh = m_staticMeshes.back();
+                mesh.handle->setUid(mesh.componentUid);
+                m_staticMeshIndices[mesh.componentUid] = m_staticMeshes.size() - 1;
+                requestStaticMeshSync(mesh.componentUid);
             }
         }
 
@@ -255,6 +260,8 @@ namespace nau
         auto& graphics = getServiceProvider().get<GraphicsImpl>();
         co_await graphics.getPreRenderExecutor();
 
+        const std::unique_lock nodesLock(m_nodesMutex);
+
         const auto componentRemoved = [&components](Uid uid)
         {
             return eastl::any_of(components.begin(), components.end(), [&uid](const DeactivatedComponentData& c)
@@ -289,6 +296,12 @@ namespace nau
 
         removeObjects(m_skinnedMeshes);
         removeObjects(m_staticMeshes);
+
+        m_staticMeshIndices.clear();
+        for (size_t i = 0; i < m_staticMeshes.size(); ++i)
+        {
+            m_staticMeshIndices[m_staticMeshes[i].componentUid] = i;
+        }
         removeObjects(m_billboards);
         removeObjects(m_directionalLights);
         removeObjects(m_envNodes);
@@ -307,6 +320,7 @@ namespace nau
 
                 m.handle->overrideMaterial(0, 0, dx12MaterialAsset);
                 m.materialOverride.reset();
+                requestStaticMeshSync(m.componentUid);
             }
         }
         for (auto& m : m_skinnedMeshes)
@@ -347,6 +361,15 @@ namespace nau
                     node.textureView = texAsset;
                     node.isDirty = true;
                 }
+
+                // Both the cooked maps are needed: otherwise they are computed from the panorama.
+                node.irradianceView = nullptr;
+                node.reflectionView = nullptr;
+                if (node.irradianceRef && node.reflectionRef)
+                {
+                    node.irradianceView = co_await node.irradianceRef.getReloadableAssetViewTyped<TextureAssetView>();
+                    node.reflectionView = co_await node.reflectionRef.getReloadableAssetViewTyped<TextureAssetView>();
+                }
             }
         }
 
@@ -388,6 +411,31 @@ namespace nau
         m_renderScene->renderDepth(activeCamera.getViewProjectionMatrix());
     }
 
+    void GraphicsScene::renderOccludedDepth(BaseTexture* depth)
+    {
+        if (m_staticMeshes.empty() && m_skinnedMeshes.empty())
+        {
+            return;
+        }
+
+        if (!hasMainCamera())
+        {
+            return;
+        }
+
+        const nau::math::Matrix4 viewProjectionMatrix = getMainCamera().getViewProjectionMatrix();
+        if (!m_renderScene->cullOccluded(depth, viewProjectionMatrix))
+        {
+            return;
+        }
+
+        d3d::set_render_target();
+        d3d::set_render_target(nullptr, 0);
+        d3d::set_depth(depth, DepthAccess::RW);
+        m_renderScene->renderLateDepth(viewProjectionMatrix);
+        d3d::set_depth(nullptr, DepthAccess::RW);
+    }
+
     void GraphicsScene::renderOutlineMask()
     {
         if (m_staticMeshes.empty() && m_skinnedMeshes.empty())
@@ -435,11 +483,11 @@ namespace nau
         auto& activeCamera = getMainCamera();
 
         m_lights.cullFrustumLights(
-            math::Point3(activeCamera.cameraProperties->getTransform().getTranslation()),
+            math::Point3(activeCamera.worldPosition),
             activeCamera.getViewProjectionMatrix(),
             activeCamera.getViewMatrix(),
             activeCamera.getProjMatrix(),
-            activeCamera.getProperties().getClipNearPlane());
+            activeCamera.clipNearPlane);
 
         if (!m_lights.hasDeferredLights())
         {
@@ -448,7 +496,7 @@ namespace nau
 
         auto mvp = activeCamera.getViewProjectionMatrix();
         shader_globals::setVariable("mvp", &mvp);
-        auto world_view_pos = math::Vector4(activeCamera.getProperties().getTranslation());
+        auto world_view_pos = math::Vector4(activeCamera.worldPosition);
         shader_globals::setVariable("world_view_pos", &world_view_pos);
 
         m_lights.renderOtherLights();
@@ -472,7 +520,7 @@ namespace nau
 
         auto mvp = activeCamera.getViewProjectionMatrix();
         shader_globals::setVariable("mvp", &mvp);
-        auto world_view_pos = math::Vector4(activeCamera.getProperties().getTranslation());
+        auto world_view_pos = math::Vector4(activeCamera.worldPosition);
         shader_globals::setVariable("world_view_pos", &world_view_pos);
 
         m_lights.renderDebugLights();
@@ -506,33 +554,99 @@ namespace nau
         m_renderScene->renderBillboards(viewProjectionMatrix);
     }
 
+    void GraphicsScene::renderPickDepth(const math::Matrix4& regionCrop)
+    {
+        if (m_staticMeshes.empty() && m_skinnedMeshes.empty())
+        {
+            return;
+        }
+
+        if (!hasMainCamera())
+        {
+            return;
+        }
+
+        // The region is within the camera frustum: the views culled for the camera are drawn.
+        auto& activeCamera = getMainCamera();
+        m_renderScene->renderDepth(regionCrop * activeCamera.getViewProjectionMatrix());
+    }
+
+    void GraphicsScene::renderPickBillboards(const math::Matrix4& regionCrop)
+    {
+        if (!hasMainCamera())
+        {
+            return;
+        }
+
+        auto& activeCamera = getMainCamera();
+        m_renderScene->renderBillboards(regionCrop * activeCamera.getViewProjectionMatrix());
+    }
+
     void GraphicsScene::syncSceneState()
     {
         using namespace nau::scene;
 
-        // TODO Tracy        NAU_CPU_SCOPED_TAG(nau::PerfTag::Core);
+        NAU_CPU_SCOPED_TAG(nau::PerfTag::Core);
         if (!getServiceProvider().has<ISceneManagerInternal>())
         {
             return;
         }
         auto& sceneManager = getServiceProvider().get<ISceneManagerInternal>();
 
-        for (auto& m : m_staticMeshes)
+        SceneRenderState& state = m_renderState.beginWrite();
+
+        syncSceneCameras(state);
+
+        const CameraNode* const mainCamera = [&]() -> const CameraNode*
+        {
+            auto camera = m_gameCameras.find(state.mainCameraUid);
+            return camera != m_gameCameras.end() ? &camera->second : nullptr;
+        }();
+
+        // The node lists are modified by the render (on activation/deactivation and at the latch) under the exclusive lock.
+        const std::shared_lock nodesLock(m_nodesMutex);
+
+        // Static meshes only change on demand: only the changed ones are synced, not the whole list.
+        if (!m_componentChanges)
+        {
+            m_componentChanges = sceneManager.subscribeComponentChanges({ComponentChange::Transform, ComponentChange::Material, ComponentChange::Visibility, ComponentChange::Properties});
+        }
+
+        {
+            const std::lock_guard lock(m_staticMeshesToSyncMutex);
+            m_syncedStaticMeshes.swap(m_staticMeshesToSync);
+        }
+
+        m_componentChanges.takeChanges(m_syncedStaticMeshes);
+
+        for (const Uid componentUid : m_syncedStaticMeshes)
         {
-            if (Component* const component = sceneManager.findComponent(m.componentUid))
+            if (m_staticMeshIndices.find(componentUid) == m_staticMeshIndices.end())
             {
-                // StaticMeshNode::updateFromScene(m, component->as<const SceneComponent&>());
+                continue;
+            }
 
+            if (Component* const component = sceneManager.findComponent(componentUid))
+            {
                 StaticMeshComponent& staticMeshComponent = component->as<StaticMeshComponent&>();
-                if ((staticMeshComponent.getDirtyFlags() & static_cast<uint32_t>(StaticMeshComponent::DirtyFlags::Material)) && staticMeshComponent.getMaterial())
+
+                StaticMeshProxy& proxy = state.staticMeshes.emplace_back();
+                proxy.componentUid = componentUid;
+                proxy.dirtyFlags = staticMeshComponent.getDirtyFlags();
+                proxy.worldTransform = staticMeshComponent.getWorldTransform();
+                proxy.isVisible = staticMeshComponent.getVisibility();
+                proxy.castShadow = staticMeshComponent.getCastShadow();
+                proxy.isOccluder = staticMeshComponent.isOccluder();
+                if ((proxy.dirtyFlags & static_cast<uint32_t>(StaticMeshComponent::DirtyFlags::Material)) && staticMeshComponent.getMaterial())
                 {
-                    m.materialOverride = staticMeshComponent.getMaterial();
+                    proxy.materialOverride = staticMeshComponent.getMaterial();
                 }
-                m.handle->syncState(staticMeshComponent);
 
                 staticMeshComponent.resetDirtyFlags();
             }
         }
+
+        m_syncedStaticMeshes.clear();
         for (auto& m : m_skinnedMeshes)
         {
             Component* const skMeshComponent = sceneManager.findComponent(m.componentUid);
@@ -543,90 +657,117 @@ namespace nau
             }
 
             Component* skeletonComponent = nullptr;
-            if (m.skeletonComponentUid != NullUid)
+            Uid& skeletonComponentUid = m_skeletonComponents.try_emplace(m.componentUid, m.skeletonComponentUid).first->second;
+            if (skeletonComponentUid != NullUid)
             {
-                skeletonComponent = sceneManager.findComponent(m.skeletonComponentUid);
+                skeletonComponent = sceneManager.findComponent(skeletonComponentUid);
             }
             if (!skeletonComponent)
             {
                 SceneObject& parentObj = skMeshComponent->getParentObject();
                 if (skeletonComponent = parentObj.findFirstComponent<SkeletonComponent>())
                 {
-                    m.skeletonComponentUid = skeletonComponent->getUid();
+                    skeletonComponentUid = skeletonComponent->getUid();
                 }
             }
 
             SkinnedMeshComponent& skinnedMeshComponent = skMeshComponent->as<SkinnedMeshComponent&>();
 
+            eastl::optional<MaterialAssetRef> materialOverride;
             if (skinnedMeshComponent.isMaterialDirty() && skinnedMeshComponent.getMaterial())
             {
-                m.materialOverride = skinnedMeshComponent.getMaterial();
+                materialOverride = skinnedMeshComponent.getMaterial();
                 skinnedMeshComponent.resetIsMaterialDirty();
             }
 
             if (skeletonComponent)
             {
-                SkinnedMeshNode::updateFromScene(m, skMeshComponent->as<const SceneComponent&>(), skeletonComponent->as<const SkeletonComponent&>());
+                SkeletonComponent& skeleton = skeletonComponent->as<SkeletonComponent&>();
+
+                SkinnedMeshProxy& proxy = state.skinnedMeshes.emplace_back(makeSkinnedMeshProxy(skMeshComponent->as<const SceneComponent&>(), skeleton));
+                proxy.materialOverride = std::move(materialOverride);
+
+                // The animation update rate of the skeleton is chosen by its distance to the camera.
+                if (mainCamera)
+                {
+                    const math::Vector3 meshPos = proxy.worldTransform.getTranslation();
+                    skeleton.setAnimationLodDistance(math::length(meshPos - mainCamera->worldPosition));
+                }
+
+                // The culling feedback (of the last rendered frame): the pose of a skeleton without visible meshes may be skipped.
+                skeleton.reportVisibility(m.isVisible);
+            }
+            else if (materialOverride)
+            {
+                SkinnedMeshProxy& proxy = state.skinnedMeshes.emplace_back();
+                proxy.componentUid = m.componentUid;
+                proxy.worldTransform = skinnedMeshComponent.getWorldTransform().getMatrix();
+                proxy.materialOverride = std::move(materialOverride);
             }
         }
 
-        for (auto& bill : m_billboards)
+        for (const auto& bill : m_billboards)
         {
             if (Component* const component = sceneManager.findComponent(bill.componentUid))
             {
-                GraphicsSceneNode::updateFromScene(bill, component->as<const SceneComponent&>());
                 BillboardComponent& billComponent = component->as<BillboardComponent&>();
-                bill.billboardHandle->setScreenPercentageSize(billComponent.getScreenPercentageSize());
-                bill.billboardHandle->setWorldPos(billComponent.getWorldTransform().getTranslation());
-                bill.billboardHandle->setVisibility(billComponent.getVisibility());
+
+                BillboardProxy& proxy = state.billboards.emplace_back();
+                proxy.componentUid = bill.componentUid;
+                proxy.worldTransform = billComponent.getWorldTransform().getMatrix();
+                proxy.screenPercentageSize = billComponent.getScreenPercentageSize();
+                proxy.isVisible = billComponent.getVisibility();
                 if (billComponent.isTextureDirty())
                 {
-                    bill.overrideTexture = billComponent.getTextureRef();
+                    proxy.overrideTexture = billComponent.getTextureRef();
                     billComponent.resetIsTextureDirty();
                 }
             }
         }
 
-        for (auto& directionalLight : m_directionalLights)
+        for (const auto& directionalLight : m_directionalLights)
         {
             if (Component* const component = sceneManager.findComponent(directionalLight.componentUid))
             {
-                DirectionalLightComponent& directionalLightComponent = component->as<DirectionalLightComponent&>();
-                directionalLight = makeDirectionalLightNode(directionalLightComponent);
+                state.directionalLights.push_back(makeDirectionalLightNode(component->as<DirectionalLightComponent&>()));
             }
         }
-        for (auto& light : m_lightNodes)
+
+        for (const auto& light : m_lightNodes)
         {
             if (Component* const component = sceneManager.findComponent(light.componentUid))
             {
                 if (component->is<OmnilightComponent>())
                 {
-                    GraphicsSceneNode::updateFromScene(light, component->as<const SceneComponent&>());
                     OmnilightComponent& omnilightComponent = component->as<OmnilightComponent&>();
-                    m_lights.setLight(light.lightId, render::ClusteredLights::OmniLight{
-                                                         math::float3((omnilightComponent.getWorldTransform().getTranslation()) + omnilightComponent.getShift()),
-                                                         omnilightComponent.getColor(),
-                                                         omnilightComponent.getRadius(),
-                                                         omnilightComponent.getAttenuation(),
-                                                         omnilightComponent.getIntensity(),
-                                                         omnilightComponent.getDebugDraw()});
+                    state.lights.push_back(LightProxy{
+                        light.componentUid,
+                        omnilightComponent.getWorldTransform().getMatrix(),
+                        render::ClusteredLights::OmniLight{
+                            math::float3((omnilightComponent.getWorldTransform().getTranslation()) + omnilightComponent.getShift()),
+                            omnilightComponent.getColor(),
+                            omnilightComponent.getRadius(),
+                            omnilightComponent.getAttenuation(),
+                            omnilightComponent.getIntensity(),
+                            omnilightComponent.getDebugDraw()}});
                 }
                 if (component->is<SpotlightComponent>())
                 {
-                    GraphicsSceneNode::updateFromScene(light, component->as<const SceneComponent&>());
                     SpotlightComponent& spotlightComponent = component->as<SpotlightComponent&>();
-                    m_lights.setLight(light.lightId, render::ClusteredLights::SpotLight{
-                                                         math::float3((spotlightComponent.getWorldTransform().getTranslation()) + spotlightComponent.getShift()),
-                                                         spotlightComponent.getColor(),
-                                                         spotlightComponent.getRadius(),
-                                                         spotlightComponent.getIntensity(),
-                                                         spotlightComponent.getAttenuation(),
-                                                         math::float3(spotlightComponent.getWorldTransform().transformVector(spotlightComponent.getDirection())),
-                                                         spotlightComponent.getAngle(),
-                                                         false,
-                                                         spotlightComponent.getDebugDraw()});
+                    state.lights.push_back(LightProxy{
+                        light.componentUid,
+                        spotlightComponent.getWorldTransform().getMatrix(),
+                        render::ClusteredLights::SpotLight{
+                            math::float3((spotlightComponent.getWorldTransform().getTranslation()) + spotlightComponent.getShift()),
+                            spotlightComponent.getColor(),
+                            spotlightComponent.getRadius(),
+                            spotlightComponent.getIntensity(),
+                            spotlightComponent.getAttenuation(),
+                            math::float3(spotlightComponent.getWorldTransform().transformVector(spotlightComponent.getDirection())),
+                            spotlightComponent.getAngle(),
+                            false,
+                            spotlightComponent.getDebugDraw()}});
                 }
-                // TODO: SpotlightComponent
             }
         }
 
@@ -635,19 +776,151 @@ namespace nau
             if (Component* const component = sceneManager.findComponent(m_envNodes[0].componentUid))
             {
                 EnvironmentComponent& envComponent = component->as<EnvironmentComponent&>();
-                m_envNodes[0].envIntensity = envComponent.getIntensity();
+
+                EnvironmentProxy& proxy = state.environment.emplace();
+                proxy.componentUid = m_envNodes[0].componentUid;
+                proxy.envIntensity = envComponent.getIntensity();
                 if (envComponent.isTextureDirty())
                 {
                     envComponent.resetIsTextureDirty();
-                    m_envNodes[0].newTextureRef = envComponent.getTextureAsset();
+                    proxy.newTextureRef = envComponent.getTextureAsset();
+                    proxy.irradianceRef = envComponent.getIrradianceAsset();
+                    proxy.reflectionRef = envComponent.getReflectionAsset();
+                }
+            }
+        }
+
+        m_renderState.publish();
+    }
+
+    void GraphicsScene::latchSceneState()
+    {
+        NAU_CPU_SCOPED_TAG(nau::PerfTag::Render);
+
+        if (!m_renderState.latch())
+        {
+            return;
+        }
+
+        // With the pipelined frames the scene sync of the next frame reads the node lists concurrently.
+        const std::unique_lock nodesLock(m_nodesMutex);
+
+        SceneRenderState& state = m_renderState.getCurrent();
+
+        for (const StaticMeshProxy& proxy : state.staticMeshes)
+        {
+            const auto meshIndex = m_staticMeshIndices.find(proxy.componentUid);
+            if (meshIndex == m_staticMeshIndices.end())
+            {
+                continue;
+            }
+
+            StaticMeshNode& m = m_staticMeshes[meshIndex->second];
+            if (proxy.materialOverride)
+            {
+                m.materialOverride = proxy.materialOverride;
+            }
+            m.handle->syncState(proxy);
+        }
+
+        for (const SkinnedMeshProxy& proxy : state.skinnedMeshes)
+        {
+            auto mesh = eastl::find_if(m_skinnedMeshes.begin(), m_skinnedMeshes.end(), [&proxy](const SkinnedMeshNode& m)
+            {
+                return m.componentUid == proxy.componentUid;
+            });
+
+            if (mesh == m_skinnedMeshes.end())
+            {
+                continue;
+            }
+
+            if (proxy.materialOverride)
+            {
+                mesh->materialOverride = proxy.materialOverride;
+            }
+
+            SkinnedMeshNode::updateFromProxy(*mesh, proxy);
+        }
+
+        for (SkinnedMeshNode& mesh : m_skinnedMeshes)
+        {
+            mesh.isVisible = mesh.instance->isVisible();
+        }
+
+        for (const BillboardProxy& proxy : state.billboards)
+        {
+            auto bill = eastl::find_if(m_billboards.begin(), m_billboards.end(), [&proxy](const BillboardNode& b)
+            {
+                return b.componentUid == proxy.componentUid;
+            });
+
+            if (bill == m_billboards.end())
+            {
+                continue;
+            }
+
+            bill->worldTransform = proxy.worldTransform;
+            bill->billboardHandle->setScreenPercentageSize(proxy.screenPercentageSize);
+            bill->billboardHandle->setWorldPos(proxy.worldTransform.getTranslation());
+            bill->billboardHandle->setVisibility(proxy.isVisible);
+            if (proxy.overrideTexture)
+            {
+                bill->overrideTexture = proxy.overrideTexture;
+            }
+        }
+
+        for (const DirectionalLightNode& proxy : state.directionalLights)
+        {
+            for (DirectionalLightNode& directionalLight : m_directionalLights)
+            {
+                if (directionalLight.componentUid == proxy.componentUid)
+                {
+                    directionalLight = proxy;
                 }
             }
         }
 
-        syncSceneCameras();
+        for (const LightProxy& proxy : state.lights)
+        {
+            auto light = eastl::find_if(m_lightNodes.begin(), m_lightNodes.end(), [&proxy](const LightNode& l)
+            {
+                return l.componentUid == proxy.componentUid;
+            });
+
+            if (light == m_lightNodes.end())
+            {
+                continue;
+            }
+
+            light->worldTransform = proxy.worldTransform;
+            eastl::visit([&](const auto& lightParams)
+            {
+                m_lights.setLight(light->lightId, lightParams);
+            }, proxy.light);
+        }
+
+        if (state.environment && !m_envNodes.empty() && m_envNodes[0].componentUid == state.environment->componentUid)
+        {
+            EnvironmentNode& envNode = m_envNodes[0];
+            envNode.envIntensity = state.environment->envIntensity;
+            if (state.environment->newTextureRef)
+            {
+                envNode.newTextureRef = state.environment->newTextureRef;
+                envNode.irradianceRef = state.environment->irradianceRef;
+                envNode.reflectionRef = state.environment->reflectionRef;
+            }
+        }
+
+        m_cameras.clear();
+        for (const CameraNode& camera : state.cameras)
+        {
+            m_cameras.emplace(camera.cameraUid, camera);
+        }
+        m_mainCameraUid = state.mainCameraUid;
     }
 
-    void GraphicsScene::syncSceneCameras()
+    void GraphicsScene::syncSceneCameras(SceneRenderState& state)
     {
         using namespace nau::scene;
 
@@ -655,19 +928,31 @@ namespace nau
         {
             NAU_LOG_VERBOSE("Found new camera:({}), uid:({}) from world:({})", cam.getCameraName(), toString(cam.getCameraUid()), toString(cam.getWorldUid()));
 
-            [[maybe_unused]] auto [iter, emplaceCameraOk] = m_cameras.emplace(cam.getCameraUid(), CameraNode{.cameraProperties = Ptr{&cam}});
+            [[maybe_unused]] auto [iter, emplaceCameraOk] = m_gameCameras.emplace(cam.getCameraUid(), CameraNode{.cameraProperties = Ptr{&cam}});
             NAU_ASSERT(emplaceCameraOk);
         };
 
         auto onCameraRemoved = [&](const ICameraProperties& cam)
         {
-            m_cameras.erase(cam.getCameraUid());
+            m_gameCameras.erase(cam.getCameraUid());
         };
 
         getServiceProvider().get<ICameraManager>().syncCameras(m_allInGameCameras, onCameraAdded, onCameraRemoved);
-        for (auto& [uid, camera]: m_cameras)
+
+        state.cameras.reserve(m_gameCameras.size());
+        for (auto& [uid, camera] : m_gameCameras)
         {
             camera.updateFromCamera();
+            state.cameras.push_back(camera);
+        }
+
+        if (Ptr<scene::ICameraProperties> cameraProps = m_allInGameCameras.getWorldMainCamera(m_worldUid))
+        {
+            state.mainCameraUid = cameraProps->getCameraUid();
+        }
+        else if (!m_gameCameras.empty())
+        {
+            state.mainCameraUid = m_gameCameras.begin()->first;
         }
     }
 
@@ -675,16 +960,11 @@ namespace nau
     {
         NAU_ASSERT(!m_cameras.empty());
 
-        Ptr<scene::ICameraProperties> cameraProps = m_allInGameCameras.getWorldMainCamera(m_worldUid);
-        if (cameraProps)
+        if (auto camIter = m_cameras.find(m_mainCameraUid); camIter != m_cameras.end())
         {
-            auto camIter = m_cameras.find(cameraProps->getCameraUid());
-            if (camIter != m_cameras.end())
-            {
-                return (camIter->second);
-            }
+            return camIter->second;
         }
-    
+
         return m_cameras.begin()->second;
     }
 
@@ -695,16 +975,19 @@ namespace nau
 
     void GraphicsScene::setObjectHighlight(nau::Uid uid, bool flag)
     {
-        for (auto& m : m_staticMeshes)
+        if (const auto meshIndex = m_staticMeshIndices.find(uid); meshIndex != m_staticMeshIndices.end())
         {
-            if (uid == m.componentUid)
-            {
-                m.handle->setHighlighted(flag);
-                break;
-            }
+            m_staticMeshes[meshIndex->second].handle->setHighlighted(flag);
+            requestStaticMeshSync(uid);
         }
     }
 
+    void GraphicsScene::requestStaticMeshSync(Uid componentUid)
+    {
+        const std::lock_guard lock(m_staticMeshesToSyncMutex);
+        m_staticMeshesToSync.push_back(componentUid);
+    }
+
     nau::RenderScene* GraphicsScene::getRenderScene()
     {
         return m_renderScene.get();
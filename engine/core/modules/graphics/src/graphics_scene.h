@@ -4,14 +4,17 @@
 
 #pragma once
 
+#include <mutex>
 #include <shared_mutex>
 
 #include "nau/animation/components/skeleton_component.h"
 #include "nau/math/math.h"
 #include "nau/scene/camera/camera_manager.h"
 #include "nau/scene/components/scene_component.h"
+#include "nau/scene/internal/scene_manager_internal.h"
 #include "nau/scene/scene_processor.h"
 #include "nau/shaders/shader_defines.h"
+#include "nau/utils/uid_map.h"
 
 #include "graphics_assets/material_asset.h"
 #include "graphics_assets/static_mesh_asset.h"
@@ -22,6 +25,7 @@
 #include "render/lights/clusteredLights.h"
 
 #include "graphics_nodes.h"
+#include "scene_render_state.h"
 
 
 namespace nau::scene
@@ -48,15 +52,33 @@ namespace nau
 
         void renderFrame(bool withGBuffer = false);
         void renderDepth();
+        /**
+         * The late phase of the GPU occlusion culling (see RenderScene::cullOccluded()): culls by the Hi-Z of the prepass depth
+         * and draws the passed instances into it. The depth must not be bound as the render target.
+         */
+        void renderOccludedDepth(BaseTexture* depth);
         void renderOutlineMask();
         void renderTranslucency();
         void renderLights();
         void renderDebugLights();
         void renderSceneDebug();
         void renderBillboards();
-
+        // The object ids of the picked region: the camera view-projection cropped by the region matrix.
+        void renderPickDepth(const math::Matrix4& regionCrop);
+        void renderPickBillboards(const math::Matrix4& regionCrop);
+
+        /**
+         * Captures the game side state (components and cameras) into the render proxies (see SceneRenderState).
+         * Called on the main thread, does not modify anything used by the render.
+         */
         void syncSceneState();
 
+        /**
+         * The latch point: applies the most recently captured state to the render nodes.
+         * Called by the render at the start of the frame, the frame is rendered with the latched state only.
+         */
+        void latchSceneState();
+
         CameraNode& getMainCamera();
         bool hasCamera();
         bool hasMainCamera() const;
@@ -72,17 +94,36 @@ namespace nau
         nau::RenderScene* getRenderScene();
 
     private:
-        void syncSceneCameras();
+        void syncSceneCameras(SceneRenderState& state);
+
+        /**
+         * Syncs the static mesh with its component on the next syncSceneState, even if the component has not changed.
+         */
+        void requestStaticMeshSync(Uid componentUid);
 
         const Uid m_worldUid;
 
         eastl::vector<StaticMeshNode> m_staticMeshes;
+        UidMap<size_t> m_staticMeshIndices; /** < Maps the component uids to the m_staticMeshes indices. */
+        std::mutex m_staticMeshesToSyncMutex;
+        eastl::vector<Uid> m_staticMeshesToSync; /** < The newly added meshes and the meshes changed by the graphics itself (highlight, material override). */
+        eastl::vector<Uid> m_syncedStaticMeshes; /** < The meshes synced by the current syncSceneState call. */
+        scene::ComponentChangesSubscription m_componentChanges;
         eastl::vector<BillboardNode> m_billboards;
         eastl::vector<SkinnedMeshNode> m_skinnedMeshes;
         eastl::vector<DirectionalLightNode> m_directionalLights;
         eastl::vector<EnvironmentNode> m_envNodes;
         eastl::vector<LightNode> m_lightNodes;
         eastl::unordered_map<Uid, CameraNode> m_cameras;
+        Uid m_mainCameraUid = NullUid;
+
+        // The node lists are modified by the render under the exclusive lock (syncSceneState reads them concurrently)
+        std::shared_mutex m_nodesMutex;
+        RenderProxyBuffer<SceneRenderState> m_renderState;
+
+        // The game side state (accessed only by syncSceneState)
+        eastl::unordered_map<Uid, CameraNode> m_gameCameras;
+        eastl::unordered_map<Uid, Uid> m_skeletonComponents;
 
         render::ClusteredLights m_lights;
         
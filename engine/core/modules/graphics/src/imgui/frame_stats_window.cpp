@@ -0,0 +1,406 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include <imgui.h>
+
+#include <EASTL/algorithm.h>
+#include <EASTL/array.h>
+#include <EASTL/deque.h>
+
+#include "graphics_assets/texture_streaming.h"
+#include "nau/app/main_loop/game_system_timings.h"
+#include "nau/assets/asset_manager.h"
+#include "nau/gui/dag_imgui.h"
+#include "nau/memory/memory_stats.h"
+#include "nau/render/gpu_memory_report.h"
+#include "nau/render/render_frame_stats.h"
+#include "nau/service/service_provider.h"
+
+namespace
+{
+    constexpr auto IMGUI_WINDOW_GROUP = "Performance";
+    constexpr auto IMGUI_FRAME_STATS_WINDOW = "Frame Stats##Frame-Stats";
+
+    constexpr size_t HistorySize = 240;
+    constexpr size_t MaxHitches = 8;
+
+    // The nodes kept in the hitch breakdown: the most expensive by the GPU (or by the CPU when there are no GPU timings).
+    constexpr size_t HitchNodesCount = 8;
+
+    // The GPU memory report walks all the resources: it is refreshed periodically, not every frame.
+    constexpr uint64_t GpuMemoryReportInterval = 30;
+    constexpr size_t GpuMemoryOwnersCount = 16;
+
+    const ImVec4 OverBudgetColor{1.f, 0.3f, 0.3f, 1.f};
+
+    /**
+        The frame which exceeded the budget, with the breakdown known at the moment it was detected.
+     */
+    struct FrameHitch
+    {
+        uint64_t frameIndex = 0;
+        float frameMs = 0.f;
+        nau::render::RenderFrameStats renderStats;
+        eastl::vector<nau::GameSystemTimings> systems;
+    };
+
+    struct FrameStatsState
+    {
+        float budgetMs = 16.6f;
+        bool nodeTimingsEnabled = false;
+
+        eastl::array<float, HistorySize> frameMs = {};
+        eastl::array<float, HistorySize> cpuRenderMs = {};
+        eastl::array<float, HistorySize> gpuFrameMs = {};
+        size_t historyOffset = 0;
+
+        std::chrono::steady_clock::time_point lastFrameTime;
+        uint64_t lastFrameIndex = 0;
+
+        eastl::deque<FrameHitch> hitches;
+
+        nau::render::GpuMemoryReport gpuMemory;
+        uint64_t gpuMemoryFrameIndex = 0;
+    };
+
+    float toMegabytes(uint64_t bytes)
+    {
+        return static_cast<float>(bytes) / (1024.f * 1024.f);
+    }
+
+    void timingText(float ms, float budgetMs)
+    {
+        if (ms < 0.f)
+        {
+            ImGui::TextUnformatted("-");
+        }
+        else if (ms > budgetMs)
+        {
+            ImGui::TextColored(OverBudgetColor, "%.3f", ms);
+        }
+        else
+        {
+            ImGui::Text("%.3f", ms);
+        }
+    }
+
+    void plotHistory(const char* label, const FrameStatsState& state, const eastl::array<float, HistorySize>& values)
+    {
+        const float maxValue = eastl::max(*eastl::max_element(values.begin(), values.end()), state.budgetMs);
+        ImGui::PlotLines(label, values.data(), static_cast<int>(values.size()), static_cast<int>(state.historyOffset), nullptr, 0.f, maxValue * 1.1f, ImVec2(0.f, 60.f));
+    }
+
+    void systemsTable(const char* id, const eastl::vector<nau::GameSystemTimings>& systems, float budgetMs)
+    {
+        if (!ImGui::BeginTable(id, 4, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+        {
+            return;
+        }
+
+        ImGui::TableSetupColumn("System");
+        ImGui::TableSetupColumn("Last, ms");
+        ImGui::TableSetupColumn("Avg, ms");
+        ImGui::TableSetupColumn("Max, ms");
+        ImGui::TableHeadersRow();
+
+        const auto toMs = [](std::chrono::microseconds time)
+        {
+            return static_cast<float>(time.count()) / 1000.f;
+        };
+
+        for (const nau::GameSystemTimings& system : systems)
+        {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(system.name.c_str());
+            ImGui::TableNextColumn();
+            timingText(toMs(system.last), budgetMs);
+            ImGui::TableNextColumn();
+            timingText(toMs(system.average), budgetMs);
+            ImGui::TableNextColumn();
+            timingText(toMs(system.max), budgetMs);
+        }
+
+        ImGui::EndTable();
+    }
+
+    void nodesTable(const char* id, const eastl::vector<nau::render::RenderNodeStats>& nodes, float budgetMs)
+    {
+        if (!ImGui::BeginTable(id, 8, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+        {
+            return;
+        }
+
+        ImGui::TableSetupColumn("Node");
+        ImGui::TableSetupColumn("CPU avg");
+        ImGui::TableSetupColumn("CPU max");
+        ImGui::TableSetupColumn("GPU avg");
+        ImGui::TableSetupColumn("GPU max");
+        ImGui::TableSetupColumn("Draws");
+        ImGui::TableSetupColumn("Instances");
+        ImGui::TableSetupColumn("Triangles");
+        ImGui::TableHeadersRow();
+
+        for (const nau::render::RenderNodeStats& node : nodes)
+        {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(node.name.c_str());
+            ImGui::TableNextColumn();
+            timingText(node.cpuAvgMs, budgetMs);
+            ImGui::TableNextColumn();
+            timingText(node.cpuMaxMs, budgetMs);
+            ImGui::TableNextColumn();
+            timingText(node.gpuAvgMs, budgetMs);
+            ImGui::TableNextColumn();
+            timingText(node.gpuMaxMs, budgetMs);
+            ImGui::TableNextColumn();
+            ImGui::Text("%u", node.drawCalls);
+            ImGui::TableNextColumn();
+            ImGui::Text("%u", node.instances);
+            ImGui::TableNextColumn();
+            ImGui::Text("%llu", static_cast<unsigned long long>(node.triangles));
+        }
+
+        ImGui::EndTable();
+    }
+
+    const char* getGpuMemoryCategoryName(nau::render::GpuMemoryCategory category)
+    {
+        switch (category)
+        {
+            case nau::render::GpuMemoryCategory::Textures:
+                return "Textures";
+            case nau::render::GpuMemoryCategory::RenderTargets:
+                return "Render targets";
+            case nau::render::GpuMemoryCategory::Buffers:
+                return "Buffers";
+            default:
+                return "Upload rings";
+        }
+    }
+
+    void gpuMemoryPoolText(const char* name, const nau::render::GpuMemoryPoolState& pool)
+    {
+        static constexpr const char* PressureNames[] = {"panic", "high", "medium", "low"};
+
+        const char* const pressure = PressureNames[static_cast<size_t>(pool.pressure)];
+        if (pool.pressure <= nau::render::GpuMemoryPressure::High)
+        {
+            ImGui::TextColored(OverBudgetColor, "%s: %.2f / %.2f MB (%.1f%%), pressure %s", name, toMegabytes(pool.usedBytes), toMegabytes(pool.budgetBytes),
+                               pool.getBudgetUsage() * 100.f, pressure);
+        }
+        else
+        {
+            ImGui::Text("%s: %.2f / %.2f MB (%.1f%%), pressure %s", name, toMegabytes(pool.usedBytes), toMegabytes(pool.budgetBytes),
+                        pool.getBudgetUsage() * 100.f, pressure);
+        }
+    }
+
+    void gpuMemoryReport(FrameStatsState& state, uint64_t frameIndex)
+    {
+        if (state.gpuMemoryFrameIndex == 0 || frameIndex >= state.gpuMemoryFrameIndex + GpuMemoryReportInterval)
+        {
+            state.gpuMemory = nau::render::getGpuMemoryReport(GpuMemoryOwnersCount);
+            state.gpuMemoryFrameIndex = eastl::max<uint64_t>(frameIndex, 1);
+        }
+
+        const nau::render::GpuMemoryReport& report = state.gpuMemory;
+        if (!report.isAvailable)
+        {
+            ImGui::TextUnformatted("The driver does not report its memory");
+            return;
+        }
+
+        gpuMemoryPoolText("Device local", report.deviceLocal);
+        gpuMemoryPoolText("Host local", report.hostLocal);
+        ImGui::Text("Heaps: %u, %.2f MB, %.2f MB free, fragmentation %u%% avg, %u%% max", report.heapsCount, toMegabytes(report.heapTotalBytes),
+                    toMegabytes(report.heapFreeBytes), report.averageHeapFragmentationPercent, report.maxHeapFragmentationPercent);
+
+        if (ImGui::BeginTable("GpuMemoryCategories", 3, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+        {
+            ImGui::TableSetupColumn("Category");
+            ImGui::TableSetupColumn("MB");
+            ImGui::TableSetupColumn("Objects");
+            ImGui::TableHeadersRow();
+
+            for (size_t i = 0; i < nau::render::GpuMemoryCategoryCount; ++i)
+            {
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(getGpuMemoryCategoryName(static_cast<nau::render::GpuMemoryCategory>(i)));
+                ImGui::TableNextColumn();
+                ImGui::Text("%.2f", toMegabytes(report.categories[i].bytes));
+                ImGui::TableNextColumn();
+                ImGui::Text("%u", report.categories[i].objectsCount);
+            }
+
+            ImGui::EndTable();
+        }
+
+        if (!report.owners.empty() && ImGui::TreeNode("Largest resources"))
+        {
+            if (ImGui::BeginTable("GpuMemoryOwners", 3, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+            {
+                ImGui::TableSetupColumn("Resource");
+                ImGui::TableSetupColumn("Category");
+                ImGui::TableSetupColumn("MB");
+                ImGui::TableHeadersRow();
+
+                for (const nau::render::GpuMemoryOwner& owner : report.owners)
+                {
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();
+                    ImGui::TextUnformatted(owner.name.c_str());
+                    ImGui::TableNextColumn();
+                    ImGui::TextUnformatted(getGpuMemoryCategoryName(owner.category));
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.2f", toMegabytes(owner.bytes));
+                }
+
+                ImGui::EndTable();
+            }
+            ImGui::TreePop();
+        }
+    }
+
+    void detectHitch(FrameStatsState& state, float frameMs, const nau::render::RenderFrameStats& renderStats)
+    {
+        if (frameMs <= state.budgetMs)
+        {
+            return;
+        }
+
+        FrameHitch& hitch = state.hitches.emplace_front();
+        hitch.frameIndex = renderStats.frameIndex;
+        hitch.frameMs = frameMs;
+        hitch.renderStats = renderStats;
+        hitch.systems = nau::getGameSystemTimings();
+
+        eastl::vector<nau::render::RenderNodeStats>& nodes = hitch.renderStats.nodes;
+        eastl::sort(nodes.begin(), nodes.end(), [](const nau::render::RenderNodeStats& node1, const nau::render::RenderNodeStats& node2)
+        {
+            return eastl::max(node1.gpuMaxMs, node1.cpuMaxMs) > eastl::max(node2.gpuMaxMs, node2.cpuMaxMs);
+        });
+        nodes.resize(eastl::min(nodes.size(), HitchNodesCount));
+
+        if (state.hitches.size() > MaxHitches)
+        {
+            state.hitches.pop_back();
+        }
+    }
+
+    void frame_stats_window()
+    {
+        static FrameStatsState state;
+
+        if (ImGui::Checkbox("Render node timings", &state.nodeTimingsEnabled))
+        {
+            nau::render::setRenderNodeTimingsEnabled(state.nodeTimingsEnabled);
+        }
+        ImGui::SameLine();
+        ImGui::SetNextItemWidth(100.f);
+        ImGui::InputFloat("Frame budget, ms", &state.budgetMs, 0.f, 0.f, "%.1f");
+
+        // The window is drawn once per frame: the history is sampled while the window is open.
+        const auto now = std::chrono::steady_clock::now();
+        const nau::render::RenderFrameStats renderStats = nau::render::getRenderFrameStats();
+        if (renderStats.frameIndex != state.lastFrameIndex)
+        {
+            const float frameMs = state.lastFrameIndex != 0 ? std::chrono::duration<float, std::milli>(now - state.lastFrameTime).count() : 0.f;
+            state.lastFrameTime = now;
+            state.lastFrameIndex = renderStats.frameIndex;
+
+            state.frameMs[state.historyOffset] = frameMs;
+            state.cpuRenderMs[state.historyOffset] = renderStats.cpuRenderMs;
+            state.gpuFrameMs[state.historyOffset] = eastl::max(renderStats.gpuFrameMs, 0.f);
+            state.historyOffset = (state.historyOffset + 1) % HistorySize;
+
+            detectHitch(state, frameMs, renderStats);
+        }
+
+        const size_t lastSample = (state.historyOffset + HistorySize - 1) % HistorySize;
+        ImGui::Text("Frame %llu:", static_cast<unsigned long long>(renderStats.frameIndex));
+        ImGui::SameLine();
+        timingText(state.frameMs[lastSample], state.budgetMs);
+        ImGui::SameLine();
+        ImGui::Text("ms, render CPU %.3f ms, GPU %.3f ms", renderStats.cpuRenderMs, renderStats.gpuFrameMs);
+
+        plotHistory("Frame, ms", state, state.frameMs);
+        plotHistory("Render CPU, ms", state, state.cpuRenderMs);
+        if (state.nodeTimingsEnabled)
+        {
+            plotHistory("GPU, ms", state, state.gpuFrameMs);
+        }
+
+        ImGui::Text("Draws: %u, instances: %u, triangles: %llu, dispatches: %u", renderStats.drawCalls, renderStats.instances,
+                    static_cast<unsigned long long>(renderStats.triangles), renderStats.dispatches);
+        ImGui::Text("Culling: %u visible of %u tested (%u culled)", renderStats.visibleInstances, renderStats.testedInstances,
+                    renderStats.testedInstances - renderStats.visibleInstances);
+
+        if (nau::getServiceProvider().has<nau::IAssetManager>())
+        {
+            const nau::AssetLoadStats loads = nau::getServiceProvider().get<nau::IAssetManager>().getLoadStats();
+            ImGui::Text("Asset loads: %u in flight, %u pending", loads.loadsInFlight, loads.pendingLoads);
+        }
+
+        if (nau::getServiceProvider().has<nau::TextureStreaming>() && nau::getServiceProvider().get<nau::TextureStreaming>().isEnabled())
+        {
+            const nau::TextureStreaming::Stats streaming = nau::getServiceProvider().get<nau::TextureStreaming>().getStats();
+            ImGui::Text("Texture streaming: %u loading", streaming.pendingLoadsCount);
+        }
+
+        const nau::MemoryStatsSnapshot memory = nau::getMemoryStatsSnapshot();
+        int64_t allocatedBytes = 0;
+        for (nau::MemoryTag tag : nau::EnumTraits<nau::MemoryTag>::getValues())
+        {
+            allocatedBytes += memory[tag].currentBytes;
+        }
+        ImGui::Text("Memory: %.2f MB allocated, VRAM %.2f / %.2f MB", toMegabytes(static_cast<uint64_t>(eastl::max<int64_t>(allocatedBytes, 0))),
+                    toMegabytes(uint64_t(renderStats.vramUsedKb) * 1024), toMegabytes(uint64_t(renderStats.vramBudgetKb) * 1024));
+
+        if (ImGui::CollapsingHeader("Game systems", ImGuiTreeNodeFlags_DefaultOpen))
+        {
+            systemsTable("GameSystems", nau::getGameSystemTimings(), state.budgetMs);
+        }
+
+        if (ImGui::CollapsingHeader("GPU memory"))
+        {
+            gpuMemoryReport(state, renderStats.frameIndex);
+        }
+
+        if (state.nodeTimingsEnabled && ImGui::CollapsingHeader("Render nodes", ImGuiTreeNodeFlags_DefaultOpen))
+        {
+            // A single node is highlighted when it takes a quarter of the frame budget alone.
+            nodesTable("RenderNodes", renderStats.nodes, state.budgetMs * 0.25f);
+        }
+
+        if (ImGui::CollapsingHeader("Hitches"))
+        {
+            if (ImGui::Button("Clear"))
+            {
+                state.hitches.clear();
+            }
+
+            for (const FrameHitch& hitch : state.hitches)
+            {
+                ImGui::PushID(&hitch);
+                if (ImGui::TreeNode("Hitch", "Frame %llu: %.3f ms", static_cast<unsigned long long>(hitch.frameIndex), hitch.frameMs))
+                {
+                    ImGui::Text("Render CPU %.3f ms, GPU %.3f ms, draws %u, triangles %llu", hitch.renderStats.cpuRenderMs, hitch.renderStats.gpuFrameMs,
+                                hitch.renderStats.drawCalls, static_cast<unsigned long long>(hitch.renderStats.triangles));
+                    systemsTable("HitchSystems", hitch.systems, state.budgetMs);
+                    if (!hitch.renderStats.nodes.empty())
+                    {
+                        nodesTable("HitchNodes", hitch.renderStats.nodes, state.budgetMs * 0.25f);
+                    }
+                    ImGui::TreePop();
+                }
+                ImGui::PopID();
+            }
+        }
+    }
+}  // namespace
+
+REGISTER_IMGUI_WINDOW(IMGUI_WINDOW_GROUP, IMGUI_FRAME_STATS_WINDOW, frame_stats_window);
@@ -9,6 +9,7 @@
 #include <implot.h>
 #include <EASTL/unique_ptr.h>
 #include <EASTL/vector.h>
+#include <mutex>
 #include "nau/3d/dag_drv3d.h"
 #include "nau/3d/dag_drv3dReset.h"
 #include "nau/perfMon/dag_cpuFreq.h"
@@ -42,8 +43,12 @@ static bool frameEnded = true;
 
 static bool imguiSubmenuEnabled = true;
 
+// The draw data goes through three slots, so the game and the render threads never touch the same data:
+// cached (built by the game thread), published (by the scene sync, guarded by the mutex), copied (latched and rendered by the render thread).
 ImDrawData* cachedDrawData = nullptr;
+ImDrawData* publishedDrawData = nullptr;
 ImDrawData* copiedDrawData = nullptr;
+static std::mutex publishedDrawDataMutex;
 
 //void imgui_set_override_blk(const nau::DataBlock &imgui_blk_)
 //{
@@ -203,6 +208,12 @@ void imgui_shutdown()
       cachedDrawData = nullptr;
   }
 
+  if(publishedDrawData)
+  {
+      deleteDrawData(publishedDrawData);
+      publishedDrawData = nullptr;
+  }
+
   if(copiedDrawData)
   {
       deleteDrawData(copiedDrawData);
@@ -328,14 +339,40 @@ void imgui_copy_render_data()
         return;
     }
 
+    // With the pipelined frames the render can still be drawing the copied data: only the published slot is replaced here
+    ImDrawData* droppedDrawData = nullptr;
+    {
+        const std::lock_guard lock(publishedDrawDataMutex);
+        droppedDrawData = publishedDrawData;
+        publishedDrawData = cachedDrawData;
+    }
+    cachedDrawData = nullptr;
+
+    if(droppedDrawData)
+    {
+        deleteDrawData(droppedDrawData);
+    }
+}
+
+void imgui_latch_render_data()
+{
+    ImDrawData* latchedDrawData = nullptr;
+    {
+        const std::lock_guard lock(publishedDrawDataMutex);
+        latchedDrawData = publishedDrawData;
+        publishedDrawData = nullptr;
+    }
+
+    if(latchedDrawData == nullptr)
+    {
+        return;
+    }
+
     if(copiedDrawData)
     {
         deleteDrawData(copiedDrawData);
-        copiedDrawData = nullptr;
     }
-
-    copiedDrawData = std::move(cachedDrawData);
-    cachedDrawData = nullptr;
+    copiedDrawData = latchedDrawData;
 }
 
 
@@ -0,0 +1,118 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include <imgui.h>
+
+#include "graphics_assets/texture_streaming.h"
+#include "nau/gui/dag_imgui.h"
+#include "nau/memory/memory_stats.h"
+#include "nau/service/service_provider.h"
+
+namespace
+{
+    constexpr auto IMGUI_WINDOW_GROUP = "Memory";
+    constexpr auto IMGUI_MEMORY_STATS_WINDOW = "Memory Stats##Memory-Stats";
+
+    // Rates are averaged over this interval, otherwise values are jumping every frame.
+    constexpr std::chrono::milliseconds RatesUpdateInterval{500};
+
+    float toMegabytes(int64_t bytes)
+    {
+        return static_cast<float>(bytes) / (1024.f * 1024.f);
+    }
+
+    void memory_stats_window()
+    {
+        static nau::MemoryStatsSnapshot rateSnapshot = nau::getMemoryStatsSnapshot();
+        static std::array<double, nau::MemoryTagsCount> allocationsRates = {};
+        static std::array<double, nau::MemoryTagsCount> bytesRates = {};
+
+        const nau::MemoryStatsSnapshot snapshot = nau::getMemoryStatsSnapshot();
+        if (snapshot.timestamp - rateSnapshot.timestamp >= RatesUpdateInterval)
+        {
+            for (nau::MemoryTag tag : nau::EnumTraits<nau::MemoryTag>::getValues())
+            {
+                allocationsRates[static_cast<size_t>(tag)] = snapshot.getAllocationsRate(rateSnapshot, tag);
+                bytesRates[static_cast<size_t>(tag)] = snapshot.getAllocatedBytesRate(rateSnapshot, tag);
+            }
+            rateSnapshot = snapshot;
+        }
+
+        ImGui::TextDisabled("Tracked: slab allocator, EASTL containers, lua. Not tracked: global new/malloc, std containers, backend allocators.");
+        ImGui::Text("Slab reserved: %.2f MB", toMegabytes(static_cast<int64_t>(snapshot.slabReservedBytes)));
+        if (snapshot.largePageRequestedBytes > 0)
+        {
+            ImGui::Text("Large pages: %.2f / %.2f MB", toMegabytes(static_cast<int64_t>(snapshot.largePageBytes)),
+                        toMegabytes(static_cast<int64_t>(snapshot.largePageRequestedBytes)));
+        }
+
+        if (nau::getServiceProvider().has<nau::TextureStreaming>() && nau::getServiceProvider().get<nau::TextureStreaming>().isEnabled())
+        {
+            const nau::TextureStreaming::Stats streaming = nau::getServiceProvider().get<nau::TextureStreaming>().getStats();
+            ImGui::Text("Streamed textures: %.2f / %.2f MB, %u textures, %u loading", toMegabytes(static_cast<int64_t>(streaming.residentBytes)),
+                        toMegabytes(static_cast<int64_t>(streaming.budgetBytes)), streaming.streamedTexturesCount, streaming.pendingLoadsCount);
+        }
+
+        if (!ImGui::BeginTable("MemoryTags", 7, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+        {
+            return;
+        }
+
+        ImGui::TableSetupColumn("Tag");
+        ImGui::TableSetupColumn("Current, MB");
+        ImGui::TableSetupColumn("Peak, MB");
+        ImGui::TableSetupColumn("Budget, MB");
+        ImGui::TableSetupColumn("Alive blocks");
+        ImGui::TableSetupColumn("Allocs/s");
+        ImGui::TableSetupColumn("MB/s");
+        ImGui::TableHeadersRow();
+
+        for (nau::MemoryTag tag : nau::EnumTraits<nau::MemoryTag>::getValues())
+        {
+            const nau::MemoryTagStats& stats = snapshot[tag];
+            const size_t tagIndex = static_cast<size_t>(tag);
+
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            const std::string_view tagName = nau::EnumTraits<nau::MemoryTag>::toString(tag);
+            ImGui::TextUnformatted(tagName.data(), tagName.data() + tagName.size());
+
+            ImGui::TableNextColumn();
+            if (stats.isOverBudget())
+            {
+                ImGui::TextColored(ImVec4(1.f, 0.3f, 0.3f, 1.f), "%.2f", toMegabytes(stats.currentBytes));
+            }
+            else
+            {
+                ImGui::Text("%.2f", toMegabytes(stats.currentBytes));
+            }
+
+            ImGui::TableNextColumn();
+            ImGui::Text("%.2f", toMegabytes(stats.peakBytes));
+
+            ImGui::TableNextColumn();
+            if (stats.budgetBytes > 0)
+            {
+                ImGui::Text("%.2f", toMegabytes(static_cast<int64_t>(stats.budgetBytes)));
+            }
+            else
+            {
+                ImGui::TextUnformatted("-");
+            }
+
+            ImGui::TableNextColumn();
+            ImGui::Text("%llu", static_cast<unsigned long long>(stats.allocationsCount - stats.deallocationsCount));
+
+            ImGui::TableNextColumn();
+            ImGui::Text("%.0f", allocationsRates[tagIndex]);
+
+            ImGui::TableNextColumn();
+            ImGui::Text("%.2f", static_cast<float>(bytesRates[tagIndex] / (1024.0 * 1024.0)));
+        }
+
+        ImGui::EndTable();
+    }
+}  // namespace
+
+REGISTER_IMGUI_WINDOW(IMGUI_WINDOW_GROUP, IMGUI_MEMORY_STATS_WINDOW, memory_stats_window);
@@ -107,6 +107,8 @@ namespace nau::csm
                 settings.cascadeWidth = width;
                 createDepthShadow(settings.splitsW, settings.splitsH, settings.cascadeWidth, settings.cascadeWidth,
                     settings.cascadeDepthHighPrecision);
+                // The cached cascades were in the old texture.
+                invalidate();
             }
         }
         void renderShadowsCascades();
@@ -127,6 +129,7 @@ namespace nau::csm
         int getNumCascadesToRender() const { return numCascadesToRender; }
         const Vector2& getZnZf(int cascade_no) const { return shadowSplits[cascade_no].znzf; }
         const NauFrustum& getFrustum(int cascade_no) const { return shadowSplits[cascade_no].frustum; }
+        const NauFrustum& getCasterCullingFrustum(int cascade_no) const { return shadowSplits[cascade_no].casterFrustum; }
         const Vector3& getRenderCameraWorldViewPos(int cascade_no) const { return shadowSplits[cascade_no].viewPos; }
         const Matrix4& getShadowViewItm(int cascade_no) const { return shadowSplits[cascade_no].shadowViewItm; }
         const Matrix4& getCameraRenderMatrix(int cascade_no) const { return shadowSplits[cascade_no].cameraRenderMatrix; }
@@ -145,6 +148,7 @@ namespace nau::csm
         {
             shadowSplits[cascade_no] = sparsedShadowSplits[cascade_no];
             shadowSplits[cascade_no].frustum.construct(shadowSplits[cascade_no].worldCullingMatrix);
+            constructCasterFrustum(shadowSplits[cascade_no]);
         }
 
         float getMaxDistance() const { return modeSettings.maxDist; }
@@ -183,6 +187,7 @@ namespace nau::csm
             Matrix4 renderViewMatrix;
             Matrix4 renderProjMatrix;
             NauFrustum frustum;
+            NauFrustum casterFrustum;
             BBox3 worldBox;
             IBBox2 viewport;
             uint16_t frames; // how many frames it was not updated
@@ -194,6 +199,7 @@ namespace nau::csm
         CascadeShadows::ModeSettings modeSettings;
         bool dbgModeSettings;
         NauFrustum wholeCoveredSpaceFrustum;
+        Vector3 dirToSun = Vector3(0.f, 0.f, 0.f);
 
 
         ResPtr<BaseTexture> shadowCascades;
@@ -220,6 +226,7 @@ namespace nau::csm
         IBBox2 getViewPort(int cascade, const IVector2& tex_width) const;
         Matrix4 getShadowViewMatrix(const Vector3& dir_to_sun, const Vector3& camera_pos, bool world_space);
         void setFadeOutToShaders(float max_dist);
+        void constructCasterFrustum(ShadowSplit& split) const;
 
         void buildShadowProjectionMatrix(uint32_t cascadeNo, const Vector3& dir_to_sun, const Matrix4& view_matrix, const Vector3& camera_pos,
             const Matrix4& projtm, float z_near, float z_far, float next_z_far, const Vector3& anchor, ShadowSplit& split);
@@ -454,6 +461,13 @@ namespace nau::csm
 
         NAU_ASSERT(modeSettings.numCascades <= settings.splitsW * settings.splitsH);
 
+        // The cached cascades were rendered with the previous light direction.
+        if (lengthSqr(dir_to_sun - dirToSun) > 1e-8f)
+        {
+            invalidate();
+            dirToSun = dir_to_sun;
+        }
+
         eastl::array<float, CascadeShadows::MAX_CASCADES> distances;
         int cascades = modeSettings.numCascades;
         float znear = scene_z_near_far.getX();
@@ -506,6 +520,7 @@ namespace nau::csm
             float minSparseDist;
             int minSparseFrame;
             ss.frustum.construct(ss.worldCullingMatrix);
+            constructCasterFrustum(ss);
             client->getCascadeShadowSparseUpdateParams(cascadeNo, ss.frustum, minSparseDist, minSparseFrame);
 
             if ((ss.from < minSparseDist || shadowSplits[cascadeNo].frames >= minSparseFrame + cascadeNo) && !force_no_update_shadows)
@@ -515,8 +530,9 @@ namespace nau::csm
             }
             else
             {
-                bool shouldUpdate = false;
-                if (minSparseDist >= 0.f) // Negative value indicates the camera direction may be ignored.
+                // The cached depth is of the previous casters.
+                bool shouldUpdate = client->isCascadeShadowCastersChanged(cascadeNo, shadowSplits[cascadeNo].casterFrustum);
+                if (!shouldUpdate && minSparseDist >= 0.f) // Negative value indicates the camera direction may be ignored.
                 {
                     NauFrustum shadowFrustum = view_frustum;
                     Vector4 curViewPos = Vector4(ss.viewPos);
@@ -528,22 +544,16 @@ namespace nau::csm
                     Vector3 frustumPoints[8];
                     shadowFrustum.generateAllPointFrustm(frustumPoints);
 
-                    for (int pt = 0; pt < 8; ++pt)
+                    // The camera slice is not covered by the cached cascade: one of its corners is outside of the cascade frustum.
+                    for (int pt = 0; pt < 8 && !shouldUpdate; ++pt)
                     {
-                        Vector3 v_pt = frustumPoints[pt];
-                        Vector4 invisible = Vector4(0, 0, 0, 0);
                         for (int plane = 0; plane < 6; ++plane)
                         {
-                            invisible = Vector4(
-                                _mm_or_ps(invisible.get128(),
-                                    Vector4(distFromPlane(Point3(v_pt), shadowSplits[cascadeNo].frustum.camPlanes[plane])).get128()));
-                        }
-                        //invisible = v_and(invisible, v_msbit());
-                        //if (!v_test_vec_x_eqi_0(invisible))
-                        if (int(invisible.getX()) != 0.0f)
-                        {
-                            shouldUpdate = true;
-                            break;
+                            if (float(distFromPlane(Point3(frustumPoints[pt]), shadowSplits[cascadeNo].frustum.camPlanes[plane])) < 0.f)
+                            {
+                                shouldUpdate = true;
+                                break;
+                            }
                         }
                     }
                 }
@@ -581,6 +591,7 @@ namespace nau::csm
         for (int cascadeNo = 0; cascadeNo < cascades; cascadeNo++)
         {
             shadowSplits[cascadeNo].frustum.construct(shadowSplits[cascadeNo].worldCullingMatrix);
+            constructCasterFrustum(shadowSplits[cascadeNo]);
         }
         createOverrides();
 
@@ -890,6 +901,22 @@ namespace nau::csm
     }
 
 
+    void CascadeShadowsPrivate::constructCasterFrustum(ShadowSplit& split) const
+    {
+        // The plane facing the sun has the inward normal looking away from it: it is moved towards the sun,
+        // the casters between the sun and the cascade are rendered with the clamped depth (see USE_SHADOW_DEPTH_CLAMP).
+        NauFrustum& frustum = split.casterFrustum;
+        frustum = split.frustum;
+        const bool isNearFacingSun = float(dot(frustum.camPlanes[NauFrustum::NEARPLANE].getXYZ(), dirToSun)) <
+            float(dot(frustum.camPlanes[NauFrustum::FARPLANE].getXYZ(), dirToSun));
+        const int sunPlane = isNearFacingSun ? NauFrustum::NEARPLANE : NauFrustum::FARPLANE;
+        frustum.camPlanes[sunPlane].setW(frustum.camPlanes[sunPlane].getW() + settings.casterCullingExtension);
+
+        // See NauFrustum::construct().
+        frustum.plane4W2 = Vector4(frustum.camPlanes[NauFrustum::FARPLANE].getXYZ(), frustum.camPlanes[NauFrustum::FARPLANE].getW() * 2.f);
+        frustum.plane5W2 = Vector4(frustum.camPlanes[NauFrustum::NEARPLANE].getXYZ(), frustum.camPlanes[NauFrustum::NEARPLANE].getW() * 2.f);
+    }
+
     void CascadeShadowsPrivate::setFadeOutToShaders(float max_dist)
     {
         NAU_ASSERT(settings.shadowFadeOut > 0.f);
@@ -999,6 +1026,7 @@ namespace nau::csm
     int CascadeShadows::getNumCascadesToRender() const { return d->getNumCascadesToRender(); }
 
     const NauFrustum& CascadeShadows::getFrustum(int cascade_no) const { return d->getFrustum(cascade_no); }
+    const NauFrustum& CascadeShadows::getCasterCullingFrustum(int cascade_no) const { return d->getCasterCullingFrustum(cascade_no); }
     const Vector3& CascadeShadows::getRenderCameraWorldViewPos(int cascade_no) const { return d->getRenderCameraWorldViewPos(cascade_no); }
 
     const Matrix4& CascadeShadows::getShadowViewItm(int cascade_no) const { return d->getShadowViewItm(cascade_no); }
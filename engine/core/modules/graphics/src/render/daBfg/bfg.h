@@ -10,6 +10,7 @@
 #include "render/daBfg/registry.h"
 #include "render/daBfg/multiplexing.h"
 #include "render/daBfg/externalState.h"
+#include "nau/3d/dag_drv3dConsts.h"
 
 #include "nau/math/math.h"
 
@@ -48,6 +49,19 @@ void shutdown();
 /// \brief Sets various global state that is external to daBfg.
 void update_external_state(ExternalState state);
 
+/**
+ * \brief The pipeline the currently executed node submits its dispatches to.
+ * \details GpuPipeline::ASYNC_COMPUTE only for the nodes declared with
+ * \ref Registry::executeAsyncCompute when the driver supports it.
+ */
+GpuPipeline current_gpu_pipeline();
+
+/**
+ * \brief Enables or disables the execution of a node.
+ * \details A disabled node keeps its place in the schedule and its
+ * resources: toggling it does not invalidate the compiled graph and
+ * costs nothing beyond skipping the execution callback.
+ */
 inline void set_node_enabled(const NodeHandle& nodeHandle, bool enabled)
 {
     return root().setNodeEnabled(nodeHandle, enabled);
@@ -0,0 +1,49 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+
+// Copyright (C) 2024  Gaijin Games KFT.  All rights reserved
+#pragma once
+
+#include <EASTL/string.h>
+#include <EASTL/vector.h>
+
+
+namespace dabfg
+{
+
+/// \brief Execution cost of a node over the recently profiled frames, in milliseconds.
+struct NodeTimings
+{
+  eastl::string name;
+  uint32_t framesCount = 0;
+
+  float cpuMin = 0.f;
+  float cpuAvg = 0.f;
+  float cpuMax = 0.f;
+
+  /// The GPU values are negative when the driver provides no timestamps.
+  float gpuMin = -1.f;
+  float gpuAvg = -1.f;
+  float gpuMax = -1.f;
+
+  /// The draws of the node in the newest profiled frame, zero when the driver does not count the draws.
+  uint32_t drawCalls = 0;
+  uint32_t instances = 0;
+  uint64_t triangles = 0;
+};
+
+/**
+ * \brief Turns on the CPU timings and the GPU timestamp queries around
+ * every executed node. Off by default: the queries are not free.
+ */
+void set_node_timings_enabled(bool enabled);
+bool is_node_timings_enabled();
+
+/**
+ * \brief Returns the timings of the nodes executed within the recently
+ * profiled frames, in the execution order of the latest one.
+ * \details A frame gets into the statistics when its GPU timestamps are
+ * read back, i.e. a few frames after it was executed.
+ */
+eastl::vector<NodeTimings> get_node_timings();
+
+} // namespace dabfg
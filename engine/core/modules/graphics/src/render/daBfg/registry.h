@@ -11,6 +11,7 @@
 #include "render/daBfg/sideEffects.h"
 #include "render/daBfg/nameSpaceRequest.h"
 #include "render/daBfg/virtualResourceCreationSemiRequest.h"
+#include "nau/generic/dag_fixedMoveOnlyFunction.h"
 
 
 namespace dabfg
@@ -93,6 +94,34 @@ public:
    */
   Registry executionHas(SideEffects side_effect);
 
+  /**
+   * \brief Marks the node as compute only: when the driver supports
+   * \ref GpuPipeline::ASYNC_COMPUTE, its dispatches are submitted to the
+   * async compute queue and overlap the graphics nodes that do not depend
+   * on it. The scheduler runs such nodes as early as their dependencies allow.
+   *
+   * The node must dispatch with GpuPipeline::ASYNC_COMPUTE (see \ref current_gpu_pipeline)
+   * and must not draw. Its resources are transitioned on the graphics queue.
+   */
+  Registry executeAsyncCompute();
+
+  /// \brief The CPU only part of the node work, see \ref prepareOnWorkerThread.
+  using PrepareCallback = nau::FixedMoveOnlyFunction<128, void(multiplexing::Index)>;
+
+  /**
+   * \brief Moves the CPU only work of the node (culling, instance data, draw lists) to a worker thread.
+   * The callback is called every frame before the node is executed, in parallel with the preparation
+   * of the other nodes and with the execution of the nodes scheduled before it. It starts only after
+   * the callbacks of the nodes this node depends on are completed.
+   *
+   * The callback must not call the driver and must not access the node resources: the commands are
+   * still recorded by the execution callback on the render thread, in the graph order, with the barriers
+   * computed from the compiled graph.
+   *
+   * \param callback The callback taking the multiplexing index of the prepared node instance.
+   */
+  Registry prepareOnWorkerThread(PrepareCallback callback);
+
   /**
    * \brief Requests a certain global state for the execution time of this node.
    *
@@ -45,9 +45,28 @@ namespace nau::render
         {
             return std::max(static_cast<uint32_t>(texSize * std::pow(0.5f, mipLevel)), 1u);
         }
+
+        static uint32_t selectCubemapsFormat()
+        {
+            // The sky radiance fits the 11/10 bits floats: 4 bytes per texel instead of 16.
+            constexpr unsigned RequiredUsage = d3d::USAGE_UNORDERED | d3d::USAGE_RTARGET | d3d::USAGE_FILTER;
+            for (const uint32_t format : {TEXFMT_R11G11B10F, TEXFMT_A16B16G16R16F})
+            {
+                if ((d3d::get_texformat_usage(format, RES3D_CUBETEX) & RequiredUsage) == RequiredUsage)
+                {
+                    return format;
+                }
+            }
+            return TEXFMT_A32B32G32R32F;
+        }
     }  // namespace details
 
-    EnvironmentRenderer::~EnvironmentRenderer() = default;
+    EnvironmentRenderer::~EnvironmentRenderer()
+    {
+        del_d3dres(m_envCubemapTexture);
+        del_d3dres(m_irradianceMap);
+        del_d3dres(m_reflectionMap);
+    }
 
     EnvironmentRenderer::EnvironmentRenderer(MaterialAssetView::Ptr envCubemapMaterial, ShaderAssetView::Ptr panoramaToCubemapComputeShader, ShaderAssetView::Ptr genIrradianceMapComputeShader, ShaderAssetView::Ptr genReflectionMapComputeShader) :
         m_envCubemapMaterial(envCubemapMaterial),
@@ -57,10 +76,8 @@ namespace nau::render
     {
         createSkyboxIndexBuffer();
 
-        m_envCubemapTexture = d3d::create_cubetex(CUBEMAP_ENV_FACE_SIZE, TEXFMT_A32B32G32R32F | TEXCF_RTARGET | TEXCF_UNORDERED, 0);
-
-        m_irradianceMap = d3d::create_cubetex(IRRADIANCE_MAP_FACE_SIZE, TEXFMT_A32B32G32R32F | TEXCF_RTARGET | TEXCF_UNORDERED, 1);  // no mips
-        m_reflectionMap = d3d::create_cubetex(REFLECTION_MAP_FACE_SIZE, TEXFMT_A32B32G32R32F | TEXCF_RTARGET | TEXCF_UNORDERED, 0);
+        m_cubemapsFormat = details::selectCubemapsFormat();
+        m_envCubemapTexture = d3d::create_cubetex(CUBEMAP_ENV_FACE_SIZE, m_cubemapsFormat | TEXCF_RTARGET | TEXCF_UNORDERED, 0);
 
         d3d::SamplerInfo csTexSamplerInfo;
         m_csTexSampler = d3d::create_sampler(csTexSamplerInfo);
@@ -76,6 +93,35 @@ namespace nau::render
         m_envCubemapsDirty = true;
     }
 
+    void EnvironmentRenderer::setPrefilteredMaps(ReloadableAssetView::Ptr irradianceMap, ReloadableAssetView::Ptr reflectionMap)
+    {
+        m_prefilteredIrradianceView = irradianceMap;
+        m_prefilteredReflectionView = reflectionMap;
+        m_envCubemapsDirty = true;
+    }
+
+    bool EnvironmentRenderer::hasPrefilteredMaps() const
+    {
+        return getCubeTexture(m_prefilteredIrradianceView) && getCubeTexture(m_prefilteredReflectionView);
+    }
+
+    CubeTexture* EnvironmentRenderer::getCubeTexture(const ReloadableAssetView::Ptr& textureView)
+    {
+        if (!textureView)
+        {
+            return nullptr;
+        }
+
+        nau::Ptr<TextureAssetView> texture;
+        textureView->getTyped<TextureAssetView>(texture);
+        if (!texture || !texture->getTexture() || texture->getTexture()->restype() != RES3D_CUBETEX)
+        {
+            return nullptr;
+        }
+
+        return texture->getTexture();
+    }
+
     CubeTexture* EnvironmentRenderer::getEnvCubemap() const
     {
         return m_envCubemapTexture;
@@ -83,11 +129,11 @@ namespace nau::render
 
     CubeTexture* EnvironmentRenderer::getIrradianceMap() const
     {
-        return m_irradianceMap;
+        return hasPrefilteredMaps() ? getCubeTexture(m_prefilteredIrradianceView) : m_irradianceMap;
     }
     CubeTexture* EnvironmentRenderer::getReflectionMap() const
     {
-        return m_reflectionMap;
+        return hasPrefilteredMaps() ? getCubeTexture(m_prefilteredReflectionView) : m_reflectionMap;
     }
 
     void EnvironmentRenderer::createSkyboxIndexBuffer()
@@ -155,13 +201,18 @@ namespace nau::render
             uint32_t cbData[4] = {uint32_t(faceIndex), CUBEMAP_ENV_FACE_SIZE, 0, 0};
             d3d::set_const(STAGE_CS, 0, &cbData[0], 1);
 
-            d3d::dispatch(csPanoramaToCubeMapGroupCount.getX(), csPanoramaToCubeMapGroupCount.getY(), csPanoramaToCubeMapGroupCount.getZ(), GpuPipeline::ASYNC_COMPUTE);
+            d3d::dispatch(csPanoramaToCubeMapGroupCount.getX(), csPanoramaToCubeMapGroupCount.getY(), csPanoramaToCubeMapGroupCount.getZ());
         }
         m_envCubemapTexture->generateMips();
     }
 
-    void EnvironmentRenderer::generateIrradianceMap()
+    void EnvironmentRenderer::generateIrradianceMap(GpuPipeline gpuPipeline)
     {
+        if (!m_irradianceMap)
+        {
+            m_irradianceMap = d3d::create_cubetex(IRRADIANCE_MAP_FACE_SIZE, m_cubemapsFormat | TEXCF_RTARGET | TEXCF_UNORDERED, 1);  // no mips
+        }
+
         const math::vec3 workgroupSize{CS_ENV_CUBEMAPS_BLOCK_SIZE, CS_ENV_CUBEMAPS_BLOCK_SIZE, 1};
         math::ivec3 genIrradianceGroupCount = details::calculateWorkGroupCount(IRRADIANCE_MAP_FACE_SIZE, workgroupSize);
 
@@ -178,12 +229,17 @@ namespace nau::render
             uint32_t cbData[4] = {uint32_t(faceIndex), IRRADIANCE_MAP_FACE_SIZE, 0, 0};
             d3d::set_const(STAGE_CS, 0, &cbData[0], 1);
 
-            d3d::dispatch(genIrradianceGroupCount.getX(), genIrradianceGroupCount.getY(), genIrradianceGroupCount.getZ(), GpuPipeline::ASYNC_COMPUTE);
+            d3d::dispatch(genIrradianceGroupCount.getX(), genIrradianceGroupCount.getY(), genIrradianceGroupCount.getZ(), gpuPipeline);
         }
     }
 
-    void EnvironmentRenderer::generateReflectionMap()
+    void EnvironmentRenderer::generateReflectionMap(GpuPipeline gpuPipeline)
     {
+        if (!m_reflectionMap)
+        {
+            m_reflectionMap = d3d::create_cubetex(REFLECTION_MAP_FACE_SIZE, m_cubemapsFormat | TEXCF_RTARGET | TEXCF_UNORDERED, 0);
+        }
+
         d3d::set_program(m_genReflectionMapCSProgram);
         d3d::set_cs_constbuffer_size(4);
 
@@ -211,7 +267,7 @@ namespace nau::render
                 d3d::set_rwtex(STAGE_CS, 0, m_reflectionMap, faceIndex, mipLevel, false);
                 d3d::set_const(STAGE_CS, 0, &cbData[0], 1);
 
-                d3d::dispatch(groupCount.getX(), groupCount.getY(), groupCount.getZ(), GpuPipeline::ASYNC_COMPUTE);
+                d3d::dispatch(groupCount.getX(), groupCount.getY(), groupCount.getZ(), gpuPipeline);
             }
         }
     }
@@ -5,6 +5,8 @@
 #include "render/lights/clusteredLights.h"
 
 #include "nau/3d/dag_lockSbuffer.h"
+#include "nau/app/global_properties.h"
+#include "nau/service/service_provider.h"
 #include "nau/shaders/shader_globals.h"
 #include "nau/utils/dag_stlqsort.h"
 
@@ -144,6 +146,10 @@ namespace nau::render
         closeOmni();
         closeSpot();
         closeLightMaterial();
+        gpuClustering.reset();
+        isGpuClustered = false;
+        omniItemMasks.reset();
+        spotItemMasks.reset();
         shaders::overrides::destroy(depthBiasOverrideId);
     }
 
@@ -334,6 +340,11 @@ namespace nau::render
 
         // TIME_PROFILE(cullFrustumLights);
         buffersFilled = false;
+        // The GPU clustering does not limit the froxel slices by the occlusion depth: the lights are binned on the CPU when it is available.
+        isGpuClustered = gpuClustering && !occlusion;
+        // The GPU clustering reads the lights from the structured buffers: they are not limited by the constant buffers size.
+        const int maxOmniLights = isGpuClustered ? int(GpuLightClustering::MaxLights) : MAX_OMNI_LIGHTS;
+        const int maxSpotLights = isGpuClustered ? int(GpuLightClustering::MaxLights) : MAX_SPOT_LIGHTS;
         NauFrustum frustum(globtm);
         Vector4 clusteredLastPlane = shrink_zfar_plane(frustum.camPlanes[4], cur_view_pos, Vector4(maxClusteredDist));
 
@@ -342,7 +353,7 @@ namespace nau::render
 
         visibleOmniLightsIdSet.reset();
         visibleOmniLightsId.clear();
-        eastl::vector<uint16_t> visibleFarOmniLightsId;  // TODO: Use frame allocator
+        visibleFarOmniLightsId.clear();
         omniLights.prepare(frustum,
                            visibleOmniLightsId,
                            visibleFarOmniLightsId,
@@ -356,7 +367,7 @@ namespace nau::render
                            cur_view_pos,
                            omni_light_mask);
 
-        if (visibleOmniLightsId.size() > MAX_OMNI_LIGHTS)
+        if (visibleOmniLightsId.size() > maxOmniLights)
         {
             // Spotlights were always sorted, this is only here to move the farthests ones into the far buffer.
             stlsort::sort(visibleOmniLightsId.begin(), visibleOmniLightsId.end(), [this, &cur_view_pos](uint16_t i, uint16_t j)
@@ -366,8 +377,8 @@ namespace nau::render
                 return distI < distJ;
             });
             auto oldFarSize = visibleFarOmniLightsId.size();
-            auto excessSize = visibleOmniLightsId.size() - MAX_OMNI_LIGHTS;
-            for (int k = MAX_OMNI_LIGHTS; k < MAX_OMNI_LIGHTS + excessSize; ++k)
+            auto excessSize = visibleOmniLightsId.size() - maxOmniLights;
+            for (int k = maxOmniLights; k < maxOmniLights + excessSize; ++k)
             {
                 visibleFarOmniLightsId.push_back(visibleOmniLightsId[k]);
             }
@@ -375,13 +386,13 @@ namespace nau::render
                             oldFarSize, visibleFarOmniLightsId.size());
             G_UNUSED(oldFarSize);
         }
-        visibleOmniLightsId.resize(std::min(int(visibleOmniLightsId.size()), int(MAX_OMNI_LIGHTS)));
+        visibleOmniLightsId.resize(std::min(int(visibleOmniLightsId.size()), maxOmniLights));
 
         visibleSpotLightsIdSet.reset();
         visibleSpotLightsId.clear();
         // spotLights.prepare(frustum, visibleSpotLightsId, occlusion);
 
-        eastl::vector<uint16_t> visibleFarSpotLightsId;  // TODO: Use frame allocator
+        visibleFarSpotLightsId.clear();
         spotLights.prepare(frustum,
                            visibleSpotLightsId,
                            visibleFarSpotLightsId,
@@ -402,11 +413,11 @@ namespace nau::render
             return distI < distJ;
         });
         // separate close and far lights cb (so we can render more far lights easier)
-        if (visibleSpotLightsId.size() > MAX_SPOT_LIGHTS)
+        if (visibleSpotLightsId.size() > maxSpotLights)
         {
             auto oldFarSize = visibleFarSpotLightsId.size();
-            auto excessSize = visibleSpotLightsId.size() - MAX_SPOT_LIGHTS;
-            for (int k = MAX_OMNI_LIGHTS; k < MAX_OMNI_LIGHTS + excessSize; ++k)
+            auto excessSize = visibleSpotLightsId.size() - maxSpotLights;
+            for (int k = maxSpotLights; k < maxSpotLights + excessSize; ++k)
             {
                 visibleFarSpotLightsId.push_back(visibleSpotLightsId[k]);
             }
@@ -414,11 +425,8 @@ namespace nau::render
                             oldFarSize, visibleFarSpotLightsId.size());
             G_UNUSED(oldFarSize);
         }
-        visibleSpotLightsId.resize(std::min<int>(visibleSpotLightsId.size(), MAX_SPOT_LIGHTS));
+        visibleSpotLightsId.resize(std::min<int>(visibleSpotLightsId.size(), maxSpotLights));
 
-        eastl::vector<SpotLightsManager::RawLight> visibleSpotLights;  // TODO: Use frame allocator
-        eastl::vector<Vector4> visibleSpotLightsBounds;                // TODO: Use frame allocator
-        eastl::vector<Vector4> visibleOmniLightsBounds;                // TODO: Use frame allocator
         visibleSpotLights.resize(visibleSpotLightsId.size());
         renderSpotLights.resize(visibleSpotLightsId.size());
         renderOmniLights.resize(visibleOmniLightsId.size());
@@ -474,6 +482,14 @@ namespace nau::render
             }
         }
 
+        if (isGpuClustered)
+        {
+            clustersOmniGrid.clear();
+            clustersSpotGrid.clear();
+            gpuClustering->cluster(view, proj, closeSliceDist, maxClusteredDist, renderOmniLights, renderSpotLights);
+            return;
+        }
+
         // clusteredCullLights(view, proj, znear, 1, 500, (Vector4*)visibleOmniLights.data(),
         //   elem_size(visibleOmniLights)/sizeof(Vector4), visibleOmniLights.size(), 2);
         uint32_t omniWords = (renderOmniLights.size() + 31) / 32, spotWords = (visibleSpotLights.size() + 31) / 32;
@@ -537,6 +553,15 @@ namespace nau::render
         if (buffersFilled)
             return;
         buffersFilled = true;
+
+        // The clustered lights and their grid are in the GPU clustering buffers, see cullFrustumLights().
+        if (isGpuClustered)
+        {
+            gridFrameHasLights = hasClusteredLights() ? HAS_CLUSTERED_LIGHTS : NO_CLUSTERED_LIGHTS;
+            fillFarBuffers();
+            return;
+        }
+
         uint32_t omniWords = clustersOmniGrid.size() / CLUSTERS_PER_GRID, spotWords = clustersSpotGrid.size() / CLUSTERS_PER_GRID;
         if ((clustersOmniGrid.size() || clustersSpotGrid.size()) || gridFrameHasLights != NO_CLUSTERED_LIGHTS)  // todo: only update if
                                                                                                                 // something changed (which
@@ -606,6 +631,11 @@ namespace nau::render
                                                                   VBLOCK_DISCARD);
         }
         w*/
+        fillFarBuffers();
+    }
+
+    void ClusteredLights::fillFarBuffers()
+    {
         // todo: only update if something changed (which won't happen very often)
         visibleFarSpotLightsCB.reallocate(renderFarSpotLights.size(), MAX_VISIBLE_FAR_LIGHTS, "far_spot_lights");
         visibleFarSpotLightsCB.update(renderFarSpotLights.data(), data_size(renderFarSpotLights));
@@ -640,24 +670,23 @@ namespace nau::render
             return;
         // TIME_D3D_PROFILE(clusteredFill);
         clusters.prepareFrustum(view, proj, znear, minDist, maxDist, use_occlusion);
-        eastl::unique_ptr<FrustumClusters::ClusterGridItemMasks> tempOmniItemsPtr, tempSpotItemsPtr;
-
-        tempOmniItemsPtr.reset(new FrustumClusters::ClusterGridItemMasks());
+        if (!omniItemMasks)
+        {
+            omniItemMasks = eastl::make_unique<FrustumClusters::ClusterGridItemMasks>();
+            spotItemMasks = eastl::make_unique<FrustumClusters::ClusterGridItemMasks>();
+        }
 
         // TIME_PROFILE(clustered);
         uint32_t clusteredOmniLights = clusters.fillItemsSpheres((const Vector4*)omni_lights.data(), elem_size(omni_lights) / sizeof(Vector4),
-                                                                 omni_lights.size(), *tempOmniItemsPtr, omni_mask, omni_words);
-
-        tempOmniItemsPtr.reset();
+                                                                 omni_lights.size(), *omniItemMasks, omni_mask, omni_words);
 
         uint32_t clusteredSpotLights = 0;
         if (spot_lights.size())
         {
-            tempSpotItemsPtr.reset(new FrustumClusters::ClusterGridItemMasks());
             clusteredSpotLights = clusters.fillItemsSpheres(spot_light_bounds.data(),
                                                             elem_size(spot_light_bounds) / sizeof(Vector4),
                                                             spot_lights.size(),
-                                                            *tempSpotItemsPtr,
+                                                            *spotItemMasks,
                                                             spot_mask,
                                                             spot_words);
         }
@@ -670,7 +699,7 @@ namespace nau::render
                 elem_size(spot_lights) / sizeof(Vector4),
                 (const Vector4*)&spot_lights[0].dir_angle,
                 elem_size(spot_lights) / sizeof(Vector4),
-                *tempSpotItemsPtr,
+                *spotItemMasks,
                 spot_mask,
                 spot_words);
         }
@@ -768,6 +797,7 @@ namespace nau::render
         initClustered(frame_initial_lights_count);
         initConeSphere();
         co_await initLightMaterial();
+        co_await initGpuClustering();
 
         visibleOmniLightsCB.reallocate(0, MAX_OMNI_LIGHTS, "omni_lights");
         visibleOmniLightsCB.update(nullptr, 0);
@@ -1056,6 +1086,29 @@ namespace nau::render
         lightsMat = nullptr;
     }
 
+    async::Task<> ClusteredLights::initGpuClustering()
+    {
+        gpuClustering.reset();
+        isGpuClustered = false;
+
+        const bool isEnabled = getServiceProvider().has<GlobalProperties>() &&
+                               getServiceProvider().get<GlobalProperties>().getValue<bool>("/graphics/lights/gpuClustering").value_or(false);
+        if (!isEnabled)
+        {
+            co_return;
+        }
+
+        MaterialAssetRef clusteringMatRef = AssetPath{"file:/res/materials/light_clustering.nmat_json"};
+        Result<MaterialAssetView::Ptr> clusteringMat = co_await clusteringMatRef.getAssetViewTyped<MaterialAssetView>().doTry();
+        if (!clusteringMat)
+        {
+            NAU_LOG_WARNING("The light clustering material is not loaded, the lights are clustered on the CPU");
+            co_return;
+        }
+
+        gpuClustering = eastl::make_unique<GpuLightClustering>(*clusteringMat);
+    }
+
     void ClusteredLights::setBuffers()
     {
         fillBuffers();
@@ -5,6 +5,7 @@
 #pragma once
 
 #include "frustumClusters.h"
+#include "gpuLightClustering.h"
 #include "graphics_assets/material_asset.h"
 #include "nau/3d/dag_drv3d.h"
 #include "nau/3d/dag_resId.h"
@@ -16,6 +17,7 @@
 #include <EASTL/array.h>
 #include <EASTL/bitset.h>
 #include <EASTL/fixed_function.h>
+#include <EASTL/unique_ptr.h>
 namespace nau::render
 {
     class ShadowSystem;
@@ -72,7 +74,15 @@ namespace nau::render
         }
         bool hasClusteredLights() const
         {
-            return (clustersOmniGrid.size() + clustersSpotGrid.size()) != 0;
+            return (clustersOmniGrid.size() + clustersSpotGrid.size()) != 0 ||
+                   (isGpuClustered && (renderOmniLights.size() + renderSpotLights.size()) != 0);
+        }
+        // The clustered lights are binned by the compute pass (set with /graphics/lights/gpuClustering).
+        // Its buffers replace the clustered lights constant buffers and the CPU grid.
+        // Null for the frames binned on the CPU (the culling with the occlusion).
+        const GpuLightClustering* getGpuClustering() const
+        {
+            return isGpuClustered ? gpuClustering.get() : nullptr;
         }
         int getVisibleNotClusteredSpotsCount() const
         {
@@ -214,8 +224,16 @@ namespace nau::render
         eastl::vector<uint16_t> visibleOmniLightsId;
         eastl::bitset<OmniLightsManager::MAX_LIGHTS> visibleOmniLightsIdSet;
         eastl::bitset<SpotLightsManager::MAX_LIGHTS> visibleSpotLightsIdSet;
+        // The per frame lists of cullFrustumLights(): they keep their capacity between the frames.
+        eastl::vector<uint16_t> visibleFarSpotLightsId;
+        eastl::vector<uint16_t> visibleFarOmniLightsId;
+        eastl::vector<SpotLightsManager::RawLight> visibleSpotLights;
+        eastl::vector<math::Vector4> visibleSpotLightsBounds;
+        eastl::vector<math::Vector4> visibleOmniLightsBounds;
 
         FrustumClusters clusters;  //-V730_NOINIT
+        // The binning scratch of clusteredCullLights(): allocated once, the masks are hundreds of KB each.
+        eastl::unique_ptr<FrustumClusters::ClusterGridItemMasks> omniItemMasks, spotItemMasks;
         static constexpr int MAX_FRAMES = 2;
         static const float MARK_SMALL_LIGHT_AS_FAR_LIMIT;
 
@@ -350,6 +368,9 @@ namespace nau::render
         uint32_t lightsGridFrame = 0, allocatedWords = 0;
 
         MaterialAssetView::Ptr lightsMat;
+        eastl::unique_ptr<GpuLightClustering> gpuClustering;
+        // The lights of the current frame are binned by gpuClustering, see cullFrustumLights().
+        bool isGpuClustered = false;
 
         uint32_t v_count = 0, f_count = 0;
         Sbuffer* coneSphereVb = nullptr;
@@ -403,9 +424,11 @@ namespace nau::render
 
         void initConeSphere();
         async::Task<> initLightMaterial();
+        async::Task<> initGpuClustering();
         void closeLightMaterial();
 
         void fillBuffers();
+        void fillFarBuffers();
 
         void setBuffers();
         void resetBuffers();
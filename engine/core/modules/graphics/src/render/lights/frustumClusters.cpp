@@ -4,8 +4,11 @@
 
 #include "frustumClusters.h"
 
+#include <atomic>
+
 #include "dag_occlusionTest.h"
 #include "lights_common.h"
+#include "nau/async/parallel_for.h"
 
 #define SHRINK_SPHERE 1
 #define VALIDATE_CLUSTERS 0
@@ -33,6 +36,26 @@ namespace nau::render
         return true;
     }
 
+    // The depth slices write the disjoint words of the result masks: the items are binned by the slice ranges in parallel.
+    // The few items are binned inline, the jobs cost more than their binning.
+    static constexpr int SlicesPerJob = 4;
+    static constexpr size_t MinParallelItemsCount = 16;
+
+    template <typename F>
+    static void for_each_slices_range(size_t items_count, F&& fn)
+    {
+        if (items_count < MinParallelItemsCount)
+        {
+            fn(0, CLUSTERS_D);
+            return;
+        }
+
+        async::parallelFor(CLUSTERS_D, SlicesPerJob, [&](size_t z_begin, size_t z_end)
+        {
+            fn(static_cast<int>(z_begin), static_cast<int>(z_end));
+        });
+    }
+
     static __forceinline Vector3 v_dist3_sq_x(Vector3 a, Vector3 b)
     {
         return Vector3(float(lengthSqr(a - b)));
@@ -221,20 +244,49 @@ namespace nau::render
         if (!items.rects3d.size())
             return 0;
 
-        uint32_t currentMasksStart = 0, totalItemsCount = 0;
-        const ItemRect3D* grid = items.rects3d.data();
-        for (int i = 0; i < items.rects3d.size(); ++i, grid++)
+        // The slice masks of an item are its [z][y] rows: their starts are known before the slices are binned.
+        uint32_t currentMasksStart = 0;
+        for (int i = 0; i < items.rects3d.size(); ++i)
         {
+            const ItemRect3D& grid = items.rects3d[i];
             items.sliceMasksStart[i] = currentMasksStart;
+            currentMasksStart += (grid.zmax - grid.zmin + 1) * (grid.rect.max_y - grid.rect.min_y + 1);
+        }
+        NAU_ASSERT(currentMasksStart <= items.sliceMasks.size());
+
+        std::atomic<uint32_t> totalItemsCount = 0;
+        for_each_slices_range(items.rects3d.size(), [&](int z_begin, int z_end)
+        {
+            totalItemsCount.fetch_add(fillItemsSpheresSlices(items, lightsViewSpace, result_mask, word_count, z_begin, z_end), std::memory_order_relaxed);
+        });
+
+        items.itemsListCount = totalItemsCount.load(std::memory_order_relaxed);
+        return items.itemsListCount;
+    }
 
+    uint32_t FrustumClusters::fillItemsSpheresSlices(ClusterGridItemMasks& items,
+                                                     const dag::RelocatableFixedVector<Vector4, ClusterGridItemMasks::MAX_ITEM_COUNT>& lightsViewSpace,
+                                                     uint32_t* result_mask,
+                                                     uint32_t word_count,
+                                                     int z_begin,
+                                                     int z_end)
+    {
+        uint32_t totalItemsCount = 0;
+        const ItemRect3D* grid = items.rects3d.data();
+        for (int i = 0; i < items.rects3d.size(); ++i, grid++)
+        {
             const uint32_t itemId = items.rects3d[i].itemId;
             uint32_t* resultMasksUse = result_mask + (itemId >> 5);
             const uint32_t itemMask = 1 << (itemId & 31);
 
             // int x_center = (grid->rect.max_x+grid->rect.min_x)/2;
-            int z0 = grid->zmin, z1 = grid->zmax;
+            int z0 = max<int>(grid->zmin, z_begin), z1 = min<int>(grid->zmax, z_end - 1);
             int y0 = grid->rect.min_y, y1 = grid->rect.max_y + 1;
             int x0 = grid->rect.min_x, x1 = grid->rect.max_x + 1;
+            if (z0 > z1)
+            {
+                continue;
+            }
 
 #if !SHRINK_SPHERE
             const MaskType x_mask = ((MaskType(1) << MaskType(grid->rect.max_x)) | ((MaskType(1) << MaskType(grid->rect.max_x)) - 1)) &
@@ -252,6 +304,7 @@ namespace nau::render
 #endif
             for (int z = z0; z <= z1; z++)
             {
+                uint32_t currentMasksStart = items.sliceMasksStart[i] + (z - grid->zmin) * (y1 - y0);
 #if SHRINK_SPHERE
                 Vector4 z_light_pos = lightViewSpace;
                 float z_lightRadiusSq = radiusSq;
@@ -274,6 +327,8 @@ namespace nau::render
                 {
                     if (sliceNoRowMax[y] < z)
                     {
+                        // The spot lights culling reads the row masks.
+                        items.sliceMasks.data()[currentMasksStart] = 0;
                         continue;
                     }
 #if SHRINK_SPHERE
@@ -360,10 +415,7 @@ namespace nau::render
 #endif
                 }
             }
-            // currentMasksStart += (grid->zmax-grid->zmin+1) * (grid->rect.max_y-grid->rect.min_y+1);
         }
-        NAU_ASSERT(currentMasksStart <= items.sliceMasks.size());
-        items.itemsListCount = totalItemsCount;
         return totalItemsCount;
     }
 
@@ -529,7 +581,7 @@ namespace nau::render
         return items.itemsListCount;
     }
 
-    uint32_t FrustumClusters::cullFrustum(ClusterGridItemMasks& items, int i, const Matrix4& plane03_XYZW, const Matrix4& plane47_XYZW, uint32_t* result_mask, uint32_t word_count)
+    uint32_t FrustumClusters::cullFrustum(ClusterGridItemMasks& items, int i, const Matrix4& plane03_XYZW, const Matrix4& plane47_XYZW, uint32_t* result_mask, uint32_t word_count, int z_begin, int z_end)
     {
         const ItemRect3D* grid = &items.rects3d[i];
 
@@ -543,10 +595,15 @@ namespace nau::render
 
         if (z0 == z1 && y1 - y0 == 1 && x1 - x0 == 1 && x0 != 0 && y0 != 0 && x1 != CLUSTERS_W && y1 != CLUSTERS_H && z0 != 0 &&
             z1 != CLUSTERS_D - 1)  // it is very small, inside one cluster and so can't culled
-            return items.itemsListCount;
+            return 0;
 
+        const int zs0 = max(z0, z_begin), zs1 = min(z1, z_end - 1);
+        if (zs0 > zs1)
+            return 0;
+
+        uint32_t culledCount = 0;
         eastl::array<uint8_t, (CLUSTERS_W + 1) * (CLUSTERS_H + 1) * (CLUSTERS_D + 1)> planeBits;
-        const int ez1 = min(z1 + 1, CLUSTERS_D);
+        const int ez1 = min(zs1 + 1, CLUSTERS_D);
         const int ey1 = min(y1 + 1, CLUSTERS_H + 1);
         const int ex1 = min(x1 + 1, CLUSTERS_W + 1);
         const int planeZStride = (CLUSTERS_W + 1) * (CLUSTERS_H + 1);  // todo: replace with tight
@@ -557,7 +614,7 @@ namespace nau::render
         // at all
         //  each plane can directly solve planes equasion, so we can know valid line for each z,y without checking each point. it is always
         //  00011111000 case, we only need boundaries
-        for (int z = z0; z <= ez1; z++)
+        for (int z = zs0; z <= ez1; z++)
         {
             uint8_t* planes = planeBits.data() + z * planeZStride + y0 * planeYStride + x0;
             Vector4* point =
@@ -574,9 +631,9 @@ namespace nau::render
         // const int planeYStride = (ex1-x0);//todo: replace with tight
         // const int planeZStride = planeYStride*(ey1-y0);
 
-        uint32_t currentMasksStart = items.sliceMasksStart[i];
+        uint32_t currentMasksStart = items.sliceMasksStart[i] + (zs0 - z0) * (y1 - y0);
         // uint8_t *cPlanes = planeBits.data();
-        for (int z = z0; z <= z1; z++)  //, cPlanes+=planeYStride)
+        for (int z = zs0; z <= zs1; z++)  //, cPlanes+=planeYStride)
         {
             for (int y = y0; y < y1; y++, currentMasksStart++)  //, cPlanes++)
             {
@@ -616,7 +673,7 @@ namespace nau::render
 #endif
                         *resultMaskAt &= ~itemMask;
                         items.sliceMasks[currentMasksStart] &= ~x_mask;
-                        items.itemsListCount--;
+                        culledCount++;
                     }
                     else
                     {
@@ -629,21 +686,24 @@ namespace nau::render
             }
         }
 
-        return items.itemsListCount;
+        return culledCount;
     }
 
     uint32_t FrustumClusters::cullSpots(const Vector4* pos_radius, int pos_aligned_stride, const Vector4* dir_angle, int dir_aligned_stride, ClusterGridItemMasks& items, uint32_t* result_mask, uint32_t word_count)
     {
         if (!items.itemsListCount)
             return 0;
+        struct SpotPlanes
+        {
+            Matrix4 plane03, plane47;
+        };
+        dag::RelocatableFixedVector<SpotPlanes, ClusterGridItemMasks::MAX_ITEM_COUNT> spotsPlanes;
+        spotsPlanes.resize(items.rects3d.size());
+
         const ItemRect3D* grid = items.rects3d.data();
-        Vector4 v_c099 = Vector4(0.999f);
         for (int i = 0; i < items.rects3d.size(); ++i, grid++)
         {
-            if (grid->zmin == grid->zmax && grid->rect.min_y == grid->rect.max_y && grid->rect.min_x == grid->rect.max_x && grid->zmin != 0 &&
-                grid->rect.min_x != 0 && grid->rect.min_y != 0 && grid->rect.min_x != CLUSTERS_W - 1 &&
-                grid->rect.min_y != CLUSTERS_H - 1)  // it is very small, inside one cluster and so can't culled
-                return items.itemsListCount;
+            // The spot planes are the same for all the slices: they are built once, the slices are culled in parallel.
 
             uint32_t id = grid->itemId;
             Vector4 wpos = pos_radius[id * pos_aligned_stride], wdir = dir_angle[id * dir_aligned_stride];
@@ -672,7 +732,7 @@ namespace nau::render
             vFar2 = (vFar2 + vdir.getXYZ());
             vFar3 = (vFar3 + vdir.getXYZ());
 
-            Matrix4 plane03;
+            Matrix4& plane03 = spotsPlanes[i].plane03;
             plane03.setCol0(v_make_plane_dir(vpos.getXYZ(), vFar0, vFar1));
             plane03.setCol1(v_make_plane_dir(vpos.getXYZ(), vFar1, vFar2));
             plane03.setCol2(v_make_plane_dir(vpos.getXYZ(), vFar2, vFar3));
@@ -681,7 +741,7 @@ namespace nau::render
 
             Vector4 planeNear = v_perm_xyzd(vdir, Vector4(-(dot(vdir.getXYZ(), vpos.getXYZ())))),
                     planeFar = v_perm_xyzd(-(vdir), Vector4((wpos - planeNear).getW()));
-            Matrix4 plane47;
+            Matrix4& plane47 = spotsPlanes[i].plane47;
             plane47.setCol0(planeNear);
             plane47.setCol1(planeFar);
 
@@ -701,7 +761,6 @@ namespace nau::render
 #endif
             plane47 = transpose(plane47);
 
-            cullFrustum(items, i, plane03, plane47, result_mask, word_count);
             // v_mat44_transpose(plane03, plane03);
             // Vector3 tp = v_make_Vector4(-3.7626, 1.98745, 4.89138, 0);//v_add(vpos, v_mul(vdir, v_mul(V_C_HALF, v_splat_w(wpos))));
             // NAU_CORE_DEBUG_LF("dist %g %g %g %g | %g %g ", v_extract_x(v_plane_dist_x(plane03.getCol0(), tp)),
@@ -713,6 +772,19 @@ namespace nau::render
             // int x_center = (grid->rect.max_x+grid->rect.min_x)/2;
             // currentMasksStart += (grid->zmax-grid->zmin+1) * (grid->rect.max_y-grid->rect.min_y+1);
         }
+
+        std::atomic<uint32_t> culledCount = 0;
+        for_each_slices_range(items.rects3d.size(), [&](int z_begin, int z_end)
+        {
+            uint32_t slicesCulledCount = 0;
+            for (int i = 0; i < items.rects3d.size(); ++i)
+            {
+                slicesCulledCount += cullFrustum(items, i, spotsPlanes[i].plane03, spotsPlanes[i].plane47, result_mask, word_count, z_begin, z_end);
+            }
+            culledCount.fetch_add(slicesCulledCount, std::memory_order_relaxed);
+        });
+
+        items.itemsListCount -= culledCount.load(std::memory_order_relaxed);
         return items.itemsListCount;
     }
 }  // namespace nau::render
\ No newline at end of file
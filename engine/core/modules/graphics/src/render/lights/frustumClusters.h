@@ -100,7 +100,7 @@ namespace nau::render
         {
             static constexpr int MAX_ITEM_COUNT = 256;                                    // can be replaced with dynamic
             eastl::array<MaskType, MAX_ITEM_COUNT * CLUSTERS_H * CLUSTERS_D> sliceMasks;  //-V730_NOINIT
-            eastl::array<uint16_t, MAX_ITEM_COUNT> sliceMasksStart;                       //-V730_NOINIT
+            eastl::array<uint32_t, MAX_ITEM_COUNT> sliceMasksStart;                       //-V730_NOINIT
 
             dag::RelocatableFixedVector<ItemRect3D, MAX_ITEM_COUNT> rects3d;
 
@@ -123,6 +123,14 @@ namespace nau::render
                                       uint32_t* result_mask,
                                       uint32_t word_count);
 
+        // Bins the items into the depth slices [z_begin, z_end), returns the count of the binned froxels.
+        uint32_t fillItemsSpheresSlices(ClusterGridItemMasks& items,
+                                        const dag::RelocatableFixedVector<math::Vector4, ClusterGridItemMasks::MAX_ITEM_COUNT>& lightsViewSpace,
+                                        uint32_t* result_mask,
+                                        uint32_t word_count,
+                                        int z_begin,
+                                        int z_end);
+
         uint32_t fillItemsSpheres(const math::Vector4* pos_radius,
                                   int aligned_stride,
                                   int count,
@@ -130,12 +138,15 @@ namespace nau::render
                                   uint32_t* result_mask,
                                   uint32_t word_count);
 
+        // Culls the froxels of the depth slices [z_begin, z_end) out of the item, returns the count of the culled froxels.
         uint32_t cullFrustum(ClusterGridItemMasks& items,
                              int i,
                              const nau::math::Matrix4& plane03_XYZW,
                              const nau::math::Matrix4& plane47_XYZW,
                              uint32_t* result_mask,
-                             uint32_t word_count);
+                             uint32_t word_count,
+                             int z_begin,
+                             int z_end);
 
         uint32_t cullSpot(ClusterGridItemMasks& items,
                           int i,
@@ -0,0 +1,140 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "gpuLightClustering.h"
+
+
+namespace nau::render
+{
+    namespace
+    {
+        const MaterialAssetView::PropertyId ViewProperty = MaterialAssetView::makePropertyId("default", "view");
+        const MaterialAssetView::PropertyId ProjScaleProperty = MaterialAssetView::makePropertyId("default", "projScale");
+        const MaterialAssetView::PropertyId DepthSliceProperty = MaterialAssetView::makePropertyId("default", "depthSlice");
+        const MaterialAssetView::PropertyId LightsCountProperty = MaterialAssetView::makePropertyId("default", "lightsCount");
+
+        void destroyBuffer(Sbuffer*& buffer)
+        {
+            if (buffer)
+            {
+                buffer->destroy();
+                buffer = nullptr;
+            }
+        }
+    }  // namespace
+
+    GpuLightClustering::GpuLightClustering(MaterialAssetView::Ptr clusteringMaterial) :
+        m_material(std::move(clusteringMaterial))
+    {
+        NAU_ASSERT(m_material);
+    }
+
+    GpuLightClustering::~GpuLightClustering()
+    {
+        destroyBuffer(m_omniLights);
+        destroyBuffer(m_spotLights);
+        destroyBuffer(m_lightsGrid);
+    }
+
+    void GpuLightClustering::reserve(uint32_t omniCount, uint32_t spotCount, uint32_t gridWordsCount)
+    {
+        // The empty buffers are bound too.
+        omniCount = eastl::max(omniCount, 1u);
+        spotCount = eastl::max(spotCount, 1u);
+        gridWordsCount = eastl::max(gridWordsCount, 1u);
+
+        if (m_omniCapacity < omniCount)
+        {
+            m_omniCapacity = omniCount;
+
+            destroyBuffer(m_omniLights);
+            m_omniLights = d3d::create_sbuffer(sizeof(RenderOmniLight), m_omniCapacity, SBCF_BIND_SHADER_RES | SBCF_MISC_STRUCTURED | SBCF_DYNAMIC, 0, u8"clustered omni lights buf");
+        }
+
+        if (m_spotCapacity < spotCount)
+        {
+            m_spotCapacity = spotCount;
+
+            destroyBuffer(m_spotLights);
+            m_spotLights = d3d::create_sbuffer(sizeof(RenderSpotLight), m_spotCapacity, SBCF_BIND_SHADER_RES | SBCF_MISC_STRUCTURED | SBCF_DYNAMIC, 0, u8"clustered spot lights buf");
+        }
+
+        if (m_gridWordsCapacity < gridWordsCount)
+        {
+            m_gridWordsCapacity = gridWordsCount;
+
+            destroyBuffer(m_lightsGrid);
+            m_lightsGrid = d3d::create_sbuffer(sizeof(uint32_t), m_gridWordsCapacity, SBCF_UA_SR_STRUCTURED, 0, u8"lights full grid buf");
+        }
+
+        NAU_ASSERT(m_omniLights && m_spotLights && m_lightsGrid);
+    }
+
+    void GpuLightClustering::cluster(const math::Matrix4& view,
+                                     const math::Matrix4& proj,
+                                     float minDist,
+                                     float maxDist,
+                                     eastl::span<const RenderOmniLight> omniLights,
+                                     eastl::span<const RenderSpotLight> spotLights)
+    {
+        NAU_ASSERT(omniLights.size() <= MaxLights && spotLights.size() <= MaxLights);
+
+        const uint32_t omniCount = static_cast<uint32_t>(omniLights.size());
+        const uint32_t spotCount = static_cast<uint32_t>(spotLights.size());
+        m_omniWordsCount = (omniCount + 31) / 32;
+        m_spotWordsCount = (spotCount + 31) / 32;
+        if (omniCount == 0 && spotCount == 0)
+        {
+            return;
+        }
+
+        reserve(omniCount, spotCount, FroxelsCount * (m_omniWordsCount + m_spotWordsCount));
+
+        bool isUpdated = omniCount == 0 || m_omniLights->updateData(0, sizeof(RenderOmniLight) * omniCount, omniLights.data(), VBLOCK_WRITEONLY | VBLOCK_DISCARD);
+        isUpdated &= spotCount == 0 || m_spotLights->updateData(0, sizeof(RenderSpotLight) * spotCount, spotLights.data(), VBLOCK_WRITEONLY | VBLOCK_DISCARD);
+        NAU_ASSERT(isUpdated);
+
+        // The same slices as FrustumClusters::prepareFrustum(): slice = log2(depth) * scale + bias.
+        const float depthSliceScale = CLUSTERS_D / log2f(maxDist / minDist);
+        const float depthSliceBias = -log2f(minDist) * depthSliceScale;
+
+        m_material->setRoBuffer("default", "omniLights", m_omniLights);
+        m_material->setRoBuffer("default", "spotLights", m_spotLights);
+        m_material->setRwBuffer("default", "lightsGrid", m_lightsGrid);
+
+        m_material->setProperty(ViewProperty, view);
+        m_material->setProperty(ProjScaleProperty, math::Vector4(proj[0][0], proj[1][1], proj[2][0], proj[2][1]));
+        m_material->setProperty(DepthSliceProperty, math::Vector4(depthSliceScale, depthSliceBias, minDist, maxDist));
+        m_material->setProperty(LightsCountProperty, math::Vector4(omniCount, m_omniWordsCount, spotCount, m_spotWordsCount));
+
+        m_material->bind();
+        m_material->dispatch((FroxelsCount + ThreadGroupSize - 1) / ThreadGroupSize, 1, 1);
+    }
+
+    Sbuffer* GpuLightClustering::getOmniLights() const
+    {
+        return m_omniLights;
+    }
+
+    Sbuffer* GpuLightClustering::getSpotLights() const
+    {
+        return m_spotLights;
+    }
+
+    Sbuffer* GpuLightClustering::getLightsGrid() const
+    {
+        return m_lightsGrid;
+    }
+
+    uint32_t GpuLightClustering::getOmniWordsCount() const
+    {
+        return m_omniWordsCount;
+    }
+
+    uint32_t GpuLightClustering::getSpotWordsCount() const
+    {
+        return m_spotWordsCount;
+    }
+
+}  // namespace nau::render
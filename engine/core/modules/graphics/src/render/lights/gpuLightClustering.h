@@ -0,0 +1,74 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <EASTL/span.h>
+
+#include "frustumClusters.h"
+#include "graphics_assets/material_asset.h"
+#include "nau/3d/dag_drv3d.h"
+#include "nau/render/omniLightsManager.h"
+#include "nau/render/spotLightsManager.h"
+
+
+namespace nau::render
+{
+    /**
+     * GPU clustering of the visible lights into the froxels of the view (the replacement of the FrustumClusters CPU binning).
+     * The lights are uploaded into the structured buffers, the compute material tests them against each froxel
+     * (CLUSTERS_W x CLUSTERS_H x CLUSTERS_D, the depth slices are logarithmic as in FrustumClusters) and writes the froxel masks
+     * into getLightsGrid() in the FrustumClusters layout: omniWordsCount words per froxel for the omni lights, then spotWordsCount
+     * words per froxel for the spot lights. The froxels of the extra (CLUSTERS_D) slice are zeroed.
+     */
+    class GpuLightClustering
+    {
+    public:
+        // The structured buffers are not limited by the constant buffer size: the cap keeps the froxel masks size reasonable.
+        static constexpr uint32_t MaxLights = 4096;
+
+        // Must match the clustering compute shader: one thread per froxel.
+        static constexpr uint32_t ThreadGroupSize = 64;
+        static constexpr uint32_t FroxelsCount = CLUSTERS_W * CLUSTERS_H * (CLUSTERS_D + 1);
+
+        explicit GpuLightClustering(MaterialAssetView::Ptr clusteringMaterial);
+        GpuLightClustering(const GpuLightClustering&) = delete;
+        ~GpuLightClustering();
+
+        GpuLightClustering& operator=(const GpuLightClustering&) = delete;
+
+        /**
+         * Uploads the lights and dispatches their clustering for the view. The froxel depth slices span [minDist, maxDist].
+         */
+        void cluster(const math::Matrix4& view,
+                     const math::Matrix4& proj,
+                     float minDist,
+                     float maxDist,
+                     eastl::span<const RenderOmniLight> omniLights,
+                     eastl::span<const RenderSpotLight> spotLights);
+
+        Sbuffer* getOmniLights() const;
+        Sbuffer* getSpotLights() const;
+        Sbuffer* getLightsGrid() const;
+
+        uint32_t getOmniWordsCount() const;
+        uint32_t getSpotWordsCount() const;
+
+    private:
+        void reserve(uint32_t omniCount, uint32_t spotCount, uint32_t gridWordsCount);
+
+        MaterialAssetView::Ptr m_material;
+
+        Sbuffer* m_omniLights = nullptr;
+        Sbuffer* m_spotLights = nullptr;
+        Sbuffer* m_lightsGrid = nullptr;
+        uint32_t m_omniCapacity = 0;
+        uint32_t m_spotCapacity = 0;
+        uint32_t m_gridWordsCapacity = 0;
+
+        uint32_t m_omniWordsCount = 0;
+        uint32_t m_spotWordsCount = 0;
+    };
+
+}  // namespace nau::render
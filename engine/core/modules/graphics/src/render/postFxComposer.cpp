@@ -0,0 +1,169 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "nau/render/postFxComposer.h"
+
+#include <EASTL/algorithm.h>
+
+
+namespace nau::render
+{
+    void PostFxComposer::addEffect(Effect effect)
+    {
+        NAU_ASSERT(effect.material);
+        NAU_ASSERT(!effect.readsNeighborhood || effect.stageBit == 0, "The neighbourhood effects are not fused");
+
+        m_effects.push_back(std::move(effect));
+        buildPasses();
+    }
+
+    void PostFxComposer::setEffectEnabled(eastl::string_view name, bool isEnabled)
+    {
+        auto effect = eastl::find_if(m_effects.begin(), m_effects.end(), [name](const Effect& effect)
+        {
+            return effect.name == name;
+        });
+        NAU_ASSERT_RETURN(effect != m_effects.end());
+        if (effect->isEnabled == isEnabled)
+        {
+            return;
+        }
+
+        effect->isEnabled = isEnabled;
+        // The stages are skipped by the mask of their pass.
+        if (!isStage(*effect))
+        {
+            buildPasses();
+        }
+    }
+
+    bool PostFxComposer::isEffectEnabled(eastl::string_view name) const
+    {
+        auto effect = eastl::find_if(m_effects.begin(), m_effects.end(), [name](const Effect& effect)
+        {
+            return effect.name == name;
+        });
+        return effect != m_effects.end() && effect->isEnabled;
+    }
+
+    const eastl::vector<PostFxComposer::Pass>& PostFxComposer::getPasses() const
+    {
+        return m_passes;
+    }
+
+    bool PostFxComposer::isComputePass(const Pass& pass) const
+    {
+        const Effect& effect = m_effects[pass.firstEffect];
+        return isStage(effect) && !effect.computePipeline.empty();
+    }
+
+    bool PostFxComposer::isLayoutChanged() const
+    {
+        return m_isLayoutChanged;
+    }
+
+    void PostFxComposer::acceptLayout()
+    {
+        m_isLayoutChanged = false;
+    }
+
+    bool PostFxComposer::isStage(const Effect& effect)
+    {
+        return effect.stageBit != 0;
+    }
+
+    bool PostFxComposer::canFuse(const Effect& previous, const Effect& next) const
+    {
+        return isStage(previous) && isStage(next) && previous.material == next.material && previous.pipeline == next.pipeline &&
+               previous.computePipeline == next.computePipeline;
+    }
+
+    void PostFxComposer::buildPasses()
+    {
+        m_passes.clear();
+        for (uint32_t i = 0; i < m_effects.size(); ++i)
+        {
+            const Effect& effect = m_effects[i];
+            // The disabled stages keep their place in the pass: toggling them does not change the layout.
+            if (!effect.isEnabled && !isStage(effect))
+            {
+                continue;
+            }
+
+            if (!m_passes.empty())
+            {
+                Pass& last = m_passes.back();
+                if (canFuse(m_effects[last.firstEffect + last.effectsCount - 1], effect))
+                {
+                    ++last.effectsCount;
+                    continue;
+                }
+            }
+
+            m_passes.push_back({i, 1});
+        }
+
+        m_isLayoutChanged = true;
+    }
+
+    void PostFxComposer::renderPass(const Pass& pass, BaseTexture* source, BaseTexture* target) const
+    {
+        NAU_ASSERT_RETURN(pass.effectsCount > 0 && pass.firstEffect + pass.effectsCount <= m_effects.size());
+        NAU_ASSERT_RETURN(source);
+
+        const Effect& effect = m_effects[pass.firstEffect];
+        if (isStage(effect))
+        {
+            uint32_t effectsMask = 0;
+            for (uint32_t i = pass.firstEffect; i < pass.firstEffect + pass.effectsCount; ++i)
+            {
+                if (m_effects[i].isEnabled)
+                {
+                    effectsMask |= m_effects[i].stageBit;
+                }
+            }
+
+            if (target && isComputePass(pass))
+            {
+                // The tiles are read into the group shared memory once for all the stages of the pass.
+                TextureInfo info;
+                target->getinfo(info);
+
+                effect.material->setProperty(effect.computePipeline, "effectsMask", effectsMask);
+                effect.material->setRoTexture(effect.computePipeline, "source", source);
+                effect.material->setRwTexture(effect.computePipeline, "target", target);
+                effect.material->bindPipeline(effect.computePipeline);
+                effect.material->dispatch((info.w + TileSize - 1) / TileSize, (info.h + TileSize - 1) / TileSize, 1);
+                return;
+            }
+
+            effect.material->setProperty(effect.pipeline.empty() ? "default" : effect.pipeline, "effectsMask", effectsMask);
+        }
+        else if (!effect.isEnabled)
+        {
+            return;
+        }
+
+        if (target)
+        {
+            d3d::set_render_target(target, 0);
+        }
+        d3d::settex(0, source);
+
+        if (effect.pipeline.empty())
+        {
+            effect.material->bind();
+        }
+        else
+        {
+            effect.material->bindPipeline(effect.pipeline);
+        }
+
+        d3d::setvsrc(0, nullptr, 0);
+        d3d::setind(nullptr);
+
+        d3d::draw(PRIM_TRISTRIP, 0, 2);  // Draw quad
+    }
+
+}  // namespace nau::render
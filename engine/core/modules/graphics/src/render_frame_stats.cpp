@@ -0,0 +1,116 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "nau/render/render_frame_stats.h"
+
+#include <atomic>
+#include <mutex>
+
+#include "frame_stats_collector.h"
+#include "nau/3d/dag_drv3d.h"
+#include "nau/threading/lock_guard.h"
+#include "render/daBfg/nodeTimings.h"
+
+namespace nau::render
+{
+    namespace
+    {
+        enum class NodeTimingsRequest : int
+        {
+            None,
+            Enable,
+            Disable
+        };
+
+        // The request is applied only once: the node timings can be also toggled by the debug window.
+        std::atomic<NodeTimingsRequest> s_nodeTimingsRequest = NodeTimingsRequest::None;
+
+        std::mutex s_statsMutex;
+        RenderFrameStats s_frameStats;
+        uint64_t s_frameIndex = 0;
+
+        std::atomic<uint32_t> s_testedInstances = 0;
+        std::atomic<uint32_t> s_visibleInstances = 0;
+    }  // namespace
+
+    void setRenderNodeTimingsEnabled(bool enabled)
+    {
+        s_nodeTimingsRequest.store(enabled ? NodeTimingsRequest::Enable : NodeTimingsRequest::Disable, std::memory_order_release);
+    }
+
+    RenderFrameStats getRenderFrameStats()
+    {
+        lock_(s_statsMutex);
+        return s_frameStats;
+    }
+
+    void addInstanceCullingStats(uint32_t testedCount, uint32_t visibleCount)
+    {
+        s_testedInstances.fetch_add(testedCount, std::memory_order_relaxed);
+        s_visibleInstances.fetch_add(visibleCount, std::memory_order_relaxed);
+    }
+
+    void collectRenderFrameStats(std::chrono::microseconds cpuRenderTime)
+    {
+        const NodeTimingsRequest request = s_nodeTimingsRequest.exchange(NodeTimingsRequest::None, std::memory_order_acquire);
+        if (request != NodeTimingsRequest::None)
+        {
+            dabfg::set_node_timings_enabled(request == NodeTimingsRequest::Enable);
+        }
+
+        RenderFrameStats stats;
+        stats.frameIndex = ++s_frameIndex;
+        stats.cpuRenderMs = static_cast<float>(cpuRenderTime.count()) / 1000.f;
+
+        Drv3dDrawStats drawStats{};
+        if (d3d::driver_command(DRV3D_COMMAND_GET_FRAME_DRAW_STATS, &drawStats, nullptr, nullptr) != 0)
+        {
+            stats.drawCalls = drawStats.drawCalls;
+            stats.instances = drawStats.instances;
+            stats.triangles = drawStats.triangles;
+            stats.dispatches = drawStats.dispatches;
+        }
+
+        stats.testedInstances = s_testedInstances.exchange(0, std::memory_order_relaxed);
+        stats.visibleInstances = s_visibleInstances.exchange(0, std::memory_order_relaxed);
+
+        uint32_t vramBudgetKb = 0;
+        uint32_t vramUsedKb = 0;
+        if (d3d::driver_command(DRV3D_COMMAND_GET_VIDEO_MEMORY_BUDGET, &vramBudgetKb, nullptr, &vramUsedKb) != 0)
+        {
+            stats.vramBudgetKb = vramBudgetKb;
+            stats.vramUsedKb = vramUsedKb;
+        }
+
+        if (dabfg::is_node_timings_enabled())
+        {
+            float gpuFrameMs = 0.f;
+            bool hasGpuTimings = false;
+
+            for (dabfg::NodeTimings& timings : dabfg::get_node_timings())
+            {
+                RenderNodeStats& node = stats.nodes.emplace_back();
+                node.name = std::move(timings.name);
+                node.cpuAvgMs = timings.cpuAvg;
+                node.cpuMaxMs = timings.cpuMax;
+                node.gpuAvgMs = timings.gpuAvg;
+                node.gpuMaxMs = timings.gpuMax;
+                node.drawCalls = timings.drawCalls;
+                node.instances = timings.instances;
+                node.triangles = timings.triangles;
+
+                if (timings.gpuAvg >= 0.f)
+                {
+                    gpuFrameMs += timings.gpuAvg;
+                    hasGpuTimings = true;
+                }
+            }
+
+            stats.gpuFrameMs = hasGpuTimings ? gpuFrameMs : -1.f;
+        }
+
+        lock_(s_statsMutex);
+        s_frameStats = std::move(stats);
+    }
+}  // namespace nau::render
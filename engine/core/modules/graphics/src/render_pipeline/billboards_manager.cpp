@@ -3,22 +3,25 @@
 
 
 #include "render_pipeline/billboards_manager.h"
+
+#include <EASTL/sort.h>
+
 #include "graphics_impl.h"
 
 namespace nau
 {
-    struct BillboardData
+    struct BillboardConstants
     {
-        nau::math::Vector4 worldPositionScPercentsize;
-        nau::Uid uid;
         nau::math::float4 aspectRatio;
+        uint32_t firstInstance;
+        uint32_t padding[3];
     };
 
 
     BillboardsManager::BillboardsManager(nau::Ptr<nau::MaterialAssetView> material)
     {
         m_billboardMaterial = material;
-        dataBuffer = d3d::create_cb(sizeof(BillboardData), SBCF_DYNAMIC, u8"billboard buffer");
+        dataBuffer = d3d::create_cb(sizeof(BillboardConstants), SBCF_DYNAMIC, u8"billboard buffer");
     }
 
     BillboardsManager::~BillboardsManager()
@@ -28,6 +31,11 @@ namespace nau
             dataBuffer->destroy();
             dataBuffer = nullptr;
         }
+        if (m_instancesBuffer)
+        {
+            m_instancesBuffer->destroy();
+            m_instancesBuffer = nullptr;
+        }
     }
 
 
@@ -60,6 +68,42 @@ namespace nau
 
         NAU_ASSERT(m_billboardMaterial);
 
+        m_visibleBillboards.clear();
+        for (const auto& billboard : m_billboards)
+        {
+            if (const auto bill = billboard.lock())
+            {
+                if (!bill->isVisible)
+                {
+                    continue;
+                }
+
+                NAU_ASSERT(bill->texture);
+                nau::Ptr<TextureAssetView> textureView;
+                bill->texture->getTyped<TextureAssetView>(textureView);
+                NAU_ASSERT(textureView->getTexture());
+
+                m_visibleBillboards.push_back({textureView->getTexture(), {nau::math::Vector4(bill->worldPosition, bill->screenPercentageSize), bill->uid}});
+            }
+            else
+            {
+                m_isBillboardsDirty = true;
+            }
+        }
+
+        if (m_visibleBillboards.empty())
+        {
+            return;
+        }
+
+        // The billboards of one texture are drawn by one instanced draw.
+        eastl::stable_sort(m_visibleBillboards.begin(), m_visibleBillboards.end(), [](const VisibleBillboard& left, const VisibleBillboard& right)
+        {
+            return left.texture < right.texture;
+        });
+
+        updateInstancesBuffer();
+
         nau::shader_globals::setVariable("vp", &viewProj);
 
         d3d::setvsrc(0, nullptr, 0);
@@ -74,44 +118,68 @@ namespace nau
             aspectRatio = width / static_cast<float>(height);
         }
 
-        BillboardData data;
-        data.aspectRatio = nau::math::float4(aspectRatio, 0.0f, 0.0f, 0.0f);
+        BillboardConstants constants = {};
+        constants.aspectRatio = nau::math::float4(aspectRatio, 0.0f, 0.0f, 0.0f);
 
-        for (const auto billboard : m_billboards)
+        const uint32_t visibleCount = static_cast<uint32_t>(m_visibleBillboards.size());
+        for (uint32_t first = 0; first < visibleCount;)
         {
-            if (const auto bill = billboard.lock())
+            BaseTexture* const texture = m_visibleBillboards[first].texture;
+
+            uint32_t last = first + 1;
+            while (last < visibleCount && m_visibleBillboards[last].texture == texture)
             {
-                if (!bill->isVisible)
-                {
-                    continue;
-                }
+                ++last;
+            }
 
-                NAU_ASSERT(bill->texture);
-                nau::Ptr<TextureAssetView> textureView;
-                bill->texture->getTyped<TextureAssetView>(textureView);
-                NAU_ASSERT(textureView->getTexture());
+            constants.firstInstance = first;
+            dataBuffer->updateDataWithLock(0, sizeof(BillboardConstants), &constants, VBLOCK_DISCARD);
+
+            m_billboardMaterial->setCBuffer("default", "SB_BillboardBuffer", dataBuffer);
+            m_billboardMaterial->setRoBuffer("default", "billboardsBuffer", m_instancesBuffer);
+            m_billboardMaterial->setTexture("default", "tex", texture);
 
-                data.worldPositionScPercentsize = nau::math::Vector4(bill->worldPosition, bill->screenPercentageSize);
-                data.uid = bill->uid;
+            m_billboardMaterial->bind();
 
-                dataBuffer->updateDataWithLock(0, sizeof(BillboardData), &data, VBLOCK_DISCARD);
+            d3d::draw_instanced(PRIM_TRISTRIP, 0, 2, last - first);
 
-                m_billboardMaterial->setCBuffer("default", "SB_BillboardBuffer", dataBuffer);
-                m_billboardMaterial->setTexture("default", "tex", textureView->getTexture());
+            first = last;
+        }
+    }
 
-                m_billboardMaterial->bind();
+    void BillboardsManager::updateInstancesBuffer()
+    {
+        const uint32_t instancesCount = static_cast<uint32_t>(m_visibleBillboards.size());
 
-                d3d::draw(PRIM_TRISTRIP, 0, 2);
-            }
-            else
+        m_instances.clear();
+        m_instances.reserve(instancesCount);
+        for (const VisibleBillboard& billboard : m_visibleBillboards)
+        {
+            m_instances.push_back(billboard.instance);
+        }
+
+        constexpr uint32_t stride = sizeof(BillboardInstance);
+
+        if (m_instancesCapacity < instancesCount)
+        {
+            m_instancesCapacity = eastl::max(MinInstancesCapacity, instancesCount + instancesCount / 2);
+
+            if (m_instancesBuffer)
             {
-                m_isBillboardsDirty = true;
+                m_instancesBuffer->destroy();
             }
+
+            m_instancesBuffer = d3d::create_sbuffer(stride, m_instancesCapacity, SBCF_BIND_SHADER_RES | SBCF_MISC_STRUCTURED | SBCF_DYNAMIC, 0, u8"billboards instances buf");
+            NAU_ASSERT(m_instancesBuffer);
         }
+
+        // The billboard handles change the billboards without notifying the manager: all the visible ones are uploaded every frame.
+        const bool isUpdated = m_instancesBuffer->updateData(0, stride * instancesCount, m_instances.data(), VBLOCK_WRITEONLY | VBLOCK_DISCARD);
+        NAU_ASSERT(isUpdated);
     }
 
     RenderList::Ptr BillboardsManager::getRenderList(const nau::math::Vector3& viewerPosition,
-        eastl::function<bool(const InstanceInfo&)>& filterFunc,
+        const InstanceCulling& culling,
         eastl::function<bool(const nau::MaterialAssetView::Ptr)>& materialFilter)
     {
         NAU_FAILURE("Not implemented yet!");
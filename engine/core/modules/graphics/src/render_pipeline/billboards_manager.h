@@ -11,6 +11,11 @@ namespace nau
 {
     class BillboardHandle;
 
+    /**
+     * Draws the visible billboards with one instanced draw per billboard texture.
+     * The billboards data is packed into the structured buffer "billboardsBuffer" once per frame:
+     * the shader reads the billboard (firstInstance + SV_InstanceID), firstInstance is in the "SB_BillboardBuffer" constants.
+     */
     class BillboardsManager : public IRenderManager
     {
         NAU_CLASS_(nau::BillboardsManager, IRenderManager);
@@ -36,18 +41,39 @@ namespace nau
 
         // Inherited via IRenderManager
         RenderList::Ptr getRenderList(const nau::math::Vector3& viewerPosition,
-            eastl::function<bool(const InstanceInfo&)>& filterFunc,
+            const InstanceCulling& culling,
             eastl::function<bool(const nau::MaterialAssetView::Ptr)>& materialFilter) override;
 
         void update() override;
 
     protected:
+        struct BillboardInstance
+        {
+            nau::math::Vector4 worldPositionScPercentsize;
+            nau::Uid uid;
+        };
+
+        struct VisibleBillboard
+        {
+            BaseTexture* texture;
+            BillboardInstance instance;
+        };
+
+        static constexpr uint32_t MinInstancesCapacity = 256;
+
+        void updateInstancesBuffer();
+
         eastl::vector<eastl::weak_ptr<BillboardInfo>> m_billboards;
 
         nau::Ptr<nau::MaterialAssetView> m_billboardMaterial;
         bool m_isBillboardsDirty = false;
 
         Sbuffer* dataBuffer = nullptr;
+
+        eastl::vector<VisibleBillboard> m_visibleBillboards;
+        eastl::vector<BillboardInstance> m_instances;
+        Sbuffer* m_instancesBuffer = nullptr;
+        uint32_t m_instancesCapacity = 0;
     };
 
     class BillboardHandle
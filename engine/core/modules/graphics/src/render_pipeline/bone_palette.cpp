@@ -0,0 +1,72 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "bone_palette.h"
+
+
+namespace nau
+{
+    BonePalette::~BonePalette()
+    {
+        if (m_buffer)
+        {
+            m_buffer->destroy();
+            m_buffer = nullptr;
+        }
+    }
+
+    void BonePalette::clear()
+    {
+        m_matrices.clear();
+    }
+
+    uint32_t BonePalette::addBones(eastl::span<const nau::math::Matrix4> transforms, eastl::span<const nau::math::Matrix4> normalTransforms)
+    {
+        NAU_ASSERT(transforms.size() == normalTransforms.size());
+
+        const uint32_t offset = static_cast<uint32_t>(m_matrices.size());
+        m_matrices.reserve(m_matrices.size() + transforms.size() * 2);
+        for (size_t bone = 0; bone < transforms.size(); ++bone)
+        {
+            m_matrices.push_back(transforms[bone]);
+            m_matrices.push_back(normalTransforms[bone]);
+        }
+
+        return offset;
+    }
+
+    void BonePalette::flush()
+    {
+        const uint32_t matricesCount = static_cast<uint32_t>(m_matrices.size());
+        if (matricesCount == 0)
+        {
+            return;
+        }
+
+        constexpr uint32_t stride = sizeof(nau::math::Matrix4);
+
+        if (m_capacity < matricesCount)
+        {
+            m_capacity = eastl::max(MinCapacity, matricesCount + matricesCount / 2);
+
+            if (m_buffer)
+            {
+                m_buffer->destroy();
+            }
+
+            m_buffer = d3d::create_sbuffer(stride, m_capacity, SBCF_BIND_SHADER_RES | SBCF_MISC_STRUCTURED | SBCF_DYNAMIC, 0, u8"bone palette buf");
+            NAU_ASSERT(m_buffer);
+        }
+
+        // All the skeletons are animated: the whole palette is rewritten every frame.
+        const bool isUpdated = m_buffer->updateData(0, stride * matricesCount, m_matrices.data(), VBLOCK_WRITEONLY | VBLOCK_DISCARD);
+        NAU_ASSERT(isUpdated);
+    }
+
+    Sbuffer* BonePalette::getBuffer() const
+    {
+        return m_buffer;
+    }
+
+} // namespace nau
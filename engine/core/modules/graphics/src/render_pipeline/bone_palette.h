@@ -0,0 +1,50 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <EASTL/span.h>
+#include <EASTL/vector.h>
+
+#include "nau/3d/dag_drv3d.h"
+#include "nau/math/math.h"
+
+
+namespace nau
+{
+    /**
+     * Bone matrices of all the skeletons, written once per frame and shared by all the passes and views.
+     * Each skeleton gets a range of the float4x4 pairs (the bone transform, then its normal transform):
+     * the skinned vertex shaders read the bone i at (bonesOffset + i * 2), the offset is in RenderEntity::InstanceData::bonesOffset.
+     */
+    class BonePalette
+    {
+    public:
+        BonePalette() = default;
+        BonePalette(const BonePalette&) = delete;
+        ~BonePalette();
+
+        BonePalette& operator=(const BonePalette&) = delete;
+
+        // Starts the frame palette, the offsets of the previous frame are invalid.
+        void clear();
+
+        // Returns the bonesOffset of the skeleton.
+        uint32_t addBones(eastl::span<const nau::math::Matrix4> transforms, eastl::span<const nau::math::Matrix4> normalTransforms);
+
+        // Uploads the whole palette with one update.
+        void flush();
+
+        // Recreated when the palette exceeds its capacity: valid until the next flush().
+        Sbuffer* getBuffer() const;
+
+    private:
+        static constexpr uint32_t MinCapacity = 4096;
+
+        eastl::vector<nau::math::Matrix4> m_matrices;
+        Sbuffer* m_buffer = nullptr;
+        uint32_t m_capacity = 0;
+    };
+
+} // namespace nau
@@ -0,0 +1,192 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "draw_packets.h"
+
+#include <EASTL/bit.h>
+
+#include "graphics_assets/material_asset.h"
+#include "render_entity.h"
+
+
+namespace nau
+{
+    namespace
+    {
+        constexpr uint32_t PipelineBits = 2;
+        constexpr uint32_t MaterialBits = 20;
+        constexpr uint32_t BuffersBits = 16;
+        constexpr uint32_t StateDepthBits = 26;
+        constexpr uint32_t BackToFrontDepthBits = 24;
+
+        constexpr uint32_t RadixBits = 8;
+        constexpr uint32_t RadixSize = 1 << RadixBits;
+
+        uint64_t hashPointer(const void* ptr, uint32_t bits)
+        {
+            uint64_t value = reinterpret_cast<uintptr_t>(ptr);
+            value ^= value >> 33;
+            value *= 0xff51afd7ed558ccdull;
+            value ^= value >> 33;
+            return value >> (64 - bits);
+        }
+
+        // The bits of the positive floats are ordered as the floats.
+        uint64_t quantizeDepth(float depth, uint32_t bits)
+        {
+            const uint32_t depthBits = eastl::bit_cast<uint32_t>(eastl::max(depth, 0.f));
+            return depthBits >> (31 - bits);
+        }
+
+        uint64_t makeStateBits(DrawPipeline pipeline, const MaterialAssetView* material, const RenderEntity& entity)
+        {
+            const uint64_t buffers = hashPointer(entity.positionBuffer, BuffersBits) ^ hashPointer(entity.indexBuffer, BuffersBits);
+
+            return (static_cast<uint64_t>(pipeline) << (MaterialBits + BuffersBits)) |
+                   (hashPointer(material, MaterialBits) << BuffersBits) |
+                   buffers;
+        }
+    }  // namespace
+
+    uint64_t makeDrawSortKey(DrawOrder order, DrawPipeline pipeline, const MaterialAssetView* material, const RenderEntity& entity, const nau::math::Matrix4& viewProj)
+    {
+        static_assert(PipelineBits + MaterialBits + BuffersBits + StateDepthBits == 64);
+        static_assert(BackToFrontDepthBits + PipelineBits + MaterialBits + BuffersBits <= 64);
+
+        // The instanced entities keep the first instance transform.
+        const float depth = (viewProj * nau::math::Vector4(entity.worldTransform.getTranslation(), 1.f)).getW();
+        const uint64_t state = makeStateBits(pipeline, material, entity);
+
+        if (order == DrawOrder::BackToFront)
+        {
+            const uint64_t invertedDepth = ((1ull << BackToFrontDepthBits) - 1) - quantizeDepth(depth, BackToFrontDepthBits);
+            return (invertedDepth << (64 - BackToFrontDepthBits)) | state;
+        }
+
+        return (state << StateDepthBits) | quantizeDepth(depth, StateDepthBits);
+    }
+
+    void sortDrawPackets(nau::FrameVector<DrawPacket>& packets)
+    {
+        const size_t count = packets.size();
+        if (count < 2)
+        {
+            return;
+        }
+
+        nau::FrameVector<DrawPacket> buffer;
+        buffer.resize(count);
+
+        DrawPacket* source = packets.data();
+        DrawPacket* target = buffer.data();
+
+        for (uint32_t shift = 0; shift < 64; shift += RadixBits)
+        {
+            eastl::array<uint32_t, RadixSize> offsets = {};
+            for (size_t i = 0; i < count; ++i)
+            {
+                ++offsets[(source[i].sortKey >> shift) & (RadixSize - 1)];
+            }
+
+            // All the keys share the digit: the pass does not change the order.
+            if (offsets[(source[0].sortKey >> shift) & (RadixSize - 1)] == count)
+            {
+                continue;
+            }
+
+            uint32_t offset = 0;
+            for (uint32_t& digitOffset : offsets)
+            {
+                const uint32_t digitCount = digitOffset;
+                digitOffset = offset;
+                offset += digitCount;
+            }
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                target[offsets[(source[i].sortKey >> shift) & (RadixSize - 1)]++] = source[i];
+            }
+
+            eastl::swap(source, target);
+        }
+
+        if (source != packets.data())
+        {
+            eastl::copy(source, source + count, packets.data());
+        }
+    }
+
+    void DrawStateCache::bindPipeline(MaterialAssetView* material, NameId pipelineName)
+    {
+        NAU_ASSERT(material);
+
+        if (material == m_material && pipelineName == m_pipelineName)
+        {
+            material->updatePipelineConstants(pipelineName);
+            return;
+        }
+
+        material->bindPipeline(pipelineName);
+
+        m_material = material;
+        m_pipelineName = pipelineName;
+        m_knownVsBuffers = 0;
+    }
+
+    void DrawStateCache::setVertexSource(uint32_t stream, Sbuffer* buffer, uint32_t stride)
+    {
+        NAU_ASSERT(stream < MaxVertexStreams);
+
+        VertexSource& source = m_vertexSources[stream];
+        const uint32_t streamBit = 1 << stream;
+        if ((m_knownVertexSources & streamBit) && source.buffer == buffer && source.stride == stride)
+        {
+            return;
+        }
+
+        d3d::setvsrc(stream, buffer, stride);
+
+        source = {buffer, stride};
+        m_knownVertexSources |= streamBit;
+    }
+
+    void DrawStateCache::setIndices(Sbuffer* buffer)
+    {
+        if (m_isIndicesKnown && m_indices == buffer)
+        {
+            return;
+        }
+
+        d3d::setind(buffer);
+
+        m_indices = buffer;
+        m_isIndicesKnown = true;
+    }
+
+    void DrawStateCache::setVsBuffer(uint32_t slot, Sbuffer* buffer)
+    {
+        NAU_ASSERT(slot < MaxVsBuffers);
+
+        const uint32_t slotBit = 1 << slot;
+        if ((m_knownVsBuffers & slotBit) && m_vsBuffers[slot] == buffer)
+        {
+            return;
+        }
+
+        d3d::set_buffer(STAGE_VS, slot, buffer);
+
+        m_vsBuffers[slot] = buffer;
+        m_knownVsBuffers |= slotBit;
+    }
+
+    void DrawStateCache::reset()
+    {
+        m_material = nullptr;
+        m_pipelineName = {};
+        m_knownVertexSources = 0;
+        m_isIndicesKnown = false;
+        m_knownVsBuffers = 0;
+    }
+
+} // namespace nau
@@ -0,0 +1,98 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <EASTL/array.h>
+#include <EASTL/string_view.h>
+
+#include "nau/3d/dag_drv3d.h"
+#include "nau/math/math.h"
+#include "nau/memory/eastl_aliases.h"
+#include "nau/string/name_id.h"
+
+
+namespace nau
+{
+    class MaterialAssetView;
+    struct RenderEntity;
+
+    // Submission order of the view draws.
+    enum class DrawOrder : uint8_t
+    {
+        // Grouped by the pipeline, the material and the vertex buffers, front to back within the same state.
+        State,
+        // Back to front by the depth only: for the blended draws.
+        BackToFront
+    };
+
+    // The entity pipeline kind, the most significant state of the sort key.
+    enum class DrawPipeline : uint8_t
+    {
+        Default,
+        Instanced,
+        Skinned
+    };
+
+    /**
+     * One draw of the view pass.
+     * The packets are sorted by the keys, so the neighbouring draws share the state and DrawStateCache skips its binds.
+     */
+    struct DrawPacket
+    {
+        uint64_t sortKey;
+        const RenderEntity* entity;
+        // Entity index in the view lists: the indirect arguments of the GPU culling are in this order.
+        uint32_t drawIndex;
+    };
+
+    /**
+     * State order: pipeline (2 bits), material (20 bits), vertex buffers (16 bits), depth (26 bits).
+     * Back to front order: inverted depth (24 bits), then the state fields as the tie break.
+     * The material and the buffers are hashed: the collisions cost the redundant binds only.
+     */
+    uint64_t makeDrawSortKey(DrawOrder order, DrawPipeline pipeline, const MaterialAssetView* material, const RenderEntity& entity, const nau::math::Matrix4& viewProj);
+
+    // LSD radix sort by the keys, the order of the equal keys is kept.
+    void sortDrawPackets(nau::FrameVector<DrawPacket>& packets);
+
+    /**
+     * Last bound state of the pass draws.
+     * The binds equal to the bound state are skipped, the same material pipeline only updates its constants.
+     */
+    class DrawStateCache
+    {
+    public:
+        static constexpr uint32_t MaxVertexStreams = 8;
+        static constexpr uint32_t MaxVsBuffers = 4;
+
+        void bindPipeline(MaterialAssetView* material, NameId pipelineName);
+        void setVertexSource(uint32_t stream, Sbuffer* buffer, uint32_t stride);
+        void setIndices(Sbuffer* buffer);
+        // Vertex shader structured buffers.
+        void setVsBuffer(uint32_t slot, Sbuffer* buffer);
+
+        // For the binds made past the cache.
+        void reset();
+
+    private:
+        struct VertexSource
+        {
+            Sbuffer* buffer;
+            uint32_t stride;
+        };
+
+        MaterialAssetView* m_material = nullptr;
+        NameId m_pipelineName;
+
+        eastl::array<VertexSource, MaxVertexStreams> m_vertexSources = {};
+        uint32_t m_knownVertexSources = 0;
+        Sbuffer* m_indices = nullptr;
+        bool m_isIndicesKnown = false;
+        // The material pipelines bind their own buffers: the slots are unknown after the pipeline change.
+        eastl::array<Sbuffer*, MaxVsBuffers> m_vsBuffers = {};
+        uint32_t m_knownVsBuffers = 0;
+    };
+
+} // namespace nau
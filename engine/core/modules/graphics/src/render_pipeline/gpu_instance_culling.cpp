@@ -0,0 +1,233 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "gpu_instance_culling.h"
+
+#include "nau/memory/eastl_aliases.h"
+
+
+namespace nau
+{
+    namespace
+    {
+        const MaterialAssetView::PropertyId FrustumPlaneProperties[6] = {
+            MaterialAssetView::makePropertyId("default", "frustumPlane0"),
+            MaterialAssetView::makePropertyId("default", "frustumPlane1"),
+            MaterialAssetView::makePropertyId("default", "frustumPlane2"),
+            MaterialAssetView::makePropertyId("default", "frustumPlane3"),
+            MaterialAssetView::makePropertyId("default", "frustumPlane4"),
+            MaterialAssetView::makePropertyId("default", "frustumPlane5")};
+        const MaterialAssetView::PropertyId CandidatesCountProperty = MaterialAssetView::makePropertyId("default", "candidatesCount");
+        const MaterialAssetView::PropertyId CullingPhaseProperty = MaterialAssetView::makePropertyId("default", "cullingPhase");
+        const MaterialAssetView::PropertyId HiZViewProjectionProperty = MaterialAssetView::makePropertyId("default", "hiZViewProjection");
+        const MaterialAssetView::PropertyId HiZSizeProperty = MaterialAssetView::makePropertyId("default", "hiZSize");
+
+        void destroyBuffer(Sbuffer*& buffer)
+        {
+            if (buffer)
+            {
+                buffer->destroy();
+                buffer = nullptr;
+            }
+        }
+    }  // namespace
+
+    GpuInstanceCulling::GpuInstanceCulling(MaterialAssetView::Ptr cullingMaterial) :
+        m_material(std::move(cullingMaterial))
+    {
+        NAU_ASSERT(m_material);
+    }
+
+    GpuInstanceCulling::~GpuInstanceCulling()
+    {
+        destroyBuffer(m_candidateDraws);
+        destroyBuffer(m_drawFirstInstances);
+        destroyBuffer(m_visibleIndices);
+        destroyBuffer(m_drawArgs);
+        destroyBuffer(m_lateVisibleIndices);
+        destroyBuffer(m_lateDrawArgs);
+        destroyBuffer(m_visibilityFlags);
+    }
+
+    void GpuInstanceCulling::reserve(uint32_t candidatesCount, uint32_t drawsCount)
+    {
+        if (m_candidatesCapacity < candidatesCount)
+        {
+            m_candidatesCapacity = candidatesCount;
+
+            destroyBuffer(m_candidateDraws);
+            destroyBuffer(m_visibleIndices);
+            destroyBuffer(m_lateVisibleIndices);
+            m_candidateDraws = d3d::create_sbuffer(sizeof(uint32_t), m_candidatesCapacity, SBCF_BIND_SHADER_RES | SBCF_MISC_STRUCTURED | SBCF_DYNAMIC, 0, u8"gpu culling candidate draws buf");
+            m_visibleIndices = d3d::create_sbuffer(sizeof(uint32_t), m_candidatesCapacity, SBCF_UA_SR_STRUCTURED, 0, u8"gpu culling visible indices buf");
+            m_lateVisibleIndices = d3d::create_sbuffer(sizeof(uint32_t), m_candidatesCapacity, SBCF_UA_SR_STRUCTURED, 0, u8"gpu culling late visible indices buf");
+        }
+
+        if (m_drawsCapacity < drawsCount)
+        {
+            m_drawsCapacity = drawsCount;
+
+            destroyBuffer(m_drawFirstInstances);
+            destroyBuffer(m_drawArgs);
+            destroyBuffer(m_lateDrawArgs);
+            m_drawFirstInstances = d3d::create_sbuffer(sizeof(uint32_t), m_drawsCapacity, SBCF_BIND_SHADER_RES | SBCF_MISC_STRUCTURED | SBCF_DYNAMIC, 0, u8"gpu culling draw first instances buf");
+            m_drawArgs = d3d::create_sbuffer(sizeof(uint32_t), m_drawsCapacity * (getDrawArgsStride() / sizeof(uint32_t)), SBCF_UA_INDIRECT, 0, u8"gpu culling draw args buf");
+            m_lateDrawArgs = d3d::create_sbuffer(sizeof(uint32_t), m_drawsCapacity * (getDrawArgsStride() / sizeof(uint32_t)), SBCF_UA_INDIRECT, 0, u8"gpu culling late draw args buf");
+        }
+
+        NAU_ASSERT(m_candidateDraws && m_visibleIndices && m_lateVisibleIndices && m_drawFirstInstances && m_drawArgs && m_lateDrawArgs);
+    }
+
+    void GpuInstanceCulling::reserveVisibilityFlags(uint32_t slotsCount)
+    {
+        if (m_slotsCapacity >= slotsCount)
+        {
+            return;
+        }
+
+        // The new slots are not visible: their instances are drawn by the late phase of the first frame.
+        m_slotsCapacity = slotsCount;
+        destroyBuffer(m_visibilityFlags);
+        m_visibilityFlags = d3d::create_sbuffer(sizeof(uint32_t), m_slotsCapacity, SBCF_UA_SR_STRUCTURED, 0, u8"gpu culling visibility flags buf");
+        NAU_ASSERT(m_visibilityFlags);
+
+        const unsigned zeros[4] = {0, 0, 0, 0};
+        d3d::clear_rwbufi(m_visibilityFlags, zeros);
+    }
+
+    uint32_t GpuInstanceCulling::upload(Sbuffer* instanceBounds, Sbuffer* candidateIndices, eastl::span<const DrawInfo> draws)
+    {
+        uint32_t candidatesCount = 0;
+        for (const DrawInfo& draw : draws)
+        {
+            candidatesCount += draw.instancesCount;
+        }
+
+        if (candidatesCount == 0 || !instanceBounds || !candidateIndices)
+        {
+            return 0;
+        }
+
+        const uint32_t drawsCount = static_cast<uint32_t>(draws.size());
+        reserve(candidatesCount, drawsCount);
+
+        nau::FrameVector<uint32_t> candidateDraws;
+        nau::FrameVector<uint32_t> drawFirstInstances;
+        nau::FrameVector<DrawIndexedIndirectArgs> drawArgs;
+        candidateDraws.reserve(candidatesCount);
+        drawFirstInstances.reserve(drawsCount);
+        drawArgs.reserve(drawsCount);
+
+        for (uint32_t drawIndex = 0; drawIndex < drawsCount; ++drawIndex)
+        {
+            const DrawInfo& draw = draws[drawIndex];
+            NAU_ASSERT(draw.firstInstance == candidateDraws.size(), "Draws candidates are expected to be consecutive");
+
+            candidateDraws.insert(candidateDraws.end(), draw.instancesCount, drawIndex);
+            drawFirstInstances.push_back(draw.firstInstance);
+            // The instances count is accumulated by the culling shader.
+            drawArgs.push_back({draw.indexCount, 0, draw.startIndex, draw.baseVertex, 0});
+        }
+
+        bool isUpdated = m_candidateDraws->updateData(0, sizeof(uint32_t) * candidatesCount, candidateDraws.data(), VBLOCK_WRITEONLY | VBLOCK_DISCARD);
+        isUpdated &= m_drawFirstInstances->updateData(0, sizeof(uint32_t) * drawsCount, drawFirstInstances.data(), VBLOCK_WRITEONLY | VBLOCK_DISCARD);
+        isUpdated &= m_drawArgs->updateData(0, getDrawArgsStride() * drawsCount, drawArgs.data(), VBLOCK_WRITEONLY);
+        isUpdated &= m_lateDrawArgs->updateData(0, getDrawArgsStride() * drawsCount, drawArgs.data(), VBLOCK_WRITEONLY);
+        NAU_ASSERT(isUpdated);
+
+        return candidatesCount;
+    }
+
+    void GpuInstanceCulling::dispatch(Phase phase, const nau::math::NauFrustum& frustum, Sbuffer* instanceBounds, Sbuffer* candidateIndices, uint32_t candidatesCount)
+    {
+        // The early phase writes the draws of the previous frame visible instances, the late one - the rest.
+        const bool isLate = phase == Phase::Late;
+
+        m_material->setRoBuffer("default", "instanceBounds", instanceBounds);
+        m_material->setRoBuffer("default", "candidateIndices", candidateIndices);
+        m_material->setRoBuffer("default", "candidateDraws", m_candidateDraws);
+        m_material->setRoBuffer("default", "drawFirstInstances", m_drawFirstInstances);
+        m_material->setRwBuffer("default", "visibleIndices", isLate ? m_lateVisibleIndices : m_visibleIndices);
+        m_material->setRwBuffer("default", "drawArgs", isLate ? m_lateDrawArgs : m_drawArgs);
+        if (phase != Phase::Frustum)
+        {
+            m_material->setRwBuffer("default", "visibilityFlags", m_visibilityFlags);
+        }
+
+        for (int plane = 0; plane < 6; ++plane)
+        {
+            m_material->setProperty(FrustumPlaneProperties[plane], frustum.camPlanes[plane]);
+        }
+        m_material->setProperty(CandidatesCountProperty, nau::math::Vector4(candidatesCount));
+        m_material->setProperty(CullingPhaseProperty, nau::math::Vector4(static_cast<float>(phase)));
+
+        m_material->bind();
+        m_material->dispatch((candidatesCount + ThreadGroupSize - 1) / ThreadGroupSize, 1, 1);
+    }
+
+    void GpuInstanceCulling::cull(const nau::math::NauFrustum& frustum, Sbuffer* instanceBounds, Sbuffer* candidateIndices, eastl::span<const DrawInfo> draws)
+    {
+        m_earlyCandidatesCount = 0;
+
+        if (const uint32_t candidatesCount = upload(instanceBounds, candidateIndices, draws); candidatesCount > 0)
+        {
+            dispatch(Phase::Frustum, frustum, instanceBounds, candidateIndices, candidatesCount);
+        }
+    }
+
+    void GpuInstanceCulling::cullEarly(const nau::math::NauFrustum& frustum, Sbuffer* instanceBounds, Sbuffer* candidateIndices, eastl::span<const DrawInfo> draws, uint32_t slotsCount)
+    {
+        m_earlyCandidatesCount = upload(instanceBounds, candidateIndices, draws);
+        if (m_earlyCandidatesCount == 0)
+        {
+            return;
+        }
+
+        reserveVisibilityFlags(slotsCount);
+
+        m_earlyFrustum = frustum;
+        m_earlyInstanceBounds = instanceBounds;
+        m_earlyCandidateIndices = candidateIndices;
+        dispatch(Phase::Early, frustum, instanceBounds, candidateIndices, m_earlyCandidatesCount);
+    }
+
+    bool GpuInstanceCulling::cullLate(const HiZBuffer& hiZ)
+    {
+        if (m_earlyCandidatesCount == 0 || !hiZ.getTexture())
+        {
+            return false;
+        }
+
+        // The material is shared by the views: the early phase buffers are bound again.
+        m_material->setRoTexture("default", "hiZ", hiZ.getTexture());
+        m_material->setProperty(HiZViewProjectionProperty, hiZ.getViewProjection());
+        m_material->setProperty(HiZSizeProperty, nau::math::Vector4(static_cast<float>(hiZ.getWidth()), static_cast<float>(hiZ.getHeight()), static_cast<float>(hiZ.getLevelsCount()), 0.f));
+
+        dispatch(Phase::Late, m_earlyFrustum, m_earlyInstanceBounds, m_earlyCandidateIndices, m_earlyCandidatesCount);
+        m_earlyCandidatesCount = 0;
+
+        return true;
+    }
+
+    Sbuffer* GpuInstanceCulling::getVisibleIndices() const
+    {
+        return m_visibleIndices;
+    }
+
+    Sbuffer* GpuInstanceCulling::getDrawArgs() const
+    {
+        return m_drawArgs;
+    }
+
+    Sbuffer* GpuInstanceCulling::getLateVisibleIndices() const
+    {
+        return m_lateVisibleIndices;
+    }
+
+    Sbuffer* GpuInstanceCulling::getLateDrawArgs() const
+    {
+        return m_lateDrawArgs;
+    }
+
+} // namespace nau
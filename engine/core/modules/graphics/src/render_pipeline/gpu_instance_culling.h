@@ -0,0 +1,116 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <EASTL/span.h>
+
+#include "graphics_assets/material_asset.h"
+#include "hi_z_buffer.h"
+#include "nau/3d/dag_drv3d.h"
+#include "nau/math/dag_frustum.h"
+
+
+namespace nau
+{
+    /**
+     * GPU frustum culling of the view instances (see RenderScene::CullingMode::Gpu).
+     * The compute material tests the candidate instances of each draw against the scene instances bounds (InstanceBuffer::getBoundsBuffer),
+     * compacts the visible ones into the draw range of getVisibleIndices() and counts them into the draw indirect arguments (getDrawArgs()).
+     *
+     * The occlusion culling is two-phase: cullEarly() takes only the instances visible in the previous frame (the per slot visibility flags),
+     * they are drawn into the depth, which is reduced into the Hi-Z. Then cullLate() tests all the candidates against the Hi-Z:
+     * the visible ones not drawn by the early phase go to getLateVisibleIndices() and getLateDrawArgs(), the flags are rewritten for the next frame.
+     */
+    class GpuInstanceCulling
+    {
+    public:
+        // Candidates range of one draw in the view instance indices and its index buffer range.
+        struct DrawInfo
+        {
+            uint32_t firstInstance;
+            uint32_t instancesCount;
+            uint32_t startIndex;
+            uint32_t indexCount;
+            int32_t baseVertex;
+        };
+
+        // Must match the culling compute shader.
+        static constexpr uint32_t ThreadGroupSize = 64;
+
+        // The "cullingPhase" of the culling compute shader.
+        enum class Phase : uint32_t
+        {
+            Frustum,
+            Early,
+            Late
+        };
+
+        explicit GpuInstanceCulling(MaterialAssetView::Ptr cullingMaterial);
+        GpuInstanceCulling(const GpuInstanceCulling&) = delete;
+        ~GpuInstanceCulling();
+
+        GpuInstanceCulling& operator=(const GpuInstanceCulling&) = delete;
+
+        /**
+         * Dispatches the culling of the draws candidates.
+         * candidateIndices holds the scene buffer slots of all the draws instances, each draw refers to its range.
+         */
+        void cull(const nau::math::NauFrustum& frustum, Sbuffer* instanceBounds, Sbuffer* candidateIndices, eastl::span<const DrawInfo> draws);
+
+        /**
+         * cull() of the instances visible in the previous frame only, the rest are left to cullLate().
+         * slotsCount is the scene instance slots count: the visibility flags are kept per slot.
+         */
+        void cullEarly(const nau::math::NauFrustum& frustum, Sbuffer* instanceBounds, Sbuffer* candidateIndices, eastl::span<const DrawInfo> draws, uint32_t slotsCount);
+
+        /**
+         * Tests the candidates of the last cullEarly() call against the frustum and the Hi-Z built from the early draws depth.
+         * Returns false if there was no early culling.
+         */
+        bool cullLate(const HiZBuffer& hiZ);
+
+        Sbuffer* getVisibleIndices() const;
+        // DrawIndexedIndirectArgs per draw, in the draws order of the last cull() call.
+        Sbuffer* getDrawArgs() const;
+
+        // The instances not drawn by the early phase, see cullLate().
+        Sbuffer* getLateVisibleIndices() const;
+        Sbuffer* getLateDrawArgs() const;
+
+        static constexpr uint32_t getDrawArgsStride()
+        {
+            return sizeof(DrawIndexedIndirectArgs);
+        }
+
+    private:
+        void reserve(uint32_t candidatesCount, uint32_t drawsCount);
+        void reserveVisibilityFlags(uint32_t slotsCount);
+        // Uploads the candidates and the zeroed draw arguments, returns the candidates count.
+        uint32_t upload(Sbuffer* instanceBounds, Sbuffer* candidateIndices, eastl::span<const DrawInfo> draws);
+        void dispatch(Phase phase, const nau::math::NauFrustum& frustum, Sbuffer* instanceBounds, Sbuffer* candidateIndices, uint32_t candidatesCount);
+
+        MaterialAssetView::Ptr m_material;
+
+        // Draw index of each candidate.
+        Sbuffer* m_candidateDraws = nullptr;
+        Sbuffer* m_drawFirstInstances = nullptr;
+        Sbuffer* m_visibleIndices = nullptr;
+        Sbuffer* m_drawArgs = nullptr;
+        Sbuffer* m_lateVisibleIndices = nullptr;
+        Sbuffer* m_lateDrawArgs = nullptr;
+        // 1 per scene slot for the instances visible in the previous frame.
+        Sbuffer* m_visibilityFlags = nullptr;
+        uint32_t m_candidatesCapacity = 0;
+        uint32_t m_drawsCapacity = 0;
+        uint32_t m_slotsCapacity = 0;
+
+        // The state of the last cullEarly() call for the cullLate() one.
+        nau::math::NauFrustum m_earlyFrustum;
+        Sbuffer* m_earlyInstanceBounds = nullptr;
+        Sbuffer* m_earlyCandidateIndices = nullptr;
+        uint32_t m_earlyCandidatesCount = 0;
+    };
+
+} // namespace nau
@@ -0,0 +1,132 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "hi_z_buffer.h"
+
+#include "nau/3d/dag_tex3d.h"
+
+
+namespace nau
+{
+    namespace
+    {
+        const MaterialAssetView::PropertyId LevelSizeProperty = MaterialAssetView::makePropertyId("default", "levelSize");
+    }  // namespace
+
+    HiZBuffer::HiZBuffer(MaterialAssetView::Ptr buildMaterial) :
+        m_material(std::move(buildMaterial))
+    {
+        NAU_ASSERT(m_material);
+    }
+
+    HiZBuffer::~HiZBuffer()
+    {
+        destroyTextures();
+    }
+
+    void HiZBuffer::destroyTextures()
+    {
+        for (BaseTexture* level : m_levels)
+        {
+            level->destroy();
+        }
+        m_levels.clear();
+
+        if (m_pyramid)
+        {
+            m_pyramid->destroy();
+            m_pyramid = nullptr;
+        }
+    }
+
+    void HiZBuffer::resize(uint32_t width, uint32_t height)
+    {
+        if (m_pyramid && m_width == width && m_height == height)
+        {
+            return;
+        }
+
+        destroyTextures();
+        m_width = width;
+        m_height = height;
+
+        uint32_t levelsCount = 1;
+        while ((width >> levelsCount) > 0 || (height >> levelsCount) > 0)
+        {
+            ++levelsCount;
+        }
+
+        m_pyramid = d3d::create_tex(nullptr, width, height, TEXFMT_R32F | TEXCF_UNORDERED, levelsCount, u8"hi-z pyramid tex");
+        NAU_ASSERT(m_pyramid);
+
+        m_levels.reserve(levelsCount);
+        for (uint32_t level = 0; level < levelsCount; ++level)
+        {
+            const uint32_t levelWidth = eastl::max(width >> level, 1u);
+            const uint32_t levelHeight = eastl::max(height >> level, 1u);
+            m_levels.push_back(d3d::create_tex(nullptr, levelWidth, levelHeight, TEXFMT_R32F | TEXCF_UNORDERED, 1, u8"hi-z level tex"));
+            NAU_ASSERT(m_levels.back());
+        }
+    }
+
+    void HiZBuffer::build(BaseTexture* depth, const nau::math::Matrix4& viewProjection)
+    {
+        NAU_ASSERT(depth);
+
+        TextureInfo depthInfo;
+        depth->getinfo(depthInfo, 0);
+        resize(eastl::max(depthInfo.w / 2u, 1u), eastl::max(depthInfo.h / 2u, 1u));
+
+        m_viewProjection = viewProjection;
+
+        // The level 0 is reduced from the depth itself, each next one from the previous level.
+        BaseTexture* source = depth;
+        for (uint32_t level = 0; level < m_levels.size(); ++level)
+        {
+            BaseTexture* const target = m_levels[level];
+
+            TextureInfo sourceInfo;
+            source->getinfo(sourceInfo, 0);
+            TextureInfo targetInfo;
+            target->getinfo(targetInfo, 0);
+
+            m_material->setRoTexture("default", "sourceDepth", source);
+            m_material->setRwTexture("default", "targetDepth", target);
+            m_material->setProperty(LevelSizeProperty, nau::math::Vector4(static_cast<float>(targetInfo.w), static_cast<float>(targetInfo.h), static_cast<float>(sourceInfo.w), static_cast<float>(sourceInfo.h)));
+
+            m_material->bind();
+            m_material->dispatch((targetInfo.w + ThreadGroupSize - 1) / ThreadGroupSize, (targetInfo.h + ThreadGroupSize - 1) / ThreadGroupSize, 1);
+
+            m_pyramid->updateSubRegion(target, 0, 0, 0, 0, targetInfo.w, targetInfo.h, 1, m_pyramid->calcSubResIdx(level), 0, 0, 0);
+
+            source = target;
+        }
+    }
+
+    BaseTexture* HiZBuffer::getTexture() const
+    {
+        return m_pyramid;
+    }
+
+    uint32_t HiZBuffer::getWidth() const
+    {
+        return m_width;
+    }
+
+    uint32_t HiZBuffer::getHeight() const
+    {
+        return m_height;
+    }
+
+    uint32_t HiZBuffer::getLevelsCount() const
+    {
+        return static_cast<uint32_t>(m_levels.size());
+    }
+
+    const nau::math::Matrix4& HiZBuffer::getViewProjection() const
+    {
+        return m_viewProjection;
+    }
+
+} // namespace nau
@@ -0,0 +1,64 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <EASTL/vector.h>
+
+#include "graphics_assets/material_asset.h"
+#include "nau/3d/dag_drv3d.h"
+#include "nau/math/math.h"
+
+
+namespace nau
+{
+    /**
+     * The depth pyramid (Hi-Z) of the camera depth, tested by the GPU occlusion culling (see GpuInstanceCulling::cullLate).
+     * Each texel of a level keeps the farthest depth of the texels it covers in the previous level (the depth is reversed: the minimum),
+     * the level 0 is the half of the depth resolution.
+     *
+     * The compute material reduces one level into the next one, the levels are built in the separate textures
+     * and copied into the mips of the pyramid texture, which the culling samples.
+     */
+    class HiZBuffer
+    {
+    public:
+        // Must match the build compute shader.
+        static constexpr uint32_t ThreadGroupSize = 8;
+
+        explicit HiZBuffer(MaterialAssetView::Ptr buildMaterial);
+        HiZBuffer(const HiZBuffer&) = delete;
+        ~HiZBuffer();
+
+        HiZBuffer& operator=(const HiZBuffer&) = delete;
+
+        /**
+         * Builds the pyramid from the depth target, rendered with the view projection.
+         * The depth must not be bound as the render target.
+         */
+        void build(BaseTexture* depth, const nau::math::Matrix4& viewProjection);
+
+        // Null until the first build.
+        BaseTexture* getTexture() const;
+        uint32_t getWidth() const;
+        uint32_t getHeight() const;
+        uint32_t getLevelsCount() const;
+
+        // The view projection the pyramid depth is rendered with.
+        const nau::math::Matrix4& getViewProjection() const;
+
+    private:
+        void resize(uint32_t width, uint32_t height);
+        void destroyTextures();
+
+        MaterialAssetView::Ptr m_material;
+
+        BaseTexture* m_pyramid = nullptr;
+        eastl::vector<BaseTexture*> m_levels;
+        uint32_t m_width = 0;
+        uint32_t m_height = 0;
+        nau::math::Matrix4 m_viewProjection = nau::math::Matrix4::identity();
+    };
+
+} // namespace nau
@@ -0,0 +1,232 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "instance_buffer.h"
+
+#include <EASTL/algorithm.h>
+#include <EASTL/sort.h>
+
+#include <limits>
+
+
+namespace nau
+{
+    namespace
+    {
+        // The radius passes any frustum test.
+        const nau::math::Vector4 NotCulledBounds{0.f, 0.f, 0.f, std::numeric_limits<float>::max()};
+    }  // namespace
+
+    InstanceBuffer::~InstanceBuffer()
+    {
+        for (GpuBuffers& buffers : m_ring)
+        {
+            if (buffers.data)
+            {
+                buffers.data->destroy();
+            }
+            if (buffers.bounds)
+            {
+                buffers.bounds->destroy();
+            }
+        }
+    }
+
+    uint32_t InstanceBuffer::allocateSlot()
+    {
+        lock_(m_mutex);
+
+        uint32_t slot;
+        if (!m_freeSlots.empty())
+        {
+            slot = m_freeSlots.back();
+            m_freeSlots.pop_back();
+            m_bounds[slot] = NotCulledBounds;
+        }
+        else
+        {
+            slot = static_cast<uint32_t>(m_data.size());
+            m_data.emplace_back();
+            m_bounds.push_back(NotCulledBounds);
+            m_isDirty.push_back(false);
+        }
+
+        return slot;
+    }
+
+    void InstanceBuffer::freeSlot(uint32_t slot)
+    {
+        if (slot == InvalidSlot)
+        {
+            return;
+        }
+
+        lock_(m_mutex);
+        NAU_ASSERT(slot < m_data.size());
+        m_freeSlots.push_back(slot);
+    }
+
+    void InstanceBuffer::setInstanceData(uint32_t slot, const RenderEntity::InstanceData& data)
+    {
+        lock_(m_mutex);
+        NAU_ASSERT(slot < m_data.size());
+
+        m_data[slot] = data;
+        markDirty(slot);
+    }
+
+    void InstanceBuffer::setInstanceData(uint32_t slot, const RenderEntity::InstanceData& data, const nau::math::BSphere3& bounds)
+    {
+        lock_(m_mutex);
+        NAU_ASSERT(slot < m_data.size());
+
+        m_data[slot] = data;
+        m_bounds[slot] = nau::math::Vector4{bounds.c, bounds.r};
+        markDirty(slot);
+    }
+
+    void InstanceBuffer::markDirty(uint32_t slot)
+    {
+        if (!m_isDirty[slot])
+        {
+            m_isDirty[slot] = true;
+            m_dirtySlots.push_back(slot);
+        }
+    }
+
+    void InstanceBuffer::flush()
+    {
+        lock_(m_mutex);
+
+        const uint32_t slotsCount = static_cast<uint32_t>(m_data.size());
+        if (slotsCount == 0)
+        {
+            return;
+        }
+
+        for (const uint32_t slot : m_dirtySlots)
+        {
+            m_isDirty[slot] = false;
+        }
+
+        if (m_capacity < slotsCount)
+        {
+            m_capacity = eastl::max(MinCapacity, slotsCount + slotsCount / 2);
+
+            for (GpuBuffers& buffers : m_ring)
+            {
+                if (buffers.data)
+                {
+                    buffers.data->destroy();
+                }
+                if (buffers.bounds)
+                {
+                    buffers.bounds->destroy();
+                }
+
+                buffers.data = d3d::create_sbuffer(sizeof(RenderEntity::InstanceData), m_capacity, SBCF_BIND_SHADER_RES | SBCF_MISC_STRUCTURED | SBCF_DYNAMIC, 0, u8"scene inst buf");
+                buffers.bounds = d3d::create_sbuffer(sizeof(nau::math::Vector4), m_capacity, SBCF_BIND_SHADER_RES | SBCF_MISC_STRUCTURED | SBCF_DYNAMIC, 0, u8"scene inst bounds buf");
+                NAU_ASSERT(buffers.data && buffers.bounds);
+
+                buffers.pendingSlots.clear();
+                buffers.isStale = true;
+            }
+        }
+        else
+        {
+            for (GpuBuffers& buffers : m_ring)
+            {
+                if (!buffers.isStale)
+                {
+                    buffers.pendingSlots.insert(buffers.pendingSlots.end(), m_dirtySlots.begin(), m_dirtySlots.end());
+                }
+            }
+        }
+
+        m_dirtySlots.clear();
+
+        m_ringIndex = (m_ringIndex + 1) % RingSize;
+        uploadPending(m_ring[m_ringIndex]);
+    }
+
+    void InstanceBuffer::uploadPending(GpuBuffers& buffers)
+    {
+        constexpr uint32_t stride = sizeof(RenderEntity::InstanceData);
+        constexpr uint32_t boundsStride = sizeof(nau::math::Vector4);
+
+        if (buffers.isStale)
+        {
+            const uint32_t slotsCount = static_cast<uint32_t>(m_data.size());
+            bool isUpdated = buffers.data->updateData(0, stride * slotsCount, m_data.data(), VBLOCK_WRITEONLY | VBLOCK_DISCARD);
+            isUpdated &= buffers.bounds->updateData(0, boundsStride * slotsCount, m_bounds.data(), VBLOCK_WRITEONLY | VBLOCK_DISCARD);
+            NAU_ASSERT(isUpdated);
+
+            buffers.pendingSlots.clear();
+            buffers.isStale = false;
+            return;
+        }
+
+        if (buffers.pendingSlots.empty())
+        {
+            return;
+        }
+
+        // The slot is pending once per frame it changed in.
+        eastl::sort(buffers.pendingSlots.begin(), buffers.pendingSlots.end());
+        buffers.pendingSlots.erase(eastl::unique(buffers.pendingSlots.begin(), buffers.pendingSlots.end()), buffers.pendingSlots.end());
+
+        // The GPU is done with the buffer (it was current RingSize frames ago): it is updated in place.
+        const auto uploadRange = [this, &buffers](uint32_t first, uint32_t last)
+        {
+            const uint32_t count = last - first + 1;
+            bool isUpdated = buffers.data->updateData(stride * first, stride * count, m_data.data() + first, VBLOCK_WRITEONLY | VBLOCK_NOOVERWRITE);
+            isUpdated &= buffers.bounds->updateData(boundsStride * first, boundsStride * count, m_bounds.data() + first, VBLOCK_WRITEONLY | VBLOCK_NOOVERWRITE);
+            NAU_ASSERT(isUpdated);
+        };
+
+        uint32_t rangeFirst = buffers.pendingSlots.front();
+        uint32_t rangeLast = rangeFirst;
+        for (const uint32_t slot : buffers.pendingSlots)
+        {
+            if (slot - rangeLast > MaxDirtyRangeGap)
+            {
+                uploadRange(rangeFirst, rangeLast);
+                rangeFirst = slot;
+            }
+            rangeLast = slot;
+        }
+        uploadRange(rangeFirst, rangeLast);
+
+        buffers.pendingSlots.clear();
+    }
+
+    void InstanceBuffer::copyInstanceData(eastl::span<const uint32_t> slots, RenderEntity::InstanceData* output) const
+    {
+        lock_(m_mutex);
+        for (const uint32_t slot : slots)
+        {
+            NAU_ASSERT(slot < m_data.size());
+            *output++ = m_data[slot];
+        }
+    }
+
+    Sbuffer* InstanceBuffer::getBuffer() const
+    {
+        lock_(m_mutex);
+        return m_ring[m_ringIndex].data;
+    }
+
+    Sbuffer* InstanceBuffer::getBoundsBuffer() const
+    {
+        lock_(m_mutex);
+        return m_ring[m_ringIndex].bounds;
+    }
+
+    uint32_t InstanceBuffer::getSlotsCount() const
+    {
+        lock_(m_mutex);
+        return static_cast<uint32_t>(m_data.size());
+    }
+
+} // namespace nau
@@ -0,0 +1,100 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <EASTL/array.h>
+#include <EASTL/shared_ptr.h>
+#include <EASTL/span.h>
+#include <EASTL/vector.h>
+
+#include <mutex>
+
+#include "nau/3d/dag_drv3d.h"
+#include "nau/math/dag_bounds3.h"
+#include "render_entity.h"
+
+
+namespace nau
+{
+    /**
+     * Persistent per-scene GPU storage of the instances data.
+     * Each instance owns a stable slot: only the changed slots are uploaded (with the sub-range updates),
+     * render views reference the instances by the slot index (see RenderView::prepareInstanceData).
+     *
+     * The GPU buffers are a ring (one per frame in flight): the frame updates the buffer the GPU finished with,
+     * so the sub-range updates of the dynamic buffer (no discard) never touch the data of the frames in flight.
+     * Each buffer of the ring catches up with all the changes made since it was current.
+     */
+    class InstanceBuffer
+    {
+    public:
+        using Ptr = eastl::shared_ptr<InstanceBuffer>;
+
+        static constexpr uint32_t InvalidSlot = ~0u;
+
+        InstanceBuffer() = default;
+        InstanceBuffer(const InstanceBuffer&) = delete;
+        ~InstanceBuffer();
+
+        InstanceBuffer& operator=(const InstanceBuffer&) = delete;
+
+        uint32_t allocateSlot();
+        void freeSlot(uint32_t slot);
+
+        void setInstanceData(uint32_t slot, const RenderEntity::InstanceData& data);
+        // Also updates the bounds the GPU culling tests the instance against (see GpuInstanceCulling).
+        // The slots without the bounds are never culled on the GPU.
+        void setInstanceData(uint32_t slot, const RenderEntity::InstanceData& data, const nau::math::BSphere3& bounds);
+
+        /**
+         * Switches to the next buffer of the ring and uploads the slots changed since it was current.
+         * Must be called once per frame, before the views refer to the buffer.
+         * The buffers are recreated (with the full upload) when the slots count exceeds their capacity.
+         */
+        void flush();
+
+        /**
+         * Copies the CPU data of the slots: the per-view contiguous instances (see RenderView::InstanceLayout::Contiguous).
+         */
+        void copyInstanceData(eastl::span<const uint32_t> slots, RenderEntity::InstanceData* output) const;
+
+        Sbuffer* getBuffer() const;
+        // float4 (center, radius) per slot.
+        Sbuffer* getBoundsBuffer() const;
+        uint32_t getSlotsCount() const;
+
+    private:
+        // The adjacent dirty slots closer than this are uploaded with one update.
+        static constexpr uint32_t MaxDirtyRangeGap = 8;
+        static constexpr uint32_t MinCapacity = 1024;
+        // Not less than the frames the GPU can lag behind (the driver frame backlog).
+        static constexpr uint32_t RingSize = 4;
+
+        struct GpuBuffers
+        {
+            Sbuffer* data = nullptr;
+            Sbuffer* bounds = nullptr;
+            // The slots changed since the buffers were current.
+            eastl::vector<uint32_t> pendingSlots;
+            // Recreated: the full upload is required.
+            bool isStale = true;
+        };
+
+        void markDirty(uint32_t slot);
+        void uploadPending(GpuBuffers& buffers);
+
+        mutable std::mutex m_mutex;
+        eastl::vector<RenderEntity::InstanceData> m_data;
+        eastl::vector<nau::math::Vector4> m_bounds;
+        eastl::vector<uint32_t> m_freeSlots;
+        eastl::vector<uint32_t> m_dirtySlots;
+        eastl::vector<bool> m_isDirty;
+
+        eastl::array<GpuBuffers, RingSize> m_ring;
+        uint32_t m_ringIndex = 0;
+        uint32_t m_capacity = 0;
+    };
+
+} // namespace nau
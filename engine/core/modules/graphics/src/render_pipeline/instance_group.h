@@ -4,11 +4,19 @@
 
 #pragma once
 
+#include <EASTL/span.h>
 #include <EASTL/vector.h>
 
 #include "nau/3d/dag_drv3d.h"
+#include "nau/3d/dag_texStreamingContext.h"
 #include "nau/math/dag_bounds3.h"
+#include "nau/math/dag_frustum.h"
+#include "nau/memory/eastl_aliases.h"
+#include "nau/utils/typed_flag.h"
 #include "graphics_assets/material_asset.h"
+#include "instance_buffer.h"
+#include "lod_selection.h"
+#include "occlusion_culling.h"
 #include "render_entity.h"
 #include "render_list.h"
 
@@ -33,30 +41,110 @@ namespace nau
         nau::math::BSphere3 localSphere;
 
         eastl::map<uint64_t, MaterialOverrideInfo> overrideInfo;
-        bool toDelete = false;
 
         // RenderParameters
         RenderTags tags;
         bool isVisible = true;
         bool isCastShadow = true;
         bool isHighlighted = false;
+        bool isOccluder = false;
 
         nau::Uid uid;
     };
 
+    enum class InstanceState : uint8_t
+    {
+        Visible = NauFlag(0),
+        CastShadow = NauFlag(1),
+        Highlighted = NauFlag(2),
+        PendingDelete = NauFlag(3),
+        // Rasterized by the occlusion culling, not tested against it.
+        Occluder = NauFlag(4)
+    };
+
+    NAU_DEFINE_TYPED_FLAG(InstanceState)
+
+    // Instance fields the view filters are tested against.
+    struct InstanceFilterInfo
+    {
+        const nau::math::BSphere3& worldSphere;
+        InstanceStateFlag state;
+
+        bool isCastShadow() const
+        {
+            return state.has(InstanceState::CastShadow);
+        }
+    };
+
+    using InstanceFilter = eastl::function<bool(const InstanceFilterInfo&)>;
+
+    /**
+     * View culling of the instances: the required states and the frustum are tested in batches
+     * (see NauFrustum::testSpheres), the custom filter is an opt-in slow path called per instance after them.
+     * The occlusion test follows the frustum one, for the groups that know their instances bounding boxes.
+     * The render lists are built in parallel, so the filters can be called concurrently from several threads.
+     */
+    struct InstanceCulling
+    {
+        const nau::math::NauFrustum* frustum = nullptr;
+        InstanceStateFlag requiredState = InstanceState::Visible;
+        const InstanceFilter* customFilter = nullptr;
+        // The occluders are rasterized for the view already.
+        const OcclusionCulling* occlusion = nullptr;
+
+        bool hasRequiredState(InstanceStateFlag state) const
+        {
+            return state.has(requiredState);
+        }
+
+        // Per instance test, for the groups that do not batch the frustum test.
+        bool isPassed(const InstanceFilterInfo& info) const
+        {
+            if (!hasRequiredState(info.state))
+            {
+                return false;
+            }
+            if (frustum && frustum->testSphere(info.worldSphere) == 0)
+            {
+                return false;
+            }
+            return !customFilter || (*customFilter)(info);
+        }
+    };
+
+
+    // Culling, materials filter and lod selection of one view, for the render lists creation of several views at once.
+    struct RenderListFilter
+    {
+        InstanceCulling culling;
+        eastl::function<bool(const nau::MaterialAssetView::Ptr)>* materialFilter = nullptr;
+        LodSelection lod;
+        // The textures resolution the drawn materials request, from the lod viewer position (no requests by default).
+        TexStreamingContext texStreaming{0.f};
+
+        uint32_t getTexLevel(const nau::math::BSphere3& worldSphere) const
+        {
+            return static_cast<uint32_t>(texStreaming.getTexLevel(worldSphere.r2, lengthSqr(worldSphere.c - lod.viewerPosition)));
+        }
+    };
+
 
     class IInstanceGroup
     {
     public:
         virtual size_t getInstancesCount() const = 0;
-        virtual InstanceInfo& getInstance(InstanceID instID) = 0;
         virtual void removeInstance(InstanceID instID) = 0;
         virtual bool contains(InstanceID instID) const = 0;
         virtual RenderEntity createRenderEntity() = 0;
         virtual RenderList::Ptr createRenderList(const nau::math::Vector3& viewerPosition, 
-            eastl::function<bool(const InstanceInfo&)>& filterFunc,
+            const InstanceCulling& culling,
             eastl::function<bool(const nau::MaterialAssetView::Ptr)>& materialFilter) = 0;
 
+        // Render lists of several views with one instances traversal: outLists[i] receives the list of views[i].
+        virtual void createRenderLists(const nau::math::Vector3& viewerPosition,
+            eastl::span<const RenderListFilter> views,
+            eastl::span<RenderList::Ptr> outLists) = 0;
+
     protected:
         RenderTags tags;
     };
@@ -0,0 +1,65 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "lod_selection.h"
+
+#include <cmath>
+
+
+namespace nau
+{
+    namespace
+    {
+        // The lod 1 threshold of the meshes without the authored ones.
+        constexpr float DefaultLod1ScreenSize = 0.4f;
+
+        float getLodScreenSize(eastl::span<const float> screenSizes, uint32_t lod)
+        {
+            NAU_ASSERT(lod > 0);
+            if (lod <= screenSizes.size())
+            {
+                return screenSizes[lod - 1];
+            }
+
+            const float lastSize = screenSizes.empty() ? DefaultLod1ScreenSize * 2.f : screenSizes.back();
+            return std::ldexp(lastSize, -static_cast<int>(lod - screenSizes.size()));
+        }
+    }  // namespace
+
+    float LodSelection::getScreenSize(const nau::math::BSphere3& worldSphere) const
+    {
+        const float distance = length(worldSphere.c - viewerPosition);
+        // Inside the sphere the instance covers the screen.
+        if (distance <= worldSphere.r)
+        {
+            return FLT_MAX;
+        }
+
+        return std::exp2(-bias) * worldSphere.r * screenScale / distance;
+    }
+
+    uint32_t LodSelection::selectLod(const nau::math::BSphere3& worldSphere, eastl::span<const float> screenSizes, uint32_t lodsCount, uint32_t previousLod) const
+    {
+        lodsCount = eastl::min(lodsCount, MaxLods);
+        if (!isEnabled() || lodsCount <= 1)
+        {
+            return 0;
+        }
+
+        const float screenSize = getScreenSize(worldSphere);
+        uint32_t lod = eastl::min(previousLod, lodsCount - 1);
+
+        while (lod + 1 < lodsCount && screenSize < getLodScreenSize(screenSizes, lod + 1) * (1.f - Hysteresis))
+        {
+            ++lod;
+        }
+        while (lod > 0 && screenSize >= getLodScreenSize(screenSizes, lod) * (1.f + Hysteresis))
+        {
+            --lod;
+        }
+
+        return lod;
+    }
+
+} // namespace nau
@@ -0,0 +1,46 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <EASTL/span.h>
+
+#include "nau/math/dag_bounds3.h"
+#include "nau/math/math.h"
+
+
+namespace nau
+{
+    /**
+     * Screen size LOD selection of one view.
+     * The screen size is the bounding sphere diameter to the screen height ratio, the lod i is used below the screenSizes[i - 1] of the mesh.
+     * The previous lod of the instance is kept while the size is within the hysteresis band of the threshold, so the lods do not flicker.
+     */
+    struct LodSelection
+    {
+        static constexpr uint32_t MaxLods = 32;
+        // Relative width of the band around the lod thresholds.
+        static constexpr float Hysteresis = 0.1f;
+
+        nau::math::Vector3 viewerPosition = nau::math::Vector3::zero();
+        // proj[1][1] of the view projection: the screen height ratio of the unit size at the unit distance. Zero disables the selection.
+        float screenScale = 0.f;
+        // In the lod levels: the positive bias selects the coarser lods (the screen size is halved per unit).
+        float bias = 0.f;
+
+        bool isEnabled() const
+        {
+            return screenScale > 0.f;
+        }
+
+        float getScreenSize(const nau::math::BSphere3& worldSphere) const;
+
+        /**
+         * @param screenSizes the authored thresholds of the lods from 1, the missing ones are halved per lod from the last one.
+         * @param previousLod the lod of the instance in the previous frame.
+         */
+        uint32_t selectLod(const nau::math::BSphere3& worldSphere, eastl::span<const float> screenSizes, uint32_t lodsCount, uint32_t previousLod) const;
+    };
+
+} // namespace nau
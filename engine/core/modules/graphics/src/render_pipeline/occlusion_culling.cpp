@@ -0,0 +1,134 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "occlusion_culling.h"
+
+#include "nau/3d/dag_maskedOcclusionCulling.h"
+#include "nau/async/parallel_for.h"
+
+
+namespace nau
+{
+    namespace
+    {
+        // Clip space w of the rasterizer near plane: the boxes crossing it are not tested.
+        constexpr float NearClipW = 0.05f;
+        constexpr size_t MergeTilesGrain = 64;
+    }  // namespace
+
+    OcclusionCulling::OcclusionCulling(uint32_t width, uint32_t height) :
+        m_width(width),
+        m_height(height)
+    {
+        NAU_ASSERT(m_width % 8 == 0 && m_height % 4 == 0);
+    }
+
+    OcclusionCulling::~OcclusionCulling()
+    {
+        for (MaskedOcclusionCulling* rasterizer : m_rasterizers)
+        {
+            if (rasterizer)
+            {
+                MaskedOcclusionCulling::Destroy(rasterizer);
+            }
+        }
+    }
+
+    MaskedOcclusionCulling* OcclusionCulling::getRasterizer(size_t index)
+    {
+        MaskedOcclusionCulling*& rasterizer = m_rasterizers[index];
+        if (!rasterizer)
+        {
+            rasterizer = MaskedOcclusionCulling::Create();
+            NAU_FATAL(rasterizer);
+            rasterizer->SetResolution(m_width, m_height);
+            rasterizer->SetNearClipPlane(NearClipW);
+        }
+
+        return rasterizer;
+    }
+
+    void OcclusionCulling::rasterize(const nau::math::Matrix4& viewProj, eastl::span<const Occluder> occluders)
+    {
+        m_viewProj = viewProj;
+        m_hasOccluders = !occluders.empty();
+        if (!m_hasOccluders)
+        {
+            return;
+        }
+
+        const size_t rasterizersCount = eastl::min(MaxRasterizers, (occluders.size() + MinOccludersPerRasterizer - 1) / MinOccludersPerRasterizer);
+        for (size_t i = 0; i < rasterizersCount; ++i)
+        {
+            getRasterizer(i);
+        }
+
+        // Each rasterizer takes every rasterizersCount-th occluder, so the big and the small ones are spread evenly.
+        async::parallelFor(rasterizersCount, 1, [&](size_t rasterizerIndex)
+        {
+            MaskedOcclusionCulling& rasterizer = *m_rasterizers[rasterizerIndex];
+            rasterizer.ClearBuffer();
+
+            for (size_t i = rasterizerIndex; i < occluders.size(); i += rasterizersCount)
+            {
+                const Occluder& occluder = occluders[i];
+                const nau::math::Matrix4 modelToClip = m_viewProj * occluder.worldMatrix;
+
+                // The winding of the source meshes is not known: the back faces are rasterized too.
+                rasterizer.RenderTriangles(reinterpret_cast<const float*>(occluder.vertices.data()), occluder.indices.data(),
+                    static_cast<int>(occluder.indices.size() / 3), reinterpret_cast<const float*>(&modelToClip),
+                    MaskedOcclusionCulling::BACKFACE_NONE);
+            }
+        });
+
+        if (rasterizersCount > 1)
+        {
+            // The tiles are independent: the merge into the first buffer is split by the tile ranges.
+            MaskedOcclusionCulling* const target = m_rasterizers[0];
+            async::parallelFor(target->getTilesCount(), MergeTilesGrain, [&](size_t firstTile, size_t lastTile)
+            {
+                target->mergeOcclusions(m_rasterizers.data() + 1, static_cast<uint32_t>(rasterizersCount - 1),
+                    static_cast<uint32_t>(firstTile), static_cast<uint32_t>(lastTile));
+            });
+        }
+    }
+
+    bool OcclusionCulling::isVisible(const nau::math::BBox3& localBox, const nau::math::Matrix4& worldMatrix) const
+    {
+        if (!m_hasOccluders || localBox.isempty())
+        {
+            return true;
+        }
+
+        const nau::math::Matrix4 modelToClip = m_viewProj * worldMatrix;
+
+        // Screen rectangle of the box corners at the nearest corner depth.
+        float xMin = FLT_MAX, yMin = FLT_MAX, xMax = -FLT_MAX, yMax = -FLT_MAX, wMin = FLT_MAX;
+        for (uint32_t corner = 0; corner < 8; ++corner)
+        {
+            const nau::math::Vector4 clip = modelToClip * nau::math::Vector4{
+                localBox.lim[corner & 1].getX(),
+                localBox.lim[(corner >> 1) & 1].getY(),
+                localBox.lim[(corner >> 2) & 1].getZ(),
+                1.f};
+
+            const float w = clip.getW();
+            if (w < NearClipW)
+            {
+                return true;
+            }
+
+            const float x = clip.getX() / w;
+            const float y = clip.getY() / w;
+            xMin = eastl::min(xMin, x);
+            xMax = eastl::max(xMax, x);
+            yMin = eastl::min(yMin, y);
+            yMax = eastl::max(yMax, y);
+            wMin = eastl::min(wMin, w);
+        }
+
+        return m_rasterizers[0]->TestRect(xMin, yMin, xMax, yMax, wMin) == MaskedOcclusionCulling::VISIBLE;
+    }
+
+} // namespace nau
@@ -0,0 +1,69 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <EASTL/array.h>
+#include <EASTL/span.h>
+
+#include "nau/math/dag_bounds3.h"
+#include "nau/math/math.h"
+
+class MaskedOcclusionCulling;
+
+
+namespace nau
+{
+    /**
+     * Software occlusion culling of one view (see MaskedOcclusionCulling).
+     * The occluders are rasterized into the masked depth buffer once per frame, between the frustum culling and the render lists creation,
+     * then the frustum visible instances are tested against it by their bounding boxes.
+     * isVisible() is const and can be called concurrently, rasterize() must not overlap with the tests.
+     */
+    class OcclusionCulling
+    {
+    public:
+        struct Occluder
+        {
+            // Model space positions (w = 1) and triangles indices.
+            eastl::span<const nau::math::float4> vertices;
+            eastl::span<const uint16_t> indices;
+            nau::math::Matrix4 worldMatrix;
+        };
+
+        // Each rasterizer has its own depth buffer, they are merged into the first one.
+        static constexpr size_t MaxRasterizers = 4;
+        static constexpr size_t MinOccludersPerRasterizer = 8;
+
+        // The buffer width must be a multiple of 8, the height a multiple of 4.
+        OcclusionCulling(uint32_t width = 512, uint32_t height = 256);
+        OcclusionCulling(const OcclusionCulling&) = delete;
+        ~OcclusionCulling();
+
+        OcclusionCulling& operator=(const OcclusionCulling&) = delete;
+
+        /**
+         * Clears the depth buffer and rasterizes the occluders on the worker threads.
+         * Without the occluders the tests are skipped: all the instances are visible.
+         */
+        void rasterize(const nau::math::Matrix4& viewProj, eastl::span<const Occluder> occluders);
+
+        bool isVisible(const nau::math::BBox3& localBox, const nau::math::Matrix4& worldMatrix) const;
+
+        bool hasOccluders() const
+        {
+            return m_hasOccluders;
+        }
+
+    private:
+        MaskedOcclusionCulling* getRasterizer(size_t index);
+
+        eastl::array<MaskedOcclusionCulling*, MaxRasterizers> m_rasterizers = {};
+        nau::math::Matrix4 m_viewProj = nau::math::Matrix4::identity();
+        uint32_t m_width;
+        uint32_t m_height;
+        bool m_hasOccluders = false;
+    };
+
+} // namespace nau
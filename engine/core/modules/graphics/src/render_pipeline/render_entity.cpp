@@ -6,115 +6,176 @@
 
 #include "nau/shaders/shader_globals.h"
 
-void nau::RenderEntity::render(nau::math::Matrix4 viewProj) const
+namespace
+{
+    using namespace nau::string_literals;
+
+    constexpr nau::NameId DefaultPipeline = "default"_nid;
+    constexpr nau::NameId InstancedPipeline = "instanced"_nid;
+    constexpr nau::NameId SkinnedPipeline = "skinned"_nid;
+
+    const nau::shader_globals::GlobalVar g_vp{"vp"};
+    const nau::shader_globals::GlobalVar g_mvp{"mvp"};
+    const nau::shader_globals::GlobalVar g_worldMatrix{"worldMatrix"};
+    const nau::shader_globals::GlobalVar g_normalMatrix{"normalMatrix"};
+    const nau::shader_globals::GlobalVar g_instanceBaseID{"instanceBaseID"};
+
+    constexpr nau::MaterialAssetView::PropertyId g_instanceBaseIDProperty = nau::MaterialAssetView::makePropertyId(InstancedPipeline, "instanceBaseID"_nid);
+} // namespace
+
+void nau::RenderEntity::render(nau::math::Matrix4 viewProj, DrawStateCache& state) const
 {
     const nau::math::Matrix4 mvpMatrix = viewProj * worldTransform;
-    const nau::math::Matrix4 normalMatrix = math::transpose(math::inverse(worldTransform));
 
-    nau::shader_globals::setVariable("vp", &viewProj);
-    nau::shader_globals::setVariable("mvp", &mvpMatrix);
-    nau::shader_globals::setVariable("worldMatrix", &worldTransform);
-    nau::shader_globals::setVariable("normalMatrix", &normalMatrix);
+    g_vp.set(&viewProj);
+    g_mvp.set(&mvpMatrix);
+    g_worldMatrix.set(&worldTransform);
+    g_normalMatrix.set(&normalTransform);
 
-    for (const auto& cbStruct : cbStructsData)
+    for (const auto& [name, cbStruct] : cbStructsData)
     {
-        nau::shader_globals::setVariable(cbStruct.first, cbStruct.second.dataPtr);
+        if (cbStruct.varId != nau::shader_globals::InvalidGlobalVarId)
+        {
+            nau::shader_globals::setVariable(cbStruct.varId, cbStruct.dataPtr);
+        }
+        else
+        {
+            nau::shader_globals::setVariable(name, cbStruct.dataPtr);
+        }
     }
 
     NAU_ASSERT(material);
-    material->bindPipeline("default");
+    state.bindPipeline(material.get(), DefaultPipeline);
 
-    d3d::set_buffer(STAGE_VS, 0, nullptr);
+    state.setVsBuffer(0, nullptr);
 
-    d3d::setvsrc(0, positionBuffer, sizeof(nau::math::float3));
-    d3d::setvsrc(1, normalsBuffer, sizeof(nau::math::float3));
-    d3d::setvsrc(2, texcoordsBuffer, sizeof(nau::math::float2));
-    if (tangentsBuffer != nullptr)
+    const uint32_t bonesStream = bindVertexAttributes(state);
+    if (isSkinned())
     {
-        d3d::setvsrc(3, tangentsBuffer, sizeof(nau::math::float4));
+        state.setVertexSource(bonesStream, boneWeightsBuffer, sizeof(nau::math::float4));
+        state.setVertexSource(bonesStream + 1, boneIndicesBuffer, sizeof(nau::math::float4));
     }
 
-    if (boneWeightsBuffer != nullptr && boneIndicesBuffer != nullptr)
-    {
-        d3d::setvsrc(4, boneWeightsBuffer, sizeof(nau::math::float4));
-        d3d::setvsrc(5, boneIndicesBuffer, sizeof(nau::math::float4));
-    }
+    state.setIndices(indexBuffer);
 
-    d3d::setind(indexBuffer);
+    d3d::drawind(PRIM_TRILIST, startIndex, (endIndex - startIndex) / 3, baseVertex);
+}
 
-    d3d::drawind(PRIM_TRILIST, startIndex, (endIndex - startIndex) / 3, 0);
+void nau::RenderEntity::renderInstanced(nau::math::Matrix4 viewProj, Sbuffer* instanceData, Sbuffer* instanceIndices, DrawStateCache& state) const
+{
+    bindInstanced(instanceData, instanceIndices, state);
+    d3d::drawind_instanced(PRIM_TRILIST, startIndex, (endIndex - startIndex) / 3, baseVertex, instancesCount, 0);
 }
 
-void nau::RenderEntity::renderInstanced(nau::math::Matrix4 viewProj, Sbuffer* instanceData) const
+void nau::RenderEntity::renderInstancedIndirect(nau::math::Matrix4 viewProj, Sbuffer* instanceData, Sbuffer* instanceIndices, Sbuffer* drawArgs, uint32_t drawArgsOffset, DrawStateCache& state) const
 {
-    NAU_ASSERT(material);
-    d3d::set_buffer(STAGE_VS, 0, instanceData);
+    bindInstanced(instanceData, instanceIndices, state);
+    d3d::draw_indexed_indirect(PRIM_TRILIST, drawArgs, drawArgsOffset);
+}
 
-    material->setProperty("instanced", "instanceBaseID", nau::math::Vector4(startInstance));
-    material->bindPipeline("instanced");
+void nau::RenderEntity::bindInstanced(Sbuffer* instanceData, Sbuffer* instanceIndices, DrawStateCache& state) const
+{
+    NAU_ASSERT(material);
+    state.setVsBuffer(0, instanceData);
+    state.setVsBuffer(1, instanceIndices);
 
-    d3d::setvsrc(0, positionBuffer, sizeof(nau::math::float3));
-    d3d::setvsrc(1, normalsBuffer, sizeof(nau::math::float3));
-    d3d::setvsrc(2, texcoordsBuffer, sizeof(nau::math::float2));
-    d3d::setvsrc(3, tangentsBuffer, sizeof(nau::math::float4));
+    material->setProperty(g_instanceBaseIDProperty, nau::math::Vector4(startInstance));
+    state.bindPipeline(material.get(), InstancedPipeline);
 
-    d3d::setind(indexBuffer);
+    const uint32_t bonesStream = bindVertexAttributes(state);
+    if (isSkinned())
+    {
+        bindBones(bonesStream, state);
+    }
 
-    d3d::drawind_instanced(PRIM_TRILIST, startIndex, (endIndex - startIndex) / 3, 0, instancesCount, 0);
+    state.setIndices(indexBuffer);
 }
 
-void nau::RenderEntity::renderZPrepass(const math::Matrix4& viewProj, MaterialAssetView* zPrepassMat) const
+void nau::RenderEntity::bindBones(uint32_t bonesStream, DrawStateCache& state) const
 {
-    const bool skinned = boneWeightsBuffer != nullptr && boneIndicesBuffer != nullptr;
+    state.setVertexSource(bonesStream, boneWeightsBuffer, sizeof(nau::math::float4));
+    state.setVertexSource(bonesStream + 1, boneIndicesBuffer, sizeof(nau::math::float4));
+    // After the instances buffers: the skinned instances take their bones by InstanceData::bonesOffset.
+    state.setVsBuffer(2, bonePalette);
+}
 
-    if (skinned)
+uint32_t nau::RenderEntity::bindVertexAttributes(DrawStateCache& state) const
+{
+    state.setVertexSource(0, positionBuffer, sizeof(nau::math::float3));
+    if (packedAttributesBuffer != nullptr)
     {
-        static constexpr auto bonesTransforms = "BonesTransforms";
+        state.setVertexSource(1, packedAttributesBuffer, sizeof(PackedVertexAttributes));
+        return 2;
+    }
 
-        auto& [size, ptr] = cbStructsData.at(bonesTransforms);
+    state.setVertexSource(1, normalsBuffer, sizeof(nau::math::float3));
+    state.setVertexSource(2, texcoordsBuffer, sizeof(nau::math::float2));
+    if (tangentsBuffer != nullptr)
+    {
+        state.setVertexSource(3, tangentsBuffer, sizeof(nau::math::float4));
+    }
 
-        nau::shader_globals::setVariable(bonesTransforms, ptr);
+    return 4;
+}
 
-        prepareZPrepass("skinned", viewProj, zPrepassMat);
-        d3d::setvsrc(0, positionBuffer, sizeof(math::float3));
-        d3d::setvsrc(1, boneWeightsBuffer, sizeof(nau::math::float4));
-        d3d::setvsrc(2, boneIndicesBuffer, sizeof(nau::math::float4));
+void nau::RenderEntity::renderZPrepass(const math::Matrix4& viewProj, MaterialAssetView* zPrepassMat, DrawStateCache& state) const
+{
+    if (isSkinned())
+    {
+        // The skinned depth pipeline takes the bones from the palette also for the single instance.
+        prepareZPrepass(SkinnedPipeline, viewProj, zPrepassMat, state);
+        state.setVertexSource(0, positionBuffer, sizeof(math::float3));
+        bindBones(1, state);
     }
     else
     {
         auto mvp = viewProj * worldTransform;
-        shader_globals::setVariable("vp", &mvp);
-        prepareZPrepass("default", viewProj, zPrepassMat);
-        d3d::setvsrc(0, positionBuffer, sizeof(math::float3));
+        g_vp.set(&mvp);
+        prepareZPrepass(DefaultPipeline, viewProj, zPrepassMat, state);
+        state.setVertexSource(0, positionBuffer, sizeof(math::float3));
     }
 
-    d3d::setind(indexBuffer);
-    d3d::drawind(PRIM_TRILIST, startIndex, (endIndex - startIndex) / 3, 0);
+    state.setIndices(indexBuffer);
+    d3d::drawind(PRIM_TRILIST, startIndex, (endIndex - startIndex) / 3, baseVertex);
 }
 
-void nau::RenderEntity::renderZPrepassInstanced(const math::Matrix4& viewProj, MaterialAssetView* zPrepassMat) const
+void nau::RenderEntity::renderZPrepassInstanced(const math::Matrix4& viewProj, MaterialAssetView* zPrepassMat, DrawStateCache& state) const
 {
-    shader_globals::setVariable("vp", &viewProj);
-    prepareZPrepass("default", viewProj, zPrepassMat);
+    bindZPrepassInstanced(viewProj, zPrepassMat, state);
+    d3d::drawind_instanced(PRIM_TRILIST, startIndex, (endIndex - startIndex) / 3, baseVertex, instancesCount, 0);
+}
+
+void nau::RenderEntity::renderZPrepassIndirect(const math::Matrix4& viewProj, MaterialAssetView* zPrepassMat, Sbuffer* drawArgs, uint32_t drawArgsOffset, DrawStateCache& state) const
+{
+    bindZPrepassInstanced(viewProj, zPrepassMat, state);
+    d3d::draw_indexed_indirect(PRIM_TRILIST, drawArgs, drawArgsOffset);
+}
 
-    d3d::setvsrc(0, positionBuffer, sizeof(math::float3));
-    d3d::setind(indexBuffer);
-    d3d::drawind_instanced(PRIM_TRILIST, startIndex, (endIndex - startIndex) / 3, 0, instancesCount, 0);
+void nau::RenderEntity::bindZPrepassInstanced(const math::Matrix4& viewProj, MaterialAssetView* zPrepassMat, DrawStateCache& state) const
+{
+    g_vp.set(&viewProj);
+    prepareZPrepass(isSkinned() ? SkinnedPipeline : DefaultPipeline, viewProj, zPrepassMat, state);
+
+    state.setVertexSource(0, positionBuffer, sizeof(math::float3));
+    if (isSkinned())
+    {
+        bindBones(1, state);
+    }
+    state.setIndices(indexBuffer);
 }
 
-void nau::RenderEntity::prepareZPrepass(eastl::string_view pipeline, const math::Matrix4& viewProj, MaterialAssetView* zPrepassMat) const
+void nau::RenderEntity::prepareZPrepass(NameId pipeline, const math::Matrix4& viewProj, MaterialAssetView* zPrepassMat, DrawStateCache& state) const
 {
     NAU_ASSERT(zPrepassMat);
 
     const nau::math::Matrix4 mvpMatrix = viewProj * worldTransform;
-    const nau::math::Matrix4 normalMatrix = math::transpose(math::inverse(worldTransform));
 
-    nau::shader_globals::setVariable("vp", &viewProj);
-    nau::shader_globals::setVariable("mvp", &mvpMatrix);
-    nau::shader_globals::setVariable("worldMatrix", &worldTransform);
-    nau::shader_globals::setVariable("normalMatrix", &normalMatrix);
+    g_vp.set(&viewProj);
+    g_mvp.set(&mvpMatrix);
+    g_worldMatrix.set(&worldTransform);
+    g_normalMatrix.set(&normalTransform);
     auto instanceId = math::Vector4(startInstance);
-    nau::shader_globals::setVariable("instanceBaseID", &instanceId);
+    g_instanceBaseID.set(&instanceId);
 
-    zPrepassMat->bindPipeline(pipeline);
+    state.bindPipeline(zPrepassMat, pipeline);
 }
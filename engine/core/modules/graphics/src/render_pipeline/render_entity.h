@@ -8,7 +8,11 @@
 
 #include "graphics_assets/material_asset.h"
 #include "nau/3d/dag_drv3d.h"
+#include "nau/memory/eastl_aliases.h"
 #include "nau/platform/windows/utils/uid.h"
+#include "graphics_assets/packed_vertex_layout.h"
+#include "nau/shaders/shader_globals.h"
+#include "draw_packets.h"
 
 
 namespace nau
@@ -24,21 +28,31 @@ namespace nau
             nau::math::Matrix4 normalMatrix;
             nau::Uid uid;
             uint32_t isHighlighted;
+            // The skinned instance bones in the scene BonePalette, fits the struct padding.
+            uint32_t bonesOffset = 0;
+            // The per-instance material properties (see MaterialAssetView::getBatchHash), the shaders read them instead of the constants.
+            MaterialAssetView::InstanceParams instanceParams = {nau::math::Vector4::zero(), nau::math::Vector4::zero()};
         };
 
         struct ConstBufferStructData
         {
             uint32_t size;
             void* dataPtr;
+            // Resolved by the producer to skip the name lookup per draw.
+            shader_globals::GlobalVarId varId = shader_globals::InvalidGlobalVarId;
         };
 
         Sbuffer* positionBuffer = nullptr;
         Sbuffer* normalsBuffer = nullptr;
         Sbuffer* texcoordsBuffer = nullptr;
         Sbuffer* tangentsBuffer = nullptr;
+        // The packed layout streams are the positions (0) and the packed attributes (1), see PackedVertexAttributes.
+        Sbuffer* packedAttributesBuffer = nullptr;
 
         Sbuffer* boneWeightsBuffer = nullptr;
         Sbuffer* boneIndicesBuffer = nullptr;
+        // The instanced skinned draws take the bones of each instance from the palette (see BonePalette).
+        Sbuffer* bonePalette = nullptr;
 
         Sbuffer* indexBuffer = nullptr;
 
@@ -46,25 +60,52 @@ namespace nau
 
         uint32_t startInstance;
         uint32_t instancesCount;
-        eastl::vector<InstanceData> instanceData;
+        // Slots of the instances in the scene InstanceBuffer.
+        // Render entities are rebuilt every frame: the slots list goes to the frame memory.
+        nau::FrameVector<uint32_t> instanceSlots;
+        bool hasHighlightedInstances = false;
 
         nau::Ptr<nau::MaterialAssetView> material;
 
+        // The index range and the base vertex in the entity buffers, the pooled meshes share them (see GeometryPool).
         uint32_t startIndex;
         uint32_t endIndex;
+        int32_t baseVertex = 0;
 
         RenderTags tags;
 
         nau::math::Matrix4 worldTransform;
+        // transpose(inverse(worldTransform)), cached by the instance owner.
+        nau::math::Matrix4 normalTransform;
         eastl::map<eastl::string_view, ConstBufferStructData> cbStructsData;
 
-        void render(nau::math::Matrix4 viewProj) const;
-        void renderInstanced(nau::math::Matrix4 viewProj, Sbuffer* instanceData) const;
+        // The binds go through the state of the pass, see DrawStateCache.
+        void render(nau::math::Matrix4 viewProj, DrawStateCache& state) const;
+        void renderInstanced(nau::math::Matrix4 viewProj, Sbuffer* instanceData, Sbuffer* instanceIndices, DrawStateCache& state) const;
+        // The instances count is taken from the indirect arguments written by the GPU culling (see GpuInstanceCulling).
+        void renderInstancedIndirect(nau::math::Matrix4 viewProj, Sbuffer* instanceData, Sbuffer* instanceIndices, Sbuffer* drawArgs, uint32_t drawArgsOffset, DrawStateCache& state) const;
+
+        void renderZPrepass(const math::Matrix4& viewProj, MaterialAssetView* zPrepassMat, DrawStateCache& state) const;
+        void renderZPrepassInstanced(const math::Matrix4& viewProj, MaterialAssetView* zPrepassMat, DrawStateCache& state) const;
+        void renderZPrepassIndirect(const math::Matrix4& viewProj, MaterialAssetView* zPrepassMat, Sbuffer* drawArgs, uint32_t drawArgsOffset, DrawStateCache& state) const;
+
+        uint32_t getIndexCount() const
+        {
+            return (endIndex - startIndex) / 3 * 3;
+        }
+
+        bool isSkinned() const
+        {
+            return boneWeightsBuffer != nullptr && boneIndicesBuffer != nullptr;
+        }
 
-        void renderZPrepass(const math::Matrix4& viewProj, MaterialAssetView* zPrepassMat) const;
-        void renderZPrepassInstanced(const math::Matrix4& viewProj, MaterialAssetView* zPrepassMat) const;
     private:
-        void prepareZPrepass(eastl::string_view pipeline, const math::Matrix4& viewProj, MaterialAssetView* zPrepassMat) const;
+        void prepareZPrepass(NameId pipeline, const math::Matrix4& viewProj, MaterialAssetView* zPrepassMat, DrawStateCache& state) const;
+        void bindInstanced(Sbuffer* instanceData, Sbuffer* instanceIndices, DrawStateCache& state) const;
+        void bindBones(uint32_t bonesStream, DrawStateCache& state) const;
+        // Returns the index of the first free stream.
+        uint32_t bindVertexAttributes(DrawStateCache& state) const;
+        void bindZPrepassInstanced(const math::Matrix4& viewProj, MaterialAssetView* zPrepassMat, DrawStateCache& state) const;
     };
 
 } // namespace nau
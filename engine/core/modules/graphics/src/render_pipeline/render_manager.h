@@ -4,6 +4,7 @@
 
 #pragma once
 #include "render_list.h"
+#include "instance_buffer.h"
 #include "instance_group.h"
 
 namespace nau
@@ -16,8 +17,55 @@ namespace nau
     public:
         virtual void update() = 0;
         virtual RenderList::Ptr getRenderList(const nau::math::Vector3& viewerPosition,
-            eastl::function<bool(const InstanceInfo&)>& filterFunc,
+            const InstanceCulling& culling,
             eastl::function<bool(const nau::MaterialAssetView::Ptr)>& materialFilter) = 0;
+
+        /**
+         * Render lists of several views: outLists[i] receives the list of views[i].
+         * The managers with many instances override it to traverse the instances once for all the views.
+         */
+        virtual void getRenderLists(const nau::math::Vector3& viewerPosition,
+            eastl::span<const RenderListFilter> views,
+            eastl::span<RenderList::Ptr> outLists)
+        {
+            NAU_ASSERT(outLists.size() >= views.size());
+            for (size_t view = 0; view < views.size(); ++view)
+            {
+                outLists[view] = getRenderList(viewerPosition, views[view].culling, *views[view].materialFilter);
+            }
+        }
+
+        /**
+         * The draws of the highlighted instances only, for the outline mask (null when nothing is highlighted).
+         * The managers keep their highlighted instances apart: the list cost does not depend on the scene size.
+         */
+        virtual RenderList::Ptr getHighlightedRenderList()
+        {
+            return nullptr;
+        }
+
+        // The occluders for the occlusion culling, gathered before the render lists creation.
+        virtual void getOccluders(nau::FrameVector<OcclusionCulling::Occluder>& outOccluders)
+        {
+        }
+
+        /**
+         * The bounds of the shadow casters changed since the previous call (moved, shown, hidden, added or removed),
+         * before and after the change. The cached shadow cascades they touch are redrawn.
+         * The animated instances are dynamic: they are reported every frame.
+         */
+        virtual void getShadowCasterChanges(eastl::vector<nau::math::BSphere3>& outChanges)
+        {
+        }
+
+        // Scene instance buffer, where the manager allocates the slots for its instances.
+        void setInstanceBuffer(InstanceBuffer::Ptr instanceBuffer)
+        {
+            m_instanceBuffer = std::move(instanceBuffer);
+        }
+
+    protected:
+        InstanceBuffer::Ptr m_instanceBuffer;
     };
 
 } // namespace nau
@@ -4,6 +4,11 @@
 
 #include "render_scene.h"
 
+#include <EASTL/algorithm.h>
+
+#include "nau/app/global_properties.h"
+#include "nau/memory/memory_stats.h"
+#include "nau/service/service_provider.h"
 #include "nau/utils/performance_profiling.h"
 
 #include "nau/render/cascadeShadows.h"
@@ -12,6 +17,16 @@ namespace nau
 {
     async::Task<> RenderScene::initialize()
     {
+        // The shipped instanced shaders read the contiguous per view instances, the slot indexed layout is opt-in.
+        const bool isSlotIndexed = getServiceProvider().has<GlobalProperties>() &&
+                                   getServiceProvider().get<GlobalProperties>().getValue<bool>("/graphics/slotIndexedInstances").value_or(false);
+        m_instanceLayout = isSlotIndexed ? RenderView::InstanceLayout::SlotIndexed : RenderView::InstanceLayout::Contiguous;
+        m_outlineView->setInstanceLayout(m_instanceLayout);
+        for (auto& view : m_views)
+        {
+            view->setInstanceLayout(m_instanceLayout);
+        }
+
         MaterialAssetRef outlineMaterialAssetRef = AssetPath{"file:/res/materials/outline_calculation.nmat_json"};
         auto outlineMaterialTask = outlineMaterialAssetRef.getAssetViewTyped<MaterialAssetView>();
 
@@ -29,6 +44,23 @@ namespace nau
         NAU_ASSERT(*billboardsMaterialTask);
         m_billboardsManager = rtti::createInstance<BillboardsManager>(*billboardsMaterialTask);
 
+        // Optional, only the GPU culling mode needs it.
+        MaterialAssetRef gpuCullingMaterialRef = AssetPath{"file:/res/materials/gpu_instance_culling.nmat_json"};
+        Result<MaterialAssetView::Ptr> gpuCullingMaterial = co_await gpuCullingMaterialRef.getAssetViewTyped<MaterialAssetView>().doTry();
+        if (gpuCullingMaterial)
+        {
+            m_gpuCullingMaterial = *gpuCullingMaterial;
+        }
+
+        // Optional too: without it the GPU culling is the frustum one.
+        MaterialAssetRef hiZMaterialRef = AssetPath{"file:/res/materials/hi_z_build.nmat_json"};
+        Result<MaterialAssetView::Ptr> hiZMaterial = co_await hiZMaterialRef.getAssetViewTyped<MaterialAssetView>().doTry();
+        if (hiZMaterial)
+        {
+            m_hiZBuffer = eastl::make_unique<HiZBuffer>(*hiZMaterial);
+        }
+        setCullingMode(m_cullingMode);
+
         co_return;
     }
 
@@ -45,12 +77,19 @@ namespace nau
     void RenderScene::addView(eastl::shared_ptr<RenderView> view)
     {
         NAU_ASSERT(view);
+        view->setInstanceLayout(m_instanceLayout);
+        if (m_cullingMode == CullingMode::Gpu)
+        {
+            view->setGpuCulling(m_gpuCullingMaterial);
+        }
+        view->setGpuOcclusionCulling(m_hiZBuffer && view->isOcclusionCulling());
         m_views.push_back(view);
     }
 
     void RenderScene::addManager(nau::Ptr<IRenderManager> manager)
     {
         NAU_ASSERT(manager);
+        manager->setInstanceBuffer(m_instanceBuffer);
         m_managers.push_back(manager);
     }
 
@@ -59,24 +98,129 @@ namespace nau
         return m_billboardsManager;
     }
 
+    const InstanceBuffer::Ptr& RenderScene::getInstanceBuffer() const
+    {
+        return m_instanceBuffer;
+    }
+
+    void RenderScene::setCullingMode(CullingMode mode)
+    {
+        if (mode == CullingMode::Gpu && !m_gpuCullingMaterial)
+        {
+            NAU_LOG_WARNING("GPU culling material is not loaded (yet), culling on the CPU");
+        }
+        if (mode == CullingMode::Gpu && m_instanceLayout == RenderView::InstanceLayout::Contiguous)
+        {
+            NAU_LOG_WARNING("GPU culling requires /graphics/slotIndexedInstances, culling on the CPU");
+            mode = CullingMode::Cpu;
+        }
+
+        m_cullingMode = mode;
+        for (auto& view : m_views)
+        {
+            view->setGpuCulling(mode == CullingMode::Gpu ? m_gpuCullingMaterial : nullptr);
+            view->setGpuOcclusionCulling(m_hiZBuffer && view->isOcclusionCulling());
+        }
+    }
+
+    RenderScene::CullingMode RenderScene::getCullingMode() const
+    {
+        return m_cullingMode;
+    }
+
+    void RenderScene::setLodBias(float bias)
+    {
+        m_lodBias = bias;
+    }
+
+    float RenderScene::getLodBias() const
+    {
+        return m_lodBias;
+    }
+
     void RenderScene::updateViews(const nau::math::Matrix4& vp)
     {
+        NAU_MEMORY_SCOPE(Render);
+
+        // Only the instances changed since the previous frame are uploaded, all views share the buffer.
+        m_instanceBuffer->flush();
+
+        // The occluders are rasterized from the camera before the render lists creation, all the occlusion culled views share them.
+        const bool hasOcclusionViews = eastl::any_of(m_views.begin(), m_views.end(), [](const auto& view)
+        {
+            return view->isOcclusionCulling();
+        });
+        if (hasOcclusionViews)
+        {
+            nau::FrameVector<OcclusionCulling::Occluder> occluders;
+            for (auto& manager : m_managers)
+            {
+                manager->getOccluders(occluders);
+            }
+            m_occlusionCulling.rasterize(vp, occluders);
+        }
+
+        // All the views are culled together: each manager traverses its instances once, not once per view.
+        nau::FrameVector<RenderView*> activeViews;
+        nau::FrameVector<RenderListFilter> viewFilters;
+        activeViews.reserve(m_views.size());
+        viewFilters.reserve(m_views.size());
         for (auto& view : m_views)
         {
             view->clearLists();
-            for (auto& manager : m_managers)
+            if (!view->isActive())
             {
-                view->addRenderList(manager->getRenderList({}, view->getInstanceFilter(), view->getMaterialFilter()));
+                continue;
+            }
+
+            activeViews.push_back(view.get());
+            viewFilters.push_back({view->getInstanceCulling(), &view->getMaterialFilter(), view->getLodSelection(), view->getTexStreaming()});
+
+            RenderListFilter& filter = viewFilters.back();
+            filter.lod.bias = m_lodBias;
+            if (view->isOcclusionCulling())
+            {
+                filter.culling.occlusion = &m_occlusionCulling;
             }
-            view->prepareInstanceData();
         }
+
+        nau::FrameVector<RenderList::Ptr> viewLists(activeViews.size());
+        for (auto& manager : m_managers)
+        {
+            manager->getRenderLists({}, viewFilters, viewLists);
+            for (size_t i = 0; i < activeViews.size(); ++i)
+            {
+                activeViews[i]->addRenderList(std::move(viewLists[i]));
+            }
+        }
+
+        for (RenderView* view : activeViews)
+        {
+            view->prepareInstanceData(*m_instanceBuffer);
+        }
+
+        // Few instances are highlighted: the outline list is not culled.
+        m_outlineView->clearLists();
+        for (auto& manager : m_managers)
+        {
+            m_outlineView->addRenderList(manager->getHighlightedRenderList());
+        }
+        m_outlineView->prepareInstanceData(*m_instanceBuffer);
+    }
+
+    eastl::span<const nau::math::BSphere3> RenderScene::getShadowCasterChanges() const
+    {
+        return m_shadowCasterChanges;
     }
 
     void RenderScene::updateManagers()
     {
+        // The changes are kept for the frame: all the render windows of the scene test their cached shadows against them.
+        m_shadowCasterChanges.clear();
         for (auto& manager : m_managers)
         {
             manager->update();
+            manager->getShadowCasterChanges(m_shadowCasterChanges);
         }
 
         m_billboardsManager->update();
@@ -117,9 +261,40 @@ namespace nau
 
     void RenderScene::renderOutlineMask(const nau::math::Matrix4& vp)
     {
+        m_outlineView->renderOutlineMask(vp, m_outlineMaterial.get());
+    }
+
+    bool RenderScene::cullOccluded(BaseTexture* depth, const nau::math::Matrix4& vp)
+    {
+        const bool hasGpuOcclusionViews = eastl::any_of(m_views.begin(), m_views.end(), [](const auto& view)
+        {
+            return view->isActive() && view->isGpuOcclusionCulling();
+        });
+        if (!hasGpuOcclusionViews || !depth)
+        {
+            return false;
+        }
+
+        m_hiZBuffer->build(depth, vp);
         for (auto& view : m_views)
         {
-            view->renderZPrepass(vp, m_outlineMaterial.get());
+            if (view->isActive() && view->isGpuOcclusionCulling())
+            {
+                view->cullLate(*m_hiZBuffer);
+            }
+        }
+
+        return true;
+    }
+
+    void RenderScene::renderLateDepth(const nau::math::Matrix4& vp)
+    {
+        for (auto& view : m_views)
+        {
+            if (view->containsTag(Tags::opaqueTag))
+            {
+                view->renderLateZPrepass(vp, m_zPrepassMaterial.get());
+            }
         }
     }
 
@@ -25,6 +25,15 @@ namespace nau
     public:
         using Ptr = nau::Ptr<RenderScene>;
 
+        enum class CullingMode
+        {
+            // The render lists are frustum culled on the CPU (see NauFrustum::testSpheres).
+            Cpu,
+            // The instanced draws are culled by the compute shader and drawn indirectly (see GpuInstanceCulling).
+            // The occlusion culled views are also tested against the Hi-Z of the camera depth (see cullOccluded()).
+            Gpu
+        };
+
         async::Task<> initialize();
 
         eastl::shared_ptr<RenderList> collectRenderLists();
@@ -47,14 +56,37 @@ namespace nau
         }
 
         nau::Ptr<BillboardsManager> getBillboardsManager();
+        const InstanceBuffer::Ptr& getInstanceBuffer() const;
+
+        // Applies to the current and the later added views.
+        // The Gpu mode falls back to the Cpu one when the culling material is not available
+        // or the instances are not slot indexed (see RenderView::InstanceLayout).
+        void setCullingMode(CullingMode mode);
+        CullingMode getCullingMode() const;
+
+        // In the lod levels, applied to all the views (see LodSelection::bias).
+        void setLodBias(float bias);
+        float getLodBias() const;
 
         void updateViews(const nau::math::Matrix4& vp);
+        // The shadow casters changes gathered by the last updateManagers() call, see IRenderManager::getShadowCasterChanges.
+        eastl::span<const nau::math::BSphere3> getShadowCasterChanges() const;
         void updateManagers();
         void renderScene(const nau::math::Matrix4& vp);
         void renderDepth(const nau::math::Matrix4& vp);
         void renderTranslucency(const nau::math::Matrix4& vp);
         void renderOutlineMask(const nau::math::Matrix4& vp);
 
+        /**
+         * The late phase of the GPU occlusion culling, between the depth prepass (which draws the instances visible in the previous frame)
+         * and the rest of the passes: builds the Hi-Z of the depth and culls the remaining instances of the occlusion culled views against it.
+         * Returns false if no view is culled so (the Cpu mode or no Hi-Z material): there is nothing to draw with renderLateDepth() then.
+         * The depth must not be bound as the render target.
+         */
+        bool cullOccluded(BaseTexture* depth, const nau::math::Matrix4& vp);
+        // The depth prepass of the instances passed the late phase.
+        void renderLateDepth(const nau::math::Matrix4& vp);
+
         void renderBillboards(const nau::math::Matrix4& vp);
 
         MaterialAssetView::Ptr getZPrepassMaterial();
@@ -69,11 +101,21 @@ namespace nau
     private:
         eastl::vector<nau::Ptr<IRenderManager>> m_managers;
         eastl::vector<eastl::shared_ptr<RenderView>> m_views;
+        // The highlighted instances only, not one of m_views: the outline mask does not depend on the scene size.
+        eastl::shared_ptr<RenderView> m_outlineView = eastl::make_shared<RenderView>("outline");
+        InstanceBuffer::Ptr m_instanceBuffer = eastl::make_shared<InstanceBuffer>();
 
         nau::Ptr<BillboardsManager> m_billboardsManager;
 
         MaterialAssetView::Ptr m_zPrepassMaterial;
         MaterialAssetView::Ptr m_outlineMaterial;
+        MaterialAssetView::Ptr m_gpuCullingMaterial;
+        eastl::unique_ptr<HiZBuffer> m_hiZBuffer;
+        CullingMode m_cullingMode = CullingMode::Cpu;
+        RenderView::InstanceLayout m_instanceLayout = RenderView::InstanceLayout::Contiguous;
+        OcclusionCulling m_occlusionCulling;
+        float m_lodBias = 0.f;
+        eastl::vector<nau::math::BSphere3> m_shadowCasterChanges;
 
         friend class RendferWindowImpl;
     };
@@ -192,7 +192,9 @@ namespace nau
         NAU_ASSERT(frameAllocator, "Frame allocator is not initialized");
         bool hasPrepared = frameAllocator->prepareFrame();
         NAU_ASSERT(hasPrepared);
-        
+
+        imgui_latch_render_data();
+
         co_await executeRenderJobs();
 
         renderMainScene();
@@ -200,7 +202,7 @@ namespace nau
         co_return true;
     }
 
-    async::Task<bool> RenderSystem::update([[maybe_unused]] std::chrono::milliseconds dt)
+    async::Task<bool> RenderSystem::update([[maybe_unused]] std::chrono::microseconds dt)
     {
         co_return renderFrame();
     }
@@ -208,7 +210,7 @@ namespace nau
 
     void RenderSystem::renderMainScene()
     {
-// TODO Tracy        NAU_CPU_SCOPED_TAG(nau::PerfTag::Render);
+        NAU_CPU_SCOPED_TAG(nau::PerfTag::Render);
 
     }
 
@@ -49,9 +49,9 @@ namespace nau
 
         async::Task<> activateComponentsAsync(Uid worldUid, eastl::span<const scene::Component*> components, async::Task<> barrier) override;
 
-        async::Task<bool> update(std::chrono::milliseconds dt) override;
+        async::Task<bool> update(std::chrono::microseconds dt) override;
 
-        eastl::optional<std::chrono::milliseconds> getFixedUpdateTimeStep() override
+        eastl::optional<std::chrono::microseconds> getFixedUpdateTimeStep() override
         {
             return eastl::nullopt;
         }
@@ -81,9 +81,9 @@ namespace nau
         eastl::map<eastl::string, RenderScene::Ptr> m_scenes;
 
 #pragma region ServicePart
-        nau::FrameAllocator m_frameAllocator;
+        nau::BufferedFrameAllocator m_frameAllocator;
 
-        WorkQueue::Ptr m_preRenderWorkQueue = WorkQueue::create();
+        WorkQueue::Ptr m_preRenderWorkQueue = WorkQueue::create(WorkQueueMode::Mpsc);
         std::mutex m_preRenderJobsMutex;
         eastl::vector<AsyncAction> m_preRenderJobs;
 
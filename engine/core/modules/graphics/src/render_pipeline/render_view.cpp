@@ -8,6 +8,10 @@
 
 #include <EASTL/functional.h>
 
+namespace
+{
+    const nau::shader_globals::GlobalVar g_vp{"vp"};
+} // namespace
 
 nau::RenderView::RenderView(eastl::string_view viewName) :
     m_viewName(viewName)
@@ -34,11 +38,6 @@ nau::RenderView::RenderView(eastl::string_view viewName) :
         nau::shader_globals::addVariable("uid", sizeof(math::IVector4), &uid);
     }
 
-    m_instanceFilter = eastl::function<bool(const InstanceInfo&)>([this](const InstanceInfo& info) 
-        {
-            return m_frustum.testSphere(info.worldSphere) != 0;
-        });
-
     m_materialFilter = eastl::function<bool(const MaterialAssetView::Ptr)>([](const MaterialAssetView::Ptr material) 
         {
             nau::BlendMode mode = material->getBlendMode("default");
@@ -48,10 +47,15 @@ nau::RenderView::RenderView(eastl::string_view viewName) :
 
 nau::RenderView::~RenderView()
 {
-    if (m_instanceData)
+    if (m_instanceIndices)
+    {
+        m_instanceIndices->destroy();
+        m_instanceIndices = nullptr;
+    }
+    if (m_viewInstanceData)
     {
-        m_instanceData->destroy();
-        m_instanceData = nullptr;
+        m_viewInstanceData->destroy();
+        m_viewInstanceData = nullptr;
     }
 }
 
@@ -70,100 +74,197 @@ void nau::RenderView::clearLists()
 
 void nau::RenderView::render(const nau::math::Matrix4& vp) const
 {
+    DrawStateCache state;
     for (auto& list : m_lists)
     {
         for (auto& ent : list->getEntities())
         {
-            ent.render(vp);
+            ent.render(vp, state);
         }
     }
 }
 
 void nau::RenderView::renderInstanced(const nau::math::Matrix4& vp) const
 {
-    if (m_instanceData == nullptr)
+    if (!hasInstanceBuffers())
     {
         return;
     }
 
-    nau::shader_globals::setVariable("vp", &vp);
+    g_vp.set(&vp);
 
-    for (auto& list : m_lists)
+    Sbuffer* const instanceIndices = getDrawInstanceIndices();
+    DrawStateCache state;
+    for (const DrawPacket& packet : makeDrawPackets(vp, nullptr, false))
     {
-        for (auto& ent : list->getEntities())
+        const RenderEntity& ent = *packet.entity;
+        // Draw arguments are in the entities order, see prepareInstanceData().
+        const uint32_t drawArgsOffset = packet.drawIndex * GpuInstanceCulling::getDrawArgsStride();
+        if (!ent.instancingSupported)
         {
-            if (!ent.instancingSupported || ent.instancesCount == 1)
-            {
-                ent.render(vp);
-            }
-            else
+            ent.render(vp, state);
+        }
+        else if (m_gpuCulling)
+        {
+            ent.renderInstancedIndirect(vp, m_instanceData, instanceIndices, m_gpuCulling->getDrawArgs(), drawArgsOffset, state);
+            if (m_hasLateDraws)
             {
-                ent.renderInstanced(vp, m_instanceData);
+                ent.renderInstancedIndirect(vp, m_instanceData, m_gpuCulling->getLateVisibleIndices(), m_gpuCulling->getLateDrawArgs(), drawArgsOffset, state);
             }
         }
+        else if (ent.instancesCount == 1 && !ent.isSkinned())
+        {
+            ent.render(vp, state);
+        }
+        else
+        {
+            ent.renderInstanced(vp, m_instanceData, instanceIndices, state);
+        }
     }
 }
 
 void nau::RenderView::renderZPrepass(const nau::math::Matrix4& vp, nau::MaterialAssetView* zPrepassMat) const
 {
-    if (m_instanceData == nullptr)
+    submitZPrepass(recordZPrepass(vp, zPrepassMat));
+}
+
+nau::RecordedPass nau::RenderView::recordZPrepass(const nau::math::Matrix4& vp, nau::MaterialAssetView* zPrepassMat) const
+{
+    NAU_ASSERT(zPrepassMat);
+    if (!hasInstanceBuffers())
+    {
+        return {vp, zPrepassMat};
+    }
+
+    return {vp, zPrepassMat, makeDrawPackets(vp, zPrepassMat, false)};
+}
+
+void nau::RenderView::submitZPrepass(const RecordedPass& pass) const
+{
+    if (!hasInstanceBuffers())
     {
         return;
     }
 
+    NAU_ASSERT(pass.material);
+    bindZPrepassBuffers(pass.material, getDrawInstanceIndices());
+    renderZPrepassPackets(pass.vp, pass.material, pass.packets, false);
+
+    if (m_hasLateDraws)
+    {
+        bindZPrepassBuffers(pass.material, m_gpuCulling->getLateVisibleIndices());
+        renderZPrepassPackets(pass.vp, pass.material, pass.packets, true);
+    }
+}
+
+void nau::RenderView::renderLateZPrepass(const nau::math::Matrix4& vp, nau::MaterialAssetView* zPrepassMat) const
+{
     NAU_ASSERT(zPrepassMat);
+    if (!m_hasLateDraws || !hasInstanceBuffers())
+    {
+        return;
+    }
+
+    bindZPrepassBuffers(zPrepassMat, m_gpuCulling->getLateVisibleIndices());
+    renderZPrepassPackets(vp, zPrepassMat, makeDrawPackets(vp, zPrepassMat, false), true);
+}
+
+void nau::RenderView::bindZPrepassBuffers(nau::MaterialAssetView* zPrepassMat, Sbuffer* instanceIndices) const
+{
     zPrepassMat->setRoBuffer("default", "instanceBuffer", m_instanceData);
     zPrepassMat->setRoBuffer("skinned", "instanceBuffer", m_instanceData);
+    if (m_instanceLayout == InstanceLayout::SlotIndexed)
+    {
+        zPrepassMat->setRoBuffer("default", "instanceIndices", instanceIndices);
+        zPrepassMat->setRoBuffer("skinned", "instanceIndices", instanceIndices);
+    }
+}
 
-    for (auto& list : m_lists)
+void nau::RenderView::renderOutlineMask(const nau::math::Matrix4& vp, nau::MaterialAssetView* zPrepassMat) const
+{
+    if (!hasInstanceBuffers())
     {
-        for (auto& ent : list->getEntities())
+        return;
+    }
+
+    NAU_ASSERT(zPrepassMat);
+    zPrepassMat->setRoBuffer("default", "instanceBuffer", m_instanceData);
+    if (m_instanceLayout == InstanceLayout::SlotIndexed)
+    {
+        zPrepassMat->setRoBuffer("default", "instanceIndices", getDrawInstanceIndices());
+    }
+
+    renderZPrepassPackets(vp, zPrepassMat, makeDrawPackets(vp, zPrepassMat, true), false);
+}
+
+void nau::RenderView::renderZPrepassPackets(const nau::math::Matrix4& vp, nau::MaterialAssetView* zPrepassMat, const nau::FrameVector<DrawPacket>& packets, bool isLate) const
+{
+    DrawStateCache state;
+    for (const DrawPacket& packet : packets)
+    {
+        const RenderEntity& ent = *packet.entity;
+        const uint32_t drawArgsOffset = packet.drawIndex * GpuInstanceCulling::getDrawArgsStride();
+        if (isLate)
         {
-            if (!ent.instancingSupported || ent.instancesCount == 1)
-            {
-                ent.renderZPrepass(vp, zPrepassMat);
-            }
-            else
+            // Only the instanced draws have the late phase.
+            if (ent.instancingSupported)
             {
-                ent.renderZPrepassInstanced(vp, zPrepassMat);
+                ent.renderZPrepassIndirect(vp, zPrepassMat, m_gpuCulling->getLateDrawArgs(), drawArgsOffset, state);
             }
         }
+        else if (!ent.instancingSupported)
+        {
+            ent.renderZPrepass(vp, zPrepassMat, state);
+        }
+        else if (m_gpuCulling)
+        {
+            ent.renderZPrepassIndirect(vp, zPrepassMat, m_gpuCulling->getDrawArgs(), drawArgsOffset, state);
+        }
+        else if (ent.instancesCount == 1)
+        {
+            ent.renderZPrepass(vp, zPrepassMat, state);
+        }
+        else
+        {
+            ent.renderZPrepassInstanced(vp, zPrepassMat, state);
+        }
     }
 }
 
-void nau::RenderView::renderOutlineMask(const nau::math::Matrix4& vp, nau::MaterialAssetView* zPrepassMat) const
+nau::DrawPipeline nau::RenderView::getDrawPipeline(const RenderEntity& entity) const
 {
-    if (m_instanceData == nullptr)
+    if (!entity.instancingSupported)
     {
-        return;
+        return entity.isSkinned() ? DrawPipeline::Skinned : DrawPipeline::Default;
     }
 
-    NAU_ASSERT(zPrepassMat);
-    zPrepassMat->setRoBuffer("default", "instanceBuffer", m_instanceData);
+    // The instanced skinned entities are drawn instanced also with one instance, their bones are in the palette only.
+    return m_gpuCulling || entity.instancesCount != 1 || entity.isSkinned() ? DrawPipeline::Instanced : DrawPipeline::Default;
+}
+
+nau::FrameVector<nau::DrawPacket> nau::RenderView::makeDrawPackets(const nau::math::Matrix4& vp, const MaterialAssetView* passMaterial, bool isHighlightedOnly) const
+{
+    nau::FrameVector<DrawPacket> packets;
 
+    uint32_t drawIndex = 0;
     for (auto& list : m_lists)
     {
-        for (auto& ent : list->getEntities())
+        for (const auto& ent : list->getEntities())
         {
-            auto highlightedIt = std::find_if(ent.instanceData.begin(), ent.instanceData.end(),
-                                              [](auto& data) -> bool
-            {
-                return data.isHighlighted;
-            });
-            if (highlightedIt == ent.instanceData.end())
+            const uint32_t entityDrawIndex = drawIndex++;
+            if (isHighlightedOnly && !ent.hasHighlightedInstances)
             {
                 continue;
             }
-            if (!ent.instancingSupported || ent.instancesCount == 1)
-            {
-                ent.renderZPrepass(vp, zPrepassMat);
-            }
-            else
-            {
-                ent.renderZPrepassInstanced(vp, zPrepassMat);
-            }
+
+            const MaterialAssetView* const material = passMaterial ? passMaterial : ent.material.get();
+            packets.push_back({makeDrawSortKey(m_drawOrder, getDrawPipeline(ent), material, ent, vp), &ent, entityDrawIndex});
         }
     }
+
+    sortDrawPackets(packets);
+
+    return packets;
 }
 
 void nau::RenderView::updateFrustum(const nau::math::Matrix4& vp)
@@ -171,8 +272,27 @@ void nau::RenderView::updateFrustum(const nau::math::Matrix4& vp)
     m_frustum = nau::math::NauFrustum(vp);
 }
 
-void nau::RenderView::prepareInstanceData()
+void nau::RenderView::updateFrustum(const nau::math::NauFrustum& frustum)
+{
+    m_frustum = frustum;
+}
+
+void nau::RenderView::setActive(bool isActive)
+{
+    m_isActive = isActive;
+}
+
+bool nau::RenderView::isActive() const
+{
+    return m_isActive;
+}
+
+void nau::RenderView::prepareInstanceData(const InstanceBuffer& sceneInstances)
 {
+    m_instanceData = m_instanceLayout == InstanceLayout::SlotIndexed ? sceneInstances.getBuffer() : m_viewInstanceData;
+    m_isEarlyCulled = false;
+    m_hasLateDraws = false;
+
     uint32_t instsCount = 0;
     for (auto& list : m_lists)
     {
@@ -187,33 +307,150 @@ void nau::RenderView::prepareInstanceData()
         return;
     }
 
-    eastl::vector<nau::RenderEntity::InstanceData> instDataVec;
-    instDataVec.reserve(instsCount);
+    nau::FrameVector<uint32_t> instSlotsVec;
+    instSlotsVec.reserve(instsCount);
 
     for (auto& list : m_lists)
     {
         for (auto& ent : list->getEntities())
         {
-            ent.startInstance = instDataVec.size();
-            instDataVec.insert(instDataVec.end(), ent.instanceData.begin(), ent.instanceData.end());
+            ent.startInstance = instSlotsVec.size();
+            instSlotsVec.insert(instSlotsVec.end(), ent.instanceSlots.begin(), ent.instanceSlots.end());
+        }
+    }
+
+    if (m_instanceLayout == InstanceLayout::Contiguous)
+    {
+        nau::FrameVector<nau::RenderEntity::InstanceData> instDataVec(instSlotsVec.size());
+        sceneInstances.copyInstanceData(instSlotsVec, instDataVec.data());
+
+        if (m_maxViewInstancesCount < instsCount)
+        {
+            m_maxViewInstancesCount = instsCount;
+
+            if (m_viewInstanceData)
+            {
+                m_viewInstanceData->destroy();
+            }
+
+            m_viewInstanceData = d3d::create_sbuffer(sizeof(nau::RenderEntity::InstanceData), m_maxViewInstancesCount, SBCF_BIND_SHADER_RES | SBCF_MISC_STRUCTURED | SBCF_DYNAMIC, 0, u8"inst buf");
         }
+        NAU_ASSERT(m_viewInstanceData);
+
+        // The whole content is rewritten: the discard gives the new memory, the frames in flight keep the previous one.
+        bool isUpdated = m_viewInstanceData->updateData(0, sizeof(nau::RenderEntity::InstanceData) * instDataVec.size(), instDataVec.data(), VBLOCK_WRITEONLY | VBLOCK_DISCARD);
+        NAU_ASSERT(isUpdated);
+
+        m_instanceData = m_viewInstanceData;
+        return;
     }
 
     if (m_maxInstancesCount < instsCount)
     {
         m_maxInstancesCount = instsCount;
 
-        if (m_instanceData)
+        if (m_instanceIndices)
         {
-            m_instanceData->destroy();
+            m_instanceIndices->destroy();
         }
 
-        m_instanceData = d3d::create_sbuffer(sizeof(nau::RenderEntity::InstanceData), m_maxInstancesCount, SBCF_BIND_SHADER_RES | SBCF_MISC_STRUCTURED | SBCF_DYNAMIC, 0, u8"inst buf");
+        m_instanceIndices = d3d::create_sbuffer(sizeof(uint32_t), m_maxInstancesCount, SBCF_BIND_SHADER_RES | SBCF_MISC_STRUCTURED | SBCF_DYNAMIC, 0, u8"inst indices buf");
     }
-    NAU_ASSERT(m_instanceData);
+    NAU_ASSERT(m_instanceIndices);
 
-    bool isUpdated = m_instanceData->updateData(0, sizeof(nau::RenderEntity::InstanceData) * instsCount, instDataVec.data(), VBLOCK_WRITEONLY | VBLOCK_DISCARD);
+    bool isUpdated = m_instanceIndices->updateData(0, sizeof(uint32_t) * instSlotsVec.size(), instSlotsVec.data(), VBLOCK_WRITEONLY | VBLOCK_DISCARD);
     NAU_ASSERT(isUpdated);
+
+    if (m_gpuCulling)
+    {
+        // One draw per entity, the not instanced ones are culled too but their draws are not used.
+        nau::FrameVector<GpuInstanceCulling::DrawInfo> draws;
+        for (auto& list : m_lists)
+        {
+            for (const auto& ent : list->getEntities())
+            {
+                draws.push_back({ent.startInstance, static_cast<uint32_t>(ent.instanceSlots.size()), ent.startIndex, ent.getIndexCount(), ent.baseVertex});
+            }
+        }
+
+        if (m_isGpuOcclusionCulling)
+        {
+            m_gpuCulling->cullEarly(m_frustum, sceneInstances.getBoundsBuffer(), m_instanceIndices, draws, sceneInstances.getSlotsCount());
+            m_isEarlyCulled = true;
+        }
+        else
+        {
+            m_gpuCulling->cull(m_frustum, sceneInstances.getBoundsBuffer(), m_instanceIndices, draws);
+        }
+    }
+}
+
+void nau::RenderView::setInstanceLayout(InstanceLayout layout)
+{
+    m_instanceLayout = layout;
+    m_instanceData = nullptr;
+    if (layout == InstanceLayout::Contiguous)
+    {
+        setGpuCulling(nullptr);
+    }
+}
+
+nau::RenderView::InstanceLayout nau::RenderView::getInstanceLayout() const
+{
+    return m_instanceLayout;
+}
+
+void nau::RenderView::setGpuCulling(MaterialAssetView::Ptr cullingMaterial)
+{
+    NAU_ASSERT(!cullingMaterial || m_instanceLayout == InstanceLayout::SlotIndexed, "GPU culling requires the slot indexed instances");
+    if (m_instanceLayout == InstanceLayout::Contiguous)
+    {
+        cullingMaterial = nullptr;
+    }
+
+    // The culled draws refer to the buffers of the replaced culling.
+    m_isEarlyCulled = false;
+    m_hasLateDraws = false;
+
+    if (cullingMaterial)
+    {
+        m_gpuCulling = eastl::make_unique<GpuInstanceCulling>(std::move(cullingMaterial));
+    }
+    else
+    {
+        m_gpuCulling.reset();
+    }
+}
+
+bool nau::RenderView::isGpuCulling() const
+{
+    return static_cast<bool>(m_gpuCulling);
+}
+
+void nau::RenderView::setGpuOcclusionCulling(bool isEnabled)
+{
+    m_isGpuOcclusionCulling = isEnabled;
+}
+
+bool nau::RenderView::isGpuOcclusionCulling() const
+{
+    return m_gpuCulling && m_isGpuOcclusionCulling;
+}
+
+void nau::RenderView::cullLate(const HiZBuffer& hiZ)
+{
+    m_hasLateDraws = m_isEarlyCulled && m_gpuCulling->cullLate(hiZ);
+    m_isEarlyCulled = false;
+}
+
+Sbuffer* nau::RenderView::getDrawInstanceIndices() const
+{
+    return m_gpuCulling ? m_gpuCulling->getVisibleIndices() : m_instanceIndices;
+}
+
+bool nau::RenderView::hasInstanceBuffers() const
+{
+    return m_instanceData && (m_instanceLayout == InstanceLayout::Contiguous || m_instanceIndices);
 }
 
 bool nau::RenderView::containsTag(RenderTag tag)
@@ -241,12 +478,67 @@ void* nau::RenderView::getUserData()
     return m_userData;
 }
 
-eastl::function<bool(const nau::InstanceInfo&)>& nau::RenderView::getInstanceFilter()
+nau::InstanceCulling nau::RenderView::getInstanceCulling() const
+{
+    // The GPU culling tests the frustum itself.
+    return {
+        .frustum = m_gpuCulling ? nullptr : &m_frustum,
+        .requiredState = m_requiredInstanceState,
+        .customFilter = m_instanceFilter ? &m_instanceFilter : nullptr};
+}
+
+void nau::RenderView::setRequiredInstanceState(InstanceStateFlag state)
+{
+    m_requiredInstanceState = state;
+}
+
+void nau::RenderView::setLodView(const nau::math::Vector3& viewerPosition, float screenScale)
+{
+    m_lodSelection.viewerPosition = viewerPosition;
+    m_lodSelection.screenScale = screenScale;
+}
+
+const nau::LodSelection& nau::RenderView::getLodSelection() const
+{
+    return m_lodSelection;
+}
+
+void nau::RenderView::setTexStreaming(const TexStreamingContext& context)
+{
+    m_texStreaming = context;
+}
+
+const TexStreamingContext& nau::RenderView::getTexStreaming() const
+{
+    return m_texStreaming;
+}
+
+void nau::RenderView::setDrawOrder(DrawOrder order)
+{
+    m_drawOrder = order;
+}
+
+nau::DrawOrder nau::RenderView::getDrawOrder() const
+{
+    return m_drawOrder;
+}
+
+void nau::RenderView::setOcclusionCulling(bool isEnabled)
+{
+    m_isOcclusionCulling = isEnabled;
+}
+
+bool nau::RenderView::isOcclusionCulling() const
+{
+    return m_isOcclusionCulling;
+}
+
+nau::InstanceFilter& nau::RenderView::getInstanceFilter()
 {
     return m_instanceFilter;
 }
 
-void nau::RenderView::setInstanceFilter(eastl::function<bool(const InstanceInfo&)>& filter)
+void nau::RenderView::setInstanceFilter(InstanceFilter& filter)
 {
     m_instanceFilter = filter;
 }
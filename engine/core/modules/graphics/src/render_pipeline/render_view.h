@@ -4,20 +4,47 @@
 
 #pragma once
 
+#include <EASTL/unique_ptr.h>
 #include <EASTL/vector.h>
 
 #include "nau/3d/dag_drv3d.h"
 #include "nau/math/dag_frustum.h"
 #include "graphics_assets/material_asset.h"
+#include "draw_packets.h"
 #include "render_list.h"
+#include "gpu_instance_culling.h"
+#include "instance_buffer.h"
 #include "instance_group.h"
 
 
 namespace nau
 {
+    /**
+     * The draws of a view pass recorded ahead of its submission. The recording makes no d3d calls:
+     * the passes of the independent views are recorded on the worker threads and then submitted in order.
+     */
+    struct RecordedPass
+    {
+        nau::math::Matrix4 vp;
+        nau::MaterialAssetView* material = nullptr;
+        nau::FrameVector<DrawPacket> packets;
+    };
+
     class RenderView
     {
     public:
+        /**
+         * How the instanced shaders read the instances data.
+         */
+        enum class InstanceLayout
+        {
+            // The view instances are copied (in the draw order) to the view buffer: instanceBuffer[instanceBaseID + instanceId].
+            // The layout of the shipped instanced shaders. No GPU culling: it produces the slot indices.
+            Contiguous,
+            // The scene buffer is read by the slots of the view indices buffer: instanceBuffer[instanceIndices[instanceBaseID + instanceId]].
+            SlotIndexed
+        };
+
         RenderView(eastl::string_view viewName);
         virtual ~RenderView();
 
@@ -29,9 +56,45 @@ namespace nau
         void renderZPrepass(const nau::math::Matrix4& vp, nau::MaterialAssetView* zPrepassMat) const;
         void renderOutlineMask(const nau::math::Matrix4& vp, nau::MaterialAssetView* zPrepassMat) const;
 
-        void updateFrustum(const nau::math::Matrix4& vp);
+        // renderZPrepass() split in two: the recording is thread safe, the submission is for the render thread only.
+        RecordedPass recordZPrepass(const nau::math::Matrix4& vp, nau::MaterialAssetView* zPrepassMat) const;
+        void submitZPrepass(const RecordedPass& pass) const;
 
-        void prepareInstanceData();
+        void updateFrustum(const nau::math::Matrix4& vp);
+        void updateFrustum(const nau::math::NauFrustum& frustum);
+
+        // The inactive views are not culled and get no render lists (the cached shadow cascades, for example).
+        void setActive(bool isActive);
+        bool isActive() const;
+
+        /**
+         * SlotIndexed: writes the scene buffer slots of all the view instances into the view indices buffer.
+         * Instances data itself is not copied: shaders read it from the scene buffer by the slot index.
+         * Contiguous: copies the data of the view instances into the view buffer.
+         */
+        void prepareInstanceData(const InstanceBuffer& sceneInstances);
+
+        // Contiguous by default. The Contiguous layout turns the GPU culling off.
+        void setInstanceLayout(InstanceLayout layout);
+        InstanceLayout getInstanceLayout() const;
+
+        /**
+         * Moves the frustum culling of the instanced draws to the GPU (nullptr material turns it off).
+         * The render lists are not frustum culled on the CPU then: prepareInstanceData() dispatches the culling
+         * and the instanced entities are drawn with the indirect arguments it produces.
+         */
+        void setGpuCulling(MaterialAssetView::Ptr cullingMaterial);
+        bool isGpuCulling() const;
+
+        /**
+         * The GPU culled views with the occlusion culling are culled in two phases (see GpuInstanceCulling::cullEarly):
+         * prepareInstanceData() leaves the instances not visible in the previous frame to cullLate().
+         * The draws of the late instances are added to the view passes once cullLate() is called, renderLateZPrepass() draws them alone.
+         */
+        void setGpuOcclusionCulling(bool isEnabled);
+        bool isGpuOcclusionCulling() const;
+        void cullLate(const HiZBuffer& hiZ);
+        void renderLateZPrepass(const nau::math::Matrix4& vp, nau::MaterialAssetView* zPrepassMat) const;
 
         const nau::math::NauFrustum& getFrustum() const
         {
@@ -46,20 +109,69 @@ namespace nau
         void* getUserData();
 
 
-        eastl::function<bool(const InstanceInfo&)>& getInstanceFilter();
-        void setInstanceFilter(eastl::function<bool(const InstanceInfo&)>& filter);
+        // The frustum culling and the required states test are batched, see InstanceCulling.
+        InstanceCulling getInstanceCulling() const;
+        void setRequiredInstanceState(InstanceStateFlag state);
+
+        // The lods are selected by the screen size of the instances from this point (see LodSelection).
+        void setLodView(const nau::math::Vector3& viewerPosition, float screenScale);
+        const LodSelection& getLodSelection() const;
+
+        // The streamed textures of the drawn materials request the resolution they cover in this view (no requests by default).
+        void setTexStreaming(const TexStreamingContext& context);
+        const TexStreamingContext& getTexStreaming() const;
+
+        // The view is culled by the scene occlusion buffer, it is rasterized from the camera: only for the camera views.
+        void setOcclusionCulling(bool isEnabled);
+        bool isOcclusionCulling() const;
+
+        // The draws of the view passes are sorted in this order (the state order by default).
+        void setDrawOrder(DrawOrder order);
+        DrawOrder getDrawOrder() const;
+
+        // Optional per instance filter (the slow path), called after the frustum culling.
+        InstanceFilter& getInstanceFilter();
+        void setInstanceFilter(InstanceFilter& filter);
 
         eastl::function<bool(const MaterialAssetView::Ptr)>& getMaterialFilter();
         void setMaterialFilter(eastl::function<bool(const MaterialAssetView::Ptr)>& filter);
 
     protected:
+        // The view instances: the GPU culled ones when the GPU culling is on.
+        Sbuffer* getDrawInstanceIndices() const;
+        bool hasInstanceBuffers() const;
+
+        void renderZPrepassPackets(const nau::math::Matrix4& vp, nau::MaterialAssetView* zPrepassMat, const nau::FrameVector<DrawPacket>& packets, bool isLate) const;
+        void bindZPrepassBuffers(nau::MaterialAssetView* zPrepassMat, Sbuffer* instanceIndices) const;
+
+        DrawPipeline getDrawPipeline(const RenderEntity& entity) const;
+        // The packets of the view entities sorted in the view draw order: by the pass material if any, else by the entity materials.
+        nau::FrameVector<DrawPacket> makeDrawPackets(const nau::math::Matrix4& vp, const MaterialAssetView* passMaterial, bool isHighlightedOnly) const;
+
         eastl::string m_viewName;
         nau::math::NauFrustum m_frustum;
+        // SlotIndexed: the scene instance buffer, owned by the RenderScene. Contiguous: m_viewInstanceData.
         Sbuffer* m_instanceData = nullptr;
+        Sbuffer* m_instanceIndices = nullptr;
         uint32_t m_maxInstancesCount = 0;
+        Sbuffer* m_viewInstanceData = nullptr;
+        uint32_t m_maxViewInstancesCount = 0;
+        InstanceLayout m_instanceLayout = InstanceLayout::Contiguous;
+        eastl::unique_ptr<GpuInstanceCulling> m_gpuCulling;
+        bool m_isGpuOcclusionCulling = false;
+        // The early phase of this frame is culled, the late one is not yet.
+        bool m_isEarlyCulled = false;
+        // The late phase of this frame is culled: its draws are added to the passes.
+        bool m_hasLateDraws = false;
         eastl::vector<RenderList::Ptr> m_lists = {};
 
-        eastl::function<bool(const InstanceInfo&)> m_instanceFilter;
+        InstanceStateFlag m_requiredInstanceState = InstanceState::Visible;
+        bool m_isOcclusionCulling = false;
+        bool m_isActive = true;
+        DrawOrder m_drawOrder = DrawOrder::State;
+        LodSelection m_lodSelection;
+        TexStreamingContext m_texStreaming{0.f};
+        InstanceFilter m_instanceFilter;
         eastl::function<bool(const MaterialAssetView::Ptr)> m_materialFilter;
 
         RenderTags m_tags;
@@ -6,9 +6,28 @@
 
 #include "graphics_assets/skinned_mesh_asset.h"
 #include "nau/math/dag_lsbVisitor.h"
+#include "nau/math/transform_batch.h"
 
 namespace nau
 {
+    namespace
+    {
+        const shader_globals::GlobalVar g_bonesTransforms{"BonesTransforms"};
+        const shader_globals::GlobalVar g_bonesNormalTransforms{"BonesNormalTransforms"};
+
+        // The box of the transformed box corners: by the center and the extents projected to the world axes.
+        nau::math::BBox3 transformBox(const nau::math::Matrix4& matrix, const nau::math::BBox3& box)
+        {
+            const nau::math::Vector3 center = (matrix * nau::math::Vector4(box.center(), 1.f)).getXYZ();
+            const nau::math::Vector3 halfWidth = box.width() * 0.5f;
+            const nau::math::Vector3 extents = absPerElem(matrix.getCol0().getXYZ()) * halfWidth.getX() +
+                                               absPerElem(matrix.getCol1().getXYZ()) * halfWidth.getY() +
+                                               absPerElem(matrix.getCol2().getXYZ()) * halfWidth.getZ();
+
+            return {center - extents, center + extents};
+        }
+    }  // namespace
+
     eastl::shared_ptr<nau::SkinnedMeshInstance> SkinnedMeshManager::addSkinnedMesh(SkinnedMeshAssetRef ref)
     {
         ReloadableAssetView::Ptr meshAsset = *async::waitResult(ref.getReloadableAssetViewTyped<SkinnedMeshAssetView>());
@@ -18,6 +37,8 @@ namespace nau
         eastl::shared_ptr<nau::SkinnedMeshInstance> ret = eastl::make_shared<nau::SkinnedMeshInstance>();
 
         ret->skinnedMesh = m_skinnedMeshes.back();
+        ret->m_instanceBuffer = m_instanceBuffer;
+        ret->m_instanceSlot = m_instanceBuffer->allocateSlot();
 
         m_skinnedMeshInstances.emplace_back(ret);
 
@@ -25,8 +46,43 @@ namespace nau
     }
 
     RenderList::Ptr nau::SkinnedMeshManager::getRenderList(const nau::math::Vector3& viewerPosition,
-        eastl::function<bool(const InstanceInfo&)>& filterFunc,
+        const InstanceCulling& culling,
         eastl::function<bool(const nau::MaterialAssetView::Ptr)>& materialFilter)
+    {
+        const RenderListFilter view{culling, &materialFilter};
+        RenderList::Ptr ret;
+        getRenderLists(viewerPosition, {&view, 1}, {&ret, 1});
+
+        return ret;
+    }
+
+    void nau::SkinnedMeshManager::getShadowCasterChanges(eastl::vector<nau::math::BSphere3>& outChanges)
+    {
+        // The animated instances are dynamic casters: both the previous and the current bounds are changed.
+        outChanges.insert(outChanges.end(), m_lastCasterSpheres.begin(), m_lastCasterSpheres.end());
+        m_lastCasterSpheres.clear();
+        for (auto& skinnedMeshInstanceWeak : m_skinnedMeshInstances)
+        {
+            if (const auto skinnedMeshInstance = skinnedMeshInstanceWeak.lock())
+            {
+                m_lastCasterSpheres.push_back(skinnedMeshInstance->worldSphere);
+            }
+        }
+        outChanges.insert(outChanges.end(), m_lastCasterSpheres.begin(), m_lastCasterSpheres.end());
+    }
+
+    void nau::SkinnedMeshManager::getRenderLists(const nau::math::Vector3& viewerPosition,
+        eastl::span<const RenderListFilter> views,
+        eastl::span<RenderList::Ptr> outLists)
+    {
+        NAU_ASSERT(outLists.size() >= views.size());
+        for (uint32_t view = 0; view < views.size(); ++view)
+        {
+            outLists[view] = createRenderList(views[view], view, static_cast<uint32_t>(views.size()));
+        }
+    }
+
+    RenderList::Ptr nau::SkinnedMeshManager::createRenderList(const RenderListFilter& view, uint32_t viewIndex, uint32_t viewsCount)
     {
         eastl::vector<RenderList::Ptr> lists;
 
@@ -36,6 +92,9 @@ namespace nau
             lists.front() = eastl::make_shared<RenderList>();
         }
 
+        // Entity index of each instanced (lod, material) pair.
+        nau::FrameMap<eastl::pair<const SkinnedMeshLod*, const MaterialAssetView*>, uint32_t> instancedEntities;
+
         for (auto& skinnedMeshInstanceWeak : m_skinnedMeshInstances)
         {
             if (skinnedMeshInstanceWeak.expired())
@@ -43,48 +102,104 @@ namespace nau
                 continue;
             }
             auto skinnedMeshInstance = skinnedMeshInstanceWeak.lock();
-            // if (!filterFunc())
-            //{
-            //     // todo: NAU-1797 fix frustum culling and test with different content
-            //     //continue;
-            // }
-            if (!materialFilter(skinnedMeshInstance->getActiveMaterial(0, 0)))
+
+            // Few instances compared to the static meshes: the per instance tests, not the batched ones.
+            if (!view.culling.isPassed(InstanceFilterInfo{skinnedMeshInstance->worldSphere, skinnedMeshInstance->getState()}))
+            {
+                continue;
+            }
+            const OcclusionCulling* occlusion = view.culling.occlusion;
+            if (occlusion && occlusion->hasOccluders() && !occlusion->isVisible(skinnedMeshInstance->m_worldBox, nau::math::Matrix4::identity()))
             {
                 continue;
             }
+            // The feedback to the animation: the pose of the culled instances is not computed.
+            skinnedMeshInstance->m_isVisibleInFrame.store(true, std::memory_order_relaxed);
 
             auto& skinnedMesh = skinnedMeshInstance->skinnedMesh;
 
-            RenderEntity& ent = lists.front()->emplaceBack();
-
             nau::Ptr<SkinnedMeshAssetView> skinnedMeshView;
             skinnedMesh->getTyped<SkinnedMeshAssetView>(skinnedMeshView);
+            const SkinnedMesh::Ptr mesh = skinnedMeshView->getMesh();
+
+            uint32_t lodLevel = 0;
+            if (view.lod.isEnabled() && mesh->getLodsCount() > 1)
+            {
+                // The previous lods of the instance in each view, for the hysteresis.
+                auto& viewLods = skinnedMeshInstance->m_viewLods;
+                if (viewLods.size() != viewsCount)
+                {
+                    viewLods.assign(viewsCount, 0);
+                }
+
+                lodLevel = view.lod.selectLod(skinnedMeshInstance->worldSphere, mesh->getLodsScreenSpaceError(), mesh->getLodsCount(), viewLods[viewIndex]);
+                viewLods[viewIndex] = static_cast<uint8_t>(lodLevel);
+            }
+
+            const nau::Ptr<MaterialAssetView> material = skinnedMeshInstance->getActiveMaterial(lodLevel, 0);
+            if (!(*view.materialFilter)(material))
+            {
+                continue;
+            }
+
+            // Few instances: the texture levels are requested per instance.
+            if (const uint32_t texLevel = view.getTexLevel(skinnedMeshInstance->worldSphere); texLevel > 0)
+            {
+                material->requestTextureLevel(texLevel);
+            }
+
+            const SkinnedMeshLod& lod = mesh->getLod(lodLevel);
+
+            // The instances of the same lod and material are drawn with one instanced draw, their bones are in the palette.
+            const bool isInstanced = material->hasPipeline("instanced");
+            if (isInstanced)
+            {
+                const auto [entityIter, isNewEntity] = instancedEntities.emplace(eastl::make_pair(&lod, material.get()), lists.front()->getEntitiesCount());
+                if (!isNewEntity)
+                {
+                    RenderEntity& ent = lists.front()->getEntities()[entityIter->second];
+                    ent.instanceSlots.push_back(skinnedMeshInstance->m_instanceSlot);
+                    ent.instancesCount = static_cast<uint32_t>(ent.instanceSlots.size());
+                    ent.hasHighlightedInstances |= skinnedMeshInstance->isHighlighted();
+                    continue;
+                }
+            }
+
+            RenderEntity& ent = lists.front()->emplaceBack();
 
-            const SkinnedMeshLod& lod = skinnedMeshView->getMesh()->getLod(0);
             ent.positionBuffer = lod.m_positionsBuffer;
             ent.normalsBuffer = lod.m_normalsBuffer;
             ent.texcoordsBuffer = lod.m_texcoordsBuffer;
             ent.tangentsBuffer = lod.m_tangentsBuffer;
+            ent.packedAttributesBuffer = lod.m_packedAttributesBuffer;
             ent.boneWeightsBuffer = lod.m_boneWeightsBuffer;
             ent.boneIndicesBuffer = lod.m_boneIndicesBuffer;
+            ent.bonePalette = m_bonePalette.getBuffer();
 
             ent.indexBuffer = lod.m_indexBuffer;
 
             ent.startInstance = 0;
             ent.instancesCount = 1;
-            ent.instanceData = {};
+            ent.instanceSlots = {};
             ent.tags = {};
 
             ent.startIndex = 0;
             ent.endIndex = lod.m_indexCount;
-            ent.material = skinnedMeshInstance->getActiveMaterial(0, 0);
+            ent.material = material;
 
-            ent.instancingSupported = false;
+            ent.instancingSupported = isInstanced;
+            // The first instance transform, for the draws sorting.
             ent.worldTransform = skinnedMeshInstance->worldMatrix;
-            ent.cbStructsData["BonesTransforms"] = RenderEntity::ConstBufferStructData{sizeof(skinnedMeshInstance->bonesTransforms), skinnedMeshInstance->bonesTransforms};
-            ent.cbStructsData["BonesNormalTransforms"] = RenderEntity::ConstBufferStructData{sizeof(skinnedMeshInstance->bonesNormalTransforms), skinnedMeshInstance->bonesNormalTransforms};
+            ent.normalTransform = skinnedMeshInstance->normalMatrix;
+            if (!isInstanced)
+            {
+                // The material default pipeline takes the bones from the constants of each draw.
+                ent.cbStructsData[g_bonesTransforms.getName()] = RenderEntity::ConstBufferStructData{sizeof(skinnedMeshInstance->bonesTransforms), skinnedMeshInstance->bonesTransforms, g_bonesTransforms.getId()};
+                ent.cbStructsData[g_bonesNormalTransforms.getName()] = RenderEntity::ConstBufferStructData{sizeof(skinnedMeshInstance->bonesNormalTransforms), skinnedMeshInstance->bonesNormalTransforms, g_bonesNormalTransforms.getId()};
+            }
 
-            ent.instanceData.emplace_back(skinnedMeshInstance->worldMatrix, skinnedMeshInstance->worldMatrix, skinnedMeshInstance->getUid(), skinnedMeshInstance->isHighlighted());
+            ent.instanceSlots.push_back(skinnedMeshInstance->m_instanceSlot);
+            ent.hasHighlightedInstances = skinnedMeshInstance->isHighlighted();
         }
 
         return eastl::make_shared<RenderList>(std::move(lists));
@@ -96,14 +211,74 @@ namespace nau
         {
             return val.expired();
         });
+
+        // Skinned meshes are animated: instance data and bones are updated every frame.
+        m_bonePalette.clear();
+        for (auto& skinnedMeshInstanceWeak : m_skinnedMeshInstances)
+        {
+            if (const auto skinnedMeshInstance = skinnedMeshInstanceWeak.lock())
+            {
+                skinnedMeshInstance->m_isVisible.store(skinnedMeshInstance->m_isVisibleInFrame.exchange(false, std::memory_order_relaxed), std::memory_order_relaxed);
+
+                nau::Ptr<SkinnedMeshAssetView> skinnedMeshView;
+                skinnedMeshInstance->skinnedMesh->getTyped<SkinnedMeshAssetView>(skinnedMeshView);
+                updateBounds(*skinnedMeshInstance, *skinnedMeshView->getMesh());
+
+                const uint32_t bonesCount = skinnedMeshInstance->bonesCount;
+                skinnedMeshInstance->m_bonesOffset = m_bonePalette.addBones({skinnedMeshInstance->bonesTransforms, bonesCount}, {skinnedMeshInstance->bonesNormalTransforms, bonesCount});
+
+                m_instanceBuffer->setInstanceData(skinnedMeshInstance->m_instanceSlot,
+                    {skinnedMeshInstance->worldMatrix, skinnedMeshInstance->worldMatrix, skinnedMeshInstance->getUid(), skinnedMeshInstance->isHighlighted(), skinnedMeshInstance->m_bonesOffset},
+                    skinnedMeshInstance->worldSphere);
+            }
+        }
+        m_bonePalette.flush();
+    }
+
+    void SkinnedMeshManager::updateBounds(SkinnedMeshInstance& instance, const SkinnedMesh& mesh)
+    {
+        nau::math::BBox3& worldBox = instance.m_worldBox;
+        worldBox.setempty();
+
+        // The bind pose boxes of the bones follow the bones: the bounds of the animated vertices.
+        const eastl::span<const nau::math::BBox3> bonesBoxes = mesh.getBonesBindBoxes();
+        const uint32_t bonesCount = instance.m_isPoseStale ? 0 : eastl::min(instance.bonesCount, static_cast<uint32_t>(bonesBoxes.size()));
+        for (uint32_t bone = 0; bone < bonesCount; ++bone)
+        {
+            if (!bonesBoxes[bone].isempty())
+            {
+                worldBox += transformBox(instance.bonesTransforms[bone], bonesBoxes[bone]);
+            }
+        }
+
+        // Not animated yet or the pose is stale: the bind pose bounds.
+        if (worldBox.isempty() && mesh.getLodsCount() > 0 && !mesh.getLod(0).m_localBBox.isempty())
+        {
+            worldBox = transformBox(instance.worldMatrix, mesh.getLod(0).m_localBBox);
+        }
+
+        if (worldBox.isempty())
+        {
+            instance.worldSphere = nau::math::BSphere3(instance.worldMatrix.getTranslation(), 0.f);
+            return;
+        }
+
+        worldBox.inflate(mesh.getBoundsPadding());
+        instance.worldSphere = nau::math::BSphere3(worldBox.center(), nau::math::length(worldBox.width()) * 0.5f);
+    }
+
+    SkinnedMeshInstance::~SkinnedMeshInstance()
+    {
+        if (m_instanceBuffer)
+        {
+            m_instanceBuffer->freeSlot(m_instanceSlot);
+        }
     }
 
     void SkinnedMeshInstance::setWorldPos(const nau::math::Matrix4& matrix)
     {
         worldMatrix = matrix;
-
-        // update aabb, bounding sphere, etc.
-        worldSphere.c = worldMatrix.getTranslation();  // TODO: need to take into account the scale
+        normalMatrix = math::inverseTransposeAffine(worldMatrix);
     }
 
     nau::math::Matrix4 SkinnedMeshInstance::getWorldPos()
@@ -127,7 +302,7 @@ namespace nau
         nau::Ptr<SkinnedMeshAssetView> skinnedMeshView;
         skinnedMesh->getTyped<SkinnedMeshAssetView>(skinnedMeshView);
         nau::Ptr<MaterialAssetView> materialMeshView;
-        skinnedMeshView->getMesh()->getLod(0).m_material->getTyped<MaterialAssetView>(materialMeshView);
+        skinnedMeshView->getMesh()->getLod(lodIndex).m_material->getTyped<MaterialAssetView>(materialMeshView);
         return materialMeshView;
     }
 
@@ -146,4 +321,25 @@ namespace nau
         return m_isHighlighted;
     }
 
+    InstanceStateFlag SkinnedMeshInstance::getState() const
+    {
+        const InstanceStateFlag state = InstanceState::Visible | InstanceState::CastShadow;
+        return m_isHighlighted ? state | InstanceState::Highlighted : state;
+    }
+
+    const nau::math::BBox3& SkinnedMeshInstance::getWorldBox() const
+    {
+        return m_worldBox;
+    }
+
+    bool SkinnedMeshInstance::isVisible() const
+    {
+        return m_isVisible.load(std::memory_order_relaxed);
+    }
+
+    void SkinnedMeshInstance::setPoseStale(bool isPoseStale)
+    {
+        m_isPoseStale = isPoseStale;
+    }
+
 }  // namespace nau
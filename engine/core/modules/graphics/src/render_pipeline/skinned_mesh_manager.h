@@ -4,19 +4,26 @@
 
 #pragma once
 
+#include "render_pipeline/bone_palette.h"
 #include "render_pipeline/render_scene.h"
 #include "render_pipeline/render_manager.h"
 #include "graphics_assets/skinned_mesh_asset.h"
 #include "nau/assets/asset_ref.h"
 #include "nau/shaders/shader_defines.h"
 
+#include <atomic>
+
 namespace nau
 {
     class SkinnedMeshInstance
     {
     public:
+        ~SkinnedMeshInstance();
+
         nau::math::Matrix4 bonesTransforms[NAU_MAX_SKINNING_BONES_COUNT];
         nau::math::Matrix4 bonesNormalTransforms[NAU_MAX_SKINNING_BONES_COUNT];
+        // The used prefix of the bones arrays, only it goes to the bone palette.
+        uint32_t bonesCount = 0;
 
         void setWorldPos(const nau::math::Matrix4& matrix);
         nau::math::Matrix4 getWorldPos();
@@ -27,6 +34,16 @@ namespace nau
         void setUid(const nau::Uid& uid);
         nau::Uid getUid() const;
         bool isHighlighted() const;
+        InstanceStateFlag getState() const;
+
+        // The world space bounds of the current pose, updated by SkinnedMeshManager::update().
+        const nau::math::BBox3& getWorldBox() const;
+
+        // Whether the instance passed the culling of any view in the last rendered frame.
+        bool isVisible() const;
+
+        // The bones are not updated while the skeleton pose is not computed: the bounds follow the world matrix only.
+        void setPoseStale(bool isPoseStale);
 
 
     private:
@@ -35,10 +52,24 @@ namespace nau
         ReloadableAssetView::Ptr skinnedMesh;
         ReloadableAssetView::Ptr m_materialOverride;
 
-        nau::math::Matrix4 worldMatrix;
+        nau::math::Matrix4 worldMatrix = nau::math::Matrix4::identity();
+        nau::math::Matrix4 normalMatrix = nau::math::Matrix4::identity();
         nau::math::BSphere3 worldSphere;
+        nau::math::BBox3 m_worldBox;
         nau::Uid m_uid;
-        bool m_isHighlighted;
+        bool m_isHighlighted = false;
+        bool m_isPoseStale = false;
+
+        // Set by the render lists of the frame (possibly of several views), moved to m_isVisible on the next update.
+        std::atomic<bool> m_isVisibleInFrame = false;
+        std::atomic<bool> m_isVisible = true;
+
+        InstanceBuffer::Ptr m_instanceBuffer;
+        uint32_t m_instanceSlot = InstanceBuffer::InvalidSlot;
+        // Of the current frame, see BonePalette.
+        uint32_t m_bonesOffset = 0;
+        // The last selected lod in each view.
+        eastl::vector<uint8_t> m_viewLods;
     };
 
     class SkinnedMeshManager : public IRenderManager
@@ -52,18 +83,31 @@ namespace nau
 
         // IRenderManager
         RenderList::Ptr getRenderList(const nau::math::Vector3& viewerPosition,
-            eastl::function<bool(const InstanceInfo&)>& filterFunc,
+            const InstanceCulling& culling,
             eastl::function<bool(const nau::MaterialAssetView::Ptr)>& materialFilter) override;
+        void getRenderLists(const nau::math::Vector3& viewerPosition,
+            eastl::span<const RenderListFilter> views,
+            eastl::span<RenderList::Ptr> outLists) override;
+        void getShadowCasterChanges(eastl::vector<nau::math::BSphere3>& outChanges) override;
 
         void update() override;
 
     protected:
+        static void updateBounds(SkinnedMeshInstance& instance, const SkinnedMesh& mesh);
+
+        RenderList::Ptr createRenderList(const RenderListFilter& view, uint32_t viewIndex, uint32_t viewsCount);
 
         RenderScene::Ptr m_sceneOwner;
 
         eastl::vector<ReloadableAssetView::Ptr> m_skinnedMeshes;
 
         eastl::vector<eastl::weak_ptr<nau::SkinnedMeshInstance>> m_skinnedMeshInstances;
+
+        // The bones of all the instances, shared by the instanced skinned draws of all the views.
+        BonePalette m_bonePalette;
+
+        // The bounds reported by the previous getShadowCasterChanges() call: the removed instances shadows are redrawn too.
+        eastl::vector<nau::math::BSphere3> m_lastCasterSpheres;
     };
 } // namespace nau
 
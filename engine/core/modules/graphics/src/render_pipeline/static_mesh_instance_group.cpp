@@ -4,15 +4,30 @@
 
 #include "static_mesh_instance_group.h"
 
+#include "frame_stats_collector.h"
 #include "graphics_assets/static_mesh_asset.h"
+#include "nau/math/dag_lsbVisitor.h"
+#include "nau/math/transform_batch.h"
 #include "nau/string/hash.h"
 
+#include <EASTL/algorithm.h>
+
 namespace nau
 {
 
-    StaticMeshInstanceGroup::StaticMeshInstanceGroup(nau::ReloadableAssetView::Ptr mesh) :
-        m_staticMesh(mesh)
+    StaticMeshInstanceGroup::StaticMeshInstanceGroup(nau::ReloadableAssetView::Ptr mesh, InstanceBuffer::Ptr instanceBuffer) :
+        m_staticMesh(mesh),
+        m_instanceBuffer(std::move(instanceBuffer))
+    {
+        NAU_ASSERT(m_instanceBuffer);
+    }
+
+    StaticMeshInstanceGroup::~StaticMeshInstanceGroup()
     {
+        for (const uint32_t slot : m_instanceSlots)
+        {
+            m_instanceBuffer->freeSlot(slot);
+        }
     }
 
     InstanceInfo StaticMeshInstanceGroup::addInstance(const nau::math::Matrix4& matrix)
@@ -25,7 +40,51 @@ namespace nau
 
     void StaticMeshInstanceGroup::addInstance(const InstanceInfo& inst)
     {
-        m_instances[inst.id] = inst;
+        uint32_t index;
+        if (const auto iter = m_idToIndex.find(inst.id); iter != m_idToIndex.end())
+        {
+            // The replaced instance keeps its slot.
+            index = iter->second;
+            addShadowCasterChange(index);
+        }
+        else
+        {
+            index = static_cast<uint32_t>(m_ids.size());
+            m_idToIndex[inst.id] = index;
+
+            m_ids.push_back(inst.id);
+            m_worldMatrices.emplace_back();
+            m_normalMatrices.emplace_back();
+            m_worldSpheres.emplace_back();
+            m_states.emplace_back();
+            m_uids.emplace_back();
+            m_instanceSlots.push_back(m_instanceBuffer->allocateSlot());
+            m_instanceParams.emplace_back();
+            m_viewLods.resize(m_viewLods.size() + m_lodViewsCount, 0);
+        }
+
+        m_worldMatrices[index] = inst.worldMatrix;
+        m_normalMatrices[index] = math::inverseTransposeAffine(inst.worldMatrix);
+        m_worldSpheres[index] = inst.worldSphere;
+        m_states[index] = {};
+        setState(index, InstanceState::Visible, inst.isVisible);
+        setState(index, InstanceState::CastShadow, inst.isCastShadow);
+        setState(index, InstanceState::Highlighted, inst.isHighlighted);
+        setState(index, InstanceState::Occluder, inst.isOccluder);
+        m_uids[index] = inst.uid;
+        addShadowCasterChange(index);
+
+        if (!inst.overrideInfo.empty())
+        {
+            m_materialOverrides[inst.id] = inst.overrideInfo;
+        }
+        else
+        {
+            m_materialOverrides.erase(inst.id);
+        }
+
+        updateInstanceParams(index);
+        updateInstanceData(index);
     }
 
     InstanceID StaticMeshInstanceGroup::reserveID()
@@ -57,130 +116,611 @@ namespace nau
 
 
     RenderList::Ptr nau::StaticMeshInstanceGroup::createRenderList(const nau::math::Vector3& viewerPosition,
-        eastl::function<bool(const InstanceInfo&)>& filterFunc,
+        const InstanceCulling& culling,
         eastl::function<bool(const nau::MaterialAssetView::Ptr)>& materialFilter)
     {
-        NAU_FATAL(m_staticMesh);
+        const RenderListFilter view{culling, &materialFilter};
+        RenderList::Ptr ret;
+        createRenderLists(viewerPosition, {&view, 1}, {&ret, 1});
+
+        return ret;
+    }
 
-        RenderList::Ptr ret = eastl::make_shared<RenderList>();
+    void nau::StaticMeshInstanceGroup::createRenderLists(const nau::math::Vector3& viewerPosition,
+        eastl::span<const RenderListFilter> views,
+        eastl::span<RenderList::Ptr> outLists)
+    {
+        NAU_FATAL(m_staticMesh);
+        NAU_ASSERT(outLists.size() >= views.size());
+
+        const uint32_t viewsCount = static_cast<uint32_t>(views.size());
+        const uint32_t instancesCount = static_cast<uint32_t>(m_ids.size());
+        const size_t maskSize = math::NauFrustum::getVisibleMaskSize(instancesCount);
+
+        // One visibility mask per view (view masks are placed one after another).
+        // The frustum test of all the views is done with one pass over the instances spheres.
+        nau::FrameVector<uint32_t> visibleMasks(maskSize * viewsCount, ~0u);
+        nau::FrameVector<const math::NauFrustum*> frusta;
+        nau::FrameVector<uint32_t*> frustaMasks;
+        for (uint32_t view = 0; view < viewsCount; ++view)
+        {
+            if (views[view].culling.frustum)
+            {
+                frusta.push_back(views[view].culling.frustum);
+                frustaMasks.push_back(visibleMasks.data() + view * maskSize);
+            }
+            NAU_ASSERT(views[view].materialFilter);
+        }
+        math::NauFrustum::testSpheres(frusta, m_worldSpheres, frustaMasks);
+        cullOccluded(views, visibleMasks, maskSize);
 
         Ptr<StaticMeshAssetView> meshView;
         m_staticMesh->getTyped<StaticMeshAssetView>(meshView);
-        eastl::vector<eastl::vector<eastl::map<size_t /*material name*/, uint32_t /*entityIndex*/>>> lodSlotMats(meshView->getMesh()->getLodsCount());
+        const nau::StaticMesh::Ptr mesh = meshView->getMesh();
+        const uint32_t lodsCount = eastl::min(mesh->getLodsCount(), LodSelection::MaxLods);
+
+        // The previous lods of the instances in each view, for the hysteresis.
+        const bool hasLodSelection = lodsCount > 1 && eastl::any_of(views.begin(), views.end(), [](const RenderListFilter& view)
+        {
+            return view.lod.isEnabled();
+        });
+        if (hasLodSelection && m_lodViewsCount != viewsCount)
+        {
+            m_lodViewsCount = viewsCount;
+            m_viewLods.assign(size_t(instancesCount) * viewsCount, 0);
+        }
+
+        // Per view: lod -> slot -> material batch -> entity index.
+        // The materials of a batch differ by the per-instance parameters only, their instances are drawn together.
+        using SlotMaterials = eastl::vector<eastl::map<size_t /*material batch hash*/, uint32_t /*entityIndex*/>>;
+        eastl::vector<eastl::vector<SlotMaterials>> viewLodSlotMats(viewsCount, eastl::vector<SlotMaterials>(mesh->getLodsCount()));
+        for (uint32_t view = 0; view < viewsCount; ++view)
+        {
+            outLists[view] = eastl::make_shared<RenderList>();
+        }
+
+        struct InstanceView
+        {
+            uint32_t view;
+            uint32_t lod;
+            uint32_t texLevel;
+        };
+        nau::FrameVector<InstanceView> instanceViews;
+        instanceViews.reserve(viewsCount);
 
-        for (const auto& [id, info] : m_instances)
+        // The highest texture level the instances of each material request, applied once after the traversal.
+        nau::FrameMap<const MaterialAssetView*, uint32_t> materialTexLevels;
+
+        // The (instance, view) pairs passed the culling, for the frame statistics.
+        uint32_t visibleCount = 0;
+
+        for (uint32_t maskIndex = 0; maskIndex < maskSize; ++maskIndex)
         {
-            if (!info.isVisible)
+            // Instances visible in any view.
+            uint32_t anyViewMask = 0;
+            for (uint32_t view = 0; view < viewsCount; ++view)
             {
-                continue;
+                anyViewMask |= visibleMasks[view * maskSize + maskIndex];
             }
 
-            if (!filterFunc(info))
+            for (const uint32_t bit : nau::math::LsbVisitor{anyViewMask})
             {
-                continue;
+                const uint32_t index = maskIndex * 32 + bit;
+                if (index >= instancesCount)
+                {
+                    break;
+                }
+
+                const InstanceStateFlag state = m_states[index];
+
+                // The views the instance passed the culling of, with the instance lod in each of them.
+                instanceViews.clear();
+                uint32_t instanceLods = 0;
+                for (uint32_t view = 0; view < viewsCount; ++view)
+                {
+                    const InstanceCulling& culling = views[view].culling;
+                    if ((visibleMasks[view * maskSize + maskIndex] & (1u << bit)) == 0 || !culling.hasRequiredState(state))
+                    {
+                        continue;
+                    }
+
+                    if (culling.customFilter && !(*culling.customFilter)(InstanceFilterInfo{m_worldSpheres[index], state}))
+                    {
+                        continue;
+                    }
+
+                    uint32_t lodLevel = 0;
+                    if (hasLodSelection)
+                    {
+                        uint8_t& previousLod = m_viewLods[size_t(index) * viewsCount + view];
+                        lodLevel = views[view].lod.selectLod(m_worldSpheres[index], mesh->getLodsScreenSpaceError(), lodsCount, previousLod);
+                        previousLod = static_cast<uint8_t>(lodLevel);
+                    }
+
+                    instanceViews.push_back({view, lodLevel, views[view].getTexLevel(m_worldSpheres[index])});
+                    instanceLods |= 1u << lodLevel;
+                }
+                visibleCount += static_cast<uint32_t>(instanceViews.size());
+
+                const eastl::map<uint64_t, MaterialOverrideInfo>* overrideInfo = nullptr;
+                if (instanceLods != 0 && !m_materialOverrides.empty())
+                {
+                    const auto overrideIter = m_materialOverrides.find(m_ids[index]);
+                    overrideInfo = overrideIter != m_materialOverrides.end() ? &overrideIter->second : nullptr;
+                }
+
+                // The materials are resolved once per (lod, slot) for all the views with that lod.
+                for (const uint32_t lodLevel : nau::math::LsbVisitor{instanceLods})
+                {
+                    const nau::StaticMeshLod& lod = mesh->getLod(lodLevel);
+
+                    for (size_t slotInd = 0; slotInd < lod.m_materialSlots.size(); slotInd++)
+                    {
+                        const nau::MaterialSlot& slot = lod.m_materialSlots[slotInd];
+                        uint64_t lodSlot = (uint64_t(lodLevel) << 32) | uint64_t(slotInd);
+
+                        nau::Ptr<nau::MaterialAssetView> material;
+                        if (overrideInfo && overrideInfo->count(lodSlot))
+                        {
+                            overrideInfo->at(lodSlot).material->getTyped<MaterialAssetView>(material);
+                        }
+                        else
+                        {
+                            slot.m_material->getTyped<MaterialAssetView>(material);
+                        }
+
+                        const size_t batchHash = material->getBatchHash();
+
+                        for (const InstanceView& instanceView : instanceViews)
+                        {
+                            const uint32_t view = instanceView.view;
+                            if (instanceView.lod != lodLevel || !(*views[view].materialFilter)(material))
+                            {
+                                continue;
+                            }
+
+                            if (instanceView.texLevel > 0)
+                            {
+                                uint32_t& texLevel = materialTexLevels[material.get()];
+                                texLevel = eastl::max(texLevel, instanceView.texLevel);
+                            }
+
+                            RenderList& list = *outLists[view];
+                            auto& slotMats = viewLodSlotMats[view][lodLevel];
+                            if (slotMats.empty())
+                            {
+                                slotMats.resize(lod.m_materialSlots.size());
+                            }
+
+                            auto& mats = slotMats[slotInd];
+
+                            if (!mats.count(batchHash))
+                            {
+                                mats[batchHash] = list.getEntitiesCount();
+
+                                nau::RenderEntity& ent = list.emplaceBack();
+                                ent.positionBuffer = lod.m_positionsBuffer;
+                                ent.normalsBuffer = lod.m_normalsBuffer;
+                                ent.texcoordsBuffer = lod.m_texCoordsBuffer;
+                                ent.tangentsBuffer = lod.m_tangentsBuffer;
+                                ent.packedAttributesBuffer = lod.m_packedAttributesBuffer;
+                                ent.indexBuffer = lod.m_indexBuffer;
+                                ent.startInstance = 0;
+                                ent.instancesCount = 0;
+                                ent.instanceSlots = {};
+                                ent.tags = {};
+
+                                // keep first world matrix
+                                ent.worldTransform = m_worldMatrices[index];
+                                ent.normalTransform = m_normalMatrices[index];
+                                ent.startIndex = lod.m_geometry.startIndex + slot.m_startIndex;
+                                ent.endIndex = lod.m_geometry.startIndex + slot.m_endIndex;
+                                ent.baseVertex = static_cast<int32_t>(lod.m_geometry.baseVertex);
+                                ent.material = material;
+                            }
+
+                            uint32_t entInd = mats[batchHash];
+                            nau::RenderEntity& entity = list[entInd];
+
+                            entity.instancesCount++;
+                            entity.instanceSlots.push_back(m_instanceSlots[index]);
+                            entity.hasHighlightedInstances |= state.has(InstanceState::Highlighted);
+                        }
+                    }
+                }
             }
+        }
 
-            // Calculate lod level based on screen size
-            // TODO: calculate lodLevel based on distance when we get lods
-            // float distance = length(info.worldMatrix.getTranslation() - viewerPosition); // distance for now, not screen size
-            uint32_t lodLevel = 0;
+        for (const auto& [material, texLevel] : materialTexLevels)
+        {
+            material->requestTextureLevel(texLevel);
+        }
 
-            Ptr<StaticMeshAssetView> meshView;
-            m_staticMesh->getTyped<StaticMeshAssetView>(meshView);
+        render::addInstanceCullingStats(instancesCount * viewsCount, visibleCount);
+    }
 
-            const nau::StaticMeshLod& lod = meshView->getMesh()->getLod(lodLevel);
+    void StaticMeshInstanceGroup::cullOccluded(eastl::span<const RenderListFilter> views, eastl::span<uint32_t> visibleMasks, size_t maskSize) const
+    {
+        const uint32_t viewsCount = static_cast<uint32_t>(views.size());
+        const uint32_t instancesCount = static_cast<uint32_t>(m_ids.size());
 
-            auto& slotMats = lodSlotMats[lodLevel];
+        Ptr<StaticMeshAssetView> meshView;
+        m_staticMesh->getTyped<StaticMeshAssetView>(meshView);
+        // The lod 0 box is tested for all the lods.
+        const nau::math::BBox3& localBox = meshView->getMesh()->getLod(0).m_localBBox;
 
-            if (slotMats.empty())
+        for (uint32_t view = 0; view < viewsCount; ++view)
+        {
+            const OcclusionCulling* occlusion = views[view].culling.occlusion;
+            if (!occlusion || !occlusion->hasOccluders())
             {
-                slotMats.resize(lod.m_materialSlots.size());
+                continue;
             }
 
-            // iterate through slots
-            for (size_t slotInd = 0; slotInd < lod.m_materialSlots.size(); slotInd++)
+            const auto hasSameOcclusion = [occlusion](const RenderListFilter& other)
+            {
+                return other.culling.occlusion == occlusion;
+            };
+            if (eastl::any_of(views.begin(), views.begin() + view, hasSameOcclusion))
             {
-                const nau::MaterialSlot& slot = lod.m_materialSlots[slotInd];
-                uint64_t lodSlot = (uint64_t(lodLevel) << 32) | uint64_t(slotInd);
+                continue;
+            }
 
-                nau::Ptr<nau::MaterialAssetView> material;
-                if (info.overrideInfo.count(lodSlot))
+            for (uint32_t maskIndex = 0; maskIndex < maskSize; ++maskIndex)
+            {
+                // Instances passed the frustum test of any view with this occlusion buffer.
+                uint32_t testMask = 0;
+                for (uint32_t other = view; other < viewsCount; ++other)
                 {
-                    info.overrideInfo.at(lodSlot).material->getTyped<MaterialAssetView>(material);
+                    if (hasSameOcclusion(views[other]))
+                    {
+                        testMask |= visibleMasks[other * maskSize + maskIndex];
+                    }
                 }
-                else
+
+                uint32_t occludedMask = 0;
+                for (const uint32_t bit : nau::math::LsbVisitor{testMask})
                 {
-                    slot.m_material->getTyped<MaterialAssetView>(material);
+                    const uint32_t index = maskIndex * 32 + bit;
+                    if (index >= instancesCount)
+                    {
+                        break;
+                    }
+
+                    if (!m_states[index].has(InstanceState::Occluder) && !occlusion->isVisible(localBox, m_worldMatrices[index]))
+                    {
+                        occludedMask |= 1u << bit;
+                    }
                 }
 
-                if (!materialFilter(material))
+                if (occludedMask == 0)
                 {
                     continue;
                 }
-
-                size_t matNameHash = material->getNameHash(); // TODO: cache this inside material
-                auto& mats = slotMats[slotInd];
-
-                if (!mats.count(matNameHash))
+                for (uint32_t other = view; other < viewsCount; ++other)
                 {
-                    mats[matNameHash] = ret->getEntitiesCount();
-
-                    nau::RenderEntity& ent = ret->emplaceBack();
-                    ent.positionBuffer = lod.m_positionsBuffer;
-                    ent.normalsBuffer = lod.m_normalsBuffer;
-                    ent.texcoordsBuffer = lod.m_texCoordsBuffer;
-                    ent.tangentsBuffer = lod.m_tangentsBuffer;
-                    ent.indexBuffer = lod.m_indexBuffer;
-                    ent.startInstance = 0;
-                    ent.instancesCount = 0;
-                    ent.instanceData = {};
-                    ent.tags = {};
-
-                    ent.worldTransform = info.worldMatrix;  // keep first world matrix
-                    ent.startIndex = slot.m_startIndex;
-                    ent.endIndex = slot.m_endIndex;
-                    ent.material = material;
+                    if (hasSameOcclusion(views[other]))
+                    {
+                        visibleMasks[other * maskSize + maskIndex] &= ~occludedMask;
+                    }
                 }
+            }
+        }
+    }
+
+    void StaticMeshInstanceGroup::setTransform(InstanceID instID, const nau::math::Matrix4& worldMatrix, const nau::math::BSphere3& worldSphere)
+    {
+        const uint32_t index = getIndex(instID);
+        addShadowCasterChange(index);
+
+        m_worldMatrices[index] = worldMatrix;
+        m_normalMatrices[index] = math::inverseTransposeAffine(worldMatrix);
+        m_worldSpheres[index] = worldSphere;
+        updateInstanceData(index);
+        addShadowCasterChange(index);
+    }
+
+    void StaticMeshInstanceGroup::setVisible(InstanceID instID, bool isVisible)
+    {
+        const uint32_t index = getIndex(instID);
+        if (m_states[index].has(InstanceState::Visible) != isVisible)
+        {
+            addShadowCasterChange(index);
+            setState(index, InstanceState::Visible, isVisible);
+            addShadowCasterChange(index);
+        }
+    }
+
+    void StaticMeshInstanceGroup::setCastShadow(InstanceID instID, bool isCastShadow)
+    {
+        const uint32_t index = getIndex(instID);
+        if (m_states[index].has(InstanceState::CastShadow) != isCastShadow)
+        {
+            addShadowCasterChange(index);
+            setState(index, InstanceState::CastShadow, isCastShadow);
+            addShadowCasterChange(index);
+        }
+    }
 
-                uint32_t entInd = mats[matNameHash];
-                nau::RenderEntity& entity = (*ret)[entInd];
+    void StaticMeshInstanceGroup::setHighlighted(InstanceID instID, bool isHighlighted)
+    {
+        const uint32_t index = getIndex(instID);
+        if (m_states[index].has(InstanceState::Highlighted) != isHighlighted)
+        {
+            setState(index, InstanceState::Highlighted, isHighlighted);
+            updateInstanceData(index);
+        }
+    }
+
+    bool StaticMeshInstanceGroup::hasHighlightedInstances() const
+    {
+        return !m_highlightedIds.empty();
+    }
 
-                entity.instancesCount++;
-                const nau::math::Matrix4 normalMatrix = math::transpose(math::inverse(info.worldMatrix));
-                entity.instanceData.emplace_back(info.worldMatrix, normalMatrix, info.uid, info.isHighlighted);
+    RenderList::Ptr StaticMeshInstanceGroup::createHighlightedRenderList() const
+    {
+        nau::FrameVector<uint32_t> indices;
+        indices.reserve(m_highlightedIds.size());
+        for (const InstanceID instID : m_highlightedIds)
+        {
+            const uint32_t index = getIndex(instID);
+            if (m_states[index].has(InstanceState::Visible) && !m_states[index].has(InstanceState::PendingDelete))
+            {
+                indices.push_back(index);
             }
         }
 
-        return ret;
+        if (indices.empty())
+        {
+            return nullptr;
+        }
+
+        Ptr<StaticMeshAssetView> meshView;
+        m_staticMesh->getTyped<StaticMeshAssetView>(meshView);
+        const nau::StaticMeshLod& lod = meshView->getMesh()->getLod(0);
+
+        // The outline material draws all the slots: their materials are for the draws sorting only.
+        RenderList::Ptr list = eastl::make_shared<RenderList>();
+        for (const nau::MaterialSlot& slot : lod.m_materialSlots)
+        {
+            nau::RenderEntity& ent = list->emplaceBack();
+            ent.positionBuffer = lod.m_positionsBuffer;
+            ent.normalsBuffer = lod.m_normalsBuffer;
+            ent.texcoordsBuffer = lod.m_texCoordsBuffer;
+            ent.tangentsBuffer = lod.m_tangentsBuffer;
+            ent.packedAttributesBuffer = lod.m_packedAttributesBuffer;
+            ent.indexBuffer = lod.m_indexBuffer;
+            ent.startInstance = 0;
+            ent.instancesCount = static_cast<uint32_t>(indices.size());
+            ent.tags = {};
+
+            // keep first world matrix
+            ent.worldTransform = m_worldMatrices[indices.front()];
+            ent.normalTransform = m_normalMatrices[indices.front()];
+            ent.startIndex = lod.m_geometry.startIndex + slot.m_startIndex;
+            ent.endIndex = lod.m_geometry.startIndex + slot.m_endIndex;
+            ent.baseVertex = static_cast<int32_t>(lod.m_geometry.baseVertex);
+            slot.m_material->getTyped<MaterialAssetView>(ent.material);
+
+            ent.instanceSlots.reserve(indices.size());
+            for (const uint32_t index : indices)
+            {
+                ent.instanceSlots.push_back(m_instanceSlots[index]);
+            }
+            ent.hasHighlightedInstances = true;
+        }
+
+        return list;
+    }
+
+    void StaticMeshInstanceGroup::setOccluder(InstanceID instID, bool isOccluder)
+    {
+        setState(getIndex(instID), InstanceState::Occluder, isOccluder);
+    }
+
+    void StaticMeshInstanceGroup::setUid(InstanceID instID, const nau::Uid& uid)
+    {
+        const uint32_t index = getIndex(instID);
+        if (m_uids[index] != uid)
+        {
+            m_uids[index] = uid;
+            updateInstanceData(index);
+        }
+    }
+
+    void StaticMeshInstanceGroup::setMaterialOverrides(InstanceID instID, const eastl::map<uint64_t, MaterialOverrideInfo>& overrides)
+    {
+        const uint32_t index = getIndex(instID);
+        if (!overrides.empty())
+        {
+            m_materialOverrides[instID] = overrides;
+        }
+        else
+        {
+            m_materialOverrides.erase(instID);
+        }
+
+        updateInstanceParams(index);
+        updateInstanceData(index);
+    }
+
+    void StaticMeshInstanceGroup::markPendingDelete(InstanceID instID)
+    {
+        const uint32_t index = getIndex(instID);
+        addShadowCasterChange(index);
+        setState(index, InstanceState::PendingDelete, true);
+        m_hasPendingDelete = true;
     }
 
     void StaticMeshInstanceGroup::clearPendingInstances()
     {
-        eastl::erase_if(m_instances, [](const auto& pair)
+        if (!m_hasPendingDelete)
         {
-            return pair.second.toDelete;
-        });
+            return;
+        }
+
+        // Backward: removeAt() moves the last instance into the removed one place.
+        for (uint32_t index = static_cast<uint32_t>(m_ids.size()); index-- > 0;)
+        {
+            if (m_states[index].has(InstanceState::PendingDelete))
+            {
+                removeAt(index);
+            }
+        }
+        m_hasPendingDelete = false;
+    }
+
+    void StaticMeshInstanceGroup::getOccluders(nau::FrameVector<OcclusionCulling::Occluder>& outOccluders) const
+    {
+        Ptr<StaticMeshAssetView> meshView;
+        m_staticMesh->getTyped<StaticMeshAssetView>(meshView);
+        const nau::StaticMeshLod& lod = meshView->getMesh()->getLod(0);
+        if (lod.m_occluderIndices.empty())
+        {
+            return;
+        }
+
+        constexpr InstanceStateFlag occluderState = InstanceState::Visible | InstanceState::Occluder;
+        for (uint32_t index = 0; index < m_ids.size(); ++index)
+        {
+            if (m_states[index].has(occluderState) && !m_states[index].has(InstanceState::PendingDelete))
+            {
+                outOccluders.push_back({lod.m_occluderVertices, lod.m_occluderIndices, m_worldMatrices[index]});
+            }
+        }
+    }
+
+    void StaticMeshInstanceGroup::takeShadowCasterChanges(eastl::vector<nau::math::BSphere3>& outChanges)
+    {
+        outChanges.insert(outChanges.end(), m_shadowCasterChanges.begin(), m_shadowCasterChanges.end());
+        m_shadowCasterChanges.clear();
     }
 
     void StaticMeshInstanceGroup::removeInstance(InstanceID instID)
     {
-        NAU_ASSERT(contains(instID));
-        m_instances.erase(instID);
+        const uint32_t index = getIndex(instID);
+        addShadowCasterChange(index);
+        removeAt(index);
     }
 
     bool StaticMeshInstanceGroup::contains(InstanceID instID) const
     {
-        return m_instances.contains(instID);
+        return m_idToIndex.contains(instID);
     }
 
     size_t StaticMeshInstanceGroup::getInstancesCount() const
     {
-        return m_instances.size();
+        return m_ids.size();
+    }
+
+    uint32_t StaticMeshInstanceGroup::getIndex(InstanceID instID) const
+    {
+        const auto iter = m_idToIndex.find(instID);
+        NAU_FATAL(iter != m_idToIndex.end(), "Unknown instance");
+        return iter->second;
+    }
+
+    void StaticMeshInstanceGroup::setState(uint32_t index, InstanceState state, bool value)
+    {
+        if (value)
+        {
+            m_states[index].set(state);
+        }
+        else
+        {
+            m_states[index].unset(state);
+        }
+
+        if (state == InstanceState::Highlighted)
+        {
+            if (value)
+            {
+                m_highlightedIds.insert(m_ids[index]);
+            }
+            else
+            {
+                m_highlightedIds.erase(m_ids[index]);
+            }
+        }
     }
 
-    InstanceInfo& StaticMeshInstanceGroup::getInstance(InstanceID instID)
+    void StaticMeshInstanceGroup::addShadowCasterChange(uint32_t index)
     {
-        return m_instances[instID];
+        constexpr InstanceStateFlag casterState = InstanceState::Visible | InstanceState::CastShadow;
+        if (m_states[index].has(casterState) && !m_states[index].has(InstanceState::PendingDelete))
+        {
+            m_shadowCasterChanges.push_back(m_worldSpheres[index]);
+        }
+    }
+
+    void StaticMeshInstanceGroup::removeAt(uint32_t index)
+    {
+        const InstanceID instID = m_ids[index];
+        m_instanceBuffer->freeSlot(m_instanceSlots[index]);
+        m_materialOverrides.erase(instID);
+        m_highlightedIds.erase(instID);
+        m_idToIndex.erase(instID);
+
+        const uint32_t lastIndex = static_cast<uint32_t>(m_ids.size()) - 1;
+        if (index != lastIndex)
+        {
+            m_ids[index] = m_ids[lastIndex];
+            m_worldMatrices[index] = m_worldMatrices[lastIndex];
+            m_normalMatrices[index] = m_normalMatrices[lastIndex];
+            m_worldSpheres[index] = m_worldSpheres[lastIndex];
+            m_states[index] = m_states[lastIndex];
+            m_uids[index] = m_uids[lastIndex];
+            m_instanceSlots[index] = m_instanceSlots[lastIndex];
+            m_instanceParams[index] = m_instanceParams[lastIndex];
+            eastl::copy_n(m_viewLods.begin() + size_t(lastIndex) * m_lodViewsCount, m_lodViewsCount, m_viewLods.begin() + size_t(index) * m_lodViewsCount);
+            m_idToIndex[m_ids[index]] = index;
+        }
+
+        m_ids.pop_back();
+        m_worldMatrices.pop_back();
+        m_normalMatrices.pop_back();
+        m_worldSpheres.pop_back();
+        m_states.pop_back();
+        m_uids.pop_back();
+        m_instanceSlots.pop_back();
+        m_instanceParams.pop_back();
+        m_viewLods.resize(m_viewLods.size() - m_lodViewsCount);
+    }
+
+    void StaticMeshInstanceGroup::updateInstanceData(uint32_t index)
+    {
+        m_instanceBuffer->setInstanceData(m_instanceSlots[index],
+            {m_worldMatrices[index], m_normalMatrices[index], m_uids[index], m_states[index].has(InstanceState::Highlighted), 0, m_instanceParams[index]},
+            m_worldSpheres[index]);
+    }
+
+    void StaticMeshInstanceGroup::updateInstanceParams(uint32_t index)
+    {
+        Ptr<StaticMeshAssetView> meshView;
+        m_staticMesh->getTyped<StaticMeshAssetView>(meshView);
+        const nau::StaticMeshLod& lod = meshView->getMesh()->getLod(0);
+
+        // The lod 0 slot 0 override key, see MeshHandle::overrideMaterial.
+        constexpr uint64_t firstLodSlot = 0;
+
+        nau::Ptr<nau::MaterialAssetView> material;
+        if (const auto overrideIter = m_materialOverrides.find(m_ids[index]); overrideIter != m_materialOverrides.end() && overrideIter->second.count(firstLodSlot))
+        {
+            overrideIter->second.at(firstLodSlot).material->getTyped<MaterialAssetView>(material);
+        }
+        else if (!lod.m_materialSlots.empty())
+        {
+            lod.m_materialSlots.front().m_material->getTyped<MaterialAssetView>(material);
+        }
+
+        if (material && material->hasInstanceParams())
+        {
+            material->getInstanceParams(m_instanceParams[index]);
+        }
+        else
+        {
+            m_instanceParams[index].fill(nau::math::Vector4::zero());
+        }
     }
 
 }  // namespace nau
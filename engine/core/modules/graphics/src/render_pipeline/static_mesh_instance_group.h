@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <EASTL/vector_set.h>
 #include <graphics_assets/static_mesh_asset.h>
 
 #include "graphics_assets/static_meshes/static_mesh.h"
@@ -13,11 +14,16 @@
 
 namespace nau
 {
+    /**
+     * Instances are stored as the structure of arrays: the render list creation and the culling walk through the packed arrays.
+     * Removal moves the last instance into the freed place, so the indices are not stable: use InstanceID to address an instance.
+     */
     class StaticMeshInstanceGroup : public IInstanceGroup
     {
     public:
 
-        StaticMeshInstanceGroup(nau::ReloadableAssetView::Ptr mesh);
+        StaticMeshInstanceGroup(nau::ReloadableAssetView::Ptr mesh, InstanceBuffer::Ptr instanceBuffer);
+        ~StaticMeshInstanceGroup();
 
         InstanceInfo addInstance(const nau::math::Matrix4& matrix);
         void addInstance(const InstanceInfo& inst);
@@ -28,17 +34,40 @@ namespace nau
         // Inherited via IInstanceGroup
         size_t getInstancesCount() const override;
 
-        InstanceInfo& getInstance(InstanceID instID) override;
         void removeInstance(InstanceID instID) override;
         bool contains(InstanceID instID) const override;
 
         RenderEntity createRenderEntity() override;
         RenderList::Ptr createRenderList(const nau::math::Vector3& viewerPosition,
-            eastl::function<bool(const InstanceInfo&)>& filterFunc,
+            const InstanceCulling& culling,
             eastl::function<bool(const nau::MaterialAssetView::Ptr)>& materialFilter) override;
+        void createRenderLists(const nau::math::Vector3& viewerPosition,
+            eastl::span<const RenderListFilter> views,
+            eastl::span<RenderList::Ptr> outLists) override;
 
+        // The normal matrix is computed here, once for the transform change.
+        void setTransform(InstanceID instID, const nau::math::Matrix4& worldMatrix, const nau::math::BSphere3& worldSphere);
+        void setVisible(InstanceID instID, bool isVisible);
+        void setCastShadow(InstanceID instID, bool isCastShadow);
+        void setHighlighted(InstanceID instID, bool isHighlighted);
+        void setOccluder(InstanceID instID, bool isOccluder);
+        void setUid(InstanceID instID, const nau::Uid& uid);
+        void setMaterialOverrides(InstanceID instID, const eastl::map<uint64_t, MaterialOverrideInfo>& overrides);
+
+        // The instance is removed with the next clearPendingInstances() call.
+        void markPendingDelete(InstanceID instID);
         void clearPendingInstances();
 
+        bool hasHighlightedInstances() const;
+        // The lod 0 draws of the visible highlighted instances only, for the outline pass: built from the highlighted set.
+        RenderList::Ptr createHighlightedRenderList() const;
+
+        // The visible occluder instances, with the lod 0 geometry.
+        void getOccluders(nau::FrameVector<OcclusionCulling::Occluder>& outOccluders) const;
+
+        // Moves out the shadow casters bounds changed since the previous call (see IRenderManager::getShadowCasterChanges).
+        void takeShadowCasterChanges(eastl::vector<nau::math::BSphere3>& outChanges);
+
         inline nau::math::BSphere3 getMeshBSphereLod0()
         {
             Ptr<StaticMeshAssetView> meshView;
@@ -47,8 +76,46 @@ namespace nau
         }
 
     protected:
+        uint32_t getIndex(InstanceID instID) const;
+        void setState(uint32_t index, InstanceState state, bool value);
+        void removeAt(uint32_t index);
+        // Called before and after the instance change: only the shadow casters bounds are recorded.
+        void addShadowCasterChange(uint32_t index);
+
+        // Clears the occluded instances bits, the views sharing the occlusion buffer are tested at once.
+        void cullOccluded(eastl::span<const RenderListFilter> views, eastl::span<uint32_t> visibleMasks, size_t maskSize) const;
+
+        // Writes the instance render data into its InstanceBuffer slot.
+        void updateInstanceData(uint32_t index);
+
+        // Reads the per-instance material parameters from the lod 0 first slot material of the instance (overridden or the mesh one):
+        // an instance has the single set of them, the slots are expected to share the master material.
+        void updateInstanceParams(uint32_t index);
+
         nau::ReloadableAssetView::Ptr m_staticMesh;
-        eastl::unordered_map<InstanceID, InstanceInfo> m_instances;
+        InstanceBuffer::Ptr m_instanceBuffer;
+
+        // Instances data, indexed by the instance index (see m_idToIndex).
+        eastl::vector<InstanceID> m_ids;
+        eastl::vector<nau::math::Matrix4> m_worldMatrices;
+        eastl::vector<nau::math::Matrix4> m_normalMatrices;
+        eastl::vector<nau::math::BSphere3> m_worldSpheres;
+        eastl::vector<InstanceStateFlag> m_states;
+        eastl::vector<nau::Uid> m_uids;
+        eastl::vector<uint32_t> m_instanceSlots;
+        eastl::vector<MaterialAssetView::InstanceParams> m_instanceParams;
+        // The last selected lod of each instance in each view: m_lodViewsCount entries per instance.
+        eastl::vector<uint8_t> m_viewLods;
+        uint32_t m_lodViewsCount = 0;
+
+        eastl::unordered_map<InstanceID, uint32_t> m_idToIndex;
+        // The instances with the Highlighted state, kept by setState(): the outline list does not walk all the instances.
+        eastl::vector_set<InstanceID> m_highlightedIds;
+        // Sparse: only the instances with the overridden materials are present.
+        eastl::unordered_map<InstanceID, eastl::map<uint64_t, MaterialOverrideInfo>> m_materialOverrides;
+        bool m_hasPendingDelete = false;
+        eastl::vector<nau::math::BSphere3> m_shadowCasterChanges;
+
         std::atomic<InstanceID> freeInstanceId = 0;
     };
 
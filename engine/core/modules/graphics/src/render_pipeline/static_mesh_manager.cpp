@@ -3,61 +3,113 @@
 
 
 #include "render_pipeline/static_mesh_manager.h"
+#include "nau/async/parallel_for.h"
 #include "nau/math/dag_lsbVisitor.h"
+#include "nau/math/transform_batch.h"
 #include <graphics_impl.h>
+#include "scene_render_state.h"
 #include <EASTL/algorithm.h>
 
 namespace nau
 {
+    eastl::shared_ptr<StaticMeshInstanceGroup> StaticMeshManager::findGroup(const AssetPath& assetPath) const
+    {
+        const auto refToGroup = m_assetRefToGroup.find(assetPath);
+        return refToGroup != m_assetRefToGroup.end() ? refToGroup->second.lock() : nullptr;
+    }
+
+
     async::Task<eastl::shared_ptr<StaticMeshInstanceGroup>> StaticMeshManager::findOrCreateGroup(StaticMeshAssetRef ref)
     {
         auto& graphics = getServiceProvider().get<nau::GraphicsImpl>();
         ASYNC_SWITCH_EXECUTOR(graphics.getPreRenderExecutor());
 
-        auto findByRef = [&ref](const auto& val)
-            {
-                return val.first == ref && !val.second.expired();
-            };
+        const AssetPath assetPath = ref.getAssetDiscriptor()->getAssetPath();
+        if (auto group = findGroup(assetPath))
+        {
+            co_return group;
+        }
 
         auto meshAsset = co_await ref.getReloadableAssetViewTyped<StaticMeshAssetView>();
 
-        eastl::shared_ptr<nau::StaticMeshInstanceGroup> group = nullptr;
-        if (eastl::find_if(m_assetRefToGroup.begin(), m_assetRefToGroup.end(), findByRef) == m_assetRefToGroup.end())
+        // The group could be created by another request while the asset was loading.
+        eastl::shared_ptr<nau::StaticMeshInstanceGroup> group = findGroup(assetPath);
+        if (!group)
         {
             NAU_ASSERT(meshAsset);
-            group = eastl::make_shared<nau::StaticMeshInstanceGroup>(meshAsset);
+            group = eastl::make_shared<nau::StaticMeshInstanceGroup>(meshAsset, m_instanceBuffer);
             m_meshGroups.push_back(group);
-            m_assetRefToGroup.emplace_back(ref, group);
+            m_assetRefToGroup[assetPath] = group;
         }
 
-        if(group == nullptr)
-        {
-            eastl::weak_ptr<StaticMeshInstanceGroup> weakGroup = eastl::find_if(m_assetRefToGroup.begin(), m_assetRefToGroup.end(), findByRef)->second;
-            group = weakGroup.lock();
-            NAU_ASSERT(group);
-        }
-        
         co_return group;
     }
 
 
-    async::Task<eastl::unique_ptr<nau::MeshHandle>> StaticMeshManager::addStaticMesh(StaticMeshAssetRef ref, const nau::math::Matrix4& matrix)
+    eastl::unique_ptr<nau::MeshHandle> StaticMeshManager::makeHandle(eastl::shared_ptr<StaticMeshInstanceGroup> group, const nau::math::Matrix4& matrix)
     {
-        eastl::shared_ptr<StaticMeshInstanceGroup> group = co_await findOrCreateGroup(ref);
-
-        auto& graphics = getServiceProvider().get<nau::GraphicsImpl>();
-        ASYNC_SWITCH_EXECUTOR(graphics.getPreRenderExecutor());
-
         auto instance = group->addInstance(matrix);
 
         eastl::unique_ptr<nau::MeshHandle> ret = eastl::make_unique<nau::MeshHandle>();
-        ret->m_group      = group;
+        ret->m_group      = std::move(group);
         ret->m_instInfo   = instance;
         ret->m_generation = 0;
         ret->m_manager    = this;
         ret->m_scene      = m_sceneOwner;
 
-        co_return eastl::move(ret);
+        return ret;
+    }
+
+
+    async::Task<eastl::unique_ptr<nau::MeshHandle>> StaticMeshManager::addStaticMesh(StaticMeshAssetRef ref, const nau::math::Matrix4& matrix)
+    {
+        eastl::shared_ptr<StaticMeshInstanceGroup> group = co_await findOrCreateGroup(ref);
+
+        auto& graphics = getServiceProvider().get<nau::GraphicsImpl>();
+        ASYNC_SWITCH_EXECUTOR(graphics.getPreRenderExecutor());
+
+        co_return makeHandle(std::move(group), matrix);
+    }
+
+
+    async::Task<eastl::vector<eastl::unique_ptr<nau::MeshHandle>>> StaticMeshManager::addStaticMeshes(eastl::vector<StaticMeshPlacement> placements)
+    {
+        auto& graphics = getServiceProvider().get<nau::GraphicsImpl>();
+        ASYNC_SWITCH_EXECUTOR(graphics.getPreRenderExecutor());
+
+        // One group request per distinct mesh, the missing groups are loaded in parallel.
+        eastl::unordered_map<AssetPath, size_t> groupIndices;
+        eastl::vector<async::Task<eastl::shared_ptr<StaticMeshInstanceGroup>>> groupTasks;
+        eastl::vector<size_t> placementGroups;
+        placementGroups.reserve(placements.size());
+        for (const StaticMeshPlacement& placement : placements)
+        {
+            const auto [groupIndex, isNew] = groupIndices.emplace(placement.mesh.getAssetDiscriptor()->getAssetPath(), groupTasks.size());
+            if (isNew)
+            {
+                groupTasks.emplace_back(findOrCreateGroup(placement.mesh));
+            }
+            placementGroups.push_back(groupIndex->second);
+        }
+
+        co_await async::whenAll(groupTasks, Expiration::never());
+        ASYNC_SWITCH_EXECUTOR(graphics.getPreRenderExecutor());
+
+        eastl::vector<eastl::shared_ptr<StaticMeshInstanceGroup>> groups;
+        groups.reserve(groupTasks.size());
+        for (auto& groupTask : groupTasks)
+        {
+            groups.emplace_back(*std::move(groupTask));
+        }
+
+        eastl::vector<eastl::unique_ptr<nau::MeshHandle>> handles;
+        handles.reserve(placements.size());
+        for (size_t i = 0; i < placements.size(); ++i)
+        {
+            handles.emplace_back(makeHandle(groups[placementGroups[i]], placements[i].worldMatrix));
+        }
+
+        co_return handles;
     }
 
 
@@ -67,13 +119,13 @@ namespace nau
         {
             if (const auto& group = weakGroup.lock())
             {
-                auto dummy = eastl::function<bool(const InstanceInfo&)>([](const InstanceInfo&) -> bool { return true; });
                 auto dummyForMaterials = eastl::function<bool(const MaterialAssetView::Ptr)>([](const MaterialAssetView::Ptr) -> bool { return true; });
-                auto list = group->createRenderList({}, dummy, dummyForMaterials);
+                auto list = group->createRenderList({}, InstanceCulling{}, dummyForMaterials);
 
+                DrawStateCache state;
                 for (auto& ent : list->getEntities())
                 {
-                    ent.render(viewProj);
+                    ent.render(viewProj, state);
                 }
             }
             else
@@ -85,24 +137,133 @@ namespace nau
 
 
     RenderList::Ptr nau::StaticMeshManager::getRenderList(const nau::math::Vector3& viewerPosition,
-        eastl::function<bool(const InstanceInfo&)>& filterFunc,
+        const InstanceCulling& culling,
         eastl::function<bool(const nau::MaterialAssetView::Ptr)>& materialFilter)
     {
-        eastl::vector<RenderList::Ptr> lists;
-        lists.reserve(m_meshGroups.size());
+        const RenderListFilter view{culling, &materialFilter};
+        RenderList::Ptr ret;
+        getRenderLists(viewerPosition, {&view, 1}, {&ret, 1});
+
+        return ret;
+    }
+
+
+    void nau::StaticMeshManager::getRenderLists(const nau::math::Vector3& viewerPosition,
+        eastl::span<const RenderListFilter> views,
+        eastl::span<RenderList::Ptr> outLists)
+    {
+        NAU_ASSERT(outLists.size() >= views.size());
+
+        nau::FrameVector<eastl::shared_ptr<StaticMeshInstanceGroup>> groups;
+        groups.reserve(m_meshGroups.size());
+        for (auto& weakGroup : m_meshGroups)
+        {
+            if (auto group = weakGroup.lock())
+            {
+                groups.emplace_back(std::move(group));
+            }
+            else
+            {
+                m_isGroupsDirty = true;
+            }
+        }
+
+        // Groups are independent: their lists (of all the views) are built in parallel,
+        // each group writes to its own place, so the merge order does not depend on the threads.
+        const size_t viewsCount = views.size();
+        nau::FrameVector<RenderList::Ptr> groupLists(groups.size() * viewsCount);
+        async::parallelFor(groups.size(), 1, [&](size_t groupIndex)
+        {
+            groups[groupIndex]->createRenderLists(viewerPosition, views, {groupLists.data() + groupIndex * viewsCount, viewsCount});
+        });
+
+        eastl::vector<eastl::vector<RenderList::Ptr>> viewLists(viewsCount);
+        for (size_t view = 0; view < viewsCount; ++view)
+        {
+            viewLists[view].reserve(groups.size());
+            for (size_t groupIndex = 0; groupIndex < groups.size(); ++groupIndex)
+            {
+                viewLists[view].emplace_back(std::move(groupLists[groupIndex * viewsCount + view]));
+            }
+        }
+
+        for (size_t view = 0; view < views.size(); ++view)
+        {
+            outLists[view] = eastl::make_shared<RenderList>(std::move(viewLists[view]));
+        }
+    }
+
+
+    RenderList::Ptr nau::StaticMeshManager::getHighlightedRenderList()
+    {
+        eastl::vector<RenderList::Ptr> groupLists;
+        eastl::erase_if(m_highlightedGroups, [&groupLists](const eastl::weak_ptr<StaticMeshInstanceGroup>& weakGroup)
+        {
+            const auto group = weakGroup.lock();
+            if (!group || !group->hasHighlightedInstances())
+            {
+                return true;
+            }
+
+            if (RenderList::Ptr list = group->createHighlightedRenderList())
+            {
+                groupLists.emplace_back(std::move(list));
+            }
+            return false;
+        });
+
+        return groupLists.empty() ? nullptr : eastl::make_shared<RenderList>(std::move(groupLists));
+    }
+
+
+    void StaticMeshManager::setHighlighted(const eastl::shared_ptr<StaticMeshInstanceGroup>& group, InstanceID instID, bool isHighlighted)
+    {
+        group->setHighlighted(instID, isHighlighted);
+        if (!isHighlighted)
+        {
+            return;
+        }
+
+        const bool isTracked = eastl::any_of(m_highlightedGroups.begin(), m_highlightedGroups.end(), [&group](const auto& weakGroup)
+        {
+            return weakGroup.lock() == group;
+        });
+        if (!isTracked)
+        {
+            m_highlightedGroups.push_back(group);
+        }
+    }
+
+
+    void nau::StaticMeshManager::getOccluders(nau::FrameVector<OcclusionCulling::Occluder>& outOccluders)
+    {
         for (auto& weakGroup : m_meshGroups)
         {
             if (const auto& group = weakGroup.lock())
             {
-                lists.emplace_back(group->createRenderList({}, filterFunc, materialFilter));
+                group->getOccluders(outOccluders);
             }
             else
             {
                 m_isGroupsDirty = true;
             }
         }
+    }
 
-        return eastl::make_shared<RenderList>(std::move(lists));
+
+    void nau::StaticMeshManager::getShadowCasterChanges(eastl::vector<nau::math::BSphere3>& outChanges)
+    {
+        for (auto& weakGroup : m_meshGroups)
+        {
+            if (const auto& group = weakGroup.lock())
+            {
+                group->takeShadowCasterChanges(outChanges);
+            }
+            else
+            {
+                m_isGroupsDirty = true;
+            }
+        }
     }
 
 
@@ -122,10 +283,10 @@ namespace nau
 
         if (m_isGroupsDirty)
         {
-            eastl::erase_if(m_assetRefToGroup, [](const auto& refToGroup)
-                {
-                    return refToGroup.second.expired();
-                });
+            for (auto refToGroup = m_assetRefToGroup.begin(); refToGroup != m_assetRefToGroup.end();)
+            {
+                refToGroup = refToGroup->second.expired() ? m_assetRefToGroup.erase(refToGroup) : eastl::next(refToGroup);
+            }
 
             eastl::erase_if(m_meshGroups, [](const auto& group)
                 {
@@ -145,10 +306,7 @@ namespace nau
     void MeshHandle::setWorldTransform(const nau::math::Transform& transform)
     {
         m_instInfo.worldMatrix = transform.getMatrix();
-
-        float maxScale = maxElem(transform.getScale());
-        // update aabb, bounding sphere, etc.
-        m_instInfo.worldSphere = nau::math::BSphere3(m_instInfo.worldMatrix.getTranslation(), m_instInfo.localSphere.r * maxScale);
+        m_instInfo.worldSphere = nau::math::transformSphere(m_instInfo.worldMatrix, m_instInfo.localSphere);
     }
 
     nau::math::Matrix4 MeshHandle::getWorldPos()
@@ -200,41 +358,60 @@ namespace nau
     }
 
 
-    void MeshHandle::syncState(nau::scene::StaticMeshComponent& component)
+    void MeshHandle::setOccluder(bool isOccluder)
+    {
+        NAU_ASSERT(m_group);
+
+        m_instInfo.isOccluder = isOccluder;
+        m_group->setOccluder(m_instInfo.id, isOccluder);
+    }
+
+    bool MeshHandle::isOccluder() const
+    {
+        return m_instInfo.isOccluder;
+    }
+
+
+    void MeshHandle::syncState(const StaticMeshProxy& proxy)
     {
         NAU_ASSERT(m_group);
         using DirtyFlags = nau::scene::StaticMeshComponent::DirtyFlags;
 
-        nau::InstanceInfo& info = m_group->getInstance(m_instInfo.id);
-        info.isHighlighted = m_instInfo.isHighlighted;
-        info.uid = m_instInfo.uid;
+        const InstanceID instID = m_instInfo.id;
+        if (m_group->hasHighlightedInstances() || m_instInfo.isHighlighted)
+        {
+            m_manager->setHighlighted(m_group, instID, m_instInfo.isHighlighted);
+        }
+        m_group->setUid(instID, m_instInfo.uid);
 
         if(isMaterialDirty)
         {
-            info.overrideInfo = m_instInfo.overrideInfo;
+            m_group->setMaterialOverrides(instID, m_instInfo.overrideInfo);
             isMaterialDirty = false;
         }
 
-        uint32_t flags = component.getDirtyFlags();
+        uint32_t flags = proxy.dirtyFlags;
         for (auto flag : nau::math::LsbVisitor{ flags })
         {
             switch (1 << flag)
             {
             case static_cast<uint32_t>(DirtyFlags::WorldPos):
-                setWorldTransform(component.getWorldTransform());
-                info.worldMatrix = m_instInfo.worldMatrix;
-                info.worldSphere = m_instInfo.worldSphere;
+                setWorldTransform(proxy.worldTransform);
+                m_group->setTransform(instID, m_instInfo.worldMatrix, m_instInfo.worldSphere);
                 break;
             //case static_cast<uint32_t>(DirtyFlags::Material):
-            //    info.overrideInfo = m_instInfo.overrideInfo;
+            //    m_group->setMaterialOverrides(instID, m_instInfo.overrideInfo);
             //    break;
             case static_cast<uint32_t>(DirtyFlags::Visibility):
-                setVisibility(component.getVisibility());
-                info.isVisible = m_instInfo.isVisible;
+                setVisibility(proxy.isVisible);
+                m_group->setVisible(instID, m_instInfo.isVisible);
                 break;
             case static_cast<uint32_t>(DirtyFlags::CastShadow):
-                setCastShadow(component.getCastShadow());
-                info.isCastShadow = m_instInfo.isCastShadow;
+                setCastShadow(proxy.castShadow);
+                m_group->setCastShadow(instID, m_instInfo.isCastShadow);
+                break;
+            case static_cast<uint32_t>(DirtyFlags::Occluder):
+                setOccluder(proxy.isOccluder);
                 break;
             }
         }
@@ -256,7 +433,7 @@ namespace nau
         NAU_ASSERT(m_manager);
         NAU_ASSERT(m_group);
 
-        m_group->getInstance(m_instInfo.id).toDelete = true;
+        m_group->markPendingDelete(m_instInfo.id);
         m_group.reset();
     }
 
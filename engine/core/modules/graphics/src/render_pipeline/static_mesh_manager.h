@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <EASTL/unordered_map.h>
+
 #include "nau/math/transform.h"
 #include "render_pipeline/render_scene.h"
 #include "render_pipeline/render_manager.h"
@@ -14,6 +16,14 @@
 namespace nau
 {
     class MeshHandle;
+    struct StaticMeshProxy;
+
+    // An instance of the mesh to add, see StaticMeshManager::addStaticMeshes.
+    struct StaticMeshPlacement
+    {
+        StaticMeshAssetRef mesh;
+        nau::math::Matrix4 worldMatrix;
+    };
 
     class StaticMeshManager : public IRenderManager
     {
@@ -24,20 +34,41 @@ namespace nau
 
         async::Task<eastl::unique_ptr<nau::MeshHandle>> addStaticMesh(StaticMeshAssetRef ref, const nau::math::Matrix4& matrix);
 
+        /**
+         * Adds the instances of many meshes at once: the group of each distinct mesh is resolved once
+         * and all the instances are inserted within a single pre-render executor job.
+         * The handles are returned in the order of the placements.
+         */
+        async::Task<eastl::vector<eastl::unique_ptr<nau::MeshHandle>>> addStaticMeshes(eastl::vector<StaticMeshPlacement> placements);
+
         void render(nau::math::Matrix4 viewProj); // temporal, for testing only
 
         // Inherited via IRenderManager
         RenderList::Ptr getRenderList(const nau::math::Vector3& viewerPosition,
-            eastl::function<bool(const InstanceInfo&)>& filterFunc,
+            const InstanceCulling& culling,
             eastl::function<bool(const nau::MaterialAssetView::Ptr)>& materialFilter) override;
+        void getRenderLists(const nau::math::Vector3& viewerPosition,
+            eastl::span<const RenderListFilter> views,
+            eastl::span<RenderList::Ptr> outLists) override;
+        RenderList::Ptr getHighlightedRenderList() override;
+        void getOccluders(nau::FrameVector<OcclusionCulling::Occluder>& outOccluders) override;
+        void getShadowCasterChanges(eastl::vector<nau::math::BSphere3>& outChanges) override;
 
         void update() override;
 
+        // Also tracks the groups with the highlighted instances, for getHighlightedRenderList().
+        void setHighlighted(const eastl::shared_ptr<StaticMeshInstanceGroup>& group, InstanceID instID, bool isHighlighted);
+
     protected:
         async::Task<eastl::shared_ptr<StaticMeshInstanceGroup>> findOrCreateGroup(StaticMeshAssetRef ref);
+        eastl::shared_ptr<StaticMeshInstanceGroup> findGroup(const AssetPath& assetPath) const;
+        eastl::unique_ptr<nau::MeshHandle> makeHandle(eastl::shared_ptr<StaticMeshInstanceGroup> group, const nau::math::Matrix4& matrix);
 
         eastl::vector<eastl::weak_ptr<StaticMeshInstanceGroup>> m_meshGroups;
-        eastl::vector<eastl::pair<StaticMeshAssetRef, eastl::weak_ptr<StaticMeshInstanceGroup>>> m_assetRefToGroup;
+        // The asset refs are equal when their paths are, so the groups are indexed by the path.
+        eastl::unordered_map<AssetPath, eastl::weak_ptr<StaticMeshInstanceGroup>> m_assetRefToGroup;
+        // The groups that had the highlighted instances: the outline list is built from them only.
+        eastl::vector<eastl::weak_ptr<StaticMeshInstanceGroup>> m_highlightedGroups;
 
         RenderScene::Ptr m_sceneOwner;
 
@@ -66,7 +97,12 @@ namespace nau
 
         void setCastShadow(bool castShadow);
 
-        void syncState(nau::scene::StaticMeshComponent& component);
+        // Applied to the instance group at once: the occluder flag is not a part of the initial instance state.
+        void setOccluder(bool isOccluder);
+        bool isOccluder() const;
+
+        // Applies the component state captured by the scene sync (see StaticMeshProxy)
+        void syncState(const StaticMeshProxy& proxy);
 
         void overrideMaterial(uint32_t lodIndex, uint32_t slotIndex, ReloadableAssetView::Ptr material);
 
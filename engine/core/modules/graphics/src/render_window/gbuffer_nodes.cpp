@@ -21,26 +21,32 @@ namespace nau::render
             registry.orderMeBefore(nau::utils::format("{}_{}", "fill_gbuffer", m_swapchain).c_str());
             registry.executionHas(dabfg::SideEffects::External);
 
-            auto uidTarget = registry
-                                 .createTexture2d(nau::utils::format("{}_{}", "uid_texture", m_swapchain).c_str(),
-                                                  dabfg::History::ClearZeroOnFirstFrame,
-                                                  dabfg::Texture2dCreateInfo{TEXFMT_A32B32G32R32UI | TEXCF_RTARGET,
-                                                                             registry.getResolution(m_resolutionName.c_str())})
-                                 .atStage(dabfg::Stage::POST_RASTER)
-                                 .useAs(dabfg::Usage::COLOR_ATTACHMENT)
-                                 .handle();
-
-            return [=, this]()
+            // The object ids are rendered by the picking nodes, on the request frames only.
+            return [this]()
             {
-                d3d::set_render_target(const_cast<BaseTexture*>(uidTarget.get()), 0);
+                d3d::set_render_target();
+                d3d::set_render_target(nullptr, 0);
                 d3d::set_depth(m_gBuffer->getDepth(), DepthAccess::RW);
-                d3d::clearview(CLEAR_TARGET | CLEAR_ZBUFFER | CLEAR_STENCIL, nau::math::E3DCOLOR(0, 0, 0, 0), 0, 0);
+                d3d::clearview(CLEAR_ZBUFFER | CLEAR_STENCIL, nau::math::E3DCOLOR(0, 0, 0, 0), 0, 0);
 
                 m_graphicsScene->renderDepth();
                 d3d::set_depth(nullptr, DepthAccess::RW);
             };
         }));
 
+        // The instances not visible in the previous frame are culled by the Hi-Z of the prepass depth and added to it (the GPU culling only).
+        m_gBufferNodes.addNode(dabfg::register_node(nau::utils::format("{}_{}", "occlusion_late_phase", m_swapchain).c_str(), DABFG_PP_NODE_SRC, [this](dabfg::Registry registry)
+        {
+            registry.orderMeAfter(nau::utils::format("{}_{}", "z-prepass", m_swapchain).c_str());
+            registry.orderMeBefore(nau::utils::format("{}_{}", "fill_gbuffer", m_swapchain).c_str());
+            registry.executionHas(dabfg::SideEffects::External);
+
+            return [this]()
+            {
+                m_graphicsScene->renderOccludedDepth(m_gBuffer->getDepth());
+            };
+        }));
+
         m_gBufferNodes.addNode(dabfg::register_node(nau::utils::format("{}_{}", "fill_gbuffer", m_swapchain).c_str(), DABFG_PP_NODE_SRC,
                                                     [=, this](dabfg::Registry registry)
         {
@@ -59,7 +65,7 @@ namespace nau::render
                 m_gBuffer->setRt();
                 d3d::clearview(CLEAR_TARGET | CLEAR_STENCIL, nau::math::E3DCOLOR(0, 0, 0), 0, 0);
                 
-                const auto worldViewPos = math::Vector4(m_graphicsScene->getMainCamera().getProperties().getTranslation());
+                const auto worldViewPos = math::Vector4(m_graphicsScene->getMainCamera().worldPosition);
                 shader_globals::setVariable("worldViewPos", &worldViewPos);
 
                 m_graphicsScene->renderFrame(true);
@@ -80,52 +86,8 @@ namespace nau::render
                     return;
                 }
 
-                nau::CameraNode& camera = m_graphicsScene->getMainCamera();
-                nau::csm::CascadeShadows::ModeSettings mode;
-                mode.powWeight = 0.985;
-                mode.maxDist = camera.cameraProperties->getClipFarPlane();
-                mode.shadowStart = camera.cameraProperties->getClipNearPlane();
-                mode.numCascades = 4;
-
-                nau::math::Vector3 lightDir = nau::math::Vector3(1,1,1);
-
-                if (m_graphicsScene->hasDirectionalLight())
-                {
-                    auto light = m_graphicsScene->getDirectionalLights()[0];
-                    lightDir = -light.m_direction;
-                    mode.numCascades = std::min(light.m_csmCascadesCount, 4u);
-                    mode.powWeight = light.m_csmPowWeight;
-
-                    m_csm->setCascadeWidth(light.m_csmSize);
-
-                    if (!light.m_castShadows)
-                    {
-                        mode.numCascades = 0;
-                    }
-                }
-                else
-                {
-                    mode.numCascades = 0;
-                }
-
-                if (length(lightDir) > MATH_SMALL_NUMBER)
-                {
-                    lightDir = Vectormath::SSE::normalize(lightDir);
-                }
-
-                nau::math::Vector3 cameraPos = camera.worldPosition;
-                nau::math::Matrix4 view = camera.getViewMatrix();
-                nau::math::Matrix4 proj = camera.getProjMatrix();
-                nau::math::Matrix4 globtm = proj * view;
-
-                auto nearZ = camera.cameraProperties->getClipNearPlane();
-                auto farZ  = camera.cameraProperties->getClipFarPlane();
-                nau::math::NauFrustum frustum;
-                frustum.construct(globtm);
-
-                m_csm->prepareShadowCascades(mode, lightDir, view, cameraPos, proj, 
-                    frustum, nau::math::Vector2(nearZ, farZ), nearZ);
-
+                // The cascades are prepared by RenderWindowImpl::render(), before their views culling:
+                // only the cascades not kept from the previous frames are rendered.
                 m_csm->renderShadowsCascades();
 
                 BaseTexture* backBuf = d3d::get_back_buffer_rt(m_swapchain);
@@ -218,14 +180,34 @@ namespace nau::render
                     {
                         node.isDirty = false;
                         m_environmentRenderer->setPanoramaTexture(node.textureView);
+                        m_environmentRenderer->setPrefilteredMaps(node.irradianceView, node.reflectionView);
                     }
                 }
                 if (m_graphicsScene->hasCamera() && m_environmentRenderer->isEnvCubemapsDirty())
                 {
                     m_environmentRenderer->convertPanoramaToCubemap();
+                }
+            };
+        }));
 
-                    m_environmentRenderer->generateIrradianceMap();
-                    m_environmentRenderer->generateReflectionMap();
+        // The filtered maps are read by the next frame resolve only: the filtering overlaps the rest of the frame.
+        m_gBufferNodes.addNode(dabfg::register_node(nau::utils::format("{}_{}", "filter_env_cubemaps", m_swapchain).c_str(), DABFG_PP_NODE_SRC, [this](dabfg::Registry registry)
+        {
+            registry.orderMeAfter(nau::utils::format("{}_{}", "compute_env_cubemaps", m_swapchain).c_str());
+            registry.executionHas(dabfg::SideEffects::External);
+            registry.executeAsyncCompute();
+
+            return [this]()
+            {
+                if (m_graphicsScene->hasCamera() && m_environmentRenderer->isEnvCubemapsDirty())
+                {
+                    // The cooked maps replace the filtering: only the skybox cubemap is converted from the panorama.
+                    if (!m_environmentRenderer->hasPrefilteredMaps())
+                    {
+                        const GpuPipeline gpuPipeline = dabfg::current_gpu_pipeline();
+                        m_environmentRenderer->generateIrradianceMap(gpuPipeline);
+                        m_environmentRenderer->generateReflectionMap(gpuPipeline);
+                    }
 
                     m_environmentRenderer->setEnvCubemapsDirty(false);
                 }
@@ -0,0 +1,124 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "pick_readback_ring.h"
+
+#include "nau/3d/dag_drv3dCmd.h"
+#include "nau/3d/dag_drv3d_buffers.h"
+
+
+namespace nau::render
+{
+    PickReadbackRing::~PickReadbackRing()
+    {
+        for (Frame& frame : m_frames)
+        {
+            // The promises are dropped: their tasks are rejected.
+            frame.promises.clear();
+            if (frame.staging)
+            {
+                frame.staging->destroy();
+                frame.staging = nullptr;
+            }
+            if (frame.fence)
+            {
+                d3d::release_event_query(frame.fence);
+                frame.fence = nullptr;
+            }
+        }
+    }
+
+    bool PickReadbackRing::beginFrame()
+    {
+        NAU_ASSERT(m_recordedFrame < 0);
+
+        // The next frame after the newest one in flight, the ring is full when it is in flight too.
+        uint32_t frameIndex = m_oldestFrame;
+        for (uint32_t i = 0; i < FramesCount && m_frames[frameIndex].isInFlight; ++i)
+        {
+            frameIndex = (frameIndex + 1) % FramesCount;
+        }
+
+        Frame& frame = m_frames[frameIndex];
+        if (frame.isInFlight)
+        {
+            return false;
+        }
+
+        if (!frame.staging)
+        {
+            frame.staging = d3d::buffers::create_staging(sizeof(PixelData) * MaxPicksPerFrame, "pick readback staging buf");
+            frame.fence = d3d::create_event_query();
+        }
+        NAU_ASSERT_RETURN(frame.staging && frame.fence, false);
+
+        m_recordedFrame = static_cast<int>(frameIndex);
+        return true;
+    }
+
+    bool PickReadbackRing::isFrameFull() const
+    {
+        NAU_ASSERT(m_recordedFrame >= 0);
+        return m_frames[m_recordedFrame].promises.size() >= MaxPicksPerFrame;
+    }
+
+    void PickReadbackRing::addPick(Sbuffer* result, async::TaskSource<nau::Uid> promise)
+    {
+        NAU_ASSERT_RETURN(m_recordedFrame >= 0 && !isFrameFull());
+
+        Frame& frame = m_frames[m_recordedFrame];
+        const uint32_t offset = static_cast<uint32_t>(frame.promises.size() * sizeof(PixelData));
+        result->copyTo(frame.staging, offset, 0, sizeof(PixelData));
+        frame.promises.emplace_back(std::move(promise));
+    }
+
+    void PickReadbackRing::endFrame()
+    {
+        NAU_ASSERT_RETURN(m_recordedFrame >= 0);
+
+        Frame& frame = m_frames[m_recordedFrame];
+        if (!frame.promises.empty())
+        {
+            d3d::issue_event_query(frame.fence);
+            frame.isInFlight = true;
+        }
+
+        m_recordedFrame = -1;
+    }
+
+    void PickReadbackRing::resolveReady()
+    {
+        for (uint32_t i = 0; i < FramesCount; ++i)
+        {
+            Frame& frame = m_frames[m_oldestFrame];
+            if (!frame.isInFlight || !d3d::get_event_query_status(frame.fence, false))
+            {
+                return;
+            }
+
+            PixelData* data = nullptr;
+            const uint32_t size = static_cast<uint32_t>(frame.promises.size() * sizeof(PixelData));
+            if (frame.staging->lock(0, size, reinterpret_cast<void**>(&data), VBLOCK_READONLY) && data)
+            {
+                for (size_t pick = 0; pick < frame.promises.size(); ++pick)
+                {
+                    frame.promises[pick].resolve(data[pick].uid);
+                }
+                frame.staging->unlock();
+            }
+            else
+            {
+                for (auto& promise : frame.promises)
+                {
+                    promise.resolve(NullUid);
+                }
+            }
+
+            frame.promises.clear();
+            frame.isInFlight = false;
+            m_oldestFrame = (m_oldestFrame + 1) % FramesCount;
+        }
+    }
+
+}  // namespace nau::render
@@ -0,0 +1,65 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <EASTL/array.h>
+#include <EASTL/vector.h>
+
+#include "nau/3d/dag_drv3d.h"
+#include "nau/async/task_base.h"
+#include "nau/utils/uid.h"
+
+namespace nau::render
+{
+    /**
+     * The readback of the UID picking results without a GPU stall. The picks of a frame are copied into the staging buffer
+     * of that frame and fenced: their promises are resolved by a later frame, when the fence is passed.
+     */
+    class PickReadbackRing
+    {
+    public:
+        // Must match the result of the pixel data extraction shader.
+        struct PixelData
+        {
+            nau::Uid uid;
+            float depth;
+        };
+
+        static constexpr uint32_t FramesCount = 3;
+        static constexpr uint32_t MaxPicksPerFrame = 8;
+
+        PickReadbackRing() = default;
+        PickReadbackRing(const PickReadbackRing&) = delete;
+        ~PickReadbackRing();
+
+        PickReadbackRing& operator=(const PickReadbackRing&) = delete;
+
+        // Returns false when all the frames are still read back: the picks wait for the next frame.
+        bool beginFrame();
+        bool isFrameFull() const;
+        // Copies the pick result on the GPU, the promise is resolved with the uid once the copy is read.
+        void addPick(Sbuffer* result, async::TaskSource<nau::Uid> promise);
+        void endFrame();
+
+        // Resolves the picks of the frames the GPU has finished.
+        void resolveReady();
+
+    private:
+        struct Frame
+        {
+            Sbuffer* staging = nullptr;
+            D3dEventQuery* fence = nullptr;
+            eastl::vector<async::TaskSource<nau::Uid>> promises;
+            bool isInFlight = false;
+        };
+
+        eastl::array<Frame, FramesCount> m_frames;
+        // The recorded frame, -1 out of beginFrame() / endFrame().
+        int m_recordedFrame = -1;
+        // The oldest frame in flight: the frames are resolved in order.
+        uint32_t m_oldestFrame = 0;
+    };
+
+}  // namespace nau::render
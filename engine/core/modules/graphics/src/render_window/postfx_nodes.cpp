@@ -0,0 +1,75 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "nau/render/postFxComposer.h"
+#include "render/daBfg/bfg.h"
+#include "render_window_impl.h"
+
+namespace nau::render
+{
+    void RenderWindowImpl::createPostFxNodes()
+    {
+        m_postFxNodes.m_frameGraphNodes.clear();
+
+        const auto& passes = m_postFxComposer->getPasses();
+        for (uint32_t passIndex = 0; passIndex < passes.size(); ++passIndex)
+        {
+            const bool isLastPass = passIndex + 1 == passes.size();
+            // The last pass keeps the node name the other nodes are ordered after.
+            const eastl::string nodeName = isLastPass ? nau::utils::format("{}_{}", "post_fx_nodes", m_swapchain)
+                                                      : nau::utils::format("{}_{}_{}", "post_fx_pass", passIndex, m_swapchain);
+
+            m_postFxNodes.addNode(dabfg::register_node(nodeName.c_str(), DABFG_PP_NODE_SRC, [this, passIndex, isLastPass](dabfg::Registry registry)
+            {
+                const eastl::string sourceName = passIndex == 0 ? nau::utils::format("{}_{}", "resolve_texture", m_swapchain)
+                                                                : nau::utils::format("{}_{}_{}", "post_fx_target", passIndex - 1, m_swapchain);
+                auto sourceTexture = registry.readTexture(sourceName.c_str())
+                                         .atStage(dabfg::Stage::PS_OR_CS)
+                                         .useAs(dabfg::Usage::SHADER_RESOURCE)
+                                         .handle();
+
+                if (passIndex == 0)
+                {
+                    registry.orderMeAfter(nau::utils::format("{}_{}", "forward_translucent", m_swapchain).c_str());
+                }
+
+                if (isLastPass)
+                {
+                    registry.executionHas(dabfg::SideEffects::External);
+
+                    return eastl::function<void()>{[=, this]()
+                    {
+                        setRenderTarget();
+                        d3d::clearview(CLEAR_TARGET | CLEAR_ZBUFFER | CLEAR_STENCIL, nau::math::E3DCOLOR(0, 0, 0), 0, 0);
+                        d3d::set_srgb_backbuffer_write(true);
+
+                        m_postFxComposer->renderPass(m_postFxComposer->getPasses()[passIndex], const_cast<BaseTexture*>(sourceTexture.get()), nullptr);
+
+                        d3d::set_srgb_backbuffer_write(false);
+                    }};
+                }
+
+                // The intermediate targets are written by the fused compute passes and drawn by the others.
+                const bool isComputePass = m_postFxComposer->isComputePass(m_postFxComposer->getPasses()[passIndex]);
+                auto target = registry
+                                  .createTexture2d(nau::utils::format("{}_{}_{}", "post_fx_target", passIndex, m_swapchain).c_str(),
+                                                   dabfg::History::No,
+                                                   dabfg::Texture2dCreateInfo{TEXFMT_A16B16G16R16F | TEXCF_RTARGET | TEXCF_UNORDERED,
+                                                                              registry.getResolution(m_resolutionName.c_str())})
+                                  .atStage(isComputePass ? dabfg::Stage::COMPUTE : dabfg::Stage::POST_RASTER)
+                                  .useAs(isComputePass ? dabfg::Usage::SHADER_RESOURCE : dabfg::Usage::COLOR_ATTACHMENT)
+                                  .handle();
+
+                return eastl::function<void()>{[=, this]()
+                {
+                    m_postFxComposer->renderPass(m_postFxComposer->getPasses()[passIndex], const_cast<BaseTexture*>(sourceTexture.get()),
+                                                 const_cast<BaseTexture*>(target.get()));
+                }};
+            }));
+        }
+
+        m_postFxComposer->acceptLayout();
+    }
+
+}  // namespace nau::render
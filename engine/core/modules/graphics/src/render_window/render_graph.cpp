@@ -75,7 +75,7 @@ namespace nau::render
 
         BufferDesc buffDesc;
         buffDesc.name = u8"pixel_data_extraction_result_buffer";
-        buffDesc.elementSize = sizeof(PixelData);
+        buffDesc.elementSize = sizeof(PickReadbackRing::PixelData);
         buffDesc.elementCount = 1;
         buffDesc.flags = 0;
         buffDesc.format = 0;
@@ -102,7 +102,9 @@ namespace nau::render
             resizeResolutions();
         }
 
-        m_postFXRenderer = eastl::make_unique<render::PostFxRenderer>(matPPTonemap);
+        // The tonemap is not a stage of a composition material: it is a pass of its own.
+        m_postFxComposer = eastl::make_unique<render::PostFxComposer>();
+        m_postFxComposer->addEffect({.name = "tonemap", .material = matPPTonemap, .pipeline = "Regular"});
         m_outlineRenderer = eastl::make_unique<render::PostFxRenderer>(outlineTonemap);
 
         createGBufferNodes();
@@ -127,67 +129,114 @@ namespace nau::render
             };
         }));
 
-        m_uidNodes.addNode(dabfg::register_node(nau::utils::format("{}_{}", "pixel_extraction", m_swapchain).c_str(), DABFG_PP_NODE_SRC, [this](dabfg::Registry registry)
+        m_uidNodes.addNode(dabfg::register_node(nau::utils::format("{}_{}", "uid_pick", m_swapchain).c_str(), DABFG_PP_NODE_SRC, [this](dabfg::Registry registry)
         {
             registry.orderMeAfter(nau::utils::format("{}_{}", "billboard_render", m_swapchain).c_str());
-            registry.orderMeBefore(nau::utils::format("{}_{}", "grid_render", m_swapchain).c_str());
             registry.executionHas(dabfg::SideEffects::External);
 
-            auto uidTex = registry.readTexture(nau::utils::format("{}_{}", "uid_texture", m_swapchain).c_str())
-                              .atStage(dabfg::Stage::PS_OR_CS)
-                              .useAs(dabfg::Usage::SHADER_RESOURCE)
-                              .handle();
+            // The region around the picked pixels only, with its own depth: the scene targets are not involved.
+            const math::IVector2 regionSize{PickRegionSize, PickRegionSize};
+            auto uidTarget = registry
+                                 .createTexture2d(nau::utils::format("{}_{}", "uid_texture", m_swapchain).c_str(), dabfg::History::No,
+                                                  dabfg::Texture2dCreateInfo{TEXFMT_A32B32G32R32UI | TEXCF_RTARGET, regionSize})
+                                 .atStage(dabfg::Stage::POST_RASTER)
+                                 .useAs(dabfg::Usage::COLOR_ATTACHMENT)
+                                 .handle();
+            // The billboards write their color too.
+            auto colorTarget = registry
+                                   .createTexture2d(nau::utils::format("{}_{}", "uid_pick_color", m_swapchain).c_str(), dabfg::History::No,
+                                                    dabfg::Texture2dCreateInfo{TEXFMT_A8R8G8B8 | TEXCF_RTARGET, regionSize})
+                                   .atStage(dabfg::Stage::POST_RASTER)
+                                   .useAs(dabfg::Usage::COLOR_ATTACHMENT)
+                                   .handle();
+            auto depthTarget = registry
+                                   .createTexture2d(nau::utils::format("{}_{}", "uid_pick_depth", m_swapchain).c_str(), dabfg::History::No,
+                                                    dabfg::Texture2dCreateInfo{TEXFMT_DEPTH32 | TEXCF_RTARGET, regionSize})
+                                   .atStage(dabfg::Stage::POST_RASTER)
+                                   .useAs(dabfg::Usage::DEPTH_ATTACHMENT)
+                                   .handle();
 
-            return [this, uidTex]()
+            return [=, this]()
             {
-                for (auto& request : m_viewportRequests)
+                m_isPickRegionRendered = false;
+                if (m_viewportRequests.empty() || !m_graphicsScene->hasMainCamera())
                 {
-                    const auto viewportCoords = math::IVector2{request.viewportX, request.viewportY};
-                    shader_globals::setVariable("viewportCoords", &viewportCoords);
-
-                    m_pixelDataExtractionMaterial->setRoTexture("default", "UIDTexture", const_cast<BaseTexture*>(uidTex.get()));
-                    m_pixelDataExtractionMaterial->setRoTexture("default", "DepthTexture", m_gBuffer->getDepth());
-                    m_pixelDataExtractionMaterial->bind();
-                    m_pixelDataExtractionMaterial->dispatch(1, 1, 1);
-
-                    PixelData data;
-                    m_pixelDataExtractionMaterial->readRwBuffer("default", "ResultBuffer", &data, sizeof(PixelData));
-
-                    request.promise.resolve(data.uid);
+                    return;
                 }
 
-                m_viewportRequests.clear();
+                // The region is centered on the first request, the requests out of it wait for the next frames.
+                const VieportObjectRequest& request = m_viewportRequests.front();
+                const math::IVector2 pixel = toRenderCoords(request.viewportX, request.viewportY);
+                m_pickRegionOrigin = math::IVector2{
+                    eastl::clamp(pixel.getX() - PickRegionSize / 2, 0, eastl::max(m_renderWidth - PickRegionSize, 0)),
+                    eastl::clamp(pixel.getY() - PickRegionSize / 2, 0, eastl::max(m_renderHeight - PickRegionSize, 0))};
+                const math::Matrix4 regionCrop = makePickRegionCrop(m_pickRegionOrigin);
+
+                d3d::set_render_target();
+                d3d::set_render_target(0, const_cast<BaseTexture*>(uidTarget.get()), 0);
+                d3d::set_depth(const_cast<BaseTexture*>(depthTarget.get()), DepthAccess::RW);
+                d3d::clearview(CLEAR_TARGET | CLEAR_ZBUFFER | CLEAR_STENCIL, nau::math::E3DCOLOR(0, 0, 0, 0), 0, 0);
+                m_graphicsScene->renderPickDepth(regionCrop);
+
+                d3d::set_render_target(0, const_cast<BaseTexture*>(colorTarget.get()), 0);
+                d3d::set_render_target(1, const_cast<BaseTexture*>(uidTarget.get()), 0);
+                m_graphicsScene->renderPickBillboards(regionCrop);
+
+                d3d::set_render_target();
+                d3d::set_depth(nullptr, DepthAccess::RW);
+                m_isPickRegionRendered = true;
             };
         }));
 
-        m_postFxNodes.addNode(
-            dabfg::register_node(nau::utils::format("{}_{}", "post_fx_nodes", m_swapchain).c_str(), DABFG_PP_NODE_SRC, [this](dabfg::Registry registry)
+        m_uidNodes.addNode(dabfg::register_node(nau::utils::format("{}_{}", "pixel_extraction", m_swapchain).c_str(), DABFG_PP_NODE_SRC, [this](dabfg::Registry registry)
         {
-            auto resolveTexture = registry.readTexture(nau::utils::format("{}_{}", "resolve_texture", m_swapchain).c_str())
-                                      .atStage(dabfg::Stage::PS_OR_CS)
-                                      .useAs(dabfg::Usage::SHADER_RESOURCE)
-                                      .handle();
-
-            registry.orderMeAfter(nau::utils::format("{}_{}", "forward_translucent", m_swapchain).c_str());
+            registry.orderMeBefore(nau::utils::format("{}_{}", "grid_render", m_swapchain).c_str());
             registry.executionHas(dabfg::SideEffects::External);
 
-            return [=, this]()
+            auto uidTex = registry.readTexture(nau::utils::format("{}_{}", "uid_texture", m_swapchain).c_str())
+                              .atStage(dabfg::Stage::PS_OR_CS)
+                              .useAs(dabfg::Usage::SHADER_RESOURCE)
+                              .handle();
+            auto depthTex = registry.readTexture(nau::utils::format("{}_{}", "uid_pick_depth", m_swapchain).c_str())
+                                .atStage(dabfg::Stage::PS_OR_CS)
+                                .useAs(dabfg::Usage::SHADER_RESOURCE)
+                                .handle();
+
+            return [this, uidTex, depthTex]()
             {
-                setRenderTarget();
-                d3d::clearview(CLEAR_TARGET | CLEAR_ZBUFFER | CLEAR_STENCIL, nau::math::E3DCOLOR(0, 0, 0), 0, 0);
-                d3d::set_srgb_backbuffer_write(true);
+                if (!m_isPickRegionRendered || !m_pickReadbacks.beginFrame())
+                {
+                    return;
+                }
+
+                m_pixelDataExtractionMaterial->setRoTexture("default", "UIDTexture", const_cast<BaseTexture*>(uidTex.get()));
+                m_pixelDataExtractionMaterial->setRoTexture("default", "DepthTexture", const_cast<BaseTexture*>(depthTex.get()));
+                Sbuffer* const result = m_pixelDataExtractionMaterial->getRwBuffer("default", "ResultBuffer");
 
-                d3d::settex(0, const_cast<BaseTexture*>(resolveTexture.get()));
+                // The results are read back by the later frames, see PickReadbackRing.
+                eastl::erase_if(m_viewportRequests, [this, result](VieportObjectRequest& request)
+                {
+                    const math::IVector2 regionCoords = toRenderCoords(request.viewportX, request.viewportY) - m_pickRegionOrigin;
+                    const bool isInRegion = regionCoords.getX() >= 0 && regionCoords.getX() < PickRegionSize &&
+                                            regionCoords.getY() >= 0 && regionCoords.getY() < PickRegionSize;
+                    if (!isInRegion || m_pickReadbacks.isFrameFull())
+                    {
+                        return false;
+                    }
+
+                    shader_globals::setVariable("viewportCoords", &regionCoords);
+                    m_pixelDataExtractionMaterial->bind();
+                    m_pixelDataExtractionMaterial->dispatch(1, 1, 1);
 
-                m_postFXRenderer->render("Regular");
-                // m_postFXRenderer->render("Uncharted");
-                // m_postFXRenderer->render("Filmic");
-                // m_postFXRenderer->render("Reinhard");
+                    m_pickReadbacks.addPick(result, std::move(request.promise));
+                    return true;
+                });
 
-                d3d::set_srgb_backbuffer_write(false);
+                m_pickReadbacks.endFrame();
             };
         }));
 
+        createPostFxNodes();
 
         m_uidNodes.addNode(
             dabfg::register_node(nau::utils::format("{}_{}", "billboard_render", m_swapchain).c_str(), DABFG_PP_NODE_SRC, [this](dabfg::Registry registry)
@@ -195,16 +244,10 @@ namespace nau::render
             registry.orderMeAfter(nau::utils::format("{}_{}", "post_fx_nodes", m_swapchain).c_str());
             registry.executionHas(dabfg::SideEffects::External);
 
-            auto uidTarget = registry.readTexture(nau::utils::format("{}_{}", "uid_texture", m_swapchain).c_str())
-                  .atStage(dabfg::Stage::PS_OR_CS)
-                  .useAs(dabfg::Usage::SHADER_RESOURCE)
-                  .handle();
-
             return [=, this]()
             {
                 setRenderTarget();
                 d3d::set_depth(m_gBuffer->getDepth(), DepthAccess::RW);
-                d3d::set_render_target(1, const_cast<BaseTexture*>(uidTarget.get()), 0);
                 m_graphicsScene->renderBillboards();
             };
         }));
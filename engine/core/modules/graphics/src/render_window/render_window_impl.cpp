@@ -4,8 +4,15 @@
 
 #include "render_window_impl.h"
 
+#include <EASTL/fixed_vector.h>
+
+#include <cmath>
+
+#include "nau/app/global_properties.h"
+#include "nau/async/parallel_for.h"
 #include "nau/graphics/core_graphics.h"
 #include "nau/input.h"
+#include "nau/service/service_provider.h"
 
 namespace nau::render
 {
@@ -44,9 +51,11 @@ namespace nau::render
     {
         d3d::set_screen_size(m_width, m_height, m_swapchain);
 
-        dabfg::set_resolution(m_resolutionName.c_str(), {m_width, m_height});
         dabfg::set_resolution(m_displayName.c_str(), {m_width, m_height});
-        m_gBuffer->changeResolution(m_width, m_height);
+
+        m_renderWidth = 0;
+        m_renderHeight = 0;
+        updateRenderResolution();
 
         if (m_swapchain == DEFAULT_SWAPID)
         {
@@ -54,6 +63,31 @@ namespace nau::render
         }
     }
 
+    void RenderWindowImpl::updateRenderResolution()
+    {
+        // The billboards, the grid and the debug draws test the viewport size targets against the g-buffer depth:
+        // the scene is rendered at the viewport resolution while they are drawn.
+        const bool hasViewportDepthPasses = m_uidNodes.m_isEnabled || m_debugNodes.m_isEnabled;
+        const float scale = hasViewportDepthPasses ? 1.f : m_resolutionScale;
+
+        const int32_t width = eastl::max(static_cast<int32_t>(std::lround(m_width * scale)), 1);
+        const int32_t height = eastl::max(static_cast<int32_t>(std::lround(m_height * scale)), 1);
+        if (width == m_renderWidth && height == m_renderHeight)
+        {
+            return;
+        }
+
+        m_renderWidth = width;
+        m_renderHeight = height;
+        dabfg::set_resolution(m_resolutionName.c_str(), {width, height});
+        m_gBuffer->changeResolution(width, height);
+    }
+
+    void RenderWindowImpl::setResolutionScale(float scale)
+    {
+        m_resolutionScale = scale;
+    }
+
     void RenderWindowImpl::getViewportSize(int32_t& width, int32_t& height)
     {
         lock_(m_readWriteMutex);
@@ -92,6 +126,15 @@ namespace nau::render
 
     void RenderWindowImpl::render()
     {
+        // The picks of the frames the GPU has finished.
+        m_pickReadbacks.resolveReady();
+
+        // The passes of the toggled post effects are new nodes: the render graph is recompiled.
+        if (m_postFxComposer && m_postFxComposer->isLayoutChanged())
+        {
+            createPostFxNodes();
+        }
+
         for (auto& [_, nodeGroup] : m_graphStages)
         {
             nodeGroup.resetState();
@@ -119,18 +162,36 @@ namespace nau::render
         {
             if(m_graphicsScene->hasMainCamera())
             {
-                nau::math::Matrix4 vp = m_graphicsScene->getMainCamera().getProjMatrix() * m_graphicsScene->getMainCamera().getViewMatrix();
+                // The cascades of this frame are known before the views culling.
+                prepareShadowCascades();
+
+                const auto& camera = m_graphicsScene->getMainCamera();
+                const nau::math::Matrix4 proj = camera.getProjMatrix();
+                nau::math::Matrix4 vp = proj * camera.getViewMatrix();
                 for (auto& view : m_graphicsScene->getRenderScene()->getViews())
                 {
+                    // The shadow views select the camera lods too: the shadows match the drawn meshes.
+                    view->setLodView(camera.worldPosition, proj.getCol1().getY());
+
                     if (view->containsTag(nau::RenderScene::Tags::shadowCascadeTag))
                     {
                         int cascade = (int)view->getUserData();
                         NAU_ASSERT(cascade < nau::csm::CascadeShadows::MAX_CASCADES);
-                        view->updateFrustum(m_csm->getWorldRenderMatrix(cascade));
+
+                        // The kept (sparse) cascades are not rendered: their casters are not culled either.
+                        const bool isRendered = cascade < m_csm->getNumCascadesToRender() && m_csm->shouldUpdateCascade(cascade);
+                        view->setActive(isRendered);
+                        if (isRendered)
+                        {
+                            view->updateFrustum(m_csm->getCasterCullingFrustum(cascade));
+                        }
                     }
                     else
                     {
                         view->updateFrustum(vp);
+                        // The camera views drive the texture streaming: (proj[0][0] * width)^2, see TexStreamingContext.
+                        const float texelsScale = proj.getCol0().getX() * static_cast<float>(m_renderWidth);
+                        view->setTexStreaming(TexStreamingContext(texelsScale * texelsScale));
                     }
                 }
                 m_graphicsScene->getRenderScene()->updateViews(vp);
@@ -146,6 +207,10 @@ namespace nau::render
                 resizeResolutions();
                 m_resizeFrameCounter = NO_RESIZE_REQUESTED;
             }
+            else
+            {
+                updateRenderResolution();
+            }
 
             if (m_resizeFrameCounter != NO_RESIZE_REQUESTED)
             {
@@ -154,6 +219,55 @@ namespace nau::render
         }
     }
 
+    void RenderWindowImpl::prepareShadowCascades()
+    {
+        nau::CameraNode& camera = m_graphicsScene->getMainCamera();
+        nau::csm::CascadeShadows::ModeSettings mode;
+        mode.powWeight = 0.985;
+        mode.maxDist = camera.clipFarPlane;
+        mode.shadowStart = camera.clipNearPlane;
+        mode.numCascades = 4;
+
+        nau::math::Vector3 lightDir = nau::math::Vector3(1,1,1);
+
+        if (m_graphicsScene->hasDirectionalLight())
+        {
+            auto light = m_graphicsScene->getDirectionalLights()[0];
+            lightDir = -light.m_direction;
+            mode.numCascades = std::min(light.m_csmCascadesCount, 4u);
+            mode.powWeight = light.m_csmPowWeight;
+
+            m_csm->setCascadeWidth(light.m_csmSize);
+
+            if (!light.m_castShadows)
+            {
+                mode.numCascades = 0;
+            }
+        }
+        else
+        {
+            mode.numCascades = 0;
+        }
+
+        if (length(lightDir) > MATH_SMALL_NUMBER)
+        {
+            lightDir = Vectormath::SSE::normalize(lightDir);
+        }
+
+        nau::math::Vector3 cameraPos = camera.worldPosition;
+        nau::math::Matrix4 view = camera.getViewMatrix();
+        nau::math::Matrix4 proj = camera.getProjMatrix();
+        nau::math::Matrix4 globtm = proj * view;
+
+        auto nearZ = camera.clipNearPlane;
+        auto farZ  = camera.clipFarPlane;
+        nau::math::NauFrustum frustum;
+        frustum.construct(globtm);
+
+        m_csm->prepareShadowCascades(mode, lightDir, view, cameraPos, proj,
+            frustum, nau::math::Vector2(nearZ, farZ), nearZ);
+    }
+
     void RenderWindowImpl::setRenderScene(eastl::shared_ptr<GraphicsScene> gScene)
     {
         m_graphicsScene = gScene;
@@ -180,6 +294,28 @@ namespace nau::render
         co_return result;
     }
 
+    math::IVector2 RenderWindowImpl::toRenderCoords(int32_t viewportX, int32_t viewportY) const
+    {
+        return math::IVector2{
+            static_cast<int32_t>(static_cast<int64_t>(viewportX) * m_renderWidth / eastl::max(m_width, 1)),
+            static_cast<int32_t>(static_cast<int64_t>(viewportY) * m_renderHeight / eastl::max(m_height, 1))};
+    }
+
+    math::Matrix4 RenderWindowImpl::makePickRegionCrop(const math::IVector2& origin) const
+    {
+        // Scales the clip space about the region center, so the region fills [-1, 1].
+        const float scaleX = static_cast<float>(m_renderWidth) / PickRegionSize;
+        const float scaleY = static_cast<float>(m_renderHeight) / PickRegionSize;
+        const float centerX = 2.f * (origin.getX() + PickRegionSize * 0.5f) / m_renderWidth - 1.f;
+        const float centerY = 1.f - 2.f * (origin.getY() + PickRegionSize * 0.5f) / m_renderHeight;
+
+        return math::Matrix4{
+            math::Vector4{scaleX, 0.f, 0.f, 0.f},
+            math::Vector4{0.f, scaleY, 0.f, 0.f},
+            math::Vector4{0.f, 0.f, 1.f, 0.f},
+            math::Vector4{-scaleX * centerX, -scaleY * centerY, 0.f, 1.f}};
+    }
+
     void RenderWindowImpl::setWorkQueue(WorkQueue::Ptr workQueue)
     {
         m_preRenderWorkQueueRef = std::move(workQueue);
@@ -247,6 +383,17 @@ namespace nau::render
         nau::csm::CascadeShadows::Settings csmSettings;
         csmSettings.cascadeWidth = 1024;
         csmSettings.splitsW = csmSettings.splitsH = 2;
+
+        // The distant cascades are cached: "/graphics/csmSparseDistance" is where they start,
+        // "/graphics/csmSparseFramePeriod" is how often they are redrawn when nothing forces it.
+        csmSettings.minimalSparseDistance = 50.f;
+        csmSettings.minimalSparseFrame = 8.f;
+        if (getServiceProvider().has<GlobalProperties>())
+        {
+            auto& properties = getServiceProvider().get<GlobalProperties>();
+            csmSettings.minimalSparseDistance = properties.getValue<float>("/graphics/csmSparseDistance").value_or(csmSettings.minimalSparseDistance);
+            csmSettings.minimalSparseFrame = properties.getValue<float>("/graphics/csmSparseFramePeriod").value_or(csmSettings.minimalSparseFrame);
+        }
         m_csm.reset(nau::csm::CascadeShadows::make(this, csmSettings));
     }
 
@@ -256,6 +403,7 @@ namespace nau::render
     }
     void RenderWindowImpl::GraphNodes::addNode(dabfg::NodeHandle&& node)
     {
+        dabfg::set_node_enabled(node, m_isAppliedEnabled);
         m_frameGraphNodes.emplace_back(std::move(node));
     }
 
@@ -267,6 +415,12 @@ namespace nau::render
 
     void RenderWindowImpl::GraphNodes::disableNodesWeak()
     {
+        if (!m_isAppliedEnabled)
+        {
+            return;
+        }
+
+        m_isAppliedEnabled = false;
         for (auto& nodeId : m_frameGraphNodes)
         {
             dabfg::set_node_enabled(nodeId, false);
@@ -275,6 +429,12 @@ namespace nau::render
 
     void RenderWindowImpl::GraphNodes::resetState()
     {
+        if (m_isAppliedEnabled == m_isEnabled)
+        {
+            return;
+        }
+
+        m_isAppliedEnabled = m_isEnabled;
         for (auto& nodeId : m_frameGraphNodes)
         {
             dabfg::set_node_enabled(nodeId, m_isEnabled);
@@ -283,13 +443,43 @@ namespace nau::render
 
 
 
+    void RenderWindowImpl::prepareRenderShadowCascades()
+    {
+        // Only the rendered cascades are active (see render()): their draws are independent and are recorded in parallel.
+        eastl::fixed_vector<RenderView*, nau::csm::CascadeShadows::MAX_CASCADES, false> cascadeViews;
+        for (auto& view : m_graphicsScene->getRenderScene()->getViews())
+        {
+            if (view->containsTag(nau::RenderScene::Tags::shadowCascadeTag) && view->isActive())
+            {
+                cascadeViews.push_back(view.get());
+            }
+        }
+
+        MaterialAssetView* const zPrepassMat = m_graphicsScene->getRenderScene()->getZPrepassMaterial().get();
+        async::parallelFor(cascadeViews.size(), 1, [&](size_t viewIndex)
+        {
+            RenderView& view = *cascadeViews[viewIndex];
+            const int cascade = int(view.getUserData());
+            m_cascadePasses[cascade] = view.recordZPrepass(m_csm->getWorldRenderMatrix(cascade), zPrepassMat);
+        });
+    }
+
     void RenderWindowImpl::renderCascadeShadowDepth(int cascade, const nau::math::Vector2 &znzf)
     {
         for (auto& view : m_graphicsScene->getRenderScene()->getViews())
         {
             if (view->containsTag(nau::RenderScene::Tags::shadowCascadeTag) && cascade == int(view->getUserData()))
             {
-                view->renderZPrepass(m_csm->getWorldRenderMatrix(cascade), m_graphicsScene->getRenderScene()->getZPrepassMaterial().get());
+                RecordedPass& pass = m_cascadePasses[cascade];
+                if (pass.material)
+                {
+                    view->submitZPrepass(pass);
+                    pass = {};
+                }
+                else
+                {
+                    view->renderZPrepass(m_csm->getWorldRenderMatrix(cascade), m_graphicsScene->getRenderScene()->getZPrepassMaterial().get());
+                }
                 return;
             }
         }
@@ -323,8 +513,21 @@ namespace nau::render
 
     void RenderWindowImpl::getCascadeShadowSparseUpdateParams(int cascade_no, const nau::math::NauFrustum& cascade_frustum, float& out_min_sparse_dist, int& out_min_sparse_frame)
     {
-        out_min_sparse_dist = 100000;
-        out_min_sparse_frame = -1000;
+        const nau::csm::CascadeShadows::Settings& settings = m_csm->getSettings();
+        out_min_sparse_dist = settings.minimalSparseDistance;
+        out_min_sparse_frame = static_cast<int>(settings.minimalSparseFrame);
+    }
+
+    bool RenderWindowImpl::isCascadeShadowCastersChanged(int cascade_no, const nau::math::NauFrustum& caster_frustum)
+    {
+        for (const nau::math::BSphere3& changedCaster : m_graphicsScene->getRenderScene()->getShadowCasterChanges())
+        {
+            if (caster_frustum.testSphere(changedCaster) != 0)
+            {
+                return true;
+            }
+        }
+        return false;
     }
 
 }  // namespace nau::render
@@ -4,14 +4,19 @@
 
 #pragma once
 
+#include <EASTL/array.h>
+
 #include "graphics_nodes.h"
 #include "graphics_scene.h"
+#include "pick_readback_ring.h"
 #include "nau/async/work_queue.h"
 #include "nau/math/dag_color.h"
 #include "nau/render/deferredRenderer.h"
 #include "nau/render/environmentRenderer.h"
+#include "nau/render/postFxComposer.h"
 #include "nau/render/render_window.h"
 #include "render/daBfg/bfg.h"
+#include "render_pipeline/render_view.h"
 
 namespace nau
 {
@@ -47,7 +52,9 @@ namespace nau::render
         // Inherited via ICascadeShadowsClient
         void getCascadeShadowAnchorPoint(float cascade_from, nau::math::Vector3& out_anchor) override;
         void getCascadeShadowSparseUpdateParams(int cascade_no, const nau::math::NauFrustum& cascade_frustum, float& out_min_sparse_dist, int& out_min_sparse_frame) override;
+        void prepareRenderShadowCascades() override;
         void renderCascadeShadowDepth(int cascade, const nau::math::Vector2 &znzf) override;
+        bool isCascadeShadowCastersChanged(int cascade_no, const nau::math::NauFrustum& caster_frustum) override;
 
     public:
         void setWorkQueue(WorkQueue::Ptr workQueue);
@@ -69,11 +76,26 @@ namespace nau::render
 
         void setRenderScene(eastl::shared_ptr<GraphicsScene> gScene);
 
+        /**
+         * @brief Sets the scale of the scene render resolution to the viewport one (see DynamicResolution).
+         *
+         * The post effects stretch the scene to the viewport. Applied with the next render().
+         */
+        void setResolutionScale(float scale);
+
     private:
         void createGBufferNodes();
         void createOutlineNodes();
+        void createPostFxNodes();
 
         void resizeResolutions();
+        void updateRenderResolution();
+        void prepareShadowCascades();
+
+        // The viewport pixel to the scene resolution.
+        math::IVector2 toRenderCoords(int32_t viewportX, int32_t viewportY) const;
+        // Maps the pick region at the origin (in the scene resolution) to the whole pick targets.
+        math::Matrix4 makePickRegionCrop(const math::IVector2& origin) const;
 
     private:
         void setName(eastl::string_view name);
@@ -84,6 +106,8 @@ namespace nau::render
             eastl::vector<dabfg::NodeHandle> m_frameGraphNodes;
 
             bool m_isEnabled = true;
+            // The state last passed to the nodes: the unchanged state is not applied again each frame.
+            bool m_isAppliedEnabled = true;
 
             void resetState();
 
@@ -119,7 +143,7 @@ namespace nau::render
         nau::Uid m_world = nau::NullUid;
         eastl::shared_ptr<GraphicsScene> m_graphicsScene = nullptr;
 
-        eastl::unique_ptr<render::PostFxRenderer> m_postFXRenderer;
+        eastl::unique_ptr<render::PostFxComposer> m_postFxComposer;
         eastl::unique_ptr<render::EnvironmentRenderer> m_environmentRenderer;
 
         void* m_windowHandle;
@@ -142,13 +166,12 @@ namespace nau::render
             nau::async::TaskSource<nau::Uid> promise;
         };
 
-        struct PixelData
-        {
-            nau::Uid uid;
-            float depth;
-        };
-
         eastl::vector<VieportObjectRequest> m_viewportRequests;
+        PickReadbackRing m_pickReadbacks;
+        // The requests are answered by rendering the ids of a PickRegionSize square of the scene around them.
+        static constexpr int32_t PickRegionSize = 32;
+        math::IVector2 m_pickRegionOrigin{0, 0};
+        bool m_isPickRegionRendered = false;
         MaterialAssetView::Ptr m_pixelDataExtractionMaterial;
 
         MaterialAssetView::Ptr m_gridMaterial;
@@ -159,9 +182,15 @@ namespace nau::render
         eastl::unique_ptr<render::PostFxRenderer> m_outlineRenderer;
 
         eastl::shared_ptr<nau::csm::CascadeShadows> m_csm;
+        // The depth passes of the rendered cascades, recorded in parallel and submitted by renderCascadeShadowDepth().
+        eastl::array<RecordedPass, nau::csm::CascadeShadows::MAX_CASCADES> m_cascadePasses;
         
         int32_t m_width;
         int32_t m_height;
+        // The scene resolution: the g-buffer and the targets of m_resolutionName.
+        float m_resolutionScale = 1.f;
+        int32_t m_renderWidth = 0;
+        int32_t m_renderHeight = 0;
 
         static constexpr int REQUEST_RESIZE = 5; // Wait 5 frames before actual
         static constexpr int PERFORM_RESIZE = 0;
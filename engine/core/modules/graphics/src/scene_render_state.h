@@ -0,0 +1,218 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <EASTL/optional.h>
+#include <EASTL/variant.h>
+#include <EASTL/vector.h>
+
+#include <mutex>
+
+#include "graphics_assets/material_asset.h"
+#include "graphics_assets/texture_asset.h"
+#include "graphics_nodes.h"
+#include "nau/math/math.h"
+#include "render/lights/clusteredLights.h"
+
+namespace nau
+{
+    /**
+     * The state of the static mesh component captured by the scene sync (the component's dirty flags are consumed by the capture).
+     */
+    struct StaticMeshProxy
+    {
+        Uid componentUid;
+        uint32_t dirtyFlags = 0;
+        math::Transform worldTransform;
+        bool isVisible = true;
+        bool castShadow = true;
+        bool isOccluder = false;
+        eastl::optional<MaterialAssetRef> materialOverride;
+    };
+
+    /**
+     * The skinned mesh transform and its skeleton pose (the bones are empty if the pose was not finalized).
+     */
+    struct SkinnedMeshProxy
+    {
+        Uid componentUid;
+        math::Matrix4 worldTransform;
+        bool isPoseFinalized = false;
+        eastl::vector<math::Matrix4> modelSpaceJoints;
+        eastl::vector<math::Matrix4> inverseBindTransforms;
+        eastl::optional<MaterialAssetRef> materialOverride;
+    };
+
+    SkinnedMeshProxy makeSkinnedMeshProxy(const scene::SceneComponent& sceneComponent, const SkeletonComponent& skeletonComponent);
+
+    struct BillboardProxy
+    {
+        Uid componentUid;
+        math::Matrix4 worldTransform;
+        float screenPercentageSize = 0.f;
+        bool isVisible = true;
+        eastl::optional<TextureAssetRef> overrideTexture;
+    };
+
+    struct LightProxy
+    {
+        Uid componentUid;
+        math::Matrix4 worldTransform;
+        eastl::variant<render::ClusteredLights::OmniLight, render::ClusteredLights::SpotLight> light;
+    };
+
+    struct EnvironmentProxy
+    {
+        Uid componentUid;
+        float envIntensity = 1.0f;
+        eastl::optional<TextureAssetRef> newTextureRef;
+        TextureAssetRef irradianceRef;
+        TextureAssetRef reflectionRef;
+    };
+
+    /**
+     * The scene state captured on the game side (by GraphicsScene::syncSceneState) and applied by the render (GraphicsScene::latchSceneState).
+     * The render reads only the applied copy, so the next frame state can be captured while the current one is being rendered.
+     */
+    struct SceneRenderState
+    {
+        // Only the changed static meshes are captured
+        eastl::vector<StaticMeshProxy> staticMeshes;
+        eastl::vector<SkinnedMeshProxy> skinnedMeshes;
+        eastl::vector<BillboardProxy> billboards;
+        eastl::vector<LightProxy> lights;
+        eastl::vector<DirectionalLightNode> directionalLights;
+        eastl::optional<EnvironmentProxy> environment;
+        eastl::vector<CameraNode> cameras;
+        Uid mainCameraUid = NullUid;
+
+        void reset();
+
+        /**
+         * Merges the newer state into the state that has not been latched yet:
+         * the incremental changes (static meshes, dirty assets) are accumulated, everything else is replaced.
+         */
+        void append(SceneRenderState&& newer);
+    };
+
+    /**
+     * Triple buffered render proxies.
+     * The producer (game side) fills the write slot and publishes it, the consumer (render side) latches the most recently published slot.
+     * Neither side waits for the other: if the published slot was not latched yet, the newer state is appended to it (see T::append).
+     */
+    template <typename T>
+    class RenderProxyBuffer
+    {
+    public:
+        /**
+         * Resets and returns the producer slot.
+         */
+        T& beginWrite()
+        {
+            m_write.reset();
+            return m_write;
+        }
+
+        void publish()
+        {
+            const std::lock_guard lock(m_mutex);
+            if (m_hasPublished)
+            {
+                m_published.append(std::move(m_write));
+            }
+            else
+            {
+                eastl::swap(m_published, m_write);
+                m_hasPublished = true;
+            }
+        }
+
+        /**
+         * Makes the most recently published state current for the consumer.
+         * @return false if nothing was published since the previous latch.
+         */
+        bool latch()
+        {
+            const std::lock_guard lock(m_mutex);
+            if (!m_hasPublished)
+            {
+                return false;
+            }
+
+            eastl::swap(m_current, m_published);
+            m_hasPublished = false;
+            return true;
+        }
+
+        T& getCurrent()
+        {
+            return m_current;
+        }
+
+    private:
+        std::mutex m_mutex;
+        T m_write;
+        T m_published;
+        T m_current;
+        bool m_hasPublished = false;
+    };
+
+    inline void SceneRenderState::reset()
+    {
+        staticMeshes.clear();
+        skinnedMeshes.clear();
+        billboards.clear();
+        lights.clear();
+        directionalLights.clear();
+        environment.reset();
+        cameras.clear();
+        mainCameraUid = NullUid;
+    }
+
+    inline void SceneRenderState::append(SceneRenderState&& newer)
+    {
+        staticMeshes.insert(staticMeshes.end(), eastl::make_move_iterator(newer.staticMeshes.begin()), eastl::make_move_iterator(newer.staticMeshes.end()));
+
+        // The dirty assets are taken from the component once, so they must survive the replacement
+        const auto keepOverride = []<typename Proxy, typename Value>(const eastl::vector<Proxy>& older, eastl::vector<Proxy>& replacement, eastl::optional<Value> Proxy::*field)
+        {
+            for (const Proxy& olderProxy : older)
+            {
+                if (!(olderProxy.*field))
+                {
+                    continue;
+                }
+
+                auto proxy = eastl::find_if(replacement.begin(), replacement.end(), [&olderProxy](const Proxy& p)
+                {
+                    return p.componentUid == olderProxy.componentUid;
+                });
+
+                if (proxy != replacement.end() && !((*proxy).*field))
+                {
+                    (*proxy).*field = olderProxy.*field;
+                }
+            }
+        };
+
+        keepOverride(skinnedMeshes, newer.skinnedMeshes, &SkinnedMeshProxy::materialOverride);
+        keepOverride(billboards, newer.billboards, &BillboardProxy::overrideTexture);
+        if (environment && environment->newTextureRef && newer.environment && !newer.environment->newTextureRef)
+        {
+            newer.environment->newTextureRef = environment->newTextureRef;
+            newer.environment->irradianceRef = environment->irradianceRef;
+            newer.environment->reflectionRef = environment->reflectionRef;
+        }
+
+        skinnedMeshes = std::move(newer.skinnedMeshes);
+        billboards = std::move(newer.billboards);
+        lights = std::move(newer.lights);
+        directionalLights = std::move(newer.directionalLights);
+        environment = std::move(newer.environment);
+        cameras = std::move(newer.cameras);
+        mainCameraUid = newer.mainCameraUid;
+    }
+
+}  // namespace nau
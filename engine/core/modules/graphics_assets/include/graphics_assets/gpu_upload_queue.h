@@ -0,0 +1,154 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <EASTL/span.h>
+#include <EASTL/unique_ptr.h>
+#include <EASTL/vector.h>
+
+#include <mutex>
+
+#include "nau/3d/dag_drv3d.h"
+#include "nau/assets/texture_asset_accessor.h"
+#include "nau/async/task.h"
+#include "nau/rtti/rtti_impl.h"
+#include "nau/service/service.h"
+
+namespace nau
+{
+    class GpuUploadQueue;
+
+    /**
+     * @brief The copies of one asset, staged by the loading thread and submitted to the GpuUploadQueue at once.
+     *
+     * The data is copied into the staging pages of the queue when it is staged: the source may be released right after.
+     */
+    class NAU_GRAPHICSASSETS_EXPORT GpuUploadBatch
+    {
+    public:
+        GpuUploadBatch() = default;
+        GpuUploadBatch(GpuUploadBatch&&) = default;
+        GpuUploadBatch& operator=(GpuUploadBatch&&) = default;
+        ~GpuUploadBatch();
+
+        /**
+         * @brief Reserves the staging of the texture mips [firstMip, firstMip + mipsCount) and returns their destinations.
+         *
+         * The rows are tightly packed: the destinations are filled with ITextureAssetAccessor::copyTextureData().
+         */
+        eastl::span<DestTextureData> stageTexture(BaseTexture* texture, uint32_t firstMip, uint32_t mipsCount);
+
+        void stageBuffer(Sbuffer* buffer, uint32_t offset, const void* data, uint32_t size);
+
+        bool isEmpty() const
+        {
+            return m_copies.empty();
+        }
+
+    private:
+        friend class GpuUploadQueue;
+
+        struct Copy
+        {
+            BaseTexture* texture = nullptr;
+            Sbuffer* buffer = nullptr;
+            // The texture mip or the buffer offset.
+            uint32_t destination = 0;
+            const std::byte* data = nullptr;
+            uint32_t rowsCount = 0;
+            uint32_t rowBytes = 0;
+        };
+
+        struct Page;
+
+        std::byte* allocate(size_t size);
+
+        GpuUploadQueue* m_queue = nullptr;
+        eastl::vector<Copy> m_copies;
+        eastl::vector<DestTextureData> m_textureDestinations;
+        eastl::vector<Page*> m_pages;
+        size_t m_pageOffset = 0;
+        size_t m_bytesCount = 0;
+    };
+
+    /**
+     * @brief Batches the texture and buffer uploads of the loading threads into one submission per frame.
+     *
+     * The loading threads stage their data into the persistent staging pages and submit the batches.
+     * The render thread copies the batches of a frame with the discard locks: the driver records them into the
+     * upload (copy) queue command list of the frame, which is submitted once and is waited by the graphics queue.
+     * An event query issued after the copies resolves the tasks of the batches when the data is on the GPU.
+     *
+     * Until the first update() the batches are copied at once by the submitting thread (under the driver ownership):
+     * the assets loaded before the frames loop are not waiting for it.
+     *
+     * Settings (global properties):
+     *  - /graphics/uploads/stagingMb: the persistent staging memory, 64 by default (the overflow pages are temporary);
+     *  - /graphics/uploads/maxMbPerFrame: the batches copied per frame, 32 by default (at least one batch is copied).
+     */
+    class NAU_GRAPHICSASSETS_EXPORT GpuUploadQueue final : public IServiceInitialization,
+                                                           public IServiceShutdown
+    {
+        NAU_RTTI_CLASS(nau::GpuUploadQueue, IServiceInitialization, IServiceShutdown)
+    public:
+        static constexpr size_t StagingPageSize = 1 << 20;
+
+        GpuUploadQueue() = default;
+        ~GpuUploadQueue();
+
+        /**
+         * @brief Thread safe.
+         */
+        GpuUploadBatch createBatch();
+
+        /**
+         * @brief Thread safe. The task is resolved when the batch data is on the GPU.
+         */
+        async::Task<> submit(GpuUploadBatch&& batch);
+
+        /**
+         * @brief Copies the submitted batches and resolves the completed ones. Called on the render thread once per frame.
+         */
+        void update();
+
+        /**
+         * @brief Copies the submitted batches at once and resolves all the tasks: the later batches are copied by the submitting threads
+         * until the next update().
+         */
+        void stop();
+
+    private:
+        friend class GpuUploadBatch;
+
+        struct PendingBatch
+        {
+            GpuUploadBatch batch;
+            async::TaskSource<> completion;
+        };
+
+        struct InFlight
+        {
+            d3d::EventQuery* query = nullptr;
+            eastl::vector<async::TaskSource<>> completions;
+        };
+
+        async::Task<> preInitService() override;
+        async::Task<> shutdownService() override;
+
+        GpuUploadBatch::Page* acquirePage(size_t size);
+        void releasePages(GpuUploadBatch& batch);
+        void copy(const GpuUploadBatch& batch) const;
+
+        size_t m_maxBytesPerFrame = size_t(32) << 20;
+
+        std::mutex m_mutex;
+        bool m_isRunning = false;
+        eastl::vector<eastl::unique_ptr<GpuUploadBatch::Page>> m_pages;
+        eastl::vector<GpuUploadBatch::Page*> m_freePages;
+        eastl::vector<PendingBatch> m_pending;
+
+        // Owned by the render thread.
+        eastl::vector<InFlight> m_inFlight;
+    };
+}  // namespace nau
@@ -4,13 +4,20 @@
 
 #pragma once
 
+#include <EASTL/array.h>
 #include <EASTL/unordered_set.h>
+#include <EASTL/vector_map.h>
+
+#include <type_traits>
 
 #include "nau/assets/asset_ref.h"
 #include "nau/assets/asset_view.h"
 #include "nau/assets/material.h"
 #include "nau/async/task_base.h"
+#include "nau/math/math.h"
 #include "nau/rtti/rtti_impl.h"
+#include "nau/shaders/shader_globals.h"
+#include "nau/string/name_id.h"
 
 #include "shader_asset.h"
 #include "texture_asset.h"
@@ -72,6 +79,18 @@ namespace nau
          */
         static async::Task<MaterialAssetView::Ptr> createFromAssetAccessor(nau::Ptr<> accessor);
 
+        /**
+         * @brief Cooks the property constant buffers of the master pipeline (see native_material.h).
+         *
+         * The values of the buffer variables are written into the buffers laid out by the shaders reflection the same way
+         * the pipeline does on load, the variables are removed from the properties.
+         *
+         * @param [in, out] pipeline    The material pipeline to cook.
+         * @param [in] shaders          The shaders of the pipeline.
+         * @return                      Operation status.
+         */
+        static Result<> cookConstantBuffers(MaterialPipeline& pipeline, eastl::span<const Shader> shaders);
+
         /**
          * @brief Binds the resource for use.
          */
@@ -82,7 +101,16 @@ namespace nau
          * 
          * @param [in] pipelineName The name of the pipeline to bind.
          */
-        virtual void bindPipeline(eastl::string_view pipelineName) = 0;
+        virtual void bindPipeline(NameId pipelineName) = 0;
+
+        /**
+         * @brief Uploads the constants of the pipeline that is still bound by the previous bindPipeline() call.
+         *
+         * Only the global and the modified material constants are updated: the program, the resources and the render state are kept.
+         * 
+         * @param [in] pipelineName The name of the bound pipeline.
+         */
+        virtual void updatePipelineConstants(NameId pipelineName) = 0;
 
         /**
          * @brief Retrieves the program associated with the specified pipeline.
@@ -90,7 +118,7 @@ namespace nau
          * @param [in] pipelineName The name of the pipeline.
          * @return                  The program associated with the pipeline.
          */
-        virtual PROGRAM getPipelineProgram(eastl::string_view pipelineName) const = 0;
+        virtual PROGRAM getPipelineProgram(NameId pipelineName) const = 0;
 
         /**
          * @brief Retrieves a set of all pipeline names.
@@ -99,6 +127,14 @@ namespace nau
          */
         virtual eastl::unordered_set<eastl::string> getPipelineNames() const;
 
+        /**
+         * @brief Checks whether the material has the specified pipeline.
+         * 
+         * @param [in] pipelineName The name of the pipeline.
+         * @return                  `true` if the pipeline exists, `false` otherwise.
+         */
+        bool hasPipeline(eastl::string_view pipelineName) const;
+
         /**
          * @brief Sets the cull mode for the specified pipeline.
          * 
@@ -172,6 +208,43 @@ namespace nau
 
         size_t getNameHash() const { return m_nameHash; }
 
+        /**
+         * @brief The maximum number of the per-instance properties (see Material::instanceProperties).
+         */
+        static constexpr uint32_t MaxInstanceParams = 2;
+
+        /**
+         * @brief Values of the per-instance properties, one float4 per property: the layout of the instance data parameters.
+         */
+        using InstanceParams = eastl::array<math::Vector4, MaxInstanceParams>;
+
+        /**
+         * @brief Retrieves the hash the instanced draws of the material are batched by.
+         *
+         * It is the name hash, unless the material is an instance that differs from its master by the per-instance properties only:
+         * then it is the hash of the master, and the draws take the values of these properties from the instance data (see getInstanceParams()).
+         * Once a property that is not per-instance, a texture or a render state is overridden, the material is batched by its own name.
+         *
+         * @return The batch hash.
+         */
+        size_t getBatchHash() const { return m_batchHash; }
+
+        /**
+         * @brief Checks whether the material declares the per-instance properties.
+         *
+         * @return `true` if the shaders read some properties from the instance data, `false` otherwise.
+         */
+        bool hasInstanceParams() const { return !m_instanceProperties.empty(); }
+
+        /**
+         * @brief Retrieves the current values of the per-instance properties.
+         *
+         * The values are read from the first pipeline with the property, the parameters of the missing properties are zero.
+         *
+         * @param [out] params  The values, in the declaration order of the properties.
+         */
+        void getInstanceParams(InstanceParams& params) const;
+
         /**
          * @brief Enables or disables automatic texture setting.
          * 
@@ -186,9 +259,46 @@ namespace nau
          */
         bool isAutoSetTexturesEnabled() const { return m_autoSetTextures; }
 
+        /**
+         * @brief Requests the resolution of the streamed textures of all the pipelines for the current frame.
+         *
+         * The render lists request the levels of the drawn materials, see TextureStreaming.
+         *
+         * @param [in] level The log2 of the resolution, see TexStreamingContext::getTexLevel().
+         */
+        void requestTextureLevel(uint32_t level) const;
+
+        /**
+         * @brief Pre-hashed names of a pipeline property.
+         *
+         * The id does not refer to a material: it is made once (see makePropertyId()) and is valid for any material with the property.
+         */
+        struct PropertyId
+        {
+            size_t pipelineHash = 0;
+            size_t propertyHash = 0;
+        };
+
+        /**
+         * @brief Makes the id of a pipeline property, to set the property without the names hashing.
+         *
+         * The id is computed at compile time for the constant names (`"default"_nid`).
+         *
+         * @param [in] pipelineName The name of the pipeline.
+         * @param [in] propertyName The name of the property.
+         * @return                  The property id.
+         */
+        static constexpr PropertyId makePropertyId(NameId pipelineName, NameId propertyName)
+        {
+            return {pipelineName.getHash(), propertyName.getHash()};
+        }
+
         /**
          * @brief Sets a property for a specified pipeline.
          *
+         * The value is copied into the CPU copy of the constant buffer, the buffer is uploaded on the next pipeline bind.
+         * `T` must have the layout of the shader variable (e.g. `math::Vector4` for a `float4`).
+         *
          * @param [in] pipelineName The name of the pipeline.
          * @param [in] propertyName The name of the property to be set.
          * @param [in] value        The new value to set for the property.
@@ -196,12 +306,21 @@ namespace nau
         template <typename T>
         void setProperty(eastl::string_view pipelineName, eastl::string_view propertyName, const T& value);
 
+        /**
+         * @brief Sets a property by its id.
+         *
+         * @param [in] propertyId   The id of the pipeline property, see makePropertyId().
+         * @param [in] value        The new value to set for the property.
+         */
+        template <typename T>
+        void setProperty(const PropertyId& propertyId, const T& value);
+
         /**
          * @brief Retrieves a property value for a specified pipeline.
          *
          * @param [in] pipelineName The name of the pipeline.
          * @param [in] propertyName The name of the property to retrieve.
-         * @return                  The value of the property, cast to the specified type `T`.
+         * @return                  The value of the property, read as the specified type `T`.
          */
         template <typename T>
         T getProperty(eastl::string_view pipelineName, eastl::string_view propertyName);
@@ -444,6 +563,8 @@ namespace nau
             uint32_t slot;
             bool isOwned;
             bool isDirty;
+
+            eastl::vector<std::byte> shadowData; ///< Only for the property constant buffers: the buffer content, uploaded as is.
         };
 
         /**
@@ -456,6 +577,7 @@ namespace nau
             BaseTexture* texture = nullptr;
             uint32_t slot;
             bool isOwned;
+            bool isBindless = false;                      ///< Not bound to the slot: the shader reads it from the bindless heap, see BindlessTexture.
 
             BaseTexture* getTexture() const
             {
@@ -467,7 +589,7 @@ namespace nau
                 {
                     nau::Ptr<TextureAssetView> textureViewPtr;
                     textureView->getTyped<TextureAssetView>(textureViewPtr);
-                    return textureViewPtr->getTexture();
+                    return textureViewPtr->getStreamedTexture();
                 }
             };
         };
@@ -490,14 +612,34 @@ namespace nau
             const ShaderVariableDescription* reflection;
             BufferCache* parentBuffer;
 
-            RuntimeValue::Ptr currentValue;
-            RuntimeValue::Ptr* masterValue; ///< Only for MaterialInstanceView.
+            RuntimeValue::Ptr currentValue; ///< The loaded value, see compileConstantBuffers(). The current one is in the parent buffer shadow data.
+            const ConstantBufferVariable* masterVariable; ///< Only for MaterialInstanceView.
 
             Timestamp timestamp;
 
             bool isMasterValue; ///< Only for MaterialInstanceView.
         };
 
+        /**
+         * @brief Global constant buffer of a pipeline shader, assembled from the shader globals.
+         *
+         * Only the variables modified since the previous bind are copied into the data.
+         */
+        struct GlobalBufferCache
+        {
+            struct Variable
+            {
+                shader_globals::GlobalVarId id;
+                uint32_t offset;
+            };
+
+            eastl::vector<std::byte> data;
+            eastl::vector<Variable> variables;
+            ShaderTarget target;
+            uint32_t bindPoint;
+            uint64_t revision = 0; ///< shader_globals::getRevision() the data was updated at.
+        };
+
         /**
          * @brief Represents a property of a sampled texture, including its current and master values.
          */
@@ -513,6 +655,23 @@ namespace nau
             bool isMasterValue; ///< Only for MaterialInstanceView.
         };
 
+        /**
+         * @brief A texture read by the shader from the bindless heap with the index in the material constant buffer.
+         *
+         * The texture is bindless when the pipeline has the `<texture>BindlessIndex` uint property and the texture is not bound
+         * to a slot by the shader. The asset textures share their slot (TextureAssetView::getBindlessIndex()),
+         * the generated and the external ones have a slot of the pipeline.
+         */
+        struct BindlessTexture
+        {
+            TextureCache* texture;
+            ConstantBufferVariable* indexProperty;
+
+            uint32_t ownIndex = TextureAssetView::InvalidBindlessIndex;
+            BaseTexture* ownTexture = nullptr;             ///< The texture the own slot points to.
+            uint32_t writtenIndex = TextureAssetView::InvalidBindlessIndex;
+        };
+
         /**
          * @brief Descriptor for a render pipeline pass.
          *
@@ -543,6 +702,12 @@ namespace nau
             
             PROGRAM programID;
 
+            eastl::vector_map<size_t, ConstantBufferVariable*> propertiesByHash; ///< See PropertyId.
+            eastl::vector<BindlessTexture> bindlessTextures; ///< Built by compileConstantBuffers().
+
+            eastl::vector<GlobalBufferCache> globalBuffers; ///< Only for MasterMaterialAssetView, built on the first bind.
+            bool hasGlobalBuffers = false;
+
             eastl::optional<shaders::RenderStateId> renderStateId;
 
             eastl::optional<CullMode> cullMode;
@@ -607,19 +772,72 @@ namespace nau
          */
         static void makeStencilCmpFunc(ComparisonFunc cmpFunc, shaders::RenderState& renderState);
 
+        /**
+         * @brief Builds the CPU copies of the pipeline property constant buffers from the loaded values and the properties ids lookup.
+         *
+         * The cooked buffers (see cookConstantBuffers()) are already filled by makeMasterPipeline().
+         * The instance pipelines take the values of the master properties they do not override from the compiled master pipeline.
+         *
+         * @param [in, out] pipeline The pipeline to compile.
+         */
+        static void compileConstantBuffers(Pipeline& pipeline);
+
+        /**
+         * @brief Copies the value into the CPU copy of the property constant buffer and marks the buffer dirty.
+         *
+         * @param [in] pipeline The pipeline of the property.
+         * @param [in] variable The property to set.
+         * @param [in] data     The value of the property layout.
+         * @param [in] size     The size of the value.
+         */
+        static void writeProperty(Pipeline& pipeline, ConstantBufferVariable& variable, const void* data, size_t size);
+
+        /**
+         * @brief Writes the bindless heap indices of the pipeline textures into their properties, if changed. Called before the bind.
+         *
+         * @param [in, out] pipeline The pipeline to update.
+         */
+        static void updateBindlessTextures(Pipeline& pipeline);
+
+        /**
+         * @brief Frees the bindless heap slots owned by the pipeline.
+         *
+         * @param [in, out] pipeline The pipeline to release.
+         */
+        static void releaseBindlessTextures(Pipeline& pipeline);
+
+        /**
+         * @brief Looks the pipeline up by the name id (no string hashing or allocation).
+         *
+         * @param [in] pipelineName The name of the pipeline.
+         * @return                  The pipeline or `nullptr` if the material does not have it.
+         */
+        Pipeline* findPipeline(NameId pipelineName);
+        const Pipeline* findPipeline(NameId pipelineName) const;
+
+        /**
+         * @brief Same as findPipeline(), but the pipeline must exist.
+         */
+        Pipeline& getPipeline(NameId pipelineName);
+        const Pipeline& getPipeline(NameId pipelineName) const;
+
+        void setPropertyData(eastl::string_view pipelineName, eastl::string_view propertyName, const void* data, size_t size);
+        void setPropertyData(const PropertyId& propertyId, const void* data, size_t size);
+        void getPropertyData(eastl::string_view pipelineName, eastl::string_view propertyName, void* data, size_t size);
+
         /**
          * @brief Updates the constant buffers bound to the pipeline with the associated CPU values.
          *
          * @param pipelineName [in] The name of the pipeline for which constant buffers are updated.
          */
-        void updateBuffers(eastl::string_view pipelineName);
+        void updateBuffers(NameId pipelineName);
 
         /**
          * @brief Updates the render state for the specified pipeline based on the pipeline's settings.
          *
          * @param pipelineName [in] The name of the pipeline for which the render state is updated.
          */
-        void updateRenderState(eastl::string_view pipelineName);
+        void updateRenderState(NameId pipelineName);
 
         /**
          * @brief Checks if any of the pipelines have a compute shader.
@@ -628,15 +846,32 @@ namespace nau
          */
         bool hasComputeShader() const;
 
+        /**
+         * @brief Checks whether the property is read per instance (see Material::instanceProperties).
+         *
+         * @param [in] propertyName The name of the property.
+         * @return                  `true` if the property is per-instance, `false` otherwise.
+         */
+        bool isInstanceProperty(eastl::string_view propertyName) const;
+
         // Map storing pipeline objects by their names.
         eastl::unordered_map<eastl::string, Pipeline> m_pipelines;
 
+        // The pipelines by their name ids (NameId hashes), see PropertyId.
+        eastl::vector_map<size_t, Pipeline*> m_pipelinesByHash;
+
         // The name associated with this material asset view.
         eastl::string m_name;
 
         // Hash of the material name
         size_t m_nameHash;
 
+        // See getBatchHash().
+        size_t m_batchHash = 0;
+
+        // The names of the per-instance properties, the instances take them from the master.
+        eastl::vector<eastl::string> m_instanceProperties;
+
         // Flag indicating whether textures should be automatically set.
         bool m_autoSetTextures = true;
     };
@@ -674,7 +909,14 @@ namespace nau
          *
          * @param [in] pipelineName The name of the pipeline to bind.
          */
-        void bindPipeline(eastl::string_view pipelineName) override;
+        void bindPipeline(NameId pipelineName) override;
+
+        /**
+         * @brief Uploads the constants of the bound pipeline.
+         *
+         * @param [in] pipelineName The name of the bound pipeline.
+         */
+        void updatePipelineConstants(NameId pipelineName) override;
 
         /**
          * @brief Retrieves the program associated with the specified pipeline.
@@ -682,14 +924,16 @@ namespace nau
          * @param [in] pipelineName The name of the pipeline.
          * @return                  The program associated with the pipeline.
          */
-        PROGRAM getPipelineProgram(eastl::string_view pipelineName) const override;
+        PROGRAM getPipelineProgram(NameId pipelineName) const override;
 
     private:
         // TODO(MaxWolf): remove this in NAU-2398.
-        void setGlobals(eastl::string_view pipelineName);
+        void setGlobals(NameId pipelineName);
+        static void buildGlobalBuffers(Pipeline& pipeline);
 
         // Stores the name of the default program associated with the first pipeline.
         eastl::string m_defaultProgram;
+        NameId m_defaultProgramId;
     };
 
 
@@ -727,7 +971,14 @@ namespace nau
          *
          * @param [in] pipelineName The name of the pipeline to bind.
          */
-        void bindPipeline(eastl::string_view pipelineName) override;
+        void bindPipeline(NameId pipelineName) override;
+
+        /**
+         * @brief Uploads the constants of the bound pipeline.
+         *
+         * @param [in] pipelineName The name of the bound pipeline.
+         */
+        void updatePipelineConstants(NameId pipelineName) override;
 
         /**
          * @brief Retrieves the program associated with the specified pipeline from the master material.
@@ -737,7 +988,7 @@ namespace nau
          *
          * @note The instance does not own the program; it references the program from the master material.
          */
-        PROGRAM getPipelineProgram(eastl::string_view pipelineName) const override;
+        PROGRAM getPipelineProgram(NameId pipelineName) const override;
 
     private:
         void syncBuffers(const Pipeline& masterPipeline, Pipeline& instancePipeline);
@@ -750,36 +1001,23 @@ namespace nau
     template <typename T>
     void MaterialAssetView::setProperty(eastl::string_view pipelineName, eastl::string_view propertyName, const T& value)
     {
-        NAU_ASSERT(m_pipelines.contains(pipelineName));
-        auto& pipeline = m_pipelines[pipelineName.data()];
-
-        NAU_ASSERT(pipeline.properties.contains(propertyName));
-        auto& variable = pipeline.properties[propertyName.data()];
-
-        if (variable.isMasterValue)
-        {
-            variable.masterValue = nullptr;
-            variable.isMasterValue = false;
-        }
-
-        variable.currentValue = makeValueCopy(value);
-        variable.timestamp = std::chrono::steady_clock::now();
-        variable.parentBuffer->isDirty = true;
+        static_assert(std::is_trivially_copyable_v<T>, "The property value is copied into the constant buffer");
+        setPropertyData(pipelineName, propertyName, &value, sizeof(T));
+    }
 
-        pipeline.isDirty = true;
+    template <typename T>
+    void MaterialAssetView::setProperty(const PropertyId& propertyId, const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "The property value is copied into the constant buffer");
+        setPropertyData(propertyId, &value, sizeof(T));
     }
 
     template <typename T>
     T MaterialAssetView::getProperty(eastl::string_view pipelineName, eastl::string_view propertyName)
     {
-        NAU_ASSERT(m_pipelines.contains(pipelineName));
-        auto& pipeline = m_pipelines[pipelineName.data()];
-
-        NAU_ASSERT(pipeline.properties.contains(propertyName));
-        auto& variable = pipeline.properties[propertyName.data()];
-
-        return variable.isMasterValue
-            ? runtimeValueCast<T>(*variable.masterValue)
-            : runtimeValueCast<T>(variable.currentValue);
+        static_assert(std::is_trivially_copyable_v<T>, "The property value is copied from the constant buffer");
+        T value{};
+        getPropertyData(pipelineName, propertyName, &value, sizeof(T));
+        return value;
     }
 }  // namespace nau
@@ -0,0 +1,48 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <EASTL/span.h>
+
+#include "nau/3d/dag_drv3d.h"
+#include "nau/math/math.h"
+
+
+namespace nau
+{
+    /**
+     * Cooked vertex attributes of the packed layout: 12 bytes instead of the 36 bytes of the separate normal, tangent and texcoord streams.
+     * The positions stay in their own float3 stream (0), so the depth only passes bind just them. The attributes are the stream 1:
+     *  - NORMAL: SHORT4N, the octahedral encoded normal in xy, the tangent in zw;
+     *  - TEXCOORD0: HALF2.
+     * The tangent w (the bitangent sign) is the sign of the encoded tangent y, its magnitude is (y * 0.5 + 0.5), so the shader decodes
+     * the tangent oct y as (abs(zw.y) * 2 - 1) and the sign as (zw.y < 0 ? -1 : 1).
+     * The layout is used for the meshes loaded with the "/graphics/packedVertexLayout" property set: their materials must use the packed shaders.
+     */
+    struct PackedVertexAttributes
+    {
+        int16_t normal[2];
+        int16_t tangent[2];
+        uint16_t texcoord[2];
+    };
+
+    static_assert(sizeof(PackedVertexAttributes) == 12);
+
+    NAU_GRAPHICSASSETS_EXPORT bool isPackedVertexLayoutEnabled();
+
+    /**
+     * @param tangents  Can be empty: the x axis is encoded as the tangents then.
+     */
+    NAU_GRAPHICSASSETS_EXPORT void packVertexAttributes(eastl::span<const nau::math::float3> normals,
+                                                        eastl::span<const nau::math::float4> tangents,
+                                                        eastl::span<const nau::math::float2> texcoords,
+                                                        eastl::span<PackedVertexAttributes> output);
+
+    /**
+     * Packs the filled and unlocked attribute buffers of vertexCount vertices into the new vertex buffer.
+     * The source buffers are kept: the caller releases them.
+     */
+    NAU_GRAPHICSASSETS_EXPORT Sbuffer* createPackedAttributesBuffer(Sbuffer* normals, Sbuffer* tangents, Sbuffer* texcoords, uint32_t vertexCount);
+
+} // namespace nau
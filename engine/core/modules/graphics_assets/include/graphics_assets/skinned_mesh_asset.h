@@ -10,6 +10,8 @@
 #include "nau/assets/mesh_asset_accessor.h"
 #include "nau/math/dag_bounds3.h"
 
+#include <EASTL/span.h>
+
 namespace nau
 {
     struct SkinnedMeshLod final
@@ -18,6 +20,8 @@ namespace nau
         Sbuffer* m_normalsBuffer;
         Sbuffer* m_tangentsBuffer;
         Sbuffer* m_texcoordsBuffer;
+        // The normals, the tangents and the texcoords of the packed layout (see PackedVertexAttributes), the separate buffers are null then.
+        Sbuffer* m_packedAttributesBuffer = nullptr;
         Sbuffer* m_boneWeightsBuffer;
         Sbuffer* m_boneIndicesBuffer;
 
@@ -49,6 +53,32 @@ namespace nau
             return m_localBSphere;
         }
 
+        // Screen sizes (the bounding sphere diameter to the screen height ratio) below which the lods from 1 are used.
+        inline eastl::span<const float> getLodsScreenSpaceError() const
+        {
+            return m_lodsScreenSpaceError;
+        }
+
+        /**
+         * The bind pose boxes of the lod 0 vertices influenced by each bone, indexed by the bone.
+         * Transformed by the bone skinning matrices, they bound the animated mesh (the empty boxes are of the unused bones).
+         */
+        inline eastl::span<const nau::math::BBox3> getBonesBindBoxes() const
+        {
+            return m_bonesBindBoxes;
+        }
+
+        // Added to the animated bounds on each side: for the animations the bind pose boxes do not cover.
+        inline float getBoundsPadding() const
+        {
+            return m_boundsPadding;
+        }
+
+        inline void setBoundsPadding(float padding)
+        {
+            m_boundsPadding = padding;
+        }
+
     public:
         static async::Task<nau::Ptr<SkinnedMesh>> createFromMeshAccessor(IMeshAssetAccessor& meshAccessor);
 
@@ -57,6 +87,8 @@ namespace nau
 
         eastl::vector<SkinnedMeshLod> lods;
         eastl::vector<float> m_lodsScreenSpaceError;
+        eastl::vector<nau::math::BBox3> m_bonesBindBoxes;
+        float m_boundsPadding = 0.f;
         float cullDistance;
     };
 
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "nau/3d/dag_drv3d.h"
+#include "nau/assets/asset_residency.h"
 #include "nau/assets/asset_view.h"
 #include "nau/rtti/rtti_impl.h"
 #include "nau/utils/functor.h"
@@ -13,19 +14,20 @@ namespace nau
 {
     /**
      */
-    class NAU_GRAPHICSASSETS_EXPORT StaticMeshAssetView : public IAssetView
+    class NAU_GRAPHICSASSETS_EXPORT StaticMeshAssetView : public IAssetView,
+                                                         public IAssetMemoryFootprint
     {
-        NAU_CLASS_(nau::StaticMeshAssetView, IAssetView)
+        NAU_CLASS_(nau::StaticMeshAssetView, IAssetView, IAssetMemoryFootprint)
     public:
         static async::Task<nau::Ptr<StaticMeshAssetView>> createFromAssetAccessor(nau::Ptr<> accessor);
 
-        Sbuffer* getPositionsBuffer() const; // todo: NAU-1797 Remove, use getMesh
-        Sbuffer* getNormalsBuffer() const; // todo: NAU-1797 Remove, use getMesh
-        Sbuffer* getTangentsBuffer() const; // todo: NAU-1797 Remove, use getMesh
-        Sbuffer* getTexcoordsBuffer() const; // todo: NAU-1797 Remove, use getMesh
-        Sbuffer* getIndexBuffer() const; // todo: NAU-1797 Remove, use getMesh
-        unsigned getIndexCount() const; // todo: NAU-1797 Remove, use getMesh
-        unsigned getVertexCount() const; // todo: NAU-1797 Remove, use getMesh
+        Sbuffer* getPositionsBuffer(uint32_t lodIndex = 0) const; // todo: NAU-1797 Remove, use getMesh
+        Sbuffer* getNormalsBuffer(uint32_t lodIndex = 0) const; // todo: NAU-1797 Remove, use getMesh
+        Sbuffer* getTangentsBuffer(uint32_t lodIndex = 0) const; // todo: NAU-1797 Remove, use getMesh
+        Sbuffer* getTexcoordsBuffer(uint32_t lodIndex = 0) const; // todo: NAU-1797 Remove, use getMesh
+        Sbuffer* getIndexBuffer(uint32_t lodIndex = 0) const; // todo: NAU-1797 Remove, use getMesh
+        unsigned getIndexCount(uint32_t lodIndex = 0) const; // todo: NAU-1797 Remove, use getMesh
+        unsigned getVertexCount(uint32_t lodIndex = 0) const; // todo: NAU-1797 Remove, use getMesh
 
         void enumerateMeshTriangles(Functor<void(
             const nau::math::vec3&, const nau::math::vec3&, const nau::math::vec3&)> sink) const;
@@ -35,6 +37,13 @@ namespace nau
             return m_mesh;
         };
 
+        AssetMemoryCategory getMemoryCategory() const override;
+
+        /**
+         * @brief The geometry pool ranges of the lods (GPU) and the occluder copies of the geometry (CPU).
+         */
+        AssetMemoryFootprint getMemoryFootprint() const override;
+
     protected:
         nau::StaticMesh::Ptr m_mesh;
     };
@@ -0,0 +1,110 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <EASTL/span.h>
+#include <EASTL/unique_ptr.h>
+#include <EASTL/vector.h>
+
+#include <mutex>
+
+#include "nau/3d/dag_drv3d.h"
+
+
+namespace nau
+{
+    /**
+     * Suballocates the mesh geometry from a few large vertex and index buffers (the pages).
+     * The vertex streams of the page share the vertex ranges: the mesh is addressed by its page, the base vertex and the start index,
+     * so the meshes of one page are drawn without the vertex and the index buffers rebinds.
+     * The indices are 16 bit and relative to the base vertex.
+     */
+    class NAU_GRAPHICSASSETS_EXPORT GeometryPool
+    {
+    public:
+        static constexpr uint32_t InvalidPage = ~0u;
+
+        struct Allocation
+        {
+            uint32_t page = InvalidPage;
+            uint32_t baseVertex = 0;
+            uint32_t vertexCount = 0;
+            uint32_t startIndex = 0;
+            uint32_t indexCount = 0;
+
+            explicit operator bool() const
+            {
+                return page != InvalidPage;
+            }
+        };
+
+        /**
+         * @param vertexStrides     The strides of the page vertex streams.
+         * @param pageVertexCount   The vertices capacity of the page, the bigger meshes get the pages of their size.
+         * @param pageIndexCount    The indices capacity of the page.
+         */
+        GeometryPool(eastl::span<const uint32_t> vertexStrides, uint32_t pageVertexCount, uint32_t pageIndexCount);
+        GeometryPool(const GeometryPool&) = delete;
+        ~GeometryPool();
+
+        GeometryPool& operator=(const GeometryPool&) = delete;
+
+        Allocation allocate(uint32_t vertexCount, uint32_t indexCount);
+        void free(const Allocation& allocation);
+
+        // The data is the vertexCount elements of the stream stride.
+        void writeVertices(const Allocation& allocation, uint32_t stream, const void* data);
+        void writeIndices(const Allocation& allocation, const uint16_t* indices);
+
+        Sbuffer* getVertexBuffer(uint32_t page, uint32_t stream) const;
+        Sbuffer* getIndexBuffer(uint32_t page) const;
+
+        uint32_t getStreamsCount() const
+        {
+            return static_cast<uint32_t>(m_vertexStrides.size());
+        }
+
+    private:
+        // First fit in the offset sorted free ranges, the neighbouring ranges are merged on free.
+        class RangeAllocator
+        {
+        public:
+            static constexpr uint32_t InvalidOffset = ~0u;
+
+            explicit RangeAllocator(uint32_t capacity);
+
+            uint32_t allocate(uint32_t size);
+            void free(uint32_t offset, uint32_t size);
+
+        private:
+            struct Range
+            {
+                uint32_t offset;
+                uint32_t size;
+            };
+
+            eastl::vector<Range> m_freeRanges;
+        };
+
+        struct Page
+        {
+            Page(uint32_t vertexCount, uint32_t indexCount);
+
+            eastl::vector<Sbuffer*> vertexBuffers;
+            Sbuffer* indexBuffer = nullptr;
+            RangeAllocator vertices;
+            RangeAllocator indices;
+        };
+
+        Page& createPage(uint32_t vertexCount, uint32_t indexCount);
+
+        eastl::vector<uint32_t> m_vertexStrides;
+        uint32_t m_pageVertexCount;
+        uint32_t m_pageIndexCount;
+
+        eastl::vector<eastl::unique_ptr<Page>> m_pages;
+        mutable std::mutex m_mutex;
+    };
+
+} // namespace nau
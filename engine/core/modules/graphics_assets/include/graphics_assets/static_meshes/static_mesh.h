@@ -10,8 +10,11 @@
 #include "nau/assets/mesh_asset_accessor.h"
 #include "nau/async/task_base.h"
 #include "graphics_assets/material_asset.h"
+#include "graphics_assets/static_meshes/geometry_pool.h"
 #include "nau/math/dag_bounds3.h"
 
+#include <EASTL/span.h>
+
 
 namespace nau
 {
@@ -32,18 +35,26 @@ namespace nau
 
     struct StaticMeshLod
     {
-        Sbuffer* m_positionsBuffer; // TODO: change to ResPtr's
-        Sbuffer* m_normalsBuffer;
-        Sbuffer* m_tangentsBuffer;
-        Sbuffer* m_texCoordsBuffer;
+        // The geometry pool page buffers: the lod vertices start at m_geometry.baseVertex, the indices at m_geometry.startIndex.
+        Sbuffer* m_positionsBuffer = nullptr;
+        Sbuffer* m_normalsBuffer = nullptr;
+        Sbuffer* m_tangentsBuffer = nullptr;
+        Sbuffer* m_texCoordsBuffer = nullptr;
+        // The normals, the tangents and the texcoords of the packed layout (see PackedVertexAttributes), the separate buffers are null then.
+        Sbuffer* m_packedAttributesBuffer = nullptr;
 
-        Sbuffer* m_indexBuffer;
+        Sbuffer* m_indexBuffer = nullptr;
+        GeometryPool::Allocation m_geometry;
 
         uint32_t m_indexCount;
         uint32_t m_vertexCount;
 
         nau::math::BBox3 m_localBBox;
 
+        // CPU copy of the positions (w = 1) and the indices, rasterized by the software occlusion culling and enumerated by StaticMeshAssetView::enumerateMeshTriangles().
+        eastl::vector<nau::math::float4> m_occluderVertices;
+        eastl::vector<uint16_t> m_occluderIndices;
+
         eastl::vector<MaterialSlot> m_materialSlots;
     };
 
@@ -55,7 +66,7 @@ namespace nau
 
         using Ptr = nau::Ptr<StaticMesh>;
 
-        virtual ~StaticMesh() = default;
+        virtual ~StaticMesh();
         StaticMesh();
 
         const nau::StaticMeshLod& getLod(uint32_t lodInd) const;
@@ -66,12 +77,23 @@ namespace nau
             return m_localBSphere;
         }
 
+        // Screen sizes (the bounding sphere diameter to the screen height ratio) below which the lods from 1 are used.
+        inline eastl::span<const float> getLodsScreenSpaceError() const
+        {
+            return m_lodsScreenSpaceError;
+        }
+
     public:
         static async::Task<nau::Ptr<StaticMesh>> createFromStaticMeshAccessor(IMeshAssetAccessor& accessor);
 
         static bool createFromGeneratedData();
 
     protected:
+        // Uploads the lod geometry into the geometry pool and keeps its occluder copy.
+        // The bounds are computed from the positions unless the precomputed ones are given.
+        static void initLod(StaticMeshLod& lod, eastl::span<uint16_t> indices, eastl::span<nau::math::float3> positions, eastl::span<nau::math::float3> normals, eastl::span<nau::math::float2> texcoords,
+                            const nau::math::BBox3* bounds = nullptr);
+
         StaticMeshDescriptor m_meshDescriptor;
 
         nau::math::BSphere3 m_localBSphere;
@@ -3,25 +3,117 @@
 
 #pragma once
 
+#include <atomic>
+
 #include "nau/3d/dag_drv3d.h"
+#include "nau/assets/asset_residency.h"
 #include "nau/assets/asset_view.h"
 #include "nau/rtti/rtti_impl.h"
+#include "nau/threading/spin_lock.h"
 
 namespace nau
 {
-    class NAU_GRAPHICSASSETS_EXPORT TextureAssetView : public IAssetView
+    class TextureStreaming;
+
+    class NAU_GRAPHICSASSETS_EXPORT TextureAssetView : public IAssetView,
+                                                      public IAssetMemoryFootprint
     {
-        NAU_CLASS_(nau::TextureAssetView, IAssetView)
+        NAU_CLASS_(nau::TextureAssetView, IAssetView, IAssetMemoryFootprint)
     public:
+        static constexpr uint32_t InvalidBindlessIndex = ~0u;
+
+        ~TextureAssetView();
+
         static async::Task<nau::Ptr<TextureAssetView>> createFromAssetAccessor(nau::Ptr<> accessor);
 
+        /**
+         * @brief Returns the texture for the use with no screen space demand (ui, environment, effects).
+         *
+         * A streamed texture is pinned by this call: it is streamed in to the full resolution and never evicted.
+         */
         inline BaseTexture* getTexture()
+        {
+            m_isPinned.store(true, std::memory_order_relaxed);
+            return m_Texture;
+        }
+
+        /**
+         * @brief Returns the texture for the material draws: its resident mips follow the levels requested with requestLevel().
+         */
+        inline BaseTexture* getStreamedTexture() const
         {
             return m_Texture;
         }
 
+        /**
+         * @brief Requests the resolution of 2^level texels for the current frame (see TexStreamingContext::getTexLevel()).
+         *
+         * Thread safe: the render lists of the views request the levels of the drawn materials concurrently.
+         */
+        inline void requestLevel(uint32_t level)
+        {
+            uint32_t requested = m_requestedLevel.load(std::memory_order_relaxed);
+            while (requested < level && !m_requestedLevel.compare_exchange_weak(requested, level, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        /**
+         * @brief Returns the slot of the texture in the bindless heap: the texture is registered with the first call.
+         *
+         * Thread safe. The slot is shared by all the materials of the texture and follows its streamed resource.
+         * InvalidBindlessIndex when the driver has no bindless resources.
+         */
+        uint32_t getBindlessIndex();
+
+        /**
+         * @brief Checks whether the higher mips of the texture are streamed in on demand.
+         */
+        inline bool isStreamed() const
+        {
+            return m_accessor != nullptr;
+        }
+
+        AssetMemoryCategory getMemoryCategory() const override;
+
+        /**
+         * @brief The GPU memory of the current texture resource (only the resident mips of the streamed texture).
+         */
+        AssetMemoryFootprint getMemoryFootprint() const override;
+
         using Ptr = nau::Ptr<TextureAssetView>;
     private:
-        BaseTexture* m_Texture;
+        friend class TextureStreaming;
+
+        /**
+         * @brief Creates the replacement of the texture with the mips from firstMip of the full chain loaded from the asset.
+         *
+         * Made on the worker threads: the render thread swaps the texture resource with it when its mips are on the GPU.
+         */
+        static async::Task<BaseTexture*> loadMips(nau::Ptr<TextureAssetView> view, uint32_t firstMip);
+
+        size_t getMipsSize(uint32_t firstMip) const;
+
+        /**
+         * @brief Points the bindless slot to the current resource of the texture, called after the resource is replaced.
+         */
+        void updateBindlessResource();
+
+        BaseTexture* m_Texture = nullptr;
+
+        threading::SpinLock m_bindlessMutex;
+        std::atomic<uint32_t> m_bindlessIndex = InvalidBindlessIndex;
+
+        // Only for the streamed textures: the higher mips are loaded from the asset later.
+        nau::Ptr<> m_accessor;
+        uint32_t m_dagorFormat = 0;
+        uint32_t m_width = 0;
+        uint32_t m_height = 0;
+        uint32_t m_mipsCount = 0;
+
+        // The highest resident mip of the full chain, changed by the TextureStreaming only.
+        uint32_t m_residentMip = 0;
+        std::atomic<uint32_t> m_requestedLevel = 0;
+        std::atomic<bool> m_isPinned = false;
     };
 }  // namespace nau
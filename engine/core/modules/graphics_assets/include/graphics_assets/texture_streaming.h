@@ -0,0 +1,117 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <EASTL/vector.h>
+
+#include <atomic>
+
+#include "nau/assets/texture_asset_accessor.h"
+#include "nau/async/task.h"
+#include "nau/rtti/rtti_impl.h"
+#include "nau/rtti/weak_ptr.h"
+#include "nau/service/service.h"
+#include "nau/threading/spin_lock.h"
+#include "texture_asset.h"
+
+namespace nau
+{
+    /**
+     * @brief Streams the higher mips of the textures in and out within the video memory budget.
+     *
+     * The textures are loaded with their mip tail only (see TextureAssetView::createFromAssetAccessor()).
+     * The views request the resolution the drawn materials cover on the screen each frame, the streaming
+     * then loads the missing mips on the worker threads and drops the mips of the least recently used textures
+     * when the budget is exceeded. The texture objects are kept: their resources are replaced in place.
+     *
+     * Settings (global properties):
+     *  - /graphics/textureStreaming/enabled: off by default;
+     *  - /graphics/textureStreaming/budgetMb: the budget of the streamed textures, 1024 by default;
+     *  - /graphics/textureStreaming/tailSize: the size of the mip tail loaded at once, 128 by default;
+     *  - /graphics/textureStreaming/maxLoadsPerFrame: the textures streamed in at the same time, 4 by default.
+     */
+    class NAU_GRAPHICSASSETS_EXPORT TextureStreaming final : public IServiceInitialization,
+                                                             public IServiceShutdown
+    {
+        NAU_RTTI_CLASS(nau::TextureStreaming, IServiceInitialization, IServiceShutdown)
+    public:
+        struct Stats
+        {
+            size_t residentBytes = 0;
+            size_t budgetBytes = 0;
+            uint32_t streamedTexturesCount = 0;
+            uint32_t pendingLoadsCount = 0;
+        };
+
+        TextureStreaming() = default;
+
+        bool isEnabled() const
+        {
+            return m_isEnabled;
+        }
+
+        /**
+         * @brief Returns the first mip of the texture loaded at once: the texture is streamed when it is not zero.
+         */
+        uint32_t getInitialMip(const TextureDescription& desc) const;
+
+        /**
+         * @brief Thread safe: the textures are registered by the loading tasks.
+         */
+        void registerTexture(const nau::Ptr<TextureAssetView>& texture);
+
+        /**
+         * @brief Applies the levels requested within the last frame. Called on the render thread once per frame.
+         */
+        void update();
+
+        Stats getStats() const;
+
+        /**
+         * @brief Limits the budget below the configured one (i.e. while the video memory of the driver is under pressure), 0 removes the limit.
+         *
+         * Thread safe: the limit is applied by the next update(), which drops the mips of the least recently used textures over it.
+         */
+        void setBudgetLimit(size_t limitBytes);
+
+        size_t getBudget() const;
+
+    private:
+        struct StreamedTexture
+        {
+            WeakPtr<TextureAssetView> view;
+            size_t residentBytes = 0;
+            uint64_t lastUsedFrame = 0;
+            // The mip loaded at once and the mip the last request needs.
+            uint32_t tailMip = 0;
+            uint32_t wantedMip = 0;
+            // The mip the texture is being streamed in from, valid while the load is not ready.
+            uint32_t loadingMip = 0;
+            async::Task<BaseTexture*> loading;
+        };
+
+        async::Task<> preInitService() override;
+        async::Task<> shutdownService() override;
+
+        uint32_t getWantedMip(const StreamedTexture& texture, const TextureAssetView& view, uint32_t requestedLevel) const;
+        // Drops the mips of the least recently used textures, returns false when less than neededBytes were freed.
+        bool evict(size_t neededBytes);
+        void finishLoad(StreamedTexture& texture, TextureAssetView& view);
+
+        bool m_isEnabled = false;
+        size_t m_budgetBytes = 0;
+        std::atomic<size_t> m_budgetLimitBytes = 0;
+        uint32_t m_tailSize = 128;
+        uint32_t m_maxLoadsPerFrame = 4;
+
+        threading::SpinLock m_registerMutex;
+        eastl::vector<StreamedTexture> m_registered;
+
+        // Owned by the render thread.
+        eastl::vector<StreamedTexture> m_textures;
+        size_t m_residentBytes = 0;
+        uint32_t m_pendingLoadsCount = 0;
+        uint64_t m_frame = 0;
+    };
+}  // namespace nau
@@ -0,0 +1,331 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#include "../../include/graphics_assets/gpu_upload_queue.h"
+
+#include "nau/app/global_properties.h"
+#include "nau/service/service_provider.h"
+#include "nau/threading/lock_guard.h"
+
+namespace nau
+{
+    namespace
+    {
+        constexpr size_t StagingAlignment = 16;
+    }
+
+    struct GpuUploadBatch::Page
+    {
+        eastl::unique_ptr<std::byte[]> data;
+        size_t size = 0;
+        // The overflow pages are freed when their batch is copied, the persistent ones are reused.
+        bool isPersistent = false;
+    };
+
+    GpuUploadBatch::~GpuUploadBatch()
+    {
+        if (m_queue && !m_pages.empty())
+        {
+            m_queue->releasePages(*this);
+        }
+    }
+
+    std::byte* GpuUploadBatch::allocate(size_t size)
+    {
+        NAU_ASSERT(m_queue);
+
+        const size_t alignedSize = (size + StagingAlignment - 1) & ~(StagingAlignment - 1);
+        if (m_pages.empty() || m_pageOffset + alignedSize > m_pages.back()->size)
+        {
+            m_pages.push_back(m_queue->acquirePage(alignedSize));
+            m_pageOffset = 0;
+        }
+
+        std::byte* const data = m_pages.back()->data.get() + m_pageOffset;
+        m_pageOffset += alignedSize;
+        m_bytesCount += size;
+
+        return data;
+    }
+
+    eastl::span<DestTextureData> GpuUploadBatch::stageTexture(BaseTexture* texture, uint32_t firstMip, uint32_t mipsCount)
+    {
+        NAU_ASSERT(texture);
+
+        TextureInfo info;
+        texture->getinfo(info, 0);
+        const TextureFormatDesc& formatDesc = get_tex_format_desc(info.cflg & TEXFMT_MASK);
+
+        // The destinations are needed until they are filled only.
+        m_textureDestinations.clear();
+        for (uint32_t mip = firstMip; mip < firstMip + mipsCount; ++mip)
+        {
+            texture->getinfo(info, mip);
+
+            const uint32_t rowBytes = (eastl::max<uint32_t>(info.w, 1) + formatDesc.elementWidth - 1) / formatDesc.elementWidth * formatDesc.bytesPerElement;
+            const uint32_t rowsCount = (eastl::max<uint32_t>(info.h, 1) + formatDesc.elementHeight - 1) / formatDesc.elementHeight;
+            std::byte* const data = allocate(size_t(rowBytes) * rowsCount);
+
+            m_copies.push_back({.texture = texture, .destination = mip, .data = data, .rowsCount = rowsCount, .rowBytes = rowBytes});
+
+            DestTextureData& destination = m_textureDestinations.emplace_back();
+            destination.outputBuffer = data;
+            destination.rowsCount = rowsCount;
+            destination.rowPitch = rowBytes;
+            destination.rowBytesSize = rowBytes;
+            destination.slicePitch = 0;
+        }
+
+        return {m_textureDestinations.data(), m_textureDestinations.size()};
+    }
+
+    void GpuUploadBatch::stageBuffer(Sbuffer* buffer, uint32_t offset, const void* data, uint32_t size)
+    {
+        NAU_ASSERT(buffer);
+
+        std::byte* const staged = allocate(size);
+        memcpy(staged, data, size);
+
+        m_copies.push_back({.buffer = buffer, .destination = offset, .data = staged, .rowsCount = 1, .rowBytes = size});
+    }
+
+    GpuUploadQueue::~GpuUploadQueue()
+    {
+        NAU_ASSERT(m_pending.empty() && m_inFlight.empty());
+    }
+
+    async::Task<> GpuUploadQueue::preInitService()
+    {
+        size_t stagingBytes = size_t(64) << 20;
+        if (getServiceProvider().has<GlobalProperties>())
+        {
+            auto& properties = getServiceProvider().get<GlobalProperties>();
+            stagingBytes = size_t(properties.getValue<uint32_t>("/graphics/uploads/stagingMb").value_or(64)) << 20;
+            m_maxBytesPerFrame = size_t(properties.getValue<uint32_t>("/graphics/uploads/maxMbPerFrame").value_or(32)) << 20;
+        }
+
+        // The persistent pages are allocated at once: the loads do not touch the heap for the staging memory.
+        const size_t pagesCount = stagingBytes / StagingPageSize;
+        m_pages.reserve(pagesCount);
+        m_freePages.reserve(pagesCount);
+        for (size_t i = 0; i < pagesCount; ++i)
+        {
+            auto& page = m_pages.emplace_back(eastl::make_unique<GpuUploadBatch::Page>());
+            page->data = eastl::make_unique<std::byte[]>(StagingPageSize);
+            page->size = StagingPageSize;
+            page->isPersistent = true;
+            m_freePages.push_back(page.get());
+        }
+
+        return async::Task<>::makeResolved();
+    }
+
+    async::Task<> GpuUploadQueue::shutdownService()
+    {
+        stop();
+
+        return async::Task<>::makeResolved();
+    }
+
+    GpuUploadBatch GpuUploadQueue::createBatch()
+    {
+        GpuUploadBatch batch;
+        batch.m_queue = this;
+
+        return batch;
+    }
+
+    async::Task<> GpuUploadQueue::submit(GpuUploadBatch&& batch)
+    {
+        NAU_ASSERT(batch.m_queue == this);
+
+        if (batch.isEmpty())
+        {
+            return async::Task<>::makeResolved();
+        }
+
+        {
+            lock_(m_mutex);
+            if (m_isRunning)
+            {
+                PendingBatch& pending = m_pending.emplace_back();
+                pending.batch = std::move(batch);
+
+                return pending.completion.getTask();
+            }
+        }
+
+        d3d::driver_command(DRV3D_COMMAND_ACQUIRE_OWNERSHIP, NULL, NULL, NULL);
+        copy(batch);
+        d3d::driver_command(DRV3D_COMMAND_RELEASE_OWNERSHIP, NULL, NULL, NULL);
+        releasePages(batch);
+
+        return async::Task<>::makeResolved();
+    }
+
+    void GpuUploadQueue::stop()
+    {
+        eastl::vector<PendingBatch> pending;
+        {
+            lock_(m_mutex);
+            m_isRunning = false;
+            pending = std::move(m_pending);
+        }
+
+        d3d::driver_command(DRV3D_COMMAND_ACQUIRE_OWNERSHIP, NULL, NULL, NULL);
+        for (PendingBatch& batch : pending)
+        {
+            copy(batch.batch);
+            releasePages(batch.batch);
+            batch.completion.resolve();
+        }
+        d3d::driver_command(DRV3D_COMMAND_RELEASE_OWNERSHIP, NULL, NULL, NULL);
+
+        // The queries are not waited: the copies are done before any later work of the device.
+        for (InFlight& inFlight : m_inFlight)
+        {
+            d3d::release_event_query(inFlight.query);
+            for (async::TaskSource<>& completion : inFlight.completions)
+            {
+                completion.resolve();
+            }
+        }
+        m_inFlight.clear();
+    }
+
+    void GpuUploadQueue::update()
+    {
+
+        // The queries complete in the issue order.
+        while (!m_inFlight.empty() && d3d::get_event_query_status(m_inFlight.front().query, false))
+        {
+            InFlight& inFlight = m_inFlight.front();
+            d3d::release_event_query(inFlight.query);
+            for (async::TaskSource<>& completion : inFlight.completions)
+            {
+                completion.resolve();
+            }
+            m_inFlight.erase(m_inFlight.begin());
+        }
+
+        // The batches over the frame limit wait for the next frame, but the first one is copied in any case.
+        eastl::vector<PendingBatch> batches;
+        {
+            lock_(m_mutex);
+            m_isRunning = true;
+
+            size_t bytesCount = 0;
+            size_t batchesCount = 0;
+            while (batchesCount < m_pending.size() && (batchesCount == 0 || bytesCount + m_pending[batchesCount].batch.m_bytesCount <= m_maxBytesPerFrame))
+            {
+                bytesCount += m_pending[batchesCount].batch.m_bytesCount;
+                ++batchesCount;
+            }
+
+            batches.reserve(batchesCount);
+            for (size_t i = 0; i < batchesCount; ++i)
+            {
+                batches.push_back(std::move(m_pending[i]));
+            }
+            m_pending.erase(m_pending.begin(), m_pending.begin() + batchesCount);
+        }
+
+        if (batches.empty())
+        {
+            return;
+        }
+
+        InFlight inFlight;
+        inFlight.completions.reserve(batches.size());
+        for (PendingBatch& batch : batches)
+        {
+            copy(batch.batch);
+            releasePages(batch.batch);
+            inFlight.completions.push_back(std::move(batch.completion));
+        }
+
+        // One query for all the copies of the frame: they are submitted together with the upload queue work of the frame.
+        inFlight.query = d3d::create_event_query();
+        if (!inFlight.query || !d3d::issue_event_query(inFlight.query))
+        {
+            d3d::release_event_query(inFlight.query);
+            for (async::TaskSource<>& completion : inFlight.completions)
+            {
+                completion.resolve();
+            }
+            return;
+        }
+
+        m_inFlight.push_back(std::move(inFlight));
+    }
+
+    GpuUploadBatch::Page* GpuUploadQueue::acquirePage(size_t size)
+    {
+        if (size <= StagingPageSize)
+        {
+            lock_(m_mutex);
+            if (!m_freePages.empty())
+            {
+                GpuUploadBatch::Page* const page = m_freePages.back();
+                m_freePages.pop_back();
+                return page;
+            }
+        }
+
+        // The staging memory is exhausted or the data does not fit into a page.
+        auto* const page = new GpuUploadBatch::Page;
+        page->size = eastl::max(size, StagingPageSize);
+        page->data = eastl::make_unique<std::byte[]>(page->size);
+
+        return page;
+    }
+
+    void GpuUploadQueue::releasePages(GpuUploadBatch& batch)
+    {
+        lock_(m_mutex);
+        for (GpuUploadBatch::Page* page : batch.m_pages)
+        {
+            if (page->isPersistent)
+            {
+                m_freePages.push_back(page);
+            }
+            else
+            {
+                delete page;
+            }
+        }
+
+        batch.m_pages.clear();
+        batch.m_copies.clear();
+        batch.m_bytesCount = 0;
+    }
+
+    void GpuUploadQueue::copy(const GpuUploadBatch& batch) const
+    {
+        for (const GpuUploadBatch::Copy& entry : batch.m_copies)
+        {
+            if (entry.buffer)
+            {
+                const bool isUpdated = entry.buffer->updateData(entry.destination, entry.rowBytes, entry.data, VBLOCK_WRITEONLY);
+                NAU_ASSERT(isUpdated);
+                continue;
+            }
+
+            // The discard lock takes the memory from the upload ring of the driver instead of a persistent copy of the texture.
+            void* texData = nullptr;
+            int stride = 0;
+            if (!entry.texture->lockimg(&texData, stride, entry.destination, TEXLOCK_WRITE | TEXLOCK_DISCARD) || !texData)
+            {
+                NAU_FAILURE("Failed to lock the texture mip ({}) for the upload", entry.destination);
+                continue;
+            }
+
+            for (uint32_t row = 0; row < entry.rowsCount; ++row)
+            {
+                memcpy(static_cast<std::byte*>(texData) + size_t(row) * stride, entry.data + size_t(row) * entry.rowBytes, entry.rowBytes);
+            }
+
+            entry.texture->unlockimg();
+        }
+    }
+}  // namespace nau
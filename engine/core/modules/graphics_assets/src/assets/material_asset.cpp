@@ -4,11 +4,13 @@
 
 #include "graphics_assets/material_asset.h"
 
+#include <EASTL/algorithm.h>
 #include <EASTL/hash_set.h>
 #include <EASTL/unordered_map.h>
 
 #include "nau/assets/asset_ref.h"
 #include "nau/assets/material_asset_accessor.h"
+#include "nau/diag/logging.h"
 #include "nau/shaders/dag_renderStateId.h"
 #include "nau/shaders/shader_defines.h"
 #include "nau/shaders/shader_globals.h"
@@ -23,6 +25,8 @@ namespace nau
         constexpr auto GeneratedTextureWidth = 4;
         constexpr auto GeneratedTextureHeight = 4;
 
+        constexpr eastl::string_view BindlessIndexSuffix = "BindlessIndex";
+
         ShaderStage getStage(ShaderTarget target)
         {
             switch (target)
@@ -43,6 +47,113 @@ namespace nau
             NAU_FAILURE_ALWAYS("Unreachable");
         }
 
+        void checkGlobalVariableType(const ShaderVariableTypeDescription& type)
+        {
+            if (type.elements > 0 || type.svc == ShaderVariableClass::Struct)
+            {
+                return;
+            }
+
+            switch (type.svc)
+            {
+                case ShaderVariableClass::Scalar:
+                    if (type.svt == ShaderVariableType::Int || type.svt == ShaderVariableType::Uint || type.svt == ShaderVariableType::Float)
+                    {
+                        return;
+                    }
+                    break;
+                case ShaderVariableClass::Vector:
+                    if ((type.svt == ShaderVariableType::Float || type.svt == ShaderVariableType::Int || type.svt == ShaderVariableType::Uint) &&
+                        type.columns >= 2 && type.columns <= 4)
+                    {
+                        return;
+                    }
+                    break;
+                case ShaderVariableClass::MatrixColumns:
+                    NAU_ASSERT(type.columns == type.rows);
+                    if (type.svt == ShaderVariableType::Float && (type.columns == 3 || type.columns == 4))
+                    {
+                        return;
+                    }
+                    break;
+                default:
+                    break;
+            }
+
+            NAU_FAILURE_ALWAYS("Not implemented");
+        }
+
+        template <typename T>
+        void writeVariableValue(std::byte* data, const ShaderVariableDescription& var, const RuntimeValue::Ptr& value)
+        {
+            const T typedValue = *runtimeValueCast<T>(value);
+            memcpy(data + var.startOffset, &typedValue, eastl::min<size_t>(sizeof(T), var.size));
+        }
+
+        // The loaded value of the property, converted to the type of the shader variable.
+        void writeVariableValue(std::byte* data, const ShaderVariableDescription& var, const RuntimeValue::Ptr& value)
+        {
+            const ShaderVariableTypeDescription& type = var.type;
+            checkGlobalVariableType(type);
+
+            switch (type.svc)
+            {
+                case ShaderVariableClass::Scalar:
+                    switch (type.svt)
+                    {
+                        case ShaderVariableType::Int:
+                            writeVariableValue<int32_t>(data, var, value);
+                            return;
+                        case ShaderVariableType::Uint:
+                            writeVariableValue<uint32_t>(data, var, value);
+                            return;
+                        default:
+                            writeVariableValue<float>(data, var, value);
+                            return;
+                    }
+                case ShaderVariableClass::Vector:
+                    if (type.svt == ShaderVariableType::Float)
+                    {
+                        switch (type.columns)
+                        {
+                            case 2:
+                                writeVariableValue<math::Vector2>(data, var, value);
+                                return;
+                            case 3:
+                                writeVariableValue<math::Vector3>(data, var, value);
+                                return;
+                            default:
+                                writeVariableValue<math::Vector4>(data, var, value);
+                                return;
+                        }
+                    }
+                    switch (type.columns)
+                    {
+                        case 2:
+                            writeVariableValue<math::IVector2>(data, var, value);
+                            return;
+                        case 3:
+                            writeVariableValue<math::IVector3>(data, var, value);
+                            return;
+                        default:
+                            writeVariableValue<math::IVector4>(data, var, value);
+                            return;
+                    }
+                case ShaderVariableClass::MatrixColumns:
+                    if (type.columns == 3)
+                    {
+                        writeVariableValue<math::Matrix3>(data, var, value);
+                    }
+                    else
+                    {
+                        writeVariableValue<math::Matrix4>(data, var, value);
+                    }
+                    return;
+                default:
+                    NAU_FAILURE_ALWAYS("Not implemented");
+            }
+        }
+
         void fillTextureWithSolidColor(BaseTexture* tex, int texWidth, int texHeight, const math::Vector4& color)
         {
             void* data = nullptr;
@@ -92,6 +203,55 @@ namespace nau
         co_return asset;
     }
 
+    Result<> MaterialAssetView::cookConstantBuffers(MaterialPipeline& pipeline, eastl::span<const Shader> shaders)
+    {
+        eastl::vector<eastl::string_view> removedVariables;
+
+        for (const Shader& shader : shaders)
+        {
+            for (const auto& bind : shader.reflection.inputBinds)
+            {
+                if (bind.type != ShaderInputType::CBuffer || pipeline.constantBuffers.contains(bind.name))
+                {
+                    continue;
+                }
+
+                // The global and the system buffers are set by the engine: the properties of their variables are not used.
+                if (shader_defines::isGlobalBuffer(bind.name) || shader_defines::isSystemBuffer(bind.name))
+                {
+                    for (const auto& var : bind.bufferDesc.variables)
+                    {
+                        removedVariables.push_back(var.name);
+                    }
+                    continue;
+                }
+
+                eastl::vector<std::byte> data(bind.bufferDesc.size, std::byte{0});
+                for (const auto& var : bind.bufferDesc.variables)
+                {
+                    const auto property = pipeline.properties.find(var.name);
+                    if (property == pipeline.properties.end())
+                    {
+                        return NauMakeError("The property ({}) of the constant buffer ({}) is not set", var.name, bind.name);
+                    }
+
+                    writeVariableValue(data.data(), var, property->second);
+                    removedVariables.push_back(var.name);
+                }
+
+                pipeline.constantBuffers.emplace(bind.name, std::move(data));
+            }
+        }
+
+        // The variables are removed after all the buffers are cooked: the buffer can be shared by the shaders.
+        for (const eastl::string_view name : removedVariables)
+        {
+            pipeline.properties.erase(eastl::string{name});
+        }
+
+        return ResultSuccess;
+    }
+
     eastl::unordered_set<eastl::string> MaterialAssetView::getPipelineNames() const
     {
         eastl::unordered_set<eastl::string> names;
@@ -105,20 +265,205 @@ namespace nau
         return names;
     }
 
-    void MaterialAssetView::setCullMode(eastl::string_view pipelineName, CullMode cullMode)
+    bool MaterialAssetView::hasPipeline(eastl::string_view pipelineName) const
+    {
+        return findPipeline(pipelineName) != nullptr;
+    }
+
+    MaterialAssetView::Pipeline* MaterialAssetView::findPipeline(NameId pipelineName)
+    {
+        const auto iter = m_pipelinesByHash.find(pipelineName.getHash());
+        return iter != m_pipelinesByHash.end() ? iter->second : nullptr;
+    }
+
+    const MaterialAssetView::Pipeline* MaterialAssetView::findPipeline(NameId pipelineName) const
+    {
+        const auto iter = m_pipelinesByHash.find(pipelineName.getHash());
+        return iter != m_pipelinesByHash.end() ? iter->second : nullptr;
+    }
+
+    MaterialAssetView::Pipeline& MaterialAssetView::getPipeline(NameId pipelineName)
+    {
+        Pipeline* const pipeline = findPipeline(pipelineName);
+        NAU_FATAL(pipeline, "Pipeline not found");
+        return *pipeline;
+    }
+
+    const MaterialAssetView::Pipeline& MaterialAssetView::getPipeline(NameId pipelineName) const
+    {
+        const Pipeline* const pipeline = findPipeline(pipelineName);
+        NAU_FATAL(pipeline, "Pipeline not found");
+        return *pipeline;
+    }
+
+    void MaterialAssetView::setPropertyData(eastl::string_view pipelineName, eastl::string_view propertyName, const void* data, size_t size)
+    {
+        setPropertyData(makePropertyId(pipelineName, propertyName), data, size);
+    }
+
+    void MaterialAssetView::setPropertyData(const PropertyId& propertyId, const void* data, size_t size)
     {
-        NAU_ASSERT(m_pipelines.contains(pipelineName));
+        const auto pipelineIter = m_pipelinesByHash.find(propertyId.pipelineHash);
+        NAU_ASSERT(pipelineIter != m_pipelinesByHash.end());
+        Pipeline& pipeline = *pipelineIter->second;
+
+        const auto propertyIter = pipeline.propertiesByHash.find(propertyId.propertyHash);
+        NAU_ASSERT(propertyIter != pipeline.propertiesByHash.end());
+        writeProperty(pipeline, *propertyIter->second, data, size);
 
-        auto& ppipeline = m_pipelines[pipelineName.data()];
+        if (!isInstanceProperty(propertyIter->second->reflection->name))
+        {
+            m_batchHash = m_nameHash;
+        }
+    }
+
+    void MaterialAssetView::getPropertyData(eastl::string_view pipelineName, eastl::string_view propertyName, void* data, size_t size)
+    {
+        auto& pipeline = getPipeline(pipelineName);
+
+        const auto propertyIter = pipeline.propertiesByHash.find(NameId::hashName(propertyName));
+        NAU_ASSERT(propertyIter != pipeline.propertiesByHash.end());
+        const ConstantBufferVariable* variable = propertyIter->second;
+        if (variable->isMasterValue)
+        {
+            variable = variable->masterVariable;
+        }
+
+        const ShaderVariableDescription& var = *variable->reflection;
+        memcpy(data, variable->parentBuffer->shadowData.data() + var.startOffset, eastl::min<size_t>(size, var.size));
+    }
+
+    void MaterialAssetView::writeProperty(Pipeline& pipeline, ConstantBufferVariable& variable, const void* data, size_t size)
+    {
+        const ShaderVariableDescription& var = *variable.reflection;
+        // The math vectors can be wider than the shader ones (Vector3 is 16 bytes, float3 is 12), the narrower values are the type mismatch.
+        NAU_ASSERT(size >= var.size, "The property {} value size {} is less than the shader variable size {}", var.name, size, var.size);
+
+        BufferCache& buffer = *variable.parentBuffer;
+        memcpy(buffer.shadowData.data() + var.startOffset, data, eastl::min<size_t>(size, var.size));
+
+        variable.isMasterValue = false;
+        variable.timestamp = std::chrono::steady_clock::now();
+        buffer.isDirty = true;
+
+        pipeline.isDirty = true;
+    }
+
+    void MaterialAssetView::compileConstantBuffers(Pipeline& pipeline)
+    {
+        for (auto& [name, cb] : pipeline.constantBuffers)
+        {
+            if (cb.shadowData.size() != cb.reflection->bufferDesc.size)
+            {
+                cb.shadowData.assign(cb.reflection->bufferDesc.size, std::byte{0});
+            }
+        }
+
+        pipeline.propertiesByHash.clear();
+        pipeline.propertiesByHash.reserve(pipeline.properties.size());
+
+        for (auto& [name, property] : pipeline.properties)
+        {
+            [[maybe_unused]] const bool isNewHash = pipeline.propertiesByHash.emplace(NameId::hashName(name), &property).second;
+            NAU_ASSERT(isNewHash, "The property {} name hash collides", name);
+
+            if (property.parentBuffer == nullptr)
+            {
+                continue;
+            }
+
+            const ShaderVariableDescription& var = *property.reflection;
+            std::byte* const data = property.parentBuffer->shadowData.data();
+            if (property.isMasterValue)
+            {
+                const ConstantBufferVariable& master = *property.masterVariable;
+                memcpy(data + var.startOffset, master.parentBuffer->shadowData.data() + var.startOffset, var.size);
+            }
+            else if (property.currentValue)
+            {
+                writeVariableValue(data, var, property.currentValue);
+            }
+        }
+
+        pipeline.bindlessTextures.clear();
+        for (auto& [name, texture] : pipeline.samplerTextures)
+        {
+            if (!texture.isBindless)
+            {
+                continue;
+            }
+
+            if (!d3d::get_driver_desc().caps.hasBindless)
+            {
+                NAU_LOG_WARNING("The texture {} is read from the bindless heap, but the driver has no bindless resources", name);
+                continue;
+            }
+
+            const auto indexProperty = pipeline.properties.find(name + eastl::string{BindlessIndexSuffix});
+            if (indexProperty != pipeline.properties.end() && indexProperty->second.parentBuffer != nullptr)
+            {
+                pipeline.bindlessTextures.push_back({.texture = &texture, .indexProperty = &indexProperty->second});
+            }
+        }
+    }
+
+    void MaterialAssetView::updateBindlessTextures(Pipeline& pipeline)
+    {
+        for (BindlessTexture& bindless : pipeline.bindlessTextures)
+        {
+            uint32_t index = TextureAssetView::InvalidBindlessIndex;
+            if (bindless.texture->textureView != nullptr)
+            {
+                nau::Ptr<TextureAssetView> textureView;
+                bindless.texture->textureView->getTyped<TextureAssetView>(textureView);
+                index = textureView->getBindlessIndex();
+            }
+            else if (BaseTexture* const texture = bindless.texture->texture; texture != nullptr)
+            {
+                if (bindless.ownIndex == TextureAssetView::InvalidBindlessIndex)
+                {
+                    bindless.ownIndex = d3d::allocate_bindless_resource_range(RES3D_TEX, 1);
+                }
+                if (bindless.ownTexture != texture)
+                {
+                    d3d::update_bindless_resource(bindless.ownIndex, texture);
+                    bindless.ownTexture = texture;
+                }
+                index = bindless.ownIndex;
+            }
+
+            if (index != TextureAssetView::InvalidBindlessIndex && index != bindless.writtenIndex)
+            {
+                writeProperty(pipeline, *bindless.indexProperty, &index, sizeof(index));
+                bindless.writtenIndex = index;
+            }
+        }
+    }
+
+    void MaterialAssetView::releaseBindlessTextures(Pipeline& pipeline)
+    {
+        for (BindlessTexture& bindless : pipeline.bindlessTextures)
+        {
+            if (bindless.ownIndex != TextureAssetView::InvalidBindlessIndex)
+            {
+                d3d::free_bindless_resource_range(RES3D_TEX, bindless.ownIndex, 1);
+            }
+        }
+
+        pipeline.bindlessTextures.clear();
+    }
+
+    void MaterialAssetView::setCullMode(eastl::string_view pipelineName, CullMode cullMode)
+    {
+        auto& ppipeline = getPipeline(pipelineName);
+        m_batchHash = m_nameHash;
         ppipeline.cullMode = eastl::make_optional(cullMode);
         ppipeline.isRenderStateDirty = true;
     }
 
     CullMode MaterialAssetView::getCullMode(eastl::string_view pipelineName) const
     {
-        NAU_ASSERT(m_pipelines.contains(pipelineName));
-
-        const auto& ppipeline = m_pipelines.at(pipelineName.data());
+        const auto& ppipeline = getPipeline(pipelineName);
         return ppipeline.cullMode.has_value()
                    ? *ppipeline.cullMode
                    : CullMode::CounterClockwise;
@@ -126,18 +471,15 @@ namespace nau
 
     void MaterialAssetView::setDepthMode(eastl::string_view pipelineName, DepthMode depthMode)
     {
-        NAU_ASSERT(m_pipelines.contains(pipelineName));
-
-        auto& ppipeline = m_pipelines[pipelineName.data()];
+        auto& ppipeline = getPipeline(pipelineName);
+        m_batchHash = m_nameHash;
         ppipeline.depthMode = eastl::make_optional(depthMode);
         ppipeline.isRenderStateDirty = true;
     }
 
     DepthMode MaterialAssetView::getDepthMode(eastl::string_view pipelineName) const
     {
-        NAU_ASSERT(m_pipelines.contains(pipelineName));
-
-        const auto& ppipeline = m_pipelines.at(pipelineName.data());
+        const auto& ppipeline = getPipeline(pipelineName);
         return ppipeline.depthMode.has_value()
                    ? *ppipeline.depthMode
                    : DepthMode::Default;
@@ -145,18 +487,15 @@ namespace nau
 
     void MaterialAssetView::setBlendMode(eastl::string_view pipelineName, BlendMode blendMode)
     {
-        NAU_ASSERT(m_pipelines.contains(pipelineName));
-
-        auto& ppipeline = m_pipelines[pipelineName.data()];
+        auto& ppipeline = getPipeline(pipelineName);
+        m_batchHash = m_nameHash;
         ppipeline.blendMode = eastl::make_optional(blendMode);
         ppipeline.isRenderStateDirty = true;
     }
 
     BlendMode MaterialAssetView::getBlendMode(eastl::string_view pipelineName) const
     {
-        NAU_ASSERT(m_pipelines.contains(pipelineName));
-
-        const auto& ppipeline = m_pipelines.at(pipelineName.data());
+        const auto& ppipeline = getPipeline(pipelineName);
         return ppipeline.blendMode.has_value()
                    ? *ppipeline.blendMode
                    : BlendMode::Opaque;
@@ -164,18 +503,15 @@ namespace nau
 
     void MaterialAssetView::setScissorsEnabled(eastl::string_view pipelineName, bool isEnabled)
     {
-        NAU_ASSERT(m_pipelines.contains(pipelineName));
-
-        auto& ppipeline = m_pipelines[pipelineName.data()];
+        auto& ppipeline = getPipeline(pipelineName);
+        m_batchHash = m_nameHash;
         ppipeline.isScissorsEnabled = eastl::make_optional(isEnabled);
         ppipeline.isRenderStateDirty = true;
     }
 
     bool MaterialAssetView::isScissorsEnabled(eastl::string_view pipelineName) const
     {
-        NAU_ASSERT(m_pipelines.contains(pipelineName));
-
-        const auto& ppipeline = m_pipelines.at(pipelineName.data());
+        const auto& ppipeline = getPipeline(pipelineName);
         return ppipeline.isScissorsEnabled.has_value()
                    ? *ppipeline.isScissorsEnabled
                    : false;
@@ -183,8 +519,7 @@ namespace nau
 
     void MaterialAssetView::setCBuffer(eastl::string_view pipelineName, eastl::string_view bufferName, Sbuffer* cbuffer)
     {
-        NAU_ASSERT(m_pipelines.contains(pipelineName));
-        auto& pipeline = m_pipelines[pipelineName.data()];
+        auto& pipeline = getPipeline(pipelineName);
 
         NAU_ASSERT(pipeline.systemCBuffers.contains(bufferName));
         pipeline.systemCBuffers[bufferName.data()].buffer = cbuffer;
@@ -192,8 +527,7 @@ namespace nau
 
     Sbuffer* MaterialAssetView::getCBuffer(eastl::string_view pipelineName, eastl::string_view bufferName)
     {
-        NAU_ASSERT(m_pipelines.contains(pipelineName));
-        auto& pipeline = m_pipelines[pipelineName.data()];
+        auto& pipeline = getPipeline(pipelineName);
 
         NAU_ASSERT(pipeline.systemCBuffers.contains(bufferName));
         return pipeline.systemCBuffers[bufferName.data()].buffer;
@@ -201,8 +535,7 @@ namespace nau
 
     void MaterialAssetView::setTexture(eastl::string_view pipelineName, eastl::string_view propertyName, BaseTexture* texture)
     {
-        NAU_ASSERT(m_pipelines.contains(pipelineName));
-        auto& pipeline = m_pipelines[pipelineName.data()];
+        auto& pipeline = getPipeline(pipelineName);
 
         NAU_ASSERT(pipeline.texProperties.contains(propertyName));
         auto& property = pipeline.texProperties[propertyName.data()];
@@ -212,6 +545,7 @@ namespace nau
             property.masterValue = nullptr;
             property.isMasterValue = false;
         }
+        m_batchHash = m_nameHash;
 
         if (property.parentTexture->isOwned && property.currentValue != nullptr && property.currentValue->is<RuntimeReadonlyCollection>())
         {
@@ -227,8 +561,7 @@ namespace nau
 
     void MaterialAssetView::setSolidColorTexture(eastl::string_view pipelineName, eastl::string_view propertyName, math::E3DCOLOR color)
     {
-        NAU_ASSERT(m_pipelines.contains(pipelineName));
-        auto& pipeline = m_pipelines[pipelineName.data()];
+        auto& pipeline = getPipeline(pipelineName);
 
         NAU_ASSERT(pipeline.texProperties.contains(propertyName));
         auto& property = pipeline.texProperties[propertyName.data()];
@@ -238,6 +571,7 @@ namespace nau
             property.masterValue = nullptr;
             property.isMasterValue = false;
         }
+        m_batchHash = m_nameHash;
 
         const math::Vector4 solidColor = {color.r / 255.0F, color.g / 255.0F, color.b / 255.0F, color.a / 255.0F};
 
@@ -262,8 +596,7 @@ namespace nau
 
     async::Task<> MaterialAssetView::setTextureFromAsset(eastl::string_view pipelineName, eastl::string_view propertyName, eastl::string_view textureView)
     {
-        NAU_ASSERT(m_pipelines.contains(pipelineName));
-        auto& pipeline = m_pipelines[pipelineName.data()];
+        auto& pipeline = getPipeline(pipelineName);
 
         NAU_ASSERT(pipeline.texProperties.contains(propertyName));
         auto& property = pipeline.texProperties[propertyName.data()];
@@ -273,6 +606,7 @@ namespace nau
             property.masterValue = nullptr;
             property.isMasterValue = false;
         }
+        m_batchHash = m_nameHash;
 
         if (property.parentTexture->isOwned && property.currentValue != nullptr && property.currentValue->is<RuntimeReadonlyCollection>())
         {
@@ -295,9 +629,7 @@ namespace nau
         NAU_ASSERT(desc.elementCount > 0);
         NAU_ASSERT(desc.elementSize > 0);
 
-        NAU_ASSERT(m_pipelines.contains(pipelineName));
-
-        auto& pipeline = m_pipelines[pipelineName.data()];
+        auto& pipeline = getPipeline(pipelineName);
 
         if (pipeline.rwBuffers.contains(bufferName))
         {
@@ -369,9 +701,7 @@ namespace nau
         NAU_ASSERT(data);
         NAU_ASSERT(size);
 
-        NAU_ASSERT(m_pipelines.contains(pipelineName));
-
-        auto& pipeline = m_pipelines[pipelineName.data()];
+        auto& pipeline = getPipeline(pipelineName);
         for (const auto& shaderAsset : pipeline.shaders)
         {
             auto* shader = shaderAsset->getShader();
@@ -409,9 +739,7 @@ namespace nau
         NAU_ASSERT(data);
         NAU_ASSERT(size);
 
-        NAU_ASSERT(m_pipelines.contains(pipelineName));
-
-        auto& pipeline = m_pipelines[pipelineName.data()];
+        auto& pipeline = getPipeline(pipelineName);
         for (const auto& shaderAsset : pipeline.shaders)
         {
             auto* shader = shaderAsset->getShader();
@@ -447,9 +775,7 @@ namespace nau
     void MaterialAssetView::setRwBuffer(eastl::string_view pipelineName, eastl::string_view bufferName, Sbuffer* rwBuffer)
     {
         NAU_ASSERT(rwBuffer);
-        NAU_ASSERT(m_pipelines.contains(pipelineName));
-
-        auto& pipeline = m_pipelines[pipelineName.data()];
+        auto& pipeline = getPipeline(pipelineName);
         for (const auto& shaderAsset : pipeline.shaders)
         {
             auto* shader = shaderAsset->getShader();
@@ -524,9 +850,7 @@ namespace nau
 
     Sbuffer* MaterialAssetView::getRwBuffer(eastl::string_view pipelineName, eastl::string_view bufferName)
     {
-        NAU_ASSERT(m_pipelines.contains(pipelineName));
-
-        auto& pipeline = m_pipelines[pipelineName.data()];
+        auto& pipeline = getPipeline(pipelineName);
         for (const auto& shaderAsset : pipeline.shaders)
         {
             auto* shader = shaderAsset->getShader();
@@ -555,9 +879,7 @@ namespace nau
         NAU_ASSERT(desc.elementCount > 0);
         NAU_ASSERT(desc.elementSize > 0);
 
-        NAU_ASSERT(m_pipelines.contains(pipelineName));
-
-        auto& pipeline = m_pipelines[pipelineName.data()];
+        auto& pipeline = getPipeline(pipelineName);
 
         if (pipeline.roBuffers.contains(bufferName))
         {
@@ -620,9 +942,7 @@ namespace nau
         NAU_ASSERT(data);
         NAU_ASSERT(size);
 
-        NAU_ASSERT(m_pipelines.contains(pipelineName));
-
-        auto& pipeline = m_pipelines[pipelineName.data()];
+        auto& pipeline = getPipeline(pipelineName);
         for (const auto& shaderAsset : pipeline.shaders)
         {
             auto* shader = shaderAsset->getShader();
@@ -658,9 +978,7 @@ namespace nau
     void MaterialAssetView::setRoBuffer(eastl::string_view pipelineName, eastl::string_view bufferName, Sbuffer* roBuffer)
     {
         NAU_ASSERT(roBuffer);
-        NAU_ASSERT(m_pipelines.contains(pipelineName));
-
-        auto& pipeline = m_pipelines[pipelineName.data()];
+        auto& pipeline = getPipeline(pipelineName);
         for (const auto& shaderAsset : pipeline.shaders)
         {
             auto* shader = shaderAsset->getShader();
@@ -728,9 +1046,7 @@ namespace nau
 
     Sbuffer* MaterialAssetView::getRoBuffer(eastl::string_view pipelineName, eastl::string_view bufferName)
     {
-        NAU_ASSERT(m_pipelines.contains(pipelineName));
-
-        auto& pipeline = m_pipelines[pipelineName.data()];
+        auto& pipeline = getPipeline(pipelineName);
         for (const auto& shaderAsset : pipeline.shaders)
         {
             auto* shader = shaderAsset->getShader();
@@ -754,9 +1070,7 @@ namespace nau
 
     void MaterialAssetView::createRwTexture(eastl::string_view pipelineName, eastl::string_view bufferName, const TextureDesc& desc)
     {
-        NAU_ASSERT(m_pipelines.contains(pipelineName));
-
-        auto& pipeline = m_pipelines[pipelineName.data()];
+        auto& pipeline = getPipeline(pipelineName);
 
         if (pipeline.rwTextures.contains(bufferName))
         {
@@ -826,9 +1140,7 @@ namespace nau
         NAU_ASSERT(data);
         NAU_ASSERT(size);
 
-        NAU_ASSERT(m_pipelines.contains(pipelineName));
-
-        auto& pipeline = m_pipelines[pipelineName.data()];
+        auto& pipeline = getPipeline(pipelineName);
         for (const auto& shaderAsset : pipeline.shaders)
         {
             auto* shader = shaderAsset->getShader();
@@ -899,9 +1211,7 @@ namespace nau
         NAU_ASSERT(data);
         NAU_ASSERT(size);
 
-        NAU_ASSERT(m_pipelines.contains(pipelineName));
-
-        auto& pipeline = m_pipelines[pipelineName.data()];
+        auto& pipeline = getPipeline(pipelineName);
         for (const auto& shaderAsset : pipeline.shaders)
         {
             auto* shader = shaderAsset->getShader();
@@ -970,9 +1280,7 @@ namespace nau
     void MaterialAssetView::setRwTexture(eastl::string_view pipelineName, eastl::string_view bufferName, BaseTexture* rwTexture)
     {
         NAU_ASSERT(rwTexture);
-        NAU_ASSERT(m_pipelines.contains(pipelineName));
-
-        auto& pipeline = m_pipelines[pipelineName.data()];
+        auto& pipeline = getPipeline(pipelineName);
         for (const auto& shaderAsset : pipeline.shaders)
         {
             auto* shader = shaderAsset->getShader();
@@ -1045,9 +1353,7 @@ namespace nau
 
     BaseTexture* MaterialAssetView::getRwTexture(eastl::string_view pipelineName, eastl::string_view bufferName)
     {
-        NAU_ASSERT(m_pipelines.contains(pipelineName));
-
-        auto& pipeline = m_pipelines[pipelineName.data()];
+        auto& pipeline = getPipeline(pipelineName);
         for (const auto& shaderAsset : pipeline.shaders)
         {
             auto* shader = shaderAsset->getShader();
@@ -1071,9 +1377,7 @@ namespace nau
 
     void MaterialAssetView::createRoTexture(eastl::string_view pipelineName, eastl::string_view bufferName, const TextureDesc& desc)
     {
-        NAU_ASSERT(m_pipelines.contains(pipelineName));
-
-        auto& pipeline = m_pipelines[pipelineName.data()];
+        auto& pipeline = getPipeline(pipelineName);
 
         if (pipeline.roTextures.contains(bufferName))
         {
@@ -1143,9 +1447,7 @@ namespace nau
         NAU_ASSERT(data);
         NAU_ASSERT(size);
 
-        NAU_ASSERT(m_pipelines.contains(pipelineName));
-
-        auto& pipeline = m_pipelines[pipelineName.data()];
+        auto& pipeline = getPipeline(pipelineName);
         for (const auto& shaderAsset : pipeline.shaders)
         {
             auto* shader = shaderAsset->getShader();
@@ -1214,9 +1516,7 @@ namespace nau
     void MaterialAssetView::setRoTexture(eastl::string_view pipelineName, eastl::string_view bufferName, BaseTexture* roTexture)
     {
         NAU_ASSERT(roTexture);
-        NAU_ASSERT(m_pipelines.contains(pipelineName));
-
-        auto& pipeline = m_pipelines[pipelineName.data()];
+        auto& pipeline = getPipeline(pipelineName);
         for (const auto& shaderAsset : pipeline.shaders)
         {
             auto* shader = shaderAsset->getShader();
@@ -1250,11 +1550,11 @@ namespace nau
 
     BaseTexture* MaterialAssetView::getRoTexture(eastl::string_view pipelineName, eastl::string_view bufferName)
     {
-        NAU_ASSERT(m_pipelines.contains(pipelineName));
+        NAU_ASSERT(hasPipeline(pipelineName));
 
-        if (m_pipelines.contains(pipelineName))
+        if (Pipeline* const pipelinePtr = findPipeline(pipelineName))
         {
-            auto& pipeline = m_pipelines[pipelineName.data()];
+            auto& pipeline = *pipelinePtr;
             for (const auto& shaderAsset : pipeline.shaders)
             {
                 auto* shader = shaderAsset->getShader();
@@ -1289,7 +1589,7 @@ namespace nau
         {
             eastl::string bindName;
             TextureCache texture;
-            ShaderAssetView* shader;
+            const ShaderAssetView* shader; ///< Null for the bindless textures.
         };
 
         eastl::unordered_map<eastl::string, ConstantBufferVariable> properties;
@@ -1300,14 +1600,17 @@ namespace nau
         eastl::unordered_map<eastl::string, SamplerCache> samplers;
         eastl::vector<async::Task<TextureLoadingResult>> textureLoaders;
 
-        const auto addTexture = [&materialPipeline, &texProperties, &textures](const ShaderAssetView& shader, eastl::string inBindName, TextureCache&& inTexCache)
+        const auto addTexture = [&materialPipeline, &texProperties, &textures](const ShaderAssetView* shader, eastl::string inBindName, TextureCache&& inTexCache)
         {
             [[maybe_unused]] auto [iter, emplaceOk] = textures.emplace(std::move(inBindName), std::move(inTexCache));
             NAU_ASSERT(emplaceOk);
 
             auto& [bindName, texCache] = *iter;
 
-            texCache.stages.insert(getStage(shader.getShader()->target));
+            if (shader != nullptr)
+            {
+                texCache.stages.insert(getStage(shader->getShader()->target));
+            }
 
             texProperties[bindName] = {
                 .parentTexture = &texCache,
@@ -1316,6 +1619,49 @@ namespace nau
                 .isMasterValue = false};
         };
 
+        eastl::unordered_set<eastl::string> loadedTextures;
+        const auto loadTexture = [&materialPipeline, &textureLoaders, &loadedTextures, &addTexture](const ShaderAssetView* shader, const eastl::string& bindName, uint32_t bindPoint, bool isBindless)
+        {
+            loadedTextures.insert(bindName);
+
+            auto property = materialPipeline.properties.at(bindName);
+            if (property->is<RuntimeStringValue>())
+            {
+                textureLoaders.emplace_back([](eastl::string bindName, uint32_t bindPoint, bool isBindless, eastl::string texName, const ShaderAssetView* shader) -> async::Task<TextureLoadingResult>
+                {
+                    MaterialAssetRef texAssetRef = AssetPath{texName};
+                    auto texAsset = co_await texAssetRef.getReloadableAssetViewTyped<TextureAssetView>();
+
+                    co_return TextureLoadingResult{
+                        .bindName = std::move(bindName),
+
+                        .texture = TextureCache{
+                                                .textureView = texAsset,
+                                                .texture = nullptr,
+                                                .slot = bindPoint,
+                                                .isOwned = false,
+                                                .isBindless = isBindless},
+                        .shader = shader
+                    };
+                }(bindName, bindPoint, isBindless, *runtimeValueCast<eastl::string>(property), shader));
+            }
+            else if (property->is<RuntimeReadonlyCollection>())
+            {
+                const auto color = *runtimeValueCast<math::Vector4>(property);
+                TextureCache texCache{
+                    .texture = generateSolidColorTexture(color),
+                    .slot = bindPoint,
+                    .isOwned = true,
+                    .isBindless = isBindless};
+
+                addTexture(shader, bindName, std::move(texCache));
+            }
+            else
+            {
+                NAU_FAILURE_ALWAYS("Invalid texture property");
+            }
+        };
+
         for (const ShaderAssetView::Ptr& shaderAsset : shaders)
         {
             const auto& reflection = shaderAsset->getShader()->reflection;
@@ -1344,6 +1690,9 @@ namespace nau
                         }
                         else  // Property constant buffers.
                         {
+                            const auto cookedBuffer = materialPipeline.constantBuffers.find(bind.name);
+                            const bool isCookedBuffer = cookedBuffer != materialPipeline.constantBuffers.end();
+
                             if (!constantBuffers.contains(bind.name))
                             {
                                 constantBuffers[bind.name] = {
@@ -1351,19 +1700,29 @@ namespace nau
                                     .buffer = d3d::create_cb(bind.bufferDesc.size, SBCF_DYNAMIC),
                                     .slot = bind.bindPoint,
                                     .isDirty = true};
+
+                                // The cooked content is used as is (see cookConstantBuffers()): the buffer variables have no loaded values.
+                                if (isCookedBuffer && cookedBuffer->second.size() == bind.bufferDesc.size)
+                                {
+                                    constantBuffers[bind.name].shadowData = cookedBuffer->second;
+                                }
+                                else if (isCookedBuffer)
+                                {
+                                    NAU_LOG_WARNING("The cooked constant buffer ({}) does not match the shader, the material should be recooked", bind.name);
+                                }
                             }
 
                             constantBuffers[bind.name].stages.insert(getStage(shaderAsset->getShader()->target));
 
                             for (const auto& var : bind.bufferDesc.variables)
                             {
-                                NAU_ASSERT(materialPipeline.properties.contains(var.name));
+                                NAU_ASSERT(isCookedBuffer || materialPipeline.properties.contains(var.name));
 
                                 properties[var.name] = {
                                     .reflection = &var,
                                     .parentBuffer = &constantBuffers[bind.name],
-                                    .currentValue = eastl::move(materialPipeline.properties.at(var.name)),
-                                    .masterValue = nullptr,
+                                    .currentValue = isCookedBuffer ? nullptr : eastl::move(materialPipeline.properties.at(var.name)),
+                                    .masterVariable = nullptr,
                                     .isMasterValue = false};
                             }
                         }
@@ -1392,42 +1751,7 @@ namespace nau
                         }
                         if (bind.dimension != SrvDimension::Buffer)
                         {
-                            auto property = materialPipeline.properties.at(bind.name);
-                            if (property->is<RuntimeStringValue>())
-                            {
-                                textureLoaders.emplace_back([](eastl::string bindName, uint32_t bindPoint, eastl::string texName, ShaderAssetView* shader) -> async::Task<TextureLoadingResult>
-                                {
-                                    MaterialAssetRef texAssetRef = AssetPath{texName};
-                                    auto texAsset = co_await texAssetRef.getReloadableAssetViewTyped<TextureAssetView>();
-
-                                    co_return TextureLoadingResult{
-                                        .bindName = std::move(bindName),
-
-                                        .texture = TextureCache{
-                                                                .textureView = texAsset,
-                                                                .texture = nullptr,
-                                                                .slot = bindPoint,
-                                                                .isOwned = false},
-                                        .shader = shader
-                                    };
-                                }(bind.name, bind.bindPoint, *runtimeValueCast<eastl::string>(property), shaderAsset.get()));
-
-                                // continue;
-                            }
-                            else if (property->is<RuntimeReadonlyCollection>())
-                            {
-                                const auto color = *runtimeValueCast<math::Vector4>(property);
-                                TextureCache texCache{
-                                    .texture = generateSolidColorTexture(color),
-                                    .slot = bind.bindPoint,
-                                    .isOwned = true};
-
-                                addTexture(*shaderAsset, bind.name, std::move(texCache));
-                            }
-                            else
-                            {
-                                NAU_FAILURE_ALWAYS("Invalid texture property");
-                            }
+                            loadTexture(shaderAsset.get(), bind.name, bind.bindPoint, false);
                         }
                         break;
                     }
@@ -1445,13 +1769,29 @@ namespace nau
             }
         }
 
+        // The textures not bound by the shaders but indexed by the `<texture>BindlessIndex` properties are read from the bindless heap.
+        for (const auto& [name, property] : properties)
+        {
+            const eastl::string_view propertyName = name;
+            if (!propertyName.ends_with(BindlessIndexSuffix))
+            {
+                continue;
+            }
+
+            const eastl::string textureName{propertyName.substr(0, propertyName.size() - BindlessIndexSuffix.size())};
+            if (!loadedTextures.contains(textureName) && materialPipeline.properties.contains(textureName))
+            {
+                loadTexture(nullptr, textureName, 0, true);
+            }
+        }
+
         if (!textureLoaders.empty())
         {
             co_await async::whenAll(textureLoaders);
             for (async::Task<TextureLoadingResult>& t : textureLoaders)
             {
                 TextureLoadingResult textureResult = *std::move(t);
-                addTexture(*textureResult.shader, std::move(textureResult.bindName), std::move(textureResult.texture));
+                addTexture(textureResult.shader, std::move(textureResult.bindName), std::move(textureResult.texture));
             }
         }
 
@@ -1498,7 +1838,7 @@ namespace nau
                     .reflection = property.reflection,
                     .parentBuffer = nullptr,
                     .currentValue = eastl::move(materialPipeline.properties.at(name)),
-                    .masterValue = nullptr,
+                    .masterVariable = &property,
                     .isMasterValue = false};
             }
             else
@@ -1507,7 +1847,7 @@ namespace nau
                     .reflection = property.reflection,
                     .parentBuffer = nullptr,
                     .currentValue = nullptr,
-                    .masterValue = &property.currentValue,
+                    .masterVariable = &property,
                     .isMasterValue = true};
             }
         }
@@ -1583,6 +1923,7 @@ namespace nau
                 }
 
                 textures[name].stages = tex.stages;
+                textures[name].isBindless = tex.isBindless;
             }
             else
             {
@@ -1592,6 +1933,7 @@ namespace nau
                 t.stages = tex.stages;
                 t.slot = tex.slot;
                 t.isOwned = false;
+                t.isBindless = tex.isBindless;
             }
         }
 
@@ -1737,9 +2079,9 @@ namespace nau
         }
     }
 
-    void MaterialAssetView::updateBuffers(eastl::string_view pipelineName)
+    void MaterialAssetView::updateBuffers(NameId pipelineName)
     {
-        auto& pipeline = m_pipelines[pipelineName.data()];
+        auto& pipeline = getPipeline(pipelineName);
 
         for (auto& [name, cb] : pipeline.constantBuffers)
         {
@@ -1748,189 +2090,21 @@ namespace nau
                 continue;
             }
 
-            Sbuffer* buf = cb.buffer;
-
-            std::byte* data = nullptr;
-            buf->lock(0, cb.reflection->bufferDesc.size, reinterpret_cast<void**>(&data), VBLOCK_WRITEONLY | VBLOCK_DISCARD);
-            NAU_ASSERT(buf);
-
-            for (const auto& var : cb.reflection->bufferDesc.variables)
-            {
-                auto& property = pipeline.properties[var.name];
-
-                switch (var.type.svc)
-                {
-                    case ShaderVariableClass::Scalar:
-                    {
-                        switch (var.type.svt)
-                        {
-                            case ShaderVariableType::Int:
-                            {
-                                auto value = property.isMasterValue
-                                                 ? *runtimeValueCast<int32_t>(*property.masterValue)
-                                                 : *runtimeValueCast<int32_t>(property.currentValue);
-
-                                memcpy(data + var.startOffset, &value, sizeof(value));
-                                break;
-                            }
-                            case ShaderVariableType::Uint:
-                            {
-                                auto value = property.isMasterValue
-                                                 ? *runtimeValueCast<uint32_t>(*property.masterValue)
-                                                 : *runtimeValueCast<uint32_t>(property.currentValue);
+            NAU_ASSERT(cb.shadowData.size() == cb.reflection->bufferDesc.size);
 
-                                memcpy(data + var.startOffset, &value, sizeof(value));
-                                break;
-                            }
-                            case ShaderVariableType::Float:
-                            {
-                                auto value = property.isMasterValue
-                                                 ? *runtimeValueCast<float>(*property.masterValue)
-                                                 : *runtimeValueCast<float>(property.currentValue);
+            // The whole buffer is rewritten with the discard: one copy of the compiled data.
+            const bool isUpdated = cb.buffer->updateData(0, cb.shadowData.size(), cb.shadowData.data(), VBLOCK_WRITEONLY | VBLOCK_DISCARD);
+            NAU_ASSERT(isUpdated);
 
-                                memcpy(data + var.startOffset, &value, sizeof(value));
-                                break;
-                            }
-                            default:
-                                NAU_FAILURE_ALWAYS("Not implemented");
-                        }
-                        break;
-                    }
-                    case ShaderVariableClass::Vector:
-                    {
-                        switch (var.type.svt)
-                        {
-                            case ShaderVariableType::Float:
-                            {
-                                switch (var.type.columns)
-                                {
-                                    case 2:
-                                    {
-                                        auto value = property.isMasterValue
-                                                         ? *runtimeValueCast<math::Vector2>(*property.masterValue)
-                                                         : *runtimeValueCast<math::Vector2>(property.currentValue);
-
-                                        memcpy(data + var.startOffset, &value, sizeof(value));
-                                        break;
-                                    }
-                                    case 3:
-                                    {
-                                        auto value = property.isMasterValue
-                                                         ? *runtimeValueCast<math::Vector3>(*property.masterValue)
-                                                         : *runtimeValueCast<math::Vector3>(property.currentValue);
-
-                                        memcpy(data + var.startOffset, &value, sizeof(value));
-                                        break;
-                                    }
-                                    case 4:
-                                    {
-                                        auto value = property.isMasterValue
-                                                         ? *runtimeValueCast<math::Vector4>(*property.masterValue)
-                                                         : *runtimeValueCast<math::Vector4>(property.currentValue);
-
-                                        memcpy(data + var.startOffset, &value, sizeof(value));
-                                        break;
-                                    }
-                                    default:
-                                        NAU_FAILURE_ALWAYS("Not implemented");
-                                }
-                                break;
-                            }
-                            case ShaderVariableType::Int:
-                            case ShaderVariableType::Uint:
-                            {
-                                switch (var.type.columns)
-                                {
-                                    case 2:
-                                    {
-                                        auto value = property.isMasterValue
-                                                         ? *runtimeValueCast<math::IVector2>(*property.masterValue)
-                                                         : *runtimeValueCast<math::IVector2>(property.currentValue);
-
-                                        memcpy(data + var.startOffset, &value, sizeof(value));
-                                        break;
-                                    }
-                                    case 3:
-                                    {
-                                        auto value = property.isMasterValue
-                                                         ? *runtimeValueCast<math::IVector3>(*property.masterValue)
-                                                         : *runtimeValueCast<math::IVector3>(property.currentValue);
-
-                                        memcpy(data + var.startOffset, &value, sizeof(value));
-                                        break;
-                                    }
-                                    case 4:
-                                    {
-                                        auto value = property.isMasterValue
-                                                         ? *runtimeValueCast<math::IVector4>(*property.masterValue)
-                                                         : *runtimeValueCast<math::IVector4>(property.currentValue);
-
-                                        memcpy(data + var.startOffset, &value, sizeof(value));
-                                        break;
-                                    }
-                                    default:
-                                        NAU_FAILURE_ALWAYS("Not implemented");
-                                }
-                                break;
-                            }
-                            default:
-                                NAU_FAILURE_ALWAYS("Not implemented");
-                        }
-                        break;
-                    }
-                    case ShaderVariableClass::MatrixColumns:
-                    {
-                        NAU_ASSERT(var.type.columns == var.type.rows);
-
-                        switch (var.type.svt)
-                        {
-                            case ShaderVariableType::Float:
-                            {
-                                switch (var.type.columns)
-                                {
-                                    case 3:
-                                    {
-                                        auto value = property.isMasterValue
-                                                         ? *runtimeValueCast<math::Matrix3>(*property.masterValue)
-                                                         : *runtimeValueCast<math::Matrix3>(property.currentValue);
-
-                                        memcpy(data + var.startOffset, &value, sizeof(value));
-                                        break;
-                                    }
-                                    case 4:
-                                    {
-                                        auto value = property.isMasterValue
-                                                         ? *runtimeValueCast<math::Matrix4>(*property.masterValue)
-                                                         : *runtimeValueCast<math::Matrix4>(property.currentValue);
-
-                                        memcpy(data + var.startOffset, &value, sizeof(value));
-                                        break;
-                                    }
-                                    default:
-                                        NAU_FAILURE_ALWAYS("Not implemented");
-                                }
-                                break;
-                            }
-                            default:
-                                NAU_FAILURE_ALWAYS("Not implemented");
-                        }
-                        break;
-                    }
-                    default:
-                        NAU_FAILURE_ALWAYS("Not implemented");
-                }
-            }
-
-            buf->unlock();
             cb.isDirty = false;
         }
 
         pipeline.isDirty = false;
     }
 
-    void MaterialAssetView::updateRenderState(eastl::string_view pipelineName)
+    void MaterialAssetView::updateRenderState(NameId pipelineName)
     {
-        auto& pipeline = m_pipelines[pipelineName.data()];
+        auto& pipeline = getPipeline(pipelineName);
 
         shaders::RenderState renderState;
 
@@ -1985,10 +2159,70 @@ namespace nau
         return false;
     }
 
+    bool MaterialAssetView::isInstanceProperty(eastl::string_view propertyName) const
+    {
+        return eastl::any_of(m_instanceProperties.begin(), m_instanceProperties.end(), [propertyName](const eastl::string& name)
+        {
+            return eastl::string_view{name} == propertyName;
+        });
+    }
+
+    void MaterialAssetView::getInstanceParams(InstanceParams& params) const
+    {
+        params.fill(math::Vector4::zero());
+
+        for (size_t i = 0; i < m_instanceProperties.size(); ++i)
+        {
+            for (const auto& [name, pipeline] : m_pipelines)
+            {
+                const auto propertyIter = pipeline.properties.find(m_instanceProperties[i]);
+                if (propertyIter == pipeline.properties.end())
+                {
+                    continue;
+                }
+
+                const ConstantBufferVariable* variable = &propertyIter->second;
+                if (variable->isMasterValue)
+                {
+                    variable = variable->masterVariable;
+                }
+
+                const ShaderVariableDescription& var = *variable->reflection;
+                float value[4] = {};
+                memcpy(value, variable->parentBuffer->shadowData.data() + var.startOffset, eastl::min<size_t>(sizeof(value), var.size));
+                params[i] = math::Vector4{value[0], value[1], value[2], value[3]};
+                break;
+            }
+        }
+    }
+
+    void MaterialAssetView::requestTextureLevel(uint32_t level) const
+    {
+        for (const auto& [name, pipeline] : m_pipelines)
+        {
+            for (const auto& [texName, tex] : pipeline.samplerTextures)
+            {
+                if (tex.textureView == nullptr)
+                {
+                    continue;
+                }
+
+                nau::Ptr<TextureAssetView> textureViewPtr;
+                tex.textureView->getTyped<TextureAssetView>(textureViewPtr);
+                if (textureViewPtr->isStreamed())
+                {
+                    textureViewPtr->requestLevel(level);
+                }
+            }
+        }
+    }
+
     MasterMaterialAssetView::~MasterMaterialAssetView()
     {
         for (auto& [name, pipeline] : m_pipelines)
         {
+            releaseBindlessTextures(pipeline);
+
             for (auto& [bufName, cb] : pipeline.constantBuffers)
             {
                 if (cb.buffer != nullptr)
@@ -2077,31 +2311,42 @@ namespace nau
             materialAssetView->m_pipelines[result.name].programID = ShaderAssetView::makeShaderProgram(result.shaders);
             materialAssetView->m_pipelines[result.name].shaders = eastl::move(result.shaders);
 
+            compileConstantBuffers(materialAssetView->m_pipelines[result.name]);
+            materialAssetView->m_pipelinesByHash.emplace(NameId::hashName(result.name), &materialAssetView->m_pipelines[result.name]);
             materialAssetView->updateBuffers(result.name);
             materialAssetView->updateRenderState(result.name);
         }
 
         materialAssetView->m_defaultProgram = materialAssetView->m_pipelines.begin()->first;
+        materialAssetView->m_defaultProgramId = materialAssetView->m_defaultProgram;
         materialAssetView->m_name = eastl::move(material.name);
         materialAssetView->m_nameHash = nau::strings::constHash(materialAssetView->m_name.data());
+        materialAssetView->m_batchHash = materialAssetView->m_nameHash;
+
+        if (material.instanceProperties.size() > MaxInstanceParams)
+        {
+            NAU_LOG_ERROR("The material ({}) declares {} per-instance properties, only the first {} are used",
+                materialAssetView->m_name, material.instanceProperties.size(), MaxInstanceParams);
+            material.instanceProperties.resize(MaxInstanceParams);
+        }
+        materialAssetView->m_instanceProperties = eastl::move(material.instanceProperties);
 
         co_return materialAssetView;
     }
 
     void MasterMaterialAssetView::bind()
     {
-        bindPipeline(m_defaultProgram);
+        bindPipeline(m_defaultProgramId);
     }
 
-    void MasterMaterialAssetView::bindPipeline(eastl::string_view pipelineName)
+    void MasterMaterialAssetView::bindPipeline(NameId pipelineName)
     {
-        NAU_ASSERT(m_pipelines.contains(pipelineName));
-
-        auto& pipeline = m_pipelines[pipelineName.data()];
+        auto& pipeline = getPipeline(pipelineName);
 
         d3d::set_program(pipeline.programID);
 
         setGlobals(pipelineName);
+        updateBindlessTextures(pipeline);
 
         if (pipeline.isDirty)
         {
@@ -2189,16 +2434,80 @@ namespace nau
         }
     }
 
-    PROGRAM MasterMaterialAssetView::getPipelineProgram(eastl::string_view pipelineName) const
+    void MasterMaterialAssetView::updatePipelineConstants(NameId pipelineName)
     {
-        NAU_ASSERT(m_pipelines.contains(pipelineName));
-        return m_pipelines.at(pipelineName.data()).programID;
+        auto& pipeline = getPipeline(pipelineName);
+        if (pipeline.isRenderStateDirty)
+        {
+            bindPipeline(pipelineName);
+            return;
+        }
+
+        setGlobals(pipelineName);
+
+        // The constant buffers are updated in place, their bindings are kept.
+        if (pipeline.isDirty)
+        {
+            updateBuffers(pipelineName);
+        }
     }
 
-    void MasterMaterialAssetView::setGlobals(eastl::string_view pipelineName)
+    PROGRAM MasterMaterialAssetView::getPipelineProgram(NameId pipelineName) const
+    {
+        return getPipeline(pipelineName).programID;
+    }
+
+    void MasterMaterialAssetView::setGlobals(NameId pipelineName)
     {
         static constexpr auto alignment = 16;
-        auto& pipeline = m_pipelines[pipelineName.data()];
+        auto& pipeline = getPipeline(pipelineName);
+
+        if (!pipeline.hasGlobalBuffers)
+        {
+            buildGlobalBuffers(pipeline);
+            pipeline.hasGlobalBuffers = true;
+        }
+
+        const uint64_t revision = shader_globals::getRevision();
+        for (auto& globalBuffer : pipeline.globalBuffers)
+        {
+            // Only the variables modified since the previous bind are copied.
+            if (globalBuffer.revision != revision)
+            {
+                for (const auto& var : globalBuffer.variables)
+                {
+                    if (shader_globals::getVariableRevision(var.id) <= globalBuffer.revision)
+                    {
+                        continue;
+                    }
+
+                    void* value = nullptr;
+                    size_t size = 0;
+                    shader_globals::getVariable(var.id, &size, &value);
+                    memcpy(globalBuffer.data.data() + var.offset, value, size);
+                }
+
+                globalBuffer.revision = revision;
+            }
+
+            const unsigned regCount = std::max(1U, static_cast<unsigned>(globalBuffer.data.size() / alignment));
+
+            if (globalBuffer.target == ShaderTarget::Vertex)
+            {
+                d3d::set_vs_constbuffer_size(regCount);
+            }
+            else if (globalBuffer.target == ShaderTarget::Compute)
+            {
+                d3d::set_cs_constbuffer_size(regCount);
+            }
+
+            d3d::set_const(getStage(globalBuffer.target), globalBuffer.bindPoint, globalBuffer.data.data(), regCount);
+        }
+    }
+
+    void MasterMaterialAssetView::buildGlobalBuffers(Pipeline& pipeline)
+    {
+        pipeline.globalBuffers.clear();
 
         for (const auto& shaderAsset : pipeline.shaders)
         {
@@ -2210,137 +2519,20 @@ namespace nau
                     continue;
                 }
 
-                eastl::vector<std::byte> buffer;
-                buffer.resize(bind.bufferDesc.size);
+                GlobalBufferCache& globalBuffer = pipeline.globalBuffers.push_back();
+                globalBuffer.data.resize(bind.bufferDesc.size);
+                globalBuffer.target = shaderAsset->getShader()->target;
+                globalBuffer.bindPoint = bind.bindPoint;
 
                 for (const auto& var : bind.bufferDesc.variables)
                 {
-                    if (var.type.elements > 0 || var.type.svc == ShaderVariableClass::Struct)
-                    {
-                        void* value = nullptr;
-                        size_t size = 0;
-                        shader_globals::getVariable(var.name, &size, &value);
-                        memcpy(buffer.data() + var.startOffset, value, size);
+                    checkGlobalVariableType(var.type);
 
-                        continue;
-                    }
+                    const shader_globals::GlobalVarId id = shader_globals::getVariableId(var.name);
+                    NAU_FATAL(id != shader_globals::InvalidGlobalVarId, "Global shader variable not found: {}", var.name);
 
-                    switch (var.type.svc)
-                    {
-                        case ShaderVariableClass::Scalar:
-                        {
-                            switch (var.type.svt)
-                            {
-                                case ShaderVariableType::Int:
-                                case ShaderVariableType::Uint:
-                                case ShaderVariableType::Float:
-                                {
-                                    void* value = nullptr;
-                                    size_t size = 0;
-                                    shader_globals::getVariable(var.name, &size, &value);
-                                    memcpy(buffer.data() + var.startOffset, value, size);
-                                    break;
-                                }
-                                default:
-                                    NAU_FAILURE_ALWAYS("Not implemented");
-                            }
-                            break;
-                        }
-                        case ShaderVariableClass::Vector:
-                        {
-                            switch (var.type.svt)
-                            {
-                                case ShaderVariableType::Float:
-                                {
-                                    switch (var.type.columns)
-                                    {
-                                        case 2:
-                                        case 3:
-                                        case 4:
-                                        {
-                                            void* value = nullptr;
-                                            size_t size = 0;
-                                            shader_globals::getVariable(var.name, &size, &value);
-                                            memcpy(buffer.data() + var.startOffset, value, size);
-                                            break;
-                                        }
-                                        default:
-                                            NAU_FAILURE_ALWAYS("Not implemented");
-                                    }
-                                    break;
-                                }
-                                case ShaderVariableType::Int:
-                                case ShaderVariableType::Uint:
-                                {
-                                    switch (var.type.columns)
-                                    {
-                                        case 2:
-                                        case 3:
-                                        case 4:
-                                        {
-                                            void* value = nullptr;
-                                            size_t size = 0;
-                                            shader_globals::getVariable(var.name, &size, &value);
-                                            memcpy(buffer.data() + var.startOffset, value, size);
-                                            break;
-                                        }
-                                        default:
-                                            NAU_FAILURE_ALWAYS("Not implemented");
-                                    }
-                                    break;
-                                }
-                                default:
-                                    NAU_FAILURE_ALWAYS("Not implemented");
-                            }
-                            break;
-                        }
-                        case ShaderVariableClass::MatrixColumns:
-                        {
-                            NAU_ASSERT(var.type.columns == var.type.rows);
-
-                            switch (var.type.svt)
-                            {
-                                case ShaderVariableType::Float:
-                                {
-                                    switch (var.type.columns)
-                                    {
-                                        case 3:
-                                        case 4:
-                                        {
-                                            void* value = nullptr;
-                                            size_t size = 0;
-                                            shader_globals::getVariable(var.name, &size, &value);
-                                            memcpy(buffer.data() + var.startOffset, value, size);
-                                            break;
-                                        }
-                                        default:
-                                            NAU_FAILURE_ALWAYS("Not implemented");
-                                    }
-                                    break;
-                                }
-                                default:
-                                    NAU_FAILURE_ALWAYS("Not implemented");
-                            }
-                            break;
-                        }
-                        default:
-                            NAU_FAILURE_ALWAYS("Not implemented");
-                    }
-                }
-
-                const ShaderTarget shaderTarget = shaderAsset->getShader()->target;
-                const unsigned regCount = std::max(1U, static_cast<unsigned>(buffer.size() / alignment));
-
-                if (shaderTarget == ShaderTarget::Vertex)
-                {
-                    d3d::set_vs_constbuffer_size(regCount);
-                }
-                else if (shaderTarget == ShaderTarget::Compute)
-                {
-                    d3d::set_cs_constbuffer_size(regCount);
+                    globalBuffer.variables.push_back({id, var.startOffset});
                 }
-
-                d3d::set_const(getStage(shaderTarget), bind.bindPoint, buffer.data(), regCount);
             }
         }
     }
@@ -2349,6 +2541,8 @@ namespace nau
     {
         for (auto& [name, pipeline] : m_pipelines)
         {
+            releaseBindlessTextures(pipeline);
+
             for (auto& [bufName, cb] : pipeline.constantBuffers)
             {
                 if (cb.buffer != nullptr)
@@ -2398,6 +2592,21 @@ namespace nau
         MaterialAssetRef masterAssetRef = AssetPath{*material.master};
         materialAssetView->m_masterMaterial = co_await masterAssetRef.getAssetViewTyped<MaterialAssetView>();
 
+        materialAssetView->m_instanceProperties = materialAssetView->m_masterMaterial->m_instanceProperties;
+
+        // The instance is drawn together with the master if it overrides the per-instance properties only.
+        bool isBatchedWithMaster = true;
+        for (const auto& [name, pipeline] : material.pipelines)
+        {
+            const bool hasRenderState = pipeline.cullMode || pipeline.depthMode || pipeline.blendMode || pipeline.isScissorsEnabled || pipeline.stencilCmpFunc;
+            const bool hasSharedProperties = eastl::any_of(pipeline.properties.begin(), pipeline.properties.end(), [&materialAssetView](const auto& property)
+            {
+                return !materialAssetView->isInstanceProperty(property.first);
+            });
+
+            isBatchedWithMaster = isBatchedWithMaster && !hasRenderState && !hasSharedProperties;
+        }
+
         materialAssetView->m_pipelines.reserve(materialAssetView->m_masterMaterial->m_pipelines.size());
         for (auto& [name, pipeline] : materialAssetView->m_masterMaterial->m_pipelines)
         {
@@ -2411,28 +2620,28 @@ namespace nau
                 materialAssetView->m_pipelines[name] = pipeline;
             }
 
+            compileConstantBuffers(materialAssetView->m_pipelines[name]);
+            materialAssetView->m_pipelinesByHash.emplace(NameId::hashName(name), &materialAssetView->m_pipelines[name]);
             materialAssetView->updateBuffers(name);
             materialAssetView->updateRenderState(name);
         }
 
         materialAssetView->m_name = eastl::move(material.name);
         materialAssetView->m_nameHash = nau::strings::constHash(materialAssetView->m_name.data());
+        materialAssetView->m_batchHash = isBatchedWithMaster ? materialAssetView->m_masterMaterial->getBatchHash() : materialAssetView->m_nameHash;
 
         co_return materialAssetView;
     }
 
     void MaterialInstanceAssetView::bind()
     {
-        bindPipeline(m_masterMaterial->m_defaultProgram);
+        bindPipeline(m_masterMaterial->m_defaultProgramId);
     }
 
-    void MaterialInstanceAssetView::bindPipeline(eastl::string_view pipelineName)
+    void MaterialInstanceAssetView::bindPipeline(NameId pipelineName)
     {
-        NAU_ASSERT(m_masterMaterial->m_pipelines.contains(pipelineName));
-        NAU_ASSERT(m_pipelines.contains(pipelineName));
-
-        auto& masterPipeline = m_masterMaterial->m_pipelines[pipelineName.data()];
-        auto& instancePipeline = m_pipelines[pipelineName.data()];
+        auto& masterPipeline = m_masterMaterial->getPipeline(pipelineName);
+        auto& instancePipeline = getPipeline(pipelineName);
 
         d3d::set_program(masterPipeline.programID);
 
@@ -2440,6 +2649,7 @@ namespace nau
 
         syncBuffers(masterPipeline, instancePipeline);
         syncTextures(masterPipeline, instancePipeline);
+        updateBindlessTextures(instancePipeline);
 
         if (instancePipeline.isDirty)
         {
@@ -2553,7 +2763,27 @@ namespace nau
         }
     }
 
-    PROGRAM MaterialInstanceAssetView::getPipelineProgram(eastl::string_view pipelineName) const
+    void MaterialInstanceAssetView::updatePipelineConstants(NameId pipelineName)
+    {
+        auto& masterPipeline = m_masterMaterial->getPipeline(pipelineName);
+        auto& instancePipeline = getPipeline(pipelineName);
+        if (instancePipeline.isRenderStateDirty)
+        {
+            bindPipeline(pipelineName);
+            return;
+        }
+
+        m_masterMaterial->setGlobals(pipelineName);
+
+        syncBuffers(masterPipeline, instancePipeline);
+
+        if (instancePipeline.isDirty)
+        {
+            updateBuffers(pipelineName);
+        }
+    }
+
+    PROGRAM MaterialInstanceAssetView::getPipelineProgram(NameId pipelineName) const
     {
         NAU_ASSERT(m_masterMaterial);
         return m_masterMaterial->getPipelineProgram(pipelineName);
@@ -2572,6 +2802,9 @@ namespace nau
 
             if (instProperty.isMasterValue)
             {
+                const ShaderVariableDescription& var = *instProperty.reflection;
+                memcpy(instProperty.parentBuffer->shadowData.data() + var.startOffset, property.parentBuffer->shadowData.data() + var.startOffset, var.size);
+
                 instProperty.timestamp = property.timestamp;
                 instProperty.parentBuffer->isDirty = true;
 
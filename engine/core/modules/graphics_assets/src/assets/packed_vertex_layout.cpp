@@ -0,0 +1,159 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#include "graphics_assets/packed_vertex_layout.h"
+
+#include <EASTL/bit.h>
+
+#include <cmath>
+
+#include "nau/app/global_properties.h"
+#include "nau/service/service_provider.h"
+
+
+namespace nau
+{
+    namespace
+    {
+        int16_t toSnorm16(float value)
+        {
+            return static_cast<int16_t>(std::lrint(eastl::clamp(value, -1.f, 1.f) * 32767.f));
+        }
+
+        // Round to the nearest even, the out of range values become the infinities.
+        uint16_t toHalf(float value)
+        {
+            const uint32_t bits = eastl::bit_cast<uint32_t>(value);
+            const uint16_t sign = static_cast<uint16_t>((bits >> 16) & 0x8000);
+            const uint32_t absBits = bits & 0x7fffffff;
+
+            if (absBits >= 0x47800000)
+            {
+                return sign | (absBits > 0x7f800000 ? 0x7e00 : 0x7c00);
+            }
+
+            if (absBits < 0x38800000)
+            {
+                // The subnormal halfs are the multiples of 2^-24.
+                return sign | static_cast<uint16_t>(std::lrint(eastl::bit_cast<float>(absBits) * 16777216.f));
+            }
+
+            uint32_t half = (absBits - 0x38000000) >> 13;
+            const uint32_t rest = absBits & 0x1fff;
+            if (rest > 0x1000 || (rest == 0x1000 && (half & 1)))
+            {
+                ++half;
+            }
+
+            return sign | static_cast<uint16_t>(half);
+        }
+
+        nau::math::Vector2 encodeOctahedral(nau::math::Vector3 direction)
+        {
+            const float l1 = std::abs(direction.getX()) + std::abs(direction.getY()) + std::abs(direction.getZ());
+            if (l1 <= FLT_EPSILON)
+            {
+                return {1.f, 0.f};
+            }
+
+            const float x = direction.getX() / l1;
+            const float y = direction.getY() / l1;
+            if (direction.getZ() >= 0.f)
+            {
+                return {x, y};
+            }
+
+            // The lower hemisphere is folded over the diagonals.
+            return {
+                (1.f - std::abs(y)) * (x >= 0.f ? 1.f : -1.f),
+                (1.f - std::abs(x)) * (y >= 0.f ? 1.f : -1.f)};
+        }
+    }  // namespace
+
+    bool isPackedVertexLayoutEnabled()
+    {
+        static const bool isEnabled = []
+        {
+            if (!getServiceProvider().has<GlobalProperties>())
+            {
+                return false;
+            }
+
+            return getServiceProvider().get<GlobalProperties>().getValue<bool>("/graphics/packedVertexLayout").value_or(false);
+        }();
+
+        return isEnabled;
+    }
+
+    void packVertexAttributes(eastl::span<const nau::math::float3> normals,
+                              eastl::span<const nau::math::float4> tangents,
+                              eastl::span<const nau::math::float2> texcoords,
+                              eastl::span<PackedVertexAttributes> output)
+    {
+        NAU_ASSERT(normals.size() == output.size() && texcoords.size() == output.size());
+        NAU_ASSERT(tangents.empty() || tangents.size() == output.size());
+
+        for (size_t i = 0; i < output.size(); ++i)
+        {
+            PackedVertexAttributes& packed = output[i];
+
+            const nau::math::Vector2 normal = encodeOctahedral({normals[i].x, normals[i].y, normals[i].z});
+            packed.normal[0] = toSnorm16(normal.getX());
+            packed.normal[1] = toSnorm16(normal.getY());
+
+            const nau::math::float4 tangent = tangents.empty() ? nau::math::float4{1.f, 0.f, 0.f, 1.f} : tangents[i];
+            const nau::math::Vector2 octTangent = encodeOctahedral({tangent.x, tangent.y, tangent.z});
+            // The magnitude is kept off zero, so the sign survives the quantization.
+            const float tangentY = eastl::max(octTangent.getY() * 0.5f + 0.5f, 1.f / 32767.f);
+            packed.tangent[0] = toSnorm16(octTangent.getX());
+            packed.tangent[1] = toSnorm16(tangent.w < 0.f ? -tangentY : tangentY);
+
+            packed.texcoord[0] = toHalf(texcoords[i].x);
+            packed.texcoord[1] = toHalf(texcoords[i].y);
+        }
+    }
+
+    Sbuffer* createPackedAttributesBuffer(Sbuffer* normals, Sbuffer* tangents, Sbuffer* texcoords, uint32_t vertexCount)
+    {
+        NAU_ASSERT(normals && texcoords);
+        if (vertexCount == 0)
+        {
+            return nullptr;
+        }
+
+        const size_t packedBufferSize = vertexCount * sizeof(PackedVertexAttributes);
+        Sbuffer* packedBuffer = d3d::create_vb(packedBufferSize, SBCF_DYNAMIC, u8"packedAttribsBuf");
+        NAU_ASSERT(packedBuffer);
+
+        std::byte* nrmMem = nullptr;
+        normals->lock(0, vertexCount * sizeof(nau::math::float3), reinterpret_cast<void**>(&nrmMem), VBLOCK_READONLY);
+
+        std::byte* tangentMem = nullptr;
+        if (tangents)
+        {
+            tangents->lock(0, vertexCount * sizeof(nau::math::float4), reinterpret_cast<void**>(&tangentMem), VBLOCK_READONLY);
+        }
+
+        std::byte* texMem = nullptr;
+        texcoords->lock(0, vertexCount * sizeof(nau::math::float2), reinterpret_cast<void**>(&texMem), VBLOCK_READONLY);
+
+        std::byte* packedMem = nullptr;
+        packedBuffer->lock(0, packedBufferSize, reinterpret_cast<void**>(&packedMem), VBLOCK_WRITEONLY);
+
+        packVertexAttributes({reinterpret_cast<const nau::math::float3*>(nrmMem), vertexCount},
+                             tangentMem ? eastl::span<const nau::math::float4>{reinterpret_cast<const nau::math::float4*>(tangentMem), vertexCount} : eastl::span<const nau::math::float4>{},
+                             {reinterpret_cast<const nau::math::float2*>(texMem), vertexCount},
+                             {reinterpret_cast<PackedVertexAttributes*>(packedMem), vertexCount});
+
+        packedBuffer->unlock();
+        texcoords->unlock();
+        if (tangents)
+        {
+            tangents->unlock();
+        }
+        normals->unlock();
+
+        return packedBuffer;
+    }
+
+} // namespace nau
@@ -2,8 +2,10 @@
 // Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
 
 #include "graphics_assets/skinned_mesh_asset.h"
+#include "graphics_assets/packed_vertex_layout.h"
 #include "nau/assets/asset_ref.h"
 #include "nau/assets/mesh_asset_accessor.h"
+#include "nau/shaders/shader_defines.h"
 
 namespace nau
 {
@@ -58,7 +60,7 @@ namespace nau
             co_return std::tuple{std::move(ibuf), bufferSize};
         }(meshAccessor, meshDesc);
 
-        auto vertexBufferTask = [](IMeshAssetAccessor& accessor, const MeshDescription& meshDesc) -> Task<std::tuple<Sbuffer*, size_t, Sbuffer*, size_t, Sbuffer*, size_t, Sbuffer*, size_t, Sbuffer*, size_t, Sbuffer*, size_t>>
+        auto vertexBufferTask = [](IMeshAssetAccessor& accessor, const MeshDescription& meshDesc, nau::math::BBox3& localBox, eastl::vector<nau::math::BBox3>& bonesBoxes) -> Task<std::tuple<Sbuffer*, size_t, Sbuffer*, size_t, Sbuffer*, size_t, Sbuffer*, size_t, Sbuffer*, size_t, Sbuffer*, size_t>>
         {
             const size_t posBufferSize = meshDesc.vertexCount * sizeof(float[3]);
             const size_t nrmBufferSize = meshDesc.vertexCount * sizeof(float[3]);
@@ -179,11 +181,32 @@ namespace nau
                 boneIndicesDesc.outputBufferSize = boneIndicesBufferSize;
 
                 co_await accessor.copyVertAttribs(outLayout);
+
+                // The bounds are gathered before the buffers are unlocked.
+                const auto* const positions = reinterpret_cast<const nau::math::float3*>(posMem);
+                const auto* const weights = reinterpret_cast<const nau::math::float4*>(weightsMem);
+                const auto* const joints = reinterpret_cast<const uint32_t*>(jointsMem);
+                bonesBoxes.resize(NAU_MAX_SKINNING_BONES_COUNT);
+                for (size_t vertex = 0; vertex < meshDesc.vertexCount; ++vertex)
+                {
+                    const nau::math::Vector3 position{positions[vertex].x, positions[vertex].y, positions[vertex].z};
+                    localBox += position;
+
+                    const float vertexWeights[] = {weights[vertex].x, weights[vertex].y, weights[vertex].z, weights[vertex].w};
+                    for (size_t influence = 0; influence < 4; ++influence)
+                    {
+                        const uint32_t joint = joints[vertex * 4 + influence];
+                        if (vertexWeights[influence] > 0.f && joint < NAU_MAX_SKINNING_BONES_COUNT)
+                        {
+                            bonesBoxes[joint] += position;
+                        }
+                    }
+                }
             }
 
             co_return std::tuple{std::move(pbuf), posBufferSize, std::move(nbuf), nrmBufferSize, std::move(tangentbuf), tangentBufferSize, std::move(tbuf), texBufferSize
                 , std::move(weightsbuf), boneWeightsBufferSize, std::move(jointsbuf), boneIndicesBufferSize};
-        }(meshAccessor, meshDesc);
+        }(meshAccessor, meshDesc, lod0.m_localBBox, mesh->m_bonesBindBoxes);
 
         co_await async::whenAll(Expiration::never(), indexBufferTask, vertexBufferTask);
 
@@ -193,6 +216,10 @@ namespace nau
 
         lod0.m_vertexCount = meshDesc.vertexCount;
         lod0.m_indexCount  = meshDesc.indexCount;
+        if (!lod0.m_localBBox.isempty())
+        {
+            mesh->m_localBSphere = nau::math::BSphere3(lod0.m_localBBox.center(), nau::math::length(lod0.m_localBBox.width()) * 0.5f);
+        }
         lod0.m_indexBuffer  = indexBuffer;
   
         lod0.m_positionsBuffer = posBuffer;
@@ -202,10 +229,49 @@ namespace nau
         lod0.m_boneWeightsBuffer = weightsBuffer;
         lod0.m_boneIndicesBuffer = jointsBuffer;
 
+        if (isPackedVertexLayoutEnabled() && lod0.m_vertexCount != 0)
+        {
+            lod0.m_packedAttributesBuffer = createPackedAttributesBuffer(nrmBuffer, tangentsBuffer, texBuffer, lod0.m_vertexCount);
+
+            nrmBuffer->destroy();
+            tangentsBuffer->destroy();
+            texBuffer->destroy();
+            lod0.m_normalsBuffer = nullptr;
+            lod0.m_tangentsBuffer = nullptr;
+            lod0.m_texcoordsBuffer = nullptr;
+        }
+
         // load material
         static MaterialAssetRef m_defaultMaterial = AssetPath{"file:/res/materials/embedded/standard_skinned.nmat_json"};
         lod0.m_material = co_await m_defaultMaterial.getReloadableAssetViewTyped<MaterialAssetView>();
 
+        // The generated lods index the lod 0 vertices: they share the lod 0 vertex buffers (the skinning is done per vertex in the draw).
+        const eastl::vector<MeshLodDescription> lodDescriptions = meshAccessor.getLodDescriptions();
+        for (unsigned lodIndex = 0; lodIndex < lodDescriptions.size(); ++lodIndex)
+        {
+            const size_t bufferSize = lodDescriptions[lodIndex].indexCount * sizeof(uint16_t);
+            Sbuffer* const ibuf = d3d::create_ib(bufferSize, SBCF_DYNAMIC, u8"IndexBuf");
+
+            std::byte* mem = nullptr;
+            ibuf->lock(0, bufferSize, reinterpret_cast<void**>(&mem), VBLOCK_WRITEONLY);
+            const Result<> copyResult = meshAccessor.copyLodIndices(lodIndex, mem, bufferSize, ElementFormat::Uint16);
+            ibuf->unlock();
+
+            if (!copyResult)
+            {
+                NAU_LOG_WARNING("The skinned mesh lod {} is not loaded: {}", lodIndex + 1, copyResult.getError()->getMessage());
+                ibuf->destroy();
+                break;
+            }
+
+            SkinnedMeshLod lod = mesh->lods.front();
+            lod.m_indexBuffer = ibuf;
+            lod.m_indexCount = lodDescriptions[lodIndex].indexCount;
+
+            mesh->lods.push_back(lod);
+            mesh->m_lodsScreenSpaceError.push_back(lodDescriptions[lodIndex].screenSize);
+        }
+
         co_return mesh;
     }
 
@@ -3,6 +3,7 @@
 
 #include "graphics_assets/static_mesh_asset.h"
 
+#include "graphics_assets/packed_vertex_layout.h"
 #include "nau/assets/mesh_asset_accessor.h"
 
 
@@ -24,89 +25,64 @@ namespace nau
         co_return meshAssetView;
     }
 
-    Sbuffer* StaticMeshAssetView::getPositionsBuffer() const
+    Sbuffer* StaticMeshAssetView::getPositionsBuffer(uint32_t lodIndex) const
     {
-        return m_mesh->getLod(0).m_positionsBuffer;
+        return m_mesh->getLod(lodIndex).m_positionsBuffer;
     }
 
-    Sbuffer* StaticMeshAssetView::getNormalsBuffer() const
+    Sbuffer* StaticMeshAssetView::getNormalsBuffer(uint32_t lodIndex) const
     {
-        return m_mesh->getLod(0).m_normalsBuffer;
+        return m_mesh->getLod(lodIndex).m_normalsBuffer;
     }
 
-    Sbuffer* StaticMeshAssetView::getTangentsBuffer() const
+    Sbuffer* StaticMeshAssetView::getTangentsBuffer(uint32_t lodIndex) const
     {
-        return m_mesh->getLod(0).m_tangentsBuffer;
+        return m_mesh->getLod(lodIndex).m_tangentsBuffer;
     }
 
-    Sbuffer* StaticMeshAssetView::getTexcoordsBuffer() const
+    Sbuffer* StaticMeshAssetView::getTexcoordsBuffer(uint32_t lodIndex) const
     {
-        return m_mesh->getLod(0).m_texCoordsBuffer;
+        return m_mesh->getLod(lodIndex).m_texCoordsBuffer;
     }
 
-    Sbuffer* StaticMeshAssetView::getIndexBuffer() const
+    Sbuffer* StaticMeshAssetView::getIndexBuffer(uint32_t lodIndex) const
     {
-        return m_mesh->getLod(0).m_indexBuffer;
+        return m_mesh->getLod(lodIndex).m_indexBuffer;
     }
 
-    unsigned StaticMeshAssetView::getIndexCount() const
+    unsigned StaticMeshAssetView::getIndexCount(uint32_t lodIndex) const
     {
-        return m_mesh->getLod(0).m_indexCount;
+        return m_mesh->getLod(lodIndex).m_indexCount;
     }
 
-    unsigned StaticMeshAssetView::getVertexCount() const
+    unsigned StaticMeshAssetView::getVertexCount(uint32_t lodIndex) const
     {
-        return m_mesh->getLod(0).m_vertexCount;
+        return m_mesh->getLod(lodIndex).m_vertexCount;
     }
 
     void StaticMeshAssetView::enumerateMeshTriangles(
         Functor<void(const nau::math::vec3&, const nau::math::vec3&, const nau::math::vec3&)> sink) const
     {
-        Sbuffer* positionBuffer = getPositionsBuffer();
-        Sbuffer* indexBuffer = getIndexBuffer();
+        // The pooled GPU buffers are shared with the other meshes: the CPU copy of the lod geometry is read.
+        const StaticMeshLod& lod = m_mesh->getLod(0);
+        const auto& points = lod.m_occluderVertices;
+        const auto& indices = lod.m_occluderIndices;
 
-        const unsigned vertexCount = getVertexCount();
-        const auto indexCount = getIndexCount();
-
-        const size_t posBufferSize = vertexCount * sizeof(float[3]);
-
-        std::byte* positionMemory = nullptr;
-        positionBuffer->lock(0, posBufferSize, reinterpret_cast<void**>(&positionMemory), VBLOCK_READONLY);
-
-        // todo: NAU-1797 Remove hardcode, support 32 bit indices geometry
-        // todo: NAU-1797 Stop readback, get geometry data from asset instead
-        const size_t indexBufferSize = indexCount * sizeof(uint16_t); 
-        std::byte* indexMemory = nullptr;
-        indexBuffer->lock(0, indexBufferSize, reinterpret_cast<void**>(&indexMemory), VBLOCK_READONLY);
-
-        auto indices = reinterpret_cast<uint16_t const*>(indexMemory);
-        auto points = reinterpret_cast<float const*>(positionMemory);
-
-        const std::size_t trVertCount = 3;
-        const auto readPoint3 = 
-            [&posBufferSize, &trVertCount, points](uint16_t const* indexPtr) -> eastl::optional<nau::math::vec3>
+        const auto readPoint3 = [&points](uint16_t index) -> eastl::optional<nau::math::vec3>
         {
-            unsigned index = *indexPtr;
-            if (index + trVertCount - 1 >= posBufferSize) 
+            if (index >= points.size())
             {
                 return eastl::nullopt;
             }
 
-            return nau::math::vec3{
-                    points[trVertCount * index + 0],
-                    points[trVertCount * index + 1],
-                    points[trVertCount * index + 2]
-            };
+            return nau::math::vec3{points[index].x, points[index].y, points[index].z};
         };
 
-        auto begin = indices;
-        auto end = indices + indexCount;
-
-        for (auto it = begin; it != std::prev(end, trVertCount); it += trVertCount)
+        for (size_t i = 0; i + 2 < indices.size(); i += 3)
         {
-            auto p1 = readPoint3(it);
-            auto p2 = readPoint3(std::next(it));
-            auto p3 = readPoint3(std::next(std::next(it)));
+            auto p1 = readPoint3(indices[i]);
+            auto p2 = readPoint3(indices[i + 1]);
+            auto p3 = readPoint3(indices[i + 2]);
 
             if (!p1 || !p2 || !p3)
             {
@@ -117,4 +93,33 @@ namespace nau
         }
     }
 
+    AssetMemoryCategory StaticMeshAssetView::getMemoryCategory() const
+    {
+        return AssetMemoryCategory::Mesh;
+    }
+
+    AssetMemoryFootprint StaticMeshAssetView::getMemoryFootprint() const
+    {
+        AssetMemoryFootprint footprint;
+        if (!m_mesh)
+        {
+            return footprint;
+        }
+
+        for (uint32_t lodIndex = 0, lodsCount = m_mesh->getLodsCount(); lodIndex < lodsCount; ++lodIndex)
+        {
+            const StaticMeshLod& lod = m_mesh->getLod(lodIndex);
+
+            // The strides of the geometry pool streams: positions and either the packed attributes or normals, tangents, texcoords.
+            const size_t vertexSize = lod.m_packedAttributesBuffer ?
+                                          sizeof(math::float3) + sizeof(PackedVertexAttributes) :
+                                          sizeof(math::float3) + sizeof(math::float3) + sizeof(math::float4) + sizeof(math::float2);
+
+            footprint.gpuBytes += lod.m_geometry.vertexCount * vertexSize + lod.m_geometry.indexCount * sizeof(uint16_t);
+            footprint.cpuBytes += lod.m_occluderVertices.size() * sizeof(math::float4) + lod.m_occluderIndices.size() * sizeof(uint16_t);
+        }
+
+        return footprint;
+    }
+
 }  // namespace nau
@@ -0,0 +1,199 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "graphics_assets/static_meshes/geometry_pool.h"
+
+#include <EASTL/algorithm.h>
+
+#include "nau/threading/lock_guard.h"
+
+
+namespace nau
+{
+    GeometryPool::RangeAllocator::RangeAllocator(uint32_t capacity)
+    {
+        m_freeRanges.push_back({0, capacity});
+    }
+
+    uint32_t GeometryPool::RangeAllocator::allocate(uint32_t size)
+    {
+        NAU_ASSERT(size > 0);
+
+        for (auto iter = m_freeRanges.begin(); iter != m_freeRanges.end(); ++iter)
+        {
+            if (iter->size < size)
+            {
+                continue;
+            }
+
+            const uint32_t offset = iter->offset;
+            iter->offset += size;
+            iter->size -= size;
+            if (iter->size == 0)
+            {
+                m_freeRanges.erase(iter);
+            }
+
+            return offset;
+        }
+
+        return InvalidOffset;
+    }
+
+    void GeometryPool::RangeAllocator::free(uint32_t offset, uint32_t size)
+    {
+        auto next = eastl::lower_bound(m_freeRanges.begin(), m_freeRanges.end(), offset, [](const Range& range, uint32_t value)
+        {
+            return range.offset < value;
+        });
+
+        if (next != m_freeRanges.end() && offset + size == next->offset)
+        {
+            next->offset = offset;
+            next->size += size;
+        }
+        else
+        {
+            next = m_freeRanges.insert(next, {offset, size});
+        }
+
+        if (next != m_freeRanges.begin())
+        {
+            const auto prev = next - 1;
+            if (prev->offset + prev->size == next->offset)
+            {
+                prev->size += next->size;
+                m_freeRanges.erase(next);
+            }
+        }
+    }
+
+    GeometryPool::Page::Page(uint32_t vertexCount, uint32_t indexCount) :
+        vertices(vertexCount),
+        indices(indexCount)
+    {
+    }
+
+    GeometryPool::GeometryPool(eastl::span<const uint32_t> vertexStrides, uint32_t pageVertexCount, uint32_t pageIndexCount) :
+        m_vertexStrides(vertexStrides.begin(), vertexStrides.end()),
+        m_pageVertexCount(pageVertexCount),
+        m_pageIndexCount(pageIndexCount)
+    {
+        NAU_ASSERT(!m_vertexStrides.empty());
+        NAU_ASSERT(m_pageVertexCount > 0 && m_pageIndexCount > 0);
+    }
+
+    GeometryPool::~GeometryPool()
+    {
+        for (const auto& page : m_pages)
+        {
+            for (Sbuffer* vertexBuffer : page->vertexBuffers)
+            {
+                vertexBuffer->destroy();
+            }
+            page->indexBuffer->destroy();
+        }
+    }
+
+    GeometryPool::Page& GeometryPool::createPage(uint32_t vertexCount, uint32_t indexCount)
+    {
+        auto& page = m_pages.emplace_back(eastl::make_unique<Page>(vertexCount, indexCount));
+
+        page->vertexBuffers.reserve(m_vertexStrides.size());
+        for (const uint32_t stride : m_vertexStrides)
+        {
+            Sbuffer* vertexBuffer = d3d::create_vb(vertexCount * stride, 0, u8"geometry pool vb");
+            NAU_FATAL(vertexBuffer);
+            page->vertexBuffers.push_back(vertexBuffer);
+        }
+
+        page->indexBuffer = d3d::create_ib(indexCount * sizeof(uint16_t), 0, u8"geometry pool ib");
+        NAU_FATAL(page->indexBuffer);
+
+        return *page;
+    }
+
+    GeometryPool::Allocation GeometryPool::allocate(uint32_t vertexCount, uint32_t indexCount)
+    {
+        NAU_ASSERT(vertexCount > 0 && indexCount > 0);
+
+        lock_(m_mutex);
+
+        for (uint32_t pageIndex = 0; pageIndex < m_pages.size(); ++pageIndex)
+        {
+            Page& page = *m_pages[pageIndex];
+
+            const uint32_t baseVertex = page.vertices.allocate(vertexCount);
+            if (baseVertex == RangeAllocator::InvalidOffset)
+            {
+                continue;
+            }
+
+            const uint32_t startIndex = page.indices.allocate(indexCount);
+            if (startIndex == RangeAllocator::InvalidOffset)
+            {
+                page.vertices.free(baseVertex, vertexCount);
+                continue;
+            }
+
+            return {pageIndex, baseVertex, vertexCount, startIndex, indexCount};
+        }
+
+        Page& page = createPage(eastl::max(vertexCount, m_pageVertexCount), eastl::max(indexCount, m_pageIndexCount));
+        const uint32_t baseVertex = page.vertices.allocate(vertexCount);
+        const uint32_t startIndex = page.indices.allocate(indexCount);
+        NAU_ASSERT(baseVertex != RangeAllocator::InvalidOffset && startIndex != RangeAllocator::InvalidOffset);
+
+        return {static_cast<uint32_t>(m_pages.size() - 1), baseVertex, vertexCount, startIndex, indexCount};
+    }
+
+    void GeometryPool::free(const Allocation& allocation)
+    {
+        if (!allocation)
+        {
+            return;
+        }
+
+        lock_(m_mutex);
+
+        NAU_ASSERT(allocation.page < m_pages.size());
+        Page& page = *m_pages[allocation.page];
+        page.vertices.free(allocation.baseVertex, allocation.vertexCount);
+        page.indices.free(allocation.startIndex, allocation.indexCount);
+    }
+
+    void GeometryPool::writeVertices(const Allocation& allocation, uint32_t stream, const void* data)
+    {
+        NAU_ASSERT(allocation && stream < m_vertexStrides.size());
+
+        const uint32_t stride = m_vertexStrides[stream];
+        const bool isUpdated = getVertexBuffer(allocation.page, stream)->updateData(allocation.baseVertex * stride, allocation.vertexCount * stride, data, VBLOCK_WRITEONLY);
+        NAU_ASSERT(isUpdated);
+    }
+
+    void GeometryPool::writeIndices(const Allocation& allocation, const uint16_t* indices)
+    {
+        NAU_ASSERT(allocation);
+
+        const bool isUpdated = getIndexBuffer(allocation.page)->updateData(allocation.startIndex * sizeof(uint16_t), allocation.indexCount * sizeof(uint16_t), indices, VBLOCK_WRITEONLY);
+        NAU_ASSERT(isUpdated);
+    }
+
+    Sbuffer* GeometryPool::getVertexBuffer(uint32_t page, uint32_t stream) const
+    {
+        lock_(m_mutex);
+
+        NAU_ASSERT(page < m_pages.size() && stream < m_vertexStrides.size());
+        return m_pages[page]->vertexBuffers[stream];
+    }
+
+    Sbuffer* GeometryPool::getIndexBuffer(uint32_t page) const
+    {
+        lock_(m_mutex);
+
+        NAU_ASSERT(page < m_pages.size());
+        return m_pages[page]->indexBuffer;
+    }
+
+} // namespace nau
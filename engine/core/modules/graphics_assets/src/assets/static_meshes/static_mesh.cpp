@@ -4,6 +4,8 @@
 
 #include "graphics_assets/static_meshes/static_mesh.h"
 
+#include "graphics_assets/packed_vertex_layout.h"
+
 #include "nau/async/task.h"
 
 nau::StaticMesh::StaticMesh()
@@ -65,57 +67,55 @@ eastl::span<nau::math::float4> getTangents(const eastl::span<uint16_t>& indices,
     return span;
 }
 
-nau::async::Task<nau::Ptr<nau::StaticMesh>> nau::StaticMesh::createFromStaticMeshAccessor(IMeshAssetAccessor& meshAccessor)
+namespace
 {
-    nau::StaticMesh::Ptr mesh = rtti::createInstance<StaticMesh>();
-
-    nau::StaticMeshLod& lod0 = mesh->lods.emplace_back();
+    // The static mesh pools outlive the meshes released at the shutdown: they are not destroyed.
+    nau::GeometryPool& getGeometryPool(bool isPacked)
+    {
+        static constexpr uint32_t PageVertexCount = 256 * 1024;
+        static constexpr uint32_t PageIndexCount = 1024 * 1024;
 
-    const auto meshDesc = meshAccessor.getDescription();
+        if (isPacked)
+        {
+            static constexpr eastl::array<uint32_t, 2> strides = {sizeof(nau::math::float3), sizeof(nau::PackedVertexAttributes)};
+            static nau::GeometryPool* pool = new nau::GeometryPool(strides, PageVertexCount, PageIndexCount);
+            return *pool;
+        }
 
-    d3d::driver_command(DRV3D_COMMAND_ACQUIRE_OWNERSHIP, NULL, NULL, NULL);
+        static constexpr eastl::array<uint32_t, 4> strides = {sizeof(nau::math::float3), sizeof(nau::math::float3), sizeof(nau::math::float4), sizeof(nau::math::float2)};
+        static nau::GeometryPool* pool = new nau::GeometryPool(strides, PageVertexCount, PageIndexCount);
+        return *pool;
+    }
+}  // namespace
 
-    auto indexBufferTask = [](IMeshAssetAccessor& accessor, const MeshDescription& meshDesc) -> nau::async::Task<std::tuple<Sbuffer*, size_t>>
+nau::StaticMesh::~StaticMesh()
+{
+    for (const StaticMeshLod& lod : lods)
     {
-        const size_t bufferSize = meshDesc.indexCount * sizeof(uint16_t);
-        if (bufferSize == 0)
+        if (lod.m_geometry)
         {
-            co_return std::tuple{nullptr, bufferSize};
+            getGeometryPool(lod.m_packedAttributesBuffer != nullptr).free(lod.m_geometry);
         }
+    }
+}
 
-        Sbuffer* ibuf;
-        {
-            ibuf = d3d::create_ib(bufferSize, SBCF_DYNAMIC, u8"IndexBuf");  // (position_float4 + color_float4) * 3
-
-            std::byte* mem = nullptr;
-            ibuf->lock(0, bufferSize, reinterpret_cast<void**>(&mem), VBLOCK_WRITEONLY);  //(0, nullptr, reinterpret_cast<void**>(&mem));
-            scope_on_leave
-            {
-                ibuf->unlock();
-            };
-
-            accessor.copyIndices(mem, bufferSize, ElementFormat::Uint16).ignore();
-        }
+nau::async::Task<nau::Ptr<nau::StaticMesh>> nau::StaticMesh::createFromStaticMeshAccessor(IMeshAssetAccessor& meshAccessor)
+{
+    nau::StaticMesh::Ptr mesh = rtti::createInstance<StaticMesh>();
 
-        co_return std::tuple{std::move(ibuf), bufferSize};
-    }(meshAccessor, meshDesc);
+    const auto meshDesc = meshAccessor.getDescription();
 
-    auto vertexBufferTask = [&](IMeshAssetAccessor& accessor, const MeshDescription& meshDesc) -> nau::async::Task<std::tuple<Sbuffer*, size_t, Sbuffer*, size_t, Sbuffer*, size_t, Sbuffer*, size_t>>
+    if ((meshDesc.indexCount != 0) && (meshDesc.vertexCount != 0))
     {
-        const size_t posBufferSize = meshDesc.vertexCount * sizeof(float[3]);
-        const size_t nrmBufferSize = meshDesc.vertexCount * sizeof(float[3]);
-        const size_t tangentBufferSize = meshDesc.vertexCount * sizeof(float[4]);
-        const size_t texBufferSize = meshDesc.vertexCount * sizeof(float[2]);
+        // The geometry is staged in the CPU memory: the tangents and the bounds are computed without the GPU buffers readback.
+        eastl::vector<uint16_t> indices(meshDesc.indexCount);
+        meshAccessor.copyIndices(indices.data(), indices.size() * sizeof(uint16_t), ElementFormat::Uint16).ignore();
 
-        if (meshDesc.vertexCount == 0)
-        {
-            co_return std::tuple{nullptr, posBufferSize,
-                                 nullptr, nrmBufferSize,
-                                 nullptr, tangentBufferSize,
-                                 nullptr, texBufferSize};
-        }
+        eastl::vector<nau::math::float3> positions(meshDesc.vertexCount);
+        eastl::vector<nau::math::float3> normals(meshDesc.vertexCount);
+        eastl::vector<nau::math::float2> texcoords(meshDesc.vertexCount);
 
-        eastl::array<OutputVertAttribDescription,4> outLayout;
+        eastl::array<OutputVertAttribDescription, 3> outLayout;
 
         auto& posDesc = outLayout[0];
         {
@@ -124,6 +124,8 @@ nau::async::Task<nau::Ptr<nau::StaticMesh>> nau::StaticMesh::createFromStaticMes
             posDesc.elementFormat = ElementFormat::Float;
             posDesc.attributeType = AttributeType::Vec3;
             posDesc.byteStride = 0;
+            posDesc.outputBuffer = positions.data();
+            posDesc.outputBufferSize = positions.size() * sizeof(nau::math::float3);
         }
 
         auto& nrmDesc = outLayout[1];
@@ -133,140 +135,152 @@ nau::async::Task<nau::Ptr<nau::StaticMesh>> nau::StaticMesh::createFromStaticMes
             nrmDesc.elementFormat = ElementFormat::Float;
             nrmDesc.attributeType = AttributeType::Vec3;
             nrmDesc.byteStride = 0;
+            nrmDesc.outputBuffer = normals.data();
+            nrmDesc.outputBufferSize = normals.size() * sizeof(nau::math::float3);
         }
 
-        auto& tangentDesc = outLayout[2];
-        {
-            tangentDesc.semantic = "TANGENT";
-            tangentDesc.semanticIndex = 0;
-            tangentDesc.elementFormat = ElementFormat::Float;
-            tangentDesc.attributeType = AttributeType::Vec4;
-            tangentDesc.byteStride = 0;
-        }
-
-        auto& uv0Desc = outLayout[3];
+        auto& uv0Desc = outLayout[2];
         {
             uv0Desc.semantic = "TEXCOORD";
             uv0Desc.semanticIndex = 0;
             uv0Desc.elementFormat = ElementFormat::Float;
             uv0Desc.attributeType = AttributeType::Vec2;
             uv0Desc.byteStride = 0;
+            uv0Desc.outputBuffer = texcoords.data();
+            uv0Desc.outputBufferSize = texcoords.size() * sizeof(nau::math::float2);
         }
 
-        Sbuffer* pbuf;
-        Sbuffer* nbuf;
-        Sbuffer* tangentbuf;
-        Sbuffer* tbuf;
-        {
-            pbuf = d3d::create_vb(posBufferSize, SBCF_DYNAMIC, u8"posBuf");
-            nbuf = d3d::create_vb(nrmBufferSize, SBCF_DYNAMIC, u8"normBuf");
-            tangentbuf = d3d::create_vb(tangentBufferSize, SBCF_DYNAMIC, u8"tangentBuf");
-            tbuf = d3d::create_vb(texBufferSize, SBCF_DYNAMIC, u8"texBuf");
+        meshAccessor.copyVertAttribs(outLayout).ignore();
 
-            std::byte* posMem = nullptr;
-            pbuf->lock(0, posBufferSize, reinterpret_cast<void**>(&posMem), VBLOCK_WRITEONLY);
+        // The cooked meshes come with the bounds. The lod vertices are the subset of the lod 0 ones, so the lod 0 bounds hold for all the lods.
+        const eastl::optional<nau::math::BBox3> bounds = meshAccessor.getBounds();
+        const nau::math::BBox3* const precomputedBounds = bounds ? &*bounds : nullptr;
 
-            std::byte* nrmMem = nullptr;
-            nbuf->lock(0, nrmBufferSize, reinterpret_cast<void**>(&nrmMem), VBLOCK_WRITEONLY);
+        nau::StaticMeshLod& lod0 = mesh->lods.emplace_back();
+        initLod(lod0, indices, positions, normals, texcoords, precomputedBounds);
 
-            std::byte* tangentMem = nullptr;
-            tangentbuf->lock(0, tangentBufferSize, reinterpret_cast<void**>(&tangentMem), VBLOCK_WRITEONLY);
+        mesh->m_localBSphere = nau::math::BSphere3();
+        mesh->m_localBSphere += lod0.m_localBBox;
 
-            std::byte* texMem = nullptr;
-            tbuf->lock(0, texBufferSize, reinterpret_cast<void**>(&texMem), VBLOCK_WRITEONLY);
+        NAU_ASSERT(mesh->m_localBSphere.r > 0.00001f);
 
-            scope_on_leave
+        // The generated lods index the lod 0 vertices: each lod gets the copy of the vertices it uses.
+        const eastl::vector<MeshLodDescription> lodDescriptions = meshAccessor.getLodDescriptions();
+        for (unsigned lodIndex = 0; lodIndex < lodDescriptions.size(); ++lodIndex)
+        {
+            eastl::vector<uint16_t> lodIndices(lodDescriptions[lodIndex].indexCount);
+            if (const Result<> copyResult = meshAccessor.copyLodIndices(lodIndex, lodIndices.data(), lodIndices.size() * sizeof(uint16_t), ElementFormat::Uint16); !copyResult)
             {
-                // Calculate AABB
-                nau::math::AABB aabb = nau::math::AABB();
-                aabb.InitFromVertsSlow(reinterpret_cast<nau::math::float3*>(posMem), meshDesc.vertexCount);
-
-                mesh->m_localBSphere = nau::math::BSphere3();
-                mesh->m_localBSphere += nau::math::BBox3(aabb.minBounds, aabb.maxBounds);
-
-                NAU_ASSERT(mesh->m_localBSphere.r > 0.00001f);
+                NAU_LOG_WARNING("The mesh lod {} is not loaded: {}", lodIndex + 1, copyResult.getError()->getMessage());
+                break;
+            }
 
-                pbuf->unlock();
-                nbuf->unlock();
-                tangentbuf->unlock();
-                tbuf->unlock();
-            };
+            eastl::vector<uint16_t> vertexRemap(meshDesc.vertexCount, eastl::numeric_limits<uint16_t>::max());
+            eastl::vector<nau::math::float3> lodPositions;
+            eastl::vector<nau::math::float3> lodNormals;
+            eastl::vector<nau::math::float2> lodTexcoords;
 
-            posDesc.outputBuffer = posMem;
-            posDesc.outputBufferSize = posBufferSize;
-
-            nrmDesc.outputBuffer = nrmMem;
-            nrmDesc.outputBufferSize = nrmBufferSize;
-
-            tangentDesc.outputBuffer = tangentMem;
-            tangentDesc.outputBufferSize = tangentBufferSize;
-
-            uv0Desc.outputBuffer = texMem;
-            uv0Desc.outputBufferSize = texBufferSize;
-
-            accessor.copyVertAttribs(outLayout).ignore();
+            for (uint16_t& index : lodIndices)
+            {
+                NAU_ASSERT(index < meshDesc.vertexCount);
+                if (vertexRemap[index] == eastl::numeric_limits<uint16_t>::max())
+                {
+                    vertexRemap[index] = static_cast<uint16_t>(lodPositions.size());
+                    lodPositions.push_back(positions[index]);
+                    lodNormals.push_back(normals[index]);
+                    lodTexcoords.push_back(texcoords[index]);
+                }
+
+                index = vertexRemap[index];
+            }
+
+            initLod(mesh->lods.emplace_back(), lodIndices, lodPositions, lodNormals, lodTexcoords, precomputedBounds);
+            mesh->m_lodsScreenSpaceError.push_back(lodDescriptions[lodIndex].screenSize);
         }
+    }
+    else
+    {
+        nau::StaticMeshLod& lod0 = mesh->lods.emplace_back();
+        lod0.m_indexCount = meshDesc.indexCount;
+        lod0.m_vertexCount = meshDesc.vertexCount;
+    }
 
-        co_return std::tuple{std::move(pbuf), posBufferSize, std::move(nbuf), nrmBufferSize, std::move(tangentbuf), tangentBufferSize, std::move(tbuf), texBufferSize};
-    }(meshAccessor, meshDesc);
+    // load material
+    static MaterialAssetRef material {AssetPath{"file:/res/materials/embedded/standard_opaque.nmat_json"}};
+    ReloadableAssetView::Ptr materialView = co_await material.getReloadableAssetViewTyped<MaterialAssetView>();
 
-    co_await async::whenAll(Expiration::never(), indexBufferTask, vertexBufferTask);
+    for (nau::StaticMeshLod& lod : mesh->lods)
+    {
+        nau::MaterialSlot& slot = lod.m_materialSlots.emplace_back();
+        slot.m_startIndex = 0;
+        slot.m_endIndex = lod.m_indexCount;
+        slot.m_material = materialView;
+    }
+
+    co_return mesh;
+}
 
-    auto [indexBuffer, indexBufferSize] = *indexBufferTask;
-    auto [posBuffer, posBufferSize, nrmBuffer, nrmBufferSize, tangentBuffer, tangentBufferSize, texBuffer, texBufferSize] = *vertexBufferTask;
+void nau::StaticMesh::initLod(StaticMeshLod& lod, eastl::span<uint16_t> indices, eastl::span<nau::math::float3> positions, eastl::span<nau::math::float3> normals, eastl::span<nau::math::float2> texcoords,
+                             const nau::math::BBox3* bounds)
+{
+    lod.m_indexCount = static_cast<uint32_t>(indices.size());
+    lod.m_vertexCount = static_cast<uint32_t>(positions.size());
 
-    lod0.m_indexCount = meshDesc.indexCount;
-    lod0.m_vertexCount = meshDesc.vertexCount;
+    if (bounds)
+    {
+        lod.m_localBBox = *bounds;
+    }
+    else
+    {
+        // Calculate AABB
+        nau::math::AABB aabb = nau::math::AABB();
+        aabb.InitFromVertsSlow(positions.data(), lod.m_vertexCount);
+        lod.m_localBBox = nau::math::BBox3(aabb.minBounds, aabb.maxBounds);
+    }
 
-    lod0.m_indexBuffer = indexBuffer;
-    lod0.m_positionsBuffer = posBuffer;
-    lod0.m_normalsBuffer = nrmBuffer;
-    lod0.m_tangentsBuffer = tangentBuffer;
-    lod0.m_texCoordsBuffer = texBuffer;
+    auto tangs = getTangents(indices, positions, normals, texcoords);
 
-    if ((lod0.m_indexCount != 0) && (lod0.m_vertexCount != 0))
+    lod.m_occluderIndices.assign(indices.begin(), indices.end());
+    lod.m_occluderVertices.reserve(lod.m_vertexCount);
+    for (const nau::math::float3& position : positions)
     {
-        std::byte* mem = nullptr;
-        indexBuffer->lock(0, indexBufferSize, reinterpret_cast<void**>(&mem), VBLOCK_READONLY);
+        lod.m_occluderVertices.emplace_back(position.x, position.y, position.z, 1.0f);
+    }
 
-        std::byte* posMem = nullptr;
-        posBuffer->lock(0, posBufferSize, reinterpret_cast<void**>(&posMem), VBLOCK_READONLY);
+    const bool isPacked = isPackedVertexLayoutEnabled();
+    GeometryPool& pool = getGeometryPool(isPacked);
 
-        std::byte* nrmMem = nullptr;
-        nrmBuffer->lock(0, nrmBufferSize, reinterpret_cast<void**>(&nrmMem), VBLOCK_READONLY);
+    d3d::driver_command(DRV3D_COMMAND_ACQUIRE_OWNERSHIP, NULL, NULL, NULL);
 
-        std::byte* texMem = nullptr;
-        texBuffer->lock(0, texBufferSize, reinterpret_cast<void**>(&texMem), VBLOCK_READONLY);
+    lod.m_geometry = pool.allocate(lod.m_vertexCount, lod.m_indexCount);
+    pool.writeIndices(lod.m_geometry, indices.data());
+    pool.writeVertices(lod.m_geometry, 0, positions.data());
 
-        std::byte* tangentMem = nullptr;
-        tangentBuffer->lock(0, tangentBufferSize, reinterpret_cast<void**>(&tangentMem), VBLOCK_WRITEONLY);
+    lod.m_indexBuffer = pool.getIndexBuffer(lod.m_geometry.page);
+    lod.m_positionsBuffer = pool.getVertexBuffer(lod.m_geometry.page, 0);
 
-        auto tangs = getTangents({(uint16_t*)mem, meshDesc.indexCount},
-                                 {(nau::math::float3*)posMem, meshDesc.vertexCount},
-                                 {(nau::math::float3*)nrmMem, meshDesc.vertexCount},
-                                 {(nau::math::float2*)texMem, meshDesc.vertexCount});
-        memcpy(tangentMem, tangs.data(), tangentBufferSize);
+    if (isPacked)
+    {
+        eastl::vector<PackedVertexAttributes> packedAttributes(lod.m_vertexCount);
+        packVertexAttributes(normals, {tangs.data(), tangs.size()}, texcoords, packedAttributes);
+        pool.writeVertices(lod.m_geometry, 1, packedAttributes.data());
 
-        delete[] tangs.data();
+        lod.m_packedAttributesBuffer = pool.getVertexBuffer(lod.m_geometry.page, 1);
+    }
+    else
+    {
+        pool.writeVertices(lod.m_geometry, 1, normals.data());
+        pool.writeVertices(lod.m_geometry, 2, tangs.data());
+        pool.writeVertices(lod.m_geometry, 3, texcoords.data());
 
-        posBuffer->unlock();
-        nrmBuffer->unlock();
-        tangentBuffer->unlock();
-        texBuffer->unlock();
-        indexBuffer->unlock();
+        lod.m_normalsBuffer = pool.getVertexBuffer(lod.m_geometry.page, 1);
+        lod.m_tangentsBuffer = pool.getVertexBuffer(lod.m_geometry.page, 2);
+        lod.m_texCoordsBuffer = pool.getVertexBuffer(lod.m_geometry.page, 3);
     }
 
     d3d::driver_command(DRV3D_COMMAND_RELEASE_OWNERSHIP, NULL, NULL, NULL);
 
-    // load material
-    nau::MaterialSlot& slot = lod0.m_materialSlots.emplace_back();
-    slot.m_startIndex = 0;
-    slot.m_endIndex = lod0.m_indexCount;
-
-    static MaterialAssetRef material {AssetPath{"file:/res/materials/embedded/standard_opaque.nmat_json"}};
-    slot.m_material = co_await material.getReloadableAssetViewTyped<MaterialAssetView>();
-
-    co_return mesh;
+    delete[] tangs.data();
 }
 
 bool nau::StaticMesh::createFromGeneratedData()
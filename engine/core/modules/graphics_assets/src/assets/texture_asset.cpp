@@ -3,7 +3,11 @@
 
 #include "../../include/graphics_assets/texture_asset.h"
 
+#include "../../include/graphics_assets/gpu_upload_queue.h"
+#include "../../include/graphics_assets/texture_streaming.h"
 #include "nau/assets/texture_asset_accessor.h"
+#include "nau/service/service_provider.h"
+#include "nau/threading/lock_guard.h"
 
 #define LOAD_TEXTURE_ASYNC
 
@@ -59,8 +63,61 @@ namespace nau
 
             return DXGI_FORMAT_UNKNOWN;
         }
+
+        // Fills the mips of tex with the mips count mips from firstMip of the asset.
+        void fillTextureMips(ITextureAssetAccessor& textureAccessor, BaseTexture* tex, uint32_t firstMip, uint32_t mipsCount, uint32_t dagorFormat)
+        {
+            const TextureFormatDesc& dagorFormatDesc = get_tex_format_desc(dagorFormat);
+
+            for(uint32_t texMip = 0; texMip < mipsCount; ++texMip)
+            {
+                TextureInfo info;
+                tex->getinfo(info, texMip);
+
+                void* texDataPtr = nullptr;
+                int stride;
+                tex->lockimg(&texDataPtr, stride, texMip, TEXLOCK_WRITE);
+
+                eastl::vector<DestTextureData> dstData(1);
+                DestTextureData& data = dstData[0];
+
+                data.outputBuffer = texDataPtr;
+                data.rowsCount    = std::max(1, info.h / dagorFormatDesc.elementHeight);
+                data.rowPitch     = stride;
+                data.rowBytesSize = 0; // will use format's default row bytes size
+                data.slicePitch   = 0;
+
+                textureAccessor.copyTextureData(firstMip + texMip, 1, dstData);
+
+                tex->unlockimg();
+            }
+        }
+
+        // Uploads the mips with the batch of the GpuUploadQueue when it is available, the task is resolved when they are on the GPU.
+        async::Task<> uploadTextureMips(ITextureAssetAccessor& textureAccessor, BaseTexture* tex, uint32_t firstMip, uint32_t mipsCount, uint32_t dagorFormat)
+        {
+            if (!getServiceProvider().has<GpuUploadQueue>())
+            {
+                fillTextureMips(textureAccessor, tex, firstMip, mipsCount, dagorFormat);
+                return async::Task<>::makeResolved();
+            }
+
+            GpuUploadQueue& uploadQueue = getServiceProvider().get<GpuUploadQueue>();
+            GpuUploadBatch batch = uploadQueue.createBatch();
+            textureAccessor.copyTextureData(firstMip, mipsCount, batch.stageTexture(tex, 0, mipsCount));
+
+            return uploadQueue.submit(std::move(batch));
+        }
     }  // namespace
 
+    TextureAssetView::~TextureAssetView()
+    {
+        if (const uint32_t index = m_bindlessIndex.load(std::memory_order_relaxed); index != InvalidBindlessIndex)
+        {
+            d3d::free_bindless_resource_range(RES3D_TEX, index, 1);
+        }
+    }
+
     async::Task<nau::Ptr<TextureAssetView>> TextureAssetView::createFromAssetAccessor(nau::Ptr<> accessor)
     {
         using namespace nau::async;
@@ -77,40 +134,105 @@ namespace nau
         auto textureAssetView = rtti::createInstance<TextureAssetView>();
         const auto& imageDesc = textureAccessor.getDescription();
 
-        BaseTexture* tex = nullptr;
+        const uint32_t dagorFormat = getDagorFormat(imageDesc.format);
 
-        const uint32_t           dagorFormat     = getDagorFormat(imageDesc.format);
-        const TextureFormatDesc& dagorFormatDesc = get_tex_format_desc(dagorFormat);
+        // Only the mip tail of the streamed textures is loaded now, the higher mips are streamed in by the demand.
+        TextureStreaming* streaming = getServiceProvider().has<TextureStreaming>() ? &getServiceProvider().get<TextureStreaming>() : nullptr;
+        const uint32_t firstMip = streaming ? streaming->getInitialMip(imageDesc) : 0;
 
-        tex = d3d::create_tex(nullptr, imageDesc.width, imageDesc.height, dagorFormat, imageDesc.numMipmaps);
+        BaseTexture* tex = d3d::create_tex(nullptr, std::max(imageDesc.width >> firstMip, 1u), std::max(imageDesc.height >> firstMip, 1u), dagorFormat, imageDesc.numMipmaps - firstMip);
+        co_await uploadTextureMips(textureAccessor, tex, firstMip, imageDesc.numMipmaps - firstMip, dagorFormat);
 
+        textureAssetView->m_Texture = tex;
 
-        for(int mipLevel = 0; mipLevel < imageDesc.numMipmaps; ++mipLevel)
+        if (firstMip > 0)
         {
-            TextureInfo info;
-            int t = tex->getinfo(info, mipLevel);
+            textureAssetView->m_accessor = accessor;
+            textureAssetView->m_dagorFormat = dagorFormat;
+            textureAssetView->m_width = imageDesc.width;
+            textureAssetView->m_height = imageDesc.height;
+            textureAssetView->m_mipsCount = imageDesc.numMipmaps;
+            textureAssetView->m_residentMip = firstMip;
+            streaming->registerTexture(textureAssetView);
+        }
 
-            void* texDataPtr = nullptr;
-            int stride;
-            tex->lockimg(&texDataPtr, stride, mipLevel, TEXLOCK_WRITE);
+        co_return textureAssetView;
+    }
 
-            eastl::vector<DestTextureData> dstData(1);
-            DestTextureData& data = dstData[0];
+    async::Task<BaseTexture*> TextureAssetView::loadMips(nau::Ptr<TextureAssetView> view, uint32_t firstMip)
+    {
+        NAU_ASSERT(view->isStreamed());
+        NAU_ASSERT(firstMip < view->m_mipsCount);
 
-            data.outputBuffer = texDataPtr;
-            data.rowsCount    = std::max(1, info.h / dagorFormatDesc.elementHeight);
-            data.rowPitch     = stride;
-            data.rowBytesSize = 0; // will use format's default row bytes size
-            data.slicePitch   = 0;
+        co_await async::Executor::getDefault();
 
-            textureAccessor.copyTextureData(mipLevel, 1, dstData);
+        BaseTexture* tex = view->m_Texture->makeTmpTexResCopy(std::max(view->m_width >> firstMip, 1u), std::max(view->m_height >> firstMip, 1u), 1, view->m_mipsCount - firstMip);
+        if (tex)
+        {
+            co_await uploadTextureMips(view->m_accessor->as<ITextureAssetAccessor&>(), tex, firstMip, view->m_mipsCount - firstMip, view->m_dagorFormat);
+        }
 
-            tex->unlockimg();
+        co_return tex;
+    }
+
+    uint32_t TextureAssetView::getBindlessIndex()
+    {
+        if (const uint32_t index = m_bindlessIndex.load(std::memory_order_acquire); index != InvalidBindlessIndex)
+        {
+            return index;
         }
 
-        textureAssetView->m_Texture = tex;
+        if (!d3d::get_driver_desc().caps.hasBindless)
+        {
+            return InvalidBindlessIndex;
+        }
 
-        co_return textureAssetView;
+        lock_(m_bindlessMutex);
+        if (m_bindlessIndex.load(std::memory_order_relaxed) == InvalidBindlessIndex)
+        {
+            d3d::driver_command(DRV3D_COMMAND_ACQUIRE_OWNERSHIP, NULL, NULL, NULL);
+            const uint32_t index = d3d::allocate_bindless_resource_range(RES3D_TEX, 1);
+            d3d::update_bindless_resource(index, m_Texture);
+            d3d::driver_command(DRV3D_COMMAND_RELEASE_OWNERSHIP, NULL, NULL, NULL);
+
+            m_bindlessIndex.store(index, std::memory_order_release);
+        }
+
+        return m_bindlessIndex.load(std::memory_order_relaxed);
+    }
+
+    void TextureAssetView::updateBindlessResource()
+    {
+        lock_(m_bindlessMutex);
+        if (const uint32_t index = m_bindlessIndex.load(std::memory_order_relaxed); index != InvalidBindlessIndex)
+        {
+            d3d::update_bindless_resource(index, m_Texture);
+        }
+    }
+
+    AssetMemoryCategory TextureAssetView::getMemoryCategory() const
+    {
+        return AssetMemoryCategory::Texture;
+    }
+
+    AssetMemoryFootprint TextureAssetView::getMemoryFootprint() const
+    {
+        return {.gpuBytes = m_Texture ? static_cast<size_t>(m_Texture->ressize()) : 0};
+    }
+
+    size_t TextureAssetView::getMipsSize(uint32_t firstMip) const
+    {
+        const TextureFormatDesc& formatDesc = get_tex_format_desc(m_dagorFormat);
+
+        size_t size = 0;
+        for (uint32_t mip = firstMip; mip < m_mipsCount; ++mip)
+        {
+            const size_t blocksX = (std::max(m_width >> mip, 1u) + formatDesc.elementWidth - 1) / formatDesc.elementWidth;
+            const size_t blocksY = (std::max(m_height >> mip, 1u) + formatDesc.elementHeight - 1) / formatDesc.elementHeight;
+            size += blocksX * blocksY * formatDesc.bytesPerElement;
+        }
+
+        return size;
     }
 
 }  // namespace nau
@@ -0,0 +1,302 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#include "../../include/graphics_assets/texture_streaming.h"
+
+#include <EASTL/sort.h>
+
+#include "../../include/graphics_assets/gpu_upload_queue.h"
+#include "nau/async/task.h"
+#include "nau/service/service_provider.h"
+#include "nau/threading/lock_guard.h"
+#include "nau/app/global_properties.h"
+
+namespace nau
+{
+    async::Task<> TextureStreaming::preInitService()
+    {
+        if (getServiceProvider().has<GlobalProperties>())
+        {
+            auto& properties = getServiceProvider().get<GlobalProperties>();
+            m_isEnabled = properties.getValue<bool>("/graphics/textureStreaming/enabled").value_or(false);
+            m_budgetBytes = size_t(properties.getValue<uint32_t>("/graphics/textureStreaming/budgetMb").value_or(1024)) << 20;
+            m_tailSize = eastl::max(properties.getValue<uint32_t>("/graphics/textureStreaming/tailSize").value_or(128u), 1u);
+            m_maxLoadsPerFrame = eastl::max(properties.getValue<uint32_t>("/graphics/textureStreaming/maxLoadsPerFrame").value_or(4u), 1u);
+        }
+
+        return async::Task<>::makeResolved();
+    }
+
+    async::Task<> TextureStreaming::shutdownService()
+    {
+        // The loads waiting for their uploads are not resumed by the frames anymore.
+        if (getServiceProvider().has<GpuUploadQueue>())
+        {
+            getServiceProvider().get<GpuUploadQueue>().stop();
+        }
+
+        for (StreamedTexture& texture : m_textures)
+        {
+            if (texture.loading)
+            {
+                BaseTexture* tex = co_await std::move(texture.loading);
+                del_d3dres(tex);
+            }
+        }
+
+        m_textures.clear();
+        m_registered.clear();
+    }
+
+    uint32_t TextureStreaming::getInitialMip(const TextureDescription& desc) const
+    {
+        // The cube maps, the arrays and the volumes are small enough or not drawn by the materials: they are loaded whole.
+        const bool isPlain2d = desc.type == TextureType::TEXTURE_2D || desc.type == TextureType::UNDEFINED;
+        if (!m_isEnabled || !isPlain2d || desc.arraySize > 1 || desc.depth > 1)
+        {
+            return 0;
+        }
+
+        uint32_t mip = 0;
+        while (mip + 1 < desc.numMipmaps && eastl::max(desc.width >> mip, desc.height >> mip) > m_tailSize)
+        {
+            ++mip;
+        }
+
+        return mip;
+    }
+
+    void TextureStreaming::registerTexture(const nau::Ptr<TextureAssetView>& texture)
+    {
+        NAU_ASSERT(texture && texture->isStreamed());
+
+        lock_(m_registerMutex);
+        StreamedTexture& streamed = m_registered.emplace_back();
+        streamed.view = WeakPtr<TextureAssetView>{texture};
+        streamed.residentBytes = texture->getMipsSize(texture->m_residentMip);
+        streamed.tailMip = texture->m_residentMip;
+        streamed.wantedMip = texture->m_residentMip;
+    }
+
+    uint32_t TextureStreaming::getWantedMip(const StreamedTexture& texture, const TextureAssetView& view, uint32_t requestedLevel) const
+    {
+        // The level is the log2 of the resolution: the mip 0 is needed at the level of the texture size.
+        uint32_t topLevel = 0;
+        while ((eastl::max(view.m_width, view.m_height) >> topLevel) > 1)
+        {
+            ++topLevel;
+        }
+
+        return topLevel > requestedLevel ? eastl::min(topLevel - requestedLevel, texture.tailMip) : 0;
+    }
+
+    void TextureStreaming::update()
+    {
+        ++m_frame;
+
+        {
+            lock_(m_registerMutex);
+            for (StreamedTexture& texture : m_registered)
+            {
+                m_residentBytes += texture.residentBytes;
+                m_textures.push_back(std::move(texture));
+            }
+            m_registered.clear();
+        }
+
+        bool hasStreamIn = false;
+        for (StreamedTexture& texture : m_textures)
+        {
+            nau::Ptr<TextureAssetView> view = texture.view.lock();
+            if (!view)
+            {
+                continue;
+            }
+
+            if (texture.loading && texture.loading.isReady())
+            {
+                finishLoad(texture, *view);
+            }
+
+            const uint32_t requestedLevel = view->m_requestedLevel.exchange(0, std::memory_order_relaxed);
+            const bool isPinned = view->m_isPinned.load(std::memory_order_relaxed);
+            if (requestedLevel > 0 || isPinned)
+            {
+                texture.lastUsedFrame = m_frame;
+            }
+            // The textures not drawn in the last frame want their mip tail only: their mips are kept until evicted.
+            texture.wantedMip = isPinned ? 0 : getWantedMip(texture, *view, requestedLevel);
+
+            hasStreamIn |= !texture.loading && texture.wantedMip < view->m_residentMip;
+        }
+
+        // The loads keep their views alive: only the idle textures are dropped with their views.
+        eastl::erase_if(m_textures, [this](const StreamedTexture& texture)
+        {
+            if (!texture.view.isDead() || texture.loading)
+            {
+                return false;
+            }
+
+            m_residentBytes -= texture.residentBytes;
+            return true;
+        });
+        const size_t budgetBytes = getBudget();
+        if (m_residentBytes > budgetBytes)
+        {
+            evict(m_residentBytes - budgetBytes);
+        }
+
+        if (!hasStreamIn || m_pendingLoadsCount >= m_maxLoadsPerFrame)
+        {
+            return;
+        }
+
+        eastl::vector<StreamedTexture*> candidates;
+        for (StreamedTexture& texture : m_textures)
+        {
+            nau::Ptr<TextureAssetView> view = texture.view.lock();
+            if (view && !texture.loading && texture.wantedMip < view->m_residentMip)
+            {
+                candidates.push_back(&texture);
+            }
+        }
+
+        // The most recently used first, then the blurriest ones.
+        eastl::sort(candidates.begin(), candidates.end(), [](const StreamedTexture* left, const StreamedTexture* right)
+        {
+            if (left->lastUsedFrame != right->lastUsedFrame)
+            {
+                return left->lastUsedFrame > right->lastUsedFrame;
+            }
+            return left->wantedMip < right->wantedMip;
+        });
+
+        for (StreamedTexture* texture : candidates)
+        {
+            if (m_pendingLoadsCount >= m_maxLoadsPerFrame)
+            {
+                break;
+            }
+
+            nau::Ptr<TextureAssetView> view = texture->view.lock();
+
+            // A coarser mip than the wanted one is streamed in when the budget can not be freed for it.
+            uint32_t mip = texture->wantedMip;
+            for (; mip < view->m_residentMip; ++mip)
+            {
+                const size_t neededBytes = view->getMipsSize(mip) - texture->residentBytes;
+                if (m_residentBytes + neededBytes <= budgetBytes || evict(m_residentBytes + neededBytes - budgetBytes))
+                {
+                    break;
+                }
+            }
+            if (mip == view->m_residentMip)
+            {
+                continue;
+            }
+
+            // Both the resources are alive until the load is finished: the new one is accounted at once.
+            const size_t loadedBytes = view->getMipsSize(mip);
+            m_residentBytes += loadedBytes - texture->residentBytes;
+            texture->residentBytes = loadedBytes;
+            texture->loadingMip = mip;
+            texture->loading = TextureAssetView::loadMips(view, mip);
+            ++m_pendingLoadsCount;
+        }
+    }
+
+    bool TextureStreaming::evict(size_t neededBytes)
+    {
+        // The least recently used first: the textures not drawn in the last frame are dropped to their mip tail,
+        // the drawn ones to the mip they are wanted at.
+        eastl::vector<StreamedTexture*> candidates;
+        for (StreamedTexture& texture : m_textures)
+        {
+            nau::Ptr<TextureAssetView> view = texture.view.lock();
+            if (!view || texture.loading || view->m_isPinned.load(std::memory_order_relaxed))
+            {
+                continue;
+            }
+
+            if (texture.wantedMip > view->m_residentMip)
+            {
+                candidates.push_back(&texture);
+            }
+        }
+
+        eastl::sort(candidates.begin(), candidates.end(), [](const StreamedTexture* left, const StreamedTexture* right)
+        {
+            return left->lastUsedFrame < right->lastUsedFrame;
+        });
+
+        size_t freedBytes = 0;
+        for (StreamedTexture* texture : candidates)
+        {
+            if (freedBytes >= neededBytes)
+            {
+                break;
+            }
+
+            nau::Ptr<TextureAssetView> view = texture->view.lock();
+            const uint32_t targetMip = texture->wantedMip;
+            const uint32_t mipsCount = view->m_mipsCount - targetMip;
+            if (!view->m_Texture->downSize(eastl::max(view->m_width >> targetMip, 1u), eastl::max(view->m_height >> targetMip, 1u), 1,
+                                           mipsCount, 0, targetMip - view->m_residentMip))
+            {
+                continue;
+            }
+
+            view->updateBindlessResource();
+
+            const size_t residentBytes = view->getMipsSize(targetMip);
+            freedBytes += texture->residentBytes - residentBytes;
+            m_residentBytes -= texture->residentBytes - residentBytes;
+            texture->residentBytes = residentBytes;
+            view->m_residentMip = targetMip;
+        }
+
+        return freedBytes >= neededBytes;
+    }
+
+    void TextureStreaming::finishLoad(StreamedTexture& texture, TextureAssetView& view)
+    {
+        BaseTexture* tex = texture.loading.result();
+        texture.loading = nullptr;
+        --m_pendingLoadsCount;
+
+        if (!tex)
+        {
+            // The memory was not allocated: the accounting goes back to the resident mips.
+            const size_t residentBytes = view.getMipsSize(view.m_residentMip);
+            m_residentBytes -= texture.residentBytes - residentBytes;
+            texture.residentBytes = residentBytes;
+            return;
+        }
+
+        // The texture object is kept: the materials keep binding it.
+        view.m_Texture->replaceTexResObject(tex);
+        view.updateBindlessResource();
+        view.m_residentMip = texture.loadingMip;
+    }
+
+    TextureStreaming::Stats TextureStreaming::getStats() const
+    {
+        return {
+            .residentBytes = m_residentBytes,
+            .budgetBytes = getBudget(),
+            .streamedTexturesCount = static_cast<uint32_t>(m_textures.size()),
+            .pendingLoadsCount = m_pendingLoadsCount};
+    }
+
+    void TextureStreaming::setBudgetLimit(size_t limitBytes)
+    {
+        m_budgetLimitBytes.store(limitBytes, std::memory_order_relaxed);
+    }
+
+    size_t TextureStreaming::getBudget() const
+    {
+        const size_t limitBytes = m_budgetLimitBytes.load(std::memory_order_relaxed);
+        return limitBytes != 0 ? eastl::min(m_budgetBytes, limitBytes) : m_budgetBytes;
+    }
+}  // namespace nau
@@ -4,7 +4,9 @@
 
 #include "graphics_assets/static_mesh_asset.h"
 #include "graphics_assets/shader_asset.h"
+#include "graphics_assets/gpu_upload_queue.h"
 #include "graphics_assets/texture_asset.h"
+#include "graphics_assets/texture_streaming.h"
 #include "graphics_assets/asset_view_factory.h"
 #include "nau/module/module.h"
 
@@ -22,6 +24,8 @@ namespace nau
             NAU_MODULE_EXPORT_CLASS(StaticMeshAssetView);
             NAU_MODULE_EXPORT_CLASS(TextureAssetView);
             NAU_MODULE_EXPORT_SERVICE(GraphicsAssetViewFactory);
+            NAU_MODULE_EXPORT_SERVICE(TextureStreaming);
+            NAU_MODULE_EXPORT_SERVICE(GpuUploadQueue);
         }
         void deinitialize() override
         {
@@ -235,6 +235,10 @@ namespace nau
                 {
                     m_properties[key] = makeValueCopy(value);
                     m_changed = true;
+                    if (m_changesCounter != nullptr)
+                    {
+                        ++*m_changesCounter;
+                    }
                 }
                 else
                 {
@@ -318,6 +322,11 @@ namespace nau
          * @brief Indicates whether signal properties have been change and the signal state require update.
          */
         bool m_changed = false;
+
+        /**
+         * @brief Counter of the signal graph changes of the input system, incremented on each property change (can be null).
+         */
+        uint32_t* m_changesCounter = nullptr;
     };
 
     /**
@@ -462,11 +471,13 @@ namespace nau
         virtual const InputSignalProperties& Properties() const = 0;
 
         /**
-         * @brief Called each frame.
+         * @brief Called on the frames the signal state can change.
          * 
          * @param [in] dt Delta time.
          * 
          * The method can be used to modify values, nested signals or state of the signal.
+         * The built-in signals are evaluated only when the keys or axes they read change, their properties change
+         * or their timers are running: otherwise they keep their state and values.
          */
         virtual void update(float dt) = 0;
     };
@@ -681,6 +692,30 @@ namespace nau
          * Source valid until next setInputSource call
          */
         virtual void setInputSource(const eastl::string& source) = 0;
+
+        /**
+         * @brief Registers a handler that is called each time the input is sampled late in the frame.
+         *
+         * @param [in] handler  Functor to call right after the late sampling. Use it to apply the freshest input (e.g. camera rotation) just before the frame is handed to the renderer.
+         * @return              Identifier of the handler, that can be passed to removeLateLatchHandler.
+         */
+        virtual uint32_t addLateLatchHandler(nau::Functor<void()> handler) = 0;
+
+        /**
+         * @brief Unregisters the late latch handler.
+         *
+         * @param [in] handlerId    Identifier returned by addLateLatchHandler.
+         */
+        virtual void removeLateLatchHandler(uint32_t handlerId) = 0;
+
+        /**
+         * @brief Re-samples the input devices and calls the late latch handlers.
+         *
+         * Called by the renderer right before the scene state (camera and view matrices) is copied for the rendering.
+         * Device states (IInputDevice::getKeyState, IInputDevice::getAxisState) reflect the re-sampled input,
+         * the actions are still processed once per frame: the key transitions are kept for the next frame update.
+         */
+        virtual void sampleLateInput() = 0;
     };
 
 }  // namespace nau
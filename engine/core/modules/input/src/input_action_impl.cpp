@@ -29,6 +29,40 @@ namespace nau
         m_prevState = m_signal->getState();
     }
 
+    bool InputActionImpl::collectSources(eastl::vector<InputSignalSource>& sources)
+    {
+        return m_signal && InputSignalImpl::collectSignalSources(m_signal.get(), sources);
+    }
+
+    bool InputActionImpl::needsWakeup() const
+    {
+        if (!m_signal)
+        {
+            return false;
+        }
+        if (m_type == Continuous && m_prevState == IInputSignal::High)
+        {
+            return true;
+        }
+        return InputSignalImpl::signalNeedsWakeup(m_signal.get());
+    }
+
+    bool InputActionImpl::isContextActive(const eastl::set<eastl::string>& contexts) const
+    {
+        if (m_tags.empty())
+        {
+            return true;
+        }
+        for (auto& tag : m_tags)
+        {
+            if (contexts.count(tag) > 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
     void InputActionImpl::serialize(DataBlock* blk) const
     {
         blk->addStr(DataName, m_name.c_str());
@@ -3,8 +3,10 @@
 
 #pragma once
 #include <EASTL/set.h>
+#include <EASTL/vector.h>
 
 #include "nau/input_system.h"
+#include "signals/input_signals_impl.h"
 
 namespace nau
 {
@@ -51,7 +53,26 @@ namespace nau
             m_signal = eastl::shared_ptr<IInputSignal>(signal);
         }
 
+        /**
+            Adds the keys and axes the action signal depends on. Returns false if the action must be updated each frame.
+         */
+        bool collectSources(eastl::vector<InputSignalSource>& sources);
+
+        /**
+            Returns true if the action must be updated on the next frame even if its sources do not change:
+            the continuous action is called each frame while its signal is high, the signal timers are running.
+         */
+        bool needsWakeup() const;
+
+        bool isContextActive(const eastl::set<eastl::string>& contexts) const;
+
     private:
+        friend class InputSystemImpl;
+
+        // Scheduling state of the input system: the action order and the update the action is scheduled for
+        size_t m_order = 0;
+        uint32_t m_scheduledUpdate = 0;
+
         Type m_type = Type::Trigger;
         eastl::string m_name;
         IInputSignal::State m_prevState = IInputSignal::State::Low;
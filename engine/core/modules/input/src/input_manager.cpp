@@ -258,11 +258,13 @@ namespace nau::input
     void InputManagerImpl::update()
     {
         m_inputManager.Update();
+        m_sessionRecording.processUpdate(m_inputManager);
     }
 
     void InputManagerImpl::update(float dt)
     {
         m_inputManager.Update(dt);
+        m_sessionRecording.processUpdate(m_inputManager);
     }
 
     bool InputManagerImpl::isKeyboardButtonPressed(int deviceId, nau::input::Key key)
@@ -7,6 +7,7 @@
 #include <gainput/gainput.h>
 
 
+#include "input_session_recording.h"
 #include "nau/input.h"
 #include "nau/rtti/rtti_impl.h"
 #include "nau/rtti/rtti_object.h"
@@ -64,6 +65,7 @@ namespace nau::input
         bool inited = false;
         gainput::InputManager m_inputManager = {false};
         gainput::InputMap m_inputMap = {m_inputManager};
+        InputSessionRecording m_sessionRecording{"input/global"};
         gainput::DeviceId m_keyboard;
         gainput::DeviceId m_mouse;
     };
@@ -0,0 +1,165 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "input_session_recording.h"
+
+#include <bit>
+
+#include "nau/service/service_provider.h"
+
+namespace nau::input
+{
+    namespace
+    {
+        // The button value is the union of bool and float: the bits of the float cover both
+        uint32_t getButtonBits(const gainput::InputState& state, gainput::DeviceButtonId buttonId)
+        {
+            return std::bit_cast<uint32_t>(state.GetFloat(buttonId));
+        }
+
+        template <typename T>
+        void appendValue(eastl::string& buffer, T value)
+        {
+            buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        template <typename T>
+        bool readValue(eastl::string_view& data, T& value)
+        {
+            if (data.size() < sizeof(T))
+            {
+                return false;
+            }
+
+            memcpy(&value, data.data(), sizeof(T));
+            data.remove_prefix(sizeof(T));
+            return true;
+        }
+    }  // namespace
+
+    InputSessionRecording::InputSessionRecording(eastl::string channel) :
+        m_channel(std::move(channel))
+    {
+    }
+
+    ISessionRecorder* InputSessionRecording::getRecorder()
+    {
+        // The recorder is created with the application, before any module service
+        if (!m_recorderRequested)
+        {
+            m_recorder = getServiceProvider().find<ISessionRecorder>();
+            m_recorderRequested = true;
+        }
+
+        return m_recorder;
+    }
+
+    void InputSessionRecording::processUpdate(gainput::InputManager& inputManager)
+    {
+        ISessionRecorder* const recorder = getRecorder();
+        if (!recorder)
+        {
+            return;
+        }
+
+        if (recorder->getMode() == SessionRecorderMode::Record)
+        {
+            recordStates(*recorder, inputManager);
+        }
+        else if (recorder->getMode() == SessionRecorderMode::Replay)
+        {
+            replayStates(*recorder, inputManager);
+        }
+    }
+
+    void InputSessionRecording::recordStates(ISessionRecorder& recorder, gainput::InputManager& inputManager)
+    {
+        eastl::string payload;
+
+        for (auto it = inputManager.begin(); it != inputManager.end(); ++it)
+        {
+            const gainput::InputState* const state = it->second->GetInputState();
+            if (!state)
+            {
+                continue;
+            }
+
+            eastl::vector<uint32_t>& recordedState = m_states[it->first];
+            recordedState.resize(state->GetButtonCount(), 0);
+
+            payload.clear();
+            appendValue(payload, static_cast<uint32_t>(it->first));
+            appendValue(payload, uint32_t{0});
+
+            uint32_t changedCount = 0;
+            for (gainput::DeviceButtonId buttonId = 0; buttonId < state->GetButtonCount(); ++buttonId)
+            {
+                const uint32_t bits = getButtonBits(*state, buttonId);
+                if (bits != recordedState[buttonId])
+                {
+                    recordedState[buttonId] = bits;
+                    appendValue(payload, static_cast<uint32_t>(buttonId));
+                    appendValue(payload, bits);
+                    ++changedCount;
+                }
+            }
+
+            if (changedCount > 0)
+            {
+                memcpy(payload.data() + sizeof(uint32_t), &changedCount, sizeof(uint32_t));
+                recorder.recordEvent(m_channel, payload);
+            }
+        }
+    }
+
+    void InputSessionRecording::replayStates(ISessionRecorder& recorder, gainput::InputManager& inputManager)
+    {
+        for (eastl::string_view payload : recorder.getReplayEvents(m_channel))
+        {
+            uint32_t deviceId = 0;
+            uint32_t changedCount = 0;
+            if (!readValue(payload, deviceId) || !readValue(payload, changedCount))
+            {
+                NAU_LOG_WARNING("Invalid input event in the session replay");
+                continue;
+            }
+
+            eastl::vector<uint32_t>& replayedState = m_states[static_cast<gainput::DeviceId>(deviceId)];
+            for (uint32_t i = 0; i < changedCount; ++i)
+            {
+                uint32_t buttonId = 0;
+                uint32_t bits = 0;
+                if (!readValue(payload, buttonId) || !readValue(payload, bits))
+                {
+                    NAU_LOG_WARNING("Truncated input event in the session replay");
+                    break;
+                }
+
+                if (replayedState.size() <= buttonId)
+                {
+                    replayedState.resize(buttonId + 1, 0);
+                }
+
+                replayedState[buttonId] = bits;
+            }
+        }
+
+        // The platform input collected by the update is replaced with the replayed states
+        for (auto it = inputManager.begin(); it != inputManager.end(); ++it)
+        {
+            gainput::InputState* const state = it->second->GetInputState();
+            if (!state)
+            {
+                continue;
+            }
+
+            const auto replayedState = m_states.find(it->first);
+            for (gainput::DeviceButtonId buttonId = 0; buttonId < state->GetButtonCount(); ++buttonId)
+            {
+                const bool hasValue = replayedState != m_states.end() && buttonId < replayedState->second.size();
+                state->Set(buttonId, std::bit_cast<float>(hasValue ? replayedState->second[buttonId] : 0u));
+            }
+        }
+    }
+}  // namespace nau::input
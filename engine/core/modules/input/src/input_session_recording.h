@@ -0,0 +1,41 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#pragma once
+#include <EASTL/string.h>
+#include <EASTL/unordered_map.h>
+#include <EASTL/vector.h>
+#include <gainput/gainput.h>
+
+#include "nau/app/session_recorder.h"
+
+namespace nau::input
+{
+    /**
+        Records the device states of the gainput manager into the session (see ISessionRecorder) and restores them on the replay.
+        Only the changed buttons are recorded: one event per device [device id:uint32][buttons count:uint32] [button id:uint32][value bits:uint32]...
+     */
+    class InputSessionRecording
+    {
+    public:
+        InputSessionRecording(eastl::string channel);
+
+        /**
+            Must be called right after the gainput manager update.
+         */
+        void processUpdate(gainput::InputManager& inputManager);
+
+    private:
+        ISessionRecorder* getRecorder();
+
+        void recordStates(ISessionRecorder& recorder, gainput::InputManager& inputManager);
+        void replayStates(ISessionRecorder& recorder, gainput::InputManager& inputManager);
+
+        const eastl::string m_channel;
+        ISessionRecorder* m_recorder = nullptr;
+        bool m_recorderRequested = false;
+
+        // The last recorded (or replayed) button values per device
+        eastl::unordered_map<gainput::DeviceId, eastl::vector<uint32_t>> m_states;
+    };
+}  // namespace nau::input
@@ -8,6 +8,9 @@
 #include "input_action_impl.h"
 #include "input_controller_impl.h"
 #include "input_devices_impl.h"
+#include <EASTL/algorithm.h>
+#include <EASTL/sort.h>
+
 #include "nau/dag_ioSys/dag_chainedMemIo.h"
 #include "nau/io/virtual_file_system.h"
 #include "nau/memory/bytes_buffer.h"
@@ -30,6 +33,7 @@ namespace nau
         InputSignalImpl* signal = InputSignalFactory::create(signalType);
         if (signal != nullptr)
         {
+            signal->setChangesCounter(&m_signalsChangesCounter);
             signal->generateName();
         }
         return signal;
@@ -60,6 +64,7 @@ namespace nau
         actionPtr->setType(type);
         actionPtr->setSignal(signal);
         m_actions.emplace(name, actionPtr);
+        ++m_signalsChangesCounter;
         return actionPtr;
     }
 
@@ -75,6 +80,7 @@ namespace nau
         if (actionPtr->deserialize(&block))
         {
             m_actions.emplace(actionPtr->getName(), actionPtr);
+            ++m_signalsChangesCounter;
             return actionPtr;
         }
         NAU_LOG_WARNING("addAction: deserialization failed");
@@ -88,6 +94,7 @@ namespace nau
             if (action == (*it).second)
             {
                 m_actions.erase(it);
+                ++m_signalsChangesCounter;
                 return true;
             }
         }
@@ -159,11 +166,16 @@ namespace nau
     {
         m_contexts.clear();
         m_contexts.emplace(context);
+        // The actions of the inactive contexts are not updated: the activated ones catch up with the state of their signals
+        m_updateAllActions = true;
     }
 
     void InputSystemImpl::addContext(const eastl::string& context)
     {
-        m_contexts.emplace(context);
+        if (m_contexts.emplace(context).second)
+        {
+            m_updateAllActions = true;
+        }
     }
 
     void InputSystemImpl::removeContext(const eastl::string& context)
@@ -202,20 +214,84 @@ namespace nau
         return devices;
     }
 
+    eastl::optional<GameUpdateAccess> InputSystemImpl::getPreUpdateAccess() const
+    {
+        // The devices are polled through the platform window messages: main thread only
+        return GameUpdateAccess{
+            .writes = {GameUpdateResource::Input}};
+    }
+
     void InputSystemImpl::gamePreUpdate(std::chrono::milliseconds dtMs)
     {
         const float dt = static_cast<float>(dtMs.count()) / 1000.f;
         m_inputManager.Update();
+        m_sessionRecording.processUpdate(m_inputManager);
+        if (m_lateLatchPending)
+        {
+            for (auto it = m_inputManager.begin(); it != m_inputManager.end(); ++it)
+            {
+                if (auto state = m_frameStates.find(it->first); state != m_frameStates.end())
+                {
+                    *it->second->GetPreviousInputState() = *state->second;
+                }
+            }
+            m_lateLatchPending = false;
+        }
+
         for (auto& controller : m_controllers)
         {
             controller.second->update(dt);
         }
+
+        if (m_indexedChangesCounter != m_signalsChangesCounter)
+        {
+            rebuildSignalSources();
+        }
+
+        // Only the actions which signals can change are updated: the keys or axes they read changed or they asked for the wakeup
+        ++m_updateIndex;
+        eastl::vector<eastl::shared_ptr<InputActionImpl>> scheduled;
+        if (m_updateAllActions)
+        {
+            for (auto& action : m_actions)
+            {
+                scheduleAction(eastl::static_pointer_cast<InputActionImpl>(action.second), scheduled);
+            }
+            m_updateAllActions = false;
+        }
+        for (auto& subscription : m_signalSources)
+        {
+            const float value = subscription.source.getValue();
+            if (value != subscription.value)
+            {
+                subscription.value = value;
+                for (auto& action : subscription.actions)
+                {
+                    scheduleAction(action, scheduled);
+                }
+            }
+        }
+        for (auto& action : m_polledActions)
+        {
+            scheduleAction(action, scheduled);
+        }
+        for (auto& action : m_awakeActions)
+        {
+            scheduleAction(action, scheduled);
+        }
+        m_awakeActions.clear();
+
+        eastl::sort(scheduled.begin(), scheduled.end(), [](const auto& left, const auto& right)
+        {
+            return left->m_order < right->m_order;
+        });
+
         // Actions with no context tag first
-        for (auto& action : m_actions)
+        for (auto& action : scheduled)
         {
-            if (action.second->isContextTag(""))
+            if (action->isContextTag(""))
             {
-                action.second->update(dt);
+                updateAction(action, dt);
             }
         }
         if (!m_contexts.empty())
@@ -223,26 +299,83 @@ namespace nau
             // Contexts can be changed in actions
             eastl::set<eastl::string> contexts = m_contexts;
             // Action with context tag processed once, even it have multiple tags
-            eastl::set<IInputAction*> processed;
             for (auto& context : contexts)
             {
-                for (auto& action : m_actions)
+                for (auto& action : scheduled)
                 {
-                    auto* actionPtr = action.second.get();
-                    if (processed.count(actionPtr) > 0)
+                    if (action->m_scheduledUpdate == m_updateIndex && action->isContextTag(context))
                     {
-                        continue;
-                    }
-                    if (actionPtr->isContextTag(context))
-                    {
-                        actionPtr->update(dt);
-                        processed.emplace(actionPtr);
+                        updateAction(action, dt);
                     }
                 }
             }
         }
     }
 
+    void InputSystemImpl::scheduleAction(const eastl::shared_ptr<InputActionImpl>& action, eastl::vector<eastl::shared_ptr<InputActionImpl>>& scheduled)
+    {
+        // The actions of the inactive contexts are skipped entirely
+        if (action->m_scheduledUpdate != m_updateIndex && action->isContextActive(m_contexts))
+        {
+            action->m_scheduledUpdate = m_updateIndex;
+            scheduled.push_back(action);
+        }
+    }
+
+    void InputSystemImpl::updateAction(const eastl::shared_ptr<InputActionImpl>& action, float dt)
+    {
+        action->m_scheduledUpdate = 0;
+        action->update(dt);
+        if (action->needsWakeup())
+        {
+            m_awakeActions.push_back(action);
+        }
+    }
+
+    void InputSystemImpl::rebuildSignalSources()
+    {
+        m_signalSources.clear();
+        m_polledActions.clear();
+        m_awakeActions.clear();
+
+        eastl::vector<InputSignalSource> sources;
+        size_t order = 0;
+        for (auto& [name, action] : m_actions)
+        {
+            auto actionImpl = eastl::static_pointer_cast<InputActionImpl>(action);
+            actionImpl->m_order = order++;
+
+            sources.clear();
+            if (!actionImpl->collectSources(sources))
+            {
+                m_polledActions.push_back(actionImpl);
+                continue;
+            }
+
+            for (const InputSignalSource& source : sources)
+            {
+                auto subscription = eastl::find_if(m_signalSources.begin(), m_signalSources.end(), [&source](const SignalSourceSubscription& subscription)
+                {
+                    return subscription.source == source;
+                });
+                if (subscription == m_signalSources.end())
+                {
+                    subscription = &m_signalSources.push_back();
+                    subscription->source = source;
+                    subscription->value = source.getValue();
+                }
+                if (subscription->actions.empty() || subscription->actions.back() != actionImpl)
+                {
+                    subscription->actions.push_back(actionImpl);
+                }
+            }
+        }
+
+        m_indexedChangesCounter = m_signalsChangesCounter;
+        // The actions are evaluated once with the new sources
+        m_updateAllActions = true;
+    }
+
     void InputSystemImpl::setInputSource(const eastl::string& source)
     {
         if (m_currentSource != source)
@@ -254,4 +387,47 @@ namespace nau
         }
     }
 
+    uint32_t InputSystemImpl::addLateLatchHandler(nau::Functor<void()> handler)
+    {
+        const uint32_t handlerId = ++m_lateLatchHandlerId;
+        m_lateLatchHandlers.emplace_back(handlerId, eastl::make_shared<nau::Functor<void()>>(std::move(handler)));
+        return handlerId;
+    }
+
+    void InputSystemImpl::removeLateLatchHandler(uint32_t handlerId)
+    {
+        eastl::erase_if(m_lateLatchHandlers, [handlerId](const auto& handler)
+        {
+            return handler.first == handlerId;
+        });
+    }
+
+    void InputSystemImpl::sampleLateInput()
+    {
+        if (!m_lateLatchPending)
+        {
+            // Keep the states of the frame update: the late sampling must not eat the transitions of the next update
+            for (auto it = m_inputManager.begin(); it != m_inputManager.end(); ++it)
+            {
+                const gainput::InputState* const deviceState = it->second->GetInputState();
+                auto& frameState = m_frameStates[it->first];
+                if (!frameState || frameState->GetButtonCount() != deviceState->GetButtonCount())
+                {
+                    frameState = eastl::make_unique<gainput::InputState>(m_inputManager.GetAllocator(), deviceState->GetButtonCount());
+                }
+                *frameState = *deviceState;
+            }
+            m_lateLatchPending = true;
+        }
+
+        m_inputManager.Update();
+        m_sessionRecording.processUpdate(m_inputManager);
+
+        const auto handlers = m_lateLatchHandlers;
+        for (const auto& [handlerId, handler] : handlers)
+        {
+            (*handler)();
+        }
+    }
+
 }  // namespace nau
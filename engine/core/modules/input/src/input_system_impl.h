@@ -6,9 +6,11 @@
 #include <EASTL/unordered_map.h>
 #include <EASTL/set.h>
 #include <EASTL/shared_ptr.h>
+#include <EASTL/unique_ptr.h>
 #include <EASTL/vector.h>
 #include <gainput/gainput.h>
 
+#include "input_session_recording.h"
 #include "nau/app/main_loop/game_system.h"
 #include "nau/input_system.h"
 #include "nau/rtti/rtti_impl.h"
@@ -18,6 +20,8 @@
 
 namespace nau
 {
+    class InputActionImpl;
+
     class InputSystemImpl final : public IServiceInitialization,
                                   public IInputSystem,
                                   public IGamePreUpdate
@@ -46,25 +50,65 @@ namespace nau
 
         void gamePreUpdate(std::chrono::milliseconds dt) override;
 
+        eastl::optional<GameUpdateAccess> getPreUpdateAccess() const override;
+
         gainput::InputManager& getGainput()
         {
             return m_inputManager;
         }
         void setInputSource(const eastl::string& source) override;
 
+        uint32_t addLateLatchHandler(nau::Functor<void()> handler) override;
+        void removeLateLatchHandler(uint32_t handlerId) override;
+        void sampleLateInput() override;
+
     private:
         class InputSignalFactory
         {
         public:
             static InputSignalImpl* create(const eastl::string& type);
         };
+
+        // The key or axis with the actions which signals read it
+        struct SignalSourceSubscription
+        {
+            InputSignalSource source;
+            float value = 0.f;
+            eastl::vector<eastl::shared_ptr<InputActionImpl>> actions;
+        };
+
+        void rebuildSignalSources();
+        void scheduleAction(const eastl::shared_ptr<InputActionImpl>& action, eastl::vector<eastl::shared_ptr<InputActionImpl>>& scheduled);
+        void updateAction(const eastl::shared_ptr<InputActionImpl>& action, float dt);
+
         gainput::InputManager m_inputManager;
+        input::InputSessionRecording m_sessionRecording{"input/system"};
         eastl::vector<eastl::shared_ptr<IInputDevice>> m_devices;
         eastl::unordered_map<eastl::string, eastl::shared_ptr<IInputController>> m_controllers;
         eastl::multimap<eastl::string, eastl::shared_ptr<IInputAction>> m_actions;
         eastl::set<eastl::string> m_contexts;
-        
+
+        // The actions are updated when the sources of their signals change (see gamePreUpdate)
+        eastl::vector<SignalSourceSubscription> m_signalSources;
+        // The actions with the signals which sources are not known: updated each frame
+        eastl::vector<eastl::shared_ptr<InputActionImpl>> m_polledActions;
+        // The actions which asked to be updated on the next frame (see InputActionImpl::needsWakeup)
+        eastl::vector<eastl::shared_ptr<InputActionImpl>> m_awakeActions;
+        // Incremented by the signals on the graph changes (and by the actions changes): the sources are rebuilt on the next update
+        uint32_t m_signalsChangesCounter = 0;
+        uint32_t m_indexedChangesCounter = UINT_MAX;
+        uint32_t m_updateIndex = 0;
+        bool m_updateAllActions = true;
+
         eastl::string m_currentSource;
         eastl::set<eastl::string> m_sources;
+
+        // The handlers are shared: the handler can be removed while it is being called
+        eastl::vector<eastl::pair<uint32_t, eastl::shared_ptr<nau::Functor<void()>>>> m_lateLatchHandlers;
+        uint32_t m_lateLatchHandlerId = 0;
+        // Device states at the frame update, restored as the previous states on the next frame update
+        // (so the transitions consumed by the late sampling are not lost for the actions)
+        eastl::unordered_map<gainput::DeviceId, eastl::unique_ptr<gainput::InputState>> m_frameStates;
+        bool m_lateLatchPending = false;
     };
 }  // namespace nau
@@ -15,6 +15,7 @@ namespace nau
             return;
         }
         m_inputs.push_back(eastl::shared_ptr<IInputSignal>(source));
+        notifyChanged();
     }
 
     IInputSignal* InputSignalGate::getInput(unsigned idx)
@@ -37,6 +38,30 @@ namespace nau
         }
     }
 
+    bool InputSignalGate::collectSources(eastl::vector<InputSignalSource>& sources)
+    {
+        for (auto& input : m_inputs)
+        {
+            if (!collectSignalSources(input.get(), sources))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool InputSignalGate::needsWakeup() const
+    {
+        for (auto& input : m_inputs)
+        {
+            if (signalNeedsWakeup(input.get()))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
     unsigned InputSignalGate::maxInputs() const
     {
         return m_maxInputs;
@@ -75,6 +100,7 @@ namespace nau
                     IInputSignal* signal = insys.createSignal(type);
                     signal->deserialize(signalBlk);
                     m_inputs.push_back(eastl::shared_ptr<IInputSignal>(signal));
+                    notifyChanged();
                 }
             }
         }
@@ -24,6 +24,10 @@ namespace nau
 
         void updateInputs(float dt, nau::Functor<void(IInputSignal*)> callback);
 
+        virtual bool collectSources(eastl::vector<InputSignalSource>& sources) override;
+
+        virtual bool needsWakeup() const override;
+
         virtual void serializeProperties(DataBlock* blk) const override;
 
         virtual void deserializeProperties(const DataBlock* blk) override;
@@ -37,6 +37,7 @@ namespace nau
     void InputSignalImpl::setController(IInputController* controller)
     {
         m_controller = controller;
+        notifyChanged();
     }
 
     IInputSignal::State InputSignalImpl::getState() const
@@ -55,6 +56,42 @@ namespace nau
         m_currState = state;
     }
 
+    void InputSignalImpl::notifyChanged()
+    {
+        if (m_properties.m_changesCounter != nullptr)
+        {
+            ++*m_properties.m_changesCounter;
+        }
+    }
+
+    void InputSignalImpl::setChangesCounter(uint32_t* counter)
+    {
+        m_properties.m_changesCounter = counter;
+    }
+
+    bool InputSignalImpl::collectSources([[maybe_unused]] eastl::vector<InputSignalSource>& sources)
+    {
+        return false;
+    }
+
+    bool InputSignalImpl::needsWakeup() const
+    {
+        return false;
+    }
+
+    bool InputSignalImpl::collectSignalSources(IInputSignal* signal, eastl::vector<InputSignalSource>& sources)
+    {
+        // The signals implemented outside of the input module are evaluated each frame
+        auto* const signalImpl = dynamic_cast<InputSignalImpl*>(signal);
+        return signalImpl != nullptr && signalImpl->collectSources(sources);
+    }
+
+    bool InputSignalImpl::signalNeedsWakeup(const IInputSignal* signal)
+    {
+        const auto* const signalImpl = dynamic_cast<const InputSignalImpl*>(signal);
+        return signalImpl == nullptr || signalImpl->needsWakeup();
+    }
+
     void InputSignalImpl::generateName()
     {
         eastl::string name = getType() + "_" + eastl::to_string(g_signalIdx++);
@@ -2,10 +2,33 @@
 // Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
 
 #pragma once
+#include <EASTL/vector.h>
+
 #include "nau/input_system.h"
 
 namespace nau
 {
+    /**
+        The device key or axis the signal state is evaluated from.
+     */
+    struct InputSignalSource
+    {
+        IInputDevice* device = nullptr;
+        unsigned id = 0;
+        bool isAxis = false;
+
+        float getValue() const
+        {
+            if (isAxis)
+            {
+                return device->getAxisState(id);
+            }
+            return device->getKeyState(id) == IInputDevice::Pressed ? 1.f : 0.f;
+        }
+
+        bool operator==(const InputSignalSource&) const = default;
+    };
+
     class InputSignalImpl : public IInputSignal
     {
     public:
@@ -51,6 +74,26 @@ namespace nau
 
         void generateName();
 
+        /**
+            Adds the keys and axes the signal state depends on.
+            Returns false if the sources are not known: the signal is evaluated each frame.
+         */
+        virtual bool collectSources(eastl::vector<InputSignalSource>& sources);
+
+        /**
+            Returns true if the signal must be evaluated on the next frame even if its sources do not change (e.g. its timer is running).
+         */
+        virtual bool needsWakeup() const;
+
+        /**
+            Sets the counter incremented on the changes of the signal graph: the properties, the controller and the inputs.
+         */
+        void setChangesCounter(uint32_t* counter);
+
+        static bool collectSignalSources(IInputSignal* signal, eastl::vector<InputSignalSource>& sources);
+
+        static bool signalNeedsWakeup(const IInputSignal* signal);
+
     protected:
         template <typename T>
         void addProperty(const eastl::string& key, const T& value)
@@ -60,6 +103,8 @@ namespace nau
 
         void updateState(State state);
 
+        void notifyChanged();
+
         eastl::string m_name;
         eastl::string m_type;
         math::vec4 m_vector = {0, 0, 0, 0};
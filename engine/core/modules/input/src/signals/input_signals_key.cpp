@@ -34,6 +34,26 @@ namespace nau
         keyToSignal(m_controller->getDevice()->getKeyState(m_key));
     }
 
+    bool InputSignalKey::collectSources(eastl::vector<InputSignalSource>& sources)
+    {
+        IInputDevice* const device = m_controller != nullptr ? m_controller->getDevice() : nullptr;
+        if (device == nullptr)
+        {
+            return false;
+        }
+
+        // The key can be not resolved yet: it is resolved by name as in update()
+        auto key = m_properties.get<eastl::string>(DataKey);
+        if (!key->empty())
+        {
+            if (const unsigned keyId = device->getKeyByName(*key); keyId != UINT_MAX)
+            {
+                sources.push_back({device, keyId, false});
+            }
+        }
+        return true;
+    }
+
     void InputSignalKey::serializeProperties(DataBlock* blk) const
     {
         blk->addStr(DataKey, m_properties.get<eastl::string>(DataKey)->c_str());
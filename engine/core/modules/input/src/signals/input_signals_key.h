@@ -15,6 +15,8 @@ namespace nau
 
         virtual void update(float dt) override;
 
+        virtual bool collectSources(eastl::vector<InputSignalSource>& sources) override;
+
     protected:
         virtual void serializeProperties(DataBlock* blk) const override;
 
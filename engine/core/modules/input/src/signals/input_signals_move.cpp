@@ -49,6 +49,30 @@ namespace nau
         }
     }
 
+    bool InputSignalAxis::collectSources(eastl::vector<InputSignalSource>& sources)
+    {
+        IInputDevice* const device = m_controller != nullptr ? m_controller->getDevice() : nullptr;
+        if (device == nullptr)
+        {
+            return false;
+        }
+
+        for (const char* axisProperty : {DataAxisX, DataAxisY, DataAxisZ, DataAxisW})
+        {
+            if (const int axis = *m_properties.get<int>(axisProperty); axis != -1)
+            {
+                sources.push_back({device, static_cast<unsigned>(axis), true});
+            }
+        }
+        return true;
+    }
+
+    bool InputSignalAxis::needsWakeup() const
+    {
+        // The signal is high on the frame the axis moves: it goes low on the next frame without the axis change
+        return getState() == High;
+    }
+
     void InputSignalMove::update(float dt)
     {
         InputSignalAxis::update(dt);
@@ -14,6 +14,10 @@ namespace nau
     protected:
         virtual void update(float dt) override;
 
+        virtual bool collectSources(eastl::vector<InputSignalSource>& sources) override;
+
+        virtual bool needsWakeup() const override;
+
         virtual void serializeProperties(DataBlock* blk) const override;
         virtual void deserializeProperties(const DataBlock* blk) override;
 
@@ -41,6 +41,16 @@ namespace nau
         });
     }
 
+    bool InputSignalDelay::needsWakeup() const
+    {
+        // The delay is counting while the input is held
+        if (m_passed > 0.f && getState() == Low)
+        {
+            return true;
+        }
+        return InputSignalGate::needsWakeup();
+    }
+
     void InputSignalDelay::serializeProperties(DataBlock* blk) const
     {
         InputSignalGate::serializeProperties(blk);
@@ -100,6 +110,16 @@ namespace nau
         });
     }
 
+    bool InputSignalMultiple::needsWakeup() const
+    {
+        // The counter is reset by the timer
+        if (m_numCurrent > 0)
+        {
+            return true;
+        }
+        return InputSignalGate::needsWakeup();
+    }
+
     void InputSignalMultiple::serializeProperties(DataBlock* blk) const
     {
         InputSignalGate::serializeProperties(blk);
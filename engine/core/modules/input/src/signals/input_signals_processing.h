@@ -13,6 +13,8 @@ namespace nau
 
         virtual void update(float dt) override;
 
+        virtual bool needsWakeup() const override;
+
     protected:
         virtual void serializeProperties(DataBlock* blk) const override;
 
@@ -29,6 +31,8 @@ namespace nau
 
         virtual void update(float dt) override;
 
+        virtual bool needsWakeup() const override;
+
     protected:
         virtual void serializeProperties(DataBlock* blk) const override;
 
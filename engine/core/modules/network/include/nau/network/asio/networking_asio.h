@@ -2,6 +2,11 @@
 // Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
 
 #pragma once
+#include <EASTL/unique_ptr.h>
+
+#include <optional>
+#include <thread>
+
 #include "asio.hpp"
 #include "nau/network/napi/networking.h"
 
@@ -9,9 +14,14 @@ namespace nau
 {
     class NetworkingListenerASIO;
     class NetworkingConnectorASIO;
+    class ASIO_GameThreadCalls;
 
     /**
      *  @brief Provides interface for ASIO network context instance.
+     *
+     *  After init() the context is run by the dedicated I/O thread: the sockets are read and written there,
+     *  update() only dispatches the connection callbacks. Without init() the context is polled by update().
+     *  The messages written between the updates are coalesced: update() sends them by one write per connection.
      */
     class NetworkingASIO : public INetworking
     {
@@ -36,14 +46,14 @@ namespace nau
         bool applyConfig(const eastl::string& data) override;
 
         /**
-         * @brief Initializes networking context. Call this function once before the first update.
+         * @brief Initializes networking context (starts the I/O thread). Call this function once before the first update.
          *
          * @return `true` on success, `false` otherwise.
          */
         bool init() override;
 
         /**
-         * @brief Shuts down the context and frees all resources.
+         * @brief Shuts down the context (stops the I/O thread) and frees all resources.
          *
          * @return `true` on success, `false` otherwise.
         */
@@ -90,6 +100,9 @@ namespace nau
     private:
         eastl::string m_identity;
         asio::io_context m_io_context;
+        std::optional<asio::executor_work_guard<asio::io_context::executor_type>> m_workGuard;
+        std::thread m_ioThread;
+        eastl::unique_ptr<ASIO_GameThreadCalls> m_gameThreadCalls;
         eastl::vector<eastl::shared_ptr<NetworkingListenerASIO>> m_listeners;
         eastl::vector<eastl::shared_ptr<NetworkingConnectorASIO>> m_connectors;
     };
@@ -11,14 +11,17 @@ namespace nau
 {
     class ASIO_Acceptor;
     class ASIO_Connection;
+    class ASIO_GameThreadCalls;
 
     struct NetworkingConectionASIOContext
     {
         asio::io_context& m_io_context;
+        ASIO_GameThreadCalls& m_gameThreadCalls;
         nau::Functor<void(eastl::shared_ptr<INetworkingTransport>)> m_successCallback;
         nau::Functor<void(void)> m_failCallback;
-        NetworkingConectionASIOContext(asio::io_context& context) :
-            m_io_context(context)
+        NetworkingConectionASIOContext(asio::io_context& context, ASIO_GameThreadCalls& gameThreadCalls) :
+            m_io_context(context),
+            m_gameThreadCalls(gameThreadCalls)
         {
         }
     };
@@ -29,7 +32,7 @@ namespace nau
     class NetworkingListenerASIO : public INetworkingListener
     {
     public:
-        NetworkingListenerASIO(asio::io_context& io_context);
+        NetworkingListenerASIO(asio::io_context& io_context, ASIO_GameThreadCalls& gameThreadCalls);
         ~NetworkingListenerASIO();
 
         /**
@@ -57,6 +60,11 @@ namespace nau
         */
         bool stop() override;
 
+        /**
+        @brief Sends the messages written to the accepted connections since the previous flush
+        */
+        void flush();
+
     private:
         NetworkingConectionASIOContext m_context;
         eastl::shared_ptr<ASIO_Acceptor> m_acceptor;
@@ -69,7 +77,7 @@ namespace nau
     class NetworkingConnectorASIO : public INetworkingConnector
     {
     public:
-        NetworkingConnectorASIO(asio::io_context& io_context);
+        NetworkingConnectorASIO(asio::io_context& io_context, ASIO_GameThreadCalls& gameThreadCalls);
         ~NetworkingConnectorASIO();
 
         /**
@@ -113,6 +121,11 @@ namespace nau
          */
         bool stop() override;
 
+        /**
+         * @brief Sends the messages written to the connection since the previous flush.
+         */
+        void flush();
+
     private:
         NetworkingConectionASIOContext m_context;
         eastl::shared_ptr<ASIO_Connection> m_connection;
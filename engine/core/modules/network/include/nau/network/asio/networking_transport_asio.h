@@ -14,6 +14,7 @@ namespace nau
     class NetworkingTransportASIO : public INetworkingTransport
     {
     public:
+        using INetworkingTransport::write;
 
         /**
          * @brief Initialization constructor.
@@ -25,7 +26,10 @@ namespace nau
         /**
          * @brief Attempts to read received messages.
          *
-         * @param [out] messages    A collection of received message. Empty if no messages.
+         * The messages are received by the I/O thread, the call only takes the complete ones from the queue.
+         * The buffers of the messages that are passed in are taken back to the connection buffer pool.
+         *
+         * @param [in, out] messages    A collection of received message. Empty if no messages.
          * @return                  Number of received messages, i.e. size of **messages**.
          */
         size_t read(eastl::vector<nau::NetworkingMessage>& messages) override;
@@ -33,11 +37,20 @@ namespace nau
         /**
          * @brief Attempts to send the specified message.
          *
+         * The message is queued, it is sent with the other ones on the next networking update.
+         *
          * @param [in] message  Message to send.
          * @return              `true` if the message can be sent, `false` otherwise.
          */
         bool write(const nau::NetworkingMessage& message) override;
 
+        /**
+         * @brief Retrieves the depths of the queues between the game thread and the I/O thread.
+         *
+         * @return Queue depths (approximate: the I/O thread changes them concurrently).
+         */
+        NetworkingTransportStatistics statistics() const override;
+
         /**
          * @brief Checks if the connection is alive.
          *
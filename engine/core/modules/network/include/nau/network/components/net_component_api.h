@@ -3,14 +3,92 @@
 // network_component_api.h
 
 #pragma once
+#include <EASTL/string.h>
 #include <EASTL/string_view.h>
 
+#include <optional>
+
 #include "nau/memory/bytes_buffer.h"
 #include "nau/rtti/rtti_object.h"
 #include "nau/scene/scene_object.h"
 
 namespace nau
 {
+    /**
+     * @brief Describes which peers are interested in the component replication and how often.
+     */
+    struct NetRelevancy
+    {
+        /**
+         * @brief World position of the component, used for the distance check.
+         */
+        math::vec3 position = math::vec3::zero();
+
+        /**
+         * @brief Max distance from the peer view position at which the component is relevant (0 means unlimited).
+         */
+        float relevancyDistance = 0.f;
+
+        /**
+         * @brief Visibility groups mask: the component is relevant to the peers interested in any of these groups.
+         */
+        uint32_t visibilityGroups = ~0u;
+
+        /**
+         * @brief The component is replicated to all peers regardless of the distance and groups.
+         */
+        bool alwaysRelevant = true;
+
+        /**
+         * @brief Amount added to the component priority accumulator each frame when the component has changes to send.
+         * When the bandwidth budget is limited, the components with the highest accumulated priority are sent first.
+         */
+        float priority = 1.f;
+    };
+
+    /**
+     * @brief Describes the replication interest of the remote peer.
+     */
+    struct NetPeerInterest
+    {
+        /**
+         * @brief Position of the peer view (player, camera), no distance check if not set.
+         */
+        std::optional<math::vec3> viewPosition;
+
+        /**
+         * @brief Visibility groups the peer is interested in.
+         */
+        uint32_t visibilityGroups = ~0u;
+
+        /**
+         * @brief Max size (in bytes) of the component data sent to the peer per frame (0 means unlimited).
+         */
+        size_t bandwidthBudget = 0;
+    };
+
+    /**
+     * @brief Describes how the replicas present the received states of the interpolated components.
+     */
+    struct NetInterpolationSettings
+    {
+        /**
+         * @brief Time (in seconds) the replicas are presented behind the latest received state.
+         * It should be larger than the send interval of the remote peer to have the states to interpolate between.
+         */
+        float interpolationDelay = 0.1f;
+
+        /**
+         * @brief The measured arrival jitter multiplied by the scale is added to the delay (0 disables the jitter buffer adaptation).
+         */
+        float jitterScale = 2.f;
+
+        /**
+         * @brief Max total delay (in seconds).
+         */
+        float maxDelay = 0.5f;
+    };
+
     /**
       * @brief Provides an interface for serializing and deserializing a scene object component.
       */
@@ -45,6 +123,26 @@ namespace nau
          */
         virtual bool isReplicated() const = 0;
 
+        /**
+         * @brief Retrieves the component relevancy (by default the component is always relevant).
+         *
+         * @return Relevancy of the component to the connected peers.
+         */
+        virtual NetRelevancy getNetRelevancy()
+        {
+            return {};
+        }
+
+        /**
+         * @brief Retrieves the component type name that the replication statistics are grouped by.
+         *
+         * @return Type name, empty if the component does not provide it.
+         */
+        virtual eastl::string getNetTypeName()
+        {
+            return {};
+        }
+
         /**
          * @brief Serializes the component into a binary buffer.
          * 
@@ -59,6 +157,29 @@ namespace nau
          */
         virtual void netRead(const BytesBuffer& buffer) = 0;
 
+        /**
+         * @brief Deserializes the binary state of the remote frame sent at the remote time.
+         * The interpolated components keep the states and present them in netInterpolate(), by default the state is read at once.
+         *
+         * @param [in] buffer     Buffer with serialized data.
+         * @param [in] remoteTime Send time of the frame (in seconds, by the clock of the remote peer).
+         * @return                `true` if the state is buffered to be presented by netInterpolate().
+         */
+        virtual bool netReadBuffered(const BytesBuffer& buffer, [[maybe_unused]] double remoteTime)
+        {
+            netRead(buffer);
+            return false;
+        }
+
+        /**
+         * @brief Presents the buffered states at the playback time (called once per frame after the received states are read).
+         *
+         * @param [in] playbackTime Time (by the clock of the remote peer) to present: the interpolation delay behind the received states.
+         */
+        virtual void netInterpolate([[maybe_unused]] double playbackTime)
+        {
+        }
+
         /**
          * @brief Serializes the component into a JSON text buffer.
          * 
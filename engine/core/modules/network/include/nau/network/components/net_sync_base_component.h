@@ -3,6 +3,7 @@
 
 #pragma once
 #include "nau/diag/logging.h"
+#include "nau/dispatch/class_descriptor.h"
 #include "nau/network/components/net_component_api.h"
 #include "nau/network/components/net_scene_component.h"
 #include "nau/network/netsync/net_snapshots.h"
@@ -32,6 +33,17 @@ namespace nau
             CLASS_ATTRIBUTE(scene::ComponentDisplayNameAttrib, "Net Sync Base"),
             CLASS_ATTRIBUTE(scene::ComponentDescriptionAttrib, "Net Sync Base (description)"))
 
+    public:
+        /**
+         * @brief Sets the replication relevancy (distance, visibility groups, priority), the position is taken from the parent object.
+         *
+         * @param [in] relevancy Relevancy settings.
+         */
+        void setNetRelevancy(const NetRelevancy& relevancy)
+        {
+            m_relevancy = relevancy;
+        }
+
     protected:
         /**
          * @brief Changes whether the component is replicated from the remote peer or owned by the local peer.
@@ -53,6 +65,28 @@ namespace nau
             return m_isReplicated;
         }
 
+        /**
+         * @brief Retrieves the relevancy set by setNetRelevancy at the parent object world position.
+         *
+         * @return Component relevancy.
+         */
+        NetRelevancy getNetRelevancy() override
+        {
+            NetRelevancy relevancy = m_relevancy;
+            relevancy.position = getParentObject().getWorldTransform().getTranslation();
+            return relevancy;
+        }
+
+        /**
+         * @brief Retrieves the component class name.
+         *
+         * @return Type name.
+         */
+        eastl::string getNetTypeName() override
+        {
+            return eastl::string{getClassDescriptor()->getClassName().c_str()};
+        }
+
         /*
          * @brief Retrieves the scene name.
          * 
@@ -143,6 +177,21 @@ namespace nau
             }
         }
 
+        /*
+         * @brief Removes the component from the snapshot manager.
+         */
+        void onComponentDeactivated() override
+        {
+            if (m_activated)
+            {
+                m_activated = false;
+                if (m_snapshots != nullptr)
+                {
+                    m_snapshots->onComponentDeactivated(this);
+                }
+            }
+        }
+
         /*
          * @brief Finds the root scene object.
          * 
@@ -196,5 +245,6 @@ namespace nau
         INetSnapshots* m_snapshots = nullptr;
         IComponentNetScene* m_scene = nullptr;
         eastl::string m_path;
+        NetRelevancy m_relevancy;
     };
 }  // namespace nau
@@ -2,6 +2,13 @@
 // Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
 
 #pragma once
+#include <EASTL/deque.h>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+#include "nau/network/netsync/net_bit_stream.h"
 #include "nau/scene/components/component_attributes.h"
 #include "nau/scene/components/internal/component_internal_attributes.h"
 #include "nau/serialization/json_utils.h"
@@ -9,6 +16,27 @@
 
 namespace nau
 {
+    /*
+    @brief Quantization of the replicated transform (must be the same on all peers)
+    */
+    struct NetworkTransformQuantization
+    {
+        /* Positions are written as fixed-point values relative to the origin (world or cell origin) */
+        math::vec3 origin = math::vec3::zero();
+        /* Position step in world units */
+        float positionPrecision = 0.001f;
+        /* Bits per each of the three smallest quaternion components */
+        unsigned rotationBits = 15;
+        /* Uniform scale is written as the single value */
+        bool elideUniformScale = true;
+
+        NAU_CLASS_FIELDS(
+            CLASS_FIELD(origin),
+            CLASS_FIELD(positionPrecision),
+            CLASS_FIELD(rotationBits),
+            CLASS_FIELD(elideUniformScale))
+    };
+
     /*
     @brief Data for NetworkTransform component sample
     */
@@ -33,6 +61,139 @@ namespace nau
             return res.isSuccess();
         }
 
+        static constexpr float Sqrt2 = 1.41421356f;
+
+        /*
+        @brief Writes bit-packed transform: fixed-point position, smallest-three rotation and optionally single uniform scale value
+        */
+        void writeQuantized(BytesBuffer& buffer, const NetworkTransformQuantization& quantization) const
+        {
+            NAU_ASSERT(quantization.rotationBits > 0 && quantization.rotationBits <= 30);
+            NetBitWriter writer{buffer};
+
+            // position: bit width of the largest zigzag encoded axis value, then the values
+            uint32_t positionValues[3];
+            uint32_t maxValue = 0;
+            const math::vec3 offset = (position - quantization.origin) / quantization.positionPrecision;
+            const float offsetValues[3] = {static_cast<float>(offset.getX()), static_cast<float>(offset.getY()), static_cast<float>(offset.getZ())};
+            for (int i = 0; i < 3; ++i)
+            {
+                const float clamped = std::clamp(std::round(offsetValues[i]), -2147483648.f, 2147483520.f);
+                const int32_t value = static_cast<int32_t>(clamped);
+                positionValues[i] = (static_cast<uint32_t>(value) << 1) ^ static_cast<uint32_t>(value >> 31);
+                maxValue = std::max(maxValue, positionValues[i]);
+            }
+
+            const unsigned positionBits = static_cast<unsigned>(std::bit_width(maxValue));
+            writer.writeBits(positionBits, 6);
+            for (const uint32_t value : positionValues)
+            {
+                writer.writeBits(value, positionBits);
+            }
+
+            // rotation: index of the largest component (that is restored from the others), the others are in [-1/sqrt(2), 1/sqrt(2)]
+            const math::quat normalized = math::normalize(rotation);
+            float components[4] = {static_cast<float>(normalized.getX()), static_cast<float>(normalized.getY()), static_cast<float>(normalized.getZ()), static_cast<float>(normalized.getW())};
+            unsigned largest = 0;
+            for (unsigned i = 1; i < 4; ++i)
+            {
+                if (std::abs(components[i]) > std::abs(components[largest]))
+                {
+                    largest = i;
+                }
+            }
+
+            const float sign = components[largest] < 0.f ? -1.f : 1.f;
+            const float maxQuantized = static_cast<float>((1u << quantization.rotationBits) - 1);
+            writer.writeBits(largest, 2);
+            for (unsigned i = 0; i < 4; ++i)
+            {
+                if (i != largest)
+                {
+                    const float unit = std::clamp(components[i] * sign * Sqrt2 * 0.5f + 0.5f, 0.f, 1.f);
+                    writer.writeBits(static_cast<uint32_t>(std::round(unit * maxQuantized)), quantization.rotationBits);
+                }
+            }
+
+            // scale
+            const float scaleX = static_cast<float>(scale.getX());
+            const bool isUniformScale = quantization.elideUniformScale && scaleX == static_cast<float>(scale.getY()) && scaleX == static_cast<float>(scale.getZ());
+            writer.writeBool(isUniformScale);
+            writer.writeFloat(scaleX);
+            if (!isUniformScale)
+            {
+                writer.writeFloat(static_cast<float>(scale.getY()));
+                writer.writeFloat(static_cast<float>(scale.getZ()));
+            }
+        }
+
+        bool readQuantized(const BytesBuffer& buffer, const NetworkTransformQuantization& quantization)
+        {
+            NAU_ASSERT(quantization.rotationBits > 0 && quantization.rotationBits <= 30);
+            NetBitReader reader{buffer.data(), buffer.size()};
+
+            uint32_t positionBits = 0;
+            if (!reader.readBits(positionBits, 6) || positionBits > 32)
+            {
+                return false;
+            }
+
+            float offset[3] = {};
+            for (int i = 0; i < 3; ++i)
+            {
+                uint32_t value = 0;
+                if (!reader.readBits(value, positionBits))
+                {
+                    return false;
+                }
+                offset[i] = static_cast<float>(static_cast<int32_t>(value >> 1) ^ -static_cast<int32_t>(value & 1));
+            }
+
+            uint32_t largest = 0;
+            if (!reader.readBits(largest, 2))
+            {
+                return false;
+            }
+
+            const float maxQuantized = static_cast<float>((1u << quantization.rotationBits) - 1);
+            float components[4] = {};
+            float sumSquares = 0.f;
+            for (unsigned i = 0; i < 4; ++i)
+            {
+                if (i != largest)
+                {
+                    uint32_t value = 0;
+                    if (!reader.readBits(value, quantization.rotationBits))
+                    {
+                        return false;
+                    }
+                    components[i] = (static_cast<float>(value) / maxQuantized - 0.5f) * 2.f / Sqrt2;
+                    sumSquares += components[i] * components[i];
+                }
+            }
+            components[largest] = std::sqrt(std::max(0.f, 1.f - sumSquares));
+
+            bool isUniformScale = false;
+            float scaleValues[3] = {};
+            if (!reader.readBool(isUniformScale) || !reader.readFloat(scaleValues[0]))
+            {
+                return false;
+            }
+            if (isUniformScale)
+            {
+                scaleValues[1] = scaleValues[2] = scaleValues[0];
+            }
+            else if (!reader.readFloat(scaleValues[1]) || !reader.readFloat(scaleValues[2]))
+            {
+                return false;
+            }
+
+            position = quantization.origin + math::vec3{offset[0], offset[1], offset[2]} * quantization.positionPrecision;
+            rotation = math::normalize(math::quat{components[0], components[1], components[2], components[3]});
+            scale = math::vec3{scaleValues[0], scaleValues[1], scaleValues[2]};
+            return true;
+        }
+
         bool read(const eastl::string& buffer)
         {
             Result<RuntimeValue::Ptr> parseResult = serialization::jsonParseString(buffer, getDefaultAllocator());
@@ -51,7 +212,9 @@ namespace nau
 
     /**
     @brief NetSyncTransformComponent sample
-    Sync transform state between network peers
+    Sync transform state between network peers.
+    The replica buffers the received states and presents them interpolated at the playback time (behind the received ones
+    by the interpolation delay), past the newest state the position is extrapolated up to the max extrapolation time.
     */
     class NetSyncTransformComponent final : public NetSyncBaseComponent
     {
@@ -65,7 +228,9 @@ namespace nau
             CLASS_ATTRIBUTE(scene::ComponentDescriptionAttrib, "Net Sync Transform (description)"))
 
         NAU_CLASS_FIELDS(
-            CLASS_NAMED_FIELD(m_transform, "transform"))
+            CLASS_NAMED_FIELD(m_transform, "transform"),
+            CLASS_NAMED_FIELD(m_quantization, "quantization"),
+            CLASS_NAMED_FIELD(m_maxExtrapolation, "maxExtrapolation"))
 
         bool wasReplicated() const
         {
@@ -75,17 +240,89 @@ namespace nau
     protected:
         void netWrite(BytesBuffer& buffer) override
         {
-            auto str = serialization::JsonUtils::stringify(*this);
-            size_t length = str.length();
-            buffer.resize(length);
-            std::byte* data = buffer.data();
-            std::memcpy(data, str.begin(), length);
+            auto& owner = getParentObject();
+            m_transform.position = owner.getTranslation();
+            m_transform.rotation = owner.getRotation();
+            m_transform.scale = owner.getScale();
+
+            m_transform.writeQuantized(buffer, m_quantization);
         }
 
         void netRead(const BytesBuffer& buffer) override
         {
-            eastl::u8string str((char8_t*)buffer.data(), (char8_t*)(buffer.data() + buffer.size()));
-            auto res = serialization::JsonUtils::parse(*this, str);
+            if (!m_transform.readQuantized(buffer, m_quantization))
+            {
+                NAU_LOG_WARNING("Invalid net transform data");
+                return;
+            }
+
+            setOwnerTransform(m_transform);
+            m_wasReplicated = true;
+        }
+
+        bool netReadBuffered(const BytesBuffer& buffer, double remoteTime) override
+        {
+            NetworkTransformData transform;
+            if (!transform.readQuantized(buffer, m_quantization))
+            {
+                NAU_LOG_WARNING("Invalid net transform data");
+                return true;
+            }
+
+            // the late state is older than the presented ones
+            if (!m_states.empty() && remoteTime <= m_states.back().time)
+            {
+                return true;
+            }
+
+            if (m_states.size() == MaxBufferedStates)
+            {
+                m_states.pop_front();
+            }
+            m_states.push_back({remoteTime, transform});
+            m_transform = transform;
+            return true;
+        }
+
+        void netInterpolate(double playbackTime) override
+        {
+            // only the last state before the playback time is kept
+            while (m_states.size() > 2 && m_states[1].time <= playbackTime)
+            {
+                m_states.pop_front();
+            }
+            if (m_states.empty())
+            {
+                return;
+            }
+
+            const TimedTransform& from = m_states.front();
+            if (m_states.size() == 1 || playbackTime <= from.time)
+            {
+                setOwnerTransform(from.transform);
+                m_wasReplicated = true;
+                return;
+            }
+
+            const TimedTransform& to = m_states[1];
+            const double interval = to.time - from.time;
+            NetworkTransformData transform = to.transform;
+            if (playbackTime <= to.time)
+            {
+                const float alpha = static_cast<float>((playbackTime - from.time) / interval);
+                transform.position = math::lerp(alpha, from.transform.position, to.transform.position);
+                transform.rotation = math::slerp(alpha, from.transform.rotation, to.transform.rotation);
+                transform.scale = math::lerp(alpha, from.transform.scale, to.transform.scale);
+            }
+            else
+            {
+                // the next state is late (or lost): the position continues by the last velocity for a limited time
+                const double extrapolation = std::min(playbackTime - to.time, static_cast<double>(m_maxExtrapolation));
+                const float alpha = static_cast<float>(1.0 + extrapolation / interval);
+                transform.position = math::lerp(alpha, from.transform.position, to.transform.position);
+            }
+
+            setOwnerTransform(transform);
             m_wasReplicated = true;
         }
 
@@ -101,14 +338,31 @@ namespace nau
         void netRead(const eastl::string& buffer) override
         {
             m_transform.read(buffer);
-            auto& owner = getParentObject();
-            owner.setTranslation(m_transform.position);
-            owner.setRotation(m_transform.rotation);
-            owner.setScale(m_transform.scale);
+            setOwnerTransform(m_transform);
             m_wasReplicated = true;
         }
 
+        void setOwnerTransform(const NetworkTransformData& transform)
+        {
+            auto& owner = getParentObject();
+            owner.setTranslation(transform.position);
+            owner.setRotation(transform.rotation);
+            owner.setScale(transform.scale);
+        }
+
+        struct TimedTransform
+        {
+            double time;
+            NetworkTransformData transform;
+        };
+
+        static constexpr size_t MaxBufferedStates = 32;
+
         NetworkTransformData m_transform;
+        NetworkTransformQuantization m_quantization;
+        /* Time (in seconds) the position is extrapolated for past the newest received state */
+        float m_maxExtrapolation = 0.25f;
+        eastl::deque<TimedTransform> m_states;
         bool m_wasReplicated = false;
     };
 }  // namespace nau
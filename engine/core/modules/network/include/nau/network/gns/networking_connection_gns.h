@@ -0,0 +1,163 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+// networking_connection_gns
+
+#pragma once
+#include <EASTL/vector.h>
+
+#include "nau/network/napi/networking_connection.h"
+
+namespace nau
+{
+    class NetworkingTransportGNS;
+
+    /**
+     * @brief Listens for GameNetworkingSockets (UDP) connections.
+     */
+    class NetworkingListenerGNS : public INetworkingListener
+    {
+    public:
+        NetworkingListenerGNS();
+        ~NetworkingListenerGNS();
+
+        /**
+         * @brief Sets the callback that is dispatched when a connection attempts to authorize.
+         *
+         * @param [in] cb Callback to assign.
+         *
+         * @note The callback takes the identity to check and the address of incoming connection as parameters.
+         */
+        void setOnAuthorization(nau::Functor<bool(const INetworkingIdentity& identity, const NetworkingAddress&)> cb) override;
+
+        /**
+         * @brief Listens for connections.
+         *
+         * @param [in] uri              URI for the local endpoint (udp://host:port, the host may be empty).
+         * @param [in] successCallback  Callback that is dispatched for each accepted connection.
+         * @param [in] failCallback     Callback that is dispatched, if listening has failed.
+         * @return                      `true`, if listening has started, `false` otherwise.
+         */
+        bool listen(const eastl::string& uri, nau::Functor<void(eastl::shared_ptr<INetworkingTransport>)> successCallback, nau::Functor<void(void)> failCallback) override;
+
+        /**
+         * @brief Stops listening.
+         *
+         * @return `true` if stopped, `false` otherwise.
+         */
+        bool stop() override;
+
+        /**
+         * @brief Retrieves the GameNetworkingSockets listen socket handle (0 if not listening).
+         */
+        uint32_t listenSocket() const
+        {
+            return m_listenSocket;
+        }
+
+        /**
+         * @brief Authorizes the incoming connection.
+         *
+         * @return `true` if the connection can be accepted.
+         */
+        bool onConnecting(const NetworkingAddress& address);
+
+        /**
+         * @brief Creates the transport for the accepted connection and dispatches the success callback.
+         */
+        void onConnected(uint32_t connection, const eastl::string& remoteEndPoint);
+
+        /**
+         * @brief Handles the connection closed by the remote peer.
+         */
+        void onClosed(uint32_t connection);
+
+    private:
+        uint32_t m_listenSocket = 0;
+        eastl::string m_localEndPoint;
+        nau::Functor<void(eastl::shared_ptr<INetworkingTransport>)> m_successCallback;
+        nau::Functor<void(void)> m_failCallback;
+        nau::Functor<bool(const INetworkingIdentity&, const NetworkingAddress&)> m_authorizationCallback;
+        eastl::vector<eastl::shared_ptr<NetworkingTransportGNS>> m_transports;
+    };
+
+    /**
+     * @brief Establishing a GameNetworkingSockets-based (UDP) network connection.
+     */
+    class NetworkingConnectorGNS : public INetworkingConnector
+    {
+    public:
+        NetworkingConnectorGNS();
+        ~NetworkingConnectorGNS();
+
+        /**
+         * @brief Sets the callback that is dispatched when a connection attempts to authorize.
+         *
+         * @param [in] cb Callback to assign.
+         *
+         * @note The callback takes the identity to check and the address of incoming connection as parameters.
+         */
+        void setOnAuthorization(nau::Functor<bool(const INetworkingIdentity& identity, const NetworkingAddress&)> cb) override;
+
+        /**
+         * @brief Connects using URI with callbacks.
+         *
+         * @param [in] uri              URI for the remote endpoint (udp://host:port).
+         * @param [in] successCallback  Callback that is dispatched, if the connection has been successful.
+         * @param [in] failCallback     Callback that is dispatched, if the connection has failed.
+         * @return                      `true`, if connection attempt has started, `false` otherwise.
+         */
+        bool connect(const eastl::string& uri,
+                     nau::Functor<void(eastl::shared_ptr<INetworkingTransport>)> successCallback,
+                     nau::Functor<void(void)> failCallback) override;
+
+        /**
+         * @brief Connects using URI with callbacks.
+         *
+         * @param [in] uri                  URI for remote endpoint.
+         * @param [in] successCallback      Callback that is dispatched, if the connection has been successful.
+         * @param [in] failCallback         Callback that is dispatched, if the connection has failed.
+         * @param [in] signalingCallback    Callback to signaling service (not used: the connection is made by the IP address).
+         * @return                          `true`, if connection attempt has started, `false` otherwise.
+         */
+        bool connect(const eastl::string& uri,
+                     nau::Functor<void(eastl::shared_ptr<INetworkingTransport>)> successCallback,
+                     nau::Functor<void(void)> failCallback,
+                     nau::Functor<void(eastl::shared_ptr<INetworkingSignaling>)> signalingCallback) override;
+
+        /**
+         * @brief Stops connection attempts.
+         *
+         * @return `true`, if connection attempts has been stopped, `false` otherwise.
+         */
+        bool stop() override;
+
+        /**
+         * @brief Retrieves the GameNetworkingSockets connection handle (0 if not connecting).
+         */
+        uint32_t connection() const
+        {
+            return m_connection;
+        }
+
+        /**
+         * @brief Creates the transport for the established connection and dispatches the success callback.
+         *
+         * @note GameNetworkingSockets does not expose the local address of the outgoing connection: the local endpoint is "udp://".
+         */
+        void onConnected();
+
+        /**
+         * @brief Handles the connection closed by the remote peer (or failed connection attempt).
+         */
+        void onClosed();
+
+    private:
+        uint32_t m_connection = 0;
+        eastl::string m_remoteEndPoint;
+        nau::Functor<void(eastl::shared_ptr<INetworkingTransport>)> m_successCallback;
+        nau::Functor<void(void)> m_failCallback;
+        nau::Functor<bool(const INetworkingIdentity&, const NetworkingAddress&)> m_authorizationCallback;
+        eastl::shared_ptr<NetworkingTransportGNS> m_transport;
+    };
+
+}  // namespace nau
@@ -0,0 +1,109 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#pragma once
+#include <EASTL/unique_ptr.h>
+#include <EASTL/vector.h>
+
+#include "nau/network/napi/networking.h"
+
+struct SteamNetConnectionStatusChangedCallback_t;
+
+namespace nau
+{
+    class NetworkingListenerGNS;
+    class NetworkingConnectorGNS;
+
+    /**
+     * @brief Provides interface for GameNetworkingSockets (UDP) network context instance.
+     *
+     * Messages are sent over the reliable or the unreliable lane (see NetworkingLane),
+     * each message is delivered as a whole (no stream framing is required).
+     * The GameNetworkingSockets library is global: only one context can be initialized at the time.
+     */
+    class NetworkingGNS : public INetworking
+    {
+    public:
+
+        /**
+         * @brief Default constructor.
+         */
+        NetworkingGNS();
+
+        /**
+         * @brief Destructor.
+         */
+        ~NetworkingGNS();
+
+        /**
+         * @brief Apply config string
+         *
+         * @param [in] data String data in implementation dependent format.
+         * @return          `true`, if the string data has been successfully parsed and applied, `false` otherwise.
+         */
+        bool applyConfig(const eastl::string& data) override;
+
+        /**
+         * @brief Initializes networking context. Call this function once before the first update.
+         *
+         * @return `true` on success, `false` otherwise.
+         */
+        bool init() override;
+
+        /**
+         * @brief Shuts down the context and frees all resources.
+         *
+         * @return `true` on success, `false` otherwise.
+        */
+        bool shutdown() override;
+
+        /**
+         * @brief Updates state (polling). This function must be called in a loop.
+         *
+         * @return `true` on success, `false` otherwise.
+         */
+        bool update() override;
+
+        /**
+         * @brief Retrieves the context instance id. It has to be unique for each instance in each process.
+         *
+         * @return A reference to a INetworkingIdentity object.
+         */
+        const INetworkingIdentity& identity() const override;
+
+        /**
+         * @brief Creates a listener object.
+         *
+         * @return A pointer to the INetworkingListener instance or `NULL` in case of failure.
+         */
+        eastl::shared_ptr<INetworkingListener> createListener() override;
+
+        /**
+         * @brief Creates a connector object.
+         *
+         * @return A pointer to the INetworkingConnector instance or `NULL` in case of failure.
+         */
+        eastl::shared_ptr<INetworkingConnector> createConnector() override;
+
+        /**
+         * @brief Creates a NetworkingGNS instance.
+         *
+         * @return A pointer to the created NetworkingGNS instance.
+         */
+        static eastl::unique_ptr<nau::INetworking> create()
+        {
+            return eastl::make_unique<NetworkingGNS>();
+        }
+
+    private:
+        static void onConnectionStatusChanged(SteamNetConnectionStatusChangedCallback_t* info);
+
+        void connectionStatusChanged(const SteamNetConnectionStatusChangedCallback_t& info);
+
+        static inline NetworkingGNS* s_instance = nullptr;
+
+        bool m_initialized = false;
+        eastl::vector<eastl::shared_ptr<NetworkingListenerGNS>> m_listeners;
+        eastl::vector<eastl::shared_ptr<NetworkingConnectorGNS>> m_connectors;
+    };
+}  // namespace nau
@@ -0,0 +1,103 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#pragma once
+#include "nau/network/napi/networking_transport.h"
+
+namespace nau
+{
+    /**
+     * @brief Provides GameNetworkingSockets-based (UDP) data transfer mechanism with the reliable and the unreliable lanes.
+     */
+    class NetworkingTransportGNS : public INetworkingTransport
+    {
+    public:
+        using INetworkingTransport::write;
+
+        /**
+         * @brief Initialization constructor.
+         *
+         * @param [in] connection       GameNetworkingSockets connection handle.
+         * @param [in] localEndPoint    Local endpoint URI.
+         * @param [in] remoteEndPoint   Remote endpoint URI.
+         */
+        NetworkingTransportGNS(uint32_t connection, eastl::string localEndPoint, eastl::string remoteEndPoint);
+
+        /**
+         * @brief Destructor. Closes the connection.
+         */
+        ~NetworkingTransportGNS();
+
+        /**
+         * @brief Attempts to read received messages.
+         *
+         * @param [out] messages    A collection of received message. Empty if no messages.
+         * @return                  Number of received messages, i.e. size of **messages**.
+         */
+        size_t read(eastl::vector<nau::NetworkingMessage>& messages) override;
+
+        /**
+         * @brief Attempts to send the specified message reliably.
+         *
+         * @param [in] message  Message to send.
+         * @return              `true` if the message can be sent, `false` otherwise.
+         */
+        bool write(const nau::NetworkingMessage& message) override;
+
+        /**
+         * @brief Attempts to send the specified message over the lane.
+         *
+         * @param [in] message  Message to send.
+         * @param [in] lane     Delivery guarantees of the message.
+         * @return              `true` if the message can be sent, `false` otherwise.
+         */
+        bool write(const nau::NetworkingMessage& message, NetworkingLane lane) override;
+
+        /**
+         * @brief Checks if the connection is alive.
+         *
+         * @return `true` if the connection is still alive, `false` otherwise.
+         */
+        bool isConnected() override;
+
+        /**
+         * @brief Drops the connection.
+         *
+         * @return `true` if the connections has been dropped successfully, `false` otherwise.
+         */
+        bool disconnect() override;
+
+        /**
+         * @brief Retrieves the local endpoint as URI.
+         *
+         * @return Local endpoint in URI form.
+         */
+        const eastl::string& localEndPoint() const override;
+
+        /**
+         * @brief Retrieves the remote endpoint as URI.
+         *
+         * @return Remote endpoint in URI form.
+         */
+        const eastl::string& remoteEndPoint() const override;
+
+        /**
+         * @brief Retrieves the GameNetworkingSockets connection handle.
+         */
+        uint32_t connection() const
+        {
+            return m_connection;
+        }
+
+        /**
+         * @brief Marks the connection closed by the remote peer (or by the connection problem).
+         */
+        void onClosed();
+
+    private:
+        const uint32_t m_connection;
+        bool m_connected = true;
+        eastl::string m_localEndPoint;
+        eastl::string m_remoteEndPoint;
+    };
+}  // namespace nau
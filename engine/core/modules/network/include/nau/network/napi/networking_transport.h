@@ -10,6 +10,24 @@
 
 namespace nau
 {
+    /**
+     * @brief Delivery guarantees of the sent message.
+     */
+    enum class NetworkingLane : unsigned
+    {
+        Reliable,   ///< Delivered once and in order (with the other reliable messages).
+        Unreliable  ///< May be dropped or reordered: for the data that is superseded by the next messages (e.g. snapshots).
+    };
+
+    /**
+     * @brief Queue depths of the transport (in messages).
+     */
+    struct NetworkingTransportStatistics
+    {
+        size_t incomingQueueDepth = 0;  ///< Received messages that are not read yet.
+        size_t outgoingQueueDepth = 0;  ///< Written messages that are not sent yet.
+    };
+
     /**
      * @brief Provides an interface for data transfer.
      */
@@ -33,6 +51,30 @@ namespace nau
          */
         virtual bool write(const nau::NetworkingMessage& message) = 0;
 
+        /**
+         * @brief Attempts to send the specified message over the lane.
+         *
+         * @param [in] message  Message to send.
+         * @param [in] lane     Delivery guarantees of the message.
+         * @return              `true` if the message can be sent, `false` otherwise.
+         *
+         * @note Stream transports do not have an unreliable lane: by default the message is sent reliably.
+         */
+        virtual bool write(const nau::NetworkingMessage& message, [[maybe_unused]] NetworkingLane lane)
+        {
+            return write(message);
+        }
+
+        /**
+         * @brief Retrieves the transport queue depths.
+         *
+         * @return Queue depths, zeros if the transport does not queue the messages.
+         */
+        virtual NetworkingTransportStatistics statistics() const
+        {
+            return {};
+        }
+
         /**
          * @brief Checks if the connection is alive.
          * 
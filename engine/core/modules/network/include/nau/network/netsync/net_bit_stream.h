@@ -0,0 +1,147 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <bit>
+#include <cstring>
+
+#include "nau/diag/assertion.h"
+#include "nau/memory/bytes_buffer.h"
+
+namespace nau
+{
+    /**
+     * @brief Writes bit-packed values (least significant bits first) to the end of the buffer.
+     */
+    class NetBitWriter
+    {
+    public:
+        explicit NetBitWriter(BytesBuffer& buffer) :
+            m_buffer(buffer)
+        {
+        }
+
+        ~NetBitWriter()
+        {
+            flush();
+        }
+
+        /**
+         * @brief Writes the lower bits of the value.
+         *
+         * @param [in] value    Value to write.
+         * @param [in] bitCount Count of the bits to write (up to 32).
+         */
+        void writeBits(uint32_t value, unsigned bitCount)
+        {
+            NAU_ASSERT(bitCount <= 32);
+            const uint64_t mask = (uint64_t{1} << bitCount) - 1;
+            m_bits |= (static_cast<uint64_t>(value) & mask) << m_bitCount;
+            m_bitCount += bitCount;
+
+            while (m_bitCount >= 8)
+            {
+                *m_buffer.append(1) = static_cast<std::byte>(m_bits & 0xff);
+                m_bits >>= 8;
+                m_bitCount -= 8;
+            }
+        }
+
+        void writeBool(bool value)
+        {
+            writeBits(value ? 1 : 0, 1);
+        }
+
+        void writeFloat(float value)
+        {
+            writeBits(std::bit_cast<uint32_t>(value), 32);
+        }
+
+        /**
+         * @brief Writes the pending bits (padded with zeros to the whole byte).
+         */
+        void flush()
+        {
+            if (m_bitCount > 0)
+            {
+                *m_buffer.append(1) = static_cast<std::byte>(m_bits & 0xff);
+                m_bits = 0;
+                m_bitCount = 0;
+            }
+        }
+
+    private:
+        BytesBuffer& m_buffer;
+        uint64_t m_bits = 0;
+        unsigned m_bitCount = 0;
+    };
+
+    /**
+     * @brief Reads the values written by NetBitWriter.
+     */
+    class NetBitReader
+    {
+    public:
+        NetBitReader(const std::byte* data, size_t size) :
+            m_data(data),
+            m_size(size)
+        {
+        }
+
+        /**
+         * @brief Reads the value of the given bit count.
+         *
+         * @param [out] value    Read value.
+         * @param [in]  bitCount Count of the bits to read (up to 32).
+         * @return               `false` if there is not enough data.
+         */
+        bool readBits(uint32_t& value, unsigned bitCount)
+        {
+            NAU_ASSERT(bitCount <= 32);
+            while (m_bitCount < bitCount)
+            {
+                if (m_position == m_size)
+                {
+                    return false;
+                }
+                m_bits |= static_cast<uint64_t>(m_data[m_position++]) << m_bitCount;
+                m_bitCount += 8;
+            }
+
+            value = static_cast<uint32_t>(m_bits & ((uint64_t{1} << bitCount) - 1));
+            m_bits >>= bitCount;
+            m_bitCount -= bitCount;
+            return true;
+        }
+
+        bool readBool(bool& value)
+        {
+            uint32_t bit = 0;
+            if (!readBits(bit, 1))
+            {
+                return false;
+            }
+            value = bit != 0;
+            return true;
+        }
+
+        bool readFloat(float& value)
+        {
+            uint32_t bits = 0;
+            if (!readBits(bits, 32))
+            {
+                return false;
+            }
+            value = std::bit_cast<float>(bits);
+            return true;
+        }
+
+    private:
+        const std::byte* const m_data;
+        const size_t m_size;
+        size_t m_position = 0;
+        uint64_t m_bits = 0;
+        unsigned m_bitCount = 0;
+    };
+}  // namespace nau
@@ -6,6 +6,7 @@
 #include <EASTL/string.h>
 #include <EASTL/vector.h>
 
+#include "nau/network/napi/networking_transport.h"
 #include "nau/rtti/type_info.h"
 
 namespace nau
@@ -82,6 +83,13 @@ namespace nau
              * @return Remote end point URI.
              */
             virtual const eastl::string& remoteEndPoint() = 0;
+
+            /**
+             * @brief Retrieves the queue depths of the connection transport.
+             *
+             * @return Transport queue depths.
+             */
+            virtual NetworkingTransportStatistics transportStatistics() = 0;
         };
 
         /**
@@ -142,7 +150,15 @@ namespace nau
         virtual void writeFrame(const eastl::string& peerId, const eastl::string& frame) = 0;
 
         /**
-         * @brief Read frame state
+         * @brief Write frame state to the single connection (i.e. the frame encoded against the baseline acknowledged by this remote peer)
+         * @param peerId - local peer, source
+         * @param toPeerId - remote peer, destination
+         * @param frame - serialized frame state
+         */
+        virtual void writeFrame(const eastl::string& peerId, const eastl::string& toPeerId, const eastl::string& frame) = 0;
+
+        /**
+         * @brief Read the oldest not yet read received frame state, the frame is read only once
          * @param peerId - local peer, destination
          * @param fromPeerId - remote peer, source of frame state
          * @param frame - serialized frame state
@@ -8,6 +8,7 @@
 
 #include "nau/memory/bytes_buffer.h"
 #include "nau/network/components/net_component_api.h"
+#include "nau/network/netsync/net_statistics.h"
 #include "nau/rtti/type_info.h"
 #include "nau/utils/functor.h"
 
@@ -71,6 +72,29 @@ namespace nau
          */
         virtual void onComponentWrite(IComponentNetSync* component) = 0;
 
+        /**
+         * @brief Sets the replication interest of the remote peer: only the relevant components are sent to it, within the bandwidth budget.
+         *
+         * @param [in] peerId       Local peer ID.
+         * @param [in] remotePeerId Remote (connected) peer ID.
+         * @param [in] interest     Interest of the remote peer.
+         */
+        virtual void setPeerInterest(eastl::string_view peerId, eastl::string_view remotePeerId, const NetPeerInterest& interest) = 0;
+
+        /**
+         * @brief Sets the rate the local peers send the frames at. Between the sends the component writes replace the frame being collected.
+         *
+         * @param [in] sendRate Frames per second, 0 to send every frame.
+         */
+        virtual void setSendRate(float sendRate) = 0;
+
+        /**
+         * @brief Sets the presentation settings of the interpolated replicas (see IComponentNetSync::netReadBuffered).
+         *
+         * @param [in] settings Interpolation settings.
+         */
+        virtual void setInterpolationSettings(const NetInterpolationSettings& settings) = 0;
+
         /**
          * @brief Advances networking to the next frame. The function must be called once per frame.
          */
@@ -81,6 +105,13 @@ namespace nau
          */
         virtual void applyPeerUpdates() = 0;
 
+        /**
+         * @brief Retrieves the replication statistics (bytes per peer and component type, timings, queue depths, RTT and loss).
+         *
+         * @return A reference to the statistics collector of the service.
+         */
+        virtual INetStatistics& getStatistics() = 0;
+
         virtual bool doSelfTest() = 0;
     };
 }  // namespace nau
@@ -0,0 +1,159 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <EASTL/string.h>
+#include <EASTL/string_view.h>
+#include <EASTL/vector.h>
+
+#include "nau/rtti/type_info.h"
+#include "nau/utils/result.h"
+
+namespace nau
+{
+    /**
+     * @brief Replication statistics of the local peer connection to the remote peer.
+     */
+    struct NetConnectionStatistics
+    {
+        eastl::string peerId;
+        eastl::string remotePeerId;
+
+        uint64_t framesSent = 0;
+        uint64_t bytesSent = 0;
+        uint64_t componentsSent = 0;
+        uint32_t lastFrameBytesSent = 0;
+        uint32_t lastFrameComponentsSent = 0;
+
+        uint64_t framesReceived = 0;
+        uint64_t bytesReceived = 0;
+        uint32_t lastFrameBytesReceived = 0;
+
+        /**
+         * @brief Frames of the remote peer that were not received (gaps in the frame numbers) or were dropped (the baseline is missing).
+         */
+        uint64_t framesLost = 0;
+
+        /**
+         * @brief Smoothed time (in milliseconds) from sending the frame to receiving its acknowledgement, 0 until the first one.
+         *
+         * @note The acknowledgement is sent with the next remote peer frame: the time includes the remote peer frame interval.
+         */
+        float roundTripTime = 0.f;
+
+        /**
+         * @brief Count of the received messages not yet read from the transport (sampled at the end of the frame).
+         */
+        size_t incomingQueueDepth = 0;
+
+        /**
+         * @brief Count of the messages queued to the transport but not yet sent (sampled at the end of the frame).
+         */
+        size_t outgoingQueueDepth = 0;
+
+        float getLossRate() const
+        {
+            const uint64_t expected = framesReceived + framesLost;
+            return expected > 0 ? static_cast<float>(framesLost) / static_cast<float>(expected) : 0.f;
+        }
+    };
+
+    /**
+     * @brief Replication statistics of the components of the same type.
+     */
+    struct NetComponentTypeStatistics
+    {
+        eastl::string typeName;
+
+        uint64_t componentsSent = 0;
+        uint64_t bytesSent = 0;
+
+        /**
+         * @brief Received component updates applied to the replicas (not changed components are not applied).
+         */
+        uint64_t componentsApplied = 0;
+        uint64_t bytesApplied = 0;
+    };
+
+    /**
+     * @brief Per frame duration of the replication stage (in microseconds).
+     */
+    struct NetTimingStatistics
+    {
+        float last = 0.f;
+        float average = 0.f;
+        float max = 0.f;
+    };
+
+    /**
+     * @brief Provides an interface for the replication statistics (see INetSnapshots::getStatistics).
+     *
+     * The statistics are collected only when enabled (disabled by default): the collection does not cost anything otherwise.
+     */
+    struct NAU_ABSTRACT_TYPE INetStatistics
+    {
+        NAU_TYPEID(INetStatistics)
+
+        /**
+         * @brief Enables or disables the statistics collection. The collected values are kept when disabled.
+         *
+         * @param [in] enabled Indicates whether the statistics should be collected.
+         */
+        virtual void setEnabled(bool enabled) = 0;
+
+        virtual bool isEnabled() const = 0;
+
+        /**
+         * @brief Shows or hides the statistics imgui panel (drawn by the network game system each frame).
+         *
+         * @param [in] visible Indicates whether the panel should be drawn.
+         */
+        virtual void setPanelVisible(bool visible) = 0;
+
+        virtual bool isPanelVisible() const = 0;
+
+        /**
+         * @brief Retrieves the statistics of all the connections of the local peers.
+         *
+         * @param [out] connections Collection of the connection statistics.
+         */
+        virtual void getConnectionStatistics(eastl::vector<NetConnectionStatistics>& connections) const = 0;
+
+        /**
+         * @brief Retrieves the statistics of the replicated component types.
+         *
+         * @param [out] componentTypes Collection of the component type statistics.
+         */
+        virtual void getComponentStatistics(eastl::vector<NetComponentTypeStatistics>& componentTypes) const = 0;
+
+        /**
+         * @brief Retrieves the duration of the snapshot serialization (INetSnapshots::nextFrame).
+         */
+        virtual NetTimingStatistics getSerializeTime() const = 0;
+
+        /**
+         * @brief Retrieves the duration of the snapshot parsing and applying (INetSnapshots::applyPeerUpdates).
+         */
+        virtual NetTimingStatistics getParseTime() const = 0;
+
+        /**
+         * @brief Starts writing the per frame connection statistics to the CSV file (one row per connection per frame).
+         * The collection is enabled by the call.
+         *
+         * @param [in] filePath Path of the file, it is overwritten.
+         * @return              Error if the file can not be opened.
+         */
+        virtual Result<> startCsvExport(eastl::string_view filePath) = 0;
+
+        /**
+         * @brief Stops writing the CSV file and flushes it.
+         */
+        virtual void stopCsvExport() = 0;
+
+        /**
+         * @brief Resets the collected values.
+         */
+        virtual void reset() = 0;
+    };
+}  // namespace nau
@@ -6,13 +6,19 @@
 #include "nau/diag/logging.h"
 #include "nau/network/asio/networking_connection_asio.h"
 #include "nau/network/asio/networking_identity_asio.h"
+#include "networking_asio_wrapper.h"
 
 namespace nau
 {
-    NetworkingASIO::NetworkingASIO()
+    NetworkingASIO::NetworkingASIO() :
+        m_gameThreadCalls(eastl::make_unique<ASIO_GameThreadCalls>())
     {
     }
-    NetworkingASIO::~NetworkingASIO() = default;
+    NetworkingASIO::~NetworkingASIO()
+    {
+        // the I/O thread is stopped before the connections are destroyed
+        shutdown();
+    }
 
     bool NetworkingASIO::applyConfig(const eastl::string& data)
     {
@@ -21,17 +27,47 @@ namespace nau
 
     bool NetworkingASIO::init()
     {
+        if (!m_ioThread.joinable())
+        {
+            m_io_context.restart();
+            m_workGuard.emplace(m_io_context.get_executor());
+            m_ioThread = std::thread([this]
+            {
+                m_io_context.run();
+            });
+        }
         NAU_LOG_DEBUG("NetworkingASIO::init Ok");
         return true;
     }
     bool NetworkingASIO::shutdown()
     {
-        NAU_LOG_DEBUG("NetworkingASIO::shutdown");
+        if (m_ioThread.joinable())
+        {
+            m_workGuard.reset();
+            m_io_context.stop();
+            m_ioThread.join();
+            NAU_LOG_DEBUG("NetworkingASIO::shutdown");
+        }
         return true;
     }
     bool NetworkingASIO::update()
     {
-        m_io_context.poll();
+        // the messages written since the previous update are sent by one write per connection
+        for (auto& listener : m_listeners)
+        {
+            listener->flush();
+        }
+        for (auto& connector : m_connectors)
+        {
+            connector->flush();
+        }
+
+        if (!m_ioThread.joinable())
+        {
+            // not initialized: the context is served on the calling thread
+            m_io_context.poll();
+        }
+        m_gameThreadCalls->dispatch();
         return true;
     }
     const INetworkingIdentity& NetworkingASIO::identity() const
@@ -41,13 +77,13 @@ namespace nau
     }
     eastl::shared_ptr<INetworkingListener> NetworkingASIO::createListener()
     {
-        auto listener = eastl::make_shared<NetworkingListenerASIO>(m_io_context);
+        auto listener = eastl::make_shared<NetworkingListenerASIO>(m_io_context, *m_gameThreadCalls);
         m_listeners.push_back(listener);
         return listener;
     }
     eastl::shared_ptr<INetworkingConnector> NetworkingASIO::createConnector()
     {
-        auto connector = eastl::make_shared<NetworkingConnectorASIO>(m_io_context);
+        auto connector = eastl::make_shared<NetworkingConnectorASIO>(m_io_context, *m_gameThreadCalls);
         m_connectors.push_back(connector);
         return connector;
     }
@@ -0,0 +1,89 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#pragma once
+#include <EASTL/vector.h>
+
+#include <atomic>
+
+#include "nau/diag/assertion.h"
+
+namespace nau
+{
+    /**
+     * The bounded lock-free single producer / single consumer queue (between the I/O thread and the game thread).
+     * Each side caches the position of the other one to touch the shared cache line only when the cached one is exhausted.
+     */
+    template <typename T>
+    class ASIO_SpscQueue
+    {
+    public:
+        // The capacity is a power of two.
+        explicit ASIO_SpscQueue(size_t capacity) :
+            m_items(capacity),
+            m_mask(capacity - 1)
+        {
+            NAU_ASSERT(capacity >= 2 && (capacity & m_mask) == 0);
+        }
+
+        ASIO_SpscQueue(const ASIO_SpscQueue&) = delete;
+        ASIO_SpscQueue& operator=(const ASIO_SpscQueue&) = delete;
+
+        // Producer side. Returns false (the item is not moved) when the queue is full.
+        bool tryPush(T&& item)
+        {
+            const size_t tail = m_tail.load(std::memory_order_relaxed);
+            if (tail - m_cachedHead == m_items.size())
+            {
+                m_cachedHead = m_head.load(std::memory_order_acquire);
+                if (tail - m_cachedHead == m_items.size())
+                {
+                    return false;
+                }
+            }
+
+            m_items[tail & m_mask] = std::move(item);
+            m_tail.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Consumer side. Returns false when the queue is empty.
+        bool tryPop(T& item)
+        {
+            const size_t head = m_head.load(std::memory_order_relaxed);
+            if (head == m_cachedTail)
+            {
+                m_cachedTail = m_tail.load(std::memory_order_acquire);
+                if (head == m_cachedTail)
+                {
+                    return false;
+                }
+            }
+
+            item = std::move(m_items[head & m_mask]);
+            m_head.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Either side (or any other thread): the count may be outdated when it is returned.
+        size_t size() const
+        {
+            // the head is loaded first: the tail loaded after it is never behind it
+            const size_t head = m_head.load(std::memory_order_acquire);
+            const size_t tail = m_tail.load(std::memory_order_acquire);
+            return tail - head;
+        }
+
+    private:
+        eastl::vector<T> m_items;
+        const size_t m_mask;
+
+        // consumer
+        alignas(64) std::atomic<size_t> m_head = 0;
+        size_t m_cachedTail = 0;
+
+        // producer
+        alignas(64) std::atomic<size_t> m_tail = 0;
+        size_t m_cachedHead = 0;
+    };
+}  // namespace nau
@@ -21,6 +21,25 @@ namespace nau
         str += "/";
     }
 
+    void ASIO_GameThreadCalls::post(Functor<void()> call)
+    {
+        std::lock_guard lock(m_mutex);
+        m_calls.push_back(std::move(call));
+    }
+
+    void ASIO_GameThreadCalls::dispatch()
+    {
+        {
+            std::lock_guard lock(m_mutex);
+            m_dispatchedCalls.swap(m_calls);
+        }
+        for (auto& call : m_dispatchedCalls)
+        {
+            call();
+        }
+        m_dispatchedCalls.clear();
+    }
+
     ASIO_Connection::ASIO_Connection(tcp::socket s) :
         m_socket(std::move(s))
     {
@@ -33,106 +52,270 @@ namespace nau
 
     void ASIO_Connection::connect(tcp::endpoint endpoint, std::function<void(std::error_code)> onConnect)
     {
-        m_socket.async_connect(endpoint, [onConnect](std::error_code ec)
+        asio::post(m_socket.get_executor(), [this, endpoint, onConnect]
         {
-            if(!ec)
+            m_socket.async_connect(endpoint, [this, onConnect](std::error_code ec)
             {
-                NAU_LOG_DEBUG("ASIO_Connection::connect Connected");
-            }
-            else
-            {
-                NAU_LOG_DEBUG(nau::utils::format("ASIO_Connection::connect Connect error {}", ec.message().c_str()));
-            }
-            onConnect(ec);
+                if(!ec)
+                {
+                    NAU_LOG_DEBUG("ASIO_Connection::connect Connected");
+                    start();
+                }
+                else
+                {
+                    NAU_LOG_DEBUG(nau::utils::format("ASIO_Connection::connect Connect error {}", ec.message().c_str()));
+                }
+                onConnect(ec);
+            });
         });
     }
 
+    void ASIO_Connection::start()
+    {
+        // the endpoints are read by the game thread after the connection is published (see m_connected)
+        std::error_code ec;
+        endpointToString(m_socket.local_endpoint(ec), m_localEndPoint);
+        endpointToString(m_socket.remote_endpoint(ec), m_remoteEndPoint);
+        m_connected.store(true, std::memory_order_release);
+        doRead();
+    }
+
     bool ASIO_Connection::disconnect()
     {
-        if (m_socket.is_open())
+        if (!m_connected.exchange(false))
         {
-            m_socket.close();
-            return true;
+            return false;
         }
-        return false;
+        asio::post(m_socket.get_executor(), [this]
+        {
+            close({});
+        });
+        return true;
     }
 
     bool ASIO_Connection::isConnected() const
     {
-        return m_socket.is_open();
+        return m_connected.load(std::memory_order_acquire);
+    }
+
+    bool ASIO_Connection::write(const BytesBuffer& buffer)
+    {
+        if (!isConnected())
+        {
+            return false;
+        }
+
+        BytesBuffer message;
+        m_outgoingFree.tryPop(message);
+        message.resize(buffer.size());
+        std::memcpy(message.data(), buffer.data(), buffer.size());
+        if (!m_outgoing.tryPush(std::move(message)))
+        {
+            NAU_LOG_WARNING("ASIO_Connection::write the outgoing queue is full");
+            return false;
+        }
+
+        // the messages are sent by flush() (once per the networking update)
+        m_hasUnflushedMessages = true;
+        return true;
     }
 
-    void ASIO_Connection::write(const BytesBuffer& buffer)
+    void ASIO_Connection::flush()
     {
-        size_t size = buffer.size();
-        asio::streambuf::mutable_buffers_type buf = m_write_buffer.prepare(size);
-        std::memcpy(buf.data(), buffer.data(), size);
-        m_write_buffer.commit(size);
-        doWriteBuffer();
+        if (!m_hasUnflushedMessages)
+        {
+            return;
+        }
+        m_hasUnflushedMessages = false;
+
+        if (!m_writeScheduled.exchange(true, std::memory_order_acq_rel))
+        {
+            asio::post(m_socket.get_executor(), [this]
+            {
+                // the flag is reset before the queue is drained: the messages pushed after that schedule the next write
+                m_writeScheduled.store(false, std::memory_order_release);
+                doWrite();
+            });
+        }
     }
 
-    void ASIO_Connection::read(BytesBuffer& buffer)
+    void ASIO_Connection::read(eastl::vector<NetworkingMessage>& messages)
     {
-        if (m_socket.is_open())
+        for (auto& message : messages)
+        {
+            // when the pool is full the buffer is just released
+            m_incomingFree.tryPush(std::move(message.buffer));
+        }
+        messages.clear();
+
+        BytesBuffer buffer;
+        while (m_incoming.tryPop(buffer))
         {
-            auto toRead = m_socket.available();
-            if (m_socket.available() > 0)
+            messages.emplace_back().buffer = std::move(buffer);
+        }
+
+        if (m_readStalled.exchange(false, std::memory_order_acq_rel))
+        {
+            asio::post(m_socket.get_executor(), [this]
             {
-                std::error_code error;
-                m_socket.read_some(m_read_buffer.prepare(m_socket.available()), error);
-                if (!error)
+                if (deliverMessages())
                 {
-                    m_read_buffer.commit(toRead);
-                    size_t size = m_read_buffer.size();
-                    buffer.resize(size);
-                    std::memcpy(buffer.data(), m_read_buffer.data().data(), size);
-                    m_read_buffer.consume(size);
+                    doRead();
                 }
-            }
+            });
         }
     }
 
+    size_t ASIO_Connection::incomingQueueDepth() const
+    {
+        return m_incoming.size();
+    }
+
+    size_t ASIO_Connection::outgoingQueueDepth() const
+    {
+        return m_outgoing.size();
+    }
+
     const eastl::string& ASIO_Connection::localEndPoint() const
     {
-        if (isConnected())
-        {
-            endpointToString(m_socket.local_endpoint(), m_localEndPoint);
-        }
         return m_localEndPoint;
     }
+
     const eastl::string& ASIO_Connection::remoteEndPoint() const
     {
-        if (isConnected())
+        return m_remoteEndPoint;
+    }
+
+    void ASIO_Connection::doRead()
+    {
+        m_socket.async_read_some(m_readBuffer.prepare(ReadChunkSize), [this](const asio::error_code& error, std::size_t bytes_transferred)
+        {
+            if (error)
+            {
+                close(error);
+                return;
+            }
+
+            m_readBuffer.commit(bytes_transferred);
+            // when the incoming queue is full the reading is resumed by the game thread (see read())
+            if (deliverMessages())
+            {
+                doRead();
+            }
+        });
+    }
+
+    bool ASIO_Connection::deliverMessages()
+    {
+        for (;;)
         {
-            endpointToString(m_socket.remote_endpoint(), m_remoteEndPoint);
+            if (!m_hasPendingMessage)
+            {
+                if (!extractMessage(m_pendingMessage))
+                {
+                    return true;
+                }
+                m_hasPendingMessage = true;
+            }
+
+            if (!m_incoming.tryPush(std::move(m_pendingMessage)))
+            {
+                m_readStalled.store(true, std::memory_order_release);
+                return false;
+            }
+            m_hasPendingMessage = false;
         }
-        return m_remoteEndPoint;
     }
 
-    void ASIO_Connection::doWriteBuffer()
+    bool ASIO_Connection::extractMessage(BytesBuffer& message)
     {
-        if (m_write_buffer.size() > 0)
+        uint32_t size = 0;
+        if (m_readBuffer.size() < sizeof(size))
         {
-            const char* str = (const char*)m_write_buffer.data().data();
-            m_socket.async_write_some(asio::buffer(m_write_buffer.data(), m_write_buffer.size()),
-                                      [this](const asio::error_code& error, std::size_t bytes_transferred)
+            return false;
+        }
+
+        const auto* const data = static_cast<const std::byte*>(m_readBuffer.data().data());
+        std::memcpy(&size, data, sizeof(size));
+        if (m_readBuffer.size() - sizeof(size) < size)
+        {
+            return false;
+        }
+
+        m_incomingFree.tryPop(message);
+        message.resize(size);
+        std::memcpy(message.data(), data + sizeof(size), size);
+        m_readBuffer.consume(sizeof(size) + size);
+        return true;
+    }
+
+    void ASIO_Connection::doWrite()
+    {
+        if (!m_writingMessages.empty())
+        {
+            // single write in flight: continued from its completion
+            return;
+        }
+
+        BytesBuffer message;
+        while (m_outgoing.tryPop(message))
+        {
+            m_writingSizes.push_back(static_cast<uint32_t>(message.size()));
+            m_writingMessages.push_back(std::move(message));
+        }
+
+        if (m_writingMessages.empty())
+        {
+            return;
+        }
+        if (!m_socket.is_open())
+        {
+            recycleWrittenMessages();
+            return;
+        }
+
+        // all the queued messages are sent by the single gather-write: [size][message][size][message]...
+        m_writeBuffers.clear();
+        for (size_t i = 0; i < m_writingMessages.size(); ++i)
+        {
+            m_writeBuffers.push_back(asio::buffer(&m_writingSizes[i], sizeof(uint32_t)));
+            m_writeBuffers.push_back(asio::buffer(m_writingMessages[i].data(), m_writingMessages[i].size()));
+        }
+
+        asio::async_write(m_socket, m_writeBuffers, [this](const asio::error_code& error, [[maybe_unused]] std::size_t bytes_transferred)
+        {
+            recycleWrittenMessages();
+            if (error)
             {
-                this->writeHandler(error, bytes_transferred);
-            });
+                close(error);
+                return;
+            }
+            doWrite();
+        });
+    }
+
+    void ASIO_Connection::recycleWrittenMessages()
+    {
+        for (auto& message : m_writingMessages)
+        {
+            // when the pool is full the buffer is just released
+            m_outgoingFree.tryPush(std::move(message));
         }
+        m_writingMessages.clear();
+        m_writingSizes.clear();
     }
 
-    void ASIO_Connection::writeHandler(const asio::error_code& error, std::size_t bytes_transferred)
+    void ASIO_Connection::close(const asio::error_code& error)
     {
-        if (error)
+        if (error && error != asio::error::operation_aborted)
         {
-            NAU_LOG_DEBUG(nau::utils::format("ASIO_Connection::writeHandler error {}", error.message().c_str()));
+            NAU_LOG_DEBUG(nau::utils::format("ASIO_Connection::close error {}", error.message().c_str()));
         }
-        else
+        m_connected.store(false, std::memory_order_release);
+        if (m_socket.is_open())
         {
-            NAU_LOG_DEBUG(nau::utils::format("ASIO_Connection::writeHandler bytes {}", bytes_transferred));
-            m_write_buffer.consume(bytes_transferred);
-            doWriteBuffer();
+            std::error_code ec;
+            m_socket.close(ec);
         }
     }
 
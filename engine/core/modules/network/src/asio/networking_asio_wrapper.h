@@ -2,12 +2,40 @@
 // Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
 
 #pragma once
+#include <EASTL/vector.h>
+
 #include <asio.hpp>
+#include <atomic>
+#include <mutex>
+#include <vector>
 
 #include "nau/memory/bytes_buffer.h"
+#include "nau/network/napi/networking_message.h"
+#include "nau/utils/functor.h"
+#include "networking_asio_queue.h"
 
 namespace nau
 {
+    /**
+     * The calls posted from the I/O thread (accept / connect completions) that are dispatched on the thread that updates the networking.
+     */
+    class ASIO_GameThreadCalls
+    {
+    public:
+        void post(Functor<void()> call);
+        void dispatch();
+
+    private:
+        std::mutex m_mutex;
+        eastl::vector<Functor<void()>> m_calls;
+        eastl::vector<Functor<void()>> m_dispatchedCalls;
+    };
+
+    /**
+     * The socket is served by the I/O thread only: the messages are framed as [size:uint32][bytes] on the stream
+     * and passed to/from the game thread through the SPSC queues. The message buffers are pooled (returned through the free queues).
+     * The outgoing messages are coalesced: there is at most one write in flight, it gathers all the messages queued before it.
+     */
     class ASIO_Connection
     {
     public:
@@ -15,24 +43,63 @@ namespace nau
         ASIO_Connection(asio::io_context& io_context);
 
         void connect(asio::ip::tcp::endpoint endpoint, std::function<void(std::error_code)> onConnect);
+
+        // I/O thread: the socket is connected, starts reading.
+        void start();
+
         bool disconnect();
         bool isConnected() const;
 
-        void write(const BytesBuffer& buffer);
-        void read(BytesBuffer& buffer);
+        // Queues the message: the queued messages are sent by flush().
+        bool write(const BytesBuffer& buffer);
+
+        // Sends the messages queued since the previous flush (by the single write on the I/O thread).
+        void flush();
+
+        // Gets the complete received messages. The buffers of the passed messages are taken back to the pool.
+        void read(eastl::vector<NetworkingMessage>& messages);
+
+        // Approximate count of the received messages not taken by read() / of the queued messages not taken by the I/O thread yet.
+        size_t incomingQueueDepth() const;
+        size_t outgoingQueueDepth() const;
 
         const eastl::string& localEndPoint() const;
         const eastl::string& remoteEndPoint() const;
 
     private:
-        void doWriteBuffer();
-        void writeHandler(const asio::error_code& error, std::size_t bytes_transferred);
+        static constexpr size_t QueueCapacity = 1024;
+        static constexpr size_t ReadChunkSize = 64 * 1024;
+
+        void doRead();
+        bool deliverMessages();
+        bool extractMessage(BytesBuffer& message);
+        void doWrite();
+        void recycleWrittenMessages();
+        void close(const asio::error_code& error);
 
         asio::ip::tcp::socket m_socket;
-        asio::streambuf m_read_buffer;
-        asio::streambuf m_write_buffer;
-        mutable eastl::string m_localEndPoint;
-        mutable eastl::string m_remoteEndPoint;
+        eastl::string m_localEndPoint;
+        eastl::string m_remoteEndPoint;
+        std::atomic<bool> m_connected = false;
+
+        // I/O thread state
+        asio::streambuf m_readBuffer;
+        BytesBuffer m_pendingMessage;
+        bool m_hasPendingMessage = false;
+        eastl::vector<BytesBuffer> m_writingMessages;
+        eastl::vector<uint32_t> m_writingSizes;
+        std::vector<asio::const_buffer> m_writeBuffers;
+
+        // game thread state
+        bool m_hasUnflushedMessages = false;
+
+        std::atomic<bool> m_readStalled = false;
+        std::atomic<bool> m_writeScheduled = false;
+
+        ASIO_SpscQueue<BytesBuffer> m_incoming{QueueCapacity};
+        ASIO_SpscQueue<BytesBuffer> m_incomingFree{QueueCapacity};
+        ASIO_SpscQueue<BytesBuffer> m_outgoing{QueueCapacity};
+        ASIO_SpscQueue<BytesBuffer> m_outgoingFree{QueueCapacity};
     };
 
     class ASIO_Acceptor
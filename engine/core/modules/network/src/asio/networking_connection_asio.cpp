@@ -3,40 +3,19 @@
 
 #include "nau/network/asio/networking_connection_asio.h"
 
-#include <uriparser/Uri.h>
-
 #include <asio.hpp>
 
 #include "nau/network/asio/networking_transport_asio.h"
 #include "networking_asio_wrapper.h"
+#include "networking_uri.h"
 
 using namespace asio;
 using namespace asio::ip;
 
 namespace nau
 {
-    namespace NetworkingASIO
-    {
-        // TODO - move to common Networking sources
-        static bool ParseURI(const eastl::string& uriStr, eastl::string& scheme, eastl::string& host, eastl::string& port)
-        {
-            UriUriA uri;
-            const char* errorPos;
-            // No need to call uriFreeUriMembersA if Failure
-            if (uriParseSingleUriA(&uri, uriStr.c_str(), &errorPos) == URI_SUCCESS)
-            {
-                scheme = eastl::string(uri.scheme.first, uri.scheme.afterLast);
-                host = eastl::string(uri.hostText.first, uri.hostText.afterLast);
-                port = eastl::string(uri.portText.first, uri.portText.afterLast);
-                uriFreeUriMembersA(&uri);
-                return true;
-            }
-            return false;
-        }
-    }  // namespace NetworkingASIO
-
-    NetworkingListenerASIO::NetworkingListenerASIO(asio::io_context& io_context) :
-        m_context(io_context)
+    NetworkingListenerASIO::NetworkingListenerASIO(asio::io_context& io_context, ASIO_GameThreadCalls& gameThreadCalls) :
+        m_context(io_context, gameThreadCalls)
     {
     }
 
@@ -48,7 +27,7 @@ namespace nau
         eastl::string scheme;
         eastl::string host;
         eastl::string port;
-        if (NetworkingASIO::ParseURI(uriStr, scheme, host, port))
+        if (parseURI(uriStr, scheme, host, port))
         {
             if (scheme == "tcp")
             {
@@ -58,10 +37,15 @@ namespace nau
                 {
                     m_acceptor = eastl::make_shared<ASIO_Acceptor>(m_context.m_io_context, std::stoi(port.c_str()), [this](tcp::socket socket) -> void
                     {
+                        // I/O thread: the callback is dispatched on the game thread
                         auto connection = eastl::make_shared<ASIO_Connection>(eastl::move(socket));
-                        auto transport = eastl::make_shared<NetworkingTransportASIO>(connection.get());
-                        m_incomingConnections.push_back(connection);
-                        m_context.m_successCallback(transport);
+                        connection->start();
+                        m_context.m_gameThreadCalls.post([this, connection]
+                        {
+                            auto transport = eastl::make_shared<NetworkingTransportASIO>(connection.get());
+                            m_incomingConnections.push_back(connection);
+                            m_context.m_successCallback(transport);
+                        });
                     });
                     result = true;
                 }
@@ -74,6 +58,14 @@ namespace nau
         return result;
     }
 
+    void NetworkingListenerASIO::flush()
+    {
+        for (auto& connection : m_incomingConnections)
+        {
+            connection->flush();
+        }
+    }
+
     bool NetworkingListenerASIO::stop()
     {
         // TODO
@@ -85,8 +77,8 @@ namespace nau
         // TODO
     }
 
-    NetworkingConnectorASIO::NetworkingConnectorASIO(asio::io_context& io_context) :
-        m_context(io_context)
+    NetworkingConnectorASIO::NetworkingConnectorASIO(asio::io_context& io_context, ASIO_GameThreadCalls& gameThreadCalls) :
+        m_context(io_context, gameThreadCalls)
     {
     }
 
@@ -105,7 +97,7 @@ namespace nau
         eastl::string scheme;
         eastl::string host;
         eastl::string port;
-        if (NetworkingASIO::ParseURI(uriStr, scheme, host, port))
+        if (parseURI(uriStr, scheme, host, port))
         {
             if (scheme == "tcp")
             {
@@ -115,15 +107,19 @@ namespace nau
                 auto endpoint = tcp::endpoint(ip::address::from_string(host.c_str()), std::stoi(port.c_str()));
                 m_connection->connect(endpoint, [this](std::error_code ec) -> void
                 {
-                    if (!ec)
-                    {
-                        auto transport = eastl::make_shared<NetworkingTransportASIO>(m_connection.get());
-                        m_context.m_successCallback(transport);
-                    }
-                    else
+                    // I/O thread: the callbacks are dispatched on the game thread
+                    m_context.m_gameThreadCalls.post([this, ec]
                     {
-                        m_context.m_failCallback();
-                    }
+                        if (!ec)
+                        {
+                            auto transport = eastl::make_shared<NetworkingTransportASIO>(m_connection.get());
+                            m_context.m_successCallback(transport);
+                        }
+                        else
+                        {
+                            m_context.m_failCallback();
+                        }
+                    });
                 });
                 result = true;
             }
@@ -148,6 +144,14 @@ namespace nau
         return false;
     }
 
+    void NetworkingConnectorASIO::flush()
+    {
+        if (m_connection)
+        {
+            m_connection->flush();
+        }
+    }
+
     bool NetworkingConnectorASIO::stop()
     {
         // TODO
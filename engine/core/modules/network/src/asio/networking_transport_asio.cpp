@@ -15,20 +15,19 @@ namespace nau
 
     size_t NetworkingTransportASIO::read(eastl::vector<nau::NetworkingMessage>& messages)
     {
-        messages.clear();
-        nau::NetworkingMessage message;
-        m_connection->read(message.buffer);
-        if (message.buffer.size() > 0)
-        {
-            messages.push_back(message);
-        }
+        // the buffers of the passed messages are reused for the next received ones
+        m_connection->read(messages);
         return messages.size();
     }
 
     bool NetworkingTransportASIO::write(const nau::NetworkingMessage& message)
     {
-        m_connection->write(message.buffer);
-        return true;
+        return m_connection->write(message.buffer);
+    }
+
+    NetworkingTransportStatistics NetworkingTransportASIO::statistics() const
+    {
+        return {m_connection->incomingQueueDepth(), m_connection->outgoingQueueDepth()};
     }
 
     bool NetworkingTransportASIO::disconnect()
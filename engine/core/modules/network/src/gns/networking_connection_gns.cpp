@@ -0,0 +1,258 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#if NAU_NETWORK_GNS
+#include "nau/network/gns/networking_connection_gns.h"
+
+#include <EASTL/algorithm.h>
+#include <steam/isteamnetworkingsockets.h>
+#include <steam/isteamnetworkingutils.h>
+
+#include "nau/diag/logging.h"
+#include "nau/network/gns/networking_transport_gns.h"
+#include "networking_uri.h"
+
+namespace nau
+{
+    namespace
+    {
+        /**
+         * @brief Parses udp://host:port (the empty host means any local address).
+         */
+        bool parseAddress(const eastl::string& uri, SteamNetworkingIPAddr& address)
+        {
+            eastl::string scheme;
+            eastl::string host;
+            eastl::string port;
+            if (!parseURI(uri, scheme, host, port) || scheme != "udp" || port.empty())
+            {
+                NAU_LOG_ERROR("Invalid GNS endpoint URI ({}), udp://host:port is expected", uri);
+                return false;
+            }
+
+            address.Clear();
+            if (!host.empty())
+            {
+                const eastl::string hostPort = host.find(':') != eastl::string::npos ? "[" + host + "]:" + port : host + ":" + port;
+                return address.ParseString(hostPort.c_str());
+            }
+            address.m_port = static_cast<uint16>(std::atoi(port.c_str()));
+            return true;
+        }
+    }  // namespace
+
+    NetworkingListenerGNS::NetworkingListenerGNS() = default;
+
+    NetworkingListenerGNS::~NetworkingListenerGNS()
+    {
+        stop();
+    }
+
+    void NetworkingListenerGNS::setOnAuthorization(nau::Functor<bool(const INetworkingIdentity& identity, const NetworkingAddress&)> cb)
+    {
+        m_authorizationCallback = eastl::move(cb);
+    }
+
+    bool NetworkingListenerGNS::listen(const eastl::string& uri, nau::Functor<void(eastl::shared_ptr<INetworkingTransport>)> successCallback, nau::Functor<void(void)> failCallback)
+    {
+        if (m_listenSocket != k_HSteamListenSocket_Invalid)
+        {
+            return false;
+        }
+
+        SteamNetworkingIPAddr address;
+        if (parseAddress(uri, address))
+        {
+            m_listenSocket = SteamNetworkingSockets()->CreateListenSocketIP(address, 0, nullptr);
+        }
+        if (m_listenSocket == k_HSteamListenSocket_Invalid)
+        {
+            if (failCallback)
+            {
+                failCallback();
+            }
+            return false;
+        }
+
+        m_localEndPoint = uri;
+        m_successCallback = eastl::move(successCallback);
+        m_failCallback = eastl::move(failCallback);
+        return true;
+    }
+
+    bool NetworkingListenerGNS::stop()
+    {
+        if (m_listenSocket == k_HSteamListenSocket_Invalid)
+        {
+            return false;
+        }
+
+        // the accepted connections are closed with the listen socket
+        for (auto& transport : m_transports)
+        {
+            transport->onClosed();
+        }
+        m_transports.clear();
+
+        SteamNetworkingSockets()->CloseListenSocket(m_listenSocket);
+        m_listenSocket = k_HSteamListenSocket_Invalid;
+        return true;
+    }
+
+    bool NetworkingListenerGNS::onConnecting(const NetworkingAddress& address)
+    {
+        if (!m_authorizationCallback)
+        {
+            return true;
+        }
+
+        class RemoteIdentity final : public INetworkingIdentity
+        {
+        public:
+            RemoteIdentity(eastl::string address) :
+                m_address(eastl::move(address))
+            {
+            }
+
+            NetworkingIdentityType getType() const override
+            {
+                return NetworkingIdentityType::Local;
+            }
+
+            eastl::string toString() const override
+            {
+                return m_address;
+            }
+
+        private:
+            eastl::string m_address;
+        };
+
+        return m_authorizationCallback(RemoteIdentity{address.address}, address);
+    }
+
+    void NetworkingListenerGNS::onConnected(uint32_t connection, const eastl::string& remoteEndPoint)
+    {
+        auto transport = eastl::make_shared<NetworkingTransportGNS>(connection, m_localEndPoint, remoteEndPoint);
+        m_transports.push_back(transport);
+        if (m_successCallback)
+        {
+            m_successCallback(transport);
+        }
+    }
+
+    void NetworkingListenerGNS::onClosed(uint32_t connection)
+    {
+        auto iter = eastl::find_if(m_transports.begin(), m_transports.end(), [connection](const auto& transport)
+        {
+            return transport->connection() == connection;
+        });
+        if (iter != m_transports.end())
+        {
+            (*iter)->onClosed();
+            m_transports.erase(iter);
+        }
+        else
+        {
+            SteamNetworkingSockets()->CloseConnection(connection, 0, nullptr, false);
+        }
+    }
+
+    NetworkingConnectorGNS::NetworkingConnectorGNS() = default;
+
+    NetworkingConnectorGNS::~NetworkingConnectorGNS()
+    {
+        stop();
+    }
+
+    void NetworkingConnectorGNS::setOnAuthorization(nau::Functor<bool(const INetworkingIdentity& identity, const NetworkingAddress&)> cb)
+    {
+        m_authorizationCallback = eastl::move(cb);
+    }
+
+    bool NetworkingConnectorGNS::connect(const eastl::string& uri,
+                                         nau::Functor<void(eastl::shared_ptr<INetworkingTransport>)> successCallback,
+                                         nau::Functor<void(void)> failCallback)
+    {
+        if (m_connection != k_HSteamNetConnection_Invalid)
+        {
+            return false;
+        }
+
+        SteamNetworkingIPAddr address;
+        if (parseAddress(uri, address))
+        {
+            m_connection = SteamNetworkingSockets()->ConnectByIPAddress(address, 0, nullptr);
+        }
+        if (m_connection == k_HSteamNetConnection_Invalid)
+        {
+            if (failCallback)
+            {
+                failCallback();
+            }
+            return false;
+        }
+
+        m_remoteEndPoint = uri;
+        m_successCallback = eastl::move(successCallback);
+        m_failCallback = eastl::move(failCallback);
+        return true;
+    }
+
+    bool NetworkingConnectorGNS::connect(const eastl::string& uri,
+                                         nau::Functor<void(eastl::shared_ptr<INetworkingTransport>)> successCallback,
+                                         nau::Functor<void(void)> failCallback,
+                                         [[maybe_unused]] nau::Functor<void(eastl::shared_ptr<INetworkingSignaling>)> signalingCallback)
+    {
+        return connect(uri, eastl::move(successCallback), eastl::move(failCallback));
+    }
+
+    bool NetworkingConnectorGNS::stop()
+    {
+        if (m_connection == k_HSteamNetConnection_Invalid)
+        {
+            return false;
+        }
+
+        if (m_transport)
+        {
+            m_transport->disconnect();
+            m_transport.reset();
+        }
+        else
+        {
+            SteamNetworkingSockets()->CloseConnection(m_connection, 0, nullptr, false);
+        }
+        m_connection = k_HSteamNetConnection_Invalid;
+        return true;
+    }
+
+    void NetworkingConnectorGNS::onConnected()
+    {
+        m_transport = eastl::make_shared<NetworkingTransportGNS>(m_connection, "udp://", m_remoteEndPoint);
+        if (m_successCallback)
+        {
+            m_successCallback(m_transport);
+        }
+    }
+
+    void NetworkingConnectorGNS::onClosed()
+    {
+        if (m_transport)
+        {
+            m_transport->onClosed();
+            m_transport.reset();
+        }
+        else
+        {
+            SteamNetworkingSockets()->CloseConnection(m_connection, 0, nullptr, false);
+            if (m_failCallback)
+            {
+                m_failCallback();
+            }
+        }
+        m_connection = k_HSteamNetConnection_Invalid;
+    }
+
+}  // namespace nau
+#endif  // NAU_NETWORK_GNS
@@ -0,0 +1,202 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#if NAU_NETWORK_GNS
+#include "nau/network/gns/networking_gns.h"
+
+#include <steam/isteamnetworkingsockets.h>
+#include <steam/isteamnetworkingutils.h>
+#include <steam/steamnetworkingsockets.h>
+
+#include "nau/diag/assertion.h"
+#include "nau/diag/logging.h"
+#include "nau/network/asio/networking_identity_asio.h"
+#include "nau/network/gns/networking_connection_gns.h"
+
+namespace nau
+{
+    namespace
+    {
+        NetworkingAddress toNetworkingAddress(const SteamNetworkingIPAddr& ipAddress)
+        {
+            char buffer[SteamNetworkingIPAddr::k_cchMaxString];
+            ipAddress.ToString(buffer, sizeof(buffer), true);
+            return {ipAddress.IsIPv4() ? NetworkingAddressType::IPv4 : NetworkingAddressType::IPv6, buffer};
+        }
+    }  // namespace
+
+    NetworkingGNS::NetworkingGNS()
+    {
+    }
+
+    NetworkingGNS::~NetworkingGNS()
+    {
+        shutdown();
+    }
+
+    bool NetworkingGNS::applyConfig(const eastl::string& data)
+    {
+        return true;
+    }
+
+    bool NetworkingGNS::init()
+    {
+        if (m_initialized)
+        {
+            return true;
+        }
+        if (s_instance)
+        {
+            NAU_LOG_ERROR("NetworkingGNS::init: GameNetworkingSockets is already used by the other context");
+            return false;
+        }
+
+        SteamNetworkingErrMsg errorMessage;
+        if (!GameNetworkingSockets_Init(nullptr, errorMessage))
+        {
+            NAU_LOG_ERROR("NetworkingGNS::init failed: {}", static_cast<const char*>(errorMessage));
+            return false;
+        }
+
+        s_instance = this;
+        m_initialized = true;
+        SteamNetworkingUtils()->SetGlobalCallback_SteamNetConnectionStatusChanged(&NetworkingGNS::onConnectionStatusChanged);
+
+        NAU_LOG_DEBUG("NetworkingGNS::init Ok");
+        return true;
+    }
+
+    bool NetworkingGNS::shutdown()
+    {
+        if (!m_initialized)
+        {
+            return true;
+        }
+
+        m_listeners.clear();
+        m_connectors.clear();
+
+        SteamNetworkingUtils()->SetGlobalCallback_SteamNetConnectionStatusChanged(nullptr);
+        GameNetworkingSockets_Kill();
+        s_instance = nullptr;
+        m_initialized = false;
+
+        NAU_LOG_DEBUG("NetworkingGNS::shutdown");
+        return true;
+    }
+
+    bool NetworkingGNS::update()
+    {
+        if (!m_initialized)
+        {
+            return false;
+        }
+        // dispatches the connection status changes (see connectionStatusChanged)
+        SteamNetworkingSockets()->RunCallbacks();
+        return true;
+    }
+
+    const INetworkingIdentity& NetworkingGNS::identity() const
+    {
+        static NetworkingIdentityASIO id("GNS");
+        return id;
+    }
+
+    eastl::shared_ptr<INetworkingListener> NetworkingGNS::createListener()
+    {
+        auto listener = eastl::make_shared<NetworkingListenerGNS>();
+        m_listeners.push_back(listener);
+        return listener;
+    }
+
+    eastl::shared_ptr<INetworkingConnector> NetworkingGNS::createConnector()
+    {
+        auto connector = eastl::make_shared<NetworkingConnectorGNS>();
+        m_connectors.push_back(connector);
+        return connector;
+    }
+
+    void NetworkingGNS::onConnectionStatusChanged(SteamNetConnectionStatusChangedCallback_t* info)
+    {
+        // the callbacks are dispatched from RunCallbacks() only: the instance is alive
+        NAU_ASSERT(s_instance);
+        s_instance->connectionStatusChanged(*info);
+    }
+
+    void NetworkingGNS::connectionStatusChanged(const SteamNetConnectionStatusChangedCallback_t& info)
+    {
+        const HSteamNetConnection connection = info.m_hConn;
+        const HSteamListenSocket listenSocket = info.m_info.m_hListenSocket;
+
+        NetworkingListenerGNS* listener = nullptr;
+        NetworkingConnectorGNS* connector = nullptr;
+        if (listenSocket != k_HSteamListenSocket_Invalid)
+        {
+            for (auto& item : m_listeners)
+            {
+                if (item->listenSocket() == listenSocket)
+                {
+                    listener = item.get();
+                    break;
+                }
+            }
+        }
+        else
+        {
+            for (auto& item : m_connectors)
+            {
+                if (item->connection() == connection)
+                {
+                    connector = item.get();
+                    break;
+                }
+            }
+        }
+
+        switch (info.m_info.m_eState)
+        {
+            case k_ESteamNetworkingConnectionState_Connecting:
+                if (listenSocket != k_HSteamListenSocket_Invalid)
+                {
+                    if (!listener || !listener->onConnecting(toNetworkingAddress(info.m_info.m_addrRemote)) ||
+                        SteamNetworkingSockets()->AcceptConnection(connection) != k_EResultOK)
+                    {
+                        SteamNetworkingSockets()->CloseConnection(connection, 0, nullptr, false);
+                    }
+                }
+                break;
+
+            case k_ESteamNetworkingConnectionState_Connected:
+                if (listener)
+                {
+                    listener->onConnected(connection, "udp://" + toNetworkingAddress(info.m_info.m_addrRemote).address);
+                }
+                else if (connector)
+                {
+                    connector->onConnected();
+                }
+                break;
+
+            case k_ESteamNetworkingConnectionState_ClosedByPeer:
+            case k_ESteamNetworkingConnectionState_ProblemDetectedLocally:
+                NAU_LOG_DEBUG("GNS connection closed ({}): {}", info.m_info.m_eEndReason, static_cast<const char*>(info.m_info.m_szEndDebug));
+                if (listener)
+                {
+                    listener->onClosed(connection);
+                }
+                else if (connector)
+                {
+                    connector->onClosed();
+                }
+                else
+                {
+                    SteamNetworkingSockets()->CloseConnection(connection, 0, nullptr, false);
+                }
+                break;
+
+            default:
+                break;
+        }
+    }
+}  // namespace nau
+#endif  // NAU_NETWORK_GNS
@@ -0,0 +1,107 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#if NAU_NETWORK_GNS
+#include "nau/network/gns/networking_transport_gns.h"
+
+#include <steam/isteamnetworkingsockets.h>
+
+namespace nau
+{
+    namespace
+    {
+        constexpr int ReadBatchSize = 32;
+    }
+
+    NetworkingTransportGNS::NetworkingTransportGNS(uint32_t connection, eastl::string localEndPoint, eastl::string remoteEndPoint) :
+        m_connection(connection),
+        m_localEndPoint(eastl::move(localEndPoint)),
+        m_remoteEndPoint(eastl::move(remoteEndPoint))
+    {
+    }
+
+    NetworkingTransportGNS::~NetworkingTransportGNS()
+    {
+        disconnect();
+    }
+
+    size_t NetworkingTransportGNS::read(eastl::vector<nau::NetworkingMessage>& messages)
+    {
+        messages.clear();
+        if (!m_connected)
+        {
+            return 0;
+        }
+
+        SteamNetworkingMessage_t* received[ReadBatchSize];
+        int count = 0;
+        do
+        {
+            count = SteamNetworkingSockets()->ReceiveMessagesOnConnection(m_connection, received, ReadBatchSize);
+            for (int i = 0; i < count; ++i)
+            {
+                nau::NetworkingMessage& message = messages.emplace_back();
+                message.buffer.resize(received[i]->m_cbSize);
+                std::memcpy(message.buffer.data(), received[i]->m_pData, received[i]->m_cbSize);
+                received[i]->Release();
+            }
+        } while (count == ReadBatchSize);
+
+        return messages.size();
+    }
+
+    bool NetworkingTransportGNS::write(const nau::NetworkingMessage& message)
+    {
+        return write(message, NetworkingLane::Reliable);
+    }
+
+    bool NetworkingTransportGNS::write(const nau::NetworkingMessage& message, NetworkingLane lane)
+    {
+        if (!m_connected)
+        {
+            return false;
+        }
+
+        // unreliable messages are delivered whole or dropped: there is no need to batch (Nagle) them
+        const int sendFlags = lane == NetworkingLane::Reliable ? k_nSteamNetworkingSend_Reliable : k_nSteamNetworkingSend_UnreliableNoNagle;
+        const EResult result = SteamNetworkingSockets()->SendMessageToConnection(m_connection, message.buffer.data(), static_cast<uint32>(message.buffer.size()), sendFlags, nullptr);
+        return result == k_EResultOK;
+    }
+
+    bool NetworkingTransportGNS::isConnected()
+    {
+        return m_connected;
+    }
+
+    bool NetworkingTransportGNS::disconnect()
+    {
+        if (!m_connected)
+        {
+            return false;
+        }
+        m_connected = false;
+        // linger to deliver the reliable messages that are already sent
+        return SteamNetworkingSockets()->CloseConnection(m_connection, 0, nullptr, true);
+    }
+
+    void NetworkingTransportGNS::onClosed()
+    {
+        if (m_connected)
+        {
+            m_connected = false;
+            SteamNetworkingSockets()->CloseConnection(m_connection, 0, nullptr, false);
+        }
+    }
+
+    const eastl::string& NetworkingTransportGNS::localEndPoint() const
+    {
+        return m_localEndPoint;
+    }
+
+    const eastl::string& NetworkingTransportGNS::remoteEndPoint() const
+    {
+        return m_remoteEndPoint;
+    }
+
+}  // namespace nau
+#endif  // NAU_NETWORK_GNS
@@ -0,0 +1,155 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#include "net_statistics_ui_controller.h"
+
+#include <imgui.h>
+
+#include "nau/diag/logging.h"
+
+namespace nau
+{
+    namespace
+    {
+        void drawTiming(const char* name, const NetTimingStatistics& timing)
+        {
+            ImGui::Text("%s: %.1f us (avg %.1f us, max %.1f us)", name, timing.last, timing.average, timing.max);
+        }
+
+        void drawConnections(const eastl::vector<NetConnectionStatistics>& connections)
+        {
+            constexpr ImGuiTableFlags flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_Resizable;
+            if (!ImGui::BeginTable("connections", 9, flags))
+            {
+                return;
+            }
+
+            ImGui::TableSetupColumn("Peer");
+            ImGui::TableSetupColumn("Remote peer");
+            ImGui::TableSetupColumn("Sent B/frame");
+            ImGui::TableSetupColumn("Components/frame");
+            ImGui::TableSetupColumn("Received B/frame");
+            ImGui::TableSetupColumn("Total sent KB");
+            ImGui::TableSetupColumn("RTT ms");
+            ImGui::TableSetupColumn("Loss %");
+            ImGui::TableSetupColumn("Queues in/out");
+            ImGui::TableHeadersRow();
+
+            for (const NetConnectionStatistics& connection : connections)
+            {
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(connection.peerId.c_str());
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(connection.remotePeerId.c_str());
+                ImGui::TableNextColumn();
+                ImGui::Text("%u", connection.lastFrameBytesSent);
+                ImGui::TableNextColumn();
+                ImGui::Text("%u", connection.lastFrameComponentsSent);
+                ImGui::TableNextColumn();
+                ImGui::Text("%u", connection.lastFrameBytesReceived);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.1f", static_cast<double>(connection.bytesSent) / 1024.0);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.2f", connection.roundTripTime);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.2f", connection.getLossRate() * 100.f);
+                ImGui::TableNextColumn();
+                ImGui::Text("%zu / %zu", connection.incomingQueueDepth, connection.outgoingQueueDepth);
+            }
+
+            ImGui::EndTable();
+        }
+
+        void drawComponentTypes(const eastl::vector<NetComponentTypeStatistics>& componentTypes)
+        {
+            constexpr ImGuiTableFlags flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_Resizable;
+            if (!ImGui::BeginTable("componentTypes", 5, flags))
+            {
+                return;
+            }
+
+            ImGui::TableSetupColumn("Type");
+            ImGui::TableSetupColumn("Sent");
+            ImGui::TableSetupColumn("Sent KB");
+            ImGui::TableSetupColumn("Applied");
+            ImGui::TableSetupColumn("Applied KB");
+            ImGui::TableHeadersRow();
+
+            for (const NetComponentTypeStatistics& componentType : componentTypes)
+            {
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(componentType.typeName.c_str());
+                ImGui::TableNextColumn();
+                ImGui::Text("%llu", static_cast<unsigned long long>(componentType.componentsSent));
+                ImGui::TableNextColumn();
+                ImGui::Text("%.1f", static_cast<double>(componentType.bytesSent) / 1024.0);
+                ImGui::TableNextColumn();
+                ImGui::Text("%llu", static_cast<unsigned long long>(componentType.componentsApplied));
+                ImGui::TableNextColumn();
+                ImGui::Text("%.1f", static_cast<double>(componentType.bytesApplied) / 1024.0);
+            }
+
+            ImGui::EndTable();
+        }
+    }  // namespace
+
+    void NetStatisticsImguiController::drawGui(INetStatistics& statistics)
+    {
+        if (ImGui::Begin("Network replication"))
+        {
+            ImGui::SetWindowPos({200, 320}, ImGuiCond_Once);
+            ImGui::SetWindowSize(ImVec2(640, 320), ImGuiCond_Once);
+
+            bool isEnabled = statistics.isEnabled();
+            if (ImGui::Checkbox("Collect", &isEnabled))
+            {
+                statistics.setEnabled(isEnabled);
+            }
+            ImGui::SameLine();
+            if (ImGui::Button("Reset"))
+            {
+                statistics.reset();
+            }
+
+            ImGui::InputText("CSV file", m_csvPath, sizeof(m_csvPath));
+            ImGui::SameLine();
+            if (!m_isCsvExporting)
+            {
+                if (ImGui::Button("Start export"))
+                {
+                    if (const Result<> result = statistics.startCsvExport(m_csvPath); result.isError())
+                    {
+                        NAU_LOG_ERROR("Net statistics export failed: {}", result.getError()->getMessage());
+                    }
+                    else
+                    {
+                        m_isCsvExporting = true;
+                    }
+                }
+            }
+            else if (ImGui::Button("Stop export"))
+            {
+                statistics.stopCsvExport();
+                m_isCsvExporting = false;
+            }
+
+            drawTiming("Serialize", statistics.getSerializeTime());
+            drawTiming("Parse", statistics.getParseTime());
+
+            if (ImGui::CollapsingHeader("Connections", ImGuiTreeNodeFlags_DefaultOpen))
+            {
+                statistics.getConnectionStatistics(m_connections);
+                drawConnections(m_connections);
+            }
+
+            if (ImGui::CollapsingHeader("Component types", ImGuiTreeNodeFlags_DefaultOpen))
+            {
+                statistics.getComponentStatistics(m_componentTypes);
+                drawComponentTypes(m_componentTypes);
+            }
+        }
+        ImGui::End();
+    }
+}  // namespace nau
@@ -0,0 +1,23 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <EASTL/vector.h>
+
+#include "nau/network/netsync/net_statistics.h"
+
+namespace nau
+{
+    class NetStatisticsImguiController final
+    {
+    public:
+        void drawGui(INetStatistics& statistics);
+
+    private:
+        char m_csvPath[256] = "net_statistics.csv";
+        bool m_isCsvExporting = false;
+        eastl::vector<NetConnectionStatistics> m_connections;
+        eastl::vector<NetComponentTypeStatistics> m_componentTypes;
+    };
+}  // namespace nau
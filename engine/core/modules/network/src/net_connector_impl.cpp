@@ -4,6 +4,7 @@
 
 #include "net_connector_impl.h"
 
+#include "nau/diag/logging.h"
 #include "nau/network/napi/networking_factory.h"
 #include "nau/service/service_provider.h"
 
@@ -16,6 +17,7 @@ namespace nau
 
     async::Task<> NetConnectorImpl::initService()
     {
+        m_sessionRecorder = getServiceProvider().find<ISessionRecorder>();
         return async::Task<>::makeResolved();
     }
 
@@ -132,16 +134,40 @@ namespace nau
         }
     }
 
+    void NetConnectorImpl::writeFrame(const eastl::string& peerId, const eastl::string& toPeerId, const eastl::string& frame)
+    {
+        for (auto& connection : m_connections)
+        {
+            if (connection->m_localPeerId == peerId && connection->m_remotePeerId == toPeerId)
+            {
+                connection->writeFrame(frame);
+            }
+        }
+    }
+
     bool NetConnectorImpl::readFrame(const eastl::string& peerId, const eastl::string& fromPeerId, eastl::string& frame)
     {
         frame.clear();
+
+        const SessionRecorderMode sessionMode = m_sessionRecorder ? m_sessionRecorder->getMode() : SessionRecorderMode::Off;
+        if (sessionMode == SessionRecorderMode::Replay)
+        {
+            return readReplayedFrame("net/" + peerId + "/" + fromPeerId, frame);
+        }
+
         for (auto& connection : m_connections)
         {
             if (connection->m_localPeerId == peerId && connection->m_remotePeerId == fromPeerId)
             {
-                if (!connection->m_frameBuffer.empty())
+                if (!connection->m_frames.empty())
                 {
-                    frame = connection->m_frameBuffer;
+                    frame = std::move(connection->m_frames.front());
+                    connection->m_frames.pop_front();
+
+                    if (sessionMode == SessionRecorderMode::Record)
+                    {
+                        m_sessionRecorder->recordEvent("net/" + peerId + "/" + fromPeerId, frame);
+                    }
                     return true;
                 }
             }
@@ -149,6 +175,27 @@ namespace nau
         return false;
     }
 
+    bool NetConnectorImpl::readReplayedFrame(const eastl::string& channel, eastl::string& frame)
+    {
+        if (m_replayFrameIndex != m_sessionRecorder->getFrameIndex())
+        {
+            m_replayFrameIndex = m_sessionRecorder->getFrameIndex();
+            m_replayReadCounts.clear();
+        }
+
+        // The frames are read in the recorded order, each one once
+        size_t& readCount = m_replayReadCounts[channel];
+        const eastl::vector<eastl::string_view> frames = m_sessionRecorder->getReplayEvents(channel);
+        if (readCount >= frames.size())
+        {
+            return false;
+        }
+
+        frame.assign(frames[readCount].data(), frames[readCount].size());
+        ++readCount;
+        return true;
+    }
+
     void NetConnectorImpl::update()
     {
         if (m_networking)
@@ -167,12 +214,11 @@ namespace nau
         {
             if (m_transport->isConnected())
             {
-                eastl::vector<NetworkingMessage> messages;
-                m_transport->read(messages);
-                // TODO - move message handling to ASIO transport implementation
-                for (auto& message : messages)
+                // the messages are kept between the updates: the transport reuses their buffers
+                m_transport->read(m_messages);
+                for (auto& message : m_messages)
                 {
-                    m_recBuffer.append(asStringView(message.buffer).data());
+                    m_recBuffer.append(reinterpret_cast<const char*>(message.buffer.data()), message.buffer.size());
                 }
                 processMessages();
                 if (m_remotePeerId.empty())
@@ -185,52 +231,75 @@ namespace nau
 
     void NetConnectorImpl::Connection::processMessages()
     {
-        while (true)
+        constexpr size_t HeaderSize = sizeof(uint8_t) + sizeof(uint32_t);
+
+        size_t offset = 0;
+        while (m_recBuffer.size() - offset >= HeaderSize)
         {
-            size_t start = m_recBuffer.find('\n');
-            if (start == eastl::string::npos)
+            const char* const header = m_recBuffer.data() + offset;
+            uint32_t payloadSize = 0;
+            std::memcpy(&payloadSize, header + sizeof(uint8_t), sizeof(uint32_t));
+            if (m_recBuffer.size() - offset - HeaderSize < payloadSize)
             {
-                return;
+                break;
             }
-            size_t end = m_recBuffer.find('\r', start);
-            if (end == eastl::string::npos)
-            {
-                return;
-            }
-            eastl::string message = m_recBuffer.substr(start, end - start + 1);
-            m_recBuffer.erase(start, end - start + 1);
-            processMessage(message);
+
+            processPacket(static_cast<PacketKind>(header[0]), eastl::string_view{header + HeaderSize, payloadSize});
+            offset += HeaderSize + payloadSize;
         }
+
+        m_recBuffer.erase(0, offset);
     }
 
-    void NetConnectorImpl::Connection::processMessage(const eastl::string& message)
+    void NetConnectorImpl::Connection::processPacket(PacketKind kind, eastl::string_view payload)
     {
-        if (message == "\n|req_id\r")
+        switch (kind)
         {
-            sendId();
-            return;
-        }
-        if (message.find("\n|id", 0) == 0)
-        {
-            m_remotePeerId = message.substr(4, message.size() - 5);
-            return;
+            case PacketKind::RequestId:
+                sendId();
+                break;
+            case PacketKind::Id:
+                m_remotePeerId.assign(payload.data(), payload.size());
+                break;
+            case PacketKind::Frame:
+                // all the frames are kept: the interpolated replicas use the intermediate states
+                if (m_frames.size() == MaxQueuedFrames)
+                {
+                    m_frames.pop_front();
+                }
+                m_frames.emplace_back(payload.data(), payload.size());
+                break;
+            default:
+                NAU_LOG_WARNING("Unknown net packet kind ({})", static_cast<unsigned>(kind));
         }
-        if (message.find("{") == 1)  // frame data assumed
+    }
+
+    void NetConnectorImpl::Connection::writePacket(PacketKind kind, eastl::string_view payload)
+    {
+        const uint32_t payloadSize = static_cast<uint32_t>(payload.size());
+
+        NetworkingMessage message;
+        message.buffer.resize(sizeof(uint8_t) + sizeof(uint32_t) + payload.size());
+        std::byte* const data = message.buffer.data();
+        data[0] = static_cast<std::byte>(kind);
+        std::memcpy(data + sizeof(uint8_t), &payloadSize, sizeof(uint32_t));
+        if (!payload.empty())
         {
-            m_frameBuffer = message;
+            std::memcpy(data + sizeof(uint8_t) + sizeof(uint32_t), payload.data(), payload.size());
         }
+
+        // frames are superseded by the next ones (and are deltas against the acknowledged frames only)
+        m_transport->write(message, kind == PacketKind::Frame ? NetworkingLane::Unreliable : NetworkingLane::Reliable);
     }
 
     void NetConnectorImpl::Connection::writeFrame(const eastl::string& frame)
     {
-        NetworkingMessage message("\n" + frame + "\r");
-        m_transport->write(message);
+        writePacket(PacketKind::Frame, frame);
     }
 
     void NetConnectorImpl::Connection::requestRemoteId()
     {
-        NetworkingMessage message("\n|req_id\r");
-        m_transport->write(message);
+        writePacket(PacketKind::RequestId, {});
         if (m_verbose)
         {
             // NAU_LOG_DEBUG("requestRemoteId()");
@@ -239,8 +308,7 @@ namespace nau
 
     void NetConnectorImpl::Connection::sendId()
     {
-        NetworkingMessage message("\n|id" + m_localPeerId + "\r");
-        m_transport->write(message);
+        writePacket(PacketKind::Id, m_localPeerId);
         if (m_verbose)
         {
             // NAU_LOG_DEBUG("sendId()");
@@ -4,10 +4,12 @@
 
 #pragma once
 
+#include <EASTL/deque.h>
 #include <EASTL/map.h>
 #include <EASTL/string.h>
 #include <EASTL/utility.h>
 
+#include "nau/app/session_recorder.h"
 #include "nau/network/napi/networking.h"
 #include "nau/network/netsync/net_connector.h"
 #include "nau/rtti/rtti_impl.h"
@@ -38,6 +40,7 @@ namespace nau
         void getConnections(eastl::vector<eastl::weak_ptr<IConnection>>& connections) override;
 
         void writeFrame(const eastl::string& peerId, const eastl::string& frame) override;
+        void writeFrame(const eastl::string& peerId, const eastl::string& toPeerId, const eastl::string& frame) override;
         bool readFrame(const eastl::string& peerId, const eastl::string& fromPeerId, eastl::string& frame) override;
 
         void update() override;
@@ -50,10 +53,24 @@ namespace nau
             State m_state = none;
             eastl::shared_ptr<INetworkingTransport> m_transport;
 
-            // Temporary measure until we implement some message protocol for stream connections, like ASIO TCP
+            /**
+             * @brief Kinds of the packets sent over the stream connection: [kind:uint8][payload size:uint32][payload].
+             */
+            enum class PacketKind : uint8_t
+            {
+                RequestId = 1,
+                Id = 2,
+                Frame = 3
+            };
+
+            eastl::vector<NetworkingMessage> m_messages;
+
+            // Received bytes that do not yet form a complete packet
             eastl::string m_recBuffer;
 
-            eastl::string m_frameBuffer;
+            // Received frames not read yet (the oldest ones are dropped when the reader falls behind)
+            eastl::deque<eastl::string> m_frames;
+            static constexpr size_t MaxQueuedFrames = 64;
 
             Connection(const eastl::string& localPeerId, const eastl::string& remotePeerId) :
                 m_localPeerId(localPeerId),
@@ -86,9 +103,15 @@ namespace nau
                 return m_transport->remoteEndPoint();
             }
 
+            virtual NetworkingTransportStatistics transportStatistics() override
+            {
+                return m_transport ? m_transport->statistics() : NetworkingTransportStatistics{};
+            }
+
             void update();
             void processMessages();
-            void processMessage(const eastl::string& message);
+            void processPacket(PacketKind kind, eastl::string_view payload);
+            void writePacket(PacketKind kind, eastl::string_view payload);
             void writeFrame(const eastl::string& frame);
             void requestRemoteId();
             void sendId();
@@ -97,11 +120,18 @@ namespace nau
             bool m_verbose = true;
         };
 
+        bool readReplayedFrame(const eastl::string& channel, eastl::string& frame);
+
         eastl::unique_ptr<INetworking> m_networking;
         eastl::vector<eastl::pair<eastl::shared_ptr<INetworkingListener>, ConnectionData>> m_listeners;
         eastl::vector<eastl::pair<eastl::shared_ptr<INetworkingConnector>, ConnectionData>> m_connectors;
         eastl::vector<eastl::shared_ptr<Connection>> m_connections;
 
+        // The read frames are recorded into the session, on the replay the frames are read from the session instead of the connections
+        ISessionRecorder* m_sessionRecorder = nullptr;
+        uint64_t m_replayFrameIndex = 0;
+        eastl::map<eastl::string, size_t> m_replayReadCounts;
+
         // Debug
         bool m_verbose = true;
     };
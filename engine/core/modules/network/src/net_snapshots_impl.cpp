@@ -3,15 +3,26 @@
 
 #include "net_snapshots_impl.h"
 
+#include <EASTL/algorithm.h>
+#include <EASTL/sort.h>
+
+#include "nau/diag/assertion.h"
 #include "nau/diag/logging.h"
 #include "nau/network/napi/networking_factory.h"
 #include "nau/network/netsync/net_connector.h"
-#include "nau/serialization/json.h"
-#include "nau/serialization/json_utils.h"
+#include "nau/serialization/binary_serialization.h"
 #include "nau/service/service_provider.h"
 
 namespace nau
 {
+    namespace
+    {
+        eastl::span<const std::byte> asBytes(const eastl::string& str)
+        {
+            return {reinterpret_cast<const std::byte*>(str.data()), str.size()};
+        }
+    }  // namespace
+
     async::Task<> NetSnapshotsImpl::preInitService()
     {
         return async::Task<>::makeResolved();
@@ -25,15 +36,23 @@ namespace nau
 
     void NetSnapshotsImpl::onSceneActivated(IComponentNetScene* scene)
     {
-        const char* peerId = scene->getPeerId().data();
-        const char* sceneName = scene->getSceneName().data();
-        if (m_peers.count(peerId) == 0)
+        const PeerIndex peerIndex = registerPeer(scene->getPeerId());
+        PeerData& pdata = m_peers[peerIndex];
+
+        const eastl::string sceneName{scene->getSceneName()};
+        if (pdata.m_sceneIndices.count(sceneName) != 0)
         {
-            m_peers.emplace(peerId, PeerData());
+            return;
         }
-        PeerData& pdata = m_peers[peerId];
-        pdata.activateScene(scene);
-        m_sceneToPeer.emplace(sceneName, &pdata);
+
+        const SceneIndex sceneIndex = static_cast<SceneIndex>(m_scenes.size());
+        SceneEntry& entry = m_scenes.emplace_back();
+        entry.m_name = sceneName;
+        entry.m_peer = peerIndex;
+        entry.m_scene = scene;
+
+        pdata.m_sceneIndices.emplace(sceneName, sceneIndex);
+        m_sceneIndices.emplace(sceneName, sceneIndex);
     }
 
     void NetSnapshotsImpl::onSceneDectivated(IComponentNetScene* scene)
@@ -43,15 +62,17 @@ namespace nau
 
     void NetSnapshotsImpl::onSceneUpdated(IComponentNetScene* scene)
     {
-        const char* peerId = scene->getPeerId().data();
-        const char* sceneName = scene->getSceneName().data();
-        if (m_sceneToPeer.count(sceneName) == 0)
+        const eastl::string sceneName{scene->getSceneName()};
+        if (m_sceneIndices.count(sceneName) == 0)
         {
-            m_onSceneMissing(peerId, sceneName);
-            return;
+            m_onSceneMissing(scene->getPeerId(), sceneName);
         }
-        PeerData* pdata = m_sceneToPeer[sceneName];
-        m_sceneToPeer.emplace(sceneName, pdata);
+    }
+
+    void NetSnapshotsImpl::setPeerInterest(eastl::string_view peerId, eastl::string_view remotePeerId, const NetPeerInterest& interest)
+    {
+        const PeerIndex remotePeer = registerPeer(remotePeerId);
+        m_peers[registerPeer(peerId)].getConnection(remotePeer).m_interest = interest;
     }
 
     void NetSnapshotsImpl::setOnSceneMissing(nau::Functor<void(eastl::string_view peerId, eastl::string_view sceneName)> callback)
@@ -66,152 +87,346 @@ namespace nau
 
     void NetSnapshotsImpl::onComponentDeactivated(IComponentNetSync* component)
     {
-        // TODO - track component show/hide
+        // the index is kept for the path: the component can be activated again
+        m_componentIndexByPtr.erase(component);
+
+        // the replica is resolved again by the path if the component is activated again
+        for (PeerData& peer : m_peers)
+        {
+            for (RemoteComponent& remoteComponent : peer.m_remoteComponents)
+            {
+                if (remoteComponent.m_component == component)
+                {
+                    remoteComponent.m_component = nullptr;
+                    remoteComponent.m_isInterpolated = false;
+                }
+            }
+        }
     }
 
     void NetSnapshotsImpl::onComponentWrite(IComponentNetSync* component)
     {
-        eastl::string_view sceneName = component->getSceneName();
-        auto peerPtr = getPeer(sceneName.data());
-        if (peerPtr != nullptr)
+        const ComponentIndex index = findComponentIndex(component);
+        if (index != InvalidIndex)
         {
-            peerPtr->writeComponent(sceneName.data(), component);
+            m_peers[m_scenes[m_components[index].m_scene].m_peer].writeComponent(index, component);
         }
     }
 
+    void NetSnapshotsImpl::setSendRate(float sendRate)
+    {
+        m_sendInterval = sendRate > 0.f ? std::chrono::duration_cast<Clock::duration>(std::chrono::duration<float>(1.f / sendRate)) : Clock::duration{0};
+        m_nextSendTime = {};
+    }
+
+    void NetSnapshotsImpl::setInterpolationSettings(const NetInterpolationSettings& settings)
+    {
+        m_interpolation = settings;
+    }
+
     void NetSnapshotsImpl::nextFrame()
     {
+        const Clock::time_point now = Clock::now();
+        if (now < m_nextSendTime)
+        {
+            // not the time to send yet: the frame is collected again by the next update
+            for (auto& peer : m_peers)
+            {
+                peer.m_frames[m_frame].m_components.clear();
+            }
+            return;
+        }
+        m_nextSendTime = m_nextSendTime + m_sendInterval > now ? m_nextSendTime + m_sendInterval : now + m_sendInterval;
+
         auto& connector = getServiceProvider().get<INetConnector>();
+        const double time = getLocalTime();
 
-        for (auto& peer : m_peers)
+        eastl::vector<eastl::string> connections;
+        for (PeerIndex peerIndex = 0; peerIndex < m_peers.size(); ++peerIndex)
         {
-            eastl::string buffer;
-            peer.second.serializeFrame(m_frame, buffer);
-            if (!buffer.empty())
+            PeerData& peer = m_peers[peerIndex];
+            connections.clear();
+            connector.getConnections(peer.m_name, connections);
+            if (connections.empty())
+            {
+                continue;
+            }
+
+            peer.m_frames[m_frame].m_time = time;
+            for (const eastl::string& remotePeerId : connections)
             {
-                connector.writeFrame(peer.first, buffer);
+                const PeerIndex remotePeer = registerPeer(remotePeerId);
+                const std::optional<uint32_t> ackFrame = m_peers[remotePeer].m_lastReceivedFrame;
+
+                eastl::string buffer;
+                const size_t componentCount = serializeConnectionFrame(peer, m_frame, remotePeer, ackFrame, buffer);
+                if (!buffer.empty())
+                {
+                    connector.writeFrame(peer.m_name, remotePeerId, buffer);
+                    m_statistics.onFrameSent(peerIndex, remotePeer, m_frame, buffer.size(), componentCount);
+                }
             }
         }
+        if (m_statistics.isEnabled())
+        {
+            m_statistics.addSerializeTime(Clock::now() - now);
+            m_statistics.endFrame(m_frame, connector);
+        }
         ++m_frame;
-        uint32_t oldFrame = m_frame >= 2 ? m_frame - 2 : 0;
+        uint32_t oldFrame = m_frame >= MaxBaselineAge ? m_frame - MaxBaselineAge : 0;
         for (auto& peer : m_peers)
         {
-            peer.second.advanceToFrame(m_frame);
-            peer.second.purgeFrames(oldFrame);
+            peer.advanceToFrame(m_frame);
+            peer.purgeFrames(oldFrame);
         }
     }
 
     void NetSnapshotsImpl::applyPeerUpdates()
     {
         auto& connector = getServiceProvider().get<INetConnector>();
-        for (auto& peer : m_peers)
+        const Clock::time_point startTime = Clock::now();
+
+        eastl::vector<eastl::string> connections;
+        eastl::string frameBuffer;
+        for (PeerIndex peerIndex = 0; peerIndex < m_peers.size(); ++peerIndex)
         {
-            eastl::vector<eastl::string> peers;
-            connector.getConnections(peer.first, peers);
-            for (auto& connected : peers)
+            connections.clear();
+            connector.getConnections(m_peers[peerIndex].m_name, connections);
+            for (const eastl::string& connected : connections)
             {
-                eastl::string frameBuffer;
-                if (connector.readFrame(peer.first, connected, frameBuffer))
+                // all the frames received since the previous update are applied in order: the interpolated replicas buffer each state
+                while (connector.readFrame(m_peers[peerIndex].m_name, connected, frameBuffer))
                 {
-                    FrameSnapshot frameSnapshot;
-                    auto res = serialization::JsonUtils::parse(frameSnapshot, frameBuffer.c_str());
-                    if (res.isSuccess())
+                    WireFrame wireFrame;
+                    auto res = serialization::binaryDeserialize(asBytes(frameBuffer), wireFrame);
+                    if (!res.isSuccess())
                     {
-                        if (m_peers.count(connected) == 0)
-                        {
-                            m_peers.emplace(connected, PeerData());
-                        }
-                        auto& dstPeer = m_peers[connected];
-                        dstPeer.m_frames.clear();
-                        dstPeer.m_frames.emplace(frameSnapshot.m_frame, frameSnapshot);
-                        applyFrameUpdate(connected, frameSnapshot.m_frame);
+                        NAU_LOG_ERROR("applyPeerUpdates parse failed");
+                        continue;
                     }
-                    else
+
+                    const PeerIndex srcPeerIndex = registerPeer(connected);
+                    if (wireFrame.m_ackFrame)
                     {
-                        NAU_LOG_ERROR("applyPeerUpdates parse failed");
+                        m_peers[peerIndex].getConnection(srcPeerIndex).m_ackedFrame = *wireFrame.m_ackFrame;
+                    }
+
+                    const uint32_t frame = wireFrame.m_frame;
+                    const double frameTime = wireFrame.m_time;
+                    const std::optional<uint32_t> ackFrame = wireFrame.m_ackFrame;
+                    const bool isReceived = m_peers[srcPeerIndex].receiveFrame(std::move(wireFrame));
+                    m_statistics.onFrameReceived(peerIndex, srcPeerIndex, frame, frameBuffer.size(), ackFrame, isReceived);
+                    if (isReceived)
+                    {
+                        m_peers[srcPeerIndex].updatePlayoutClock(frameTime, getLocalTime());
+                        applyFrameUpdate(srcPeerIndex, frame);
                     }
                 }
             }
         }
+
+        // the interpolated replicas are presented every update (between the received frames too)
+        const double localTime = getLocalTime();
+        for (PeerData& peer : m_peers)
+        {
+            if (!peer.m_clockOffset)
+            {
+                continue;
+            }
+
+            const double playbackTime = peer.getPlaybackTime(localTime, m_interpolation);
+            for (const RemoteComponent& remoteComponent : peer.m_remoteComponents)
+            {
+                if (remoteComponent.m_isInterpolated && remoteComponent.m_component != nullptr)
+                {
+                    remoteComponent.m_component->netInterpolate(playbackTime);
+                }
+            }
+        }
+
+        if (m_statistics.isEnabled())
+        {
+            m_statistics.addParseTime(Clock::now() - startTime);
+        }
     }
 
-    void NetSnapshotsImpl::applyFrameUpdate(const eastl::string& peerId, uint32_t frameNum)
+    INetStatistics& NetSnapshotsImpl::getStatistics()
     {
-        if (m_peers.count(peerId) == 0)
+        return m_statistics;
+    }
+
+    void NetSnapshotsImpl::applyFrameUpdate(PeerIndex peerIndex, uint32_t frameNum)
+    {
+        auto& peer = m_peers[peerIndex];
+        auto& frame = peer.m_receivedFrames[frameNum];
+
+        // the components that are not changed since the previously applied frame are skipped
+        const FrameSnapshot* appliedFrame = nullptr;
+        if (peer.m_appliedFrame)
         {
-            return;
+            if (auto applied = peer.m_receivedFrames.find(*peer.m_appliedFrame); applied != peer.m_receivedFrames.end())
+            {
+                appliedFrame = &applied->second;
+            }
         }
-        auto& peer = m_peers[peerId];
-        auto& frame = peer.m_frames[frameNum];
-        for (auto& sceneSnapshot : frame.m_scenes)
+        peer.m_appliedFrame = frameNum;
+
+        eastl::vector<eastl::string_view> missingScenes;
+        for (ComponentIndex index = 0; index < frame.m_components.size(); ++index)
         {
-            auto& sceneName = sceneSnapshot.first;
-            if (peer.m_peerScenes.count(sceneName) == 0)
+            const auto& componentData = frame.m_components[index];
+            if (!componentData)
             {
-                m_onSceneMissing(peerId, sceneName);
                 continue;
             }
-            auto* scene = peer.m_peerScenes[sceneName];
-            for (auto& componentData : sceneSnapshot.second.m_components)
+            RemoteComponent& remoteComponent = peer.m_remoteComponents[index];
+            if (appliedFrame && !remoteComponent.m_isInterpolated)
+            {
+                if (const ComponentData* applied = appliedFrame->findComponent(index); applied && *applied == *componentData)
+                {
+                    continue;
+                }
+            }
+
+            if (remoteComponent.m_component == nullptr)
             {
-                auto* component = scene->getOrCreateComponent(componentData.first.c_str(), "");
-                if (component == nullptr)
+                auto sceneIndex = peer.m_sceneIndices.find(remoteComponent.m_sceneName);
+                if (sceneIndex == peer.m_sceneIndices.end())
+                {
+                    const eastl::string_view sceneName = remoteComponent.m_sceneName;
+                    if (eastl::find(missingScenes.begin(), missingScenes.end(), sceneName) == missingScenes.end())
+                    {
+                        missingScenes.push_back(sceneName);
+                        m_onSceneMissing(peer.m_name, sceneName);
+                    }
+                    continue;
+                }
+
+                // the replica is resolved by the path once
+                remoteComponent.m_component = m_scenes[sceneIndex->second].m_scene->getOrCreateComponent(remoteComponent.m_componentPath, "");
+                if (remoteComponent.m_component == nullptr)
                 {
                     NAU_LOG_WARNING("applyFrameUpdate dst component not found");
                     continue;
                 }
-                component->netRead(componentData.second.m_data);
+                remoteComponent.m_typeIndex = m_statistics.registerComponentType(remoteComponent.m_component->getNetTypeName());
             }
+            remoteComponent.m_isInterpolated = componentData->readBufferedTo(remoteComponent.m_component, frame.m_time);
+            m_statistics.onComponentApplied(remoteComponent.m_typeIndex, componentData->m_data.size());
         }
     }
 
     void NetSnapshotsImpl::applyPeerUpdatesLocal(const char* srcPeerId, const char* dstPeerId)
     {
-        if (m_peers.count(srcPeerId) == 0 || m_peers.count(dstPeerId) == 0)
+        auto srcPeerIndex = m_peerIndices.find(eastl::string{srcPeerId});
+        auto dstPeerIndex = m_peerIndices.find(eastl::string{dstPeerId});
+        if (srcPeerIndex == m_peerIndices.end() || dstPeerIndex == m_peerIndices.end())
         {
             return;
         }
-        auto& srcPeer = m_peers[srcPeerId];
-        auto& dstPeer = m_peers[dstPeerId];
-        if (srcPeer.m_frames.count(m_frame) == 0)
+        auto& srcPeer = m_peers[srcPeerIndex->second];
+        auto& dstPeer = m_peers[dstPeerIndex->second];
+        auto srcFrame = srcPeer.m_frames.find(m_frame);
+        if (srcFrame == srcPeer.m_frames.end())
         {
             return;
         }
-        auto& srcFrame = srcPeer.m_frames[m_frame];
-        for (auto& srcScene : srcFrame.m_scenes)
+        for (ComponentIndex index = 0; index < srcFrame->second.m_components.size(); ++index)
         {
-            auto& srcSceneName = srcScene.first;
-            if (dstPeer.m_peerScenes.count(srcSceneName) == 0)
+            const auto& componentData = srcFrame->second.m_components[index];
+            if (!componentData)
+            {
+                continue;
+            }
+            const ComponentEntry& entry = m_components[index];
+            auto dstScene = dstPeer.m_sceneIndices.find(m_scenes[entry.m_scene].m_name);
+            if (dstScene == dstPeer.m_sceneIndices.end())
             {
                 NAU_LOG_WARNING("applyPeerUpdates dst scene not found");
                 continue;
             }
-            auto* dstScene = dstPeer.m_peerScenes[srcSceneName];
-            for (auto& componentData : srcScene.second.m_components)
+            auto* component = m_scenes[dstScene->second].m_scene->getOrCreateComponent(entry.m_path, "");
+            if (component == nullptr)
             {
-                auto* component = dstScene->getOrCreateComponent(componentData.first.c_str(), "");
-                if (component == nullptr)
-                {
-                    NAU_LOG_WARNING("applyPeerUpdates dst component not found");
-                    continue;
-                }
-                component->netRead(componentData.second.m_data);
+                NAU_LOG_WARNING("applyPeerUpdates dst component not found");
+                continue;
             }
+            componentData->readTo(component);
+        }
+    }
+
+    double NetSnapshotsImpl::getLocalTime() const
+    {
+        return std::chrono::duration<double>(Clock::now() - m_startTime).count();
+    }
+
+    NetSnapshotsImpl::PeerIndex NetSnapshotsImpl::registerPeer(eastl::string_view peerId)
+    {
+        auto [iter, emplaced] = m_peerIndices.try_emplace(eastl::string{peerId}, static_cast<PeerIndex>(m_peers.size()));
+        if (emplaced)
+        {
+            PeerData& peer = m_peers.emplace_back();
+            peer.m_name = iter->first;
+            peer.advanceToFrame(m_frame);
+            m_statistics.registerPeer(iter->second, peer.m_name);
+        }
+        return iter->second;
+    }
+
+    NetSnapshotsImpl::ComponentIndex NetSnapshotsImpl::registerComponent(SceneIndex scene, eastl::string_view componentPath)
+    {
+        auto [iter, emplaced] = m_scenes[scene].m_componentIndices.try_emplace(eastl::string{componentPath}, static_cast<ComponentIndex>(m_components.size()));
+        if (emplaced)
+        {
+            m_components.push_back({scene, iter->first});
         }
+        return iter->second;
     }
 
-    void NetSnapshotsImpl::PeerData::activateScene(IComponentNetScene* scene)
+    NetSnapshotsImpl::ComponentIndex NetSnapshotsImpl::findComponentIndex(IComponentNetSync* component)
     {
-        const char* sceneName = scene->getSceneName().data();
-        if (m_peerScenes.count(sceneName) == 0)
+        if (auto iter = m_componentIndexByPtr.find(component); iter != m_componentIndexByPtr.end())
         {
-            m_peerScenes.emplace(sceneName, scene);
+            return iter->second;
         }
+
+        auto scene = m_sceneIndices.find(eastl::string{component->getSceneName()});
+        if (scene == m_sceneIndices.end())
+        {
+            NAU_LOG_ERROR("Missing scene while trying getPeer");
+            return InvalidIndex;
+        }
+
+        const ComponentIndex index = registerComponent(scene->second, component->getComponentPath());
+        m_components[index].m_typeIndex = m_statistics.registerComponentType(component->getNetTypeName());
+        m_componentIndexByPtr.emplace(component, index);
+        return index;
+    }
+
+    void NetSnapshotsImpl::clearState()
+    {
+        m_peers.clear();
+        m_peerIndices.clear();
+        m_scenes.clear();
+        m_sceneIndices.clear();
+        m_components.clear();
+        m_componentIndexByPtr.clear();
+        m_statistics.clearPeers();
     }
 
-    void NetSnapshotsImpl::PeerData::deactivateScene(IComponentNetScene* scene)
+    NetSnapshotsImpl::ComponentDefinition NetSnapshotsImpl::makeDefinition(ComponentIndex index) const
     {
-        // TODO - track scene unload
+        const ComponentEntry& entry = m_components[index];
+        return {index, m_scenes[entry.m_scene].m_name, entry.m_path};
+    }
+
+    NetSnapshotsImpl::ConnectionState& NetSnapshotsImpl::PeerData::getConnection(PeerIndex remotePeer)
+    {
+        if (remotePeer >= m_connections.size())
+        {
+            m_connections.resize(remotePeer + 1);
+        }
+        return m_connections[remotePeer];
     }
 
     void NetSnapshotsImpl::PeerData::advanceToFrame(uint32_t frame)
@@ -222,83 +437,307 @@ namespace nau
 
     void NetSnapshotsImpl::PeerData::purgeFrames(uint32_t oldFrame)
     {
-        for (auto it = m_frames.cbegin(); it != m_frames.cend();)
+        const auto eraseOldFrames = [](eastl::map<uint32_t, FrameSnapshot>& frames, uint32_t oldFrame)
+        {
+            frames.erase(frames.begin(), frames.upper_bound(oldFrame));
+        };
+
+        eraseOldFrames(m_frames, oldFrame);
+        for (auto& connection : m_connections)
+        {
+            eraseOldFrames(connection.m_sentFrames, oldFrame);
+        }
+
+        // received frames are numbered by the remote peer
+        if (m_lastReceivedFrame && *m_lastReceivedFrame >= MaxBaselineAge)
+        {
+            eraseOldFrames(m_receivedFrames, *m_lastReceivedFrame - MaxBaselineAge);
+        }
+    }
+
+    void NetSnapshotsImpl::serializeFrame(const PeerData& peer, uint32_t frame, eastl::string& str) const
+    {
+        auto current = peer.m_frames.find(frame);
+        if (current == peer.m_frames.end())
+        {
+            return;
+        }
+
+        WireFrame wireFrame;
+        wireFrame.m_frame = frame;
+        wireFrame.m_time = current->second.m_time;
+        for (ComponentIndex index = 0; index < current->second.m_components.size(); ++index)
+        {
+            if (const auto& componentData = current->second.m_components[index])
+            {
+                wireFrame.m_definitions.push_back(makeDefinition(index));
+                wireFrame.m_components.push_back({index, *componentData});
+            }
+        }
+
+        const BytesBuffer buffer = serialization::binarySerialize(wireFrame);
+        str.assign(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+    }
+
+    size_t NetSnapshotsImpl::serializeConnectionFrame(PeerData& peer, uint32_t frame, PeerIndex remotePeer, std::optional<uint32_t> ackFrame, eastl::string& str)
+    {
+        auto current = peer.m_frames.find(frame);
+        if (current == peer.m_frames.end())
+        {
+            return 0;
+        }
+
+        ConnectionState& connection = peer.getConnection(remotePeer);
+
+        // delta against the remote peer state at the last acknowledged frame, full frame if there is no such frame (yet or anymore)
+        const FrameSnapshot* baseFrame = nullptr;
+        if (connection.m_ackedFrame)
+        {
+            if (auto acked = connection.m_sentFrames.find(*connection.m_ackedFrame); acked != connection.m_sentFrames.end())
+            {
+                baseFrame = &acked->second;
+            }
+        }
+
+        struct Candidate
+        {
+            ComponentIndex index;
+            const ComponentData* data;
+            float priority;
+            // the remote peer does not know the component yet: the names are sent with it
+            bool isDefined;
+        };
+
+        const auto& components = current->second.m_components;
+        if (connection.m_priorities.size() < components.size())
+        {
+            connection.m_priorities.resize(components.size(), 0.f);
+        }
+
+        eastl::vector<Candidate> candidates;
+        for (ComponentIndex index = 0; index < components.size(); ++index)
+        {
+            if (!components[index])
+            {
+                continue;
+            }
+            const ComponentData& componentData = *components[index];
+
+            const ComponentData* baseComponent = baseFrame ? baseFrame->findComponent(index) : nullptr;
+            if (baseComponent && *baseComponent == componentData)
+            {
+                continue;
+            }
+
+            if (!connection.isRelevant(componentData.m_relevancy))
+            {
+                continue;
+            }
+
+            float& priority = connection.m_priorities[index];
+            priority += componentData.m_relevancy.priority;
+            candidates.push_back({index, &componentData, priority, baseComponent != nullptr});
+        }
+
+        eastl::sort(candidates.begin(), candidates.end(), [](const Candidate& left, const Candidate& right)
+        {
+            return left.priority > right.priority;
+        });
+
+        WireFrame wireFrame;
+        wireFrame.m_frame = frame;
+        wireFrame.m_time = current->second.m_time;
+        wireFrame.m_ackFrame = ackFrame;
+        FrameSnapshot sentFrame = baseFrame ? *baseFrame : FrameSnapshot{};
+        sentFrame.m_frame = frame;
+        if (baseFrame)
         {
-            if (it->first <= oldFrame)
+            wireFrame.m_baseFrame = baseFrame->m_frame;
+        }
+
+        // the components that do not fit into the budget keep the accumulated priority for the next frames
+        const size_t budget = connection.m_interest.bandwidthBudget;
+        size_t usedBudget = 0;
+        for (const Candidate& candidate : candidates)
+        {
+            const ComponentEntry& entry = m_components[candidate.index];
+            const size_t definitionSize = candidate.isDefined ? 0 : m_scenes[entry.m_scene].m_name.size() + entry.m_path.size();
+            const size_t size = sizeof(ComponentIndex) + definitionSize + candidate.data->m_data.size();
+            if (budget > 0 && usedBudget > 0 && usedBudget + size > budget)
             {
-                it = m_frames.erase(it);
+                continue;
             }
-            else
+            usedBudget += size;
+
+            if (!candidate.isDefined)
             {
-                ++it;
+                wireFrame.m_definitions.push_back(makeDefinition(candidate.index));
             }
+            wireFrame.m_components.push_back({candidate.index, *candidate.data});
+            sentFrame.getComponent(candidate.index) = *candidate.data;
+            connection.m_priorities[candidate.index] = 0.f;
+            m_statistics.onComponentSent(entry.m_typeIndex, candidate.data->m_data.size());
         }
+
+        connection.m_sentFrames[frame] = std::move(sentFrame);
+
+        const BytesBuffer buffer = serialization::binarySerialize(wireFrame);
+        str.assign(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+        return wireFrame.m_components.size();
     }
 
-    void NetSnapshotsImpl::PeerData::serializeFrame(uint32_t frame, eastl::string& str)
+    bool NetSnapshotsImpl::ConnectionState::isRelevant(const NetRelevancy& relevancy) const
     {
-        if (m_frames.count(frame) > 0)
+        if (relevancy.alwaysRelevant)
+        {
+            return true;
+        }
+
+        if ((relevancy.visibilityGroups & m_interest.visibilityGroups) == 0)
+        {
+            return false;
+        }
+
+        if (relevancy.relevancyDistance > 0.f && m_interest.viewPosition)
         {
-            auto& f = m_frames[frame];
-            io::InplaceStringWriter<char> writer{str};
-            serialization::JsonSettings settings;
-            serialization::jsonWrite(writer, makeValueRef(f, getDefaultAllocator()), settings).ignore();
+            const float distanceSqr = static_cast<float>(math::lengthSqr(relevancy.position - *m_interest.viewPosition));
+            return distanceSqr <= relevancy.relevancyDistance * relevancy.relevancyDistance;
         }
+
+        return true;
     }
 
-    void NetSnapshotsImpl::PeerData::deserializeFrame(const eastl::string& str)
+    bool NetSnapshotsImpl::PeerData::receiveFrame(WireFrame&& wireFrame)
     {
-        FrameSnapshot frameSnapshot;
-        auto res = serialization::JsonUtils::parse(frameSnapshot, str.c_str());
-        if (res.isSuccess())
+        // the definitions are valid for any frame of the peer (the remote component indices are not reused)
+        for (ComponentDefinition& definition : wireFrame.m_definitions)
+        {
+            if (definition.m_index >= m_remoteComponents.size())
+            {
+                m_remoteComponents.resize(definition.m_index + 1);
+            }
+            RemoteComponent& remoteComponent = m_remoteComponents[definition.m_index];
+            if (!remoteComponent.m_isDefined)
+            {
+                remoteComponent.m_isDefined = true;
+                remoteComponent.m_sceneName = std::move(definition.m_sceneName);
+                remoteComponent.m_componentPath = std::move(definition.m_componentPath);
+            }
+        }
+
+        const uint32_t frame = wireFrame.m_frame;
+        if (m_lastReceivedFrame && frame <= *m_lastReceivedFrame)
+        {
+            return false;
+        }
+
+        FrameSnapshot fullFrame;
+        if (wireFrame.m_baseFrame)
+        {
+            auto base = m_receivedFrames.find(*wireFrame.m_baseFrame);
+            if (base == m_receivedFrames.end())
+            {
+                // the frame is not acknowledged: the sender falls back to the older baseline or to the full frame
+                NAU_LOG_DEBUG("Net snapshot baseline ({}) is missing", *wireFrame.m_baseFrame);
+                return false;
+            }
+            fullFrame = base->second;
+        }
+
+        for (WireComponent& component : wireFrame.m_components)
         {
-            m_frames.emplace(frameSnapshot.m_frame, frameSnapshot);
+            if (component.m_index >= m_remoteComponents.size() || !m_remoteComponents[component.m_index].m_isDefined)
+            {
+                NAU_LOG_WARNING("Net snapshot component ({}) is not defined", component.m_index);
+                continue;
+            }
+            fullFrame.getComponent(component.m_index) = std::move(component.m_data);
         }
+
+        fullFrame.m_frame = frame;
+        fullFrame.m_time = wireFrame.m_time;
+        m_receivedFrames[frame] = std::move(fullFrame);
+        m_lastReceivedFrame = frame;
+        return true;
     }
 
-    void NetSnapshotsImpl::PeerData::writeComponent(const eastl::string& sceneName, IComponentNetSync* component)
+    void NetSnapshotsImpl::PeerData::updatePlayoutClock(double remoteTime, double localTime)
     {
-        if (m_peerScenes.count(sceneName) == 0)
+        // the offset follows the earliest arrivals (and slowly drifts to the later ones to follow the clock drift and the route changes)
+        constexpr double OffsetAdaptation = 0.01;
+        constexpr double JitterSmoothing = 1.0 / 16.0;
+
+        const double offset = localTime - remoteTime;
+        if (!m_clockOffset || offset < *m_clockOffset)
         {
-            NAU_LOG_ERROR("Net writeComponent - no scene for component");
-            return;
+            m_clockOffset = offset;
         }
-        auto& frame = m_frames[m_currentFrame];
-        frame.writeComponent(sceneName, component);
+        else
+        {
+            *m_clockOffset += (offset - *m_clockOffset) * OffsetAdaptation;
+        }
+        m_jitter += (offset - *m_clockOffset - m_jitter) * JitterSmoothing;
+    }
+
+    double NetSnapshotsImpl::PeerData::getPlaybackTime(double localTime, const NetInterpolationSettings& settings) const
+    {
+        NAU_ASSERT(m_clockOffset);
+        const double delay = eastl::min(static_cast<double>(settings.interpolationDelay) + settings.jitterScale * m_jitter, static_cast<double>(settings.maxDelay));
+        return localTime - *m_clockOffset - delay;
     }
 
-    NetSnapshotsImpl::ComponentData::ComponentData(IComponentNetSync* component)
+    void NetSnapshotsImpl::PeerData::writeComponent(ComponentIndex index, IComponentNetSync* component)
     {
-        component->netWrite(m_data);
+        std::optional<ComponentData>& componentData = m_frames[m_currentFrame].getComponent(index);
+        if (componentData)
+        {
+            NAU_LOG_ERROR("Net writeComponent must be called once per frame");
+            return;
+        }
+        componentData.emplace(component);
     }
 
-    void NetSnapshotsImpl::FrameSnapshot::writeComponent(const eastl::string& sceneName, IComponentNetSync* component)
+    NetSnapshotsImpl::ComponentData::ComponentData(IComponentNetSync* component) :
+        m_relevancy(component->getNetRelevancy())
     {
-        if (m_scenes.count(sceneName) == 0)
+        BytesBuffer buffer;
+        component->netWrite(buffer);
+        if (buffer.size() > 0)
+        {
+            m_data.assign(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+            m_isBinary = true;
+        }
+        else
         {
-            m_scenes.emplace(sceneName, SceneSnapshot());
+            component->netWrite(m_data);
         }
-        auto& sceneSnapshot = m_scenes[sceneName];
-        sceneSnapshot.writeComponent(component);
     }
 
-    void NetSnapshotsImpl::SceneSnapshot::writeComponent(IComponentNetSync* component)
+    bool NetSnapshotsImpl::ComponentData::readBufferedTo(IComponentNetSync* component, double remoteTime) const
     {
-        if (m_components.count(component->getComponentPath().data()) != 0)
+        if (m_isBinary)
         {
-            NAU_LOG_ERROR("Net writeComponent must be called once per frame");
-            return;
+            BytesBuffer buffer{m_data.size()};
+            std::memcpy(buffer.data(), m_data.data(), m_data.size());
+            return component->netReadBuffered(buffer, remoteTime);
         }
-        m_components.emplace(component->getComponentPath().data(), ComponentData(component));
+
+        component->netRead(m_data);
+        return false;
     }
 
-    NetSnapshotsImpl::PeerData* NetSnapshotsImpl::getPeer(const eastl::string& sceneName)
+    void NetSnapshotsImpl::ComponentData::readTo(IComponentNetSync* component) const
     {
-        if (m_sceneToPeer.count(sceneName) == 0)
+        if (m_isBinary)
         {
-            NAU_LOG_ERROR("Missing scene while trying getPeer");
-            return nullptr;
+            BytesBuffer buffer{m_data.size()};
+            std::memcpy(buffer.data(), m_data.data(), m_data.size());
+            component->netRead(buffer);
+        }
+        else
+        {
+            component->netRead(m_data);
         }
-        return m_sceneToPeer[sceneName];
     }
+
 }  // namespace nau
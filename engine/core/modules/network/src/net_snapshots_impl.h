@@ -4,14 +4,26 @@
 
 #pragma once
 
+#include <EASTL/deque.h>
 #include <EASTL/map.h>
 #include <EASTL/string.h>
+#include <EASTL/unordered_map.h>
+#include <EASTL/vector.h>
+
+#include <chrono>
+#include <optional>
 
 #include "nau/network/netsync/net_snapshots.h"
 #include "nau/rtti/rtti_impl.h"
 #include "nau/rtti/rtti_object.h"
 #include "nau/rtti/type_info.h"
 #include "nau/service/service.h"
+#include "net_statistics_impl.h"
+
+namespace nau::test
+{
+    class TestNetSnapshots;
+}  // namespace nau::test
 
 namespace nau
 {
@@ -26,15 +38,19 @@ namespace nau
         void onSceneActivated(IComponentNetScene* scene) override;
         void onSceneDectivated(IComponentNetScene* scene) override;
         void onSceneUpdated(IComponentNetScene* scene) override;
+        void setPeerInterest(eastl::string_view peerId, eastl::string_view remotePeerId, const NetPeerInterest& interest) override;
         void setOnSceneMissing(nau::Functor<void(eastl::string_view peerId, eastl::string_view sceneName)> callback) override;
+        void setSendRate(float sendRate) override;
+        void setInterpolationSettings(const NetInterpolationSettings& settings) override;
 
         void onComponentActivated(IComponentNetSync* component) override;
         void onComponentDeactivated(IComponentNetSync* component) override;
         void onComponentWrite(IComponentNetSync* component) override;
 
         void nextFrame() override;
-        void applyPeerUpdates();
-        void applyFrameUpdate(const eastl::string& peerId, uint32_t frame);
+        void applyPeerUpdates() override;
+
+        INetStatistics& getStatistics() override;
 
         // Debug
         void applyPeerUpdatesLocal(const char* srcPeerId, const char* dstPeerId);
@@ -42,69 +58,227 @@ namespace nau
         bool doSelfTest() override;
 
     private:
+        // Compact indices assigned on registration: the snapshot storage is the dense arrays indexed by them,
+        // the names are kept for the handshake with the remote peers (see ComponentDefinition) and for debugging
+        using Clock = std::chrono::steady_clock;
+
+        using PeerIndex = uint32_t;
+        using SceneIndex = uint32_t;
+        using ComponentIndex = uint32_t;
+        static constexpr uint32_t InvalidIndex = ~0u;
+
         // Seriazable
         struct ComponentData
         {
             NAU_CLASS_FIELDS(
-                CLASS_FIELD(m_data))
+                CLASS_FIELD(m_data),
+                CLASS_FIELD(m_isBinary))
 
             ComponentData() = default;
             ComponentData(IComponentNetSync* component);
+            void readTo(IComponentNetSync* component) const;
+            // Returns true if the component buffered the state to interpolate it
+            bool readBufferedTo(IComponentNetSync* component, double remoteTime) const;
+
+            bool operator==(const ComponentData& other) const
+            {
+                return m_isBinary == other.m_isBinary && m_data == other.m_data;
+            }
+
             eastl::string m_data;
+            // Not serialized: used by the sender to select the components for each peer
+            NetRelevancy m_relevancy;
+            // Data written by the binary netWrite (text netWrite is used only for the components that do not provide the binary data)
+            bool m_isBinary = false;
+        };
+
+        // Seriazable: the names of the sender component index, sent until the remote peer has the component in the acknowledged frame
+        struct ComponentDefinition
+        {
+            NAU_CLASS_FIELDS(
+                CLASS_FIELD(m_index),
+                CLASS_FIELD(m_sceneName),
+                CLASS_FIELD(m_componentPath))
+
+            ComponentIndex m_index = 0;
+            eastl::string m_sceneName;
+            eastl::string m_componentPath;
         };
 
         // Seriazable
-        struct SceneSnapshot
+        struct WireComponent
         {
             NAU_CLASS_FIELDS(
-                CLASS_FIELD(m_components))
+                CLASS_FIELD(m_index),
+                CLASS_FIELD(m_data))
 
-            eastl::map<eastl::string, ComponentData> m_components;
-            void writeComponent(IComponentNetSync* component);
+            ComponentIndex m_index = 0;
+            ComponentData m_data;
         };
 
         // Seriazable
-        struct FrameSnapshot
+        struct WireFrame
         {
             NAU_CLASS_FIELDS(
                 CLASS_FIELD(m_frame),
-                CLASS_FIELD(m_scenes))
+                CLASS_FIELD(m_time),
+                CLASS_FIELD(m_baseFrame),
+                CLASS_FIELD(m_ackFrame),
+                CLASS_FIELD(m_definitions),
+                CLASS_FIELD(m_components))
+
+            uint32_t m_frame = 0;
+            // Send time (in seconds, by the sender clock): the receiver presents the interpolated components by it
+            double m_time = 0.0;
+            // Delta snapshot: only the components changed since the base frame are written
+            std::optional<uint32_t> m_baseFrame;
+            // The last frame received from the destination peer
+            std::optional<uint32_t> m_ackFrame;
+            eastl::vector<ComponentDefinition> m_definitions;
+            eastl::vector<WireComponent> m_components;
+        };
 
+        // Local: the components of the frame by the component index (of the peer that writes the frame)
+        struct FrameSnapshot
+        {
             FrameSnapshot() = default;
 
             FrameSnapshot(uint32_t frame) :
                 m_frame(frame)
             {
             }
+
+            const ComponentData* findComponent(ComponentIndex index) const
+            {
+                return index < m_components.size() && m_components[index] ? &*m_components[index] : nullptr;
+            }
+
+            std::optional<ComponentData>& getComponent(ComponentIndex index)
+            {
+                if (index >= m_components.size())
+                {
+                    m_components.resize(index + 1);
+                }
+                return m_components[index];
+            }
+
             uint32_t m_frame = 0;
-            eastl::map<eastl::string, SceneSnapshot> m_scenes;
-            void writeComponent(const eastl::string& sceneName, IComponentNetSync* component);
+            double m_time = 0.0;
+            eastl::vector<std::optional<ComponentData>> m_components;
+        };
+
+        struct SceneEntry
+        {
+            eastl::string m_name;
+            PeerIndex m_peer = InvalidIndex;
+            IComponentNetScene* m_scene = nullptr;
+            eastl::unordered_map<eastl::string, ComponentIndex> m_componentIndices;
+        };
+
+        struct ComponentEntry
+        {
+            SceneIndex m_scene = InvalidIndex;
+            eastl::string m_path;
+            // Component type of the statistics
+            uint32_t m_typeIndex = 0;
+        };
+
+        // Remote peer component (by the remote component index) resolved to the local replica
+        struct RemoteComponent
+        {
+            bool m_isDefined = false;
+            eastl::string m_sceneName;
+            eastl::string m_componentPath;
+            IComponentNetSync* m_component = nullptr;
+            // Component type of the statistics, known when the replica is resolved
+            uint32_t m_typeIndex = 0;
+            // The replica buffers the received states: it gets every frame state and is presented by netInterpolate
+            bool m_isInterpolated = false;
+        };
+
+        // Local, not serializable: replication state of the local peer frames to the single remote peer
+        struct ConnectionState
+        {
+            NetPeerInterest m_interest;
+            std::optional<uint32_t> m_ackedFrame;
+            // The remote peer state after each sent frame: the baselines for the delta snapshots
+            eastl::map<uint32_t, FrameSnapshot> m_sentFrames;
+            // Priorities accumulated by the changed components that are not sent yet (by the component index)
+            eastl::vector<float> m_priorities;
+
+            bool isRelevant(const NetRelevancy& relevancy) const;
         };
 
         // Local, not serializable
         struct PeerData
         {
-            uint32_t m_currentFrame;
-            eastl::map<eastl::string, IComponentNetScene*> m_peerScenes;
+            eastl::string m_name;
+            uint32_t m_currentFrame = 0;
+            // Scenes of the peer by the name
+            eastl::unordered_map<eastl::string, SceneIndex> m_sceneIndices;
             eastl::map<uint32_t, FrameSnapshot> m_frames;
 
-            void activateScene(IComponentNetScene* scene);
-            void deactivateScene(IComponentNetScene* scene);
+            // Local peer: replication state for each connected peer (by the peer index)
+            eastl::vector<ConnectionState> m_connections;
+
+            // Remote peer: the full (reconstructed from the deltas) received frames
+            eastl::map<uint32_t, FrameSnapshot> m_receivedFrames;
+            std::optional<uint32_t> m_lastReceivedFrame;
+            std::optional<uint32_t> m_appliedFrame;
+            eastl::vector<RemoteComponent> m_remoteComponents;
+            // Remote peer: local time minus the remote time of the earliest arriving frames, the later arrival is the jitter
+            std::optional<double> m_clockOffset;
+            double m_jitter = 0.0;
 
-            void writeComponent(const eastl::string& sceneName, IComponentNetSync* component);
+            ConnectionState& getConnection(PeerIndex remotePeer);
+
+            void updatePlayoutClock(double remoteTime, double localTime);
+            double getPlaybackTime(double localTime, const NetInterpolationSettings& settings) const;
+
+            void writeComponent(ComponentIndex index, IComponentNetSync* component);
 
             void advanceToFrame(uint32_t frame);
             void purgeFrames(uint32_t frame);
 
-            void serializeFrame(uint32_t frame, eastl::string& str);
-            void deserializeFrame(const eastl::string& str);
+            bool receiveFrame(WireFrame&& wireFrame);
         };
 
-        PeerData* getPeer(const eastl::string& sceneName);
+        // The count of the frames kept to be the baselines for the delta snapshots
+        static constexpr uint32_t MaxBaselineAge = 32;
+
+        double getLocalTime() const;
+
+        PeerIndex registerPeer(eastl::string_view peerId);
+        ComponentIndex registerComponent(SceneIndex scene, eastl::string_view componentPath);
+        ComponentIndex findComponentIndex(IComponentNetSync* component);
+        void clearState();
+
+        void applyFrameUpdate(PeerIndex peerIndex, uint32_t frame);
+        ComponentDefinition makeDefinition(ComponentIndex index) const;
+        void serializeFrame(const PeerData& peer, uint32_t frame, eastl::string& str) const;
+        // Returns the count of the components written to the frame
+        size_t serializeConnectionFrame(PeerData& peer, uint32_t frame, PeerIndex remotePeer, std::optional<uint32_t> ackFrame, eastl::string& str);
 
         uint32_t m_frame = 0;
-        eastl::map<eastl::string, PeerData> m_peers;
-        eastl::map<eastl::string, PeerData*> m_sceneToPeer;
+
+        const Clock::time_point m_startTime = Clock::now();
+        Clock::duration m_sendInterval{0};
+        Clock::time_point m_nextSendTime;
+        NetInterpolationSettings m_interpolation;
+
+        // deque: the peer references are kept while the new peers are registered
+        eastl::deque<PeerData> m_peers;
+        eastl::unordered_map<eastl::string, PeerIndex> m_peerIndices;
+        eastl::vector<SceneEntry> m_scenes;
+        // The scene of the component by the scene name (the first activated one)
+        eastl::unordered_map<eastl::string, SceneIndex> m_sceneIndices;
+        eastl::vector<ComponentEntry> m_components;
+        eastl::unordered_map<IComponentNetSync*, ComponentIndex> m_componentIndexByPtr;
+
         nau::Functor<void(eastl::string_view peerId, eastl::string_view sceneName)> m_onSceneMissing;
+
+        NetStatisticsImpl m_statistics;
+
+        friend class test::TestNetSnapshots;
     };
-}  // namespace nau
\ No newline at end of file
+}  // namespace nau
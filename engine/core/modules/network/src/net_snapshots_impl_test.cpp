@@ -4,8 +4,12 @@
 
 #include "net_snapshots_impl.h"
 
+#include <chrono>
+#include <thread>
+
 #include "nau/diag/logging.h"
 #include "nau/network/napi/networking_factory.h"
+#include "nau/serialization/binary_serialization.h"
 #include "nau/serialization/json.h"
 #include "nau/serialization/json_utils.h"
 #include "nau/service/service_provider.h"
@@ -95,20 +99,19 @@ namespace nau
             const char* m_sceneName;
         };
 
-        m_peers.clear();
+        clearState();
         const char* peerName = "Peer1";
         const char* sceneName = "Scene1";
         const char* componentPath = "root/c1";
-        auto res1 = m_peers.emplace(peerName, PeerData());
-        auto& peer1 = (*res1.first).second;
-        peer1.advanceToFrame(1);
         TestSceneComponent tsc1(peerName, sceneName);
-        peer1.activateScene(&tsc1);
+        onSceneActivated(&tsc1);
+        auto& peer1 = m_peers[m_peerIndices[peerName]];
+        peer1.advanceToFrame(1);
         TestSyncComponent tsyc1(componentPath, sceneName);
-        peer1.writeComponent(sceneName, &tsyc1);
+        onComponentWrite(&tsyc1);
 
         eastl::string frameBuffer;
-        peer1.serializeFrame(1, frameBuffer);
+        serializeFrame(peer1, 1, frameBuffer);
 
         //
         eastl::unique_ptr<INetworking> networking;
@@ -143,28 +146,43 @@ namespace nau
         {
         });
 
-        networking->update();
+        // the sockets are served by the I/O thread: the results are waited for (with the limit)
+        constexpr int MaxUpdates = 1000;
+        for (int i = 0; i < MaxUpdates && !(transportIncoming && transportOutgoing); ++i)
+        {
+            networking->update();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        if (!transportIncoming || !transportOutgoing)
+        {
+            clearState();
+            return false;
+        }
 
         transportOutgoing->write(NetworkingMessage(frameBuffer));
-        networking->update();
 
         eastl::vector<nau::NetworkingMessage> messages;
-        transportIncoming->read(messages);
+        for (int i = 0; i < MaxUpdates && messages.empty(); ++i)
+        {
+            networking->update();
+            transportIncoming->read(messages);
+            if (messages.empty())
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
         if (messages.size() > 0)
         {
-            auto res2 = m_peers.emplace("Peer2", PeerData());
-            auto& peer2 = (*res2.first).second;
-
-            const char* ptr = (const char*)messages[0].buffer.data();
-            eastl::string incomingFrameBuffer(ptr, ptr + messages[0].buffer.size());
-
-            //
+            auto& peer2 = m_peers[registerPeer("Peer2")];
 
-            peer2.deserializeFrame(incomingFrameBuffer);
-            return peer2.m_frames.size() == peer1.m_frames.size();
+            WireFrame wireFrame;
+            const bool received = serialization::binaryDeserialize(eastl::span<const std::byte>{messages[0].buffer.data(), messages[0].buffer.size()}, wireFrame).isSuccess() && peer2.receiveFrame(std::move(wireFrame));
+            const bool isSameFrame = received && peer2.m_receivedFrames.size() == 1 && peer2.m_receivedFrames.begin()->second.m_components == peer1.m_frames[1].m_components;
+            clearState();
+            return isSameFrame;
         }
 
-        m_peers.clear();
+        clearState();
         return false;
     }
 }  // namespace nau
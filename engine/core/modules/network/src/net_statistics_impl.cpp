@@ -0,0 +1,382 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#include "net_statistics_impl.h"
+
+#include <EASTL/algorithm.h>
+
+#include "nau/io/file_system.h"
+
+namespace nau
+{
+    namespace
+    {
+        // The CSV is written by the chunks of this size
+        constexpr size_t CsvFlushSize = 64 * 1024;
+
+        // Smoothing factors of the round trip time and of the average timings
+        constexpr float RttSmoothing = 0.125f;
+        constexpr float TimeSmoothing = 0.05f;
+
+        float toMilliseconds(NetStatisticsImpl::Clock::duration duration)
+        {
+            return std::chrono::duration<float, std::milli>(duration).count();
+        }
+    }  // namespace
+
+    NetStatisticsImpl::~NetStatisticsImpl()
+    {
+        stopCsvExport();
+    }
+
+    void NetStatisticsImpl::setEnabled(bool enabled)
+    {
+        m_isEnabled = enabled;
+    }
+
+    bool NetStatisticsImpl::isEnabled() const
+    {
+        return m_isEnabled;
+    }
+
+    void NetStatisticsImpl::setPanelVisible(bool visible)
+    {
+        m_isPanelVisible = visible;
+    }
+
+    bool NetStatisticsImpl::isPanelVisible() const
+    {
+        return m_isPanelVisible;
+    }
+
+    void NetStatisticsImpl::getConnectionStatistics(eastl::vector<NetConnectionStatistics>& connections) const
+    {
+        connections.clear();
+        for (const auto& peerConnections : m_connections)
+        {
+            for (const std::optional<Connection>& connection : peerConnections)
+            {
+                if (connection)
+                {
+                    connections.push_back(connection->m_stats);
+                }
+            }
+        }
+    }
+
+    void NetStatisticsImpl::getComponentStatistics(eastl::vector<NetComponentTypeStatistics>& componentTypes) const
+    {
+        componentTypes = m_componentTypes;
+    }
+
+    NetTimingStatistics NetStatisticsImpl::getSerializeTime() const
+    {
+        return m_serializeTime;
+    }
+
+    NetTimingStatistics NetStatisticsImpl::getParseTime() const
+    {
+        return m_parseTime;
+    }
+
+    Result<> NetStatisticsImpl::startCsvExport(eastl::string_view filePath)
+    {
+        stopCsvExport();
+
+        const eastl::string path{filePath};
+        m_csvStream = io::createNativeFileStream(path.c_str(), io::AccessMode::Write, io::OpenFileMode::CreateAlways);
+        if (!m_csvStream)
+        {
+            return NauMakeError("Can not open the net statistics file ({})", path);
+        }
+
+        m_csvBuffer =
+            "frame,peer,remote_peer,bytes_sent,components_sent,bytes_received,frames_sent,frames_received,frames_lost,"
+            "rtt_ms,incoming_queue,outgoing_queue,serialize_us,parse_us\n";
+        m_isEnabled = true;
+
+        return ResultSuccess;
+    }
+
+    void NetStatisticsImpl::stopCsvExport()
+    {
+        if (m_csvStream)
+        {
+            flushCsv();
+            m_csvStream.reset();
+        }
+    }
+
+    void NetStatisticsImpl::reset()
+    {
+        for (auto& peerConnections : m_connections)
+        {
+            for (std::optional<Connection>& connection : peerConnections)
+            {
+                if (connection)
+                {
+                    NetConnectionStatistics& stats = connection->m_stats;
+                    stats = NetConnectionStatistics{eastl::move(stats.peerId), eastl::move(stats.remotePeerId)};
+                    connection->m_sentFrames.clear();
+                    connection->m_lastReceivedFrame.reset();
+                }
+            }
+        }
+
+        for (NetComponentTypeStatistics& componentType : m_componentTypes)
+        {
+            componentType = NetComponentTypeStatistics{eastl::move(componentType.typeName)};
+        }
+
+        m_serializeTime = {};
+        m_parseTime = {};
+    }
+
+    void NetStatisticsImpl::registerPeer(uint32_t peer, eastl::string_view peerId)
+    {
+        if (peer >= m_peerNames.size())
+        {
+            m_peerNames.resize(peer + 1);
+        }
+        m_peerNames[peer] = peerId;
+        m_peerIndices[m_peerNames[peer]] = peer;
+    }
+
+    uint32_t NetStatisticsImpl::registerComponentType(eastl::string_view typeName)
+    {
+        const eastl::string name = typeName.empty() ? eastl::string{"<unknown>"} : eastl::string{typeName};
+        auto [iter, emplaced] = m_componentTypeIndices.try_emplace(name, static_cast<uint32_t>(m_componentTypes.size()));
+        if (emplaced)
+        {
+            m_componentTypes.emplace_back().typeName = name;
+        }
+        return iter->second;
+    }
+
+    void NetStatisticsImpl::clearPeers()
+    {
+        m_peerNames.clear();
+        m_peerIndices.clear();
+        m_connections.clear();
+    }
+
+    void NetStatisticsImpl::onFrameSent(uint32_t peer, uint32_t remotePeer, uint32_t frame, size_t bytes, size_t componentCount)
+    {
+        if (!m_isEnabled)
+        {
+            return;
+        }
+
+        Connection& connection = getConnection(peer, remotePeer);
+        NetConnectionStatistics& stats = connection.m_stats;
+        ++stats.framesSent;
+        stats.bytesSent += bytes;
+        stats.componentsSent += componentCount;
+        stats.lastFrameBytesSent = static_cast<uint32_t>(bytes);
+        stats.lastFrameComponentsSent = static_cast<uint32_t>(componentCount);
+
+        if (connection.m_sentFrames.size() == MaxUnackedFrames)
+        {
+            connection.m_sentFrames.pop_front();
+        }
+        connection.m_sentFrames.emplace_back(frame, Clock::now());
+    }
+
+    void NetStatisticsImpl::onComponentSent(uint32_t componentType, size_t bytes)
+    {
+        if (!m_isEnabled || componentType >= m_componentTypes.size())
+        {
+            return;
+        }
+
+        NetComponentTypeStatistics& stats = m_componentTypes[componentType];
+        ++stats.componentsSent;
+        stats.bytesSent += bytes;
+    }
+
+    void NetStatisticsImpl::onFrameReceived(uint32_t peer, uint32_t remotePeer, uint32_t frame, size_t bytes, std::optional<uint32_t> ackFrame, bool isReceived)
+    {
+        if (!m_isEnabled)
+        {
+            return;
+        }
+
+        Connection& connection = getConnection(peer, remotePeer);
+        NetConnectionStatistics& stats = connection.m_stats;
+        stats.bytesReceived += bytes;
+        stats.lastFrameBytesReceived = static_cast<uint32_t>(bytes);
+
+        // each frame of the remote peer is sent: the skipped frame numbers are lost,
+        // the late (reordered) frame is not counted, it is already lost by the gap
+        if (!connection.m_lastReceivedFrame || frame > *connection.m_lastReceivedFrame)
+        {
+            if (connection.m_lastReceivedFrame)
+            {
+                stats.framesLost += frame - *connection.m_lastReceivedFrame - 1;
+            }
+            connection.m_lastReceivedFrame = frame;
+
+            if (isReceived)
+            {
+                ++stats.framesReceived;
+            }
+            else
+            {
+                ++stats.framesLost;
+            }
+        }
+
+        if (!ackFrame)
+        {
+            return;
+        }
+
+        // the same frame is acknowledged until the next one is received: only the first acknowledgement is measured
+        auto& sentFrames = connection.m_sentFrames;
+        while (!sentFrames.empty() && sentFrames.front().first < *ackFrame)
+        {
+            sentFrames.pop_front();
+        }
+        if (!sentFrames.empty() && sentFrames.front().first == *ackFrame)
+        {
+            const float rtt = toMilliseconds(Clock::now() - sentFrames.front().second);
+            stats.roundTripTime = stats.roundTripTime > 0.f ? stats.roundTripTime + (rtt - stats.roundTripTime) * RttSmoothing : rtt;
+            sentFrames.pop_front();
+        }
+    }
+
+    void NetStatisticsImpl::onComponentApplied(uint32_t componentType, size_t bytes)
+    {
+        if (!m_isEnabled || componentType >= m_componentTypes.size())
+        {
+            return;
+        }
+
+        NetComponentTypeStatistics& stats = m_componentTypes[componentType];
+        ++stats.componentsApplied;
+        stats.bytesApplied += bytes;
+    }
+
+    void NetStatisticsImpl::addSerializeTime(Clock::duration duration)
+    {
+        addTime(m_serializeTime, duration);
+    }
+
+    void NetStatisticsImpl::addParseTime(Clock::duration duration)
+    {
+        addTime(m_parseTime, duration);
+    }
+
+    void NetStatisticsImpl::addTime(NetTimingStatistics& timing, Clock::duration duration)
+    {
+        const float time = std::chrono::duration<float, std::micro>(duration).count();
+        timing.last = time;
+        timing.average = timing.average > 0.f ? timing.average + (time - timing.average) * TimeSmoothing : time;
+        timing.max = eastl::max(timing.max, time);
+    }
+
+    void NetStatisticsImpl::endFrame(uint32_t frame, INetConnector& connector)
+    {
+        if (!m_isEnabled)
+        {
+            return;
+        }
+
+        eastl::vector<eastl::weak_ptr<INetConnector::IConnection>> connections;
+        connector.getConnections(connections);
+        for (const auto& weakConnection : connections)
+        {
+            const auto connection = weakConnection.lock();
+            if (!connection)
+            {
+                continue;
+            }
+
+            const auto peer = m_peerIndices.find(connection->localPeerId());
+            const auto remotePeer = m_peerIndices.find(connection->remotePeerId());
+            if (peer == m_peerIndices.end() || remotePeer == m_peerIndices.end())
+            {
+                continue;
+            }
+
+            const NetworkingTransportStatistics transport = connection->transportStatistics();
+            NetConnectionStatistics& stats = getConnection(peer->second, remotePeer->second).m_stats;
+            stats.incomingQueueDepth = transport.incomingQueueDepth;
+            stats.outgoingQueueDepth = transport.outgoingQueueDepth;
+        }
+
+        if (m_csvStream)
+        {
+            writeCsvRows(frame);
+        }
+    }
+
+    NetStatisticsImpl::Connection& NetStatisticsImpl::getConnection(uint32_t peer, uint32_t remotePeer)
+    {
+        if (peer >= m_connections.size())
+        {
+            m_connections.resize(peer + 1);
+        }
+        auto& peerConnections = m_connections[peer];
+        if (remotePeer >= peerConnections.size())
+        {
+            peerConnections.resize(remotePeer + 1);
+        }
+
+        std::optional<Connection>& connection = peerConnections[remotePeer];
+        if (!connection)
+        {
+            connection.emplace();
+            connection->m_stats.peerId = peer < m_peerNames.size() ? m_peerNames[peer] : eastl::string{};
+            connection->m_stats.remotePeerId = remotePeer < m_peerNames.size() ? m_peerNames[remotePeer] : eastl::string{};
+        }
+        return *connection;
+    }
+
+    void NetStatisticsImpl::writeCsvRows(uint32_t frame)
+    {
+        for (const auto& peerConnections : m_connections)
+        {
+            for (const std::optional<Connection>& connection : peerConnections)
+            {
+                if (!connection)
+                {
+                    continue;
+                }
+
+                const NetConnectionStatistics& stats = connection->m_stats;
+                m_csvBuffer.append_sprintf("%u,%s,%s,%u,%u,%u,%llu,%llu,%llu,%.3f,%zu,%zu,%.1f,%.1f\n",
+                                           frame,
+                                           stats.peerId.c_str(),
+                                           stats.remotePeerId.c_str(),
+                                           stats.lastFrameBytesSent,
+                                           stats.lastFrameComponentsSent,
+                                           stats.lastFrameBytesReceived,
+                                           static_cast<unsigned long long>(stats.framesSent),
+                                           static_cast<unsigned long long>(stats.framesReceived),
+                                           static_cast<unsigned long long>(stats.framesLost),
+                                           stats.roundTripTime,
+                                           stats.incomingQueueDepth,
+                                           stats.outgoingQueueDepth,
+                                           m_serializeTime.last,
+                                           m_parseTime.last);
+            }
+        }
+
+        if (m_csvBuffer.size() >= CsvFlushSize)
+        {
+            flushCsv();
+        }
+    }
+
+    void NetStatisticsImpl::flushCsv()
+    {
+        if (!m_csvBuffer.empty())
+        {
+            // the statistics are diagnostics: a write error only loses the rows
+            [[maybe_unused]] const auto result = m_csvStream->write(reinterpret_cast<const std::byte*>(m_csvBuffer.data()), m_csvBuffer.size());
+            m_csvStream->flush();
+            m_csvBuffer.clear();
+        }
+    }
+}  // namespace nau
@@ -0,0 +1,97 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <EASTL/deque.h>
+#include <EASTL/string.h>
+#include <EASTL/unordered_map.h>
+#include <EASTL/vector.h>
+
+#include <chrono>
+#include <optional>
+
+#include "nau/io/stream.h"
+#include "nau/network/netsync/net_connector.h"
+#include "nau/network/netsync/net_statistics.h"
+
+namespace nau
+{
+    /**
+     * Collects the replication statistics of NetSnapshotsImpl. The peers and the component types are addressed by the indices
+     * assigned on registration (the registration is done regardless of the collection being enabled).
+     */
+    class NetStatisticsImpl final : public INetStatistics
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        ~NetStatisticsImpl();
+
+        void setEnabled(bool enabled) override;
+        bool isEnabled() const override;
+        void setPanelVisible(bool visible) override;
+        bool isPanelVisible() const override;
+
+        void getConnectionStatistics(eastl::vector<NetConnectionStatistics>& connections) const override;
+        void getComponentStatistics(eastl::vector<NetComponentTypeStatistics>& componentTypes) const override;
+        NetTimingStatistics getSerializeTime() const override;
+        NetTimingStatistics getParseTime() const override;
+
+        Result<> startCsvExport(eastl::string_view filePath) override;
+        void stopCsvExport() override;
+        void reset() override;
+
+        void registerPeer(uint32_t peer, eastl::string_view peerId);
+        uint32_t registerComponentType(eastl::string_view typeName);
+        // Drops the registered peers (the component types are kept)
+        void clearPeers();
+
+        void onFrameSent(uint32_t peer, uint32_t remotePeer, uint32_t frame, size_t bytes, size_t componentCount);
+        void onComponentSent(uint32_t componentType, size_t bytes);
+        // The frame that is not received by the peer (the baseline is missing) is counted as lost
+        void onFrameReceived(uint32_t peer, uint32_t remotePeer, uint32_t frame, size_t bytes, std::optional<uint32_t> ackFrame, bool isReceived);
+        void onComponentApplied(uint32_t componentType, size_t bytes);
+
+        void addSerializeTime(Clock::duration duration);
+        void addParseTime(Clock::duration duration);
+
+        // Samples the transport queues and writes the CSV rows of the frame
+        void endFrame(uint32_t frame, INetConnector& connector);
+
+    private:
+        struct Connection
+        {
+            NetConnectionStatistics m_stats;
+            // Send time of the frames that are not acknowledged yet (ordered by the frame)
+            eastl::deque<eastl::pair<uint32_t, Clock::time_point>> m_sentFrames;
+            std::optional<uint32_t> m_lastReceivedFrame;
+        };
+
+        static void addTime(NetTimingStatistics& timing, Clock::duration duration);
+
+        Connection& getConnection(uint32_t peer, uint32_t remotePeer);
+        void writeCsvRows(uint32_t frame);
+        void flushCsv();
+
+        // The count of the not acknowledged frames kept for the round trip time
+        static constexpr size_t MaxUnackedFrames = 64;
+
+        bool m_isEnabled = false;
+        bool m_isPanelVisible = false;
+
+        eastl::vector<eastl::string> m_peerNames;
+        eastl::unordered_map<eastl::string, uint32_t> m_peerIndices;
+        // [peer][remote peer]
+        eastl::vector<eastl::vector<std::optional<Connection>>> m_connections;
+
+        eastl::vector<NetComponentTypeStatistics> m_componentTypes;
+        eastl::unordered_map<eastl::string, uint32_t> m_componentTypeIndices;
+
+        NetTimingStatistics m_serializeTime;
+        NetTimingStatistics m_parseTime;
+
+        io::IStreamWriter::Ptr m_csvStream;
+        eastl::string m_csvBuffer;
+    };
+}  // namespace nau
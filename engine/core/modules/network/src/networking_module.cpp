@@ -1,10 +1,12 @@
 // Copyright 2024 N-GINN LLC. All rights reserved.
 // Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
 
+#include "instruments/net_statistics_ui_controller.h"
 #include "nau/app/main_loop/game_system.h"
 #include "nau/dispatch/class_descriptor.h"
 #include "nau/module/module.h"
 #include "nau/network/asio/networking_asio.h"
+#include "nau/network/gns/networking_gns.h"
 #include "nau/network/transportTest/networking_test.h"
 #include "nau/rtti/rtti_impl.h"
 #include "net_connector_impl.h"
@@ -28,8 +30,16 @@ namespace nau
 
         void gamePostUpdate([[maybe_unused]] std::chrono::milliseconds dt) override
         {
-            getServiceProvider().get<INetSnapshots>().nextFrame();
+            auto& snapshots = getServiceProvider().get<INetSnapshots>();
+            snapshots.nextFrame();
+
+            if (INetStatistics& statistics = snapshots.getStatistics(); statistics.isPanelVisible())
+            {
+                m_statisticsUi.drawGui(statistics);
+            }
         }
+
+        NetStatisticsImguiController m_statisticsUi;
     };
 
     /**
@@ -45,6 +55,9 @@ namespace nau
         {
             NetworkingFactoryImpl::Register("Test", NetworkingTest::create);
             NetworkingFactoryImpl::Register("ASIO", NetworkingASIO::create);
+#if NAU_NETWORK_GNS
+            NetworkingFactoryImpl::Register("GNS", NetworkingGNS::create);
+#endif
 
             NAU_MODULE_EXPORT_SERVICE(nau::NetworkingFactoryImpl);
             NAU_MODULE_EXPORT_SERVICE(nau::NetSnapshotsImpl);
@@ -0,0 +1,25 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#include "networking_uri.h"
+
+#include <uriparser/Uri.h>
+
+namespace nau
+{
+    bool parseURI(const eastl::string& uriStr, eastl::string& scheme, eastl::string& host, eastl::string& port)
+    {
+        UriUriA uri;
+        const char* errorPos;
+        // No need to call uriFreeUriMembersA if Failure
+        if (uriParseSingleUriA(&uri, uriStr.c_str(), &errorPos) == URI_SUCCESS)
+        {
+            scheme = eastl::string(uri.scheme.first, uri.scheme.afterLast);
+            host = eastl::string(uri.hostText.first, uri.hostText.afterLast);
+            port = eastl::string(uri.portText.first, uri.portText.afterLast);
+            uriFreeUriMembersA(&uri);
+            return true;
+        }
+        return false;
+    }
+}  // namespace nau
@@ -0,0 +1,20 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <EASTL/string.h>
+
+namespace nau
+{
+    /**
+     * @brief Splits the endpoint URI (i.e. tcp://127.0.0.1:9999/) into its parts, shared by the networking backends.
+     *
+     * @param [in]  uriStr URI to parse.
+     * @param [out] scheme URI scheme, i.e. "tcp" or "udp".
+     * @param [out] host   Host text, empty if the URI has no host.
+     * @param [out] port   Port text, empty if the URI has no port.
+     * @return false if the URI is malformed.
+     */
+    bool parseURI(const eastl::string& uriStr, eastl::string& scheme, eastl::string& host, eastl::string& port);
+}  // namespace nau
@@ -2,15 +2,322 @@
 // Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
 
 
-#include "nau/netsync/net_snapshots.h"
+#include "../src/net_snapshots_impl.h"
+#include "nau/network/components/net_sync_transform_component.h"
+#include "nau/serialization/binary_serialization.h"
 
 namespace nau
 {
     namespace test
     {
-        TEST(TestNetSnapshots, TestTemplate)
+        namespace
         {
-            ASSERT_TRUE(true);
+            class TestSceneComponent : public IComponentNetScene
+            {
+            public:
+                TestSceneComponent(const char* peerId, const char* sceneName) :
+                    m_peerId(peerId),
+                    m_sceneName(sceneName)
+                {
+                }
+
+                eastl::string_view getPeerId() override
+                {
+                    return m_peerId;
+                }
+
+                eastl::string_view getSceneName() override
+                {
+                    return m_sceneName;
+                }
+
+                IComponentNetSync* getOrCreateComponent(eastl::string_view, eastl::string_view) override
+                {
+                    return nullptr;
+                }
+
+                const char* m_peerId;
+                const char* m_sceneName;
+            };
+
+            class TestSyncComponent : public IComponentNetSync
+            {
+            public:
+                TestSyncComponent(const char* componentPath, const char* sceneName) :
+                    m_componentPath(componentPath),
+                    m_sceneName(sceneName)
+                {
+                }
+
+                eastl::string_view getSceneName() override
+                {
+                    return m_sceneName;
+                }
+
+                eastl::string_view getComponentPath() override
+                {
+                    return m_componentPath;
+                }
+
+                void setIsReplicated(bool) override
+                {
+                }
+
+                bool isReplicated() const override
+                {
+                    return false;
+                }
+
+                void netWrite(BytesBuffer&) override
+                {
+                }
+
+                void netRead(const BytesBuffer&) override
+                {
+                }
+
+                void netWrite(eastl::string& buffer) override
+                {
+                    buffer = m_value;
+                }
+
+                void netRead(const eastl::string& buffer) override
+                {
+                    m_value = buffer;
+                }
+
+                const char* m_componentPath;
+                const char* m_sceneName;
+                eastl::string m_value;
+            };
+        }  // namespace
+
+        /**
+            The server peer frames are written by one snapshots instance and received by the other one, the transport is replaced by the direct calls.
+         */
+        class TestNetSnapshots : public ::testing::Test
+        {
+        protected:
+            using WireFrame = NetSnapshotsImpl::WireFrame;
+            using FrameSnapshot = NetSnapshotsImpl::FrameSnapshot;
+
+            static constexpr uint32_t MaxBaselineAge = NetSnapshotsImpl::MaxBaselineAge;
+            static constexpr const char* ServerPeer = "Server";
+            static constexpr const char* ClientPeer = "Client";
+            static constexpr const char* SceneName = "Scene";
+
+            void SetUp() override
+            {
+                m_sender.onSceneActivated(&m_scene);
+                m_sender.registerPeer(ClientPeer);
+            }
+
+            // Writes the components to the current frame of the server and serializes it for the client (see NetSnapshotsImpl::nextFrame)
+            eastl::string sendFrame(std::initializer_list<TestSyncComponent*> components)
+            {
+                for (TestSyncComponent* component : components)
+                {
+                    m_sender.onComponentWrite(component);
+                }
+
+                eastl::string buffer;
+                m_sender.serializeConnectionFrame(getServer(), m_sender.m_frame, m_sender.m_peerIndices[ClientPeer], std::nullopt, buffer);
+                advanceFrame(m_sender);
+                return buffer;
+            }
+
+            bool receiveFrame(const eastl::string& buffer)
+            {
+                WireFrame wireFrame = parseFrame(buffer);
+                const bool isReceived = m_receiver.m_peers[m_receiver.registerPeer(ServerPeer)].receiveFrame(std::move(wireFrame));
+                advanceFrame(m_receiver);
+                return isReceived;
+            }
+
+            void acknowledge(uint32_t frame)
+            {
+                getServer().getConnection(m_sender.m_peerIndices[ClientPeer]).m_ackedFrame = frame;
+            }
+
+            static WireFrame parseFrame(const eastl::string& buffer)
+            {
+                WireFrame wireFrame;
+                const auto bytes = eastl::span<const std::byte>{reinterpret_cast<const std::byte*>(buffer.data()), buffer.size()};
+                const bool isParsed = serialization::binaryDeserialize(bytes, wireFrame).isSuccess();
+                EXPECT_TRUE(isParsed);
+                return wireFrame;
+            }
+
+            const FrameSnapshot* findSentFrame(uint32_t frame)
+            {
+                auto iter = getServer().m_frames.find(frame);
+                return iter != getServer().m_frames.end() ? &iter->second : nullptr;
+            }
+
+            const FrameSnapshot* findReceivedFrame(uint32_t frame)
+            {
+                auto& frames = m_receiver.m_peers[m_receiver.registerPeer(ServerPeer)].m_receivedFrames;
+                auto iter = frames.find(frame);
+                return iter != frames.end() ? &iter->second : nullptr;
+            }
+
+            size_t getReceivedFramesCount()
+            {
+                return m_receiver.m_peers[m_receiver.registerPeer(ServerPeer)].m_receivedFrames.size();
+            }
+
+            TestSceneComponent m_scene{ServerPeer, SceneName};
+            TestSyncComponent m_first{"root/first", SceneName};
+            TestSyncComponent m_second{"root/second", SceneName};
+
+            NetSnapshotsImpl m_sender;
+            NetSnapshotsImpl m_receiver;
+
+        private:
+            NetSnapshotsImpl::PeerData& getServer()
+            {
+                return m_sender.m_peers[m_sender.m_peerIndices[ServerPeer]];
+            }
+
+            static void advanceFrame(NetSnapshotsImpl& snapshots)
+            {
+                ++snapshots.m_frame;
+                const uint32_t oldFrame = snapshots.m_frame >= MaxBaselineAge ? snapshots.m_frame - MaxBaselineAge : 0;
+                for (auto& peer : snapshots.m_peers)
+                {
+                    peer.advanceToFrame(snapshots.m_frame);
+                    peer.purgeFrames(oldFrame);
+                }
+            }
+        };
+
+        /**
+            Test: the first frame is full, the next one has only the changed component and is reconstructed by the receiver to the full frame.
+         */
+        TEST_F(TestNetSnapshots, FullThenDeltaReconstruct)
+        {
+            m_first.m_value = "first:0";
+            m_second.m_value = "second:0";
+            const eastl::string fullBuffer = sendFrame({&m_first, &m_second});
+
+            const WireFrame fullFrame = parseFrame(fullBuffer);
+            ASSERT_FALSE(fullFrame.m_baseFrame);
+            ASSERT_EQ(fullFrame.m_components.size(), 2);
+            ASSERT_EQ(fullFrame.m_definitions.size(), 2);
+            ASSERT_TRUE(receiveFrame(fullBuffer));
+            acknowledge(0);
+
+            m_first.m_value = "first:1";
+            const eastl::string deltaBuffer = sendFrame({&m_first, &m_second});
+
+            const WireFrame deltaFrame = parseFrame(deltaBuffer);
+            ASSERT_EQ(deltaFrame.m_baseFrame, 0u);
+            ASSERT_EQ(deltaFrame.m_components.size(), 1);
+            ASSERT_TRUE(deltaFrame.m_definitions.empty());
+            ASSERT_TRUE(receiveFrame(deltaBuffer));
+
+            const FrameSnapshot* const sent = findSentFrame(1);
+            const FrameSnapshot* const received = findReceivedFrame(1);
+            ASSERT_TRUE(sent && received);
+            ASSERT_EQ(received->m_components, sent->m_components);
+        }
+
+        /**
+            Test: the delta of the baseline the receiver does not have is dropped,
+            the next delta is written against the last acknowledged frame and is reconstructed.
+         */
+        TEST_F(TestNetSnapshots, MissingBaselineDropAndFallback)
+        {
+            m_first.m_value = "first:0";
+            m_second.m_value = "second:0";
+            ASSERT_TRUE(receiveFrame(sendFrame({&m_first, &m_second})));
+            acknowledge(0);
+
+            // frame 1 is lost: it is not acknowledged
+            m_first.m_value = "first:1";
+            sendFrame({&m_first, &m_second});
+
+            m_second.m_value = "second:2";
+            const eastl::string fallbackBuffer = sendFrame({&m_first, &m_second});
+            const WireFrame fallbackFrame = parseFrame(fallbackBuffer);
+            ASSERT_EQ(fallbackFrame.m_baseFrame, 0u);
+            ASSERT_EQ(fallbackFrame.m_components.size(), 2);
+            ASSERT_TRUE(receiveFrame(fallbackBuffer));
+            ASSERT_EQ(findReceivedFrame(2)->m_components, findSentFrame(2)->m_components);
+
+            // the baseline that was never received
+            WireFrame unknownBase = parseFrame(fallbackBuffer);
+            unknownBase.m_frame = 3;
+            unknownBase.m_baseFrame = 1;
+            const BytesBuffer unknownBaseBytes = serialization::binarySerialize(unknownBase);
+            ASSERT_FALSE(receiveFrame(eastl::string{reinterpret_cast<const char*>(unknownBaseBytes.data()), unknownBaseBytes.size()}));
+            ASSERT_EQ(findReceivedFrame(3), nullptr);
+        }
+
+        /**
+            Test: the baselines older than MaxBaselineAge are purged on both sides, the sender falls back to the full frame.
+         */
+        TEST_F(TestNetSnapshots, BaselinePurgedPastMaxAge)
+        {
+            m_first.m_value = "first:0";
+            m_second.m_value = "second:0";
+            ASSERT_TRUE(receiveFrame(sendFrame({&m_first, &m_second})));
+            acknowledge(0);
+
+            // the acknowledgement is not updated (i.e. the client stopped acknowledging)
+            for (uint32_t frame = 1; frame <= MaxBaselineAge; ++frame)
+            {
+                m_first.m_value.sprintf("first:%u", frame);
+                const eastl::string buffer = sendFrame({&m_first, &m_second});
+                if (parseFrame(buffer).m_baseFrame)
+                {
+                    ASSERT_EQ(parseFrame(buffer).m_baseFrame, 0u);
+                }
+                ASSERT_TRUE(receiveFrame(buffer));
+            }
+
+            ASSERT_EQ(findReceivedFrame(0), nullptr);
+            ASSERT_LE(getReceivedFramesCount(), MaxBaselineAge + 1);
+
+            m_first.m_value = "first:last";
+            const eastl::string fullBuffer = sendFrame({&m_first, &m_second});
+            const WireFrame fullFrame = parseFrame(fullBuffer);
+            ASSERT_FALSE(fullFrame.m_baseFrame);
+            ASSERT_EQ(fullFrame.m_components.size(), 2);
+            ASSERT_TRUE(receiveFrame(fullBuffer));
+            ASSERT_EQ(findReceivedFrame(fullFrame.m_frame)->m_components, findSentFrame(fullFrame.m_frame)->m_components);
+        }
+
+        /**
+            Test: the quantized transform is restored within the quantization precision, the truncated data is rejected.
+         */
+        TEST_F(TestNetSnapshots, QuantizedTransformRoundTrip)
+        {
+            NetworkTransformQuantization quantization;
+            quantization.origin = math::vec3{10.f, 0.f, -10.f};
+
+            for (const math::vec3 scale : {math::vec3{2.f, 2.f, 2.f}, math::vec3{1.f, 0.5f, 3.f}})
+            {
+                NetworkTransformData source;
+                source.position = math::vec3{12.345f, -6.789f, 100.5f};
+                source.rotation = math::normalize(math::quat::rotationY(1.2f) * math::quat::rotationX(-0.4f));
+                source.scale = scale;
+
+                BytesBuffer buffer;
+                source.writeQuantized(buffer, quantization);
+
+                NetworkTransformData restored;
+                ASSERT_TRUE(restored.readQuantized(buffer, quantization));
+
+                const float positionError = static_cast<float>(math::length(restored.position - source.position));
+                ASSERT_LE(positionError, quantization.positionPrecision);
+                ASSERT_GE(std::abs(static_cast<float>(math::dot(restored.rotation, source.rotation))), 0.9999f);
+                ASSERT_TRUE(restored.scale == source.scale);
+
+                BytesBuffer truncated{buffer.size() - 1};
+                std::memcpy(truncated.data(), buffer.data(), truncated.size());
+                ASSERT_FALSE(NetworkTransformData{}.readQuantized(truncated, quantization));
+            }
         }
 
     }  // namespace test
@@ -42,6 +42,9 @@ namespace nau::physics
     public:
         /**
          * @brief Keeps the parent scene object transformation up to date with the transformation of the associated body in the physical world.
+         *
+         * When the interpolation is enabled, the presented transform moves from the previous physics pose to the last one
+         * over the physics step time, so the object moves smoothly at any display rate.
          */
         virtual void updateComponent(float dt) override;
 
@@ -87,6 +90,15 @@ namespace nau::physics
         void addImpulse(math::vec3 impulse);
         void addImpulse(math::vec3 impulse, math::vec3 applyPoint);
 
+        /**
+         * @brief Enables or disables the interpolation of the presented transform between the two last physics poses.
+         *
+         * The interpolation is enabled by default. It delays the presented transform by up to a physics step,
+         * disable it for the objects that must show the exact simulated pose.
+         */
+        void setInterpolationEnabled(bool enabled);
+        bool isInterpolationEnabled() const;
+
     private:
         // TODO: Collision info must not present directly within RigidBodyComponent,
         // but instead it should be within
@@ -95,6 +107,19 @@ namespace nau::physics
 
         void applyPhysicsBodyActions(IPhysicsBody* body);
 
+        /**
+         * @brief Receives the body pose after a physics step, called by the scene synchronization.
+         *
+         * @param [in] pose         World transform of the parent object at the end of the step.
+         * @param [in] stepTime     Duration of the step, the interpolation towards the pose lasts as long.
+         */
+        void setPhysicsPose(const math::Transform& pose, float stepTime);
+
+        /**
+         * @brief Drops the interpolation state, the next physics pose is presented as is.
+         */
+        void resetPhysicsPose();
+
         CollisionDescription m_collisions;
 
         AssetRef<> m_meshCollisionAsset;
@@ -112,6 +137,15 @@ namespace nau::physics
 
         PhysicsBodyActions m_pendingActions;
 
+        bool m_isInterpolationEnabled = true;
+        bool m_hasPhysicsPose = false;
+        bool m_isInterpolating = false;
+        math::Transform m_previousPose;
+        math::Transform m_currentPose;
+        math::Transform m_presentedPose;
+        float m_physicsStepTime = 0.0f;
+        float m_timeSincePhysicsPose = 0.0f;
+
         friend class PhysicsWorldState;
 
     };
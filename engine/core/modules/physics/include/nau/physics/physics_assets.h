@@ -3,10 +3,26 @@
 
 
 #pragma once
+#include <EASTL/string_view.h>
+
 #include "nau/assets/asset_view.h"
 
 namespace nau::physics
 {
+    /**
+     * @brief Suffix of the source path the cooked collision shapes of a mesh are registered under in the asset database.
+     *
+     * The asset tools cook the collision shapes of a mesh at build time into a single asset,
+     * registered with the source path of the mesh followed by this suffix.
+     */
+    inline constexpr eastl::string_view CookedCollisionSourcePathSuffix = "+[collision]";
+
+    /**
+     * @brief Content paths of the shapes within a cooked collision asset.
+     */
+    inline constexpr eastl::string_view CookedConvexHullContentPath = "hull";
+    inline constexpr eastl::string_view CookedTriMeshContentPath = "mesh";
+
     /**
      */
     struct NAU_ABSTRACT_TYPE TriMeshAssetView : IAssetView
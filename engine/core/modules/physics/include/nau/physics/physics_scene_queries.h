@@ -0,0 +1,151 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <EASTL/span.h>
+
+#include "nau/math/math.h"
+#include "nau/physics/physics_defines.h"
+#include "nau/utils/uid.h"
+
+
+namespace nau::physics
+{
+    /**
+     * @brief Geometry of the shape swept or overlapped by a batched scene query.
+     *
+     * The shape is described by value, so the queries do not create collision shape objects.
+     */
+    struct QueryShape
+    {
+        enum class Type
+        {
+            Sphere,
+            Box,
+            Capsule
+        };
+
+        Type type = Type::Sphere;
+
+        /**
+         * @brief Radius of the sphere or of the capsule caps.
+         */
+        TFloat radius = 0.5f;
+
+        /**
+         * @brief Half height of the capsule cylinder part (along the local Y axis).
+         */
+        TFloat halfHeight = 0.5f;
+
+        /**
+         * @brief Half size of the box.
+         */
+        math::vec3 halfExtent = math::vec3(0.5f, 0.5f, 0.5f);
+    };
+
+    /**
+     * @brief Encapsulates the settings of a shape sweep in a batch.
+     */
+    struct ShapeCastQuery
+    {
+        uint32_t id = 0;
+
+        QueryShape shape;
+
+        /**
+         * @brief World coordinates of the shape center at the sweep start.
+         */
+        math::vec3 origin;
+
+        /**
+         * @brief Orientation of the shape during the sweep.
+         */
+        math::quat rotation = math::quat::identity();
+
+        /**
+         * @brief Normalized direction of the sweep.
+         */
+        math::vec3 direction;
+
+        /**
+         * @brief Length of the sweep. It is expected to be finite.
+         */
+        TFloat maxDistance = 0;
+
+        /**
+         * @brief Channels the shape should hit, empty means any channel.
+         *
+         * The storage is owned by the caller and must outlive the query.
+         */
+        eastl::span<const CollisionChannel> reactChannels;
+
+        bool ignoreTriggers = false;
+    };
+
+    /**
+     * @brief Encapsulates the settings of a shape overlap test in a batch.
+     */
+    struct ShapeOverlapQuery
+    {
+        uint32_t id = 0;
+
+        QueryShape shape;
+
+        /**
+         * @brief World coordinates of the shape center.
+         */
+        math::vec3 origin;
+
+        math::quat rotation = math::quat::identity();
+
+        /**
+         * @brief Channels the shape should overlap, empty means any channel.
+         *
+         * The storage is owned by the caller and must outlive the query.
+         */
+        eastl::span<const CollisionChannel> reactChannels;
+
+        bool ignoreTriggers = false;
+    };
+
+    /**
+     * @brief Plain result of a batched scene query.
+     *
+     * Unlike RayCastResult it keeps no references, so it can be written from the worker threads
+     * into the caller buffers as is. Use @ref sceneObjectUid to look up the hit object.
+     */
+    struct SceneQueryHit
+    {
+        uint32_t queryId = 0;
+
+        Uid sceneObjectUid = NullUid;
+
+        /**
+         * @brief World coordinates of the hit (the contact point for the shape queries).
+         */
+        math::vec3 position;
+
+        /**
+         * @brief Normal to the hit surface, directed towards the query.
+         */
+        math::vec3 normal;
+
+        /**
+         * @brief Distance travelled before the hit for the casts, penetration depth for the overlaps.
+         */
+        TFloat distance = 0;
+
+        explicit operator bool() const
+        {
+            return sceneObjectUid != NullUid;
+        }
+
+        bool hasTarget() const
+        {
+            return static_cast<bool>(*this);
+        }
+    };
+
+}  // namespace nau::physics
@@ -5,12 +5,16 @@
 #pragma once
 
 #include <EASTL/optional.h>
+#include <EASTL/span.h>
+#include <EASTL/vector.h>
 
 #include "nau/debugRenderer/debug_render_system.h"
 #include "nau/memory/eastl_aliases.h"
 #include "nau/physics/physics_defines.h"
 #include "nau/physics/physics_material.h"
 #include "nau/physics/physics_raycast.h"
+#include "nau/physics/physics_scene_queries.h"
+#include "nau/physics/physics_world_snapshot.h"
 #include "nau/rtti/rtti_impl.h"
 #include "nau/scene/scene_object.h"
 
@@ -50,6 +54,18 @@ namespace nau::physics
          */
         virtual nau::Ptr<IPhysicsBody> createBody(Uid originSceneObjectUid, const PhysicsBodyCreationData& creationData) = 0;
 
+        /**
+         * @brief Creates physical bodies and places them in the physical world all at once.
+         *
+         * Prefer it over createBody() when many bodies appear together (e.g. on scene activation):
+         * the bodies are inserted into the broad phase as a single batch.
+         *
+         * @param [in] originSceneObjectUids    Scene objects' uids to attach the bodies to.
+         * @param [in] creationData             Physical properties of each body, of the same size as originSceneObjectUids.
+         * @return                              Pointers to the created bodies, in the order of creationData (null for the failed ones).
+         */
+        virtual eastl::vector<nau::Ptr<IPhysicsBody>> createBodies(eastl::span<const Uid> originSceneObjectUids, eastl::span<const PhysicsBodyCreationData> creationData) = 0;
+
         /**
          * @brief Allows or forbids contacts between to collision channels.
          *
@@ -105,6 +121,58 @@ namespace nau::physics
             co_return result.front();
         }
 
+        /**
+         * @brief Casts a batch of rays, splitting it across the worker threads.
+         *
+         * @param [in]  queries Rays to cast.
+         * @param [out] hits    Receives the closest hit of each query at the query index, it must be at least as long as @ref queries.
+         *                      The entries of the queries without a hit have no target.
+         *
+         * Blocks until the whole batch is processed. Nothing is allocated: the results are written into the caller buffer.
+         * Debug drawing settings of the queries are ignored.
+         */
+        virtual void castRays(eastl::span<const RayCastQuery> queries, eastl::span<SceneQueryHit> hits) const = 0;
+
+        /**
+         * @brief Sweeps a batch of shapes, splitting it across the worker threads.
+         *
+         * @param [in]  queries Shapes to sweep.
+         * @param [out] hits    Receives the closest hit of each query at the query index, it must be at least as long as @ref queries.
+         *                      The entries of the queries without a hit have no target.
+         */
+        virtual void castShapes(eastl::span<const ShapeCastQuery> queries, eastl::span<SceneQueryHit> hits) const = 0;
+
+        /**
+         * @brief Tests a batch of shapes for overlaps, splitting it across the worker threads.
+         *
+         * @param [in]  queries Shapes to test.
+         * @param [out] hits    Receives the overlapped bodies of all queries in no particular order, use SceneQueryHit::queryId to match them.
+         * @return              Number of the hits written. The overlaps that do not fit into @ref hits are dropped.
+         */
+        virtual size_t overlapShapes(eastl::span<const ShapeOverlapQuery> queries, eastl::span<SceneQueryHit> hits) const = 0;
+
+        /**
+         * @brief Captures the simulation state of the world, for example to rewind and resimulate a few frames on a network correction.
+         *
+         * @param [out] snapshot    Receives the state. Its previous content is replaced, its storage is reused.
+         * @param [in]  scope       Determines whether all bodies or only the awake ones are captured.
+         *
+         * Only the state modified by the simulation is captured: body properties like friction or motion quality are not.
+         * Must not be called while the world is ticking.
+         */
+        virtual void saveState(PhysicsWorldSnapshot& snapshot, PhysicsSnapshotScope scope = PhysicsSnapshotScope::AllBodies) const = 0;
+
+        /**
+         * @brief Brings the world back to a state captured by saveState().
+         *
+         * @param [in] snapshot State to restore. The captured bodies must still exist.
+         * @return              `false` if the snapshot could not be applied, the world state is undefined then.
+         *
+         * The restored bodies are synced to the scene on the next scene state synchronization.
+         * Must not be called while the world is ticking.
+         */
+        virtual bool restoreState(const PhysicsWorldSnapshot& snapshot) = 0;
+
         virtual void drawDebug(nau::DebugRenderSystem& dr) {};
 
         virtual void setGravity(const nau::math::vec3& gravity) = 0;
@@ -113,6 +181,15 @@ namespace nau::physics
 
         virtual void syncSceneState() = 0;
 
+        /**
+         * @brief Collects the bodies whose transforms may have changed since the previous call.
+         *
+         * @param [out] bodies  Receives the bodies that are awake and the bodies that have just fallen asleep. It is cleared first.
+         *
+         * Sleeping and static bodies are never reported, so the scene synchronization costs nothing for them.
+         */
+        virtual void collectMovedBodies(eastl::vector<IPhysicsBody*>& bodies) = 0;
+
         friend class PhysicsWorldState;
     };
 }  // namespace nau::physics
@@ -0,0 +1,72 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <EASTL/vector.h>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace nau::physics
+{
+    /**
+     * @brief Determines which bodies are captured by IPhysicsWorld::saveState.
+     */
+    enum class PhysicsSnapshotScope
+    {
+        /**
+         * @brief Captures every body of the world.
+         */
+        AllBodies,
+
+        /**
+         * @brief Captures the awake bodies only.
+         *
+         * Sleeping bodies do not move, so for a short rollback the delta is enough and much smaller.
+         * Restoring it leaves the bodies that were asleep at the capture untouched.
+         */
+        ActiveBodies
+    };
+
+    /**
+     * @brief Simulation state of a physics world captured by IPhysicsWorld::saveState.
+     *
+     * The content is opaque and only valid for the world it was captured from, with the same bodies.
+     * Keep the snapshots of a rollback window alive and reuse them: saving clears the buffers without releasing their storage,
+     * so once they have grown (or have been reserved) capturing a frame allocates nothing.
+     */
+    struct PhysicsWorldSnapshot
+    {
+        /**
+         * @brief Serialized state of the world, written by the physics backend.
+         */
+        eastl::vector<std::byte> data;
+
+        /**
+         * @brief Backend ids of the captured bodies, their transforms are synced to the scene after a restore.
+         */
+        eastl::vector<uint32_t> bodyIds;
+
+        PhysicsSnapshotScope scope = PhysicsSnapshotScope::AllBodies;
+
+        /**
+         * @brief Preallocates the snapshot storage.
+         *
+         * @param [in] dataSize     Expected size of the serialized state in bytes.
+         * @param [in] bodiesCount  Expected number of the captured bodies.
+         */
+        void reserve(size_t dataSize, size_t bodiesCount)
+        {
+            data.reserve(dataSize);
+            bodyIds.reserve(bodiesCount);
+        }
+
+        bool empty() const
+        {
+            return data.empty();
+        }
+    };
+}  // namespace nau::physics
@@ -10,8 +10,20 @@ namespace nau::physics
 {
     NAU_IMPLEMENT_DYNAMIC_OBJECT(RigidBodyComponent)
 
-    void RigidBodyComponent::updateComponent(float)
+    void RigidBodyComponent::updateComponent(float dt)
     {
+        if (!m_isInterpolating)
+        {
+            return;
+        }
+
+        m_timeSincePhysicsPose += dt;
+        const float alpha = std::min(m_timeSincePhysicsPose / m_physicsStepTime, 1.0f);
+
+        m_presentedPose = m_previousPose.slerpTransform(m_currentPose, alpha);
+        getParentObject().setWorldTransform(m_presentedPose);
+
+        m_isInterpolating = alpha < 1.0f;
     }
 
     void RigidBodyComponent::setCollisions(CollisionDescription collisions)
@@ -170,6 +182,47 @@ namespace nau::physics
         });
     }
 
+    void RigidBodyComponent::setInterpolationEnabled(bool enabled)
+    {
+        m_isInterpolationEnabled = enabled;
+        if (!enabled)
+        {
+            resetPhysicsPose();
+        }
+    }
+
+    bool RigidBodyComponent::isInterpolationEnabled() const
+    {
+        return m_isInterpolationEnabled;
+    }
+
+    void RigidBodyComponent::setPhysicsPose(const math::Transform& pose, float stepTime)
+    {
+        if (!m_isInterpolationEnabled || !m_hasPhysicsPose || stepTime <= 0.0f)
+        {
+            m_hasPhysicsPose = true;
+            m_isInterpolating = false;
+            m_currentPose = pose;
+            m_presentedPose = pose;
+            getParentObject().setWorldTransform(pose);
+            return;
+        }
+
+        // Starting from the presented pose (not from the previous physics pose) keeps the motion continuous
+        // when the step completes before the interpolation towards the previous pose has finished.
+        m_previousPose = m_presentedPose;
+        m_currentPose = pose;
+        m_physicsStepTime = stepTime;
+        m_timeSincePhysicsPose = 0.0f;
+        m_isInterpolating = true;
+    }
+
+    void RigidBodyComponent::resetPhysicsPose()
+    {
+        m_hasPhysicsPose = false;
+        m_isInterpolating = false;
+    }
+
     void RigidBodyComponent::applyPhysicsBodyActions(IPhysicsBody* body)
     {
         if (body)
@@ -13,6 +13,7 @@
 #include "nau/service/service.h"
 #include "nau/service/service_provider.h"
 #include "nau/threading/set_thread_name.h"
+#include "nau/utils/performance_profiling.h"
 
 namespace nau::physics
 {
@@ -94,7 +95,7 @@ namespace nau::physics
         }
     }
 
-    async::Task<bool> PhysicsService::update(std::chrono::milliseconds dt)
+    async::Task<bool> PhysicsService::update(std::chrono::microseconds dt)
     {
         m_preUpdateWorkQueue->poll();
 
@@ -106,23 +107,27 @@ namespace nau::physics
         }
 
         constexpr float MaxSimulationStep = 0.1f;
-        const float simulationTimeStep = std::min(static_cast<float>(dt.count()) / 1000.f, MaxSimulationStep);
+        const float simulationTimeStep = std::min(std::chrono::duration<float>(dt).count(), MaxSimulationStep);
 
-        for (PhysicsWorldState& physWorld : m_physicsWorlds)
         {
-            physWorld.tick(simulationTimeStep);
+            // There is no suspension inside the block: zone must not span co_await.
+            NAU_CPU_SCOPED_TAG_NAME("PhysicsTick", nau::PerfTag::Physics);
+            for (PhysicsWorldState& physWorld : m_physicsWorlds)
+            {
+                physWorld.tick(simulationTimeStep);
+            }
         }
 
         co_return true;
     }
 
-    eastl::optional<std::chrono::milliseconds> PhysicsService::getFixedUpdateTimeStep()
+    eastl::optional<std::chrono::microseconds> PhysicsService::getFixedUpdateTimeStep()
     {
         // The target refresh rate value can be calculated more intelligently (or at least loaded from global settings)
-        constexpr size_t TargetStepsPerSecond = 75;
-        constexpr size_t SimulationStepTime = 1000.0f / TargetStepsPerSecond;
+        constexpr std::chrono::microseconds::rep TargetStepsPerSecond = 75;
+        constexpr std::chrono::microseconds SimulationStepTime{std::chrono::microseconds{std::chrono::seconds{1}}.count() / TargetStepsPerSecond};
 
-        return std::chrono::milliseconds(SimulationStepTime);
+        return SimulationStepTime;
     }
 
     void PhysicsService::syncSceneState()
@@ -135,6 +140,8 @@ namespace nau::physics
         }
 
 
+        NAU_CPU_SCOPED_TAG(nau::PerfTag::Physics);
+
         ISceneManager& sceneManager = getServiceProvider().get<ISceneManager>();
         for (PhysicsWorldState& physWorld : m_physicsWorlds)
         {
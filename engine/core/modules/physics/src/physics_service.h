@@ -51,9 +51,9 @@ namespace nau::physics
 
         async::Task<> deactivateComponentsAsync(Uid, eastl::span<const scene::DeactivatedComponentData> components) override;
 
-        async::Task<bool> update(std::chrono::milliseconds dt) override;
+        async::Task<bool> update(std::chrono::microseconds dt) override;
 
-        eastl::optional<std::chrono::milliseconds> getFixedUpdateTimeStep() override;
+        eastl::optional<std::chrono::microseconds> getFixedUpdateTimeStep() override;
 
         void syncSceneState() override;
 
@@ -5,6 +5,7 @@
 #include "physics_world_state.h"
 
 #include "nau/assets/asset_manager.h"
+#include "nau/memory/memory_stats.h"
 #include "nau/physics/physics_assets.h"
 #include "nau/physics/physics_collision_shapes_factory.h"
 #include "nau/service/service_provider.h"
@@ -24,6 +25,7 @@ namespace nau::physics
 
     PhysicsWorldState::~PhysicsWorldState()
     {
+        m_bodyEntriesByBody.clear();
         m_bodies.clear();
     }
 
@@ -45,39 +47,77 @@ namespace nau::physics
             return;
         }
 
+        NAU_MEMORY_SCOPE(Physics);
         m_physics->tick(secondsDt);
+        m_lastStepTime = secondsDt;
     }
 
     async::Task<> PhysicsWorldState::activateComponents(eastl::span<const scene::Component*> components)
     {
         using namespace nau::scene;
 
+        // The creation data is gathered first, so the bodies are inserted into the physical world as a single batch.
+        eastl::vector<const RigidBodyComponent*> rigidBodyComponents;
+        eastl::vector<Uid> sceneObjectUids;
+        eastl::vector<PhysicsBodyCreationData> creationData;
+
         for (const Component* const component : components)
         {
             auto* const rigidBodyComponent = component->as<const RigidBodyComponent*>();
             if (rigidBodyComponent)
             {
-                nau::Ptr<IPhysicsBody> physBody = co_await createPhysicsBodyForComponent(*rigidBodyComponent);
-                if (!physBody)
+                eastl::optional<PhysicsBodyCreationData> bodyCreationData = co_await makeBodyCreationData(*rigidBodyComponent);
+                if (!bodyCreationData)
                 {
                     NAU_LOG_ERROR("Fail to create PhysicsBody for corresponding RigidBodyComponent");
                     continue;
                 }
 
-                m_bodies.emplace_back(*rigidBodyComponent, std::move(physBody));
+                rigidBodyComponents.push_back(rigidBodyComponent);
+                sceneObjectUids.push_back(rigidBodyComponent->getParentObject().getUid());
+                creationData.push_back(std::move(*bodyCreationData));
+            }
+        }
+
+        if (creationData.empty())
+        {
+            co_return;
+        }
+
+        eastl::vector<nau::Ptr<IPhysicsBody>> physBodies = m_physics->createBodies(sceneObjectUids, creationData);
+        NAU_ASSERT(physBodies.size() == rigidBodyComponents.size());
+
+        for (size_t i = 0; i < physBodies.size(); ++i)
+        {
+            if (!physBodies[i])
+            {
+                NAU_LOG_ERROR("Fail to create PhysicsBody for corresponding RigidBodyComponent");
+                continue;
             }
+
+            const IPhysicsBody* const body = physBodies[i].get();
+            m_bodies.emplace_back(*rigidBodyComponents[i], std::move(physBodies[i]));
+            m_bodyEntriesByBody[body] = eastl::prev(m_bodies.end());
         }
     }
 
     void PhysicsWorldState::deactivateComponents(eastl::span<const scene::DeactivatedComponentData> components)
     {
-        eastl::erase_if(m_bodies, [&components](const PhysicsBodyEntry& entry)
+        for (auto entry = m_bodies.begin(); entry != m_bodies.end();)
         {
-            return eastl::find_if(components.begin(), components.end(), [&entry](const scene::DeactivatedComponentData& c)
+            const bool isDeactivated = eastl::any_of(components.begin(), components.end(), [&entry](const scene::DeactivatedComponentData& c)
             {
-                return c.componentUid == entry.componentUid;
+                return c.componentUid == entry->componentUid;
             });
-        });
+
+            entry = isDeactivated ? eraseBodyEntry(entry) : eastl::next(entry);
+        }
+    }
+
+    PhysicsWorldState::BodyEntries::iterator PhysicsWorldState::eraseBodyEntry(BodyEntries::iterator entry)
+    {
+        m_bodyEntriesByBody.erase(entry->physicsBody.get());
+        return m_bodies.erase(entry);
     }
 
     bool PhysicsWorldState::syncSceneState(scene::ISceneManager& sceneManager)
@@ -111,35 +151,54 @@ namespace nau::physics
         {
             if (!entry->componentRef)
             {
-                entry = m_bodies.erase(entry);
+                entry = eraseBodyEntry(entry);
                 continue;
             }
 
             NAU_FATAL(entry->physicsBody);
 
-            SceneObject& parentObject = entry->componentRef->getParentObject();
+            if (m_isPaused)
+            {
+                SceneObject& parentObject = entry->componentRef->getParentObject();
+                entry->physicsBody->setTransform({parentObject.getRotation(), parentObject.getWorldTransform().getTranslation()});
+                entry->componentRef->applyPhysicsBodyActions(nullptr);
+                entry->componentRef->resetPhysicsPose();
+            }
+            else
+            {
+                entry->componentRef->applyPhysicsBodyActions(entry->physicsBody.get());
+            }
+
+            ++entry;
+        }
 
-            if (!m_isPaused)
+        if (!m_isPaused)
+        {
+            // Only the bodies that are awake (or have just fallen asleep) are written back to the scene:
+            // sleeping bodies do not invalidate the scene transforms nor fire change notifications.
+            // The components present the poses interpolated over the step time (see RigidBodyComponent::updateComponent).
+            m_physics->collectMovedBodies(m_movedBodies);
+            for (const IPhysicsBody* const body : m_movedBodies)
             {
+                const auto bodyEntry = m_bodyEntriesByBody.find(body);
+                if (bodyEntry == m_bodyEntriesByBody.end())
+                {
+                    continue;
+                }
+
+                const PhysicsBodyEntry& entry = *bodyEntry->second;
+                SceneObject& parentObject = entry.componentRef->getParentObject();
+
                 math::mat4 physTransform;
-                entry->physicsBody->getTransform(physTransform);
+                entry.physicsBody->getTransform(physTransform);
 
                 // TODO: maybe do not need to getting world transform ?
                 // If no need to deal with scale
                 auto transform = parentObject.getWorldTransform();
                 transform.setTranslation(physTransform.getTranslation());
                 transform.setRotation(math::quat(physTransform.getUpper3x3()));
-                parentObject.setWorldTransform(transform);
-
-                entry->componentRef->applyPhysicsBodyActions(entry->physicsBody.get());
+                entry.componentRef->setPhysicsPose(transform, m_lastStepTime);
             }
-            else
-            {
-                entry->physicsBody->setTransform({parentObject.getRotation(), parentObject.getWorldTransform().getTranslation()});
-                entry->componentRef->applyPhysicsBodyActions(nullptr);
-            }
-
-            ++entry;
         }
 
         if (!m_isPaused)
@@ -150,7 +209,7 @@ namespace nau::physics
         return true;
     }
 
-    async::Task<nau::Ptr<IPhysicsBody>> PhysicsWorldState::createPhysicsBodyForComponent(const RigidBodyComponent& component)
+    async::Task<eastl::optional<PhysicsBodyCreationData>> PhysicsWorldState::makeBodyCreationData(const RigidBodyComponent& component)
     {
         auto& shapeFactory = getServiceProvider().get<physics::ICollisionShapesFactory>();
 
@@ -209,7 +268,7 @@ namespace nau::physics
         if (!collisionShape)
         {
             NAU_LOG_ERROR("Can not create collisions for rigid body ({})", component.getParentObject().getName());
-            co_return nullptr;
+            co_return eastl::nullopt;
         }
 
         const scene::SceneObject& parentObject = component.getParentObject();
@@ -227,7 +286,7 @@ namespace nau::physics
         creationData.debugDraw = component.isDebugDrawEnabled();
         creationData.comOffset = component.centerMassShift();
 
-        co_return m_physics->createBody(parentObject.getUid(), creationData);
+        co_return creationData;
     }
 
 }  // namespace nau::physics
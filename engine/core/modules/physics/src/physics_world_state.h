@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <EASTL/unordered_map.h>
+
 #include "nau/memory/eastl_aliases.h"
 #include "nau/physics/components/rigid_body_component.h"
 #include "nau/physics/physics_body.h"
@@ -55,11 +57,18 @@ namespace nau::physics
         bool syncSceneState(scene::ISceneManager& sceneManager);
 
     private:
-        async::Task<nau::Ptr<IPhysicsBody>> createPhysicsBodyForComponent(const RigidBodyComponent& component);
+        using BodyEntries = List<PhysicsBodyEntry>;
+
+        async::Task<eastl::optional<PhysicsBodyCreationData>> makeBodyCreationData(const RigidBodyComponent& component);
+
+        BodyEntries::iterator eraseBodyEntry(BodyEntries::iterator entry);
 
         const Uid m_worldUid;
         nau::Ptr<IPhysicsWorld> m_physics;
-        List<PhysicsBodyEntry> m_bodies;
+        BodyEntries m_bodies;
+        eastl::unordered_map<const IPhysicsBody*, BodyEntries::iterator> m_bodyEntriesByBody;
+        eastl::vector<IPhysicsBody*> m_movedBodies;
         bool m_isPaused = false;
+        float m_lastStepTime = 0.0f; /** < Duration of the last simulated step, the scene presents the body poses interpolated over it. */
     };
 }  // namespace nau::physics
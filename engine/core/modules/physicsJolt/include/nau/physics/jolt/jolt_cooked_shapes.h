@@ -0,0 +1,113 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#pragma once
+#include <Jolt/Jolt.h>
+#include <Jolt/Core/StreamIn.h>
+#include <Jolt/Core/StreamOut.h>
+#include <Jolt/Physics/Collision/Shape/ConvexHullShape.h>
+#include <Jolt/Physics/Collision/Shape/MeshShape.h>
+
+#include <cstdint>
+
+
+/**
+ * Binary format of the collision shapes cooked by the asset tools and restored by the runtime.
+ *
+ * The functions are inline, so the tools share the exact shape construction and layout of the runtime
+ * without depending on the physics module itself.
+ */
+namespace nau::physics::jolt::cooked_shapes
+{
+    inline constexpr uint32_t FormatTag = 0x5348504A;  // "JPHS"
+    inline constexpr uint32_t FormatVersion = 1;
+
+    /**
+     * @brief Shapes of a single mesh: the convex hull of its vertices and its triangles.
+     */
+    struct CookedShapes
+    {
+        JPH::ShapeRefC convexHull;
+        JPH::ShapeRefC triMesh;
+    };
+
+    /**
+     * @brief Builds the convex hull shape of the vertices.
+     */
+    inline JPH::ShapeSettings::ShapeResult createConvexHullShape(const JPH::VertexList& positions)
+    {
+        JPH::Array<JPH::Vec3> points;
+        points.reserve(positions.size());
+        for (const JPH::Float3& position : positions)
+        {
+            points.push_back(JPH::Vec3{position.x, position.y, position.z});
+        }
+
+        return JPH::ConvexHullShapeSettings{points}.Create();
+    }
+
+    /**
+     * @brief Builds the triangle mesh shape (with its bounding volume hierarchy) of the vertices and the triangles.
+     */
+    inline JPH::ShapeSettings::ShapeResult createTriMeshShape(JPH::VertexList positions, JPH::IndexedTriangleList triangles)
+    {
+        return JPH::MeshShapeSettings{std::move(positions), std::move(triangles)}.Create();
+    }
+
+    /**
+     * @brief Writes the shapes with Jolt's binary state serialization.
+     *
+     * @return false if the shapes are missing or the stream has failed.
+     */
+    inline bool save(const CookedShapes& shapes, JPH::StreamOut& stream)
+    {
+        if (shapes.convexHull == nullptr || shapes.triMesh == nullptr)
+        {
+            return false;
+        }
+
+        stream.Write(FormatTag);
+        stream.Write(FormatVersion);
+
+        for (const JPH::ShapeRefC& shape : {shapes.convexHull, shapes.triMesh})
+        {
+            JPH::Shape::ShapeToIDMap shapeMap;
+            JPH::Shape::MaterialToIDMap materialMap;
+            shape->SaveWithChildren(stream, shapeMap, materialMap);
+        }
+
+        return !stream.IsFailed();
+    }
+
+    /**
+     * @brief Restores the shapes written by save(), no hull computation nor hierarchy building is performed.
+     *
+     * @return false if the data is not a cooked shapes stream of the current version or is corrupted.
+     */
+    inline bool restore(JPH::StreamIn& stream, CookedShapes& shapes)
+    {
+        uint32_t tag = 0;
+        uint32_t version = 0;
+        stream.Read(tag);
+        stream.Read(version);
+        if (stream.IsFailed() || tag != FormatTag || version != FormatVersion)
+        {
+            return false;
+        }
+
+        for (JPH::ShapeRefC* const shape : {&shapes.convexHull, &shapes.triMesh})
+        {
+            JPH::Shape::IDToShapeMap shapeMap;
+            JPH::Shape::IDToMaterialMap materialMap;
+            JPH::Shape::ShapeResult result = JPH::Shape::sRestoreWithChildren(stream, shapeMap, materialMap);
+            if (!result.IsValid())
+            {
+                return false;
+            }
+
+            *shape = result.Get();
+        }
+
+        return true;
+    }
+}  // namespace nau::physics::jolt::cooked_shapes
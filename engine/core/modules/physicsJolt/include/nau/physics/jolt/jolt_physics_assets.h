@@ -15,30 +15,38 @@
 namespace nau::physics::jolt
 {
     /**
+     * @brief Keeps the convex hull shape of a mesh, shared by all colliders created from the asset.
+     *
+     * The shape is either built from the mesh vertices or restored from the shapes cooked by the asset tools.
      */
     class JoltConvexHullAssetView final : public physics::ConvexHullAssetView
     {
         NAU_CLASS_(nau::physics::jolt::JoltConvexHullAssetView, physics::ConvexHullAssetView)
     public:
         JoltConvexHullAssetView(IMeshAssetAccessor& meshAccessor);
+        JoltConvexHullAssetView(JPH::ShapeRefC cookedShape);
 
-        JPH::ConvexHullShapeSettings& getShapeSettings();
+        JPH::ShapeRefC getShape() const;
 
     private:
-        std::optional<JPH::ConvexHullShapeSettings> m_convexHullShapeSettings;
+        JPH::ShapeRefC m_shape;
     };
 
     /**
+     * @brief Keeps the triangle mesh shape of a mesh, shared by all colliders created from the asset.
+     *
+     * The shape is either built from the mesh triangles or restored from the shapes cooked by the asset tools.
      */
     class JoltTriMeshAssetView final : public physics::TriMeshAssetView
     {
         NAU_CLASS_(nau::physics::jolt::JoltTriMeshAssetView, physics::TriMeshAssetView)
     public:
         JoltTriMeshAssetView(IMeshAssetAccessor& meshAccessor);
+        JoltTriMeshAssetView(JPH::ShapeRefC cookedShape);
 
-        JPH::MeshShapeSettings& getShapeSettings();
+        JPH::ShapeRefC getShape() const;
 
     private:
-        std::optional<JPH::MeshShapeSettings> m_meshShapeSettings;
+        JPH::ShapeRefC m_shape;
     };
 }  // namespace nau::physics
\ No newline at end of file
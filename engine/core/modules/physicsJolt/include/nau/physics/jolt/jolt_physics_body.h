@@ -26,7 +26,11 @@ namespace nau::physics::jolt
         NAU_CLASS(nau::physics::jolt::JoltPhysicsBody, rtti::RCPolicy::Concurrent, IPhysicsBody)
 
     public:
-        JoltPhysicsBody(Ptr<JoltPhysicsWorld> physWorld, Uid originObjectUid, const PhysicsBodyCreationData& creationData);
+        /**
+         * @param [in] addToWorld   Indicates whether the body is added to the physical world at once.
+         *                          Otherwise the caller adds it (see JoltPhysicsWorld::createBodies), the body is only created.
+         */
+        JoltPhysicsBody(Ptr<JoltPhysicsWorld> physWorld, Uid originObjectUid, const PhysicsBodyCreationData& creationData, bool addToWorld = true);
         ~JoltPhysicsBody();
 
         /**
@@ -119,14 +123,22 @@ namespace nau::physics::jolt
         //nau::physics::RigidBodyComponent* component() const;
         Uid getSceneObjectUid() const;
 
+        /**
+         * @brief Retrieves the handle to the body within the physical world.
+         *
+         * @return Body id, invalid if the body creation has failed.
+         */
+        JPH::BodyID getBodyId() const;
+
     private:
 
         /**
-         * @brief Creates the body and adds it to the physical world.
+         * @brief Creates the body and optionally adds it to the physical world.
          * 
          * @param [in] creationData Physical properties of the body.
+         * @param [in] addToWorld   Indicates whether the body should be added to the physical world.
          */
-        void initializeJoltBody(const PhysicsBodyCreationData& creationData);
+        void initializeJoltBody(const PhysicsBodyCreationData& creationData, bool addToWorld);
 
     private:
         eastl::shared_ptr<JoltCollisionShape> m_collisionShape;
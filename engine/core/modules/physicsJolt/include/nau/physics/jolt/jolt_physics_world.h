@@ -16,10 +16,16 @@
 #include <EASTL/unique_ptr.h>
 #include <EASTL/shared_ptr.h>
 #include <EASTL/tuple.h>
+#include <EASTL/vector_map.h>
+
+#include <atomic>
+#include <thread>
 
 #include <Jolt/Jolt.h>
 #include <Jolt/Core/Color.h>
 #include <Jolt/Core/Mutex.h>
+#include <Jolt/Physics/Body/BodyActivationListener.h>
+#include <Jolt/Physics/Body/BodyManager.h>
 #include <Jolt/Physics/Collision/ContactListener.h>
 
 namespace JPH
@@ -40,7 +46,7 @@ namespace nau::physics::jolt
     /**
      * @brief Implements nau::physics::IPhysicsWorld interface utilizing Jolt physics engine.
      */
-    class JoltPhysicsWorld final : public IPhysicsWorld, public JPH::ContactListener 
+    class JoltPhysicsWorld final : public IPhysicsWorld, public JPH::ContactListener, public JPH::BodyActivationListener
     {
         NAU_CLASS(nau::physics::jolt::JoltPhysicsWorld, rtti::RCPolicy::Concurrent, IPhysicsWorld)
 
@@ -76,6 +82,13 @@ namespace nau::physics::jolt
          */
         virtual nau::Ptr<IPhysicsBody> createBody(Uid originSceneObjectUid, const PhysicsBodyCreationData& creationData) override;
 
+        /**
+         * @brief Creates the bodies and inserts them into the broad phase with a single AddBodiesPrepare / AddBodiesFinalize pair.
+         *
+         * The broad phase is optimized once after a large batch, instead of being left degraded by the bulk insertion.
+         */
+        eastl::vector<nau::Ptr<IPhysicsBody>> createBodies(eastl::span<const Uid> originSceneObjectUids, eastl::span<const PhysicsBodyCreationData> creationData) override;
+
         /**
          * @brief Allows or forbids contacts between to collision channels.
          *
@@ -124,6 +137,18 @@ namespace nau::physics::jolt
          */
         virtual void OnContactRemoved(const JPH::SubShapeIDPair& subShapePair) override;
 
+        /**
+         * @brief Called when a body wakes up. Awake bodies are taken from Jolt's active bodies list, so nothing is done here.
+         */
+        virtual void OnBodyActivated(const JPH::BodyID& bodyId, JPH::uint64 bodyUserData) override;
+
+        /**
+         * @brief Called when a body falls asleep. The body is remembered to sync its resting transform once more.
+         *
+         * @note Called from the physics jobs with the body locked.
+         */
+        virtual void OnBodyDeactivated(const JPH::BodyID& bodyId, JPH::uint64 bodyUserData) override;
+
         /**
          * @brief Provides access to the body interface.
          * 
@@ -154,6 +179,19 @@ namespace nau::physics::jolt
 
         async::Task<eastl::vector<RayCastResult>> castRaysAsync(eastl::vector<physics::RayCastQuery> queries) const override;
 
+        void castRays(eastl::span<const RayCastQuery> queries, eastl::span<SceneQueryHit> hits) const override;
+
+        void castShapes(eastl::span<const ShapeCastQuery> queries, eastl::span<SceneQueryHit> hits) const override;
+
+        size_t overlapShapes(eastl::span<const ShapeOverlapQuery> queries, eastl::span<SceneQueryHit> hits) const override;
+
+        /**
+         * @brief Captures the simulation state with JPH::PhysicsSystem::SaveState, straight into the snapshot buffers.
+         */
+        void saveState(PhysicsWorldSnapshot& snapshot, PhysicsSnapshotScope scope = PhysicsSnapshotScope::AllBodies) const override;
+
+        bool restoreState(const PhysicsWorldSnapshot& snapshot) override;
+
         /**
          * @brief Performs physics debug drawing.
          * 
@@ -168,6 +206,8 @@ namespace nau::physics::jolt
 
         void syncSceneState() override;
 
+        void collectMovedBodies(eastl::vector<IPhysicsBody*>& bodies) override;
+
     private:
 
         /**
@@ -193,10 +233,10 @@ namespace nau::physics::jolt
         /**
          * @brief Extracts contact points from the JPH::ContactManifold object.
          * 
-         * @param [in] manifold Object to extract the points from.
-         * @return A vector of contact points.
+         * @param [in]  manifold    Object to extract the points from.
+         * @param [out] points      Vector to append the contact points to.
          */
-        static eastl::vector<nau::math::vec3> calculateContactPoints(const JPH::ContactManifold& manifold);
+        static void appendContactPoints(const JPH::ContactManifold& manifold, eastl::vector<nau::math::vec3>& points);
 
         /**
          * @brief Sends a line segment to rendering.
@@ -231,13 +271,54 @@ namespace nau::physics::jolt
 
         };
 
-        struct ContactData
+        /**
+         * @brief Contact callback data recorded by a physics job, without any reference counting nor lookups.
+         */
+        struct ContactEvent
         {
-            const JoltPhysicsBody* body1 = nullptr;
-            const JoltPhysicsBody* body2 = nullptr;
-            eastl::set<JPH::SubShapeIDPair> contacts;
+            ContactNotificationKind kind;
+            JPH::BodyID bodyId1;
+            JPH::BodyID bodyId2;
+            Uid sceneObjectUid1;
+            Uid sceneObjectUid2;
+            const JoltPhysicsMaterial* material1 = nullptr;
+            const JoltPhysicsMaterial* material2 = nullptr;
+            uint32_t pointsOffset = 0;
+            uint32_t pointsCount = 0;
         };
 
+        /**
+         * @brief Contact events of a single thread during a step.
+         */
+        struct ContactEventsBuffer
+        {
+            std::thread::id threadId;
+            eastl::vector<ContactEvent> events;
+            eastl::vector<math::vec3> points;
+        };
+
+        /**
+         * @brief State of the contact between two bodies, kept until all their sub shape contacts are removed.
+         */
+        struct BodiesContact
+        {
+            Uid sceneObjectUid1;
+            Uid sceneObjectUid2;
+            uint32_t subShapeContactsCount = 0;
+        };
+
+        /**
+         * @brief Returns the contact events buffer of the calling thread.
+         *
+         * The buffer is cached in a thread local, so the lock is only taken on the first contact of a thread.
+         */
+        ContactEventsBuffer& getThreadContactEvents();
+
+        /**
+         * @brief Merges the contact events of all threads into the contact notifications once the step is completed.
+         */
+        void mergeContactEvents();
+
         eastl::unique_ptr<JPH::ObjectLayerPairFilterTable> m_layerPairFilter; /** < Responsible for turning on or off collision between channels (layers).*/
         eastl::unique_ptr<JPH::BroadPhaseLayerInterfaceTable> m_broadPhaseLayerInterface;
         eastl::unique_ptr<JPH::ObjectVsBroadPhaseLayerFilter> m_objectOverBroadPhaseFilter;
@@ -254,18 +335,31 @@ namespace nau::physics::jolt
         int m_collisionStepsCount = 1; /** < Indicates granularity of collision detection stage within a physical world tick. */
 
 
-        JPH::Mutex m_bodiesInContactGuard;
+        /**
+         * @brief Indicates whether the contact events should be recorded, read by the physics jobs instead of the listener itself.
+         */
+        std::atomic<bool> m_isContactListenerSet = false;
+
+        const uint64_t m_worldId; /** < Unique id of the world, identifies the world in the thread local contact buffer caches. */
+
+        JPH::Mutex m_contactEventsGuard; /** < Only taken when a thread reports its first contact. */
+        eastl::vector<eastl::unique_ptr<ContactEventsBuffer>> m_contactEvents;
 
         /**
-         * @brief Maps a pairs of Jolt ids of contacting bodies to the corresponding ContactData object.
+         * @brief Maps a pairs of Jolt ids of contacting bodies to the state of their contact.
          * 
          * We keep track bodies that are currently in contact by ourselves, for Jolt system contact listener
          * provide only bodyIDs of removed contacts. See JPH::ContactListener::OnContactRemoved for details.
+         * Only the merge after the step accesses it, the sorted flat storage keeps the lookups cache friendly.
          */
-        eastl::map<eastl::pair<JPH::BodyID, JPH::BodyID>, ContactData> m_bodiesInContact;
+        eastl::vector_map<eastl::pair<JPH::BodyID, JPH::BodyID>, BodiesContact> m_bodiesInContact;
 
         eastl::vector<InternalContactManifoldEntry> m_contactsData;
 
+        JPH::Mutex m_deactivatedBodiesGuard;
+        eastl::vector<JPH::BodyID> m_deactivatedBodies; /** < Bodies that have fallen asleep since the last collectMovedBodies call. */
+        JPH::BodyIDVector m_activeBodies;
+
     };
 } // namespace nau::physics::jolt
 
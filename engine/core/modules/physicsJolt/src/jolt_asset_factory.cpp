@@ -3,6 +3,8 @@
 
 #include "jolt_asset_factory.h"
 
+#include "jolt_cooked_shapes_container.h"
+
 #include "nau/assets/mesh_asset_accessor.h"
 #include "nau/physics/jolt/jolt_physics_assets.h"
 
@@ -18,7 +20,19 @@ namespace nau::physics::jolt
 
     async::Task<IAssetView::Ptr> JoltAssetFactory::createAssetView(nau::Ptr<> accessor, const rtti::TypeInfo& viewType)
     {
-        if (viewType == rtti::getTypeInfo<physics::ConvexHullAssetView>())
+        // The shapes cooked by the asset tools are restored on load: the views just share them.
+        if (auto* const cookedShape = accessor->as<JoltCookedShapeAccessor*>())
+        {
+            if (viewType == rtti::getTypeInfo<physics::ConvexHullAssetView>())
+            {
+                co_return rtti::createInstance<JoltConvexHullAssetView>(cookedShape->getShape());
+            }
+            else if (viewType == rtti::getTypeInfo<physics::TriMeshAssetView>())
+            {
+                co_return rtti::createInstance<JoltTriMeshAssetView>(cookedShape->getShape());
+            }
+        }
+        else if (viewType == rtti::getTypeInfo<physics::ConvexHullAssetView>())
         {
             auto& meshAccessor = accessor->as<IMeshAssetAccessor&>();
             co_return rtti::createInstance<JoltConvexHullAssetView>(meshAccessor);
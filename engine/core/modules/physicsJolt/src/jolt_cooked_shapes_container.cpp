@@ -0,0 +1,113 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#include "jolt_cooked_shapes_container.h"
+
+#include "nau/physics/physics_assets.h"
+
+
+namespace nau::physics::jolt
+{
+    namespace
+    {
+        /**
+         * Reads the Jolt binary state straight from the asset stream.
+         */
+        class JoltAssetStreamIn final : public JPH::StreamIn
+        {
+        public:
+            JoltAssetStreamIn(io::IStreamReader& stream) :
+                m_stream(stream)
+            {
+            }
+
+            void ReadBytes(void* outData, size_t inNumBytes) override
+            {
+                Result<size_t> readResult = m_stream.read(reinterpret_cast<std::byte*>(outData), inNumBytes);
+                if (!readResult)
+                {
+                    m_isFailed = true;
+                    return;
+                }
+
+                m_isEof = *readResult < inNumBytes;
+            }
+
+            bool IsEOF() const override
+            {
+                return m_isEof;
+            }
+
+            bool IsFailed() const override
+            {
+                return m_isFailed || m_isEof;
+            }
+
+        private:
+            io::IStreamReader& m_stream;
+            bool m_isEof = false;
+            bool m_isFailed = false;
+        };
+    }  // namespace
+
+    eastl::vector<eastl::string_view> JoltCookedShapesContainerLoader::getSupportedAssetKind() const
+    {
+        return {"jphys"};
+    }
+
+    async::Task<IAssetContainer::Ptr> JoltCookedShapesContainerLoader::loadFromStream(io::IStreamReader::Ptr stream, AssetContentInfo info)
+    {
+        NAU_ASSERT(stream);
+
+        JoltAssetStreamIn joltStream{*stream};
+        cooked_shapes::CookedShapes shapes;
+        if (!cooked_shapes::restore(joltStream, shapes))
+        {
+            co_yield NauMakeError("Invalid cooked collision shapes ({})", info.path.getString());
+        }
+
+        co_return rtti::createInstance<JoltCookedShapesContainer>(shapes);
+    }
+
+    RuntimeReadonlyDictionary::Ptr JoltCookedShapesContainerLoader::getDefaultImportSettings() const
+    {
+        return nullptr;
+    }
+
+    JoltCookedShapeAccessor::JoltCookedShapeAccessor(JPH::ShapeRefC shape) :
+        m_shape(std::move(shape))
+    {
+    }
+
+    JPH::ShapeRefC JoltCookedShapeAccessor::getShape() const
+    {
+        return m_shape;
+    }
+
+    JoltCookedShapesContainer::JoltCookedShapesContainer(const cooked_shapes::CookedShapes& shapes) :
+        m_convexHull(rtti::createInstance<JoltCookedShapeAccessor>(shapes.convexHull)),
+        m_triMesh(rtti::createInstance<JoltCookedShapeAccessor>(shapes.triMesh))
+    {
+    }
+
+    nau::Ptr<> JoltCookedShapesContainer::getAsset(eastl::string_view path)
+    {
+        if (path == CookedConvexHullContentPath)
+        {
+            return m_convexHull;
+        }
+
+        if (path == CookedTriMeshContentPath)
+        {
+            return m_triMesh;
+        }
+
+        NAU_LOG_ERROR("Unknown cooked collision shape ({})", path);
+        return nullptr;
+    }
+
+    eastl::vector<eastl::string> JoltCookedShapesContainer::getContent() const
+    {
+        return {eastl::string{CookedConvexHullContentPath}, eastl::string{CookedTriMeshContentPath}};
+    }
+}  // namespace nau::physics::jolt
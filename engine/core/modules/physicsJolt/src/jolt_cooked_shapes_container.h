@@ -0,0 +1,67 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#pragma once
+
+#include "nau/assets/asset_accessor.h"
+#include "nau/assets/asset_container.h"
+#include "nau/physics/jolt/jolt_cooked_shapes.h"
+#include "nau/rtti/rtti_impl.h"
+
+
+namespace nau::physics::jolt
+{
+    /**
+     * @brief Loads the collision shapes cooked by the asset tools (".jphys" files).
+     *
+     * The shapes are restored from their binary state on load, so no hull computation
+     * nor triangle hierarchy building happens when the colliders are created.
+     */
+    class JoltCookedShapesContainerLoader final : public IAssetContainerLoader
+    {
+        NAU_INTERFACE(nau::physics::jolt::JoltCookedShapesContainerLoader, IAssetContainerLoader)
+
+    public:
+        JoltCookedShapesContainerLoader() = default;
+
+    private:
+        eastl::vector<eastl::string_view> getSupportedAssetKind() const override;
+
+        async::Task<IAssetContainer::Ptr> loadFromStream(io::IStreamReader::Ptr stream, AssetContentInfo info) override;
+
+        RuntimeReadonlyDictionary::Ptr getDefaultImportSettings() const override;
+    };
+
+    /**
+     * @brief Accessor of a single cooked collision shape, see nau::physics::CookedConvexHullContentPath and nau::physics::CookedTriMeshContentPath.
+     */
+    class JoltCookedShapeAccessor final : public IAssetAccessor
+    {
+        NAU_CLASS_(nau::physics::jolt::JoltCookedShapeAccessor, IAssetAccessor)
+
+    public:
+        JoltCookedShapeAccessor(JPH::ShapeRefC shape);
+
+        JPH::ShapeRefC getShape() const;
+
+    private:
+        JPH::ShapeRefC m_shape;
+    };
+
+    /**
+     */
+    class JoltCookedShapesContainer final : public IAssetContainer
+    {
+        NAU_CLASS_(nau::physics::jolt::JoltCookedShapesContainer, IAssetContainer)
+
+    public:
+        JoltCookedShapesContainer(const cooked_shapes::CookedShapes& shapes);
+
+    private:
+        nau::Ptr<> getAsset(eastl::string_view path) override;
+        eastl::vector<eastl::string> getContent() const override;
+
+        nau::Ptr<JoltCookedShapeAccessor> m_convexHull;
+        nau::Ptr<JoltCookedShapeAccessor> m_triMesh;
+    };
+}  // namespace nau::physics::jolt
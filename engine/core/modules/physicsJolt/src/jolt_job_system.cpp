@@ -0,0 +1,93 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "jolt_job_system.h"
+
+#include "nau/diag/assertion.h"
+
+#include <thread>
+
+namespace nau::physics::jolt
+{
+    JoltJobSystem::JoltJobSystem(async::Executor::Ptr executor, JPH::uint maxJobs, JPH::uint maxBarriers) :
+        JPH::JobSystemWithBarrier(maxBarriers),
+        m_executor(std::move(executor))
+    {
+        m_jobs.Init(maxJobs, maxJobs);
+    }
+
+    JoltJobSystem::~JoltJobSystem()
+    {
+        // The jobs scheduled on the executor hold a reference to their job and to the free list.
+        while (m_scheduledJobsCount.load(std::memory_order_acquire) > 0)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    int JoltJobSystem::GetMaxConcurrency() const
+    {
+        // The waiting thread takes part in the jobs.
+        return m_executor ? static_cast<int>(m_executor->getConcurrency()) + 1 : 1;
+    }
+
+    JPH::JobSystem::JobHandle JoltJobSystem::CreateJob(const char* inName, JPH::ColorArg inColor, const JobFunction& inJobFunction, JPH::uint32 inNumDependencies)
+    {
+        JPH::uint32 index = m_jobs.ConstructObject(inName, inColor, this, inJobFunction, inNumDependencies);
+        while (index == AvailableJobs::cInvalidObjectIndex)
+        {
+            NAU_FAILURE("Out of the physics jobs");
+            std::this_thread::yield();
+            index = m_jobs.ConstructObject(inName, inColor, this, inJobFunction, inNumDependencies);
+        }
+
+        Job* const job = &m_jobs.Get(index);
+
+        // The handle keeps the job alive: it may be executed (and released by the executor) right away.
+        JobHandle handle(job);
+        if (inNumDependencies == 0)
+        {
+            QueueJob(job);
+        }
+
+        return handle;
+    }
+
+    void JoltJobSystem::QueueJob(Job* inJob)
+    {
+        // No executor: the barrier executes the job on the waiting thread.
+        if (!m_executor)
+        {
+            return;
+        }
+
+        inJob->AddRef();
+        m_scheduledJobsCount.fetch_add(1, std::memory_order_relaxed);
+
+        m_executor->execute([](void* data1, void* data2) noexcept
+        {
+            Job* const job = reinterpret_cast<Job*>(data1);
+            JoltJobSystem* const jobSystem = reinterpret_cast<JoltJobSystem*>(data2);
+
+            // Does nothing if the waiting thread already executed the job.
+            job->Execute();
+            job->Release();
+
+            jobSystem->m_scheduledJobsCount.fetch_sub(1, std::memory_order_release);
+        }, inJob, this);
+    }
+
+    void JoltJobSystem::QueueJobs(Job** inJobs, JPH::uint inNumJobs)
+    {
+        for (JPH::uint i = 0; i < inNumJobs; ++i)
+        {
+            QueueJob(inJobs[i]);
+        }
+    }
+
+    void JoltJobSystem::FreeJob(Job* inJob)
+    {
+        m_jobs.DestructObject(inJob);
+    }
+}  // namespace nau::physics::jolt
@@ -0,0 +1,46 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <Jolt/Jolt.h>
+#include <Jolt/Core/FixedSizeFreeList.h>
+#include <Jolt/Core/JobSystemWithBarrier.h>
+
+#include "nau/async/executor.h"
+
+#include <atomic>
+
+namespace nau::physics::jolt
+{
+    /**
+     * Runs the Jolt jobs of the physics update on an engine executor.
+     *
+     * The jobs are scheduled on the executor as soon as their dependencies are resolved,
+     * the thread waiting for a barrier executes the ready jobs of the barrier too.
+     * Without an executor all the jobs are executed by the waiting thread.
+     */
+    class JoltJobSystem final : public JPH::JobSystemWithBarrier
+    {
+    public:
+        JoltJobSystem(async::Executor::Ptr executor, JPH::uint maxJobs, JPH::uint maxBarriers);
+        ~JoltJobSystem() override;
+
+        int GetMaxConcurrency() const override;
+        JobHandle CreateJob(const char* inName, JPH::ColorArg inColor, const JobFunction& inJobFunction, JPH::uint32 inNumDependencies = 0) override;
+
+    protected:
+        void QueueJob(Job* inJob) override;
+        void QueueJobs(Job** inJobs, JPH::uint inNumJobs) override;
+        void FreeJob(Job* inJob) override;
+
+    private:
+        using AvailableJobs = JPH::FixedSizeFreeList<Job>;
+
+        async::Executor::Ptr m_executor;
+        AvailableJobs m_jobs;
+        // The jobs scheduled on the executor and not released yet.
+        std::atomic<JPH::uint32> m_scheduledJobsCount = 0;
+    };
+}  // namespace nau::physics::jolt
@@ -3,6 +3,8 @@
 
 #include "nau/physics/jolt/jolt_physics_assets.h"
 
+#include "nau/physics/jolt/jolt_cooked_shapes.h"
+
 namespace nau::physics::jolt
 {
     namespace
@@ -62,6 +64,16 @@ namespace nau::physics::jolt
             }
         }
 
+        JPH::ShapeRefC getShapeOrLogError(const JPH::ShapeSettings::ShapeResult& shapeResult)
+        {
+            if (shapeResult.HasError())
+            {
+                NAU_LOG_ERROR(shapeResult.GetError());
+                return nullptr;
+            }
+
+            return shapeResult.Get();
+        }
     }  // namespace
 
     JoltConvexHullAssetView::JoltConvexHullAssetView(IMeshAssetAccessor& meshAccessor)
@@ -70,26 +82,17 @@ namespace nau::physics::jolt
         JPH::IndexedTriangleList triangles;
         fillMeshTopology(meshAccessor, positions, triangles);
 
-        JPH::Array<JPH::Vec3> chPoints(triangles.size() * 3);
-        size_t idx = 0;
-        for (const JPH::IndexedTriangle& tri : triangles)
-        {
-            const JPH::Float3& p0 = positions[tri.mIdx[0]];
-            const JPH::Float3& p1 = positions[tri.mIdx[1]];
-            const JPH::Float3& p2 = positions[tri.mIdx[2]];
-
-            chPoints[idx++] = JPH::Vec3{p0.x, p0.y, p0.z};
-            chPoints[idx++] = JPH::Vec3{p1.x, p1.y, p1.z};;
-            chPoints[idx++] = JPH::Vec3{p2.x, p2.y, p2.z};;
-        }
+        m_shape = getShapeOrLogError(cooked_shapes::createConvexHullShape(positions));
+    }
 
-        m_convexHullShapeSettings.emplace(std::move(chPoints));
+    JoltConvexHullAssetView::JoltConvexHullAssetView(JPH::ShapeRefC cookedShape) :
+        m_shape(std::move(cookedShape))
+    {
     }
 
-    JPH::ConvexHullShapeSettings& JoltConvexHullAssetView::getShapeSettings()
+    JPH::ShapeRefC JoltConvexHullAssetView::getShape() const
     {
-        NAU_FATAL(m_convexHullShapeSettings);
-        return *m_convexHullShapeSettings;
+        return m_shape;
     }
 
     JoltTriMeshAssetView::JoltTriMeshAssetView(IMeshAssetAccessor& meshAccessor)
@@ -98,12 +101,16 @@ namespace nau::physics::jolt
         JPH::IndexedTriangleList triangles;
         fillMeshTopology(meshAccessor, positions, triangles);
 
-        m_meshShapeSettings.emplace(std::move(positions), std::move(triangles));
+        m_shape = getShapeOrLogError(cooked_shapes::createTriMeshShape(std::move(positions), std::move(triangles)));
+    }
+
+    JoltTriMeshAssetView::JoltTriMeshAssetView(JPH::ShapeRefC cookedShape) :
+        m_shape(std::move(cookedShape))
+    {
     }
 
-    JPH::MeshShapeSettings& JoltTriMeshAssetView::getShapeSettings()
+    JPH::ShapeRefC JoltTriMeshAssetView::getShape() const
     {
-        NAU_FATAL(m_meshShapeSettings);
-        return *m_meshShapeSettings;
+        return m_shape;
     }
-}  // namespace nau::physics::jolt
\ No newline at end of file
+}  // namespace nau::physics::jolt
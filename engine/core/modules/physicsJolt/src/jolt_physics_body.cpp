@@ -20,22 +20,27 @@
 namespace nau::physics::jolt
 {
     JoltPhysicsBody::JoltPhysicsBody(Ptr<JoltPhysicsWorld> physWorld,
-        Uid originObjectUid, const PhysicsBodyCreationData& creationData)
+        Uid originObjectUid, const PhysicsBodyCreationData& creationData, bool addToWorld)
         : m_physWorld(std::move(physWorld))
         , m_sceneObjectUid(originObjectUid)
     {
         NAU_ASSERT(m_physWorld);
 
-        initializeJoltBody(creationData);
+        initializeJoltBody(creationData, addToWorld);
     }
 
     JoltPhysicsBody::~JoltPhysicsBody()
     {
-        if (m_physWorld && m_physWorld->getBodyInterface().IsAdded(m_bodyId))
+        if (!m_physWorld || m_bodyId.IsInvalid())
+        {
+            return;
+        }
+
+        if (m_physWorld->getBodyInterface().IsAdded(m_bodyId))
         {
             m_physWorld->getBodyInterface().RemoveBody(m_bodyId);
-            m_physWorld->getBodyInterface().DestroyBody(m_bodyId);
         }
+        m_physWorld->getBodyInterface().DestroyBody(m_bodyId);
     }
 
     void JoltPhysicsBody::getTransform(math::mat4& transform) const
@@ -128,7 +133,12 @@ namespace nau::physics::jolt
         return m_sceneObjectUid;
     }
 
-    void JoltPhysicsBody::initializeJoltBody(const PhysicsBodyCreationData& creationData)
+    JPH::BodyID JoltPhysicsBody::getBodyId() const
+    {
+        return m_bodyId;
+    }
+
+    void JoltPhysicsBody::initializeJoltBody(const PhysicsBodyCreationData& creationData, bool addToWorld)
     {
         NAU_ASSERT(creationData.collisionShape);
         if (!creationData.collisionShape)
@@ -199,7 +209,10 @@ namespace nau::physics::jolt
             joltBody->SetUserData(reinterpret_cast<uint64_t>(this));
 
             m_debugDrawEnabled = creationData.debugDraw;
-            m_physWorld->getBodyInterface().AddBody(m_bodyId, JPH::EActivation::Activate);
+            if (addToWorld)
+            {
+                m_physWorld->getBodyInterface().AddBody(m_bodyId, JPH::EActivation::Activate);
+            }
         }
     }
 
@@ -113,14 +113,10 @@ namespace nau::physics::jolt
         NAU_ASSERT(m_convexHullAsset);
         if (m_convexHullAsset)
         {
-            JPH::ShapeSettings::ShapeResult shapeResult = m_convexHullAsset->getShapeSettings().Create();
-            if (!shapeResult.HasError())
+            // The shape is shared by all colliders of the asset.
+            if (JPH::ShapeRefC shape = m_convexHullAsset->getShape())
             {
-                setCollisionShape(shapeResult.Get());
-            }
-            else
-            {
-                NAU_LOG_ERROR(shapeResult.GetError());
+                setCollisionShape(std::move(shape));
             }
         }
     }
@@ -159,14 +155,10 @@ namespace nau::physics::jolt
         NAU_ASSERT(m_meshAsset);
         if (m_meshAsset)
         {
-            JPH::ShapeSettings::ShapeResult shapeResult = m_meshAsset->getShapeSettings().Create();
-            if (!shapeResult.HasError())
-            {
-                setCollisionShape(shapeResult.Get());
-            }
-            else
+            // The shape is shared by all colliders of the asset.
+            if (JPH::ShapeRefC shape = m_meshAsset->getShape())
             {
-                NAU_LOG_ERROR(shapeResult.GetError());
+                setCollisionShape(std::move(shape));
             }
         }
     }
@@ -7,11 +7,15 @@
 #include "nau/physics/physics_defines.h"
 
 #include <Jolt/Jolt.h>
+#include <Jolt/Physics/Body/Body.h>
+#include <Jolt/Physics/Body/BodyFilter.h>
 #include <Jolt/Physics/Collision/BroadPhase/BroadPhaseLayer.h>
 #include <Jolt/Physics/Collision/ObjectLayer.h>
 
-#include <EASTL/vector.h>
+#include <EASTL/algorithm.h>
 #include <EASTL/set.h>
+#include <EASTL/span.h>
+#include <EASTL/vector.h>
 
 namespace nau::physics::jolt
 {
@@ -45,4 +49,45 @@ namespace nau::physics::jolt
         eastl::set<nau::physics::CollisionChannel> m_interestLayers;
     };
 
+    /**
+     * Allows all channels(if none specified) or only specified ones.
+     * Unlike DefaultRayCastChannelFilter does not copy the channels, so it is used by the batched queries that must not allocate.
+     */
+    class SpanChannelFilter : public JPH::ObjectLayerFilter
+    {
+    public:
+        SpanChannelFilter(eastl::span<const nau::physics::CollisionChannel> interestLayers)
+            : m_interestLayers(interestLayers)
+        {
+        }
+
+        bool ShouldCollide(JPH::ObjectLayer layer) const override
+        {
+            return m_interestLayers.empty() || eastl::find(m_interestLayers.begin(), m_interestLayers.end(), layer) != m_interestLayers.end();
+        }
+
+    private:
+        eastl::span<const nau::physics::CollisionChannel> m_interestLayers;
+    };
+
+    /**
+     * Rejects sensor bodies (triggers) if asked to.
+     */
+    class TriggersBodyFilter : public JPH::BodyFilter
+    {
+    public:
+        TriggersBodyFilter(bool ignoreTriggers)
+            : m_ignoreTriggers(ignoreTriggers)
+        {
+        }
+
+        bool ShouldCollideLocked(const JPH::Body& body) const override
+        {
+            return !m_ignoreTriggers || !body.IsSensor();
+        }
+
+    private:
+        bool m_ignoreTriggers;
+    };
+
 }  // namespace nau::physics::jolt
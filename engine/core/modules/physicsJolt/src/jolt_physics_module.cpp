@@ -3,6 +3,7 @@
 
 
 #include "jolt_asset_factory.h"
+#include "jolt_cooked_shapes_container.h"
 #include "jolt_physics_collision_shapes_factory.h"
 #include "nau/module/module.h"
 #include "nau/physics/jolt/jolt_physics_world.h"
@@ -24,6 +25,7 @@ namespace nau
             NAU_MODULE_EXPORT_CLASS(physics::jolt::JoltPhysicsWorld);
             NAU_MODULE_EXPORT_CLASS(physics::jolt::JoltPhysicsCollisionShapesFactory);
             NAU_MODULE_EXPORT_SERVICE(physics::jolt::JoltAssetFactory);
+            NAU_MODULE_EXPORT_SERVICE(physics::jolt::JoltCookedShapesContainerLoader);
         }
     };
 }  // namespace nau
@@ -4,20 +4,30 @@
 
 #include "nau/physics/jolt/jolt_physics_world.h"
 
-#include <Jolt/Core/JobSystemSingleThreaded.h>
 #include <Jolt/Core/Memory.h>
 #include <Jolt/Core/TempAllocator.h>
 #include <Jolt/Jolt.h>
 #include <Jolt/Physics/Collision/BroadPhase/BroadPhaseLayerInterfaceTable.h>
 #include <Jolt/Physics/Collision/CastResult.h>
+#include <Jolt/Physics/Collision/CollideShape.h>
+#include <Jolt/Physics/Collision/CollisionCollectorImpl.h>
 #include <Jolt/Physics/Collision/ContactListener.h>
 #include <Jolt/Physics/Collision/ObjectLayerPairFilterTable.h>
 #include <Jolt/Physics/Collision/RayCast.h>
+#include <Jolt/Physics/Collision/Shape/BoxShape.h>
+#include <Jolt/Physics/Collision/Shape/CapsuleShape.h>
+#include <Jolt/Physics/Collision/Shape/SphereShape.h>
+#include <Jolt/Physics/Collision/ShapeCast.h>
 #include <Jolt/Physics/PhysicsSettings.h>
 #include <Jolt/Physics/PhysicsSystem.h>
+#include <Jolt/Physics/StateRecorder.h>
 #include <Jolt/RegisterTypes.h>
 
+#include "jolt_job_system.h"
 #include "jolt_physics_layers.h"
+#include "nau/async/parallel_for.h"
+#include "nau/async/thread_pool_executor.h"
+#include "nau/app/global_properties.h"
 #include "nau/diag/assertion.h"
 #include "nau/physics/internal/core_physics_internal.h"
 #include "nau/physics/jolt/jolt_physics_body.h"
@@ -31,7 +41,8 @@ namespace nau::physics::jolt
     namespace
     {
         constexpr int JOLT_TEMP_ALLOC_SIZE = 1 << 20;
-        constexpr int JOLT_MAX_JOBS = 32;
+        constexpr int JOLT_MAX_JOBS = JPH::cMaxPhysicsJobs;
+        constexpr int JOLT_MAX_BARRIERS = JPH::cMaxPhysicsBarriers;
 
         constexpr int JOLT_SETTING_MAX_BODIES = 16384;
         constexpr int JOLT_SETTING_NUM_BODY_MUTEXES = 32;
@@ -45,10 +56,241 @@ namespace nau::physics::jolt
 
         constexpr unsigned JOLT_SETTING_OBJECT_LAYERS_COUNTS = 1000;
 
+        /**
+         * Bulk insertion leaves the broad phase tree unbalanced, the batches of at least that many bodies are followed by its optimization.
+         */
+        constexpr size_t JOLT_OPTIMIZE_BROAD_PHASE_BATCH_SIZE = 256;
+
         static const JPH::Vec3 gravityAcceleration{.0f, -9.81f, .0f};
+
+        std::atomic<uint64_t> worldsCounter = 0;
+
+        /**
+         * The executor of the physics jobs, set by "/physics/jolt/workerThreadsCount":
+         * the default executor if not set, a dedicated pool of the threads count if positive, the updating thread only if 0.
+         */
+        async::Executor::Ptr createJobsExecutor()
+        {
+            eastl::optional<int> workerThreadsCount;
+            if (getServiceProvider().has<GlobalProperties>())
+            {
+                workerThreadsCount = getServiceProvider().get<GlobalProperties>().getValue<int>("/physics/jolt/workerThreadsCount");
+            }
+
+            if (!workerThreadsCount)
+            {
+                return async::Executor::getDefault();
+            }
+
+            if (*workerThreadsCount > 0)
+            {
+                return async::createThreadPoolExecutor("Physics", static_cast<size_t>(*workerThreadsCount));
+            }
+
+            return nullptr;
+        }
+
+        /**
+         * Writes the Jolt state into the snapshot buffer, so a reused snapshot is captured without allocations.
+         */
+        class SnapshotStateWriter final : public JPH::StateRecorder
+        {
+        public:
+            explicit SnapshotStateWriter(eastl::vector<std::byte>& data) :
+                m_data(data)
+            {
+            }
+
+            void WriteBytes(const void* inData, size_t inNumBytes) override
+            {
+                const auto* const bytes = reinterpret_cast<const std::byte*>(inData);
+                m_data.insert(m_data.end(), bytes, bytes + inNumBytes);
+            }
+
+            void ReadBytes([[maybe_unused]] void* outData, [[maybe_unused]] size_t inNumBytes) override
+            {
+                NAU_FAILURE("The snapshot writer can not be read");
+            }
+
+            bool IsEOF() const override
+            {
+                return true;
+            }
+
+            bool IsFailed() const override
+            {
+                return false;
+            }
+
+        private:
+            eastl::vector<std::byte>& m_data;
+        };
+
+        /**
+         * Reads the Jolt state back from the snapshot buffer.
+         */
+        class SnapshotStateReader final : public JPH::StateRecorder
+        {
+        public:
+            explicit SnapshotStateReader(const eastl::vector<std::byte>& data) :
+                m_data(data)
+            {
+            }
+
+            void WriteBytes([[maybe_unused]] const void* inData, [[maybe_unused]] size_t inNumBytes) override
+            {
+                NAU_FAILURE("The snapshot reader can not be written");
+            }
+
+            void ReadBytes(void* outData, size_t inNumBytes) override
+            {
+                if (m_failed || m_offset + inNumBytes > m_data.size())
+                {
+                    m_failed = true;
+                    memset(outData, 0, inNumBytes);
+                    return;
+                }
+
+                memcpy(outData, m_data.data() + m_offset, inNumBytes);
+                m_offset += inNumBytes;
+            }
+
+            bool IsEOF() const override
+            {
+                return m_offset >= m_data.size();
+            }
+
+            bool IsFailed() const override
+            {
+                return m_failed;
+            }
+
+        private:
+            const eastl::vector<std::byte>& m_data;
+            size_t m_offset = 0;
+            bool m_failed = false;
+        };
+
+        /**
+         * Selects the bodies to capture and records their ids, to sync them to the scene after a restore.
+         */
+        class SnapshotStateFilter final : public JPH::StateRecorderFilter
+        {
+        public:
+            SnapshotStateFilter(PhysicsSnapshotScope scope, eastl::vector<uint32_t>& bodyIds) :
+                m_scope(scope),
+                m_bodyIds(bodyIds)
+            {
+            }
+
+            bool ShouldSaveBody(const JPH::Body& inBody) const override
+            {
+                if (m_scope == PhysicsSnapshotScope::ActiveBodies && !inBody.IsActive())
+                {
+                    return false;
+                }
+
+                m_bodyIds.push_back(inBody.GetID().GetIndexAndSequenceNumber());
+                return true;
+            }
+
+        private:
+            const PhysicsSnapshotScope m_scope;
+            eastl::vector<uint32_t>& m_bodyIds;
+        };
+
+        /**
+         * Builds the Jolt shape of the query on the stack and passes it to fn(const JPH::Shape&).
+         * The shape is embedded, so it is never reference counted nor released.
+         */
+        template <typename F>
+        void withQueryShape(const QueryShape& queryShape, F&& fn)
+        {
+            switch (queryShape.type)
+            {
+                case QueryShape::Type::Box:
+                {
+                    const JPH::Vec3 halfExtent = vec3ToJolt(queryShape.halfExtent);
+                    JPH::BoxShape shape(halfExtent, std::min(JPH::cDefaultConvexRadius, halfExtent.ReduceMin()));
+                    shape.SetEmbedded();
+                    fn(static_cast<const JPH::Shape&>(shape));
+                    break;
+                }
+                case QueryShape::Type::Capsule:
+                {
+                    JPH::CapsuleShape shape(queryShape.halfHeight, queryShape.radius);
+                    shape.SetEmbedded();
+                    fn(static_cast<const JPH::Shape&>(shape));
+                    break;
+                }
+                default:
+                {
+                    JPH::SphereShape shape(queryShape.radius);
+                    shape.SetEmbedded();
+                    fn(static_cast<const JPH::Shape&>(shape));
+                    break;
+                }
+            }
+        }
+
+        Uid getBodySceneObjectUid(const JPH::Body& body)
+        {
+            const auto* const joltBody = reinterpret_cast<const JoltPhysicsBody*>(body.GetUserData());
+            return joltBody ? joltBody->getSceneObjectUid() : NullUid;
+        }
+
+        /**
+         * Writes the overlapped bodies of a single query into the shared hits buffer.
+         *
+         * Jolt calls AddHit with the hit body locked, so the body is read through the non locking interface.
+         */
+        class OverlapHitsCollector final : public JPH::CollideShapeCollector
+        {
+        public:
+            OverlapHitsCollector(uint32_t queryId, eastl::span<SceneQueryHit> hits, std::atomic<size_t>& hitsCount, const JPH::BodyLockInterface& bodyLockInterface) :
+                m_queryId(queryId),
+                m_hits(hits),
+                m_hitsCount(hitsCount),
+                m_bodyLockInterface(bodyLockInterface)
+            {
+            }
+
+            void AddHit(const JPH::CollideShapeResult& result) override
+            {
+                // The sub shapes of a body are reported one after another: keep a single hit per body.
+                if (result.mBodyID2 == m_lastBodyId)
+                {
+                    return;
+                }
+                m_lastBodyId = result.mBodyID2;
+
+                const size_t hitIndex = m_hitsCount.fetch_add(1, std::memory_order_relaxed);
+                if (hitIndex >= m_hits.size())
+                {
+                    ForceEarlyOut();
+                    return;
+                }
+
+                JPH::BodyLockRead lock(m_bodyLockInterface, result.mBodyID2);
+                SceneQueryHit& hit = m_hits[hitIndex];
+                hit.queryId = m_queryId;
+                hit.sceneObjectUid = lock.Succeeded() ? getBodySceneObjectUid(lock.GetBody()) : NullUid;
+                hit.position = joltVec3ToNauVec3(result.mContactPointOn2);
+                hit.normal = joltVec3ToNauVec3(-result.mPenetrationAxis.NormalizedOr(JPH::Vec3::sZero()));
+                hit.distance = result.mPenetrationDepth;
+            }
+
+        private:
+            const uint32_t m_queryId;
+            const eastl::span<SceneQueryHit> m_hits;
+            std::atomic<size_t>& m_hitsCount;
+            const JPH::BodyLockInterface& m_bodyLockInterface;
+            JPH::BodyID m_lastBodyId;
+        };
     };  // namespace
 
-    JoltPhysicsWorld::JoltPhysicsWorld()
+    JoltPhysicsWorld::JoltPhysicsWorld() :
+        m_worldId(++worldsCounter)
     {
         JPH::RegisterDefaultAllocator();
         JPH::Factory::sInstance = new JPH::Factory;
@@ -72,7 +314,7 @@ namespace nau::physics::jolt
         m_joltDebugRender = eastl::make_unique<DebugRendererImp>();
 
         m_joltPhysicsSystem = eastl::make_unique<JPH::PhysicsSystem>();
-        m_joltJobSystem = eastl::make_unique<JPH::JobSystemSingleThreaded>(JOLT_MAX_JOBS);
+        m_joltJobSystem = eastl::make_unique<JoltJobSystem>(createJobsExecutor(), JOLT_MAX_JOBS, JOLT_MAX_BARRIERS);
         m_joltTempAllocator = eastl::make_unique<JPH::TempAllocatorImpl>(JOLT_TEMP_ALLOC_SIZE);
 
         m_joltPhysicsSystem->Init(
@@ -87,6 +329,7 @@ namespace nau::physics::jolt
         m_joltPhysicsSystem->SetPhysicsSettings(JPH::PhysicsSettings{});
         m_joltPhysicsSystem->SetGravity(gravityAcceleration);
         m_joltPhysicsSystem->SetContactListener(this);
+        m_joltPhysicsSystem->SetBodyActivationListener(this);
     }
 
     JoltPhysicsWorld::~JoltPhysicsWorld()
@@ -98,6 +341,7 @@ namespace nau::physics::jolt
     void JoltPhysicsWorld::tick(float dt)
     {
         m_joltPhysicsSystem->Update(dt, m_collisionStepsCount, m_joltTempAllocator.get(), m_joltJobSystem.get());
+        mergeContactEvents();
     }
 
     nau::Ptr<IPhysicsBody> JoltPhysicsWorld::createBody(Uid sceneObjectUid, const PhysicsBodyCreationData& creationData)
@@ -105,6 +349,47 @@ namespace nau::physics::jolt
         return rtti::createInstance<JoltPhysicsBody>(this, sceneObjectUid, creationData);
     }
 
+    eastl::vector<nau::Ptr<IPhysicsBody>> JoltPhysicsWorld::createBodies(eastl::span<const Uid> sceneObjectUids, eastl::span<const PhysicsBodyCreationData> creationData)
+    {
+        NAU_ASSERT(sceneObjectUids.size() == creationData.size());
+
+        eastl::vector<nau::Ptr<IPhysicsBody>> bodies;
+        bodies.reserve(creationData.size());
+
+        eastl::vector<JPH::BodyID> bodyIds;
+        bodyIds.reserve(creationData.size());
+
+        for (size_t i = 0; i < creationData.size(); ++i)
+        {
+            auto body = rtti::createInstance<JoltPhysicsBody>(this, sceneObjectUids[i], creationData[i], false);
+            if (body->getBodyId().IsInvalid())
+            {
+                bodies.emplace_back(nullptr);
+                continue;
+            }
+
+            bodyIds.push_back(body->getBodyId());
+            bodies.emplace_back(std::move(body));
+        }
+
+        if (bodyIds.empty())
+        {
+            return bodies;
+        }
+
+        JPH::BodyInterface& bodyInterface = getBodyInterface();
+        const int bodiesCount = static_cast<int>(bodyIds.size());
+        JPH::BodyInterface::AddState addState = bodyInterface.AddBodiesPrepare(bodyIds.data(), bodiesCount);
+        bodyInterface.AddBodiesFinalize(bodyIds.data(), bodiesCount, addState, JPH::EActivation::Activate);
+
+        if (bodyIds.size() >= JOLT_OPTIMIZE_BROAD_PHASE_BATCH_SIZE)
+        {
+            m_joltPhysicsSystem->OptimizeBroadPhase();
+        }
+
+        return bodies;
+    }
+
     void JoltPhysicsWorld::setChannelsCollidable(CollisionChannel channelA, CollisionChannel channelB, bool collidable)
     {
         NAU_ASSERT(m_layerPairFilter);
@@ -128,6 +413,7 @@ namespace nau::physics::jolt
     void JoltPhysicsWorld::setContactListener(nau::Ptr<IPhysicsContactListener> listener)
     {
         m_engineContactListener = eastl::move(listener);
+        m_isContactListenerSet.store(static_cast<bool>(m_engineContactListener), std::memory_order_relaxed);
     }
 
     JPH::BodyInterface& JoltPhysicsWorld::getBodyInterface() const
@@ -292,6 +578,147 @@ namespace nau::physics::jolt
         co_return castResults;
     }
 
+    void JoltPhysicsWorld::castRays(eastl::span<const RayCastQuery> queries, eastl::span<SceneQueryHit> hits) const
+    {
+        NAU_ASSERT_RETURN(hits.size() >= queries.size());
+
+        const JPH::NarrowPhaseQuery& narrowPhaseQuery = m_joltPhysicsSystem->GetNarrowPhaseQuery();
+        const JPH::BodyLockInterface& bodyLockInterface = m_joltPhysicsSystem->GetBodyLockInterface();
+
+        async::parallelFor(queries.size(), 0, [&](size_t queryIndex)
+        {
+            const RayCastQuery& query = queries[queryIndex];
+            SceneQueryHit& result = hits[queryIndex];
+            result = SceneQueryHit{.queryId = query.id};
+
+            const JPH::RRayCast ray{vec3ToJolt(query.origin), vec3ToJolt(query.maxDistance * query.direction)};
+            const SpanChannelFilter channelFilter(query.reactChannels);
+            const TriggersBodyFilter bodyFilter(query.ignoreTriggers);
+
+            JPH::RayCastResult hit;
+            if (!narrowPhaseQuery.CastRay(ray, hit, {}, channelFilter, bodyFilter))
+            {
+                return;
+            }
+
+            JPH::BodyLockRead lock(bodyLockInterface, hit.mBodyID);
+            if (!lock.Succeeded())
+            {
+                return;
+            }
+
+            const JPH::Body& hitBody = lock.GetBody();
+            const JPH::Vec3 hitPosition = ray.GetPointOnRay(hit.mFraction);
+
+            result.sceneObjectUid = getBodySceneObjectUid(hitBody);
+            result.position = joltVec3ToNauVec3(hitPosition);
+            result.normal = joltVec3ToNauVec3(hitBody.GetWorldSpaceSurfaceNormal(hit.mSubShapeID2, hitPosition));
+            result.distance = hit.mFraction * query.maxDistance;
+        });
+    }
+
+    void JoltPhysicsWorld::castShapes(eastl::span<const ShapeCastQuery> queries, eastl::span<SceneQueryHit> hits) const
+    {
+        NAU_ASSERT_RETURN(hits.size() >= queries.size());
+
+        const JPH::NarrowPhaseQuery& narrowPhaseQuery = m_joltPhysicsSystem->GetNarrowPhaseQuery();
+        const JPH::BodyLockInterface& bodyLockInterface = m_joltPhysicsSystem->GetBodyLockInterface();
+
+        async::parallelFor(queries.size(), 0, [&](size_t queryIndex)
+        {
+            const ShapeCastQuery& query = queries[queryIndex];
+            SceneQueryHit& result = hits[queryIndex];
+            result = SceneQueryHit{.queryId = query.id};
+
+            const SpanChannelFilter channelFilter(query.reactChannels);
+            const TriggersBodyFilter bodyFilter(query.ignoreTriggers);
+
+            JPH::ClosestHitCollisionCollector<JPH::CastShapeCollector> collector;
+            withQueryShape(query.shape, [&](const JPH::Shape& shape)
+            {
+                const JPH::RMat44 transform = JPH::RMat44::sRotationTranslation(quatToJolt(query.rotation), vec3ToJolt(query.origin));
+                const JPH::RShapeCast shapeCast = JPH::RShapeCast::sFromWorldTransform(&shape, JPH::Vec3::sReplicate(1.0f), transform,
+                                                                                       vec3ToJolt(query.maxDistance * query.direction));
+
+                narrowPhaseQuery.CastShape(shapeCast, {}, JPH::RVec3::sZero(), collector, {}, channelFilter, bodyFilter);
+            });
+
+            if (!collector.HadHit())
+            {
+                return;
+            }
+
+            const JPH::ShapeCastResult& hit = collector.mHit;
+            JPH::BodyLockRead lock(bodyLockInterface, hit.mBodyID2);
+            if (!lock.Succeeded())
+            {
+                return;
+            }
+
+            result.sceneObjectUid = getBodySceneObjectUid(lock.GetBody());
+            result.position = joltVec3ToNauVec3(hit.mContactPointOn2);
+            result.normal = joltVec3ToNauVec3(-hit.mPenetrationAxis.NormalizedOr(JPH::Vec3::sZero()));
+            result.distance = hit.mFraction * query.maxDistance;
+        });
+    }
+
+    size_t JoltPhysicsWorld::overlapShapes(eastl::span<const ShapeOverlapQuery> queries, eastl::span<SceneQueryHit> hits) const
+    {
+        const JPH::NarrowPhaseQuery& narrowPhaseQuery = m_joltPhysicsSystem->GetNarrowPhaseQuery();
+        const JPH::BodyLockInterface& bodyLockInterfaceNoLock = m_joltPhysicsSystem->GetBodyLockInterfaceNoLock();
+
+        std::atomic<size_t> hitsCount = 0;
+
+        async::parallelFor(queries.size(), 0, [&](size_t queryIndex)
+        {
+            const ShapeOverlapQuery& query = queries[queryIndex];
+
+            const SpanChannelFilter channelFilter(query.reactChannels);
+            const TriggersBodyFilter bodyFilter(query.ignoreTriggers);
+
+            OverlapHitsCollector collector(query.id, hits, hitsCount, bodyLockInterfaceNoLock);
+            withQueryShape(query.shape, [&](const JPH::Shape& shape)
+            {
+                const JPH::RMat44 transform = JPH::RMat44::sRotationTranslation(quatToJolt(query.rotation), vec3ToJolt(query.origin));
+                narrowPhaseQuery.CollideShape(&shape, JPH::Vec3::sReplicate(1.0f), transform, {}, JPH::RVec3::sZero(), collector, {}, channelFilter, bodyFilter);
+            });
+        });
+
+        return std::min(hitsCount.load(std::memory_order_relaxed), hits.size());
+    }
+
+    void JoltPhysicsWorld::saveState(PhysicsWorldSnapshot& snapshot, PhysicsSnapshotScope scope) const
+    {
+        snapshot.data.clear();
+        snapshot.bodyIds.clear();
+        snapshot.scope = scope;
+
+        SnapshotStateWriter writer(snapshot.data);
+        const SnapshotStateFilter filter(scope, snapshot.bodyIds);
+        m_joltPhysicsSystem->SaveState(writer, JPH::EStateRecorderState::All, &filter);
+    }
+
+    bool JoltPhysicsWorld::restoreState(const PhysicsWorldSnapshot& snapshot)
+    {
+        NAU_ASSERT(!snapshot.empty(), "The snapshot was never captured");
+
+        SnapshotStateReader reader(snapshot.data);
+        if (!m_joltPhysicsSystem->RestoreState(reader))
+        {
+            NAU_LOG_ERROR("Failed to restore the physics world state");
+            return false;
+        }
+
+        // The restored bodies may be asleep now, report them as deactivated so the scene gets their restored transforms.
+        JPH::lock_guard lock(m_deactivatedBodiesGuard);
+        for (const uint32_t bodyId : snapshot.bodyIds)
+        {
+            m_deactivatedBodies.push_back(JPH::BodyID{bodyId});
+        }
+
+        return true;
+    }
+
     void JoltPhysicsWorld::drawDebug(nau::DebugRenderSystem& dr)
     {
         m_joltDebugRender->setDebugRenderer(&dr);
@@ -310,107 +737,179 @@ namespace nau::physics::jolt
     {
         handleBodiesContact(body1, body2, manifold, settings);
 
-        // TODO: thread unsafe access (for m_engineContactListener)
-        if (m_engineContactListener)
+        if (!m_isContactListenerSet.load(std::memory_order_relaxed))
         {
-            const auto& jBody1 = *reinterpret_cast<JoltPhysicsBody*>(body1.GetUserData());
-            const auto& jBody2 = *reinterpret_cast<JoltPhysicsBody*>(body2.GetUserData());
-
-            // Get friction and restitution from custom material or from bodies.
-            auto [friction1, restitution1, mat1] = getFrictionAndRestitution(body1, manifold.mSubShapeID1);
-            auto [friction2, restitution2, mat2] = getFrictionAndRestitution(body2, manifold.mSubShapeID2);
-
-            JPH::lock_guard lock(m_bodiesInContactGuard);
-            auto itContacts = m_bodiesInContact.find({body1.GetID(), body2.GetID()});
-            if (itContacts == m_bodiesInContact.end())
-            {
-                ContactData data;
-                data.body1 = &jBody1;
-                data.body2 = &jBody2;
-
-                itContacts = m_bodiesInContact.insert({
-                                                          {body1.GetID(), body2.GetID()},
-                                                          data
-                })
-                                 .first;
-            }
-            ContactData& data = itContacts->second;
-            data.contacts.insert({body1.GetID(), manifold.mSubShapeID1, body2.GetID(), manifold.mSubShapeID2});
+            return;
+        }
 
-            {
-                auto& contactData = m_contactsData.emplace_back(ContactNotificationKind::Added);
-                contactData.object1 = {
-                    .sceneObjectUid = data.body1->getSceneObjectUid(),
-                    .material = mat1->engineMaterial()};
+        const auto& jBody1 = *reinterpret_cast<JoltPhysicsBody*>(body1.GetUserData());
+        const auto& jBody2 = *reinterpret_cast<JoltPhysicsBody*>(body2.GetUserData());
 
-                contactData.object2 = {
-                    .sceneObjectUid = data.body2->getSceneObjectUid(),
-                    .material = mat2->engineMaterial()};
+        // Get friction and restitution from custom material or from bodies.
+        auto [friction1, restitution1, mat1] = getFrictionAndRestitution(body1, manifold.mSubShapeID1);
+        auto [friction2, restitution2, mat2] = getFrictionAndRestitution(body2, manifold.mSubShapeID2);
 
-                contactData.collisionWorldPoints = calculateContactPoints(manifold);
-            }
-        }
+        ContactEventsBuffer& buffer = getThreadContactEvents();
+        const auto pointsOffset = static_cast<uint32_t>(buffer.points.size());
+        appendContactPoints(manifold, buffer.points);
+
+        buffer.events.push_back({
+            .kind = ContactNotificationKind::Added,
+            .bodyId1 = body1.GetID(),
+            .bodyId2 = body2.GetID(),
+            .sceneObjectUid1 = jBody1.getSceneObjectUid(),
+            .sceneObjectUid2 = jBody2.getSceneObjectUid(),
+            .material1 = mat1,
+            .material2 = mat2,
+            .pointsOffset = pointsOffset,
+            .pointsCount = static_cast<uint32_t>(buffer.points.size()) - pointsOffset});
     }
 
     void JoltPhysicsWorld::OnContactPersisted(const JPH::Body& body1, const JPH::Body& body2, const JPH::ContactManifold& manifold, JPH::ContactSettings& settings)
     {
         handleBodiesContact(body1, body2, manifold, settings);
 
-        // TODO: thread unsafe access (for m_engineContactListener)
-        if (m_engineContactListener)
+        if (!m_isContactListenerSet.load(std::memory_order_relaxed))
         {
-            const auto& jBody1 = *reinterpret_cast<JoltPhysicsBody*>(body1.GetUserData());
-            const auto& jBody2 = *reinterpret_cast<JoltPhysicsBody*>(body2.GetUserData());
+            return;
+        }
 
-            // Get friction and restitution from custom material or from bodies.
-            auto [friction1, restitution1, mat1] = getFrictionAndRestitution(body1, manifold.mSubShapeID1);
-            auto [friction2, restitution2, mat2] = getFrictionAndRestitution(body2, manifold.mSubShapeID2);
+        const auto& jBody1 = *reinterpret_cast<JoltPhysicsBody*>(body1.GetUserData());
+        const auto& jBody2 = *reinterpret_cast<JoltPhysicsBody*>(body2.GetUserData());
 
-            {
-                auto& contactData = m_contactsData.emplace_back(ContactNotificationKind::Continued);
-                contactData.object1 = {
-                    .sceneObjectUid = jBody1.getSceneObjectUid(),
-                    .material = mat1->engineMaterial()};
-
-                contactData.object2 = {
-                    .sceneObjectUid = jBody2.getSceneObjectUid(),
-                    .material = mat2->engineMaterial()};
+        // Get friction and restitution from custom material or from bodies.
+        auto [friction1, restitution1, mat1] = getFrictionAndRestitution(body1, manifold.mSubShapeID1);
+        auto [friction2, restitution2, mat2] = getFrictionAndRestitution(body2, manifold.mSubShapeID2);
 
-                contactData.collisionWorldPoints = calculateContactPoints(manifold);
-            }
-        }
+        ContactEventsBuffer& buffer = getThreadContactEvents();
+        const auto pointsOffset = static_cast<uint32_t>(buffer.points.size());
+        appendContactPoints(manifold, buffer.points);
+
+        buffer.events.push_back({
+            .kind = ContactNotificationKind::Continued,
+            .bodyId1 = body1.GetID(),
+            .bodyId2 = body2.GetID(),
+            .sceneObjectUid1 = jBody1.getSceneObjectUid(),
+            .sceneObjectUid2 = jBody2.getSceneObjectUid(),
+            .material1 = mat1,
+            .material2 = mat2,
+            .pointsOffset = pointsOffset,
+            .pointsCount = static_cast<uint32_t>(buffer.points.size()) - pointsOffset});
     }
 
     void JoltPhysicsWorld::OnContactRemoved(const JPH::SubShapeIDPair& subShapePair)
     {
-        // TODO: thread unsafe access (for m_engineContactListener)
-        if (!m_engineContactListener)
+        if (!m_isContactListenerSet.load(std::memory_order_relaxed))
         {
             return;
         }
 
-        JPH::lock_guard lock(m_bodiesInContactGuard);
-        auto itContacts = m_bodiesInContact.find({subShapePair.GetBody1ID(), subShapePair.GetBody2ID()});
-        if (itContacts == m_bodiesInContact.end())
+        getThreadContactEvents().events.push_back({
+            .kind = ContactNotificationKind::Removed,
+            .bodyId1 = subShapePair.GetBody1ID(),
+            .bodyId2 = subShapePair.GetBody2ID()});
+    }
+
+    JoltPhysicsWorld::ContactEventsBuffer& JoltPhysicsWorld::getThreadContactEvents()
+    {
+        struct ThreadContactEventsCache
         {
-            NAU_LOG_DEBUG("Unknown contact is reported as ended from physics system. That's not supposed to happened");
-            return;
+            uint64_t worldId = 0;
+            ContactEventsBuffer* buffer = nullptr;
+        };
+
+        // A thread alternating between the worlds takes the lock on each switch, which is fine for the usual single world.
+        thread_local ThreadContactEventsCache cache;
+        if (cache.worldId == m_worldId)
+        {
+            return *cache.buffer;
         }
 
-        ContactData& data = itContacts->second;
-        data.contacts.erase(subShapePair);
+        const std::thread::id threadId = std::this_thread::get_id();
+
+        JPH::lock_guard lock(m_contactEventsGuard);
+        auto existingBuffer = eastl::find_if(m_contactEvents.begin(), m_contactEvents.end(), [threadId](const auto& buffer)
+        {
+            return buffer->threadId == threadId;
+        });
+
+        ContactEventsBuffer* const buffer = existingBuffer != m_contactEvents.end()
+                                                ? existingBuffer->get()
+                                                : m_contactEvents.emplace_back(eastl::make_unique<ContactEventsBuffer>(ContactEventsBuffer{.threadId = threadId})).get();
+
+        cache = {m_worldId, buffer};
+        return *buffer;
+    }
 
-        const bool contactsBetweenBodiesCompleted = data.contacts.empty();
-        if (contactsBetweenBodiesCompleted)
+    void JoltPhysicsWorld::mergeContactEvents()
+    {
+        // The step is completed, no physics job writes to the buffers anymore.
+        // The removals are merged last: a body pair may lose one sub shape contact and gain another one within the same step.
+        for (const eastl::unique_ptr<ContactEventsBuffer>& buffer : m_contactEvents)
         {
-            auto& contactData = m_contactsData.emplace_back(ContactNotificationKind::Removed);
-            contactData.object1 = {
-                .sceneObjectUid = data.body1->getSceneObjectUid(),
-                .material = nullptr};
+            for (const ContactEvent& event : buffer->events)
+            {
+                if (event.kind == ContactNotificationKind::Removed)
+                {
+                    continue;
+                }
 
-            contactData.object2 = {
-                .sceneObjectUid = data.body2->getSceneObjectUid(),
-                .material = nullptr};
+                if (event.kind == ContactNotificationKind::Added)
+                {
+                    BodiesContact& bodiesContact = m_bodiesInContact[{event.bodyId1, event.bodyId2}];
+                    bodiesContact.sceneObjectUid1 = event.sceneObjectUid1;
+                    bodiesContact.sceneObjectUid2 = event.sceneObjectUid2;
+                    ++bodiesContact.subShapeContactsCount;
+                }
+
+                auto& contactData = m_contactsData.emplace_back(event.kind);
+                contactData.object1 = {
+                    .sceneObjectUid = event.sceneObjectUid1,
+                    .material = event.material1->engineMaterial()};
+
+                contactData.object2 = {
+                    .sceneObjectUid = event.sceneObjectUid2,
+                    .material = event.material2->engineMaterial()};
+
+                const auto points = buffer->points.begin() + event.pointsOffset;
+                contactData.collisionWorldPoints.assign(points, points + event.pointsCount);
+            }
+        }
+
+        for (const eastl::unique_ptr<ContactEventsBuffer>& buffer : m_contactEvents)
+        {
+            for (const ContactEvent& event : buffer->events)
+            {
+                if (event.kind != ContactNotificationKind::Removed)
+                {
+                    continue;
+                }
+
+                auto itContacts = m_bodiesInContact.find({event.bodyId1, event.bodyId2});
+                if (itContacts == m_bodiesInContact.end())
+                {
+                    NAU_LOG_DEBUG("Unknown contact is reported as ended from physics system. That's not supposed to happened");
+                    continue;
+                }
+
+                BodiesContact& bodiesContact = itContacts->second;
+                if (--bodiesContact.subShapeContactsCount == 0)
+                {
+                    auto& contactData = m_contactsData.emplace_back(ContactNotificationKind::Removed);
+                    contactData.object1 = {
+                        .sceneObjectUid = bodiesContact.sceneObjectUid1,
+                        .material = nullptr};
+
+                    contactData.object2 = {
+                        .sceneObjectUid = bodiesContact.sceneObjectUid2,
+                        .material = nullptr};
+
+                    m_bodiesInContact.erase(itContacts);
+                }
+            }
+
+            buffer->events.clear();
+            buffer->points.clear();
         }
     }
 
@@ -425,18 +924,15 @@ namespace nau::physics::jolt
         settings.mCombinedRestitution = eastl::max(restitution1, restitution2);
     }
 
-    eastl::vector<nau::math::vec3> JoltPhysicsWorld::calculateContactPoints(const JPH::ContactManifold& manifold)
+    void JoltPhysicsWorld::appendContactPoints(const JPH::ContactManifold& manifold, eastl::vector<nau::math::vec3>& points)
     {
         // At this moment we have only rigid bodies. For simplicity assume that two bodies don't penetrate into each other.
         // In this case manifold.mRelativeContactPointsOn1 and manifold.mRelativeContactPointsOn2 is the same.
-        eastl::vector<nau::math::vec3> result;
         for (JPH::uint idx = 0; idx < manifold.mRelativeContactPointsOn1.size(); ++idx)
         {
             const auto& point = manifold.GetWorldSpaceContactPointOn1(idx);
-            result.push_back({point.GetX(), point.GetY(), point.GetZ()});
+            points.push_back({point.GetX(), point.GetY(), point.GetZ()});
         }
-
-        return result;
     }
 
     void JoltPhysicsWorld::debugDrawLine(const nau::math::Point3& pos0, const nau::math::Point3& pos1, const nau::math::Color4& color, float time)
@@ -469,6 +965,50 @@ namespace nau::physics::jolt
                                  reinterpret_cast<const JoltPhysicsMaterial*>(JPH::PhysicsMaterial::sDefault.GetPtr()));
     }
 
+    void JoltPhysicsWorld::OnBodyActivated([[maybe_unused]] const JPH::BodyID& bodyId, [[maybe_unused]] JPH::uint64 bodyUserData)
+    {
+    }
+
+    void JoltPhysicsWorld::OnBodyDeactivated(const JPH::BodyID& bodyId, [[maybe_unused]] JPH::uint64 bodyUserData)
+    {
+        // The user data is not used: the body may be destroyed before the deactivated bodies are collected.
+        JPH::lock_guard lock(m_deactivatedBodiesGuard);
+        m_deactivatedBodies.push_back(bodyId);
+    }
+
+    void JoltPhysicsWorld::collectMovedBodies(eastl::vector<IPhysicsBody*>& bodies)
+    {
+        bodies.clear();
+
+        m_joltPhysicsSystem->GetActiveBodies(JPH::EBodyType::RigidBody, m_activeBodies);
+
+        const JPH::BodyLockInterface& bodyLockInterface = m_joltPhysicsSystem->GetBodyLockInterfaceNoLock();
+        auto collectBody = [&](const JPH::BodyID& bodyId)
+        {
+            JPH::BodyLockRead lock(bodyLockInterface, bodyId);
+            if (lock.Succeeded())
+            {
+                if (auto* const joltBody = reinterpret_cast<JoltPhysicsBody*>(lock.GetBody().GetUserData()))
+                {
+                    bodies.push_back(joltBody);
+                }
+            }
+        };
+
+        for (const JPH::BodyID& bodyId : m_activeBodies)
+        {
+            collectBody(bodyId);
+        }
+
+        JPH::lock_guard lock(m_deactivatedBodiesGuard);
+        for (const JPH::BodyID& bodyId : m_deactivatedBodies)
+        {
+            collectBody(bodyId);
+        }
+
+        m_deactivatedBodies.clear();
+    }
+
     void JoltPhysicsWorld::syncSceneState()
     {
         using namespace nau::scene;
@@ -499,7 +1039,7 @@ namespace nau::physics::jolt
                     continue;
                 }
 
-                RigidBodyComponent* const rb2 = object1->as<SceneObject&>().findFirstComponent<RigidBodyComponent>();
+                RigidBodyComponent* const rb2 = object2->as<SceneObject&>().findFirstComponent<RigidBodyComponent>();
                 if (!rb2)
                 {
                     NAU_LOG_WARNING("Contact notification, but rigid body does not exists:({})", object2->as<SceneObject&>().getName());
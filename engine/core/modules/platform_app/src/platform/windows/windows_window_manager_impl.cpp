@@ -101,7 +101,7 @@ namespace nau
 
     Result<> WindowsWindowManager::pumpMessageQueue(bool waitForMessage, std::optional<std::chrono::milliseconds> maxProcessingTime)
     {
-        // TODO Tracy        NAU_CPU_SCOPED_TAG(nau::PerfTag::Platform);
+        NAU_CPU_SCOPED_TAG(nau::PerfTag::Platform);
         if (!checkAppThread())
         {
             return NauMakeError("Invalid thread");
@@ -191,7 +191,7 @@ namespace nau
 
     void WindowsWindowManager::processAsyncInvocations()
     {
-// TODO Tracy        NAU_CPU_SCOPED_TAG(nau::PerfTag::Platform);
+        NAU_CPU_SCOPED_TAG(nau::PerfTag::Platform);
         using namespace nau::async;
 
         eastl::vector<Executor::Invocation> invocations;
@@ -220,8 +220,9 @@ namespace nau
         }
     }
 
-    void WindowsWindowManager::waitAnyActivity() noexcept
+    bool WindowsWindowManager::waitAnyActivity([[maybe_unused]] std::optional<std::chrono::milliseconds> timeout) noexcept
     {
+        return true;
     }
 
     void WindowsWindowManager::scheduleInvocation(Invocation invocation) noexcept
@@ -268,7 +269,7 @@ namespace nau
 
     bool WindowsWindowManager::handleWindowMessage(WindowsWindow& window, HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam)
     {
-// TODO Tracy NAU_CPU_SCOPED_TAG(nau::PerfTag::Platform);
+        NAU_CPU_SCOPED_TAG(nau::PerfTag::Platform);
         if (message == WM_CLOSE)
         {
             if (window.exitAppOnClose())
@@ -43,7 +43,7 @@ namespace nau
 
         nau::Ptr<IPlatformWindow> createWindow(bool exitAppOnClose) override;
 
-        void waitAnyActivity() noexcept override;
+        bool waitAnyActivity(std::optional<std::chrono::milliseconds> timeout) noexcept override;
 
         void scheduleInvocation(Invocation) noexcept override;
 
@@ -394,6 +394,30 @@ enum
   // par2: uint64_t*
   DRV3D_COMMAND_GET_BUFFER_GPU_ADDRESS,
 
+  // par1: PrewarmPipelineCache*
+  DRV3D_COMMAND_PREWARM_PIPELINE_CACHE,
+
+  // par1: PipelinePrewarmProgress*
+  // Returns 0 when the driver has no pipeline cache to prewarm.
+  DRV3D_COMMAND_GET_PIPELINE_PREWARM_PROGRESS,
+
+  // par1: Drv3dDrawStats*, the counters of the last presented frame
+  // Returns 0 when the driver does not count the draws.
+  DRV3D_COMMAND_GET_FRAME_DRAW_STATS,
+
+  // par1: Drv3dDrawStats*, the counters of the frame being recorded so far (the per pass counts are the differences)
+  // Returns 0 when the driver does not count the draws.
+  DRV3D_COMMAND_GET_CURRENT_DRAW_STATS,
+
+  // par1: Drv3dGpuMemoryReport*, the snapshot of the video memory use
+  // par2: Drv3dGpuMemoryOwnerVisitor* (optional), visits every texture and buffer with its owner name and size
+  // Returns 0 when the driver does not track its memory.
+  DRV3D_COMMAND_GET_GPU_MEMORY_REPORT,
+
+  // par1: Drv3dGpuMemoryBudgetCallback*, null to remove the callback
+  // Returns 0 when the driver does not observe the memory budget.
+  DRV3D_COMMAND_SET_GPU_MEMORY_BUDGET_CALLBACK,
+
   DRV3D_COMMAND_USER = 1000,
 };
 
@@ -445,6 +469,91 @@ struct CompilePipelineSet
   const nau::DataBlock *computePipelineSet;
 };
 
+// Creates the graphics pipelines stored in the driver pipeline cache ahead of their first use.
+// Only the pipelines of the already loaded shaders are created, the others are created with their programs as before.
+struct PrewarmPipelineCache
+{
+  // 0: all the pipelines are created by the driver backend before it executes the next commands, for the loading screens.
+  // Otherwise the pipelines are created in the background at the frame ends, spending up to this time per frame.
+  uint32_t frameBudgetUs;
+};
+
+struct PipelinePrewarmProgress
+{
+  // The cached pipelines processed by the requested prewarms, created or skipped.
+  uint32_t completed;
+  uint32_t total;
+};
+
+// The draw calls recorded within the frame: the indirect draws are counted by their draw count,
+// their instances and triangles are not known on the CPU.
+struct Drv3dDrawStats
+{
+  uint32_t drawCalls;
+  uint32_t instances;
+  uint64_t triangles;
+  uint32_t dispatches;
+};
+
+enum class Drv3dGpuMemoryCategory : uint32_t
+{
+  Textures,
+  RenderTargets,
+  Buffers,
+  UploadRings, // The frame push ring, upload rings and the temporary and persistent upload memory
+  Count
+};
+
+// The level of the memory use relative to the budget reported by the OS (DXGI on DX12), Panic is over the budget.
+enum class Drv3dGpuMemoryPressure : uint32_t
+{
+  Panic,
+  High,
+  Medium,
+  Low,
+};
+
+// All sizes are in bytes
+struct Drv3dGpuMemoryPool
+{
+  uint64_t budget;
+  uint64_t currentUsage;
+  uint64_t availableForReservation;
+  uint64_t physicalSize; // 0 when unknown
+  Drv3dGpuMemoryPressure pressure;
+};
+
+struct Drv3dGpuMemoryReport
+{
+  Drv3dGpuMemoryPool deviceLocal;
+  Drv3dGpuMemoryPool hostLocal;
+  uint64_t categoryBytes[static_cast<uint32_t>(Drv3dGpuMemoryCategory::Count)];
+  uint32_t categoryObjects[static_cast<uint32_t>(Drv3dGpuMemoryCategory::Count)];
+  // The heaps the resources are placed in
+  uint32_t heapCount;
+  uint64_t heapTotalBytes;
+  uint64_t heapFreeBytes;
+  // The free memory scattered across the free ranges, in percents of the heap free memory: 0 when it is a single range
+  uint32_t maxHeapFragmentationPercent;
+  uint32_t averageHeapFragmentationPercent;
+};
+
+// Called for every tracked texture and buffer while the report is generated, under the driver lock:
+// the callback must not call the driver.
+struct Drv3dGpuMemoryOwnerVisitor
+{
+  void (*visit)(void *context, Drv3dGpuMemoryCategory category, const char *owner_name, uint64_t size);
+  void *context;
+};
+
+// The callback is called by the driver backend at the end of the frame when the pressure of the memory pool changes
+// (the pool is 0 for the device local memory and 1 for the host local memory).
+struct Drv3dGpuMemoryBudgetCallback
+{
+  void (*onPressureChanged)(void *context, uint32_t pool, Drv3dGpuMemoryPressure pressure, const Drv3dGpuMemoryPool &state);
+  void *context;
+};
+
 enum ResourceBarrier : int;
 
 struct Drv3dMakeTextureParams
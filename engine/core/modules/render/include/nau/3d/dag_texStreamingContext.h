@@ -5,11 +5,14 @@
 
 #include "nau/3d/dag_drv3d.h"
 
-class TexStreamingContext
+class NAU_RENDER_EXPORT TexStreamingContext
 {
   float multiplicator;
 
 public:
+  // The highest level getTexLevel() returns: the 32768 texels wide texture.
+  static constexpr int MAX_TEX_LEVEL = 15;
+
   // Explicitly create context with specified multiplicator, which is (current_perspective.wk * current_rendering_res_width)^2
   // Can be used in two cases:
   // 1. TexStreamingContext(0), when streaming of textures is not needed (shadows, depth-only rendering, etc). Will request lowest mip
@@ -20,5 +23,7 @@ public:
   TexStreamingContext(float mul) : multiplicator(mul) {}
   // Create a context correctly computing texture mips for streaming
   TexStreamingContext(const Driver3dPerspective &persp, int width);
+  // Returns the log2 of the texture resolution needed at the distance: texScale is the squared world radius the texture is mapped over.
+  // Zero means no demand (the lowest mip is enough), distSq = 0 requests MAX_TEX_LEVEL.
   int getTexLevel(float texScale, float distSq = 0.0f) const;
 };
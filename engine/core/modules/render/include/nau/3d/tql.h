@@ -50,6 +50,10 @@ extern void (*dump_tex_state)(TEXTUREID idx);
 extern void get_tex_streaming_stats(int &_mem_used_discardable_kb, int &_mem_used_persistent_kb, int &_mem_used_discardable_kb_max,
   int &_mem_used_persistent_kb_max, int &_mem_used_sum_kb_max, int &_tex_used_discardable_cnt, int &_tex_used_persistent_cnt,
   int &_max_mem_used_overdraft_kb);
+
+// Re-evaluates mem_quota_kb from the driver memory budget on the next frame instead of waiting for the periodic check,
+// can be called from any thread (i.e. by the driver memory budget callback).
+NAU_RENDER_EXPORT void request_mem_quota_update();
 } // namespace tql
 
 namespace tql
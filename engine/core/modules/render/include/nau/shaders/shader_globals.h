@@ -4,12 +4,75 @@
 
 #pragma once
 
+#include <EASTL/string_view.h>
+
+#include <atomic>
+
+#include "nau/string/name_id.h"
+
 namespace nau::shader_globals
 {
-    NAU_RENDER_EXPORT bool containsName(eastl::string_view name);
+    // Stable handle of the registered variable: its value lives in the packed backing buffer.
+    using GlobalVarId = uint32_t;
+    inline constexpr GlobalVarId InvalidGlobalVarId = ~0u;
+
+    // The names are looked up by NameId: no hashing per call for the ids made at compile time (e.g. "vp"_nid).
+    NAU_RENDER_EXPORT bool containsName(NameId name);
+
+    // The re-registered name keeps its id. The value pointers from getVariable() are invalidated by the registration.
+    NAU_RENDER_EXPORT GlobalVarId addVariable(eastl::string_view name, size_t size, const void* defaultValue = nullptr);
+    // InvalidGlobalVarId for the unknown name.
+    NAU_RENDER_EXPORT GlobalVarId getVariableId(NameId name);
+
+    // Writes the variable size bytes. The revision is not changed when the value is the same.
+    NAU_RENDER_EXPORT void setVariable(GlobalVarId id, const void* value);
+    NAU_RENDER_EXPORT void getVariable(GlobalVarId id, size_t* size, void** value);
+
+    // Grows with every value change: the variables with the revision newer than the cached one are modified since then.
+    NAU_RENDER_EXPORT uint64_t getRevision();
+    NAU_RENDER_EXPORT uint64_t getVariableRevision(GlobalVarId id);
+
+    // By name: the id lookup per call, prefer GlobalVar for the frequent updates.
+    NAU_RENDER_EXPORT void setVariable(NameId name, const void* value);
+    NAU_RENDER_EXPORT void getVariable(NameId name, size_t* size, void** value);
+
+    /**
+     * Variable with the id resolved on the first use: it can be declared before the variable is registered.
+     * The name must outlive the object (string literals are expected).
+     */
+    class GlobalVar
+    {
+    public:
+        constexpr explicit GlobalVar(eastl::string_view name) :
+            m_name(name),
+            m_nameId(name)
+        {
+        }
+
+        GlobalVarId getId() const
+        {
+            GlobalVarId id = m_id.load(std::memory_order_relaxed);
+            if (id == InvalidGlobalVarId)
+            {
+                id = getVariableId(m_nameId);
+                m_id.store(id, std::memory_order_relaxed);
+            }
+            return id;
+        }
+
+        eastl::string_view getName() const
+        {
+            return m_name;
+        }
 
-    NAU_RENDER_EXPORT void addVariable(eastl::string_view name, size_t size, const void* defaultValue = nullptr);
+        void set(const void* value) const
+        {
+            setVariable(getId(), value);
+        }
 
-    NAU_RENDER_EXPORT void setVariable(eastl::string_view name, const void* value);
-    NAU_RENDER_EXPORT void getVariable(eastl::string_view name, size_t* size, void** value);
+    private:
+        eastl::string_view m_name;
+        NameId m_nameId;
+        mutable std::atomic<GlobalVarId> m_id = InvalidGlobalVarId;
+    };
 } // namespace nau::shaderGlobals
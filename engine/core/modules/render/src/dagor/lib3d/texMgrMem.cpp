@@ -41,6 +41,7 @@ static int mem_used_discardable_kb = 0;
 static int mem_used_discardable_kb_max = 0, mem_used_persistent_kb_max = 0, mem_used_sum_kb_max = 0;
 static int tex_used_discardable_cnt = 0, tex_used_persistent_cnt = 0;
 static int mgr_log_level = 0;
+static volatile bool mem_quota_update_requested = false;
 using texmgr_internal::reload_jobmgr_id;
 using texmgr_internal::RMGR;
 
@@ -62,6 +63,8 @@ void tql::get_tex_streaming_stats(int &_mem_used_discardable_kb, int &_mem_used_
   _max_mem_used_overdraft_kb = 0 /*-mem_quota_reserve_kb*/;
 }
 
+void tql::request_mem_quota_update() { interlocked_release_store(mem_quota_update_requested, true); }
+
 static void on_tex_created(BaseTexture *t)
 {
   using namespace texmgr_internal;
@@ -233,7 +236,7 @@ static void on_frame_finished()
       free_up_sys_mem(int(mem_used_mb - sys_mem_usage_thres_mb + sys_mem_add_free_mb) << 10);
   }
 
-  if (!(dagor_frame_no() & 0x7F))
+  if (!(dagor_frame_no() & 0x7F) || interlocked_exchange(mem_quota_update_requested, false))
   {
     int total_gpu_mem_sz_kb = 0, free_gpu_mem_sz_kb = 0;
     // we can't tune quota of vulkan as it can make some resources non resident,
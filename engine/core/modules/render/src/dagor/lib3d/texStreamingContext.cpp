@@ -0,0 +1,37 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+
+// Copyright (C) 2024  Gaijin Games KFT.  All rights reserved
+
+#include <EASTL/algorithm.h>
+
+#include <cfloat>
+#include <cmath>
+
+#include "nau/3d/dag_texStreamingContext.h"
+
+TexStreamingContext::TexStreamingContext(const Driver3dPerspective& persp, int width) :
+    multiplicator(persp.wk * width * persp.wk * width)
+{
+}
+
+int TexStreamingContext::getTexLevel(float texScale, float distSq) const
+{
+    // The default (NaN) and the FLT_MAX contexts request the maximum quality.
+    if (!(multiplicator < FLT_MAX) || distSq <= 0.f)
+    {
+        return MAX_TEX_LEVEL;
+    }
+    if (multiplicator <= 0.f || texScale <= 0.f)
+    {
+        return 0;
+    }
+
+    // The screen texels across the texture are sqrt(multiplicator * texScale / distSq).
+    const float texelsSq = multiplicator * texScale / distSq;
+    if (texelsSq <= 1.f)
+    {
+        return 0;
+    }
+
+    return eastl::min(static_cast<int>(std::ceil(0.5f * std::log2(texelsSq))), MAX_TEX_LEVEL);
+}
@@ -559,6 +559,7 @@ bool Device::init(DXGIFactory *factory, AdapterInfo &&adapterInfo, D3D_FEATURE_L
     shutdown({});
     return false;
   }
+  gpuProfiler.init(device.get(), queues[DeviceQueueType::GRAPHICS].getHandle());
 
   NAU_LOG_DEBUG("DX12: Creating swapchain...");
   if (!context.back.swapchain.setup(*this, context.front.swapchain, factory, queues[DeviceQueueType::GRAPHICS].getHandle(),
@@ -651,7 +652,7 @@ bool Device::init(DXGIFactory *factory, AdapterInfo &&adapterInfo, D3D_FEATURE_L
   DeviceContext::ExecutionMode execMode = DeviceContext::ExecutionMode::IMMEDIATE;
   if (config.features.test(DeviceFeaturesConfig::USE_THREADED_COMMAND_EXECUTION))
   {
-    execMode = DeviceContext::ExecutionMode::IMMEDIATE;
+    execMode = DeviceContext::ExecutionMode::CONCURRENT;
   }
 
   context.initMode(execMode);
@@ -733,6 +734,7 @@ void Device::shutdown(const DeviceCapsAndShaderModel &features)
 
   resources.shutdown(getDXGIAdapter(), &bindlessManager);
   debug::DeviceState::teardown();
+  gpuProfiler.shutdown();
   queues.shutdown();
 
 #if _TARGET_PC_WIN
@@ -1289,6 +1291,7 @@ LUID Device::preRecovery()
   debug::DeviceState::preRecovery();
   pipeMan.preRecovery();
   pipelineCache.preRecovery();
+  gpuProfiler.shutdown();
   queues.shutdown();
   stopDeviceErrorObserver(eastl::move(errorObserverShutdownToken));
   device.reset();
@@ -1350,6 +1353,7 @@ bool Device::recover(DXGIFactory *factory, ComPtr<IDXGIAdapter1> input_adapter,
     enterErrorState();
     return false;
   }
+  gpuProfiler.init(device.get(), queues[DeviceQueueType::GRAPHICS].getHandle());
 
   NAU_LOG_DEBUG("DX12: Creating swapchain...");
   // reconstruct from current state
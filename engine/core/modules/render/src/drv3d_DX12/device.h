@@ -32,6 +32,7 @@
 #include "bindless.h"
 #include "device_context.h"
 #include "query_manager.h"
+#include "gpu_profiler.h"
 #include "tagged_handles.h"
 #include "pipeline/blk_cache.h"
 
@@ -566,6 +567,7 @@ private:
   PipelineManager pipeMan;
   PipelineCache pipelineCache;
   FrontendQueryManager frontendQueryManager;
+  GpuProfiler gpuProfiler;
   uint32_t lastAllocationCount = 0;
   uint32_t lastFreeCount = 0;
   DeviceContext context;
@@ -684,6 +686,7 @@ public:
   bool hasDepthBoundsTest() const { return caps.test(Caps::DEPTH_BOUNDS_TEST); }
 
   ID3D12CommandQueue *getGraphicsCommandQueue() const;
+  GpuProfiler &getGpuProfiler() { return gpuProfiler; }
   D3DDevice *getDevice();
 
   DeviceContext &getContext() { return context; }
@@ -1037,6 +1040,15 @@ public:
     resources.generateResourceAndMemoryReport(num_textures, total_mem, out_text);
   }
 
+  void generateGpuMemoryReport(Drv3dGpuMemoryReport &report, const Drv3dGpuMemoryOwnerVisitor *owner_visitor)
+  {
+    resources.generateGpuMemoryReport(report, owner_visitor);
+  }
+
+#if _TARGET_PC_WIN
+  void setGpuMemoryBudgetCallback(const Drv3dGpuMemoryBudgetCallback *callback) { resources.setBudgetCallback(callback); }
+#endif
+
   void reportOOMInformation() { resources.reportOOMInformation(); }
   bool isImageAlive(Image *image) { return resources.isImageAlive(image); }
 };
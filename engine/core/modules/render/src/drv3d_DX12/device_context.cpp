@@ -554,6 +554,20 @@ void DeviceContext::compilePipelineSet(const nau::DataBlock *feature_sets, Dynam
   immediateModeExecute();
 }
 
+void DeviceContext::prewarmPipelineCache(uint32_t frame_budget_us)
+{
+  DX12_LOCK_FRONT();
+  commandStream.pushBack(make_command<CmdPrewarmPipelineCache>(frame_budget_us));
+  immediateModeExecute();
+}
+
+void DeviceContext::getPipelinePrewarmProgress(uint32_t &completed, uint32_t &total) const
+{
+  // total first, so completed never exceeds it
+  total = pipelinePrewarmTotal.load(std::memory_order_acquire);
+  completed = eastl::min(pipelinePrewarmCompleted.load(std::memory_order_acquire), total);
+}
+
 void DeviceContext::resizeSwapchain(Extent2D size)
 {
   front.swapchain.prepareForShutdown(device);
@@ -1408,7 +1422,7 @@ void DeviceContext::destroyImage(Image *img)
 
 void DeviceContext::present(OutputMode mode)
 {
-// TODO Tracy    NAU_CPU_SCOPED_TAG(nau::PerfTag::Render);
+    NAU_CPU_SCOPED_TAG(nau::PerfTag::Render);
 #if DX12_RECORD_TIMING_DATA
   auto now = ref_time_ticks();
 #endif
@@ -3369,6 +3383,7 @@ int64_t DeviceContext::ExecutionContext::flush(bool present, uint64_t progress,
   auto frameCore = contextState.cmdBuffer.releaseBufferForSubmit();
   if (frameCore)
   {
+    device.getGpuProfiler().closeZones();
     contextState.debugEndCommandBuffer(device, frameCore.get());
 
     contextState.resourceStates.implicitUAVFlushAll(device.currentEventPath().data(), device.validatesUserBarriers());
@@ -3536,6 +3551,7 @@ void DeviceContext::ExecutionContext::pushEvent(StringIndexRef::RangeType name)
   }
 
   contextState.debugEventBegin(device, contextState.cmdBuffer.getHandle(), {name.data(), name.size()});
+  device.getGpuProfiler().beginZone(contextState.cmdBuffer.getHandle(), {name.data(), name.size()});
 
   contextState.resourceStates.beginEvent(name);
 }
@@ -3548,6 +3564,7 @@ void DeviceContext::ExecutionContext::popEvent()
   }
 
   contextState.debugEventEnd(device, contextState.cmdBuffer.getHandle());
+  device.getGpuProfiler().endZone();
 
   contextState.resourceStates.endEvent();
 }
@@ -3856,6 +3873,7 @@ void DeviceContext::ExecutionContext::present(uint64_t progress, Drv3dTimings *t
     G_UNUSED(swapDur);
 #endif
   }
+  device.getGpuProfiler().collect();
 
   /*  uint32_t deltaAlloc = device->memory.getAllocationCounter() - device->lastAllocationCount;
     uint32_t deltaFree = device->memory.getFreeCounter() - device->lastFreeCount;
@@ -3874,6 +3892,11 @@ void DeviceContext::ExecutionContext::present(uint64_t progress, Drv3dTimings *t
   self.initNextFrameLog();
 #endif
   device.pipeMan.evictDecompressionCache();
+
+  if (device.pipeMan.hasPendingPipelinePrewarm())
+  {
+    prewarmPipelines(device.pipeMan.getPipelinePrewarmFrameBudget());
+  }
 }
 
 void DeviceContext::ExecutionContext::dispatch(uint32_t x, uint32_t y, uint32_t z)
@@ -6338,4 +6361,23 @@ void DeviceContext::ExecutionContext::compilePipelineSet(DynamicArray<InputLayou
     eastl::forward<DynamicArray<ComputePipelinePreloadInfo>>(compute_pipelines));
 }
 
+void DeviceContext::ExecutionContext::prewarmPipelineCache(uint32_t frame_budget_us)
+{
+  const uint32_t queuedCount = device.pipeMan.queuePipelineCachePrewarm(device.pipelineCache, frame_budget_us);
+  self.pipelinePrewarmTotal.fetch_add(queuedCount, std::memory_order_release);
+  NAU_LOG_DEBUG("DX12: Prewarming {} cached graphics pipelines...", queuedCount);
+
+  if (0 == frame_budget_us)
+  {
+    prewarmPipelines(0);
+  }
+}
+
+void DeviceContext::ExecutionContext::prewarmPipelines(uint32_t budget_us)
+{
+  const uint32_t processedCount = device.pipeMan.prewarmPipelines(device.getDevice(), device.pipelineCache,
+    contextState.framebufferLayouts, budget_us);
+  self.pipelinePrewarmCompleted.fetch_add(processedCount, std::memory_order_release);
+}
+
 void DeviceContext::ExecutionContext::switchActivePipeline(ActivePipeline pipeline) { contextState.switchActivePipeline(pipeline); }
@@ -1509,6 +1509,8 @@ class DeviceContext : protected ResourceUsageHistoryDataSetDebugger, public debu
     void compilePipelineSet(DynamicArray<InputLayoutID> &&input_layouts, DynamicArray<StaticRenderStateID> &&static_render_states,
       DynamicArray<FramebufferLayout> &&framebuffer_layouts, DynamicArray<GraphicsPipelinePreloadInfo> &&graphics_pipelines,
       DynamicArray<MeshPipelinePreloadInfo> &&mesh_pipelines, DynamicArray<ComputePipelinePreloadInfo> &&compute_pipelines);
+    void prewarmPipelineCache(uint32_t frame_budget_us);
+    void prewarmPipelines(uint32_t budget_us);
 
     void switchActivePipeline(ActivePipeline pipeline);
   };
@@ -1641,6 +1643,9 @@ class DeviceContext : protected ResourceUsageHistoryDataSetDebugger, public debu
 #if DX12_REPORT_DISCARD_MEMORY_PER_FRAME
   std::atomic<size_t> discardBytes{0};
 #endif
+  // written by the backend, read by the frontend progress queries
+  std::atomic<uint32_t> pipelinePrewarmCompleted{0};
+  std::atomic<uint32_t> pipelinePrewarmTotal{0};
 
   XessWrapper xessWrapper;
   NgxWrapper ngxWrapper;
@@ -2107,6 +2112,8 @@ public:
     DynamicArray<StaticRenderStateID> &&static_render_states, const nau::DataBlock *output_formats_set,
     const nau::DataBlock *graphics_pipeline_set, const nau::DataBlock *mesh_pipeline_set, const nau::DataBlock *compute_pipeline_set,
     const char *default_format);
+  void prewarmPipelineCache(uint32_t frame_budget_us);
+  void getPipelinePrewarmProgress(uint32_t &completed, uint32_t &total) const;
 };
 
 class ScopedCommitLock
@@ -1385,3 +1385,11 @@ DX12_BEGIN_CONTEXT_COMMAND(CompilePipelineSet)
     DynamicArray<ComputePipelinePreloadInfo>::fromSpan(computePipelines));
 #endif
 DX12_END_CONTEXT_COMMAND
+
+DX12_BEGIN_CONTEXT_COMMAND(PrewarmPipelineCache)
+  DX12_CONTEXT_COMMAND_PARAM(uint32_t, frameBudgetUs)
+
+#if DX12_CONTEXT_COMMAND_IMPLEMENTATION
+  ctx.prewarmPipelineCache(frameBudgetUs);
+#endif
+DX12_END_CONTEXT_COMMAND
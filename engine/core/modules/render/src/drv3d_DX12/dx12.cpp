@@ -447,6 +447,17 @@ struct ApiState
   float maxLum = 0.f;
   float maxFullFrameLum = 0.f;
 
+  // The draws are recorded from the main thread only, the counters are published at the frame end (see update_screen).
+  Drv3dDrawStats frameDrawStats{};
+  Drv3dDrawStats lastFrameDrawStats{};
+
+  void countDraws(uint32_t draw_count, uint32_t num_instances, uint64_t triangles)
+  {
+    frameDrawStats.drawCalls += draw_count;
+    frameDrawStats.instances += num_instances;
+    frameDrawStats.triangles += triangles;
+  }
+
   void adjustCaps()
   {
     driverDesc.zcmpfunc = 0;
@@ -1380,6 +1391,32 @@ int d3d::driver_command(int command, void *par1, void *par2, void *par3)
   {
     case DRV3D_COMMAND_GET_BUFFER_GPU_ADDRESS: return on_get_buffer_gpu_address(par1, par2);
     case DRV3D_COMMAND_COMPILE_PIPELINE_SET: return on_driver_command_compile_pipeline_set(par1);
+    case DRV3D_COMMAND_PREWARM_PIPELINE_CACHE:
+      drv3d_dx12::api_state.device.getContext().prewarmPipelineCache(static_cast<const PrewarmPipelineCache *>(par1)->frameBudgetUs);
+      return 1;
+    case DRV3D_COMMAND_GET_PIPELINE_PREWARM_PROGRESS:
+    {
+      auto progress = static_cast<PipelinePrewarmProgress *>(par1);
+      drv3d_dx12::api_state.device.getContext().getPipelinePrewarmProgress(progress->completed, progress->total);
+      return 1;
+    }
+    case DRV3D_COMMAND_GET_FRAME_DRAW_STATS:
+      *static_cast<Drv3dDrawStats *>(par1) = drv3d_dx12::api_state.lastFrameDrawStats;
+      return 1;
+    case DRV3D_COMMAND_GET_CURRENT_DRAW_STATS:
+      *static_cast<Drv3dDrawStats *>(par1) = drv3d_dx12::api_state.frameDrawStats;
+      return 1;
+    case DRV3D_COMMAND_GET_GPU_MEMORY_REPORT:
+      drv3d_dx12::api_state.device.generateGpuMemoryReport(*static_cast<Drv3dGpuMemoryReport *>(par1),
+        static_cast<const Drv3dGpuMemoryOwnerVisitor *>(par2));
+      return 1;
+    case DRV3D_COMMAND_SET_GPU_MEMORY_BUDGET_CALLBACK:
+#if _TARGET_PC_WIN
+      drv3d_dx12::api_state.device.setGpuMemoryBudgetCallback(static_cast<const Drv3dGpuMemoryBudgetCallback *>(par1));
+      return 1;
+#else
+      return 0;
+#endif
     case DRV3D_COMMAND_REMOVE_DEBUG_BREAK_STRING_SEARCH:
       drv3d_dx12::api_state.device.getContext().removeDebugBreakString({static_cast<const char *>(par1)});
       return 1;
@@ -2874,6 +2911,9 @@ bool d3d::update_screen(bool app_active)
   STORE_RETURN_ADDRESS();
   CHECK_MAIN_THREAD();
 
+  drv3d_dx12::api_state.lastFrameDrawStats = drv3d_dx12::api_state.frameDrawStats;
+  drv3d_dx12::api_state.frameDrawStats = {};
+
   if (!drv3d_dx12::api_state.device.getContext().wasCurrentFramePresentSubmitted())
   {
     drv3d_dx12::api_state.state.onFrameEnd(drv3d_dx12::api_state.device.getContext());
@@ -2989,10 +3029,7 @@ bool d3d::draw_base(int type, int start, int numprim, uint32_t num_instances, ui
   }
   drv3d_dx12::api_state.device.getContext().draw(topology, start, nprim_to_nverts(type, numprim), start_instance, num_instances);
 
-  //Stat3D::updateDrawPrim();
-  //Stat3D::updateTriangles(numprim * num_instances);
-  //if (num_instances > 1)
-    //Stat3D::updateInstances(num_instances);
+  drv3d_dx12::api_state.countDraws(1, num_instances, uint64_t(numprim) * num_instances);
   return true;
 }
 
@@ -3010,10 +3047,7 @@ bool d3d::drawind_base(int type, int startind, int numprim, int base_vertex, uin
   drv3d_dx12::api_state.device.getContext().drawIndexed(topology, startind, nprim_to_nverts(type, numprim), Vectormath::max(base_vertex, 0), start_instance,
     num_instances);
 
-  //Stat3D::updateDrawPrim();
-  //Stat3D::updateTriangles(numprim * num_instances);
-  //if (num_instances > 1)
-    //Stat3D::updateInstances(num_instances);
+  drv3d_dx12::api_state.countDraws(1, num_instances, uint64_t(numprim) * num_instances);
   return true;
 }
 
@@ -3031,8 +3065,7 @@ bool d3d::draw_up(int type, int numprim, const void *ptr, int stride_bytes)
   }
   drv3d_dx12::api_state.device.getContext().drawUserData(topology, primCount, stride_bytes, ptr);
 
-  //Stat3D::updateDrawPrim();
-  //Stat3D::updateTriangles(numprim);
+  drv3d_dx12::api_state.countDraws(1, 1, numprim);
   return true;
 }
 
@@ -3051,8 +3084,7 @@ bool d3d::drawind_up(int type, int minvert, int numvert, int numprim, const uint
   }
   drv3d_dx12::api_state.device.getContext().drawIndexedUserData(topology, primCount, stride_bytes, ptr, numvert, ind);
 
-  //Stat3D::updateDrawPrim();
-  //Stat3D::updateTriangles(numprim);
+  drv3d_dx12::api_state.countDraws(1, 1, numprim);
   return true;
 }
 
@@ -3065,6 +3097,7 @@ bool d3d::dispatch(uint32_t x, uint32_t y, uint32_t z, GpuPipeline gpu_pipeline)
   ScopedCommitLock ctxLock{drv3d_dx12::api_state.device.getContext()};
   drv3d_dx12::api_state.state.flushCompute(drv3d_dx12::api_state.device.getContext());
   drv3d_dx12::api_state.device.getContext().dispatch(x, y, z);
+  ++drv3d_dx12::api_state.frameDrawStats.dispatches;
   return true;
 }
 
@@ -3102,7 +3135,7 @@ bool d3d::multi_draw_indirect(int prim_type, Sbuffer *args, uint32_t draw_count,
   }
   drv3d_dx12::api_state.device.getContext().drawIndirect(topology, draw_count, bufferRef, stride_bytes);
 
-  //Stat3D::updateDrawPrim();
+  drv3d_dx12::api_state.countDraws(draw_count, 0, 0);
   return true;
 }
 
@@ -3128,7 +3161,7 @@ bool d3d::multi_draw_indexed_indirect(int prim_type, Sbuffer *args, uint32_t dra
   }
   drv3d_dx12::api_state.device.getContext().drawIndexedIndirect(topology, draw_count, bufferRef, stride_bytes);
 
-  //Stat3D::updateDrawPrim();
+  drv3d_dx12::api_state.countDraws(draw_count, 0, 0);
   return true;
 }
 
@@ -3149,6 +3182,7 @@ bool d3d::dispatch_indirect(Sbuffer *args, uint32_t byte_offset, GpuPipeline gpu
 
   drv3d_dx12::api_state.state.flushCompute(drv3d_dx12::api_state.device.getContext());
   drv3d_dx12::api_state.device.getContext().dispatchIndirect(bufferRef);
+  ++drv3d_dx12::api_state.frameDrawStats.dispatches;
   return true;
 }
 
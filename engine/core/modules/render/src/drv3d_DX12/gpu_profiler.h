@@ -0,0 +1,126 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+#pragma once
+
+#include <EASTL/algorithm.h>
+#include <EASTL/string_view.h>
+#include <cstdint>
+#include <new>
+
+#include "nau/utils/performance_profiling.h"
+
+#if NAU_PROFILING_TRACY
+#include <tracy/TracyD3D12.hpp>
+#endif
+
+struct ID3D12Device;
+struct ID3D12CommandQueue;
+struct ID3D12GraphicsCommandList;
+
+namespace drv3d_dx12
+{
+// GPU zones of the profiler, driven by the debug events (d3d::beginEvent/endEvent).
+// Everything is a no-op when the engine is built without NAU_PROFILING_TRACY.
+// All methods except init/shutdown are called from the execution context (backend) thread only.
+class GpuProfiler
+{
+public:
+  void init([[maybe_unused]] ID3D12Device *device, [[maybe_unused]] ID3D12CommandQueue *queue)
+  {
+#if NAU_PROFILING_TRACY
+    context = TracyD3D12Context(device, queue);
+    TracyD3D12ContextName(context, "Graphics Queue", 14);
+#endif
+  }
+
+  void shutdown()
+  {
+#if NAU_PROFILING_TRACY
+    if (context)
+    {
+      closeZones();
+      TracyD3D12Destroy(context);
+      context = nullptr;
+    }
+    zoneDepth = 0;
+#endif
+  }
+
+  void beginZone([[maybe_unused]] ID3D12GraphicsCommandList *cmd, [[maybe_unused]] eastl::string_view name)
+  {
+#if NAU_PROFILING_TRACY
+    const uint32_t depth = zoneDepth++;
+    if (!context || depth >= max_zone_depth)
+    {
+      return;
+    }
+
+    new (&zones[depth]) tracy::D3D12ZoneScope(context, __LINE__, __FILE__, sizeof(__FILE__) - 1, __FUNCTION__,
+      sizeof(__FUNCTION__) - 1, name.data(), name.size(), cmd, true);
+    zoneOpened[depth] = true;
+#endif
+  }
+
+  void endZone()
+  {
+#if NAU_PROFILING_TRACY
+    if (zoneDepth == 0)
+    {
+      return;
+    }
+
+    const uint32_t depth = --zoneDepth;
+    if (depth < max_zone_depth && zoneOpened[depth])
+    {
+      getZone(depth).~D3D12ZoneScope();
+      zoneOpened[depth] = false;
+    }
+#endif
+  }
+
+  // Query of the zone has to be ended in the same command list where it was started,
+  // so all open zones are closed before the command list is submitted (zone is cut at the submit point).
+  void closeZones()
+  {
+#if NAU_PROFILING_TRACY
+    for (uint32_t depth = eastl::min(zoneDepth, max_zone_depth); depth > 0; --depth)
+    {
+      if (zoneOpened[depth - 1])
+      {
+        getZone(depth - 1).~D3D12ZoneScope();
+        zoneOpened[depth - 1] = false;
+      }
+    }
+#endif
+  }
+
+  // Called once per frame after the frame command lists are submitted.
+  void collect()
+  {
+#if NAU_PROFILING_TRACY
+    if (context)
+    {
+      TracyD3D12NewFrame(context);
+      TracyD3D12Collect(context);
+    }
+#endif
+  }
+
+#if NAU_PROFILING_TRACY
+private:
+  static constexpr uint32_t max_zone_depth = 64;
+
+  struct alignas(tracy::D3D12ZoneScope) ZoneStorage
+  {
+    uint8_t data[sizeof(tracy::D3D12ZoneScope)];
+  };
+
+  tracy::D3D12ZoneScope &getZone(uint32_t depth) { return *std::launder(reinterpret_cast<tracy::D3D12ZoneScope *>(&zones[depth])); }
+
+  tracy::D3D12QueueCtx *context = nullptr;
+  ZoneStorage zones[max_zone_depth];
+  bool zoneOpened[max_zone_depth] = {};
+  uint32_t zoneDepth = 0;
+#endif
+};
+} // namespace drv3d_dx12
@@ -1876,6 +1876,76 @@ void PipelineManager::addGraphics(ID3D12Device2 *device, PipelineCache &cache, F
   }
 }
 
+uint32_t PipelineManager::queuePipelineCachePrewarm(PipelineCache &pipeline_cache, uint32_t frame_budget_us)
+{
+  eastl::vector<BasePipelineIdentifier> cachedPipelines;
+  pipeline_cache.enumerateGraphicsPipelines([&cachedPipelines](const BasePipelineIdentifier &ident) { cachedPipelines.push_back(ident); });
+  pipelinePrewarmQueue.insert(pipelinePrewarmQueue.begin(), cachedPipelines.rbegin(), cachedPipelines.rend());
+
+  // the unbudgeted requests are processed right away and keep the background budget
+  if (frame_budget_us > 0)
+  {
+    pipelinePrewarmFrameBudgetUs = frame_budget_us;
+  }
+  return static_cast<uint32_t>(cachedPipelines.size());
+}
+
+uint32_t PipelineManager::prewarmPipelines(ID3D12Device2 *device, PipelineCache &pipeline_cache, FramebufferLayoutManager &fbs,
+  uint32_t budget_us)
+{
+  const int64_t startTicks = ref_time_ticks();
+  uint32_t processedCount = 0;
+  while (!pipelinePrewarmQueue.empty())
+  {
+    if (budget_us > 0 && processedCount > 0 && ref_time_delta_to_usec(ref_time_ticks() - startTicks) >= budget_us)
+    {
+      break;
+    }
+
+    const BasePipelineIdentifier ident = pipelinePrewarmQueue.back();
+    pipelinePrewarmQueue.pop_back();
+    ++processedCount;
+
+    // the shaders which are not loaded yet create the pipeline with their program
+    auto vsID = findVertexShader(ident.vs);
+    auto psID = findPixelShader(ident.ps);
+    if (ShaderID::Null() == vsID || ShaderID::Null() == psID)
+    {
+      continue;
+    }
+
+    auto isPreloaded = eastl::any_of(preloadedGraphicsPipelines.begin(), preloadedGraphicsPipelines.end(),
+      [vsID, psID](const auto &pp) { return (pp.vsID == vsID) && (pp.psID == psID); });
+    if (isPreloaded)
+    {
+      continue;
+    }
+
+    auto vs = getVertexShader(vsID);
+    auto ps = getPixelShader(psID);
+    if (findLoadedPipeline(vs, ps))
+    {
+      continue;
+    }
+
+    // the constructor loads all the cached variants, addGraphics takes the pipeline on the program creation
+    auto pipeline = createGraphics(device, pipeline_cache, fbs, vs, ps, RecoverablePipelineCompileBehavior::REPORT_ERROR, true);
+    if (pipeline)
+    {
+      auto &preloadedPipeline = preloadedGraphicsPipelines.emplace_back();
+      preloadedPipeline.vsID = vsID;
+      preloadedPipeline.psID = psID;
+      preloadedPipeline.pipeline = eastl::move(pipeline);
+    }
+  }
+
+  if (pipelinePrewarmQueue.empty())
+  {
+    pipelinePrewarmFrameBudgetUs = 0;
+  }
+  return processedCount;
+}
+
 eastl::unique_ptr<BasePipeline> PipelineManager::createGraphics(ID3D12Device2 *device, PipelineCache &cache,
   FramebufferLayoutManager &fbs, backend::VertexShaderModuleRefStore vertexShader, backend::PixelShaderModuleRefStore pixelShader,
   RecoverablePipelineCompileBehavior on_error, bool give_name)
@@ -1927,8 +1927,22 @@ public:
     compileComputePipelineSet(device, pipeline_cache, compute_pipelines);
     validateInGameSpikes = dgs_get_settings()->getBlockByNameEx("dx12")->getBool("validateInGameSpikes", false);
   }
+
+  // Queues all the graphics pipelines of the cache, returns the number of the queued pipelines.
+  uint32_t queuePipelineCachePrewarm(PipelineCache &pipeline_cache, uint32_t frame_budget_us);
+  // Creates the queued pipelines with their cached variants until the budget is spent, 0 budget creates all of them.
+  // Returns the number of the processed pipelines.
+  uint32_t prewarmPipelines(ID3D12Device2 *device, PipelineCache &pipeline_cache, FramebufferLayoutManager &fbs, uint32_t budget_us);
+  bool hasPendingPipelinePrewarm() const { return !pipelinePrewarmQueue.empty(); }
+  uint32_t getPipelinePrewarmFrameBudget() const { return pipelinePrewarmFrameBudgetUs; }
+
   bool validateInGameSpikes = false;
   bool needToUpdateCache = false;
+
+private:
+  // Processed from the back, so it is stored in the reversed cache order.
+  eastl::vector<BasePipelineIdentifier> pipelinePrewarmQueue;
+  uint32_t pipelinePrewarmFrameBudgetUs = 0;
 };
 
 
@@ -764,6 +764,13 @@ public:
       clb(il);
   }
 
+  template <typename T>
+  void enumerateGraphicsPipelines(T clb)
+  {
+    for (auto &&pipeline : graphicsCache)
+      clb(pipeline.ident);
+  }
+
   void onBindumpLoad(ID3D12Device1 *device, eastl::span<const dxil::HashValue> all_shader_hashes);
 
 private:
@@ -295,6 +295,7 @@ void MemoryBudgetObserver::completeFrameExecution(const CompletedFrameExecutionI
   auto oldTrimUploadRingBuffer = shouldTrimFramePushRingBuffer();
 
   updateBudgetLevelStatus();
+  notifyBudgetLevelChanges();
 
   if (oldTrimFramePushRingBuffer != shouldTrimUploadRingBuffer())
   {
@@ -320,6 +321,49 @@ void MemoryBudgetObserver::completeFrameExecution(const CompletedFrameExecutionI
   }
 }
 
+void MemoryBudgetObserver::notifyBudgetLevelChanges()
+{
+  lock_(budgetCallbackMutex);
+  if (!budgetCallback.onPressureChanged)
+  {
+    return;
+  }
+
+  for (uint32_t i : {device_local_memory_pool, host_local_memory_pool})
+  {
+    if (notifiedBudgetLevelstatus[i] == poolBudgetLevelstatus[i])
+    {
+      continue;
+    }
+
+    NAU_LOG_DEBUG("DX12: {} memory budget level changed from {} to {}", i == device_local_memory_pool ? "Device Local" : "Host Local",
+      as_string(notifiedBudgetLevelstatus[i]), as_string(poolBudgetLevelstatus[i]));
+    notifiedBudgetLevelstatus[i] = poolBudgetLevelstatus[i];
+
+    Drv3dGpuMemoryPool report;
+    getMemoryPoolReport(i, report);
+    budgetCallback.onPressureChanged(budgetCallback.context, i, report.pressure, report);
+  }
+}
+
+void MemoryBudgetObserver::setBudgetCallback(const Drv3dGpuMemoryBudgetCallback *callback)
+{
+  lock_(budgetCallbackMutex);
+  budgetCallback = callback ? *callback : Drv3dGpuMemoryBudgetCallback{};
+  // the new callback gets the current levels with the next frame when they are not low
+  notifiedBudgetLevelstatus[device_local_memory_pool] = BudgetPressureLevels::LOW;
+  notifiedBudgetLevelstatus[host_local_memory_pool] = BudgetPressureLevels::LOW;
+}
+
+void MemoryBudgetObserver::getMemoryPoolReport(uint32_t pool_type, Drv3dGpuMemoryPool &report) const
+{
+  report.budget = getPoolBudget(pool_type);
+  report.currentUsage = poolStates[pool_type].CurrentUsage;
+  report.availableForReservation = poolStates[pool_type].AvailableForReservation;
+  report.physicalSize = getPhysicalLimit(pool_type);
+  report.pressure = static_cast<Drv3dGpuMemoryPressure>(poolBudgetLevelstatus[pool_type]);
+}
+
 uint64_t MemoryBudgetObserver::getHeapSizeFromAllocationSize(uint64_t size, ResourceHeapProperties properties, AllocationFlags flags)
 {
   const bool isCPUCachedMemory = D3D12_CPU_PAGE_PROPERTY_WRITE_BACK == properties.getCpuPageProperty(isUMASystem());
@@ -19,6 +19,8 @@
 
 #include "resource_manager/descriptor_components.h"
 
+#include "nau/3d/dag_drv3dCmd.h"
+
 
 namespace drv3d_dx12
 {
@@ -460,6 +462,19 @@ protected:
 
   void setup(const SetupInfo &info);
 
+  // reports changes of the pressure levels to the budget callback, levels are compared to the last reported ones
+  void notifyBudgetLevelChanges();
+
+  nau::threading::SpinLock budgetCallbackMutex;
+  Drv3dGpuMemoryBudgetCallback budgetCallback{};
+  BudgetPressureLevels notifiedBudgetLevelstatus[total_memory_pool_count]{BudgetPressureLevels::LOW, BudgetPressureLevels::LOW};
+
+public:
+  void setBudgetCallback(const Drv3dGpuMemoryBudgetCallback *callback);
+
+  void getMemoryPoolReport(uint32_t pool_type, Drv3dGpuMemoryPool &report) const;
+
+protected:
   bool shouldTrimFramePushRingBuffer() const { return getHostLocalBudgetLevel() < BudgetPressureLevels::HIGH; }
 
   bool shouldTrimUploadRingBuffer() const { return getHostLocalBudgetLevel() < BudgetPressureLevels::HIGH; }
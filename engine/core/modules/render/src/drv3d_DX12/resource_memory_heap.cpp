@@ -5489,6 +5489,73 @@ void ResourceMemoryHeap::generateResourceAndMemoryReport(uint32_t *num_textures,
   }
 }
 
+namespace
+{
+struct GpuMemoryReportHeapVisitor
+{
+  Drv3dGpuMemoryReport &report;
+  uint64_t &fragmentationPercentSum;
+
+  void visitHeapGroup(uint32_t, size_t count, bool, bool, bool) { report.heapCount += static_cast<uint32_t>(count); }
+
+  void visitHeap(ByteUnits total_size, ByteUnits free_size, uint32_t fragmentation_percent)
+  {
+    report.heapTotalBytes += total_size.value();
+    report.heapFreeBytes += free_size.value();
+    report.maxHeapFragmentationPercent = eastl::max(report.maxHeapFragmentationPercent, fragmentation_percent);
+    fragmentationPercentSum += fragmentation_percent;
+  }
+
+  void visitHeapUsedRange(ValueRange<uint64_t>) {}
+
+  void visitHeapFreeRange(ValueRange<uint64_t>) {}
+};
+} // namespace
+
+void ResourceMemoryHeap::generateGpuMemoryReport(Drv3dGpuMemoryReport &report, const Drv3dGpuMemoryOwnerVisitor *owner_visitor)
+{
+  report = {};
+
+#if _TARGET_PC_WIN
+  getMemoryPoolReport(device_local_memory_pool, report.deviceLocal);
+  getMemoryPoolReport(host_local_memory_pool, report.hostLocal);
+#endif
+
+  uint64_t fragmentationPercentSum = 0;
+  visitHeaps(GpuMemoryReportHeapVisitor{report, fragmentationPercentSum});
+  report.averageHeapFragmentationPercent = report.heapCount ? static_cast<uint32_t>(fragmentationPercentSum / report.heapCount) : 0;
+
+  const auto addObject = [&report, owner_visitor](Drv3dGpuMemoryCategory category, const char *name, uint64_t size) //
+  {
+    report.categoryBytes[static_cast<uint32_t>(category)] += size;
+    ++report.categoryObjects[static_cast<uint32_t>(category)];
+    if (owner_visitor)
+    {
+      owner_visitor->visit(owner_visitor->context, category, name, size);
+    }
+  };
+
+  visitTextureObjects([&addObject](auto tex) //
+    {
+      auto img = tex->getDeviceImage();
+      // aliased textures share the memory of the texture they alias
+      if (!img || img->isAliased())
+      {
+        return;
+      }
+      addObject(tex->isRenderTarget() ? Drv3dGpuMemoryCategory::RenderTargets : Drv3dGpuMemoryCategory::Textures, tex->getResName(),
+        img->getMemory().size());
+    });
+
+  visitBufferObjects([&addObject](auto buffer) //
+    { addObject(Drv3dGpuMemoryCategory::Buffers, buffer->getBufName(), buffer->ressize()); });
+
+  const uint64_t uploadRingsSize = getFramePushRingMemorySize() + getUploadRingMemorySize() + getTemporaryUploadMemorySize() +
+                                   getPersistentUploadMemorySize() + getPersistentReadBackMemorySize() +
+                                   getPersistentBidirectionalMemorySize();
+  report.categoryBytes[static_cast<uint32_t>(Drv3dGpuMemoryCategory::UploadRings)] = uploadRingsSize;
+}
+
 void OutOfMemoryRepoter::reportOOMInformation()
 {
   if (!didReportOOM)
@@ -958,6 +958,12 @@ public:
 
   void generateResourceAndMemoryReport(uint32_t *num_textures, uint64_t *total_mem, nau::string *out_text);
 
+  void generateGpuMemoryReport(Drv3dGpuMemoryReport &report, const Drv3dGpuMemoryOwnerVisitor *owner_visitor);
+
+#if _TARGET_PC_WIN
+  using BaseType::setBudgetCallback;
+#endif
+
   using BaseType::reportOOMInformation;
 
   using BaseType::isImageAlive;
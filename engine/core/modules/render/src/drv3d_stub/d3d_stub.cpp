@@ -0,0 +1,1009 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+// The null d3d driver: the resources are the CPU side descriptors without the content, nothing is submitted to a GPU
+// and the GPU timestamps resolve to zero. Built instead of the DX12 driver with NAU_RENDER_NULL_DRIVER
+// (the headless servers and the automated runs).
+
+#include "stub_resources.h"
+
+#include "nau/3d/dag_drv3d.h"
+#include "nau/3d/dag_drv3dCmd.h"
+#include "nau/3d/ddsxTex.h"
+#include "nau/3d/tql.h"
+#if _TARGET_PC
+#include "nau/3d/dag_drv3d_pc.h"
+#endif
+#include "nau/dag_ioSys/dag_genIo.h"
+#include "nau/diag/logging.h"
+#include "nau/image/dag_texPixel.h"
+#include "nau/string/format.h"
+#include "nau/threading/lock_guard.h"
+
+#include <EASTL/vector.h>
+#include <EASTL/vector_map.h>
+
+#include <atomic>
+#include <mutex>
+
+#include "drv3d_commonCode/frameStateTM.inc.h"
+#include "drv3d_commonCode/renderPassGeneric.h"
+#include "drv3d_commonCode/resUpdateBufferGeneric.h"
+#include "drv3d_commonCode/resourceActivationGeneric.h"
+
+using namespace drv3d_stub;
+
+namespace drv3d_stub
+{
+constexpr int DEFAULT_SCREEN_WIDTH = 1280;
+constexpr int DEFAULT_SCREEN_HEIGHT = 720;
+// Any nonzero frequency: the issued timestamps are all zero, so the measured GPU time is zero.
+constexpr uint64_t TIMESTAMP_FREQUENCY = 1000000000ull;
+
+struct Swapchain
+{
+  StubTexture *color = nullptr;
+  int width = 0;
+  int height = 0;
+};
+
+struct ApiState
+{
+  bool isInitialized = false;
+  bool initVideoDone = false;
+
+  Driver3dDesc driverDesc{};
+
+  // The frontend state is for the main thread (as for the other drivers), the resource creation is thread safe.
+  Driver3dRenderTarget renderTarget;
+  Viewport viewport{};
+  eastl::vector_map<SWAPID, Swapchain> swapchains;
+  StubTexture *backbufferDepth = nullptr;
+  SWAPID nextSwapchainId = DEFAULT_SWAPID + 1;
+
+  Drv3dDrawStats frameDrawStats{};
+  Drv3dDrawStats lastFrameDrawStats{};
+
+  std::mutex objectsMutex;
+  eastl::vector<VDECL> programVdecls;
+  std::atomic<int> nextShaderId = 0;
+  std::atomic<int> nextVdeclId = 0;
+  std::atomic<uint32_t> nextRenderStateId = 0;
+  std::atomic<uintptr_t> nextSamplerId = 0;
+  std::atomic<int> nextPredicateId = 0;
+
+  std::recursive_mutex globalLock;
+
+  void countDraws(uint32_t draw_count, uint32_t num_instances, uint64_t triangles)
+  {
+    frameDrawStats.drawCalls += draw_count;
+    frameDrawStats.instances += num_instances;
+    frameDrawStats.triangles += triangles;
+  }
+
+  void adjustCaps()
+  {
+    driverDesc.mintexw = 1;
+    driverDesc.mintexh = 1;
+    driverDesc.maxtexw = 16384;
+    driverDesc.maxtexh = 16384;
+    driverDesc.mincubesize = 1;
+    driverDesc.maxcubesize = 16384;
+    driverDesc.minvolsize = 1;
+    driverDesc.maxvolsize = 2048;
+    driverDesc.maxtexaspect = 0;
+    driverDesc.maxtexcoord = 0x7FFFFFFF;
+    driverDesc.maxsimtex = 0x7FFFFFFF;
+    driverDesc.maxvertexsamplers = 0x7FFFFFFF;
+    driverDesc.maxclipplanes = 0x7FFFFFFF;
+    driverDesc.maxstreams = 0x7FFFFFFF;
+    driverDesc.maxstreamstr = 0x7FFFFFFF;
+    driverDesc.maxvpconsts = 0x7FFFFFFF;
+    driverDesc.maxprims = 0x7FFFFFFF;
+    driverDesc.maxvertind = 0x7FFFFFFF;
+    driverDesc.maxSimRT = Driver3dRenderTarget::MAX_SIMRT;
+    driverDesc.minWarpSize = 32;
+    driverDesc.is20ArbitrarySwizzleAvailable = true;
+  }
+
+  Swapchain *getSwapchain(SWAPID id)
+  {
+    auto swapchain = swapchains.find(id);
+    return swapchain != swapchains.end() ? &swapchain->second : nullptr;
+  }
+
+  void resizeSwapchain(Swapchain &swapchain, int w, int h)
+  {
+    if (swapchain.color && swapchain.width == w && swapchain.height == h)
+      return;
+
+    del_d3dres(swapchain.color);
+    swapchain.color = new StubTexture(RES3D_TEX, TEXFMT_A8R8G8B8 | TEXCF_RTARGET, w, h, 1, 1, u8"backbuffer");
+    swapchain.width = w;
+    swapchain.height = h;
+  }
+
+  void releaseAll()
+  {
+    for (auto &[id, swapchain] : swapchains)
+      del_d3dres(swapchain.color);
+    swapchains.clear();
+    del_d3dres(backbufferDepth);
+
+    lock_(objectsMutex);
+    programVdecls.clear();
+  }
+};
+
+ApiState api_state;
+FrameStateTM g_frameState;
+int timestamp_query = 0;
+int event_query = 0;
+} // namespace drv3d_stub
+
+/////////////////////////// From frameStateTM.inc.cpp
+bool d3d::setpersp(const Driver3dPerspective &p, nau::math::Matrix4 *proj_tm)
+{
+  g_frameState.setpersp(p, proj_tm);
+  return true;
+}
+
+bool d3d::calcproj(const Driver3dPerspective &p, nau::math::Matrix4 &proj_tm)
+{
+  g_frameState.calcproj(p, proj_tm);
+  return true;
+}
+
+void d3d::calcglobtm(const nau::math::Matrix4 &view_tm, const nau::math::Matrix4 &proj_tm, nau::math::Matrix4 &result)
+{
+  g_frameState.calcglobtm(view_tm, proj_tm, result);
+}
+
+void d3d::calcglobtm(const nau::math::Matrix4 &view_tm, const Driver3dPerspective &persp, nau::math::Matrix4 &result)
+{
+  g_frameState.calcglobtm(view_tm, persp, result);
+}
+
+bool d3d::getpersp(Driver3dPerspective &p) { return g_frameState.getpersp(p); }
+
+bool d3d::validatepersp(const Driver3dPerspective &p) { return g_frameState.validatepersp(p); }
+
+void d3d::setglobtm(nau::math::Matrix4 &tm) { g_frameState.setglobtm(tm); }
+
+bool d3d::settm(int which, const nau::math::Matrix4 *m)
+{
+  g_frameState.settm(which, *m);
+  return true;
+}
+
+bool d3d::settm(int which, const nau::math::Matrix4 &m)
+{
+  g_frameState.settm(which, m);
+  return true;
+}
+
+bool d3d::gettm(int which, nau::math::Matrix4 *out_m)
+{
+  g_frameState.gettm(which, out_m);
+  return true;
+}
+
+const nau::math::Matrix4 &d3d::gettm_cref(int which) { return g_frameState.gettm_cref(which); }
+
+bool d3d::gettm(int which, nau::math::Matrix4 &t)
+{
+  g_frameState.gettm(which, t);
+  return true;
+}
+
+void d3d::getm2vtm(nau::math::Matrix4 &tm) { g_frameState.getm2vtm(tm); }
+
+void d3d::getglobtm(nau::math::Matrix4 &tm) { g_frameState.getglobtm(tm); }
+
+void d3d::setglobtm(const nau::math::Matrix4 &tm) { g_frameState.setglobtm(tm); }
+
+//////////////// End from frameStateTM.inc.cpp
+
+const bool d3d::HALF_TEXEL_OFS = false;
+const float d3d::HALF_TEXEL_OFSFU = 0.0f;
+
+void d3d::get_texture_statistics(uint32_t *num_textures, uint64_t *total_mem, nau::string *out_text)
+{
+  const ResourceStats &stats = get_resource_stats();
+  const uint32_t textureCount = stats.textureCount.load(std::memory_order_relaxed);
+  const uint64_t textureBytes = stats.textureBytes.load(std::memory_order_relaxed);
+
+  if (num_textures)
+    *num_textures = textureCount;
+  if (total_mem)
+    *total_mem = textureBytes;
+  if (out_text)
+  {
+    const eastl::string report = nau::utils::format("Null driver: {} textures ({} Kb), {} buffers ({} Kb), no device memory is used\n",
+      textureCount, textureBytes >> 10, stats.bufferCount.load(std::memory_order_relaxed),
+      stats.bufferBytes.load(std::memory_order_relaxed) >> 10);
+    out_text->append(report.c_str());
+  }
+}
+
+bool d3d::is_inited() { return api_state.isInitialized && api_state.initVideoDone; }
+
+bool d3d::init_driver()
+{
+  if (d3d::is_inited())
+  {
+    NAU_LOG_ERROR("Driver is already created");
+    return false;
+  }
+  api_state.isInitialized = true;
+  return true;
+}
+
+void d3d::release_driver()
+{
+  TEXQL_SHUTDOWN_TEX();
+  tql::termTexStubs();
+  api_state.releaseAll();
+  api_state.isInitialized = false;
+  api_state.initVideoDone = false;
+}
+
+bool d3d::init_video(void *, main_wnd_f *, const char *, int, void *&mainwnd, void *renderwnd, void *, const char *, Driver3dInitCallback *)
+{
+  // There is no output: the window (if any) is kept only as the identity of the default swapchain.
+  mainwnd = renderwnd;
+
+  api_state.adjustCaps();
+  api_state.resizeSwapchain(api_state.swapchains[DEFAULT_SWAPID], DEFAULT_SCREEN_WIDTH, DEFAULT_SCREEN_HEIGHT);
+  api_state.backbufferDepth =
+    new StubTexture(RES3D_TEX, TEXFMT_DEPTH24 | TEXCF_RTARGET, DEFAULT_SCREEN_WIDTH, DEFAULT_SCREEN_HEIGHT, 1, 1, u8"backbuffer_depth");
+  api_state.renderTarget.setBackbufColor();
+  api_state.viewport = {{0, 0, DEFAULT_SCREEN_WIDTH, DEFAULT_SCREEN_HEIGHT}, 0.f, 1.f};
+
+  tql::initTexStubs();
+
+  NAU_LOG_DEBUG("Null driver: init_video done");
+  api_state.initVideoDone = true;
+  return true;
+}
+
+void d3d::prepare_for_destroy() {}
+
+void d3d::window_destroyed(void *) {}
+
+void d3d::reserve_res_entries(bool, int, int, int, int, int, int, int) {}
+
+void d3d::get_max_used_res_entries(int &max_tex, int &max_vs, int &max_ps, int &max_vdecl, int &max_vb, int &max_ib, int &max_stblk)
+{
+  get_cur_used_res_entries(max_tex, max_vs, max_ps, max_vdecl, max_vb, max_ib, max_stblk);
+}
+
+void d3d::get_cur_used_res_entries(int &max_tex, int &max_vs, int &max_ps, int &max_vdecl, int &max_vb, int &max_ib, int &max_stblk)
+{
+  const ResourceStats &stats = get_resource_stats();
+  max_tex = stats.textureCount.load(std::memory_order_relaxed);
+  max_vb = stats.bufferCount.load(std::memory_order_relaxed);
+  max_vs = max_ps = api_state.nextShaderId.load(std::memory_order_relaxed);
+  max_vdecl = api_state.nextVdeclId.load(std::memory_order_relaxed);
+  max_ib = 0;
+  max_stblk = 0;
+}
+
+const char *d3d::get_driver_name() { return "Null"; }
+
+DriverCode d3d::get_driver_code() { return DriverCode::make(d3d::stub); }
+
+const char *d3d::get_device_name() { return "Null device"; }
+
+const char *d3d::get_last_error() { return "no error"; }
+
+uint32_t d3d::get_last_error_code() { return 0; }
+
+const char *d3d::get_device_driver_version() { return "1.0"; }
+
+void *d3d::get_device() { return nullptr; }
+
+const Driver3dDesc &d3d::get_driver_desc() { return api_state.driverDesc; }
+
+int d3d::driver_command(int command, void *par1, void *par2, void *par3)
+{
+  G_UNUSED(par3);
+  switch (command)
+  {
+    case DRV3D_COMMAND_GET_FRAME_DRAW_STATS: *static_cast<Drv3dDrawStats *>(par1) = api_state.lastFrameDrawStats; return 1;
+    case DRV3D_COMMAND_GET_CURRENT_DRAW_STATS: *static_cast<Drv3dDrawStats *>(par1) = api_state.frameDrawStats; return 1;
+    case DRV3D_COMMAND_ACQUIRE_OWNERSHIP: api_state.globalLock.lock(); break;
+    case DRV3D_COMMAND_RELEASE_OWNERSHIP: api_state.globalLock.unlock(); break;
+    case D3V3D_COMMAND_TIMESTAMPFREQ: *reinterpret_cast<uint64_t *>(par1) = TIMESTAMP_FREQUENCY; return 1;
+    case D3V3D_COMMAND_TIMESTAMPISSUE:
+    {
+      // All the timestamps share the one dummy query, nothing is allocated.
+      void **q = static_cast<void **>(par1);
+      if (!*q)
+        *q = &timestamp_query;
+      return 1;
+    }
+    case D3V3D_COMMAND_TIMESTAMPGET:
+      if (par1)
+      {
+        *reinterpret_cast<uint64_t *>(par2) = 0;
+        return 1;
+      }
+      break;
+    case DRV3D_COMMAND_RELEASE_QUERY:
+      if (par1)
+        *static_cast<void **>(par1) = nullptr;
+      break;
+    default: break;
+  }
+  return 0;
+}
+
+bool d3d::device_lost(bool *can_reset_now)
+{
+  if (can_reset_now)
+    *can_reset_now = false;
+  return false;
+}
+
+bool d3d::is_in_device_reset_now() { return false; }
+
+bool d3d::reset_device() { return true; }
+
+bool d3d::check_texformat(int) { return true; }
+
+int d3d::get_max_sample_count(int) { return 1; }
+
+bool d3d::issame_texformat(int cflg1, int cflg2) { return BaseTextureImpl::isSameFormat(cflg1, cflg2); }
+
+bool d3d::check_cubetexformat(int) { return true; }
+
+bool d3d::issame_cubetexformat(int cflg1, int cflg2) { return BaseTextureImpl::isSameFormat(cflg1, cflg2); }
+
+bool d3d::check_voltexformat(int) { return true; }
+
+bool d3d::issame_voltexformat(int cflg1, int cflg2) { return BaseTextureImpl::isSameFormat(cflg1, cflg2); }
+
+void d3d::discard_managed_textures() {}
+
+bool d3d::stretch_rect(BaseTexture *, BaseTexture *, nau::math::RectInt *, nau::math::RectInt *) { return true; }
+
+bool d3d::copy_from_current_render_target(BaseTexture *) { return true; }
+
+unsigned d3d::get_texformat_usage(int, int)
+{
+  return USAGE_TEXTURE | USAGE_VERTEXTEXTURE | USAGE_RTARGET | USAGE_DEPTH | USAGE_FILTER | USAGE_BLEND | USAGE_UNORDERED |
+         USAGE_UNORDERED_LOAD;
+}
+
+VPROG d3d::create_vertex_shader(const uint32_t *) { return api_state.nextShaderId++; }
+
+VPROG d3d::create_raw_vertex_shader(eastl::span<const uint8_t>, const dxil::ShaderResourceUsageTable &, VDECL)
+{
+  return api_state.nextShaderId++;
+}
+
+NAU_RENDER_EXPORT VPROG d3d::create_raw_vs_hs_ds_gs(VertexHullDomainGeometryShadersCreationDesc) { return api_state.nextShaderId++; }
+
+FSHADER d3d::create_raw_pixel_shader(eastl::span<const uint8_t>, const dxil::ShaderResourceUsageTable &)
+{
+  return api_state.nextShaderId++;
+}
+
+void d3d::delete_vertex_shader(VPROG) {}
+
+int d3d::set_cs_constbuffer_size(int required_size) { return required_size; }
+
+int d3d::set_vs_constbuffer_size(int required_size) { return required_size; }
+
+FSHADER d3d::create_pixel_shader(const uint32_t *) { return api_state.nextShaderId++; }
+
+void d3d::delete_pixel_shader(FSHADER) {}
+
+PROGRAM d3d::get_debug_program() { return BAD_PROGRAM; }
+
+PROGRAM d3d::create_program(VPROG, FSHADER, VDECL vdecl, unsigned *, unsigned)
+{
+  lock_(api_state.objectsMutex);
+  api_state.programVdecls.push_back(vdecl);
+  return PROGRAM(api_state.programVdecls.size() - 1);
+}
+
+PROGRAM d3d::create_program(const uint32_t *, const uint32_t *, VDECL vdecl, unsigned *strides, unsigned streams)
+{
+  return create_program(BAD_VPROG, BAD_FSHADER, vdecl, strides, streams);
+}
+
+PROGRAM d3d::create_program_cs(const uint32_t *, CSPreloaded) { return create_program(BAD_VPROG, BAD_FSHADER, BAD_VDECL, nullptr, 0); }
+
+NAU_RENDER_EXPORT PROGRAM d3d::create_raw_program_cs(eastl::span<const uint8_t>, const dxil::ShaderResourceUsageTable &, CSPreloaded)
+{
+  return create_program(BAD_VPROG, BAD_FSHADER, BAD_VDECL, nullptr, 0);
+}
+
+bool d3d::set_program(PROGRAM) { return true; }
+
+void d3d::delete_program(PROGRAM) {}
+
+VPROG d3d::create_vertex_shader_dagor(const VPRTYPE *, int) { return BAD_VPROG; }
+
+VPROG d3d::create_vertex_shader_asm(const char *) { return BAD_VPROG; }
+
+FSHADER d3d::create_pixel_shader_dagor(const FSHTYPE *, int) { return BAD_FSHADER; }
+
+FSHADER d3d::create_pixel_shader_asm(const char *) { return BAD_FSHADER; }
+
+#if _TARGET_PC_WIN
+VPROG d3d::create_vertex_shader_hlsl(const char *, unsigned, const char *, const char *, nau::string *) { return BAD_VPROG; }
+
+FSHADER d3d::create_pixel_shader_hlsl(const char *, unsigned, const char *, const char *, nau::string *) { return BAD_FSHADER; }
+#endif
+
+bool d3d::set_pixel_shader(FSHADER) { return true; }
+
+bool d3d::set_vertex_shader(VPROG) { return true; }
+
+VDECL d3d::get_program_vdecl(PROGRAM prog)
+{
+  lock_(api_state.objectsMutex);
+  return prog >= 0 && prog < int(api_state.programVdecls.size()) ? api_state.programVdecls[prog] : BAD_VDECL;
+}
+
+bool d3d::set_const(unsigned, unsigned, const void *, unsigned) { return true; }
+
+bool d3d::set_immediate_const(unsigned, const uint32_t *, unsigned) { return true; }
+
+bool d3d::set_blend_factor(nau::math::E3DCOLOR) { return true; }
+
+bool d3d::set_tex(unsigned, unsigned, BaseTexture *, bool) { return true; }
+
+bool d3d::set_rwtex(unsigned, unsigned, BaseTexture *, uint32_t, uint32_t, bool) { return true; }
+
+bool d3d::clear_rwtexi(BaseTexture *, const unsigned[4], uint32_t, uint32_t) { return true; }
+
+bool d3d::clear_rwtexf(BaseTexture *, const float[4], uint32_t, uint32_t) { return true; }
+
+bool d3d::clear_rwbufi(Sbuffer *, const unsigned[4]) { return true; }
+
+bool d3d::clear_rwbuff(Sbuffer *, const float[4]) { return true; }
+
+bool d3d::set_buffer(unsigned, unsigned, Sbuffer *) { return true; }
+
+bool d3d::set_rwbuffer(unsigned, unsigned, Sbuffer *) { return true; }
+
+bool d3d::set_const_buffer(uint32_t, uint32_t, Sbuffer *, uint32_t, uint32_t) { return true; }
+
+bool d3d::set_render_target()
+{
+  api_state.renderTarget.reset();
+  api_state.renderTarget.setBackbufColor();
+  api_state.renderTarget.setBackbufDepth();
+  int w = 0, h = 0;
+  get_target_size(w, h);
+  api_state.viewport = {{0, 0, w, h}, 0.f, 1.f};
+  return true;
+}
+
+bool d3d::set_depth(Texture *tex, DepthAccess access) { return set_depth(tex, 0, access); }
+
+bool d3d::set_depth(BaseTexture *tex, int layer, DepthAccess access)
+{
+  if (tex)
+    api_state.renderTarget.setDepth(tex, layer, access == DepthAccess::SampledRO);
+  else
+    api_state.renderTarget.removeDepth();
+  return true;
+}
+
+bool d3d::set_backbuf_depth()
+{
+  api_state.renderTarget.setBackbufDepth();
+  return true;
+}
+
+bool d3d::set_render_target(int ri, Texture *tex, int level) { return set_render_target(ri, tex, 0, level); }
+
+bool d3d::set_render_target(int ri, BaseTexture *tex, int layer, int level)
+{
+  if (tex || ri == 0)
+    api_state.renderTarget.setColor(ri, tex, level, layer);
+  else
+    api_state.renderTarget.removeColor(ri);
+
+  if (ri == 0)
+  {
+    int w = 0, h = 0;
+    get_target_size(w, h);
+    api_state.viewport = {{0, 0, w, h}, 0.f, 1.f};
+  }
+  return true;
+}
+
+bool d3d::set_render_target(const Driver3dRenderTarget &rt)
+{
+  api_state.renderTarget = rt;
+  int w = 0, h = 0;
+  get_target_size(w, h);
+  api_state.viewport = {{0, 0, w, h}, 0.f, 1.f};
+  return true;
+}
+
+void d3d::get_render_target(Driver3dRenderTarget &out_rt) { out_rt = api_state.renderTarget; }
+
+bool d3d::get_target_size(int &w, int &h)
+{
+  const Driver3dRenderTarget &rt = api_state.renderTarget;
+  if (rt.used & Driver3dRenderTarget::COLOR0)
+    return get_render_target_size(w, h, rt.color[0].tex, rt.color[0].level);
+  if ((rt.used & Driver3dRenderTarget::DEPTH) && rt.depth.tex)
+    return get_render_target_size(w, h, rt.depth.tex, rt.depth.level);
+  return get_render_target_size(w, h, nullptr, 0);
+}
+
+bool d3d::get_render_target_size(int &w, int &h, BaseTexture *rt_tex, int lev)
+{
+  if (!rt_tex)
+  {
+    get_screen_size(w, h);
+    return true;
+  }
+
+  TextureInfo info;
+  rt_tex->getinfo(info, lev);
+  w = info.w;
+  h = info.h;
+  return true;
+}
+
+bool d3d::setviews(eastl::span<const Viewport> viewports)
+{
+  NAU_ASSERT(viewports.size() < Viewport::MAX_VIEWPORT_COUNT);
+  if (!viewports.empty())
+    api_state.viewport = viewports[0];
+  return true;
+}
+
+bool d3d::setview(int x, int y, int w, int h, float minz, float maxz)
+{
+  Viewport viewport = {{x, y, w, h}, minz, maxz};
+  return setviews(make_span_const(&viewport, 1));
+}
+
+bool d3d::getview(int &x, int &y, int &w, int &h, float &minz, float &maxz)
+{
+  const Viewport &viewport = api_state.viewport;
+  x = viewport.x;
+  y = viewport.y;
+  w = viewport.w;
+  h = viewport.h;
+  minz = viewport.minz;
+  maxz = viewport.maxz;
+  return true;
+}
+
+bool d3d::setscissor(int, int, int, int) { return true; }
+
+bool d3d::setscissors(eastl::span<const ScissorRect>) { return true; }
+
+bool d3d::clearview(int, nau::math::E3DCOLOR, float, uint32_t) { return true; }
+
+bool d3d::update_screen(bool)
+{
+  api_state.lastFrameDrawStats = api_state.frameDrawStats;
+  api_state.frameDrawStats = {};
+  return true;
+}
+
+bool d3d::is_window_occluded() { return false; }
+
+bool d3d::should_use_compute_for_image_processing(std::initializer_list<unsigned>) { return false; }
+
+bool d3d::setvsrc_ex(int, Vbuffer *, int, int) { return true; }
+
+bool d3d::setind(Ibuffer *) { return true; }
+
+VDECL d3d::create_vdecl(VSDTYPE *) { return api_state.nextVdeclId++; }
+
+void d3d::delete_vdecl(VDECL) {}
+
+bool d3d::setvdecl(VDECL) { return true; }
+
+bool d3d::draw_base(int, int, int numprim, uint32_t num_instances, uint32_t)
+{
+  api_state.countDraws(1, num_instances, uint64_t(numprim) * num_instances);
+  return true;
+}
+
+bool d3d::drawind_base(int, int, int numprim, int, uint32_t num_instances, uint32_t)
+{
+  api_state.countDraws(1, num_instances, uint64_t(numprim) * num_instances);
+  return true;
+}
+
+bool d3d::draw_up(int, int numprim, const void *, int)
+{
+  api_state.countDraws(1, 1, numprim);
+  return true;
+}
+
+bool d3d::drawind_up(int, int, int, int numprim, const uint16_t *, const void *, int)
+{
+  api_state.countDraws(1, 1, numprim);
+  return true;
+}
+
+bool d3d::dispatch(uint32_t, uint32_t, uint32_t, GpuPipeline)
+{
+  ++api_state.frameDrawStats.dispatches;
+  return true;
+}
+
+bool d3d::draw_indirect(int, Sbuffer *, uint32_t)
+{
+  api_state.countDraws(1, 0, 0);
+  return true;
+}
+
+bool d3d::draw_indexed_indirect(int, Sbuffer *, uint32_t)
+{
+  api_state.countDraws(1, 0, 0);
+  return true;
+}
+
+bool d3d::multi_draw_indirect(int, Sbuffer *, uint32_t draw_count, uint32_t, uint32_t)
+{
+  api_state.countDraws(draw_count, 0, 0);
+  return true;
+}
+
+bool d3d::multi_draw_indexed_indirect(int, Sbuffer *, uint32_t draw_count, uint32_t, uint32_t)
+{
+  api_state.countDraws(draw_count, 0, 0);
+  return true;
+}
+
+bool d3d::dispatch_indirect(Sbuffer *, uint32_t, GpuPipeline)
+{
+  ++api_state.frameDrawStats.dispatches;
+  return true;
+}
+
+void d3d::dispatch_mesh(uint32_t, uint32_t, uint32_t) {}
+
+void d3d::dispatch_mesh_indirect(Sbuffer *, uint32_t, uint32_t, uint32_t) {}
+
+void d3d::dispatch_mesh_indirect_count(Sbuffer *, uint32_t, uint32_t, Sbuffer *, uint32_t, uint32_t) {}
+
+GPUFENCEHANDLE d3d::insert_fence(GpuPipeline) { return BAD_GPUFENCEHANDLE; }
+
+void d3d::insert_wait_on_fence(GPUFENCEHANDLE &fence, GpuPipeline) { fence = BAD_GPUFENCEHANDLE; }
+
+bool d3d::setantialias(int) { return true; }
+
+int d3d::getantialias() { return 0; }
+
+bool d3d::setstencil(uint32_t) { return true; }
+
+bool d3d::setwire(bool) { return true; }
+
+bool d3d::setgamma(float) { return true; }
+
+bool d3d::set_msaa_pass() { return true; }
+
+bool d3d::set_depth_resolve() { return true; }
+
+bool d3d::isVcolRgba() { return true; }
+
+float d3d::get_screen_aspect_ratio()
+{
+  int w = 0, h = 0;
+  get_screen_size(w, h);
+  return h > 0 ? float(w) / float(h) : 1.f;
+}
+
+void d3d::change_screen_aspect_ratio(float) {}
+
+void *d3d::fast_capture_screen(int &w, int &h, int &stride_bytes, int &format)
+{
+  w = h = stride_bytes = 0;
+  format = 0;
+  return nullptr;
+}
+
+void d3d::end_fast_capture_screen() {}
+
+TexPixel32 *d3d::capture_screen(int &w, int &h, int &stride_bytes)
+{
+  w = h = stride_bytes = 0;
+  return nullptr;
+}
+
+void d3d::release_capture_buffer() {}
+
+void d3d::get_screen_size(int &w, int &h)
+{
+  const Swapchain *swapchain = api_state.getSwapchain(DEFAULT_SWAPID);
+  w = swapchain ? swapchain->width : DEFAULT_SCREEN_WIDTH;
+  h = swapchain ? swapchain->height : DEFAULT_SCREEN_HEIGHT;
+}
+
+void d3d::set_screen_size(unsigned int w, unsigned int h) { set_screen_size(w, h, DEFAULT_SWAPID); }
+
+void d3d::set_screen_size(unsigned int w, unsigned int h, SWAPID swapID)
+{
+  if (Swapchain *swapchain = api_state.getSwapchain(swapID))
+    api_state.resizeSwapchain(*swapchain, w, h);
+}
+
+bool d3d::set_srgb_backbuffer_write(bool) { return false; }
+
+void d3d::beginEvent(const char *) {}
+
+void d3d::endEvent() {}
+
+bool d3d::set_depth_bounds(float, float) { return false; }
+
+bool d3d::supports_depth_bounds() { return false; }
+
+bool d3d::begin_survey(int) { return false; }
+
+void d3d::end_survey(int) {}
+
+int d3d::create_predicate() { return api_state.nextPredicateId++; }
+
+void d3d::free_predicate(int) {}
+
+void d3d::begin_conditional_render(int) {}
+
+void d3d::end_conditional_render(int) {}
+
+bool d3d::get_vrr_supported() { return false; }
+
+bool d3d::get_vsync_enabled() { return false; }
+
+bool d3d::enable_vsync(bool enable) { return !enable; }
+
+#if _TARGET_PC_WIN
+bool d3d::pcwin32::set_capture_full_frame_buffer(bool) { return false; }
+
+void d3d::pcwin32::set_present_wnd(void *) {}
+#endif
+
+d3d::EventQuery *d3d::create_event_query() { return reinterpret_cast<d3d::EventQuery *>(&event_query); }
+
+void d3d::release_event_query(d3d::EventQuery *) {}
+
+bool d3d::issue_event_query(d3d::EventQuery *) { return true; }
+
+bool d3d::get_event_query_status(d3d::EventQuery *, bool) { return true; }
+
+void d3d::get_video_modes_list(eastl::vector<nau::string> &list) { list.clear(); }
+
+Vbuffer *d3d::create_vb(int size, int flg, const char8_t *name) { return new StubBuffer(0, size, flg | SBCF_BIND_VERTEX, name); }
+
+Ibuffer *d3d::create_ib(int size, int flg, const char8_t *stat_name) { return new StubBuffer(0, size, flg | SBCF_BIND_INDEX, stat_name); }
+
+Sbuffer *d3d::create_cb(int size, int flg, const char8_t *stat_name)
+{
+  return new StubBuffer(0, size, flg | SBCF_BIND_CONSTANT, stat_name);
+}
+
+Vbuffer *d3d::create_sbuffer(int struct_size, int elements, unsigned flags, unsigned, const char8_t *name)
+{
+  return new StubBuffer(struct_size, elements, flags, name);
+}
+
+Texture *d3d::get_backbuffer_tex()
+{
+  const Swapchain *swapchain = api_state.getSwapchain(DEFAULT_SWAPID);
+  return swapchain ? swapchain->color : nullptr;
+}
+
+Texture *d3d::get_secondary_backbuffer_tex() { return nullptr; }
+
+Texture *d3d::get_backbuffer_tex_depth() { return api_state.backbufferDepth; }
+
+#include "drv3d_commonCode/rayTracingStub.inc.h"
+
+shaders::DriverRenderStateId d3d::create_render_state(const shaders::RenderState &)
+{
+  return shaders::DriverRenderStateId{api_state.nextRenderStateId++};
+}
+
+bool d3d::set_render_state(shaders::DriverRenderStateId) { return true; }
+
+void d3d::clear_render_states() {}
+
+void d3d::set_variable_rate_shading(unsigned, unsigned, VariableRateShadingCombiner, VariableRateShadingCombiner) {}
+
+void d3d::set_variable_rate_shading_texture(BaseTexture *) {}
+
+void d3d::resource_barrier(ResourceBarrierDesc, GpuPipeline) {}
+
+d3d::SamplerHandle d3d::create_sampler(const d3d::SamplerInfo &)
+{
+  return reinterpret_cast<d3d::SamplerHandle>(++api_state.nextSamplerId);
+}
+
+void d3d::destroy_sampler(d3d::SamplerHandle) {}
+
+void d3d::set_sampler(unsigned, unsigned, d3d::SamplerHandle) {}
+
+uint32_t d3d::register_bindless_sampler(BaseTexture *) { return 0; }
+
+ResourceAllocationProperties d3d::get_resource_allocation_properties(const ResourceDescription &) { return {0, 1, nullptr}; }
+
+ResourceHeap *d3d::create_resource_heap(ResourceHeapGroup *, size_t, ResourceHeapCreateFlags) { return nullptr; }
+
+void d3d::destroy_resource_heap(ResourceHeap *) {}
+
+Sbuffer *d3d::place_buffere_in_resource_heap(ResourceHeap *, const ResourceDescription &, size_t, const ResourceAllocationProperties &,
+  const char8_t *)
+{
+  return nullptr;
+}
+
+BaseTexture *d3d::place_texture_in_resource_heap(ResourceHeap *, const ResourceDescription &, size_t,
+  const ResourceAllocationProperties &, const char8_t *)
+{
+  return nullptr;
+}
+
+ResourceHeapGroupProperties d3d::get_resource_heap_group_properties(ResourceHeapGroup *) { return {}; }
+
+void d3d::map_tile_to_resource(BaseTexture *, ResourceHeap *, const TileMapping *, size_t) {}
+
+TextureTilingInfo d3d::get_texture_tiling_info(BaseTexture *, size_t) { return {}; }
+
+IMPLEMENT_D3D_RESOURCE_ACTIVATION_API_USING_GENERIC()
+
+uint32_t d3d::allocate_bindless_resource_range(uint32_t, uint32_t) { return 0; }
+
+uint32_t d3d::resize_bindless_resource_range(uint32_t, uint32_t index, uint32_t, uint32_t) { return index; }
+
+void d3d::free_bindless_resource_range(uint32_t, uint32_t, uint32_t) {}
+
+void d3d::update_bindless_resource(uint32_t, D3dResource *) {}
+
+void d3d::update_bindless_resources_to_null(uint32_t, uint32_t, uint32_t) {}
+
+SWAPID d3d::create_swapchain(void *)
+{
+  const SWAPID id = api_state.nextSwapchainId++;
+  api_state.resizeSwapchain(api_state.swapchains[id], DEFAULT_SCREEN_WIDTH, DEFAULT_SCREEN_HEIGHT);
+  return id;
+}
+
+void d3d::remove_swapchain(SWAPID swapID)
+{
+  if (Swapchain *swapchain = api_state.getSwapchain(swapID))
+  {
+    del_d3dres(swapchain->color);
+    api_state.swapchains.erase(swapID);
+  }
+}
+
+NAU_RENDER_EXPORT void d3d::finish_render_commands() {}
+
+BaseTexture *d3d::get_back_buffer_rt(SWAPID id)
+{
+  const Swapchain *swapchain = api_state.getSwapchain(id);
+  return swapchain ? swapchain->color : nullptr;
+}
+
+Texture *d3d::create_tex(TexImage32 *img, int w, int h, int flg, int levels, const char8_t *stat_name)
+{
+  NAU_ASSERT_RETURN(!img, nullptr, "The null driver does not create the textures from the images");
+  return new StubTexture(RES3D_TEX, flg, w, h, 1, levels, stat_name);
+}
+
+CubeTexture *d3d::create_cubetex(int size, int flg, int levels, const char8_t *stat_name)
+{
+  return new StubTexture(RES3D_CUBETEX, flg, size, size, 1, levels, stat_name);
+}
+
+VolTexture *d3d::create_voltex(int w, int h, int d, int flg, int levels, const char8_t *stat_name)
+{
+  return new StubTexture(RES3D_VOLTEX, flg, w, h, d, levels, stat_name);
+}
+
+ArrayTexture *d3d::create_array_tex(int w, int h, int d, int flg, int levels, const char8_t *stat_name)
+{
+  return new StubTexture(RES3D_ARRTEX, flg, w, h, d, levels, stat_name);
+}
+
+ArrayTexture *d3d::create_cube_array_tex(int side, int d, int flg, int levels, const char8_t *stat_name)
+{
+  return new StubTexture(RES3D_CUBEARRTEX, flg, side, side, d, levels, stat_name);
+}
+
+BaseTexture *d3d::create_ddsx_tex(nau::iosys::IGenLoad &crd, int flg, int quality_id, int levels, const char8_t *stat_name)
+{
+  ddsx::Header hdr;
+  if (!crd.readExact(&hdr, sizeof(hdr)) || !hdr.checkLabel())
+  {
+    NAU_LOG_DEBUG("invalid DDSx format");
+    return nullptr;
+  }
+
+  // The content is skipped, the stream is left after the texture data as if it was loaded.
+  BaseTexture *tex = alloc_ddsx_tex(hdr, flg, quality_id, levels, stat_name, -1);
+  crd.seekrel(hdr.packedSz ? hdr.packedSz : hdr.memSz);
+  return tex;
+}
+
+BaseTexture *d3d::alloc_ddsx_tex(const ddsx::Header &hdr, int flg, int q_id, int levels, const char8_t *stat_name, int)
+{
+  flg = implant_d3dformat(flg, hdr.d3dFormat);
+  flg |= (hdr.flags & hdr.FLG_GAMMA_EQ_1) ? 0 : TEXCF_SRGBREAD;
+
+  if (levels <= 0)
+    levels = hdr.levels;
+
+  int resType;
+  if (hdr.flags & ddsx::Header::FLG_CUBTEX)
+    resType = RES3D_CUBETEX;
+  else if (hdr.flags & ddsx::Header::FLG_VOLTEX)
+    resType = RES3D_VOLTEX;
+  else if (hdr.flags & ddsx::Header::FLG_ARRTEX)
+    resType = RES3D_ARRTEX;
+  else
+    resType = RES3D_TEX;
+
+  const int skipLevels = hdr.getSkipLevels(hdr.getSkipLevelsFromQ(q_id), levels);
+  const int w = eastl::max(hdr.w >> skipLevels, 1), h = eastl::max(hdr.h >> skipLevels, 1);
+  int d = eastl::max(hdr.depth >> skipLevels, 1);
+  if (!(hdr.flags & hdr.FLG_VOLTEX))
+    d = (hdr.flags & hdr.FLG_ARRTEX) ? hdr.depth : 1;
+
+  return new StubTexture(resType, flg, w, h, d, levels, stat_name);
+}
+
+#if _TARGET_PC_WIN
+unsigned d3d::pcwin32::get_texture_format(BaseTexture *tex)
+{
+  const auto *bt = static_cast<StubTexture *>(tex);
+  return bt ? texfmt_to_d3dformat(bt->cflg & TEXFMT_MASK) : 0;
+}
+
+const char *d3d::pcwin32::get_texture_format_str(BaseTexture *tex)
+{
+  const auto *bt = static_cast<StubTexture *>(tex);
+  return bt ? get_tex_format_name(bt->cflg & TEXFMT_MASK) : nullptr;
+}
+
+void *d3d::pcwin32::get_native_surface(BaseTexture *) { return nullptr; }
+#endif
+
+bool d3d::set_tex_usage_hint(int, int, int, const char *, unsigned int) { return true; }
+
+// The stub textures own no memory, so the aliases are the separate textures of the requested description.
+Texture *d3d::alias_tex(Texture *, TexImage32 *img, int w, int h, int flg, int levels, const char8_t *stat_name)
+{
+  return create_tex(img, w, h, flg, levels, stat_name);
+}
+
+CubeTexture *d3d::alias_cubetex(CubeTexture *, int size, int flg, int levels, const char8_t *stat_name)
+{
+  return create_cubetex(size, flg, levels, stat_name);
+}
+
+VolTexture *d3d::alias_voltex(VolTexture *, int w, int h, int d, int flg, int levels, const char8_t *stat_name)
+{
+  return create_voltex(w, h, d, flg, levels, stat_name);
+}
+
+ArrayTexture *d3d::alias_array_tex(ArrayTexture *, int w, int h, int d, int flg, int levels, const char8_t *stat_name)
+{
+  return create_array_tex(w, h, d, flg, levels, stat_name);
+}
+
+ArrayTexture *d3d::alias_cube_array_tex(ArrayTexture *, int side, int d, int flg, int levels, const char8_t *stat_name)
+{
+  return create_cube_array_tex(side, d, flg, levels, stat_name);
+}
+
+IMPLEMENT_D3D_RUB_API_USING_GENERIC()
+
+IMPLEMENT_D3D_RENDER_PASS_API_USING_GENERIC()
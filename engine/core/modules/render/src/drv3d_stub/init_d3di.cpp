@@ -0,0 +1,7 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#define DRV3D_CODE decltype(d3dit.driverCode)::make(stub)
+
+#include "drv3d_commonCode/init_d3di.inc.h"
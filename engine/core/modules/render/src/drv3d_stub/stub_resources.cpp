@@ -0,0 +1,262 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "stub_resources.h"
+
+#include <EASTL/algorithm.h>
+
+using namespace drv3d_stub;
+
+namespace
+{
+uint32_t get_level_extent(uint32_t extent, int level) { return eastl::max<uint32_t>(extent >> level, 1u); }
+
+uint32_t get_layer_count(int res_type, int depth)
+{
+  switch (res_type)
+  {
+    case RES3D_CUBETEX: return 6;
+    case RES3D_ARRTEX: return depth;
+    case RES3D_CUBEARRTEX: return depth * 6;
+    default: return 1;
+  }
+}
+} // namespace
+
+ResourceStats &drv3d_stub::get_resource_stats()
+{
+  static ResourceStats stats;
+  return stats;
+}
+
+StubTexture::StubTexture(int res_type, int cflg, int w, int h, int d, int levels, const char8_t *stat_name) :
+  BaseTextureImpl(cflg, res_type)
+{
+  width = w;
+  height = h;
+  depth = d;
+  mipLevels = eastl::clamp(count_mips_if_needed(w, h, cflg, levels), 1, 15);
+  minMipLevel = 0;
+  maxMipLevel = mipLevels - 1;
+  setTexName(stat_name);
+
+  for (int level = 0; level < mipLevels; ++level)
+  {
+    const uint32_t slices = type == RES3D_VOLTEX ? get_level_extent(depth, level) : get_layer_count(type, depth);
+    totalSize += calcLevelPitch(level) * calcLevelRows(level) * slices;
+  }
+
+  ResourceStats &stats = get_resource_stats();
+  stats.textureCount.fetch_add(1, std::memory_order_relaxed);
+  stats.textureBytes.fetch_add(totalSize, std::memory_order_relaxed);
+}
+
+StubTexture::~StubTexture()
+{
+  ResourceStats &stats = get_resource_stats();
+  stats.textureCount.fetch_sub(1, std::memory_order_relaxed);
+  stats.textureBytes.fetch_sub(totalSize, std::memory_order_relaxed);
+}
+
+void StubTexture::destroy() { delete this; }
+
+int StubTexture::ressize() const { return totalSize; }
+
+uint32_t StubTexture::calcLevelPitch(int level) const
+{
+  const TextureFormatDesc &desc = get_tex_format_desc(cflg & TEXFMT_MASK);
+  const uint32_t elementWidth = desc.isBlockFormat ? desc.elementWidth : 1;
+  return (get_level_extent(width, level) + elementWidth - 1) / elementWidth * desc.bytesPerElement;
+}
+
+uint32_t StubTexture::calcLevelRows(int level) const
+{
+  const TextureFormatDesc &desc = get_tex_format_desc(cflg & TEXFMT_MASK);
+  const uint32_t elementHeight = desc.isBlockFormat ? desc.elementHeight : 1;
+  return (get_level_extent(height, level) + elementHeight - 1) / elementHeight;
+}
+
+int StubTexture::update(BaseTexture *) { return 1; }
+
+int StubTexture::updateSubRegion(BaseTexture *, int, int, int, int, int, int, int, int, int, int, int) { return 1; }
+
+int StubTexture::texaddr(int a)
+{
+  addrU = addrV = addrW = a;
+  return 1;
+}
+
+int StubTexture::texaddru(int a)
+{
+  addrU = a;
+  return 1;
+}
+
+int StubTexture::texaddrv(int a)
+{
+  addrV = a;
+  return 1;
+}
+
+int StubTexture::texaddrw(int a)
+{
+  addrW = a;
+  return 1;
+}
+
+int StubTexture::texbordercolor(nau::math::E3DCOLOR c)
+{
+  borderColor = c;
+  return 1;
+}
+
+int StubTexture::texfilter(int m)
+{
+  texFilter = m;
+  return 1;
+}
+
+int StubTexture::texmipmap(int m)
+{
+  mipFilter = m;
+  return 1;
+}
+
+int StubTexture::texlod(float mipmaplod)
+{
+  lodBias = mipmaplod;
+  return 1;
+}
+
+int StubTexture::texmiplevel(int minlev, int maxlev)
+{
+  minMipLevel = minlev < 0 ? 0 : minlev;
+  maxMipLevel = maxlev < 0 ? mipLevels - 1 : maxlev;
+  return 1;
+}
+
+int StubTexture::setAnisotropy(int level)
+{
+  anisotropyLevel = eastl::clamp(level, 1, 16);
+  return 1;
+}
+
+int StubTexture::lockimg(void **p, int &stride_bytes, int level, unsigned flags) { return lockimg(p, stride_bytes, 0, level, flags); }
+
+int StubTexture::lockimg(void **p, int &stride_bytes, int, int level, unsigned flags)
+{
+  NAU_ASSERT_RETURN(!lockedData, 0, "The texture '{}' is locked twice", (const char *)getResName());
+  NAU_ASSERT_RETURN(level < mipLevels, 0);
+
+  stride_bytes = calcLevelPitch(level);
+  lockedLevel = level;
+  lockFlags = flags;
+
+  // Nothing is ever read back: the locked memory is the scratch space for the writes which are dropped on the unlock.
+  if (p)
+  {
+    lockedData = eastl::make_unique<uint8_t[]>(size_t(stride_bytes) * calcLevelRows(level));
+    *p = lockedData.get();
+  }
+  return 1;
+}
+
+int StubTexture::unlockimg()
+{
+  lockedData.reset();
+  lockFlags = 0;
+  return 1;
+}
+
+int StubTexture::lockbox(void **data, int &row_pitch, int &slice_pitch, int level, unsigned flags)
+{
+  NAU_ASSERT_RETURN(!lockedData, 0, "The texture '{}' is locked twice", (const char *)getResName());
+  NAU_ASSERT_RETURN(level < mipLevels, 0);
+
+  row_pitch = calcLevelPitch(level);
+  slice_pitch = row_pitch * calcLevelRows(level);
+  lockedLevel = level;
+  lockFlags = flags;
+
+  if (data)
+  {
+    lockedData = eastl::make_unique<uint8_t[]>(size_t(slice_pitch) * get_level_extent(depth, level));
+    *data = lockedData.get();
+  }
+  return 1;
+}
+
+int StubTexture::unlockbox() { return unlockimg(); }
+
+BaseTexture *StubTexture::makeTmpTexResCopy(int w, int h, int d, int l, bool staging_tex)
+{
+  if (type != RES3D_ARRTEX && type != RES3D_VOLTEX && type != RES3D_CUBEARRTEX)
+    d = 1;
+
+  nau::string tempName = staging_tex ? u8"stg:" : u8"tmp:";
+  tempName.append(getResName());
+  return new StubTexture(type, cflg | (staging_tex ? TEXCF_SYSMEM : 0), w, h, d, l, tempName.c_str());
+}
+
+void StubTexture::replaceTexResObject(BaseTexture *&new_tex)
+{
+  StubTexture *other = static_cast<StubTexture *>(new_tex);
+  NAU_ASSERT_RETURN(other, );
+
+  eastl::swap(width, other->width);
+  eastl::swap(height, other->height);
+  eastl::swap(depth, other->depth);
+  eastl::swap(totalSize, other->totalSize);
+
+  uint32_t levels = mipLevels, minLevel = minMipLevel, maxLevel = maxMipLevel;
+  mipLevels = other->mipLevels, minMipLevel = other->minMipLevel, maxMipLevel = other->maxMipLevel;
+  other->mipLevels = levels, other->minMipLevel = minLevel, other->maxMipLevel = maxLevel;
+
+  del_d3dres(new_tex);
+}
+
+StubBuffer::StubBuffer(int struct_size, int elements, unsigned flags, const char8_t *stat_name) :
+  structSize(struct_size),
+  bufSize(struct_size > 0 ? struct_size * elements : elements),
+  bufFlags(flags)
+{
+  setResName(stat_name);
+
+  ResourceStats &stats = get_resource_stats();
+  stats.bufferCount.fetch_add(1, std::memory_order_relaxed);
+  stats.bufferBytes.fetch_add(bufSize, std::memory_order_relaxed);
+}
+
+StubBuffer::~StubBuffer()
+{
+  ResourceStats &stats = get_resource_stats();
+  stats.bufferCount.fetch_sub(1, std::memory_order_relaxed);
+  stats.bufferBytes.fetch_sub(bufSize, std::memory_order_relaxed);
+}
+
+void StubBuffer::destroy() { delete this; }
+
+int StubBuffer::lock(uint32_t ofs_bytes, uint32_t size_bytes, void **p, int flags)
+{
+  NAU_ASSERT_RETURN(!lockedData, 0, "The buffer '{}' is locked twice", (const char *)getResName());
+  NAU_ASSERT_RETURN(ofs_bytes <= uint32_t(bufSize), 0);
+  checkLockParams(ofs_bytes, size_bytes, flags, bufFlags);
+
+  if (size_bytes == 0)
+    size_bytes = bufSize - ofs_bytes;
+  NAU_ASSERT_RETURN(ofs_bytes + size_bytes <= uint32_t(bufSize), 0);
+
+  if (p)
+  {
+    lockedData = eastl::make_unique<uint8_t[]>(eastl::max(size_bytes, 1u));
+    *p = lockedData.get();
+  }
+  return 1;
+}
+
+int StubBuffer::unlock()
+{
+  lockedData.reset();
+  return 1;
+}
@@ -0,0 +1,98 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <EASTL/unique_ptr.h>
+
+#include <atomic>
+
+#include "drv3d_commonCode/basetexture.h"
+
+namespace drv3d_stub
+{
+// The resources of the null driver have no device objects and no content: the lock returns the scratch memory
+// which is released on the unlock, so a live resource costs only its descriptor.
+
+struct ResourceStats
+{
+  std::atomic<uint32_t> textureCount = 0;
+  std::atomic<uint64_t> textureBytes = 0;
+  std::atomic<uint32_t> bufferCount = 0;
+  std::atomic<uint64_t> bufferBytes = 0;
+};
+
+ResourceStats &get_resource_stats();
+
+class StubTexture final : public BaseTextureImpl
+{
+public:
+  StubTexture(int res_type, int cflg, int w, int h, int d, int levels, const char8_t *stat_name);
+
+  void destroy() override;
+  int ressize() const override;
+  bool isCubeArray() const override { return type == RES3D_CUBEARRTEX; }
+
+  int update(BaseTexture *src) override;
+  int updateSubRegion(BaseTexture *src, int src_subres_idx, int src_x, int src_y, int src_z, int src_w, int src_h, int src_d,
+    int dest_subres_idx, int dest_x, int dest_y, int dest_z) override;
+
+  int texaddr(int a) override;
+  int texaddru(int a) override;
+  int texaddrv(int a) override;
+  int texaddrw(int a) override;
+  int texbordercolor(nau::math::E3DCOLOR c) override;
+  int texfilter(int m) override;
+  int texmipmap(int m) override;
+  int texlod(float mipmaplod) override;
+  int texmiplevel(int minlev, int maxlev) override;
+  int setAnisotropy(int level) override;
+
+  int lockimg(void **p, int &stride_bytes, int level, unsigned flags) override;
+  int lockimg(void **p, int &stride_bytes, int layer, int level, unsigned flags) override;
+  int unlockimg() override;
+  int lockbox(void **data, int &row_pitch, int &slice_pitch, int level, unsigned flags) override;
+  int unlockbox() override;
+
+  int generateMips() override { return 1; }
+
+  BaseTexture *makeTmpTexResCopy(int w, int h, int d, int l, bool staging_tex) override;
+  void replaceTexResObject(BaseTexture *&new_tex) override;
+
+private:
+  ~StubTexture() override;
+
+  uint32_t calcLevelPitch(int level) const;
+  uint32_t calcLevelRows(int level) const;
+
+  eastl::unique_ptr<uint8_t[]> lockedData;
+  int totalSize = 0;
+};
+
+class StubBuffer final : public Sbuffer
+{
+public:
+  StubBuffer(int struct_size, int elements, unsigned flags, const char8_t *stat_name);
+
+  void destroy() override;
+  int ressize() const override { return bufSize; }
+
+  int lock(uint32_t ofs_bytes, uint32_t size_bytes, void **p, int flags) override;
+  int unlock() override;
+  int getFlags() const override { return bufFlags; }
+
+  int getElementSize() const override { return structSize; }
+  int getNumElements() const override { return structSize > 0 ? bufSize / structSize : 0; }
+  bool copyTo(Sbuffer *) override { return true; }
+  bool copyTo(Sbuffer *, uint32_t, uint32_t, uint32_t) override { return true; }
+
+private:
+  ~StubBuffer() override;
+
+  eastl::unique_ptr<uint8_t[]> lockedData;
+  int structSize = 0;
+  int bufSize = 0;
+  int bufFlags = 0;
+};
+} // namespace drv3d_stub
@@ -10,53 +10,135 @@ namespace nau::shader_globals
 {
     namespace detail
     {
-        eastl::unordered_map<eastl::string, eastl::vector<std::byte>> g_shaderDataTable;
+        // The variables values are packed into one buffer, each one starts at the 16 bytes boundary.
+        constexpr size_t VariableAlignment = 16;
+
+        struct VariableInfo
+        {
+            eastl::string name;
+            size_t offset;
+            size_t size;
+            uint64_t revision;
+        };
+
+        eastl::unordered_map<NameId, GlobalVarId> g_nameToId;
+        eastl::vector<VariableInfo> g_variables;
+        eastl::vector<std::byte> g_data;
+        uint64_t g_revision = 0;
 
         std::shared_mutex g_mutex;
+
+        GlobalVarId findId(NameId name)
+        {
+            const auto iter = g_nameToId.find(name);
+            return iter != g_nameToId.end() ? iter->second : InvalidGlobalVarId;
+        }
+
+        VariableInfo& getInfo(GlobalVarId id)
+        {
+            NAU_FATAL(id < g_variables.size(), "Invalid global shader variable id: {}", id);
+            return g_variables[id];
+        }
     } // namespace detail
 
     using namespace detail;
 
-    bool containsName(eastl::string_view name)
+    bool containsName(NameId name)
     {
         shared_lock_(g_mutex);
-        return detail::g_shaderDataTable.contains(name);
+        return findId(name) != InvalidGlobalVarId;
     }
 
-    void addVariable(eastl::string_view name, size_t size, const void* defaultValue /* = nullptr */)
+    GlobalVarId addVariable(eastl::string_view name, size_t size, const void* defaultValue /* = nullptr */)
     {
         NAU_ASSERT(size);
 
         lock_(g_mutex);
 
-        g_shaderDataTable[name.data()] = {};
-        g_shaderDataTable[name.data()].resize(size);
+        GlobalVarId id = findId(name);
+        if (id == InvalidGlobalVarId)
+        {
+            id = static_cast<GlobalVarId>(g_variables.size());
+            g_variables.push_back({eastl::string{name.data(), name.size()}, 0, 0, 0});
+            g_nameToId.emplace(NameId::intern(name), id);
+        }
+        NAU_ASSERT(eastl::string_view{g_variables[id].name} == name, "Global shader variables ({}) and ({}) have the same name hash", g_variables[id].name, name);
 
+        VariableInfo& info = g_variables[id];
+        if (info.size != size)
+        {
+            // The old range of the resized variable is not reused.
+            info.offset = (g_data.size() + VariableAlignment - 1) / VariableAlignment * VariableAlignment;
+            info.size = size;
+            g_data.resize(info.offset + size);
+        }
+
+        std::byte* const data = g_data.data() + info.offset;
         if (defaultValue != nullptr)
         {
-            memcpy(g_shaderDataTable[name.data()].data(), defaultValue, size);
+            memcpy(data, defaultValue, size);
         }
+        else
+        {
+            memset(data, 0, size);
+        }
+        info.revision = ++g_revision;
+
+        return id;
     }
 
-    void setVariable(eastl::string_view name, const void* value)
+    GlobalVarId getVariableId(NameId name)
     {
-        NAU_FATAL(g_shaderDataTable.contains(name), "Global shader variable not found: {}", name.data());
+        shared_lock_(g_mutex);
+        return findId(name);
+    }
 
+    void setVariable(GlobalVarId id, const void* value)
+    {
         NAU_ASSERT(value);
 
-        auto& buf = g_shaderDataTable[name.data()];
-        memcpy(buf.data(), value, buf.size());
+        VariableInfo& info = getInfo(id);
+        std::byte* const data = g_data.data() + info.offset;
+        if (memcmp(data, value, info.size) != 0)
+        {
+            memcpy(data, value, info.size);
+            info.revision = ++g_revision;
+        }
     }
 
-    void getVariable(eastl::string_view name, size_t* size, void** value)
+    void getVariable(GlobalVarId id, size_t* size, void** value)
     {
-        NAU_FATAL(g_shaderDataTable.contains(name), "Global shader variable not found: {}", name.data());
-
         NAU_ASSERT(size);
         NAU_ASSERT(value);
 
-        auto& buf = g_shaderDataTable[name.data()];
-        *size = buf.size();
-        *value = buf.data();
+        const VariableInfo& info = getInfo(id);
+        *size = info.size;
+        *value = g_data.data() + info.offset;
+    }
+
+    uint64_t getRevision()
+    {
+        return g_revision;
+    }
+
+    uint64_t getVariableRevision(GlobalVarId id)
+    {
+        return getInfo(id).revision;
+    }
+
+    void setVariable(NameId name, const void* value)
+    {
+        const GlobalVarId id = getVariableId(name);
+        NAU_FATAL(id != InvalidGlobalVarId, "Global shader variable not found: {}", name.getName());
+
+        setVariable(id, value);
+    }
+
+    void getVariable(NameId name, size_t* size, void** value)
+    {
+        const GlobalVarId id = getVariableId(name);
+        NAU_FATAL(id != InvalidGlobalVarId, "Global shader variable not found: {}", name.getName());
+
+        getVariable(id, size, value);
     }
 } // namespace nau::shaderGlobals
@@ -13,6 +13,7 @@
 #include "nau/dispatch/dynamic_object_impl.h"
 #include "nau/meta/attribute.h"
 #include "nau/runtime/disposable.h"
+#include "nau/scene/components/component_changes.h"
 #include "nau/scene/nau_object.h"
 #include "nau/utils/functor.h"
 
@@ -99,6 +100,13 @@ namespace nau::scene
 
         void onBeforeDeleteObject() override;
 
+        /**
+         * @brief Publishes the changes of an active component to the component change subscribers.
+         *
+         * @param [in] changes Kinds of the changes.
+         */
+        void publishChanges(ComponentChangeFlag changes);
+
     private:
         void addRef() final;
         void releaseRef() final;
@@ -125,8 +133,10 @@ namespace nau::scene
         // TODO: used for notification about value changes.
         //  should not be used (excluded) when scene listener support is off.
         SceneManagerImpl* m_sceneManager = nullptr;
+        uint32_t m_typeRegistryIndex = 0; /** < Position of the active component in the dense array of its type, see SceneManagerImpl. */
 
         friend SceneObject;
+        friend class SceneComponent;
         friend class SceneManagerImpl;
     };
 
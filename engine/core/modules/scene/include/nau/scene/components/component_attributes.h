@@ -12,4 +12,11 @@ namespace nau::scene
     NAU_DEFINE_ATTRIBUTE(ComponentDescriptionAttrib, "nau.scene.component_description", meta::AttributeOptionsNone)
 
     NAU_DEFINE_ATTRIBUTE(HiddenAttributeAttr, "nau.scene.hidden_component", meta::AttributeOptionsNone)
+
+    /**
+     * Marks a component type whose IComponentUpdate::updateComponent can run on the worker threads,
+     * concurrently for the components of the type and with the other thread safe types.
+     * The update must only modify the component itself: no scene graph changes, no other components access.
+     */
+    NAU_DEFINE_ATTRIBUTE(ComponentThreadSafeUpdateAttrib, "nau.scene.component_thread_safe_update", meta::AttributeOptionsNone)
 }  // namespace nau::scene
@@ -0,0 +1,33 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include "nau/math/dag_bounds3.h"
+#include "nau/rtti/type_info.h"
+
+namespace nau::scene
+{
+    /**
+     * @brief Provides the bounds of a scene component for the world spatial index (see IWorld::queryBox).
+     *
+     * Scene components that do not provide the bounds are indexed as points at their world positions.
+     */
+    struct NAU_ABSTRACT_TYPE IComponentBounds
+    {
+        NAU_TYPEID(nau::scene::IComponentBounds)
+
+        /**
+         * @brief Destructor.
+         */
+        virtual ~IComponentBounds() = default;
+
+        /**
+         * @brief Retrieves the bounds of the component in its local space.
+         *
+         * When the bounds are changed the component should publish ComponentChange::Bounds.
+         */
+        virtual math::BBox3 getLocalBounds() const = 0;
+    };
+}  // namespace nau::scene
@@ -0,0 +1,23 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#pragma once
+
+#include "nau/utils/typed_flag.h"
+
+namespace nau::scene
+{
+    /**
+     * @brief Kind of a component change, published to the change subscribers (see ISceneManagerInternal::subscribeComponentChanges).
+     */
+    enum class ComponentChange
+    {
+        Transform = NauFlag(1),
+        Material = NauFlag(2),
+        Visibility = NauFlag(3),
+        Properties = NauFlag(4),
+        Bounds = NauFlag(5) /** < Local bounds of the component are changed (see IComponentBounds). */
+    };
+
+    NAU_DEFINE_TYPED_FLAG(ComponentChange)
+}  // namespace nau::scene
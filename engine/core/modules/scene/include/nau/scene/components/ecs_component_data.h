@@ -0,0 +1,172 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <daECS/core/entityManager.h>
+#include <daECS/core/internal/performQuery.h>
+#include <daECS/core/template_declaration.h>
+
+#include <EASTL/optional.h>
+
+#include "nau/diag/assertion.h"
+
+namespace nau::scene
+{
+    class Component;
+
+    /**
+     * @brief The back reference of the data entity to its authoring component (see EcsComponentData).
+     */
+    struct EcsComponentRef
+    {
+        Component* component = nullptr;
+    };
+}  // namespace nau::scene
+
+ECS_DECLARE_RELOCATABLE_TYPE(nau::scene::EcsComponentRef);
+
+namespace nau::scene
+{
+    /**
+     * @brief The name of the daECS component of the EcsComponentRef.
+     */
+    inline constexpr const char* EcsComponentRefName = ecs::ComponentTypeInfo<EcsComponentRef>::type_name;
+
+    /**
+     * @brief Retrieves the daECS entity manager of the component data, it is initialized on the first call.
+     *
+     * The pending entity destructions are flushed by the scene manager update.
+     */
+    NAU_CORESCENE_EXPORT ecs::EntityManager& getEcsEntityManager();
+
+    /**
+     * @brief The data of a component stored in the daECS archetype chunks instead of the component object.
+     *
+     * @tparam Data The data-only (trivially relocatable) type, declared with ECS_DECLARE_RELOCATABLE_TYPE and registered with
+     *              ECS_REGISTER_RELOCATABLE_TYPE. The type name is the name of its daECS component.
+     *
+     * The component (the authoring facade) keeps the data as its member and moves it into a daECS entity on the activation
+     * (see activate()), the entity holds the data and the EcsComponentRef. The data of all the active components of the type are then
+     * iterated linearly by the bulk systems (see forEachEcsComponentData()) rather than by the component virtual calls.
+     * On the deactivation the data is moved back into the component.
+     *
+     * The data must not be accessed from the different threads, the entity creation and the destruction are only for the main thread.
+     */
+    template <typename Data>
+    class EcsComponentData
+    {
+    public:
+        static constexpr const char* ComponentName = ecs::ComponentTypeInfo<Data>::type_name;
+
+        EcsComponentData() = default;
+
+        EcsComponentData(const EcsComponentData&) = delete;
+        EcsComponentData& operator=(const EcsComponentData&) = delete;
+
+        ~EcsComponentData()
+        {
+            NAU_ASSERT(!isActive(), "The component data must be deactivated with the component");
+        }
+
+        /**
+         * @brief Creates the entity of the data. Called on the component activation.
+         */
+        void activate(Component& component)
+        {
+            NAU_ASSERT(!isActive());
+
+            ecs::ComponentsInitializer initializer;
+            initializer[ECS_HASH_SLOW(ComponentName)] = std::move(*m_inactiveData);
+            initializer[ECS_HASH_SLOW(EcsComponentRefName)] = EcsComponentRef{&component};
+
+            m_entity = getEcsEntityManager().createEntitySync(getTemplate(), std::move(initializer));
+            m_inactiveData.reset();
+        }
+
+        /**
+         * @brief Moves the data back into the component and destroys the entity. Called on the component deactivation.
+         */
+        void deactivate()
+        {
+            if (!isActive())
+            {
+                return;
+            }
+
+            m_inactiveData = std::move(get());
+            getEcsEntityManager().destroyEntityAsync(m_entity);
+            m_entity = INVALID_ENTITY_ID;
+        }
+
+        bool isActive() const
+        {
+            return static_cast<bool>(m_entity);
+        }
+
+        ecs::EntityId getEntityId() const
+        {
+            return m_entity;
+        }
+
+        const Data& get() const
+        {
+            return isActive() ? *getEcsEntityManager().getNullable<Data>(m_entity, ECS_HASH_SLOW(ComponentName)) : *m_inactiveData;
+        }
+
+        Data& get()
+        {
+            return isActive() ? *getEcsEntityManager().getNullableRW<Data>(m_entity, ECS_HASH_SLOW(ComponentName)) : *m_inactiveData;
+        }
+
+        /**
+         * @brief Retrieves the template of the data entities: the data and the component reference.
+         */
+        static ecs::template_t getTemplate()
+        {
+            static const ecs::template_t templateId = []
+            {
+                ecs::ComponentsMap map;
+                map[ECS_HASH_SLOW(ComponentName)] = Data{};
+                map[ECS_HASH_SLOW(EcsComponentRefName)] = EcsComponentRef{};
+
+                const eastl::string templateName = eastl::string{ComponentName} + "$scene_component";
+                getEcsEntityManager();
+                return ecs::CreateTemplate(templateName.c_str(), std::move(map), {});
+            }();
+
+            return templateId;
+        }
+
+    private:
+        ecs::EntityId m_entity = INVALID_ENTITY_ID;
+        eastl::optional<Data> m_inactiveData = Data{};
+    };
+
+    /**
+     * @brief Iterates the data of all the active components of the data type chunk by chunk.
+     *
+     * @param [in] callback Called with the (mutable) data and its authoring component: `void(Data&, Component&)`.
+     */
+    template <typename Data, typename Callback>
+    void forEachEcsComponentData(Callback&& callback)
+    {
+        static const ecs::ComponentDesc rwComponents[] = {
+            {ECS_HASH_SLOW(EcsComponentData<Data>::ComponentName), ecs::ComponentTypeInfo<Data>::type}};
+        static const ecs::ComponentDesc roComponents[] = {
+            {ECS_HASH_SLOW(EcsComponentRefName), ecs::ComponentTypeInfo<EcsComponentRef>::type}};
+
+        ecs::EntityManager& manager = getEcsEntityManager();
+        static const ecs::QueryId queryId = manager.createQuery(ecs::NamedQueryDesc{EcsComponentData<Data>::ComponentName, rwComponents, roComponents});
+
+        ecs::perform_query(&manager, queryId, [&callback](const ecs::QueryView& view)
+        {
+            // The view is the range of the entities in the chunk: the data of the range is contiguous.
+            for (ecs::QueryIterator i = view.begin(), end = view.end(); i != end; ++i)
+            {
+                callback(view.getComponentRW<Data>(view.getRwStart(), i), *view.getComponentRO<EcsComponentRef>(view.getRoStart(), i).component);
+            }
+        });
+    }
+}  // namespace nau::scene
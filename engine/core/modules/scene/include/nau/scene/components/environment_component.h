@@ -17,12 +17,22 @@ namespace nau::scene
 
         NAU_CLASS_FIELDS(
             CLASS_NAMED_FIELD(m_textureAsset, "texture"),
+            CLASS_NAMED_FIELD(m_irradianceAsset, "irradiance_texture"),
+            CLASS_NAMED_FIELD(m_reflectionAsset, "reflection_texture"),
             CLASS_NAMED_FIELD(m_enviIntensity, "environment_intensity"))
 
     public:
         TextureAssetRef getTextureAsset() const;
         void setTextureAsset(const TextureAssetRef& texture);
 
+        /**
+         * The cooked prefiltered cubemaps of the panorama (e.g. BC6H DDS): the irradiance map without mips and the GGX reflection map
+         * with the roughness in the mips. The maps are computed from the panorama at runtime when they are not set.
+         */
+        TextureAssetRef getIrradianceAsset() const;
+        TextureAssetRef getReflectionAsset() const;
+        void setPrefilteredAssets(const TextureAssetRef& irradiance, const TextureAssetRef& reflection);
+
         bool isTextureDirty() const;
         void resetIsTextureDirty();
 
@@ -31,6 +41,8 @@ namespace nau::scene
 
     private:
         TextureAssetRef m_textureAsset;
+        TextureAssetRef m_irradianceAsset;
+        TextureAssetRef m_reflectionAsset;
         float m_enviIntensity = 1.0f;
 
         bool m_isTextureDirty = true;
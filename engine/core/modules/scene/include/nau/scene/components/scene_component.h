@@ -6,6 +6,8 @@
 
 #include <EASTL/optional.h>
 
+#include <atomic>
+
 #include "nau/math/transform.h"
 #include "nau/meta/class_info.h"
 #include "nau/scene/components/component.h"
@@ -76,9 +78,26 @@ namespace nau::scene
         void appendTransformChild(SceneComponent& child);
         void removeTransformChild(SceneComponent& child);
 
+        /**
+            @brief  Invalidates the world transform of the component and notifies its change.
+
+            The descendants of an active component are not visited: their cached world transforms are validated against the parent on access,
+            and their change notifications are issued once per frame by the scene manager (see flushTransformChanges).
+        */
+        void markTransformDirty();
+
+        /**
+            @brief  Walks the descendants parent before child: updates their world transforms and notifies their changes.
+        */
+        void flushTransformChanges();
+
     protected:
+        /**
+            @brief  Called when the world transform of the component has changed.
+
+            Called at once for the changed component itself, and by the batched transform update for its descendants.
+        */
         virtual void notifyTransformChanged();
-        virtual void notifyTransformChanged(const math::Transform& worldTransformCache);
 
     protected:
         math::Transform m_transform;
@@ -88,7 +107,14 @@ namespace nau::scene
         SceneComponent* m_transformParent = nullptr;
         eastl::intrusive_list<scene_internal::TransformListNode> m_transformChildren;
 
+        mutable uint32_t m_worldTransformVersion = 0;       /** < Incremented each time the world transform is recomputed. */
+        mutable uint32_t m_parentWorldTransformVersion = 0; /** < Version of the parent world transform the cache is computed from. */
+        std::atomic<bool> m_transformDirty = false;         /** < Set while the component is queued in the scene manager dirty transforms. */
+        mutable std::atomic<bool> m_spatialProxyDirty = false; /** < Set while the component is queued to update its bounds in the world spatial index. */
+        int32_t m_spatialProxyId = -1;                      /** < Leaf of the active component in the world spatial index, see SceneManagerImpl. */
+
         friend class SceneObject;
+        friend class SceneManagerImpl;
     };
 
 }  // namespace nau::scene
@@ -25,7 +25,8 @@ namespace nau::scene
             CLASS_NAMED_FIELD(m_geometryAsset, "geometry"),
             CLASS_NAMED_FIELD(m_materialAsset, "material"),
             CLASS_NAMED_FIELD(m_isVisible, "is visible"),
-            CLASS_NAMED_FIELD(m_castShadow, "cast shadow"))
+            CLASS_NAMED_FIELD(m_castShadow, "cast shadow"),
+            CLASS_NAMED_FIELD(m_isOccluder, "is occluder"))
 
     public:
         enum class DirtyFlags : uint32_t
@@ -34,6 +35,7 @@ namespace nau::scene
             Visibility  = 1 << 1,
             Material    = 1 << 2,
             CastShadow  = 1 << 3,
+            Occluder    = 1 << 4,
         };
 
         StaticMeshAssetRef getMeshGeometry() const;
@@ -59,15 +61,19 @@ namespace nau::scene
         bool getCastShadow();
         void setCastShadow(bool castShadow);
 
+        // Occluders are rasterized by the software occlusion culling: use it for the big closed meshes (walls, floors).
+        bool isOccluder() const;
+        void setOccluder(bool isOccluder);
+
     protected:
         void notifyTransformChanged() override;
-        void notifyTransformChanged(const math::Transform& worldTransformCache) override;
 
     private:
         mutable StaticMeshAssetRef m_geometryAsset;
         mutable MaterialAssetRef m_materialAsset;
         bool m_castShadow = true;
         bool m_isVisible = true;
+        bool m_isOccluder = false;
         uint32_t m_dirtyFlags = 0;
     };
 }  // namespace nau::scene
@@ -4,9 +4,12 @@
 
 #pragma once
 
+#include <EASTL/vector.h>
+
 #include "nau/async/task_base.h"
 #include "nau/rtti/type_info.h"
 #include "nau/scene/components/component.h"
+#include "nau/scene/components/component_changes.h"
 
 namespace nau::scene
 {
@@ -36,6 +39,37 @@ namespace nau::scene
         friend class SceneManagerImpl;
     };
 
+    /**
+     * @brief Receives the uids of the active components changed in the subscribed channels.
+     *
+     * The changes are accumulated until taken, each component is listed once however many times it has changed.
+     * So a synchronization consuming the changes costs O(changed) instead of walking all its objects.
+     */
+    struct [[nodiscard]] NAU_CORESCENE_EXPORT ComponentChangesSubscription
+    {
+        ComponentChangesSubscription() = default;
+        ComponentChangesSubscription(ComponentChangesSubscription&&);
+        ComponentChangesSubscription(const ComponentChangesSubscription&) = delete;
+        ~ComponentChangesSubscription();
+        ComponentChangesSubscription& operator=(const ComponentChangesSubscription&) = delete;
+        ComponentChangesSubscription& operator=(ComponentChangesSubscription&&);
+
+        explicit operator bool() const;
+        void reset();
+
+        /**
+         * @brief Moves the changes accumulated since the previous call into @ref changedComponents (appended).
+         */
+        void takeChanges(eastl::vector<Uid>& changedComponents);
+
+    private:
+        ComponentChangesSubscription(void* handle);
+
+        void* m_handle = nullptr;
+
+        friend class SceneManagerImpl;
+    };
+
     /**
      */
     struct NAU_ABSTRACT_TYPE ISceneManagerInternal
@@ -49,6 +83,13 @@ namespace nau::scene
         virtual async::Task<> shutdown() = 0;
 
         virtual SceneListenerRegistration addSceneListener(ISceneListener&) = 0;
+
+        /**
+         * @brief Starts collecting the changes of the active components.
+         *
+         * @param [in] channels Kinds of the changes to collect.
+         */
+        virtual ComponentChangesSubscription subscribeComponentChanges(ComponentChangeFlag channels) = 0;
     };
 
 }  // namespace nau::scene
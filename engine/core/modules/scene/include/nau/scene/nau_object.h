@@ -209,7 +209,7 @@ namespace nau::scene
          * @tparam T    Type of the object to construct. It has to be derived from NauObject.
          * @tparam A    Parameter pack for the object constructor.
          * 
-         * @param [in] allocator    Allocator to use for costructing the object. If `NULL` is passed, the default allocator is going to be used.
+         * @param [in] allocator    Allocator to use for costructing the object. If `NULL` is passed, the allocator returned by getCurrentObjectsAllocator() is going to be used.
          * @param [in] a            Object constructor arguments.
          * @return                  A pointer to the constructed object.
          */
@@ -220,7 +220,7 @@ namespace nau::scene
             static_assert(std::is_constructible_v<T, A...>, "Invalid construction arguments");
             constexpr size_t Alignment = alignof(T);
 
-            IMemAllocator* const actualAllocator = allocator ? allocator : getDefaultAllocator().get();
+            IMemAllocator* const actualAllocator = allocator ? allocator : getCurrentObjectsAllocator();
             NAU_FATAL(actualAllocator);
 
             void* mem = actualAllocator->allocateAligned(sizeof(T), Alignment);
@@ -255,6 +255,15 @@ namespace nau::scene
             return instance;
         }
 
+        /**
+         * @brief Retrieves the allocator for the objects that are constructed without an explicit allocator.
+         *
+         * While a scene (or a prefab instance) is being created from an asset, that is the scene objects arena:
+         * objects and components of the scene are grouped in memory and released in bulk along with the scene.
+         * Otherwise that is the default allocator.
+         */
+        static IMemAllocator* getCurrentObjectsAllocator();
+
 #ifdef NAU_ASSERT_ENABLED
         static void operator delete(void*, size_t);
 #endif
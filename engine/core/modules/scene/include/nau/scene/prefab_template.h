@@ -0,0 +1,46 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <EASTL/span.h>
+
+#include "nau/math/transform.h"
+#include "nau/memory/eastl_aliases.h"
+#include "nau/rtti/ptr.h"
+#include "nau/rtti/rtti_object.h"
+#include "nau/scene/scene_object.h"
+
+namespace nau::scene
+{
+    /**
+     * @brief Prebuilt prefab for the fast runtime spawning (see ISceneFactory::createPrefabTemplate).
+     *
+     * The template keeps a fully built (never activated) object hierarchy of the prefab.
+     * An instance is a memberwise copy of that hierarchy: the prefab asset is not visited again,
+     * all objects and components get new uids, and the references between the prefab's own objects
+     * are redirected to the corresponding objects of the instance.
+     */
+    struct NAU_ABSTRACT_TYPE IPrefabTemplate : virtual IRefCounted
+    {
+        NAU_INTERFACE(nau::scene::IPrefabTemplate, IRefCounted)
+
+        using Ptr = nau::Ptr<IPrefabTemplate>;
+
+        /**
+         * @brief Creates a new instance of the prefab.
+         *
+         * @return  Instance that is not attached to any scene.
+         */
+        virtual SceneObject::Ptr instantiate() = 0;
+
+        /**
+         * @brief Creates an instance of the prefab for each of the transforms.
+         *
+         * @param [in] transforms   Transforms of the root objects of the instances.
+         * @return                  Instances (in the order of the transforms) that are not attached to any scene.
+         */
+        virtual Vector<SceneObject::Ptr> instantiate(eastl::span<const math::Transform> transforms) = 0;
+    };
+}  // namespace nau::scene
@@ -10,6 +10,7 @@
 
 #include "nau/assets/scene_asset.h"
 #include "nau/rtti/ptr.h"
+#include "nau/scene/prefab_template.h"
 #include "nau/scene/scene.h"
 #include "nau/scene/scene_object.h"
 #include "nau/utils/typed_flag.h"
@@ -37,6 +38,14 @@ namespace nau::scene
 
         virtual SceneObject::Ptr createSceneObjectFromAsset(const SceneAsset& sceneAsset) = 0;
 
+        /**
+         * @brief Builds the prefab once, so it can be instantiated many times without visiting the asset again.
+         *
+         * @param [in] prefabAsset  Asset of the prefab (SceneAssetKind::Prefab).
+         * @return                  Template to spawn the instances of the prefab.
+         */
+        virtual IPrefabTemplate::Ptr createPrefabTemplate(const SceneAsset& prefabAsset) = 0;
+
         virtual SceneObject::Ptr createSceneObject(const rtti::TypeInfo* rootComponentType = nullptr, const eastl::span<const rtti::TypeInfo*> components = {}) = 0;
 
         template <std::derived_from<SceneComponent> ComponentType, std::derived_from<Component>... MoreComponents>
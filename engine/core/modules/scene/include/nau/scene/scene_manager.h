@@ -4,12 +4,17 @@
 
 #pragma once
 
+#include <EASTL/span.h>
+
+#include <chrono>
+
 #include "nau/async/task.h"
 #include "nau/memory/eastl_aliases.h"
 #include "nau/rtti/rtti_object.h"
 #include "nau/scene/scene.h"
 #include "nau/scene/scene_object.h"
 #include "nau/scene/scene_query.h"
+#include "nau/scene/scene_streaming.h"
 #include "nau/scene/world.h"
 
 namespace nau::scene
@@ -84,9 +89,50 @@ namespace nau::scene
          */
         virtual void deactivateScene(IScene::WeakRef sceneRef) = 0;
 
+        /**
+         * @brief Activates the scene within the default world spreading the work across multiple frames.
+         *
+         * @param [in] scene    Scene to activate.
+         * @param [in] options  Streaming settings.
+         * @return              Request object providing the progress and control over the streaming.
+         *
+         * The scene is registered (and its root is activated) immediately, the root children are streamed.
+         * See ISceneStreamingRequest for details. World specific analog: IWorld::streamScene.
+         */
+        virtual ISceneStreamingRequest::Ptr streamScene(IScene::Ptr&& scene, SceneStreamingOptions options = {}) = 0;
+
+        /**
+         * @brief Attaches the object hierarchy (cell) to the active parent spreading its activation across multiple frames.
+         *
+         * @param [in] parent   Object to attach the cell to. It is expected to belong to an active scene.
+         * @param [in] cell     Root of the hierarchy to attach.
+         * @param [in] options  Streaming settings.
+         * @return              Request object providing the progress and control over the streaming.
+         *
+         * Cells of a world are streamed independently, so they can be attached and removed (with SceneObject::removeChild) while the others are streamed.
+         */
+        virtual ISceneStreamingRequest::Ptr streamSceneObject(SceneObject& parent, SceneObject::Ptr&& cell, SceneStreamingOptions options = {}) = 0;
+
+        /**
+         * @brief Sets the time that can be spent per frame on attaching and activating streamed objects.
+         *
+         * At least one object is processed every frame while there are streaming requests, so a zero budget is valid.
+         */
+        virtual void setStreamingFrameBudget(std::chrono::microseconds budget) = 0;
+
         /**
          */
         virtual ObjectWeakRef<> querySingleObject(const SceneQuery& query) = 0;
+
+        /**
+         * @brief Retrieves all active components of the queried type within the queried world.
+         *
+         * @param [in] query    Query with the component type set. Only the components whose class is exactly that type are returned.
+         *                      SceneQuery::worldUid selects the world, the default world is used when it is not set.
+         * @return              Dense array of the components. It refers the manager storage, so nothing is allocated,
+         *                      but it is valid only until the next component activation or deactivation.
+         */
+        virtual eastl::span<Component* const> queryComponents(const SceneQuery& query) = 0;
     };
 
     /**
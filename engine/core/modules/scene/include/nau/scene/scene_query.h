@@ -26,6 +26,11 @@ namespace nau::scene
         Uid uid = NullUid;
         size_t typeHashCode = 0;
 
+        /**
+         * @brief Restricts the query to the objects of the world, NullUid means any world (the default world for ISceneManager::queryComponents).
+         */
+        Uid worldUid = NullUid;
+
         SceneQuery() = default;
         SceneQuery(QueryObjectCategory inCategory, Uid inUid = NullUid);
         SceneQuery(const SceneQuery&) = default;
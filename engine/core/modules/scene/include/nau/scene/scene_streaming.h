@@ -0,0 +1,71 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include "nau/async/task.h"
+#include "nau/rtti/rtti_object.h"
+#include "nau/rtti/ptr.h"
+
+namespace nau::scene
+{
+    /**
+     * @brief Settings of a streaming activation.
+     */
+    struct SceneStreamingOptions
+    {
+        /**
+         * @brief Requests with higher priority are served first within the frame budget.
+         */
+        int priority = 0;
+    };
+
+    /**
+     * @brief Provides control over a streaming activation of a scene or of a scene sub-hierarchy (cell).
+     *
+     * The streamed hierarchy is attached to its parent object by object, each object is activated with its components
+     * as an independent batch. The scene manager spends no more than its streaming frame budget per frame on the requests
+     * (see ISceneManager::setStreamingFrameBudget), so big scenes do not stall the main thread.
+     * A child object is attached only when its parent is already active (it is not queued for the streaming).
+     *
+     * Until the request is completed, the streamed objects that are not yet attached are owned by the request.
+     */
+    struct NAU_ABSTRACT_TYPE ISceneStreamingRequest : virtual IRefCounted
+    {
+        NAU_INTERFACE(nau::scene::ISceneStreamingRequest, IRefCounted)
+
+        using Ptr = nau::Ptr<ISceneStreamingRequest>;
+
+        /**
+         * @brief Retrieves the fraction of the streamed objects which activation has been completed.
+         *
+         * @return Value in the [0, 1] range.
+         */
+        virtual float getProgress() const = 0;
+
+        /**
+         * @brief Checks whether all the streamed objects have been activated (or the request has been canceled).
+         */
+        virtual bool isCompleted() const = 0;
+
+        virtual int getPriority() const = 0;
+
+        /**
+         * @brief Changes the request priority, i.e. when a cell gets closer to the player.
+         */
+        virtual void setPriority(int priority) = 0;
+
+        /**
+         * @brief Stops the streaming: the objects that are not attached yet are destroyed, the attached ones stay in the scene.
+         */
+        virtual void cancel() = 0;
+
+        /**
+         * @brief Provides a task that is ready when the request is completed.
+         *
+         * The function can be called multiple times, every call returns its own task.
+         */
+        virtual async::Task<> waitForCompletion() = 0;
+    };
+}  // namespace nau::scene
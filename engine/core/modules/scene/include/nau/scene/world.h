@@ -5,12 +5,17 @@
 #pragma once
 #include <EASTL/string_view.h>
 
+#include "nau/math/dag_bounds3.h"
+#include "nau/math/dag_frustum.h"
 #include "nau/memory/eastl_aliases.h"
 #include "nau/scene/nau_object.h"
 #include "nau/scene/scene.h"
+#include "nau/scene/scene_streaming.h"
 
 namespace nau::scene
 {
+    class SceneComponent;
+
     /**
      *   An interface for logically combining a group of scenes.
      */
@@ -51,6 +56,17 @@ namespace nau::scene
          */
         virtual async::Task<IScene::WeakRef> addScene(IScene::Ptr&& scene) = 0;
 
+        /**
+         * @brief Attaches the scene to the world spreading its activation across multiple frames.
+         *
+         * @param [in] scene    Scene to add.
+         * @param [in] options  Streaming settings.
+         * @return              Request object providing the progress and control over the streaming.
+         *
+         * See ISceneManager::streamScene.
+         */
+        virtual ISceneStreamingRequest::Ptr streamScene(IScene::Ptr&& scene, SceneStreamingOptions options = {}) = 0;
+
         /**
          * @brief Detaches the scene from the world and destroys all the contained objects.
          *
@@ -67,5 +83,42 @@ namespace nau::scene
         virtual void setSimulationPause(bool pause) = 0;
 
         virtual bool isSimulationPaused() const = 0;
+
+        /**
+         * @brief Collects the active scene components whose bounds intersect the box.
+         *
+         * The spatial queries are served by the incrementally updated index of the world:
+         * components are indexed by their world bounds (see IComponentBounds) or as points at their world positions.
+         * The collected pointers are valid until the hierarchy of the world is changed.
+         *
+         * @param [in] box          Box to test.
+         * @param [out] components  Container the found components are appended to.
+         */
+        virtual void queryBox(const math::BBox3& box, Vector<SceneComponent*>& components) = 0;
+
+        /**
+         * @brief Collects the active scene components whose bounds intersect the sphere.
+         *
+         * See queryBox.
+         */
+        virtual void querySphere(const math::BSphere3& sphere, Vector<SceneComponent*>& components) = 0;
+
+        /**
+         * @brief Collects the active scene components whose bounds may be visible within the frustum.
+         *
+         * The index subtrees that are entirely inside the frustum are taken without testing their components,
+         * so the result can be used for the hierarchical culling. See queryBox.
+         */
+        virtual void queryFrustum(const math::NauFrustum& frustum, Vector<SceneComponent*>& components) = 0;
+
+        /**
+         * @brief Collects the active scene components whose bounds are hit by the ray segment, ordered by the hit distance.
+         *
+         * @param [in] origin       Origin of the ray.
+         * @param [in] direction    Direction of the ray (expected to be normalized).
+         * @param [in] maxDistance  Length of the ray segment.
+         * @param [out] components  Container the found components are appended to.
+         */
+        virtual void queryRay(const math::Vector3& origin, const math::Vector3& direction, float maxDistance, Vector<SceneComponent*>& components) = 0;
     };
 }  // namespace nau::scene
@@ -294,6 +294,13 @@ namespace nau::scene
         checkCameras();
     }
 
+    eastl::optional<GameUpdateAccess> CameraManagerImpl::getPreUpdateAccess() const
+    {
+        return GameUpdateAccess{
+            .reads = {GameUpdateResource::Transforms},
+            .writes = {GameUpdateResource::Cameras}};
+    }
+
     void CameraManagerImpl::checkCameras()
     {
         using namespace std::chrono;
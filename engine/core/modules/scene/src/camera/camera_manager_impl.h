@@ -33,6 +33,8 @@ namespace nau::scene
         void deactivateComponents(Uid worldUid, eastl::span<Component*> components) override;
         void gamePreUpdate(std::chrono::milliseconds dt) override;
 
+        eastl::optional<GameUpdateAccess> getPreUpdateAccess() const override;
+
         void checkCameras();
 
         mutable std::mutex m_mutex;
@@ -97,6 +97,16 @@ namespace nau::scene
         {
             NAU_FATAL(m_sceneManager);
             m_sceneManager->notifyListenerComponentWasChanged(*this);
+            m_sceneManager->publishComponentChanges(*this, ComponentChange::Properties);
+        }
+    }
+
+    void Component::publishChanges(ComponentChangeFlag changes)
+    {
+        if (m_activationState == ActivationState::Active)
+        {
+            NAU_FATAL(m_sceneManager);
+            m_sceneManager->publishComponentChanges(*this, changes);
         }
     }
 
@@ -0,0 +1,25 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#include "nau/scene/components/ecs_component_data.h"
+
+#include <daECS/core/ecsGameRes.h>
+
+ECS_REGISTER_RELOCATABLE_TYPE(nau::scene::EcsComponentRef, nullptr);
+
+namespace nau::scene
+{
+    ecs::EntityManager& getEcsEntityManager()
+    {
+        if (!g_entity_mgr)
+        {
+            g_entity_mgr.demandInit();
+            if (!ecs::getECSResourceManager())
+            {
+                ecs::setECSResourceManager(ecs::createDefaultECSResourceManager());
+            }
+        }
+
+        return *g_entity_mgr;
+    }
+}  // namespace nau::scene
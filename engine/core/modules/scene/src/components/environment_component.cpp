@@ -19,6 +19,23 @@ namespace nau::scene
         m_isTextureDirty = true;
     }
 
+    TextureAssetRef EnvironmentComponent::getIrradianceAsset() const
+    {
+        return m_irradianceAsset;
+    }
+
+    TextureAssetRef EnvironmentComponent::getReflectionAsset() const
+    {
+        return m_reflectionAsset;
+    }
+
+    void EnvironmentComponent::setPrefilteredAssets(const TextureAssetRef& irradiance, const TextureAssetRef& reflection)
+    {
+        m_irradianceAsset = irradiance;
+        m_reflectionAsset = reflection;
+        m_isTextureDirty = true;
+    }
+
     bool EnvironmentComponent::isTextureDirty() const
     {
         return m_isTextureDirty;
@@ -3,23 +3,32 @@
 
 #include "nau/scene/components/scene_component.h"
 
+#include "nau/math/transform_batch.h"
+#include "nau/memory/stack_allocator.h"
+#include "scene_management/scene_manager_impl.h"
+
 namespace nau::scene
 {
     NAU_IMPLEMENT_DYNAMIC_OBJECT(SceneComponent)
 
     const math::Transform& SceneComponent::getWorldTransform() const
     {
-        if (!m_worldTransformCache)
+        if (m_transformParent)
         {
-            if (m_transformParent)
-            {
-                m_worldTransformCache = static_cast<SceneComponent&>(*m_transformParent).getWorldTransform() * m_transform;
-            }
-            else
+            // Validates the whole chain of ancestors: a changed ancestor has a newer world transform version.
+            const math::Transform& parentWorldTransform = m_transformParent->getWorldTransform();
+            if (!m_worldTransformCache || m_parentWorldTransformVersion != m_transformParent->m_worldTransformVersion)
             {
-                m_worldTransformCache = m_transform;
+                m_worldTransformCache = parentWorldTransform * m_transform;
+                m_parentWorldTransformVersion = m_transformParent->m_worldTransformVersion;
+                ++m_worldTransformVersion;
             }
         }
+        else if (!m_worldTransformCache)
+        {
+            m_worldTransformCache = m_transform;
+            ++m_worldTransformVersion;
+        }
 
         return *m_worldTransformCache;
     }
@@ -36,7 +45,9 @@ namespace nau::scene
             m_transform = worldTransform;
         }
 
-        notifyTransformChanged(worldTransform);
+        markTransformDirty();
+        m_worldTransformCache.emplace(worldTransform);
+        m_parentWorldTransformVersion = m_transformParent ? m_transformParent->m_worldTransformVersion : 0;
     }
 
     const math::Transform& SceneComponent::getTransform() const
@@ -47,25 +58,25 @@ namespace nau::scene
     void SceneComponent::setTransform(const math::Transform& transform)
     {
         m_transform = transform;
-        notifyTransformChanged();
+        markTransformDirty();
     }
 
     void SceneComponent::setRotation(math::quat rotation)
     {
         m_transform.setRotation(rotation);
-        notifyTransformChanged();
+        markTransformDirty();
     }
 
     void SceneComponent::setTranslation(math::vec3 position)
     {
         m_transform.setTranslation(position);
-        notifyTransformChanged();
+        markTransformDirty();
     }
 
     void SceneComponent::setScale(math::vec3 scale)
     {
         m_transform.setScale(scale);
-        notifyTransformChanged();
+        markTransformDirty();
     }
 
     math::quat SceneComponent::getRotation() const
@@ -90,6 +101,7 @@ namespace nau::scene
 
         m_transformChildren.push_back(child);
         child.m_transformParent = this;
+        child.m_worldTransformCache.reset();
     }
 
     void SceneComponent::removeTransformChild(SceneComponent& child)
@@ -100,28 +112,85 @@ namespace nau::scene
 
         m_transformChildren.remove(child);
         child.m_transformParent = nullptr;
+        child.m_worldTransformCache.reset();
     }
 
-    void SceneComponent::notifyTransformChanged()
+    void SceneComponent::markTransformDirty()
     {
         m_worldTransformCache.reset();
-        notifyChanged();
+        ++m_worldTransformVersion;
+        notifyTransformChanged();
+
+        if (m_transformChildren.empty())
+        {
+            return;
+        }
 
-        for (auto& transformChild : m_transformChildren)
+        // The descendants of an active component are notified by the batched pass of the scene manager, once per frame.
+        // There is no such pass for an inactive hierarchy, it is notified at once.
+        if (m_activationState != ActivationState::Active)
+        {
+            flushTransformChanges();
+        }
+        else if (!m_transformDirty.exchange(true))
         {
-            static_cast<SceneComponent&>(transformChild).notifyTransformChanged();
+            NAU_FATAL(m_sceneManager);
+            m_sceneManager->addDirtyTransform(*this);
         }
     }
 
-    void SceneComponent::notifyTransformChanged(const math::Transform& worldTransformCache)
+    void SceneComponent::flushTransformChanges()
     {
-        m_worldTransformCache.emplace(worldTransformCache);
-        notifyChanged();
+        // The world transforms are computed parent by parent: the children of a parent are multiplied by its world transform in batches.
+        constexpr size_t BatchSize = 16;
 
-        for (auto& transformChild : m_transformChildren)
+        m_transformDirty = false;
+
+        StackVector<SceneComponent*> parents;
+        parents.push_back(this);
+
+        while (!parents.empty())
         {
-            static_cast<SceneComponent&>(transformChild).notifyTransformChanged();
+            SceneComponent* const parent = parents.back();
+            parents.pop_back();
+
+            const math::Transform& parentWorldTransform = parent->getWorldTransform();
+
+            auto transformChild = parent->m_transformChildren.begin();
+            while (transformChild != parent->m_transformChildren.end())
+            {
+                SceneComponent* children[BatchSize];
+                math::Transform transforms[BatchSize];
+
+                size_t count = 0;
+                for (; count < BatchSize && transformChild != parent->m_transformChildren.end(); ++count, ++transformChild)
+                {
+                    children[count] = &static_cast<SceneComponent&>(*transformChild);
+                    transforms[count] = children[count]->m_transform;
+                }
+
+                math::multiplyTransforms(parentWorldTransform, eastl::span{transforms, count}, eastl::span{transforms, count});
+
+                for (size_t i = 0; i < count; ++i)
+                {
+                    SceneComponent* const component = children[i];
+                    component->m_worldTransformCache = transforms[i];
+                    component->m_parentWorldTransformVersion = parent->m_worldTransformVersion;
+                    ++component->m_worldTransformVersion;
+
+                    component->m_transformDirty = false;
+                    component->notifyTransformChanged();
+
+                    parents.push_back(component);
+                }
+            }
         }
     }
 
+    void SceneComponent::notifyTransformChanged()
+    {
+        publishChanges(ComponentChange::Transform);
+        notifyChanged();
+    }
+
 }  // namespace nau::scene
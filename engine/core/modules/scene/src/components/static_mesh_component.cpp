@@ -27,6 +27,7 @@ namespace nau::scene
     {
         m_materialAsset = assetRef;
         m_dirtyFlags |= static_cast<uint32_t>(DirtyFlags::Material);
+        publishChanges(ComponentChange::Material);
     }
 
     uint32_t StaticMeshComponent::getDirtyFlags() const
@@ -48,6 +49,7 @@ namespace nau::scene
     {
         m_isVisible = isVisible;
         m_dirtyFlags |= static_cast<uint32_t>(DirtyFlags::Visibility);
+        publishChanges(ComponentChange::Visibility);
     }
 
     bool StaticMeshComponent::getCastShadow()
@@ -59,17 +61,24 @@ namespace nau::scene
     {
         m_castShadow = castShadow;
         m_dirtyFlags |= static_cast<uint32_t>(DirtyFlags::CastShadow);
+        publishChanges(ComponentChange::Properties);
     }
 
-    void StaticMeshComponent::notifyTransformChanged()
+    bool StaticMeshComponent::isOccluder() const
     {
-        SceneComponent::notifyTransformChanged();
-        m_dirtyFlags |= static_cast<uint32_t>(DirtyFlags::WorldPos);
+        return m_isOccluder;
+    }
+
+    void StaticMeshComponent::setOccluder(bool isOccluder)
+    {
+        m_isOccluder = isOccluder;
+        m_dirtyFlags |= static_cast<uint32_t>(DirtyFlags::Occluder);
+        publishChanges(ComponentChange::Properties);
     }
 
-    void StaticMeshComponent::notifyTransformChanged(const math::Transform& worldTransformCache)
+    void StaticMeshComponent::notifyTransformChanged()
     {
-        SceneComponent::notifyTransformChanged(worldTransformCache);
+        SceneComponent::notifyTransformChanged();
         m_dirtyFlags |= static_cast<uint32_t>(DirtyFlags::WorldPos);
     }
 
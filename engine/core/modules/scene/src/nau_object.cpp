@@ -5,6 +5,7 @@
 #include "nau/scene/nau_object.h"
 
 #include "nau/scene/scene_manager.h"
+#include "scene_management/scene_objects_arena.h"
 
 namespace nau::scene
 {
@@ -15,6 +16,16 @@ namespace nau::scene
     }
 #endif
 
+    IMemAllocator* NauObject::getCurrentObjectsAllocator()
+    {
+        if (SceneObjectsArena* const arena = SceneObjectsArena::getCurrent())
+        {
+            return arena;
+        }
+
+        return getDefaultAllocator().get();
+    }
+
     NauObject::~NauObject()
     {
         NAU_ASSERT(m_references.empty());
@@ -0,0 +1,176 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "./prefab_template_impl.h"
+
+#include "nau/scene/components/component_life_cycle.h"
+#include "nau/scene/components/internal/missing_component.h"
+#include "nau/scene/scene_manager.h"
+#include "nau/service/service_provider.h"
+#include "nau/string/string_conv.h"
+
+namespace nau::scene
+{
+    struct PrefabTemplateImpl::CloneContext
+    {
+        // Keys are the uids of the prototype objects.
+        eastl::unordered_map<Uid, SceneObject*> objects;
+        eastl::unordered_map<Uid, Component*> components;
+        Vector<IComponentEvents*> componentEvents;
+    };
+
+    PrefabTemplateImpl::PrefabTemplateImpl(ObjectUniquePtr<SceneObject> prototype, eastl::optional<Vector<ReferenceField>> referencesInfo) :
+        m_prototype(std::move(prototype)),
+        m_referencesInfo(referencesInfo ? std::move(*referencesInfo) : Vector<ReferenceField>{}),
+        m_sceneFactory(getServiceProvider().get<ISceneFactory>())
+    {
+        NAU_FATAL(m_prototype);
+    }
+
+    SceneObject::Ptr PrefabTemplateImpl::instantiate()
+    {
+        CloneContext context;
+        ObjectUniquePtr instance = cloneObject(*m_prototype, context);
+
+        resolveReferenceFields(context);
+        for (IComponentEvents* const componentEvents : context.componentEvents)
+        {
+            componentEvents->onAfterComponentRestored();
+        }
+
+        return instance;
+    }
+
+    Vector<SceneObject::Ptr> PrefabTemplateImpl::instantiate(eastl::span<const math::Transform> transforms)
+    {
+        Vector<SceneObject::Ptr> instances;
+        instances.reserve(transforms.size());
+
+        for (const math::Transform& transform : transforms)
+        {
+            SceneObject::Ptr& instance = instances.emplace_back(instantiate());
+            instance->setTransform(transform);
+        }
+
+        return instances;
+    }
+
+    ObjectUniquePtr<SceneObject> PrefabTemplateImpl::cloneObject(SceneObject& source, CloneContext& context)
+    {
+        Component& sourceRoot = source.getRootComponent();
+        const rtti::TypeInfo& rootComponentType = sourceRoot.getClassDescriptor()->getClassTypeInfo();
+
+        ObjectUniquePtr object = m_sceneFactory.createSceneObject(&rootComponentType);
+        NAU_FATAL(object);
+
+        object->setName(source.getName());
+        object->setUid(Uid::generate());
+        context.objects.emplace(source.getUid(), object.get());
+        copyComponent(sourceRoot, object->getRootComponent(), context);
+
+        for (Component* const sourceComponent : source.getDirectComponents())
+        {
+            if (sourceComponent == &sourceRoot)
+            {
+                continue;
+            }
+
+            Component& component = object->addComponent(sourceComponent->getClassDescriptor()->getClassTypeInfo());
+            copyComponent(*sourceComponent, component, context);
+        }
+
+        for (SceneObject* const sourceChild : source.getDirectChildObjects())
+        {
+            object->attachChild(cloneObject(*sourceChild, context));
+        }
+
+        return object;
+    }
+
+    void PrefabTemplateImpl::copyComponent(Component& source, Component& target, CloneContext& context)
+    {
+        if (IMissingComponent* const missingComponent = source.as<IMissingComponent*>()) [[unlikely]]
+        {
+            ComponentAsset componentData;
+            missingComponent->fillComponentData(componentData);
+            if (IMissingComponent* const targetMissingComponent = target.as<IMissingComponent*>())
+            {
+                targetMissingComponent->setComponentData(componentData);
+            }
+        }
+
+        RuntimeValue::Ptr propsTarget = rtti::staticCast<RuntimeValue*>(&target);
+        RuntimeValue::Ptr propsSource = rtti::staticCast<RuntimeValue*>(&source);
+        if (auto result = RuntimeValue::assign(propsTarget, propsSource); !result)
+        {
+            NAU_LOG_ERROR("Fail to copy component:({})", result.getError()->getMessage());
+        }
+
+        if (SceneComponent* const sceneComponent = target.as<SceneComponent*>())
+        {
+            sceneComponent->setTransform(source.as<SceneComponent&>().getTransform());
+        }
+
+        // uid is also copied with the properties.
+        target.setUid(Uid::generate());
+        context.components.emplace(source.getUid(), &target);
+
+        if (IComponentEvents* const componentEvents = target.as<IComponentEvents*>())
+        {
+            context.componentEvents.push_back(componentEvents);
+        }
+    }
+
+    void PrefabTemplateImpl::resolveReferenceFields(CloneContext& context)
+    {
+        // Copied reference fields are still pointing to the prototype objects: such references are redirected to the instance objects.
+        // The references to the objects outside of the prefab are kept as is.
+        const auto findInstanceObject = [&context](const SceneQuery& query) -> ObjectWeakRef<>
+        {
+            if (query.uid == NullUid)
+            {
+                return nullptr;
+            }
+
+            if (!query.category || *query.category == QueryObjectCategory::Object)
+            {
+                if (auto object = context.objects.find(query.uid); object != context.objects.end())
+                {
+                    return ObjectWeakRef<>{*object->second};
+                }
+            }
+
+            if (!query.category || *query.category == QueryObjectCategory::Component)
+            {
+                if (auto component = context.components.find(query.uid); component != context.components.end())
+                {
+                    return ObjectWeakRef<>{*component->second};
+                }
+            }
+
+            return nullptr;
+        };
+
+        for (const ReferenceField& field : m_referencesInfo)
+        {
+            auto componentEntry = context.components.find(field.componentUid);
+            if (componentEntry == context.components.end())
+            {
+                continue;
+            }
+
+            RuntimeValue::Ptr fieldValue = componentEntry->second->getValue(strings::toStringView(field.fieldPath));
+            RuntimeObjectWeakRefValue* const weakRefField = fieldValue ? fieldValue->as<RuntimeObjectWeakRefValue*>() : nullptr;
+            if (!weakRefField)
+            {
+                continue;
+            }
+
+            if (ObjectWeakRef<> weakRef = findInstanceObject(weakRefField->getObjectQuery()))
+            {
+                weakRefField->setObjectWeakRef(weakRef);
+            }
+        }
+    }
+}  // namespace nau::scene
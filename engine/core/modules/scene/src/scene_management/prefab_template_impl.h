@@ -0,0 +1,40 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include "nau/assets/scene_asset.h"
+#include "nau/rtti/rtti_impl.h"
+#include "nau/scene/prefab_template.h"
+#include "nau/scene/scene_factory.h"
+
+namespace nau::scene
+{
+    /**
+     */
+    class PrefabTemplateImpl final : public IPrefabTemplate
+    {
+        NAU_CLASS_(nau::scene::PrefabTemplateImpl, IPrefabTemplate)
+
+    public:
+        PrefabTemplateImpl(ObjectUniquePtr<SceneObject> prototype, eastl::optional<Vector<ReferenceField>> referencesInfo);
+
+        SceneObject::Ptr instantiate() override;
+
+        Vector<SceneObject::Ptr> instantiate(eastl::span<const math::Transform> transforms) override;
+
+    private:
+        struct CloneContext;
+
+        ObjectUniquePtr<SceneObject> cloneObject(SceneObject& source, CloneContext& context);
+
+        void copyComponent(Component& source, Component& target, CloneContext& context);
+
+        void resolveReferenceFields(CloneContext& context);
+
+        ObjectUniquePtr<SceneObject> m_prototype;
+        const Vector<ReferenceField> m_referencesInfo;
+        ISceneFactory& m_sceneFactory;
+    };
+}  // namespace nau::scene
@@ -8,7 +8,9 @@
 #include "nau/scene/components/internal/missing_component.h"
 #include "nau/service/service_provider.h"
 #include "scene_impl.h"
+#include "scene_management/prefab_template_impl.h"
 #include "scene_management/scene_builder.h"
+#include "scene_management/scene_objects_arena.h"
 
 namespace nau::scene
 {
@@ -22,6 +24,15 @@ namespace nau::scene
         NAU_ASSERT(sceneAsset.getSceneInfo().assetKind == SceneAssetKind::Scene);
 
         StackAllocatorUnnamed;
+
+        // The scene, its objects and components are allocated from the scene's arena.
+        SceneObjectsArena* const arena = SceneObjectsArena::create();
+        scope_on_leave
+        {
+            arena->release();
+        };
+        const SceneObjectsArena::Scope arenaScope{*arena};
+
         ObjectUniquePtr scene = NauObject::classCreateInstance<SceneImpl>();
 
         SceneAssetVisitor sceneVisitor{*scene, options};
@@ -42,6 +53,13 @@ namespace nau::scene
 
         StackAllocatorUnnamed;
 
+        SceneObjectsArena* const arena = SceneObjectsArena::create();
+        scope_on_leave
+        {
+            arena->release();
+        };
+        const SceneObjectsArena::Scope arenaScope{*arena};
+
         SceneAssetVisitor sceneVisitor{options};
         sceneAsset.visitScene(sceneVisitor);
         sceneVisitor.finalizeConstruction(sceneAsset);
@@ -49,6 +67,13 @@ namespace nau::scene
         return sceneVisitor.getPrefabInstance();
     }
 
+    IPrefabTemplate::Ptr SceneFactoryImpl::createPrefabTemplate(const SceneAsset& prefabAsset)
+    {
+        // The prototype keeps the asset uids: the reference fields info is bound to them.
+        ObjectUniquePtr prototype = createSceneObjectFromAssetWithOptions(prefabAsset, {});
+        return rtti::createInstance<PrefabTemplateImpl>(std::move(prototype), prefabAsset.getReferencesInfo());
+    }
+
     ObjectUniquePtr<SceneObject> SceneFactoryImpl::createSceneObject(const rtti::TypeInfo* rootComponentType, const eastl::span<const rtti::TypeInfo*>)
     {
         ObjectUniquePtr<SceneComponent> rootComponent;
@@ -27,6 +27,8 @@ namespace nau::scene
 
         scene::SceneObject::Ptr createSceneObjectFromAssetWithOptions(const SceneAsset& sceneAsset, scene::CreateSceneOptionFlag options) override;
 
+        IPrefabTemplate::Ptr createPrefabTemplate(const SceneAsset& prefabAsset) override;
+
         scene::ObjectUniquePtr<SceneObject> createSceneObject(const rtti::TypeInfo* rootComponentType, const eastl::span<const rtti::TypeInfo*>) override;
 
         scene::ObjectUniquePtr<Component> createComponent(const rtti::TypeInfo& type) override;
@@ -4,8 +4,16 @@
 
 #include "scene_manager_impl.h"
 
+#include <daECS/core/entityManager.h>
+
+#include <EASTL/sort.h>
+
+#include "nau/async/parallel_for.h"
 #include "nau/memory/stack_allocator.h"
+#include "nau/scene/components/component_attributes.h"
+#include "nau/scene/components/component_bounds.h"
 #include "nau/scene/scene_processor.h"
+#include "nau/scripts/script_manager.h"
 #include "scene_impl.h"
 #include <nau/assets/asset_ref.h>
 #include <nau/assets/scene_asset.h>
@@ -13,6 +21,39 @@
 
 namespace nau::scene
 {
+    namespace
+    {
+        /**
+         * World bounds of the component in the spatial index: the transformed local bounds, or the point at the component position.
+         */
+        math::BBox3 getSpatialBounds(const SceneComponent& component)
+        {
+            const math::Transform& worldTransform = component.getWorldTransform();
+            const IComponentBounds* const componentBounds = component.as<const IComponentBounds*>();
+            if (!componentBounds)
+            {
+                return math::BBox3{worldTransform.getTranslation(), worldTransform.getTranslation()};
+            }
+
+            const math::BBox3 localBounds = componentBounds->getLocalBounds();
+            if (localBounds.isempty())
+            {
+                return math::BBox3{worldTransform.getTranslation(), worldTransform.getTranslation()};
+            }
+
+            // The extents are projected on the world axes by the absolute values of the transform matrix.
+            const math::Matrix4 matrix = worldTransform.toMatrixWithScale();
+            const math::Vector3 center = (matrix * math::Point3{localBounds.center()}).getXYZ();
+            const math::Vector3 halfSize = localBounds.width() * 0.5f;
+            const math::Vector3 extent =
+                math::absPerElem(matrix.getCol0().getXYZ()) * halfSize.getX() +
+                math::absPerElem(matrix.getCol1().getXYZ()) * halfSize.getY() +
+                math::absPerElem(matrix.getCol2().getXYZ()) * halfSize.getZ();
+
+            return math::BBox3{center - extent, center + extent};
+        }
+    }  // namespace
+
     SceneListenerRegistration::SceneListenerRegistration(void* handle) :
         m_handle(handle)
     {
@@ -56,6 +97,69 @@ namespace nau::scene
         return reinterpret_cast<ISceneListener*>(m_handle);
     }
 
+    ComponentChangesSubscription::ComponentChangesSubscription(void* handle) :
+        m_handle(handle)
+    {
+    }
+
+    ComponentChangesSubscription::ComponentChangesSubscription(ComponentChangesSubscription&& other) :
+        m_handle(std::exchange(other.m_handle, nullptr))
+    {
+    }
+
+    ComponentChangesSubscription::~ComponentChangesSubscription()
+    {
+        reset();
+    }
+
+    ComponentChangesSubscription& ComponentChangesSubscription::operator=(ComponentChangesSubscription&& other)
+    {
+        reset();
+        m_handle = std::exchange(other.m_handle, nullptr);
+        return *this;
+    }
+
+    ComponentChangesSubscription::operator bool() const
+    {
+        return m_handle != nullptr;
+    }
+
+    void ComponentChangesSubscription::reset()
+    {
+        if (const auto handle = std::exchange(m_handle, nullptr); handle != nullptr && hasServiceProvider())
+        {
+            ServiceProvider& serviceProvider = getServiceProvider();
+            if (serviceProvider.has<SceneManagerImpl>())
+            {
+                serviceProvider.get<SceneManagerImpl>().unsubscribeComponentChanges(handle);
+            }
+        }
+    }
+
+    void ComponentChangesSubscription::takeChanges(eastl::vector<Uid>& changedComponents)
+    {
+        NAU_ASSERT(m_handle);
+        if (!m_handle)
+        {
+            return;
+        }
+
+        auto& queue = *reinterpret_cast<SceneManagerImpl::ComponentChangesQueue*>(m_handle);
+        const std::lock_guard lock(queue.mutex);
+
+        if (changedComponents.empty())
+        {
+            changedComponents.swap(queue.changedComponents);
+        }
+        else
+        {
+            changedComponents.insert(changedComponents.end(), queue.changedComponents.begin(), queue.changedComponents.end());
+            queue.changedComponents.clear();
+        }
+
+        queue.changedComponentsSet.clear();
+    }
+
     SceneManagerImpl::UpdatableComponentEntry::UpdatableComponentEntry(Component& inComponent) :
         component(&inComponent),
         componentUpdate(inComponent.as<IComponentUpdate*>()),
@@ -157,7 +261,7 @@ namespace nau::scene
             else
             {
                 NAU_ASSERT(object.m_activationState == ActivationState::Active);
-                NAU_ASSERT(m_activeObjects.contains(object.getUid()));
+                NAU_ASSERT(m_activeObjects.count(object.getUid()) > 0);
             }
 #endif
         };
@@ -286,11 +390,23 @@ namespace nau::scene
         {
             for (Component* const component : components)
             {
-                m_activeComponents.emplace(component->getUid(), component);
+                if (m_activeComponents.emplace(component->getUid(), component).second)
+                {
+                    registerComponent(*component);
+                }
+
                 const bool isUpdatable = component->is<IComponentUpdate>() || component->is<IComponentAsyncUpdate>();
                 if (isUpdatable)
                 {
-                    m_updatableComponents.emplace_back(*component);
+                    // The groups can not grow while they are being iterated.
+                    if (m_insideUpdate)
+                    {
+                        m_pendingUpdatableComponents.push_back(component);
+                    }
+                    else
+                    {
+                        addUpdatableComponent(*component);
+                    }
                 }
 
                 // IComponentEvents::onComponentActivated must be called inside transferActivationState
@@ -511,13 +627,19 @@ namespace nau::scene
             NAU_FATAL(component->isOperable());
 
             component->changeActivationState(ActivationState::Deactivating);
-            component->clearAllWeakReferences();
-            component->getParentObject().removeComponentFromList(*component);
+            if (SceneComponent* const sceneComponent = component->as<SceneComponent*>(); sceneComponent && sceneComponent->m_transformDirty)
+            {
+                removeDirtyTransform(*sceneComponent);
+            }
 
             if (const auto iter = m_activeComponents.find(component->getUid()); iter != m_activeComponents.end())
             {
                 m_activeComponents.erase(iter);
+                unregisterComponent(*component, worldUid);
             }
+
+            component->clearAllWeakReferences();
+            component->getParentObject().removeComponentFromList(*component);
         }
 
         // Component deactivation must be processed only from outside of the main update
@@ -526,21 +648,42 @@ namespace nau::scene
             co_await m_postUpdateWorkQueue;
         }
 
-        m_updatableComponents.remove_if([](UpdatableComponentEntry& entry)
+        eastl::erase_if(m_pendingUpdatableComponents, [](const Component* component)
         {
-            NAU_FATAL(entry.component);
-            const bool deactivating = entry.component->m_activationState == ActivationState::Deactivating;
-            if (deactivating)
+            return component->m_activationState == ActivationState::Deactivating;
+        });
+
+        for (WorldUpdatableComponents& worldComponents : m_updatableComponents)
+        {
+            for (UpdatableComponentGroup& group : worldComponents.groups)
             {
-                // keep listener's finalization as component's internal async operation
-                // that will be awaited prior component deletion
-                if (entry.asyncUpdateTask && !entry.asyncUpdateTask.isReady())
+                eastl::erase_if(group.entries, [](UpdatableComponentEntry& entry)
                 {
-                    entry.component->m_asyncTasks.push(std::move(entry.asyncUpdateTask));
-                }
+                    NAU_FATAL(entry.component);
+                    const bool deactivating = entry.component->m_activationState == ActivationState::Deactivating;
+                    if (deactivating)
+                    {
+                        // keep listener's finalization as component's internal async operation
+                        // that will be awaited prior component deletion
+                        if (entry.asyncUpdateTask && !entry.asyncUpdateTask.isReady())
+                        {
+                            entry.component->m_asyncTasks.push(std::move(entry.asyncUpdateTask));
+                        }
+                    }
+
+                    return deactivating;
+                });
             }
 
-            return deactivating;
+            eastl::erase_if(worldComponents.groups, [](const UpdatableComponentGroup& group)
+            {
+                return group.entries.empty();
+            });
+        }
+
+        eastl::erase_if(m_updatableComponents, [](const WorldUpdatableComponents& worldComponents)
+        {
+            return worldComponents.groups.empty();
         });
 
         {
@@ -620,6 +763,138 @@ namespace nau::scene
         return activateScene(getDefaultWorld(), std::move(scene));
     }
 
+    ISceneStreamingRequest::Ptr SceneManagerImpl::streamScene(ObjectWeakRef<WorldImpl> world, IScene::Ptr&& scene, SceneStreamingOptions options)
+    {
+        NAU_ASSERT(world);
+        NAU_ASSERT(scene);
+        if (!world || !scene)
+        {
+            return nullptr;
+        }
+
+        NAU_FATAL(getSceneIter(scene.get()) == m_scenes.end());
+
+        auto request = rtti::createInstance<SceneStreamingRequest>(options);
+
+        // Only the root is activated right away: its children are detached and streamed.
+        SceneObject& root = scene->getRoot();
+        for (SceneObject* child : root.getDirectChildObjects())
+        {
+            child->resetParentInternal(nullptr, SetParentOpts::DontKeepWorldTransform);
+            enqueueStreamedObjects(*request, root, SceneObject::Ptr{child});
+        }
+
+        m_scenes.emplace_back(std::move(scene));
+        ObjectWeakRef sceneRef = *m_scenes.back().scene;
+        sceneRef->setWorld(*world);
+
+        request->addActivation(activateSceneObject(root));
+        m_streamingRequests.push_back(request);
+
+        return request;
+    }
+
+    ISceneStreamingRequest::Ptr SceneManagerImpl::streamScene(IScene::Ptr&& scene, SceneStreamingOptions options)
+    {
+        return streamScene(getDefaultWorld(), std::move(scene), options);
+    }
+
+    ISceneStreamingRequest::Ptr SceneManagerImpl::streamSceneObject(SceneObject& parent, SceneObject::Ptr&& cell, SceneStreamingOptions options)
+    {
+        NAU_ASSERT(cell);
+        if (!cell)
+        {
+            return nullptr;
+        }
+
+        NAU_ASSERT(getSceneIter(parent.getScene()) != m_scenes.end(), "The cell parent must belong to an active scene");
+
+        auto request = rtti::createInstance<SceneStreamingRequest>(options);
+        enqueueStreamedObjects(*request, parent, std::move(cell));
+        m_streamingRequests.push_back(request);
+
+        return request;
+    }
+
+    void SceneManagerImpl::setStreamingFrameBudget(std::chrono::microseconds budget)
+    {
+        m_streamingFrameBudget = budget;
+    }
+
+    void SceneManagerImpl::enqueueStreamedObjects(SceneStreamingRequest& request, ObjectWeakRef<SceneObject> parent, SceneObject::Ptr&& object)
+    {
+        NAU_FATAL(object);
+
+        Vector<SceneObject*> objects;
+        objects.push_back(object.get());
+        request.addObject(std::move(parent), std::move(object));
+
+        for (size_t i = 0; i < objects.size(); ++i)
+        {
+            SceneObject& current = *objects[i];
+            for (SceneObject* child : current.getDirectChildObjects())
+            {
+                child->resetParentInternal(nullptr, SetParentOpts::DontKeepWorldTransform);
+                objects.push_back(child);
+                request.addObject(current, SceneObject::Ptr{child});
+            }
+        }
+    }
+
+    void SceneManagerImpl::processStreamingRequests()
+    {
+        using Clock = std::chrono::steady_clock;
+
+        if (m_streamingRequests.empty())
+        {
+            return;
+        }
+
+        // Equal priorities keep the order of the submission.
+        eastl::stable_sort(m_streamingRequests.begin(), m_streamingRequests.end(), [](const SceneStreamingRequest::Ptr& left, const SceneStreamingRequest::Ptr& right)
+        {
+            return left->getPriority() > right->getPriority();
+        });
+
+        // The budget is checked after the attachment, so at least one object is processed per frame.
+        const Clock::time_point deadline = Clock::now() + m_streamingFrameBudget;
+        bool budgetSpent = false;
+
+        for (const SceneStreamingRequest::Ptr& request : m_streamingRequests)
+        {
+            while (!budgetSpent)
+            {
+                SceneStreamingRequest::QueuedObject* const next = request->getNextObject();
+                if (!next)
+                {
+                    break;
+                }
+
+                if (!next->parent)
+                {
+                    // The parent has been removed during the streaming: the object is destroyed, so are its queued children then.
+                    request->popNextObject(async::Task<>::makeResolved());
+                    continue;
+                }
+
+                if (next->parent->getActivationState() != ActivationState::Active)
+                {
+                    break;
+                }
+
+                SceneObject& object = next->parent->attachChildInternal(std::move(next->object), false);
+                request->popNextObject(activateSceneObject(object));
+
+                budgetSpent = Clock::now() >= deadline;
+            }
+        }
+
+        eastl::erase_if(m_streamingRequests, [](const SceneStreamingRequest::Ptr& request)
+        {
+            return request->updateCompletion();
+        });
+    }
+
     void SceneManagerImpl::deactivateScene(IScene::WeakRef sceneRef)
     {
         using namespace nau::async;
@@ -642,6 +917,12 @@ namespace nau::scene
 
         deactivateSceneObjectInternal(sceneEntry->scene->getRoot(), false);
         m_scenes.erase(sceneEntry);
+
+        // the level transition: the script objects of the scene are collected at once instead of the incremental steps
+        if (getServiceProvider().has<scripts::ScriptManager>())
+        {
+            getServiceProvider().get<scripts::ScriptManager>().collectGarbage();
+        }
     }
 
     IWorld& SceneManagerImpl::getDefaultWorld() const
@@ -723,6 +1004,12 @@ namespace nau::scene
             NAU_ASSERT(worldIter != m_worlds.end());
             if (worldIter != m_worlds.end())
             {
+                const Uid worldUid = (*worldIter)->getUid();
+                eastl::erase_if(m_componentRegistries, [&worldUid](const WorldComponentRegistry& registry)
+                {
+                    return registry.worldUid == worldUid;
+                });
+
                 m_worlds.erase(worldIter);
             }
         }
@@ -766,32 +1053,75 @@ namespace nau::scene
         scope_on_leave
         {
             m_insideUpdate = false;
+            addPendingUpdatableComponents();
             m_postUpdateWorkQueue->poll();
+            flushDirtyTransforms();
+            updateSpatialIndices();
+
+            // Flushes the data entities destroyed by the deactivated components (see EcsComponentData).
+            if (g_entity_mgr)
+            {
+                g_entity_mgr->tick();
+            }
+
             Executor::setThisThreadExecutor(std::move(prevThisThreadExecutor));
 
             notifyListenerEndScene();
         };
 
         m_updateWorkQueue->poll();
+        processStreamingRequests();
 
-        for (auto iter = m_updatableComponents.begin(); iter != m_updatableComponents.end(); ++iter)
+        for (WorldUpdatableComponents& worldComponents : m_updatableComponents)
         {
-            UpdatableComponentEntry& entry = *iter;
-
-            NAU_FATAL(entry.component);
-            if (!entry.isActive())
+            const IWorld::WeakRef world = findWorld(worldComponents.worldUid);
+            if (!world || world->isSimulationPaused())
             {
                 continue;
             }
 
-            // TODO: this is very temporal solution.
-            // m_updatableComponents must keeps components in separated groups related to different worlds.
-            if (entry.component->getParentObject().getScene()->getWorld()->isSimulationPaused())
+            // The thread safe types are updated in parallel first, they do not depend on the others.
+            for (UpdatableComponentGroup& group : worldComponents.groups)
+            {
+                if (group.threadSafeUpdate)
+                {
+                    updateComponents(group, dt);
+                }
+            }
+
+            for (UpdatableComponentGroup& group : worldComponents.groups)
+            {
+                if (!group.threadSafeUpdate)
+                {
+                    updateComponents(group, dt);
+                }
+            }
+        }
+    }
+
+    void SceneManagerImpl::updateComponents(UpdatableComponentGroup& group, float dt)
+    {
+        if (group.threadSafeUpdate)
+        {
+            async::parallelFor(group.entries.size(), 0, [&group, dt](size_t index)
+            {
+                UpdatableComponentEntry& entry = group.entries[index];
+                if (entry.componentUpdate && entry.isActive())
+                {
+                    entry.componentUpdate->updateComponent(dt);
+                }
+            });
+        }
+
+        for (UpdatableComponentEntry& entry : group.entries)
+        {
+            NAU_FATAL(entry.component);
+            if (!entry.isActive())
             {
                 continue;
             }
 
-            if (entry.componentUpdate)
+            if (entry.componentUpdate && !group.threadSafeUpdate)
             {
                 entry.componentUpdate->updateComponent(dt);
                 if (!entry.isActive())
@@ -800,7 +1130,7 @@ namespace nau::scene
                 }
             }
 
-            if (entry.componentAsyncUpdate && entry.isActive())
+            if (entry.componentAsyncUpdate)
             {
                 if (!entry.asyncUpdateTask || entry.asyncUpdateTask.isReady())
                 {
@@ -812,6 +1142,179 @@ namespace nau::scene
         }
     }
 
+    SceneManagerImpl::WorldComponentRegistry* SceneManagerImpl::findComponentRegistry(Uid worldUid)
+    {
+        auto registry = eastl::find_if(m_componentRegistries.begin(), m_componentRegistries.end(), [&worldUid](const WorldComponentRegistry& entry)
+        {
+            return entry.worldUid == worldUid;
+        });
+
+        return registry != m_componentRegistries.end() ? registry : nullptr;
+    }
+
+    void SceneManagerImpl::registerComponent(Component& component)
+    {
+        const Uid worldUid = component.getParentObject().getScene()->getWorld()->getUid();
+        WorldComponentRegistry* registry = findComponentRegistry(worldUid);
+        if (!registry)
+        {
+            registry = &m_componentRegistries.emplace_back();
+            registry->worldUid = worldUid;
+        }
+
+        eastl::vector<Component*>& components = registry->componentsByType[component.getClassDescriptor()->getClassTypeInfo().getHashCode()];
+        component.m_typeRegistryIndex = static_cast<uint32_t>(components.size());
+        components.push_back(&component);
+
+        if (SceneComponent* const sceneComponent = component.as<SceneComponent*>())
+        {
+            sceneComponent->m_spatialProxyId = registry->spatialIndex.createProxy(getSpatialBounds(*sceneComponent), sceneComponent);
+        }
+    }
+
+    void SceneManagerImpl::unregisterComponent(Component& component, Uid worldUid)
+    {
+        WorldComponentRegistry* const registry = findComponentRegistry(worldUid);
+        NAU_FATAL(registry);
+
+        auto componentsIter = registry->componentsByType.find(component.getClassDescriptor()->getClassTypeInfo().getHashCode());
+        NAU_FATAL(componentsIter != registry->componentsByType.end());
+
+        // Swap with the last one to keep the array dense, the moved component takes over the index of the removed one.
+        eastl::vector<Component*>& components = componentsIter->second;
+        const uint32_t index = component.m_typeRegistryIndex;
+        NAU_FATAL(index < components.size() && components[index] == &component);
+
+        components[index] = components.back();
+        components[index]->m_typeRegistryIndex = index;
+        components.pop_back();
+
+        if (SceneComponent* const sceneComponent = component.as<SceneComponent*>(); sceneComponent && sceneComponent->m_spatialProxyId != SpatialIndex::NullProxy)
+        {
+            registry->spatialIndex.destroyProxy(sceneComponent->m_spatialProxyId);
+            sceneComponent->m_spatialProxyId = SpatialIndex::NullProxy;
+
+            if (sceneComponent->m_spatialProxyDirty.exchange(false))
+            {
+                const std::lock_guard lock(m_spatialChangesMutex);
+                eastl::erase(m_spatialChanges, sceneComponent);
+            }
+        }
+    }
+
+    const SpatialIndex* SceneManagerImpl::getSpatialIndex(Uid worldUid)
+    {
+        updateSpatialIndices();
+
+        const WorldComponentRegistry* const registry = findComponentRegistry(worldUid);
+        return registry ? &registry->spatialIndex : nullptr;
+    }
+
+    void SceneManagerImpl::updateSpatialIndices()
+    {
+        eastl::vector<const SceneComponent*> changes;
+        {
+            const std::lock_guard lock(m_spatialChangesMutex);
+            changes.swap(m_spatialChanges);
+        }
+
+        for (const SceneComponent* const component : changes)
+        {
+            component->m_spatialProxyDirty = false;
+            NAU_FATAL(component->m_spatialProxyId != SpatialIndex::NullProxy);
+
+            const Uid worldUid = component->getParentObject().getScene()->getWorld()->getUid();
+            WorldComponentRegistry* const registry = findComponentRegistry(worldUid);
+            NAU_FATAL(registry);
+
+            registry->spatialIndex.moveProxy(component->m_spatialProxyId, getSpatialBounds(*component));
+        }
+    }
+
+    void SceneManagerImpl::addUpdatableComponent(Component& component)
+    {
+        const Uid worldUid = component.getParentObject().getScene()->getWorld()->getUid();
+        auto worldComponents = eastl::find_if(m_updatableComponents.begin(), m_updatableComponents.end(), [&worldUid](const WorldUpdatableComponents& entry)
+        {
+            return entry.worldUid == worldUid;
+        });
+
+        if (worldComponents == m_updatableComponents.end())
+        {
+            worldComponents = &m_updatableComponents.emplace_back();
+            worldComponents->worldUid = worldUid;
+        }
+
+        const IClassDescriptor::Ptr classDescriptor = component.getClassDescriptor();
+        const rtti::TypeInfo* const componentType = &classDescriptor->getClassTypeInfo();
+
+        auto group = eastl::find_if(worldComponents->groups.begin(), worldComponents->groups.end(), [componentType](const UpdatableComponentGroup& entry)
+        {
+            return *entry.componentType == *componentType;
+        });
+
+        if (group == worldComponents->groups.end())
+        {
+            const meta::IRuntimeAttributeContainer* const attributes = classDescriptor->getClassAttributes();
+
+            group = &worldComponents->groups.emplace_back();
+            group->componentType = componentType;
+            group->threadSafeUpdate = attributes && attributes->contains<ComponentThreadSafeUpdateAttrib>();
+        }
+
+        group->entries.emplace_back(component);
+    }
+
+    void SceneManagerImpl::addDirtyTransform(SceneComponent& component)
+    {
+        // Transforms may be set from the thread safe component updates.
+        const std::lock_guard lock(m_dirtyTransformsMutex);
+        m_dirtyTransforms.push_back(&component);
+    }
+
+    void SceneManagerImpl::removeDirtyTransform(SceneComponent& component)
+    {
+        const std::lock_guard lock(m_dirtyTransformsMutex);
+        component.m_transformDirty = false;
+        eastl::erase(m_dirtyTransforms, &component);
+    }
+
+    void SceneManagerImpl::flushDirtyTransforms()
+    {
+        for (SceneComponent* const component : m_dirtyTransforms)
+        {
+            // Already flushed with the subtree of a dirty ancestor.
+            if (!component->m_transformDirty)
+            {
+                continue;
+            }
+
+            // Starting from the topmost dirty ancestor, each subtree is walked once however many of its components were changed.
+            SceneComponent* subtreeRoot = component;
+            for (SceneComponent* parent = component->m_transformParent; parent; parent = parent->m_transformParent)
+            {
+                if (parent->m_transformDirty)
+                {
+                    subtreeRoot = parent;
+                }
+            }
+
+            subtreeRoot->flushTransformChanges();
+        }
+
+        m_dirtyTransforms.clear();
+    }
+
+    void SceneManagerImpl::addPendingUpdatableComponents()
+    {
+        for (Component* const component : m_pendingUpdatableComponents)
+        {
+            addUpdatableComponent(*component);
+        }
+
+        m_pendingUpdatableComponents.clear();
+    }
+
     Component* SceneManagerImpl::findComponent(Uid componentUid)
     {
         auto component = m_activeComponents.find(componentUid);
@@ -828,10 +1331,19 @@ namespace nau::scene
             NAU_ASSERT(m_activeObjects.empty());
             NAU_ASSERT(m_activeComponents.empty());
             NAU_ASSERT(m_updatableComponents.empty());
+            NAU_ASSERT(m_pendingUpdatableComponents.empty());
+            NAU_ASSERT(m_dirtyTransforms.empty());
             NAU_ASSERT(m_asyncTasks.isEmpty());
+            NAU_ASSERT(m_streamingRequests.empty());
         };
 #endif
 
+        for (const SceneStreamingRequest::Ptr& request : m_streamingRequests)
+        {
+            co_await request->shutdown();
+        }
+        m_streamingRequests.clear();
+
         while (!m_scenes.empty())
         {
             deactivateScene(*m_scenes.front().scene);
@@ -913,6 +1425,48 @@ namespace nau::scene
         }
     }
 
+    void SceneManagerImpl::publishComponentChanges(const Component& component, ComponentChangeFlag changes)
+    {
+        if (changes.hasAny(ComponentChange::Transform, ComponentChange::Bounds))
+        {
+            const SceneComponent* const sceneComponent = component.as<const SceneComponent*>();
+            if (sceneComponent && sceneComponent->m_spatialProxyId != SpatialIndex::NullProxy && !sceneComponent->m_spatialProxyDirty.exchange(true))
+            {
+                const std::lock_guard lock(m_spatialChangesMutex);
+                m_spatialChanges.push_back(sceneComponent);
+            }
+        }
+
+        for (const eastl::unique_ptr<ComponentChangesQueue>& queue : m_componentChangesQueues)
+        {
+            if (!queue->channels.hasAny(changes))
+            {
+                continue;
+            }
+
+            // Changes may be published from the thread safe component updates.
+            const std::lock_guard lock(queue->mutex);
+            if (queue->changedComponentsSet.insert(component.getUid()).second)
+            {
+                queue->changedComponents.push_back(component.getUid());
+            }
+        }
+    }
+
+    ComponentChangesSubscription SceneManagerImpl::subscribeComponentChanges(ComponentChangeFlag channels)
+    {
+        auto& queue = m_componentChangesQueues.emplace_back(eastl::make_unique<ComponentChangesQueue>(channels));
+        return ComponentChangesSubscription{queue.get()};
+    }
+
+    void SceneManagerImpl::unsubscribeComponentChanges(void* subscriptionHandle)
+    {
+        eastl::erase_if(m_componentChangesQueues, [subscriptionHandle](const eastl::unique_ptr<ComponentChangesQueue>& queue)
+        {
+            return queue.get() == subscriptionHandle;
+        });
+    }
+
     async::Task<IScene::Ptr> openScene(const eastl::string& path)
     {
         AssetRef<> sceneAssetRef{path};
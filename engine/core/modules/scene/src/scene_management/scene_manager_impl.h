@@ -4,13 +4,23 @@
 
 
 #pragma once
+#include <EASTL/unique_ptr.h>
+#include <EASTL/unordered_set.h>
+
+#include <chrono>
+#include <mutex>
+
 #include "nau/scene/components/component_life_cycle.h"
+#include "nau/scene/components/scene_component.h"
 #include "nau/scene/internal/scene_listener.h"
 #include "nau/scene/internal/scene_manager_internal.h"
 #include "nau/scene/scene_manager.h"
 #include "nau/scene/scene_object.h"
 #include "nau/memory/eastl_aliases.h"
+#include "nau/utils/uid_map.h"
 #include "scene_impl.h"
+#include "scene_streaming_request.h"
+#include "spatial_index.h"
 #include "world_impl.h"
 
 
@@ -54,8 +64,18 @@ namespace nau::scene
 
         void deactivateScene(IScene::WeakRef sceneRef) override;
 
+        ISceneStreamingRequest::Ptr streamScene(ObjectWeakRef<WorldImpl> world, IScene::Ptr&& scene, SceneStreamingOptions options);
+
+        ISceneStreamingRequest::Ptr streamScene(IScene::Ptr&& scene, SceneStreamingOptions options) override;
+
+        ISceneStreamingRequest::Ptr streamSceneObject(SceneObject& parent, SceneObject::Ptr&& cell, SceneStreamingOptions options) override;
+
+        void setStreamingFrameBudget(std::chrono::microseconds budget) override;
+
         ObjectWeakRef<> querySingleObject(const SceneQuery& query) override;
 
+        eastl::span<Component* const> queryComponents(const SceneQuery& query) override;
+
         void update(float dt) override;
 
         Component* findComponent(Uid componentId) override;
@@ -64,6 +84,23 @@ namespace nau::scene
 
         void notifyListenerComponentWasChanged(const Component& component);
 
+        void publishComponentChanges(const Component& component, ComponentChangeFlag changes);
+
+        /**
+         * Queues the component whose transform was changed, its subtree is notified by the next flushDirtyTransforms().
+         */
+        void addDirtyTransform(SceneComponent& component);
+
+        /**
+         * Updates the world transforms of the changed components subtrees and notifies their changes, once per frame.
+         */
+        void flushDirtyTransforms();
+
+        /**
+         * @return  Spatial index of the world with the pending bounds changes applied, nullptr if the world has no active components.
+         */
+        const SpatialIndex* getSpatialIndex(Uid worldUid);
+
     private:
         struct UpdatableComponentEntry
         {
@@ -81,6 +118,51 @@ namespace nau::scene
             }
         };
 
+        /**
+         * Updatable components of the same type, kept contiguous and updated together.
+         */
+        struct UpdatableComponentGroup
+        {
+            const rtti::TypeInfo* componentType = nullptr;
+            bool threadSafeUpdate = false;
+            eastl::vector<UpdatableComponentEntry> entries;
+        };
+
+        /**
+         * Updatable components of a world, the whole world is skipped while its simulation is paused.
+         */
+        struct WorldUpdatableComponents
+        {
+            Uid worldUid;
+            eastl::vector<UpdatableComponentGroup> groups;
+        };
+
+        /**
+         * Active components of a world, by their exact types, and the spatial index of its active scene components.
+         */
+        struct WorldComponentRegistry
+        {
+            Uid worldUid;
+            eastl::unordered_map<size_t, eastl::vector<Component*>> componentsByType;
+            SpatialIndex spatialIndex;
+        };
+
+        /**
+         * Changed components collected for a ComponentChangesSubscription.
+         */
+        struct ComponentChangesQueue
+        {
+            const ComponentChangeFlag channels;
+            std::mutex mutex;
+            eastl::vector<Uid> changedComponents;
+            eastl::unordered_set<Uid> changedComponentsSet;
+
+            ComponentChangesQueue(ComponentChangeFlag inChannels) :
+                channels(inChannels)
+            {
+            }
+        };
+
         struct SceneEntry
         {
             ObjectUniquePtr<SceneImpl> scene;
@@ -106,27 +188,72 @@ namespace nau::scene
         SceneListenerRegistration addSceneListener(ISceneListener& sceneListener) override;
         void removeSceneListener(void* sceneListenerHandle);
 
+        ComponentChangesSubscription subscribeComponentChanges(ComponentChangeFlag channels) override;
+        void unsubscribeComponentChanges(void* subscriptionHandle);
+
         ObjectWeakRef<> lookupComponent(const SceneQuery& query);
 
         ObjectWeakRef<> lookupSceneObject(const SceneQuery& query);
 
+        WorldComponentRegistry* findComponentRegistry(Uid worldUid);
+
+        void registerComponent(Component& component);
+
+        void unregisterComponent(Component& component, Uid worldUid);
+
+        /**
+         * Splits the hierarchy into standalone objects queued in breadth-first order, so parents are always attached before their children.
+         */
+        void enqueueStreamedObjects(SceneStreamingRequest& request, ObjectWeakRef<SceneObject> parent, SceneObject::Ptr&& object);
+
+        /**
+         * Attaches the queued objects of the streaming requests until the frame budget is spent.
+         */
+        void processStreamingRequests();
+
+        void addUpdatableComponent(Component& component);
+
+        void addPendingUpdatableComponents();
+
+        void removeDirtyTransform(SceneComponent& component);
+
+        /**
+         * Moves the proxies of the components whose transforms or bounds were changed in the world spatial indices.
+         */
+        void updateSpatialIndices();
+
+        void updateComponents(UpdatableComponentGroup& group, float dt);
+
         eastl::list<ObjectUniquePtr<WorldImpl>> m_worlds;
         eastl::list<SceneEntry> m_scenes;
-        eastl::list<UpdatableComponentEntry> m_updatableComponents;
-        eastl::unordered_map<Uid, SceneObject*> m_activeObjects;
-    eastl::unordered_map<Uid, Component*> m_activeComponents;
+        eastl::vector<WorldUpdatableComponents> m_updatableComponents;
+        Vector<Component*> m_pendingUpdatableComponents; /** < Components activated inside the update, added to the groups once it is done. */
+
+        std::mutex m_dirtyTransformsMutex;
+        eastl::vector<SceneComponent*> m_dirtyTransforms; /** < Active components whose transforms were changed since the last flush. */
+        UidMap<SceneObject*> m_activeObjects;
+        UidMap<Component*> m_activeComponents;
+        eastl::vector<WorldComponentRegistry> m_componentRegistries;
+
+        std::mutex m_spatialChangesMutex;
+        eastl::vector<const SceneComponent*> m_spatialChanges; /** < Active components whose proxies are to be moved in the spatial index. */
 
         bool m_insideUpdate = false;
         async::TaskCollection m_asyncTasks;
         WorkQueue::Ptr m_updateWorkQueue = WorkQueue::create();
         WorkQueue::Ptr m_postUpdateWorkQueue = WorkQueue::create();
 
+        eastl::vector<SceneStreamingRequest::Ptr> m_streamingRequests;
+        std::chrono::microseconds m_streamingFrameBudget{2000};
+
         ISceneListener* m_sceneListener = nullptr;
+        eastl::vector<eastl::unique_ptr<ComponentChangesQueue>> m_componentChangesQueues;
 
         // TODO: The allocator is currently being used incorrectly (there is single allocator that is being used from the graphics thread)
         //eastl::unordered_set<const Component*, eastl::hash<const Component*>, eastl::equal_to<const Component*>, EastlFrameAllocator> m_changedComponents;
         eastl::unordered_set<const Component*> m_changedComponents;
 
         friend struct SceneListenerRegistration;
+        friend struct ComponentChangesSubscription;
     };
 }  // namespace nau::scene
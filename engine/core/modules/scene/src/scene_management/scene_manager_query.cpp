@@ -64,9 +64,14 @@ namespace nau::scene
                 return nullptr;
             }
         }
+        else if (query.typeHashCode != 0)
+        {
+            const eastl::span<Component* const> components = queryComponents(query);
+            component = components.empty() ? nullptr : components.front();
+        }
         else
         {
-            NAU_LOG_WARNING("Current query mechanism is very restricted and can query components only by uid");
+            NAU_LOG_WARNING("Current query mechanism is very restricted and can query components only by uid or by type");
         }
 
         if (component && query.typeHashCode != 0)
@@ -77,10 +82,42 @@ namespace nau::scene
             }
         }
 
+        if (component && query.worldUid != NullUid)
+        {
+            if (component->getParentObject().getScene()->getWorld()->getUid() != query.worldUid)
+            {
+                component = nullptr;
+            }
+        }
+
         // Initialization ObjectWeakRef<> with null (not std::nullptr_t) is prohibited for security reasons
         return component ? ObjectWeakRef<>{component} : nullptr;
     }
 
+    eastl::span<Component* const> SceneManagerImpl::queryComponents(const SceneQuery& query)
+    {
+        NAU_ASSERT(query.hasType(), "Components can be queried only by type");
+        if (!query.hasType())
+        {
+            return {};
+        }
+
+        const Uid worldUid = query.worldUid != NullUid ? query.worldUid : getDefaultWorld().getUid();
+        WorldComponentRegistry* const registry = findComponentRegistry(worldUid);
+        if (!registry)
+        {
+            return {};
+        }
+
+        const auto componentsIter = registry->componentsByType.find(query.typeHashCode);
+        if (componentsIter == registry->componentsByType.end())
+        {
+            return {};
+        }
+
+        return {componentsIter->second.data(), componentsIter->second.size()};
+    }
+
     ObjectWeakRef<> SceneManagerImpl::lookupSceneObject(const SceneQuery& query)
     {
         SceneObject* sceneObject = nullptr;
@@ -0,0 +1,197 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "scene_objects_arena.h"
+
+namespace nau::scene
+{
+    namespace
+    {
+        constexpr size_t ChunkSize = 64 * 1024;
+        constexpr size_t BlockAlignment = 16;
+        constexpr uint32_t BlockMagic = 0x41524E53;  // "SNRA"
+
+        struct alignas(BlockAlignment) BlockHeader
+        {
+            uint32_t size;
+            uint32_t magic;
+        };
+
+        static_assert(sizeof(BlockHeader) == BlockAlignment);
+
+        thread_local SceneObjectsArena* s_currentArena = nullptr;
+
+        inline BlockHeader* getBlockHeader(const void* ptr)
+        {
+            return reinterpret_cast<BlockHeader*>(const_cast<std::byte*>(reinterpret_cast<const std::byte*>(ptr))) - 1;
+        }
+    }  // namespace
+
+    SceneObjectsArena::Scope::Scope(SceneObjectsArena& arena) :
+        m_prevArena(std::exchange(s_currentArena, &arena))
+    {
+    }
+
+    SceneObjectsArena::Scope::~Scope()
+    {
+        s_currentArena = m_prevArena;
+    }
+
+    SceneObjectsArena* SceneObjectsArena::getCurrent()
+    {
+        return s_currentArena;
+    }
+
+    SceneObjectsArena* SceneObjectsArena::create()
+    {
+        return new SceneObjectsArena();
+    }
+
+    SceneObjectsArena::~SceneObjectsArena()
+    {
+        NAU_ASSERT(s_currentArena != this);
+
+        const IMemAllocator::Ptr& allocator = getDefaultAllocator();
+        for (std::byte* const chunk : m_chunks)
+        {
+            allocator->deallocateAligned(chunk);
+        }
+    }
+
+    void SceneObjectsArena::release()
+    {
+        removeRef();
+    }
+
+    void SceneObjectsArena::removeRef()
+    {
+        NAU_FATAL(m_refsCount > 0);
+        if (m_refsCount.fetch_sub(1) == 1)
+        {
+            delete this;
+        }
+    }
+
+    std::byte* SceneObjectsArena::allocateChunk(size_t size)
+    {
+        std::byte* const chunk = reinterpret_cast<std::byte*>(getDefaultAllocator()->allocateAligned(size, BlockAlignment));
+        NAU_FATAL(chunk);
+        m_chunks.push_back(chunk);
+
+        return chunk;
+    }
+
+    void* SceneObjectsArena::allocate(size_t size)
+    {
+        return allocateAligned(size, BlockAlignment);
+    }
+
+    void* SceneObjectsArena::reallocate(void* ptr, size_t size)
+    {
+        return reallocateAligned(ptr, size, BlockAlignment);
+    }
+
+    void SceneObjectsArena::deallocate(void* ptr)
+    {
+        deallocateAligned(ptr);
+    }
+
+    size_t SceneObjectsArena::getSize(const void* ptr) const
+    {
+        return getSizeAligned(ptr, BlockAlignment);
+    }
+
+    void* SceneObjectsArena::allocateAligned(size_t size, size_t alignment)
+    {
+        NAU_ASSERT(isPowerOf2(alignment));
+        NAU_FATAL(size <= eastl::numeric_limits<uint32_t>::max());
+
+        // Blocks of the same size (i.e. of the same type) are taken from the same chunks.
+        const size_t extraAlignment = alignment > BlockAlignment ? alignment - BlockAlignment : 0;
+        const size_t blockSize = sizeof(BlockHeader) + alignedSize(size, BlockAlignment) + extraAlignment;
+
+        std::byte* block = nullptr;
+        {
+            const std::lock_guard lock{m_mutex};
+
+            Bucket& bucket = m_buckets[blockSize];
+            if (static_cast<size_t>(bucket.end - bucket.current) < blockSize)
+            {
+                const size_t chunkSize = eastl::max(ChunkSize, blockSize);
+                bucket.current = allocateChunk(chunkSize);
+                bucket.end = bucket.current + chunkSize;
+            }
+
+            block = bucket.current;
+            bucket.current += blockSize;
+        }
+
+        ++m_refsCount;
+
+        std::byte* const ptr = reinterpret_cast<std::byte*>(alignedSize(reinterpret_cast<uintptr_t>(block + sizeof(BlockHeader)), alignment));
+        BlockHeader* const header = getBlockHeader(ptr);
+        header->size = static_cast<uint32_t>(size);
+        header->magic = BlockMagic;
+
+        return ptr;
+    }
+
+    void* SceneObjectsArena::reallocateAligned(void* ptr, size_t size, size_t alignment)
+    {
+        if (!ptr)
+        {
+            return allocateAligned(size, alignment);
+        }
+
+        const size_t prevSize = getSizeAligned(ptr, alignment);
+        if (size <= prevSize)
+        {
+            return ptr;
+        }
+
+        void* const newPtr = allocateAligned(size, alignment);
+        memcpy(newPtr, ptr, prevSize);
+        deallocateAligned(ptr);
+
+        return newPtr;
+    }
+
+    void SceneObjectsArena::deallocateAligned(void* ptr)
+    {
+        if (!ptr)
+        {
+            return;
+        }
+
+        NAU_ASSERT(isValid(ptr));
+        getBlockHeader(ptr)->magic = 0;
+
+        // The block memory is not reused: the chunks are released all together with the last block.
+        removeRef();
+    }
+
+    size_t SceneObjectsArena::getSizeAligned(const void* ptr, [[maybe_unused]] size_t alignment) const
+    {
+        return ptr ? getBlockHeader(ptr)->size : 0;
+    }
+
+    bool SceneObjectsArena::isAligned(const void* ptr) const
+    {
+        return ptr != nullptr;
+    }
+
+    bool SceneObjectsArena::isValid(const void* ptr) const
+    {
+        return ptr && getBlockHeader(ptr)->magic == BlockMagic;
+    }
+
+    const char* SceneObjectsArena::getName() const
+    {
+        return "SceneObjectsArena";
+    }
+
+    void SceneObjectsArena::setName([[maybe_unused]] const char* name)
+    {
+    }
+}  // namespace nau::scene
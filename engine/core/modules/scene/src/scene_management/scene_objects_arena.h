@@ -0,0 +1,105 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <EASTL/vector.h>
+#include <EASTL/vector_map.h>
+
+#include <atomic>
+#include <mutex>
+
+#include "nau/memory/mem_allocator.h"
+
+namespace nau::scene
+{
+    /**
+     * Arena for the objects and components that are created along with a scene (or a prefab instance).
+     *
+     * Blocks are carved from the chunks that are grouped by the block size, so the instances of the same type
+     * are placed next to each other. Releasing a block does not return memory to the system: the chunks are released in bulk
+     * when the last block is released and the arena is no longer used for the allocations (see release()).
+     * So unloading of the whole scene does not spend time in the general allocator.
+     *
+     * The arena is used by NauObject::classCreateInstance while it is current (see Scope).
+     */
+    class SceneObjectsArena final : public IMemAllocator
+    {
+    public:
+        /**
+         * Makes the arena current for the objects created on this thread, restores the previous one on destruction.
+         */
+        class Scope
+        {
+        public:
+            Scope(SceneObjectsArena& arena);
+            ~Scope();
+
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+
+        private:
+            SceneObjectsArena* const m_prevArena;
+        };
+
+        /**
+         * @return The arena that is current for this thread or nullptr.
+         */
+        static SceneObjectsArena* getCurrent();
+
+        /**
+         * Creates the arena, the caller must call release() when the arena is no longer used for the allocations.
+         */
+        static SceneObjectsArena* create();
+
+        /**
+         * Gives up the ownership of the arena: it will be destroyed along with its last block.
+         */
+        void release();
+
+        [[nodiscard]] void* allocate(size_t size) override;
+
+        [[nodiscard]] void* reallocate(void* ptr, size_t size) override;
+
+        void deallocate(void* ptr) override;
+
+        [[nodiscard]] size_t getSize(const void* ptr) const override;
+
+        [[nodiscard]] void* allocateAligned(size_t size, size_t alignment) override;
+
+        [[nodiscard]] void* reallocateAligned(void* ptr, size_t size, size_t alignment) override;
+
+        void deallocateAligned(void* ptr) override;
+
+        [[nodiscard]] size_t getSizeAligned(const void* ptr, size_t alignment) const override;
+
+        [[nodiscard]] bool isAligned(const void* ptr) const override;
+
+        [[nodiscard]] bool isValid(const void* ptr) const override;
+
+        [[nodiscard]] const char* getName() const override;
+
+        void setName(const char* name) override;
+
+    private:
+        struct Bucket
+        {
+            std::byte* current = nullptr;
+            std::byte* end = nullptr;
+        };
+
+        SceneObjectsArena() = default;
+        ~SceneObjectsArena();
+
+        std::byte* allocateChunk(size_t size);
+        void removeRef();
+
+        eastl::vector_map<size_t, Bucket> m_buckets;
+        eastl::vector<std::byte*> m_chunks;
+        std::mutex m_mutex;
+
+        // The owner reference + one reference per the allocated block.
+        std::atomic<size_t> m_refsCount = 1;
+    };
+}  // namespace nau::scene
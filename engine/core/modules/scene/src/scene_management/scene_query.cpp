@@ -42,7 +42,8 @@ namespace nau::scene
     {
         return left.category == right.category &&
                left.uid == right.uid &&
-               left.typeHashCode == right.typeHashCode;
+               left.typeHashCode == right.typeHashCode &&
+               left.worldUid == right.worldUid;
     }
 
     Result<> parse(std::string_view queryStr, SceneQuery& queryData)
@@ -82,6 +83,10 @@ namespace nau::scene
             {
                 queryData.typeHashCode = lexicalCast<size_t>(propValue);
             }
+            else if (icaseEqual(propKey, "world"))
+            {
+                NauCheckResult(parse(propValue, queryData.worldUid))
+            }
             else
             {
                 return NauMakeError("Unknown query param:({})=({})", propKey, propValue);
@@ -138,6 +143,12 @@ namespace nau::scene
             appendQueryProperty("type_id", toStringView(typeIdValue));
         }
 
+        if (queryData.worldUid != NullUid)
+        {
+            const std::string worldUidValue = toString(queryData.worldUid);
+            appendQueryProperty("world", toStringView(worldUidValue));
+        }
+
         return resultQueryString;
     }
 }  // namespace nau::scene
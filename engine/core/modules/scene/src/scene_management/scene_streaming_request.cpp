@@ -0,0 +1,139 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "scene_streaming_request.h"
+
+namespace nau::scene
+{
+    SceneStreamingRequest::SceneStreamingRequest(SceneStreamingOptions options) :
+        m_priority(options.priority)
+    {
+    }
+
+    SceneStreamingRequest::~SceneStreamingRequest()
+    {
+        NAU_ASSERT(m_activations.empty());
+
+        if (!m_completed)
+        {
+            m_completion.resolve();
+        }
+    }
+
+    float SceneStreamingRequest::getProgress() const
+    {
+        if (m_completed)
+        {
+            return 1.f;
+        }
+
+        const size_t totalCount = m_totalCount;
+        return totalCount == 0 ? 0.f : static_cast<float>(m_activatedCount) / static_cast<float>(totalCount);
+    }
+
+    bool SceneStreamingRequest::isCompleted() const
+    {
+        return m_completed;
+    }
+
+    int SceneStreamingRequest::getPriority() const
+    {
+        return m_priority;
+    }
+
+    void SceneStreamingRequest::setPriority(int priority)
+    {
+        m_priority = priority;
+    }
+
+    void SceneStreamingRequest::cancel()
+    {
+        m_canceled = true;
+    }
+
+    async::Task<> SceneStreamingRequest::waitForCompletion()
+    {
+        return m_completion.getNextTask();
+    }
+
+    void SceneStreamingRequest::addObject(ObjectWeakRef<SceneObject> parent, SceneObject::Ptr&& object)
+    {
+        NAU_FATAL(object);
+
+        m_queuedObjects.push_back(QueuedObject{std::move(parent), std::move(object)});
+        ++m_totalCount;
+    }
+
+    void SceneStreamingRequest::addActivation(async::Task<> activationTask)
+    {
+        ++m_totalCount;
+        if (activationTask && !activationTask.isReady())
+        {
+            m_activations.emplace_back(std::move(activationTask));
+        }
+        else
+        {
+            ++m_activatedCount;
+        }
+    }
+
+    SceneStreamingRequest::QueuedObject* SceneStreamingRequest::getNextObject()
+    {
+        if (m_canceled)
+        {
+            // The objects that were not attached are destroyed along with the queue.
+            m_queuedObjects.clear();
+        }
+
+        return m_queuedObjects.empty() ? nullptr : &m_queuedObjects.front();
+    }
+
+    void SceneStreamingRequest::popNextObject(async::Task<> activationTask)
+    {
+        NAU_FATAL(!m_queuedObjects.empty());
+
+        m_queuedObjects.pop_front();
+        --m_totalCount;
+        addActivation(std::move(activationTask));
+    }
+
+    bool SceneStreamingRequest::updateCompletion()
+    {
+        if (m_completed)
+        {
+            return true;
+        }
+
+        if (m_canceled)
+        {
+            m_queuedObjects.clear();
+        }
+
+        const size_t activationsCount = m_activations.size();
+        eastl::erase_if(m_activations, [](const async::Task<>& activationTask)
+        {
+            return activationTask.isReady();
+        });
+        m_activatedCount += activationsCount - m_activations.size();
+
+        if (!m_activations.empty() || !m_queuedObjects.empty())
+        {
+            return false;
+        }
+
+        m_completed = true;
+        m_completion.resolve();
+
+        return true;
+    }
+
+    async::Task<> SceneStreamingRequest::shutdown()
+    {
+        m_canceled = true;
+        m_queuedObjects.clear();
+
+        co_await async::whenAll(m_activations);
+        updateCompletion();
+    }
+}  // namespace nau::scene
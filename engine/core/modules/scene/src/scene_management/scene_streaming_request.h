@@ -0,0 +1,94 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <EASTL/deque.h>
+
+#include <atomic>
+
+#include "nau/async/multi_task_source.h"
+#include "nau/memory/eastl_aliases.h"
+#include "nau/scene/scene_object.h"
+#include "nau/scene/scene_streaming.h"
+
+namespace nau::scene
+{
+    /**
+     * Streaming request state, the objects are queued and attached by SceneManagerImpl on the main thread.
+     */
+    class SceneStreamingRequest final : public ISceneStreamingRequest
+    {
+        NAU_CLASS_(nau::scene::SceneStreamingRequest, ISceneStreamingRequest)
+
+    public:
+        using Ptr = nau::Ptr<SceneStreamingRequest>;
+
+        SceneStreamingRequest(SceneStreamingOptions options);
+
+        ~SceneStreamingRequest();
+
+        float getProgress() const override;
+
+        bool isCompleted() const override;
+
+        int getPriority() const override;
+
+        void setPriority(int priority) override;
+
+        void cancel() override;
+
+        async::Task<> waitForCompletion() override;
+
+        struct QueuedObject
+        {
+            ObjectWeakRef<SceneObject> parent;
+            SceneObject::Ptr object;
+        };
+
+        /**
+         * Queues the object to be attached to the parent. The parent must be queued before (or be attached already).
+         */
+        void addObject(ObjectWeakRef<SceneObject> parent, SceneObject::Ptr&& object);
+
+        /**
+         * Tracks the activation of an object that is not queued (i.e. the scene root), it counts as a streamed object.
+         */
+        void addActivation(async::Task<> activationTask);
+
+        /**
+         * @return  Next object to attach, nullptr if the queue is empty (or the request was canceled).
+         */
+        QueuedObject* getNextObject();
+
+        /**
+         * Removes the next object from the queue after it has been attached.
+         *
+         * @param [in] activationTask   Activation of the attached object.
+         */
+        void popNextObject(async::Task<> activationTask);
+
+        /**
+         * Drops the completed activations and resolves the request when everything is done.
+         *
+         * @return  true if the request is completed.
+         */
+        bool updateCompletion();
+
+        /**
+         * Cancels the request and waits for the activations that are in progress.
+         */
+        async::Task<> shutdown();
+
+    private:
+        eastl::deque<QueuedObject> m_queuedObjects;
+        Vector<async::Task<>> m_activations;
+        std::atomic<size_t> m_totalCount = 0;
+        std::atomic<size_t> m_activatedCount = 0;
+        std::atomic<int> m_priority;
+        std::atomic<bool> m_canceled = false;
+        std::atomic<bool> m_completed = false;
+        async::MultiTaskSource<> m_completion;
+    };
+}  // namespace nau::scene
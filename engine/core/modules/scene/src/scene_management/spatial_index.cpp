@@ -0,0 +1,477 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "spatial_index.h"
+
+#include <EASTL/fixed_vector.h>
+#include <EASTL/sort.h>
+
+namespace nau::scene
+{
+    namespace
+    {
+        // Enlargement of the leaf bounds, so the small movements do not change the tree.
+        constexpr float ProxyMargin = 0.1f;
+
+        using NodeStack = eastl::fixed_vector<int32_t, 128, true>;
+
+        inline math::BBox3 combine(const math::BBox3& box1, const math::BBox3& box2)
+        {
+            return math::BBox3{math::minPerElem(box1.lim[0], box2.lim[0]), math::maxPerElem(box1.lim[1], box2.lim[1])};
+        }
+
+        inline bool contains(const math::BBox3& outer, const math::BBox3& inner)
+        {
+            return outer.lim[0].getX() <= inner.lim[0].getX() && outer.lim[0].getY() <= inner.lim[0].getY() && outer.lim[0].getZ() <= inner.lim[0].getZ() &&
+                   inner.lim[1].getX() <= outer.lim[1].getX() && inner.lim[1].getY() <= outer.lim[1].getY() && inner.lim[1].getZ() <= outer.lim[1].getZ();
+        }
+
+        inline float getSurfaceArea(const math::BBox3& box)
+        {
+            const math::Vector3 size = box.width();
+            return 2.f * (size.getX() * size.getY() + size.getY() * size.getZ() + size.getZ() * size.getX());
+        }
+
+        inline math::BBox3 enlarge(const math::BBox3& box)
+        {
+            const math::Vector3 margin{ProxyMargin, ProxyMargin, ProxyMargin};
+            return math::BBox3{box.lim[0] - margin, box.lim[1] + margin};
+        }
+
+        inline float getDistanceSqr(const math::BBox3& box, const math::Vector3& point)
+        {
+            const math::Vector3 nearest = math::minPerElem(math::maxPerElem(point, box.lim[0]), box.lim[1]);
+            return math::lengthSqr(nearest - point);
+        }
+
+        inline float getFarthestDistanceSqr(const math::BBox3& box, const math::Vector3& point)
+        {
+            const math::Vector3 farthest = math::maxPerElem(math::absPerElem(point - box.lim[0]), math::absPerElem(box.lim[1] - point));
+            return math::lengthSqr(farthest);
+        }
+
+        /**
+         * Slab test of the ray segment against the box.
+         *
+         * @return  Distance along the ray to the box entry point, negative if the segment misses the box.
+         */
+        inline float intersectRay(const math::BBox3& box, const math::Vector3& origin, const math::Vector3& invDirection, float maxDistance)
+        {
+            float tMin = 0.f;
+            float tMax = maxDistance;
+
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                const float t1 = (box.lim[0][axis] - origin[axis]) * invDirection[axis];
+                const float t2 = (box.lim[1][axis] - origin[axis]) * invDirection[axis];
+
+                tMin = eastl::max(tMin, eastl::min(t1, t2));
+                tMax = eastl::min(tMax, eastl::max(t1, t2));
+                if (tMin > tMax)
+                {
+                    return -1.f;
+                }
+            }
+
+            return tMin;
+        }
+    }  // namespace
+
+    int32_t SpatialIndex::createProxy(const math::BBox3& bounds, SceneComponent* component)
+    {
+        const int32_t proxyId = allocateNode();
+        Node& node = m_nodes[proxyId];
+        node.bounds = enlarge(bounds);
+        node.componentBounds = bounds;
+        node.component = component;
+        node.height = 0;
+
+        insertLeaf(proxyId);
+        ++m_proxyCount;
+
+        return proxyId;
+    }
+
+    void SpatialIndex::destroyProxy(int32_t proxyId)
+    {
+        NAU_FATAL(proxyId >= 0 && static_cast<size_t>(proxyId) < m_nodes.size());
+        NAU_FATAL(m_nodes[proxyId].isLeaf());
+
+        removeLeaf(proxyId);
+        freeNode(proxyId);
+        --m_proxyCount;
+    }
+
+    void SpatialIndex::moveProxy(int32_t proxyId, const math::BBox3& bounds)
+    {
+        NAU_FATAL(proxyId >= 0 && static_cast<size_t>(proxyId) < m_nodes.size());
+        NAU_FATAL(m_nodes[proxyId].isLeaf());
+
+        m_nodes[proxyId].componentBounds = bounds;
+        if (contains(m_nodes[proxyId].bounds, bounds))
+        {
+            return;
+        }
+
+        removeLeaf(proxyId);
+        m_nodes[proxyId].bounds = enlarge(bounds);
+        insertLeaf(proxyId);
+    }
+
+    size_t SpatialIndex::getProxyCount() const
+    {
+        return m_proxyCount;
+    }
+
+    void SpatialIndex::queryBox(const math::BBox3& box, Vector<SceneComponent*>& result) const
+    {
+        query([&box](const math::BBox3& bounds)
+        {
+            if (!box.non_empty_intersect(bounds))
+            {
+                return Overlap::Outside;
+            }
+
+            return contains(box, bounds) ? Overlap::Inside : Overlap::Intersects;
+        }, result);
+    }
+
+    void SpatialIndex::querySphere(const math::BSphere3& sphere, Vector<SceneComponent*>& result) const
+    {
+        query([&sphere](const math::BBox3& bounds)
+        {
+            if (getDistanceSqr(bounds, sphere.c) > sphere.r2)
+            {
+                return Overlap::Outside;
+            }
+
+            return getFarthestDistanceSqr(bounds, sphere.c) <= sphere.r2 ? Overlap::Inside : Overlap::Intersects;
+        }, result);
+    }
+
+    void SpatialIndex::queryFrustum(const math::NauFrustum& frustum, Vector<SceneComponent*>& result) const
+    {
+        query([&frustum](const math::BBox3& bounds)
+        {
+            // The bounding sphere of the box is tested: it can only give the false positives.
+            const math::Vector3 center = bounds.center();
+            const float radius = math::length(bounds.width()) * 0.5f;
+
+            // NauFrustum::testSphere: 0 - outside, 1 - inside, 2 - intersects.
+            switch (frustum.testSphere(center, math::Vector4{radius}))
+            {
+                case 0:
+                    return Overlap::Outside;
+                case 1:
+                    return Overlap::Inside;
+                default:
+                    return Overlap::Intersects;
+            }
+        }, result);
+    }
+
+    void SpatialIndex::queryRay(const math::Vector3& origin, const math::Vector3& direction, float maxDistance, Vector<SceneComponent*>& result) const
+    {
+        if (m_root == NullProxy)
+        {
+            return;
+        }
+
+        // Division by zero gives the infinities that are handled by the slab test.
+        const math::Vector3 invDirection = math::divPerElem(math::Vector3{1.f, 1.f, 1.f}, direction);
+
+        eastl::vector<eastl::pair<float, SceneComponent*>> hits;
+        NodeStack stack;
+        stack.push_back(m_root);
+
+        while (!stack.empty())
+        {
+            const Node& node = m_nodes[stack.back()];
+            stack.pop_back();
+
+            if (node.isLeaf())
+            {
+                if (const float distance = intersectRay(node.componentBounds, origin, invDirection, maxDistance); distance >= 0.f)
+                {
+                    hits.emplace_back(distance, node.component);
+                }
+            }
+            else if (intersectRay(node.bounds, origin, invDirection, maxDistance) >= 0.f)
+            {
+                stack.push_back(node.child1);
+                stack.push_back(node.child2);
+            }
+        }
+
+        eastl::sort(hits.begin(), hits.end(), [](const auto& hit1, const auto& hit2)
+        {
+            return hit1.first < hit2.first;
+        });
+
+        result.reserve(result.size() + hits.size());
+        for (const auto& [distance, component] : hits)
+        {
+            result.push_back(component);
+        }
+    }
+
+    template <typename OverlapTest>
+    void SpatialIndex::query(OverlapTest&& overlapTest, Vector<SceneComponent*>& result) const
+    {
+        if (m_root == NullProxy)
+        {
+            return;
+        }
+
+        NodeStack stack;
+        stack.push_back(m_root);
+
+        while (!stack.empty())
+        {
+            const int32_t nodeId = stack.back();
+            stack.pop_back();
+
+            const Node& node = m_nodes[nodeId];
+            const Overlap overlap = overlapTest(node.isLeaf() ? node.componentBounds : node.bounds);
+            if (overlap == Overlap::Outside)
+            {
+                continue;
+            }
+
+            if (node.isLeaf())
+            {
+                result.push_back(node.component);
+            }
+            else if (overlap == Overlap::Inside)
+            {
+                collectLeaves(nodeId, result);
+            }
+            else
+            {
+                stack.push_back(node.child1);
+                stack.push_back(node.child2);
+            }
+        }
+    }
+
+    void SpatialIndex::collectLeaves(int32_t nodeId, Vector<SceneComponent*>& result) const
+    {
+        NodeStack stack;
+        stack.push_back(nodeId);
+
+        while (!stack.empty())
+        {
+            const Node& node = m_nodes[stack.back()];
+            stack.pop_back();
+
+            if (node.isLeaf())
+            {
+                result.push_back(node.component);
+            }
+            else
+            {
+                stack.push_back(node.child1);
+                stack.push_back(node.child2);
+            }
+        }
+    }
+
+    int32_t SpatialIndex::allocateNode()
+    {
+        if (m_freeList == NullProxy)
+        {
+            m_nodes.emplace_back();
+            return static_cast<int32_t>(m_nodes.size() - 1);
+        }
+
+        const int32_t nodeId = m_freeList;
+        m_freeList = m_nodes[nodeId].parent;
+        m_nodes[nodeId] = Node{};
+
+        return nodeId;
+    }
+
+    void SpatialIndex::freeNode(int32_t nodeId)
+    {
+        Node& node = m_nodes[nodeId];
+        node.component = nullptr;
+        node.child1 = NullProxy;
+        node.child2 = NullProxy;
+        node.height = -1;
+        node.parent = m_freeList;
+        m_freeList = nodeId;
+    }
+
+    void SpatialIndex::insertLeaf(int32_t leafId)
+    {
+        if (m_root == NullProxy)
+        {
+            m_root = leafId;
+            m_nodes[leafId].parent = NullProxy;
+            return;
+        }
+
+        // Descend to the sibling that gives the smallest surface area increase of the tree.
+        const math::BBox3 leafBounds = m_nodes[leafId].bounds;
+        int32_t index = m_root;
+        while (!m_nodes[index].isLeaf())
+        {
+            const Node& node = m_nodes[index];
+
+            const float area = getSurfaceArea(node.bounds);
+            const float combinedArea = getSurfaceArea(combine(node.bounds, leafBounds));
+
+            // Cost of creating a new parent for this node and the new leaf.
+            const float cost = 2.f * combinedArea;
+
+            // Minimum cost of pushing the leaf further down the tree.
+            const float inheritanceCost = 2.f * (combinedArea - area);
+
+            const auto getDescendCost = [&](int32_t childId)
+            {
+                const Node& child = m_nodes[childId];
+                const float childCombinedArea = getSurfaceArea(combine(child.bounds, leafBounds));
+                return (child.isLeaf() ? childCombinedArea : childCombinedArea - getSurfaceArea(child.bounds)) + inheritanceCost;
+            };
+
+            const float cost1 = getDescendCost(node.child1);
+            const float cost2 = getDescendCost(node.child2);
+            if (cost < cost1 && cost < cost2)
+            {
+                break;
+            }
+
+            index = cost1 < cost2 ? node.child1 : node.child2;
+        }
+
+        const int32_t siblingId = index;
+        const int32_t oldParentId = m_nodes[siblingId].parent;
+        const int32_t newParentId = allocateNode();
+
+        Node& newParent = m_nodes[newParentId];
+        newParent.parent = oldParentId;
+        newParent.bounds = combine(leafBounds, m_nodes[siblingId].bounds);
+        newParent.height = m_nodes[siblingId].height + 1;
+        newParent.child1 = siblingId;
+        newParent.child2 = leafId;
+
+        if (oldParentId != NullProxy)
+        {
+            Node& oldParent = m_nodes[oldParentId];
+            (oldParent.child1 == siblingId ? oldParent.child1 : oldParent.child2) = newParentId;
+        }
+        else
+        {
+            m_root = newParentId;
+        }
+
+        m_nodes[siblingId].parent = newParentId;
+        m_nodes[leafId].parent = newParentId;
+
+        refitAncestors(m_nodes[leafId].parent);
+    }
+
+    void SpatialIndex::removeLeaf(int32_t leafId)
+    {
+        if (leafId == m_root)
+        {
+            m_root = NullProxy;
+            return;
+        }
+
+        const int32_t parentId = m_nodes[leafId].parent;
+        const int32_t grandParentId = m_nodes[parentId].parent;
+        const int32_t siblingId = m_nodes[parentId].child1 == leafId ? m_nodes[parentId].child2 : m_nodes[parentId].child1;
+
+        m_nodes[siblingId].parent = grandParentId;
+        freeNode(parentId);
+
+        if (grandParentId != NullProxy)
+        {
+            Node& grandParent = m_nodes[grandParentId];
+            (grandParent.child1 == parentId ? grandParent.child1 : grandParent.child2) = siblingId;
+            refitAncestors(grandParentId);
+        }
+        else
+        {
+            m_root = siblingId;
+        }
+    }
+
+    void SpatialIndex::refitAncestors(int32_t nodeId)
+    {
+        while (nodeId != NullProxy)
+        {
+            nodeId = balance(nodeId);
+
+            Node& node = m_nodes[nodeId];
+            const Node& child1 = m_nodes[node.child1];
+            const Node& child2 = m_nodes[node.child2];
+
+            node.height = 1 + eastl::max(child1.height, child2.height);
+            node.bounds = combine(child1.bounds, child2.bounds);
+
+            nodeId = node.parent;
+        }
+    }
+
+    int32_t SpatialIndex::balance(int32_t nodeIdA)
+    {
+        Node& nodeA = m_nodes[nodeIdA];
+        if (nodeA.isLeaf() || nodeA.height < 2)
+        {
+            return nodeIdA;
+        }
+
+        const int32_t nodeIdB = nodeA.child1;
+        const int32_t nodeIdC = nodeA.child2;
+        Node& nodeB = m_nodes[nodeIdB];
+        Node& nodeC = m_nodes[nodeIdC];
+
+        const int32_t heightBalance = nodeC.height - nodeB.height;
+        if (heightBalance >= -1 && heightBalance <= 1)
+        {
+            return nodeIdA;
+        }
+
+        // The higher child (up) takes the place of A, A takes the place of the lower grandchild of the up node.
+        const bool rotateC = heightBalance > 1;
+        const int32_t upId = rotateC ? nodeIdC : nodeIdB;
+        const int32_t otherId = rotateC ? nodeIdB : nodeIdC;
+        Node& up = m_nodes[upId];
+
+        const int32_t grandChildId1 = up.child1;
+        const int32_t grandChildId2 = up.child2;
+
+        up.child1 = nodeIdA;
+        up.parent = nodeA.parent;
+        nodeA.parent = upId;
+
+        if (up.parent != NullProxy)
+        {
+            Node& parent = m_nodes[up.parent];
+            (parent.child1 == nodeIdA ? parent.child1 : parent.child2) = upId;
+        }
+        else
+        {
+            m_root = upId;
+        }
+
+        // The higher grandchild stays with the up node, the lower one moves to A.
+        const bool keepFirst = m_nodes[grandChildId1].height > m_nodes[grandChildId2].height;
+        const int32_t keptId = keepFirst ? grandChildId1 : grandChildId2;
+        const int32_t movedId = keepFirst ? grandChildId2 : grandChildId1;
+
+        up.child2 = keptId;
+        (rotateC ? nodeA.child2 : nodeA.child1) = movedId;
+        m_nodes[movedId].parent = nodeIdA;
+
+        nodeA.bounds = combine(m_nodes[otherId].bounds, m_nodes[movedId].bounds);
+        nodeA.height = 1 + eastl::max(m_nodes[otherId].height, m_nodes[movedId].height);
+        up.bounds = combine(nodeA.bounds, m_nodes[keptId].bounds);
+        up.height = 1 + eastl::max(nodeA.height, m_nodes[keptId].height);
+
+        return upId;
+    }
+}  // namespace nau::scene
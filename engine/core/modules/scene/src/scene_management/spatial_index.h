@@ -0,0 +1,103 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <EASTL/vector.h>
+
+#include "nau/math/dag_bounds3.h"
+#include "nau/math/dag_frustum.h"
+#include "nau/memory/eastl_aliases.h"
+
+namespace nau::scene
+{
+    class SceneComponent;
+
+    /**
+     * Dynamic AABB tree of the active scene components of a world.
+     *
+     * Leaves keep the component bounds enlarged by a margin, so small movements do not change the tree.
+     * Inserted leaves are paired with the sibling that gives the smallest surface area increase,
+     * and the tree is kept balanced by rotations, so the queries cull whole subtrees by their bounds.
+     */
+    class SpatialIndex
+    {
+    public:
+        static constexpr int32_t NullProxy = -1;
+
+        /**
+         * @return  Proxy id of the component (stays the same until the proxy is destroyed).
+         */
+        int32_t createProxy(const math::BBox3& bounds, SceneComponent* component);
+
+        void destroyProxy(int32_t proxyId);
+
+        /**
+         * Updates the bounds of the proxy, the tree is changed only if the bounds leave the enlarged bounds of the leaf.
+         */
+        void moveProxy(int32_t proxyId, const math::BBox3& bounds);
+
+        size_t getProxyCount() const;
+
+        void queryBox(const math::BBox3& box, Vector<SceneComponent*>& result) const;
+
+        void querySphere(const math::BSphere3& sphere, Vector<SceneComponent*>& result) const;
+
+        /**
+         * The subtrees that are entirely inside the frustum are taken without testing their nodes.
+         */
+        void queryFrustum(const math::NauFrustum& frustum, Vector<SceneComponent*>& result) const;
+
+        /**
+         * @return  Components whose bounds are hit by the ray segment, ordered by the hit distance.
+         */
+        void queryRay(const math::Vector3& origin, const math::Vector3& direction, float maxDistance, Vector<SceneComponent*>& result) const;
+
+    private:
+        enum class Overlap
+        {
+            Outside,
+            Intersects,
+            Inside
+        };
+
+        struct Node
+        {
+            math::BBox3 bounds;           // enlarged for the leaves
+            math::BBox3 componentBounds;  // leaves only
+            SceneComponent* component = nullptr;
+            int32_t parent = NullProxy;  // next free node while the node is in the free list
+            int32_t child1 = NullProxy;
+            int32_t child2 = NullProxy;
+            int32_t height = 0;  // -1 while the node is in the free list
+
+            bool isLeaf() const
+            {
+                return child1 == NullProxy;
+            }
+        };
+
+        template <typename OverlapTest>
+        void query(OverlapTest&& overlapTest, Vector<SceneComponent*>& result) const;
+
+        void collectLeaves(int32_t nodeId, Vector<SceneComponent*>& result) const;
+
+        int32_t allocateNode();
+
+        void freeNode(int32_t nodeId);
+
+        void insertLeaf(int32_t leafId);
+
+        void removeLeaf(int32_t leafId);
+
+        void refitAncestors(int32_t nodeId);
+
+        int32_t balance(int32_t nodeId);
+
+        eastl::vector<Node> m_nodes;
+        int32_t m_root = NullProxy;
+        int32_t m_freeList = NullProxy;
+        size_t m_proxyCount = 0;
+    };
+}  // namespace nau::scene
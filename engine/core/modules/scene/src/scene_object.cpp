@@ -237,7 +237,7 @@ namespace nau::scene
             }
             else
             {
-                m_rootComponent->notifyTransformChanged();
+                m_rootComponent->markTransformDirty();
             }
         };
 
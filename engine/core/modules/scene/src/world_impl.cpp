@@ -37,6 +37,11 @@ namespace nau::scene
         return getSceneManager().activateScene(*this, std::move(scene));
     }
 
+    ISceneStreamingRequest::Ptr WorldImpl::streamScene(IScene::Ptr&& scene, SceneStreamingOptions options)
+    {
+        return getSceneManager().streamScene(*this, std::move(scene), options);
+    }
+
     void WorldImpl::removeScene(IScene::WeakRef sceneRef)
     {
         getSceneManager().deactivateScene(sceneRef);
@@ -51,4 +56,36 @@ namespace nau::scene
     {
         return m_isPaused;
     }
+
+    void WorldImpl::queryBox(const math::BBox3& box, Vector<SceneComponent*>& components)
+    {
+        if (const SpatialIndex* const spatialIndex = getSceneManager().getSpatialIndex(getUid()))
+        {
+            spatialIndex->queryBox(box, components);
+        }
+    }
+
+    void WorldImpl::querySphere(const math::BSphere3& sphere, Vector<SceneComponent*>& components)
+    {
+        if (const SpatialIndex* const spatialIndex = getSceneManager().getSpatialIndex(getUid()))
+        {
+            spatialIndex->querySphere(sphere, components);
+        }
+    }
+
+    void WorldImpl::queryFrustum(const math::NauFrustum& frustum, Vector<SceneComponent*>& components)
+    {
+        if (const SpatialIndex* const spatialIndex = getSceneManager().getSpatialIndex(getUid()))
+        {
+            spatialIndex->queryFrustum(frustum, components);
+        }
+    }
+
+    void WorldImpl::queryRay(const math::Vector3& origin, const math::Vector3& direction, float maxDistance, Vector<SceneComponent*>& components)
+    {
+        if (const SpatialIndex* const spatialIndex = getSceneManager().getSpatialIndex(getUid()))
+        {
+            spatialIndex->queryRay(origin, direction, maxDistance, components);
+        }
+    }
 }  // namespace nau::scene
@@ -24,12 +24,22 @@ namespace nau::scene
 
         async::Task<IScene::WeakRef> addScene(IScene::Ptr&& scene) override;
 
+        ISceneStreamingRequest::Ptr streamScene(IScene::Ptr&& scene, SceneStreamingOptions options) override;
+
         void removeScene(IScene::WeakRef sceneRef) override;
 
         void setSimulationPause(bool pause) override;
 
         bool isSimulationPaused() const override;
 
+        void queryBox(const math::BBox3& box, Vector<SceneComponent*>& components) override;
+
+        void querySphere(const math::BSphere3& sphere, Vector<SceneComponent*>& components) override;
+
+        void queryFrustum(const math::NauFrustum& frustum, Vector<SceneComponent*>& components) override;
+
+        void queryRay(const math::Vector3& origin, const math::Vector3& direction, float maxDistance, Vector<SceneComponent*>& components) override;
+
     private:
 
         class SceneManagerImpl& getSceneManager() const;
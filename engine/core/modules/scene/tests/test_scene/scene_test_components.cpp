@@ -10,6 +10,7 @@ namespace nau::scene_test
     NAU_IMPLEMENT_DYNAMIC_OBJECT(MyDisposableComponent)
     NAU_IMPLEMENT_DYNAMIC_OBJECT(MyComponentWithAsyncUpdate)
     NAU_IMPLEMENT_DYNAMIC_OBJECT(MyCustomUpdateAction)
+    NAU_IMPLEMENT_DYNAMIC_OBJECT(MyThreadSafeUpdateComponent)
 
     WithDestructor::~WithDestructor()
     {
@@ -191,6 +192,16 @@ namespace nau::scene_test
         m_asyncAction = std::move(action);
     }
 
+    void MyThreadSafeUpdateComponent::updateComponent([[maybe_unused]] float dt)
+    {
+        ++m_updateCounter;
+    }
+
+    size_t MyThreadSafeUpdateComponent::getUpdateCounter() const
+    {
+        return m_updateCounter;
+    }
+
     void registerAllTestComponentClasses()
     {
         auto& provider = getServiceProvider();
@@ -198,6 +209,7 @@ namespace nau::scene_test
         provider.addClass<MyDisposableComponent>();
         provider.addClass<MyComponentWithAsyncUpdate>();
         provider.addClass<MyCustomUpdateAction>();
+        provider.addClass<MyThreadSafeUpdateComponent>();
     }
 
 }  // namespace nau::scene_test
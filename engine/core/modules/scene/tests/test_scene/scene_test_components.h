@@ -4,6 +4,7 @@
 
 #pragma once
 #include "nau/runtime/disposable.h"
+#include "nau/scene/components/component_attributes.h"
 #include "nau/scene/components/component_life_cycle.h"
 #include "nau/scene/components/scene_component.h"
 
@@ -154,5 +155,25 @@ namespace nau::scene_test
         AsyncAction m_asyncAction;
     };
 
+    /**
+     */
+    class MyThreadSafeUpdateComponent final : public scene::SceneComponent,
+                                              public scene::IComponentUpdate
+    {
+        NAU_OBJECT(MyThreadSafeUpdateComponent, scene::SceneComponent, scene::IComponentUpdate)
+        NAU_DECLARE_DYNAMIC_OBJECT
+
+        NAU_CLASS_ATTRIBUTES(
+            CLASS_ATTRIBUTE(scene::ComponentThreadSafeUpdateAttrib, true))
+
+    public:
+        void updateComponent(float dt) override;
+
+        size_t getUpdateCounter() const;
+
+    private:
+        size_t m_updateCounter = 0;
+    };
+
     void registerAllTestComponentClasses();
 }  // namespace nau::scene_test
@@ -0,0 +1,122 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "nau/scene/components/component_life_cycle.h"
+#include "nau/scene/components/ecs_component_data.h"
+#include "scene_test_base.h"
+
+namespace nau::scene_test
+{
+    struct MyEcsCounterData
+    {
+        unsigned counter = 0;
+    };
+}  // namespace nau::scene_test
+
+ECS_DECLARE_RELOCATABLE_TYPE(nau::scene_test::MyEcsCounterData);
+ECS_REGISTER_RELOCATABLE_TYPE(nau::scene_test::MyEcsCounterData, nullptr);
+
+namespace nau::test
+{
+    namespace
+    {
+        class MyEcsComponent : public scene::SceneComponent,
+                               public scene::IComponentActivation
+        {
+            NAU_COMPONENT(test::MyEcsComponent, scene::SceneComponent, scene::IComponentActivation)
+
+        public:
+            unsigned getCounter() const
+            {
+                return m_data.get().counter;
+            }
+
+        private:
+            void activateComponent() override
+            {
+                m_data.activate(*this);
+            }
+
+            void deactivateComponent() override
+            {
+                m_data.deactivate();
+            }
+
+            scene::EcsComponentData<scene_test::MyEcsCounterData> m_data;
+        };
+
+        NAU_IMPLEMENT_COMPONENT(MyEcsComponent)
+    }  // namespace
+
+    class TestEcsComponentData : public SceneTestBase
+    {
+    protected:
+        void initializeApp() override
+        {
+            registerClasses<MyEcsComponent>();
+        }
+    };
+
+    /**
+        Test:
+            - the data of the active components is iterated by the daECS query with its components
+            - the data changed by the query is seen by the component
+            - the data of the removed and the deactivated components is not iterated
+     */
+    TEST_F(TestEcsComponentData, IterateActiveComponents)
+    {
+        using namespace testing;
+        using namespace nau::async;
+        using namespace nau::scene;
+
+        const AssertionResult testResult = runTestApp([&]() -> Task<AssertionResult>
+        {
+            constexpr size_t ObjectsCount = 3;
+
+            IScene::Ptr scene = createEmptyScene();
+            eastl::vector<ObjectWeakRef<SceneObject>> objects;
+            for (size_t i = 0; i < ObjectsCount; ++i)
+            {
+                objects.emplace_back(scene->getRoot().attachChild(createObject<MyEcsComponent>()));
+            }
+
+            ObjectWeakRef sceneRef = co_await getSceneManager().activateScene(std::move(scene));
+
+            size_t iteratedCount = 0;
+            forEachEcsComponentData<scene_test::MyEcsCounterData>([&](scene_test::MyEcsCounterData& data, Component& component)
+            {
+                ++data.counter;
+                ++iteratedCount;
+                NAU_FATAL(component.is<MyEcsComponent>());
+            });
+
+            ASSERT_ASYNC(iteratedCount == ObjectsCount);
+            ASSERT_ASYNC(objects.back()->getRootComponent<MyEcsComponent>().getCounter() == 1);
+
+            sceneRef->getRoot().removeChild(objects.front());
+            co_await skipFrames(1);
+
+            iteratedCount = 0;
+            forEachEcsComponentData<scene_test::MyEcsCounterData>([&](scene_test::MyEcsCounterData&, Component&)
+            {
+                ++iteratedCount;
+            });
+            ASSERT_ASYNC(iteratedCount == ObjectsCount - 1);
+
+            getSceneManager().deactivateScene(sceneRef);
+            co_await skipFrames(1);
+
+            iteratedCount = 0;
+            forEachEcsComponentData<scene_test::MyEcsCounterData>([&](scene_test::MyEcsCounterData&, Component&)
+            {
+                ++iteratedCount;
+            });
+            ASSERT_ASYNC(iteratedCount == 0);
+
+            co_return AssertionSuccess();
+        });
+
+        ASSERT_TRUE(testResult);
+    }
+}  // namespace nau::test
@@ -165,6 +165,35 @@ namespace nau::test
         ASSERT_TRUE(scenesEqualSimple(*scene, *sceneClone));
     }
 
+    /**
+        Test:
+            The prefab template instances are copies of the prefab with own uids.
+     */
+    TEST_F(TestSceneAsset, PrefabTemplateInstances)
+    {
+        auto scene = makeSceneWithHierarchy();
+        scene::SceneObject& prefabObject = *scene->getRoot().getDirectChildObjects().front();
+
+        SceneAsset::Ptr prefabAsset = scene::wrapSceneObjectAsAsset(prefabObject);
+        scene::IPrefabTemplate::Ptr prefabTemplate = getSceneFactory().createPrefabTemplate(*prefabAsset);
+        ASSERT_TRUE(prefabTemplate);
+
+        scene::SceneObject::Ptr instance = prefabTemplate->instantiate();
+        ASSERT_TRUE(instance);
+        ASSERT_TRUE(sceneObjectsEqualSimple(prefabObject, *instance, false));
+        ASSERT_NE(prefabObject.getUid(), instance->getUid());
+
+        const math::Transform transforms[] = {
+            math::Transform{math::Vector3{1.f, 0.f, 0.f}},
+            math::Transform{math::Vector3{2.f, 0.f, 0.f}}};
+
+        Vector<scene::SceneObject::Ptr> instances = prefabTemplate->instantiate(transforms);
+        ASSERT_EQ(instances.size(), 2);
+        ASSERT_TRUE(sceneObjectsEqualSimple(*instances[0], *instances[1], false));
+        ASSERT_NE(instances[0]->getUid(), instances[1]->getUid());
+        ASSERT_EQ(instances[1]->getTransform().getTranslation().getX(), 2.f);
+    }
+
     /**
      */
     TEST_F(TestSceneAsset, DumpSceneToStreamAndCreateCopy)
@@ -289,4 +289,58 @@ namespace nau::test
         ASSERT_TRUE(testResult);
     }
 
+    /**
+        Test:
+            - subscribe to the transform changes
+            - change the transform of an active object several times
+            - check that the changed components are listed once, with their descendants
+            - check that the unchanged components are not listed
+     */
+    TEST_F(TestSceneListener, ComponentChangesSubscription)
+    {
+        using namespace testing;
+        using namespace nau::async;
+        using namespace nau::scene;
+        using namespace nau::scene_test;
+
+        const AssertionResult testResult = runTestApp([&]() -> Task<AssertionResult>
+        {
+            IScene::Ptr scene = createEmptyScene();
+
+            ObjectWeakRef object = scene->getRoot().attachChild(createObject());
+            ObjectWeakRef child = object->attachChild(createObject());
+            ObjectWeakRef otherObject = scene->getRoot().attachChild(createObject());
+
+            co_await getSceneManager().activateScene(std::move(scene));
+            co_await skipFrames(1);
+
+            ComponentChangesSubscription subscription = getServiceProvider().get<ISceneManagerInternal>().subscribeComponentChanges(ComponentChange::Transform);
+
+            object->setTranslation({1, 0, 0});
+            object->setTranslation({2, 0, 0});
+            co_await skipFrames(1);
+
+            eastl::vector<Uid> changedComponents;
+            subscription.takeChanges(changedComponents);
+
+            const auto isChanged = [&changedComponents](const SceneObject& changedObject)
+            {
+                return eastl::count(changedComponents.begin(), changedComponents.end(), changedObject.getRootComponent().getUid());
+            };
+
+            ASSERT_ASYNC(changedComponents.size() == 2);
+            ASSERT_ASYNC(isChanged(*object) == 1);
+            ASSERT_ASYNC(isChanged(*child) == 1);
+            ASSERT_ASYNC(isChanged(*otherObject) == 0);
+
+            changedComponents.clear();
+            subscription.takeChanges(changedComponents);
+            ASSERT_ASYNC(changedComponents.empty());
+
+            co_return AssertionSuccess();
+        });
+
+        ASSERT_TRUE(testResult);
+    }
+
 }  // namespace nau::test
@@ -59,6 +59,7 @@ namespace nau::test
         scene::SceneQuery query;
         query.category = scene::QueryObjectCategory::Component;
         query.uid = Uid::generate();
+        query.worldUid = Uid::generate();
         query.setType<MyComponent1>();
 
         std::string queryStr = toString(query);
@@ -184,6 +185,166 @@ namespace nau::test
         ASSERT_TRUE(testResult);
     }
 
+    /**
+        Test: query single component only by its type
+     */
+    TEST_F(TestSceneQuery, QuerySingleComponentByType)
+    {
+        using namespace testing;
+        using namespace nau::async;
+        using namespace nau::scene;
+
+        const AssertionResult testResult = runTestApp([&]() -> Task<AssertionResult>
+        {
+            IScene::Ptr scene = createEmptyScene();
+            auto& child = scene->getRoot().attachChild(createObject<MyComponent2>());
+
+            co_await getSceneManager().activateScene(std::move(scene));
+
+            SceneQuery query;
+            query.category = QueryObjectCategory::Component;
+            query.setType<MyComponent2>();
+
+            ObjectWeakRef<> componentRef = getSceneManager().querySingleObject(query);
+            ASSERT_ASYNC(componentRef);
+            ASSERT_ASYNC(componentRef.get() == child.getRootComponent().as<NauObject*>());
+
+            co_return AssertionSuccess();
+        });
+
+        ASSERT_TRUE(testResult);
+    }
+
+    /**
+        Test: query all active components of a type, the result follows the activation and the deactivation
+     */
+    TEST_F(TestSceneQuery, QueryComponentsByType)
+    {
+        using namespace testing;
+        using namespace nau::async;
+        using namespace nau::scene;
+
+        const AssertionResult testResult = runTestApp([&]() -> Task<AssertionResult>
+        {
+            IScene::Ptr scene = createEmptyScene();
+            ObjectWeakRef child1 = scene->getRoot().attachChild(createObject<MyComponent1>());
+            ObjectWeakRef child2 = scene->getRoot().attachChild(createObject<MyComponent1>());
+            ObjectWeakRef child3 = scene->getRoot().attachChild(createObject<MyComponent1>());
+            scene->getRoot().attachChild(createObject<MyComponent2>());
+
+            ObjectWeakRef sceneRef = co_await getSceneManager().activateScene(std::move(scene));
+
+            SceneQuery query;
+            query.setType<MyComponent1>();
+
+            {
+                const eastl::span<Component* const> components = getSceneManager().queryComponents(query);
+                ASSERT_ASYNC(components.size() == 3);
+                for (const Component* component : components)
+                {
+                    ASSERT_ASYNC(component->is<MyComponent1>());
+                }
+            }
+
+            const Uid child3ComponentUid = child3->getRootComponent().getUid();
+            sceneRef->getRoot().removeChild(child1);
+            co_await skipFrames(1);
+
+            {
+                // the last component is moved to the place of the removed one
+                const eastl::span<Component* const> components = getSceneManager().queryComponents(query);
+                ASSERT_ASYNC(components.size() == 2);
+                ASSERT_ASYNC(components[0]->getUid() == child3ComponentUid);
+                ASSERT_ASYNC(components[1] == &child2->getRootComponent());
+            }
+
+            co_return AssertionSuccess();
+        });
+
+        ASSERT_TRUE(testResult);
+    }
+
+    /**
+        Test: components query is restricted to the requested world
+     */
+    TEST_F(TestSceneQuery, QueryComponentsByWorld)
+    {
+        using namespace testing;
+        using namespace nau::async;
+        using namespace nau::scene;
+
+        const AssertionResult testResult = runTestApp([&]() -> Task<AssertionResult>
+        {
+            IScene::Ptr scene = createEmptyScene();
+            scene->getRoot().attachChild(createObject<MyComponent1>());
+            co_await getSceneManager().activateScene(std::move(scene));
+
+            ObjectWeakRef newWorld = getSceneManager().createWorld();
+            ObjectWeakRef sceneRef = co_await newWorld->addScene(createEmptyScene());
+            ObjectWeakRef objectRef = co_await sceneRef->getRoot().attachChildAsync(createObject<MyComponent1>());
+
+            SceneQuery query;
+            query.setType<MyComponent1>();
+            query.worldUid = newWorld->getUid();
+
+            const eastl::span<Component* const> components = getSceneManager().queryComponents(query);
+            ASSERT_ASYNC(components.size() == 1);
+            ASSERT_ASYNC(components.front() == &objectRef->getRootComponent());
+
+            query.worldUid = getSceneManager().getDefaultWorld().getUid();
+            ASSERT_ASYNC(getSceneManager().queryComponents(query).size() == 1);
+            ASSERT_ASYNC(getSceneManager().queryComponents(query).front() != &objectRef->getRootComponent());
+
+            co_return AssertionSuccess();
+        });
+
+        ASSERT_TRUE(testResult);
+    }
+
+    /**
+        Test: the world spatial index follows the activation and the transforms of the scene components
+    */
+    TEST_F(TestSceneQuery, QueryComponentsBySphere)
+    {
+        using namespace testing;
+        using namespace nau::async;
+        using namespace nau::scene;
+
+        const AssertionResult testResult = runTestApp([&]() -> Task<AssertionResult>
+        {
+            IScene::Ptr scene = createEmptyScene();
+            SceneObject& object1 = scene->getRoot().attachChild(createObject<MyComponent1>());
+            SceneObject& object2 = scene->getRoot().attachChild(createObject<MyComponent2>());
+            object1.setTranslation({10.f, 0.f, 0.f});
+            object2.setTranslation({100.f, 0.f, 0.f});
+            co_await getSceneManager().activateScene(std::move(scene));
+
+            IWorld& world = getSceneManager().getDefaultWorld();
+
+            Vector<SceneComponent*> components;
+            world.querySphere(math::BSphere3{math::Vector3{10.f, 0.f, 0.f}, 1.f}, components);
+            ASSERT_ASYNC(components.size() == 1);
+            ASSERT_ASYNC(components.front() == &object1.getRootComponent());
+
+            components.clear();
+            world.queryRay(math::Vector3{1.f, 0.f, 0.f}, math::Vector3{1.f, 0.f, 0.f}, 200.f, components);
+            ASSERT_ASYNC(components.size() == 2);
+            ASSERT_ASYNC(components[0] == &object1.getRootComponent());
+            ASSERT_ASYNC(components[1] == &object2.getRootComponent());
+
+            object1.setTranslation({100.f, 0.f, 0.f});
+            co_await skipFrames(1);
+
+            components.clear();
+            world.queryBox(math::BBox3{math::Vector3{99.f, -1.f, -1.f}, math::Vector3{101.f, 1.f, 1.f}}, components);
+            ASSERT_ASYNC(components.size() == 2);
+
+            co_return AssertionSuccess();
+        });
+
+        ASSERT_TRUE(testResult);
+    }
+
     /**
         Test: query single object by uid
     */
@@ -0,0 +1,107 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "nau/scene/scene_streaming.h"
+#include "scene_test_base.h"
+#include "scene_test_components.h"
+
+namespace nau::test
+{
+    class TestSceneStreaming : public SceneTestBase
+    {
+    protected:
+        static scene::SceneObject::Ptr createCell(unsigned childCount)
+        {
+            scene::SceneObject::Ptr cell = createObject();
+            for (unsigned i = 0; i < childCount; ++i)
+            {
+                cell->attachChild(createObject()).attachChild(createObject());
+            }
+
+            return cell;
+        }
+    };
+
+    /**
+        Test:
+            With a zero budget a single object is attached per frame,
+            the scene gets its whole hierarchy once the request is completed.
+     */
+    TEST_F(TestSceneStreaming, StreamScene)
+    {
+        using namespace testing;
+        using namespace nau::async;
+        using namespace nau::scene;
+
+        const AssertionResult testResult = runTestApp([&]() -> Task<AssertionResult>
+        {
+            getSceneManager().setStreamingFrameBudget(std::chrono::microseconds{0});
+
+            IScene::Ptr scene = createEmptyScene();
+            scene->getRoot().attachChild(createCell(2));
+            ObjectWeakRef root = scene->getRoot();
+
+            ISceneStreamingRequest::Ptr request = getSceneManager().streamScene(std::move(scene));
+            ASSERT_ASYNC(request);
+            ASSERT_ASYNC(root->getAllChildObjects().empty());
+
+            co_await skipFrames(2);
+            ASSERT_ASYNC(!request->isCompleted());
+            ASSERT_ASYNC(request->getProgress() < 1.f);
+
+            co_await request->waitForCompletion();
+
+            ASSERT_ASYNC(request->getProgress() == 1.f);
+            const Vector<SceneObject*> objects = root->getAllChildObjects();
+            ASSERT_ASYNC(objects.size() == 5);
+            for (const SceneObject* object : objects)
+            {
+                ASSERT_ASYNC(object->getActivationState() == ActivationState::Active);
+            }
+
+            co_return AssertionSuccess();
+        });
+
+        ASSERT_TRUE(testResult);
+    }
+
+    /**
+        Test:
+            Cells are attached to an active scene independently, the canceled cell keeps only its attached objects
+     */
+    TEST_F(TestSceneStreaming, StreamCells)
+    {
+        using namespace testing;
+        using namespace nau::async;
+        using namespace nau::scene;
+
+        const AssertionResult testResult = runTestApp([&]() -> Task<AssertionResult>
+        {
+            getSceneManager().setStreamingFrameBudget(std::chrono::microseconds{0});
+
+            IScene::WeakRef sceneRef = co_await getSceneManager().activateScene(createEmptyScene());
+            SceneObject& root = sceneRef->getRoot();
+
+            ISceneStreamingRequest::Ptr request1 = getSceneManager().streamSceneObject(root, createCell(4));
+            ISceneStreamingRequest::Ptr request2 = getSceneManager().streamSceneObject(root, createCell(4), {.priority = 1});
+
+            // The higher priority cell is attached first.
+            co_await skipFrames(1);
+            ASSERT_ASYNC(request2->getProgress() > 0.f);
+            ASSERT_ASYNC(request1->getProgress() == 0.f);
+
+            request2->cancel();
+            co_await request2->waitForCompletion();
+            co_await request1->waitForCompletion();
+
+            ASSERT_ASYNC(request2->isCompleted());
+            ASSERT_ASYNC(root.getDirectChildObjects().size() == 2);
+            ASSERT_ASYNC(root.getAllChildObjects().size() < 20);
+
+            co_return AssertionSuccess();
+        });
+
+        ASSERT_TRUE(testResult);
+    }
+}  // namespace nau::test
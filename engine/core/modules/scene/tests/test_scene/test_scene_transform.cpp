@@ -250,4 +250,50 @@ namespace nau::test
         ASSERT_FALSE(child2->getWorldTransform().similar(child2InitialWorldTransform));
     }
 
+    /**
+        Test:
+            - transform of the root of an active hierarchy is changed several times within a frame
+            - check that the world transforms of the descendants are up to date at once
+            - check that the descendants are notified once, by the batched transform update
+     */
+    TEST_F(TestSceneTransform, ActiveHierarchyBatchedNotification)
+    {
+        using namespace testing;
+        using namespace nau::async;
+        using namespace nau::math;
+        using namespace nau::scene;
+
+        const AssertionResult testResult = runTestApp([&]() -> Task<AssertionResult>
+        {
+            IScene::Ptr scene = createEmptyScene();
+            auto& object = scene->getRoot().attachChild(createObject());
+            auto& child1 = object.attachChild(createObject());
+            auto& child2 = child1.attachChild(createObject());
+            child2.setTranslation({0, 2, 0});
+
+            co_await getSceneManager().activateScene(std::move(scene));
+            co_await skipFrames(1);
+
+            size_t changesCounter = 0;
+            auto subscription = child2.getRootComponent().subscribeOnChanges([&changesCounter](const RuntimeValue&, std::string_view)
+            {
+                ++changesCounter;
+            });
+
+            object.setTranslation({10, 0, 0});
+            object.setRotation(quat::rotationY(1.f));
+            object.setTranslation({10, 10, 0});
+
+            ASSERT_ASYNC(child2.getWorldTransform().similar(object.getWorldTransform() * child2.getTransform()));
+            ASSERT_ASYNC(changesCounter == 0);
+
+            co_await skipFrames(1);
+            ASSERT_ASYNC(changesCounter == 1);
+
+            co_return AssertionSuccess();
+        });
+
+        ASSERT_TRUE(testResult);
+    }
+
 }  // namespace nau::test
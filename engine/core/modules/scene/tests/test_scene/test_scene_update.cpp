@@ -354,4 +354,74 @@ namespace nau::test
         ASSERT_TRUE(testResult);
     }
 
+    /**
+        Test:
+            - components of a thread safe update type are activated
+            - wait some frames
+            - check that each component is updated once per frame
+     */
+    TEST_F(TestSceneUpdate, ThreadSafeComponentUpdate)
+    {
+        using namespace testing;
+        using namespace nau::async;
+        using namespace nau::scene;
+
+        const AssertionResult testResult = runTestApp([&]() -> Task<AssertionResult>
+        {
+            constexpr unsigned FrameCount = 2;
+            constexpr size_t ObjectCount = 64;
+
+            IScene::Ptr scene = createEmptyScene();
+            for (size_t i = 0; i < ObjectCount; ++i)
+            {
+                scene->getRoot().attachChild(createObject<scene_test::MyThreadSafeUpdateComponent>());
+            }
+
+            ObjectWeakRef sceneRef = co_await getSceneManager().activateScene(std::move(scene));
+            co_await skipFrames(FrameCount);
+
+            for (SceneObject* const child : sceneRef->getRoot().getDirectChildObjects())
+            {
+                ASSERT_ASYNC(child->getRootComponent<scene_test::MyThreadSafeUpdateComponent>().getUpdateCounter() == FrameCount);
+            }
+
+            co_return AssertionSuccess();
+        });
+
+        ASSERT_TRUE(testResult);
+    }
+
+    /**
+        Test:
+            - the world simulation is paused
+            - check that the components of the world are not updated
+     */
+    TEST_F(TestSceneUpdate, PausedWorldIsNotUpdated)
+    {
+        using namespace testing;
+        using namespace nau::async;
+        using namespace nau::scene;
+
+        const AssertionResult testResult = runTestApp([&]() -> Task<AssertionResult>
+        {
+            IScene::Ptr scene = createEmptyScene();
+            auto& child = scene->getRoot().attachChild(createObject<scene_test::MyDefaultSceneComponent>());
+
+            getSceneManager().getDefaultWorld().setSimulationPause(true);
+            co_await getSceneManager().activateScene(std::move(scene));
+            co_await skipFrames(2);
+
+            auto& component = child.getRootComponent<scene_test::MyDefaultSceneComponent>();
+            ASSERT_ASYNC(component.getUpdateCounter() == 0);
+
+            getSceneManager().getDefaultWorld().setSimulationPause(false);
+            co_await skipFrames(1);
+            ASSERT_ASYNC(component.getUpdateCounter() == 1);
+
+            co_return AssertionSuccess();
+        });
+
+        ASSERT_TRUE(testResult);
+    }
+
 }  // namespace nau::test
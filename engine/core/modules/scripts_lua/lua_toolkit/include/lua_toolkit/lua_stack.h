@@ -0,0 +1,160 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+// lua_toolkit/lua_stack.h
+
+
+#pragma once
+
+#include <EASTL/string.h>
+#include <EASTL/string_view.h>
+
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "lua_toolkit/lua_headers.h"
+#include "nau/math/math.h"
+#include "nau/utils/result.h"
+
+/**
+ * Direct (typed) access to the Lua stack values.
+ * Unlike the RuntimeValue marshaling (lua_interop.h) the values are not boxed: nothing is allocated for the primitives.
+ * The math vectors are represented the same way as with the RuntimeValue marshaling: the array tables {x, y, z, w}.
+ */
+namespace nau::lua
+{
+    template <typename T>
+    inline constexpr int StackVectorSize = 0;
+
+    template <>
+    inline constexpr int StackVectorSize<math::vec2> = 2;
+
+    template <>
+    inline constexpr int StackVectorSize<math::vec3> = 3;
+
+    template <>
+    inline constexpr int StackVectorSize<math::vec4> = 4;
+
+    template <>
+    inline constexpr int StackVectorSize<math::quat> = 4;
+
+    template <typename T>
+    concept StackPrimitive = std::is_arithmetic_v<T> || std::is_enum_v<T> || std::is_convertible_v<const T&, std::string_view> ||
+                             std::is_convertible_v<const T&, eastl::string_view>;
+
+    template <typename T>
+    concept StackVector = StackVectorSize<T> > 0;
+
+    template <typename T>
+    requires StackPrimitive<T> || StackVector<T>
+    void push(lua_State* l, const T& value)
+    {
+        if constexpr (std::is_same_v<T, bool>)
+        {
+            lua_pushboolean(l, value ? 1 : 0);
+        }
+        else if constexpr (std::is_enum_v<T> || std::is_integral_v<T>)
+        {
+            lua_pushinteger(l, static_cast<lua_Integer>(value));
+        }
+        else if constexpr (std::is_floating_point_v<T>)
+        {
+            lua_pushnumber(l, static_cast<lua_Number>(value));
+        }
+        else if constexpr (std::is_convertible_v<const T&, std::string_view>)
+        {
+            const std::string_view str{value};
+            lua_pushlstring(l, str.data(), str.size());
+        }
+        else if constexpr (std::is_convertible_v<const T&, eastl::string_view>)
+        {
+            const eastl::string_view str{value};
+            lua_pushlstring(l, str.data(), str.size());
+        }
+        else
+        {
+            constexpr int Size = StackVectorSize<T>;
+            lua_createtable(l, Size, 0);
+            for (int i = 0; i < Size; ++i)
+            {
+                lua_pushnumber(l, static_cast<lua_Number>(static_cast<float>(value.getElem(i))));
+                lua_rawseti(l, -2, i + 1);
+            }
+        }
+    }
+
+    /**
+     * Reads the value at the stack index (the value is kept on the stack).
+     * The string views (std::string_view, eastl::string_view) reference the Lua string: they are valid while the string is on the stack.
+     */
+    template <typename T>
+    requires StackPrimitive<T> || StackVector<T>
+    Result<> get(lua_State* l, int index, T& value)
+    {
+        if constexpr (std::is_same_v<T, bool>)
+        {
+            value = lua_toboolean(l, index) != 0;
+        }
+        else if constexpr (std::is_enum_v<T> || std::is_integral_v<T>)
+        {
+            int isInteger = 0;
+            const lua_Integer i = lua_tointegerx(l, index, &isInteger);
+            if (!isInteger)
+            {
+                return NauMakeError("Integer expected, got ({})", luaL_typename(l, index));
+            }
+            value = static_cast<T>(i);
+        }
+        else if constexpr (std::is_floating_point_v<T>)
+        {
+            int isNumber = 0;
+            const lua_Number n = lua_tonumberx(l, index, &isNumber);
+            if (!isNumber)
+            {
+                return NauMakeError("Number expected, got ({})", luaL_typename(l, index));
+            }
+            value = static_cast<T>(n);
+        }
+        else if constexpr (StackVector<T>)
+        {
+            if (lua_type(l, index) != LUA_TTABLE)
+            {
+                return NauMakeError("Table expected, got ({})", luaL_typename(l, index));
+            }
+
+            constexpr int Size = StackVectorSize<T>;
+            const int tableIndex = lua_absindex(l, index);
+            for (int i = 0; i < Size; ++i)
+            {
+                lua_rawgeti(l, tableIndex, i + 1);
+            }
+
+            for (int i = 0; i < Size; ++i)
+            {
+                int isNumber = 0;
+                const lua_Number n = lua_tonumberx(l, i - Size, &isNumber);
+                if (!isNumber)
+                {
+                    lua_pop(l, Size);
+                    return NauMakeError("Vector element ({}) is not a number", i);
+                }
+                value.setElem(i, static_cast<float>(n));
+            }
+
+            lua_pop(l, Size);
+        }
+        else
+        {
+            if (lua_type(l, index) != LUA_TSTRING)
+            {
+                return NauMakeError("String expected, got ({})", luaL_typename(l, index));
+            }
+
+            size_t len = 0;
+            const char* const str = lua_tolstring(l, index, &len);
+            value = T{str, len};
+        }
+
+        return ResultSuccess;
+    }
+}  // namespace nau::lua
@@ -4,6 +4,8 @@
 
 
 #pragma once
+#include <EASTL/vector.h>
+
 #include <string_view>
 
 #include "lua_toolkit/lua_headers.h"
@@ -28,6 +30,19 @@ namespace nau::lua
     NAU_LUATOOLKIT_EXPORT
     Result<> loadBuffer(lua_State* l, std::string_view buffer, const char* chunkName);
 
+    /**
+     * Serializes the Lua function at the given stack index to the binary chunk (the function is kept on the stack).
+     * The stripped chunk has no debug information: smaller and faster to load, but the errors are reported without the line numbers.
+     */
+    NAU_LUATOOLKIT_EXPORT
+    Result<eastl::vector<std::byte>> dumpFunction(lua_State* l, int index, bool stripDebugInfo);
+
+    /**
+     * Compiles the Lua source to the binary chunk (that can be loaded with the "b" mode) without executing it.
+     */
+    NAU_LUATOOLKIT_EXPORT
+    Result<eastl::vector<std::byte>> compileBuffer(lua_State* l, std::string_view source, const char* chunkName, bool stripDebugInfo);
+
     NAU_LUATOOLKIT_EXPORT
     int getAbsoluteStackPos(lua_State* l, int index);
 
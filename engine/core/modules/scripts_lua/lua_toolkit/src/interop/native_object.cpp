@@ -74,21 +74,55 @@ namespace nau::lua_detail
         IRttiObject* const object = nativeObjWrapper->getObject();
         NAU_ASSERT(object);
 
-        DispatchArguments arguments;
+        // The primitives are passed to the method unboxed (the strings reference the Lua stack during the call),
+        // only the tables and the other objects are wrapped into RuntimeValue
+        DispatchArgumentsPack arguments;
 
         constexpr int FirstArgStackIndex = 2;
         for(int i = FirstArgStackIndex, luaTop = lua_gettop(l); i <= luaTop; ++i)
         {
-            arguments.emplace_back(lua::makeValueFromLuaStack(l, i));
+            switch(lua_type(l, i))
+            {
+                case LUA_TNIL:
+                    arguments.emplace_back();
+                    break;
+                case LUA_TBOOLEAN:
+                    arguments.emplace_back(lua_toboolean(l, i) != 0);
+                    break;
+                case LUA_TNUMBER:
+                    if(lua_isinteger(l, i))
+                    {
+                        arguments.emplace_back(static_cast<int64_t>(lua_tointeger(l, i)));
+                    }
+                    else
+                    {
+                        arguments.emplace_back(static_cast<double>(lua_tonumber(l, i)));
+                    }
+                    break;
+                case LUA_TSTRING:
+                {
+                    size_t len = 0;
+                    const char* const str = lua_tolstring(l, i, &len);
+                    arguments.emplace_back(eastl::string_view{str, len});
+                    break;
+                }
+                default:
+                    arguments.emplace_back(lua::makeValueFromLuaStack(l, i));
+            }
         }
 
         const auto methodUpvalueIndex = lua_upvalueindex(1);
         NAU_ASSERT(lua_type(l, methodUpvalueIndex) == LUA_TLIGHTUSERDATA);
         const IMethodInfo* const method = reinterpret_cast<IMethodInfo*>(lua_touserdata(l, methodUpvalueIndex));
 
-        auto result = method->invokeToPtr(object, std::move(arguments));
+        Result<nau::Ptr<>> result = method->invokeUnboxedToPtr(object, arguments);
+        if(!result)
+        {
+            NAU_LOG_ERROR("Native method ({}) invocation error: {}", method->getName(), result.getError()->getMessage());
+            return 0;
+        }
 
-        if(nau::Ptr<> resultValue = result)
+        if(nau::Ptr<> resultValue = *result)
         {
             if (!lua::pushRuntimeValue(l, resultValue))
             { // TODO: make an error
@@ -64,6 +64,61 @@ namespace nau::lua
         return NauMakeError(eastl::string{message, len});
     }
 
+    Result<eastl::vector<std::byte>> dumpFunction(lua_State* l, int index, bool stripDebugInfo)
+    {
+        NAU_ASSERT(l);
+
+        if(!l || lua_type(l, index) != LUA_TFUNCTION)
+        {
+            return NauMakeError("Invalid argument");
+        }
+
+        auto writer = [](lua_State*, const void* data, size_t size, void* userData) noexcept -> int
+        {
+            auto& chunk = *reinterpret_cast<eastl::vector<std::byte>*>(userData);
+            const auto* const bytes = reinterpret_cast<const std::byte*>(data);
+            chunk.insert(chunk.end(), bytes, bytes + size);
+            return 0;
+        };
+
+        // lua_dump takes the function from the top of the stack
+        lua_pushvalue(l, index);
+        scope_on_leave
+        {
+            lua_pop(l, 1);
+        };
+
+        eastl::vector<std::byte> chunk;
+        if(lua_dump(l, writer, &chunk, stripDebugInfo ? 1 : 0) != 0 || chunk.empty())
+        {
+            return NauMakeError("Fail to dump the function");
+        }
+
+        return chunk;
+    }
+
+    Result<eastl::vector<std::byte>> compileBuffer(lua_State* l, std::string_view source, const char* chunkName, bool stripDebugInfo)
+    {
+        NAU_ASSERT(l);
+
+        if(!l)
+        {
+            return NauMakeError("Invalid argument");
+        }
+
+        const StackGuard stackGuard{l};
+
+        // only the source is accepted: the binary chunk is not recompiled
+        if(luaL_loadbufferx(l, source.data(), source.size(), chunkName, "t") != 0)
+        {
+            size_t len;
+            const char* const message = lua_tolstring(l, -1, &len);
+            return NauMakeError(eastl::string{message, len});
+        }
+
+        return dumpFunction(l, -1, stripDebugInfo);
+    }
+
     int getAbsoluteStackPos(lua_State* l, int index)
     {
         NAU_ASSERT(index != 0);
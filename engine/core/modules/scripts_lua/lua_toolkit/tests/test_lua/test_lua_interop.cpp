@@ -4,6 +4,7 @@
 
 #include "lua_toolkit/lua_headers.h"
 #include "lua_toolkit/lua_interop.h"
+#include "lua_toolkit/lua_stack.h"
 #include "lua_toolkit/lua_utils.h"
 #include "nau/dispatch/class_descriptor_builder.h"
 #include "nau/meta/common_attributes.h"
@@ -193,4 +194,68 @@ namespace nau::test
 
     }
 
+    TEST_F(TestLuaInterop, CompiledChunk)
+    {
+        const char* script = R"--(
+            function testMain()
+                return 7 * 6
+            end
+        )--";
+
+        auto chunk = lua::compileBuffer(getLua(), script, "compiled_chunk", true);
+        ASSERT_TRUE(chunk);
+        ASSERT_EQ(lua_gettop(getLua()), 0);
+
+        // the text mode does not accept the binary chunk
+        ASSERT_NE(luaL_loadbufferx(getLua(), reinterpret_cast<const char*>(chunk->data()), chunk->size(), "compiled_chunk", "t"), 0);
+        lua_pop(getLua(), 1);
+
+        ASSERT_EQ(luaL_loadbufferx(getLua(), reinterpret_cast<const char*>(chunk->data()), chunk->size(), "compiled_chunk", "b"), 0);
+        ASSERT_EQ(lua_pcall(getLua(), 0, 0, 0), 0);
+        call("testMain");
+
+        ASSERT_EQ(*lua::cast<int>(getLua(), -1), 42);
+    }
+
+    TEST_F(TestLuaInterop, TypedStackValues)
+    {
+        const char* script = R"--(
+            function testMain(i, f, str, vec)
+                return i == 77 and f == 1.5 and str == 'lua_text' and vec[1] == 1 and vec[2] == 2 and vec[3] == 3
+            end
+
+            function scaleVec(vec, scale)
+                return {vec[1] * scale, vec[2] * scale, vec[3] * scale}
+            end
+        )--";
+
+        load(script);
+
+        lua_getglobal(getLua(), "testMain");
+        lua::push(getLua(), 77);
+        lua::push(getLua(), 1.5f);
+        lua::push(getLua(), std::string_view{"lua_text"});
+        lua::push(getLua(), math::vec3{1.f, 2.f, 3.f});
+        ASSERT_EQ(lua_pcall(getLua(), 4, 1, 0), 0);
+
+        bool testResult = false;
+        ASSERT_TRUE(lua::get(getLua(), -1, testResult));
+        ASSERT_TRUE(testResult);
+        lua_pop(getLua(), 1);
+
+        lua_getglobal(getLua(), "scaleVec");
+        lua::push(getLua(), math::vec3{1.f, 2.f, 3.f});
+        lua::push(getLua(), 2);
+        ASSERT_EQ(lua_pcall(getLua(), 2, 1, 0), 0);
+
+        math::vec3 vec;
+        ASSERT_TRUE(lua::get(getLua(), -1, vec));
+        ASSERT_EQ(vec.getX(), 2.f);
+        ASSERT_EQ(vec.getY(), 4.f);
+        ASSERT_EQ(vec.getZ(), 6.f);
+
+        float notNumber = 0.f;
+        ASSERT_FALSE(lua::get(getLua(), -1, notNumber));
+    }
+
 }  // namespace nau::test
@@ -0,0 +1,173 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "lua_allocator.h"
+
+#include "nau/memory/mem_allocator.h"
+#include "nau/memory/memory_stats.h"
+
+namespace nau::scripts
+{
+    LuaAllocator::LuaAllocator() = default;
+
+    LuaAllocator::~LuaAllocator()
+    {
+        // the state is closed: all the blocks are already freed
+        for (void* const page : m_pages)
+        {
+            getDefaultAllocator()->deallocate(page);
+            memory_detail::onMemoryFreed(MemoryTag::Scripts, PageSize);
+        }
+    }
+
+    void* LuaAllocator::luaAlloc(void* userData, void* ptr, size_t oldSize, size_t newSize) noexcept
+    {
+        return reinterpret_cast<LuaAllocator*>(userData)->reallocate(ptr, oldSize, newSize);
+    }
+
+    void LuaAllocator::setMemoryLimit(size_t limit)
+    {
+        m_memoryLimit = limit;
+    }
+
+    ScriptMemoryStatistics LuaAllocator::getStatistics() const
+    {
+        return {
+            .usedBytes = m_usedBytes,
+            .peakBytes = m_peakBytes,
+            .pooledBytes = m_pages.size() * PageSize,
+            .memoryLimit = m_memoryLimit};
+    }
+
+    size_t LuaAllocator::getSizeClassIndex(size_t size)
+    {
+        for (size_t i = 0; i < SizeClasses.size(); ++i)
+        {
+            if (size <= SizeClasses[i])
+            {
+                return i;
+            }
+        }
+
+        return SizeClasses.size();
+    }
+
+    void* LuaAllocator::reallocate(void* ptr, size_t oldSize, size_t newSize)
+    {
+        // Lua passes the object type instead of the size for the new blocks
+        if (!ptr)
+        {
+            oldSize = 0;
+        }
+
+        if (newSize == 0)
+        {
+            if (ptr)
+            {
+                freeBlock(ptr, oldSize);
+                m_usedBytes -= oldSize;
+            }
+            return nullptr;
+        }
+
+        // only the growth can fail: Lua expects the shrinking to always succeed
+        if (m_memoryLimit != 0 && newSize > oldSize && m_usedBytes - oldSize + newSize > m_memoryLimit)
+        {
+            return nullptr;
+        }
+
+        void* newPtr = nullptr;
+
+        const size_t oldClass = ptr ? getSizeClassIndex(oldSize) : SizeClasses.size();
+        const size_t newClass = getSizeClassIndex(newSize);
+
+        if (ptr && oldClass == newClass && newClass < SizeClasses.size())
+        {
+            newPtr = ptr;
+        }
+        else if (ptr && oldClass == SizeClasses.size() && newClass == SizeClasses.size())
+        {
+            newPtr = getDefaultAllocator()->reallocate(ptr, newSize);
+            if (newPtr)
+            {
+                memory_detail::onMemoryFreed(MemoryTag::Scripts, oldSize);
+                memory_detail::onMemoryAllocated(MemoryTag::Scripts, newSize);
+            }
+        }
+        else
+        {
+            newPtr = allocateBlock(newSize);
+            if (newPtr && ptr)
+            {
+                memcpy(newPtr, ptr, eastl::min(oldSize, newSize));
+                freeBlock(ptr, oldSize);
+            }
+        }
+
+        if (!newPtr)
+        {
+            return nullptr;
+        }
+
+        m_usedBytes = m_usedBytes - oldSize + newSize;
+        m_peakBytes = eastl::max(m_peakBytes, m_usedBytes);
+
+        return newPtr;
+    }
+
+    void* LuaAllocator::allocateBlock(size_t size)
+    {
+        const size_t classIndex = getSizeClassIndex(size);
+        // The memory of the lua state is always charged to the scripts memory tag (whatever the thread tag is).
+        if (classIndex == SizeClasses.size())
+        {
+            void* const block = getDefaultAllocator()->allocate(size);
+            if (block)
+            {
+                memory_detail::onMemoryAllocated(MemoryTag::Scripts, size);
+            }
+            return block;
+        }
+
+        if (!m_freeBlocks[classIndex])
+        {
+            std::byte* const page = reinterpret_cast<std::byte*>(getDefaultAllocator()->allocate(PageSize));
+            if (!page)
+            {
+                return nullptr;
+            }
+
+            m_pages.push_back(page);
+            memory_detail::onMemoryAllocated(MemoryTag::Scripts, PageSize);
+
+            // the page is split into the blocks of the single size class
+            const size_t blockSize = SizeClasses[classIndex];
+            for (size_t offset = PageSize - PageSize % blockSize; offset >= blockSize; offset -= blockSize)
+            {
+                auto* const block = reinterpret_cast<FreeBlock*>(page + offset - blockSize);
+                block->next = m_freeBlocks[classIndex];
+                m_freeBlocks[classIndex] = block;
+            }
+        }
+
+        FreeBlock* const block = m_freeBlocks[classIndex];
+        m_freeBlocks[classIndex] = block->next;
+        return block;
+    }
+
+    void LuaAllocator::freeBlock(void* ptr, size_t size)
+    {
+        const size_t classIndex = getSizeClassIndex(size);
+        if (classIndex == SizeClasses.size())
+        {
+            getDefaultAllocator()->deallocate(ptr);
+            memory_detail::onMemoryFreed(MemoryTag::Scripts, size);
+            return;
+        }
+
+        auto* const block = reinterpret_cast<FreeBlock*>(ptr);
+        block->next = m_freeBlocks[classIndex];
+        m_freeBlocks[classIndex] = block;
+    }
+}  // namespace nau::scripts
@@ -0,0 +1,67 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <EASTL/array.h>
+#include <EASTL/vector.h>
+
+#include "nau/scripts/script_manager.h"
+
+namespace nau::scripts
+{
+    /**
+     * Memory allocator of the single lua_State (lua_Alloc).
+     *
+     * The small blocks (most of the Lua objects: strings, tables, closures, upvalues) are taken from the size class pools,
+     * the pool pages are kept until the allocator is destroyed. The larger blocks are allocated with the engine default allocator.
+     * The allocator is not thread safe: the Lua state is never accessed concurrently.
+     */
+    class LuaAllocator
+    {
+    public:
+        LuaAllocator();
+        ~LuaAllocator();
+
+        LuaAllocator(const LuaAllocator&) = delete;
+        LuaAllocator& operator=(const LuaAllocator&) = delete;
+
+        static void* luaAlloc(void* userData, void* ptr, size_t oldSize, size_t newSize) noexcept;
+
+        /**
+         * The allocations that exceed the limit fail (Lua runs the emergency collection and raises the memory error).
+         * 0 means no limit.
+         */
+        void setMemoryLimit(size_t limit);
+
+        ScriptMemoryStatistics getStatistics() const;
+
+        size_t getUsedBytes() const
+        {
+            return m_usedBytes;
+        }
+
+    private:
+        static constexpr size_t PageSize = 64 * 1024;
+        static constexpr eastl::array<size_t, 8> SizeClasses = {16, 32, 48, 64, 96, 128, 192, 256};
+
+        struct FreeBlock
+        {
+            FreeBlock* next;
+        };
+
+        static size_t getSizeClassIndex(size_t size);
+
+        void* reallocate(void* ptr, size_t oldSize, size_t newSize);
+        void* allocateBlock(size_t size);
+        void freeBlock(void* ptr, size_t size);
+
+        eastl::array<FreeBlock*, SizeClasses.size()> m_freeBlocks = {};
+        eastl::vector<void*> m_pages;
+
+        size_t m_usedBytes = 0;
+        size_t m_peakBytes = 0;
+        size_t m_memoryLimit = 0;
+    };
+}  // namespace nau::scripts
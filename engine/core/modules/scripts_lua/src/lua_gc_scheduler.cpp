@@ -0,0 +1,78 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "lua_gc_scheduler.h"
+
+#include "lua_allocator.h"
+
+namespace nau::scripts
+{
+    void LuaGcScheduler::initialize(lua_State* luaState, const LuaAllocator& allocator)
+    {
+        NAU_ASSERT(luaState);
+
+        m_luaState = luaState;
+        m_allocator = &allocator;
+
+        lua_gc(m_luaState, LUA_GCINC, BackstopPause, 0, 0);
+        m_liveBytes = m_allocator->getUsedBytes();
+    }
+
+    void LuaGcScheduler::setFrameBudget(std::chrono::microseconds budget)
+    {
+        m_frameBudget = budget;
+    }
+
+    void LuaGcScheduler::requestFullCollection()
+    {
+        m_fullCollectionRequested = true;
+    }
+
+    void LuaGcScheduler::update()
+    {
+        using Clock = std::chrono::steady_clock;
+
+        if (!m_luaState)
+        {
+            return;
+        }
+
+        if (m_fullCollectionRequested)
+        {
+            fullCollection();
+            return;
+        }
+
+        if (!m_isCycleRunning)
+        {
+            if (m_frameBudget.count() <= 0 || static_cast<float>(m_allocator->getUsedBytes()) < static_cast<float>(m_liveBytes) * CycleGrowthRatio)
+            {
+                return;
+            }
+
+            m_isCycleRunning = true;
+        }
+
+        const Clock::time_point deadline = Clock::now() + m_frameBudget;
+        do
+        {
+            // the step returns 1 when the cycle is finished
+            if (lua_gc(m_luaState, LUA_GCSTEP, StepSizeKb) != 0)
+            {
+                m_isCycleRunning = false;
+                m_liveBytes = m_allocator->getUsedBytes();
+                break;
+            }
+        } while (Clock::now() < deadline);
+    }
+
+    void LuaGcScheduler::fullCollection()
+    {
+        lua_gc(m_luaState, LUA_GCCOLLECT);
+
+        m_fullCollectionRequested = false;
+        m_isCycleRunning = false;
+        m_liveBytes = m_allocator->getUsedBytes();
+    }
+}  // namespace nau::scripts
@@ -0,0 +1,51 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <chrono>
+
+#include "lua_toolkit/lua_headers.h"
+
+namespace nau::scripts
+{
+    class LuaAllocator;
+
+    /**
+     * Drives the incremental garbage collection of the environment lua_State from the frame update.
+     *
+     * The Lua automatic collection is kept only as a backstop (with a large pause): the collection steps are run once per frame
+     * within the time budget, so the collector does not interrupt the gameplay code at unpredictable moments.
+     * The full collection is deferred to the next frame update (i.e. requested at the level transition).
+     */
+    class LuaGcScheduler
+    {
+    public:
+        void initialize(lua_State* luaState, const LuaAllocator& allocator);
+
+        void setFrameBudget(std::chrono::microseconds budget);
+
+        void requestFullCollection();
+
+        void update();
+
+    private:
+        // The automatic collection starts when the memory grows by 300% since the last cycle
+        static constexpr int BackstopPause = 400;
+        // The scheduled cycle starts when the memory grows by 50% since the last cycle
+        static constexpr float CycleGrowthRatio = 1.5f;
+        // The amount of work of the single step (in kilobytes of allocations)
+        static constexpr int StepSizeKb = 16;
+
+        void fullCollection();
+
+        lua_State* m_luaState = nullptr;
+        const LuaAllocator* m_allocator = nullptr;
+
+        std::chrono::microseconds m_frameBudget{1000};
+        size_t m_liveBytes = 0;
+        bool m_isCycleRunning = false;
+        bool m_fullCollectionRequested = false;
+    };
+}  // namespace nau::scripts
@@ -0,0 +1,679 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "lua_script_environment.h"
+
+#include "lua_toolkit/lua_interop.h"
+#include "lua_toolkit/lua_stack.h"
+#include "lua_toolkit/lua_utils.h"
+#include "nau/assets/derived_data_cache.h"
+#include "nau/io/file_system.h"
+#include "nau/io/virtual_file_system.h"
+#include "nau/memory/memory_stats.h"
+#include "nau/messaging/messaging.h"
+#include "nau/serialization/json.h"
+#include "nau/service/service_provider.h"
+
+namespace nau::scripts
+{
+    namespace
+    {
+        // Registry key of the last string result of the typed call (keeps the string alive until the next call)
+        constexpr char StringResultAnchorKey = 0;
+
+        // Must be increased when the compiled chunks stored in the derived data cache are changed
+        constexpr uint32_t ScriptBytecodeVersion = 1;
+
+        eastl::vector<std::byte> readStreamContent(io::IStreamReader& stream)
+        {
+            constexpr size_t ChunkSize = 16 * 1024;
+
+            eastl::vector<std::byte> content;
+            for (;;)
+            {
+                const size_t contentSize = content.size();
+                content.resize(contentSize + ChunkSize);
+
+                const Result<size_t> readResult = stream.read(content.data() + contentSize, ChunkSize);
+                if (!readResult || *readResult == 0)
+                {
+                    content.resize(contentSize);
+                    break;
+                }
+
+                content.resize(contentSize + *readResult);
+            }
+
+            return content;
+        }
+
+        struct LuaChunkStreamLoader
+        {
+            std::array<std::byte, 512> buffer;
+            io::IStreamReader& streamReader;
+
+            LuaChunkStreamLoader(io::IStreamReader& inStreamReader) :
+                streamReader(inStreamReader)
+            {
+            }
+
+            static const char* read([[maybe_unused]] lua_State* lua, void* data, size_t* size) noexcept
+            {
+                auto& self = *reinterpret_cast<LuaChunkStreamLoader*>(data);
+
+                Result<size_t> readResult = self.streamReader.read(self.buffer.data(), self.buffer.size());
+                if (!readResult)
+                {
+                    NAU_ASSERT("Fail to read input stream: ({})", readResult.getError()->getMessage());
+                    *size = 0;
+                    return nullptr;
+                }
+
+                *size = *readResult;
+                return *size > 0 ? reinterpret_cast<const char*>(self.buffer.data()) : nullptr;
+            }
+        };
+
+        class InplaceBufferReader final : public io::IStreamReader
+        {
+            NAU_CLASS_(InplaceBufferReader, io::IStreamReader)
+
+        public:
+            InplaceBufferReader(eastl::span<const std::byte> buffer) :
+                m_buffer(buffer)
+            {
+            }
+
+            size_t getPosition() const override
+            {
+                return m_readOffset;
+            }
+
+            size_t setPosition(io::OffsetOrigin origin, int64_t offset) override
+            {
+                NAU_FATAL(origin == io::OffsetOrigin::Begin);
+                m_readOffset = static_cast<size_t>(offset);
+                return m_readOffset;
+            }
+
+            Result<size_t> read(std::byte* outBuffer, size_t count) override
+            {
+                NAU_FATAL(m_readOffset <= m_buffer.size());
+
+                const size_t availSize = (m_buffer.size() - m_readOffset);
+                const size_t readCount = std::min(availSize, count);
+
+                memcpy(outBuffer, m_buffer.data() + m_readOffset, readCount);
+                m_readOffset += readCount;
+                return readCount;
+            }
+
+        private:
+            eastl::span<const std::byte> m_buffer;
+            size_t m_readOffset = 0;
+        };
+
+    }  // namespace
+
+    LuaScriptEnvironment::LuaScriptEnvironment(eastl::string_view name, async::Executor::Ptr executor, eastl::shared_ptr<const LuaScriptSettings> settings) :
+        m_name(name),
+        m_executor(std::move(executor)),
+        m_settings(std::move(settings))
+    {
+        NAU_FATAL(m_settings);
+    }
+
+    LuaScriptEnvironment::~LuaScriptEnvironment()
+    {
+        NAU_ASSERT(!m_luaState, "Script environment ({}) is not shutdown", m_name);
+    }
+
+    LuaScriptEnvironment& LuaScriptEnvironment::getSelf(lua_State* l)
+    {
+        const auto selfUpvalueIndex = lua_upvalueindex(1);
+        NAU_FATAL(lua_type(l, selfUpvalueIndex) == LUA_TLIGHTUSERDATA);
+        return *reinterpret_cast<LuaScriptEnvironment*>(lua_touserdata(l, selfUpvalueIndex));
+    }
+
+    int LuaScriptEnvironment::luaRequire(lua_State* l) noexcept
+    {
+        LuaScriptEnvironment& self = getSelf(l);
+
+        const int top = lua_gettop(l);
+        io::FsPath filePath = *lua::cast<std::string>(l, -1);
+
+        // executeFileInternal will keeps result on stack
+        Result<> executeFileResult = self.executeFileInternal(filePath);
+
+        if (executeFileResult)
+        {
+            const int top2 = lua_gettop(l);
+            NAU_ASSERT(top2 >= top);
+            return top2 - top;
+        }
+
+        NAU_LOG_ERROR("Script module ({}) execution error: {}", filePath.getString(), executeFileResult.getError()->getMessage());
+        return 0;
+    }
+
+    int LuaScriptEnvironment::luaPostMessage(lua_State* l) noexcept
+    {
+        if (lua_type(l, 1) != LUA_TSTRING)
+        {
+            return luaL_error(l, "messaging.post: stream name expected");
+        }
+
+        size_t streamNameLen = 0;
+        const char* const streamName = lua_tolstring(l, 1, &streamNameLen);
+
+        // The value made from the stack references the lua_State: the receivers (i.e. the other environments) get the copy
+        RuntimeValue::Ptr message;
+        if (!lua_isnoneornil(l, 2))
+        {
+            message = serialization::jsonToRuntimeValue(serialization::runtimeToJsonValue(lua::makeValueFromLuaStack(l, 2)));
+        }
+
+        getBroadcaster().post(eastl::string_view{streamName, streamNameLen}, std::move(message));
+        return 0;
+    }
+
+    int LuaScriptEnvironment::luaSubscribeMessage(lua_State* l) noexcept
+    {
+        if (lua_type(l, 1) != LUA_TSTRING || lua_type(l, 2) != LUA_TFUNCTION)
+        {
+            return luaL_error(l, "messaging.subscribe: (streamName, handler) expected");
+        }
+
+        LuaScriptEnvironment& self = getSelf(l);
+
+        size_t streamNameLen = 0;
+        const char* const streamName = lua_tolstring(l, 1, &streamNameLen);
+        AsyncMessageStream stream = getBroadcaster().getStream(eastl::string_view{streamName, streamNameLen});
+
+        lua_pushvalue(l, 2);
+        MessageSubscription& subscription = self.m_subscriptions.emplace_back();
+        subscription.handlerRef = luaL_ref(l, LUA_REGISTRYINDEX);
+        subscription.task = self.runMessageListener(std::move(stream), subscription.handlerRef, subscription.cancellationSource.getCancellation());
+
+        return 0;
+    }
+
+    async::Task<> LuaScriptEnvironment::runMessageListener(AsyncMessageStream stream, int handlerRef, Cancellation cancellation)
+    {
+        // The listener is started from the script (on the environment executor): the continuations are resumed on the same executor
+        while (!cancellation.isCancelled())
+        {
+            async::Task<RuntimeValue::Ptr> task = stream.getNextMessage();
+
+            if (!task.isReady())
+            {
+                task.detach();
+                auto result = co_await async::whenAny(cancellation, task);
+                if (!result || cancellation.isCancelled())
+                {
+                    co_return;
+                }
+            }
+
+            if (task.isRejected())
+            {
+                co_yield task.getError();
+            }
+
+            RuntimeValue::Ptr message = *std::move(task);
+
+            lua_State* const luaState = getLua();
+            const lua::StackGuard lstackGuard{luaState};
+
+            lua_rawgeti(luaState, LUA_REGISTRYINDEX, handlerRef);
+            if (!message || !lua::pushRuntimeValue(luaState, message))
+            {
+                lua_pushnil(luaState);
+            }
+
+            if (lua_pcall(luaState, 1, 0, 0) != 0)
+            {
+                NAU_LOG_ERROR("Script environment ({}) message handler error: {}", m_name, *lua::cast<std::string>(luaState, -1));
+            }
+        }
+    }
+
+    lua_State* LuaScriptEnvironment::getLua() const
+    {
+        NAU_FATAL(m_luaState);
+
+        return m_luaState;
+    }
+
+    eastl::string_view LuaScriptEnvironment::getName() const
+    {
+        return m_name;
+    }
+
+    async::Executor::Ptr LuaScriptEnvironment::getExecutor() const
+    {
+        return m_executor;
+    }
+
+    bool LuaScriptEnvironment::isInitialized() const
+    {
+        return m_luaState != nullptr;
+    }
+
+    void LuaScriptEnvironment::initialize()
+    {
+        NAU_FATAL(!m_luaState);
+
+        m_allocator.setMemoryLimit(m_settings->memoryLimit);
+
+        m_luaState = lua_newstate(LuaAllocator::luaAlloc, &m_allocator);
+        NAU_FATAL(m_luaState);
+        luaL_openlibs(m_luaState);
+
+        m_gcScheduler.initialize(m_luaState, m_allocator);
+        if (m_settings->gcFrameBudget)
+        {
+            m_gcScheduler.setFrameBudget(*m_settings->gcFrameBudget);
+        }
+
+        lua_pushlightuserdata(m_luaState, this);
+        lua_pushcclosure(m_luaState, luaRequire, 1);
+        lua_setglobal(m_luaState, "require");
+
+        const luaL_Reg messagingFunctions[] = {
+            {"post",      luaPostMessage     },
+            {"subscribe", luaSubscribeMessage},
+            {nullptr,     nullptr            }
+        };
+
+        lua_newtable(m_luaState);
+        lua_pushlightuserdata(m_luaState, this);
+        luaL_setfuncs(m_luaState, messagingFunctions, 1);
+        lua_setglobal(m_luaState, "messaging");
+    }
+
+    void LuaScriptEnvironment::shutdown()
+    {
+        for (MessageSubscription& subscription : m_subscriptions)
+        {
+            subscription.cancellationSource.cancel();
+            if (auto task = std::move(subscription.task); task && !task.isReady())
+            {
+                task.detach();
+            }
+        }
+
+        m_subscriptions.clear();
+
+        if (m_luaState)
+        {
+            m_functionRefs.clear();
+            m_batchHandlesRef = LUA_NOREF;
+            m_batchHandlesCount = 0;
+            lua_close(m_luaState);
+            m_luaState = nullptr;
+        }
+    }
+
+    ScriptMemoryStatistics LuaScriptEnvironment::getMemoryStatistics() const
+    {
+        return m_allocator.getStatistics();
+    }
+
+    void LuaScriptEnvironment::setMemoryLimit(size_t limit)
+    {
+        m_allocator.setMemoryLimit(limit);
+    }
+
+    void LuaScriptEnvironment::setGcFrameBudget(std::chrono::microseconds budget)
+    {
+        m_gcScheduler.setFrameBudget(budget);
+    }
+
+    void LuaScriptEnvironment::requestFullCollection()
+    {
+        m_gcScheduler.requestFullCollection();
+    }
+
+    void LuaScriptEnvironment::updateGc()
+    {
+        if (m_luaState)
+        {
+            m_gcScheduler.update();
+        }
+    }
+
+    Result<> LuaScriptEnvironment::executeScriptFromBytes(const char* scriptName, eastl::span<const std::byte> scriptCode)
+    {
+        NAU_MEMORY_SCOPE(Scripts);
+        resetFunctionsCache();
+
+        // TODO: actually reader must be created through rtti::createInstance
+        InplaceBufferReader reader(scriptCode);
+        LuaChunkStreamLoader loader{reader};
+
+        auto* const luaState = getLua();
+
+        if (lua_load(luaState, LuaChunkStreamLoader::read, &loader, (scriptName ? scriptName : "unnamed"), "t") == 0)
+        {
+            if (lua_pcall(luaState, 0, 0, 0) != 0)
+            {
+                auto err = *lua::cast<std::string>(luaState, -1);
+                return NauMakeError("Execution error: {}", err);
+            }
+        }
+        else
+        {
+            auto err = *lua::cast<std::string>(luaState, -1);
+            return NauMakeError("Parse error: {}", err);
+        }
+
+        return ResultSuccess;
+    }
+
+    Result<> LuaScriptEnvironment::executeScriptFromFile(const io::FsPath& filePath)
+    {
+        NAU_MEMORY_SCOPE(Scripts);
+        auto* const luaState = getLua();
+        const lua::StackGuard lstackGuard{luaState};
+
+        resetFunctionsCache();
+        return executeFileInternal(filePath);
+    }
+
+    Result<> LuaScriptEnvironment::executeFileInternal(const io::FsPath& filePath)
+    {
+        auto* const luaState = getLua();
+
+        io::IFileSystem& fs = getServiceProvider().get<io::IFileSystem>();
+        io::FsPath moduleFullPath;
+        if (filePath.isAbsolute())
+        {
+            moduleFullPath = filePath;
+        }
+        else
+        {
+            for (const auto& scriptsRoot : m_settings->searchPaths)
+            {
+                io::FsPath modulePath = (scriptsRoot / filePath);
+                modulePath = modulePath + m_settings->scriptFileExtension;
+
+                if (fs.exists(modulePath, io::FsEntryKind::File))
+                {
+                    moduleFullPath = std::move(modulePath);
+                    break;
+                }
+            }
+        }
+
+        if (moduleFullPath.isEmpty() || !fs.exists(moduleFullPath, io::FsEntryKind::File))
+        {
+            return NauMakeError("Script file path not resolved:({})", filePath.getString());
+        }
+
+        auto file = fs.openFile(moduleFullPath, io::AccessMode::Read, io::OpenFileMode::OpenExisting);
+        if (!file)
+        {
+            return NauMakeError("Fail to open script file:({})", moduleFullPath.getString());
+        }
+
+        io::IStreamReader::Ptr stream = file->createStream();
+        const std::string chunkName = moduleFullPath.getString();
+
+        // The loose (native) files are the sources, they are compiled through the bytecode cache.
+        // Binary chunks are accepted only from the packs cooked by the build tool (mounted as trusted):
+        // any other archive (e.g. a mod zip) is loaded as text, the lua undump does not validate the bytecode.
+        if (file->is<io::INativeFile>())
+        {
+            NauCheckResult(loadSourceFile(*stream, chunkName.c_str()));
+        }
+        else
+        {
+            auto* const vfs = fs.as<io::IVirtualFileSystem*>();
+            const char* const loadMode = vfs && vfs->isTrustedFile(moduleFullPath) ? "bt" : "t";
+
+            LuaChunkStreamLoader loader{*stream};
+            if (lua_load(luaState, LuaChunkStreamLoader::read, &loader, chunkName.c_str(), loadMode) != 0)
+            {
+                auto err = *lua::cast<std::string>(luaState, -1);
+                return NauMakeError("Parse error: {}", err);
+            }
+        }
+
+        if (lua_pcall(luaState, 0, LUA_MULTRET, 0) != 0)
+        {
+            auto err = *lua::cast<std::string>(luaState, -1);
+            return NauMakeError("Execution error: {}", err);
+        }
+
+        return ResultSuccess;
+    }
+
+    Result<> LuaScriptEnvironment::loadSourceFile(io::IStreamReader& stream, const char* chunkName)
+    {
+        auto* const luaState = getLua();
+
+        const eastl::vector<std::byte> source = readStreamContent(stream);
+
+        IDerivedDataCache* const bytecodeCache = m_settings->useBytecodeCache && getServiceProvider().has<IDerivedDataCache>() ? &getServiceProvider().get<IDerivedDataCache>() : nullptr;
+
+        // The chunk name is kept within the (not stripped) compiled chunk and is reported by the errors
+        DerivedDataKey key{"lua_bytecode", ScriptBytecodeVersion};
+        key.add(eastl::string_view{LUA_VERSION}).add(eastl::string_view{chunkName}).add(eastl::span<const std::byte>{source.data(), source.size()});
+
+        if (bytecodeCache)
+        {
+            if (eastl::optional<eastl::vector<std::byte>> bytecode = bytecodeCache->find(key))
+            {
+                if (luaL_loadbufferx(luaState, reinterpret_cast<const char*>(bytecode->data()), bytecode->size(), chunkName, "b") == 0)
+                {
+                    return ResultSuccess;
+                }
+
+                // the broken product is replaced below
+                lua_pop(luaState, 1);
+            }
+        }
+
+        if (luaL_loadbufferx(luaState, reinterpret_cast<const char*>(source.data()), source.size(), chunkName, "t") != 0)
+        {
+            auto err = *lua::cast<std::string>(luaState, -1);
+            return NauMakeError("Parse error: {}", err);
+        }
+
+        if (bytecodeCache)
+        {
+            // the debug information is kept: the development builds report the script errors with the line numbers
+            if (Result<eastl::vector<std::byte>> bytecode = lua::dumpFunction(luaState, -1, false))
+            {
+                bytecodeCache->store(key, *bytecode);
+            }
+        }
+
+        return ResultSuccess;
+    }
+
+    void LuaScriptEnvironment::registerClass(IClassDescriptor::Ptr classDescriptor)
+    {
+        lua::initializeClass(getLua(), std::move(classDescriptor), false).ignore();
+    }
+
+    Result<> LuaScriptEnvironment::invokeGlobal(eastl::string_view method, DispatchArguments args, Functor<void(const nau::Ptr<>& result)> resultCallback)
+    {
+        auto* const luaState = getLua();
+        const lua::StackGuard lstackGuard{luaState};
+
+        const int type = lua_getglobal(luaState, eastl::string{method}.c_str());
+        NAU_ASSERT(type == LUA_TFUNCTION);
+        if (type != LUA_TFUNCTION)
+        {
+            return NauMakeError("Global ({}) is not resolved to Function", method);
+        }
+
+        for (auto& rtArg : args)
+        {
+            lua::pushRuntimeValue(luaState, rtArg).ignore();
+        }
+
+        constexpr int MaxResulCount = 1;
+
+        if (lua_pcall(luaState, static_cast<int>(args.size()), MaxResulCount, 0) != 0)
+        {
+            auto err = *lua::cast<std::string>(luaState, -1);
+            return NauMakeError("Parse error: {}", err);
+        }
+
+        if (resultCallback)
+        {
+            const int top = lua_gettop(luaState);
+
+            if (lstackGuard.top != top)
+            {
+                NAU_ASSERT(lstackGuard.top < top);
+                resultCallback(lua::makeValueFromLuaStack(luaState, top));
+            }
+        }
+        else
+        {
+            resultCallback(nullptr);
+        }
+
+        return ResultSuccess;
+    }
+
+    Result<> LuaScriptEnvironment::invokeFunction(eastl::string_view function, eastl::span<const ScriptValue> args, ScriptValue* result)
+    {
+        auto* const luaState = getLua();
+        const lua::StackGuard lstackGuard{luaState};
+
+        if (!lua_checkstack(luaState, static_cast<int>(args.size()) + 1))
+        {
+            return NauMakeError("Too many arguments ({})", args.size());
+        }
+
+        NauCheckResult(pushCachedFunction(function));
+
+        for (const ScriptValue& arg : args)
+        {
+            eastl::visit([luaState](const auto& value)
+            {
+                using T = std::decay_t<decltype(value)>;
+                if constexpr (std::is_same_v<T, eastl::monostate>)
+                {
+                    lua_pushnil(luaState);
+                }
+                else
+                {
+                    lua::push(luaState, value);
+                }
+            }, arg);
+        }
+
+        if (lua_pcall(luaState, static_cast<int>(args.size()), result ? 1 : 0, 0) != 0)
+        {
+            auto err = *lua::cast<std::string>(luaState, -1);
+            return NauMakeError("Execution error: {}", err);
+        }
+
+        if (!result)
+        {
+            return ResultSuccess;
+        }
+
+        return eastl::visit([luaState](auto& value) -> Result<>
+        {
+            using T = std::decay_t<decltype(value)>;
+            if constexpr (std::is_same_v<T, eastl::monostate>)
+            {
+                return ResultSuccess;
+            }
+            else
+            {
+                if constexpr (std::is_same_v<T, eastl::string_view>)
+                {
+                    lua_pushvalue(luaState, -1);
+                    lua_rawsetp(luaState, LUA_REGISTRYINDEX, &StringResultAnchorKey);
+                }
+
+                return lua::get(luaState, -1, value);
+            }
+        }, *result);
+    }
+
+    Result<> LuaScriptEnvironment::invokeBatchedUpdate(eastl::string_view function, eastl::span<void* const> objects, float dt)
+    {
+        auto* const luaState = getLua();
+        const lua::StackGuard lstackGuard{luaState};
+
+        NauCheckResult(pushCachedFunction(function));
+
+        if (m_batchHandlesRef == LUA_NOREF)
+        {
+            lua_createtable(luaState, static_cast<int>(objects.size()), 0);
+            m_batchHandlesRef = luaL_ref(luaState, LUA_REGISTRYINDEX);
+        }
+        lua_rawgeti(luaState, LUA_REGISTRYINDEX, m_batchHandlesRef);
+
+        const int handlesIndex = lua_gettop(luaState);
+        for (size_t i = 0; i < objects.size(); ++i)
+        {
+            lua_pushlightuserdata(luaState, objects[i]);
+            lua_rawseti(luaState, handlesIndex, static_cast<lua_Integer>(i + 1));
+        }
+
+        // The handles of the previous (larger) batch must not outlive their objects
+        for (size_t i = objects.size(); i < m_batchHandlesCount; ++i)
+        {
+            lua_pushnil(luaState);
+            lua_rawseti(luaState, handlesIndex, static_cast<lua_Integer>(i + 1));
+        }
+        m_batchHandlesCount = objects.size();
+
+        lua_pushinteger(luaState, static_cast<lua_Integer>(objects.size()));
+        lua_pushnumber(luaState, dt);
+
+        if (lua_pcall(luaState, 3, 0, 0) != 0)
+        {
+            auto err = *lua::cast<std::string>(luaState, -1);
+            return NauMakeError("Execution error: {}", err);
+        }
+
+        return ResultSuccess;
+    }
+
+    Result<> LuaScriptEnvironment::pushCachedFunction(eastl::string_view function)
+    {
+        auto* const luaState = getLua();
+
+        auto functionRef = m_functionRefs.find_as(function, eastl::hash<eastl::string_view>{}, eastl::equal_to_2<eastl::string, eastl::string_view>{});
+        if (functionRef == m_functionRefs.end())
+        {
+            const int type = lua_getglobal(luaState, eastl::string{function}.c_str());
+            if (type != LUA_TFUNCTION)
+            {
+                lua_pop(luaState, 1);
+                return NauMakeError("Global ({}) is not resolved to Function", function);
+            }
+
+            // luaL_ref pops the function
+            lua_pushvalue(luaState, -1);
+            m_functionRefs.emplace(eastl::string{function}, luaL_ref(luaState, LUA_REGISTRYINDEX));
+            return ResultSuccess;
+        }
+
+        lua_rawgeti(luaState, LUA_REGISTRYINDEX, functionRef->second);
+        return ResultSuccess;
+    }
+
+    void LuaScriptEnvironment::resetFunctionsCache()
+    {
+        for (const auto& [function, functionRef] : m_functionRefs)
+        {
+            luaL_unref(getLua(), LUA_REGISTRYINDEX, functionRef);
+        }
+
+        m_functionRefs.clear();
+    }
+
+}  // namespace nau::scripts
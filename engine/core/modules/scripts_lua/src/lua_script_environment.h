@@ -0,0 +1,141 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <EASTL/list.h>
+#include <EASTL/optional.h>
+#include <EASTL/shared_ptr.h>
+#include <EASTL/string.h>
+#include <EASTL/unordered_map.h>
+#include <EASTL/vector.h>
+
+#include <chrono>
+
+#include "lua_allocator.h"
+#include "lua_gc_scheduler.h"
+#include "nau/io/stream.h"
+#include "nau/messaging/async_message_stream.h"
+#include "nau/rtti/rtti_impl.h"
+#include "nau/scripts/script_manager.h"
+#include "nau/utils/cancellation.h"
+
+namespace nau::scripts
+{
+    /**
+     * Settings shared by all the environments of the script manager.
+     * Expected to be configured before the scripts are executed (they are read by the environment threads without locking).
+     */
+    struct LuaScriptSettings
+    {
+        eastl::vector<io::FsPath> searchPaths;
+        eastl::string scriptFileExtension = ".lua";
+        bool useBytecodeCache = true;
+        size_t memoryLimit = 0;
+        eastl::optional<std::chrono::microseconds> gcFrameBudget;
+    };
+
+    /**
+     * The lua_State with its own allocator, GC scheduler and cached functions.
+     * All the methods (except getName and getExecutor) must be called on the environment executor.
+     */
+    class LuaScriptEnvironment final : public IScriptEnvironment
+    {
+        NAU_CLASS_(nau::scripts::LuaScriptEnvironment, IScriptEnvironment)
+
+    public:
+        using Ptr = nau::Ptr<LuaScriptEnvironment>;
+
+        LuaScriptEnvironment(eastl::string_view name, async::Executor::Ptr executor, eastl::shared_ptr<const LuaScriptSettings> settings);
+
+        ~LuaScriptEnvironment();
+
+        eastl::string_view getName() const override;
+
+        async::Executor::Ptr getExecutor() const override;
+
+        Result<> executeScriptFromBytes(const char* scriptName, eastl::span<const std::byte> scriptCode) override;
+
+        Result<> executeScriptFromFile(const io::FsPath& path) override;
+
+        Result<> invokeFunction(eastl::string_view function, eastl::span<const ScriptValue> args, ScriptValue* result) override;
+
+        ScriptMemoryStatistics getMemoryStatistics() const override;
+
+        /**
+         * Creates the lua_State. Must be called (on the environment executor) before any other operation.
+         */
+        void initialize();
+
+        /**
+         * Cancels the message subscriptions and closes the lua_State.
+         */
+        void shutdown();
+
+        bool isInitialized() const;
+
+        void registerClass(IClassDescriptor::Ptr classDescriptor);
+
+        Result<> invokeGlobal(eastl::string_view method, DispatchArguments args, Functor<void(const nau::Ptr<>& result)> resultCallback);
+
+        // Calls function(handles, count, dt), the objects are packed as the light userdata into the handles array reused between the calls
+        Result<> invokeBatchedUpdate(eastl::string_view function, eastl::span<void* const> objects, float dt);
+
+        void setMemoryLimit(size_t limit);
+
+        void setGcFrameBudget(std::chrono::microseconds budget);
+
+        void requestFullCollection();
+
+        // Runs the incremental GC steps within the frame budget
+        void updateGc();
+
+    private:
+        struct MessageSubscription
+        {
+            CancellationSource cancellationSource;
+            async::Task<> task;
+            int handlerRef = LUA_NOREF;
+        };
+
+        static LuaScriptEnvironment& getSelf(lua_State* l);
+
+        static int luaRequire(lua_State* l) noexcept;
+
+        // messaging.post(streamName, value)
+        static int luaPostMessage(lua_State* l) noexcept;
+
+        // messaging.subscribe(streamName, function(value) end)
+        static int luaSubscribeMessage(lua_State* l) noexcept;
+
+        lua_State* getLua() const;
+
+        Result<> executeFileInternal(const io::FsPath& filePath);
+
+        // Loads the source chunk (keeps the function on the stack), the compiled chunk is taken from the bytecode cache when possible
+        Result<> loadSourceFile(io::IStreamReader& stream, const char* chunkName);
+
+        // Pushes the global function, the resolved functions are referenced from the registry
+        Result<> pushCachedFunction(eastl::string_view function);
+
+        // The globals may be reassigned by the executed scripts
+        void resetFunctionsCache();
+
+        async::Task<> runMessageListener(AsyncMessageStream stream, int handlerRef, Cancellation cancellation);
+
+        const eastl::string m_name;
+        const async::Executor::Ptr m_executor;
+        const eastl::shared_ptr<const LuaScriptSettings> m_settings;
+
+        LuaAllocator m_allocator;
+        LuaGcScheduler m_gcScheduler;
+        lua_State* m_luaState = nullptr;
+        eastl::unordered_map<eastl::string, int> m_functionRefs;
+        int m_batchHandlesRef = LUA_NOREF;
+        // Filled entries of the handles array
+        size_t m_batchHandlesCount = 0;
+        eastl::list<MessageSubscription> m_subscriptions;
+    };
+
+}  // namespace nau::scripts
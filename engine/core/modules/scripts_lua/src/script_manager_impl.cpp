@@ -4,12 +4,12 @@
 
 #include "script_manager_impl.h"
 
-#include "lua_toolkit/lua_interop.h"
-#include "lua_toolkit/lua_utils.h"
+#include <EASTL/algorithm.h>
+
+#include "nau/app/application.h"
 #include "nau/app/global_properties.h"
-#include "nau/io/file_system.h"
-#include "nau/io/stream.h"
-#include "nau/memory/bytes_buffer.h"
+#include "nau/async/thread_pool_executor.h"
+#include "nau/memory/memory_stats.h"
 #include "nau/serialization/json_utils.h"
 #include "nau/service/service_provider.h"
 
@@ -17,33 +17,6 @@ namespace nau::scripts
 {
     namespace
     {
-        struct LuaChunkStreamLoader
-        {
-            std::array<std::byte, 512> buffer;
-            io::IStreamReader& streamReader;
-
-            LuaChunkStreamLoader(io::IStreamReader& inStreamReader) :
-                streamReader(inStreamReader)
-            {
-            }
-
-            static const char* read([[maybe_unused]] lua_State* lua, void* data, size_t* size) noexcept
-            {
-                auto& self = *reinterpret_cast<LuaChunkStreamLoader*>(data);
-
-                Result<size_t> readResult = self.streamReader.read(self.buffer.data(), self.buffer.size());
-                if (!readResult)
-                {
-                    NAU_ASSERT("Fail to read input stream: ({})", readResult.getError()->getMessage());
-                    *size = 0;
-                    return nullptr;
-                }
-
-                *size = *readResult;
-                return *size > 0 ? reinterpret_cast<const char*>(self.buffer.data()) : nullptr;
-            }
-        };
-
         struct ScriptsGlobalConfig
         {
             eastl::vector<io::FsPath> searchPaths;
@@ -52,224 +25,313 @@ namespace nau::scripts
                 CLASS_FIELD(searchPaths))
         };
 
-        class InplaceBufferReader final : public io::IStreamReader
+        void shutdownEnvironment(LuaScriptEnvironment::Ptr environment)
         {
-            NAU_CLASS_(InplaceBufferReader, io::IStreamReader)
-
-        public:
-            InplaceBufferReader(eastl::span<const std::byte> buffer) :
-                m_buffer(buffer)
+            if (environment->getExecutor() == async::Executor::getCurrent())
             {
+                environment->shutdown();
+                return;
             }
 
-            size_t getPosition() const override
+            async::Task<> shutdownTask = async::run([environment]
             {
-                return m_readOffset;
-            }
+                environment->shutdown();
+            }, environment->getExecutor());
 
-            size_t setPosition(io::OffsetOrigin origin, int64_t offset) override
-            {
-                NAU_FATAL(origin == io::OffsetOrigin::Begin);
-                m_readOffset = static_cast<size_t>(offset);
-                return m_readOffset;
-            }
+            async::wait(shutdownTask);
+        }
+    }  // namespace
 
-            Result<size_t> read(std::byte* outBuffer, size_t count) override
-            {
-                NAU_FATAL(m_readOffset <= m_buffer.size());
+    ScriptManagerImpl::~ScriptManagerImpl()
+    {
+    }
 
-                const size_t availSize = (m_buffer.size() - m_readOffset);
-                const size_t readCount = std::min(availSize, count);
+    LuaScriptEnvironment& ScriptManagerImpl::getMainEnvironment() const
+    {
+        NAU_FATAL(m_mainEnvironment);
 
-                memcpy(outBuffer, m_buffer.data(), readCount);
-                m_readOffset += readCount;
-                return readCount;
-            }
+        return *m_mainEnvironment;
+    }
 
-        private:
-            eastl::span<const std::byte> m_buffer;
-            size_t m_readOffset = 0;
-        };
+    async::Task<> ScriptManagerImpl::preInitService()
+    {
+        GlobalProperties& properties = getServiceProvider().get<GlobalProperties>();
+        if (eastl::optional<ScriptsGlobalConfig> config = properties.getValue<ScriptsGlobalConfig>("/scripts"))
+        {
+            for (auto& path : config->searchPaths)
+            {
+                addScriptSearchPath(std::move(path));
+            }
+        }
 
-    }  // namespace
+        m_settings->useBytecodeCache = properties.getValue<bool>("/scripts/bytecodeCache").value_or(true);
+        m_settings->memoryLimit = static_cast<size_t>(properties.getValue<uint32_t>("/scripts/memoryLimitMb").value_or(0)) * 1024 * 1024;
+        if (eastl::optional<uint32_t> gcFrameBudget = properties.getValue<uint32_t>("/scripts/gcFrameBudgetUs"))
+        {
+            m_settings->gcFrameBudget = std::chrono::microseconds{*gcFrameBudget};
+        }
 
-    int ScriptManagerImpl::luaRequire(lua_State* l) noexcept
-    {
-        const auto selfUpvalueIndex = lua_upvalueindex(1);
-        NAU_FATAL(lua_type(l, selfUpvalueIndex) == LUA_TLIGHTUSERDATA);
-        ScriptManagerImpl* const self = reinterpret_cast<ScriptManagerImpl*>(lua_touserdata(l, selfUpvalueIndex));
+        // The main environment is used directly on the main thread, there is no executor without the running application (i.e. the tests)
+        async::Executor::Ptr mainExecutor = applicationExists() && getApplication().hasExecutor() ? getApplication().getExecutor() : async::Executor::getCurrent();
 
-        const int top = lua_gettop(l);
-        io::FsPath filePath = *lua::cast<std::string>(l, -1);
+        m_mainEnvironment = rtti::createInstance<LuaScriptEnvironment>("main", std::move(mainExecutor), m_settings);
+        m_mainEnvironment->initialize();
 
-        // executeFileInternal will keeps result on stack
-        Result<> executeFileResult = self->executeFileInternal(filePath);
+        return async::Task<>::makeResolved();
+    }
 
-        if (executeFileResult)
+    void ScriptManagerImpl::dispose()
+    {
+        eastl::vector<Environment> environments;
         {
-            const int top2 = lua_gettop(l);
-            NAU_ASSERT(top2 >= top);
-            return top2 - top;
+            const std::lock_guard lock{m_mutex};
+            environments = std::move(m_environments);
         }
 
-        NAU_LOG_ERROR("Script module ({}) execution error: {}", filePath.getString(), executeFileResult.getError()->getMessage());
-        return 0;
+        for (Environment& environment : environments)
+        {
+            shutdownEnvironment(std::move(environment.environment));
+        }
 
+        if (m_mainEnvironment)
+        {
+            m_mainEnvironment->shutdown();
+            m_mainEnvironment.reset();
+        }
     }
 
-    ScriptManagerImpl::~ScriptManagerImpl()
+    void ScriptManagerImpl::addBatchedUpdate(eastl::string_view updateFunction, void* object)
     {
+        NAU_ASSERT(object);
+
+        auto batch = eastl::find_if(m_updateBatches.begin(), m_updateBatches.end(), [updateFunction](const UpdateBatch& batch)
+        {
+            return batch.function == updateFunction;
+        });
+
+        if (batch == m_updateBatches.end())
+        {
+            m_updateBatches.push_back({eastl::string{updateFunction}, {object}});
+            return;
+        }
+
+        batch->objects.push_back(object);
     }
 
-    lua_State* ScriptManagerImpl::getLua() const
+    void ScriptManagerImpl::removeBatchedUpdate(eastl::string_view updateFunction, void* object)
     {
-        NAU_FATAL(m_luaState);
+        auto batch = eastl::find_if(m_updateBatches.begin(), m_updateBatches.end(), [updateFunction](const UpdateBatch& batch)
+        {
+            return batch.function == updateFunction;
+        });
 
-        return m_luaState;
+        if (batch == m_updateBatches.end())
+        {
+            return;
+        }
+
+        // The order of the objects is not kept
+        auto& objects = batch->objects;
+        if (auto entry = eastl::find(objects.begin(), objects.end(), object); entry != objects.end())
+        {
+            *entry = objects.back();
+            objects.pop_back();
+        }
     }
 
-    async::Task<> ScriptManagerImpl::preInitService()
+    void ScriptManagerImpl::gamePreUpdate(std::chrono::milliseconds dt)
     {
-        auto luaAlloc = []([[maybe_unused]] void* ud, void* ptr, [[maybe_unused]] size_t osize, size_t nsize) noexcept -> void*
+        if (!m_mainEnvironment || m_updateBatches.empty())
+        {
+            return;
+        }
+
+        NAU_MEMORY_SCOPE(Scripts);
+        const float dtSeconds = std::chrono::duration<float>(dt).count();
+
+        // The batches are accessed by the index: the script can add the objects (and the batches) while it is updated.
+        // The objects are packed to the script array before the call, so the batch can be changed by the call.
+        for (size_t i = 0; i < m_updateBatches.size(); ++i)
         {
-            // TODO: replace with custom allocator
-            if (nsize == 0)
+            if (m_updateBatches[i].objects.empty())
             {
-                ::free(ptr);
-                return nullptr;
+                continue;
             }
 
-            void* const memPtr = ::realloc(ptr, nsize);
-            NAU_FATAL(memPtr, "Fail to allocate/reallocate script memory:({}) bytes", nsize);
-            return memPtr;
-        };
+            if (Result<> updateResult = m_mainEnvironment->invokeBatchedUpdate(m_updateBatches[i].function, m_updateBatches[i].objects, dtSeconds); !updateResult)
+            {
+                NAU_LOG_ERROR("Batched script update ({}) error: {}", m_updateBatches[i].function, updateResult.getError()->getMessage());
+            }
+        }
+    }
 
-        if (eastl::optional<ScriptsGlobalConfig> config = getServiceProvider().get<GlobalProperties>().getValue<ScriptsGlobalConfig>("/scripts"))
+    void ScriptManagerImpl::gamePostUpdate([[maybe_unused]] std::chrono::milliseconds dt)
+    {
+        if (m_mainEnvironment)
         {
-            for (auto& path : config->searchPaths)
+            m_mainEnvironment->updateGc();
+        }
+
+        const std::lock_guard lock{m_mutex};
+
+        // The GC of the other environments is stepped on their executors: the environment that has not finished
+        // the previous step (i.e. is busy with the long script call) skips the frame
+        for (Environment& entry : m_environments)
+        {
+            if (entry.gcTask && !entry.gcTask.isReady())
             {
-                addScriptSearchPath(std::move(path));
+                continue;
             }
+
+            entry.gcTask = async::run([environment = entry.environment]
+            {
+                environment->updateGc();
+            }, entry.environment->getExecutor());
         }
+    }
 
-        m_luaState = lua_newstate(luaAlloc, nullptr);
-        NAU_FATAL(m_luaState);
-        luaL_openlibs(m_luaState);
+    ScriptMemoryStatistics ScriptManagerImpl::getMemoryStatistics() const
+    {
+        return getMainEnvironment().getMemoryStatistics();
+    }
 
-        lua_pushlightuserdata(m_luaState, this);
-        lua_pushcclosure(m_luaState, luaRequire, 1);
-        lua_setglobal(m_luaState, "require");
+    void ScriptManagerImpl::setMemoryLimit(size_t limit)
+    {
+        getMainEnvironment().setMemoryLimit(limit);
+    }
 
-        return async::Task<>::makeResolved();
+    void ScriptManagerImpl::setGcFrameBudget(std::chrono::microseconds budget)
+    {
+        getMainEnvironment().setGcFrameBudget(budget);
     }
 
-    void ScriptManagerImpl::dispose()
+    void ScriptManagerImpl::collectGarbage()
     {
-        if (m_luaState)
+        getMainEnvironment().requestFullCollection();
+
+        const std::lock_guard lock{m_mutex};
+        for (Environment& entry : m_environments)
         {
-            lua_close(m_luaState);
+            async::run([environment = entry.environment]
+            {
+                environment->requestFullCollection();
+            }, entry.environment->getExecutor()).detach();
         }
     }
 
-    Result<Ptr<>> ScriptManagerImpl::executeScriptFromBytes(const char* scriptName, eastl::span<const std::byte> scriptCode)
+    IScriptEnvironment::Ptr ScriptManagerImpl::createEnvironment(eastl::string_view name, async::Executor::Ptr executor)
     {
-        // TODO: actually reader must be created through rtti::createInstance
-        InplaceBufferReader reader(scriptCode);
-        LuaChunkStreamLoader loader{reader};
+        const std::lock_guard lock{m_mutex};
 
-        auto* const luaState = getLua();
+        const bool nameExists = name == getMainEnvironment().getName() ||
+                                eastl::any_of(m_environments.begin(), m_environments.end(), [name](const Environment& entry)
+        {
+            return entry.environment->getName() == name;
+        });
 
-        if (lua_load(luaState, LuaChunkStreamLoader::read, &loader, (scriptName ? scriptName : "unnamed"), "t") == 0)
+        if (nameExists)
         {
-            if (lua_pcall(luaState, 0, 0, 0) != 0)
-            {
-                auto err = *lua::cast<std::string>(luaState, -1);
-                return NauMakeError("Execution error: {}", err);
-            }
+            NAU_LOG_ERROR("Script environment ({}) already exists", name);
+            return nullptr;
         }
-        else
+
+        if (!executor)
         {
-            auto err = *lua::cast<std::string>(luaState, -1);
-            return NauMakeError("Parse error: {}", err);
+            executor = async::createThreadPoolExecutor(std::string_view{name.data(), name.size()}, 1);
         }
 
-        return nullptr;
-    }
+        auto environment = rtti::createInstance<LuaScriptEnvironment>(name, std::move(executor), m_settings);
 
-    Result<> ScriptManagerImpl::executeFileInternal(const io::FsPath& filePath)
-    {
-        auto* const luaState = getLua();
-
-        io::IFileSystem& fs = getServiceProvider().get<io::IFileSystem>();
-        io::FsPath moduleFullPath;
-        if (filePath.isAbsolute())
-        {
-            moduleFullPath = filePath;
-        }
-        else
+        // The executor runs the invocations in order: the initialization precedes the operations scheduled by the caller
+        Environment& entry = m_environments.emplace_back();
+        entry.environment = environment;
+        entry.gcTask = async::run([environment, classes = m_classes]() mutable
         {
-            for (const auto& scriptsRoot : m_searchPaths)
+            environment->initialize();
+            for (IClassDescriptor::Ptr& classDescriptor : classes)
             {
-                io::FsPath modulePath = (scriptsRoot / filePath);
-                modulePath = modulePath + m_scriptFileExtension;
-
-                if (fs.exists(modulePath, io::FsEntryKind::File))
-                {
-                    moduleFullPath = std::move(modulePath);
-                    break;
-                }
+                environment->registerClass(std::move(classDescriptor));
             }
-        }
+        }, environment->getExecutor());
+
+        return environment;
+    }
 
-        if (moduleFullPath.isEmpty() || !fs.exists(moduleFullPath, io::FsEntryKind::File))
+    IScriptEnvironment::Ptr ScriptManagerImpl::findEnvironment(eastl::string_view name) const
+    {
+        if (m_mainEnvironment && m_mainEnvironment->getName() == name)
         {
-            return NauMakeError("Script file path not resolved:({})", filePath.getString());
+            return m_mainEnvironment;
         }
 
-        auto file = fs.openFile(moduleFullPath, io::AccessMode::Read, io::OpenFileMode::OpenExisting);
-        if (!file)
+        const std::lock_guard lock{m_mutex};
+        auto entry = eastl::find_if(m_environments.begin(), m_environments.end(), [name](const Environment& entry)
         {
-            return NauMakeError("Fail to open script file:({})", moduleFullPath.getString());
-        }
+            return entry.environment->getName() == name;
+        });
 
-        io::IStreamReader::Ptr stream = file->createStream();
-        LuaChunkStreamLoader loader{*stream};
+        return entry != m_environments.end() ? entry->environment : nullptr;
+    }
 
-        if (lua_load(luaState, LuaChunkStreamLoader::read, &loader, moduleFullPath.getString().c_str(), "t") == 0)
+    async::Task<> ScriptManagerImpl::destroyEnvironment(eastl::string_view name)
+    {
+        LuaScriptEnvironment::Ptr environment;
         {
-            if (lua_pcall(luaState, 0, LUA_MULTRET, 0) != 0)
+            const std::lock_guard lock{m_mutex};
+            auto entry = eastl::find_if(m_environments.begin(), m_environments.end(), [name](const Environment& entry)
+            {
+                return entry.environment->getName() == name;
+            });
+
+            if (entry == m_environments.end())
             {
-                auto err = *lua::cast<std::string>(luaState, -1);
-                return NauMakeError("Execution error: {}", err);
+                return async::Task<>::makeResolved();
             }
+
+            environment = std::move(entry->environment);
+            m_environments.erase(entry);
         }
-        else
+
+        async::Executor::Ptr executor = environment->getExecutor();
+        return async::run([environment = std::move(environment)]
         {
-            auto err = *lua::cast<std::string>(luaState, -1);
-            return NauMakeError("Parse error: {}", err);
-        }
+            environment->shutdown();
+        }, std::move(executor));
+    }
 
-        return ResultSuccess;
+    Result<Ptr<>> ScriptManagerImpl::executeScriptFromBytes(const char* scriptName, eastl::span<const std::byte> scriptCode)
+    {
+        NauCheckResult(getMainEnvironment().executeScriptFromBytes(scriptName, scriptCode));
+
+        return nullptr;
     }
 
     Result<Ptr<>> ScriptManagerImpl::executeScriptFromFile(const io::FsPath& filePath)
     {
-        auto* const luaState = getLua();
-        const lua::StackGuard lstackGuard{luaState};
-
-        NauCheckResult(executeFileInternal(filePath));
+        NauCheckResult(getMainEnvironment().executeScriptFromFile(filePath));
 
         return nullptr;
     }
 
     void ScriptManagerImpl::registerClass(IClassDescriptor::Ptr classDescriptor)
     {
-        lua::initializeClass(getLua(), std::move(classDescriptor), false).ignore();
+        getMainEnvironment().registerClass(classDescriptor);
+
+        const std::lock_guard lock{m_mutex};
+        for (Environment& entry : m_environments)
+        {
+            async::run([environment = entry.environment, classDescriptor]() mutable
+            {
+                environment->registerClass(std::move(classDescriptor));
+            }, entry.environment->getExecutor()).detach();
+        }
+
+        m_classes.emplace_back(std::move(classDescriptor));
     }
 
     Result<Ptr<IDispatch>> ScriptManagerImpl::createScriptInstance(eastl::string_view scriptClass)
     {
-        NAU_FATAL(m_luaState);
+        NAU_FATAL(m_mainEnvironment);
         NAU_FAILURE("ScriptManager::createScriptInstance not implemented (under development)");
 
         return nullptr;
@@ -277,55 +339,22 @@ namespace nau::scripts
 
     void ScriptManagerImpl::addScriptSearchPath(io::FsPath path)
     {
-        m_searchPaths.emplace_back(std::move(path));
+        m_settings->searchPaths.emplace_back(std::move(path));
     }
 
     void ScriptManagerImpl::addScriptFileExtension(eastl::string_view ext)
     {
-        m_scriptFileExtension = ext;
+        m_settings->scriptFileExtension = ext;
     }
 
     Result<> ScriptManagerImpl::invokeGlobal(eastl::string_view method, DispatchArguments args, Functor<void(const nau::Ptr<>& result)> resultCallback)
     {
-        auto* const luaState = getLua();
-        const lua::StackGuard lstackGuard{luaState};
-
-        const int type = lua_getglobal(m_luaState, eastl::string{method}.c_str());
-        NAU_ASSERT(type == LUA_TFUNCTION);
-        if (type != LUA_TFUNCTION)
-        {
-            return NauMakeError("Global ({}) is not resolved to Function", method);
-        }
-
-        for (auto& rtArg : args)
-        {
-            lua::pushRuntimeValue(m_luaState, rtArg).ignore();
-        }
-
-        constexpr int MaxResulCount = 1;
-
-        if (lua_pcall(getLua(), static_cast<int>(args.size()), MaxResulCount, 0) != 0)
-        {
-            auto err = *lua::cast<std::string>(m_luaState, -1);
-            return NauMakeError("Parse error: {}", err);
-        }
-
-        if (resultCallback)
-        {
-            const int top = lua_gettop(luaState);
-
-            if (lstackGuard.top != top)
-            {
-                NAU_ASSERT(lstackGuard.top < top);
-                resultCallback(lua::makeValueFromLuaStack(luaState, top));
-            }
-        }
-        else
-        {
-            resultCallback(nullptr);
-        }
+        return getMainEnvironment().invokeGlobal(method, std::move(args), std::move(resultCallback));
+    }
 
-        return ResultSuccess;
+    Result<> ScriptManagerImpl::invokeFunction(eastl::string_view function, eastl::span<const ScriptValue> args, ScriptValue* result)
+    {
+        return getMainEnvironment().invokeFunction(function, args, result);
     }
 
 }  // namespace nau::scripts
@@ -4,6 +4,13 @@
 
 #pragma once
 
+#include <EASTL/shared_ptr.h>
+#include <EASTL/vector.h>
+
+#include <mutex>
+
+#include "lua_script_environment.h"
+#include "nau/app/main_loop/game_system.h"
 #include "nau/rtti/rtti_impl.h"
 #include "nau/runtime/disposable.h"
 #include "nau/scripts/script_manager.h"
@@ -12,17 +19,35 @@
 
 namespace nau::scripts
 {
+    /**
+     * The ScriptManager API operates on the main environment (executed on the thread that initialized the service),
+     * the additional environments are created with createEnvironment.
+     */
     class ScriptManagerImpl final : public ScriptManager,
                                     public IServiceInitialization,
-                                    public IDisposable
+                                    public IDisposable,
+                                    public IGamePreUpdate,
+                                    public IGamePostUpdate
     {
-        NAU_RTTI_CLASS(nau::scripts::ScriptManagerImpl, ScriptManager, IServiceInitialization, IDisposable)
+        NAU_RTTI_CLASS(nau::scripts::ScriptManagerImpl, ScriptManager, IServiceInitialization, IDisposable, IGamePreUpdate, IGamePostUpdate)
 
     public:
         ~ScriptManagerImpl();
 
     private:
-        static int luaRequire(lua_State* l) noexcept;
+        struct Environment
+        {
+            LuaScriptEnvironment::Ptr environment;
+            // The last GC update (the update is skipped while the environment is busy)
+            async::Task<> gcTask;
+        };
+
+        // The objects updated by a single call of the script function
+        struct UpdateBatch
+        {
+            eastl::string function;
+            eastl::vector<void*> objects;
+        };
 
         Result<Ptr<>> executeScriptFromBytes(const char* scriptName, eastl::span<const std::byte> scriptCode) override;
 
@@ -36,20 +61,46 @@ namespace nau::scripts
 
         void addScriptFileExtension(eastl::string_view ext) override;
 
+        ScriptMemoryStatistics getMemoryStatistics() const override;
+
+        void setMemoryLimit(size_t limit) override;
+
+        void setGcFrameBudget(std::chrono::microseconds budget) override;
+
+        void collectGarbage() override;
+
+        IScriptEnvironment::Ptr createEnvironment(eastl::string_view name, async::Executor::Ptr executor) override;
+
+        IScriptEnvironment::Ptr findEnvironment(eastl::string_view name) const override;
+
+        async::Task<> destroyEnvironment(eastl::string_view name) override;
+
+        void addBatchedUpdate(eastl::string_view updateFunction, void* object) override;
+
+        void removeBatchedUpdate(eastl::string_view updateFunction, void* object) override;
+
+        void gamePreUpdate(std::chrono::milliseconds dt) override;
+
+        void gamePostUpdate(std::chrono::milliseconds dt) override;
+
         async::Task<> preInitService() override;
 
         void dispose() override;
 
         Result<> invokeGlobal(eastl::string_view method, DispatchArguments args, Functor<void (const nau::Ptr<>& result)>) override;
 
-        lua_State* getLua() const;
+        Result<> invokeFunction(eastl::string_view function, eastl::span<const ScriptValue> args, ScriptValue* result) override;
 
-        Result<> executeFileInternal(const io::FsPath& filePath);
+        LuaScriptEnvironment& getMainEnvironment() const;
 
+        eastl::shared_ptr<LuaScriptSettings> m_settings = eastl::make_shared<LuaScriptSettings>();
+        LuaScriptEnvironment::Ptr m_mainEnvironment;
 
-        lua_State* m_luaState = nullptr;
-        eastl::vector<io::FsPath> m_searchPaths;
-        eastl::string m_scriptFileExtension = ".lua";
+        eastl::vector<IClassDescriptor::Ptr> m_classes;
+        eastl::vector<Environment> m_environments;
+        // Accessed on the main thread only (as the main environment)
+        eastl::vector<UpdateBatch> m_updateBatches;
+        mutable std::mutex m_mutex;
     };
 
 }  // namespace nau::scripts
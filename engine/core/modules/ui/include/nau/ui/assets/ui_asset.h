@@ -26,6 +26,10 @@ namespace nau::ui::data
         void createUi(Canvas* uiCanvas) const;
 
     private:
+        // Registers the atlas images as the sprite frames (named by the packed image paths)
+        void registerAtlasFrames() const;
+
         eastl::vector<UiElementAssetData> m_uiElementsData;
+        eastl::vector<UiAtlasAssetData> m_uiAtlasesData;
     };
 } // namespace nau::ui
@@ -13,6 +13,10 @@
 #include "nau/math/math.h"
 
 
+namespace cocos2d
+{
+    class RenderTexture;
+}
 
 namespace nau::ui {
 
@@ -107,6 +111,29 @@ public:
      */
     const eastl::string& getCanvasName() const { return m_canvasName; }
 
+    /**
+     * @brief Enables or disables the retained rendering of the canvas.
+     * 
+     * @param [in] enabled Indicates whether the canvas should be cached.
+     * 
+     * @note The cached canvas is rendered into the screen sized texture only when it has changed (see Node::invalidateRenderCache),
+     *       otherwise the texture is drawn as a single quad and the canvas elements are not visited at all.
+     *       Suits the static panels (HUD, menus): the canvas that changes each frame only pays for the extra texture.
+     */
+    void setRenderCacheEnabled(bool enabled);
+
+    /**
+     * @brief Checks whether the retained rendering of the canvas is enabled.
+     * 
+     * @return `true` if the canvas is cached, `false` otherwise.
+     */
+    bool isRenderCacheEnabled() const;
+
+    /**
+     * @brief Marks the cached image of the canvas outdated: it is rendered again in the next frame.
+     */
+    void invalidateRenderCache() override;
+
     /**
      * @brief Retrieves a GUI element attached to the canvas.
      * 
@@ -138,6 +165,12 @@ public:
         return nullptr;
     }
  
+protected:
+    virtual void visit(cocos2d::Renderer* renderer, const cocos2d::Mat4& parentTransform, uint32_t parentFlags) override;
+
+private:
+    void releaseRenderCache();
+
 private:
     RescalePolicy m_rescale = { RescalePolicy::NoRescale };
 
@@ -146,6 +179,10 @@ private:
     math::vec2 m_size = {0.f, 0.f};
 
     eastl::string m_canvasName {}; 
+
+    bool m_isRenderCacheEnabled = false;
+    bool m_isRenderCacheValid = false;
+    cocos2d::RenderTexture* m_renderCache = nullptr;
 };
 
 }
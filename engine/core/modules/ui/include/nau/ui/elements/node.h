@@ -174,6 +174,13 @@ public:
 
     virtual void redrawDebug();
 
+    /**
+     * @brief Notifies the canvas the node belongs to that its rendered image is outdated (see Canvas::setRenderCacheEnabled).
+     * 
+     * @note Called by all the property setters. Call it explicitly after the changes that bypass them (e.g. cocos actions).
+     */
+    virtual void invalidateRenderCache();
+
 protected:
     void markDirty();
     void markClean();
@@ -6,6 +6,7 @@
 
 #include <string>
 #include <memory>
+#include <EASTL/shared_ptr.h>
 #include <EASTL/unique_ptr.h>
 #include <EASTL/vector.h>
 #include "EASTL/string.h"
@@ -238,11 +239,13 @@ protected:
     float getNextWordLenght(const eastl::u32string& utf32Text, size_t startIndex, const std::u32string& font);
     bool isCharacterEndOfWord(char32_t character);
     void setLetterColor(Sprite* letterSprite, const SymbolParams& params);
+    void updateLettersColor();
     void removeSpacesAtEdges(std::vector<SymbolDefinition>& symbolDefinitions);
 
 private:
     void drawText(const std::vector<TextLineDefinition>& lineDefinitions, float totalLinesHeight);
     TextDefinition calculateTextDefinition(const eastl::u32string& text);
+    eastl::shared_ptr<const TextDefinition> getTextLayout();
 
     Overflow m_overflow{ Overflow::none };
     Wrapping m_wrapping{ Wrapping::disable };
@@ -254,8 +257,12 @@ private:
 
     eastl::string m_utf8Text{};
     eastl::u32string m_utf32Text{};
+    size_t m_utf32TextHash{ 0 };
     bool m_isRichText{ true };
 
+    // The layout shown by the letter sprites (shared through the text layout cache)
+    eastl::shared_ptr<const TextDefinition> m_textLayout{};
+
     
 #if UI_ELEMENT_DEBUG
     void DebugDrawLetter(float x, float y, Sprite* letter);
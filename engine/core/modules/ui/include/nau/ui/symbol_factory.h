@@ -44,8 +44,16 @@ namespace nau::ui
         cocos2d::Texture2D* getSymbolTexture(int textureId, char32_t utf32Code, const std::u32string& font = U"") const;
         int* getHorizontalKerning(const eastl::u32string& text, int& outNumLetters) const;
 
+        /**
+         * @brief Retrieves the hash of the registered font names (in the lookup order), the layouts built with the same fonts are shared.
+         */
+        size_t getFontsHash() const;
+
     private:
         eastl::vector<eastl::shared_ptr<ISymbolProvider>> m_providers{};
+        size_t m_fontsHash{ 0 };
+
+        void updateFontsHash();
 
         std::string getFileExtension(const std::string& fileName) const;
         std::u32string extractFontName(const std::string& filePath) const;
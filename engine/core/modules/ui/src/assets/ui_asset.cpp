@@ -6,6 +6,7 @@
 
 #include "nau/assets/ui_asset_accessor.h"
 #include "nau/diag/assertion.h"
+#include "nau/diag/logging.h"
 #include "nau/math/dag_color.h"
 #include "nau/math/math.h"
 #include "nau/ui/elements/layer.h"
@@ -17,6 +18,10 @@
 #include "nau/ui/scroll.h"
 #include "nau/animation/playback/animation_instance.h"
 
+#include "2d/CCSpriteFrameCache.h"
+#include "base/CCDirector.h"
+#include "renderer/CCTextureCache.h"
+
 namespace nau::ui::data
 {
     namespace
@@ -247,16 +252,44 @@ namespace nau::ui::data
         UiAssetView* instance = instancePtr.get();
 
         co_await uiSceneAccessor.copyUiElements(instance->m_uiElementsData);
+        co_await uiSceneAccessor.copyUiAtlases(instance->m_uiAtlasesData);
 
         co_return instancePtr;
     }
 
     void UiAssetView::createUi(Canvas* uiCanvas) const
     {
+        registerAtlasFrames();
+
         for (const auto& elementData : m_uiElementsData)
         {
             createUiNodeHierarchy(uiCanvas, elementData);
         }
     }
 
+    void UiAssetView::registerAtlasFrames() const
+    {
+        cocos2d::SpriteFrameCache* frameCache = cocos2d::SpriteFrameCache::getInstance();
+
+        for (const auto& atlasData : m_uiAtlasesData)
+        {
+            // the missing atlas is not fatal: the sprites load their images as is
+            cocos2d::Texture2D* texture = cocos2d::Director::getInstance()->getTextureCache()->addImage(atlasData.imageFileName.c_str());
+            if (!texture)
+            {
+                NAU_LOG_ERROR("Failed to load UI atlas:{}", atlasData.imageFileName);
+                continue;
+            }
+
+            for (const auto& frameData : atlasData.frames)
+            {
+                const cocos2d::Rect rect(frameData.rect.getX(), frameData.rect.getY(), frameData.rect.getZ(), frameData.rect.getW());
+                if (cocos2d::SpriteFrame* frame = cocos2d::SpriteFrame::createWithTexture(texture, CC_RECT_PIXELS_TO_POINTS(rect)))
+                {
+                    frameCache->addSpriteFrame(frame, frameData.name.c_str());
+                }
+            }
+        }
+    }
+
 } // namespace nau::ui::data
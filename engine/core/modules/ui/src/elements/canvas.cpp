@@ -4,9 +4,12 @@
 
 #include "nau/ui/elements/canvas.h"
 #include "CCDirector.h"
+#include "2d/CCRenderTexture.h"
+#include "2d/CCSprite.h"
 #include "EASTL/algorithm.h"
 #include "math/Vec2.h"
 #include "nau/diag/assertion.h"
+#include "nau/diag/logging.h"
 #include "nau/math/math.h"
 
 
@@ -16,7 +19,10 @@ const eastl::string Canvas::DEFAULT_NAME = "[unnamed]";
 
 Canvas::Canvas(const eastl::string& name) : m_canvasName(name) {}
 
-Canvas::~Canvas() {}
+Canvas::~Canvas()
+{
+    releaseRenderCache();
+}
 
 Canvas* Canvas::create(math::vec2 size, RescalePolicy rescale)
 {
@@ -62,6 +68,84 @@ math::vec2 Canvas::getReferenceSize() const
     return m_size;
 }
 
+void Canvas::setRenderCacheEnabled(bool enabled)
+{
+    m_isRenderCacheEnabled = enabled;
+    m_isRenderCacheValid = false;
+    if (!enabled)
+    {
+        releaseRenderCache();
+    }
+}
+
+bool Canvas::isRenderCacheEnabled() const
+{
+    return m_isRenderCacheEnabled;
+}
+
+void Canvas::invalidateRenderCache()
+{
+    m_isRenderCacheValid = false;
+}
+
+void Canvas::visit(cocos2d::Renderer* renderer, const cocos2d::Mat4& parentTransform, uint32_t parentFlags)
+{
+    if (!m_isRenderCacheEnabled || !_visible)
+    {
+        cocos2d::Node::visit(renderer, parentTransform, parentFlags);
+        return;
+    }
+
+    // The cached image is in the screen space: it is outdated by the canvas placement change as well
+    const cocos2d::Size winSize = cocos2d::Director::getInstance()->getWinSize();
+    if (m_renderCache && !m_renderCache->getSprite()->getContentSize().equals(winSize))
+    {
+        releaseRenderCache();
+    }
+    if (!m_renderCache)
+    {
+        m_renderCache = cocos2d::RenderTexture::create(
+            static_cast<int>(winSize.width),
+            static_cast<int>(winSize.height),
+            cocos2d::backend::PixelFormat::RGBA8888,
+            cocos2d::backend::PixelFormat::D24S8);
+        if (!m_renderCache)
+        {
+            NAU_LOG_WARNING("UI: Failed to create the render cache of canvas {}", m_canvasName);
+            m_isRenderCacheEnabled = false;
+            cocos2d::Node::visit(renderer, parentTransform, parentFlags);
+            return;
+        }
+
+        m_renderCache->retain();
+        m_renderCache->setPosition(winSize.width * 0.5f, winSize.height * 0.5f);
+        // The elements are blended into the transparent texture: its colors are premultiplied by alpha
+        m_renderCache->getSprite()->setBlendFunc(cocos2d::BlendFunc::ALPHA_PREMULTIPLIED);
+        m_isRenderCacheValid = false;
+    }
+
+    if ((parentFlags & FLAGS_DIRTY_MASK) || _transformUpdated || _contentSizeDirty)
+    {
+        m_isRenderCacheValid = false;
+    }
+
+    if (!m_isRenderCacheValid)
+    {
+        m_renderCache->beginWithClear(0.f, 0.f, 0.f, 0.f, 1.f, 0);
+        cocos2d::Node::visit(renderer, parentTransform, parentFlags);
+        m_renderCache->end();
+        m_isRenderCacheValid = true;
+    }
+
+    m_renderCache->visit(renderer, parentTransform, parentFlags);
+}
+
+void Canvas::releaseRenderCache()
+{
+    CC_SAFE_RELEASE_NULL(m_renderCache);
+    m_isRenderCacheValid = false;
+}
+
 RescalePolicy Canvas::getRescalePolicy() const
 {
     return m_rescale;
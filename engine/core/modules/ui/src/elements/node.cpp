@@ -453,10 +453,19 @@ nau::Ptr<UiNodeAnimator> Node::createAnimator()
     return rtti::createInstance<UiNodeAnimator>(*this);
 }
 
+void Node::invalidateRenderCache()
+{
+    if (Node* parent = getParent())
+    {
+        parent->invalidateRenderCache();
+    }
+}
+
 #if NAU_UI_CALLBACK_ON_ELEMNT_CHANGE
 void Node::markDirty()
 {
     m_dirty = true;
+    invalidateRenderCache();
 }
 
 void Node::markClean()
@@ -469,7 +478,7 @@ bool Node::isDirty() const
     return m_dirty;
 }
 #else
-void Node::markDirty() {}
+void Node::markDirty() { invalidateRenderCache(); }
 void Node::markClean() {}
 bool Node::isDirty() const { return false; }
 #endif
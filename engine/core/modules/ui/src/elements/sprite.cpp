@@ -6,6 +6,7 @@
 #include "../nau_controls/Button/States/sprite_frame_handler.h"
 #include "../nau_controls/Label/texture_2d_handler.h"
 #include "2d/CCSprite.h"
+#include "2d/CCSpriteFrameCache.h"
 
 
 namespace nau::ui
@@ -52,6 +53,12 @@ bool Sprite::initWithTexture2dContainer(const Texture2DHandler& container)
 
 bool Sprite::initWithFile(const eastl::string& filename)
 {
+    // the image packed to the UI atlas is drawn from the atlas, the sprites sharing it are batched
+    if (cocos2d::SpriteFrame* frame = cocos2d::SpriteFrameCache::getInstance()->getSpriteFrameByName(filename.c_str()))
+    {
+        return initWithSpriteFrame(frame);
+    }
+
     return cocos2d::Sprite::initWithFile(filename.c_str());
 }
 
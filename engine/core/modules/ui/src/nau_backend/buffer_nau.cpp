@@ -26,12 +26,16 @@
 
 #include "buffer_nau.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cstring>
 
 #include "base/CCDirector.h"
 #include "base/CCEventDispatcher.h"
 #include "base/CCEventType.h"
 #include "base/ccMacros.h"
+#include "device_nau.h"
+#include "dynamic_buffer_ring_nau.h"
 
 DAGOR_CC_BACKEND_BEGIN
 
@@ -78,12 +82,19 @@ namespace
 BufferNau::BufferNau(std::size_t size, cocos2d::backend::BufferType type, cocos2d::backend::BufferUsage usage) :
     Buffer(size, type, usage)
 {
+    if (usage == cocos2d::backend::BufferUsage::DYNAMIC)
+    {
+        _ring = &static_cast<DeviceNau*>(cocos2d::backend::Device::getInstance())->getDynamicBufferRing(type);
+        _data.resize(size);
+        return;
+    }
+
     _buffer = d3d::create_sbuffer(0, size, toNauUsage(usage) | toNauType(type), 0, toNauBufferNameType(type));
 }
 
 BufferNau::~BufferNau()
 {
-    if (_buffer)
+    if (_buffer && !_ring)
     {
         _buffer->destroy();
     }
@@ -98,14 +109,49 @@ void BufferNau::updateData(void* data, std::size_t size)
 {
     NAU_ASSERT(size && size <= _size);
 
+    if (_ring)
+    {
+        memcpy(_data.data(), data, size);
+        _dataSize = size;
+        _isDirty = true;
+        return;
+    }
+
     _buffer->updateData(0, size, data, VBLOCK_WRITEONLY);
 }
 
 void BufferNau::updateSubData(void* data, std::size_t offset, std::size_t size)
 {
-    NAU_ASSERT(size && size <= _size);
+    NAU_ASSERT(size && offset + size <= _size);
+
+    if (_ring)
+    {
+        memcpy(_data.data() + offset, data, size);
+        _dataSize = std::max(_dataSize, offset + size);
+        _isDirty = true;
+        return;
+    }
 
     _buffer->updateData(offset, size, data, VBLOCK_WRITEONLY);
 }
 
+bool BufferNau::needsCommit() const
+{
+    // The ring discard loses the data appended before: it is appended once more.
+    return _ring && _dataSize > 0 && (_isDirty || _ringGeneration != _ring->getGeneration());
+}
+
+void BufferNau::commit()
+{
+    if (!needsCommit())
+    {
+        return;
+    }
+
+    _offset = _ring->append(_data.data(), _dataSize);
+    _buffer = _ring->getHandler();
+    _ringGeneration = _ring->getGeneration();
+    _isDirty = false;
+}
+
 DAGOR_CC_BACKEND_END
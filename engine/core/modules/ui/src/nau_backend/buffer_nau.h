@@ -35,8 +35,12 @@
 
 DAGOR_CC_BACKEND_BEGIN
 
+class DynamicBufferRingNau;
+
 /**
  * Store vertex and index data.
+ * The dynamic buffers keep the data on the CPU and append it to the ring shared by all the dynamic buffers of the type on commit,
+ * so the updates never overwrite the data of the draws recorded before.
  */
 class BufferNau : public cocos2d::backend::Buffer
 {
@@ -73,15 +77,35 @@ public:
      */
     virtual void usingDefaultStoredData(bool needDefaultStoredData) override;
 
+    /**
+     * Append the data updated since the last commit to the ring, no-op for the static buffers.
+     * The handler and the offset are valid until the next commit.
+     */
+    void commit();
+
+    /**
+     * Check whether commit() appends the data: the draws recorded with the previous data have to be issued before.
+     */
+    bool needsCommit() const;
+
     /**
      * Get buffer object.
-     * @return Buffer object.
+     * @return Buffer object, the ring buffer for the dynamic buffers.
      */
     inline Sbuffer* getHandler() const
     {
         return _buffer;
     }
 
+    /**
+     * Get the data offset in the buffer object.
+     * @return Offset in bytes, always 0 for the static buffers.
+     */
+    inline std::size_t getOffset() const
+    {
+        return _offset;
+    }
+
 private:
 #if CC_ENABLE_CACHE_TEXTURE_DATA
     void reloadBuffer();
@@ -92,6 +116,13 @@ private:
 #endif
 
     Sbuffer* _buffer = nullptr;
+    std::size_t _offset = 0;
+
+    DynamicBufferRingNau* _ring = nullptr;
+    std::vector<uint8_t> _data;
+    std::size_t _dataSize = 0;
+    uint32_t _ringGeneration = 0;
+    bool _isDirty = false;
 };
 
 DAGOR_CC_BACKEND_END
@@ -28,7 +28,10 @@
 
 #include <nau/math/dag_color.h>
 
+#include <EASTL/sort.h>
+
 #include <algorithm>
+#include <cstring>
 
 #include "base/CCDirector.h"
 #include "base/CCEventDispatcher.h"
@@ -80,6 +83,22 @@ namespace
                 return;
         }
     }
+
+    // Slot ordered, as the unordered texture infos of the equal program states can be iterated in the different orders.
+    void collectTextures(ProgramState* programState, eastl::vector<eastl::pair<int, TextureBackend*>>& textures)
+    {
+        textures.clear();
+        for (const auto& [location, texture] : programState->getVertexTextureInfos())
+        {
+            textures.emplace_back(texture.slot[0], texture.textures[0]);
+        }
+        eastl::sort(textures.begin(), textures.end());
+    }
+
+    bool hasClear(const RenderPassDescriptor& descriptor)
+    {
+        return descriptor.needClearColor || descriptor.needClearDepth || descriptor.needClearStencil;
+    }
 }  // namespace
 
 CommandBufferNau::CommandBufferNau()
@@ -94,11 +113,21 @@ CommandBufferNau::~CommandBufferNau()
 
 void CommandBufferNau::beginFrame(BaseTexture* backBuffer)
 {
+    flushPendingDraw();
+
     m_backBuffer = backBuffer;
+    // The scene rendering between the frames changes the scissor.
+    _isScissorRectKnown = false;
 }
 
 void CommandBufferNau::beginRenderPass(const RenderPassDescriptor& descirptor)
 {
+    // The same targets are bound again without breaking the pending draw.
+    if (hasClear(descirptor) || !(descirptor == _pendingDraw.renderPass))
+    {
+        flushPendingDraw();
+    }
+
     applyRenderPassDescriptor(descirptor);
 }
 
@@ -142,6 +171,11 @@ void CommandBufferNau::applyRenderPassDescriptor(const RenderPassDescriptor& des
 
     // set clear, depth and stencil
     int clearMask = 0;
+    if (descirptor.needClearColor && useColorAttachmentExternal)
+    {
+        // Render to texture (e.g. the cached canvas) starts from the cleared target
+        clearMask |= CLEAR_TARGET;
+    }
     if (descirptor.needClearDepth)
     {
         clearMask |= CLEAR_ZBUFFER;
@@ -217,6 +251,9 @@ void CommandBufferNau::setProgramState(ProgramState* programState)
 
 void CommandBufferNau::drawArrays(PrimitiveType primitiveType, std::size_t start, std::size_t count)
 {
+    flushPendingDraw();
+    commitBuffers();
+
     prepareDrawing();
     d3d::draw(cocos_utils::toNauPrimitiveType(primitiveType), start, cocos_utils::toNauPrimitiveCountFromVertexCount(count, primitiveType));
     cleanResources();
@@ -226,18 +263,134 @@ void CommandBufferNau::drawElements(PrimitiveType primitiveType, IndexFormat ind
 {
     NAU_ASSERT(indexType != IndexFormat::U_INT, "int32 indexes are unsupported. It should be part of buffers description.");
 
+    commitBuffers();
+
+    const std::size_t startIndex = (_indexBuffer->getOffset() + offset) / sizeof(uint16_t);
+    const shaders::RenderState renderState = makeRenderState();
+
+    if (canMergeDraw(primitiveType, startIndex, renderState))
+    {
+        _pendingDraw.indexCount += count;
+        cleanResources();
+        return;
+    }
+
+    flushPendingDraw();
+
     prepareDrawing();
-    d3d::setind(_indexBuffer->getHandler());
-    d3d::drawind(cocos_utils::toNauPrimitiveType(primitiveType), offset / sizeof(uint16_t), cocos_utils::toNauPrimitiveCountFromVertexCount(count, primitiveType), 0);
+    recordPendingDraw(primitiveType, startIndex, count, renderState);
     cleanResources();
 }
 
+void CommandBufferNau::commitBuffers()
+{
+    const bool needsCommit = (_vertexBuffer && _vertexBuffer->needsCommit()) || (_indexBuffer && _indexBuffer->needsCommit());
+    if (!needsCommit)
+    {
+        return;
+    }
+
+    // The ring discard on append replaces the data the pending draw reads.
+    flushPendingDraw();
+
+    if (_vertexBuffer)
+    {
+        _vertexBuffer->commit();
+    }
+    if (_indexBuffer)
+    {
+        _indexBuffer->commit();
+    }
+}
+
+bool CommandBufferNau::canMergeDraw(PrimitiveType primitiveType, std::size_t startIndex, const shaders::RenderState& renderState) const
+{
+    // The strips can not be concatenated.
+    if (!_pendingDraw.isActive || primitiveType != _pendingDraw.primitiveType ||
+        (primitiveType != PrimitiveType::TRIANGLE && primitiveType != PrimitiveType::LINE))
+    {
+        return false;
+    }
+
+    if (startIndex != _pendingDraw.startIndex + _pendingDraw.indexCount ||
+        _vertexBuffer->getHandler() != _pendingDraw.vertexBuffer || _vertexBuffer->getOffset() != _pendingDraw.vertexOffset ||
+        _programState->getVertexLayout()->getStride() != _pendingDraw.vertexStride || _indexBuffer->getHandler() != _pendingDraw.indexBuffer)
+    {
+        return false;
+    }
+
+    // The pipeline render pass is applied on every draw: its clears can not be skipped.
+    const RenderPassDescriptor& renderPass = _renderPipeline->m_renderPassDescriptor;
+    if (!(renderState == _pendingDraw.renderState) || !(_viewPort == _pendingDraw.viewport) ||
+        hasClear(renderPass) || !(renderPass == _pendingDraw.renderPass))
+    {
+        return false;
+    }
+
+    ProgramState* programState = _renderPipeline->getProgramState();
+    if (programState->getProgram() != _pendingDraw.program)
+    {
+        return false;
+    }
+
+    char* uniforms;
+    std::size_t uniformsSize;
+    programState->getVertexUniformBuffer(&uniforms, uniformsSize);
+    if (uniformsSize != _pendingDraw.uniforms.size() || memcmp(uniforms, _pendingDraw.uniforms.data(), uniformsSize) != 0)
+    {
+        return false;
+    }
+
+    eastl::vector<eastl::pair<int, TextureBackend*>> textures;
+    collectTextures(programState, textures);
+
+    return textures == _pendingDraw.textures;
+}
+
+void CommandBufferNau::recordPendingDraw(PrimitiveType primitiveType, std::size_t startIndex, std::size_t count, const shaders::RenderState& renderState)
+{
+    ProgramState* programState = _renderPipeline->getProgramState();
+
+    _pendingDraw.isActive = true;
+    _pendingDraw.primitiveType = primitiveType;
+    _pendingDraw.startIndex = startIndex;
+    _pendingDraw.indexCount = count;
+    _pendingDraw.vertexBuffer = _vertexBuffer->getHandler();
+    _pendingDraw.vertexOffset = _vertexBuffer->getOffset();
+    _pendingDraw.vertexStride = _programState->getVertexLayout()->getStride();
+    _pendingDraw.indexBuffer = _indexBuffer->getHandler();
+    _pendingDraw.program = programState->getProgram();
+    _pendingDraw.renderState = renderState;
+    _pendingDraw.viewport = _viewPort;
+    _pendingDraw.renderPass = _renderPipeline->m_renderPassDescriptor;
+
+    char* uniforms;
+    std::size_t uniformsSize;
+    programState->getVertexUniformBuffer(&uniforms, uniformsSize);
+    _pendingDraw.uniforms.assign(uniforms, uniforms + uniformsSize);
+
+    collectTextures(programState, _pendingDraw.textures);
+}
+
+void CommandBufferNau::flushPendingDraw()
+{
+    if (!_pendingDraw.isActive)
+    {
+        return;
+    }
+
+    d3d::drawind(cocos_utils::toNauPrimitiveType(_pendingDraw.primitiveType), _pendingDraw.startIndex,
+                 cocos_utils::toNauPrimitiveCountFromVertexCount(_pendingDraw.indexCount, _pendingDraw.primitiveType), 0);
+    _pendingDraw.isActive = false;
+}
+
 void CommandBufferNau::endRenderPass()
 {
 }
 
 void CommandBufferNau::endFrame()
 {
+    flushPendingDraw();
 }
 
 void CommandBufferNau::setDepthStencilState(DepthStencilState* depthStencilState)
@@ -250,11 +403,8 @@ void CommandBufferNau::setDepthStencilState(DepthStencilState* depthStencilState
     }
 }
 
-void CommandBufferNau::prepareDrawing()
+shaders::RenderState CommandBufferNau::makeRenderState() const
 {
-    bindVertexBuffer();
-    bindIndexBuffer();
-
     shaders::RenderState rendState;
     rendState.cull = cocos_utils::toNauCullMode(_cullMode);
 
@@ -270,6 +420,17 @@ void CommandBufferNau::prepareDrawing()
         rendState.ztest = 0;
     }
 
+    _renderPipeline->applyBlendState(rendState);
+
+    return rendState;
+}
+
+void CommandBufferNau::prepareDrawing()
+{
+    bindVertexBuffer();
+    bindIndexBuffer();
+
+    shaders::RenderState rendState = makeRenderState();
     _renderPipeline->apply(rendState);
 
     applyRenderPassDescriptor(_renderPipeline->m_renderPassDescriptor);
@@ -301,7 +462,7 @@ void CommandBufferNau::bindVertexBuffer() const
     if (!vertexLayout->isValid())
         return;
 
-    d3d::setvsrc_ex(0, _vertexBuffer->getHandler(), 0, vertexLayout->getStride());
+    d3d::setvsrc_ex(0, _vertexBuffer->getHandler(), _vertexBuffer->getOffset(), vertexLayout->getStride());
 }
 
 void CommandBufferNau::bindIndexBuffer() const
@@ -330,18 +491,28 @@ void CommandBufferNau::setLineWidth(float lineWidth)
 
 void CommandBufferNau::setScissorRect(bool isEnabled, float x, float y, float width, float height)
 {
+    Viewport scissorRect = _viewPort;
     if (isEnabled)
     {
-        d3d::setscissor(x, y, width, height);
+        scissorRect = {static_cast<int>(x), static_cast<int>(y), static_cast<unsigned int>(width), static_cast<unsigned int>(height)};
     }
-    else
+
+    if (_isScissorRectKnown && scissorRect == _scissorRect)
     {
-        d3d::setscissor(_viewPort.x, _viewPort.y, _viewPort.w, _viewPort.h);
+        return;
     }
+
+    flushPendingDraw();
+
+    d3d::setscissor(scissorRect.x, scissorRect.y, scissorRect.w, scissorRect.h);
+    _scissorRect = scissorRect;
+    _isScissorRectKnown = true;
 }
 
 void CommandBufferNau::captureScreen(std::function<void(const unsigned char*, int, int)> callback)
 {
+    flushPendingDraw();
+
     ::TextureInfo info;
     d3d::get_backbuffer_tex()->getinfo(info, 0);
 
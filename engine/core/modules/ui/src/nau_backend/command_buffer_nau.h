@@ -31,6 +31,7 @@
 #include "base/CCEventListenerCustom.h"
 
 #include "nau/3d/dag_drv3d.h"
+#include "nau/3d/dag_renderStates.h"
 
 #include "CCStdC.h"
 
@@ -175,9 +176,42 @@ private:
         int y = 0;
         unsigned int w = 0;
         unsigned int h = 0;
+
+        bool operator==(const Viewport& other) const
+        {
+            return x == other.x && y == other.y && w == other.w && h == other.h;
+        }
     };
-    
+
+    /**
+     * The indexed draw with its state already bound. It is issued on the first state change:
+     * the next draw with the same state and the index range following its range extends it instead.
+     */
+    struct PendingDraw
+    {
+        bool isActive = false;
+        cocos2d::backend::PrimitiveType primitiveType = cocos2d::backend::PrimitiveType::TRIANGLE;
+        std::size_t startIndex = 0;
+        std::size_t indexCount = 0;
+
+        Sbuffer* vertexBuffer = nullptr;
+        std::size_t vertexOffset = 0;
+        std::size_t vertexStride = 0;
+        Sbuffer* indexBuffer = nullptr;
+        cocos2d::backend::Program* program = nullptr;
+        shaders::RenderState renderState;
+        Viewport viewport;
+        cocos2d::backend::RenderPassDescriptor renderPass;
+        eastl::vector<eastl::pair<int, cocos2d::backend::TextureBackend*>> textures;
+        eastl::vector<char> uniforms;
+    };
+
     void prepareDrawing();
+    shaders::RenderState makeRenderState() const;
+    void commitBuffers();
+    bool canMergeDraw(cocos2d::backend::PrimitiveType primitiveType, std::size_t startIndex, const shaders::RenderState& renderState) const;
+    void recordPendingDraw(cocos2d::backend::PrimitiveType primitiveType, std::size_t startIndex, std::size_t count, const shaders::RenderState& renderState);
+    void flushPendingDraw();
     void bindVertexBuffer() const;
     void bindIndexBuffer() const;
     void cleanResources();
@@ -200,6 +234,10 @@ private:
 
     eastl::vector<eastl::pair<shaders::RenderState, shaders::DriverRenderStateId>> cachedRS;
 
+    PendingDraw _pendingDraw;
+    Viewport _scissorRect;
+    bool _isScissorRectKnown = false;
+
 };
 
 DAGOR_CC_BACKEND_END
@@ -111,4 +111,9 @@ Program* DeviceNau::newProgram(const std::string& vertexShader, const std::strin
     return new (std::nothrow) ProgramNau(vertexShader, fragmentShader);
 }
 
+DynamicBufferRingNau& DeviceNau::getDynamicBufferRing(BufferType type)
+{
+    return type == BufferType::INDEX ? _indexRing : _vertexRing;
+}
+
 DAGOR_CC_BACKEND_END
@@ -24,6 +24,7 @@
  ****************************************************************************/
 
 
+#include "dynamic_buffer_ring_nau.h"
 #include "renderer/backend/Device.h"
 #include "nau/rtti/rtti_impl.h"
 #include "nau/service/service.h"
@@ -102,6 +103,13 @@ public:
      */
     virtual cocos2d::backend::Program* newProgram(const std::string& vertexShader, const std::string& fragmentShader) override;
 
+    /**
+     * Get the ring shared by the dynamic buffers of the type.
+     * @param type Specifies the buffer type, BufferType::VERTEX or BufferType::INDEX.
+     * @return The ring the dynamic buffers data is appended to.
+     */
+    DynamicBufferRingNau& getDynamicBufferRing(cocos2d::backend::BufferType type);
+
 protected:
     /**
      * New a shaderModule, not auto released.
@@ -113,6 +121,13 @@ protected:
     {
         return nullptr;
     };
+
+private:
+    static constexpr std::size_t VertexRingCapacity = 4 * 1024 * 1024;
+    static constexpr std::size_t IndexRingCapacity = 1024 * 1024;
+
+    DynamicBufferRingNau _vertexRing{cocos2d::backend::BufferType::VERTEX, VertexRingCapacity};
+    DynamicBufferRingNau _indexRing{cocos2d::backend::BufferType::INDEX, IndexRingCapacity};
 };
 
 DAGOR_CC_BACKEND_END
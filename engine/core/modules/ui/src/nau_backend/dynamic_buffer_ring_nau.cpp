@@ -0,0 +1,73 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "dynamic_buffer_ring_nau.h"
+
+DAGOR_CC_BACKEND_BEGIN
+
+DynamicBufferRingNau::DynamicBufferRingNau(cocos2d::backend::BufferType type, std::size_t capacity) :
+    _type(type),
+    _capacity(capacity)
+{
+}
+
+DynamicBufferRingNau::~DynamicBufferRingNau()
+{
+    if (_buffer)
+    {
+        _buffer->destroy();
+    }
+    _buffer = nullptr;
+}
+
+void DynamicBufferRingNau::createBuffer(std::size_t capacity)
+{
+    if (_buffer)
+    {
+        _buffer->destroy();
+    }
+
+    const SBCF bindFlag = _type == cocos2d::backend::BufferType::INDEX ? SBCF_BIND_INDEX : SBCF_BIND_VERTEX;
+    _buffer = d3d::create_sbuffer(0, capacity, SBCF_DYNAMIC | bindFlag, 0, _type == cocos2d::backend::BufferType::INDEX ? u8"UiIndexRing" : u8"UiVertexRing");
+    NAU_FATAL(_buffer);
+
+    _capacity = capacity;
+    _position = 0;
+}
+
+std::size_t DynamicBufferRingNau::append(const void* data, std::size_t size)
+{
+    NAU_ASSERT(size > 0);
+
+    if (!_buffer)
+    {
+        createBuffer(_capacity);
+    }
+
+    const std::size_t offset = (_position + Alignment - 1) & ~(Alignment - 1);
+    if (offset + size > _capacity)
+    {
+        ++_generation;
+
+        if (size > _capacity)
+        {
+            std::size_t capacity = _capacity * 2;
+            while (capacity < size)
+            {
+                capacity *= 2;
+            }
+            createBuffer(capacity);
+        }
+
+        _buffer->updateData(0, size, data, VBLOCK_WRITEONLY | VBLOCK_DISCARD);
+        _position = size;
+        return 0;
+    }
+
+    _buffer->updateData(offset, size, data, VBLOCK_WRITEONLY | (offset == 0 ? VBLOCK_DISCARD : VBLOCK_NOOVERWRITE));
+    _position = offset + size;
+    return offset;
+}
+
+DAGOR_CC_BACKEND_END
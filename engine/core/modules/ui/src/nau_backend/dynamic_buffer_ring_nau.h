@@ -0,0 +1,59 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include "renderer/backend/Macros.h"
+#include "renderer/backend/Types.h"
+#include "nau/3d/dag_drv3d.h"
+
+DAGOR_CC_BACKEND_BEGIN
+
+/**
+ * Ring of the dynamic vertex or index data shared by all the dynamic ui buffers.
+ * The data is appended with no-overwrite after the previous appends, so the draws already issued keep reading their data.
+ * The ring is discarded when the data does not fit the rest of it: the data offsets of the previous appends become invalid then.
+ */
+class DynamicBufferRingNau
+{
+public:
+    DynamicBufferRingNau(cocos2d::backend::BufferType type, std::size_t capacity);
+    DynamicBufferRingNau(const DynamicBufferRingNau&) = delete;
+    ~DynamicBufferRingNau();
+
+    DynamicBufferRingNau& operator=(const DynamicBufferRingNau&) = delete;
+
+    /**
+     * The ring buffer is created on the first append.
+     * The ring grows when the data is bigger than its capacity.
+     * @return Byte offset of the data in the ring buffer.
+     */
+    std::size_t append(const void* data, std::size_t size);
+
+    inline Sbuffer* getHandler() const
+    {
+        return _buffer;
+    }
+
+    /**
+     * Incremented on every discard: the data appended with the other generation has to be appended again.
+     */
+    inline uint32_t getGeneration() const
+    {
+        return _generation;
+    }
+
+private:
+    static constexpr std::size_t Alignment = 16;
+
+    void createBuffer(std::size_t capacity);
+
+    cocos2d::backend::BufferType _type;
+    Sbuffer* _buffer = nullptr;
+    std::size_t _capacity = 0;
+    std::size_t _position = 0;
+    uint32_t _generation = 0;
+};
+
+DAGOR_CC_BACKEND_END
@@ -41,7 +41,7 @@ void RenderPipelineNau::update(const cocos2d::PipelineDescriptor& pipelineDescir
     m_renderPassDescriptor = renderpassDescriptor;
 }
 
-void RenderPipelineNau::apply(shaders::RenderState& renderState)
+void RenderPipelineNau::applyBlendState(shaders::RenderState& renderState) const
 {
     renderState.colorWr = cocos_utils::toNauWriteMask(m_pipelineDescriptor.blendDescriptor.writeMask);
 
@@ -59,6 +59,11 @@ void RenderPipelineNau::apply(shaders::RenderState& renderState)
             blendParam.sepablendFactors.dst = cocos_utils::toNauBlendFactor(m_pipelineDescriptor.blendDescriptor.destinationAlphaBlendFactor);
         }
     }
+}
+
+void RenderPipelineNau::apply(shaders::RenderState& renderState)
+{
+    applyBlendState(renderState);
 
     ProgramNau* program = dynamic_cast<ProgramNau*>(m_pipelineDescriptor.programState->getProgram());
     NAU_ASSERT(program != nullptr);
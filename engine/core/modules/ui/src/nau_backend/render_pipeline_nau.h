@@ -53,8 +53,21 @@ public:
 
     virtual void update(const cocos2d::PipelineDescriptor& pipelineDescirptor, const cocos2d::backend::RenderPassDescriptor& renderpassDescriptor) override;
 
+    /**
+     * Fill the blend and the color write state of the pipeline.
+     */
+    void applyBlendState(shaders::RenderState& renderState) const;
+
+    /**
+     * Fill the blend state, bind the program, the uniforms and the textures.
+     */
     void apply(shaders::RenderState& renderState);
 
+    inline cocos2d::backend::ProgramState* getProgramState() const
+    {
+        return m_pipelineDescriptor.programState;
+    }
+
     cocos2d::backend::RenderPassDescriptor m_renderPassDescriptor;
 
     ~RenderPipelineNau() override;
@@ -5,6 +5,7 @@
 #include "button_state_base.h"
 
 #include "2d/CCSpriteFrame.h"
+#include "2d/CCSpriteFrameCache.h"
 #include "nau/ui/button.h"
 #include <sstream>
 #include "base/CCDirector.h"
@@ -22,6 +23,15 @@ namespace nau::ui
 
     bool ButtonStateBase::tryCreateStateSpriteFrame(const std::string& filePath)
     {
+        // the image packed to the UI atlas
+        if (cocos2d::SpriteFrame* atlasFrame = cocos2d::SpriteFrameCache::getInstance()->getSpriteFrameByName(filePath))
+        {
+            m_stateSpriteFrame = atlasFrame;
+            CC_SAFE_RETAIN(m_stateSpriteFrame);
+
+            return true;
+        }
+
         cocos2d::Texture2D* texture = cocos2d::Director::getInstance()->getTextureCache()->addImage(filePath);
         if (!texture)
         {
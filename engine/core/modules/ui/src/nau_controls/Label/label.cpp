@@ -4,9 +4,12 @@
 #include "nau/ui/label.h"
 
 #include "texture_2d_handler.h"
+#include "text_layout_cache.h"
 #include "../src/nau_controls/rich_text/rich_text_lexer.h"
 #include "../src/nau_controls/rich_text/rich_text_helper.h"
 
+#include <string_view>
+
 #include "base/ccUTF8.h"
 #include "2d/CCFontAtlasCache.h"
 #include "2d/CCLabel.h"
@@ -58,6 +61,7 @@ void NauLabel::setText(const eastl::string& text)
 
     m_utf32Text.clear();
     utf8::utf8to32(text.begin(), text.end(), std::back_inserter(m_utf32Text));
+    m_utf32TextHash = std::hash<std::u32string_view>{}(std::u32string_view(m_utf32Text.data(), m_utf32Text.size()));
 
     updateLabel();
 }
@@ -80,20 +84,45 @@ void NauLabel::updateLabel()
     {
         return;
     }
-    if (!m_symbolFactory->warmUpSymbosCache(m_utf32Text))
-    {
-        NAU_LOG_ERROR("Label symbols warm up error");
-    }
 
-    const TextDefinition& textDefinitions = calculateTextDefinition(m_utf32Text);
+    m_textLayout = getTextLayout();
 
-    drawText(textDefinitions.lineDefinitions, textDefinitions.totalTextHeight);
+    drawText(m_textLayout->lineDefinitions, m_textLayout->totalTextHeight);
 
 #if UI_ELEMENT_DEBUG
     debugDrawlContetnSize();
 #endif
 }
 
+eastl::shared_ptr<const TextDefinition> NauLabel::getTextLayout()
+{
+    // the width affects the layout only through the wrapping
+    const TextLayoutCache::Key key
+    {
+        m_utf32TextHash,
+        m_symbolFactory->getFontsHash(),
+        m_wrapping != Wrapping::disable ? _contentSize.width : 0.0f,
+        static_cast<int>(m_wrapping),
+        m_isRichText
+    };
+
+    TextLayoutCache& layoutCache = TextLayoutCache::getInstance();
+    if (auto layout = layoutCache.find(key, m_utf32Text))
+    {
+        return layout;
+    }
+
+    if (!m_symbolFactory->warmUpSymbosCache(m_utf32Text))
+    {
+        NAU_LOG_ERROR("Label symbols warm up error");
+    }
+
+    auto layout = eastl::make_shared<const TextDefinition>(calculateTextDefinition(m_utf32Text));
+    layoutCache.add(key, m_utf32Text, layout);
+
+    return layout;
+}
+
 void NauLabel::enableRichText(bool enable)
 {
     markDirty();
@@ -407,28 +436,51 @@ void NauLabel::setLetterColor(Sprite* letterSprite, const SymbolParams& params)
     letterSprite->setOpacity(colorData.Opacity);
 }
 
+void NauLabel::updateLettersColor()
+{
+    if (!m_textLayout || !m_isRichText)
+    {
+        return;
+    }
+
+    // the sprites are assigned in the order of the layout symbols (see drawText)
+    size_t letterIndex = 0;
+    for (const TextLineDefinition& line : m_textLayout->lineDefinitions)
+    {
+        for (const SymbolDefinition& symbol : line.symbolDefinitions)
+        {
+            if (letterIndex < m_spriteCache.size() && symbol.richParams.Image.empty() && m_spriteCache[letterIndex]->isVisible())
+            {
+                setLetterColor(m_spriteCache[letterIndex], symbol.richParams);
+            }
+
+            letterIndex++;
+        }
+    }
+}
+
 void NauLabel::setColor(const nau::math::E3DCOLOR& color)
 {
     Node::setColor(color);
-    updateLabel();
+    updateLettersColor();
 }
 
 void NauLabel::setOpacity(uint8_t opacity)
 {
     Node::setOpacity(opacity);
-    updateLabel();
+    updateLettersColor();
 }
 
 void NauLabel::setCascadeColorEnabled(bool cascadeColorEnabled)
 {
     Node::setCascadeColorEnabled(cascadeColorEnabled);
-    updateLabel();
+    updateLettersColor();
 }
 
 void NauLabel::setCascadeOpacityEnabled(bool cascadeOpacityEnabled)
 {
     Node::setCascadeOpacityEnabled(cascadeOpacityEnabled);
-    updateLabel();
+    updateLettersColor();
 }
 
 
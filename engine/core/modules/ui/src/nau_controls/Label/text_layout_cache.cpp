@@ -0,0 +1,72 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#include "text_layout_cache.h"
+
+#include <functional>
+
+namespace nau::ui
+{
+
+size_t TextLayoutCache::KeyHash::operator()(const Key& key) const
+{
+    size_t hash = key.textHash;
+    const auto combine = [&hash](size_t value)
+    {
+        hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    };
+
+    combine(key.fontsHash);
+    combine(std::hash<float>{}(key.width));
+    combine(static_cast<size_t>(key.wrapping));
+    combine(static_cast<size_t>(key.isRichText));
+
+    return hash;
+}
+
+TextLayoutCache& TextLayoutCache::getInstance()
+{
+    static TextLayoutCache cache;
+    return cache;
+}
+
+eastl::shared_ptr<const TextDefinition> TextLayoutCache::find(const Key& key, const eastl::u32string& text)
+{
+    auto it = m_current.find(key);
+    if (it != m_current.end())
+    {
+        // the hashes can collide: the text itself is compared
+        return it->second.text == text ? it->second.layout : nullptr;
+    }
+
+    it = m_previous.find(key);
+    if (it == m_previous.end() || it->second.text != text)
+    {
+        return nullptr;
+    }
+
+    eastl::shared_ptr<const TextDefinition> layout = it->second.layout;
+    m_previous.erase(it);
+    add(key, text, layout);
+
+    return layout;
+}
+
+void TextLayoutCache::add(const Key& key, const eastl::u32string& text, eastl::shared_ptr<const TextDefinition> layout)
+{
+    if (m_current.size() >= GenerationSize)
+    {
+        m_previous = eastl::move(m_current);
+        m_current.clear();
+    }
+
+    m_current[key] = Entry{ text, eastl::move(layout) };
+}
+
+void TextLayoutCache::clear()
+{
+    m_current.clear();
+    m_previous.clear();
+}
+
+}
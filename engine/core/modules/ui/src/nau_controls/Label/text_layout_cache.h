@@ -0,0 +1,61 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <EASTL/shared_ptr.h>
+#include <EASTL/string.h>
+#include <EASTL/unordered_map.h>
+
+#include "nau/ui/label.h"
+
+namespace nau::ui
+{
+
+/**
+ * @brief Shared cache of the text layouts: the labels showing the same text with the same fonts share the layout
+ * (the lines, the letter definitions and the parsed rich text params).
+ *
+ * Two generations are kept, the layout that is not requested for the whole generation is dropped.
+ */
+class TextLayoutCache
+{
+public:
+    struct Key
+    {
+        size_t textHash {0};
+        size_t fontsHash {0};
+        float width {0.0f};     ///< Label width, only when the wrapping is enabled.
+        int wrapping {0};
+        bool isRichText {false};
+
+        bool operator==(const Key& other) const = default;
+    };
+
+    static TextLayoutCache& getInstance();
+
+    eastl::shared_ptr<const TextDefinition> find(const Key& key, const eastl::u32string& text);
+    void add(const Key& key, const eastl::u32string& text, eastl::shared_ptr<const TextDefinition> layout);
+    void clear();
+
+private:
+    static constexpr size_t GenerationSize = 256;
+
+    struct KeyHash
+    {
+        size_t operator()(const Key& key) const;
+    };
+
+    struct Entry
+    {
+        eastl::u32string text;
+        eastl::shared_ptr<const TextDefinition> layout;
+    };
+
+    using Generation = eastl::unordered_map<Key, Entry, KeyHash>;
+
+    Generation m_current;
+    Generation m_previous;
+};
+
+}
@@ -0,0 +1,231 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#include "glyph_atlas.h"
+
+#include "2d/CCFontFreeType.h"
+#include "base/CCDirector.h"
+#include "platform/CCFileUtils.h"
+#include "renderer/CCTexture2D.h"
+
+
+namespace
+{
+    // Gap between the packed glyphs, prevents the bleeding of the neighbours with the linear filtering
+    constexpr int GlyphPadding = 1;
+
+    eastl::unordered_map<eastl::string, eastl::shared_ptr<GlyphAtlas>>& getAtlases()
+    {
+        static eastl::unordered_map<eastl::string, eastl::shared_ptr<GlyphAtlas>> atlases;
+        return atlases;
+    }
+}
+
+eastl::shared_ptr<GlyphAtlas> GlyphAtlas::getAtlas(const std::string& fontFileName, float fontSize)
+{
+    // resolves real file path, to prevent storing multiple atlases for the same file
+    const std::string realFontFileName = cocos2d::FileUtils::getInstance()->getNewFilename(fontFileName);
+
+    char keyPrefix[32];
+    snprintf(keyPrefix, sizeof(keyPrefix), "%.2f ", fontSize);
+    eastl::string atlasKey{ keyPrefix };
+    atlasKey += realFontFileName.c_str();
+
+    auto& atlases = getAtlases();
+    auto it = atlases.find(atlasKey);
+    if (it != atlases.end())
+    {
+        return it->second;
+    }
+
+    cocos2d::FontFreeType* font = cocos2d::FontFreeType::create(realFontFileName, fontSize, cocos2d::GlyphCollection::DYNAMIC, nullptr);
+    if (!font)
+    {
+        NAU_LOG_ERROR("[GlyphAtlas] Font {} loading error", fontFileName.c_str());
+        return nullptr;
+    }
+
+    auto atlas = eastl::make_shared<GlyphAtlas>(font);
+    atlases[atlasKey] = atlas;
+
+    return atlas;
+}
+
+void GlyphAtlas::releaseAtlases()
+{
+    getAtlases().clear();
+}
+
+GlyphAtlas::GlyphAtlas(cocos2d::FontFreeType* font) :
+    m_font(font)
+{
+    CC_SAFE_RETAIN(m_font);
+    m_fontAscender = m_font->getFontAscender();
+}
+
+GlyphAtlas::~GlyphAtlas()
+{
+    for (const auto& page : m_pages)
+    {
+        CC_SAFE_RELEASE(page->texture);
+    }
+
+    CC_SAFE_RELEASE(m_font);
+}
+
+bool GlyphAtlas::prepareGlyphs(const eastl::u32string& text)
+{
+    bool result = true;
+
+    for (char32_t utf32Code : text)
+    {
+        if (m_glyphs.find(utf32Code) == m_glyphs.end())
+        {
+            result &= addGlyph(utf32Code);
+        }
+    }
+
+    uploadPages();
+
+    return result;
+}
+
+bool GlyphAtlas::getGlyph(char32_t utf32Code, nau::ui::FontLetterDefinition& glyphDefinition) const
+{
+    auto it = m_glyphs.find(utf32Code);
+    if (it == m_glyphs.end() || !it->second.validDefinition)
+    {
+        return false;
+    }
+
+    glyphDefinition = it->second;
+    return true;
+}
+
+bool GlyphAtlas::hasGlyph(char32_t utf32Code) const
+{
+    auto it = m_glyphs.find(utf32Code);
+    return it != m_glyphs.end() && it->second.validDefinition;
+}
+
+cocos2d::Texture2D* GlyphAtlas::getTexture(int pageIndex) const
+{
+    if (pageIndex < 0 || pageIndex >= static_cast<int>(m_pages.size()))
+    {
+        return nullptr;
+    }
+
+    return m_pages[pageIndex]->texture;
+}
+
+cocos2d::FontFreeType* GlyphAtlas::getFont() const
+{
+    return m_font;
+}
+
+bool GlyphAtlas::addGlyph(char32_t utf32Code)
+{
+    nau::ui::FontLetterDefinition& glyphDefinition = m_glyphs[utf32Code];
+
+    long bitmapWidth = 0;
+    long bitmapHeight = 0;
+    cocos2d::Rect glyphRect;
+    unsigned char* bitmap = m_font->getGlyphBitmap(utf32Code, bitmapWidth, bitmapHeight, glyphRect, glyphDefinition.xAdvance);
+
+    // the glyph without the image (the space) only advances the line, the missing one stays invalid
+    if (!bitmap || bitmapWidth <= 0 || bitmapHeight <= 0)
+    {
+        glyphDefinition.validDefinition = glyphDefinition.xAdvance != 0;
+        return true;
+    }
+
+    const int packedWidth = static_cast<int>(bitmapWidth) + GlyphPadding * 2;
+    const int packedHeight = static_cast<int>(bitmapHeight) + GlyphPadding * 2;
+    if (packedWidth > PageSize || packedHeight > PageSize)
+    {
+        NAU_LOG_ERROR("[GlyphAtlas] Glyph {} does not fit the atlas page", static_cast<uint32_t>(utf32Code));
+        return false;
+    }
+
+    Page* page = m_pages.empty() ? nullptr : m_pages.back().get();
+    rbp::Rect packedRect{};
+    if (page)
+    {
+        packedRect = page->packer.Insert(packedWidth, packedHeight, rbp::MaxRectsBinPack::RectBestShortSideFit, false);
+    }
+
+    if (!page || packedRect.height == 0)
+    {
+        page = addPage();
+        if (!page)
+        {
+            return false;
+        }
+
+        packedRect = page->packer.Insert(packedWidth, packedHeight, rbp::MaxRectsBinPack::RectBestShortSideFit, false);
+    }
+
+    const int glyphX = packedRect.x + GlyphPadding;
+    const int glyphY = packedRect.y + GlyphPadding;
+    for (long row = 0; row < bitmapHeight; ++row)
+    {
+        memcpy(page->pixels.data() + (glyphY + row) * PageSize + glyphX, bitmap + row * bitmapWidth, bitmapWidth);
+    }
+
+    page->dirtyMinY = std::min(page->dirtyMinY, glyphY);
+    page->dirtyMaxY = std::max(page->dirtyMaxY, glyphY + static_cast<int>(bitmapHeight));
+
+    // take from pixels to points
+    const float scaleFactor = CC_CONTENT_SCALE_FACTOR();
+
+    glyphDefinition.U = glyphX / scaleFactor;
+    glyphDefinition.V = glyphY / scaleFactor;
+    glyphDefinition.width = glyphRect.size.width / scaleFactor;
+    glyphDefinition.height = glyphRect.size.height / scaleFactor;
+    glyphDefinition.offsetX = glyphRect.origin.x;
+    glyphDefinition.offsetY = m_fontAscender + glyphRect.origin.y;
+    glyphDefinition.textureID = static_cast<int>(m_pages.size()) - 1;
+    glyphDefinition.validDefinition = true;
+    glyphDefinition.rotated = false;
+
+    return true;
+}
+
+GlyphAtlas::Page* GlyphAtlas::addPage()
+{
+    auto page = eastl::make_unique<Page>();
+    page->packer.Init(PageSize, PageSize);
+    page->pixels.resize(PageSize * PageSize, 0);
+
+    page->texture = new (std::nothrow) cocos2d::Texture2D;
+    if (!page->texture)
+    {
+        NAU_LOG_ERROR("[GlyphAtlas] Page texture allocation error");
+        return nullptr;
+    }
+
+    page->texture->initWithData(page->pixels.data(), page->pixels.size(), cocos2d::backend::PixelFormat::A8,
+        PageSize, PageSize, cocos2d::Size(PageSize, PageSize));
+    page->texture->setAntiAliasTexParameters();
+
+    m_pages.push_back(eastl::move(page));
+    return m_pages.back().get();
+}
+
+void GlyphAtlas::uploadPages()
+{
+    for (const auto& page : m_pages)
+    {
+        if (page->dirtyMinY >= page->dirtyMaxY)
+        {
+            continue;
+        }
+
+        // the dirty rows are uploaded as the single region
+        page->texture->updateWithData(page->pixels.data() + page->dirtyMinY * PageSize,
+            0, page->dirtyMinY, PageSize, page->dirtyMaxY - page->dirtyMinY);
+
+        page->dirtyMinY = PageSize;
+        page->dirtyMaxY = 0;
+    }
+}
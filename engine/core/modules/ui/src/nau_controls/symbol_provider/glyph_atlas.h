@@ -0,0 +1,73 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <nau/ui/label.h>
+#include <string>
+
+#include <EASTL/shared_ptr.h>
+#include <EASTL/string.h>
+#include <EASTL/unique_ptr.h>
+#include <EASTL/unordered_map.h>
+#include <EASTL/vector.h>
+#include <binPack2D/MaxRectsBinPack.h>
+
+namespace cocos2d
+{
+    class FontFreeType;
+    class Texture2D;
+}
+
+/**
+ * @brief Glyph atlas of the TTF font of the given size, shared by all the providers of the font.
+ *
+ * The glyphs are rasterized on demand and packed to the A8 pages with MAXRECTS, the packed glyphs are never moved:
+ * the letter definitions (and the layouts built from them) stay valid for the atlas lifetime.
+ */
+class GlyphAtlas
+{
+public:
+    static constexpr int PageSize = 1024;
+
+    /**
+     * @brief Retrieves the atlas of the font, the atlases are kept until the UI shutdown.
+     */
+    static eastl::shared_ptr<GlyphAtlas> getAtlas(const std::string& fontFileName, float fontSize);
+    static void releaseAtlases();
+
+    explicit GlyphAtlas(cocos2d::FontFreeType* font);
+    ~GlyphAtlas();
+
+    /**
+     * @brief Rasterizes the glyphs of the text that are not in the atlas yet. The touched pages are uploaded once.
+     *
+     * @return `false` if some glyph could not be packed (the glyphs missing in the font are not an error).
+     */
+    bool prepareGlyphs(const eastl::u32string& text);
+
+    bool getGlyph(char32_t utf32Code, nau::ui::FontLetterDefinition& glyphDefinition) const;
+    bool hasGlyph(char32_t utf32Code) const;
+    cocos2d::Texture2D* getTexture(int pageIndex) const;
+    cocos2d::FontFreeType* getFont() const;
+
+private:
+    struct Page
+    {
+        cocos2d::Texture2D* texture{ nullptr };
+        rbp::MaxRectsBinPack packer;
+        eastl::vector<uint8_t> pixels;
+        int dirtyMinY{ PageSize };
+        int dirtyMaxY{ 0 };
+    };
+
+    bool addGlyph(char32_t utf32Code);
+    Page* addPage();
+    void uploadPages();
+
+    cocos2d::FontFreeType* m_font{ nullptr };
+    int m_fontAscender{ 0 };
+
+    eastl::vector<eastl::unique_ptr<Page>> m_pages;
+    eastl::unordered_map<char32_t, nau::ui::FontLetterDefinition> m_glyphs;
+};
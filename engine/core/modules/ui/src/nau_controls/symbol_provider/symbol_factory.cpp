@@ -20,7 +20,8 @@ namespace nau::ui
     SymbolFactory::SymbolFactory() {}
 
     SymbolFactory::SymbolFactory(SymbolFactory&& other) noexcept
-    : m_providers(eastl::move(other.m_providers)) 
+    : m_providers(eastl::move(other.m_providers)),
+      m_fontsHash(other.m_fontsHash)
     {}
 
     SymbolFactory& SymbolFactory::operator=(SymbolFactory&& other) noexcept 
@@ -28,6 +29,7 @@ namespace nau::ui
         if (this != &other) 
         {
             m_providers = eastl::move(other.m_providers);
+            m_fontsHash = other.m_fontsHash;
         }
         return *this;
     }
@@ -63,6 +65,7 @@ namespace nau::ui
         {
             provider->setName(fontName);
             m_providers.push_back(provider);
+            updateFontsHash();
         }
     }
 
@@ -83,6 +86,7 @@ namespace nau::ui
         if (it != m_providers.end()) 
         {
             m_providers.erase(it);
+            updateFontsHash();
         }
     }
 
@@ -199,6 +203,20 @@ namespace nau::ui
         return nullptr;
     }
 
+    size_t SymbolFactory::getFontsHash() const
+    {
+        return m_fontsHash;
+    }
+
+    void SymbolFactory::updateFontsHash()
+    {
+        m_fontsHash = 0;
+        for (const auto& provider : m_providers)
+        {
+            m_fontsHash ^= std::hash<std::u32string>{}(provider->getName()) + 0x9e3779b9 + (m_fontsHash << 6) + (m_fontsHash >> 2);
+        }
+    }
+
     std::string SymbolFactory::getFileExtension(const std::string& fileName) const
     {
         size_t dotPos = fileName.rfind('.');
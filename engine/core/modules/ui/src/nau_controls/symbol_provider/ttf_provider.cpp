@@ -4,10 +4,6 @@
 #include "ttf_provider.h"
 #include "nau/ui/label.h"
 
-#include <2d/CCFontAtlasCache.h>
-#include <2d/CCLabel.h>
-#include "2d/CCFontAtlas.h"
-#include "2d/CCFontFNT.h"
 #include "2d/CCFontFreeType.h"
 
 
@@ -16,20 +12,17 @@ const float TTFProvider::TTFONT_DEFAULT_SIZE = 12.0f;
 
 TTFProvider::TTFProvider(const std::string& fontFileName)
 {
-    cocos2d::TTFConfig ttfConfig(fontFileName, TTFProvider::TTFONT_DEFAULT_SIZE);
-    m_fontAtlas = cocos2d:: FontAtlasCache::getFontAtlasTTF(&ttfConfig);
-    CC_SAFE_RETAIN(m_fontAtlas);
+    m_glyphAtlas = GlyphAtlas::getAtlas(fontFileName, TTFProvider::TTFONT_DEFAULT_SIZE);
 }
 
 TTFProvider::~TTFProvider() 
 {
-    CC_SAFE_RELEASE(m_fontAtlas);
+    m_glyphAtlas.reset();
 }
 
 int* TTFProvider::getHorizontalKerning(const eastl::u32string& text, int& outNumLetters) const
 {
-    const cocos2d::FontFNT* bmFont = (cocos2d::FontFNT*)m_fontAtlas->getFont();
-    if (!bmFont)
+    if (!m_glyphAtlas)
     {
         NAU_LOG_ERROR("[TTFProvider] Get font error");
 
@@ -37,46 +30,14 @@ int* TTFProvider::getHorizontalKerning(const eastl::u32string& text, int& outNum
         return nullptr;
     }
 
-    return bmFont->getHorizontalKerningForTextUTF32(text, outNumLetters);
+    return m_glyphAtlas->getFont()->getHorizontalKerningForTextUTF32(text, outNumLetters);
 }
 
 bool TTFProvider::getSymbol(char32_t utf32Code, nau::ui::FontLetterDefinition& symbolDefinition)
 {
-    if(containsDefinition(utf32Code))
+    if (m_glyphAtlas && m_glyphAtlas->getGlyph(utf32Code, symbolDefinition))
     {
-        auto result = getDefinition(utf32Code);
-        if (result) 
-        {
-            symbolDefinition = result.value();
-            return true;
-        }
-    }
-
-    cocos2d::FontLetterDefinition cocosLetterlDefinition;
-
-    if (m_fontAtlas->getLetterDefinitionForChar(utf32Code, cocosLetterlDefinition))
-    {
-        if (cocosLetterlDefinition.validDefinition)
-        {
-            symbolDefinition.U = cocosLetterlDefinition.U;
-            symbolDefinition.V = cocosLetterlDefinition.V;
-            symbolDefinition.width = cocosLetterlDefinition.width;
-            symbolDefinition.height = cocosLetterlDefinition.height;
-            symbolDefinition.offsetX = cocosLetterlDefinition.offsetX;
-            symbolDefinition.offsetY = cocosLetterlDefinition.offsetY;
-            symbolDefinition.textureID = cocosLetterlDefinition.textureID;
-            symbolDefinition.validDefinition = cocosLetterlDefinition.validDefinition;
-            symbolDefinition.xAdvance = cocosLetterlDefinition.xAdvance;
-            symbolDefinition.rotated = cocosLetterlDefinition.rotated;
-
-            addDefinition(utf32Code, symbolDefinition);
-
-            return true;
-        }
-        else
-        {
-            NAU_LOG_ERROR("[TTFProvider] Letter definition validation error");
-        }
+        return true;
     }
 
     return false;
@@ -84,17 +45,12 @@ bool TTFProvider::getSymbol(char32_t utf32Code, nau::ui::FontLetterDefinition& s
 
 bool TTFProvider::hasSymbol(char32_t utf32Code) const
 {
-    if(containsDefinition(utf32Code))
-    {
-        return true;
-    }
-
-    return false;
+    return m_glyphAtlas && m_glyphAtlas->hasGlyph(utf32Code);
 }
 
 bool TTFProvider::warmUpSymbosCache(const eastl::u32string& text) const
 {
-    if (m_fontAtlas->prepareLetterDefinitions(text))
+    if (m_glyphAtlas && m_glyphAtlas->prepareGlyphs(text))
     {
         return true;
     }
@@ -106,5 +62,5 @@ bool TTFProvider::warmUpSymbosCache(const eastl::u32string& text) const
 
 cocos2d::Texture2D* TTFProvider::getSymbolTexture(int textureId) const
 {
-    return m_fontAtlas->getTexture(textureId);
+    return m_glyphAtlas ? m_glyphAtlas->getTexture(textureId) : nullptr;
 }
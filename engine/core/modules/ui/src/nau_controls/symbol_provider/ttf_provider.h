@@ -3,13 +3,9 @@
 
 #pragma once
 
+#include "glyph_atlas.h"
 #include "symbol_provider.h"
 
-namespace cocos2d
-{
-    class FontAtlas;
-}
-
 
 class TTFProvider : public ISymbolProvider
 {
@@ -26,5 +22,5 @@ public:
     int* getHorizontalKerning(const eastl::u32string& text, int& outNumLetters) const override;
 
 private:
-    cocos2d::FontAtlas* m_fontAtlas{ nullptr };
+    eastl::shared_ptr<GlyphAtlas> m_glyphAtlas;
 };
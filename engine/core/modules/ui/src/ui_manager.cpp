@@ -32,6 +32,8 @@
 #include "nau/service/service_provider.h"
 #include "nau/ui/elements/canvas.h"
 #include "nau_backend/device_nau.h"
+#include "nau_controls/Label/text_layout_cache.h"
+#include "nau_controls/symbol_provider/glyph_atlas.h"
 #include "ui_render_view.h"
 #include "nau/scene/scene_factory.h"
 #include "nau/scene/scene_manager.h"
@@ -513,6 +515,9 @@ namespace nau::ui
             // Director should still do a cleanup if the window was closed manually.
             if (glview->isOpenGLReady())
             {
+                // the atlases still used by the labels are released with the scene, before the FreeType shutdown
+                GlyphAtlas::releaseAtlases();
+                TextLayoutCache::getInstance().clear();
                 director->end();
                 director->mainLoop();
                 director = nullptr;
@@ -0,0 +1,185 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#include "modfx_gpu_sim.h"
+
+#include "nau/3d/dag_drv3d_buffers.h"
+
+namespace nau::vfx::modfx
+{
+    namespace
+    {
+        // The layout of the instances read by the particles material, see VFXModFXInstance.
+        struct GpuInstanceData
+        {
+            nau::math::Matrix4 worldMatrix;
+            int frameID;
+            nau::math::Color4 color;
+            nau::math::uint3 dummy;
+        };
+
+        constexpr eastl::string_view ResetPipeline = "reset";
+        constexpr eastl::string_view EmitPipeline = "emit";
+        constexpr eastl::string_view SimulatePipeline = "simulate";
+        constexpr eastl::string_view BuildArgsPipeline = "build_args";
+
+        // The counters of the pool: the dead count, the alive counts of the lists.
+        constexpr uint32_t CountersCount = 3;
+    }  // namespace
+
+    ModfxGpuSim::ModfxGpuSim(MaterialAssetView::Ptr simMaterial, uint32_t capacity) :
+        m_simMaterial(std::move(simMaterial)),
+        m_capacity(capacity)
+    {
+        NAU_ASSERT(m_simMaterial);
+        NAU_ASSERT(m_capacity > 0);
+
+        m_settingsBuffer = d3d::buffers::create_persistent_cb(d3d::buffers::cb_struct_reg_count<Settings>(), "modfx_gpu_sim_settings");
+        m_frameBuffer = d3d::buffers::create_one_frame_cb(d3d::buffers::cb_struct_reg_count<Frame>(), "modfx_gpu_sim_frame");
+        m_particlesBuffer = d3d::buffers::create_ua_sr_structured(sizeof(Particle), m_capacity, "modfx_gpu_sim_particles");
+        m_deadListBuffer = d3d::buffers::create_ua_sr_structured(sizeof(uint32_t), m_capacity, "modfx_gpu_sim_dead_list");
+        m_aliveListsBuffer = d3d::buffers::create_ua_sr_structured(sizeof(uint32_t), m_capacity * 2, "modfx_gpu_sim_alive_lists");
+        m_countersBuffer = d3d::buffers::create_ua_sr_byte_address(CountersCount, "modfx_gpu_sim_counters");
+        m_instanceBuffer = d3d::buffers::create_ua_sr_structured(sizeof(GpuInstanceData), m_capacity, "modfx_gpu_sim_instances");
+        m_dispatchArgsBuffer = d3d::buffers::create_ua_indirect(d3d::buffers::Indirect::Dispatch, 1, "modfx_gpu_sim_dispatch_args");
+        m_drawArgsBuffer = d3d::buffers::create_ua_indirect(d3d::buffers::Indirect::DrawIndexed, 1, "modfx_gpu_sim_draw_args");
+    }
+
+    ModfxGpuSim::~ModfxGpuSim()
+    {
+        for (Sbuffer* buffer : {m_settingsBuffer, m_frameBuffer, m_particlesBuffer, m_deadListBuffer, m_aliveListsBuffer,
+                                m_countersBuffer, m_instanceBuffer, m_dispatchArgsBuffer, m_drawArgsBuffer})
+        {
+            if (buffer)
+            {
+                buffer->destroy();
+            }
+        }
+    }
+
+    void ModfxGpuSim::setSettings(const settings::FxLife& life, const settings::FxPosition& position, const settings::FxRadius& radius,
+                                  const settings::FxVelocity& velocity, const settings::FxColor& color, const settings::FxTexture& texture)
+    {
+        using nau::math::Vector4;
+
+        Settings gpuSettings;
+
+        const float lifeMax = life.part_life_max != 0.0f ? life.part_life_max : 1.0f;
+        gpuSettings.life = Vector4(life.part_life_min, life.part_life_max, life.part_life_rnd_offset, 1.0f / lifeMax);
+        gpuSettings.radius = Vector4(radius.enabled ? 1.0f : 0.0f, radius.rad_min, radius.rad_max, 0.0f);
+
+        gpuSettings.position = Vector4(position.enabled ? 1.0f : 0.0f, static_cast<float>(position.type), position.volume, 0.0f);
+        gpuSettings.positionOffset = Vector4(position.offset, 0.0f);
+        gpuSettings.positionVec = Vector4::zero();
+        switch (position.type)
+        {
+            case settings::PositionType::SPHERE:
+                gpuSettings.positionShape = Vector4(position.sphere.radius, 0.0f, 0.0f, position.sphere.volume);
+                break;
+            case settings::PositionType::CYLINDER:
+                gpuSettings.positionShape = Vector4(position.cylinder.radius, position.cylinder.height, position.cylinder.random_burst, position.cylinder.volume);
+                gpuSettings.positionVec = Vector4(position.cylinder.vec, 0.0f);
+                break;
+            case settings::PositionType::CONE:
+                gpuSettings.positionShape = Vector4(position.cone.width_top, position.cone.width_bottom, position.cone.height, position.cone.volume);
+                gpuSettings.positionVec = Vector4(position.cone.vec, position.cone.random_burst);
+                break;
+            case settings::PositionType::BOX:
+                gpuSettings.positionShape = Vector4(position.box.width, position.box.height, position.box.depth, position.box.volume);
+                break;
+        }
+
+        gpuSettings.velocity = Vector4(velocity.enabled ? 1.0f : 0.0f, velocity.mass, velocity.drag_coeff, velocity.drag_to_rad_k);
+        gpuSettings.velocityFlags = Vector4(velocity.apply_gravity ? 1.0f : 0.0f, velocity.start.enabled ? 1.0f : 0.0f,
+                                            static_cast<float>(velocity.start.type), velocity.add.enabled ? 1.0f : 0.0f);
+        gpuSettings.velocityStart = Vector4(velocity.start.vel_min, velocity.start.vel_max, velocity.start.vec_rnd, 0.0f);
+        gpuSettings.velocityStartVec = Vector4(velocity.start.type == settings::StartType::POINT ? velocity.start.point.offset : velocity.start.vec.vec, 0.0f);
+        gpuSettings.velocityAdd = Vector4(velocity.add.vel_min, velocity.add.vel_max, velocity.add.vec_rnd, static_cast<float>(velocity.add.type));
+        gpuSettings.velocityAddVec = Vector4(velocity.add.type == settings::AddType::POINT ? velocity.add.point.offset : velocity.add.vec.vec, 0.0f);
+
+        gpuSettings.colorStart = color.start_color;
+        gpuSettings.colorEnd = color.end_color;
+        gpuSettings.color = Vector4(color.enabled ? 1.0f : 0.0f, 0.0f, 0.0f, 0.0f);
+
+        gpuSettings.texture = Vector4(texture.enabled ? 1.0f : 0.0f, static_cast<float>(texture.frames_x), static_cast<float>(texture.frames_y),
+                                      texture.looped ? 1.0f : 0.0f);
+
+        m_settingsBuffer->updateData(0, sizeof(Settings), &gpuSettings, VBLOCK_WRITEONLY | VBLOCK_DISCARD);
+    }
+
+    void ModfxGpuSim::reset()
+    {
+        m_isResetPending = true;
+    }
+
+    void ModfxGpuSim::simulate(uint32_t spawnCount, float dt, const nau::math::Vector3& offset)
+    {
+        const Frame frame{
+            .offset = nau::math::Vector4(offset, dt),
+            .spawnCount = eastl::min(spawnCount, m_capacity),
+            .capacity = m_capacity,
+            .seed = m_frameSeed++,
+            .aliveList = m_aliveList};
+        m_frameBuffer->updateData(0, sizeof(Frame), &frame, VBLOCK_WRITEONLY | VBLOCK_DISCARD);
+
+        if (m_isResetPending)
+        {
+            // All the particles to the dead list, no alive ones.
+            bindBuffers(ResetPipeline);
+            m_simMaterial->dispatch((m_capacity + ThreadGroupSize - 1) / ThreadGroupSize, 1, 1);
+            m_isResetPending = false;
+        }
+
+        if (frame.spawnCount > 0)
+        {
+            // The spawn count is clamped by the dead count on the GPU.
+            bindBuffers(EmitPipeline);
+            m_simMaterial->dispatch((frame.spawnCount + ThreadGroupSize - 1) / ThreadGroupSize, 1, 1);
+        }
+
+        // The groups of the alive particles: the emitted ones are counted by the emission of this frame.
+        bindBuffers(BuildArgsPipeline);
+        m_simMaterial->setProperty(BuildArgsPipeline, "argsStage", 0u);
+        m_simMaterial->dispatch(1, 1, 1);
+
+        bindBuffers(SimulatePipeline);
+        d3d::dispatch_indirect(m_dispatchArgsBuffer, 0);
+
+        // The instances count of the next alive list, the current one is emptied for the next frame.
+        bindBuffers(BuildArgsPipeline);
+        m_simMaterial->setProperty(BuildArgsPipeline, "argsStage", 1u);
+        m_simMaterial->dispatch(1, 1, 1);
+
+        m_aliveList ^= 1;
+    }
+
+    Sbuffer* ModfxGpuSim::getInstanceBuffer() const
+    {
+        return m_instanceBuffer;
+    }
+
+    Sbuffer* ModfxGpuSim::getDrawArgsBuffer() const
+    {
+        return m_drawArgsBuffer;
+    }
+
+    uint32_t ModfxGpuSim::getCapacity() const
+    {
+        return m_capacity;
+    }
+
+    void ModfxGpuSim::bindBuffers(eastl::string_view pipeline)
+    {
+        m_simMaterial->setCBuffer(pipeline, "ModfxSimSettings", m_settingsBuffer);
+        m_simMaterial->setCBuffer(pipeline, "ModfxSimFrame", m_frameBuffer);
+        m_simMaterial->setRwBuffer(pipeline, "Particles", m_particlesBuffer);
+        m_simMaterial->setRwBuffer(pipeline, "DeadList", m_deadListBuffer);
+        m_simMaterial->setRwBuffer(pipeline, "AliveLists", m_aliveListsBuffer);
+        m_simMaterial->setRwBuffer(pipeline, "Counters", m_countersBuffer);
+        m_simMaterial->setRwBuffer(pipeline, "Instances", m_instanceBuffer);
+        m_simMaterial->setRwBuffer(pipeline, "DispatchArgs", m_dispatchArgsBuffer);
+        m_simMaterial->setRwBuffer(pipeline, "DrawArgs", m_drawArgsBuffer);
+        m_simMaterial->bindPipeline(pipeline);
+    }
+
+}  // namespace nau::vfx::modfx
@@ -0,0 +1,124 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#pragma once
+
+#include "graphics_assets/material_asset.h"
+
+#include "modfx/settings/fx_color.h"
+#include "modfx/settings/fx_life.h"
+#include "modfx/settings/fx_position.h"
+#include "modfx/settings/fx_radius.h"
+#include "modfx/settings/fx_texture.h"
+#include "modfx/settings/fx_velocity.h"
+
+#include "nau/3d/dag_drv3d.h"
+#include "nau/math/dag_color.h"
+#include "nau/math/math.h"
+
+namespace nau::vfx::modfx
+{
+    /**
+     * The compute shader simulation of an emitter: the particles never leave the GPU.
+     *
+     * The free particles are in the dead list. The emission pops them into the alive list, the simulation runs the
+     * FxLife, FxRadius, FxVelocity, FxColor and FxTexture modules for the alive ones: the surviving particles are pushed
+     * into the next alive list with their instances, the dead ones back into the dead list. The alive lists are swapped
+     * each frame and the instances count of the draw is written by the GPU.
+     */
+    class ModfxGpuSim
+    {
+    public:
+        // Must match the compute pipelines of the simulation material: one thread per particle.
+        static constexpr uint32_t ThreadGroupSize = 64;
+
+        ModfxGpuSim(MaterialAssetView::Ptr simMaterial, uint32_t capacity);
+        ~ModfxGpuSim();
+
+        ModfxGpuSim(const ModfxGpuSim&) = delete;
+        ModfxGpuSim& operator=(const ModfxGpuSim&) = delete;
+
+        void setSettings(const settings::FxLife& life, const settings::FxPosition& position, const settings::FxRadius& radius,
+                         const settings::FxVelocity& velocity, const settings::FxColor& color, const settings::FxTexture& texture);
+
+        // Kills all the particles.
+        void reset();
+
+        // Emits the particles, up to the dead ones, and simulates the alive ones.
+        void simulate(uint32_t spawnCount, float dt, const nau::math::Vector3& offset);
+
+        // The instances of the simulated particles, the same layout as the CPU simulation instances.
+        Sbuffer* getInstanceBuffer() const;
+        // The indexed instanced draw of the instances, its count is written by simulate().
+        Sbuffer* getDrawArgsBuffer() const;
+
+        uint32_t getCapacity() const;
+
+    private:
+        // The particle state on the GPU.
+        struct Particle
+        {
+            nau::math::Vector3 pos;
+            nau::math::Vector3 velocity;
+            nau::math::Color4 color;
+            float radius;
+            float lifeNorm;
+            int rndSeed;
+            int frameIdx;
+        };
+
+        // The settings constant buffer: the modules parameters packed by float4.
+        struct Settings
+        {
+            nau::math::Vector4 life;              // min, max, rnd offset, 1 / max
+            nau::math::Vector4 radius;            // enabled, min, max
+            nau::math::Vector4 position;          // enabled, type, volume
+            nau::math::Vector4 positionOffset;    // xyz
+            nau::math::Vector4 positionShape;     // sphere: radius; box: width, height, depth; cylinder: radius, height; cone: top, bottom, height
+            nau::math::Vector4 positionVec;       // the cylinder and cone axis
+            nau::math::Vector4 velocity;          // enabled, mass, drag coefficient, drag to radius k
+            nau::math::Vector4 velocityFlags;     // gravity, start enabled, start type, add enabled
+            nau::math::Vector4 velocityStart;     // min, max, vec rnd
+            nau::math::Vector4 velocityStartVec;  // the point offset or the direction by the start type
+            nau::math::Vector4 velocityAdd;       // min, max, vec rnd, type
+            nau::math::Vector4 velocityAddVec;    // the point offset or the direction by the add type
+            nau::math::Color4 colorStart;
+            nau::math::Color4 colorEnd;
+            nau::math::Vector4 color;             // enabled
+            nau::math::Vector4 texture;           // enabled, frames x, frames y, looped
+        };
+
+        // The per frame constants.
+        struct Frame
+        {
+            nau::math::Vector4 offset;  // xyz: the emitter offset, w: dt
+            uint32_t spawnCount;
+            uint32_t capacity;
+            uint32_t seed;
+            uint32_t aliveList;         // The current alive list, 0 or 1.
+        };
+
+        void bindBuffers(eastl::string_view pipeline);
+
+        MaterialAssetView::Ptr m_simMaterial;
+        uint32_t m_capacity;
+
+        Sbuffer* m_settingsBuffer = nullptr;
+        Sbuffer* m_frameBuffer = nullptr;
+        Sbuffer* m_particlesBuffer = nullptr;
+        Sbuffer* m_deadListBuffer = nullptr;
+        // The two alive lists, one after another.
+        Sbuffer* m_aliveListsBuffer = nullptr;
+        // The dead count and the counts of the alive lists.
+        Sbuffer* m_countersBuffer = nullptr;
+        Sbuffer* m_instanceBuffer = nullptr;
+        // The simulation dispatch of the current alive list, written by the previous frame.
+        Sbuffer* m_dispatchArgsBuffer = nullptr;
+        Sbuffer* m_drawArgsBuffer = nullptr;
+
+        uint32_t m_aliveList = 0;
+        uint32_t m_frameSeed = 0;
+        bool m_isResetPending = true;
+    };
+
+}  // namespace nau::vfx::modfx
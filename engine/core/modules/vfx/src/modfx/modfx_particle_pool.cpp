@@ -0,0 +1,66 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#include "modfx_particle_pool.h"
+
+namespace nau::vfx::modfx
+{
+    void ModfxParticlePool::reserveParticles(size_t count)
+    {
+        const size_t paddedCount = (count + Lanes - 1) / Lanes * Lanes;
+        if (paddedCount <= size())
+        {
+            return;
+        }
+
+        posX.resize(paddedCount, 0.0f);
+        posY.resize(paddedCount, 0.0f);
+        posZ.resize(paddedCount, 0.0f);
+        velocityX.resize(paddedCount, 0.0f);
+        velocityY.resize(paddedCount, 0.0f);
+        velocityZ.resize(paddedCount, 0.0f);
+        radius.resize(paddedCount, 0.0f);
+        lifeNorm.resize(paddedCount, FreeLife);
+        lifeRate.resize(paddedCount, 0.0f);
+        rndSeed.resize(paddedCount, 0);
+        frameIdx.resize(paddedCount, 0);
+        color.resize(paddedCount, nau::math::Color4(1.0f, 1.0f, 1.0f, 1.0f));
+    }
+
+    void ModfxParticlePool::clear()
+    {
+        posX.clear();
+        posY.clear();
+        posZ.clear();
+        velocityX.clear();
+        velocityY.clear();
+        velocityZ.clear();
+        radius.clear();
+        lifeNorm.clear();
+        lifeRate.clear();
+        rndSeed.clear();
+        frameIdx.clear();
+        color.clear();
+    }
+
+    void ModfxParticlePool::setParticle(size_t index, const ModfxRenData& rdata, const ModfxSimData& sdata, float particleLifeRate)
+    {
+        NAU_ASSERT(index < size());
+
+        setPos(index, rdata.pos);
+        setVelocity(index, sdata.velocity);
+        radius[index] = rdata.radius;
+        lifeNorm[index] = sdata.life_norm;
+        lifeRate[index] = particleLifeRate;
+        rndSeed[index] = sdata.rnd_seed;
+        frameIdx[index] = rdata.frame_idx;
+        color[index] = rdata.color;
+    }
+
+    void ModfxParticlePool::freeParticle(size_t index)
+    {
+        lifeNorm[index] = FreeLife;
+        lifeRate[index] = 0.0f;
+    }
+
+}  // namespace nau::vfx::modfx
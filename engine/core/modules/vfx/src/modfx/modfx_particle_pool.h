@@ -0,0 +1,77 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <EASTL/numeric_limits.h>
+#include <EASTL/vector.h>
+
+#include "modfx_ren_data.h"
+#include "modfx_sim_data.h"
+#include "nau/math/dag_color.h"
+#include "nau/math/math.h"
+
+namespace nau::vfx::modfx
+{
+    /**
+     * The CPU particles of an emitter by the attribute arrays, so the simulation updates them by Lanes with SSE.
+     * The arrays are padded to a multiple of Lanes: the padding and the free particles have the FreeLife.
+     */
+    struct ModfxParticlePool
+    {
+        static constexpr size_t Lanes = 4;
+        // The particles alive have the life below 1, the ones that died in the last simulation have it at 1 or above.
+        static constexpr float FreeLife = eastl::numeric_limits<float>::max();
+
+        eastl::vector<float> posX;
+        eastl::vector<float> posY;
+        eastl::vector<float> posZ;
+        eastl::vector<float> velocityX;
+        eastl::vector<float> velocityY;
+        eastl::vector<float> velocityZ;
+        eastl::vector<float> radius;
+        eastl::vector<float> lifeNorm;
+        // The life per second, drawn at the spawn (see life::modfx_life_sim).
+        eastl::vector<float> lifeRate;
+        eastl::vector<int> rndSeed;
+        eastl::vector<int> frameIdx;
+        eastl::vector<nau::math::Color4> color;
+
+        size_t size() const
+        {
+            return lifeNorm.size();
+        }
+
+        // Grows the arrays to hold count particles, the new ones are free.
+        void reserveParticles(size_t count);
+        void clear();
+
+        void setParticle(size_t index, const ModfxRenData& rdata, const ModfxSimData& sdata, float particleLifeRate);
+        void freeParticle(size_t index);
+
+        nau::math::Vector3 getPos(size_t index) const
+        {
+            return {posX[index], posY[index], posZ[index]};
+        }
+
+        void setPos(size_t index, const nau::math::Vector3& pos)
+        {
+            posX[index] = pos.getX();
+            posY[index] = pos.getY();
+            posZ[index] = pos.getZ();
+        }
+
+        nau::math::Vector3 getVelocity(size_t index) const
+        {
+            return {velocityX[index], velocityY[index], velocityZ[index]};
+        }
+
+        void setVelocity(size_t index, const nau::math::Vector3& velocity)
+        {
+            velocityX[index] = velocity.getX();
+            velocityY[index] = velocity.getY();
+            velocityZ[index] = velocity.getZ();
+        }
+    };
+
+}  // namespace nau::vfx::modfx
@@ -0,0 +1,93 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#include "modfx_quad_geometry.h"
+
+#include "nau/math/math.h"
+
+#include <mutex>
+
+namespace nau::vfx::modfx
+{
+    namespace
+    {
+        Sbuffer* fillBuffer(Sbuffer* buffer, const void* data, size_t size)
+        {
+            std::byte* memory = nullptr;
+            buffer->lock(0, size, reinterpret_cast<void**>(&memory), VBLOCK_WRITEONLY);
+            std::memcpy(memory, data, size);
+            buffer->unlock();
+
+            return buffer;
+        }
+    }  // namespace
+
+    std::shared_ptr<ModfxQuadGeometry> ModfxQuadGeometry::acquire()
+    {
+        static std::mutex mutex;
+        static std::weak_ptr<ModfxQuadGeometry> sharedGeometry;
+
+        std::lock_guard lock(mutex);
+        std::shared_ptr<ModfxQuadGeometry> geometry = sharedGeometry.lock();
+        if (!geometry)
+        {
+            geometry = std::make_shared<ModfxQuadGeometry>();
+            sharedGeometry = geometry;
+        }
+
+        return geometry;
+    }
+
+    ModfxQuadGeometry::ModfxQuadGeometry()
+    {
+        const nau::math::float3 quadPositions[] = {
+            {-0.5f, -0.5f, 0.0f},
+            { 0.5f, -0.5f, 0.0f},
+            { 0.5f,  0.5f, 0.0f},
+            {-0.5f,  0.5f, 0.0f}
+        };
+
+        const nau::math::float3 quadNormals[] = {
+            {0, 0,  1},
+            {0, 0,  1},
+            {0, 0, -1},
+            {0, 0, -1}
+        };
+
+        const nau::math::float2 quadTexCoords[] = {
+            {0, 1},
+            {1, 1},
+            {1, 0},
+            {0, 0}
+        };
+
+        const uint16_t quadIndices[IndexCount] = {0, 1, 2, 2, 3, 0};
+
+        // The quad never changes: the buffers are static.
+        m_positionBuffer = fillBuffer(d3d::create_vb(sizeof(quadPositions), 0, u8"ModfxQuadPositionBuffer"), quadPositions, sizeof(quadPositions));
+        m_normalBuffer = fillBuffer(d3d::create_vb(sizeof(quadNormals), 0, u8"ModfxQuadNormalBuffer"), quadNormals, sizeof(quadNormals));
+        m_texCoordBuffer = fillBuffer(d3d::create_vb(sizeof(quadTexCoords), 0, u8"ModfxQuadTexCoordBuffer"), quadTexCoords, sizeof(quadTexCoords));
+        m_indexBuffer = fillBuffer(d3d::create_ib(sizeof(quadIndices), 0, u8"ModfxQuadIndexBuffer"), quadIndices, sizeof(quadIndices));
+    }
+
+    ModfxQuadGeometry::~ModfxQuadGeometry()
+    {
+        for (Sbuffer* buffer : {m_positionBuffer, m_normalBuffer, m_texCoordBuffer, m_indexBuffer})
+        {
+            if (buffer)
+            {
+                buffer->destroy();
+            }
+        }
+    }
+
+    void ModfxQuadGeometry::bind() const
+    {
+        d3d::setvsrc(0, m_positionBuffer, sizeof(nau::math::float3));
+        d3d::setvsrc(1, m_normalBuffer, sizeof(nau::math::float3));
+        d3d::setvsrc(2, m_texCoordBuffer, sizeof(nau::math::float2));
+
+        d3d::setind(m_indexBuffer);
+    }
+
+}  // namespace nau::vfx::modfx
@@ -0,0 +1,39 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <memory>
+
+#include "nau/3d/dag_drv3d.h"
+
+namespace nau::vfx::modfx
+{
+    /**
+     * The quad drawn by the particle instances, shared by all the emitters: it lives while an emitter holds it.
+     */
+    class ModfxQuadGeometry
+    {
+    public:
+        static constexpr int IndexCount = 6;
+
+        // The geometry of the alive emitters or a new one.
+        static std::shared_ptr<ModfxQuadGeometry> acquire();
+
+        ModfxQuadGeometry();
+        ~ModfxQuadGeometry();
+
+        ModfxQuadGeometry(const ModfxQuadGeometry&) = delete;
+        ModfxQuadGeometry& operator=(const ModfxQuadGeometry&) = delete;
+
+        // Sets the vertex streams and the indices of the quad.
+        void bind() const;
+
+    private:
+        Sbuffer* m_positionBuffer = nullptr;
+        Sbuffer* m_normalBuffer = nullptr;
+        Sbuffer* m_texCoordBuffer = nullptr;
+        Sbuffer* m_indexBuffer = nullptr;
+    };
+
+}  // namespace nau::vfx::modfx
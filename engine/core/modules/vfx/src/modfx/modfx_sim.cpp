@@ -9,6 +9,8 @@
 #include "modfx_color.h"
 #include "modfx_texture.h"
 
+#include <emmintrin.h>
+
 namespace nau::vfx::modfx
 {
     void sim::modfx_apply_sim(modfx::ModfxRenData& rdata, modfx::ModfxSimData& sdata, float dt, const settings::FxLife& life, const settings::FxRadius& radius, const settings::FxVelocity& velocity, const settings::FxColor& color, const settings::FxTexture& texture)
@@ -45,5 +47,79 @@ namespace nau::vfx::modfx
         if (dead)
             rdata.radius = 0;
     }
-}
 
+    void sim::modfx_apply_sim_soa(modfx::ModfxParticlePool& pool, size_t count, float dt, const settings::FxLife& life, const settings::FxRadius& radius, const settings::FxVelocity& velocity, const settings::FxColor& color, const settings::FxTexture& texture)
+    {
+        NAU_ASSERT(count % ModfxParticlePool::Lanes == 0 && count <= pool.size());
+
+        // The forces of the particles are integrated one by one, the gravity only is integrated by the lanes.
+        const bool isVelocityPerParticle = velocity.enabled &&
+                                           (velocity.mass > 0.0f || velocity.force_field.vortex.enabled ||
+                                            (velocity.add.enabled && (velocity.add.vel_min > 0 || velocity.add.vel_max > 0)));
+        if (isVelocityPerParticle && dt > 0)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (pool.lifeNorm[i] >= 1.0f)
+                {
+                    continue;
+                }
+
+                const float lifeK = eastl::min(pool.lifeNorm[i] + dt * pool.lifeRate[i], 1.0f);
+                nau::math::Vector3 pos = pool.getPos(i);
+                nau::math::Vector3 posOffset = nau::math::Vector3::zero();
+                nau::math::Vector3 particleVelocity = pool.getVelocity(i);
+                velocity::modfx_velocity_sim(pool.rndSeed[i], lifeK, dt, pool.radius[i], pos, posOffset, particleVelocity, velocity);
+                pool.setPos(i, pos + posOffset);
+                pool.setVelocity(i, particleVelocity);
+            }
+        }
+
+        const bool isVelocityByLanes = velocity.enabled && !isVelocityPerParticle && dt > 0;
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128 dtLanes = _mm_set1_ps(dt);
+        const __m128 gravityDt = _mm_set1_ps(velocity.apply_gravity ? -9.81f * dt : 0.0f);
+        const __m128 framesCount = _mm_set1_ps(static_cast<float>(texture.frames_x * texture.frames_y - 1));
+
+        for (size_t i = 0; i < count; i += ModfxParticlePool::Lanes)
+        {
+            __m128 lifeNorm = _mm_loadu_ps(&pool.lifeNorm[i]);
+            const __m128 isAlive = _mm_cmplt_ps(lifeNorm, one);
+
+            // The life rate of the particle is drawn once at the spawn: modfx_life_sim() draws the same one each frame.
+            lifeNorm = _mm_add_ps(lifeNorm, _mm_and_ps(isAlive, _mm_mul_ps(dtLanes, _mm_loadu_ps(&pool.lifeRate[i]))));
+            _mm_storeu_ps(&pool.lifeNorm[i], lifeNorm);
+
+            if (isVelocityByLanes)
+            {
+                const __m128 velocityY = _mm_add_ps(_mm_loadu_ps(&pool.velocityY[i]), _mm_and_ps(isAlive, gravityDt));
+                _mm_storeu_ps(&pool.velocityY[i], velocityY);
+
+                _mm_storeu_ps(&pool.posX[i], _mm_add_ps(_mm_loadu_ps(&pool.posX[i]), _mm_and_ps(isAlive, _mm_mul_ps(_mm_loadu_ps(&pool.velocityX[i]), dtLanes))));
+                _mm_storeu_ps(&pool.posY[i], _mm_add_ps(_mm_loadu_ps(&pool.posY[i]), _mm_and_ps(isAlive, _mm_mul_ps(velocityY, dtLanes))));
+                _mm_storeu_ps(&pool.posZ[i], _mm_add_ps(_mm_loadu_ps(&pool.posZ[i]), _mm_and_ps(isAlive, _mm_mul_ps(_mm_loadu_ps(&pool.velocityZ[i]), dtLanes))));
+            }
+
+            if (texture.enabled)
+            {
+                const __m128 lifeK = _mm_min_ps(_mm_max_ps(lifeNorm, _mm_setzero_ps()), one);
+                const __m128i frame = _mm_cvttps_epi32(_mm_mul_ps(lifeK, framesCount));
+                const __m128i previousFrame = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&pool.frameIdx[i]));
+                const __m128i aliveMask = _mm_castps_si128(isAlive);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(&pool.frameIdx[i]),
+                                 _mm_or_si128(_mm_and_si128(aliveMask, frame), _mm_andnot_si128(aliveMask, previousFrame)));
+            }
+        }
+
+        if (color.enabled && color.gradient.enabled)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (pool.lifeNorm[i] != ModfxParticlePool::FreeLife)
+                {
+                    color::modfx_color_sim(pool.rndSeed[i], eastl::min(pool.lifeNorm[i], 1.0f), pool.color[i], color);
+                }
+            }
+        }
+    }
+}
@@ -3,6 +3,7 @@
 // Copyright (C) 2024  Gaijin Games KFT.  All rights reserved
 #pragma once
 
+#include "modfx_particle_pool.h"
 #include "modfx_ren_data.h"
 #include "modfx_sim_data.h"
 
@@ -15,5 +16,8 @@
 namespace nau::vfx::modfx::sim
 {
     void modfx_apply_sim(modfx::ModfxRenData& rdata, modfx::ModfxSimData& sdata, float dt, const settings::FxLife& life, const settings::FxRadius& radius, const settings::FxVelocity& velocity, const settings::FxColor& color, const settings::FxTexture& texture);
+
+    // The modfx_apply_sim() of the first count particles of the pool, by ModfxParticlePool::Lanes. The count is a multiple of the lanes.
+    void modfx_apply_sim_soa(modfx::ModfxParticlePool& pool, size_t count, float dt, const settings::FxLife& life, const settings::FxRadius& radius, const settings::FxVelocity& velocity, const settings::FxColor& color, const settings::FxTexture& texture);
 }
 
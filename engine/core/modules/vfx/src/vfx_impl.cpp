@@ -3,11 +3,33 @@
 
 #include "vfx_impl.h"
 
+#include <EASTL/algorithm.h>
+
+#include "nau/assets/asset_ref.h"
+#include "nau/async/parallel_for.h"
+#include "nau/math/dag_frustum.h"
 #include "vfx_mod_fx_instance.h"
 
 
 namespace nau::vfx
 {
+    namespace
+    {
+        // The detail of the instances by the distance from the camera to their bounds.
+        struct LodTier
+        {
+            float maxDistance;
+            float lodScale;
+        };
+
+        // The instances farther than the last tier are culled.
+        constexpr LodTier LodTiers[] = {
+            { 30.0f, 1.0f},
+            { 80.0f, 0.5f},
+            {200.0f, 0.25f}
+        };
+    }  // namespace
+
     async::Task<> VFXManagerImpl::preInitService()
     {
         return async::Task<>::makeResolved();
@@ -15,12 +37,20 @@ namespace nau::vfx
 
     async::Task<> VFXManagerImpl::initService()
     {
-        return async::Task<>::makeResolved();
+        auto gpuSimMaterialRef = MaterialAssetRef{"file:/res/materials/embedded/modfx_gpu_sim.nmat_json"};
+        m_gpuSimMaterial = co_await gpuSimMaterialRef.getAssetViewTyped<MaterialAssetView>();
+        if (!m_gpuSimMaterial)
+        {
+            NAU_LOG_WARNING("The GPU particle simulation material is not loaded, the emitters are simulated on the CPU");
+        }
+
+        co_return;
     }
 
     async::Task<> VFXManagerImpl::shutdownService()
     {
         m_vfxInstances.clear();
+        m_gpuSimMaterial.reset();
 
         return async::Task<>::makeResolved();
     }
@@ -66,7 +96,7 @@ namespace nau::vfx
 
             // Create a new instance (currently only ModFX supported)
             // TODO Add a type definition in the future
-            std::shared_ptr<IVFXInstance> vfxInstance = std::make_shared<modfx::VFXModFXInstance>(material);
+            std::shared_ptr<IVFXInstance> vfxInstance = std::make_shared<modfx::VFXModFXInstance>(material, m_gpuSimMaterial);
             if (vfxInstance->deserialize(instanceBlock))
             {
                 m_vfxInstances.insert(vfxInstance);
@@ -82,7 +112,7 @@ namespace nau::vfx
     {
         // We only have a ModFX instance
         // TODO Add a factory in the future
-        std::shared_ptr<IVFXInstance> vfxInstance = std::make_shared<modfx::VFXModFXInstance>(material);
+        std::shared_ptr<IVFXInstance> vfxInstance = std::make_shared<modfx::VFXModFXInstance>(material, m_gpuSimMaterial);
         m_vfxInstances.insert(vfxInstance);
 
         return vfxInstance;
@@ -98,8 +128,15 @@ namespace nau::vfx
         if (m_vfxInstances.empty())
             return;
 
+        // The instances are independent: each one is simulated by a single task.
+        m_updateInstances.clear();
         for (auto&& vfx : m_vfxInstances)
-            vfx->update(dt);
+            m_updateInstances.push_back(vfx.get());
+
+        async::parallelFor(m_updateInstances.size(), 1, [this, dt](size_t instanceIndex)
+        {
+            m_updateInstances[instanceIndex]->update(dt);
+        });
     }
 
     void VFXManagerImpl::render(const nau::math::Matrix4& view, const nau::math::Matrix4& projection)
@@ -107,7 +144,32 @@ namespace nau::vfx
         if (m_vfxInstances.empty())
             return;
 
+        const nau::math::NauFrustum frustum(projection * view);
+        const nau::math::Vector3 cameraPosition = inverse(view).getTranslation();
+
         for (auto&& vfx : m_vfxInstances)
+        {
+            const nau::math::BSphere3 bounds = vfx->worldBounds();
+
+            const LodTier* lodTier = nullptr;
+            if (frustum.testSphere(bounds) != 0)
+            {
+                const float distance = eastl::max(length(bounds.c - cameraPosition) - bounds.r, 0.0f);
+                lodTier = eastl::find_if(eastl::begin(LodTiers), eastl::end(LodTiers), [distance](const LodTier& tier)
+                {
+                    return distance <= tier.maxDistance;
+                });
+            }
+
+            if (!lodTier || lodTier == eastl::end(LodTiers))
+            {
+                // Until the catch-up, the hidden instance is simulated at the lowest detail.
+                vfx->setVisibility(false, LodTiers[eastl::size(LodTiers) - 1].lodScale);
+                continue;
+            }
+
+            vfx->setVisibility(true, lodTier->lodScale);
             vfx->render(view, projection);
+        }
     }
 }  // namespace nau::vfx
\ No newline at end of file
@@ -37,5 +37,9 @@ namespace nau::vfx
 
     private:
         eastl::set<std::shared_ptr<IVFXInstance>> m_vfxInstances;
+        // The instances of the parallel update, kept between the frames.
+        eastl::vector<IVFXInstance*> m_updateInstances;
+        // The compute pipelines of the GPU simulated emitters, see modfx::ModfxGpuSim.
+        nau::MaterialAssetView::Ptr m_gpuSimMaterial;
     };
 }  // namespace nau::vfx
\ No newline at end of file
@@ -9,6 +9,7 @@
 #include "modfx/modfx_ren_data.h"
 #include "modfx/modfx_sim_data.h"
 
+#include "nau/math/dag_bounds3.h"
 #include "nau/math/dag_color.h"
 #include "nau/math/math.h"
 #include "nau/dataBlock/dag_dataBlock.h"
@@ -25,6 +26,11 @@ namespace nau::vfx
         virtual void setTransform(const nau::math::Matrix4& transform) = 0;
         virtual nau::math::Matrix4 transform() const = 0;
     
+        // The sphere holding the particles the instance can emit, in the world.
+        virtual nau::math::BSphere3 worldBounds() const = 0;
+        // The visibility of the last rendering and the detail by the distance to the camera: 1 is the full detail.
+        virtual void setVisibility(bool isVisible, float lodScale) = 0;
+
         virtual void update(float dt) = 0;
         virtual void render(const nau::math::Matrix4& view, const nau::math::Matrix4& projection) = 0;
     };
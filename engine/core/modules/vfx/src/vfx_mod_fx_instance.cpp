@@ -20,23 +20,20 @@
 
 namespace nau::vfx::modfx
 {
-    VFXModFXInstance::VFXModFXInstance(const nau::MaterialAssetView::Ptr material)
-        : m_positionBuffer(nullptr)
-        , m_normalBuffer(nullptr)
-        , m_texCoordBuffer(nullptr)
-        , m_quadIndexBuffer(nullptr)
-        , m_instanceData(nullptr)
+    VFXModFXInstance::VFXModFXInstance(const nau::MaterialAssetView::Ptr material, const nau::MaterialAssetView::Ptr gpuSimMaterial)
+        : m_quadGeometry(ModfxQuadGeometry::acquire())
+        , m_instanceBuffer(nullptr)
         , m_material(material)
         , m_actualParticlePoolSize(0)
+        , m_gpuSimMaterial(gpuSimMaterial)
         , m_transform(nau::math::Matrix4::identity())
         , m_offset(nau::math::Vector3::zero())
         , m_isPause(false)
     {
-        prepareQuadBuffer();
         prepareInstanceBuffer();
 
-        m_particlePool.reserve(PoolSizeMultiplier * MaxParticleCount);
-        m_instanceData.reserve(PoolSizeMultiplier * MaxParticleCount);
+        m_particlePool.reserveParticles(PoolSizeMultiplier * MaxParticleCount);
+        m_freeIndexPool.reserve(PoolSizeMultiplier * MaxParticleCount);
     }
 
     void VFXModFXInstance::serialize(nau::DataBlock* blk) const
@@ -68,6 +65,8 @@ namespace nau::vfx::modfx
 
         auto* textureBlock = blk->addNewBlock("texture");
         m_texture.save(textureBlock);
+
+        blk->addBool("gpuSimulation", m_simulationBackend == SimulationBackend::Gpu);
     }
 
     bool VFXModFXInstance::deserialize(const nau::DataBlock* blk)
@@ -214,7 +213,9 @@ namespace nau::vfx::modfx
         m_color.end_color = nau::math::Color4(end_color.r, end_color.g, end_color.b, end_color.a);
         //
 
+        setSimulationBackend(blk->getBool("gpuSimulation", false) ? SimulationBackend::Gpu : SimulationBackend::Cpu);
         updateSpawnSettings();
+        updateGpuSimSettings();
 
         return true;
     }
@@ -234,6 +235,7 @@ namespace nau::vfx::modfx
     {
         m_life = life;
         updateSpawnSettings();
+        updateGpuSimSettings();
     }
 
     settings::FxLife VFXModFXInstance::lifeSettings() const
@@ -244,6 +246,7 @@ namespace nau::vfx::modfx
     void VFXModFXInstance::setPositionSettings(const settings::FxPosition& position)
     {
         m_position = position;
+        updateGpuSimSettings();
     }
 
     settings::FxPosition VFXModFXInstance::positionSettings() const
@@ -254,6 +257,7 @@ namespace nau::vfx::modfx
     void VFXModFXInstance::setRadiusSettings(const settings::FxRadius& radius)
     {
         m_radius = radius;
+        updateGpuSimSettings();
     }
 
     settings::FxRadius VFXModFXInstance::radiusSettings() const
@@ -264,6 +268,7 @@ namespace nau::vfx::modfx
     void VFXModFXInstance::setColorSettings(const settings::FxColor& color)
     {
         m_color = color;
+        updateGpuSimSettings();
     }
 
     settings::FxColor VFXModFXInstance::colorSettings() const
@@ -284,6 +289,7 @@ namespace nau::vfx::modfx
     void VFXModFXInstance::setVelocitySettings(const settings::FxVelocity& velocity)
     {
         m_velocity = velocity;
+        updateGpuSimSettings();
     }
 
     settings::FxVelocity VFXModFXInstance::velocitySettings() const
@@ -294,6 +300,7 @@ namespace nau::vfx::modfx
     void VFXModFXInstance::setTextureSettings(const settings::FxTexture& texture)
     {
         m_texture = texture;
+        updateGpuSimSettings();
     }
 
     settings::FxTexture VFXModFXInstance::textureSettings() const
@@ -301,6 +308,48 @@ namespace nau::vfx::modfx
         return m_texture;
     }
 
+    void VFXModFXInstance::setSimulationBackend(SimulationBackend backend)
+    {
+        if (backend == SimulationBackend::Gpu && !m_gpuSimMaterial)
+        {
+            NAU_LOG_WARNING("The GPU particle simulation material is not loaded, the emitter is simulated on the CPU");
+            backend = SimulationBackend::Cpu;
+        }
+
+        std::lock_guard lock(m_vfxMutex);
+        if (backend == m_simulationBackend)
+        {
+            return;
+        }
+
+        m_simulationBackend = backend;
+        m_particlePool.clear();
+        m_particlePool.reserveParticles(PoolSizeMultiplier * MaxParticleCount);
+        m_freeIndexPool.clear();
+        m_actualParticlePoolSize = 0;
+        m_aliveParticleCount = 0;
+        m_isInstanceDataDirty = false;
+        m_gpuPendingSpawn = 0;
+        m_gpuPendingDt = 0.0f;
+
+        if (m_simulationBackend == SimulationBackend::Gpu)
+        {
+            m_gpuSim = eastl::make_unique<ModfxGpuSim>(m_gpuSimMaterial, GpuMaxParticleCount);
+            m_gpuSim->setSettings(m_life, m_position, m_radius, m_velocity, m_color, m_texture);
+        }
+        else
+        {
+            m_gpuSim.reset();
+        }
+
+        updateSpawnSettings();
+    }
+
+    SimulationBackend VFXModFXInstance::simulationBackend() const
+    {
+        return m_simulationBackend;
+    }
+
     void VFXModFXInstance::setTexture(ReloadableAssetView::Ptr assetTexture)
     {
         m_assetTexture = assetTexture;
@@ -327,6 +376,57 @@ namespace nau::vfx::modfx
         return m_transform;
     }
 
+    nau::math::BSphere3 VFXModFXInstance::worldBounds() const
+    {
+        float shapeRadius = 0.0f;
+        if (m_position.enabled)
+        {
+            switch (m_position.type)
+            {
+                case settings::PositionType::SPHERE:
+                    shapeRadius = m_position.sphere.radius;
+                    break;
+                case settings::PositionType::CYLINDER:
+                    shapeRadius = eastl::max(m_position.cylinder.radius, m_position.cylinder.height);
+                    break;
+                case settings::PositionType::CONE:
+                    shapeRadius = eastl::max({m_position.cone.width_top, m_position.cone.width_bottom, m_position.cone.height});
+                    break;
+                case settings::PositionType::BOX:
+                    shapeRadius = 0.5f * length(nau::math::Vector3(m_position.box.width, m_position.box.height, m_position.box.depth));
+                    break;
+            }
+        }
+
+        // The farthest the particles get in their life: the start and the added speed, the fall.
+        float travelDistance = 0.0f;
+        if (m_velocity.enabled)
+        {
+            const float lifeTime = m_life.part_life_max;
+            float speed = m_velocity.start.enabled ? eastl::max(m_velocity.start.vel_min, m_velocity.start.vel_max) : 0.0f;
+            if (m_velocity.add.enabled)
+            {
+                speed += 0.5f * eastl::max(m_velocity.add.vel_min, m_velocity.add.vel_max) * lifeTime;
+            }
+
+            travelDistance = speed * lifeTime;
+            if (m_velocity.apply_gravity)
+            {
+                travelDistance += 0.5f * 9.81f * lifeTime * lifeTime;
+            }
+        }
+
+        const float particleRadius = m_radius.enabled ? eastl::max(m_radius.rad_min, m_radius.rad_max) : 0.5f;
+        return nau::math::BSphere3(m_offset + (m_position.enabled ? m_position.offset : nau::math::Vector3::zero()),
+                                   shapeRadius + travelDistance + particleRadius);
+    }
+
+    void VFXModFXInstance::setVisibility(bool isVisible, float lodScale)
+    {
+        m_isVisible.store(isVisible, std::memory_order_relaxed);
+        m_lodScale.store(lodScale, std::memory_order_relaxed);
+    }
+
     void VFXModFXInstance::update(float dt)
     {
         if (m_isPause)
@@ -334,10 +434,47 @@ namespace nau::vfx::modfx
             return;
         }
 
+        if (!m_isVisible.load(std::memory_order_relaxed))
+        {
+            m_hiddenTime += dt;
+            if (m_hiddenTime > HiddenCatchUpDelay)
+            {
+                m_catchUpDt += dt;
+                return;
+            }
+        }
+        else
+        {
+            m_hiddenTime = 0.0f;
+            if (m_catchUpDt > 0.0f)
+            {
+                // No particle lives longer than part_life_max: the older time has no visible result.
+                dt += eastl::min(m_catchUpDt, m_life.part_life_max);
+                m_catchUpDt = 0.0f;
+            }
+        }
+
+        const float lodScale = m_lodScale.load(std::memory_order_relaxed);
         int particleToSpawn = emitter_utils::update_emitter(m_emitterState, dt);
+        if (lodScale < 1.0f && particleToSpawn > 0)
+        {
+            const float scaledSpawn = particleToSpawn * lodScale + m_spawnRemainder;
+            particleToSpawn = static_cast<int>(scaledSpawn);
+            m_spawnRemainder = scaledSpawn - particleToSpawn;
+        }
+        if (m_simulationBackend == SimulationBackend::Gpu)
+        {
+            std::lock_guard lock(m_vfxMutex);
+            m_gpuPendingSpawn += particleToSpawn;
+            m_gpuPendingDt += dt;
+            return;
+        }
+
+        std::lock_guard lock(m_vfxMutex);
         if (particleToSpawn > 0)
         {
-            addParticles(particleToSpawn);
+            const int lodParticleLimit = eastl::max(1, static_cast<int>(PoolSizeMultiplier * MaxParticleCount * lodScale));
+            addParticles(particleToSpawn, lodParticleLimit);
         }
 
         if (m_actualParticlePoolSize != 0)
@@ -348,12 +485,43 @@ namespace nau::vfx::modfx
 
     void VFXModFXInstance::render(const nau::math::Matrix4& view, const nau::math::Matrix4& projection)
     {
-        if (m_actualParticlePoolSize == 0 || !m_assetTexture || !m_material)
+        const bool isGpuSimulated = m_simulationBackend == SimulationBackend::Gpu && m_gpuSim;
+        if (!m_assetTexture || !m_material)
         {
             return;
         }
 
-        d3d::set_buffer(STAGE_VS, 1, m_instanceBuffer);
+        int instanceCount = 0;
+
+        if (isGpuSimulated)
+        {
+            int particleToSpawn = 0;
+            float dt = 0.0f;
+            {
+                std::lock_guard lock(m_vfxMutex);
+                eastl::swap(particleToSpawn, m_gpuPendingSpawn);
+                eastl::swap(dt, m_gpuPendingDt);
+            }
+            simulateGpuParticles(particleToSpawn, dt);
+        }
+        else
+        {
+            std::lock_guard lock(m_vfxMutex);
+            instanceCount = m_aliveParticleCount;
+            if (instanceCount == 0)
+            {
+                // No live particles, nothing to draw until the next emission.
+                return;
+            }
+
+            if (m_isInstanceDataDirty)
+            {
+                m_instanceBuffer->updateData(0, sizeof(InstanceData) * instanceCount, m_instanceData.data(), VBLOCK_WRITEONLY | VBLOCK_DISCARD);
+                m_isInstanceDataDirty = false;
+            }
+        }
+
+        d3d::set_buffer(STAGE_VS, 1, isGpuSimulated ? m_gpuSim->getInstanceBuffer() : m_instanceBuffer);
 
         shader_globals::setVariable("view", &view);
         shader_globals::setVariable("projection", &projection);
@@ -367,73 +535,16 @@ namespace nau::vfx::modfx
         m_material->setTexture("default", "tex", textureView->getTexture());
 
         m_material->bindPipeline("default");
-        
-        d3d::setvsrc(0, m_positionBuffer, sizeof(nau::math::float3));
-        d3d::setvsrc(1, m_normalBuffer, sizeof(nau::math::float3));
-        d3d::setvsrc(2, m_texCoordBuffer, sizeof(nau::math::float2));
-
-        d3d::setind(m_quadIndexBuffer);
-
-        d3d::drawind_instanced(PRIM_TRILIST, 0, 6, 0, m_actualParticlePoolSize);
-    }
-
-    void VFXModFXInstance::prepareQuadBuffer()
-    {
-        nau::math::float3 quadPositions[] = {
-            {-0.5f, -0.5f, 0.0f},
-            { 0.5f, -0.5f, 0.0f},
-            { 0.5f,  0.5f, 0.0f},
-            {-0.5f,  0.5f, 0.0f}
-        };
-
-        nau::math::float3 quadNormals[] = {
-            {0, 0,  1},
-            {0, 0,  1},
-            {0, 0, -1},
-            {0, 0, -1}
-        };
-
-        nau::math::float2 quadTexCoords[] = {
-            {0, 1},
-            {1, 1},
-            {1, 0},
-            {0, 0}
-        };
-
-        quadIndices[0] = 0;
-        quadIndices[1] = 1;
-        quadIndices[2] = 2;
-        quadIndices[3] = 2;
-        quadIndices[4] = 3;
-        quadIndices[5] = 0;
-
-        size_t posBufferSize = sizeof(quadPositions);
-        m_positionBuffer = d3d::create_vb(posBufferSize, SBCF_DYNAMIC, u8"PositionBuffer");
-        std::byte* posMemory = nullptr;
-        m_positionBuffer->lock(0, posBufferSize, reinterpret_cast<void**>(&posMemory), VBLOCK_WRITEONLY);
-        std::memcpy(posMemory, quadPositions, posBufferSize);
-        m_positionBuffer->unlock();
-
-        size_t nrmBufferSize = sizeof(quadNormals);
-        m_normalBuffer = d3d::create_vb(nrmBufferSize, SBCF_DYNAMIC, u8"NormalBuffer");
-        std::byte* nrmMemory = nullptr;
-        m_normalBuffer->lock(0, nrmBufferSize, reinterpret_cast<void**>(&nrmMemory), VBLOCK_WRITEONLY);
-        std::memcpy(nrmMemory, quadNormals, nrmBufferSize);
-        m_normalBuffer->unlock();
-
-        size_t texBufferSize = sizeof(quadTexCoords);
-        m_texCoordBuffer = d3d::create_vb(texBufferSize, SBCF_DYNAMIC, u8"TexCoordBuffer");
-        std::byte* texMemory = nullptr;
-        m_texCoordBuffer->lock(0, texBufferSize, reinterpret_cast<void**>(&texMemory), VBLOCK_WRITEONLY);
-        std::memcpy(texMemory, quadTexCoords, texBufferSize);
-        m_texCoordBuffer->unlock();
-
-        size_t indexBufferSize = sizeof(quadIndices);
-        m_quadIndexBuffer = d3d::create_ib(indexBufferSize, SBCF_DYNAMIC, u8"CubeIndexBuffer");
-        std::byte* indexMemory = nullptr;
-        m_quadIndexBuffer->lock(0, indexBufferSize, reinterpret_cast<void**>(&indexMemory), VBLOCK_WRITEONLY);
-        std::memcpy(indexMemory, quadIndices, indexBufferSize);
-        m_quadIndexBuffer->unlock();
+        m_quadGeometry->bind();
+
+        if (isGpuSimulated)
+        {
+            // The alive particles count is known to the GPU only.
+            d3d::draw_indexed_indirect(PRIM_TRILIST, m_gpuSim->getDrawArgsBuffer());
+            return;
+        }
+
+        d3d::drawind_instanced(PRIM_TRILIST, 0, ModfxQuadGeometry::IndexCount, 0, instanceCount);
     }
 
     void VFXModFXInstance::prepareInstanceBuffer()
@@ -451,23 +562,21 @@ namespace nau::vfx::modfx
         }
     }
 
-    void VFXModFXInstance::addParticles(int particleToSpawn)
+    void VFXModFXInstance::addParticles(int particleToSpawn, int particleLimit)
     {
+        const int aliveCount = m_actualParticlePoolSize - static_cast<int>(m_freeIndexPool.size());
+        particleToSpawn = eastl::min(particleToSpawn, particleLimit - aliveCount);
         for (int i = 0; i < particleToSpawn; ++i)
         {
-            if (m_actualParticlePoolSize < PoolSizeMultiplier * MaxParticleCount)
+            if (!m_freeIndexPool.empty())
             {
-                ModFxData data;
-                initializeParticleData(data);
-                m_particlePool.push_back(data);
-
-                ++m_actualParticlePoolSize;
+                initializeParticleData(m_freeIndexPool.back());
+                m_freeIndexPool.pop_back();
             }
-            else if (!m_freeIndexPool.empty())
+            else if (m_actualParticlePoolSize < PoolSizeMultiplier * MaxParticleCount)
             {
-                int freeIndex = *m_freeIndexPool.begin();
-                initializeParticleData(m_particlePool[freeIndex]);
-                m_freeIndexPool.erase(freeIndex);
+                initializeParticleData(m_actualParticlePoolSize);
+                ++m_actualParticlePoolSize;
             }
             else
             {
@@ -492,67 +601,110 @@ namespace nau::vfx::modfx
         m_emitterData.burstData.cycles = m_spawn.burst.cycles;
         m_emitterData.burstData.period = m_spawn.burst.period;
         m_emitterData.burstData.lifeLimit = m_life.part_life_max;
-        m_emitterData.burstData.elemLimit = MaxParticleCount;
+        m_emitterData.burstData.elemLimit = particleLimit();
 
-        m_emitterData.fixedData.count = eastl::min<int>(m_spawn.fixed.count, MaxParticleCount);
+        m_emitterData.fixedData.count = eastl::min<int>(m_spawn.fixed.count, particleLimit());
     
-        emitter_utils::create_emitter_state(m_emitterState, m_emitterData, MaxParticleCount, 1.0f);
+        emitter_utils::create_emitter_state(m_emitterState, m_emitterData, particleLimit(), 1.0f);
+    }
+
+    void VFXModFXInstance::updateGpuSimSettings()
+    {
+        if (m_gpuSim)
+        {
+            m_gpuSim->setSettings(m_life, m_position, m_radius, m_velocity, m_color, m_texture);
+        }
+    }
+
+    int VFXModFXInstance::particleLimit() const
+    {
+        return m_simulationBackend == SimulationBackend::Gpu ? GpuMaxParticleCount : MaxParticleCount;
     }
 
     void VFXModFXInstance::simulateParticles(float dt)
     {
+        constexpr size_t Lanes = ModfxParticlePool::Lanes;
+        const size_t simulatedCount = (m_actualParticlePoolSize + Lanes - 1) / Lanes * Lanes;
+        sim::modfx_apply_sim_soa(m_particlePool, simulatedCount, dt, m_life, m_radius, m_velocity, m_color, m_texture);
+
+        // The instances of the alive particles only, one after another: the draw covers exactly them.
+        int aliveCount = 0;
         for (int i = 0; i < m_actualParticlePoolSize; ++i)
         {
-            if (m_particlePool[i].sdata.life_norm < 1.0f)
+            const float lifeNorm = m_particlePool.lifeNorm[i];
+            if (lifeNorm == ModfxParticlePool::FreeLife)
             {
-                sim::modfx_apply_sim(m_particlePool[i].rdata, m_particlePool[i].sdata, dt, m_life, m_radius, m_velocity, m_color, m_texture);
-                
-                // TODO Multiply in the shader
-                m_instanceData[i].worldMatrix = nau::math::Matrix4::translation(m_particlePool[i].rdata.pos + m_offset) * nau::math::Matrix4::scale(nau::math::Vector3(m_particlePool[i].rdata.radius));
-                m_instanceData[i].frameID = m_particlePool[i].rdata.frame_idx;
-                m_instanceData[i].color = m_particlePool[i].rdata.color;
+                continue;
             }
-            else
+
+            if (lifeNorm >= 1.0f)
             {
-                m_particlePool[i].sdata.life_norm = 2.0f;
-                m_freeIndexPool.insert(i);
+                m_particlePool.freeParticle(i);
+                m_freeIndexPool.push_back(i);
+                continue;
             }
+
+            InstanceData& instance = m_instanceData[aliveCount++];
+            // TODO Multiply in the shader
+            instance.worldMatrix = nau::math::Matrix4::translation(m_particlePool.getPos(i) + m_offset) * nau::math::Matrix4::scale(nau::math::Vector3(m_particlePool.radius[i]));
+            instance.frameID = m_particlePool.frameIdx[i];
+            instance.color = m_particlePool.color[i];
+        }
+
+        m_aliveParticleCount = aliveCount;
+        m_isInstanceDataDirty = true;
+    }
+
+    void VFXModFXInstance::simulateGpuParticles(int particleToSpawn, float dt)
+    {
+        if (m_isPause)
+        {
+            return;
         }
 
-        m_instanceBuffer->updateData(0, sizeof(InstanceData) * m_actualParticlePoolSize, m_instanceData.data(), VBLOCK_WRITEONLY | VBLOCK_DISCARD);
+        m_gpuSim->simulate(static_cast<uint32_t>(eastl::max(particleToSpawn, 0)), dt, m_offset);
     }
 
-    void VFXModFXInstance::initializeParticleData(ModFxData& data)
+    void VFXModFXInstance::initializeParticleData(int index)
     {
-        data.sdata.clear();
-        data.rdata.clear();
+        modfx::ModfxRenData rdata;
+        modfx::ModfxSimData sdata;
+        rdata.clear();
+        sdata.clear();
 
         const int seed = PoolSizeMultiplier * MaxParticleCount;
         int gid = rand() % (seed + 1);
         int dispatch_seed = rand() % (seed + 1);
-        data.sdata.rnd_seed = vfx::math::dafx_calc_instance_rnd_seed(gid, dispatch_seed);
+        sdata.rnd_seed = vfx::math::dafx_calc_instance_rnd_seed(gid, dispatch_seed);
 
-        life::modfx_life_init(data.sdata.rnd_seed, data.sdata.life_norm, m_life);
+        life::modfx_life_init(sdata.rnd_seed, sdata.life_norm, m_life);
 
         if (m_radius.enabled)
         {
-            radius::modfx_radius_init(data.sdata.rnd_seed, data.rdata.radius, m_radius);
+            radius::modfx_radius_init(sdata.rnd_seed, rdata.radius, m_radius);
         }
 
         nau::math::Vector3 pos_v = nau::math::Vector3::zero();
         if (m_position.enabled)
         {
-            position::modfx_position_init(data.sdata.rnd_seed, dispatch_seed, data.rdata.pos, pos_v, m_position);
+            position::modfx_position_init(sdata.rnd_seed, dispatch_seed, rdata.pos, pos_v, m_position);
         }
 
         if (m_velocity.enabled)
         {
-            velocity::modfx_velocity_init(data.rdata.pos, pos_v, data.sdata.velocity, data.sdata.rnd_seed, m_velocity);
+            velocity::modfx_velocity_init(rdata.pos, pos_v, sdata.velocity, sdata.rnd_seed, m_velocity);
         }
 
         if (m_color.enabled)
         {
-            color::modfx_color_init(data.sdata.rnd_seed, data.rdata.color, m_color);
+            color::modfx_color_init(sdata.rnd_seed, rdata.color, m_color);
         }
+
+        // The life rate of the particle for the whole life, see sim::modfx_apply_sim_soa.
+        const float lifeTimeRCP = 1.0f / (m_life.part_life_max != 0.0f ? m_life.part_life_max : 1.0f);
+        float lifeRate = 0.0f;
+        life::modfx_life_sim(sdata.rnd_seed, lifeTimeRCP, 1.0f, m_life, lifeRate);
+
+        m_particlePool.setParticle(index, rdata, sdata, lifeRate);
     }
 }  // namespace nau::vfx::modfx
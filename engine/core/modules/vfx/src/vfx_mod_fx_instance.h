@@ -9,6 +9,9 @@
 
 #include "vfx_instance.h"
 
+#include "modfx/modfx_gpu_sim.h"
+#include "modfx/modfx_particle_pool.h"
+#include "modfx/modfx_quad_geometry.h"
 #include "modfx/emitter/emitter_state.h"
 #include "modfx/emitter/emitter_data.h"
 
@@ -23,15 +26,27 @@
 
 #include "nau/math/math.h"
 
+#include <atomic>
 
 namespace nau::vfx::modfx
 {
+    /**
+     * Where the particles of an emitter are simulated. The CPU keeps the particles readable by the gameplay,
+     * the GPU simulates the large effects: their particles are never read back.
+     */
+    enum class SimulationBackend
+    {
+        Cpu,
+        Gpu
+    };
+
     class NAU_VFX_EXPORT VFXModFXInstance : public IVFXInstance
     {
         NAU_CLASS(nau::vfx::modfx::VFXModFXInstance, rtti::RCPolicy::Concurrent, IVFXInstance)
 
     public:
-        VFXModFXInstance(const nau::MaterialAssetView::Ptr material);
+        // The GPU simulation material is required by the SimulationBackend::Gpu emitters.
+        VFXModFXInstance(const nau::MaterialAssetView::Ptr material, const nau::MaterialAssetView::Ptr gpuSimMaterial = nullptr);
         ~VFXModFXInstance() = default;
 
         void serialize(nau::DataBlock* blk) const override;
@@ -62,6 +77,10 @@ namespace nau::vfx::modfx
         void setTextureSettings(const settings::FxTexture& texture);
         settings::FxTexture textureSettings() const;
 
+        // The CPU particles are dropped when the backend changes.
+        void setSimulationBackend(SimulationBackend backend);
+        SimulationBackend simulationBackend() const;
+
     public:
         void setTexture(ReloadableAssetView::Ptr assetTexture);
 
@@ -73,27 +92,29 @@ namespace nau::vfx::modfx
         void setTransform(const nau::math::Matrix4& transform) override;
         nau::math::Matrix4 transform() const override;
 
+        nau::math::BSphere3 worldBounds() const override;
+        void setVisibility(bool isVisible, float lodScale) override;
+
         void update(float dt) override;
         void render(const nau::math::Matrix4& view, const nau::math::Matrix4& projection) override;
 
     private:
-        struct ModFxData
-        {
-            modfx::ModfxRenData rdata;
-            modfx::ModfxSimData sdata;
-        };
-
-    private:
-        void addParticles(int particleToSpawn);
-        void initializeParticleData(ModFxData& data);
+        void addParticles(int particleToSpawn, int particleLimit);
+        void initializeParticleData(int index);
 
         void simulateParticles(float dt);
+        void simulateGpuParticles(int particleToSpawn, float dt);
 
         void updateSpawnSettings();
+        void updateGpuSimSettings();
+        int particleLimit() const;
 
     private:
         static inline constexpr int PoolSizeMultiplier = 2;
         static inline constexpr int MaxParticleCount = 20;
+        static inline constexpr int GpuMaxParticleCount = 1024 * 64;
+        // The emitters hidden longer are not simulated until they are visible again.
+        static inline constexpr float HiddenCatchUpDelay = 1.0f;
 
     private:
         settings::FxSpawn m_spawn;
@@ -106,12 +127,7 @@ namespace nau::vfx::modfx
         settings::FxTexture m_texture;
 
     private:
-        // TODO Move out to base class
-        Sbuffer* m_positionBuffer;
-        Sbuffer* m_normalBuffer;
-        Sbuffer* m_texCoordBuffer;
-
-        Sbuffer* m_quadIndexBuffer;
+        std::shared_ptr<ModfxQuadGeometry> m_quadGeometry;
         Sbuffer* m_instanceBuffer;
 
         MaterialAssetView::Ptr m_material;
@@ -125,27 +141,44 @@ namespace nau::vfx::modfx
             nau::math::uint3 dummy;
         };
 
-        uint16_t quadIndices[6];
-
-        void prepareQuadBuffer();
         void prepareInstanceBuffer();
 
     private:
         EmitterData m_emitterData;
         EmitterState m_emitterState;
 
-        eastl::vector<ModFxData> m_particlePool;
-        eastl::unordered_set<int> m_freeIndexPool;
+        ModfxParticlePool m_particlePool;
+        eastl::vector<int> m_freeIndexPool;
         eastl::vector<InstanceData> m_instanceData;
+        // The instances are simulated with the update and uploaded with the rendering.
+        bool m_isInstanceDataDirty = false;
 
     private:
         int m_actualParticlePoolSize;
+        // The instances drawn: the particles alive after the last simulation.
+        int m_aliveParticleCount = 0;
+
+        SimulationBackend m_simulationBackend = SimulationBackend::Cpu;
+        MaterialAssetView::Ptr m_gpuSimMaterial;
+        eastl::unique_ptr<ModfxGpuSim> m_gpuSim;
+        // The GPU simulation runs with the rendering: the emission and the time of the updates until then.
+        int m_gpuPendingSpawn = 0;
+        float m_gpuPendingDt = 0.0f;
 
         nau::math::Matrix4 m_transform;
         nau::math::Vector3 m_offset;
 
         bool m_isPause;
 
+        // Set by the rendering, read by the update.
+        std::atomic<bool> m_isVisible = true;
+        std::atomic<float> m_lodScale = 1.0f;
+        float m_hiddenTime = 0.0f;
+        // The time hidden, simulated by a single step when the emitter is visible again.
+        float m_catchUpDt = 0.0f;
+        // The fraction of the particles the LOD did not spawn yet.
+        float m_spawnRemainder = 0.0f;
+
         std::mutex m_vfxMutex;
     };
 }  // namespace nau::vfx::modfx
\ No newline at end of file
@@ -0,0 +1,63 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <EASTL/string.h>
+
+#include "nau/meta/class_info.h"
+
+namespace nau::sample
+{
+    /**
+        The benchmark settings, read from the "/benchmark" global properties (see config/benchmark.json).
+        The counts scale the procedural scene, the same seed and counts always build the same scene.
+     */
+    struct BenchmarkConfig
+    {
+        uint32_t staticMeshes = 2500;
+        uint32_t skinnedCharacters = 32;
+        uint32_t omniLights = 128;
+        uint32_t particleSystems = 16;
+        uint32_t physicsBodies = 512;
+        uint32_t seed = 1;
+
+        /// The frames to skip before the capture: the assets streaming and the shader pipelines warm up.
+        uint32_t warmupFrames = 120;
+        uint32_t measuredFrames = 1200;
+
+        /// The camera path is driven by the frame index (not by the time), so each run renders the same views.
+        uint32_t cameraOrbitFrames = 600;
+
+        bool renderNodeTimings = true;
+        bool quitOnComplete = true;
+
+        /// The directory of the results, [sampleProjectDir]/results when empty.
+        eastl::string outputDir;
+
+        eastl::string staticMeshAsset;
+        eastl::string boxMeshAsset;
+        eastl::string characterSceneAsset;
+        eastl::string particleAsset;
+        eastl::string environmentTexture;
+
+        NAU_CLASS_FIELDS(
+            CLASS_FIELD(staticMeshes),
+            CLASS_FIELD(skinnedCharacters),
+            CLASS_FIELD(omniLights),
+            CLASS_FIELD(particleSystems),
+            CLASS_FIELD(physicsBodies),
+            CLASS_FIELD(seed),
+            CLASS_FIELD(warmupFrames),
+            CLASS_FIELD(measuredFrames),
+            CLASS_FIELD(cameraOrbitFrames),
+            CLASS_FIELD(renderNodeTimings),
+            CLASS_FIELD(quitOnComplete),
+            CLASS_FIELD(outputDir),
+            CLASS_FIELD(staticMeshAsset),
+            CLASS_FIELD(boxMeshAsset),
+            CLASS_FIELD(characterSceneAsset),
+            CLASS_FIELD(particleAsset),
+            CLASS_FIELD(environmentTexture))
+    };
+}  // namespace nau::sample
@@ -0,0 +1,94 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#include "./benchmark_driver.h"
+
+#include <numbers>
+
+#include "./benchmark_scene.h"
+
+namespace nau::sample
+{
+    NAU_IMPLEMENT_DYNAMIC_OBJECT(BenchmarkDriver)
+
+    void BenchmarkDriver::setup(const BenchmarkConfig& config, scene::ObjectWeakRef<scene::SceneObject> cameraObject)
+    {
+        m_config = config;
+        m_cameraObject = cameraObject;
+        m_recorder = {};
+        m_frameIndex = 0;
+        m_isCompleted = false;
+    }
+
+    void BenchmarkDriver::updateComponent(float dt)
+    {
+        if (m_isCompleted)
+        {
+            return;
+        }
+
+        updateCamera();
+
+        if (m_frameIndex >= m_config.warmupFrames)
+        {
+            m_recorder.recordFrame(m_frameIndex - m_config.warmupFrames, dt * 1000.f);
+
+            if (m_recorder.getFramesCount() >= m_config.measuredFrames)
+            {
+                completeCapture();
+            }
+        }
+
+        ++m_frameIndex;
+    }
+
+    void BenchmarkDriver::updateCamera()
+    {
+        if (!m_cameraObject)
+        {
+            return;
+        }
+
+        // The orbit around the area center: the radius and the height oscillate so the view sweeps both the dense and the sparse parts.
+        const float orbitFrames = static_cast<float>(eastl::max(m_config.cameraOrbitFrames, 1u));
+        const float angle = std::numbers::pi_v<float> * 2.f * static_cast<float>(m_frameIndex) / orbitFrames;
+
+        const float extent = getBenchmarkAreaExtent(m_config);
+        const float radius = extent * (0.75f + 0.25f * std::sin(angle * 2.f));
+        const float height = 8.f + 4.f * std::sin(angle * 3.f);
+        const float pitch = std::atan2(height, radius);
+
+        m_cameraObject->setTranslation({radius * std::sin(angle), height, radius * std::cos(angle)});
+        m_cameraObject->setRotation(math::quat::rotationY(angle) * math::quat::rotationX(-pitch));
+    }
+
+    void BenchmarkDriver::completeCapture()
+    {
+        m_isCompleted = true;
+
+        std::filesystem::path outputDir;
+        if (!m_config.outputDir.empty())
+        {
+            outputDir = std::filesystem::path{m_config.outputDir.c_str()};
+        }
+        else
+        {
+            const eastl::string projectDir = getServiceProvider().get<GlobalProperties>().getValue<eastl::string>("/sampleProjectDir").value_or("");
+            outputDir = std::filesystem::path{projectDir.c_str()} / "results";
+        }
+
+        if (Result<> writeResult = m_recorder.writeResults(outputDir, m_config); writeResult)
+        {
+            NAU_LOG("The benchmark results ({} frames) are written to ({})", m_recorder.getFramesCount(), outputDir.string());
+        }
+        else
+        {
+            NAU_LOG_ERROR("Fail to write the benchmark results: {}", writeResult.getError()->getDiagMessage());
+        }
+
+        if (m_config.quitOnComplete)
+        {
+            getApplication().stop();
+        }
+    }
+}  // namespace nau::sample
@@ -0,0 +1,40 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#pragma once
+
+#include "./benchmark_config.h"
+#include "./benchmark_recorder.h"
+#include "nau/scene/components/component.h"
+#include "nau/scene/components/component_life_cycle.h"
+#include "nau/scene/scene_object.h"
+
+namespace nau::sample
+{
+    /**
+        Flies the camera along the deterministic path, captures the frames after the warm up,
+        writes the results and quits the application (if configured) when all the measured frames are captured.
+     */
+    class BenchmarkDriver final : public scene::Component,
+                                  public scene::IComponentUpdate
+    {
+        NAU_OBJECT(nau::sample::BenchmarkDriver, scene::Component, scene::IComponentUpdate)
+        NAU_DECLARE_DYNAMIC_OBJECT
+
+    public:
+        void setup(const BenchmarkConfig& config, scene::ObjectWeakRef<scene::SceneObject> cameraObject);
+
+    private:
+        void updateComponent(float dt) override;
+
+        void updateCamera();
+
+        void completeCapture();
+
+        BenchmarkConfig m_config;
+        scene::ObjectWeakRef<scene::SceneObject> m_cameraObject;
+        BenchmarkRecorder m_recorder;
+        uint32_t m_frameIndex = 0;
+        bool m_isCompleted = false;
+    };
+}  // namespace nau::sample
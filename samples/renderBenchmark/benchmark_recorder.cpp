@@ -0,0 +1,276 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#include "./benchmark_recorder.h"
+
+#include <EASTL/sort.h>
+
+#include "nau/app/main_loop/game_system_timings.h"
+#include "nau/io/file_system.h"
+#include "nau/memory/memory_stats.h"
+#include "nau/render/render_frame_stats.h"
+#include "nau/serialization/json.h"
+#include "nau/serialization/runtime_value_builder.h"
+
+namespace nau::sample
+{
+    namespace
+    {
+        constexpr float BytesInMb = 1024.f * 1024.f;
+
+        struct BenchmarkMetric
+        {
+            eastl::string name;
+            uint32_t samples = 0;
+            float average = 0.f;
+            float median = 0.f;
+            float p95 = 0.f;
+            float p99 = 0.f;
+            float max = 0.f;
+
+            NAU_CLASS_FIELDS(
+                CLASS_FIELD(name),
+                CLASS_FIELD(samples),
+                CLASS_FIELD(average),
+                CLASS_FIELD(median),
+                CLASS_FIELD(p95),
+                CLASS_FIELD(p99),
+                CLASS_FIELD(max))
+        };
+
+        struct BenchmarkSummary
+        {
+            BenchmarkConfig config;
+            uint32_t frames = 0;
+            eastl::vector<BenchmarkMetric> metrics;
+
+            NAU_CLASS_FIELDS(
+                CLASS_FIELD(config),
+                CLASS_FIELD(frames),
+                CLASS_FIELD(metrics))
+        };
+
+        BenchmarkMetric makeMetric(eastl::string name, eastl::vector<float> values)
+        {
+            BenchmarkMetric metric;
+            metric.name = std::move(name);
+            metric.samples = static_cast<uint32_t>(values.size());
+
+            if (values.empty())
+            {
+                return metric;
+            }
+
+            eastl::sort(values.begin(), values.end());
+
+            // Nearest rank percentile
+            const auto percentile = [&values](float p)
+            {
+                const size_t rank = static_cast<size_t>(std::ceil(p * static_cast<float>(values.size())));
+                return values[eastl::clamp<size_t>(rank, 1, values.size()) - 1];
+            };
+
+            float total = 0.f;
+            for (const float value : values)
+            {
+                total += value;
+            }
+
+            metric.average = total / static_cast<float>(values.size());
+            metric.median = percentile(0.5f);
+            metric.p95 = percentile(0.95f);
+            metric.p99 = percentile(0.99f);
+            metric.max = values.back();
+
+            return metric;
+        }
+
+        template <typename Getter>
+        eastl::vector<float> collectValues(const auto& frames, Getter getter)
+        {
+            eastl::vector<float> values;
+            values.reserve(frames.size());
+
+            for (const auto& frame : frames)
+            {
+                if (const float value = getter(frame); value >= 0.f)
+                {
+                    values.push_back(value);
+                }
+            }
+
+            return values;
+        }
+
+        Result<> writeText(io::IStreamWriter& stream, eastl::string_view text)
+        {
+            NauCheckResult(stream.write(reinterpret_cast<const std::byte*>(text.data()), text.size()));
+            return ResultSuccess;
+        }
+
+        io::IStreamWriter::Ptr createResultFile(const std::filesystem::path& path)
+        {
+            const std::string pathStr = path.string();
+            return io::createNativeFileStream(pathStr.c_str(), io::AccessMode::Write, io::OpenFileMode::CreateAlways);
+        }
+    }  // namespace
+
+    size_t BenchmarkRecorder::getSystemColumn(eastl::string_view name)
+    {
+        auto column = eastl::find_if(m_systemNames.begin(), m_systemNames.end(), [name](const eastl::string& systemName)
+        {
+            return name == systemName;
+        });
+        if (column == m_systemNames.end())
+        {
+            column = &m_systemNames.emplace_back(name);
+        }
+
+        return static_cast<size_t>(column - m_systemNames.begin());
+    }
+
+    BenchmarkRecorder::NodeSamples& BenchmarkRecorder::getNodeSamples(eastl::string_view name)
+    {
+        auto node = eastl::find_if(m_nodes.begin(), m_nodes.end(), [name](const NodeSamples& samples)
+        {
+            return name == samples.name;
+        });
+
+        if (node == m_nodes.end())
+        {
+            node = &m_nodes.emplace_back();
+            node->name = eastl::string{name};
+        }
+
+        return *node;
+    }
+
+    void BenchmarkRecorder::recordFrame(uint32_t frameIndex, float frameMs)
+    {
+        using namespace std::chrono;
+
+        FrameSample& frame = m_frames.emplace_back();
+        frame.frameIndex = frameIndex;
+        frame.frameMs = frameMs;
+
+        for (const GameSystemTimings& timings : getGameSystemTimings())
+        {
+            const size_t column = getSystemColumn(timings.name);
+            frame.systemMs.resize(eastl::max(frame.systemMs.size(), column + 1), -1.f);
+            frame.systemMs[column] = static_cast<float>(timings.last.count()) / 1000.f;
+        }
+
+        const render::RenderFrameStats renderStats = render::getRenderFrameStats();
+        frame.renderCpuMs = renderStats.cpuRenderMs;
+        frame.renderGpuMs = renderStats.gpuFrameMs;
+        frame.drawCalls = renderStats.drawCalls;
+        frame.instances = renderStats.instances;
+        frame.triangles = renderStats.triangles;
+        frame.dispatches = renderStats.dispatches;
+        frame.vramUsedMb = static_cast<float>(renderStats.vramUsedKb) / 1024.f;
+
+        for (const render::RenderNodeStats& nodeStats : renderStats.nodes)
+        {
+            NodeSamples& node = getNodeSamples(nodeStats.name);
+            node.cpuMs.push_back(nodeStats.cpuAvgMs);
+            if (nodeStats.gpuAvgMs >= 0.f)
+            {
+                node.gpuMs.push_back(nodeStats.gpuAvgMs);
+            }
+        }
+
+        const MemoryStatsSnapshot memoryStats = getMemoryStatsSnapshot();
+        int64_t memoryBytes = 0;
+        for (const MemoryTagStats& tagStats : memoryStats.tags)
+        {
+            memoryBytes += tagStats.currentBytes;
+        }
+
+        frame.memoryMb = static_cast<float>(memoryBytes) / BytesInMb;
+    }
+
+    Result<> BenchmarkRecorder::writeResults(const std::filesystem::path& outputDir, const BenchmarkConfig& config) const
+    {
+        std::error_code ec;
+        std::filesystem::create_directories(outputDir, ec);
+        if (ec)
+        {
+            return NauMakeError("Fail to create the results directory ({}): {}", outputDir.string(), ec.message());
+        }
+
+        {
+            io::IStreamWriter::Ptr csv = createResultFile(outputDir / "frames.csv");
+            if (!csv)
+            {
+                return NauMakeError("Fail to create frames.csv");
+            }
+
+            eastl::string header = "frame,frameMs,renderCpuMs,renderGpuMs,drawCalls,instances,triangles,dispatches,vramUsedMb,memoryMb";
+            for (const eastl::string& systemName : m_systemNames)
+            {
+                header.append_sprintf(",%s", systemName.c_str());
+            }
+
+            NauCheckResult(writeText(*csv, header));
+
+            for (const FrameSample& frame : m_frames)
+            {
+                eastl::string row;
+                row.sprintf("\n%u,%.3f,%.3f,%.3f,%u,%u,%llu,%u,%.1f,%.1f", frame.frameIndex, frame.frameMs, frame.renderCpuMs, frame.renderGpuMs,
+                            frame.drawCalls, frame.instances, static_cast<unsigned long long>(frame.triangles), frame.dispatches, frame.vramUsedMb, frame.memoryMb);
+
+                for (size_t i = 0; i < m_systemNames.size(); ++i)
+                {
+                    if (i < frame.systemMs.size() && frame.systemMs[i] >= 0.f)
+                    {
+                        row.append_sprintf(",%.3f", frame.systemMs[i]);
+                    }
+                    else
+                    {
+                        // The empty cell: the system was not reported yet
+                        row.push_back(',');
+                    }
+                }
+
+                NauCheckResult(writeText(*csv, row));
+            }
+        }
+
+        BenchmarkSummary summary;
+        summary.config = config;
+        summary.frames = static_cast<uint32_t>(m_frames.size());
+
+        auto& metrics = summary.metrics;
+        metrics.push_back(makeMetric("frameMs", collectValues(m_frames, [](const FrameSample& f) { return f.frameMs; })));
+        metrics.push_back(makeMetric("render/cpuMs", collectValues(m_frames, [](const FrameSample& f) { return f.renderCpuMs; })));
+        metrics.push_back(makeMetric("render/gpuMs", collectValues(m_frames, [](const FrameSample& f) { return f.renderGpuMs; })));
+        metrics.push_back(makeMetric("render/drawCalls", collectValues(m_frames, [](const FrameSample& f) { return static_cast<float>(f.drawCalls); })));
+        metrics.push_back(makeMetric("render/instances", collectValues(m_frames, [](const FrameSample& f) { return static_cast<float>(f.instances); })));
+        metrics.push_back(makeMetric("render/triangles", collectValues(m_frames, [](const FrameSample& f) { return static_cast<float>(f.triangles); })));
+        metrics.push_back(makeMetric("render/dispatches", collectValues(m_frames, [](const FrameSample& f) { return static_cast<float>(f.dispatches); })));
+        metrics.push_back(makeMetric("memory/vramUsedMb", collectValues(m_frames, [](const FrameSample& f) { return f.vramUsedMb; })));
+        metrics.push_back(makeMetric("memory/trackedMb", collectValues(m_frames, [](const FrameSample& f) { return f.memoryMb; })));
+
+        for (size_t i = 0; i < m_systemNames.size(); ++i)
+        {
+            metrics.push_back(makeMetric("system/" + m_systemNames[i], collectValues(m_frames, [i](const FrameSample& f)
+            {
+                return i < f.systemMs.size() ? f.systemMs[i] : -1.f;
+            })));
+        }
+
+        for (const NodeSamples& node : m_nodes)
+        {
+            metrics.push_back(makeMetric("node/cpu/" + node.name, node.cpuMs));
+            metrics.push_back(makeMetric("node/gpu/" + node.name, node.gpuMs));
+        }
+
+        io::IStreamWriter::Ptr json = createResultFile(outputDir / "summary.json");
+        if (!json)
+        {
+            return NauMakeError("Fail to create summary.json");
+        }
+
+        return serialization::jsonWrite(*json, makeValueRef(summary), serialization::JsonSettings{.pretty = true});
+    }
+}  // namespace nau::sample
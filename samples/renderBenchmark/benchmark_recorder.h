@@ -0,0 +1,70 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <EASTL/string.h>
+#include <EASTL/vector.h>
+
+#include <filesystem>
+
+#include "./benchmark_config.h"
+#include "nau/utils/result.h"
+
+namespace nau::sample
+{
+    /**
+        Collects the per frame statistics of the engine: the frame time, the CPU time of each game system,
+        the render thread and the render graph node timings, the draw counters, the VRAM and the tracked memory.
+
+        The render statistics are of the last presented frame: with the concurrent render they lag the game frame by one.
+     */
+    class BenchmarkRecorder
+    {
+    public:
+        void recordFrame(uint32_t frameIndex, float frameMs);
+
+        /**
+            Writes frames.csv (a row per captured frame) and summary.json (the average, the median, the percentiles and the max of each metric).
+         */
+        Result<> writeResults(const std::filesystem::path& outputDir, const BenchmarkConfig& config) const;
+
+        size_t getFramesCount() const
+        {
+            return m_frames.size();
+        }
+
+    private:
+        struct FrameSample
+        {
+            uint32_t frameIndex = 0;
+            float frameMs = 0.f;
+            float renderCpuMs = 0.f;
+            float renderGpuMs = -1.f;
+            uint32_t drawCalls = 0;
+            uint32_t instances = 0;
+            uint64_t triangles = 0;
+            uint32_t dispatches = 0;
+            float vramUsedMb = 0.f;
+            float memoryMb = 0.f;
+
+            /// Aligned with m_systemNames: the systems reported after the frame are not in the sample.
+            eastl::vector<float> systemMs;
+        };
+
+        struct NodeSamples
+        {
+            eastl::string name;
+            eastl::vector<float> cpuMs;
+            eastl::vector<float> gpuMs;
+        };
+
+        size_t getSystemColumn(eastl::string_view name);
+
+        NodeSamples& getNodeSamples(eastl::string_view name);
+
+        eastl::vector<eastl::string> m_systemNames;
+        eastl::vector<FrameSample> m_frames;
+        eastl::vector<NodeSamples> m_nodes;
+    };
+}  // namespace nau::sample
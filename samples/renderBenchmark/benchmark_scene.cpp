@@ -0,0 +1,264 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#include "./benchmark_scene.h"
+
+#include <numbers>
+
+#include "./benchmark_driver.h"
+#include "nau/animation/animation_manager.h"
+#include "nau/assets/asset_ref.h"
+#include "nau/assets/scene_asset.h"
+#include "nau/async/task_collection.h"
+#include "nau/physics/components/rigid_body_component.h"
+#include "nau/scene/components/camera_component.h"
+#include "nau/scene/components/directional_light_component.h"
+#include "nau/scene/components/environment_component.h"
+#include "nau/scene/components/omnilight_component.h"
+#include "nau/scene/components/static_mesh_component.h"
+
+namespace nau::sample
+{
+    namespace
+    {
+        constexpr float MeshSpacing = 4.f;
+        constexpr float CameraFarPlane = 1000.f;
+
+        /**
+            The xorshift generator: unlike the std distributions its sequence does not depend on the standard library,
+            so the scene layout is the same on all the platforms.
+         */
+        class BenchmarkRandom
+        {
+        public:
+            explicit BenchmarkRandom(uint32_t seed) :
+                m_state(seed != 0 ? seed : 1)
+            {
+            }
+
+            float next()
+            {
+                m_state ^= m_state << 13;
+                m_state ^= m_state >> 17;
+                m_state ^= m_state << 5;
+
+                return static_cast<float>(m_state >> 8) / static_cast<float>(1 << 24);
+            }
+
+            float range(float min, float max)
+            {
+                return min + (max - min) * next();
+            }
+
+        private:
+            uint32_t m_state;
+        };
+
+        void addStaticMeshes(scene::SceneObject& root, const BenchmarkConfig& config, BenchmarkRandom& random)
+        {
+            using namespace nau::scene;
+
+            auto& factory = getServiceProvider().get<ISceneFactory>();
+            const StaticMeshAssetRef meshAsset{config.staticMeshAsset};
+
+            const uint32_t gridSize = static_cast<uint32_t>(std::ceil(std::sqrt(static_cast<float>(config.staticMeshes))));
+            const float extent = getBenchmarkAreaExtent(config);
+
+            SceneObject::Ptr prototype = factory.createSceneObject<StaticMeshComponent>();
+            prototype->getRootComponent<StaticMeshComponent>().setMeshGeometry(meshAsset);
+
+            for (uint32_t i = 0; i < config.staticMeshes; ++i)
+            {
+                auto& meshObject = root.attachChild(prototype->clone());
+                meshObject.setName(::fmt::format("StaticMesh.{}", i).c_str());
+                meshObject.setTranslation({MeshSpacing * (i % gridSize) - extent, 0.f, MeshSpacing * (i / gridSize) - extent});
+                meshObject.setRotation(math::quat::rotationY(random.range(0.f, std::numbers::pi_v<float> * 2.f)));
+
+                const float scale = random.range(0.5f, 1.5f);
+                meshObject.setScale({scale, scale, scale});
+            }
+        }
+
+        void addOmniLights(scene::SceneObject& root, const BenchmarkConfig& config, BenchmarkRandom& random)
+        {
+            using namespace nau::scene;
+
+            auto& factory = getServiceProvider().get<ISceneFactory>();
+            const float extent = getBenchmarkAreaExtent(config);
+
+            for (uint32_t i = 0; i < config.omniLights; ++i)
+            {
+                auto& lightObject = root.attachChild(factory.createSceneObject<OmnilightComponent>());
+                lightObject.setName(::fmt::format("OmniLight.{}", i).c_str());
+                lightObject.setTranslation({random.range(-extent, extent), random.range(2.f, 8.f), random.range(-extent, extent)});
+
+                auto& light = lightObject.getRootComponent<OmnilightComponent>();
+                light.setColor({random.range(0.2f, 1.f), random.range(0.2f, 1.f), random.range(0.2f, 1.f)});
+                light.setRadius(random.range(6.f, 12.f));
+                light.setIntensity(random.range(0.5f, 2.f));
+            }
+        }
+
+        void addParticleSystems(scene::SceneObject& root, const BenchmarkConfig& config, BenchmarkRandom& random)
+        {
+            if (config.particleSystems == 0)
+            {
+                return;
+            }
+
+            if (config.particleAsset.empty())
+            {
+                NAU_LOG_WARNING("The particle systems are skipped: /benchmark/particleAsset is not set");
+                return;
+            }
+
+            // The VFX component header is private to its module: the component is created by its type name.
+            const rtti::TypeInfo vfxComponentType = rtti::makeTypeInfoFromName("nau::vfx::VFXComponent");
+            const float extent = getBenchmarkAreaExtent(config);
+
+            for (uint32_t i = 0; i < config.particleSystems; ++i)
+            {
+                auto& vfxObject = root.attachChild(getServiceProvider().get<scene::ISceneFactory>().createSceneObject());
+                vfxObject.setName(::fmt::format("Particles.{}", i).c_str());
+                vfxObject.setTranslation({random.range(-extent, extent), 1.f, random.range(-extent, extent)});
+
+                vfxObject.addComponent(vfxComponentType, [&config](scene::Component& component)
+                {
+                    component.setFieldValue("vfxAssetPath", makeValueCopy(config.particleAsset)).ignore();
+                });
+            }
+        }
+
+        void addPhysicsBodies(scene::SceneObject& root, const BenchmarkConfig& config, BenchmarkRandom& random)
+        {
+            using namespace nau::scene;
+
+            auto& factory = getServiceProvider().get<ISceneFactory>();
+            const StaticMeshAssetRef boxAsset{config.boxMeshAsset};
+            const float extent = getBenchmarkAreaExtent(config);
+
+            {
+                auto& floorObject = root.attachChild(factory.createSceneObject<StaticMeshComponent>());
+                floorObject.setName("Floor");
+                floorObject.getRootComponent<StaticMeshComponent>().setMeshGeometry(boxAsset);
+                floorObject.setTranslation({0.f, -1.f, 0.f});
+                floorObject.setScale({extent + MeshSpacing, 0.5f, extent + MeshSpacing});
+
+                auto& rigidBody = floorObject.addComponent<physics::RigidBodyComponent>();
+                rigidBody.setMotionType(physics::MotionType::Static);
+                rigidBody.getCollisions().addBox(floorObject.getScale());
+            }
+
+            // The bodies fall onto the central part of the area: the stacks keep the contacts alive through the whole capture.
+            const float dropExtent = eastl::max(extent * 0.25f, MeshSpacing);
+
+            for (uint32_t i = 0; i < config.physicsBodies; ++i)
+            {
+                auto& boxObject = root.attachChild(factory.createSceneObject<StaticMeshComponent>());
+                boxObject.setName(::fmt::format("Body.{}", i).c_str());
+                boxObject.getRootComponent<StaticMeshComponent>().setMeshGeometry(boxAsset);
+                boxObject.setTranslation({random.range(-dropExtent, dropExtent), random.range(10.f, 60.f), random.range(-dropExtent, dropExtent)});
+                boxObject.setRotation(math::quat::rotationY(random.range(0.f, std::numbers::pi_v<float> * 2.f)));
+                boxObject.setScale({0.5f, 0.5f, 0.5f});
+
+                auto& rigidBody = boxObject.addComponent<physics::RigidBodyComponent>();
+                rigidBody.setMotionType(physics::MotionType::Dynamic);
+                rigidBody.setMass(10);
+                rigidBody.getCollisions().addBox(boxObject.getScale());
+            }
+        }
+    }  // namespace
+
+    float getBenchmarkAreaExtent(const BenchmarkConfig& config)
+    {
+        const uint32_t gridSize = static_cast<uint32_t>(std::ceil(std::sqrt(static_cast<float>(eastl::max(config.staticMeshes, 1u)))));
+        return MeshSpacing * static_cast<float>(gridSize) * 0.5f;
+    }
+
+    scene::IScene::Ptr makeBenchmarkScene(const BenchmarkConfig& config)
+    {
+        using namespace nau::scene;
+
+        auto& factory = getServiceProvider().get<ISceneFactory>();
+
+        IScene::Ptr scene = factory.createEmptyScene();
+        scene->setName("benchmark");
+
+        SceneObject& sceneRoot = scene->getRoot();
+        sceneRoot.addComponent<DirectionalLightComponent>();
+
+        if (!config.environmentTexture.empty())
+        {
+            auto& environment = sceneRoot.addComponent<EnvironmentComponent>();
+            environment.setIntensity(0.5f);
+            environment.setTextureAsset(TextureAssetRef{config.environmentTexture});
+        }
+
+        // Each object kind has its own random sequence: changing the count of one kind does not move the others.
+        {
+            BenchmarkRandom random{config.seed};
+            addStaticMeshes(sceneRoot, config, random);
+        }
+        {
+            BenchmarkRandom random{config.seed + 1};
+            addOmniLights(sceneRoot, config, random);
+        }
+        {
+            BenchmarkRandom random{config.seed + 2};
+            addParticleSystems(sceneRoot, config, random);
+        }
+        {
+            BenchmarkRandom random{config.seed + 3};
+            addPhysicsBodies(sceneRoot, config, random);
+        }
+
+        auto& cameraObject = sceneRoot.attachChild(factory.createSceneObject<CameraComponent>());
+        cameraObject.setName("Camera.Benchmark");
+        cameraObject.getRootComponent<CameraComponent>().setClipFarPlane(CameraFarPlane);
+
+        sceneRoot.addComponent<BenchmarkDriver>().setup(config, cameraObject);
+
+        return scene;
+    }
+
+    async::Task<> activateCharacterScenes(const BenchmarkConfig& config)
+    {
+        using namespace nau::scene;
+
+        if (config.skinnedCharacters == 0)
+        {
+            co_return;
+        }
+
+        AssetRef<> characterAssetRef{config.characterSceneAsset};
+        SceneAsset::Ptr characterAsset = co_await characterAssetRef.getAssetViewTyped<SceneAsset>();
+        if (!characterAsset)
+        {
+            NAU_LOG_ERROR("Fail to load the character scene ({})", config.characterSceneAsset);
+            co_return;
+        }
+
+        auto& sceneFactory = getServiceProvider().get<ISceneFactory>();
+        auto& sceneManager = getServiceProvider().get<ISceneManager>();
+
+        BenchmarkRandom random{config.seed + 4};
+        const float extent = getBenchmarkAreaExtent(config);
+
+        async::TaskCollection sceneLoaders;
+
+        for (uint32_t i = 0; i < config.skinnedCharacters; ++i)
+        {
+            IScene::Ptr characterScene = sceneFactory.createSceneFromAsset(*characterAsset);
+            characterScene->setName(::fmt::format("character_{}", i).c_str());
+
+            SceneObject& root = characterScene->getRoot();
+            root.setTranslation({random.range(-extent, extent), 0.f, random.range(-extent, extent)});
+            root.setRotation(math::quat::rotationY(random.range(0.f, std::numbers::pi_v<float> * 2.f)));
+            root.addComponent<animation::AnimationManager>();
+
+            sceneLoaders.push(sceneManager.activateScene(std::move(characterScene)));
+        }
+
+        co_await sceneLoaders.awaitCompletion();
+    }
+}  // namespace nau::sample
@@ -0,0 +1,27 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#pragma once
+
+#include "./benchmark_config.h"
+#include "nau/async/task.h"
+#include "nau/scene/scene.h"
+
+namespace nau::sample
+{
+    /**
+        The half size of the square area the benchmark objects are placed in.
+     */
+    float getBenchmarkAreaExtent(const BenchmarkConfig& config);
+
+    /**
+        Builds the scene with the static meshes, the omni lights, the particle systems and the physics bodies.
+        The scene root gets the BenchmarkDriver with the camera.
+     */
+    scene::IScene::Ptr makeBenchmarkScene(const BenchmarkConfig& config);
+
+    /**
+        Loads the character scene asset once and activates its copy for each skinned character.
+     */
+    async::Task<> activateCharacterScenes(const BenchmarkConfig& config);
+}  // namespace nau::sample
@@ -0,0 +1,54 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "./benchmark_config.h"
+#include "./benchmark_driver.h"
+#include "./benchmark_scene.h"
+#include "nau/app/run_application.h"
+#include "nau/render/render_frame_stats.h"
+#include "nau/samples/sample_app_delegate.h"
+
+namespace nau::sample
+{
+    /**
+        The rendering benchmark: builds the procedural scene of the configured scale (see BenchmarkConfig),
+        flies the camera along the deterministic path and captures the per frame engine statistics (see BenchmarkRecorder).
+     */
+    class RenderBenchmarkDelegate final : public SampleAppDelegate
+    {
+    public:
+        RenderBenchmarkDelegate() :
+            SampleAppDelegate("renderBenchmark")
+        {
+        }
+
+    private:
+        Result<> initializeServices() override
+        {
+            getServiceProvider().addClass<sample::BenchmarkDriver>();
+            return ResultSuccess;
+        }
+
+        async::Task<> startupApplication() override
+        {
+            const BenchmarkConfig config = getServiceProvider().get<GlobalProperties>().getValue<BenchmarkConfig>("/benchmark").value_or(BenchmarkConfig{});
+
+            NAU_LOG("Benchmark scene: {} static meshes, {} characters, {} lights, {} particle systems, {} physics bodies",
+                    config.staticMeshes, config.skinnedCharacters, config.omniLights, config.particleSystems, config.physicsBodies);
+
+            render::setRenderNodeTimingsEnabled(config.renderNodeTimings);
+
+            // The characters are activated first: the capture (driven by the main scene) starts when everything is in place.
+            co_await activateCharacterScenes(config);
+            co_await getServiceProvider().get<scene::ISceneManager>().activateScene(makeBenchmarkScene(config));
+        }
+    };
+}  // namespace nau::sample
+
+int main([[maybe_unused]] int argc, [[maybe_unused]] char** argv)
+{
+    using namespace nau;
+
+    return runApplication(eastl::make_unique<sample::RenderBenchmarkDelegate>());
+}
@@ -0,0 +1,19 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <EASTL/string.h>
+#include <EASTL/vector.h>
+
+#include <chrono>
+#include <filesystem>
+
+#include "nau/app/application.h"
+#include "nau/app/global_properties.h"
+#include "nau/diag/logging.h"
+#include "nau/rtti/rtti_impl.h"
+#include "nau/scene/scene.h"
+#include "nau/scene/scene_factory.h"
+#include "nau/scene/scene_manager.h"
+#include "nau/service/service_provider.h"
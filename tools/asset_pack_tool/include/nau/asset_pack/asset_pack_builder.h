@@ -40,6 +40,20 @@ namespace nau
         eastl::string contentType = "application/json"; ///< The content type of the asset package.
         eastl::string version = "0.1"; ///< The version of the asset package.
         eastl::string description; ///< A human-readable description of the asset package.
+
+        io::AssetPackCompression compression = io::AssetPackCompression::None; ///< Compression of the package entries (the entries that are not compressible are stored as is).
+        int compressionLevel = 18; ///< zstd compression level.
+        uint32_t compressionBlockSize = 256 * 1024; ///< Size of the independently decompressible blocks of the compressed entries.
+        bool trainDictionaries = true; ///< Train the compression dictionary per file type (extension) for the small entries.
+        uint32_t compressionThreadsCount = 0; ///< Count of the threads compressing the entries in parallel (0 - the hardware concurrency).
+        bool deduplicateContent = true; ///< The entries of the identical content share the single blob in the package.
+
+        /**
+         * The package paths of the entries in the order they are loaded (the recorded load trace).
+         * The blobs of these entries are written first and in this order, so the loading reads the package sequentially;
+         * the rest of the blobs follows in the order of the input files. The order of the index entries is not affected.
+         */
+        eastl::vector<eastl::string> loadOrder;
     };
 
     /**
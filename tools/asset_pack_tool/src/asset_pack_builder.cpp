@@ -2,6 +2,10 @@
 // Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
 #include "nau/asset_pack/asset_pack_builder.h"
 
+#include <EASTL/map.h>
+#include <EASTL/unordered_map.h>
+
+#include "nau/dag_ioSys/dag_zstdIo.h"
 #include "nau/io/asset_pack.h"
 #include "nau/io/file_system.h"
 #include "nau/io/nau_container.h"
@@ -10,9 +14,215 @@
 #include "nau/memory/bytes_buffer.h"
 #include "nau/serialization/runtime_value_builder.h"
 #include "nau/string/string_conv.h"
+#include "nau/utils/dag_hash.h"
 
 namespace nau
 {
+    namespace
+    {
+        // Only the small entries are compressed with the dictionary: the large ones are compressed well on their own.
+        constexpr size_t DictionaryEntrySizeLimit = 128 * 1024;
+        constexpr size_t DictionaryMinSamplesCount = 16;
+        constexpr size_t DictionaryMaxSize = 112 * 1024;
+
+        eastl::vector<std::byte> readStreamContent(io::IStreamReader& stream)
+        {
+            constexpr size_t ChunkSize = 64 * 1024;
+
+            eastl::vector<std::byte> content;
+            for (;;)
+            {
+                const size_t contentSize = content.size();
+                content.resize(contentSize + ChunkSize);
+
+                const Result<size_t> readResult = stream.read(content.data() + contentSize, ChunkSize);
+                const size_t readCount = readResult ? *readResult : 0;
+                content.resize(contentSize + readCount);
+
+                if (readCount == 0)
+                {
+                    return content;
+                }
+            }
+        }
+
+        /**
+            Asset type of the file for which the separate dictionary is trained: the file extension.
+         */
+        eastl::string getEntryKind(eastl::string_view filePath)
+        {
+            const size_t namePos = filePath.find_last_of("/\\");
+            const eastl::string_view fileName = namePos == eastl::string_view::npos ? filePath : filePath.substr(namePos + 1);
+            const size_t extPos = fileName.rfind('.');
+
+            return extPos == eastl::string_view::npos ? eastl::string{} : eastl::string{fileName.substr(extPos + 1)};
+        }
+
+        /**
+            Compresses the data into the independent blocks (see io::AssetPackCompression for the layout).
+         */
+        Result<eastl::vector<std::byte>> compressEntryBlocks(eastl::span<const std::byte> data, uint32_t blockSize, int compressionLevel, ZSTD_CCtx_s* context, const ZSTD_CDict_s* dictionary)
+        {
+            const size_t blocksCount = (data.size() + blockSize - 1) / blockSize;
+
+            eastl::vector<uint64_t> blockEnds(blocksCount);
+            eastl::vector<std::byte> compressedData(blocksCount * sizeof(uint64_t));
+
+            for (size_t i = 0; i < blocksCount; ++i)
+            {
+                const eastl::span<const std::byte> block = data.subspan(i * blockSize, std::min(data.size() - i * blockSize, static_cast<size_t>(blockSize)));
+                const size_t maxCompressedSize = iosys::zstd_compress_bound(block.size());
+                const size_t blockOffset = compressedData.size();
+
+                compressedData.resize(blockOffset + maxCompressedSize);
+                std::byte* const output = compressedData.data() + blockOffset;
+
+                const size_t compressedSize = dictionary ? iosys::zstd_compress_with_dict(context, output, maxCompressedSize, block.data(), block.size(), dictionary)
+                                                         : iosys::zstd_compress(output, maxCompressedSize, block.data(), block.size(), compressionLevel);
+                if (compressedSize == 0 || compressedSize > maxCompressedSize)
+                {
+                    return NauMakeError("Fail to compress the block");
+                }
+
+                compressedData.resize(blockOffset + compressedSize);
+                blockEnds[i] = compressedData.size();
+            }
+
+            memcpy(compressedData.data(), blockEnds.data(), blocksCount * sizeof(uint64_t));
+            return compressedData;
+        }
+
+        struct PackDictionary
+        {
+            eastl::vector<char> data;
+            ZSTD_CDict_s* compressionDictionary = nullptr;
+        };
+
+        /**
+            The unique content of the package: the entries of the identical content refer to the single blob.
+         */
+        struct PackBlob
+        {
+            eastl::vector<std::byte> content;
+            eastl::string kind;
+
+            eastl::vector<std::byte> compressedContent;
+            uint32_t dictionaryIndex = 0;
+            io::BlobData blobData;
+            bool isWritten = false;
+        };
+
+        /**
+            Trains the dictionary per entry kind from the small blobs.
+         */
+        eastl::map<eastl::string, PackDictionary> trainDictionaries(const eastl::vector<PackBlob>& blobs, const PackBuildOptions& buildOptions)
+        {
+            struct Samples
+            {
+                eastl::vector<char> data;
+                eastl::vector<size_t> sizes;
+            };
+
+            eastl::map<eastl::string, Samples> samplesByKind;
+            for (const PackBlob& blob : blobs)
+            {
+                if (blob.content.empty() || blob.content.size() > DictionaryEntrySizeLimit)
+                {
+                    continue;
+                }
+
+                Samples& samples = samplesByKind[blob.kind];
+                samples.data.insert(samples.data.end(), reinterpret_cast<const char*>(blob.content.begin()), reinterpret_cast<const char*>(blob.content.end()));
+                samples.sizes.push_back(blob.content.size());
+            }
+
+            eastl::map<eastl::string, PackDictionary> dictionaries;
+            for (auto& [kind, samples] : samplesByKind)
+            {
+                if (samples.sizes.size() < DictionaryMinSamplesCount)
+                {
+                    continue;
+                }
+
+                eastl::vector<char> dictionaryData(DictionaryMaxSize);
+                const size_t dictionarySize = iosys::zstd_train_dict_buffer(dictionaryData, buildOptions.compressionLevel, samples.data, samples.sizes);
+                if (dictionarySize == 0)
+                {
+                    continue;
+                }
+
+                dictionaryData.resize(dictionarySize);
+
+                PackDictionary& dictionary = dictionaries[kind];
+                dictionary.compressionDictionary = iosys::zstd_create_cdict(dictionaryData, buildOptions.compressionLevel);
+                dictionary.data = std::move(dictionaryData);
+            }
+
+            return dictionaries;
+        }
+
+        /**
+            Compresses the blobs in parallel: every thread takes the next blob and compresses it with its own zstd context
+            (the dictionaries are shared, they are read only).
+            The blobs that are not compressible are left with the empty compressed content and are stored as is.
+         */
+        void compressBlobs(eastl::vector<PackBlob>& blobs, const eastl::map<eastl::string, PackDictionary>& dictionaries,
+                           const eastl::map<eastl::string, uint32_t>& dictionaryIndices, const PackBuildOptions& buildOptions)
+        {
+            std::atomic<size_t> nextBlob = 0;
+
+            const auto compressNextBlobs = [&]
+            {
+                ZSTD_CCtx_s* const compressionContext = iosys::zstd_create_cctx();
+
+                for (size_t i = nextBlob++; i < blobs.size(); i = nextBlob++)
+                {
+                    PackBlob& blob = blobs[i];
+                    if (blob.content.empty())
+                    {
+                        continue;
+                    }
+
+                    uint32_t dictionaryIndex = 0;
+                    const ZSTD_CDict_s* compressionDictionary = nullptr;
+                    if (blob.content.size() <= DictionaryEntrySizeLimit)
+                    {
+                        if (auto iter = dictionaryIndices.find(blob.kind); iter != dictionaryIndices.end())
+                        {
+                            dictionaryIndex = iter->second;
+                            compressionDictionary = dictionaries.find(blob.kind)->second.compressionDictionary;
+                        }
+                    }
+
+                    Result<eastl::vector<std::byte>> compressedContent = compressEntryBlocks(blob.content, buildOptions.compressionBlockSize, buildOptions.compressionLevel, compressionContext, compressionDictionary);
+                    if (compressedContent && compressedContent->size() < blob.content.size())
+                    {
+                        blob.compressedContent = std::move(*compressedContent);
+                        blob.dictionaryIndex = dictionaryIndex;
+                    }
+                }
+
+                iosys::zstd_destroy_cctx(compressionContext);
+            };
+
+            const size_t hardwareThreadsCount = std::max(std::thread::hardware_concurrency(), 1u);
+            const size_t threadsCount = std::min<size_t>(buildOptions.compressionThreadsCount > 0 ? buildOptions.compressionThreadsCount : hardwareThreadsCount, blobs.size());
+
+            eastl::vector<std::thread> threads;
+            for (size_t i = 1; i < threadsCount; ++i)
+            {
+                threads.emplace_back(compressNextBlobs);
+            }
+
+            compressNextBlobs();
+
+            for (std::thread& thread : threads)
+            {
+                thread.join();
+            }
+        }
+    }  // namespace
+
     Result<io::AssetPackIndexData> writeAssetPackIndexDataToStream(const eastl::vector<PackInputFileData>& content, PackBuildOptions buildOptions, const std::string& tempFilePath)
     {
         using namespace io;
@@ -22,6 +232,13 @@ namespace nau
 
         IStreamWriter::Ptr tempStream = createNativeFileStream(tempFilePath.data(), AccessMode::Write, OpenFileMode::CreateAlways);
 
+        const bool compress = buildOptions.compression == AssetPackCompression::Zstd && buildOptions.compressionBlockSize > 0;
+
+        // Read the content of the entries and collapse the identical content into the single blob.
+        eastl::vector<PackBlob> blobs;
+        eastl::vector<size_t> entryBlobs;
+        eastl::unordered_map<uint64_t, eastl::vector<size_t>> blobsByHash;
+
         for (const PackInputFileData& content : content)
         {
             IStreamReader::Ptr srcStream = content.stream();
@@ -32,13 +249,113 @@ namespace nau
             }
 
             AssetPackFileEntry& packEntry = packData.content.emplace_back();
-            packEntry.blobData.offset = tempStream->getPosition();
-            copyStream(*tempStream, *srcStream).ignore();
-
             packEntry.filePath = content.filePathInPack;
-            packEntry.contentCompression = packEntry.clientSize;
-            packEntry.clientSize = srcStream->getPosition();
-            packEntry.blobData.size = srcStream->getPosition();
+
+            eastl::vector<std::byte> entryContent = readStreamContent(*srcStream);
+            packEntry.clientSize = entryContent.size();
+
+            const uint64_t hash = mem_hash_fnv1<64>(reinterpret_cast<const char*>(entryContent.data()), entryContent.size());
+            eastl::vector<size_t>& sameHashBlobs = blobsByHash[hash];
+
+            if (buildOptions.deduplicateContent)
+            {
+                const auto sameBlob = eastl::find_if(sameHashBlobs.begin(), sameHashBlobs.end(), [&](size_t blobIndex)
+                {
+                    const eastl::vector<std::byte>& blobContent = blobs[blobIndex].content;
+                    return blobContent.size() == entryContent.size() && memcmp(blobContent.data(), entryContent.data(), entryContent.size()) == 0;
+                });
+
+                if (sameBlob != sameHashBlobs.end())
+                {
+                    entryBlobs.push_back(*sameBlob);
+                    continue;
+                }
+            }
+
+            sameHashBlobs.push_back(blobs.size());
+            entryBlobs.push_back(blobs.size());
+
+            PackBlob& blob = blobs.emplace_back();
+            blob.content = std::move(entryContent);
+            blob.kind = getEntryKind(content.filePathInPack);
+        }
+
+        // Dictionaries are written before the entries.
+        eastl::map<eastl::string, PackDictionary> dictionaries;
+        eastl::map<eastl::string, uint32_t> dictionaryIndices;
+        if (compress && buildOptions.trainDictionaries)
+        {
+            dictionaries = trainDictionaries(blobs, buildOptions);
+            for (const auto& [kind, dictionary] : dictionaries)
+            {
+                BlobData& dictionaryBlob = packData.dictionaries.emplace_back();
+                dictionaryBlob.offset = tempStream->getPosition();
+                dictionaryBlob.size = dictionary.data.size();
+                tempStream->write(reinterpret_cast<const std::byte*>(dictionary.data.data()), dictionary.data.size()).ignore();
+
+                dictionaryIndices[kind] = static_cast<uint32_t>(packData.dictionaries.size());
+            }
+        }
+
+        if (compress)
+        {
+            compressBlobs(blobs, dictionaries, dictionaryIndices, buildOptions);
+        }
+
+        for (auto& [kind, dictionary] : dictionaries)
+        {
+            iosys::zstd_destroy_cdict(dictionary.compressionDictionary);
+        }
+
+        const auto writeBlob = [&tempStream](PackBlob& blob)
+        {
+            if (blob.isWritten)
+            {
+                return;
+            }
+
+            const eastl::vector<std::byte>& data = blob.compressedContent.empty() ? blob.content : blob.compressedContent;
+            blob.blobData.offset = tempStream->getPosition();
+            blob.blobData.size = data.size();
+            tempStream->write(data.data(), data.size()).ignore();
+            blob.isWritten = true;
+        };
+
+        // The blobs of the load trace go first, in the order of loading.
+        if (!buildOptions.loadOrder.empty())
+        {
+            eastl::unordered_map<eastl::string_view, size_t> entryIndices;
+            for (size_t i = 0; i < packData.content.size(); ++i)
+            {
+                entryIndices.emplace(eastl::string_view{packData.content[i].filePath}, i);
+            }
+
+            for (const eastl::string& filePath : buildOptions.loadOrder)
+            {
+                if (auto iter = entryIndices.find(eastl::string_view{filePath}); iter != entryIndices.end())
+                {
+                    writeBlob(blobs[entryBlobs[iter->second]]);
+                }
+            }
+        }
+
+        for (PackBlob& blob : blobs)
+        {
+            writeBlob(blob);
+        }
+
+        for (size_t i = 0; i < packData.content.size(); ++i)
+        {
+            const PackBlob& blob = blobs[entryBlobs[i]];
+
+            AssetPackFileEntry& packEntry = packData.content[i];
+            packEntry.blobData = blob.blobData;
+            if (!blob.compressedContent.empty())
+            {
+                packEntry.contentCompression = AssetPackZstdCompressionName;
+                packEntry.blockSize = buildOptions.compressionBlockSize;
+                packEntry.dictionaryIndex = blob.dictionaryIndex;
+            }
         }
 
         tempStream->flush();
@@ -52,7 +369,29 @@ namespace nau
         const std::string tempFilePath(u8tempFilePath.cbegin(), u8tempFilePath.cend());
 
         AssetPackIndexData packIndexData = *writeAssetPackIndexDataToStream(content, buildOptions, tempFilePath);
+
+        // The binary index is written right after the header (before the blobs), so the blob offsets are shifted by the index size.
+        // The size of the index does not depend on the offsets.
+        const size_t binaryIndexSize = AssetPackBinaryIndex::build(packIndexData.content, packIndexData.dictionaries).size();
+        for (AssetPackFileEntry& entry : packIndexData.content)
+        {
+            entry.blobData.offset += binaryIndexSize;
+        }
+
+        for (BlobData& dictionary : packIndexData.dictionaries)
+        {
+            dictionary.offset += binaryIndexSize;
+        }
+
+        const eastl::vector<std::byte> binaryIndex = AssetPackBinaryIndex::build(packIndexData.content, packIndexData.dictionaries);
+        NAU_ASSERT(binaryIndex.size() == binaryIndexSize);
+
+        packIndexData.binaryIndexSize = binaryIndex.size();
+        packIndexData.content.clear();
+        packIndexData.dictionaries.clear();
+
         writeContainerHeader(outputStream, "nau-vfs-pack", nau::makeValueRef(packIndexData));
+        outputStream->write(binaryIndex.data(), binaryIndex.size()).ignore();
 
         IStreamReader::Ptr temp = createNativeFileStream(tempFilePath.data(), AccessMode::Read, OpenFileMode::OpenExisting);
         copyStream(*outputStream, *temp).ignore();
@@ -70,11 +409,53 @@ namespace nau
         auto value = nau::makeValueRef(packIndexData);
         auto res = RuntimeValue::assign(value, packData);
 
+        if (packIndexData.binaryIndexSize > 0)
+        {
+            eastl::vector<std::byte> indexData(packIndexData.binaryIndexSize);
+            packageStream->setPosition(io::OffsetOrigin::Begin, static_cast<int64_t>(headerDataOffset));
+
+            Result<size_t> readResult = packageStream->read(indexData.data(), indexData.size());
+            NauCheckResult(readResult);
+            if (*readResult != indexData.size())
+            {
+                return NauMakeError("Unexpected end of the asset pack index");
+            }
+
+            Result<io::AssetPackBinaryIndex> index = io::AssetPackBinaryIndex::open(indexData);
+            NauCheckResult(index);
+
+            for (const io::AssetPackBinaryIndexEntry& entry : index->getEntries())
+            {
+                io::AssetPackFileEntry& content = packIndexData.content.emplace_back();
+                const eastl::string_view filePath = index->getPath(entry);
+                content.filePath.assign(filePath.data(), filePath.size());
+                content.clientSize = entry.clientSize;
+                content.blobData.offset = entry.offset;
+                content.blobData.size = entry.size;
+                if (static_cast<io::AssetPackCompression>(entry.compression) == io::AssetPackCompression::Zstd)
+                {
+                    content.contentCompression = io::AssetPackZstdCompressionName;
+                    content.blockSize = entry.blockSize;
+                    content.dictionaryIndex = entry.dictionaryIndex;
+                }
+            }
+
+            for (const io::AssetPackBinaryIndexDictionary& dictionary : index->getDictionaries())
+            {
+                packIndexData.dictionaries.push_back({static_cast<size_t>(dictionary.size), static_cast<size_t>(dictionary.offset)});
+            }
+        }
+
         for (io::AssetPackFileEntry& content : packIndexData.content)
         {
             content.blobData.offset += headerDataOffset;
         }
 
+        for (io::BlobData& dictionary : packIndexData.dictionaries)
+        {
+            dictionary.offset += headerDataOffset;
+        }
+
         return {packIndexData};
     }
 }  // namespace nau
\ No newline at end of file
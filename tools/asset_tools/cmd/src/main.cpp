@@ -36,6 +36,10 @@ namespace nau
         import.add_argument("--files_mask")
             .nargs(argparse::nargs_pattern::any)
             .help("Optional value to scan only specific files");
+        import.add_argument("-j", "--jobs")
+            .default_value(0)
+            .scan<'i', int>()
+            .help("Number of the asset cook threads (0 - hardware concurrency).");
 
         programArgs.add_subparser(import);
 
@@ -68,6 +72,7 @@ namespace nau
                 args->projectPath = import.get<std::string>("--project");
                 args->assetPath = import.get<std::string>("--file");
                 args->filesExtensions = import.get<std::vector<std::string>>("--files_mask");
+                args->jobsCount = static_cast<size_t>(std::max(import.get<int>("--jobs"), 0));
 
                 LOG_INFO("Importing project assets at path {}...", args->projectPath);
 
@@ -7,8 +7,10 @@
 #include <gtest/gtest.h>
 
 #include <filesystem>
+#include <fstream>
 #include <string>
 
+#include "nau/asset_tools/asset_cook_graph.h"
 #include "nau/shared/args.h"
 #include "nau/shared/file_system.h"
 #include "nau/shared/logger.h"
@@ -90,4 +92,42 @@ namespace nau::test
 
         std::filesystem::remove_all(p);
     }
-}  // namespace nau::test
\ No newline at end of file
+
+    TEST(AssetTool, CookInputHash)
+    {
+        const std::filesystem::path p = std::filesystem::current_path() / "_temp_cook";
+        std::filesystem::create_directories(p);
+
+        const auto writeFile = [](const std::filesystem::path& path, std::string_view content)
+        {
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            file << content;
+        };
+
+        const std::filesystem::path sourcePath = p / "texture.png";
+        const std::filesystem::path metafilePath = p / "texture.png.nausd";
+        writeFile(sourcePath, "source");
+        writeFile(metafilePath, "settings");
+
+        nau::UsdMetaInfo meta;
+        meta.isValid = true;
+        meta.type = "texture";
+        meta.assetPath = sourcePath.string();
+
+        const uint64_t hash = computeAssetInputHash(meta, metafilePath);
+        EXPECT_EQ(hash, computeAssetInputHash(meta, metafilePath));
+
+        // Touching the file without changing the content does not make the asset dirty
+        writeFile(sourcePath, "source");
+        EXPECT_EQ(hash, computeAssetInputHash(meta, metafilePath));
+
+        writeFile(sourcePath, "changed source");
+        const uint64_t sourceChangedHash = computeAssetInputHash(meta, metafilePath);
+        EXPECT_NE(hash, sourceChangedHash);
+
+        writeFile(metafilePath, "changed settings");
+        EXPECT_NE(sourceChangedHash, computeAssetInputHash(meta, metafilePath));
+
+        std::filesystem::remove_all(p);
+    }
+}  // namespace nau::test
@@ -0,0 +1,103 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <chrono>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "nau/asset_tools/asset_info.h"
+#include "nau/usd_meta_tools/usd_meta_info.h"
+#include "pxr/usd/usd/common.h"
+
+namespace nau
+{
+    class AssetDatabaseManager;
+
+    enum class AssetCookStatus
+    {
+        UpToDate,
+        Cooked,
+        Failed
+    };
+
+    /**
+     * The record of the single asset step of the cook (see AssetCookGraph::writeReport).
+     */
+    struct AssetCookStep
+    {
+        Uid uid;
+        std::string sourcePath;
+        AssetCookStatus status = AssetCookStatus::UpToDate;
+        std::string reason;
+        std::chrono::microseconds duration{0};
+    };
+
+    /**
+     * The incremental cook of the asset meta files (.nausd).
+     *
+     * Every meta file is the graph node: its assets are cooked together (they share the USD stage, that can not be used by several threads).
+     * The node inputs are hashed (the source files, the meta file with the import settings and the tool version, see computeAssetInputHash)
+     * and compared with the hashes recorded into the asset database by the previous cook.
+     * The edges are the asset dependencies recorded by the previous cook (a layer -> meshes -> materials -> textures):
+     * the node is dirty if its inputs are changed or any of its dependencies is dirty.
+     *
+     * Only the dirty nodes are cooked: the nodes are cooked in parallel, a node is started when all its dirty dependencies are cooked.
+     */
+    class ASSET_TOOL_API AssetCookGraph
+    {
+    public:
+        /**
+         * Cooks the single asset: the asset is compiled into the database and its record is returned.
+         * Called concurrently for the assets of the different nodes.
+         */
+        using CookFunction = std::function<nau::Result<AssetMetaInfo>(PXR_NS::UsdStageRefPtr stage, nau::UsdMetaInfo& meta, uint64_t inputHash)>;
+
+        void addNode(std::string metafilePath, PXR_NS::UsdStageRefPtr stage, nau::UsdMetaInfoArray meta);
+
+        /**
+         * Evaluates the dirty nodes against the database records.
+         */
+        void build(AssetDatabaseManager& db);
+
+        /**
+         * Cooks the dirty nodes.
+         * @param jobsCount the number of the cook threads (0 - hardware concurrency).
+         * @return the records of all the (cooked and up to date) assets.
+         */
+        std::vector<AssetMetaInfo> run(const CookFunction& cook, AssetDatabaseManager& db, size_t jobsCount = 0);
+
+        /**
+         * Writes the machine readable (json) report of the last run: what was cooked, why and how long it took.
+         */
+        bool writeReport(const std::filesystem::path& reportPath) const;
+
+        const std::vector<AssetCookStep>& getSteps() const;
+
+    private:
+        struct Node
+        {
+            std::string metafilePath;
+            PXR_NS::UsdStageRefPtr stage;
+            nau::UsdMetaInfoArray meta;
+            std::vector<uint64_t> inputHashes; /** < The hashes of the node assets (in the assets traversal order). */
+            std::vector<size_t> dependencies;
+            bool isDirty = false;
+            std::string dirtyReason;
+        };
+
+        std::vector<Node> m_nodes;
+        std::vector<AssetCookStep> m_steps;
+        std::chrono::microseconds m_totalDuration{0};
+        size_t m_jobsCount = 0;
+    };
+
+    /**
+     * The hash of the asset cook inputs: the source file, the meta file (holds the import settings) and the tool version.
+     */
+    ASSET_TOOL_API uint64_t computeAssetInputHash(const nau::UsdMetaInfo& meta, const std::filesystem::path& metafilePath);
+}  // namespace nau
@@ -24,11 +24,13 @@ namespace nau
     {
         uint64_t lastModified;
         bool dirty;
+        uint64_t inputHash = 0; /** < The hash of the inputs the asset was cooked from (see computeAssetInputHash). */
 
         NAU_CLASS_BASE(AssetMetaInfoBase)
         NAU_CLASS_FIELDS(
             CLASS_FIELD(lastModified),
-            CLASS_FIELD(dirty))
+            CLASS_FIELD(dirty),
+            CLASS_FIELD(inputHash))
     };
 
     inline static AssetMetaInfo makeAssetMetaInfo(const std::string& path, const nau::Uid& uid, const std::string& dbPath, const std::string& type, const std::string& kind, bool sourceAsMeta = false)
@@ -14,6 +14,7 @@
 namespace nau
 {
     class FileSystem;
+    class AssetCookGraph;
     class AssetDatabaseManager;
     struct UsdMetaInfo;
 
@@ -24,12 +25,12 @@ namespace nau
 
     private:
         nau::Result<AssetMetaInfo> compileAsset(PXR_NS::UsdStageRefPtr stage, const nau::UsdMetaInfo& metaInfo, const std::string& dbPath, const std::string& projectRootPath, int folderIndex);
-        nau::Result<std::vector<AssetMetaInfo>> updateAssetInDatabase(PXR_NS::UsdStageRefPtr stage, std::vector<nau::UsdMetaInfo>& metaArray, const std::filesystem::path& dbPath, const std::string& projectRootPath, AssetDatabaseManager& db, FileSystem& fs);
+        void cookAssets(AssetCookGraph& graph, const struct ImportAssetsArguments* args, const std::filesystem::path& dbPath, AssetDatabaseManager& db, std::vector<AssetMetaInfo>& assetsList);
         
         int importAssets(const struct ImportAssetsArguments* args, FileSystem& fs, AssetDatabaseManager& db);
         int importSingleAsset(const struct FileInfo& file, const std::filesystem::path& dbPath, AssetDatabaseManager& db, FileSystem& fs);
         int compileAssets(const ImportAssetsArguments* args, FileSystem& fs, AssetDatabaseManager& db, std::vector<AssetMetaInfo>& assetsList);
-        int compileSingleAsset(const FileInfo& file, const std::filesystem::path& dbPath, const std::string& projectRootPath, AssetDatabaseManager& db, FileSystem& fs, std::vector<AssetMetaInfo>& assetsList);
-        nau::Result<AssetMetaInfo> updateAsset(PXR_NS::UsdStageRefPtr stage, nau::UsdMetaInfo& meta, const std::filesystem::path& dbPath, const std::string& projectRootPath, AssetDatabaseManager& db, FileSystem& fs);
+        int compileSingleAsset(const ImportAssetsArguments* args, const FileInfo& file, const std::filesystem::path& dbPath, AssetDatabaseManager& db, FileSystem& fs, std::vector<AssetMetaInfo>& assetsList);
+        nau::Result<AssetMetaInfo> updateAsset(PXR_NS::UsdStageRefPtr stage, nau::UsdMetaInfo& meta, uint64_t inputHash, const std::filesystem::path& dbPath, const std::string& projectRootPath, AssetDatabaseManager& db, FileSystem& fs);
     };
 };  // namespace nau
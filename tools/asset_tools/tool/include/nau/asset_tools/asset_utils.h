@@ -17,6 +17,9 @@ namespace nau
         int getAssetSubDir(const std::filesystem::path& path, FileSystem& fs);
         void* getUsdPlugin(const std::string& pluginName);
 
+        // Records the assets referenced ("uid:<asset uid>") by the compiled asset content into metaInfo.dependencies.
+        void collectAssetDependencies(const std::filesystem::path& dbPath, AssetMetaInfo& metaInfo);
+
         namespace compilers
         {
             std::filesystem::path ensureOutputPath(const std::string& outputPath, const AssetMetaInfo& metaInfo, std::string ext);
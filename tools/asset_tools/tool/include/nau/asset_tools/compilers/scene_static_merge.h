@@ -0,0 +1,45 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <string>
+
+#include "nau/asset_tools/asset_info.h"
+#include "nau/scene/scene.h"
+#include "nau/utils/result.h"
+
+namespace nau
+{
+    namespace compilers
+    {
+        /**
+         * The settings of the static props merging, read from the "/assets/scene/staticMerge" global properties.
+         */
+        struct SceneStaticMergeSettings
+        {
+            bool enabled = false;
+
+            // The edge of the spatial cell (in meters): the props are merged within the cell their bounds center is in.
+            float cellSize = 32.f;
+
+            // The merged mesh is split once it has more vertices.
+            uint32_t maxVertices = 1u << 20;
+
+            static SceneStaticMergeSettings fromGlobalProperties();
+        };
+
+        /**
+         * Merges the static props of the cooked scene that share the material (and the shadow casting) within the spatial cell
+         * into the combined native meshes, so the runtime draws the cell with a single draw call per material.
+         *
+         * Only the leaf objects with the single visible, non-occluder StaticMeshComponent (the native mesh one) are merged:
+         * the objects with the children, the other components or the occluder meshes keep their identity.
+         * The merged meshes are written next to the scene and registered in the asset database with the stable uids.
+         *
+         * @return The number of the objects replaced by the merged meshes.
+         */
+        nau::Result<size_t> mergeStaticMeshes(scene::IScene& scene, const std::string& outputPath, int folderIndex, const AssetMetaInfo& sceneMeta, const SceneStaticMergeSettings& settings);
+    }  // namespace compilers
+}  // namespace nau
@@ -20,7 +20,7 @@ namespace nau
         public:
             std::string_view ext() const override
             {
-                return ".gltf";
+                return ".nmesh";
             }
             bool canCompile(const std::string& path) const override
             {
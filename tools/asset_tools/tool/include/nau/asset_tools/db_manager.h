@@ -5,6 +5,7 @@
 #pragma once
 
 #include <map>
+#include <mutex>
 
 #include "nau/asset_tools/asset_info.h"
 #include "nau/shared/file_system.h"
@@ -22,6 +23,9 @@ namespace nau
             CLASS_FIELD(content))
     };
 
+    /**
+     * The records are accessed concurrently by the asset cook threads (see AssetCookGraph): the record accessors are synchronized.
+     */
     class ASSET_TOOL_API AssetDatabaseManager
     {
     public:
@@ -61,5 +65,6 @@ namespace nau
         std::string m_cachePath;
         std::filesystem::path m_dbFile;
         bool m_isLoaded = false;
+        std::recursive_mutex m_mutex;
     };
 };  // namespace nau
\ No newline at end of file
@@ -0,0 +1,351 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "nau/asset_tools/asset_cook_graph.h"
+
+#include <atomic>
+#include <format>
+#include <fstream>
+#include <thread>
+#include <unordered_map>
+
+#include "nau/asset_tools/db_manager.h"
+#include "nau/shared/logger.h"
+#include "nau/utils/dag_hash.h"
+#include "nlohmann/json.hpp"
+
+namespace nau
+{
+    namespace
+    {
+        bool isCookableAsset(const nau::UsdMetaInfo& meta)
+        {
+            return meta.isValid && meta.type != "group";
+        }
+
+        void iterateCookableAssets(nau::UsdMetaInfoArray& metaArray, const std::function<void(nau::UsdMetaInfo& meta)>& func)
+        {
+            for (nau::UsdMetaInfo& meta : metaArray)
+            {
+                if (!meta.isValid)
+                {
+                    continue;
+                }
+
+                if (isCookableAsset(meta))
+                {
+                    func(meta);
+                }
+
+                iterateCookableAssets(meta.children, func);
+            }
+        }
+
+        uint64_t hashFile(const std::filesystem::path& path, uint64_t hash)
+        {
+            std::ifstream file(path, std::ios::binary);
+            if (!file)
+            {
+                return hash;
+            }
+
+            char buffer[64 * 1024];
+            while (file)
+            {
+                file.read(buffer, sizeof(buffer));
+                hash = mem_hash_fnv1<64>(buffer, static_cast<size_t>(file.gcount()), hash);
+            }
+
+            return hash;
+        }
+
+        const char* statusToString(AssetCookStatus status)
+        {
+            switch (status)
+            {
+                case AssetCookStatus::Cooked:
+                    return "cooked";
+                case AssetCookStatus::Failed:
+                    return "failed";
+                default:
+                    return "upToDate";
+            }
+        }
+    }  // namespace
+
+    uint64_t computeAssetInputHash(const nau::UsdMetaInfo& meta, const std::filesystem::path& metafilePath)
+    {
+        uint64_t hash = str_hash_fnv1<64>(NAU_VERSION);
+        hash = str_hash_fnv1<64>(meta.type.c_str(), hash);
+        hash = hashFile(metafilePath, hash);
+        if (std::filesystem::path{meta.assetPath} != metafilePath)
+        {
+            hash = hashFile(meta.assetPath, hash);
+        }
+
+        return hash;
+    }
+
+    void AssetCookGraph::addNode(std::string metafilePath, PXR_NS::UsdStageRefPtr stage, nau::UsdMetaInfoArray meta)
+    {
+        Node& node = m_nodes.emplace_back();
+        node.metafilePath = std::move(metafilePath);
+        node.stage = std::move(stage);
+        node.meta = std::move(meta);
+    }
+
+    void AssetCookGraph::build(AssetDatabaseManager& db)
+    {
+        std::unordered_map<Uid, size_t> assetNodes;
+
+        for (size_t i = 0; i < m_nodes.size(); ++i)
+        {
+            Node& node = m_nodes[i];
+            node.inputHashes.clear();
+            node.dependencies.clear();
+            node.isDirty = false;
+            node.dirtyReason.clear();
+
+            iterateCookableAssets(node.meta, [&](nau::UsdMetaInfo& meta)
+            {
+                assetNodes[meta.uid] = i;
+                node.inputHashes.push_back(computeAssetInputHash(meta, node.metafilePath));
+            });
+        }
+
+        for (size_t i = 0; i < m_nodes.size(); ++i)
+        {
+            Node& node = m_nodes[i];
+            size_t assetIndex = 0;
+
+            iterateCookableAssets(node.meta, [&](nau::UsdMetaInfo& meta)
+            {
+                const uint64_t inputHash = node.inputHashes[assetIndex++];
+                const nau::Result<AssetMetaInfo> record = db.get(meta.uid);
+
+                if (!node.isDirty)
+                {
+                    if (record.isError())
+                    {
+                        node.isDirty = true;
+                        node.dirtyReason = "new asset";
+                    }
+                    else if (record->inputHash != inputHash)
+                    {
+                        node.isDirty = true;
+                        node.dirtyReason = "inputs changed";
+                    }
+                    else if (!db.compiled(meta.uid))
+                    {
+                        node.isDirty = true;
+                        node.dirtyReason = "compiled asset is missing";
+                    }
+                }
+
+                if (record.isError())
+                {
+                    return;
+                }
+
+                for (const Uid& dependencyUid : record->dependencies)
+                {
+                    const auto dependencyNode = assetNodes.find(dependencyUid);
+                    if (dependencyNode != assetNodes.end() && dependencyNode->second != i &&
+                        std::find(node.dependencies.begin(), node.dependencies.end(), dependencyNode->second) == node.dependencies.end())
+                    {
+                        node.dependencies.push_back(dependencyNode->second);
+                    }
+                }
+            });
+        }
+
+        // The dirty state is propagated to the dependent nodes
+        for (bool changed = true; changed;)
+        {
+            changed = false;
+            for (Node& node : m_nodes)
+            {
+                if (node.isDirty)
+                {
+                    continue;
+                }
+
+                for (const size_t dependency : node.dependencies)
+                {
+                    if (m_nodes[dependency].isDirty)
+                    {
+                        node.isDirty = true;
+                        node.dirtyReason = std::format("dependency {} changed", m_nodes[dependency].metafilePath);
+                        changed = true;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    std::vector<AssetMetaInfo> AssetCookGraph::run(const CookFunction& cook, AssetDatabaseManager& db, size_t jobsCount)
+    {
+        using namespace std::chrono;
+
+        const auto runStartTime = steady_clock::now();
+
+        m_jobsCount = jobsCount > 0 ? jobsCount : std::max(std::thread::hardware_concurrency(), 1u);
+        m_steps.clear();
+
+        // The waves of the dirty nodes: the node is cooked after all its dirty dependencies.
+        // The dependency cycles (should not be there) are broken by the nodes count limit.
+        std::vector<size_t> nodeWaves(m_nodes.size(), 0);
+        bool changed = true;
+        for (size_t iteration = 0; changed && iteration < m_nodes.size(); ++iteration)
+        {
+            changed = false;
+            for (size_t i = 0; i < m_nodes.size(); ++i)
+            {
+                for (const size_t dependency : m_nodes[i].dependencies)
+                {
+                    if (m_nodes[dependency].isDirty && nodeWaves[i] <= nodeWaves[dependency])
+                    {
+                        nodeWaves[i] = nodeWaves[dependency] + 1;
+                        changed = true;
+                    }
+                }
+            }
+        }
+
+        std::vector<std::vector<size_t>> waves;
+        std::vector<std::vector<AssetCookStep>> nodeSteps(m_nodes.size());
+        std::vector<std::vector<AssetMetaInfo>> nodeResults(m_nodes.size());
+
+        for (size_t i = 0; i < m_nodes.size(); ++i)
+        {
+            Node& node = m_nodes[i];
+            if (node.isDirty)
+            {
+                if (waves.size() <= nodeWaves[i])
+                {
+                    waves.resize(nodeWaves[i] + 1);
+                }
+                waves[nodeWaves[i]].push_back(i);
+                continue;
+            }
+
+            iterateCookableAssets(node.meta, [&](nau::UsdMetaInfo& meta)
+            {
+                nodeSteps[i].push_back(AssetCookStep{meta.uid, meta.assetPath, AssetCookStatus::UpToDate, {}, microseconds{0}});
+                if (nau::Result<AssetMetaInfo> record = db.get(meta.uid); !record.isError())
+                {
+                    nodeResults[i].push_back(*record);
+                }
+            });
+        }
+
+        const auto cookNode = [&](size_t nodeIndex)
+        {
+            Node& node = m_nodes[nodeIndex];
+            size_t assetIndex = 0;
+
+            LOG_INFO("Cooking {} ({})", node.metafilePath, node.dirtyReason);
+
+            iterateCookableAssets(node.meta, [&](nau::UsdMetaInfo& meta)
+            {
+                const auto startTime = steady_clock::now();
+                nau::Result<AssetMetaInfo> result = cook(node.stage, meta, node.inputHashes[assetIndex++]);
+                const auto duration = duration_cast<microseconds>(steady_clock::now() - startTime);
+
+                const AssetCookStatus status = result.isError() ? AssetCookStatus::Failed : AssetCookStatus::Cooked;
+                nodeSteps[nodeIndex].push_back(AssetCookStep{meta.uid, meta.assetPath, status, node.dirtyReason, duration});
+
+                if (!result.isError())
+                {
+                    nodeResults[nodeIndex].push_back(std::move(*result));
+                }
+            });
+        };
+
+        for (const std::vector<size_t>& wave : waves)
+        {
+            std::atomic<size_t> nextNode = 0;
+            const auto worker = [&]
+            {
+                for (size_t i = nextNode++; i < wave.size(); i = nextNode++)
+                {
+                    cookNode(wave[i]);
+                }
+            };
+
+            std::vector<std::thread> threads;
+            for (size_t i = 1, count = std::min(m_jobsCount, wave.size()); i < count; ++i)
+            {
+                threads.emplace_back(worker);
+            }
+
+            worker();
+
+            for (std::thread& thread : threads)
+            {
+                thread.join();
+            }
+        }
+
+        std::vector<AssetMetaInfo> results;
+        for (size_t i = 0; i < m_nodes.size(); ++i)
+        {
+            m_steps.insert(m_steps.end(), nodeSteps[i].begin(), nodeSteps[i].end());
+            results.insert(results.end(), std::make_move_iterator(nodeResults[i].begin()), std::make_move_iterator(nodeResults[i].end()));
+        }
+
+        m_totalDuration = duration_cast<microseconds>(steady_clock::now() - runStartTime);
+
+        const auto countSteps = [this](AssetCookStatus status)
+        {
+            return std::count_if(m_steps.begin(), m_steps.end(), [status](const AssetCookStep& step)
+            {
+                return step.status == status;
+            });
+        };
+
+        LOG_INFO("Assets cook finished in {} ms: {} cooked, {} up to date, {} failed", duration_cast<milliseconds>(m_totalDuration).count(),
+                 countSteps(AssetCookStatus::Cooked), countSteps(AssetCookStatus::UpToDate), countSteps(AssetCookStatus::Failed));
+
+        return results;
+    }
+
+    bool AssetCookGraph::writeReport(const std::filesystem::path& reportPath) const
+    {
+        nlohmann::json steps = nlohmann::json::array();
+        for (const AssetCookStep& step : m_steps)
+        {
+            steps.push_back({
+                {      "uid",                     toString(step.uid)},
+                {   "source",                        step.sourcePath},
+                {   "status",                   statusToString(step.status)},
+                {   "reason",                            step.reason},
+                {"durationMs", static_cast<double>(step.duration.count()) / 1000.0}
+            });
+        }
+
+        const nlohmann::json report = {
+            {   "toolVersion",                                                               NAU_VERSION},
+            {     "jobsCount",                                                               m_jobsCount},
+            {"totalDurationMs", static_cast<double>(m_totalDuration.count()) / 1000.0},
+            {         "steps",                                                          std::move(steps)}
+        };
+
+        std::ofstream file(reportPath, std::ios::trunc);
+        if (!file)
+        {
+            LOG_WARN("Could not write the cook report {}", reportPath.string());
+            return false;
+        }
+
+        file << report.dump(4);
+        return static_cast<bool>(file);
+    }
+
+    const std::vector<AssetCookStep>& AssetCookGraph::getSteps() const
+    {
+        return m_steps;
+    }
+}  // namespace nau
@@ -16,6 +16,7 @@
 
 #include "EASTL/string.h"
 #include "nau/asset_tools/asset_api.h"
+#include "nau/asset_tools/asset_cook_graph.h"
 #include "nau/asset_tools/asset_compiler.h"
 #include "nau/asset_tools/asset_utils.h"
 #include "nau/asset_tools/db_manager.h"
@@ -115,17 +116,6 @@ namespace nau
         }
     }
 
-    bool isDirtyAsset(nau::UsdMetaInfo& metaInfo, AssetDatabaseManager& dbManager)
-    {
-        auto dbMeta = dbManager.get(metaInfo.uid);
-        auto& sourcePath = metaInfo.assetPath;
-        auto lastTimeWrite = std::filesystem::last_write_time(sourcePath).time_since_epoch().count();
-
-        const bool dirty = dbMeta.isError() || lastTimeWrite > dbMeta->lastModified || !dbManager.exist(metaInfo.uid) || !dbManager.compiled(metaInfo.uid);
-
-        return dirty;
-    }
-
     int NauImportAssetsJob::run(const CommonArguments* const params)
     {
         const ImportAssetsArguments* args = static_cast<const ImportAssetsArguments*>(params);
@@ -178,7 +168,7 @@ namespace nau
             {
                 const std::filesystem::path path = std::filesystem::path(assetPath.string());
 
-                if (compileSingleAsset(fs.getFileInfo(path.string()), assetsDb.string(), args->projectPath, dbManager, fs, assetsList))
+                if (compileSingleAsset(args, fs.getFileInfo(path.string()), assetsDb.string(), dbManager, fs, assetsList))
                 {
                     dbManager.save();
 
@@ -191,7 +181,7 @@ namespace nau
                 {
                     const std::filesystem::path metafilePath = std::filesystem::path(assetPath.string() + ".nausd");
 
-                    if (compileSingleAsset(fs.getFileInfo(metafilePath.string()), assetsDb.string(), args->projectPath, dbManager, fs, assetsList))
+                    if (compileSingleAsset(args, fs.getFileInfo(metafilePath.string()), assetsDb.string(), dbManager, fs, assetsList))
                     {
                         dbManager.save();
 
@@ -232,7 +222,7 @@ namespace nau
         return result;
     }
 
-    nau::Result<AssetMetaInfo> NauImportAssetsJob::updateAsset(PXR_NS::UsdStageRefPtr stage, nau::UsdMetaInfo& meta, const std::filesystem::path& dbPath, const std::string& projectRootPath, AssetDatabaseManager& db, FileSystem& fs)
+    nau::Result<AssetMetaInfo> NauImportAssetsJob::updateAsset(PXR_NS::UsdStageRefPtr stage, nau::UsdMetaInfo& meta, uint64_t inputHash, const std::filesystem::path& dbPath, const std::string& projectRootPath, AssetDatabaseManager& db, FileSystem& fs)
     {
         if (!fs.exist(meta.assetPath))
         {
@@ -254,13 +244,6 @@ namespace nau
             LOG_INFO("Asset {} not found in database, its new asset, adding to folder {}", meta.assetPath, *assetDbIndex);
         }
 
-        if (!isDirtyAsset(meta, db))
-        {
-            LOG_INFO("Asset {} is not dirty, skipping...", meta.assetPath);
-            auto dbMeta = db.get(meta.uid);
-            return *dbMeta;
-        }
-
         LOG_INFO("Compiling asset {}", meta.assetPath);
 
         try
@@ -275,8 +258,10 @@ namespace nau
             else
             {
                 AssetMetaInfo info = *compilationResult;
+                info.inputHash = inputHash;
 
-                auto lastModified = std::filesystem::last_write_time(meta.assetPath).time_since_epoch().count();
+                // Dependencies are used by the runtime to load the referenced assets together with the asset.
+                utils::collectAssetDependencies(dbPath, info);
 
                 // Import asset into asset database only if compilation was successful
                 db.addOrReplace(info);
@@ -294,26 +279,20 @@ namespace nau
         return NauMakeError("Asset cannot be compiled");
     };
 
-    nau::Result<std::vector<AssetMetaInfo>> NauImportAssetsJob::updateAssetInDatabase(PXR_NS::UsdStageRefPtr stage, std::vector<nau::UsdMetaInfo>& metaArray, const std::filesystem::path& dbPath, const std::string& projectRootPath, AssetDatabaseManager& db, FileSystem& fs)
+    void NauImportAssetsJob::cookAssets(AssetCookGraph& graph, const ImportAssetsArguments* args, const std::filesystem::path& dbPath, AssetDatabaseManager& db, std::vector<AssetMetaInfo>& assetsList)
     {
-        std::vector<AssetMetaInfo> result;
+        graph.build(db);
 
-        iterators::iterateMeta(metaArray, [&](nau::UsdMetaInfo& meta)
+        std::vector<AssetMetaInfo> cookedAssets = graph.run([&](PXR_NS::UsdStageRefPtr stage, nau::UsdMetaInfo& meta, uint64_t inputHash)
         {
-            auto compilationResult = updateAsset(stage, meta, dbPath, projectRootPath, db, fs);
-
-            if (!compilationResult.isError())
-            {
-                result.push_back(*compilationResult);
-            }
-        });
+            // Called by the cook threads
+            FileSystem fs;
+            return updateAsset(stage, meta, inputHash, dbPath, args->projectPath, db, fs);
+        }, db, args->jobsCount);
 
-        if (result.empty())
-        {
-            return NauMakeError("Asset cannot be compiled, see log for details!");
-        }
+        assetsList.insert(assetsList.end(), cookedAssets.begin(), cookedAssets.end());
 
-        return result;
+        graph.writeReport(dbPath / getAssetsCookReportName());
     }
 
     int NauImportAssetsJob::importAssets(const ImportAssetsArguments* args, FileSystem& fs, AssetDatabaseManager& db)
@@ -434,6 +413,8 @@ namespace nau
 
         LOG_INFO("Project {} scanned, {} assets found!", args->projectPath, metaFiles.size());
 
+        AssetCookGraph graph;
+
         for (const auto& file : metaFiles)
         {
             auto metafilePath = file.path + file.extension;
@@ -454,21 +435,15 @@ namespace nau
 
             updateMetaPath(meta, std::filesystem::path(file.path).parent_path(), metafilePath);
 
-            auto compilationResultMeta = updateAssetInDatabase(stage, meta, assetsDb, args->projectPath, db, fs);
-
-            if (!compilationResultMeta.isError())
-            {
-                for (auto& asset : *compilationResultMeta)
-                {
-                    assetsList.push_back(asset);
-                }
-            }
+            graph.addNode(metafilePath, stage, std::move(meta));
         }
 
+        cookAssets(graph, args, assetsDb, db, assetsList);
+
         return 0;
     }
 
-    int NauImportAssetsJob::compileSingleAsset(const FileInfo& file, const std::filesystem::path& dbPath, const std::string& projectRootPath, AssetDatabaseManager& db, FileSystem& fs, std::vector<AssetMetaInfo>& assetsList)
+    int NauImportAssetsJob::compileSingleAsset(const ImportAssetsArguments* args, const FileInfo& file, const std::filesystem::path& dbPath, AssetDatabaseManager& db, FileSystem& fs, std::vector<AssetMetaInfo>& assetsList)
     {
         UsdMetaManager& metaManager = UsdMetaManager::instance();
 
@@ -484,15 +459,10 @@ namespace nau
 
         updateMetaPath(meta, std::filesystem::path(file.path).parent_path(), metafilePath);
 
-        auto compilationResultMeta = updateAssetInDatabase(stage, meta, dbPath, projectRootPath, db, fs);
+        AssetCookGraph graph;
+        graph.addNode(metafilePath, stage, std::move(meta));
 
-        if (!compilationResultMeta.isError())
-        {
-            for (auto& asset : *compilationResultMeta)
-            {
-                assetsList.push_back(asset);
-            }
-        }
+        cookAssets(graph, args, dbPath, db, assetsList);
 
         return 1;
     }
@@ -4,6 +4,8 @@
 
 #include "nau/asset_tools/asset_utils.h"
 
+#include <fstream>
+
 #include "nau/asset_tools/asset_compiler.h"
 #include "nau/asset_tools/asset_info.h"
 #include "nau/shared/file_system.h"
@@ -97,6 +99,42 @@ namespace nau
             return plugins[pluginName];
         }
 
+        void collectAssetDependencies(const std::filesystem::path& dbPath, AssetMetaInfo& metaInfo)
+        {
+            static constexpr std::string_view UidScheme = "uid:";
+            static constexpr size_t UidStringLength = 36;
+
+            metaInfo.dependencies.clear();
+
+            std::ifstream file(dbPath / metaInfo.dbPath.c_str(), std::ios::binary);
+            if (!file)
+            {
+                return;
+            }
+
+            const std::string content{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+
+            for (size_t pos = content.find(UidScheme); pos != std::string::npos; pos = content.find(UidScheme, pos))
+            {
+                pos += UidScheme.size();
+                if (content.size() < pos + UidStringLength)
+                {
+                    break;
+                }
+
+                const Result<Uid> uid = Uid::parseString(std::string_view{content}.substr(pos, UidStringLength));
+                if (!uid || *uid == metaInfo.uid)
+                {
+                    continue;
+                }
+
+                if (std::find(metaInfo.dependencies.begin(), metaInfo.dependencies.end(), *uid) == metaInfo.dependencies.end())
+                {
+                    metaInfo.dependencies.push_back(*uid);
+                }
+            }
+        }
+
         namespace compilers
         {
             std::filesystem::path ensureOutputPath(const std::string& outputPath, const AssetMetaInfo& metaInfo, std::string ext)
@@ -443,12 +443,31 @@ namespace nau::compilers
             return tmpDirPath;
         }
 
+        // The animations section of the ozz import config: the keyframes reduction at cook time.
+        // The ozz runtime animation keeps the remaining keys quantized (half floats, 16 bit quaternion components).
+        std::string makeOzzAnimationsConfig(const std::string& outputAnimationsPath, const ExtraInfoAnimation* clipSettings)
+        {
+            const ExtraInfoAnimation defaultSettings;
+            const ExtraInfoAnimation& settings = clipSettings ? *clipSettings : defaultSettings;
+
+            std::string overrides;
+            for (const auto& joint : settings.jointOptimizations)
+            {
+                overrides += std::format("{}{{\"name\":\"{}\",\"tolerance\":{},\"distance\":{}}}",
+                    overrides.empty() ? "" : ",", joint.jointName, joint.tolerance, joint.distance);
+            }
+
+            return std::format("[{{\"filename\":\"{}\",\"optimize\":{},\"optimization_settings\":{{\"tolerance\":{},\"distance\":{},\"override\":[{}]}}}}]",
+                outputAnimationsPath, settings.optimize ? "true" : "false", settings.optimizationTolerance, settings.optimizationDistance, overrides);
+        }
+
         nau::Result<AssetMetaInfo> exportSkeletalGltf2Nanim(
             const std::string& outputPath,
             const std::string& assetPath,
             const std::string& sourceGltfPath,
             int folderIndex,
             bool clearTempDir,
+            const ExtraInfoAnimation* clipSettings,
             SkeletalAnimationAssetData& nanimData)
         {
             const std::string relativeSourcePath = FileSystemExtensions::getRelativeAssetPath(assetPath, true).string();
@@ -493,7 +512,7 @@ namespace nau::compilers
 
                 std::string ozzGltfPath = std::format("--file={}", tempGltfPath.string());
                 std::replace(ozzGltfPath.begin(), ozzGltfPath.end(), '\\', '/');
-                std::string ozzParams = std::format("--config={{\"skeleton\":{{\"filename\":\"{}\"}},\"animations\":[{{\"filename\":\"{}\"}}]}}", outputSkeletonPath, outputAnimationsPath);
+                std::string ozzParams = std::format("--config={{\"skeleton\":{{\"filename\":\"{}\"}},\"animations\":{}}}", outputSkeletonPath, makeOzzAnimationsConfig(outputAnimationsPath, clipSettings));
                 std::replace(ozzParams.begin(), ozzParams.end(), '\\', '/');
 
                 const char* params[] =
@@ -790,7 +809,7 @@ namespace nau::compilers
 
         if (auto bindsResult = getBindsDataFromPrim(primToCompile))
         {
-            return exportSkeletalGltf2Nanim(outputPath, metaInfo.assetPath, intermediateGltfPath, folderIndex, false, *bindsResult);
+            return exportSkeletalGltf2Nanim(outputPath, metaInfo.assetPath, intermediateGltfPath, folderIndex, false, extraInfo, *bindsResult);
         }
 
         return NauMakeError("Failed to get bind matrices");
@@ -805,7 +824,8 @@ namespace nau::compilers
     {
         SkeletalAnimationAssetData emptyBindsData;
 
-        return exportSkeletalGltf2Nanim(outputPath, metaInfo.assetPath, metaInfo.assetPath, folderIndex, true, emptyBindsData);
+        // No clip meta for a plain glTF: the default keyframes reduction.
+        return exportSkeletalGltf2Nanim(outputPath, metaInfo.assetPath, metaInfo.assetPath, folderIndex, true, nullptr, emptyBindsData);
     }
 
 }  // namespace nau::compilers
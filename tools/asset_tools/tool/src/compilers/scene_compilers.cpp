@@ -5,7 +5,9 @@
 #pragma once
 
 #include "nau/asset_tools/compilers/scene_compilers.h"
+#include "nau/asset_tools/compilers/scene_static_merge.h"
 
+#include <nau/app/global_properties.h>
 #include <nau/assets/asset_container_builder.h>
 #include <nau/scene/scene_factory.h>
 #include <nau/service/service_provider.h>
@@ -79,6 +81,21 @@ namespace nau
 
             translatorFunction(stageToCompile, scene.getRef());
 
+            const AssetMetaInfo sceneMeta = makeAssetMetaInfo(extraData->path, metaInfo.uid, std::format("{}/{}{}", folderIndex, toString(metaInfo.uid), ext().data()), "nausd_scene", "scene");
+
+            // The editor works with the authoring scene: only the cooked one has the static props merged.
+            if (const SceneStaticMergeSettings mergeSettings = SceneStaticMergeSettings::fromGlobalProperties(); mergeSettings.enabled)
+            {
+                if (auto mergeResult = mergeStaticMeshes(*scene, outputPath, folderIndex, sceneMeta, mergeSettings); !mergeResult)
+                {
+                    LOG_WARN("Static meshes of scene {} are not merged: {}", extraData->path, mergeResult.getError()->getMessage());
+                }
+                else if (*mergeResult > 0)
+                {
+                    LOG_INFO("Merged {} static meshes of scene {}", *mergeResult, extraData->path);
+                }
+            }
+
             const std::filesystem::path subPath = std::filesystem::path(outputPath) / std::to_string(folderIndex) / std::string(toString(metaInfo.uid) + ext().data());
 
             if (!std::filesystem::exists(subPath.parent_path()))
@@ -99,6 +116,12 @@ namespace nau
                     return NauMakeError("Could not find builder for scene!");
                 }
 
+                // Compiled scenes are stored in the cooked binary format, the JSON format remains for the authoring.
+                if (getServiceProvider().has<GlobalProperties>())
+                {
+                    getServiceProvider().get<GlobalProperties>().setValue("/assets/scene/cookedFormat", true).ignore();
+                }
+
                 const Result<> writeResult = assetBuilder->writeAssetToStream(stream, sceneAsset);
             }
 
@@ -106,7 +129,7 @@ namespace nau
 
             if (std::filesystem::exists(output))
             {
-                return makeAssetMetaInfo(extraData->path, metaInfo.uid, std::format("{}/{}{}", folderIndex, toString(metaInfo.uid), ext().data()), "nausd_scene", "scene");
+                return sceneMeta;
             }
 
             return NauMakeError("Failed to write scene {} at path {}!", extraData->path.c_str(), output.c_str());
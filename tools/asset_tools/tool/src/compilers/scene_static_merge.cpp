@@ -0,0 +1,424 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "nau/asset_tools/compilers/scene_static_merge.h"
+
+#include <nau/app/global_properties.h>
+#include <nau/scene/components/static_mesh_component.h>
+#include <nau/scene/scene_factory.h>
+#include <nau/service/service_provider.h>
+#include <nau/shared/logger.h>
+
+#include <cfloat>
+#include <cmath>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <map>
+#include <optional>
+#include <vector>
+
+#include "nau/asset_tools/db_manager.h"
+#include "nau/assets/native_mesh.h"
+
+namespace nau
+{
+    namespace compilers
+    {
+        namespace
+        {
+            struct MergeCandidate
+            {
+                scene::SceneObject* object = nullptr;
+                math::Transform transform;
+                std::vector<std::byte> data;
+                NativeMeshView mesh;
+            };
+
+            // The native mesh the geometry of the component is cooked into, nothing if the geometry is not a cooked native mesh.
+            std::optional<std::vector<std::byte>> loadNativeMesh(const scene::StaticMeshComponent& component, const std::string& outputPath)
+            {
+                const IAssetDescriptor::Ptr descriptor = component.getMeshGeometry().getAssetDiscriptor();
+                if (!descriptor)
+                {
+                    return std::nullopt;
+                }
+
+                const AssetPath assetPath = descriptor->getAssetPath();
+                if (assetPath.getScheme() != "uid")
+                {
+                    return std::nullopt;
+                }
+
+                const eastl::string_view uidStr = assetPath.getContainerPath();
+                const nau::Result<Uid> uid = Uid::parseString(std::string_view{uidStr.data(), uidStr.size()});
+                if (!uid)
+                {
+                    return std::nullopt;
+                }
+
+                const nau::Result<AssetMetaInfo> meshMeta = AssetDatabaseManager::instance().get(*uid);
+                if (!meshMeta)
+                {
+                    return std::nullopt;
+                }
+
+                const std::filesystem::path meshPath = std::filesystem::path(outputPath) / meshMeta->dbPath.c_str();
+                if (meshPath.extension() != ".nmesh")
+                {
+                    return std::nullopt;
+                }
+
+                std::ifstream file(meshPath, std::ios::binary | std::ios::ate);
+                if (!file)
+                {
+                    return std::nullopt;
+                }
+
+                std::vector<std::byte> data(static_cast<size_t>(file.tellg()));
+                file.seekg(0);
+                if (!file.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size())))
+                {
+                    return std::nullopt;
+                }
+
+                return data;
+            }
+
+            // The merged meshes must have the same vertex streams: the attributes are compared in their order.
+            std::string getAttributesSignature(const NativeMeshView& mesh)
+            {
+                std::string signature;
+                for (const NativeMeshAttribute& attribute : mesh.getAttributes())
+                {
+                    signature += std::format("{}{}:{}:{};", attribute.semantic, attribute.semanticIndex, attribute.elementFormat, attribute.attributeType);
+                }
+
+                return signature;
+            }
+
+            uint32_t readIndex(eastl::span<const std::byte> indices, ElementFormat format, size_t i)
+            {
+                return format == ElementFormat::Uint16 ? reinterpret_cast<const uint16_t*>(indices.data())[i] : reinterpret_cast<const uint32_t*>(indices.data())[i];
+            }
+
+            void appendIndices(eastl::vector<std::byte>& output, eastl::span<const std::byte> indices, ElementFormat format, uint32_t baseVertex, bool isUint16)
+            {
+                const size_t count = indices.size() / (format == ElementFormat::Uint16 ? sizeof(uint16_t) : sizeof(uint32_t));
+                const size_t indexSize = isUint16 ? sizeof(uint16_t) : sizeof(uint32_t);
+                const size_t start = output.size();
+                output.resize(start + count * indexSize);
+
+                for (size_t i = 0; i < count; ++i)
+                {
+                    const uint32_t index = readIndex(indices, format, i) + baseVertex;
+                    if (isUint16)
+                    {
+                        reinterpret_cast<uint16_t*>(output.data() + start)[i] = static_cast<uint16_t>(index);
+                    }
+                    else
+                    {
+                        reinterpret_cast<uint32_t*>(output.data() + start)[i] = index;
+                    }
+                }
+            }
+
+            // Appends the vertex stream of the member transformed into the world space:
+            // the positions are transformed, the normals are transformed with the inverse scale, the tangents are rotated (keeping their sign).
+            void appendAttribute(eastl::vector<std::byte>& output, const NativeMeshAttribute& attribute, eastl::span<const std::byte> data, const math::Transform& transform)
+            {
+                const size_t start = output.size();
+                output.resize(start + data.size());
+                memcpy(output.data() + start, data.data(), data.size());
+
+                if (static_cast<ElementFormat>(attribute.elementFormat) != ElementFormat::Float)
+                {
+                    return;
+                }
+
+                const std::string_view semantic = attribute.semantic;
+                const AttributeType type = static_cast<AttributeType>(attribute.attributeType);
+                const size_t componentsCount = type == AttributeType::Vec4 ? 4 : type == AttributeType::Vec3 ? 3 : 0;
+                if (componentsCount == 0 || (semantic != "POSITION" && semantic != "NORMAL" && semantic != "TANGENT"))
+                {
+                    return;
+                }
+
+                float* const values = reinterpret_cast<float*>(output.data() + start);
+                const size_t count = data.size() / (componentsCount * sizeof(float));
+                const math::vec3 scale = transform.getScale();
+
+                for (size_t i = 0; i < count; ++i)
+                {
+                    float* const value = values + i * componentsCount;
+                    math::vec3 result;
+                    if (semantic == "POSITION")
+                    {
+                        result = math::vec3{transform.transformPoint(math::Point3{value[0], value[1], value[2]})};
+                    }
+                    else
+                    {
+                        const math::vec3 direction{value[0], value[1], value[2]};
+                        result = math::rotate(transform.getRotation(), semantic == "NORMAL" ? math::divPerElem(direction, scale) : math::mulPerElem(direction, scale));
+                        if (const float length = math::length(result); length > FLT_EPSILON)
+                        {
+                            result /= length;
+                        }
+                    }
+
+                    value[0] = result.getX();
+                    value[1] = result.getY();
+                    value[2] = result.getZ();
+                }
+            }
+
+            NativeMeshData mergeMeshes(eastl::span<const MergeCandidate* const> members)
+            {
+                const NativeMeshView& first = members.front()->mesh;
+
+                size_t vertexCount = 0;
+                bool mergeLods = true;
+                for (const MergeCandidate* member : members)
+                {
+                    vertexCount += member->mesh.getDescription().vertexCount;
+                    mergeLods = mergeLods && member->mesh.getLods().size() == first.getLods().size();
+                }
+
+                const bool isUint16 = vertexCount <= std::numeric_limits<uint16_t>::max();
+
+                NativeMeshData merged;
+                merged.description.vertexCount = static_cast<unsigned>(vertexCount);
+                merged.description.indexFormat = isUint16 ? ElementFormat::Uint16 : ElementFormat::Uint32;
+                merged.bounds.setempty();
+
+                for (const NativeMeshAttribute& attribute : first.getAttributes())
+                {
+                    NativeMeshData::Attribute& mergedAttribute = merged.attributes.emplace_back();
+                    mergedAttribute.description.semantic = attribute.semantic;
+                    mergedAttribute.description.semanticIndex = attribute.semanticIndex;
+                    mergedAttribute.description.elementFormat = static_cast<ElementFormat>(attribute.elementFormat);
+                    mergedAttribute.description.attributeType = static_cast<AttributeType>(attribute.attributeType);
+                }
+
+                if (mergeLods)
+                {
+                    merged.lods.resize(first.getLods().size());
+                    for (NativeMeshData::Lod& lod : merged.lods)
+                    {
+                        lod.description.indexCount = 0;
+                        lod.description.screenSize = FLT_MAX;
+                    }
+                }
+
+                uint32_t baseVertex = 0;
+                for (const MergeCandidate* member : members)
+                {
+                    const NativeMeshView& mesh = member->mesh;
+                    const MeshDescription description = mesh.getDescription();
+
+                    appendIndices(merged.indices, mesh.getIndices(), description.indexFormat, baseVertex, isUint16);
+
+                    for (size_t i = 0; i < mesh.getAttributes().size(); ++i)
+                    {
+                        const NativeMeshAttribute& attribute = mesh.getAttributes()[i];
+                        appendAttribute(merged.attributes[i].data, attribute, mesh.getBlock(attribute.data), member->transform);
+                    }
+
+                    // The lod screen size is relative to the bounds, which only grow: the finest member threshold is kept.
+                    for (size_t i = 0; i < merged.lods.size(); ++i)
+                    {
+                        const NativeMeshLod& lod = mesh.getLods()[i];
+                        merged.lods[i].description.indexCount += lod.indexCount;
+                        merged.lods[i].description.screenSize = eastl::min(merged.lods[i].description.screenSize, lod.screenSize);
+                        appendIndices(merged.lods[i].indices, mesh.getBlock(lod.indices), description.indexFormat, baseVertex, isUint16);
+                    }
+
+                    const math::BBox3 bounds = mesh.getBounds();
+                    for (int corner = 0; corner < 8; ++corner)
+                    {
+                        const math::Point3 point{bounds.lim[corner & 1].getX(), bounds.lim[(corner >> 1) & 1].getY(), bounds.lim[(corner >> 2) & 1].getZ()};
+                        merged.bounds += math::vec3{member->transform.transformPoint(point)};
+                    }
+
+                    baseVertex += description.vertexCount;
+                }
+
+                merged.description.indexCount = static_cast<unsigned>(merged.indices.size() / (isUint16 ? sizeof(uint16_t) : sizeof(uint32_t)));
+
+                return merged;
+            }
+
+            // The merged mesh is registered as the model derived from the scene: the uid is kept between the cooks.
+            nau::Result<Uid> writeMergedMesh(const NativeMeshData& mesh, const std::string& key, const std::string& outputPath, int folderIndex, const AssetMetaInfo& sceneMeta)
+            {
+                AssetDatabaseManager& dbManager = AssetDatabaseManager::instance();
+
+                const std::string sourcePath = std::format("{}+[merged/{}]", sceneMeta.sourcePath.c_str(), key);
+                const nau::Result<Uid> existingUid = dbManager.findIf(sourcePath);
+                const Uid uid = existingUid ? *existingUid : Uid::generate();
+                const std::string fileName = toString(uid) + ".nmesh";
+
+                const eastl::vector<std::byte> nativeMesh = writeNativeMesh(mesh);
+
+                std::ofstream file(std::filesystem::path(outputPath) / std::to_string(folderIndex) / fileName, std::ios::binary | std::ios::trunc);
+                file.write(reinterpret_cast<const char*>(nativeMesh.data()), static_cast<std::streamsize>(nativeMesh.size()));
+                if (!file)
+                {
+                    return NauMakeError("Failed to write the merged mesh {}", fileName);
+                }
+
+                AssetMetaInfo meshMeta;
+                meshMeta.uid = uid;
+                meshMeta.dbPath = (std::filesystem::path(std::to_string(folderIndex)) / fileName).string().c_str();
+                meshMeta.kind = "Model";
+                meshMeta.sourceType = sceneMeta.sourceType;
+                meshMeta.sourcePath = sourcePath.c_str();
+                meshMeta.nausdPath = sceneMeta.nausdPath;
+                meshMeta.dirty = false;
+                meshMeta.lastModified = sceneMeta.lastModified;
+
+                dbManager.addOrReplace(meshMeta);
+
+                return uid;
+            }
+        }  // namespace
+
+        SceneStaticMergeSettings SceneStaticMergeSettings::fromGlobalProperties()
+        {
+            SceneStaticMergeSettings settings;
+            if (!getServiceProvider().has<GlobalProperties>())
+            {
+                return settings;
+            }
+
+            auto& properties = getServiceProvider().get<GlobalProperties>();
+            settings.enabled = properties.getValue<bool>("/assets/scene/staticMerge/enabled").value_or(settings.enabled);
+            settings.cellSize = properties.getValue<float>("/assets/scene/staticMerge/cellSize").value_or(settings.cellSize);
+            settings.maxVertices = properties.getValue<uint32_t>("/assets/scene/staticMerge/maxVertices").value_or(settings.maxVertices);
+
+            return settings;
+        }
+
+        nau::Result<size_t> mergeStaticMeshes(scene::IScene& scene, const std::string& outputPath, int folderIndex, const AssetMetaInfo& sceneMeta, const SceneStaticMergeSettings& settings)
+        {
+            NAU_ASSERT(settings.cellSize > 0.f);
+
+            struct Group
+            {
+                MaterialAssetRef material;
+                bool castShadow = true;
+                std::vector<MergeCandidate> members;
+            };
+
+            // The ordered map: the groups (and so the merged meshes keys) do not depend on the scene objects order.
+            std::map<std::string, Group> groups;
+
+            for (scene::SceneObject* const object : scene.getRoot().getChildObjects(true))
+            {
+                if (!object->getChildObjects(false).empty() || object->getDirectComponents().size() != 1)
+                {
+                    continue;
+                }
+
+                auto* const component = object->getRootComponent().as<scene::StaticMeshComponent*>();
+                if (!component || !component->getVisibility() || component->isOccluder())
+                {
+                    continue;
+                }
+
+                std::optional<std::vector<std::byte>> data = loadNativeMesh(*component, outputPath);
+                if (!data)
+                {
+                    continue;
+                }
+
+                MergeCandidate candidate{.object = object, .transform = component->getWorldTransform(), .data = std::move(*data)};
+                nau::Result<NativeMeshView> mesh = NativeMeshView::open({candidate.data.data(), candidate.data.size()});
+                if (!mesh)
+                {
+                    continue;
+                }
+
+                candidate.mesh = *mesh;
+
+                const math::BBox3 bounds = candidate.mesh.getBounds();
+                const math::vec3 center{candidate.transform.transformPoint(math::Point3{bounds.center()})};
+                const std::string key = std::format("{}/{}/{}_{}_{}/{}", toString(component->getMaterial()), component->getCastShadow() ? 1 : 0,
+                                                    static_cast<int>(std::floor(center.getX() / settings.cellSize)),
+                                                    static_cast<int>(std::floor(center.getY() / settings.cellSize)),
+                                                    static_cast<int>(std::floor(center.getZ() / settings.cellSize)),
+                                                    getAttributesSignature(candidate.mesh));
+
+                Group& group = groups[key];
+                if (group.members.empty())
+                {
+                    group.material = component->getMaterial();
+                    group.castShadow = component->getCastShadow();
+                }
+
+                group.members.push_back(std::move(candidate));
+            }
+
+            auto& sceneFactory = getServiceProvider().get<scene::ISceneFactory>();
+            size_t mergedObjectsCount = 0;
+
+            for (auto& [key, group] : groups)
+            {
+                if (group.members.size() < 2)
+                {
+                    continue;
+                }
+
+                // The members are split into the chunks of the limited vertex count.
+                std::vector<std::vector<const MergeCandidate*>> chunks(1);
+                size_t chunkVertexCount = 0;
+                for (const MergeCandidate& member : group.members)
+                {
+                    const size_t vertexCount = member.mesh.getDescription().vertexCount;
+                    if (!chunks.back().empty() && chunkVertexCount + vertexCount > settings.maxVertices)
+                    {
+                        chunks.emplace_back();
+                        chunkVertexCount = 0;
+                    }
+
+                    chunks.back().push_back(&member);
+                    chunkVertexCount += vertexCount;
+                }
+
+                for (size_t chunkIndex = 0; chunkIndex < chunks.size(); ++chunkIndex)
+                {
+                    const std::vector<const MergeCandidate*>& chunk = chunks[chunkIndex];
+                    if (chunk.size() < 2)
+                    {
+                        continue;
+                    }
+
+                    const NativeMeshData mergedMesh = mergeMeshes({chunk.data(), chunk.size()});
+                    const nau::Result<Uid> uid = writeMergedMesh(mergedMesh, std::format("{}/{}", key, chunkIndex), outputPath, folderIndex, sceneMeta);
+                    NauCheckResult(uid);
+
+                    auto mergedObject = sceneFactory.createSceneObject<scene::StaticMeshComponent>();
+                    mergedObject->setName(std::format("MergedStaticMesh_{}", toString(*uid)).c_str());
+
+                    auto& meshComponent = mergedObject->getRootComponent<scene::StaticMeshComponent>();
+                    const std::string uidStr = toString(*uid);
+                    // The merged mesh is not known to the asset manager yet: the reference is resolved by the runtime.
+                    meshComponent.setMeshGeometry(StaticMeshAssetRef{AssetPath{"uid", eastl::string_view{uidStr.data(), uidStr.size()}, "mesh/0"}, true});
+                    meshComponent.setMaterial(group.material);
+                    meshComponent.setCastShadow(group.castShadow);
+
+                    for (const MergeCandidate* member : chunk)
+                    {
+                        member->object->getParentObject()->removeChild(*member->object);
+                    }
+
+                    scene.getRoot().attachChild(std::move(mergedObject));
+                    mergedObjectsCount += chunk.size();
+                }
+            }
+
+            return mergedObjectsCount;
+        }
+    }  // namespace compilers
+}  // namespace nau
@@ -10,13 +10,169 @@
 #include "nau/usd_meta_tools/usd_meta_info.h"
 #include "nau/service/service_provider.h"
 #include "nau/dataBlock/dag_dataBlock.h"
+#include "nau/math/math.h"
 #include "nau/asset_tools/asset_utils.h"
+#include "nau/shared/logger.h"
 
 #include "pxr/usd/sdf/payload.h"
 #include "usd_proxy/usd_prim_proxy.h"
 
+#include <binPack2D/MaxRectsBinPack.h>
+
+#define STB_IMAGE_STATIC
+#define STB_IMAGE_IMPLEMENTATION
+#include "stb_image.h"
+#define STB_IMAGE_WRITE_STATIC
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include "stb_image_write.h"
+
 namespace nau::compilers
 {
+    namespace
+    {
+        // The images of the UI scene sprites are packed to the atlases of this size
+        constexpr int UiAtlasSize = 2048;
+        // Larger images (backgrounds) are left as is: they would not share the atlas with anything
+        constexpr int UiAtlasMaxImageSize = 512;
+        // Transparent gap between the packed images, prevents the bleeding with the linear filtering
+        constexpr int UiAtlasPadding = 2;
+
+        struct UiAtlasImage
+        {
+            std::string fileName;
+            int width = 0;
+            int height = 0;
+            stbi_uc* pixels = nullptr;
+        };
+
+        // Collects the images referenced by the sprites and the button states
+        void collectUiImages(const DataBlock& blk, bool isButtonData, std::vector<std::string>& images)
+        {
+            const char* paramName = isButtonData ? "image" : (strcmp(blk.getBlockName(), "sprite_data") == 0 ? "fileName" : nullptr);
+            if (paramName)
+            {
+                const char* image = blk.getStr(paramName, "");
+                if (*image && std::find(images.begin(), images.end(), image) == images.end())
+                {
+                    images.emplace_back(image);
+                }
+            }
+
+            for (uint32_t i = 0; i < blk.blockCount(); ++i)
+            {
+                const DataBlock* childBlock = blk.getBlock(i);
+                collectUiImages(*childBlock, isButtonData || strcmp(childBlock->getBlockName(), "button_data") == 0, images);
+            }
+        }
+
+        /**
+            Packs the sprite images of the UI scene to the atlases (written next to the scene) and records the frames
+            (the atlas image and the image rectangle) to the scene blk: the runtime registers them as the sprite frames,
+            so the sprites of the canvas share few textures and are batched.
+         */
+        void packUiAtlases(DataBlock& blk, const std::filesystem::path& resourcesPath, const std::filesystem::path& scenePath)
+        {
+            std::vector<std::string> fileNames;
+            collectUiImages(blk, false, fileNames);
+
+            std::vector<UiAtlasImage> images;
+            for (const std::string& fileName : fileNames)
+            {
+                UiAtlasImage image{fileName};
+                int channels = 0;
+                image.pixels = stbi_load((resourcesPath / fileName).string().c_str(), &image.width, &image.height, &channels, 4);
+                if (!image.pixels)
+                {
+                    LOG_WARN("UI image {} is not packed to the atlas: {}", fileName, stbi_failure_reason());
+                    continue;
+                }
+
+                if (image.width > UiAtlasMaxImageSize || image.height > UiAtlasMaxImageSize)
+                {
+                    stbi_image_free(image.pixels);
+                    continue;
+                }
+
+                images.push_back(image);
+            }
+
+            // the single image gains nothing from the atlas
+            if (images.size() < 2)
+            {
+                for (UiAtlasImage& image : images)
+                {
+                    stbi_image_free(image.pixels);
+                }
+                return;
+            }
+
+            std::sort(images.begin(), images.end(), [](const UiAtlasImage& left, const UiAtlasImage& right)
+            {
+                return left.height != right.height ? left.height > right.height : left.width > right.width;
+            });
+
+            std::vector<stbi_uc> atlasPixels;
+            rbp::MaxRectsBinPack packer;
+            DataBlock* atlasBlock = nullptr;
+            int atlasIndex = -1;
+
+            const auto writeAtlas = [&]()
+            {
+                if (atlasIndex < 0)
+                {
+                    return;
+                }
+
+                const std::filesystem::path atlasPath = scenePath.parent_path() / std::format("{}_atlas{}.png", scenePath.stem().string(), atlasIndex);
+                std::error_code errorCode;
+                std::filesystem::create_directories(atlasPath.parent_path(), errorCode);
+                if (!stbi_write_png(atlasPath.string().c_str(), UiAtlasSize, UiAtlasSize, 4, atlasPixels.data(), UiAtlasSize * 4))
+                {
+                    LOG_WARN("Failed to write UI atlas {}", atlasPath.string());
+                }
+
+                atlasBlock->setStr("image", std::filesystem::relative(atlasPath, resourcesPath).generic_string().c_str());
+            };
+
+            for (const UiAtlasImage& image : images)
+            {
+                rbp::Rect rect{};
+                if (atlasIndex >= 0)
+                {
+                    rect = packer.Insert(image.width + UiAtlasPadding, image.height + UiAtlasPadding, rbp::MaxRectsBinPack::RectBestShortSideFit, false);
+                }
+
+                if (rect.height == 0)
+                {
+                    writeAtlas();
+
+                    ++atlasIndex;
+                    packer.Init(UiAtlasSize, UiAtlasSize);
+                    atlasPixels.assign(UiAtlasSize * UiAtlasSize * 4, 0);
+                    atlasBlock = blk.addNewBlock("atlas");
+
+                    rect = packer.Insert(image.width + UiAtlasPadding, image.height + UiAtlasPadding, rbp::MaxRectsBinPack::RectBestShortSideFit, false);
+                }
+
+                for (int row = 0; row < image.height; ++row)
+                {
+                    memcpy(atlasPixels.data() + ((rect.y + row) * UiAtlasSize + rect.x) * 4, image.pixels + row * image.width * 4, image.width * 4);
+                }
+
+                DataBlock* frameBlock = atlasBlock->addNewBlock("frame");
+                frameBlock->setStr("name", image.fileName.c_str());
+                frameBlock->setPoint4("rect", math::vec4(rect.x, rect.y, image.width, image.height));
+            }
+
+            writeAtlas();
+
+            for (UiAtlasImage& image : images)
+            {
+                stbi_image_free(image.pixels);
+            }
+        }
+    }  // namespace
+
     using translateUIScene = void (*)(PXR_NS::UsdStageRefPtr stage, nau::DataBlock& blk);
     translateUIScene getTranslatorFunction()
     {
@@ -55,6 +211,7 @@ namespace nau::compilers
 
         DataBlock blk;
         translateFn(uiSceneStage, blk);
+        packUiAtlases(blk, resourcesContentPath, exprotPath);
 
         if (!blk.saveToTextFile(exprotPath.string().c_str()))
         {
@@ -4,19 +4,29 @@
 
 #include "nau/asset_tools/compilers/usd_compilers.h"
 
+#include <Jolt/Core/StreamWrapper.h>
 #include <nau/shared/file_system.h>
 #include <nau/shared/logger.h>
+#include <pxr/usd/usdGeom/mesh.h>
 #include <pxr/usd/usdGeom/metrics.h>
 #include <pxr/usd/sdf/copyUtils.h>
 
+#include <cfloat>
+#include <fstream>
+
 #include "nau/asset_tools/asset_compiler.h"
 #include "nau/asset_tools/asset_utils.h"
 #include "nau/asset_tools/db_manager.h"
+#include "nau/assets/mesh_simplifier.h"
+#include "nau/assets/native_mesh.h"
+#include "nau/physics/jolt/jolt_cooked_shapes.h"
+#include "nau/physics/physics_assets.h"
 #include "nau/usd_meta_tools/usd_meta_manager.h"
 #include "usd_translator/usd_mesh_adapter.h"
 #include "usd_translator/usd_mesh_composer.h"
 #include "usd_translator/usd_translator.h"
 #include <nau/asset_tools/compilers/material_compilers.h>
+#include <nlohmann/json.hpp>
 
 namespace nau
 {
@@ -24,10 +34,412 @@ namespace nau
     {
         namespace
         {
-            bool isDirty(const std::string& path, const std::time_t& lastModified)
+            // Cooks the collision shapes of the mesh, so the runtime restores them
+            // instead of computing the convex hull and the triangles hierarchy on the scene activation.
+            nau::Result<> cookCollisionShapes(const PXR_NS::UsdGeomMesh& mesh, const std::filesystem::path& basePath, int folderIndex, const AssetMetaInfo& meshMeta)
             {
-                const std::time_t modTime = std::filesystem::last_write_time(path).time_since_epoch().count();
-                return lastModified != modTime;
+                namespace cooked_shapes = nau::physics::jolt::cooked_shapes;
+
+                PXR_NS::VtArray<PXR_NS::GfVec3f> points;
+                PXR_NS::VtArray<int> faceVertexCounts;
+                PXR_NS::VtArray<int> faceVertexIndices;
+                mesh.GetPointsAttr().Get(&points);
+                mesh.GetFaceVertexCountsAttr().Get(&faceVertexCounts);
+                mesh.GetFaceVertexIndicesAttr().Get(&faceVertexIndices);
+
+                JPH::VertexList positions;
+                positions.reserve(points.size());
+                for (const PXR_NS::GfVec3f& point : points)
+                {
+                    positions.push_back(JPH::Float3{point[0], point[1], point[2]});
+                }
+
+                // Faces are triangulated as fans, like the mesh export does.
+                JPH::IndexedTriangleList triangles;
+                size_t faceStart = 0;
+                for (const int faceVertexCount : faceVertexCounts)
+                {
+                    for (int i = 2; i < faceVertexCount; ++i)
+                    {
+                        triangles.push_back(JPH::IndexedTriangle{
+                            static_cast<uint32_t>(faceVertexIndices[faceStart]),
+                            static_cast<uint32_t>(faceVertexIndices[faceStart + i - 1]),
+                            static_cast<uint32_t>(faceVertexIndices[faceStart + i]),
+                            0});
+                    }
+                    faceStart += faceVertexCount;
+                }
+
+                if (triangles.empty())
+                {
+                    return NauMakeError("Mesh has no triangles to cook the collision");
+                }
+
+                JPH::RegisterDefaultAllocator();
+
+                const JPH::ShapeSettings::ShapeResult convexHull = cooked_shapes::createConvexHullShape(positions);
+                const JPH::ShapeSettings::ShapeResult triMesh = cooked_shapes::createTriMeshShape(std::move(positions), std::move(triangles));
+                if (convexHull.HasError() || triMesh.HasError())
+                {
+                    return NauMakeError("Failed to cook the collision: {}", convexHull.HasError() ? convexHull.GetError().c_str() : triMesh.GetError().c_str());
+                }
+
+                AssetDatabaseManager& dbManager = AssetDatabaseManager::instance();
+
+                const std::string sourcePath = std::string{meshMeta.sourcePath.c_str()} + std::string{nau::physics::CookedCollisionSourcePathSuffix.data(), nau::physics::CookedCollisionSourcePathSuffix.size()};
+                const nau::Result<Uid> existingUid = dbManager.findIf(sourcePath);
+                const Uid uid = existingUid ? *existingUid : Uid::generate();
+                const std::string fileName = toString(uid) + ".jphys";
+
+                std::ofstream output(basePath / fileName, std::ios::binary | std::ios::trunc);
+                JPH::StreamOutWrapper stream(output);
+                if (!cooked_shapes::save({convexHull.Get(), triMesh.Get()}, stream))
+                {
+                    return NauMakeError("Failed to write the cooked collision {}", fileName);
+                }
+
+                AssetMetaInfo cookedMeta;
+                cookedMeta.uid = uid;
+                cookedMeta.dbPath = (std::filesystem::path(std::to_string(folderIndex)) / fileName).string().c_str();
+                cookedMeta.kind = "CollisionShapes";
+                cookedMeta.sourceType = meshMeta.sourceType;
+                cookedMeta.sourcePath = sourcePath.c_str();
+                cookedMeta.nausdPath = meshMeta.nausdPath;
+                cookedMeta.dirty = false;
+                cookedMeta.lastModified = meshMeta.lastModified;
+
+                dbManager.addOrReplace(cookedMeta);
+
+                return nau::ResultSuccess;
+            }
+
+            constexpr unsigned GltfComponentUint8 = 5121;
+            constexpr unsigned GltfComponentUint16 = 5123;
+            constexpr unsigned GltfComponentUint32 = 5125;
+            constexpr unsigned GltfComponentFloat = 5126;
+
+            // The exported gltf with its binary buffer: the exporter writes the single external buffer.
+            struct ExportedGltf
+            {
+                nlohmann::json gltf;
+                std::vector<char> buffer;
+                std::filesystem::path bufferPath;
+
+                const char* readAccessor(unsigned accessorIndex, size_t& count, unsigned& componentType) const
+                {
+                    const nlohmann::json& accessor = gltf["accessors"][accessorIndex];
+                    const nlohmann::json& bufferView = gltf["bufferViews"][accessor.value("bufferView", 0u)];
+
+                    count = accessor.value("count", 0u);
+                    componentType = accessor.value("componentType", 0u);
+
+                    const size_t offset = bufferView.value("byteOffset", 0u) + accessor.value("byteOffset", 0u);
+                    return bufferView.value("buffer", 0u) == 0 && offset < buffer.size() ? buffer.data() + offset : nullptr;
+                }
+
+                eastl::vector<uint32_t> readIndices(unsigned accessorIndex) const
+                {
+                    size_t indexCount = 0;
+                    unsigned indexType = 0;
+                    const char* const indexData = readAccessor(accessorIndex, indexCount, indexType);
+
+                    eastl::vector<uint32_t> indices(indexData ? indexCount : 0);
+                    for (size_t i = 0; i < indices.size(); ++i)
+                    {
+                        indices[i] = indexType == GltfComponentUint32 ? reinterpret_cast<const uint32_t*>(indexData)[i] :
+                                     indexType == GltfComponentUint16 ? reinterpret_cast<const uint16_t*>(indexData)[i] :
+                                                                        static_cast<uint8_t>(indexData[i]);
+                    }
+
+                    return indices;
+                }
+            };
+
+            nau::Result<ExportedGltf> loadExportedGltf(const std::filesystem::path& gltfPath)
+            {
+                ExportedGltf exported;
+                {
+                    std::ifstream gltfFile(gltfPath);
+                    exported.gltf = nlohmann::json::parse(gltfFile, nullptr, false);
+                }
+
+                const nlohmann::json& gltf = exported.gltf;
+                if (gltf.is_discarded() || !gltf.contains("meshes") || gltf["meshes"].empty() || !gltf.contains("buffers") || gltf["buffers"].empty())
+                {
+                    return NauMakeError("Invalid gltf {}", gltfPath.string());
+                }
+
+                const std::string bufferUri = gltf["buffers"][0].value("uri", "");
+                if (bufferUri.empty() || bufferUri.starts_with("data:"))
+                {
+                    return NauMakeError("The embedded gltf buffers are not supported");
+                }
+
+                exported.bufferPath = gltfPath.parent_path() / bufferUri;
+                {
+                    std::ifstream bufferFile(exported.bufferPath, std::ios::binary);
+                    exported.buffer.assign(std::istreambuf_iterator<char>(bufferFile), std::istreambuf_iterator<char>());
+                }
+
+                return exported;
+            }
+
+            // Generates the lods of the exported mesh primitive: the lod indices are appended to the gltf binary buffer
+            // and referenced by the primitive extras (see GltfMeshData::PrimitiveExtras).
+            nau::Result<size_t> cookMeshLods(const std::filesystem::path& gltfPath)
+            {
+                constexpr unsigned ElementArrayBufferTarget = 34963;
+
+                nau::Result<ExportedGltf> exported = loadExportedGltf(gltfPath);
+                NauCheckResult(exported);
+
+                nlohmann::json& gltf = exported->gltf;
+                std::vector<char>& buffer = exported->buffer;
+                const std::filesystem::path& bufferPath = exported->bufferPath;
+                nlohmann::json& primitive = gltf["meshes"][0]["primitives"][0];
+
+                size_t vertexCount = 0;
+                unsigned positionType = 0;
+                const char* const positionData = exported->readAccessor(primitive["attributes"].value("POSITION", 0u), vertexCount, positionType);
+
+                eastl::vector<uint32_t> indices = exported->readIndices(primitive.value("indices", 0u));
+                if (indices.empty() || !positionData || positionType != GltfComponentFloat)
+                {
+                    return NauMakeError("The mesh has no indexed positions");
+                }
+
+                // The exported vertices can be duplicated: the lods are built of the first vertex of the equal ones,
+                // so the vertices of the equal positions are the attribute seams the simplification keeps.
+                eastl::vector<MeshVertexStream> streams;
+                for (const auto& [attributeName, accessorIndex] : primitive["attributes"].items())
+                {
+                    size_t count = 0;
+                    unsigned componentType = 0;
+                    const char* const data = exported->readAccessor(accessorIndex.get<unsigned>(), count, componentType);
+                    const nlohmann::json& accessor = gltf["accessors"][accessorIndex.get<unsigned>()];
+                    const std::string type = accessor.value("type", "SCALAR");
+
+                    const size_t componentsCount = type == "VEC2" ? 2 : type == "VEC3" ? 3 : type == "VEC4" ? 4 : 1;
+                    const size_t componentSize = componentType == GltfComponentUint8 ? 1 : componentType == GltfComponentUint16 ? 2 : 4;
+                    if (data && count == vertexCount)
+                    {
+                        streams.push_back({data, componentsCount * componentSize, 0});
+                    }
+                }
+
+                eastl::vector<uint32_t> remap(vertexCount);
+                const size_t uniqueCount = generateVertexRemap(remap, indices, vertexCount, streams);
+
+                eastl::vector<uint32_t> firstVertices(uniqueCount, ~0u);
+                for (uint32_t v = 0; v < vertexCount; ++v)
+                {
+                    if (remap[v] != ~0u && firstVertices[remap[v]] == ~0u)
+                    {
+                        firstVertices[remap[v]] = v;
+                    }
+                }
+
+                for (uint32_t& index : indices)
+                {
+                    index = firstVertices[remap[index]];
+                }
+
+                const MeshVertexStream positions{positionData, sizeof(float) * 3, 0};
+                const eastl::vector<MeshLod> lods = generateMeshLods(indices, vertexCount, positions, {});
+                if (lods.empty())
+                {
+                    return size_t{0};
+                }
+
+                // The runtime reads the lod indices as 16 bit ones (as the lod 0 indices)
+                const bool isUint16 = vertexCount <= std::numeric_limits<uint16_t>::max();
+                nlohmann::json primitiveLods = nlohmann::json::array();
+
+                for (const MeshLod& lod : lods)
+                {
+                    buffer.resize((buffer.size() + 3) & ~size_t{3});
+                    const size_t byteOffset = buffer.size();
+
+                    for (const uint32_t index : lod.indices)
+                    {
+                        if (isUint16)
+                        {
+                            const uint16_t index16 = static_cast<uint16_t>(index);
+                            buffer.insert(buffer.end(), reinterpret_cast<const char*>(&index16), reinterpret_cast<const char*>(&index16) + sizeof(index16));
+                        }
+                        else
+                        {
+                            buffer.insert(buffer.end(), reinterpret_cast<const char*>(&index), reinterpret_cast<const char*>(&index) + sizeof(index));
+                        }
+                    }
+
+                    gltf["bufferViews"].push_back({
+                        {    "buffer",                          0},
+                        {"byteOffset",                 byteOffset},
+                        {"byteLength", buffer.size() - byteOffset},
+                        {    "target",   ElementArrayBufferTarget}
+                    });
+
+                    gltf["accessors"].push_back({
+                        {   "bufferView",                       gltf["bufferViews"].size() - 1},
+                        {"componentType", isUint16 ? GltfComponentUint16 : GltfComponentUint32},
+                        {        "count",                                   lod.indices.size()},
+                        {         "type",                                             "SCALAR"}
+                    });
+
+                    primitiveLods.push_back({
+                        {   "indices", gltf["accessors"].size() - 1},
+                        {"screenSize",               lod.screenSize}
+                    });
+                }
+
+                gltf["buffers"][0]["byteLength"] = buffer.size();
+                primitive["extras"]["lods"] = std::move(primitiveLods);
+
+                std::ofstream bufferFile(bufferPath, std::ios::binary | std::ios::trunc);
+                bufferFile.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+
+                std::ofstream gltfFile(gltfPath, std::ios::trunc);
+                gltfFile << gltf.dump();
+
+                if (!bufferFile || !gltfFile)
+                {
+                    return NauMakeError("Failed to write the mesh lods into {}", gltfPath.string());
+                }
+
+                return lods.size();
+            }
+
+            // Converts the exported mesh primitive (with its lods) into the native mesh (see NativeMeshView):
+            // the vertex streams are written in the formats the runtime meshes upload, the indices - in the 16 bit format when the vertices fit.
+            nau::Result<> cookNativeMesh(const std::filesystem::path& gltfPath, const std::filesystem::path& nativeMeshPath)
+            {
+                nau::Result<ExportedGltf> exported = loadExportedGltf(gltfPath);
+                NauCheckResult(exported);
+
+                const nlohmann::json& gltf = exported->gltf;
+                const nlohmann::json& primitive = gltf["meshes"][0]["primitives"][0];
+
+                size_t vertexCount = 0;
+                unsigned positionType = 0;
+                const char* const positionData = exported->readAccessor(primitive["attributes"].value("POSITION", 0u), vertexCount, positionType);
+
+                const eastl::vector<uint32_t> indices = exported->readIndices(primitive.value("indices", 0u));
+                if (indices.empty() || !positionData || positionType != GltfComponentFloat)
+                {
+                    return NauMakeError("The mesh has no indexed positions");
+                }
+
+                const bool isUint16 = vertexCount <= std::numeric_limits<uint16_t>::max();
+                const auto writeIndices = [isUint16](const eastl::vector<uint32_t>& indices)
+                {
+                    eastl::vector<std::byte> data(indices.size() * (isUint16 ? sizeof(uint16_t) : sizeof(uint32_t)));
+                    for (size_t i = 0; i < indices.size(); ++i)
+                    {
+                        if (isUint16)
+                        {
+                            reinterpret_cast<uint16_t*>(data.data())[i] = static_cast<uint16_t>(indices[i]);
+                        }
+                        else
+                        {
+                            reinterpret_cast<uint32_t*>(data.data())[i] = indices[i];
+                        }
+                    }
+
+                    return data;
+                };
+
+                NativeMeshData mesh;
+                mesh.description.vertexCount = static_cast<unsigned>(vertexCount);
+                mesh.description.indexCount = static_cast<unsigned>(indices.size());
+                mesh.description.indexFormat = isUint16 ? ElementFormat::Uint16 : ElementFormat::Uint32;
+                mesh.indices = writeIndices(indices);
+
+                math::vec3 boundsMin{FLT_MAX, FLT_MAX, FLT_MAX};
+                math::vec3 boundsMax{-FLT_MAX, -FLT_MAX, -FLT_MAX};
+                for (size_t i = 0; i < vertexCount; ++i)
+                {
+                    const float* const position = reinterpret_cast<const float*>(positionData) + i * 3;
+                    const math::vec3 point{position[0], position[1], position[2]};
+                    boundsMin = math::minPerElem(boundsMin, point);
+                    boundsMax = math::maxPerElem(boundsMax, point);
+                }
+
+                mesh.bounds = math::BBox3{boundsMin, boundsMax};
+
+                for (const auto& [attributeName, accessorIndex] : primitive["attributes"].items())
+                {
+                    const nlohmann::json& accessor = gltf["accessors"][accessorIndex.get<unsigned>()];
+                    if (gltf["bufferViews"][accessor.value("bufferView", 0u)].value("byteStride", 0u) != 0)
+                    {
+                        return NauMakeError("The interleaved attribute {} is not supported", attributeName);
+                    }
+
+                    size_t count = 0;
+                    unsigned componentType = 0;
+                    const char* const data = exported->readAccessor(accessorIndex.get<unsigned>(), count, componentType);
+                    if (!data || count != vertexCount)
+                    {
+                        return NauMakeError("Invalid attribute {}", attributeName);
+                    }
+
+                    const std::string type = accessor.value("type", "SCALAR");
+                    const size_t componentsCount = type == "VEC2" ? 2 : type == "VEC3" ? 3 : type == "VEC4" ? 4 : 1;
+
+                    NativeMeshData::Attribute& attribute = mesh.attributes.emplace_back();
+                    const size_t separatorPos = attributeName.find('_');
+                    attribute.description.semantic = attributeName.substr(0, separatorPos);
+                    attribute.description.semanticIndex = separatorPos == std::string::npos ? 0 : static_cast<unsigned>(std::stoul(attributeName.substr(separatorPos + 1)));
+                    attribute.description.attributeType = componentsCount == 2 ? AttributeType::Vec2 : componentsCount == 3 ? AttributeType::Vec3 :
+                                                          componentsCount == 4 ? AttributeType::Vec4 : AttributeType::Scalar;
+
+                    const size_t componentsTotal = count * componentsCount;
+                    if (componentType == GltfComponentFloat || componentType == GltfComponentUint32)
+                    {
+                        attribute.description.elementFormat = componentType == GltfComponentFloat ? ElementFormat::Float : ElementFormat::Uint32;
+                        attribute.data.resize(componentsTotal * sizeof(uint32_t));
+                        memcpy(attribute.data.data(), data, attribute.data.size());
+                    }
+                    else if (componentType == GltfComponentUint8 || componentType == GltfComponentUint16)
+                    {
+                        // The joint indices (and the other integer streams) are read by the runtime as 32 bit ones.
+                        attribute.description.elementFormat = ElementFormat::Uint32;
+                        attribute.data.resize(componentsTotal * sizeof(uint32_t));
+
+                        uint32_t* const output = reinterpret_cast<uint32_t*>(attribute.data.data());
+                        for (size_t i = 0; i < componentsTotal; ++i)
+                        {
+                            output[i] = componentType == GltfComponentUint8 ? static_cast<uint8_t>(data[i]) : reinterpret_cast<const uint16_t*>(data)[i];
+                        }
+                    }
+                    else
+                    {
+                        return NauMakeError("Unsupported component type of attribute {}", attributeName);
+                    }
+                }
+
+                if (primitive.contains("extras") && primitive["extras"].contains("lods"))
+                {
+                    for (const nlohmann::json& primitiveLod : primitive["extras"]["lods"])
+                    {
+                        NativeMeshData::Lod& lod = mesh.lods.emplace_back();
+                        const eastl::vector<uint32_t> lodIndices = exported->readIndices(primitiveLod.value("indices", 0u));
+                        lod.description.indexCount = static_cast<unsigned>(lodIndices.size());
+                        lod.description.screenSize = primitiveLod.value("screenSize", 0.f);
+                        lod.indices = writeIndices(lodIndices);
+                    }
+                }
+
+                const eastl::vector<std::byte> nativeMesh = writeNativeMesh(mesh);
+
+                std::ofstream nativeMeshFile(nativeMeshPath, std::ios::binary | std::ios::trunc);
+                nativeMeshFile.write(reinterpret_cast<const char*>(nativeMesh.data()), static_cast<std::streamsize>(nativeMesh.size()));
+                if (!nativeMeshFile)
+                {
+                    return NauMakeError("Failed to write the native mesh {}", nativeMeshPath.string());
+                }
+
+                return nau::ResultSuccess;
             }
 
         } // namespace
@@ -35,7 +447,6 @@ namespace nau
         nau::Result<AssetMetaInfo> UsdMeshAssetCompiler::compile(PXR_NS::UsdStageRefPtr stage, const std::string& outputPath, const std::string& projectRootPath, const nau::UsdMetaInfo& metaInfo, int folderIndex)
         {
             FileSystem fs;
-            AssetDatabaseManager& dbManager = AssetDatabaseManager::instance();
 
             auto extraInfo = reinterpret_cast<ExtraInfoMesh*>(metaInfo.extraInfo.get());
 
@@ -56,14 +467,9 @@ namespace nau
             }
 
             auto relativePath = FileSystemExtensions::getRelativeAssetPath(metaInfo.assetPath, true).string();
-            const auto dbMeta = dbManager.get(metaInfo.uid);
+            // The up to date assets are not passed to the compiler (see AssetCookGraph)
             const std::string sourcePath = std::format("{}+[{}]", relativePath.c_str(), primToCompile.GetName().GetString());
 
-            if (!dbMeta.isError() && dbManager.compiled(metaInfo.uid) && !isDirty(metaInfo.assetPath, dbMeta->lastModified))
-            {
-                return NauMakeError("Skipping compilation, asset's {} prim {} is not dirty!", metaInfo.assetPath, primToCompile.GetName().GetString());
-            }
-
             const std::filesystem::path basePath = std::filesystem::path(outputPath) / std::to_string(folderIndex);
             std::string output = (basePath / toString(metaInfo.uid)).string() + ".gltf";
 
@@ -99,6 +505,39 @@ namespace nau
 
             LOG_INFO("Saved model {}", output);
 
+            if (extraInfo->generateLods)
+            {
+                if (auto lodsResult = cookMeshLods(output); !lodsResult)
+                {
+                    LOG_WARN("Lods of model {} are not generated: {}", output, lodsResult.getError()->getMessage());
+                }
+                else
+                {
+                    LOG_INFO("Generated {} lods of model {}", *lodsResult, output);
+                }
+            }
+
+            // The runtime loads the native mesh: the gltf is the intermediate file then. It is kept if the mesh can not be converted.
+            const std::filesystem::path nativeMeshPath = std::filesystem::path(output).replace_extension(ext());
+            if (auto nativeMeshResult = cookNativeMesh(output, nativeMeshPath); !nativeMeshResult)
+            {
+                LOG_WARN("Model {} is not converted to the native mesh: {}", output, nativeMeshResult.getError()->getMessage());
+            }
+            else
+            {
+                const std::filesystem::path bufferPath = std::filesystem::path(output).replace_extension(".bin");
+                std::filesystem::remove(output);
+                std::filesystem::remove(bufferPath);
+
+                composedMeshMeta.dbPath = (std::filesystem::path(std::to_string(folderIndex)) / nativeMeshPath.filename()).string().c_str();
+                LOG_INFO("Saved native mesh {}", nativeMeshPath.string());
+            }
+
+            if (auto cookResult = cookCollisionShapes(PXR_NS::UsdGeomMesh{primToCompile}, basePath, folderIndex, composedMeshMeta); !cookResult)
+            {
+                LOG_WARN("Collision of model {} is not cooked: {}", output, cookResult.getError()->getMessage());
+            }
+
             return composedMeshMeta;
         }
     }  // namespace compilers
@@ -69,12 +69,16 @@ namespace nau
 
     bool AssetDatabaseManager::save()
     {
+        const std::lock_guard lock(m_mutex);
+
         eastl::u8string serializedResult = serialization::JsonUtils::stringify(m_cache);
         return m_fs.writeFile(m_dbFile, reinterpret_cast<const char*>(serializedResult.data()), serializedResult.length());
     }
 
     bool AssetDatabaseManager::addOrReplace(const AssetMetaInfo& metaInfo)
     {
+        const std::lock_guard lock(m_mutex);
+
         std::vector<AssetMetaInfo>& db = assets();
 
         auto it = std::find_if(db.begin(), db.end(), [&](const AssetMetaInfo& info)
@@ -96,6 +100,8 @@ namespace nau
 
     int AssetDatabaseManager::update(std::vector<AssetMetaInfo>& list)
     {
+        const std::lock_guard lock(m_mutex);
+
         int count = 0;
 
         FileSystem fs;
@@ -157,6 +163,8 @@ namespace nau
 
     bool AssetDatabaseManager::exist(const Uid& uid)
     {
+        const std::lock_guard lock(m_mutex);
+
         std::vector<AssetMetaInfo>& db = assets();
         return std::find_if(db.begin(), db.end(), [&](const AssetMetaInfo& info)
         {
@@ -166,6 +174,8 @@ namespace nau
 
     bool AssetDatabaseManager::compiled(const Uid& uid)
     {
+        const std::lock_guard lock(m_mutex);
+
         FileSystem fs;
         nau::Result<AssetMetaInfo> metaInfo = get(uid);
         if (metaInfo.isError())
@@ -178,6 +188,8 @@ namespace nau
 
     bool AssetDatabaseManager::compiled(const std::string_view& sourcePath)
     {
+        const std::lock_guard lock(m_mutex);
+
         std::vector<AssetMetaInfo>& db = assets();
 
         const eastl::string path = sourcePath.data();
@@ -197,6 +209,8 @@ namespace nau
 
     nau::Result<Uid> AssetDatabaseManager::findIf(const std::string_view& sourcePath)
     {
+        const std::lock_guard lock(m_mutex);
+
         std::vector<AssetMetaInfo>& db = assets();
 
         const eastl::string path = sourcePath.data();
@@ -216,6 +230,8 @@ namespace nau
 
     nau::Result<int> AssetDatabaseManager::getDbFolderIndex(const Uid& uid)
     {
+        const std::lock_guard lock(m_mutex);
+
         auto info = get(uid);
 
         if (info.isError())
@@ -229,6 +245,8 @@ namespace nau
 
     nau::Result<AssetMetaInfo> AssetDatabaseManager::get(const Uid& uid)
     {
+        const std::lock_guard lock(m_mutex);
+
         std::vector<AssetMetaInfo>& db = assets();
 
         const auto it = std::find_if(db.begin(), db.end(), [&](const AssetMetaInfo& info)
@@ -20,7 +20,9 @@
 #include <nau/shared/util.h>
 
 #include <format>
+#include <fstream>
 
+#include "lua_toolkit/lua_utils.h"
 #include "nau/app/application.h"
 #include "nau/app/application_services.h"
 #include "nau/app/platform_window.h"
@@ -30,13 +32,16 @@
 #include "nau/asset_tools/asset_manager.h"
 #include "nau/asset_tools/db_manager.h"
 #include "nau/build_tool/interface/build_tool.h"
+#include "nau/dataBlock/ro_data_block_value.h"
 #include "nau/io/memory_stream.h"
 #include "nau/io/virtual_file_system.h"
+#include "nau/serialization/json.h"
 #include "nau/serialization/json_utils.h"
 #include "nau/serialization/serialization.h"
 #include "nau/shared/file_system.h"
 #include "nau/shared/logger.h"
 #include "nau/shared/platform/win/utils.h"
+#include "nau/utils/scope_guard.h"
 
 namespace nau
 {
@@ -91,6 +96,30 @@ namespace nau
         }
     }
 
+    // The json config is cooked to the binary read-only data block (see RoDataBlock::saveDump()) read by the game without parsing.
+    bool cookConfigFile(const std::filesystem::path& source, const std::filesystem::path& destination)
+    {
+        io::IStreamReader::Ptr sourceStream = io::createNativeFileStream(source.string().c_str(), io::AccessMode::Read, io::OpenFileMode::OpenExisting);
+        if (!sourceStream)
+        {
+            return false;
+        }
+
+        Result<RuntimeValue::Ptr> config = serialization::jsonParse(*sourceStream);
+        if (!config || !(*config)->is<RuntimeReadonlyDictionary>())
+        {
+            return false;
+        }
+
+        io::IStreamWriter::Ptr destinationStream = io::createNativeFileStream(destination.string().c_str(), io::AccessMode::Write, io::OpenFileMode::CreateAlways);
+        if (!destinationStream)
+        {
+            return false;
+        }
+
+        return static_cast<bool>(saveRoDataBlock(*(*config)->as<const RuntimeReadonlyDictionary*>(), *destinationStream));
+    }
+
     void configureVirtualFileSystem(io::IVirtualFileSystem& vfs, const BuildConfig& config)
     {
         auto contentFs = io::createNativeFileSystem(config.projectPath);
@@ -269,6 +298,19 @@ namespace nau
             {
                 for (const auto& entry : std::filesystem::directory_iterator(sourceConfigPath))
                 {
+                    if (entry.path().extension() == ".json")
+                    {
+                        const std::filesystem::path cookedPath = (configPath / entry.path().filename()).replace_extension(".roblk");
+                        if (cookConfigFile(entry.path(), cookedPath))
+                        {
+                            LOG_INFO("Cooked config file {}", cookedPath.filename().string());
+                            continue;
+                        }
+
+                        std::filesystem::remove(cookedPath);
+                        LOG_WARN("Could not cook config file {}, copying it as is", entry.path().filename().string());
+                    }
+
                     LOG_INFO("Copying config file {}", entry.path().filename().string());
                     std::filesystem::copy_file(entry.path(), configPath / entry.path().filename(), std::filesystem::copy_options::overwrite_existing);
                 }
@@ -428,6 +470,64 @@ namespace nau
         return BuildResult::Success;
     }
 
+    namespace
+    {
+        // Compiles the project scripts (content/**/*.lua) to the stripped bytecode and adds them to the package under the same paths:
+        // the script manager loads the binary chunks from the mounted packages, so the scripts are not parsed at the game startup.
+        bool addCompiledScripts(const std::filesystem::path& projectPath, eastl::vector<PackInputFileData>& packData)
+        {
+            const std::filesystem::path contentPath = projectPath / getAssetsSubfolderDefaultName();
+
+            std::error_code err;
+            if (!std::filesystem::is_directory(contentPath, err))
+            {
+                return true;
+            }
+
+            lua_State* const luaState = luaL_newstate();
+            NAU_ASSERT(luaState);
+            scope_on_leave
+            {
+                lua_close(luaState);
+            };
+
+            bool result = true;
+
+            for (const auto& entry : std::filesystem::recursive_directory_iterator(contentPath, err))
+            {
+                if (!entry.is_regular_file() || entry.path().extension() != ".lua")
+                {
+                    continue;
+                }
+
+                std::ifstream sourceFile(entry.path(), std::ios::binary);
+                const std::string source{std::istreambuf_iterator<char>(sourceFile), std::istreambuf_iterator<char>()};
+
+                const std::string filePathInPack = std::filesystem::relative(entry.path(), projectPath).generic_string();
+
+                // The stripped chunk has no debug information: the chunk name is not stored
+                Result<eastl::vector<std::byte>> bytecode = lua::compileBuffer(luaState, source, filePathInPack.c_str(), true);
+                if (!bytecode)
+                {
+                    LOG_ERROR("Could not compile script {}: {}", entry.path().string(), bytecode.getError()->getMessage().c_str());
+                    result = false;
+                    continue;
+                }
+
+                LOG_INFO("Adding compiled script {} to package", filePathInPack);
+
+                PackInputFileData& data = packData.emplace_back();
+                data.filePathInPack = filePathInPack.c_str();
+                data.stream = [bytecode = eastl::make_shared<eastl::vector<std::byte>>(std::move(*bytecode))]()
+                {
+                    return io::createReadonlyMemoryStream(eastl::span<const std::byte>{bytecode->data(), bytecode->size()});
+                };
+            }
+
+            return result;
+        }
+    }  // namespace
+
     BuildResult BuildTool::createPackage()
     {
         FileSystem fs;
@@ -435,6 +535,27 @@ namespace nau
         options.contentType = "application/json";
         options.description = "Assets package";
         options.version = "0.1";
+        options.compression = io::AssetPackCompression::Zstd;
+
+        // The recorded load trace (the package paths in the order of loading, one per line) lays the blobs out for the sequential reads.
+        const std::filesystem::path loadTracePath = std::filesystem::path(m_buildConfig->projectPath) / "assets_load_trace.txt";
+        if (std::ifstream loadTrace(loadTracePath); loadTrace)
+        {
+            for (std::string filePath; std::getline(loadTrace, filePath);)
+            {
+                if (!filePath.empty() && filePath.back() == '\r')
+                {
+                    filePath.pop_back();
+                }
+
+                if (!filePath.empty())
+                {
+                    options.loadOrder.emplace_back(filePath.c_str());
+                }
+            }
+
+            LOG_INFO("Using load trace {} ({} entries)", loadTracePath.string(), options.loadOrder.size());
+        }
 
         LOG_INFO("Creating package... {}", m_buildConfig->targetDestination);
 
@@ -541,6 +662,12 @@ namespace nau
             }
         }
 
+        if (!addCompiledScripts(m_buildConfig->projectPath, packData))
+        {
+            LOG_ERROR("Could not compile project scripts!");
+            return BuildResult::Failed;
+        }
+
         NAU_ASSERT(assets.size() > 0, "Asset database is empty, something is wrong!");
 
         const std::filesystem::path packDest = assetsPackPath / "content.assets";
@@ -3,6 +3,7 @@
 
 
 #include <fstream>
+#include <iterator>
 
 #include "nau/serialization/json_utils.h"
 #include "nau/serialization/serialization.h"
@@ -21,6 +22,7 @@ struct Arguments
 {
     fs::path material;
     fs::path shaderCache;
+    fs::path cookSource;
     eastl::vector<Pipeline> pipelines;
 };
 
@@ -33,10 +35,15 @@ constexpr auto ShaderCacheFullKey = "-cache";
 constexpr auto PipelineKey = "-p";
 constexpr auto PipelineFullKey = "--pipeline";
 
+constexpr auto CookKey = "-k";
+constexpr auto CookFullKey = "--cook";
+
 constexpr auto Extension = ".nsbc";
+constexpr auto NativeMaterialExtension = ".nmat";
 
 nau::Result<Arguments> parseArguments(int argc, char* argv[]);
 void printUsage(std::string_view appName);
+int writeNativeMaterialFile(const nau::Material& material, nau::ShaderPack& pack, const fs::path& path);
 
 int main(int argc, char** argv)
 {
@@ -53,6 +60,28 @@ int main(int argc, char** argv)
     io::IStreamBase::Ptr stream = io::createNativeFileStream(args->shaderCache.string().c_str(), io::AccessMode::Read, io::OpenFileMode::OpenExisting);
     ShaderPack pack(stream);
 
+    if (!args->cookSource.empty())
+    {
+        std::ifstream sourceFile(args->cookSource.string().c_str());
+        if (!sourceFile)
+        {
+            std::cerr << "Cannot read material file: " << args->cookSource.string();
+            return EXIT_FAILURE;
+        }
+
+        const std::string json{std::istreambuf_iterator<char>{sourceFile}, std::istreambuf_iterator<char>{}};
+
+        auto source = serialization::JsonUtils::parse<Material>(eastl::u8string_view{reinterpret_cast<const char8_t*>(json.data()), json.size()});
+        if (source.isError())
+        {
+            std::cerr << strings::toStringView(source.getError()->getMessage()) << '\n';
+            return EXIT_FAILURE;
+        }
+
+        const fs::path nativeMaterial = args->material.empty() ? fs::path{args->cookSource}.replace_extension(NativeMaterialExtension) : args->material;
+        return writeNativeMaterialFile(*source, pack, nativeMaterial);
+    }
+
     MaterialCreator creator;
     auto result = creator.createMaterial(args->material.stem().string().c_str());
     if (result.isError())
@@ -102,6 +131,31 @@ int main(int argc, char** argv)
 
     std::cout << std::format("Material successfully created: {}\n", args->material.string());
 
+    // The cooked material is loaded at runtime without the json parsing, it must be recooked (see --cook) after the json is edited.
+    return writeNativeMaterialFile(*mat, pack, fs::path{args->material}.replace_extension(NativeMaterialExtension));
+}
+
+int writeNativeMaterialFile(const nau::Material& material, nau::ShaderPack& pack, const fs::path& path)
+{
+    using namespace nau;
+
+    auto data = MaterialCreator::cookMaterial(material, pack);
+    if (data.isError())
+    {
+        std::cerr << strings::toStringView(data.getError()->getMessage()) << '\n';
+        return EXIT_FAILURE;
+    }
+
+    std::ofstream file(path.string().c_str(), std::ios::binary);
+    file.write(reinterpret_cast<const char*>(data->data()), data->size());
+    if (!file)
+    {
+        std::cerr << "Cannot write material file: " << path.string();
+        return EXIT_FAILURE;
+    }
+
+    std::cout << std::format("Material successfully cooked: {}\n", path.string());
+
     return EXIT_SUCCESS;
 }
 
@@ -146,6 +200,17 @@ nau::Result<Arguments> parseArguments(int argc, char* argv[])
                 return NauMakeError("Missing value for {}/{}", ShaderCacheKey, ShaderCacheFullKey);
             }
         }
+        else if (arg == CookKey || arg == CookFullKey)
+        {
+            if (i + 1 < argc && argv[i + 1][0] != '-')
+            {
+                args.cookSource = argv[++i];
+            }
+            else
+            {
+                return NauMakeError("Missing value for {}/{}", CookKey, CookFullKey);
+            }
+        }
         else if (arg == "-p" || arg == "--pipeline")
         {
             if (i + 1 < argc && argv[i + 1][0] != '-')
@@ -176,14 +241,18 @@ nau::Result<Arguments> parseArguments(int argc, char* argv[])
         }
     }
 
-    if (!hasOut)
-    {
-        return NauMakeError("Missing required argument: {}/{}", OutKey, OutFullKey);
-    }
     if (!hasCache)
     {
         return NauMakeError("Missing required argument: {}/{}", ShaderCacheKey, ShaderCacheFullKey);
     }
+    if (!args.cookSource.empty())
+    {
+        return args;
+    }
+    if (!hasOut)
+    {
+        return NauMakeError("Missing required argument: {}/{}", OutKey, OutFullKey);
+    }
     if (args.pipelines.empty())
     {
         return NauMakeError("At least one pipeline must be specified with {}/{}", PipelineKey, PipelineFullKey);
@@ -200,10 +269,12 @@ void printUsage(std::string_view appName)
         "Usage: {} -o <material_file> -c <shader_cache_path> -p <pipeline_name> <shader1> <shader2> ... [-p <pipeline_name> <shader1> <shader2> ...]\n",
         fullName.filename().string()
         );
+    std::cout << std::format("       {} -c <shader_cache_path> -k <material_file> [-o <native_material_file>]\n", fullName.filename().string());
 
     std::cout << "\nOptions:\n";
     std::cout << "  -h, --help             Display this help message and exit.\n";
     std::cout << "  -o, --out              Material file to be created (required).\n";
     std::cout << "  -c, --cache            Path to the shader cache (required).\n";
     std::cout << "  -p, --pipeline         Specify a pipeline name followed by a list of shader names (required, can be repeated).\n";
+    std::cout << "  -k, --cook             Cook the edited material file into the native material (.nmat).\n";
 }
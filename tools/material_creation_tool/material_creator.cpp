@@ -4,6 +4,8 @@
 
 #include "material_creator.h"
 
+#include "graphics_assets/material_asset.h"
+#include "nau/assets/native_material.h"
 #include "nau/serialization/runtime_value_builder.h"
 
 namespace nau
@@ -81,6 +83,33 @@ namespace nau
             : NauMakeError("Material not created");
     }
 
+    Result<eastl::vector<std::byte>> MaterialCreator::cookMaterial(Material material, ShaderPack& pack)
+    {
+        for (auto& [name, pipeline] : material.pipelines)
+        {
+            // The shader paths are "<shader cache>+[<shader name>]", see addPipeline().
+            eastl::vector<eastl::string> shaderNames;
+            for (const eastl::string& shaderPath : pipeline.shaders)
+            {
+                const size_t nameStart = shaderPath.rfind("+[");
+                if (nameStart == eastl::string::npos || shaderPath.back() != ']')
+                {
+                    return NauMakeError("Unsupported shader path ({}) in the pipeline ({})", shaderPath, name);
+                }
+
+                shaderNames.emplace_back(shaderPath.substr(nameStart + 2, shaderPath.size() - nameStart - 3));
+            }
+
+            auto shaders = pack.getShaders(shaderNames);
+            NauCheckResult(shaders);
+
+            auto result = MaterialAssetView::cookConstantBuffers(pipeline, *shaders);
+            NauCheckResult(result);
+        }
+
+        return writeNativeMaterial(material);
+    }
+
     void MaterialCreator::clear()
     {
         m_material.reset();
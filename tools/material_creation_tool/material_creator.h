@@ -8,6 +8,8 @@
 
 #include "nau/assets/material.h"
 
+#include "shader_pack.h"
+
 namespace nau
 {
     class MaterialCreator final
@@ -18,6 +20,12 @@ namespace nau
 
         Result<Material> getResult() const;
 
+        /**
+         * Cooks the master material into the native material (see native_material.h): the constant buffers are laid out
+         * by the reflection of the pipeline shaders, taken from the pack by the shader names of the material shader paths.
+         */
+        static Result<eastl::vector<std::byte>> cookMaterial(Material material, ShaderPack& pack);
+
         void clear();
 
     private:
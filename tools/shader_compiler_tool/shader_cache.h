@@ -29,6 +29,8 @@ namespace nau
             std::vector<fs::path> includeDirs;
             std::optional<fs::path> debugOutputDir;
             bool embedDebugInfo;
+            std::optional<fs::path> compileCacheDir; /** < The dxc outputs cache (see ShaderCompileCache), the unchanged shaders are not recompiled. */
+            std::optional<size_t> jobsCount; /** < The number of the parallel compilations, by default all the cores are used. */
         };
 
 
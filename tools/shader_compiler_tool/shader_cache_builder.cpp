@@ -3,7 +3,14 @@
 
 #include "shader_cache_builder.h"
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <format>
 #include <fstream>
+#include <iostream>
+#include <mutex>
+#include <thread>
 
 #include <windows.h>
 
@@ -13,6 +20,8 @@
 #include "nau/memory/bytes_buffer.h"
 #include "nau/platform/windows/utils/uid.h"
 #include "nau/serialization/runtime_value_builder.h"
+#include "nau/string/string_conv.h"
+#include "nau/utils/scope_guard.h"
 
 namespace nau
 {
@@ -125,6 +134,26 @@ namespace nau
 
             return ResultSuccess;
         }
+
+        std::string makeShaderName(const fs::path& filename, std::string_view permutationName, ShaderTarget stage, std::string_view entry)
+        {
+            std::string shaderName = filename.stem().string();
+            shaderName += ".";
+
+            if (permutationName != "regular")
+            {
+                shaderName += permutationName;
+                shaderName += ".";
+            }
+
+            std::string ep{entry};
+            std::ranges::transform(ep, ep.begin(), [](unsigned char c) { return std::tolower(c); });
+
+            shaderName += Targets[static_cast<size_t>(stage)];
+            shaderName += "." + ep;
+
+            return shaderName;
+        }
     } // anonymous namespace
 
     Result<> ShaderCacheBuilder::makeCache(StreamFactory streamFactory, const Arguments& args)
@@ -135,13 +164,17 @@ namespace nau
             return NauMakeError(shaderInfos.getError()->getMessage());
         }
 
-        auto result = compileShaders(*shaderInfos, args);
-        NauCheckResult(result);
+        std::vector<Shader> shaders;
+        NauCheckResult(compileShaders(*shaderInfos, args, [&shaders](Shader&& shader) -> Result<>
+        {
+            shaders.emplace_back(std::move(shader));
+            return ResultSuccess;
+        }));
 
         io::IStreamWriter::Ptr outStream = streamFactory(args.shaderCacheName);
         NAU_FATAL(outStream);
 
-        return writeShadersPack(outStream, *std::move(result));
+        return writeShadersPack(outStream, std::move(shaders));
     }
 
     Result<> ShaderCacheBuilder::makeCacheFiles(StreamFactory streamFactory, const Arguments& args)
@@ -152,24 +185,17 @@ namespace nau
             return NauMakeError(shaderInfos.getError()->getMessage());
         }
 
-        auto result = compileShaders(*shaderInfos, args);
-        NauCheckResult(result);
-
-        std::vector<Shader> shaders;
-
-        for (Shader& shader : *result)
+        // Each shader file is written as soon as the shader is compiled (or taken from the compile cache)
+        return compileShaders(*shaderInfos, args, [&streamFactory](Shader&& shader) -> Result<>
         {
-            const std::string_view shaderName{shader.name.data(), shader.name.size()};
+            const std::string shaderName{shader.name.data(), shader.name.size()};
             io::IStreamWriter::Ptr outStream = streamFactory(shaderName);
             NAU_FATAL(outStream);
 
+            std::vector<Shader> shaders;
             shaders.emplace_back(std::move(shader));
-            NauCheckResult(writeShadersPack(outStream, std::move(shaders)));
-
-            shaders.clear();
-        }
-
-        return {};
+            return writeShadersPack(outStream, std::move(shaders));
+        });
     }
 
     Result<std::vector<ShaderCacheBuilder::ShaderInfo>> ShaderCacheBuilder::collectShaderInfo(const fs::path& shadersPath, const fs::path& metafilesPath)
@@ -231,7 +257,7 @@ namespace nau
         return files;
     }
 
-    Result<std::vector<Shader>> ShaderCacheBuilder::compileShaders(const std::vector<ShaderInfo>& shaderInfos, const Arguments& args)
+    Result<> ShaderCacheBuilder::compileShaders(const std::vector<ShaderInfo>& shaderInfos, const Arguments& args, ShaderCallback onShaderCompiled)
     {
         std::vector<std::wstring> includes;
         includes.reserve(args.includeDirs.size());
@@ -241,77 +267,188 @@ namespace nau
             includes.emplace_back(dir.c_str());
         }
 
-        std::vector<Shader> shaders;
-
-        ShaderCompiler compiler;
+        std::vector<ShaderMeta> metas;
+        metas.reserve(shaderInfos.size());
 
         for (const auto& [shader, metafile] : shaderInfos)
         {
             auto meta = getShaderMeta(metafile);
             NauCheckResult(meta);
 
-            auto result = compileShader(&compiler, shader, *meta, includes, args.debugOutputDir, args.embedDebugInfo);
-            NauCheckResult(result);
-
-            shaders.reserve(shaders.size() + result->size());
-            std::move(result->begin(), result->end(), std::back_inserter(shaders));
+            metas.emplace_back(*std::move(meta));
         }
 
-        return shaders;
-    }
+        std::vector<CompileJob> jobs;
 
-    Result<std::vector<Shader>> ShaderCacheBuilder::compileShader(
-        ShaderCompiler* compiler,
-        const fs::path& filename,
-        const ShaderMeta& meta,
-        const std::vector<std::wstring>& includeDirs,
-        const std::optional<fs::path>& pdbDir,
-        bool needEmbedDebug)
-    {
-        compiler->reset();
+        for (size_t i = 0; i < shaderInfos.size(); ++i)
+        {
+            const ShaderMeta& meta = metas[i];
+            for (const auto& config : meta.configs)
+            {
+                for (const auto& permutation : meta.permutations)
+                {
+                    jobs.emplace_back(CompileJob{
+                        &shaderInfos[i].srcFile,
+                        &meta,
+                        &config,
+                        &permutation,
+                        makeShaderName(shaderInfos[i].srcFile, permutation.name, config.stage, config.entry)});
+                }
+            }
+        }
 
-        auto result = compiler->loadFile(filename);
-        if (result.isError())
+        if (jobs.empty())
         {
-            return NauMakeError(result.getError()->getMessage());
+            return ResultSuccess;
         }
 
-        std::vector<Shader> shaders;
+        // The PDB files are the side effect of the compilation: the cache is not used when they are requested
+        std::optional<ShaderCompileCache> cache;
+        if (args.compileCacheDir.has_value() && !args.debugOutputDir.has_value())
+        {
+            auto compilerVersion = ShaderCompiler::getCompilerVersion();
+            NauCheckResult(compilerVersion);
+
+            cache.emplace(*args.compileCacheDir, *std::move(compilerVersion));
+        }
+
+        const size_t defaultJobsCount = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+        const size_t workersCount = std::clamp<size_t>(args.jobsCount.value_or(defaultJobsCount), 1, jobs.size());
 
-        for (const auto& config : meta.configs)
+        std::vector<std::optional<Result<Shader>>> results(jobs.size());
+        std::mutex resultsMutex;
+        std::condition_variable resultReady;
+        std::atomic<size_t> nextJob = 0;
+        std::atomic<size_t> cachedCount = 0;
+        std::atomic<bool> isCancelled = false;
+
+        const auto workerFunc = [&]
         {
-            for (const auto& permutation : meta.permutations)
+            // The dxc compiler instances are not shared between the threads
+            ShaderCompiler compiler;
+
+            while (!isCancelled)
             {
-                std::string shaderName = filename.stem().string();
-                shaderName += ".";
+                const size_t jobIndex = nextJob.fetch_add(1);
+                if (jobIndex >= jobs.size())
+                {
+                    break;
+                }
 
-                if (permutation.name != "regular")
+                bool isFromCache = false;
+                Result<Shader> result = compileJob(compiler, jobs[jobIndex], includes, args, cache ? &*cache : nullptr, isFromCache);
+                if (isFromCache)
                 {
-                    shaderName += permutation.name + ".";
+                    ++cachedCount;
                 }
 
-                std::string ep = config.entry;
-                std::ranges::transform(ep, ep.begin(), [](unsigned char c) { return std::tolower(c); });
+                {
+                    const std::lock_guard lock(resultsMutex);
+                    results[jobIndex].emplace(std::move(result));
+                }
+
+                resultReady.notify_all();
+            }
+        };
+
+        std::vector<std::thread> workers;
+        workers.reserve(workersCount);
+        for (size_t i = 0; i < workersCount; ++i)
+        {
+            workers.emplace_back(workerFunc);
+        }
 
-                shaderName += Targets[static_cast<size_t>(config.stage)];
-                shaderName += "." + ep;
+        scope_on_leave
+        {
+            isCancelled = true;
+            for (auto& worker : workers)
+            {
+                worker.join();
+            }
+        };
 
-                std::optional<fs::path> pdbFilename = std::nullopt;
-                if (pdbDir.has_value())
+        // The shaders are emitted in the jobs order, so the output does not depend on the workers scheduling
+        for (size_t i = 0; i < jobs.size(); ++i)
+        {
+            {
+                std::unique_lock lock(resultsMutex);
+                resultReady.wait(lock, [&results, i]
                 {
-                    const std::string pdbName = shaderName + ".pdb";
-                    pdbFilename = (*pdbDir / pdbName).string();
-                }
+                    return results[i].has_value();
+                });
+            }
+
+            Result<Shader>& result = *results[i];
+            NauCheckResult(result);
+            NauCheckResult(onShaderCompiled(*std::move(result)));
+
+            results[i].reset();
+        }
+
+        std::cout << std::format("Shaders: {} compiled, {} taken from the compile cache\n", jobs.size() - cachedCount, cachedCount.load());
+
+        return ResultSuccess;
+    }
 
-                NauCheckResult(compiler->compile(config.stage, config.entry, permutation.defines, includeDirs, pdbFilename, needEmbedDebug));
+    Result<Shader> ShaderCacheBuilder::compileJob(
+        ShaderCompiler& compiler,
+        const CompileJob& job,
+        const std::vector<std::wstring>& includeDirs,
+        const Arguments& args,
+        const ShaderCompileCache* cache,
+        bool& isFromCache)
+    {
+        const auto finalizeShader = [&job](Shader&& shader)
+        {
+            shader.name.assign(job.shaderName.data(), job.shaderName.size());
+            shader.vsd.assign(job.meta->vsd.begin(), job.meta->vsd.end());
+            return std::move(shader);
+        };
+
+        std::optional<ShaderCompileCache::Key> cacheKey;
+        if (cache)
+        {
+            auto key = cache->makeKey({*job.srcFile, job.config->entry, job.config->stage, job.permutation->defines, includeDirs, args.embedDebugInfo});
+            NauCheckResult(key);
 
-                Shader& shader = shaders.emplace_back(*compiler->getResult());
-                shader.name.assign(shaderName.data(), shaderName.size());
-                shader.vsd.assign(meta.vsd.begin(), meta.vsd.end());
+            cacheKey = *key;
+            if (std::optional<Shader> cachedShader = cache->find(*cacheKey))
+            {
+                isFromCache = true;
+                return finalizeShader(*std::move(cachedShader));
+            }
+        }
+
+        compiler.reset();
+
+        auto result = compiler.loadFile(*job.srcFile);
+        if (result.isError())
+        {
+            return NauMakeError(result.getError()->getMessage());
+        }
+
+        std::optional<fs::path> pdbFilename = std::nullopt;
+        if (args.debugOutputDir.has_value())
+        {
+            const std::string pdbName = job.shaderName + ".pdb";
+            pdbFilename = (*args.debugOutputDir / pdbName).string();
+        }
+
+        NauCheckResult(compiler.compile(job.config->stage, job.config->entry, job.permutation->defines, includeDirs, pdbFilename, args.embedDebugInfo));
+
+        auto shader = compiler.getResult();
+        NauCheckResult(shader);
+
+        if (cacheKey)
+        {
+            // The failed store only means the shader will be compiled again next time
+            if (auto storeResult = cache->store(*cacheKey, *shader, compiler.getIncludedFiles()); storeResult.isError())
+            {
+                std::cerr << "Warning: " << strings::toStringView(storeResult.getError()->getMessage()) << '\n';
             }
         }
 
-        return shaders;
+        return finalizeShader(*std::move(shader));
     }
 
     Result<ShaderCacheBuilder::ShaderMeta> ShaderCacheBuilder::getShaderMeta(const fs::path& filename)
@@ -5,6 +5,7 @@
 
 #include "nau/assets/shader_asset_accessor.h"
 #include "shader_cache.h"
+#include "shader_compile_cache.h"
 #include "shader_compiler.h"
 
 namespace fs = std::filesystem;
@@ -47,15 +48,33 @@ namespace nau
         Result<std::vector<ShaderInfo>> collectShaderInfo(const fs::path& shadersPath, const fs::path& metafilesPath);
         Result<std::vector<fs::path>> collectFiles(const fs::path& directory, std::string_view extension);
 
-        Result<std::vector<Shader>> compileShaders(const std::vector<ShaderInfo>& shaderInfos, const Arguments& args);
+        /**
+         * The single permutation compilation.
+         */
+        struct CompileJob
+        {
+            const fs::path* srcFile;
+            const ShaderMeta* meta;
+            const CompileConfig* config;
+            const ShaderPermutation* permutation;
+            std::string shaderName;
+        };
+
+        using ShaderCallback = Functor<Result<>(Shader&&)>;
+
+        /**
+         * Compiles all the permutations in parallel.
+         * The compiled shaders are passed to the callback (on the calling thread) in the stable order, as soon as they are ready.
+         */
+        Result<> compileShaders(const std::vector<ShaderInfo>& shaderInfos, const Arguments& args, ShaderCallback onShaderCompiled);
 
-        Result<std::vector<Shader>> compileShader(
-            ShaderCompiler* compiler,
-            const fs::path& filename,
-            const ShaderMeta& meta,
+        Result<Shader> compileJob(
+            ShaderCompiler& compiler,
+            const CompileJob& job,
             const std::vector<std::wstring>& includeDirs,
-            const std::optional<fs::path>& pdbDir,
-            bool needEmbedDebug);
+            const Arguments& args,
+            const ShaderCompileCache* cache,
+            bool& isFromCache);
 
         Result<ShaderMeta> getShaderMeta(const fs::path& filename);
     };
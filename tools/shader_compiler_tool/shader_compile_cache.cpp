@@ -0,0 +1,226 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#include "shader_compile_cache.h"
+
+#include <format>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#include "nau/io/file_system.h"
+#include "nau/io/nau_container.h"
+#include "nau/serialization/runtime_value_builder.h"
+#include "nau/utils/dag_hash.h"
+
+namespace nau
+{
+    namespace
+    {
+        // Must be changed with any change of the entry format or the key inputs
+        constexpr uint32_t CacheFormatVersion = 1;
+
+        constexpr auto CacheEntryKind = "nau-shader-compile-cache";
+        constexpr auto CacheEntryExtension = ".nscc";
+
+        struct IncludedFileEntry
+        {
+            eastl::string path;
+            uint64_t contentHash;
+
+            NAU_CLASS_FIELDS(
+                CLASS_FIELD(path),
+                CLASS_FIELD(contentHash)
+            )
+        };
+
+        struct CacheEntryData
+        {
+            Shader shader;
+            size_t bytecodeSize;
+            std::vector<IncludedFileEntry> includedFiles;
+
+            NAU_CLASS_FIELDS(
+                CLASS_FIELD(shader),
+                CLASS_FIELD(bytecodeSize),
+                CLASS_FIELD(includedFiles)
+            )
+        };
+
+        uint64_t hashBytes(const void* data, size_t size, uint64_t hash)
+        {
+            return mem_hash_fnv1<64>(reinterpret_cast<const char*>(data), size, hash);
+        }
+
+        uint64_t hashString(std::string_view str, uint64_t hash)
+        {
+            // the size separates the adjacent strings: ("ab", "c") and ("a", "bc") are hashed differently
+            const uint64_t size = str.size();
+            hash = hashBytes(&size, sizeof(size), hash);
+            return hashBytes(str.data(), str.size(), hash);
+        }
+
+        uint64_t hashString(std::wstring_view str, uint64_t hash)
+        {
+            const uint64_t size = str.size();
+            hash = hashBytes(&size, sizeof(size), hash);
+            return hashBytes(str.data(), str.size() * sizeof(wchar_t), hash);
+        }
+
+        std::optional<uint64_t> hashFileContent(const fs::path& path)
+        {
+            std::ifstream file(path, std::ios::binary);
+            if (!file)
+            {
+                return std::nullopt;
+            }
+
+            std::stringstream buffer;
+            buffer << file.rdbuf();
+
+            return hashString(buffer.view(), FNV1Params<64>::offset_basis);
+        }
+    }  // namespace
+
+    ShaderCompileCache::ShaderCompileCache(fs::path cacheDir, std::string compilerVersion) :
+        m_cacheDir(std::move(cacheDir)),
+        m_compilerVersion(std::move(compilerVersion))
+    {
+        std::error_code error;
+        fs::create_directories(m_cacheDir, error);
+    }
+
+    Result<ShaderCompileCache::Key> ShaderCompileCache::makeKey(const KeyInputs& inputs) const
+    {
+        const std::optional<uint64_t> sourceHash = hashFileContent(inputs.sourceFile);
+        if (!sourceHash)
+        {
+            return NauMakeError("Can not read the shader source: {}", inputs.sourceFile.string());
+        }
+
+        uint64_t hash = hashBytes(&CacheFormatVersion, sizeof(CacheFormatVersion), FNV1Params<64>::offset_basis);
+        hash = hashString(m_compilerVersion, hash);
+        hash = hashBytes(&*sourceHash, sizeof(uint64_t), hash);
+        hash = hashString(inputs.entry, hash);
+
+        const auto stage = static_cast<uint32_t>(inputs.stage);
+        hash = hashBytes(&stage, sizeof(stage), hash);
+
+        for (const std::wstring& define : inputs.defines)
+        {
+            hash = hashString(define, hash);
+        }
+
+        for (const std::wstring& includeDir : inputs.includeDirs)
+        {
+            hash = hashString(includeDir, hash);
+        }
+
+        const uint8_t embedDebugInfo = inputs.embedDebugInfo ? 1 : 0;
+        return hashBytes(&embedDebugInfo, sizeof(embedDebugInfo), hash);
+    }
+
+    std::optional<Shader> ShaderCompileCache::find(Key key) const
+    {
+        const fs::path entryPath = getEntryPath(key);
+        if (!fs::exists(entryPath))
+        {
+            return std::nullopt;
+        }
+
+        const std::string entryPathStr = entryPath.string();
+        io::IStreamReader::Ptr stream = io::createNativeFileStream(entryPathStr.c_str(), io::AccessMode::Read, io::OpenFileMode::OpenExisting);
+        if (!stream)
+        {
+            return std::nullopt;
+        }
+
+        auto header = io::readContainerHeader(stream);
+        if (!header)
+        {
+            return std::nullopt;
+        }
+
+        auto [headerValue, dataOffset] = *std::move(header);
+
+        CacheEntryData entryData;
+        if (!RuntimeValue::assign(makeValueRef(entryData), headerValue))
+        {
+            return std::nullopt;
+        }
+
+        for (const IncludedFileEntry& includedFile : entryData.includedFiles)
+        {
+            const std::optional<uint64_t> contentHash = hashFileContent(fs::path{std::string_view{includedFile.path.data(), includedFile.path.size()}});
+            if (!contentHash || *contentHash != includedFile.contentHash)
+            {
+                return std::nullopt;
+            }
+        }
+
+        BytesBuffer bytecode(entryData.bytecodeSize);
+        stream->setPosition(io::OffsetOrigin::Begin, static_cast<int64_t>(dataOffset));
+        auto readResult = stream->read(bytecode.data(), bytecode.size());
+        if (!readResult || *readResult != entryData.bytecodeSize)
+        {
+            return std::nullopt;
+        }
+
+        entryData.shader.bytecode = std::move(bytecode);
+
+        return std::move(entryData.shader);
+    }
+
+    Result<> ShaderCompileCache::store(Key key, const Shader& shader, const std::vector<fs::path>& includedFiles) const
+    {
+        CacheEntryData entryData;
+        entryData.shader = shader;
+        entryData.shader.bytecode = {};
+        entryData.bytecodeSize = shader.bytecode.size();
+
+        for (const fs::path& includedFile : includedFiles)
+        {
+            const std::optional<uint64_t> contentHash = hashFileContent(includedFile);
+            if (!contentHash)
+            {
+                return NauMakeError("Can not read the included file: {}", includedFile.string());
+            }
+
+            const std::string path = includedFile.string();
+            entryData.includedFiles.emplace_back(IncludedFileEntry{eastl::string{path.data(), path.size()}, *contentHash});
+        }
+
+        // The entry is written into the temporary file and then renamed:
+        // the concurrent readers (other tool instances sharing the cache) never see the partially written entry
+        const fs::path entryPath = getEntryPath(key);
+        fs::path tempPath = entryPath;
+        tempPath += std::format(".{}.tmp", std::hash<std::thread::id>{}(std::this_thread::get_id()));
+
+        {
+            const std::string tempPathStr = tempPath.string();
+            io::IStreamWriter::Ptr stream = io::createNativeFileStream(tempPathStr.c_str(), io::AccessMode::Write, io::OpenFileMode::CreateAlways);
+            if (!stream)
+            {
+                return NauMakeError("Can not create the cache entry: {}", tempPathStr);
+            }
+
+            io::writeContainerHeader(stream, CacheEntryKind, makeValueRef(entryData));
+            NauCheckResult(stream->write(shader.bytecode.data(), shader.bytecode.size()));
+        }
+
+        std::error_code error;
+        fs::rename(tempPath, entryPath, error);
+        if (error)
+        {
+            fs::remove(tempPath, error);
+            return NauMakeError("Can not store the cache entry: {}", entryPath.string());
+        }
+
+        return ResultSuccess;
+    }
+
+    fs::path ShaderCompileCache::getEntryPath(Key key) const
+    {
+        return m_cacheDir / std::format("{:016x}{}", key, CacheEntryExtension);
+    }
+}  // namespace nau
@@ -0,0 +1,57 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+#pragma once
+
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "nau/assets/shader_asset_accessor.h"
+#include "nau/utils/result.h"
+
+namespace fs = std::filesystem;
+
+namespace nau
+{
+    /**
+     * The content-addressed cache of the dxc outputs.
+     * The entry key is the hash of everything that is known before the compilation: the source text, entry point, stage, defines,
+     * include directories, debug flags and the compiler version. The included files are known only after the compilation,
+     * so the entry keeps the hashes of the files that were included and is valid only while all of them are unchanged.
+     * Each entry is stored as a separate file (<key>.nscc) inside the cache directory: the entries can be looked up and stored concurrently.
+     */
+    class ShaderCompileCache final
+    {
+    public:
+        using Key = uint64_t;
+
+        struct KeyInputs
+        {
+            const fs::path& sourceFile;
+            std::string_view entry;
+            ShaderTarget stage;
+            const std::vector<std::wstring>& defines;
+            const std::vector<std::wstring>& includeDirs;
+            bool embedDebugInfo;
+        };
+
+        ShaderCompileCache(fs::path cacheDir, std::string compilerVersion);
+
+        Result<Key> makeKey(const KeyInputs& inputs) const;
+
+        /**
+         * @return the cached compilation result or nullopt if there is no entry or any of the included files has changed.
+         */
+        std::optional<Shader> find(Key key) const;
+
+        Result<> store(Key key, const Shader& shader, const std::vector<fs::path>& includedFiles) const;
+
+    private:
+        fs::path getEntryPath(Key key) const;
+
+        const fs::path m_cacheDir;
+        const std::string m_compilerVersion;
+    };
+}  // namespace nau
@@ -98,6 +98,7 @@ namespace nau
 
             void SetUtils(IDxcUtils* utils);
             void ClearIncludedFiles();
+            const std::unordered_set<std::wstring>& GetIncludedFiles() const;
 
         private:
             std::unordered_set<std::wstring> m_includedFiles;
@@ -161,6 +162,11 @@ namespace nau
             m_includedFiles.clear();
         }
 
+        const std::unordered_set<std::wstring>& IncludeHandler::GetIncludedFiles() const
+        {
+            return m_includedFiles;
+        }
+
         Result<ShaderVariableTypeDescription> getVariableTypeDescription(ID3D12ShaderReflectionType* type)
         {
             if (!type)
@@ -244,6 +250,10 @@ namespace nau
         Result<BytesBuffer> getBytecode() const;
         Result<ShaderReflection> getReflection() const;
 
+        std::vector<fs::path> getIncludedFiles() const;
+
+        static Result<std::string> getCompilerVersion();
+
     private:
         ComPtr<IDxcBlobEncoding> m_source = nullptr;
         ComPtr<IDxcResult> m_compileResult = nullptr;
@@ -629,6 +639,54 @@ namespace nau
         return shaderReflection;
     }
 
+    std::vector<fs::path> ShaderCompilerImpl::getIncludedFiles() const
+    {
+        const auto& includedFiles = m_includeHandler.GetIncludedFiles();
+        return {includedFiles.begin(), includedFiles.end()};
+    }
+
+    Result<std::string> ShaderCompilerImpl::getCompilerVersion()
+    {
+        ComPtr<IDxcCompiler3> compiler = nullptr;
+        HRESULT result = DxcCreateInstance(CLSID_DxcCompiler, IID_PPV_ARGS(&compiler));
+        if (FAILED(result))
+        {
+            NAU_TCHAR_ERROR(result);
+        }
+
+        ComPtr<IDxcVersionInfo> versionInfo = nullptr;
+        result = compiler.As(&versionInfo);
+        if (FAILED(result))
+        {
+            NAU_TCHAR_ERROR(result);
+        }
+
+        UINT32 major = 0;
+        UINT32 minor = 0;
+        result = versionInfo->GetVersion(&major, &minor);
+        if (FAILED(result))
+        {
+            NAU_TCHAR_ERROR(result);
+        }
+
+        std::string version = std::format("{}.{}", major, minor);
+
+        // The commit info is not available for all the dxc builds
+        ComPtr<IDxcVersionInfo2> versionInfo2 = nullptr;
+        if (SUCCEEDED(compiler.As(&versionInfo2)))
+        {
+            UINT32 commitCount = 0;
+            char* commitHash = nullptr;
+            if (SUCCEEDED(versionInfo2->GetCommitInfo(&commitCount, &commitHash)))
+            {
+                version += std::format(".{}.{}", commitCount, commitHash ? commitHash : "");
+                CoTaskMemFree(commitHash);
+            }
+        }
+
+        return version;
+    }
+
     ShaderCompiler::ShaderCompiler() :
         m_pimpl(std::make_unique<ShaderCompilerImpl>())
     {
@@ -671,4 +729,14 @@ namespace nau
     {
         return m_pimpl->getReflection();
     }
+
+    std::vector<fs::path> ShaderCompiler::getIncludedFiles() const
+    {
+        return m_pimpl->getIncludedFiles();
+    }
+
+    Result<std::string> ShaderCompiler::getCompilerVersion()
+    {
+        return ShaderCompilerImpl::getCompilerVersion();
+    }
 } // namespace nau
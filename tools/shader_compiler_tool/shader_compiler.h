@@ -37,6 +37,16 @@ namespace nau
         Result<BytesBuffer> getBytecode() const;
         Result<ShaderReflection> getReflection() const;
 
+        /**
+         * The files included by the last compilation (the compilation cache dependencies).
+         */
+        std::vector<fs::path> getIncludedFiles() const;
+
+        /**
+         * The dxc version ("<major>.<minor>.<commit count>.<commit hash>"), it is part of the compilation cache key.
+         */
+        static Result<std::string> getCompilerVersion();
+
     private:
         std::unique_ptr<class ShaderCompilerImpl> m_pimpl = nullptr;
     };
@@ -37,6 +37,12 @@ constexpr auto DebugOutFullKey = "--debug-out";
 constexpr auto DebugEmbedKey = "-De";
 constexpr auto DebugEmbedFullKey = "--debug-embed";
 
+constexpr auto CompileCacheKey = "-cc";
+constexpr auto CompileCacheFullKey = "--compile-cache";
+
+constexpr auto JobsKey = "-j";
+constexpr auto JobsFullKey = "--jobs";
+
 constexpr auto Extension = ".nsbc";
 
 nau::Result<Args> parseArguments(int argc, char* argv[]);
@@ -228,6 +234,38 @@ nau::Result<Args> parseArguments(int argc, char* argv[])
                 return NauMakeError("Missing value for {}/{}", DebugOutKey, DebugOutFullKey);
             }
         }
+        else if (arg == CompileCacheKey || arg == CompileCacheFullKey)
+        {
+            if (i + 1 < argc && argv[i + 1][0] != '-')
+            {
+                args.compileCacheDir = argv[i + 1];
+                if (!fs::create_directories(args.compileCacheDir.value()) && !fs::is_directory(args.compileCacheDir.value()))
+                {
+                    return NauMakeError("This is not a directory or does not exist ({}/{}): {}\n", CompileCacheKey, CompileCacheFullKey, args.compileCacheDir->string());
+                }
+                i++;
+            }
+            else
+            {
+                return NauMakeError("Missing value for {}/{}", CompileCacheKey, CompileCacheFullKey);
+            }
+        }
+        else if (arg == JobsKey || arg == JobsFullKey)
+        {
+            if (i + 1 < argc && argv[i + 1][0] != '-')
+            {
+                const int jobsCount = std::atoi(argv[++i]);
+                if (jobsCount <= 0)
+                {
+                    return NauMakeError("Invalid value for {}/{}: {}", JobsKey, JobsFullKey, argv[i]);
+                }
+                args.jobsCount = static_cast<size_t>(jobsCount);
+            }
+            else
+            {
+                return NauMakeError("Missing value for {}/{}", JobsKey, JobsFullKey);
+            }
+        }
         else
         {
             return NauMakeError("Unknown argument: {}", arg);
@@ -261,7 +299,9 @@ void printUsage(std::string_view appName)
         "[-i <include_path1> <include_path2> ...] "
         "[-c <shader_cache_name>] "
         "[-Do <pdb_output_directory>] "
-        "[-De]\n",
+        "[-De] "
+        "[-cc <compile_cache_directory>] "
+        "[-j <jobs_count>]\n",
         fullName.filename().string());
 
     std::cout << "\nOptions:\n";
@@ -273,4 +313,6 @@ void printUsage(std::string_view appName)
     std::cout << "  -c, --cache            Name of the shader cache file to be created (optional).\n";
     std::cout << "  -Do, --debug-out       Specify directory to output PDB files for debugging (optional).\n";
     std::cout << "  -De, --debug-embed     Embed debug information into the shader bytecode (optional).\n";
+    std::cout << "  -cc, --compile-cache   Directory of the compiled shaders cache, unchanged shaders are not recompiled (optional).\n";
+    std::cout << "  -j, --jobs             Number of parallel compilations, all cores are used by default (optional).\n";
 }
@@ -55,6 +55,7 @@ namespace nau
         std::string projectPath;
         std::string assetPath;
         std::vector<std::string> filesExtensions;
+        size_t jobsCount = 0; /** < The number of the asset cook threads (0 - hardware concurrency). */
     };
 
     struct BuildProjectArguments : public CommonArguments
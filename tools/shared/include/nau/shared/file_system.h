@@ -25,6 +25,11 @@ namespace nau
 		return "database.db";
     }
 
+    SHARED_API inline const char* getAssetsCookReportName()
+    {
+        return "cook_report.json";
+    }
+
     SHARED_API std::string getShadersIncludeDir(const std::filesystem::path& shadersIn);
 
     struct FileSearchOptions
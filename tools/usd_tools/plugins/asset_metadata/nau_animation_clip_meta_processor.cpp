@@ -53,6 +53,23 @@ bool NauSkeletalAnimationClipMetaProcessor::process(PXR_NS::UsdPrim prim, nau::U
         info->source = targets[0].GetAsString();
     }
 
+    asset.GetOptimizeAttr().Get(&info->optimize);
+    asset.GetOptimizationToleranceAttr().Get(&info->optimizationTolerance);
+    asset.GetOptimizationDistanceAttr().Get(&info->optimizationDistance);
+
+    PXR_NS::VtArray<std::string> jointNames;
+    PXR_NS::VtArray<float> jointTolerances;
+    PXR_NS::VtArray<float> jointDistances;
+    asset.GetJointOverrideNamesAttr().Get(&jointNames);
+    asset.GetJointOverrideTolerancesAttr().Get(&jointTolerances);
+    asset.GetJointOverrideDistancesAttr().Get(&jointDistances);
+
+    for (size_t i = 0; i < jointNames.size() && i < jointTolerances.size(); ++i)
+    {
+        const float distance = i < jointDistances.size() ? jointDistances[i] : info->optimizationDistance;
+        info->jointOptimizations.push_back({jointNames[i], jointTolerances[i], distance});
+    }
+
     dest.type = "prim-animation-skeleton";
     dest.extraInfo = info;
     return true;
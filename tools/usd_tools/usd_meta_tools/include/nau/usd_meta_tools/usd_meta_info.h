@@ -172,9 +172,22 @@ namespace nau
     };
     EXTRA_INFO_OBJECT(ExtraInfoAnimation)
     {
+        // The keyframes reduction setting of a joint (see ozz::animation::offline::AnimationOptimizer).
+        struct JointOptimization
+        {
+            std::string jointName;
+            float tolerance = 0.001f;
+            float distance = 0.1f;
+        };
+
         std::string path;
 
         std::string source;
+
+        bool optimize = true;
+        float optimizationTolerance = 0.001f;
+        float optimizationDistance = 0.1f;
+        std::vector<JointOptimization> jointOptimizations;
     };
     EXTRA_INFO_OBJECT(ExtraInfoGltf)
     {
@@ -8,6 +8,7 @@
 #include <pxr/usd/usdSkel/bindingAPI.h>
 
 #include "nau/assets/mesh_asset_accessor.h"
+#include "nau/assets/mesh_optimizer.h"
 #include "usd_mesh_composer.h"
 
 using namespace nau;
@@ -21,8 +22,15 @@ namespace UsdTranslator
 
     public:
         UsdMeshAccessor(PXR_NS::UsdPrim prim) :
-            m_mesh(prim)
+            m_mesh(prim),
+            m_positions(m_mesh.getPositions()),
+            m_normals(m_mesh.getNormals()),
+            m_tangents(m_mesh.getTangents()),
+            m_uvs(m_mesh.getUVs()),
+            m_joints(m_mesh.getJoints()),
+            m_weights(m_mesh.getWeights())
         {
+            optimize();
         }
 
         nau::ElementFormatFlag getSupportedIndexTypes() const override
@@ -33,8 +41,8 @@ namespace UsdTranslator
         MeshDescription getDescription() const override
         {
             return {
-                .indexCount = m_mesh.getNumIndices(),
-                .vertexCount = m_mesh.getNumVertices(),
+                .indexCount = m_isOptimized ? static_cast<uint32_t>(m_optimizedMesh.indices.size()) : m_mesh.getNumIndices(),
+                .vertexCount = m_isOptimized ? static_cast<uint32_t>(m_optimizedMesh.vertexSources.size()) : m_mesh.getNumVertices(),
                 .indexFormat = ElementFormat::Uint32  // todo: NAU-1797 Add proper support for both 32 and 16 bit index geometries
             };
         }
@@ -112,44 +120,42 @@ namespace UsdTranslator
             {
                 if (outputDesc.semantic == "POSITION")
                 {
-                    auto attributeData = m_mesh.getPositions();
+                    auto attributeData = remapAttribute(m_positions);
                     NauCheckResult(check(outputDesc, AttributeType::Vec3, attributeData))
 
-                    auto data = attributeData.data();
-                    auto size = attributeData.size() * sizeof(decltype(attributeData)::value_type);
                     memcpy(outputDesc.outputBuffer, attributeData.data(), attributeData.size() * sizeof(decltype(attributeData)::value_type));
                 }
                 else if (outputDesc.semantic == "NORMAL")
                 {
-                    auto attributeData = m_mesh.getNormals();
+                    auto attributeData = remapAttribute(m_normals);
                     NauCheckResult(check(outputDesc, AttributeType::Vec3, attributeData))
 
                     memcpy(outputDesc.outputBuffer, attributeData.data(), attributeData.size() * sizeof(decltype(attributeData)::value_type));
                 }
                 else if (outputDesc.semantic == "TANGENT")
                 {
-                    auto attributeData = m_mesh.getTangents();
+                    auto attributeData = remapAttribute(m_tangents);
                     NauCheckResult(check(outputDesc, AttributeType::Vec4, attributeData))
 
                     memcpy(outputDesc.outputBuffer, attributeData.data(), attributeData.size() * sizeof(decltype(attributeData)::value_type));
                 }
                 else if (outputDesc.semantic == "TEXCOORD")
                 {
-                    auto attributeData = m_mesh.getUVs();
+                    auto attributeData = remapAttribute(m_uvs);
                     NauCheckResult(check(outputDesc, AttributeType::Vec2, attributeData))
 
                     memcpy(outputDesc.outputBuffer, attributeData.data(), attributeData.size() * sizeof(decltype(attributeData)::value_type));
                 }
                 else if (outputDesc.semantic == "JOINTS")
                 {
-                    auto attributeData = m_mesh.getJoints();
+                    auto attributeData = remapAttribute(m_joints, 4);
                     NauCheckResult(check(outputDesc, AttributeType::Vec4, attributeData))
 
                     memcpy(outputDesc.outputBuffer, attributeData.data(), attributeData.size() * sizeof(decltype(attributeData)::value_type));
                 }
                 else if (outputDesc.semantic == "WEIGHTS")
                 {
-                    auto attributeData = m_mesh.getWeights();
+                    auto attributeData = remapAttribute(m_weights, 4);
                     NauCheckResult(check(outputDesc, AttributeType::Vec4, attributeData))
 
                     memcpy(outputDesc.outputBuffer, attributeData.data(), attributeData.size() * sizeof(decltype(attributeData)::value_type));
@@ -172,7 +178,20 @@ namespace UsdTranslator
                 return NauMakeError("UsdMeshAccessor: wrong index format");
             }
 
-            auto indices = m_mesh.getIndices();
+            PXR_NS::VtArray<uint16_t> indices;
+            if (m_isOptimized)
+            {
+                indices.reserve(m_optimizedMesh.indices.size());
+                for (const uint32_t index : m_optimizedMesh.indices)
+                {
+                    indices.push_back(static_cast<uint16_t>(index));
+                }
+            }
+            else
+            {
+                indices = m_mesh.getIndices();
+            }
+
             if (outputBufferSize < indices.size() * sizeof(decltype(indices)::value_type))
             {
                 NAU_FAILURE("UsdMeshAccessor: output buffer overflow");
@@ -185,7 +204,82 @@ namespace UsdTranslator
         }
 
     private:
+        /**
+         * The composed mesh has a vertex per face corner: the equal vertices are merged
+         * and the triangles are reordered for the vertex cache, the overdraw and the vertex fetch.
+         * The attributes that do not match the composed vertices (unsupported interpolation) leave the mesh as is.
+         */
+        void optimize()
+        {
+            const size_t vertexCount = m_mesh.getNumVertices();
+            if (vertexCount == 0 || m_positions.size() != vertexCount)
+            {
+                return;
+            }
+
+            eastl::vector<MeshVertexStream> streams;
+            const auto addStream = [&](const auto& attribute, size_t componentsCount)
+            {
+                using Element = typename std::remove_reference_t<decltype(attribute)>::value_type;
+
+                if (attribute.empty())
+                {
+                    return true;
+                }
+                if (attribute.size() != vertexCount * componentsCount)
+                {
+                    return false;
+                }
+
+                streams.push_back({attribute.data(), sizeof(Element) * componentsCount, 0});
+                return true;
+            };
+
+            if (!addStream(m_positions, 1) || !addStream(m_normals, 1) || !addStream(m_tangents, 1) ||
+                !addStream(m_uvs, 1) || !addStream(m_joints, 4) || !addStream(m_weights, 4))
+            {
+                return;
+            }
+
+            const PXR_NS::VtArray<uint16_t> sourceIndices = m_mesh.getIndices();
+            eastl::vector<uint32_t> indices(sourceIndices.begin(), sourceIndices.end());
+
+            m_optimizedMesh = nau::optimizeMesh(indices, vertexCount, streams.front(), streams);
+            m_isOptimized = true;
+        }
+
+        template <typename T>
+        PXR_NS::VtArray<T> remapAttribute(const PXR_NS::VtArray<T>& attribute, size_t componentsCount = 1) const
+        {
+            if (!m_isOptimized || attribute.empty())
+            {
+                return attribute;
+            }
+
+            PXR_NS::VtArray<T> vertices;
+            vertices.reserve(m_optimizedMesh.vertexSources.size() * componentsCount);
+            for (const uint32_t source : m_optimizedMesh.vertexSources)
+            {
+                for (size_t i = 0; i < componentsCount; ++i)
+                {
+                    vertices.push_back(attribute[source * componentsCount + i]);
+                }
+            }
+
+            return vertices;
+        }
+
         MeshComposer m_mesh;
+
+        PXR_NS::VtArray<PXR_NS::GfVec3f> m_positions;
+        PXR_NS::VtArray<PXR_NS::GfVec3f> m_normals;
+        PXR_NS::VtArray<PXR_NS::GfVec4f> m_tangents;
+        PXR_NS::VtArray<PXR_NS::GfVec2f> m_uvs;
+        PXR_NS::VtIntArray m_joints;
+        PXR_NS::VtFloatArray m_weights;
+
+        OptimizedMesh m_optimizedMesh;
+        bool m_isOptimized = false;
     };
 
     UsdMeshContainer::UsdMeshContainer(PXR_NS::UsdPrim prim) :
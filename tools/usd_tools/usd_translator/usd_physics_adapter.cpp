@@ -18,6 +18,7 @@
 #include "nau/service/service_provider.h"
 #include "nau/diag/logging.h"
 #include "nau/assets/asset_db.h"
+#include "nau/physics/physics_assets.h"
 #include "nau/physics/components/rigid_body_component.h"
 #include "nau/physics/physics_body.h"
 #include "nau/physics/physics_collision_shapes_factory.h"
@@ -148,6 +149,39 @@ namespace UsdTranslator
         return nau::AssetPath(scheme.data(), toString(uuid).c_str(), "mesh/0");
     }
 
+    nau::AssetPath PhysicsRigidBodyAdapter::getCollisionMeshAsset(const PXR_NS::SdfAssetPath& sdfPath, bool convexHull)
+    {
+        const nau::AssetPath meshAsset = getMeshAsset(sdfPath);
+        if (!meshAsset)
+        {
+            return meshAsset;
+        }
+
+        // The asset tools cook the collision of each mesh next to it, prefer it over the runtime shape building.
+        auto& assetDb = nau::getServiceProvider().get<nau::IAssetDB>();
+        const eastl::string_view meshContainerPath = meshAsset.getContainerPath();
+        const auto meshUid = nau::Uid::parseString({meshContainerPath.data(), meshContainerPath.size()});
+        if (!meshUid)
+        {
+            return meshAsset;
+        }
+
+        const eastl::string meshSourcePath = assetDb.getSourcePathFromUid(*meshUid);
+        if (meshSourcePath.empty())
+        {
+            return meshAsset;
+        }
+
+        const nau::Uid cookedUid = assetDb.getUidFromSourcePath(meshSourcePath + nau::physics::CookedCollisionSourcePathSuffix.data());
+        if (!cookedUid)
+        {
+            return meshAsset;
+        }
+
+        const eastl::string_view contentPath = convexHull ? nau::physics::CookedConvexHullContentPath : nau::physics::CookedTriMeshContentPath;
+        return nau::AssetPath("uid", toString(cookedUid).c_str(), contentPath);
+    }
+
     nau::physics::IPhysicsMaterial::Ptr PhysicsRigidBodyAdapter::createMaterial(const PXR_NS::UsdPrim& prim)
     {
         // ToDo 
@@ -36,6 +36,7 @@ namespace UsdTranslator
         void preInitRigidBodyComponent(nau::physics::RigidBodyComponent& component) const;
 
         static nau::AssetPath getMeshAsset(const PXR_NS::SdfAssetPath& sdfPath);
+        static nau::AssetPath getCollisionMeshAsset(const PXR_NS::SdfAssetPath& sdfPath, bool convexHull);
         static nau::physics::IPhysicsMaterial::Ptr createMaterial(const PXR_NS::UsdPrim& prim);
 
     protected:
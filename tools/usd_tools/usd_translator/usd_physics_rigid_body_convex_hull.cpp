@@ -30,7 +30,7 @@ namespace UsdTranslator
         PXR_NS::SdfAssetPath sdfPath;
         hullBody.GetModelMeshAttr().Get(&sdfPath);
 
-        component.setMeshCollision(getMeshAsset(sdfPath));
+        component.setMeshCollision(getCollisionMeshAsset(sdfPath, true));
         component.setUseConvexHullForCollision(true);
     };
 
@@ -28,7 +28,7 @@ namespace UsdTranslator
         PXR_NS::SdfAssetPath sdfPath;
         meshBody.GetModelMeshAttr().Get(&sdfPath);
 
-        component.setMeshCollision(getMeshAsset(sdfPath));
+        component.setMeshCollision(getCollisionMeshAsset(sdfPath, false));
         component.setUseConvexHullForCollision(false);
     }
 